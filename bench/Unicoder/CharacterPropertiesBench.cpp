@@ -0,0 +1,77 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/CharacterProperties.h>
+#include <Util/Time.h>
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+const size_t codePointCount = 1 << 16;
+const size_t lookupCount = 20 * 1000 * 1000;
+
+//
+// Code points in [first, last], from a fixed linear congruential
+// generator so that every run looks up the same ones.
+//
+vector<UTF32>
+MakeCodePoints(UTF32 first, UTF32 last)
+{
+    vector<UTF32> codePoints(codePointCount);
+    uint32 state = 12345;
+    for (size_t i = 0; i < codePointCount; ++i)
+    {
+        state = state * 1103515245 + 12345;
+        codePoints[i] = first + (state >> 8) % (last - first + 1);
+    }
+    return codePoints;
+}
+
+//
+// Each lookup picks its code point from the result of the previous one,
+// so the loads cannot overlap and the time is the latency of a lookup.
+//
+void
+Run(const char* name, const vector<UTF32>& codePoints)
+{
+    const size_t mask = codePoints.size() - 1;
+    size_t position = 0;
+    Time start = Time::Now(Time::Monotonic);
+    for (size_t i = 0; i < lookupCount; ++i)
+    {
+        position = (position + 1 + GetGeneralCategory(codePoints[position])) & mask;
+    }
+    Time elapsed = Time::Now(Time::Monotonic) - start;
+
+    cout << setw(8) << left << name << fixed << setprecision(2) << setw(8) << right
+         << elapsed.ToMicroSecondsDouble() * 1000 / lookupCount << " ns/lookup"
+         << " (" << position << ")" << endl;
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "table size: " << CharacterPropertiesTableSize() << " bytes" << endl;
+
+    Run("ASCII", MakeCodePoints(0, 0x7F));
+    Run("BMP", MakeCodePoints(0, 0xFFFF));
+    Run("all", MakeCodePoints(0, 0x10FFFF));
+
+    return EXIT_SUCCESS;
+}
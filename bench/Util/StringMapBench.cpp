@@ -0,0 +1,201 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/StringMap.h>
+#include <Util/Time.h>
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+
+#if defined(LANG_CPP11) || defined(_WIN32)
+#    include <unordered_map>
+#else
+#    include <tr1/unordered_map>
+#endif
+
+#if !defined(LANG_CPP11)
+namespace std {
+    using tr1::unordered_map;
+}
+#endif
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const size_t keyCount = 200 * 1000;
+const int rounds = 5;
+
+typedef unordered_map<string, uint32> StdMap;
+
+//
+// Identifiers of 4 to 35 characters, from a fixed linear congruential
+// generator so that every run uses the same ones.
+//
+vector<string>
+MakeKeys(size_t count, uint32 seed)
+{
+    static const char alphabet[] = "abcdefghijklmnopqrstuvwxyz_0123456789";
+    vector<string> keys;
+    keys.reserve(count);
+    uint32 state = seed;
+    for (size_t i = 0; i < count; ++i)
+    {
+        state = state * 1103515245 + 12345;
+        string key(4 + (state >> 16) % 32, ' ');
+        for (size_t j = 0; j < key.size(); ++j)
+        {
+            state = state * 1103515245 + 12345;
+            key[j] = alphabet[(state >> 16) % (sizeof(alphabet) - 1)];
+        }
+        key += static_cast<char>('A' + i % 26);
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+void
+Insert(StringMap<uint32>& map, const vector<string>& keys)
+{
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        map.Insert(keys[i], static_cast<uint32>(i));
+    }
+}
+
+void
+Insert(StringPool& pool, const vector<string>& keys)
+{
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        pool.Intern(keys[i]);
+    }
+}
+
+void
+Insert(StdMap& map, const vector<string>& keys)
+{
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        map.insert(make_pair(keys[i], static_cast<uint32>(i)));
+    }
+}
+
+size_t
+Find(const StringMap<uint32>& map, const vector<string>& keys)
+{
+    size_t found = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        found += map.Find(keys[i]) != 0 ? 1 : 0;
+    }
+    return found;
+}
+
+size_t
+Find(const StringPool& pool, const vector<string>& keys)
+{
+    size_t found = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        found += pool.Find(keys[i]) != StringPool::invalidId ? 1 : 0;
+    }
+    return found;
+}
+
+size_t
+Find(const StdMap& map, const vector<string>& keys)
+{
+    size_t found = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        found += map.find(keys[i]) != map.end() ? 1 : 0;
+    }
+    return found;
+}
+
+void
+Report(const char* name, const char* operation, Time elapsed, size_t operations)
+{
+    cout << setw(20) << left << name << setw(12) << operation << fixed << setprecision(1) << setw(8) << right
+         << elapsed.ToMicroSecondsDouble() * 1000 / operations << " ns/op" << endl;
+}
+
+//
+// Inserts all keys in a new container, then looks up the keys in another
+// order (all hits) and keys that are not there (all misses).
+//
+template <typename Container>
+void
+Run(const char* name, const vector<string>& keys, const vector<string>& hits, const vector<string>& misses)
+{
+    Time elapsed;
+    for (int round = 0; round < rounds; ++round)
+    {
+        Container container;
+        Time start = Time::Now(Time::Monotonic);
+        Insert(container, keys);
+        elapsed += Time::Now(Time::Monotonic) - start;
+    }
+    Report(name, "insert", elapsed, rounds * keys.size());
+
+    Container container;
+    Insert(container, keys);
+    size_t found = 0;
+
+    Time start = Time::Now(Time::Monotonic);
+    for (int round = 0; round < rounds; ++round)
+    {
+        found += Find(container, hits);
+    }
+    Report(name, "find-hit", Time::Now(Time::Monotonic) - start, rounds * hits.size());
+
+    start = Time::Now(Time::Monotonic);
+    for (int round = 0; round < rounds; ++round)
+    {
+        found += Find(container, misses);
+    }
+    Report(name, "find-miss", Time::Now(Time::Monotonic) - start, rounds * misses.size());
+
+    if (found != rounds * hits.size())
+    {
+        cerr << name << ": found " << found << " keys instead of " << rounds * hits.size() << endl;
+        exit(EXIT_FAILURE);
+    }
+}
+
+}
+
+int
+main(int, char*[])
+{
+    //
+    // Keys end with a letter cycling through the alphabet, those of the
+    // misses with a digit, so that no miss is a key.
+    //
+    vector<string> keys = MakeKeys(keyCount, 1);
+    vector<string> hits(keyCount);
+    for (size_t i = 0; i < keyCount; ++i)
+    {
+        hits[i] = keys[i * 7919 % keyCount];   // 7919 is prime, so all keys are visited
+    }
+    vector<string> misses = MakeKeys(keyCount, 2);
+    for (size_t i = 0; i < misses.size(); ++i)
+    {
+        misses[i][misses[i].size() - 1] = static_cast<char>('0' + i % 10);
+    }
+
+    Run<StringMap<uint32> >("StringMap", keys, hits, misses);
+    Run<StringPool>("StringPool", keys, hits, misses);
+    Run<StdMap>("std::unordered_map", keys, hits, misses);
+
+    return EXIT_SUCCESS;
+}
@@ -135,6 +135,26 @@
 #error Please add support for your architecture in build/build_config.h
 #endif
 
+//
+// SIMD instruction set detection. Only what the compiler is allowed to
+// emit unconditionally is reported here (e.g. -msse4.2 / -mavx2 or /arch).
+//
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    define ARCH_CPU_SSE2 1
+#endif
+#if defined(__SSSE3__) || defined(__AVX__)
+#    define ARCH_CPU_SSSE3 1
+#endif
+#if defined(__SSE4_2__) || defined(__AVX__)
+#    define ARCH_CPU_SSE42 1
+#endif
+#if defined(__AVX2__)
+#    define ARCH_CPU_AVX2 1
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    define ARCH_CPU_NEON 1
+#endif
+
 //
 // Type detection for wchar_t.
 //
@@ -0,0 +1,77 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_CASE_MAPPING_H
+#define UTIL_CASE_MAPPING_H
+
+#include <Unicoder/Unicode.h>
+#include <Unicoder/ConvertUTF.h>
+
+#include <string>
+
+namespace Util
+{
+
+//
+// Language specific case mapping rules. turkicCaseMapping applies the
+// Turkish and Azerbaijani rules for dotted and dotless i (I <-> U+0131,
+// U+0130 <-> i), everything else follows the default rules.
+//
+enum CaseMappingLocale
+{
+    defaultCaseMapping,
+    turkicCaseMapping
+};
+
+//
+// Full Unicode case mapping and case folding of UTF-8 strings, including
+// the mappings that change the length of a string (e.g. U+00DF "sharp s"
+// uppercases to "SS") and the Final_Sigma rule of ToLowerCase. They are
+// not locale dependent except for the explicit CaseMappingLocale.
+//
+// Runs of ASCII are converted with SIMD instructions, other characters go
+// through a two-stage table lookup. Bytes that are not part of well-formed
+// UTF-8 are copied unchanged.
+//
+UTIL_API std::string ToLowerCase(const std::string& utf8, CaseMappingLocale = defaultCaseMapping);
+UTIL_API std::string ToUpperCase(const std::string& utf8, CaseMappingLocale = defaultCaseMapping);
+UTIL_API std::string FoldCase(const std::string& utf8, CaseMappingLocale = defaultCaseMapping);
+
+//
+// The full case folding of a single code point: writes at most three code
+// points to target and returns how many.
+//
+UTIL_API int FoldCase(UtilInternal::UTF32 cp, UtilInternal::UTF32* target, CaseMappingLocale = defaultCaseMapping);
+
+//
+// Caseless comparison of UTF-8 strings: the code points of the full case
+// folding of both strings are compared, without building the folded
+// strings. Returns < 0, 0 or > 0 like strcmp. Canonically equivalent but
+// differently normalized strings are not equal, normalize them first if
+// that matters.
+//
+UTIL_API int CompareCaseInsensitive(const char* lhsFirst, const char* lhsLast,
+                                    const char* rhsFirst, const char* rhsLast,
+                                    CaseMappingLocale = defaultCaseMapping);
+UTIL_API int CompareCaseInsensitive(const std::string& lhs, const std::string& rhs,
+                                    CaseMappingLocale = defaultCaseMapping);
+UTIL_API bool EqualsCaseInsensitive(const std::string& lhs, const std::string& rhs,
+                                    CaseMappingLocale = defaultCaseMapping);
+
+//
+// Hash of the case folded string, computed without building it: strings
+// that are EqualsCaseInsensitive have the same hash.
+//
+UTIL_API unsigned long HashCaseInsensitive(const char* first, const char* last,
+                                           CaseMappingLocale = defaultCaseMapping);
+UTIL_API unsigned long HashCaseInsensitive(const std::string& utf8,
+                                           CaseMappingLocale = defaultCaseMapping);
+
+}
+
+#endif
@@ -0,0 +1,2545 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+//
+// Generated by MakeUnicodeTables.pl from the Unicode Character Database
+// 14.0.0 - do not edit.
+//
+
+#ifndef UTIL_CHARACTER_DATA_H
+#define UTIL_CHARACTER_DATA_H
+
+#include <Util/Config.h>
+#include <Unicoder/ConvertUTF.h>
+
+namespace UtilInternal
+{
+
+//
+// Every per code point property of the Unicoder module, stored once per
+// distinct combination in CharacterTables::records. The record of a code
+// point is found in three stages:
+//
+//     block(cp)  = index2[index1[cp >> characterIndexShift] + ((cp >> characterDataShift) & characterIndexMask)]
+//     record(cp) = records[data[block(cp) + (cp & characterDataMask)]]
+//
+// Code points at or above characterLimit use record 0. A record holds:
+//
+//     bits 0-4    General_Category, in the order of the GeneralCategory enum
+//     bits 5-8    Lowercase, Uppercase, Cased and Case_Ignorable
+//     bits 9-16   Script, an index in scriptCodes
+//     bits 17-30  the normalization properties (NormalizationData.h), the
+//                 canonical combining class in bits 17-24
+//     bits 31-40  the segmentation properties (SegmentationData.h)
+//     bits 41-43  the width (WidthData.h)
+//     bits 44-55  the case mappings, an index in caseRecords (CaseData.h)
+//
+// Included by CharacterProperties.h, which has the lookup.
+//
+const int characterDataShift = 4;
+const int characterIndexShift = 10;
+const UTF32 characterDataMask = 15;
+const UTF32 characterIndexMask = 63;
+const UTF32 characterLimit = 1114112;
+
+const uint64 characterCategoryMask = 0x1F;
+const uint64 characterLowercase = 0x20;
+const uint64 characterUppercase = 0x40;
+const uint64 characterCased = 0x80;
+const uint64 characterCaseIgnorable = 0x100;
+const int characterScriptShift = 9;
+const uint64 characterScriptMask = 0xFF;
+const int characterCombiningClassShift = 17;
+const uint64 characterCombiningClassMask = 0xFF;
+const int characterNormalizationShift = 17;
+const uint64 characterNormalizationMask = 0x3FFF;
+const int characterSegmentationShift = 31;
+const uint64 characterSegmentationMask = 0x3FF;
+const int characterWidthShift = 41;
+const uint64 characterWidthMask = 0x7;
+const int characterCaseMappingShift = 44;
+const uint64 characterCaseMappingMask = 0xFFF;
+
+//
+// The tables are static members of a class template so that they can be
+// defined in this header, for the lookups to be inline (and constexpr with
+// C++11), and still be stored once in a program.
+//
+template <typename T>
+struct CharacterTables
+{
+    static const char* const categoryNames[30];
+    static const char* const scriptCodes[162];
+    static const uint16 index1[1088];
+    static const uint16 index2[5056];
+    static const uint16 data[18848];
+    static const uint64 records[1299];
+};
+
+template <typename T>
+UTIL_CONSTEXPR const char* const CharacterTables<T>::categoryNames[30] =
+{
+    "Cn", "Lu", "Ll", "Lt", "Lm", "Lo", "Mn", "Mc", "Me", "Nd",
+    "Nl", "No", "Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po", "Sm",
+    "Sc", "Sk", "So", "Zs", "Zl", "Zp", "Cc", "Cf", "Cs", "Co"
+};
+
+template <typename T>
+UTIL_CONSTEXPR const char* const CharacterTables<T>::scriptCodes[162] =
+{
+    "Zzzz", "Adlm", "Ahom", "Hluw", "Arab", "Armn", "Avst", "Bali", "Bamu", "Bass",
+    "Batk", "Beng", "Bhks", "Bopo", "Brah", "Brai", "Bugi", "Buhd", "Cans", "Cari",
+    "Aghb", "Cakm", "Cham", "Cher", "Chrs", "Zyyy", "Copt", "Xsux", "Cprt", "Cpmn",
+    "Cyrl", "Dsrt", "Deva", "Diak", "Dogr", "Dupl", "Egyp", "Elba", "Elym", "Ethi",
+    "Geor", "Glag", "Goth", "Gran", "Grek", "Gujr", "Gong", "Guru", "Hani", "Hang",
+    "Rohg", "Hano", "Hatr", "Hebr", "Hira", "Armi", "Zinh", "Phli", "Prti", "Java",
+    "Kthi", "Knda", "Kana", "Kali", "Khar", "Kits", "Khmr", "Khoj", "Sind", "Laoo",
+    "Latn", "Lepc", "Limb", "Lina", "Linb", "Lisu", "Lyci", "Lydi", "Mahj", "Maka",
+    "Mlym", "Mand", "Mani", "Marc", "Gonm", "Medf", "Mtei", "Mend", "Merc", "Mero",
+    "Plrd", "Modi", "Mong", "Mroo", "Mult", "Mymr", "Nbat", "Nand", "Talu", "Newa",
+    "Nkoo", "Nshu", "Hmnp", "Ogam", "Olck", "Hung", "Ital", "Narb", "Perm", "Xpeo",
+    "Sogo", "Sarb", "Orkh", "Ougr", "Orya", "Osge", "Osma", "Hmng", "Palm", "Pauc",
+    "Phag", "Phnx", "Phlp", "Rjng", "Runr", "Samr", "Saur", "Shrd", "Shaw", "Sidd",
+    "Sgnw", "Sinh", "Sogd", "Sora", "Soyo", "Sund", "Sylo", "Syrc", "Tglg", "Tagb",
+    "Tale", "Lana", "Tavt", "Takr", "Taml", "Tnsa", "Tang", "Telu", "Thaa", "Thai",
+    "Tibt", "Tfng", "Tirh", "Toto", "Ugar", "Vaii", "Vith", "Wcho", "Wara", "Yezi",
+    "Yiii", "Zanb"
+};
+
+template <typename T>
+UTIL_CONSTEXPR const uint16 CharacterTables<T>::index1[1088] =
+{
+    0x0000, 0x0040, 0x0080, 0x00C0, 0x0100, 0x0140, 0x0180, 0x01C0, 0x0200, 0x0240, 0x0280, 0x02C0,
+    0x0300, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0380, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x03C0, 0x0400, 0x0440, 0x0480, 0x04C0, 0x0500, 0x0540, 0x0580,
+    0x05C0, 0x0600, 0x0480, 0x04C0, 0x0500, 0x0640, 0x0680, 0x0680, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x0700, 0x0740, 0x0780, 0x07C0, 0x0800, 0x0840, 0x0880, 0x08C0, 0x0900, 0x0940,
+    0x0980, 0x09C0, 0x0A00, 0x0A40, 0x0A80, 0x0AC0, 0x0A00, 0x0A00, 0x0A00, 0x0B00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0B40, 0x0B80, 0x0BC0, 0x0BC0, 0x0BC0, 0x0BC0,
+    0x0BC0, 0x0C00, 0x0C40, 0x0C80, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0CC0,
+    0x0D00, 0x0A00, 0x0A00, 0x0D40, 0x0A00, 0x0A00, 0x0A00, 0x0D80, 0x0DC0, 0x0E00, 0x0E40, 0x0E80,
+    0x0EC0, 0x0F00, 0x0F40, 0x0F80, 0x0FC0, 0x1000, 0x1040, 0x1080, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340,
+    0x0340, 0x10C0, 0x0340, 0x0340, 0x0340, 0x1100, 0x1140, 0x0340, 0x0340, 0x0340, 0x0340, 0x1180,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x0340, 0x11C0, 0x1200, 0x1200, 0x1200, 0x1240, 0x1280,
+    0x0340, 0x0340, 0x0340, 0x0340, 0x12C0, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200,
+    0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200,
+    0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200,
+    0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200,
+    0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200, 0x1200,
+    0x1200, 0x1200, 0x1200, 0x1280, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x1300, 0x1340, 0x1340, 0x1340,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00, 0x0A00,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x1380, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0,
+    0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x06C0, 0x1380
+};
+
+template <typename T>
+UTIL_CONSTEXPR const uint16 CharacterTables<T>::index2[5056] =
+{
+    0x0000, 0x0010, 0x0020, 0x0030, 0x0040, 0x0050, 0x0060, 0x0070, 0x0080, 0x0010, 0x0090, 0x00A0,
+    0x00B0, 0x00C0, 0x00D0, 0x00E0, 0x00F0, 0x0100, 0x0110, 0x0120, 0x0130, 0x0140, 0x0110, 0x0150,
+    0x0160, 0x0170, 0x0180, 0x0190, 0x01A0, 0x01B0, 0x01C0, 0x01D0, 0x00F0, 0x01E0, 0x01F0, 0x0200,
+    0x0210, 0x0220, 0x0230, 0x0240, 0x0250, 0x0260, 0x0270, 0x0280, 0x0290, 0x02A0, 0x02B0, 0x02C0,
+    0x02D0, 0x02E0, 0x02F0, 0x0300, 0x0310, 0x0320, 0x0330, 0x0340, 0x0350, 0x0360, 0x0370, 0x0380,
+    0x0390, 0x03A0, 0x03B0, 0x03C0, 0x03D0, 0x03E0, 0x03F0, 0x0400, 0x0410, 0x0420, 0x0430, 0x0440,
+    0x0450, 0x0430, 0x0430, 0x0430, 0x0460, 0x0470, 0x0480, 0x0490, 0x0430, 0x0430, 0x0430, 0x04A0,
+    0x04B0, 0x04C0, 0x04D0, 0x04E0, 0x04F0, 0x0500, 0x0510, 0x0520, 0x0530, 0x0540, 0x0550, 0x0560,
+    0x0570, 0x0580, 0x0590, 0x05A0, 0x05B0, 0x05C0, 0x05D0, 0x05E0, 0x05A0, 0x05A0, 0x05A0, 0x05A0,
+    0x05F0, 0x0600, 0x0610, 0x0620, 0x0630, 0x0640, 0x0650, 0x0660, 0x0670, 0x05A0, 0x05A0, 0x05A0,
+    0x0680, 0x0680, 0x0690, 0x06A0, 0x06B0, 0x06C0, 0x06D0, 0x06E0, 0x06F0, 0x0700, 0x0710, 0x0720,
+    0x0730, 0x0740, 0x0750, 0x05A0, 0x0760, 0x0770, 0x05A0, 0x05A0, 0x0780, 0x0790, 0x07A0, 0x07B0,
+    0x07C0, 0x07D0, 0x07E0, 0x07F0, 0x0800, 0x0810, 0x0820, 0x0830, 0x0840, 0x0850, 0x0860, 0x0870,
+    0x0880, 0x0890, 0x08A0, 0x08B0, 0x08C0, 0x08D0, 0x08E0, 0x08F0, 0x0900, 0x0910, 0x0920, 0x0930,
+    0x0940, 0x0950, 0x0960, 0x0970, 0x0980, 0x0990, 0x09A0, 0x09B0, 0x09C0, 0x09D0, 0x09E0, 0x09F0,
+    0x0A00, 0x0A10, 0x0A20, 0x0A30, 0x0A40, 0x0A50, 0x0A60, 0x0A70, 0x0A80, 0x0A90, 0x0AA0, 0x0AB0,
+    0x0AC0, 0x0AD0, 0x0AE0, 0x0AF0, 0x0B00, 0x0B10, 0x0B20, 0x0B30, 0x0B40, 0x0B50, 0x0B60, 0x0B70,
+    0x0B80, 0x0B90, 0x0BA0, 0x0BB0, 0x0BC0, 0x0BD0, 0x0BE0, 0x0BF0, 0x0C00, 0x0C10, 0x0C20, 0x0C30,
+    0x0C40, 0x0C50, 0x0C60, 0x0C70, 0x0C80, 0x0C90, 0x0CA0, 0x0CB0, 0x0CC0, 0x0CD0, 0x0CD0, 0x0CE0,
+    0x0CF0, 0x0D00, 0x0D10, 0x0D10, 0x0D20, 0x0D30, 0x0D40, 0x0D50, 0x0D60, 0x0D70, 0x0D10, 0x0D10,
+    0x0D80, 0x0D90, 0x0DA0, 0x0DB0, 0x0DC0, 0x0DD0, 0x0DE0, 0x0DF0, 0x0E00, 0x0E10, 0x0E20, 0x0E30,
+    0x0E40, 0x0E50, 0x0D10, 0x0D10, 0x0E60, 0x0E60, 0x0E70, 0x0E80, 0x0E90, 0x0EA0, 0x0EB0, 0x0EC0,
+    0x0ED0, 0x0EE0, 0x0EF0, 0x0EF0, 0x0F00, 0x0F10, 0x0F10, 0x0F20, 0x0F30, 0x0F30, 0x0F30, 0x0F30,
+    0x0F30, 0x0F30, 0x0F40, 0x0F50, 0x0F60, 0x0F60, 0x0F70, 0x0F80, 0x0F90, 0x0FA0, 0x0FA0, 0x0FA0,
+    0x0FB0, 0x0FB0, 0x0FB0, 0x0FB0, 0x0FC0, 0x0FD0, 0x0FB0, 0x0FB0, 0x0FC0, 0x0FB0, 0x0FB0, 0x0FE0,
+    0x0FF0, 0x1000, 0x0FB0, 0x0FB0, 0x0FB0, 0x0FF0, 0x0FB0, 0x0FB0, 0x0FB0, 0x1010, 0x1020, 0x1030,
+    0x0FB0, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1070, 0x1080, 0x1080, 0x1080,
+    0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+    0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080,
+    0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1080, 0x1090, 0x1080,
+    0x10A0, 0x10B0, 0x10C0, 0x10C0, 0x10C0, 0x10C0, 0x10D0, 0x10E0, 0x10F0, 0x1100, 0x1110, 0x1120,
+    0x1130, 0x1140, 0x1150, 0x1160, 0x1170, 0x1170, 0x1170, 0x1180, 0x1190, 0x11A0, 0x11B0, 0x11C0,
+    0x11D0, 0x11E0, 0x11F0, 0x11F0, 0x1200, 0x11F0, 0x11F0, 0x1210, 0x1220, 0x11F0, 0x1230, 0x1080,
+    0x1080, 0x1080, 0x1080, 0x1240, 0x1250, 0x1260, 0x1270, 0x1280, 0x1290, 0x12A0, 0x12B0, 0x12C0,
+    0x12D0, 0x12D0, 0x12E0, 0x12D0, 0x12F0, 0x1300, 0x1310, 0x1310, 0x1320, 0x1330, 0x1340, 0x1340,
+    0x1340, 0x1350, 0x1360, 0x1370, 0x1380, 0x1380, 0x1390, 0x13A0, 0x13B0, 0x0D10, 0x0D10, 0x0D10,
+    0x13C0, 0x13D0, 0x13E0, 0x13F0, 0x1400, 0x1410, 0x1420, 0x1430, 0x1440, 0x1450, 0x1460, 0x1470,
+    0x1480, 0x1480, 0x1490, 0x14A0, 0x14B0, 0x14B0, 0x14C0, 0x14D0, 0x14E0, 0x14F0, 0x1500, 0x1510,
+    0x1520, 0x1530, 0x1530, 0x1540, 0x1550, 0x1560, 0x1570, 0x1580, 0x0270, 0x0270, 0x1590, 0x15A0,
+    0x15B0, 0x15C0, 0x15D0, 0x15E0, 0x15F0, 0x1600, 0x1610, 0x1620, 0x1630, 0x1640, 0x1650, 0x1660,
+    0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x00F0, 0x1670, 0x00F0, 0x00F0,
+    0x00F0, 0x00F0, 0x00F0, 0x1680, 0x1690, 0x16A0, 0x1690, 0x1690, 0x16A0, 0x16B0, 0x1690, 0x16C0,
+    0x16D0, 0x16E0, 0x16F0, 0x1700, 0x1710, 0x1720, 0x1730, 0x1740, 0x1750, 0x1760, 0x1770, 0x1780,
+    0x1790, 0x17A0, 0x17B0, 0x17C0, 0x17D0, 0x17E0, 0x17F0, 0x1800, 0x1810, 0x1820, 0x1830, 0x1840,
+    0x1850, 0x1860, 0x1870, 0x1880, 0x1890, 0x18A0, 0x18B0, 0x18C0, 0x18D0, 0x18E0, 0x18F0, 0x1900,
+    0x1910, 0x1920, 0x1900, 0x1930, 0x1940, 0x1950, 0x1960, 0x1970, 0x1980, 0x1950, 0x1990, 0x19A0,
+    0x19A0, 0x1950, 0x19B0, 0x1950, 0x1950, 0x1950, 0x19C0, 0x1950, 0x19D0, 0x19E0, 0x19F0, 0x1900,
+    0x1900, 0x1900, 0x1900, 0x1A00, 0x1A10, 0x1A20, 0x1950, 0x1A30, 0x1A40, 0x1A50, 0x1A60, 0x1A70,
+    0x1900, 0x1900, 0x1A80, 0x0D10, 0x1A90, 0x0D10, 0x18A0, 0x18A0, 0x18A0, 0x1AA0, 0x1AB0, 0x1AC0,
+    0x1AD0, 0x1AE0, 0x1AF0, 0x1B00, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900,
+    0x1900, 0x1900, 0x1B10, 0x1B20, 0x1B30, 0x1900, 0x1900, 0x1B40, 0x1B50, 0x1B60, 0x1B70, 0x1B80,
+    0x1B90, 0x1BA0, 0x1BB0, 0x1BC0, 0x1BD0, 0x1BE0, 0x1BF0, 0x1C00, 0x1C10, 0x1C20, 0x1C30, 0x1C40,
+    0x1C50, 0x1C60, 0x1C70, 0x1C80, 0x1C90, 0x1CA0, 0x1CB0, 0x1CC0, 0x1B00, 0x1CD0, 0x1CE0, 0x1CF0,
+    0x1D00, 0x1950, 0x1D10, 0x1950, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20,
+    0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1D20, 0x1950, 0x1950, 0x1950, 0x1D30,
+    0x1950, 0x1950, 0x1950, 0x1950, 0x1D40, 0x1D50, 0x1950, 0x1950, 0x1950, 0x1D60, 0x1950, 0x1D70,
+    0x1D80, 0x1950, 0x1950, 0x1950, 0x1950, 0x1950, 0x1950, 0x1D90, 0x1950, 0x1950, 0x1950, 0x1950,
+    0x1950, 0x1DA0, 0x1950, 0x1950, 0x1DB0, 0x1DC0, 0x1900, 0x1950, 0x1DD0, 0x1DE0, 0x1900, 0x1DF0,
+    0x1900, 0x1E00, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1E10, 0x1E10, 0x1E10, 0x1E20,
+    0x1E20, 0x1E20, 0x1E30, 0x1E40, 0x1E50, 0x1E50, 0x1E50, 0x1E50, 0x1E50, 0x1E50, 0x1E60, 0x1E70,
+    0x1E80, 0x1E80, 0x1E90, 0x1EA0, 0x1EA0, 0x1EA0, 0x1EB0, 0x1EC0, 0x0FB0, 0x1ED0, 0x1EE0, 0x1EE0,
+    0x1EE0, 0x1EE0, 0x1EF0, 0x1EF0, 0x1F00, 0x1F10, 0x1F20, 0x1F30, 0x1F40, 0x1F50, 0x0D10, 0x0D10,
+    0x1F60, 0x1F70, 0x1F60, 0x1F60, 0x1F60, 0x1F60, 0x1F60, 0x1F80, 0x1F90, 0x1F90, 0x1F90, 0x1F90,
+    0x1F90, 0x1F90, 0x1F90, 0x1F90, 0x1F90, 0x1F90, 0x1F90, 0x1F90, 0x1F90, 0x1FA0, 0x0D10, 0x1FB0,
+    0x1FC0, 0x1FD0, 0x1FE0, 0x1FF0, 0x2000, 0x2010, 0x2020, 0x2030, 0x2040, 0x2050, 0x2060, 0x2070,
+    0x2080, 0x2090, 0x20A0, 0x20B0, 0x20C0, 0x20D0, 0x20D0, 0x20E0, 0x20F0, 0x20F0, 0x20F0, 0x20F0,
+    0x2100, 0x2110, 0x20D0, 0x20D0, 0x2120, 0x2120, 0x2130, 0x20A0, 0x2140, 0x2150, 0x2160, 0x2170,
+    0x2180, 0x2190, 0x2140, 0x21A0, 0x2160, 0x21B0, 0x2170, 0x2190, 0x2170, 0x21C0, 0x21C0, 0x21D0,
+    0x21C0, 0x21C0, 0x21C0, 0x21C0, 0x21C0, 0x21E0, 0x2170, 0x2170, 0x2170, 0x2170, 0x2170, 0x2170,
+    0x2170, 0x2170, 0x2170, 0x2170, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x1900, 0x1900, 0x1900, 0x1900, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x2200, 0x2210, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+    0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+    0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+    0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+    0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+    0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200, 0x2200,
+    0x2220, 0x2230, 0x2230, 0x2230, 0x2240, 0x2250, 0x2250, 0x2260, 0x2270, 0x2270, 0x2270, 0x2270,
+    0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270, 0x2270,
+    0x2280, 0x2270, 0x2290, 0x0D10, 0x0430, 0x0430, 0x22A0, 0x22B0, 0x0430, 0x22C0, 0x22D0, 0x22D0,
+    0x22D0, 0x22D0, 0x22E0, 0x22F0, 0x2300, 0x2310, 0x2320, 0x2330, 0x2340, 0x2340, 0x2340, 0x2350,
+    0x2360, 0x2370, 0x2380, 0x2390, 0x23A0, 0x23B0, 0x0D10, 0x23C0, 0x23D0, 0x23E0, 0x23F0, 0x2400,
+    0x2410, 0x2410, 0x2410, 0x2420, 0x2430, 0x2440, 0x2440, 0x2450, 0x2460, 0x2470, 0x2480, 0x2490,
+    0x24A0, 0x24B0, 0x24C0, 0x24D0, 0x24E0, 0x24F0, 0x0F30, 0x2500, 0x2510, 0x2520, 0x2520, 0x2530,
+    0x2540, 0x2550, 0x2560, 0x2570, 0x2580, 0x2580, 0x2590, 0x25A0, 0x25B0, 0x25C0, 0x0E60, 0x25D0,
+    0x25E0, 0x25E0, 0x25E0, 0x25F0, 0x2600, 0x2610, 0x2620, 0x2630, 0x2640, 0x2650, 0x1EE0, 0x0270,
+    0x0270, 0x2660, 0x2670, 0x2680, 0x2680, 0x2680, 0x2680, 0x2680, 0x2690, 0x2690, 0x26A0, 0x26B0,
+    0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0,
+    0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0,
+    0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0,
+    0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700,
+    0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0,
+    0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0,
+    0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0,
+    0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0,
+    0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0,
+    0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0,
+    0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700,
+    0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0,
+    0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0,
+    0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0,
+    0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0,
+    0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0,
+    0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0,
+    0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700,
+    0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0,
+    0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0,
+    0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0,
+    0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0,
+    0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0,
+    0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0,
+    0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700,
+    0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0,
+    0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0,
+    0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0,
+    0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0,
+    0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0,
+    0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0,
+    0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700,
+    0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0,
+    0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0,
+    0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0,
+    0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0,
+    0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0,
+    0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0,
+    0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0,
+    0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0,
+    0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0,
+    0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0, 0x26F0, 0x26E0, 0x2700, 0x26E0, 0x26C0, 0x26D0, 0x26E0,
+    0x26F0, 0x26E0, 0x2710, 0x0F60, 0x2720, 0x0FA0, 0x0FA0, 0x2730, 0x2740, 0x2740, 0x2740, 0x2740,
+    0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740,
+    0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740,
+    0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740,
+    0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740,
+    0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740, 0x2740,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2760, 0x2760, 0x2760, 0x2760,
+    0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760,
+    0x2770, 0x2780, 0x2790, 0x2760, 0x2760, 0x2760, 0x27A0, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760,
+    0x2760, 0x27B0, 0x27C0, 0x27C0, 0x27D0, 0x27E0, 0x27F0, 0x2800, 0x2810, 0x2820, 0x2820, 0x2820,
+    0x2820, 0x2820, 0x2820, 0x2830, 0x2840, 0x2850, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820,
+    0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820,
+    0x2820, 0x2820, 0x2820, 0x2860, 0x2870, 0x2820, 0x2820, 0x2820, 0x2820, 0x2880, 0x2820, 0x2820,
+    0x2890, 0x0D10, 0x0D10, 0x28A0, 0x28B0, 0x28C0, 0x28D0, 0x28E0, 0x28F0, 0x2900, 0x2910, 0x2920,
+    0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2820, 0x2930, 0x2940, 0x2950, 0x2960, 0x2970,
+    0x2980, 0x2990, 0x29A0, 0x29B0, 0x29C0, 0x29D0, 0x29E0, 0x29F0, 0x2A00, 0x2A10, 0x2A20, 0x2A30,
+    0x2A40, 0x2A50, 0x2A60, 0x2A70, 0x2A80, 0x2A80, 0x0D10, 0x0D10, 0x2A50, 0x2A50, 0x2A50, 0x2A50,
+    0x2A50, 0x2A50, 0x2A50, 0x2A90, 0x2AA0, 0x1B00, 0x1B00, 0x2AB0, 0x2AC0, 0x2AC0, 0x2AC0, 0x2AD0,
+    0x2AE0, 0x2AF0, 0x2B00, 0x0D10, 0x0D10, 0x1900, 0x1900, 0x2B10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x2B20, 0x2B30, 0x2B40, 0x2B40, 0x2B40, 0x2B50, 0x2B60, 0x2B70,
+    0x2B80, 0x2B80, 0x2B90, 0x2BA0, 0x2BB0, 0x2BC0, 0x2BC0, 0x2BD0, 0x2BE0, 0x2BF0, 0x2C00, 0x2C00,
+    0x2C10, 0x2C20, 0x0D10, 0x0D10, 0x2C30, 0x2C30, 0x2C40, 0x2C50, 0x2C50, 0x2C60, 0x2C60, 0x2C60,
+    0x2C70, 0x2C80, 0x2C90, 0x2CA0, 0x2CA0, 0x2CB0, 0x2CC0, 0x2CD0, 0x2CE0, 0x2CE0, 0x2CF0, 0x2D00,
+    0x2D00, 0x2D00, 0x2D10, 0x2D20, 0x2D20, 0x2D30, 0x2D40, 0x2D50, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60,
+    0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D60, 0x2D70, 0x2D60, 0x2D80, 0x2D90, 0x0D10,
+    0x2DA0, 0x1610, 0x1610, 0x2DB0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x2DC0, 0x2DD0, 0x2DD0, 0x2DE0,
+    0x2DF0, 0x2E00, 0x2E10, 0x2E20, 0x2E30, 0x2E40, 0x2E50, 0x0D10, 0x0D10, 0x0D10, 0x2E60, 0x2E70,
+    0x2E80, 0x2E90, 0x2EA0, 0x2EB0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x2EC0, 0x2EC0, 0x2ED0, 0x2EE0,
+    0x2EF0, 0x2F00, 0x2EF0, 0x2EF0, 0x2F10, 0x2F20, 0x2F30, 0x2F40, 0x2F50, 0x2F60, 0x2F70, 0x2F80,
+    0x2F90, 0x2FA0, 0x0D10, 0x0D10, 0x2FB0, 0x2FC0, 0x2FD0, 0x2FE0, 0x2FF0, 0x2FF0, 0x2FF0, 0x3000,
+    0x3010, 0x3020, 0x3030, 0x3040, 0x3050, 0x3060, 0x3070, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x3080, 0x3080, 0x3080, 0x3080, 0x3090, 0x0D10, 0x0D10, 0x0D10, 0x30A0, 0x30A0, 0x30A0, 0x30B0,
+    0x30C0, 0x30C0, 0x30C0, 0x30D0, 0x30E0, 0x30E0, 0x30F0, 0x3100, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x3110, 0x3120, 0x3130, 0x3130, 0x3140, 0x3150, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x3160, 0x3170, 0x3180, 0x3190, 0x31A0, 0x31B0, 0x0D10, 0x31C0, 0x31D0, 0x0D10, 0x0D10, 0x31E0,
+    0x31F0, 0x0D10, 0x3200, 0x3210, 0x3220, 0x3230, 0x3230, 0x3240, 0x3250, 0x3260, 0x3270, 0x3280,
+    0x3290, 0x32A0, 0x32B0, 0x32C0, 0x32D0, 0x32E0, 0x32F0, 0x3300, 0x3310, 0x3320, 0x3330, 0x3340,
+    0x3350, 0x3360, 0x3360, 0x3370, 0x3380, 0x3390, 0x3390, 0x33A0, 0x33B0, 0x33C0, 0x33D0, 0x33E0,
+    0x33F0, 0x3400, 0x3410, 0x3420, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3430, 0x3440, 0x3450, 0x3460,
+    0x3460, 0x3470, 0x3480, 0x3490, 0x34A0, 0x34B0, 0x34C0, 0x34D0, 0x34E0, 0x34F0, 0x3500, 0x3510,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3520, 0x3520, 0x3520, 0x3530,
+    0x3540, 0x3550, 0x3560, 0x0D10, 0x3570, 0x3570, 0x3570, 0x3580, 0x3590, 0x35A0, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x35B0, 0x35B0, 0x35C0, 0x35D0,
+    0x35E0, 0x35F0, 0x0D10, 0x0D10, 0x3600, 0x3600, 0x3600, 0x3610, 0x3620, 0x3630, 0x3640, 0x0D10,
+    0x3650, 0x3650, 0x3660, 0x3670, 0x3680, 0x0D10, 0x0D10, 0x0D10, 0x3690, 0x36A0, 0x36B0, 0x36C0,
+    0x36D0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x36E0, 0x36E0, 0x36F0, 0x3700, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3710, 0x3710,
+    0x3720, 0x3720, 0x3730, 0x3740, 0x3750, 0x3760, 0x3770, 0x3780, 0x3790, 0x37A0, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x37B0, 0x37C0, 0x37C0, 0x37D0, 0x37E0, 0x0D10, 0x37F0, 0x3800, 0x3800, 0x3810,
+    0x3820, 0x3830, 0x3840, 0x3840, 0x3850, 0x3860, 0x3870, 0x1080, 0x3880, 0x3880, 0x3880, 0x3890,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x38A0, 0x38B0, 0x38C0, 0x38D0, 0x38E0, 0x38F0, 0x3900, 0x3910,
+    0x3920, 0x3930, 0x3940, 0x3950, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3960, 0x3970, 0x3970, 0x3980,
+    0x3990, 0x39A0, 0x39B0, 0x39C0, 0x39D0, 0x39E0, 0x39F0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x3A00, 0x3A10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x3A20, 0x3A30, 0x3A40, 0x3A50, 0x3A60, 0x3A70, 0x3A70, 0x3A70, 0x3A70,
+    0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70,
+    0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70,
+    0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70,
+    0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70,
+    0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A80, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x3A90, 0x3A90, 0x3A90, 0x3A90, 0x3A90, 0x3A90, 0x3AA0, 0x3AB0, 0x3A70, 0x3A70, 0x3A70, 0x3A70,
+    0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3A70, 0x3AC0, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3AD0, 0x3AD0, 0x3AD0, 0x3AD0, 0x3AD0, 0x3AD0, 0x3AE0,
+    0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0,
+    0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0,
+    0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0,
+    0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0,
+    0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0,
+    0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3AF0, 0x3B00, 0x3B10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3B20, 0x3B20, 0x3B20, 0x3B20,
+    0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20,
+    0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20,
+    0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B20, 0x3B30, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0,
+    0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0,
+    0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x22D0, 0x3B40,
+    0x3B50, 0x3B60, 0x3B70, 0x3B80, 0x3B80, 0x3B80, 0x3B80, 0x3B90, 0x3BA0, 0x3BB0, 0x3BC0, 0x3BD0,
+    0x3BE0, 0x3BE0, 0x3BE0, 0x3BF0, 0x3C00, 0x3C10, 0x3C20, 0x3C30, 0x3BE0, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3C40, 0x3C40, 0x3C50, 0x3C50, 0x3C60, 0x3C70, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3C80, 0x3C80, 0x3C80, 0x3C80, 0x3C90, 0x3CA0, 0x3CB0, 0x3CB0,
+    0x3CC0, 0x3CD0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3CE0, 0x3CF0, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D10, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D00,
+    0x3D00, 0x3D00, 0x3D00, 0x3D00, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20,
+    0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20,
+    0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D20, 0x3D30, 0x0D10, 0x0D10,
+    0x3D40, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x3D50, 0x3D60, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040,
+    0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x2040, 0x3D70, 0x0D10,
+    0x0D10, 0x3D80, 0x3D90, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0,
+    0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0, 0x3DA0,
+    0x3DA0, 0x3DA0, 0x3DA0, 0x3DB0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3DC0, 0x3DC0, 0x3DC0, 0x3DC0,
+    0x3DC0, 0x3DC0, 0x3DD0, 0x3DE0, 0x3DF0, 0x3E00, 0x3E10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x28B0, 0x28B0, 0x3E20, 0x28B0, 0x3E30, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900,
+    0x3E40, 0x0D10, 0x0D10, 0x0D10, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900,
+    0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x3E50, 0x1900, 0x1900, 0x3E60, 0x1900,
+    0x1900, 0x3E70, 0x3E80, 0x3E90, 0x3EA0, 0x1900, 0x3EB0, 0x3EC0, 0x3ED0, 0x1900, 0x1A90, 0x0D10,
+    0x3EE0, 0x3EE0, 0x3EE0, 0x3EE0, 0x3EF0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x1B00, 0x3F00, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1A80, 0x1B00, 0x3F10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x3F20, 0x3F30, 0x3F40, 0x3F50,
+    0x3F60, 0x3F70, 0x3F80, 0x3F20, 0x3F90, 0x3FA0, 0x3FB0, 0x3FC0, 0x3FD0, 0x3F20, 0x3F30, 0x3F40,
+    0x3FE0, 0x3FF0, 0x3F40, 0x4000, 0x4010, 0x4020, 0x4030, 0x3F20, 0x4040, 0x3F40, 0x3F20, 0x3F30,
+    0x3F40, 0x3F50, 0x3F60, 0x3F40, 0x3F80, 0x3F20, 0x3F90, 0x4030, 0x3F20, 0x4040, 0x3F40, 0x3F20,
+    0x3F30, 0x3F40, 0x4050, 0x3F20, 0x4060, 0x4070, 0x4080, 0x4090, 0x3F40, 0x40A0, 0x3F20, 0x40B0,
+    0x40C0, 0x40D0, 0x40E0, 0x3F40, 0x40F0, 0x3F20, 0x4100, 0x3F40, 0x4110, 0x4120, 0x4120, 0x4120,
+    0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130,
+    0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130,
+    0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4130, 0x4140, 0x4140, 0x4140, 0x4150,
+    0x4140, 0x4140, 0x4160, 0x4170, 0x4180, 0x4190, 0x41A0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x41B0, 0x41C0, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x41D0, 0x41E0, 0x41F0, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x4200, 0x4200, 0x4210, 0x4220, 0x4230, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x4240, 0x4250, 0x0D10, 0x4260, 0x4260, 0x4270, 0x4280, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x4290, 0x42A0, 0x42B0, 0x42B0, 0x42B0, 0x42B0, 0x42B0, 0x42B0, 0x42B0, 0x42B0,
+    0x42B0, 0x42B0, 0x42B0, 0x42B0, 0x42C0, 0x42D0, 0x0D10, 0x0D10, 0x42E0, 0x42E0, 0x42F0, 0x4300,
+    0x4310, 0x4320, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x4330, 0x1B00, 0x1B00, 0x4340, 0x4350, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x4330, 0x1B00, 0x4360, 0x4370, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x4380, 0x2820, 0x4390, 0x43A0, 0x43B0, 0x43C0, 0x43D0, 0x43E0,
+    0x43F0, 0x4400, 0x4410, 0x4400, 0x0D10, 0x0D10, 0x0D10, 0x4420, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10, 0x0D10,
+    0x4430, 0x4440, 0x4450, 0x4440, 0x4440, 0x4440, 0x4440, 0x4440, 0x4440, 0x4460, 0x4470, 0x4480,
+    0x4490, 0x4480, 0x4440, 0x44A0, 0x44B0, 0x1AB0, 0x44C0, 0x44D0, 0x44E0, 0x44F0, 0x4500, 0x4510,
+    0x4520, 0x4530, 0x4540, 0x4550, 0x4550, 0x4550, 0x4560, 0x4570, 0x4580, 0x4590, 0x45A0, 0x45B0,
+    0x45C0, 0x45D0, 0x45E0, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550,
+    0x45F0, 0x45F0, 0x4600, 0x4610, 0x45F0, 0x45F0, 0x45F0, 0x4620, 0x45F0, 0x4630, 0x45F0, 0x45F0,
+    0x4640, 0x4650, 0x45F0, 0x4660, 0x45F0, 0x45F0, 0x45F0, 0x4670, 0x4680, 0x45F0, 0x45F0, 0x45F0,
+    0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x4690, 0x45F0, 0x45F0, 0x45F0, 0x46A0,
+    0x46B0, 0x45F0, 0x46C0, 0x46D0, 0x46E0, 0x46F0, 0x4700, 0x4710, 0x4720, 0x4730, 0x4740, 0x4750,
+    0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x1900, 0x1900, 0x1900, 0x45F0, 0x45F0, 0x45F0, 0x45F0,
+    0x4760, 0x4770, 0x4780, 0x4790, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x47A0,
+    0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x47B0, 0x47C0, 0x47D0, 0x47E0, 0x1900, 0x1900, 0x1900,
+    0x47F0, 0x4800, 0x1900, 0x1900, 0x47F0, 0x1900, 0x4810, 0x4820, 0x4550, 0x4550, 0x4550, 0x4550,
+    0x4830, 0x45F0, 0x45F0, 0x4840, 0x4850, 0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x45F0,
+    0x45F0, 0x45F0, 0x45F0, 0x45F0, 0x4440, 0x4440, 0x4440, 0x4440, 0x4440, 0x4460, 0x4860, 0x4870,
+    0x4880, 0x45F0, 0x4890, 0x48A0, 0x45E0, 0x48B0, 0x48C0, 0x4880, 0x1900, 0x1900, 0x1900, 0x1900,
+    0x1900, 0x1900, 0x1900, 0x1900, 0x1900, 0x48D0, 0x1900, 0x1900, 0x1A90, 0x0D10, 0x0D10, 0x48E0,
+    0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550,
+    0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550,
+    0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550,
+    0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550,
+    0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550, 0x4550,
+    0x4550, 0x4550, 0x4550, 0x48F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x27C0, 0x27C0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x4900,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x4910, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x4920, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x4930, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760,
+    0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760,
+    0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760, 0x2760,
+    0x2760, 0x27A0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x4940,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x21F0,
+    0x21F0, 0x21F0, 0x21F0, 0x21F0, 0x4950, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x27C0,
+    0x27C0, 0x27C0, 0x27C0, 0x27C0, 0x4960, 0x4970, 0x4980, 0x4980, 0x4980, 0x4980, 0x4980, 0x4980,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x28B0, 0x28B0, 0x28B0, 0x28B0,
+    0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x28B0, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970, 0x4970,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750, 0x2750,
+    0x2750, 0x2750, 0x2750, 0x4990
+};
+
+template <typename T>
+UTIL_CONSTEXPR const uint16 CharacterTables<T>::data[18848] =
+{
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0002, 0x0003,
+    0x0003, 0x0004, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x0006, 0x0007, 0x0008,
+    0x0009, 0x0006, 0x0006, 0x000A, 0x000B, 0x000C, 0x0008, 0x000D, 0x000E, 0x000F, 0x0010, 0x0006,
+    0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0011, 0x0012, 0x000E,
+    0x000D, 0x000D, 0x000D, 0x0006, 0x0006, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+    0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013,
+    0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x0013, 0x000B, 0x0006, 0x000C, 0x0014, 0x0015,
+    0x0014, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016, 0x0016,
+    0x0016, 0x0016, 0x0016, 0x000B, 0x000D, 0x000C, 0x000D, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0017, 0x0006, 0x0009, 0x0009, 0x0009, 0x0009, 0x0018, 0x0006, 0x0019, 0x001A, 0x001B, 0x001C,
+    0x000D, 0x001D, 0x001A, 0x0019, 0x0018, 0x000D, 0x001E, 0x001E, 0x0019, 0x001F, 0x0006, 0x0012,
+    0x0019, 0x001E, 0x001B, 0x0020, 0x001E, 0x001E, 0x001E, 0x0006, 0x0021, 0x0021, 0x0021, 0x0021,
+    0x0021, 0x0021, 0x0013, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
+    0x0013, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x000D, 0x0013, 0x0021, 0x0021, 0x0021,
+    0x0021, 0x0021, 0x0013, 0x0022, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0016, 0x0023,
+    0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0016, 0x0023, 0x0023, 0x0023,
+    0x0023, 0x0023, 0x0023, 0x000D, 0x0016, 0x0023, 0x0023, 0x0023, 0x0023, 0x0023, 0x0016, 0x0024,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0027, 0x0028, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0029, 0x002A, 0x002B, 0x002C, 0x0025, 0x0026, 0x0025, 0x0026, 0x002D, 0x0025, 0x0026, 0x0025,
+    0x0026, 0x0025, 0x0026, 0x002B, 0x002C, 0x0027, 0x0028, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025,
+    0x0026, 0x002E, 0x0027, 0x0028, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0027, 0x0028,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x002F, 0x0025, 0x0026, 0x0025,
+    0x0026, 0x0025, 0x0026, 0x0030, 0x0031, 0x0032, 0x0027, 0x0028, 0x0027, 0x0028, 0x0033, 0x0027,
+    0x0028, 0x0034, 0x0034, 0x0027, 0x0028, 0x002D, 0x0035, 0x0036, 0x0037, 0x0027, 0x0028, 0x0034,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x0027, 0x0028, 0x003C, 0x002D, 0x003A, 0x003D, 0x003E, 0x003F,
+    0x0025, 0x0026, 0x0027, 0x0028, 0x0027, 0x0028, 0x0040, 0x0027, 0x0028, 0x0040, 0x002D, 0x002D,
+    0x0027, 0x0028, 0x0040, 0x0025, 0x0026, 0x0041, 0x0041, 0x0027, 0x0028, 0x0027, 0x0028, 0x0042,
+    0x0027, 0x0028, 0x002D, 0x0043, 0x0027, 0x0028, 0x002D, 0x0044, 0x0043, 0x0043, 0x0043, 0x0043,
+    0x0045, 0x0046, 0x0047, 0x0045, 0x0046, 0x0047, 0x0045, 0x0046, 0x0047, 0x0025, 0x0026, 0x0025,
+    0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025,
+    0x0026, 0x0048, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0027, 0x0028, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0049, 0x0045, 0x0046, 0x0047,
+    0x0025, 0x0026, 0x004A, 0x004B, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0027, 0x0028, 0x0025, 0x0026, 0x004C, 0x002D, 0x0027, 0x0028, 0x0027, 0x0028, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x004D, 0x0027, 0x0028, 0x004E, 0x004F, 0x0050,
+    0x0050, 0x0027, 0x0028, 0x0051, 0x0052, 0x0053, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x002D, 0x0059, 0x0059,
+    0x002D, 0x005A, 0x002D, 0x005B, 0x005C, 0x002D, 0x002D, 0x002D, 0x0059, 0x005D, 0x002D, 0x005E,
+    0x002D, 0x005F, 0x0060, 0x002D, 0x0061, 0x0062, 0x0060, 0x0063, 0x0064, 0x002D, 0x002D, 0x0062,
+    0x002D, 0x0065, 0x0066, 0x002D, 0x002D, 0x0067, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x0068, 0x002D, 0x002D, 0x0069, 0x002D, 0x006A, 0x0069, 0x002D, 0x002D, 0x002D, 0x006B,
+    0x0069, 0x006C, 0x006D, 0x006D, 0x006E, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x006F, 0x002D,
+    0x0043, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x0070, 0x0071, 0x002D,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0074, 0x0074, 0x0075, 0x0075,
+    0x0075, 0x0075, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+    0x0073, 0x0073, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0019, 0x0019, 0x0019, 0x0019,
+    0x0019, 0x0019, 0x0075, 0x0075, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0075, 0x0075, 0x0075,
+    0x0075, 0x0075, 0x0076, 0x0076, 0x0073, 0x0075, 0x0073, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+    0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+    0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0078, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077,
+    0x0077, 0x0078, 0x0078, 0x0077, 0x0078, 0x0077, 0x0078, 0x0077, 0x0077, 0x0079, 0x007A, 0x007A,
+    0x007A, 0x007A, 0x0079, 0x007B, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x007C, 0x007C, 0x007D,
+    0x007D, 0x007D, 0x007D, 0x007E, 0x007E, 0x007A, 0x007A, 0x007A, 0x007A, 0x007D, 0x007D, 0x007A,
+    0x007D, 0x007D, 0x007A, 0x007A, 0x007F, 0x007F, 0x007F, 0x007F, 0x0080, 0x007A, 0x007A, 0x007A,
+    0x007A, 0x0078, 0x0078, 0x0078, 0x0081, 0x0081, 0x0077, 0x0081, 0x0081, 0x0082, 0x0078, 0x007A,
+    0x007A, 0x007A, 0x0078, 0x0078, 0x0078, 0x007A, 0x007A, 0x0083, 0x0078, 0x0078, 0x0078, 0x007A,
+    0x007A, 0x007A, 0x007A, 0x0078, 0x0079, 0x007A, 0x007A, 0x0078, 0x0084, 0x0085, 0x0085, 0x0084,
+    0x0085, 0x0085, 0x0084, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0086, 0x0087, 0x0086, 0x0087, 0x0088, 0x0089, 0x0086, 0x0087,
+    0x008A, 0x008A, 0x008B, 0x008C, 0x008C, 0x008C, 0x008D, 0x008E, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008F, 0x0090, 0x0091, 0x0092, 0x0093, 0x0093, 0x0093, 0x008A, 0x0094, 0x008A, 0x0095, 0x0095,
+    0x0096, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097,
+    0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097, 0x008A, 0x0097, 0x0097, 0x0097, 0x0097, 0x0097,
+    0x0097, 0x0097, 0x0098, 0x0098, 0x0099, 0x009A, 0x009A, 0x009A, 0x009B, 0x009C, 0x009C, 0x009C,
+    0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C,
+    0x009C, 0x009C, 0x009D, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009C, 0x009E, 0x009E,
+    0x009F, 0x00A0, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A5, 0x00A6, 0x00A7, 0x00A8,
+    0x0086, 0x0087, 0x0086, 0x0087, 0x0086, 0x0087, 0x0086, 0x0087, 0x0086, 0x0087, 0x00A9, 0x00AA,
+    0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA,
+    0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x0086, 0x0087, 0x00B2, 0x0086, 0x0087,
+    0x00B3, 0x00B4, 0x00B4, 0x00B4, 0x00B5, 0x00B5, 0x00B6, 0x00B5, 0x00B6, 0x00B6, 0x00B6, 0x00B5,
+    0x00B6, 0x00B6, 0x00B6, 0x00B6, 0x00B5, 0x00B5, 0x00B5, 0x00B6, 0x00B7, 0x00B7, 0x00B7, 0x00B7,
+    0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B8, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7,
+    0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B7,
+    0x00B7, 0x00B7, 0x00B7, 0x00B7, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00BA, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9, 0x00B9,
+    0x00BB, 0x00BB, 0x00BC, 0x00BB, 0x00BC, 0x00BC, 0x00BC, 0x00BB, 0x00BC, 0x00BC, 0x00BC, 0x00BC,
+    0x00BB, 0x00BB, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE,
+    0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE,
+    0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE,
+    0x00BD, 0x00BE, 0x00C1, 0x00C2, 0x00C2, 0x0078, 0x0078, 0x00C2, 0x00C3, 0x00C3, 0x00BD, 0x00BE,
+    0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00C4, 0x00BF, 0x00C0, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD,
+    0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00C5, 0x00BF, 0x00C0, 0x00BF, 0x00C0,
+    0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00BF, 0x00C0, 0x00BF, 0x00C0,
+    0x00BD, 0x00BE, 0x00BF, 0x00C0, 0x00BF, 0x00C0, 0x00BF, 0x00C0, 0x00BD, 0x00BE, 0x00BF, 0x00C0,
+    0x00BF, 0x00C0, 0x00BF, 0x00C0, 0x00BF, 0x00C0, 0x00BF, 0x00C0, 0x00BF, 0x00C0, 0x00BD, 0x00BE,
+    0x00BF, 0x00C0, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x008A, 0x00C6, 0x00C6, 0x00C6,
+    0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6,
+    0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6,
+    0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x00C6, 0x008A,
+    0x008A, 0x00C7, 0x00C8, 0x00C8, 0x00C8, 0x00C9, 0x00C8, 0x00CA, 0x00CB, 0x00CC, 0x00CC, 0x00CC,
+    0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+    0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC,
+    0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CC, 0x00CD,
+    0x00CB, 0x00CE, 0x00CF, 0x008A, 0x008A, 0x00D0, 0x00D0, 0x00D1, 0x008A, 0x00D2, 0x00D3, 0x00D3,
+    0x00D3, 0x00D3, 0x00D2, 0x00D3, 0x00D3, 0x00D3, 0x00D4, 0x00D2, 0x00D3, 0x00D3, 0x00D3, 0x00D3,
+    0x00D3, 0x00D3, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D2, 0x00D3, 0x00D3, 0x00D2, 0x00D3,
+    0x00D3, 0x00D4, 0x00D5, 0x00D3, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD,
+    0x00DE, 0x00DF, 0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E5,
+    0x00D3, 0x00D2, 0x00E5, 0x00DE, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8,
+    0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E8,
+    0x00E8, 0x00E8, 0x00E8, 0x008A, 0x008A, 0x008A, 0x008A, 0x00E8, 0x00E8, 0x00E8, 0x00E8, 0x00E9,
+    0x00EA, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EB, 0x00EC, 0x00ED, 0x00ED, 0x00ED, 0x00EE, 0x00EE, 0x00EF,
+    0x000E, 0x00F0, 0x00F1, 0x00F1, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2,
+    0x00F3, 0x00F4, 0x00F5, 0x0006, 0x00F6, 0x00EE, 0x00EE, 0x0006, 0x00F7, 0x00F7, 0x00F8, 0x00F8,
+    0x00F8, 0x00F8, 0x00F8, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7,
+    0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7,
+    0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x0073, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7,
+    0x00F7, 0x00F7, 0x00F7, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100, 0x0077,
+    0x0077, 0x007D, 0x0101, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x0101, 0x00F2, 0x00F2, 0x0101,
+    0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x00EE, 0x0103,
+    0x00F0, 0x00EE, 0x00F7, 0x00F7, 0x0104, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F8, 0x00F7, 0x00F8, 0x00F7,
+    0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7,
+    0x00F7, 0x00F7, 0x00F7, 0x00F8, 0x00EE, 0x00F7, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2,
+    0x00F2, 0x00EC, 0x00F1, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x0101, 0x00F2, 0x0106, 0x0106, 0x00F2,
+    0x00F2, 0x00F1, 0x0101, 0x00F2, 0x00F2, 0x0101, 0x00F7, 0x00F7, 0x0102, 0x0102, 0x0102, 0x0102,
+    0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x0102, 0x00F7, 0x00F7, 0x00F7, 0x00F1, 0x00F1, 0x00F7,
+    0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107, 0x0107,
+    0x0107, 0x0107, 0x008A, 0x0108, 0x0109, 0x010A, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109,
+    0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109,
+    0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109,
+    0x010B, 0x010C, 0x010B, 0x010B, 0x010C, 0x010B, 0x010B, 0x010C, 0x010C, 0x010C, 0x010B, 0x010C,
+    0x010C, 0x010B, 0x010C, 0x010B, 0x010B, 0x010B, 0x010C, 0x010B, 0x010C, 0x010B, 0x010C, 0x010B,
+    0x010C, 0x010B, 0x010B, 0x008A, 0x008A, 0x0109, 0x0109, 0x0109, 0x010D, 0x010D, 0x010D, 0x010D,
+    0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D,
+    0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010D, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010E,
+    0x010E, 0x010E, 0x010E, 0x010E, 0x010E, 0x010D, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x010F, 0x010F, 0x010F, 0x010F,
+    0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x010F, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+    0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+    0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110, 0x0110,
+    0x0110, 0x0110, 0x0110, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0111, 0x0112, 0x0111,
+    0x0113, 0x0113, 0x0114, 0x0115, 0x0116, 0x0115, 0x0113, 0x008A, 0x008A, 0x0112, 0x0117, 0x0117,
+    0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118,
+    0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0118, 0x0119, 0x0119,
+    0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119,
+    0x011A, 0x0119, 0x0119, 0x0119, 0x011A, 0x0119, 0x0119, 0x0119, 0x0119, 0x0119, 0x008A, 0x008A,
+    0x011B, 0x011B, 0x011B, 0x011B, 0x011B, 0x011B, 0x011B, 0x011B, 0x011B, 0x011B, 0x011B, 0x011B,
+    0x011B, 0x011B, 0x011B, 0x008A, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C,
+    0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011C,
+    0x011C, 0x011C, 0x011C, 0x011C, 0x011C, 0x011D, 0x011D, 0x011D, 0x008A, 0x008A, 0x011E, 0x008A,
+    0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x0109, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7,
+    0x011F, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x008A, 0x00EB, 0x00EB, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x00F2, 0x0101, 0x0101, 0x0101, 0x00F2, 0x00F2, 0x00F2, 0x00F2,
+    0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x00F7, 0x0106, 0x00F2, 0x00F2,
+    0x00F2, 0x00F2, 0x00F2, 0x0101, 0x0101, 0x0101, 0x0101, 0x0101, 0x00F2, 0x00F2, 0x00F2, 0x00F2,
+    0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x00EC, 0x0101,
+    0x00F2, 0x00F2, 0x0101, 0x00F2, 0x00F2, 0x0101, 0x00F2, 0x00F2, 0x00F2, 0x0101, 0x0101, 0x0101,
+    0x0120, 0x0121, 0x0122, 0x00F2, 0x00F2, 0x00F2, 0x0101, 0x00F2, 0x00F2, 0x0101, 0x0101, 0x00F2,
+    0x00F2, 0x00F2, 0x00F2, 0x00F2, 0x0123, 0x0123, 0x0123, 0x0124, 0x0125, 0x0125, 0x0125, 0x0125,
+    0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125,
+    0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125,
+    0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0126, 0x0125, 0x0125,
+    0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0126, 0x0125, 0x0125, 0x0126, 0x0125, 0x0125, 0x0125,
+    0x0125, 0x0125, 0x0123, 0x0124, 0x0127, 0x0125, 0x0124, 0x0124, 0x0124, 0x0123, 0x0123, 0x0123,
+    0x0123, 0x0123, 0x0123, 0x0123, 0x0123, 0x0124, 0x0124, 0x0124, 0x0124, 0x0128, 0x0124, 0x0124,
+    0x0125, 0x0078, 0x007A, 0x0078, 0x0078, 0x0123, 0x0123, 0x0123, 0x0129, 0x0129, 0x0129, 0x0129,
+    0x0129, 0x0129, 0x0129, 0x0129, 0x0125, 0x0125, 0x0123, 0x0123, 0x0006, 0x0006, 0x012A, 0x012A,
+    0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x012A, 0x012B, 0x012C, 0x0125, 0x0125,
+    0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125,
+    0x012D, 0x012E, 0x012F, 0x012F, 0x008A, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D,
+    0x012D, 0x008A, 0x008A, 0x012D, 0x012D, 0x008A, 0x008A, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D,
+    0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D,
+    0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x008A, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D, 0x012D,
+    0x012D, 0x008A, 0x012D, 0x008A, 0x008A, 0x008A, 0x012D, 0x012D, 0x012D, 0x012D, 0x008A, 0x008A,
+    0x0130, 0x012D, 0x0131, 0x012F, 0x012F, 0x012E, 0x012E, 0x012E, 0x012E, 0x008A, 0x008A, 0x012F,
+    0x012F, 0x008A, 0x008A, 0x0132, 0x0132, 0x0133, 0x012D, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x0131, 0x008A, 0x008A, 0x008A, 0x008A, 0x0134, 0x0134, 0x008A, 0x0134,
+    0x012D, 0x012D, 0x012E, 0x012E, 0x008A, 0x008A, 0x0135, 0x0135, 0x0135, 0x0135, 0x0135, 0x0135,
+    0x0135, 0x0135, 0x0135, 0x0135, 0x012D, 0x012D, 0x0136, 0x0136, 0x0137, 0x0137, 0x0137, 0x0137,
+    0x0137, 0x0137, 0x0138, 0x0136, 0x012D, 0x0139, 0x013A, 0x008A, 0x008A, 0x013B, 0x013B, 0x013C,
+    0x008A, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x008A, 0x008A, 0x008A, 0x008A, 0x013D,
+    0x013D, 0x008A, 0x008A, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D,
+    0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D,
+    0x013D, 0x008A, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x013D, 0x008A, 0x013D, 0x013E,
+    0x008A, 0x013D, 0x013E, 0x008A, 0x013D, 0x013D, 0x008A, 0x008A, 0x013F, 0x008A, 0x013C, 0x013C,
+    0x013C, 0x013B, 0x013B, 0x008A, 0x008A, 0x008A, 0x008A, 0x013B, 0x013B, 0x008A, 0x008A, 0x013B,
+    0x013B, 0x0140, 0x008A, 0x008A, 0x008A, 0x013B, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x013E, 0x013E, 0x013E, 0x013D, 0x008A, 0x013E, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x0141, 0x0141, 0x0141, 0x0141, 0x0141, 0x0141, 0x0141, 0x0141, 0x0141, 0x0141,
+    0x013B, 0x013B, 0x013D, 0x013D, 0x013D, 0x013B, 0x0142, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0143, 0x0143, 0x0144, 0x008A, 0x0145, 0x0145, 0x0145,
+    0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x008A, 0x0145, 0x0145, 0x0145, 0x008A, 0x0145,
+    0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145,
+    0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x008A, 0x0145, 0x0145,
+    0x0145, 0x0145, 0x0145, 0x0145, 0x0145, 0x008A, 0x0145, 0x0145, 0x008A, 0x0145, 0x0145, 0x0145,
+    0x0145, 0x0145, 0x008A, 0x008A, 0x0146, 0x0145, 0x0144, 0x0144, 0x0144, 0x0143, 0x0143, 0x0143,
+    0x0143, 0x0143, 0x008A, 0x0143, 0x0143, 0x0144, 0x008A, 0x0144, 0x0144, 0x0147, 0x008A, 0x008A,
+    0x0145, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0145, 0x0145, 0x0143, 0x0143, 0x008A, 0x008A, 0x0148, 0x0148,
+    0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0148, 0x0149, 0x014A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0145, 0x0143, 0x0143, 0x0143, 0x0143, 0x0143, 0x0143,
+    0x008A, 0x014B, 0x014C, 0x014C, 0x008A, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D,
+    0x014D, 0x008A, 0x008A, 0x014D, 0x014D, 0x008A, 0x008A, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D,
+    0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D,
+    0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x008A, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D,
+    0x014D, 0x008A, 0x014D, 0x014D, 0x008A, 0x014D, 0x014D, 0x014D, 0x014D, 0x014D, 0x008A, 0x008A,
+    0x014E, 0x014D, 0x014F, 0x014B, 0x014C, 0x014B, 0x014B, 0x014B, 0x014B, 0x008A, 0x008A, 0x014C,
+    0x0150, 0x008A, 0x008A, 0x0150, 0x0150, 0x0151, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x014B, 0x0152, 0x014F, 0x008A, 0x008A, 0x008A, 0x008A, 0x0153, 0x0153, 0x008A, 0x014D,
+    0x014D, 0x014D, 0x014B, 0x014B, 0x008A, 0x008A, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154, 0x0154,
+    0x0154, 0x0154, 0x0154, 0x0154, 0x0155, 0x014D, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156, 0x0156,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0157, 0x0158,
+    0x008A, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x008A, 0x008A, 0x008A, 0x0158, 0x0158,
+    0x0158, 0x008A, 0x0158, 0x0158, 0x0159, 0x0158, 0x008A, 0x008A, 0x008A, 0x0158, 0x0158, 0x008A,
+    0x0158, 0x008A, 0x0158, 0x0158, 0x008A, 0x008A, 0x008A, 0x0158, 0x0158, 0x008A, 0x008A, 0x008A,
+    0x0158, 0x0158, 0x0158, 0x008A, 0x008A, 0x008A, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158,
+    0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x0158, 0x008A, 0x008A, 0x008A, 0x008A, 0x015A, 0x015B,
+    0x0157, 0x015B, 0x015B, 0x008A, 0x008A, 0x008A, 0x015B, 0x015B, 0x015B, 0x008A, 0x015C, 0x015C,
+    0x015C, 0x015D, 0x008A, 0x008A, 0x0158, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x015A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E, 0x015E,
+    0x015F, 0x015F, 0x015F, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0161, 0x0160, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0162, 0x0163, 0x0163, 0x0163, 0x0162, 0x0164, 0x0164, 0x0164,
+    0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x008A, 0x0164, 0x0164, 0x0164, 0x008A, 0x0164, 0x0164,
+    0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164,
+    0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x008A, 0x0164, 0x0164,
+    0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164, 0x0164,
+    0x0164, 0x0164, 0x008A, 0x008A, 0x0165, 0x0164, 0x0162, 0x0162, 0x0162, 0x0163, 0x0163, 0x0163,
+    0x0163, 0x008A, 0x0162, 0x0162, 0x0166, 0x008A, 0x0162, 0x0162, 0x0162, 0x0167, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0168, 0x0169, 0x008A, 0x0164, 0x0164, 0x0164, 0x008A,
+    0x008A, 0x0164, 0x008A, 0x008A, 0x0164, 0x0164, 0x0162, 0x0162, 0x008A, 0x008A, 0x016A, 0x016A,
+    0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x016A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x016B, 0x016C, 0x016C, 0x016C, 0x016C, 0x016C, 0x016C, 0x016C, 0x016D,
+    0x016E, 0x016F, 0x0170, 0x0170, 0x0171, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E,
+    0x016E, 0x008A, 0x016E, 0x016E, 0x016E, 0x008A, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E,
+    0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E,
+    0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x008A, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E,
+    0x016E, 0x016E, 0x016E, 0x016E, 0x008A, 0x016E, 0x016E, 0x016E, 0x016E, 0x016E, 0x008A, 0x008A,
+    0x0172, 0x016E, 0x0170, 0x016F, 0x0173, 0x0170, 0x0174, 0x0170, 0x0170, 0x008A, 0x016F, 0x0173,
+    0x0173, 0x008A, 0x0173, 0x0173, 0x016F, 0x0175, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x0174, 0x0174, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x016E, 0x016E, 0x008A,
+    0x016E, 0x016E, 0x016F, 0x016F, 0x008A, 0x008A, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176, 0x0176,
+    0x0176, 0x0176, 0x0176, 0x0176, 0x008A, 0x016E, 0x016E, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0177, 0x0177, 0x0178, 0x0178,
+    0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x008A, 0x0179, 0x0179,
+    0x0179, 0x008A, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179,
+    0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179,
+    0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179,
+    0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x0179, 0x017A, 0x017A, 0x0179, 0x017B, 0x0178,
+    0x0178, 0x0177, 0x0177, 0x0177, 0x0177, 0x008A, 0x0178, 0x0178, 0x0178, 0x008A, 0x017C, 0x017C,
+    0x017C, 0x017A, 0x017D, 0x017E, 0x008A, 0x008A, 0x008A, 0x008A, 0x0179, 0x0179, 0x0179, 0x017B,
+    0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x0179, 0x0179, 0x0179, 0x0177, 0x0177,
+    0x008A, 0x008A, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180, 0x0180,
+    0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x017F, 0x017E, 0x0179, 0x0179,
+    0x0179, 0x0179, 0x0179, 0x0179, 0x008A, 0x0181, 0x0182, 0x0182, 0x008A, 0x0183, 0x0183, 0x0183,
+    0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183,
+    0x0183, 0x0183, 0x0183, 0x008A, 0x008A, 0x008A, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183,
+    0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183,
+    0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183, 0x008A, 0x0183, 0x0183, 0x0183, 0x0183, 0x0183,
+    0x0183, 0x0183, 0x0183, 0x0183, 0x008A, 0x0183, 0x008A, 0x008A, 0x0183, 0x0183, 0x0183, 0x0183,
+    0x0183, 0x0183, 0x0183, 0x008A, 0x008A, 0x008A, 0x0184, 0x008A, 0x008A, 0x008A, 0x008A, 0x0185,
+    0x0182, 0x0182, 0x0181, 0x0181, 0x0181, 0x008A, 0x0181, 0x008A, 0x0182, 0x0182, 0x0186, 0x0182,
+    0x0186, 0x0186, 0x0186, 0x0185, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0187, 0x0187,
+    0x0187, 0x0187, 0x0187, 0x0187, 0x0187, 0x0187, 0x0187, 0x0187, 0x008A, 0x008A, 0x0182, 0x0182,
+    0x0188, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189,
+    0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189,
+    0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x018A, 0x0189, 0x018B,
+    0x018A, 0x018A, 0x018A, 0x018A, 0x018C, 0x018C, 0x018D, 0x008A, 0x008A, 0x008A, 0x008A, 0x0009,
+    0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x0189, 0x018E, 0x018A, 0x018F, 0x018F, 0x018F, 0x018F,
+    0x018A, 0x018A, 0x018A, 0x0190, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191, 0x0191,
+    0x0191, 0x0191, 0x0190, 0x0190, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x0192, 0x0192, 0x008A, 0x0192, 0x008A, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x008A,
+    0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192,
+    0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192,
+    0x008A, 0x0192, 0x008A, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192,
+    0x0192, 0x0193, 0x0192, 0x0194, 0x0193, 0x0193, 0x0193, 0x0193, 0x0195, 0x0195, 0x0196, 0x0193,
+    0x0193, 0x0192, 0x008A, 0x008A, 0x0192, 0x0192, 0x0192, 0x0192, 0x0192, 0x008A, 0x0197, 0x008A,
+    0x0198, 0x0198, 0x0198, 0x0198, 0x0193, 0x0193, 0x008A, 0x008A, 0x0199, 0x0199, 0x0199, 0x0199,
+    0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x0199, 0x008A, 0x008A, 0x019A, 0x019A, 0x0192, 0x0192,
+    0x019B, 0x019C, 0x019C, 0x019C, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D,
+    0x019E, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x019C, 0x019D, 0x019C, 0x019C, 0x019C,
+    0x019F, 0x019F, 0x019C, 0x019C, 0x019C, 0x019C, 0x019C, 0x019C, 0x01A0, 0x01A0, 0x01A0, 0x01A0,
+    0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A0, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x01A1,
+    0x01A1, 0x01A1, 0x01A1, 0x01A1, 0x019C, 0x019F, 0x019C, 0x019F, 0x019C, 0x01A2, 0x01A3, 0x01A4,
+    0x01A3, 0x01A4, 0x01A5, 0x01A5, 0x019B, 0x019B, 0x019B, 0x01A6, 0x019B, 0x019B, 0x019B, 0x019B,
+    0x008A, 0x019B, 0x019B, 0x019B, 0x019B, 0x01A6, 0x019B, 0x019B, 0x019B, 0x019B, 0x01A6, 0x019B,
+    0x019B, 0x019B, 0x019B, 0x01A6, 0x019B, 0x019B, 0x019B, 0x019B, 0x01A6, 0x019B, 0x019B, 0x019B,
+    0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x01A6, 0x019B, 0x019B,
+    0x019B, 0x008A, 0x008A, 0x008A, 0x008A, 0x01A7, 0x01A8, 0x01A9, 0x01AA, 0x01A9, 0x01A9, 0x01AB,
+    0x01A9, 0x01AB, 0x01A8, 0x01A8, 0x01A8, 0x01A8, 0x01AC, 0x01A5, 0x01A8, 0x01A9, 0x01AD, 0x01AD,
+    0x01AE, 0x019D, 0x01AD, 0x01AD, 0x019B, 0x019B, 0x019B, 0x019B, 0x019B, 0x01AC, 0x01AC, 0x01AC,
+    0x01AC, 0x01AC, 0x01AC, 0x01A9, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x008A, 0x01AC, 0x01AC, 0x01AC,
+    0x01AC, 0x01A9, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01A9, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01A9,
+    0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01A9, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC,
+    0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01AC, 0x01A9, 0x01AC, 0x01AC, 0x01AC, 0x008A, 0x019C, 0x019C,
+    0x019C, 0x019C, 0x019C, 0x019C, 0x019C, 0x019C, 0x019F, 0x019C, 0x019C, 0x019C, 0x019C, 0x019C,
+    0x019C, 0x008A, 0x019C, 0x019C, 0x019D, 0x019D, 0x019D, 0x019D, 0x019D, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x019D, 0x019D, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01AF, 0x01AF, 0x01AF, 0x01AF,
+    0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF,
+    0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01B0, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01B1,
+    0x01B1, 0x01B2, 0x01B3, 0x01B2, 0x01B2, 0x01B4, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B2, 0x01B5,
+    0x01B1, 0x01B6, 0x01B6, 0x01B4, 0x01B4, 0x01B2, 0x01B2, 0x01AF, 0x01B7, 0x01B7, 0x01B7, 0x01B7,
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8, 0x01B8,
+    0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01B4, 0x01B4, 0x01B2, 0x01B2, 0x01AF, 0x01AF,
+    0x01AF, 0x01AF, 0x01B2, 0x01B2, 0x01B2, 0x01AF, 0x01B1, 0x01B1, 0x01B1, 0x01AF, 0x01AF, 0x01B1,
+    0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01AF, 0x01AF, 0x01AF, 0x01B2, 0x01B2, 0x01B2,
+    0x01B2, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF,
+    0x01AF, 0x01AF, 0x01B2, 0x01B1, 0x01B4, 0x01B2, 0x01B2, 0x01B1, 0x01B1, 0x01B1, 0x01B1, 0x01B1,
+    0x01B1, 0x01B9, 0x01AF, 0x01B1, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7,
+    0x01B7, 0x01B7, 0x01B1, 0x01B1, 0x01B1, 0x01B2, 0x01BA, 0x01BA, 0x01BB, 0x01BB, 0x01BB, 0x01BB,
+    0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB,
+    0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x01BB, 0x008A, 0x01BB, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x01BB, 0x008A, 0x008A, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC,
+    0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC,
+    0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x01BC, 0x0006, 0x01BD, 0x01BC, 0x01BC, 0x01BC,
+    0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE,
+    0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BF, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0, 0x01C0,
+    0x01C0, 0x01C0, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF,
+    0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF,
+    0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF, 0x01BF,
+    0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1,
+    0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1, 0x01C1,
+    0x01C1, 0x01C1, 0x01C1, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2,
+    0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2,
+    0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x008A, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A,
+    0x01C3, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A, 0x008A, 0x01C3, 0x008A, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x008A, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A,
+    0x01C3, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A, 0x008A, 0x01C4, 0x01C4, 0x01C4,
+    0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C5, 0x01C6, 0x01C6, 0x01C6,
+    0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6,
+    0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x01C6, 0x008A, 0x008A, 0x008A, 0x01C7, 0x01C7, 0x01C7, 0x01C7,
+    0x01C7, 0x01C7, 0x01C7, 0x01C7, 0x01C7, 0x01C7, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C8,
+    0x01C8, 0x01C8, 0x01C8, 0x01C8, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x01C9, 0x008A, 0x008A,
+    0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x01CA, 0x008A, 0x008A, 0x01CB, 0x01CC, 0x01CC, 0x01CC,
+    0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC,
+    0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC,
+    0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC,
+    0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CD, 0x01CE, 0x01CC, 0x01CF, 0x01D0, 0x01D0, 0x01D0,
+    0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0,
+    0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D0, 0x01D1,
+    0x01D2, 0x008A, 0x008A, 0x008A, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3,
+    0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3,
+    0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x0006, 0x0006, 0x0006, 0x01D4, 0x01D4,
+    0x01D4, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x01D3, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5,
+    0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D5, 0x01D6, 0x01D6,
+    0x01D7, 0x01D8, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01D5,
+    0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9,
+    0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01D9, 0x01DA, 0x01DA, 0x01DB, 0x0006, 0x0006, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01DC, 0x01DC, 0x01DC, 0x01DC,
+    0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC, 0x01DC,
+    0x01DC, 0x01DC, 0x01DD, 0x01DD, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x01DE,
+    0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x01DE, 0x008A, 0x01DE, 0x01DE, 0x01DE, 0x008A, 0x01DF, 0x01DF,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0,
+    0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E0, 0x01E1, 0x01E1, 0x01E2, 0x01E1,
+    0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E2, 0x01E2, 0x01E2, 0x01E2, 0x01E2, 0x01E2,
+    0x01E2, 0x01E2, 0x01E1, 0x01E2, 0x01E2, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1, 0x01E1,
+    0x01E1, 0x01E1, 0x01E3, 0x01E1, 0x01E4, 0x01E4, 0x01E4, 0x01E5, 0x01E4, 0x01E4, 0x01E4, 0x01E6,
+    0x01E0, 0x01E7, 0x008A, 0x008A, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8, 0x01E8,
+    0x01E8, 0x01E8, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01E9, 0x01E9, 0x01E9, 0x01E9,
+    0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x01E9, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x01EA, 0x01EA, 0x0006, 0x0006, 0x01EA, 0x0006, 0x01EB, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EC,
+    0x01EC, 0x01EC, 0x01ED, 0x01EC, 0x01EE, 0x01EE, 0x01EE, 0x01EE, 0x01EE, 0x01EE, 0x01EE, 0x01EE,
+    0x01EE, 0x01EE, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01EF, 0x01EF, 0x01EF, 0x01EF,
+    0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF,
+    0x01EF, 0x01EF, 0x01EF, 0x01F0, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF,
+    0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF,
+    0x01EF, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01EF, 0x01EF, 0x01EF, 0x01EF,
+    0x01EF, 0x01EC, 0x01EC, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF,
+    0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01EF, 0x01F1, 0x01EF, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x01CC, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01F2, 0x01F2, 0x01F2, 0x01F2,
+    0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2,
+    0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2, 0x01F2,
+    0x01F2, 0x01F2, 0x01F2, 0x008A, 0x01F3, 0x01F3, 0x01F3, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F3,
+    0x01F3, 0x01F4, 0x01F4, 0x01F4, 0x008A, 0x008A, 0x008A, 0x008A, 0x01F4, 0x01F4, 0x01F3, 0x01F4,
+    0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F4, 0x01F5, 0x01F6, 0x01F7, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x01F8, 0x008A, 0x008A, 0x008A, 0x01F9, 0x01F9, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FA,
+    0x01FA, 0x01FA, 0x01FA, 0x01FA, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB,
+    0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB,
+    0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x008A, 0x008A,
+    0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x01FB, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC,
+    0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC,
+    0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x01FC, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD, 0x01FD,
+    0x01FD, 0x01FD, 0x01FE, 0x008A, 0x008A, 0x008A, 0x01FF, 0x01FF, 0x0200, 0x0200, 0x0200, 0x0200,
+    0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200,
+    0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201,
+    0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0201, 0x0202,
+    0x0203, 0x0204, 0x0204, 0x0205, 0x008A, 0x008A, 0x0206, 0x0206, 0x0207, 0x0207, 0x0207, 0x0207,
+    0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0207,
+    0x0207, 0x0207, 0x0207, 0x0207, 0x0207, 0x0208, 0x0209, 0x0208, 0x0209, 0x0209, 0x0209, 0x0209,
+    0x0209, 0x0209, 0x0209, 0x008A, 0x020A, 0x020B, 0x0209, 0x020B, 0x020B, 0x0209, 0x0209, 0x0209,
+    0x0209, 0x0209, 0x0209, 0x0209, 0x0209, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0208, 0x0209,
+    0x0209, 0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x020C, 0x008A, 0x008A, 0x020D,
+    0x020E, 0x020E, 0x020E, 0x020E, 0x020E, 0x020E, 0x020E, 0x020E, 0x020E, 0x020E, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x020F, 0x020F, 0x020F, 0x020F, 0x020F, 0x020F, 0x020F, 0x0210,
+    0x020F, 0x020F, 0x020F, 0x020F, 0x020F, 0x020F, 0x008A, 0x008A, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0078, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x0078, 0x0078, 0x007A, 0x0211, 0x007A,
+    0x007A, 0x0078, 0x0078, 0x007A, 0x007A, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x007A, 0x0078,
+    0x0078, 0x0078, 0x0078, 0x008A, 0x0212, 0x0212, 0x0212, 0x0212, 0x0213, 0x0214, 0x0215, 0x0214,
+    0x0215, 0x0214, 0x0215, 0x0214, 0x0215, 0x0214, 0x0215, 0x0214, 0x0214, 0x0214, 0x0215, 0x0214,
+    0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214,
+    0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214,
+    0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0216, 0x0217, 0x0212, 0x0212,
+    0x0212, 0x0212, 0x0212, 0x0218, 0x0212, 0x0218, 0x0213, 0x0213, 0x0218, 0x0218, 0x0212, 0x0218,
+    0x0219, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x0214, 0x008A, 0x008A, 0x008A,
+    0x021A, 0x021A, 0x021A, 0x021A, 0x021A, 0x021A, 0x021A, 0x021A, 0x021A, 0x021A, 0x021B, 0x021B,
+    0x021B, 0x021B, 0x021B, 0x021B, 0x021B, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C,
+    0x021C, 0x021C, 0x021C, 0x021D, 0x021E, 0x021D, 0x021D, 0x021D, 0x021D, 0x021D, 0x021D, 0x021D,
+    0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021C, 0x021B, 0x021B, 0x008A,
+    0x021F, 0x021F, 0x0220, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221,
+    0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221,
+    0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0221, 0x0220, 0x021F, 0x021F,
+    0x021F, 0x021F, 0x0220, 0x0220, 0x021F, 0x021F, 0x0222, 0x0223, 0x021F, 0x021F, 0x0221, 0x0221,
+    0x0224, 0x0224, 0x0224, 0x0224, 0x0224, 0x0224, 0x0224, 0x0224, 0x0224, 0x0224, 0x0221, 0x0221,
+    0x0221, 0x0221, 0x0221, 0x0221, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225,
+    0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225, 0x0225,
+    0x0225, 0x0225, 0x0226, 0x0227, 0x0228, 0x0228, 0x0227, 0x0227, 0x0227, 0x0228, 0x0227, 0x0228,
+    0x0228, 0x0228, 0x0229, 0x0229, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x022A, 0x022A, 0x022A, 0x022A, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B,
+    0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B, 0x022B,
+    0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022C, 0x022D, 0x022D, 0x022D, 0x022D,
+    0x022D, 0x022D, 0x022D, 0x022D, 0x022C, 0x022C, 0x022D, 0x022E, 0x008A, 0x008A, 0x008A, 0x022F,
+    0x022F, 0x022F, 0x022F, 0x022F, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230, 0x0230,
+    0x0230, 0x0230, 0x008A, 0x008A, 0x008A, 0x022B, 0x022B, 0x022B, 0x0231, 0x0231, 0x0231, 0x0231,
+    0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0231, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232,
+    0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232,
+    0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232, 0x0232,
+    0x0233, 0x0233, 0x0233, 0x0233, 0x0233, 0x0233, 0x0234, 0x0234, 0x0235, 0x0236, 0x0237, 0x0238,
+    0x0238, 0x0239, 0x023A, 0x023B, 0x023C, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D,
+    0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D, 0x023D,
+    0x023D, 0x023D, 0x023D, 0x008A, 0x008A, 0x023D, 0x023D, 0x023D, 0x023E, 0x023E, 0x023E, 0x023E,
+    0x023E, 0x023E, 0x023E, 0x023E, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0078, 0x0078, 0x0078, 0x0006, 0x007F, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x0078, 0x0078,
+    0x007A, 0x007A, 0x007A, 0x007A, 0x0078, 0x023F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F, 0x007F,
+    0x007F, 0x0240, 0x0240, 0x0240, 0x0240, 0x007A, 0x0240, 0x0240, 0x0240, 0x0240, 0x0240, 0x0240,
+    0x0078, 0x0240, 0x0240, 0x023F, 0x0078, 0x0078, 0x0240, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x00B3, 0x0241,
+    0x0072, 0x0072, 0x0072, 0x0242, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0242, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0242, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x008B, 0x008B, 0x008B, 0x008B, 0x008B, 0x0072, 0x0072, 0x0072, 0x0072, 0x008B, 0x008B,
+    0x008B, 0x008B, 0x008B, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x0243, 0x0244, 0x002D, 0x002D, 0x002D, 0x0245, 0x002D, 0x002D,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x002D, 0x0246, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x002D, 0x002D, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x008B, 0x0078, 0x0078, 0x007A, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0078, 0x0078, 0x007A, 0x0078, 0x0078, 0x0085, 0x0247, 0x007A, 0x007C, 0x0078, 0x0078, 0x0078,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x0079, 0x0248,
+    0x0248, 0x007A, 0x0249, 0x0078, 0x0084, 0x007A, 0x0078, 0x007A, 0x0025, 0x0026, 0x0025, 0x0026,
+    0x0025, 0x0026, 0x024A, 0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x002D, 0x002D, 0x0250, 0x002D,
+    0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0025, 0x0026, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251, 0x0251,
+    0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0251, 0x0251, 0x0251, 0x0251,
+    0x0251, 0x0251, 0x008A, 0x008A, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x0252, 0x008A, 0x008A,
+    0x0253, 0x0251, 0x0254, 0x0251, 0x0255, 0x0251, 0x0256, 0x0251, 0x008A, 0x0252, 0x008A, 0x0252,
+    0x008A, 0x0252, 0x008A, 0x0252, 0x0257, 0x0258, 0x0259, 0x025A, 0x0259, 0x025A, 0x025B, 0x025C,
+    0x025D, 0x025E, 0x025F, 0x0260, 0x0261, 0x0262, 0x008A, 0x008A, 0x0263, 0x0264, 0x0265, 0x0266,
+    0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270, 0x0271, 0x0272,
+    0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E,
+    0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287, 0x0288, 0x0289, 0x028A,
+    0x028B, 0x028C, 0x028D, 0x028E, 0x028F, 0x0290, 0x0291, 0x0292, 0x0251, 0x0251, 0x0293, 0x0294,
+    0x0295, 0x008A, 0x0296, 0x0297, 0x0252, 0x0252, 0x0298, 0x0299, 0x029A, 0x008F, 0x029B, 0x008F,
+    0x008F, 0x029C, 0x029D, 0x029E, 0x029F, 0x008A, 0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A2, 0x02A3,
+    0x02A4, 0x029C, 0x029C, 0x029C, 0x0251, 0x0251, 0x02A5, 0x02A6, 0x008A, 0x008A, 0x02A7, 0x02A8,
+    0x0252, 0x0252, 0x02A9, 0x02AA, 0x008A, 0x029C, 0x029C, 0x029C, 0x0251, 0x0251, 0x02AB, 0x02AC,
+    0x02AD, 0x02AE, 0x02AF, 0x02B0, 0x0252, 0x0252, 0x02B1, 0x02B2, 0x02B3, 0x029C, 0x02B4, 0x02B4,
+    0x008A, 0x008A, 0x02B5, 0x02B6, 0x02B7, 0x008A, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD,
+    0x02BE, 0x02B4, 0x008F, 0x008A, 0x02BF, 0x02BF, 0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x02C0, 0x0017,
+    0x02C0, 0x02C0, 0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C4, 0x000F, 0x02C5, 0x000F, 0x000F,
+    0x000F, 0x000F, 0x0006, 0x02C6, 0x02C7, 0x02C8, 0x000B, 0x001C, 0x001C, 0x0020, 0x000B, 0x001C,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x02C9, 0x02C6, 0x02C6, 0x0012, 0x02CA, 0x02CB, 0x02C4, 0x02C4,
+    0x02C4, 0x02C4, 0x02C4, 0x02CC, 0x0006, 0x0006, 0x0006, 0x02C6, 0x02C6, 0x0006, 0x02C6, 0x02C6,
+    0x0006, 0x001C, 0x0020, 0x0006, 0x02CD, 0x0006, 0x02C6, 0x0015, 0x0015, 0x0006, 0x0006, 0x0006,
+    0x02CE, 0x000B, 0x000C, 0x02C6, 0x02C6, 0x02CD, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x000D, 0x0006, 0x0015, 0x0006, 0x0006, 0x02C6, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x02C0, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02CF, 0x02C4, 0x02C4,
+    0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x001E, 0x0072, 0x008A, 0x008A,
+    0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x02D0, 0x02D0, 0x02D0, 0x02D1, 0x02D2, 0x0072,
+    0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x02D0, 0x02D0,
+    0x02D0, 0x02D1, 0x02D2, 0x008A, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x008A, 0x008A, 0x008A, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x0009, 0x0009, 0x0009, 0x0009, 0x02D3, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0078, 0x0078, 0x007F, 0x007F,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x007F, 0x007F, 0x007F, 0x0078, 0x0078, 0x0211, 0x0211, 0x0211,
+    0x0211, 0x0078, 0x0211, 0x0211, 0x0211, 0x007F, 0x007F, 0x0078, 0x007A, 0x0078, 0x007F, 0x007F,
+    0x007A, 0x007A, 0x007A, 0x007A, 0x0078, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x02D4, 0x02D4, 0x02D5, 0x02D4,
+    0x0018, 0x02D4, 0x02D4, 0x02D5, 0x0018, 0x02D4, 0x02D6, 0x02D5, 0x02D5, 0x02D5, 0x02D6, 0x02D6,
+    0x02D5, 0x02D5, 0x02D5, 0x02D6, 0x0018, 0x02D5, 0x02D4, 0x0018, 0x000D, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x0018, 0x0018, 0x02D4, 0x02D4, 0x02D7, 0x0018, 0x02D5, 0x0018, 0x02D8, 0x0018,
+    0x02D5, 0x0018, 0x02D9, 0x02DA, 0x02D5, 0x02D5, 0x0018, 0x02D6, 0x02D5, 0x02D5, 0x02DB, 0x02D5,
+    0x02D6, 0x02DC, 0x02DC, 0x02DC, 0x02DC, 0x02DD, 0x0018, 0x02D4, 0x02D6, 0x02D6, 0x02D5, 0x02D5,
+    0x02D0, 0x000D, 0x000D, 0x000D, 0x000D, 0x02D5, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x0018, 0x000D,
+    0x0018, 0x0018, 0x02DE, 0x0018, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E,
+    0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x02DF, 0x02DF, 0x02DF, 0x02DF,
+    0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF, 0x02DF,
+    0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E0,
+    0x02E0, 0x02E0, 0x02E0, 0x02E0, 0x02E1, 0x02E1, 0x02E1, 0x0027, 0x0028, 0x02E1, 0x02E1, 0x02E1,
+    0x02E1, 0x001E, 0x0018, 0x0018, 0x008A, 0x008A, 0x008A, 0x008A, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x02E2, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x02E3, 0x02E3, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x000D, 0x0018, 0x0018, 0x000D, 0x0018, 0x0018, 0x000D, 0x0018, 0x0018, 0x001A, 0x001A, 0x0018,
+    0x0018, 0x0018, 0x02E3, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E4, 0x02E3, 0x02E3,
+    0x0018, 0x0018, 0x000D, 0x0018, 0x000D, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x02E3, 0x000D, 0x000D, 0x000D, 0x000D, 0x02E3, 0x000D, 0x000D, 0x02E3, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x02E3, 0x000D, 0x02E3, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x02D0, 0x02D0, 0x000D, 0x02D0, 0x02D0, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x02E3, 0x000D, 0x000D, 0x02E3, 0x000D, 0x000D, 0x02E3, 0x000D, 0x02E3, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x02E3, 0x000D, 0x02E3, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x000D, 0x000D,
+    0x02E3, 0x02E3, 0x000D, 0x000D, 0x02E3, 0x02E3, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x02E3, 0x02E3, 0x02E3, 0x02E3, 0x000D, 0x000D, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x000B, 0x000C, 0x000B, 0x000C, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x02E5,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x000D, 0x000D, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x001A, 0x02E6, 0x02E7, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x000D, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E8, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x001A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x001A, 0x001A, 0x001A,
+    0x02E5, 0x001A, 0x001A, 0x02E5, 0x0018, 0x0018, 0x0018, 0x0018, 0x001A, 0x001A, 0x001A, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E,
+    0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4,
+    0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4,
+    0x02D4, 0x02D4, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9,
+    0x02E9, 0x02E9, 0x02EA, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02E9,
+    0x02E9, 0x02E9, 0x02E9, 0x02E9, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB,
+    0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB,
+    0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x02EB, 0x001E, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x001A, 0x001A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x001A, 0x000D, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x001A, 0x000D, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x000D, 0x000D, 0x000D, 0x02E2, 0x02E2, 0x02ED, 0x02ED, 0x000D, 0x001A, 0x001A, 0x001A, 0x001A,
+    0x001A, 0x02E8, 0x0018, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x02E8,
+    0x02E8, 0x001A, 0x02E8, 0x0018, 0x02E5, 0x02E5, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x02E8,
+    0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x001A, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x001A,
+    0x02E8, 0x001A, 0x001A, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02EE,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A,
+    0x02E8, 0x02E8, 0x001A, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E8, 0x02E8, 0x001A, 0x02E5,
+    0x001A, 0x001A, 0x001A, 0x001A, 0x02E8, 0x001A, 0x02E8, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x02E8,
+    0x001A, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E5, 0x02E5,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E5, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E5, 0x02E5, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E5, 0x001A,
+    0x02E8, 0x001A, 0x02E8, 0x001A, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x001A, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x02E5, 0x02E5,
+    0x001A, 0x02E5, 0x02E8, 0x001A, 0x001A, 0x001A, 0x02E5, 0x02E8, 0x02E8, 0x02E5, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E5, 0x0018, 0x0018, 0x001A, 0x001A, 0x02E5, 0x02E5,
+    0x001A, 0x001A, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x0018, 0x001A, 0x0018, 0x001A, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x001A, 0x0018, 0x0018, 0x0018, 0x001A, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x001A, 0x001A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x001A, 0x0018, 0x0018, 0x001A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x0018, 0x02E5, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E5,
+    0x02E5, 0x02E5, 0x0018, 0x02E5, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x000B, 0x000C, 0x000B, 0x000C,
+    0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x0018, 0x02E5, 0x02E5, 0x02E5, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x001A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000B, 0x000C, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C,
+    0x000B, 0x000C, 0x000B, 0x000C, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF,
+    0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x02EF, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x02E2, 0x02E2, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B,
+    0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B,
+    0x000C, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000B, 0x000C, 0x000B, 0x000C, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000B, 0x000C, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x02D0, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x02D0, 0x02D0, 0x02D0, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x02F0, 0x000D, 0x000D, 0x000D, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x001A, 0x001A, 0x001A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x02E5, 0x0018, 0x0018, 0x0018,
+    0x000D, 0x000D, 0x000D, 0x000D, 0x000D, 0x0018, 0x0018, 0x000D, 0x000D, 0x000D, 0x000D, 0x000D,
+    0x000D, 0x0018, 0x0018, 0x0018, 0x02E5, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x008A, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1,
+    0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F1, 0x02F2, 0x02F2, 0x02F2, 0x02F2,
+    0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2, 0x02F2,
+    0x0027, 0x0028, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027,
+    0x0028, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x002D, 0x0027, 0x0028, 0x002D, 0x0027, 0x0028, 0x002D,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x0072, 0x0072, 0x02FC, 0x02FC, 0x00A9, 0x00AA, 0x00A9, 0x00AA,
+    0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x00A9, 0x00AA,
+    0x00A9, 0x00AA, 0x00A9, 0x00AA, 0x02FD, 0x02FE, 0x02FE, 0x02FE, 0x02FE, 0x02FE, 0x02FE, 0x00A9,
+    0x00AA, 0x00A9, 0x00AA, 0x02FF, 0x02FF, 0x02FF, 0x00A9, 0x00AA, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x0300, 0x0300, 0x0300, 0x0300, 0x0301, 0x0300, 0x0300, 0x0302, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302,
+    0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x0302, 0x008A, 0x0302, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x0302, 0x008A, 0x008A, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303,
+    0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303, 0x0303,
+    0x0303, 0x0303, 0x0303, 0x0303, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0304,
+    0x0305, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x0306, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A,
+    0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2,
+    0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x0006, 0x0006, 0x001C, 0x0020, 0x001C, 0x0020, 0x0006, 0x0006,
+    0x0006, 0x001C, 0x0020, 0x0006, 0x001C, 0x0020, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x000F, 0x0006, 0x0006, 0x000F, 0x0006, 0x001C, 0x0020, 0x0006, 0x0006,
+    0x001C, 0x0020, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0073, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0006, 0x0006, 0x000F, 0x000F, 0x0006, 0x0006, 0x0006, 0x0006, 0x000F, 0x0006, 0x000B, 0x0006,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0018, 0x0018, 0x0006, 0x0006, 0x0006, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B, 0x000C, 0x000B,
+    0x000C, 0x000F, 0x008A, 0x008A, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307,
+    0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307,
+    0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x0307, 0x008A, 0x0307, 0x0307, 0x0307, 0x0307, 0x0308,
+    0x0307, 0x0307, 0x0307, 0x0308, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308,
+    0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308, 0x0308,
+    0x0308, 0x0308, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x030A, 0x030B, 0x030B, 0x030B, 0x0309, 0x030C, 0x030D, 0x030E,
+    0x030F, 0x0310, 0x030F, 0x0310, 0x030F, 0x0310, 0x030F, 0x0310, 0x030F, 0x0310, 0x0309, 0x0309,
+    0x030F, 0x0310, 0x030F, 0x0310, 0x030F, 0x0310, 0x030F, 0x0310, 0x0311, 0x030F, 0x0310, 0x0310,
+    0x0309, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x030E, 0x0249, 0x0248,
+    0x0079, 0x0312, 0x0313, 0x0313, 0x0314, 0x0315, 0x0315, 0x0315, 0x0315, 0x0315, 0x0316, 0x0309,
+    0x0317, 0x0317, 0x0317, 0x030C, 0x0318, 0x0319, 0x0309, 0x0018, 0x008A, 0x031A, 0x031A, 0x031A,
+    0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031B, 0x031A, 0x031B, 0x031A,
+    0x031B, 0x031A, 0x031B, 0x031A, 0x031B, 0x031A, 0x031B, 0x031A, 0x031B, 0x031A, 0x031B, 0x031A,
+    0x031B, 0x031A, 0x031B, 0x031A, 0x031B, 0x031A, 0x031B, 0x031A, 0x031A, 0x031B, 0x031A, 0x031B,
+    0x031A, 0x031B, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031B, 0x031B, 0x031A, 0x031B,
+    0x031B, 0x031A, 0x031B, 0x031B, 0x031A, 0x031B, 0x031B, 0x031A, 0x031B, 0x031B, 0x031A, 0x031A,
+    0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A,
+    0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031B, 0x031A, 0x031A, 0x008A,
+    0x008A, 0x031C, 0x031C, 0x031D, 0x031D, 0x031E, 0x031F, 0x0320, 0x0321, 0x0322, 0x0322, 0x0322,
+    0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0323, 0x0322, 0x0323, 0x0322,
+    0x0323, 0x0322, 0x0323, 0x0322, 0x0323, 0x0322, 0x0323, 0x0322, 0x0323, 0x0322, 0x0323, 0x0322,
+    0x0323, 0x0322, 0x0323, 0x0322, 0x0323, 0x0322, 0x0323, 0x0322, 0x0322, 0x0323, 0x0322, 0x0323,
+    0x0322, 0x0323, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0323, 0x0323, 0x0322, 0x0323,
+    0x0323, 0x0322, 0x0323, 0x0323, 0x0322, 0x0323, 0x0323, 0x0322, 0x0323, 0x0323, 0x0322, 0x0322,
+    0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322,
+    0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0322, 0x0323, 0x0322, 0x0322, 0x0323,
+    0x0323, 0x0323, 0x0323, 0x030B, 0x0315, 0x0324, 0x0325, 0x0326, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327,
+    0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327, 0x0327,
+    0x0327, 0x0327, 0x0327, 0x0327, 0x008A, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328,
+    0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328,
+    0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328,
+    0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328, 0x0328,
+    0x0328, 0x0328, 0x0328, 0x008A, 0x0309, 0x0309, 0x0329, 0x0329, 0x0329, 0x0329, 0x0316, 0x0316,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0309, 0x0309, 0x0309, 0x0309,
+    0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309, 0x0309,
+    0x0309, 0x0309, 0x0309, 0x0309, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A,
+    0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A,
+    0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x008A,
+    0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0316, 0x0316,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x0316, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329, 0x0329,
+    0x0329, 0x0329, 0x0329, 0x0329, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A,
+    0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x032A, 0x0309, 0x0316, 0x0316, 0x0316, 0x0316,
+    0x0316, 0x0316, 0x0316, 0x032B, 0x0316, 0x032B, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+    0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C,
+    0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C,
+    0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x032C, 0x0316, 0x032C, 0x032C, 0x032C, 0x032C,
+    0x032C, 0x032C, 0x032C, 0x032C, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+    0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D,
+    0x032D, 0x032D, 0x032D, 0x032D, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E,
+    0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E,
+    0x032E, 0x032F, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E,
+    0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E, 0x032E,
+    0x032E, 0x008A, 0x008A, 0x008A, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+    0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330, 0x0330,
+    0x0330, 0x0330, 0x0330, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331, 0x0331,
+    0x0332, 0x0332, 0x0332, 0x0332, 0x0332, 0x0332, 0x0333, 0x0333, 0x0334, 0x0334, 0x0334, 0x0334,
+    0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334,
+    0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334, 0x0334,
+    0x0335, 0x0336, 0x0336, 0x0336, 0x0337, 0x0337, 0x0337, 0x0337, 0x0337, 0x0337, 0x0337, 0x0337,
+    0x0337, 0x0337, 0x0334, 0x0334, 0x008A, 0x008A, 0x008A, 0x008A, 0x00BD, 0x00BE, 0x00BD, 0x00BE,
+    0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x0338, 0x00C2,
+    0x00C3, 0x00C3, 0x00C3, 0x0339, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2, 0x00C2,
+    0x00C2, 0x00C2, 0x0339, 0x033A, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x00BD, 0x00BE,
+    0x00BD, 0x00BE, 0x00BD, 0x00BE, 0x0243, 0x0243, 0x00C2, 0x00C2, 0x033B, 0x033B, 0x033B, 0x033B,
+    0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B,
+    0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033C, 0x033C, 0x033C, 0x033C, 0x033C, 0x033C,
+    0x033C, 0x033C, 0x033C, 0x033C, 0x033D, 0x033D, 0x033E, 0x033E, 0x033E, 0x033E, 0x033E, 0x033E,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075,
+    0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0075, 0x0073, 0x0073, 0x0073, 0x0073, 0x0073,
+    0x0073, 0x0073, 0x0073, 0x0073, 0x0075, 0x0075, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x002D, 0x002D, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0072, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x0027, 0x0028, 0x0027, 0x0028, 0x033F, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0073, 0x0075, 0x0075, 0x0027, 0x0028, 0x0340, 0x002D, 0x0043,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0341, 0x002D, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0342, 0x0343, 0x0344, 0x0345, 0x0342, 0x002D, 0x0346, 0x0347, 0x0348, 0x0349,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x0027, 0x0028, 0x034A, 0x034B, 0x034C, 0x0027, 0x0028, 0x0027, 0x0028, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0027, 0x0028, 0x008A, 0x002D, 0x008A, 0x002D, 0x0027, 0x0028,
+    0x0027, 0x0028, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x034D, 0x034D,
+    0x034D, 0x0027, 0x0028, 0x0043, 0x0072, 0x0072, 0x002D, 0x0043, 0x0043, 0x0043, 0x0043, 0x0043,
+    0x034E, 0x034E, 0x034F, 0x034E, 0x034E, 0x034E, 0x0350, 0x034E, 0x034E, 0x034E, 0x034E, 0x034F,
+    0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E,
+    0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x034E, 0x0351,
+    0x0351, 0x034F, 0x034F, 0x0351, 0x0352, 0x0352, 0x0352, 0x0352, 0x0350, 0x008A, 0x008A, 0x008A,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x0018, 0x0018, 0x0009, 0x0018, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353,
+    0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353, 0x0353,
+    0x0354, 0x0354, 0x0354, 0x0354, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0355, 0x0355, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356,
+    0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356,
+    0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356, 0x0356,
+    0x0355, 0x0355, 0x0355, 0x0355, 0x0355, 0x0355, 0x0355, 0x0355, 0x0355, 0x0355, 0x0355, 0x0355,
+    0x0355, 0x0355, 0x0355, 0x0355, 0x0357, 0x0358, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x0359, 0x0359, 0x035A, 0x035A, 0x035A, 0x035A, 0x035A, 0x035A, 0x035A, 0x035A,
+    0x035A, 0x035A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x035B, 0x035B, 0x035B, 0x035B,
+    0x035B, 0x035B, 0x035B, 0x035B, 0x035B, 0x035B, 0x035B, 0x035B, 0x035B, 0x035B, 0x035B, 0x035B,
+    0x035B, 0x035B, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x0125, 0x012B, 0x012B, 0x012B, 0x0125,
+    0x012B, 0x0125, 0x0125, 0x0123, 0x035C, 0x035C, 0x035C, 0x035C, 0x035C, 0x035C, 0x035C, 0x035C,
+    0x035C, 0x035C, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D,
+    0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D,
+    0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035D, 0x035E, 0x035E, 0x035E, 0x035E, 0x035E, 0x035F,
+    0x035F, 0x035F, 0x0006, 0x0360, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361,
+    0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361, 0x0361,
+    0x0361, 0x0361, 0x0361, 0x0362, 0x0362, 0x0362, 0x0362, 0x0362, 0x0362, 0x0362, 0x0362, 0x0362,
+    0x0362, 0x0362, 0x0363, 0x0364, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x0365, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE,
+    0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x01BE, 0x008A, 0x008A, 0x008A, 0x0366, 0x0366, 0x0366, 0x0367,
+    0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368,
+    0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368,
+    0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0368, 0x0369, 0x0367, 0x0367, 0x0366, 0x0366,
+    0x0366, 0x0366, 0x0367, 0x0367, 0x0366, 0x0366, 0x0367, 0x0367, 0x036A, 0x036B, 0x036B, 0x036B,
+    0x036B, 0x036B, 0x036B, 0x036B, 0x036B, 0x036B, 0x036B, 0x036B, 0x036B, 0x036B, 0x008A, 0x0073,
+    0x036C, 0x036C, 0x036C, 0x036C, 0x036C, 0x036C, 0x036C, 0x036C, 0x036C, 0x036C, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x036B, 0x036B, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01B2, 0x036D, 0x01AF,
+    0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01B7, 0x01B7, 0x01B7, 0x01B7,
+    0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01B7, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x01AF, 0x008A,
+    0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E,
+    0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E,
+    0x036E, 0x036F, 0x036F, 0x036F, 0x036F, 0x036F, 0x036F, 0x0370, 0x0370, 0x036F, 0x036F, 0x0370,
+    0x0370, 0x036F, 0x036F, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x036E, 0x036E, 0x036E, 0x036F, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E, 0x036E,
+    0x036F, 0x0370, 0x008A, 0x008A, 0x0371, 0x0371, 0x0371, 0x0371, 0x0371, 0x0371, 0x0371, 0x0371,
+    0x0371, 0x0371, 0x008A, 0x008A, 0x0372, 0x0372, 0x0372, 0x0372, 0x036D, 0x01AF, 0x01AF, 0x01AF,
+    0x01AF, 0x01AF, 0x01AF, 0x01BA, 0x01BA, 0x01BA, 0x01AF, 0x01B1, 0x01B2, 0x01B1, 0x01AF, 0x01AF,
+    0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373,
+    0x0373, 0x0373, 0x0373, 0x0373, 0x0374, 0x0373, 0x0374, 0x0374, 0x0375, 0x0373, 0x0373, 0x0374,
+    0x0374, 0x0373, 0x0373, 0x0373, 0x0373, 0x0373, 0x0374, 0x0374, 0x0373, 0x0374, 0x0373, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0373,
+    0x0373, 0x0376, 0x0377, 0x0377, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378,
+    0x0378, 0x0378, 0x0378, 0x0379, 0x037A, 0x037A, 0x0379, 0x0379, 0x037B, 0x037B, 0x0378, 0x037C,
+    0x037C, 0x0379, 0x037D, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A, 0x008A, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x008A, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x002D, 0x002D, 0x002D, 0x037E,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x0075, 0x0072, 0x0072, 0x0072, 0x0072,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x00B3, 0x002D, 0x002D, 0x002D, 0x034D, 0x0014, 0x0014,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x037F, 0x037F, 0x037F, 0x037F, 0x037F, 0x037F, 0x037F, 0x037F,
+    0x037F, 0x037F, 0x037F, 0x037F, 0x037F, 0x037F, 0x037F, 0x037F, 0x0378, 0x0378, 0x0378, 0x0378,
+    0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378, 0x0378,
+    0x0378, 0x0378, 0x0378, 0x0379, 0x0379, 0x037A, 0x0379, 0x0379, 0x037A, 0x0379, 0x0379, 0x037B,
+    0x0379, 0x037D, 0x008A, 0x008A, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380, 0x0380,
+    0x0380, 0x0380, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0381, 0x0382, 0x0382, 0x0382,
+    0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382,
+    0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382,
+    0x0381, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382,
+    0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382,
+    0x0382, 0x0382, 0x0382, 0x0382, 0x0381, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382,
+    0x0382, 0x0382, 0x0382, 0x0382, 0x0381, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382,
+    0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x0382, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x01BF, 0x01BF, 0x01BF, 0x01BF,
+    0x01BF, 0x01BF, 0x01BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2,
+    0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2, 0x01C2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0383, 0x0383, 0x0383, 0x0383, 0x0383, 0x0383, 0x0383, 0x0383,
+    0x0383, 0x0383, 0x0383, 0x0383, 0x0383, 0x0383, 0x0383, 0x0383, 0x0384, 0x0384, 0x0384, 0x0384,
+    0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384,
+    0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385,
+    0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385,
+    0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x032D, 0x032D, 0x0385, 0x032D, 0x0385, 0x032D,
+    0x032D, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x032D,
+    0x0385, 0x032D, 0x0385, 0x032D, 0x032D, 0x0385, 0x0385, 0x032D, 0x032D, 0x032D, 0x0385, 0x0385,
+    0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385,
+    0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0386, 0x0386, 0x0385, 0x0385, 0x0385, 0x0385,
+    0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0385, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386,
+    0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386,
+    0x0386, 0x0386, 0x0386, 0x0386, 0x0387, 0x0388, 0x0389, 0x038A, 0x038B, 0x038C, 0x038C, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x038D,
+    0x038E, 0x038F, 0x0390, 0x0391, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0392, 0x0393, 0x0392,
+    0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0394, 0x0395, 0x0392, 0x0392,
+    0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x008A,
+    0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x008A, 0x0392, 0x008A, 0x0392, 0x0392, 0x008A, 0x0392,
+    0x0392, 0x008A, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0392, 0x0394,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F,
+    0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x011F, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x000C, 0x000B, 0x00F1, 0x00F1, 0x00F1, 0x00F1,
+    0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1, 0x00F1,
+    0x008A, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x00F1, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0396, 0x00F1, 0x00F1, 0x00F1,
+    0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+    0x0083, 0x0083, 0x0083, 0x0083, 0x0397, 0x0398, 0x0398, 0x0399, 0x0397, 0x0398, 0x0398, 0x039A,
+    0x039B, 0x0398, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0078, 0x0078, 0x0078, 0x0078,
+    0x0078, 0x0078, 0x0078, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A, 0x00C2, 0x00C2,
+    0x0398, 0x039C, 0x039C, 0x039D, 0x039D, 0x039A, 0x039B, 0x039A, 0x039B, 0x039A, 0x039B, 0x039A,
+    0x039B, 0x039A, 0x039B, 0x039A, 0x039B, 0x039A, 0x039B, 0x039A, 0x039B, 0x030B, 0x030B, 0x039A,
+    0x039B, 0x0398, 0x0398, 0x0398, 0x0398, 0x039D, 0x039D, 0x039D, 0x0397, 0x0398, 0x039E, 0x008A,
+    0x0397, 0x0399, 0x0398, 0x0398, 0x039C, 0x039A, 0x039B, 0x039A, 0x039B, 0x039A, 0x039B, 0x0398,
+    0x0398, 0x0398, 0x039F, 0x039C, 0x039F, 0x039F, 0x039F, 0x008A, 0x0398, 0x03A0, 0x0398, 0x0398,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0105, 0x0105, 0x0105, 0x00F7, 0x0105, 0x008A, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x008A, 0x02C4,
+    0x008A, 0x0398, 0x0398, 0x0398, 0x03A0, 0x0398, 0x0398, 0x039E, 0x039A, 0x039B, 0x0398, 0x039F,
+    0x0397, 0x039C, 0x039E, 0x0398, 0x03A1, 0x03A1, 0x03A1, 0x03A1, 0x03A1, 0x03A1, 0x03A1, 0x03A1,
+    0x03A1, 0x03A1, 0x0399, 0x0397, 0x039F, 0x039F, 0x039F, 0x0398, 0x0398, 0x03A2, 0x03A2, 0x03A2,
+    0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2,
+    0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x03A2, 0x039A,
+    0x0398, 0x039B, 0x03A3, 0x039D, 0x03A3, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4,
+    0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4,
+    0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x03A4, 0x039A, 0x039F, 0x039B, 0x039F, 0x039A,
+    0x039B, 0x02C6, 0x02D1, 0x02D2, 0x02C6, 0x02C6, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5,
+    0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A6, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5,
+    0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5,
+    0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5,
+    0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5, 0x03A5,
+    0x03A5, 0x03A5, 0x03A7, 0x03A7, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8,
+    0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8,
+    0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x008A,
+    0x008A, 0x008A, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x008A, 0x008A, 0x03A8, 0x03A8,
+    0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x008A, 0x008A, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8, 0x03A8,
+    0x008A, 0x008A, 0x03A8, 0x03A8, 0x03A8, 0x008A, 0x008A, 0x008A, 0x03A0, 0x03A0, 0x039F, 0x03A3,
+    0x0316, 0x03A0, 0x03A0, 0x008A, 0x02D4, 0x02D0, 0x02D0, 0x02D0, 0x02D0, 0x02D4, 0x02D4, 0x008A,
+    0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02C4, 0x02C4, 0x02C4,
+    0x0018, 0x0018, 0x008A, 0x008A, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
+    0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x008A, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
+    0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
+    0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x008A, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
+    0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
+    0x03A9, 0x03A9, 0x03A9, 0x008A, 0x03A9, 0x03A9, 0x008A, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9,
+    0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x008A, 0x008A,
+    0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x03A9, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0006, 0x0006, 0x0006, 0x008A, 0x008A, 0x008A, 0x008A, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x008A, 0x008A, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA,
+    0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AA, 0x03AB, 0x03AB, 0x03AB,
+    0x03AB, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC,
+    0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AB, 0x03AB, 0x03AC, 0x03AC, 0x03AC, 0x008A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x008A, 0x008A, 0x008A, 0x03AC, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x007A, 0x008A, 0x008A,
+    0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD,
+    0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD,
+    0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x03AD, 0x008A, 0x008A, 0x008A, 0x03AE, 0x03AE, 0x03AE, 0x03AE,
+    0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE, 0x03AE,
+    0x03AE, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x007A, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03AF,
+    0x03AF, 0x03AF, 0x03AF, 0x03AF, 0x03B0, 0x03B0, 0x03B0, 0x03B0, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03AF, 0x03AF, 0x03AF, 0x03B1, 0x03B1, 0x03B1, 0x03B1,
+    0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1,
+    0x03B1, 0x03B2, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B1, 0x03B2, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3,
+    0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3, 0x03B3,
+    0x03B3, 0x03B3, 0x03B4, 0x03B4, 0x03B4, 0x03B4, 0x03B4, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5,
+    0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5,
+    0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x03B5, 0x008A, 0x03B6, 0x03B7, 0x03B7, 0x03B7, 0x03B7,
+    0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B7,
+    0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x008A, 0x008A, 0x008A, 0x008A, 0x03B7, 0x03B7, 0x03B7, 0x03B7,
+    0x03B7, 0x03B7, 0x03B7, 0x03B7, 0x03B8, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x03B9, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03BA, 0x03BA, 0x03BA, 0x03BA,
+    0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA,
+    0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BA, 0x03BB, 0x03BB, 0x03BB, 0x03BB,
+    0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB,
+    0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BB, 0x03BC, 0x03BC, 0x03BC, 0x03BC,
+    0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC, 0x03BC,
+    0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD,
+    0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD,
+    0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x03BD, 0x008A, 0x008A, 0x03BE, 0x03BE, 0x03BE, 0x03BE,
+    0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x03BE, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF,
+    0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x03BF, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0,
+    0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0,
+    0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0, 0x03C0,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1,
+    0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x03C1,
+    0x03C1, 0x03C1, 0x03C1, 0x03C1, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2,
+    0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x03C2, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03C3, 0x03C4, 0x03C4, 0x03C4, 0x03C4,
+    0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x03C4, 0x008A, 0x03C4, 0x03C4, 0x03C4, 0x03C4,
+    0x03C4, 0x03C4, 0x03C4, 0x008A, 0x03C4, 0x03C4, 0x008A, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5,
+    0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x008A, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5,
+    0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x008A, 0x03C5,
+    0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x03C5, 0x008A, 0x03C5, 0x03C5, 0x008A, 0x008A, 0x008A,
+    0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6,
+    0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03C6, 0x03C6, 0x03C6, 0x03C6,
+    0x03C6, 0x03C6, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x03C6, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0242, 0x034D, 0x034D, 0x0072, 0x0072, 0x0072, 0x008A, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x008A, 0x0072, 0x0072,
+    0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x0072, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x008A, 0x008A, 0x03C7, 0x008A, 0x03C7, 0x03C7,
+    0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7,
+    0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7, 0x03C7,
+    0x03C7, 0x03C7, 0x008A, 0x03C7, 0x03C7, 0x008A, 0x008A, 0x008A, 0x03C7, 0x008A, 0x008A, 0x03C7,
+    0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8,
+    0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x03C8, 0x008A, 0x03C9,
+    0x03CA, 0x03CA, 0x03CA, 0x03CA, 0x03CA, 0x03CA, 0x03CA, 0x03CA, 0x03CB, 0x03CB, 0x03CB, 0x03CB,
+    0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB,
+    0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CB, 0x03CC, 0x03CC, 0x03CD, 0x03CD, 0x03CD,
+    0x03CD, 0x03CD, 0x03CD, 0x03CD, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE,
+    0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE,
+    0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x03CE, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03CF, 0x03CF, 0x03CF, 0x03CF, 0x03CF,
+    0x03CF, 0x03CF, 0x03CF, 0x03CF, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0,
+    0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x03D0, 0x008A,
+    0x03D0, 0x03D0, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03D1, 0x03D1, 0x03D1, 0x03D1, 0x03D1,
+    0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2,
+    0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D2, 0x03D3, 0x03D3,
+    0x03D3, 0x03D3, 0x03D3, 0x03D3, 0x008A, 0x008A, 0x008A, 0x03D4, 0x03D5, 0x03D5, 0x03D5, 0x03D5,
+    0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5,
+    0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x03D5, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x03D6, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7,
+    0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D7, 0x03D8, 0x03D8, 0x03D8, 0x03D8,
+    0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8,
+    0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x03D8, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03D9, 0x03D9, 0x03D8, 0x03D8, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9,
+    0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x008A, 0x008A, 0x03D9, 0x03D9,
+    0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9, 0x03D9,
+    0x03DA, 0x03DB, 0x03DB, 0x03DB, 0x008A, 0x03DB, 0x03DB, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03DB, 0x03DC, 0x03DB, 0x03DD, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x008A, 0x03DA, 0x03DA, 0x03DA,
+    0x008A, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA,
+    0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA,
+    0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x03DA, 0x008A, 0x008A, 0x03DD, 0x03DE, 0x03DC, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x03DF, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0, 0x03E0,
+    0x03E0, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03E1, 0x03E1, 0x03E1, 0x03E1,
+    0x03E1, 0x03E1, 0x03E1, 0x03E1, 0x03E1, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2,
+    0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2,
+    0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E2, 0x03E3, 0x03E3, 0x03E4, 0x03E5, 0x03E5, 0x03E5, 0x03E5,
+    0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5,
+    0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5, 0x03E5,
+    0x03E5, 0x03E6, 0x03E6, 0x03E6, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7,
+    0x03E8, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7,
+    0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7,
+    0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E7, 0x03E9, 0x03EA, 0x008A, 0x008A, 0x008A, 0x008A, 0x03EB,
+    0x03EB, 0x03EB, 0x03EB, 0x03EB, 0x03EC, 0x03EC, 0x03EC, 0x03EC, 0x03EC, 0x03EC, 0x03EC, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03ED, 0x03ED, 0x03ED, 0x03ED,
+    0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED,
+    0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x03ED, 0x008A, 0x008A, 0x008A, 0x03EE, 0x03EE, 0x03EE,
+    0x03EE, 0x03EE, 0x03EE, 0x03EE, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF,
+    0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF, 0x03EF,
+    0x03EF, 0x03EF, 0x008A, 0x008A, 0x03F0, 0x03F0, 0x03F0, 0x03F0, 0x03F0, 0x03F0, 0x03F0, 0x03F0,
+    0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1,
+    0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x03F1, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03F2, 0x03F2, 0x03F2, 0x03F2, 0x03F2, 0x03F2, 0x03F2, 0x03F2, 0x03F3, 0x03F3, 0x03F3, 0x03F3,
+    0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3, 0x03F3,
+    0x03F3, 0x03F3, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03F4, 0x03F4, 0x03F4,
+    0x03F4, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x03F5, 0x03F5, 0x03F5, 0x03F5, 0x03F5, 0x03F5, 0x03F5, 0x03F6, 0x03F6, 0x03F6, 0x03F6,
+    0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6,
+    0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x03F6, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7,
+    0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x03F7, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8,
+    0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x03F8, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x03F9, 0x03F9, 0x03F9, 0x03F9, 0x03F9, 0x03F9, 0x03FA, 0x03FA, 0x03FA, 0x03FA,
+    0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FA,
+    0x03FA, 0x03FA, 0x03FA, 0x03FA, 0x03FB, 0x03FB, 0x03FB, 0x03FB, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x03FC, 0x03FC, 0x03FC, 0x03FC, 0x03FC, 0x03FC, 0x03FC, 0x03FC,
+    0x03FC, 0x03FC, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x03FD, 0x03FD, 0x03FD, 0x03FD,
+    0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD,
+    0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD, 0x03FD,
+    0x03FD, 0x03FD, 0x03FD, 0x008A, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE,
+    0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE,
+    0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x03FE, 0x008A, 0x03FF, 0x03FF, 0x0400, 0x008A, 0x008A,
+    0x03FE, 0x03FE, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401,
+    0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401,
+    0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0401, 0x0402, 0x0402, 0x0402,
+    0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0402, 0x0401, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403,
+    0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403, 0x0403,
+    0x0403, 0x0403, 0x0404, 0x0404, 0x0405, 0x0405, 0x0405, 0x0404, 0x0405, 0x0404, 0x0404, 0x0404,
+    0x0404, 0x0406, 0x0406, 0x0406, 0x0406, 0x0407, 0x0407, 0x0407, 0x0407, 0x0407, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408,
+    0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0408, 0x0409, 0x040A,
+    0x0409, 0x040A, 0x040B, 0x040B, 0x040B, 0x040B, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C,
+    0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040C, 0x040D, 0x040D, 0x040D,
+    0x040D, 0x040D, 0x040D, 0x040D, 0x008A, 0x008A, 0x008A, 0x008A, 0x040E, 0x040E, 0x040E, 0x040E,
+    0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E,
+    0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x040E, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x040F, 0x0410, 0x040F, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411,
+    0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411,
+    0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411,
+    0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0411, 0x0410, 0x0410, 0x0410, 0x0410,
+    0x0410, 0x0410, 0x0410, 0x0410, 0x0410, 0x0410, 0x0410, 0x0410, 0x0410, 0x0410, 0x0412, 0x0413,
+    0x0413, 0x0413, 0x0413, 0x0413, 0x0413, 0x0413, 0x008A, 0x008A, 0x008A, 0x008A, 0x0414, 0x0414,
+    0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414,
+    0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0415, 0x0415, 0x0415, 0x0415, 0x0415, 0x0415,
+    0x0415, 0x0415, 0x0415, 0x0415, 0x0412, 0x0411, 0x0411, 0x0410, 0x0410, 0x0411, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0412, 0x0416, 0x0416, 0x0417, 0x0418,
+    0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418,
+    0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0419, 0x0418,
+    0x0419, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418, 0x0418,
+    0x0418, 0x0418, 0x0418, 0x0419, 0x0418, 0x0418, 0x0418, 0x0418, 0x0417, 0x0417, 0x0417, 0x0416,
+    0x0416, 0x0416, 0x0416, 0x0417, 0x0417, 0x041A, 0x041B, 0x041C, 0x041C, 0x041D, 0x041C, 0x041C,
+    0x041C, 0x041C, 0x0416, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x041D, 0x008A, 0x008A, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E,
+    0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x041E,
+    0x041E, 0x041E, 0x041E, 0x041E, 0x041E, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x041F, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0420, 0x0420, 0x0420, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421,
+    0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0421, 0x0422, 0x0423, 0x0423, 0x0423, 0x0423,
+    0x0424, 0x0423, 0x0425, 0x0425, 0x0423, 0x0423, 0x0423, 0x0426, 0x0426, 0x008A, 0x0427, 0x0427,
+    0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0427, 0x0428, 0x0428, 0x0428, 0x0428,
+    0x0421, 0x0424, 0x0424, 0x0421, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429,
+    0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x0429, 0x042A, 0x042B, 0x042B, 0x0429, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x042C, 0x042C, 0x042D, 0x042E,
+    0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E,
+    0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E,
+    0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042E, 0x042D, 0x042D, 0x042D, 0x042C, 0x042C,
+    0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042C, 0x042D, 0x042F, 0x042E, 0x0430, 0x0430,
+    0x042E, 0x0431, 0x0431, 0x0431, 0x0431, 0x042C, 0x0432, 0x042C, 0x042C, 0x0431, 0x042D, 0x042C,
+    0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x0433, 0x042E, 0x0431,
+    0x042E, 0x0431, 0x0431, 0x0431, 0x008A, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434,
+    0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434,
+    0x0434, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435,
+    0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x008A, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435,
+    0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435,
+    0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0435, 0x0436, 0x0436, 0x0436, 0x0437,
+    0x0437, 0x0437, 0x0436, 0x0436, 0x0437, 0x0438, 0x0439, 0x0437, 0x043A, 0x043A, 0x043A, 0x043A,
+    0x043A, 0x043A, 0x0437, 0x008A, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x008A,
+    0x043B, 0x008A, 0x043B, 0x043B, 0x043B, 0x043B, 0x008A, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B,
+    0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x008A, 0x043B,
+    0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043B, 0x043C, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D,
+    0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D,
+    0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043D, 0x043E,
+    0x043F, 0x043F, 0x043F, 0x043E, 0x043E, 0x043E, 0x043E, 0x043E, 0x043E, 0x0440, 0x0441, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442, 0x0442,
+    0x0442, 0x0442, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0443, 0x0443, 0x0444, 0x0444,
+    0x008A, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x008A, 0x008A, 0x0445,
+    0x0445, 0x008A, 0x008A, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445,
+    0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445,
+    0x0445, 0x008A, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x008A, 0x0445, 0x0445,
+    0x008A, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x008A, 0x0446, 0x0447, 0x0445, 0x0448, 0x0444,
+    0x0443, 0x0444, 0x0444, 0x0444, 0x0444, 0x008A, 0x008A, 0x0444, 0x0444, 0x008A, 0x008A, 0x0449,
+    0x0449, 0x044A, 0x008A, 0x008A, 0x0445, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0448,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0445, 0x0445, 0x0445, 0x0445, 0x0445, 0x0444, 0x0444,
+    0x008A, 0x008A, 0x044B, 0x044B, 0x044B, 0x044B, 0x044B, 0x044B, 0x044B, 0x008A, 0x008A, 0x008A,
+    0x044B, 0x044B, 0x044B, 0x044B, 0x044B, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C,
+    0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C, 0x044C,
+    0x044C, 0x044D, 0x044D, 0x044D, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E, 0x044E,
+    0x044D, 0x044D, 0x044F, 0x044E, 0x044E, 0x044D, 0x0450, 0x044C, 0x044C, 0x044C, 0x044C, 0x0451,
+    0x0451, 0x0451, 0x0451, 0x0451, 0x0452, 0x0452, 0x0452, 0x0452, 0x0452, 0x0452, 0x0452, 0x0452,
+    0x0452, 0x0452, 0x0451, 0x0451, 0x008A, 0x0451, 0x0453, 0x044C, 0x044C, 0x044C, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454,
+    0x0454, 0x0454, 0x0454, 0x0454, 0x0455, 0x0456, 0x0456, 0x0457, 0x0457, 0x0457, 0x0457, 0x0457,
+    0x0457, 0x0456, 0x0458, 0x0459, 0x0459, 0x0455, 0x0459, 0x0457, 0x0457, 0x0456, 0x045A, 0x045B,
+    0x0454, 0x0454, 0x045C, 0x0454, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x045D, 0x045D, 0x045D, 0x045D, 0x045D, 0x045D, 0x045D, 0x045D, 0x045D, 0x045D, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E,
+    0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E,
+    0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045E, 0x045F,
+    0x0460, 0x0460, 0x0461, 0x0461, 0x0461, 0x0461, 0x008A, 0x008A, 0x0460, 0x0460, 0x0462, 0x0462,
+    0x0461, 0x0461, 0x0460, 0x0463, 0x0464, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465,
+    0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465, 0x0465,
+    0x0465, 0x0465, 0x0465, 0x0465, 0x045E, 0x045E, 0x045E, 0x045E, 0x0461, 0x0461, 0x008A, 0x008A,
+    0x0466, 0x0466, 0x0466, 0x0466, 0x0466, 0x0466, 0x0466, 0x0466, 0x0466, 0x0466, 0x0466, 0x0466,
+    0x0466, 0x0466, 0x0466, 0x0466, 0x0467, 0x0467, 0x0467, 0x0468, 0x0468, 0x0468, 0x0468, 0x0468,
+    0x0468, 0x0468, 0x0468, 0x0467, 0x0467, 0x0468, 0x0467, 0x0469, 0x0468, 0x046A, 0x046A, 0x046A,
+    0x0466, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x046B, 0x046B, 0x046B, 0x046B, 0x046B, 0x046B, 0x046B, 0x046B, 0x046B, 0x046B, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA,
+    0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x01EA, 0x008A, 0x008A, 0x008A, 0x046C, 0x046C, 0x046C, 0x046C,
+    0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C,
+    0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046C, 0x046D,
+    0x046E, 0x046D, 0x046E, 0x046E, 0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046D, 0x046F, 0x0470,
+    0x046C, 0x0471, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0472, 0x0472, 0x0472, 0x0472,
+    0x0472, 0x0472, 0x0472, 0x0472, 0x0472, 0x0472, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473,
+    0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473,
+    0x0473, 0x0473, 0x0473, 0x008A, 0x008A, 0x0474, 0x0474, 0x0474, 0x0475, 0x0475, 0x0474, 0x0474,
+    0x0474, 0x0474, 0x0476, 0x0474, 0x0474, 0x0474, 0x0474, 0x0477, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0478, 0x0479, 0x0479,
+    0x047A, 0x047A, 0x047A, 0x047B, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x0473, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x047C, 0x047C, 0x047C, 0x047C,
+    0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C,
+    0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C, 0x047C,
+    0x047D, 0x047D, 0x047D, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E, 0x047E,
+    0x047D, 0x047F, 0x0480, 0x0481, 0x008A, 0x008A, 0x008A, 0x008A, 0x0482, 0x0482, 0x0482, 0x0482,
+    0x0482, 0x0482, 0x0482, 0x0482, 0x0482, 0x0482, 0x0482, 0x0482, 0x0482, 0x0482, 0x0482, 0x0482,
+    0x0483, 0x0483, 0x0483, 0x0483, 0x0483, 0x0483, 0x0483, 0x0483, 0x0483, 0x0483, 0x0483, 0x0483,
+    0x0483, 0x0483, 0x0483, 0x0483, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484, 0x0484,
+    0x0484, 0x0484, 0x0485, 0x0485, 0x0485, 0x0485, 0x0485, 0x0485, 0x0485, 0x0485, 0x0485, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0486,
+    0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x008A, 0x008A, 0x0487, 0x008A, 0x008A,
+    0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x008A, 0x0487, 0x0487, 0x008A,
+    0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487,
+    0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487, 0x0487,
+    0x0488, 0x0489, 0x0489, 0x0489, 0x0489, 0x0489, 0x008A, 0x0489, 0x048A, 0x008A, 0x008A, 0x048B,
+    0x048B, 0x048C, 0x048D, 0x048E, 0x0489, 0x048E, 0x0489, 0x048F, 0x0490, 0x0490, 0x0490, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0491, 0x0491, 0x0491, 0x0491,
+    0x0491, 0x0491, 0x0491, 0x0491, 0x0491, 0x0491, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x008A, 0x008A, 0x0492, 0x0492,
+    0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492,
+    0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0492, 0x0493, 0x0493, 0x0493,
+    0x0494, 0x0494, 0x0494, 0x0494, 0x008A, 0x008A, 0x0494, 0x0494, 0x0493, 0x0493, 0x0493, 0x0493,
+    0x0495, 0x0492, 0x0496, 0x0492, 0x0493, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0497, 0x0498, 0x0498, 0x0498, 0x0498, 0x0498, 0x0498, 0x0498,
+    0x0498, 0x0498, 0x0498, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497,
+    0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497, 0x0497,
+    0x0497, 0x0497, 0x0497, 0x0498, 0x0499, 0x0498, 0x0498, 0x0498, 0x0498, 0x049A, 0x049B, 0x0498,
+    0x0498, 0x0498, 0x0498, 0x049C, 0x049C, 0x049C, 0x049C, 0x049C, 0x049C, 0x049C, 0x049C, 0x0499,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x049D, 0x049E, 0x049E, 0x049E,
+    0x049E, 0x049E, 0x049E, 0x049F, 0x049F, 0x049E, 0x049E, 0x049E, 0x049D, 0x049D, 0x049D, 0x049D,
+    0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D,
+    0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x049D, 0x04A0, 0x04A0, 0x04A0, 0x04A0,
+    0x04A0, 0x04A0, 0x049E, 0x049E, 0x049E, 0x049E, 0x049E, 0x049E, 0x049E, 0x049E, 0x049E, 0x049E,
+    0x049E, 0x049E, 0x049E, 0x049F, 0x049E, 0x04A1, 0x04A2, 0x04A2, 0x04A2, 0x049D, 0x04A2, 0x04A2,
+    0x04A2, 0x04A2, 0x04A2, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3,
+    0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3,
+    0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x04A3, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x008A, 0x04A4, 0x04A4,
+    0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4,
+    0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4,
+    0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A4, 0x04A5,
+    0x04A6, 0x04A6, 0x04A6, 0x04A6, 0x04A6, 0x04A6, 0x04A6, 0x008A, 0x04A6, 0x04A6, 0x04A6, 0x04A6,
+    0x04A6, 0x04A6, 0x04A5, 0x04A7, 0x04A4, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x04A8, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04A9, 0x04A9, 0x04A9, 0x04A9,
+    0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04A9, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA,
+    0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA, 0x04AA,
+    0x04AA, 0x008A, 0x008A, 0x008A, 0x04AB, 0x04AB, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC,
+    0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC,
+    0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC, 0x04AC,
+    0x008A, 0x008A, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD,
+    0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD,
+    0x008A, 0x04AE, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AD, 0x04AE, 0x04AD, 0x04AD,
+    0x04AE, 0x04AD, 0x04AD, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x008A, 0x04AF, 0x04AF, 0x008A, 0x04AF,
+    0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF,
+    0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04AF, 0x04B0, 0x04B0, 0x04B0,
+    0x04B0, 0x04B0, 0x04B0, 0x008A, 0x008A, 0x008A, 0x04B0, 0x008A, 0x04B0, 0x04B0, 0x008A, 0x04B0,
+    0x04B0, 0x04B0, 0x04B1, 0x04B0, 0x04B2, 0x04B2, 0x04B3, 0x04B0, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4, 0x04B4,
+    0x04B4, 0x04B4, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04B5, 0x04B5, 0x04B5, 0x04B5,
+    0x04B5, 0x04B5, 0x008A, 0x04B5, 0x04B5, 0x008A, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5,
+    0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5,
+    0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5, 0x04B5,
+    0x04B5, 0x04B5, 0x04B6, 0x04B6, 0x04B6, 0x04B6, 0x04B6, 0x008A, 0x04B7, 0x04B7, 0x008A, 0x04B6,
+    0x04B6, 0x04B7, 0x04B6, 0x04B8, 0x04B5, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x04B9, 0x04B9, 0x04B9, 0x04B9, 0x04B9, 0x04B9, 0x04B9, 0x04B9, 0x04B9, 0x04B9, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA,
+    0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BA, 0x04BB,
+    0x04BB, 0x04BC, 0x04BC, 0x04BD, 0x04BD, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0331, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F,
+    0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F, 0x015F,
+    0x015F, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0161, 0x0161, 0x0161,
+    0x0161, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160,
+    0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x0160, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04BE, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+    0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF,
+    0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0,
+    0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0,
+    0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x04C0, 0x008A,
+    0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x04C1, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04BF, 0x04BF, 0x04BF, 0x04BF, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04C2, 0x04C2, 0x04C2, 0x04C2,
+    0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2, 0x04C2,
+    0x04C2, 0x04C3, 0x04C3, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4,
+    0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4,
+    0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x04C4, 0x008A,
+    0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x04C5, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6,
+    0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6, 0x04C6,
+    0x04C6, 0x04C6, 0x04C6, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x033B, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7,
+    0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7,
+    0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x04C7, 0x008A,
+    0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x04C8, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x04C9, 0x04C9, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA,
+    0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA,
+    0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x04CA, 0x008A,
+    0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x04CB, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC,
+    0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC,
+    0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x04CC, 0x008A, 0x008A,
+    0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CD, 0x04CE, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF,
+    0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04D0, 0x04D0, 0x04D0, 0x04D0,
+    0x04D0, 0x04D0, 0x04D0, 0x04D1, 0x04D1, 0x04D1, 0x04D1, 0x04D1, 0x04D2, 0x04D2, 0x04D2, 0x04D2,
+    0x04D3, 0x04D3, 0x04D3, 0x04D3, 0x04D1, 0x04D2, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04D4, 0x04D4, 0x04D4, 0x04D4, 0x04D4, 0x04D4, 0x04D4, 0x04D4,
+    0x04D4, 0x04D4, 0x008A, 0x04D5, 0x04D5, 0x04D5, 0x04D5, 0x04D5, 0x04D5, 0x04D5, 0x008A, 0x04CF,
+    0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF,
+    0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x04CF, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x04CF, 0x04CF, 0x04CF, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6,
+    0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D6, 0x04D7, 0x04D7, 0x04D7, 0x04D7,
+    0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7, 0x04D7,
+    0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8,
+    0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D8, 0x04D9,
+    0x04D9, 0x04D9, 0x04D9, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04DA, 0x04DA, 0x04DA, 0x04DA,
+    0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA,
+    0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x04DA, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x04DB, 0x04DA, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC,
+    0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC,
+    0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC,
+    0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x04DC, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x04DB, 0x04DB, 0x04DB, 0x04DB, 0x04DD, 0x04DD, 0x04DD, 0x04DD, 0x04DD,
+    0x04DD, 0x04DD, 0x04DD, 0x04DD, 0x04DD, 0x04DD, 0x04DD, 0x04DD, 0x04DE, 0x04DF, 0x04E0, 0x030C,
+    0x04E1, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x04E2, 0x04E2, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3,
+    0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3,
+    0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4,
+    0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x04E4, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04E3, 0x04E3, 0x04E3, 0x04E3,
+    0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x04E3, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0324, 0x0324, 0x0324, 0x0324, 0x008A, 0x0324, 0x0324, 0x0324, 0x0324, 0x0324, 0x0324, 0x0324,
+    0x008A, 0x0324, 0x0324, 0x008A, 0x0322, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A,
+    0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x031A, 0x0322, 0x0322, 0x0322, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x031A, 0x031A, 0x031A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0322, 0x0322, 0x0322, 0x0322,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04E5, 0x04E5, 0x04E5, 0x04E5,
+    0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5,
+    0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5, 0x04E5,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6,
+    0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6,
+    0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6,
+    0x04E6, 0x008A, 0x008A, 0x008A, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6,
+    0x04E6, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04E6, 0x04E6, 0x04E6, 0x04E6,
+    0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x04E6, 0x008A, 0x008A, 0x04E7, 0x04E8, 0x04E9, 0x04EA,
+    0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083,
+    0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x0083, 0x008A, 0x008A, 0x0083, 0x0083, 0x0083, 0x0083,
+    0x0083, 0x0083, 0x0083, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x008A, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EC, 0x04ED, 0x007F,
+    0x007F, 0x007F, 0x0018, 0x0018, 0x0018, 0x04EE, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x04EC, 0x02C4,
+    0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x02C4, 0x007A, 0x007A, 0x007A, 0x007A, 0x007A,
+    0x007A, 0x007A, 0x007A, 0x0018, 0x0018, 0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x007A, 0x007A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0078, 0x0078, 0x0078, 0x0078, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x04EB, 0x04EB, 0x04EB, 0x04EB, 0x04EB,
+    0x04EB, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC,
+    0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x03AC, 0x04EF, 0x04EF,
+    0x04EF, 0x03AC, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x008A, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D5, 0x008A, 0x02D5, 0x02D5, 0x008A, 0x008A, 0x02D5, 0x008A,
+    0x008A, 0x02D5, 0x02D5, 0x008A, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x008A, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x008A, 0x02D6,
+    0x008A, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x008A, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D5, 0x02D5, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x008A, 0x008A, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x008A, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D5, 0x02D5, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x008A, 0x02D5, 0x008A, 0x008A, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x008A, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x008A, 0x008A, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D5, 0x02D5, 0x02D5, 0x02D5,
+    0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D5, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6,
+    0x02D6, 0x02D6, 0x02D6, 0x02D0, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D6, 0x02D5, 0x02D6,
+    0x008A, 0x008A, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0,
+    0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F1, 0x04F1, 0x04F1, 0x04F1,
+    0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1,
+    0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2,
+    0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F1,
+    0x04F1, 0x04F1, 0x04F1, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2,
+    0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F1, 0x04F1, 0x04F1,
+    0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F2, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1,
+    0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F1, 0x04F2, 0x04F1, 0x04F1, 0x04F3,
+    0x04F3, 0x04F3, 0x04F3, 0x04F3, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2,
+    0x008A, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x04F2,
+    0x04F2, 0x04F2, 0x04F2, 0x04F2, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x002D, 0x0043, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D,
+    0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x002D, 0x008A,
+    0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x008A, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+    0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4,
+    0x04F4, 0x008A, 0x008A, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x008A, 0x04F4,
+    0x04F4, 0x008A, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x04F4, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5,
+    0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5,
+    0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x04F5, 0x008A, 0x008A, 0x008A, 0x04F6, 0x04F6, 0x04F6, 0x04F6,
+    0x04F6, 0x04F6, 0x04F6, 0x04F7, 0x04F7, 0x04F7, 0x04F7, 0x04F7, 0x04F7, 0x04F7, 0x008A, 0x008A,
+    0x04F8, 0x04F8, 0x04F8, 0x04F8, 0x04F8, 0x04F8, 0x04F8, 0x04F8, 0x04F8, 0x04F8, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x04F5, 0x04F9, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA,
+    0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA,
+    0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FA, 0x04FB, 0x008A,
+    0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+    0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FC,
+    0x04FC, 0x04FC, 0x04FC, 0x04FC, 0x04FD, 0x04FD, 0x04FD, 0x04FD, 0x04FE, 0x04FE, 0x04FE, 0x04FE,
+    0x04FE, 0x04FE, 0x04FE, 0x04FE, 0x04FE, 0x04FE, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x04FF,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x008A, 0x01C3, 0x01C3, 0x008A, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3,
+    0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x01C3, 0x008A, 0x0500, 0x0500, 0x0500, 0x0500,
+    0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x0500,
+    0x0500, 0x0500, 0x0500, 0x0500, 0x0500, 0x008A, 0x008A, 0x0501, 0x0501, 0x0501, 0x0501, 0x0501,
+    0x0501, 0x0501, 0x0501, 0x0501, 0x0502, 0x0502, 0x0502, 0x0502, 0x0502, 0x0502, 0x0502, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x0503, 0x0503, 0x0503, 0x0503,
+    0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503, 0x0503,
+    0x0503, 0x0503, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504,
+    0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504,
+    0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504, 0x0504,
+    0x0505, 0x0505, 0x0505, 0x0505, 0x0505, 0x0505, 0x0506, 0x0507, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x0508, 0x0508, 0x0508, 0x0508, 0x0508, 0x0508, 0x0508, 0x0508, 0x0508, 0x0508, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x0509, 0x0509, 0x008A, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x0018, 0x02EC, 0x02EC, 0x02EC,
+    0x0009, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x0018, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC,
+    0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x02EC, 0x008A, 0x008A,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x008A, 0x0105, 0x008A, 0x008A, 0x0105,
+    0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x008A,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x008A, 0x0105, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x0105, 0x008A, 0x008A, 0x008A, 0x008A, 0x0105, 0x008A, 0x0105, 0x008A, 0x0105,
+    0x008A, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x008A, 0x0105, 0x008A, 0x008A, 0x0105,
+    0x008A, 0x0105, 0x008A, 0x0105, 0x008A, 0x0105, 0x008A, 0x0105, 0x008A, 0x0105, 0x0105, 0x008A,
+    0x0105, 0x008A, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x008A, 0x0105, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105, 0x0105, 0x0105, 0x0105, 0x0105, 0x008A, 0x0105,
+    0x0105, 0x0105, 0x0105, 0x0105, 0x00ED, 0x00ED, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x050A, 0x050A, 0x050A, 0x050A, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x050A, 0x050A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x050A, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E5,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E, 0x001E,
+    0x001E, 0x001E, 0x001E, 0x02EC, 0x02EC, 0x02E8, 0x02E8, 0x02E8, 0x02D4, 0x02D4, 0x02D4, 0x02D4,
+    0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02E8,
+    0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B,
+    0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B, 0x050B,
+    0x050B, 0x050B, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x02D4, 0x050C, 0x050C, 0x050C, 0x050C,
+    0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C,
+    0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x02D4, 0x02D4,
+    0x050D, 0x02E8, 0x02E8, 0x02E8, 0x050E, 0x050E, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C,
+    0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050E, 0x050E, 0x050C, 0x050C, 0x050C, 0x050C,
+    0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x050C, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E5, 0x0018,
+    0x02D4, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E8, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F,
+    0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F,
+    0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x050F, 0x0510, 0x032B, 0x032B, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x032B, 0x0316,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x032B, 0x0316, 0x0316, 0x032B, 0x032B,
+    0x032B, 0x032B, 0x032B, 0x032B, 0x032B, 0x032B, 0x032B, 0x0316, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x0316, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x032B, 0x032B, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x001A, 0x001A,
+    0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x001A, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x001A, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E8, 0x02E8, 0x001A, 0x001A,
+    0x02E8, 0x001A, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x001A, 0x001A, 0x001A, 0x001A, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A,
+    0x001A, 0x001A, 0x001A, 0x001A, 0x02E5, 0x02E8, 0x02E8, 0x001A, 0x02E5, 0x001A, 0x02E8, 0x001A,
+    0x02E5, 0x02E5, 0x02E5, 0x0511, 0x0511, 0x0511, 0x0511, 0x0511, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x001A,
+    0x02E5, 0x001A, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x001A, 0x02E8, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E8, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x001A,
+    0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x001A,
+    0x001A, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E5, 0x02E5, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E5, 0x001A, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x001A, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x001A,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x001A, 0x001A, 0x02E8,
+    0x02E8, 0x001A, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x001A, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x001A, 0x02E5, 0x001A, 0x001A, 0x001A,
+    0x02E5, 0x02E5, 0x02E5, 0x02E8, 0x02E8, 0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x02E5, 0x02E5, 0x02E5, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x001A, 0x02E8, 0x02E8,
+    0x02E8, 0x001A, 0x02E8, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x001A, 0x02E8, 0x02E8, 0x001A,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x02E5, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x050A, 0x050A, 0x050A, 0x050A, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x050A, 0x050A, 0x02E8, 0x02E8, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x0018, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x0018, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8, 0x02E8,
+    0x02E8, 0x02E8, 0x050A, 0x050A, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x050A, 0x050A, 0x050A, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x02E5, 0x02E5, 0x02E5, 0x02E5,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x02E5, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x0018, 0x0018, 0x0018, 0x008A, 0x0018, 0x0018, 0x0018, 0x0018,
+    0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x0018, 0x04F0, 0x04F0, 0x04F0, 0x04F0,
+    0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x04F0, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A, 0x008A,
+    0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A, 0x050A,
+    0x050A, 0x050A, 0x008A, 0x008A, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D,
+    0x032D, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x032D, 0x032D, 0x032D, 0x032D,
+    0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x0386, 0x0386,
+    0x032D, 0x032D, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386,
+    0x0386, 0x0386, 0x0386, 0x0386, 0x032D, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386,
+    0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386,
+    0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x0386, 0x008A, 0x008A,
+    0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x032D, 0x0386,
+    0x0386, 0x0386, 0x0386, 0x0386, 0x02CF, 0x02C4, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF,
+    0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF,
+    0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF, 0x02CF,
+    0x0512, 0x0512, 0x0512, 0x0512, 0x0512, 0x0512, 0x0512, 0x0512, 0x0512, 0x0512, 0x0512, 0x0512,
+    0x0512, 0x0512, 0x0512, 0x0512, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384,
+    0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x0384, 0x008A, 0x008A
+};
+
+template <typename T>
+UTIL_CONSTEXPR const uint64 CharacterTables<T>::records[1299] =
+{
+    UTIL_UINT64(0x00000000000000), UTIL_UINT64(0x0002018000321A), UTIL_UINT64(0x0002110000321A), UTIL_UINT64(0x0002198000321A),
+    UTIL_UINT64(0x0002088000321A), UTIL_UINT64(0x00029000003217), UTIL_UINT64(0x00020000003212), UTIL_UINT64(0x00026000003212),
+    UTIL_UINT64(0x000A0000003212), UTIL_UINT64(0x00020000003214), UTIL_UINT64(0x00025800003312), UTIL_UINT64(0x0002000000320E),
+    UTIL_UINT64(0x0002000000320F), UTIL_UINT64(0x00020000003213), UTIL_UINT64(0x00027800003212), UTIL_UINT64(0x0002000000320D),
+    UTIL_UINT64(0x00026800003312), UTIL_UINT64(0x000A8000003209), UTIL_UINT64(0x00027000003312), UTIL_UINT64(0x00125000008CC1),
+    UTIL_UINT64(0x00020000003315), UTIL_UINT64(0x0002880000320C), UTIL_UINT64(0x00225000008CA2), UTIL_UINT64(0x00020024003217),
+    UTIL_UINT64(0x00020000003216), UTIL_UINT64(0x00020024003315), UTIL_UINT64(0x000B0000003216), UTIL_UINT64(0x00025024008CA5),
+    UTIL_UINT64(0x00020000003210), UTIL_UINT64(0x0002398000331B), UTIL_UINT64(0x0002002400320B), UTIL_UINT64(0x003250240032A2),
+    UTIL_UINT64(0x00020000003211), UTIL_UINT64(0x00125006008CC1), UTIL_UINT64(0x00425000008CA2), UTIL_UINT64(0x00225006008CA2),
+    UTIL_UINT64(0x00525006008CA2), UTIL_UINT64(0x00625006008CC1), UTIL_UINT64(0x00725006008CA2), UTIL_UINT64(0x00625000008CC1),
+    UTIL_UINT64(0x00725000008CA2), UTIL_UINT64(0x00825006008CC1), UTIL_UINT64(0x00925000008CA2), UTIL_UINT64(0x00625024008CC1),
+    UTIL_UINT64(0x00725024008CA2), UTIL_UINT64(0x00025000008CA2), UTIL_UINT64(0x00A25024008CA2), UTIL_UINT64(0x00B25006008CC1),
+    UTIL_UINT64(0x00C25024008CA2), UTIL_UINT64(0x00D25000008CA2), UTIL_UINT64(0x00E25000008CC1), UTIL_UINT64(0x00F25000008CC1),
+    UTIL_UINT64(0x01025000008CC1), UTIL_UINT64(0x01125000008CC1), UTIL_UINT64(0x01225000008CC1), UTIL_UINT64(0x01325000008CC1),
+    UTIL_UINT64(0x01425000008CC1), UTIL_UINT64(0x01525000008CA2), UTIL_UINT64(0x01625000008CC1), UTIL_UINT64(0x01725000008CC1),
+    UTIL_UINT64(0x01825000008CA2), UTIL_UINT64(0x01925000008CC1), UTIL_UINT64(0x01A25000008CA2), UTIL_UINT64(0x01B25000008CC1),
+    UTIL_UINT64(0x01C25000008CC1), UTIL_UINT64(0x01D25000008CC1), UTIL_UINT64(0x01E25000008CC1), UTIL_UINT64(0x00025000008C05),
+    UTIL_UINT64(0x01F25000008CA2), UTIL_UINT64(0x02025024008CC1), UTIL_UINT64(0x02125024008C83), UTIL_UINT64(0x02225024008CA2),
+    UTIL_UINT64(0x02325000008CA2), UTIL_UINT64(0x02425006008CA2), UTIL_UINT64(0x02525000008CC1), UTIL_UINT64(0x02625000008CC1),
+    UTIL_UINT64(0x02725000008CC1), UTIL_UINT64(0x02825000008CC1), UTIL_UINT64(0x02925000008CC1), UTIL_UINT64(0x02A25000008CC1),
+    UTIL_UINT64(0x02B25000008CA2), UTIL_UINT64(0x02C25000008CC1), UTIL_UINT64(0x02D25000008CC1), UTIL_UINT64(0x02E25000008CC1),
+    UTIL_UINT64(0x02F25000008CA2), UTIL_UINT64(0x03025000008CA2), UTIL_UINT64(0x03125000008CA2), UTIL_UINT64(0x03225000008CA2),
+    UTIL_UINT64(0x03325000008CA2), UTIL_UINT64(0x03425000008CA2), UTIL_UINT64(0x03525000008CA2), UTIL_UINT64(0x03625000008CA2),
+    UTIL_UINT64(0x03725000008CA2), UTIL_UINT64(0x03825000008CA2), UTIL_UINT64(0x03925000008CA2), UTIL_UINT64(0x03A25000008CA2),
+    UTIL_UINT64(0x03B25000008CA2), UTIL_UINT64(0x03C25000008CA2), UTIL_UINT64(0x03D25000008CA2), UTIL_UINT64(0x03E25000008CA2),
+    UTIL_UINT64(0x03F25000008CA2), UTIL_UINT64(0x04025000008CA2), UTIL_UINT64(0x04125000008CA2), UTIL_UINT64(0x04225000008CA2),
+    UTIL_UINT64(0x04325000008CA2), UTIL_UINT64(0x04425000008CA2), UTIL_UINT64(0x04525000008CA2), UTIL_UINT64(0x04625000008CA2),
+    UTIL_UINT64(0x04725000008CA2), UTIL_UINT64(0x04825000008CA2), UTIL_UINT64(0x04925000008CA2), UTIL_UINT64(0x04A25000008CA2),
+    UTIL_UINT64(0x04B25000008CA2), UTIL_UINT64(0x04C25000008CA2), UTIL_UINT64(0x00025024008DA4), UTIL_UINT64(0x00025000003304),
+    UTIL_UINT64(0x000250000033A4), UTIL_UINT64(0x00025000003315), UTIL_UINT64(0x00025000001B15), UTIL_UINT64(0x00002251CC7106),
+    UTIL_UINT64(0x00002201CC7106), UTIL_UINT64(0x00002201D07106), UTIL_UINT64(0x00002201B87106), UTIL_UINT64(0x00002251B07106),
+    UTIL_UINT64(0x00002201947106), UTIL_UINT64(0x00002251B87106), UTIL_UINT64(0x00002251947106), UTIL_UINT64(0x00002200027106),
+    UTIL_UINT64(0x00002250027106), UTIL_UINT64(0x0000222FCC7106), UTIL_UINT64(0x04D02251E071A6), UTIL_UINT64(0x00002200007106),
+    UTIL_UINT64(0x00002201D27106), UTIL_UINT64(0x00002201D47106), UTIL_UINT64(0x006250000058C1), UTIL_UINT64(0x007250000058A2),
+    UTIL_UINT64(0x0002502E003304), UTIL_UINT64(0x00020000005915), UTIL_UINT64(0x00020000000000), UTIL_UINT64(0x000250240059A4),
+    UTIL_UINT64(0x01A250000058A2), UTIL_UINT64(0x0002782E003212), UTIL_UINT64(0x04E250000058C1), UTIL_UINT64(0x00020024005915),
+    UTIL_UINT64(0x00020026003315), UTIL_UINT64(0x04F250060058C1), UTIL_UINT64(0x0002702E003312), UTIL_UINT64(0x050250060058C1),
+    UTIL_UINT64(0x051250060058C1), UTIL_UINT64(0x052250060058C1), UTIL_UINT64(0x053250060058A2), UTIL_UINT64(0x001250000058C1),
+    UTIL_UINT64(0x001250060058C1), UTIL_UINT64(0x054250060058A2), UTIL_UINT64(0x055250060058A2), UTIL_UINT64(0x056250060058A2),
+    UTIL_UINT64(0x002250000058A2), UTIL_UINT64(0x057250000058A2), UTIL_UINT64(0x002250060058A2), UTIL_UINT64(0x058250060058A2),
+    UTIL_UINT64(0x059250060058A2), UTIL_UINT64(0x05A250000058C1), UTIL_UINT64(0x05B250240058A2), UTIL_UINT64(0x05C250240058A2),
+    UTIL_UINT64(0x000250240058C1), UTIL_UINT64(0x000250260058C1), UTIL_UINT64(0x05D250240058A2), UTIL_UINT64(0x05E250240058A2),
+    UTIL_UINT64(0x05F250000058A2), UTIL_UINT64(0x006250000034C1), UTIL_UINT64(0x007250000034A2), UTIL_UINT64(0x060250240058A2),
+    UTIL_UINT64(0x061250240058A2), UTIL_UINT64(0x062250240058A2), UTIL_UINT64(0x063250000058A2), UTIL_UINT64(0x064250240058C1),
+    UTIL_UINT64(0x065250240058A2), UTIL_UINT64(0x00020000005813), UTIL_UINT64(0x066250240058C1), UTIL_UINT64(0x000250000058A2),
+    UTIL_UINT64(0x027250000058C1), UTIL_UINT64(0x06725006003CC1), UTIL_UINT64(0x06725000003CC1), UTIL_UINT64(0x00125000003CC1),
+    UTIL_UINT64(0x00125006003CC1), UTIL_UINT64(0x00225000003CA2), UTIL_UINT64(0x00225006003CA2), UTIL_UINT64(0x06825006003CA2),
+    UTIL_UINT64(0x06825000003CA2), UTIL_UINT64(0x00625000003CC1), UTIL_UINT64(0x00725000003CA2), UTIL_UINT64(0x00625006003CC1),
+    UTIL_UINT64(0x00725006003CA2), UTIL_UINT64(0x00020000003C16), UTIL_UINT64(0x00002201CC3D06), UTIL_UINT64(0x00002200003D08),
+    UTIL_UINT64(0x06925000003CC1), UTIL_UINT64(0x06A25000003CA2), UTIL_UINT64(0x06B25000000AC1), UTIL_UINT64(0x00025000000B04),
+    UTIL_UINT64(0x00025000000A12), UTIL_UINT64(0x00020000000A12), UTIL_UINT64(0x00027000000B12), UTIL_UINT64(0x00025000000AA2),
+    UTIL_UINT64(0x06C25000000AA2), UTIL_UINT64(0x06D25024000AA2), UTIL_UINT64(0x00027800000A12), UTIL_UINT64(0x00025000000A0D),
+    UTIL_UINT64(0x00020000000A16), UTIL_UINT64(0x00020000000A14), UTIL_UINT64(0x00002201B86B06), UTIL_UINT64(0x00002201CC6B06),
+    UTIL_UINT64(0x00002201BC6B06), UTIL_UINT64(0x00002201C86B06), UTIL_UINT64(0x00002200146B06), UTIL_UINT64(0x00002200166B06),
+    UTIL_UINT64(0x00002200186B06), UTIL_UINT64(0x000022001A6B06), UTIL_UINT64(0x000022001C6B06), UTIL_UINT64(0x000022001E6B06),
+    UTIL_UINT64(0x00002200206B06), UTIL_UINT64(0x00002200226B06), UTIL_UINT64(0x00002200246B06), UTIL_UINT64(0x00002200266B06),
+    UTIL_UINT64(0x00002200286B06), UTIL_UINT64(0x000022002A6B06), UTIL_UINT64(0x000022002C6B06), UTIL_UINT64(0x00020000006A0D),
+    UTIL_UINT64(0x000022002E6B06), UTIL_UINT64(0x00020000006A12), UTIL_UINT64(0x00002200306B06), UTIL_UINT64(0x00002200326B06),
+    UTIL_UINT64(0x00024800006A05), UTIL_UINT64(0x00025000006A12), UTIL_UINT64(0x00027000006B12), UTIL_UINT64(0x00003B8000091B),
+    UTIL_UINT64(0x00003B8000331B), UTIL_UINT64(0x00020000000813), UTIL_UINT64(0x00020000000812), UTIL_UINT64(0x00020000000814),
+    UTIL_UINT64(0x00027800000812), UTIL_UINT64(0x00020000000816), UTIL_UINT64(0x00002201CC0906), UTIL_UINT64(0x000022003C0906),
+    UTIL_UINT64(0x000022003E0906), UTIL_UINT64(0x00002200400906), UTIL_UINT64(0x0000398000091B), UTIL_UINT64(0x00025000000805),
+    UTIL_UINT64(0x00025006000805), UTIL_UINT64(0x00002200367106), UTIL_UINT64(0x00002200387106), UTIL_UINT64(0x000022003A7106),
+    UTIL_UINT64(0x000022003C7106), UTIL_UINT64(0x000022003E7106), UTIL_UINT64(0x00002200407106), UTIL_UINT64(0x00002200427106),
+    UTIL_UINT64(0x00002200447106), UTIL_UINT64(0x00002201B80906), UTIL_UINT64(0x00028000000809), UTIL_UINT64(0x00028000000812),
+    UTIL_UINT64(0x00002200467106), UTIL_UINT64(0x00025024000805), UTIL_UINT64(0x00025000000904), UTIL_UINT64(0x00020000011212),
+    UTIL_UINT64(0x00003B8001131B), UTIL_UINT64(0x00025000011205), UTIL_UINT64(0x00002200491306), UTIL_UINT64(0x00002201CD1306),
+    UTIL_UINT64(0x00002201B91306), UTIL_UINT64(0x00025000012805), UTIL_UINT64(0x00002200012906), UTIL_UINT64(0x0002800000C809),
+    UTIL_UINT64(0x0002500000C805), UTIL_UINT64(0x00002201CCC906), UTIL_UINT64(0x00002201B8C906), UTIL_UINT64(0x0002500000C904),
+    UTIL_UINT64(0x0002000000C816), UTIL_UINT64(0x0002000000C812), UTIL_UINT64(0x0002780000C812), UTIL_UINT64(0x0002000000C814),
+    UTIL_UINT64(0x0002500000FA05), UTIL_UINT64(0x00002201CCFB06), UTIL_UINT64(0x0002500000FB04), UTIL_UINT64(0x0002000000FA12),
+    UTIL_UINT64(0x0002500000A205), UTIL_UINT64(0x00002201B8A306), UTIL_UINT64(0x0002000000A212), UTIL_UINT64(0x00020000000915),
+    UTIL_UINT64(0x00002200360906), UTIL_UINT64(0x00002200380906), UTIL_UINT64(0x000022003A0906), UTIL_UINT64(0x00002200004106),
+    UTIL_UINT64(0x00002400004007), UTIL_UINT64(0x00025000004005), UTIL_UINT64(0x00025006004005), UTIL_UINT64(0x000022500E4106),
+    UTIL_UINT64(0x00002200124106), UTIL_UINT64(0x0002502E004005), UTIL_UINT64(0x00028000004009), UTIL_UINT64(0x00020000004012),
+    UTIL_UINT64(0x00025000004104), UTIL_UINT64(0x00025000001605), UTIL_UINT64(0x00002200001706), UTIL_UINT64(0x00002400001607),
+    UTIL_UINT64(0x000022000E1706), UTIL_UINT64(0x00002250001607), UTIL_UINT64(0x00002406001607), UTIL_UINT64(0x00002200121706),
+    UTIL_UINT64(0x0002502E001605), UTIL_UINT64(0x00028000001609), UTIL_UINT64(0x00020000001614), UTIL_UINT64(0x0002000000160B),
+    UTIL_UINT64(0x00020000001616), UTIL_UINT64(0x00020000001612), UTIL_UINT64(0x00002201CC1706), UTIL_UINT64(0x00002200005F06),
+    UTIL_UINT64(0x00002400005E07), UTIL_UINT64(0x00025000005E05), UTIL_UINT64(0x0002502E005E05), UTIL_UINT64(0x000022000E5F06),
+    UTIL_UINT64(0x00002200125F06), UTIL_UINT64(0x00028000005E09), UTIL_UINT64(0x00020000005E12), UTIL_UINT64(0x00002200005B06),
+    UTIL_UINT64(0x00002400005A07), UTIL_UINT64(0x00025000005A05), UTIL_UINT64(0x000022000E5B06), UTIL_UINT64(0x00002200125B06),
+    UTIL_UINT64(0x00028000005A09), UTIL_UINT64(0x00020000005A12), UTIL_UINT64(0x00020000005A14), UTIL_UINT64(0x0000220000E506),
+    UTIL_UINT64(0x0000240000E407), UTIL_UINT64(0x0002500000E405), UTIL_UINT64(0x000022000EE506), UTIL_UINT64(0x0000225000E407),
+    UTIL_UINT64(0x0000240600E407), UTIL_UINT64(0x0000220012E506), UTIL_UINT64(0x0000225000E506), UTIL_UINT64(0x0002502E00E405),
+    UTIL_UINT64(0x0002800000E409), UTIL_UINT64(0x0002000000E416), UTIL_UINT64(0x0002000000E40B), UTIL_UINT64(0x00002200012106),
+    UTIL_UINT64(0x00025000012005), UTIL_UINT64(0x00025006012005), UTIL_UINT64(0x00002250012007), UTIL_UINT64(0x00002400012007),
+    UTIL_UINT64(0x00002406012007), UTIL_UINT64(0x00002200132106), UTIL_UINT64(0x00028000012009), UTIL_UINT64(0x0002000001200B),
+    UTIL_UINT64(0x00020000012016), UTIL_UINT64(0x00020000012014), UTIL_UINT64(0x00002200012706), UTIL_UINT64(0x00002400012607),
+    UTIL_UINT64(0x00025000012605), UTIL_UINT64(0x000022000F2706), UTIL_UINT64(0x00002206012706), UTIL_UINT64(0x00002200132706),
+    UTIL_UINT64(0x00002200A92706), UTIL_UINT64(0x00002250B72706), UTIL_UINT64(0x00028000012609), UTIL_UINT64(0x00020000012612),
+    UTIL_UINT64(0x0002000001260B), UTIL_UINT64(0x00020000012616), UTIL_UINT64(0x00025000007A05), UTIL_UINT64(0x00002200007B06),
+    UTIL_UINT64(0x00002400007A07), UTIL_UINT64(0x00020000007A12), UTIL_UINT64(0x000022000E7B06), UTIL_UINT64(0x00002406007A07),
+    UTIL_UINT64(0x00002250007A07), UTIL_UINT64(0x00002200127B06), UTIL_UINT64(0x00028000007A09), UTIL_UINT64(0x0000220000A106),
+    UTIL_UINT64(0x0000240000A007), UTIL_UINT64(0x0002500000A005), UTIL_UINT64(0x0000220012A106), UTIL_UINT64(0x0000225000A007),
+    UTIL_UINT64(0x0000240600A007), UTIL_UINT64(0x0002538000A005), UTIL_UINT64(0x0002000000A016), UTIL_UINT64(0x0002000000A00B),
+    UTIL_UINT64(0x0002800000A009), UTIL_UINT64(0x00002200010706), UTIL_UINT64(0x00002400010607), UTIL_UINT64(0x00025000010605),
+    UTIL_UINT64(0x00002250130706), UTIL_UINT64(0x00002250010607), UTIL_UINT64(0x00002406010607), UTIL_UINT64(0x00028000010609),
+    UTIL_UINT64(0x00020000010612), UTIL_UINT64(0x00020000012A05), UTIL_UINT64(0x00002200012B06), UTIL_UINT64(0x00020424012A05),
+    UTIL_UINT64(0x00002200CF2B06), UTIL_UINT64(0x00002200132B06), UTIL_UINT64(0x00020000012B04), UTIL_UINT64(0x00002200D72B06),
+    UTIL_UINT64(0x00020000012A12), UTIL_UINT64(0x00028000012A09), UTIL_UINT64(0x00020000008A05), UTIL_UINT64(0x00002200008B06),
+    UTIL_UINT64(0x00020424008A05), UTIL_UINT64(0x00002200EC8B06), UTIL_UINT64(0x00002200128B06), UTIL_UINT64(0x00020000008B04),
+    UTIL_UINT64(0x00002200F48B06), UTIL_UINT64(0x00028000008A09), UTIL_UINT64(0x00020024008A05), UTIL_UINT64(0x00025000012C05),
+    UTIL_UINT64(0x00020000012C16), UTIL_UINT64(0x00020000012C12), UTIL_UINT64(0x00020024012C12), UTIL_UINT64(0x00002201B92D06),
+    UTIL_UINT64(0x00028000012C09), UTIL_UINT64(0x00020000012C0B), UTIL_UINT64(0x00002201B12D06), UTIL_UINT64(0x00020000012C0E),
+    UTIL_UINT64(0x00020000012C0F), UTIL_UINT64(0x00002400012C07), UTIL_UINT64(0x0002502E012C05), UTIL_UINT64(0x00002201032D06),
+    UTIL_UINT64(0x00002201052D06), UTIL_UINT64(0x0000222E012D06), UTIL_UINT64(0x00002201092D06), UTIL_UINT64(0x00002224012D06),
+    UTIL_UINT64(0x00002200012D06), UTIL_UINT64(0x00002201CD2D06), UTIL_UINT64(0x00002200132D06), UTIL_UINT64(0x0002000000BE05),
+    UTIL_UINT64(0x0002000600BE05), UTIL_UINT64(0x0000200000BE07), UTIL_UINT64(0x0000220000BF06), UTIL_UINT64(0x0000225000BF06),
+    UTIL_UINT64(0x0000240000BE07), UTIL_UINT64(0x000022000EBF06), UTIL_UINT64(0x0000220012BF06), UTIL_UINT64(0x0002800000BE09),
+    UTIL_UINT64(0x0002000000BE12), UTIL_UINT64(0x00002201B8BF06), UTIL_UINT64(0x0002000000BE16), UTIL_UINT64(0x06E250000050C1),
+    UTIL_UINT64(0x06F250000050A2), UTIL_UINT64(0x00025024005104), UTIL_UINT64(0x00045480006205), UTIL_UINT64(0x00005500006205),
+    UTIL_UINT64(0x00005550006205), UTIL_UINT64(0x000055D0006205), UTIL_UINT64(0x00005580006205), UTIL_UINT64(0x00025000004E05),
+    UTIL_UINT64(0x00002201CC4F06), UTIL_UINT64(0x00020000004E12), UTIL_UINT64(0x00020000004E0B), UTIL_UINT64(0x00020000004E16),
+    UTIL_UINT64(0x07025000002EC1), UTIL_UINT64(0x07125000002EC1), UTIL_UINT64(0x07225000002EA2), UTIL_UINT64(0x0002000000240D),
+    UTIL_UINT64(0x00025000002405), UTIL_UINT64(0x00020000002416), UTIL_UINT64(0x00020000002412), UTIL_UINT64(0x0002900000CE17),
+    UTIL_UINT64(0x0002500000CE05), UTIL_UINT64(0x0002000000CE0E), UTIL_UINT64(0x0002000000CE0F), UTIL_UINT64(0x0002500000F805),
+    UTIL_UINT64(0x0002500000F80A), UTIL_UINT64(0x00025000011405), UTIL_UINT64(0x00002200011506), UTIL_UINT64(0x00002200131506),
+    UTIL_UINT64(0x00002400131407), UTIL_UINT64(0x00025000006605), UTIL_UINT64(0x00002200006706), UTIL_UINT64(0x00002400126607),
+    UTIL_UINT64(0x00025000002205), UTIL_UINT64(0x00002200002306), UTIL_UINT64(0x00025000011605), UTIL_UINT64(0x00002200011706),
+    UTIL_UINT64(0x00020000008405), UTIL_UINT64(0x00002200008506), UTIL_UINT64(0x00002400008407), UTIL_UINT64(0x00002200128506),
+    UTIL_UINT64(0x00020000008412), UTIL_UINT64(0x00020000008504), UTIL_UINT64(0x00020000008414), UTIL_UINT64(0x00002201CC8506),
+    UTIL_UINT64(0x00028000008409), UTIL_UINT64(0x0002000000840B), UTIL_UINT64(0x0002000000B812), UTIL_UINT64(0x0002000000B80D),
+    UTIL_UINT64(0x0000220000B906), UTIL_UINT64(0x0000398000B91B), UTIL_UINT64(0x0002800000B809), UTIL_UINT64(0x0002500000B805),
+    UTIL_UINT64(0x0002500000B904), UTIL_UINT64(0x00002201C8B906), UTIL_UINT64(0x00025000009005), UTIL_UINT64(0x00002200009106),
+    UTIL_UINT64(0x00002400009007), UTIL_UINT64(0x00002201BC9106), UTIL_UINT64(0x00002201CC9106), UTIL_UINT64(0x00002201B89106),
+    UTIL_UINT64(0x00020000009016), UTIL_UINT64(0x00020000009012), UTIL_UINT64(0x00028000009009), UTIL_UINT64(0x00020000011805),
+    UTIL_UINT64(0x0002000000C405), UTIL_UINT64(0x0002800000C409), UTIL_UINT64(0x0002000000C40B), UTIL_UINT64(0x0002000000C416),
+    UTIL_UINT64(0x00020000008416), UTIL_UINT64(0x00025000002005), UTIL_UINT64(0x00002201CC2106), UTIL_UINT64(0x00002201B82106),
+    UTIL_UINT64(0x00002400002007), UTIL_UINT64(0x00002200002106), UTIL_UINT64(0x00020000002012), UTIL_UINT64(0x00020000011A05),
+    UTIL_UINT64(0x00002400011A07), UTIL_UINT64(0x00002200011B06), UTIL_UINT64(0x00002200131B06), UTIL_UINT64(0x00002000011A07),
+    UTIL_UINT64(0x00002201CD1B06), UTIL_UINT64(0x00002201B91B06), UTIL_UINT64(0x00028000011A09), UTIL_UINT64(0x00020000011A12),
+    UTIL_UINT64(0x00020000011B04), UTIL_UINT64(0x00002200007108), UTIL_UINT64(0x00002200000F06), UTIL_UINT64(0x00002400000E07),
+    UTIL_UINT64(0x00025000000E05), UTIL_UINT64(0x00025006000E05), UTIL_UINT64(0x000022000E0F06), UTIL_UINT64(0x00002250000E07),
+    UTIL_UINT64(0x00002406000E07), UTIL_UINT64(0x00002400120E07), UTIL_UINT64(0x00028000000E09), UTIL_UINT64(0x00020000000E12),
+    UTIL_UINT64(0x00020000000E16), UTIL_UINT64(0x00002201CC0F06), UTIL_UINT64(0x00002201B80F06), UTIL_UINT64(0x00002200010F06),
+    UTIL_UINT64(0x00002400010E07), UTIL_UINT64(0x00025000010E05), UTIL_UINT64(0x00002400130E07), UTIL_UINT64(0x00002200130F06),
+    UTIL_UINT64(0x00028000010E09), UTIL_UINT64(0x00025000001405), UTIL_UINT64(0x000022000E1506), UTIL_UINT64(0x00002400001407),
+    UTIL_UINT64(0x00002200001506), UTIL_UINT64(0x00002400121407), UTIL_UINT64(0x00020000001412), UTIL_UINT64(0x00025000008E05),
+    UTIL_UINT64(0x00002400008E07), UTIL_UINT64(0x00002200008F06), UTIL_UINT64(0x000022000E8F06), UTIL_UINT64(0x00020000008E12),
+    UTIL_UINT64(0x00028000008E09), UTIL_UINT64(0x0002800000D009), UTIL_UINT64(0x0002500000D005), UTIL_UINT64(0x0002500000D104),
+    UTIL_UINT64(0x0002000000D012), UTIL_UINT64(0x07325000003CA2), UTIL_UINT64(0x07425000003CA2), UTIL_UINT64(0x07525000003CA2),
+    UTIL_UINT64(0x07625000003CA2), UTIL_UINT64(0x07725000003CA2), UTIL_UINT64(0x07825000003CA2), UTIL_UINT64(0x07925000003CA2),
+    UTIL_UINT64(0x07A25000003CA2), UTIL_UINT64(0x07B250000050C1), UTIL_UINT64(0x00020000010E12), UTIL_UINT64(0x00002400003207),
+    UTIL_UINT64(0x00025000003205), UTIL_UINT64(0x00025000003CA2), UTIL_UINT64(0x00025000008DA4), UTIL_UINT64(0x00025024003DA4),
+    UTIL_UINT64(0x07C25000008CA2), UTIL_UINT64(0x07D25000008CA2), UTIL_UINT64(0x07E25000008CA2), UTIL_UINT64(0x00002201AC7106),
+    UTIL_UINT64(0x00002201C87106), UTIL_UINT64(0x00002201B47106), UTIL_UINT64(0x07F25006008CA2), UTIL_UINT64(0x08025006008CA2),
+    UTIL_UINT64(0x08125006008CA2), UTIL_UINT64(0x08225006008CA2), UTIL_UINT64(0x08325024008CA2), UTIL_UINT64(0x08425026008CA2),
+    UTIL_UINT64(0x08525000008CC1), UTIL_UINT64(0x086250060058A2), UTIL_UINT64(0x087250060058C1), UTIL_UINT64(0x088250060058A2),
+    UTIL_UINT64(0x089250060058A2), UTIL_UINT64(0x08A250060058A2), UTIL_UINT64(0x08B250060058A2), UTIL_UINT64(0x08C250060058A2),
+    UTIL_UINT64(0x08C2502E0058A2), UTIL_UINT64(0x08D250060058A2), UTIL_UINT64(0x08D2502E0058A2), UTIL_UINT64(0x08E250060058A2),
+    UTIL_UINT64(0x08E2502E0058A2), UTIL_UINT64(0x08F250060058A2), UTIL_UINT64(0x08F2502E0058A2), UTIL_UINT64(0x090250060058A2),
+    UTIL_UINT64(0x0902502E0058A2), UTIL_UINT64(0x091250060058A2), UTIL_UINT64(0x0912502E0058A2), UTIL_UINT64(0x092250060058A2),
+    UTIL_UINT64(0x093250060058A2), UTIL_UINT64(0x094250060058A2), UTIL_UINT64(0x095250060058A2), UTIL_UINT64(0x096250060058A2),
+    UTIL_UINT64(0x097250060058A2), UTIL_UINT64(0x098250060058A2), UTIL_UINT64(0x099250060058A2), UTIL_UINT64(0x09A25006005883),
+    UTIL_UINT64(0x09B25006005883), UTIL_UINT64(0x09C25006005883), UTIL_UINT64(0x09D25006005883), UTIL_UINT64(0x09E25006005883),
+    UTIL_UINT64(0x09F25006005883), UTIL_UINT64(0x0A025006005883), UTIL_UINT64(0x0A125006005883), UTIL_UINT64(0x0A2250060058A2),
+    UTIL_UINT64(0x0A3250060058A2), UTIL_UINT64(0x0A4250060058A2), UTIL_UINT64(0x0A5250060058A2), UTIL_UINT64(0x0A6250060058A2),
+    UTIL_UINT64(0x0A7250060058A2), UTIL_UINT64(0x0A8250060058A2), UTIL_UINT64(0x0A9250060058A2), UTIL_UINT64(0x0AA25006005883),
+    UTIL_UINT64(0x0AB25006005883), UTIL_UINT64(0x0AC25006005883), UTIL_UINT64(0x0AD25006005883), UTIL_UINT64(0x0AE25006005883),
+    UTIL_UINT64(0x0AF25006005883), UTIL_UINT64(0x0B025006005883), UTIL_UINT64(0x0B125006005883), UTIL_UINT64(0x0B2250060058A2),
+    UTIL_UINT64(0x0B3250060058A2), UTIL_UINT64(0x0B4250060058A2), UTIL_UINT64(0x0B5250060058A2), UTIL_UINT64(0x0B6250060058A2),
+    UTIL_UINT64(0x0B7250060058A2), UTIL_UINT64(0x0B8250060058A2), UTIL_UINT64(0x0B9250060058A2), UTIL_UINT64(0x0BA25006005883),
+    UTIL_UINT64(0x0BB25006005883), UTIL_UINT64(0x0BC25006005883), UTIL_UINT64(0x0BD25006005883), UTIL_UINT64(0x0BE25006005883),
+    UTIL_UINT64(0x0BF25006005883), UTIL_UINT64(0x0C025006005883), UTIL_UINT64(0x0C125006005883), UTIL_UINT64(0x0C2250060058A2),
+    UTIL_UINT64(0x0C3250060058A2), UTIL_UINT64(0x0C4250060058A2), UTIL_UINT64(0x0C5250060058A2), UTIL_UINT64(0x0C6250060058A2),
+    UTIL_UINT64(0x0C7250060058C1), UTIL_UINT64(0x0C72502E0058C1), UTIL_UINT64(0x0C825006005883), UTIL_UINT64(0x0C92502E0058A2),
+    UTIL_UINT64(0x00020026005915), UTIL_UINT64(0x0CA250060058A2), UTIL_UINT64(0x0CB250060058A2), UTIL_UINT64(0x0CC250060058A2),
+    UTIL_UINT64(0x0CD250060058A2), UTIL_UINT64(0x0CE250060058A2), UTIL_UINT64(0x0CF250060058C1), UTIL_UINT64(0x0CF2502E0058C1),
+    UTIL_UINT64(0x0D025006005883), UTIL_UINT64(0x0D1250060058A2), UTIL_UINT64(0x0532502E0058A2), UTIL_UINT64(0x0D2250060058A2),
+    UTIL_UINT64(0x0D3250060058A2), UTIL_UINT64(0x0D4250060058C1), UTIL_UINT64(0x0D42502E0058C1), UTIL_UINT64(0x0D5250060058A2),
+    UTIL_UINT64(0x0562502E0058A2), UTIL_UINT64(0x0D6250060058A2), UTIL_UINT64(0x062250060058A2), UTIL_UINT64(0x0D7250060058A2),
+    UTIL_UINT64(0x0D8250060058A2), UTIL_UINT64(0x0D9250060058C1), UTIL_UINT64(0x0D92502E0058C1), UTIL_UINT64(0x066250060058C1),
+    UTIL_UINT64(0x0002002E005915), UTIL_UINT64(0x0DA250060058A2), UTIL_UINT64(0x0DB250060058A2), UTIL_UINT64(0x0DC250060058A2),
+    UTIL_UINT64(0x0DD250060058A2), UTIL_UINT64(0x0DE250060058A2), UTIL_UINT64(0x0DF250060058C1), UTIL_UINT64(0x0DF2502E0058C1),
+    UTIL_UINT64(0x0E0250060058C1), UTIL_UINT64(0x0E02502E0058C1), UTIL_UINT64(0x0E125006005883), UTIL_UINT64(0x0002902E003217),
+    UTIL_UINT64(0x00029024003217), UTIL_UINT64(0x0000018000331B), UTIL_UINT64(0x0000220000711B), UTIL_UINT64(0x00002A8000711B),
+    UTIL_UINT64(0x0000398000331B), UTIL_UINT64(0x0002002400320D), UTIL_UINT64(0x00020024003212), UTIL_UINT64(0x00026800003310),
+    UTIL_UINT64(0x00026800003311), UTIL_UINT64(0x00026824003312), UTIL_UINT64(0x00001980003218), UTIL_UINT64(0x00001980003219),
+    UTIL_UINT64(0x00028824003217), UTIL_UINT64(0x000B0024003212), UTIL_UINT64(0x00027800003213), UTIL_UINT64(0x00020180000000),
+    UTIL_UINT64(0x00020024003213), UTIL_UINT64(0x0002002400320E), UTIL_UINT64(0x0002002400320F), UTIL_UINT64(0x00020024003214),
+    UTIL_UINT64(0x00020024003216), UTIL_UINT64(0x000250240032C1), UTIL_UINT64(0x000250240032A2), UTIL_UINT64(0x000B0024003216),
+    UTIL_UINT64(0x0E22502E0058C1), UTIL_UINT64(0x0E32502E008CC1), UTIL_UINT64(0x0E42502E008CC1), UTIL_UINT64(0x0E525000008CC1),
+    UTIL_UINT64(0x00025024003205), UTIL_UINT64(0x000B50240032A2), UTIL_UINT64(0x0E625000008CA2), UTIL_UINT64(0x0E725024008CCA),
+    UTIL_UINT64(0x0E825024008CAA), UTIL_UINT64(0x00025000008C0A), UTIL_UINT64(0x000B0000003213), UTIL_UINT64(0x00020006003213),
+    UTIL_UINT64(0x00020006003216), UTIL_UINT64(0x00050000003216), UTIL_UINT64(0x0004002E00320E), UTIL_UINT64(0x0004002E00320F),
+    UTIL_UINT64(0x00030000003216), UTIL_UINT64(0x0E9250240032D6), UTIL_UINT64(0x0E9B50240032D6), UTIL_UINT64(0x0EA250240032B6),
+    UTIL_UINT64(0x0002000000320B), UTIL_UINT64(0x00050000003213), UTIL_UINT64(0x00030000003213), UTIL_UINT64(0x00020000001E16),
+    UTIL_UINT64(0x0002002E003213), UTIL_UINT64(0x06B250000052C1), UTIL_UINT64(0x06C250000052A2), UTIL_UINT64(0x0EB25000008CC1),
+    UTIL_UINT64(0x0EC25000008CC1), UTIL_UINT64(0x0ED25000008CC1), UTIL_UINT64(0x0EE25000008CA2), UTIL_UINT64(0x0EF25000008CA2),
+    UTIL_UINT64(0x0F025000008CC1), UTIL_UINT64(0x0F125000008CC1), UTIL_UINT64(0x0F225000008CC1), UTIL_UINT64(0x0F325000008CC1),
+    UTIL_UINT64(0x0F425000008CC1), UTIL_UINT64(0x000250000034A2), UTIL_UINT64(0x00020000003416), UTIL_UINT64(0x00002201CC3506),
+    UTIL_UINT64(0x00020000003412), UTIL_UINT64(0x0002000000340B), UTIL_UINT64(0x0F5250000050A2), UTIL_UINT64(0x00025000012E05),
+    UTIL_UINT64(0x00025024012F04), UTIL_UINT64(0x00020000012E12), UTIL_UINT64(0x00002200132F06), UTIL_UINT64(0x00040000006016),
+    UTIL_UINT64(0x00040024006016), UTIL_UINT64(0x00040000003216), UTIL_UINT64(0x00049024003217), UTIL_UINT64(0x00040000003212),
+    UTIL_UINT64(0x00045000006104), UTIL_UINT64(0x00040000003205), UTIL_UINT64(0x0004000000600A), UTIL_UINT64(0x0004000000320E),
+    UTIL_UINT64(0x0004000000320F), UTIL_UINT64(0x0004000000320D), UTIL_UINT64(0x00002201BC7106), UTIL_UINT64(0x00002201C06207),
+    UTIL_UINT64(0x0005000000320D), UTIL_UINT64(0x00044000003304), UTIL_UINT64(0x00040024003216), UTIL_UINT64(0x0004002400600A),
+    UTIL_UINT64(0x00045000003205), UTIL_UINT64(0x00050000003212), UTIL_UINT64(0x00040000006C05), UTIL_UINT64(0x00040006006C05),
+    UTIL_UINT64(0x00002250107106), UTIL_UINT64(0x00044024003315), UTIL_UINT64(0x00040000006D04), UTIL_UINT64(0x00040006006D04),
+    UTIL_UINT64(0x00040024006C05), UTIL_UINT64(0x0004400000320D), UTIL_UINT64(0x00044000007C05), UTIL_UINT64(0x00044006007C05),
+    UTIL_UINT64(0x00044000007D04), UTIL_UINT64(0x00044006007D04), UTIL_UINT64(0x00044024007C05), UTIL_UINT64(0x00045000001A05),
+    UTIL_UINT64(0x00045024006205), UTIL_UINT64(0x0004002400320B), UTIL_UINT64(0x00040024006216), UTIL_UINT64(0x00050024003216),
+    UTIL_UINT64(0x00044024007C16), UTIL_UINT64(0x00040000006005), UTIL_UINT64(0x00045000014005), UTIL_UINT64(0x00045000014104),
+    UTIL_UINT64(0x00040000014016), UTIL_UINT64(0x00025000009605), UTIL_UINT64(0x00025000009704), UTIL_UINT64(0x00020000009612),
+    UTIL_UINT64(0x00025000013605), UTIL_UINT64(0x00025000013704), UTIL_UINT64(0x00020000013612), UTIL_UINT64(0x00028000013609),
+    UTIL_UINT64(0x00025000003C05), UTIL_UINT64(0x00020000003C12), UTIL_UINT64(0x00025000003D04), UTIL_UINT64(0x00025000001005),
+    UTIL_UINT64(0x0002500000100A), UTIL_UINT64(0x00002201CC1106), UTIL_UINT64(0x00020000001012), UTIL_UINT64(0x0F625000008CC1),
+    UTIL_UINT64(0x0F725000008CC1), UTIL_UINT64(0x0F825000008CA2), UTIL_UINT64(0x0F925000008CC1), UTIL_UINT64(0x0FA25000008CC1),
+    UTIL_UINT64(0x0FB25000008CC1), UTIL_UINT64(0x0FC25000008CC1), UTIL_UINT64(0x0FD25000008CC1), UTIL_UINT64(0x0FE25000008CC1),
+    UTIL_UINT64(0x0FF25000008CC1), UTIL_UINT64(0x10025000008CC1), UTIL_UINT64(0x10125000008CC1), UTIL_UINT64(0x10225000008CC1),
+    UTIL_UINT64(0x10325000008CC1), UTIL_UINT64(0x00025024008D04), UTIL_UINT64(0x00025000011005), UTIL_UINT64(0x00002200011106),
+    UTIL_UINT64(0x00002200131106), UTIL_UINT64(0x00002400011007), UTIL_UINT64(0x00020000011016), UTIL_UINT64(0x0002500000F005),
+    UTIL_UINT64(0x0002000000F012), UTIL_UINT64(0x0000240000FC07), UTIL_UINT64(0x0002500000FC05), UTIL_UINT64(0x0000220012FD06),
+    UTIL_UINT64(0x0000220000FD06), UTIL_UINT64(0x0002000000FC12), UTIL_UINT64(0x0002800000FC09), UTIL_UINT64(0x00002201CC4106),
+    UTIL_UINT64(0x00028000007E09), UTIL_UINT64(0x00025000007E05), UTIL_UINT64(0x00002200007F06), UTIL_UINT64(0x00002201B87F06),
+    UTIL_UINT64(0x00020000007E12), UTIL_UINT64(0x0002500000F605), UTIL_UINT64(0x0000220000F706), UTIL_UINT64(0x0000240000F607),
+    UTIL_UINT64(0x0000240012F607), UTIL_UINT64(0x0002000000F612), UTIL_UINT64(0x00002200007706), UTIL_UINT64(0x00002400007607),
+    UTIL_UINT64(0x00025000007605), UTIL_UINT64(0x000022000E7706), UTIL_UINT64(0x00002400127607), UTIL_UINT64(0x00020000007612),
+    UTIL_UINT64(0x00028000007609), UTIL_UINT64(0x0002000000BF04), UTIL_UINT64(0x00025000002C05), UTIL_UINT64(0x00002200002D06),
+    UTIL_UINT64(0x00002400002C07), UTIL_UINT64(0x00028000002C09), UTIL_UINT64(0x00020000002C12), UTIL_UINT64(0x00020000011C05),
+    UTIL_UINT64(0x00002201CD1D06), UTIL_UINT64(0x00002201B91D06), UTIL_UINT64(0x00020000011D04), UTIL_UINT64(0x00020000011C12),
+    UTIL_UINT64(0x0002500000AC05), UTIL_UINT64(0x0000240000AC07), UTIL_UINT64(0x0000220000AD06), UTIL_UINT64(0x0002000000AC12),
+    UTIL_UINT64(0x0002500000AD04), UTIL_UINT64(0x0000220012AD06), UTIL_UINT64(0x10425000008CA2), UTIL_UINT64(0x10525000002EA2),
+    UTIL_UINT64(0x0002800000AC09), UTIL_UINT64(0x00045606006205), UTIL_UINT64(0x00045686006205), UTIL_UINT64(0x0002000000001C),
+    UTIL_UINT64(0x0002000000001D), UTIL_UINT64(0x0004002E006005), UTIL_UINT64(0x00040000000000), UTIL_UINT64(0x10625024008CA2),
+    UTIL_UINT64(0x10725024008CA2), UTIL_UINT64(0x10825024008CA2), UTIL_UINT64(0x10925024008CA2), UTIL_UINT64(0x10A25024008CA2),
+    UTIL_UINT64(0x10B25024008CA2), UTIL_UINT64(0x10C25024000AA2), UTIL_UINT64(0x10D25024000AA2), UTIL_UINT64(0x10E25024000AA2),
+    UTIL_UINT64(0x10F25024000AA2), UTIL_UINT64(0x11025024000AA2), UTIL_UINT64(0x0002482E006A05), UTIL_UINT64(0x00002200346B06),
+    UTIL_UINT64(0x00024824006A05), UTIL_UINT64(0x00020024006A13), UTIL_UINT64(0x00020024000814), UTIL_UINT64(0x00047824003212),
+    UTIL_UINT64(0x00040024003212), UTIL_UINT64(0x00047024003312), UTIL_UINT64(0x0004002400320E), UTIL_UINT64(0x0004002400320F),
+    UTIL_UINT64(0x0004002400320D), UTIL_UINT64(0x0004882400320C), UTIL_UINT64(0x00046824003312), UTIL_UINT64(0x00040024003213),
+    UTIL_UINT64(0x00040024003214), UTIL_UINT64(0x00048024003209), UTIL_UINT64(0x00145024008CC1), UTIL_UINT64(0x00040024003315),
+    UTIL_UINT64(0x00245024008CA2), UTIL_UINT64(0x00024024007C05), UTIL_UINT64(0x00024024003304), UTIL_UINT64(0x00022224003304),
+    UTIL_UINT64(0x00025024006205), UTIL_UINT64(0x00025000009405), UTIL_UINT64(0x0002500000580A), UTIL_UINT64(0x0002000000580B),
+    UTIL_UINT64(0x00020000005816), UTIL_UINT64(0x00025000009805), UTIL_UINT64(0x00025000002605), UTIL_UINT64(0x0002500000D405),
+    UTIL_UINT64(0x0002000000D40B), UTIL_UINT64(0x00025000005405), UTIL_UINT64(0x0002500000540A), UTIL_UINT64(0x0002500000D805),
+    UTIL_UINT64(0x00002201CCD906), UTIL_UINT64(0x00025000013405), UTIL_UINT64(0x00020000013412), UTIL_UINT64(0x0002500000DA05),
+    UTIL_UINT64(0x0002000000DA12), UTIL_UINT64(0x0002500000DA0A), UTIL_UINT64(0x11125000003EC1), UTIL_UINT64(0x11225000003EA2),
+    UTIL_UINT64(0x00025000010005), UTIL_UINT64(0x0002500000E805), UTIL_UINT64(0x0002800000E809), UTIL_UINT64(0x1112500000E6C1),
+    UTIL_UINT64(0x1122500000E6A2), UTIL_UINT64(0x00025000004A05), UTIL_UINT64(0x00025000002805), UTIL_UINT64(0x00020000002812),
+    UTIL_UINT64(0x113250000138C1), UTIL_UINT64(0x114250000138A2), UTIL_UINT64(0x00025000009205), UTIL_UINT64(0x00025000003805),
+    UTIL_UINT64(0x00025000006E05), UTIL_UINT64(0x00020000006E12), UTIL_UINT64(0x00020000006E0B), UTIL_UINT64(0x0002500000EC05),
+    UTIL_UINT64(0x0002000000EC16), UTIL_UINT64(0x0002000000EC0B), UTIL_UINT64(0x0002500000C005), UTIL_UINT64(0x0002000000C00B),
+    UTIL_UINT64(0x00025000006805), UTIL_UINT64(0x0002000000680B), UTIL_UINT64(0x0002500000F205), UTIL_UINT64(0x0002000000F20B),
+    UTIL_UINT64(0x0002000000F212), UTIL_UINT64(0x00025000009A05), UTIL_UINT64(0x00020000009A12), UTIL_UINT64(0x0002500000B205),
+    UTIL_UINT64(0x0002500000B005), UTIL_UINT64(0x0002000000B00B), UTIL_UINT64(0x00025000008005), UTIL_UINT64(0x00002200008106),
+    UTIL_UINT64(0x00002201B88106), UTIL_UINT64(0x00002201CC8106), UTIL_UINT64(0x00002200028106), UTIL_UINT64(0x00002200128106),
+    UTIL_UINT64(0x0002000000800B), UTIL_UINT64(0x00020000008012), UTIL_UINT64(0x0002500000DE05), UTIL_UINT64(0x0002000000DE0B),
+    UTIL_UINT64(0x0002000000DE12), UTIL_UINT64(0x0002500000D605), UTIL_UINT64(0x0002000000D60B), UTIL_UINT64(0x0002500000A405),
+    UTIL_UINT64(0x0002000000A416), UTIL_UINT64(0x00002201CCA506), UTIL_UINT64(0x00002201B8A506), UTIL_UINT64(0x0002000000A40B),
+    UTIL_UINT64(0x0002000000A412), UTIL_UINT64(0x00025000000C05), UTIL_UINT64(0x00020000000C12), UTIL_UINT64(0x00025000007405),
+    UTIL_UINT64(0x0002000000740B), UTIL_UINT64(0x00025000007205), UTIL_UINT64(0x0002000000720B), UTIL_UINT64(0x0002500000F405),
+    UTIL_UINT64(0x0002000000F412), UTIL_UINT64(0x0002000000F40B), UTIL_UINT64(0x0002500000E005), UTIL_UINT64(0x0512500000D2C1),
+    UTIL_UINT64(0x0582500000D2A2), UTIL_UINT64(0x0002000000D20B), UTIL_UINT64(0x00025000006405), UTIL_UINT64(0x00002201CC6506),
+    UTIL_UINT64(0x00028000006409), UTIL_UINT64(0x0002000000080B), UTIL_UINT64(0x00025000013E05), UTIL_UINT64(0x00002201CD3F06),
+    UTIL_UINT64(0x00020000013E0D), UTIL_UINT64(0x0002500000DC05), UTIL_UINT64(0x0002000000DC0B), UTIL_UINT64(0x00025000010805),
+    UTIL_UINT64(0x00002201B90906), UTIL_UINT64(0x00002201CD0906), UTIL_UINT64(0x0002000001080B), UTIL_UINT64(0x00020000010812),
+    UTIL_UINT64(0x0002500000E205), UTIL_UINT64(0x00002201CCE306), UTIL_UINT64(0x00002201B8E306), UTIL_UINT64(0x0002000000E212),
+    UTIL_UINT64(0x00025000003005), UTIL_UINT64(0x0002000000300B), UTIL_UINT64(0x00025000004C05), UTIL_UINT64(0x00002400001C07),
+    UTIL_UINT64(0x00002200001D06), UTIL_UINT64(0x00025000001C05), UTIL_UINT64(0x00002200121D06), UTIL_UINT64(0x00020000001C12),
+    UTIL_UINT64(0x00020000001C0B), UTIL_UINT64(0x00028000001C09), UTIL_UINT64(0x00002200007906), UTIL_UINT64(0x00002400007807),
+    UTIL_UINT64(0x00025000007805), UTIL_UINT64(0x00025006007805), UTIL_UINT64(0x00002200127906), UTIL_UINT64(0x000022500E7906),
+    UTIL_UINT64(0x00020000007812), UTIL_UINT64(0x00003B8000791B), UTIL_UINT64(0x00025000010A05), UTIL_UINT64(0x00028000010A09),
+    UTIL_UINT64(0x00002201CC2B06), UTIL_UINT64(0x00025000002A05), UTIL_UINT64(0x00002250002B06), UTIL_UINT64(0x00002200002B06),
+    UTIL_UINT64(0x00002400002A07), UTIL_UINT64(0x00002206002B06), UTIL_UINT64(0x00002200122B06), UTIL_UINT64(0x00028000002A09),
+    UTIL_UINT64(0x00020000002A12), UTIL_UINT64(0x00025000009C05), UTIL_UINT64(0x000022000E9D06), UTIL_UINT64(0x00020000009C12),
+    UTIL_UINT64(0x0000220000FF06), UTIL_UINT64(0x0000240000FE07), UTIL_UINT64(0x0002500000FE05), UTIL_UINT64(0x0000240012FE07),
+    UTIL_UINT64(0x0002538000FE05), UTIL_UINT64(0x0002000000FE12), UTIL_UINT64(0x000022000EFF06), UTIL_UINT64(0x0002800000FE09),
+    UTIL_UINT64(0x0002000001060B), UTIL_UINT64(0x00025000008605), UTIL_UINT64(0x00002400008607), UTIL_UINT64(0x00002200008706),
+    UTIL_UINT64(0x00002400128607), UTIL_UINT64(0x000022000E8706), UTIL_UINT64(0x00020000008612), UTIL_UINT64(0x0002500000BC05),
+    UTIL_UINT64(0x0002000000BC12), UTIL_UINT64(0x00025000008805), UTIL_UINT64(0x00002200008906), UTIL_UINT64(0x00002400008807),
+    UTIL_UINT64(0x000022000E8906), UTIL_UINT64(0x00002200128906), UTIL_UINT64(0x00028000008809), UTIL_UINT64(0x00002200005706),
+    UTIL_UINT64(0x00002400005607), UTIL_UINT64(0x00025000005605), UTIL_UINT64(0x000022000E7106), UTIL_UINT64(0x000022000E5706),
+    UTIL_UINT64(0x00002250005607), UTIL_UINT64(0x00002406005607), UTIL_UINT64(0x00002400125607), UTIL_UINT64(0x00002201CC5706),
+    UTIL_UINT64(0x0002500000C605), UTIL_UINT64(0x0000240000C607), UTIL_UINT64(0x0000220000C706), UTIL_UINT64(0x0000220012C706),
+    UTIL_UINT64(0x000022000EC706), UTIL_UINT64(0x0002000000C612), UTIL_UINT64(0x0002800000C609), UTIL_UINT64(0x00002201CCC706),
+    UTIL_UINT64(0x00025000013005), UTIL_UINT64(0x00002250013007), UTIL_UINT64(0x00002400013007), UTIL_UINT64(0x00002200013106),
+    UTIL_UINT64(0x00002250013106), UTIL_UINT64(0x00002406013007), UTIL_UINT64(0x00002200133106), UTIL_UINT64(0x000022000F3106),
+    UTIL_UINT64(0x00020000013012), UTIL_UINT64(0x00028000013009), UTIL_UINT64(0x00025000010205), UTIL_UINT64(0x00002250010207),
+    UTIL_UINT64(0x00002400010207), UTIL_UINT64(0x00002200010306), UTIL_UINT64(0x00002406010207), UTIL_UINT64(0x00002200130306),
+    UTIL_UINT64(0x000022000F0306), UTIL_UINT64(0x00020000010212), UTIL_UINT64(0x0002500000B605), UTIL_UINT64(0x0000240000B607),
+    UTIL_UINT64(0x0000220000B706), UTIL_UINT64(0x0000220012B706), UTIL_UINT64(0x0002000000B612), UTIL_UINT64(0x0002800000B609),
+    UTIL_UINT64(0x00025000011E05), UTIL_UINT64(0x00002200011F06), UTIL_UINT64(0x00002400011E07), UTIL_UINT64(0x00002400131E07),
+    UTIL_UINT64(0x000022000F1F06), UTIL_UINT64(0x00020000011E12), UTIL_UINT64(0x00028000011E09), UTIL_UINT64(0x00020000000405),
+    UTIL_UINT64(0x00002200000506), UTIL_UINT64(0x00002000000407), UTIL_UINT64(0x00002400000407), UTIL_UINT64(0x00002200120506),
+    UTIL_UINT64(0x00028000000409), UTIL_UINT64(0x0002000000040B), UTIL_UINT64(0x00020000000412), UTIL_UINT64(0x00020000000416),
+    UTIL_UINT64(0x00025000004405), UTIL_UINT64(0x00002400004407), UTIL_UINT64(0x00002200004506), UTIL_UINT64(0x00002200124506),
+    UTIL_UINT64(0x000022000E4506), UTIL_UINT64(0x00020000004412), UTIL_UINT64(0x00125000013CC1), UTIL_UINT64(0x00225000013CA2),
+    UTIL_UINT64(0x00028000013C09), UTIL_UINT64(0x00020000013C0B), UTIL_UINT64(0x00025000013C05), UTIL_UINT64(0x00025000004205),
+    UTIL_UINT64(0x00002250004207), UTIL_UINT64(0x00002400004207), UTIL_UINT64(0x00002406004207), UTIL_UINT64(0x00002200004306),
+    UTIL_UINT64(0x00002400124207), UTIL_UINT64(0x00002200124306), UTIL_UINT64(0x00025380004205), UTIL_UINT64(0x000022000E4306),
+    UTIL_UINT64(0x00020000004212), UTIL_UINT64(0x00028000004209), UTIL_UINT64(0x0002500000C205), UTIL_UINT64(0x0000240000C207),
+    UTIL_UINT64(0x0000220000C306), UTIL_UINT64(0x0000220012C306), UTIL_UINT64(0x0002000000C212), UTIL_UINT64(0x00025000014205),
+    UTIL_UINT64(0x00002200014306), UTIL_UINT64(0x00002200134306), UTIL_UINT64(0x00002400014207), UTIL_UINT64(0x00025380014205),
+    UTIL_UINT64(0x00020000014212), UTIL_UINT64(0x00025000010C05), UTIL_UINT64(0x00002200010D06), UTIL_UINT64(0x00002400010C07),
+    UTIL_UINT64(0x00025380010C05), UTIL_UINT64(0x00002200130D06), UTIL_UINT64(0x00020000010C12), UTIL_UINT64(0x0002500000EE05),
+    UTIL_UINT64(0x00025000001805), UTIL_UINT64(0x00002400001807), UTIL_UINT64(0x00002200001906), UTIL_UINT64(0x00002200121906),
+    UTIL_UINT64(0x00020000001812), UTIL_UINT64(0x00028000001809), UTIL_UINT64(0x0002000000180B), UTIL_UINT64(0x0002000000A612),
+    UTIL_UINT64(0x0002500000A605), UTIL_UINT64(0x0000220000A706), UTIL_UINT64(0x0000240000A607), UTIL_UINT64(0x0002500000A805),
+    UTIL_UINT64(0x0000220000A906), UTIL_UINT64(0x000022000EA906), UTIL_UINT64(0x0000220012A906), UTIL_UINT64(0x0002538000A805),
+    UTIL_UINT64(0x0002800000A809), UTIL_UINT64(0x00025000005C05), UTIL_UINT64(0x00002400005C07), UTIL_UINT64(0x00002200005D06),
+    UTIL_UINT64(0x00002200125D06), UTIL_UINT64(0x00028000005C09), UTIL_UINT64(0x00025000009E05), UTIL_UINT64(0x00002200009F06),
+    UTIL_UINT64(0x00002400009E07), UTIL_UINT64(0x00020000009E12), UTIL_UINT64(0x00020000012012), UTIL_UINT64(0x00025000003605),
+    UTIL_UINT64(0x0002500000360A), UTIL_UINT64(0x00020000003612), UTIL_UINT64(0x00025000003A05), UTIL_UINT64(0x00020000003A12),
+    UTIL_UINT64(0x00025000004805), UTIL_UINT64(0x0000398000491B), UTIL_UINT64(0x00025000000605), UTIL_UINT64(0x0002500000BA05),
+    UTIL_UINT64(0x0002800000BA09), UTIL_UINT64(0x0002000000BA12), UTIL_UINT64(0x00025000012205), UTIL_UINT64(0x00028000012209),
+    UTIL_UINT64(0x00025000001205), UTIL_UINT64(0x00002200021306), UTIL_UINT64(0x00020000001212), UTIL_UINT64(0x0002500000EA05),
+    UTIL_UINT64(0x00002201CCEB06), UTIL_UINT64(0x0002000000EA12), UTIL_UINT64(0x0002000000EA16), UTIL_UINT64(0x0002500000EB04),
+    UTIL_UINT64(0x0002800000EA09), UTIL_UINT64(0x0002000000EA0B), UTIL_UINT64(0x0012500000AAC1), UTIL_UINT64(0x0022500000AAA2),
+    UTIL_UINT64(0x0002000000AA0B), UTIL_UINT64(0x0002000000AA12), UTIL_UINT64(0x0002500000B405), UTIL_UINT64(0x0000220000B506),
+    UTIL_UINT64(0x0000240000B407), UTIL_UINT64(0x0002500000B504), UTIL_UINT64(0x00045000012504), UTIL_UINT64(0x0004500000CB04),
+    UTIL_UINT64(0x00040000006012), UTIL_UINT64(0x00002200008306), UTIL_UINT64(0x000024000C6007), UTIL_UINT64(0x00040000012405),
+    UTIL_UINT64(0x00040000008205), UTIL_UINT64(0x0004000000CA05), UTIL_UINT64(0x00025000004605), UTIL_UINT64(0x00020000004616),
+    UTIL_UINT64(0x00002200004706), UTIL_UINT64(0x00002200024706), UTIL_UINT64(0x00020000004612), UTIL_UINT64(0x0002002E003216),
+    UTIL_UINT64(0x00002201B03207), UTIL_UINT64(0x00002401B03207), UTIL_UINT64(0x00002401C43207), UTIL_UINT64(0x00002201CC5906),
+    UTIL_UINT64(0x00028024003209), UTIL_UINT64(0x00020000010416), UTIL_UINT64(0x00002200010506), UTIL_UINT64(0x00020000010412),
+    UTIL_UINT64(0x00002201CC5306), UTIL_UINT64(0x0002500000CC05), UTIL_UINT64(0x00002201CCCD06), UTIL_UINT64(0x0002500000CD04),
+    UTIL_UINT64(0x0002800000CC09), UTIL_UINT64(0x0002000000CC16), UTIL_UINT64(0x00025000013205), UTIL_UINT64(0x00002201CD3306),
+    UTIL_UINT64(0x00025000013A05), UTIL_UINT64(0x00002201CD3B06), UTIL_UINT64(0x00028000013A09), UTIL_UINT64(0x00020000013A14),
+    UTIL_UINT64(0x0002500000AE05), UTIL_UINT64(0x0002000000AE0B), UTIL_UINT64(0x00002201B8AF06), UTIL_UINT64(0x115250000002C1),
+    UTIL_UINT64(0x116250000002A2), UTIL_UINT64(0x00002201CC0306), UTIL_UINT64(0x000022000E0306), UTIL_UINT64(0x00025000000304),
+    UTIL_UINT64(0x00028000000209), UTIL_UINT64(0x00020000000212), UTIL_UINT64(0x00030000000000), UTIL_UINT64(0x000250240032D6),
+    UTIL_UINT64(0x000250000032D6), UTIL_UINT64(0x00030024003216), UTIL_UINT64(0x000B50000032D6), UTIL_UINT64(0x00023300003216),
+    UTIL_UINT64(0x00040024006C16), UTIL_UINT64(0x00002200003315), UTIL_UINT64(0x0000220000331B)
+};
+
+}
+
+#endif
@@ -0,0 +1,186 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_CHARACTER_PROPERTIES_H
+#define UTIL_CHARACTER_PROPERTIES_H
+
+#include <Unicoder/Unicode.h>
+#include <Unicoder/ConvertUTF.h>
+#include <Unicoder/CharacterData.h>
+
+namespace UtilInternal
+{
+
+//
+// The record of a code point, see CharacterData.h. A single expression so
+// that it is constexpr with C++11: lookups of constants are folded by the
+// compiler.
+//
+UTIL_CONSTEXPR inline uint64
+GetCharacterRecord(UTF32 cp)
+{
+    return CharacterTables<void>::records[cp >= characterLimit ? 0 :
+        CharacterTables<void>::data[
+            CharacterTables<void>::index2[CharacterTables<void>::index1[cp >> characterIndexShift] +
+                                          ((cp >> characterDataShift) & characterIndexMask)] +
+            (cp & characterDataMask)]];
+}
+
+}
+
+namespace Util
+{
+
+//
+// General_Category values, named by their short aliases. Unassigned code
+// points (and those above U+10FFFF) are categoryCn.
+//
+enum GeneralCategory
+{
+    categoryCn,     // Unassigned
+    categoryLu,     // Uppercase_Letter
+    categoryLl,     // Lowercase_Letter
+    categoryLt,     // Titlecase_Letter
+    categoryLm,     // Modifier_Letter
+    categoryLo,     // Other_Letter
+    categoryMn,     // Nonspacing_Mark
+    categoryMc,     // Spacing_Mark
+    categoryMe,     // Enclosing_Mark
+    categoryNd,     // Decimal_Number
+    categoryNl,     // Letter_Number
+    categoryNo,     // Other_Number
+    categoryPc,     // Connector_Punctuation
+    categoryPd,     // Dash_Punctuation
+    categoryPs,     // Open_Punctuation
+    categoryPe,     // Close_Punctuation
+    categoryPi,     // Initial_Punctuation
+    categoryPf,     // Final_Punctuation
+    categoryPo,     // Other_Punctuation
+    categorySm,     // Math_Symbol
+    categorySc,     // Currency_Symbol
+    categorySk,     // Modifier_Symbol
+    categorySo,     // Other_Symbol
+    categoryZs,     // Space_Separator
+    categoryZl,     // Line_Separator
+    categoryZp,     // Paragraph_Separator
+    categoryCc,     // Control
+    categoryCf,     // Format
+    categoryCs,     // Surrogate
+    categoryCo      // Private_Use
+};
+
+//
+// The properties of a code point from the Unicode Character Database.
+// script is the ISO 15924 code of the Script property ("Latn", "Zyyy" for
+// Common, "Zinh" for Inherited, "Zzzz" for Unknown); the same script
+// always yields the same pointer, so scripts can be compared with ==.
+//
+struct CharacterProperties
+{
+    GeneralCategory category;
+    const char* script;
+    int combiningClass;
+    bool lowercase;
+    bool uppercase;
+    bool cased;
+    bool caseIgnorable;
+};
+
+//
+// All properties come from a single table generated by MakeUnicodeTables.pl
+// (CharacterData.h): a three-stage trie of indexes into the distinct
+// property combinations, shared with normalization, case mapping,
+// segmentation and display width. It is constant data, nothing is
+// allocated, computed or read at startup, and a lookup is four dependent
+// loads. The lookups are inline, and constexpr with C++11.
+//
+inline CharacterProperties
+GetCharacterProperties(UtilInternal::UTF32 cp)
+{
+    using namespace UtilInternal;
+    uint64 record = GetCharacterRecord(cp);
+    CharacterProperties properties;
+    properties.category = static_cast<GeneralCategory>(record & characterCategoryMask);
+    properties.script = CharacterTables<void>::scriptCodes[(record >> characterScriptShift) & characterScriptMask];
+    properties.combiningClass = static_cast<int>((record >> characterCombiningClassShift) &
+                                                 characterCombiningClassMask);
+    properties.lowercase = (record & characterLowercase) != 0;
+    properties.uppercase = (record & characterUppercase) != 0;
+    properties.cased = (record & characterCased) != 0;
+    properties.caseIgnorable = (record & characterCaseIgnorable) != 0;
+    return properties;
+}
+
+UTIL_CONSTEXPR inline GeneralCategory
+GetGeneralCategory(UtilInternal::UTF32 cp)
+{
+    return static_cast<GeneralCategory>(UtilInternal::GetCharacterRecord(cp) & UtilInternal::characterCategoryMask);
+}
+
+UTIL_CONSTEXPR inline const char*
+GetScript(UtilInternal::UTF32 cp)
+{
+    return UtilInternal::CharacterTables<void>::scriptCodes[(UtilInternal::GetCharacterRecord(cp) >>
+                                                             UtilInternal::characterScriptShift) &
+                                                            UtilInternal::characterScriptMask];
+}
+
+UTIL_CONSTEXPR inline int
+GetCombiningClass(UtilInternal::UTF32 cp)
+{
+    return static_cast<int>((UtilInternal::GetCharacterRecord(cp) >> UtilInternal::characterCombiningClassShift) &
+                            UtilInternal::characterCombiningClassMask);
+}
+
+//
+// The Lowercase, Uppercase, Cased and Case_Ignorable derived properties.
+// Lowercase and Uppercase are wider than categoryLl and categoryLu, e.g.
+// U+00AA FEMININE ORDINAL INDICATOR and U+24B6 CIRCLED LATIN CAPITAL A.
+//
+UTIL_CONSTEXPR inline bool
+IsLowercase(UtilInternal::UTF32 cp)
+{
+    return (UtilInternal::GetCharacterRecord(cp) & UtilInternal::characterLowercase) != 0;
+}
+
+UTIL_CONSTEXPR inline bool
+IsUppercase(UtilInternal::UTF32 cp)
+{
+    return (UtilInternal::GetCharacterRecord(cp) & UtilInternal::characterUppercase) != 0;
+}
+
+UTIL_CONSTEXPR inline bool
+IsCased(UtilInternal::UTF32 cp)
+{
+    return (UtilInternal::GetCharacterRecord(cp) & UtilInternal::characterCased) != 0;
+}
+
+UTIL_CONSTEXPR inline bool
+IsCaseIgnorable(UtilInternal::UTF32 cp)
+{
+    return (UtilInternal::GetCharacterRecord(cp) & UtilInternal::characterCaseIgnorable) != 0;
+}
+
+//
+// The short alias of a category, e.g. "Lu".
+//
+inline const char*
+GeneralCategoryName(GeneralCategory category)
+{
+    assert(category >= categoryCn && category <= categoryCo);
+    return UtilInternal::CharacterTables<void>::categoryNames[category];
+}
+
+//
+// Size in bytes of the property tables.
+//
+UTIL_API size_t CharacterPropertiesTableSize();
+
+}
+
+#endif
@@ -0,0 +1,94 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_CODE_POINT_INDEX_H
+#define UTIL_CODE_POINT_INDEX_H
+
+#include <Unicoder/Unicode.h>
+
+#include <string>
+#include <vector>
+
+namespace Util
+{
+
+//
+// Sidecar index over a UTF-8 buffer which maps code point positions to byte
+// offsets and back in constant time plus a scan of at most one stride.
+//
+// Two tables are kept: the byte offset of every stride-th code point, and
+// the number of code points starting before every stride-th byte. Both are
+// built with the vectorized continuation byte count, so for the default
+// stride of 512 the index costs about 3% of the text size.
+//
+// Every byte that is not a continuation byte starts a code point, which is
+// exact for well-formed UTF-8; validate the buffer first if it may not be.
+//
+// The index does not own the buffer: it must stay alive and unchanged
+// between Build() / Update() and the queries.
+//
+class UTIL_API CodePointIndex
+{
+public:
+
+    explicit CodePointIndex(size_t stride = 512);
+
+    void Build(const char* data, size_t size);
+    void Build(const std::string& str);
+
+    //
+    // Brings the index up to date after the buffer was edited: data / size
+    // describe the new buffer, whose first editOffset bytes are unchanged
+    // (editOffset must be a code point boundary, at most size). Only the
+    // part of the index after the edit is recomputed.
+    //
+    void Update(const char* data, size_t size, size_t editOffset);
+
+    //
+    // Number of code points in the buffer.
+    //
+    size_t Size() const;
+
+    //
+    // Byte offset of the code point with the given index; Size() maps to
+    // the size of the buffer.
+    //
+    size_t ByteOffset(size_t codePoint) const;
+
+    //
+    // Number of code points that start before byteOffset, which is the
+    // index of the code point at byteOffset if that is a boundary.
+    //
+    size_t CodePointOffset(size_t byteOffset) const;
+
+    //
+    // The bytes of count code points starting with code point first,
+    // count is clamped to the end of the buffer.
+    //
+    std::string Substring(size_t first, size_t count) const;
+
+private:
+
+    void Reindex();
+
+    const Byte* m_data;
+    size_t m_size;
+    size_t m_count;
+    const size_t m_stride;
+
+    //
+    // m_byteOffsets[i] is the byte offset of code point i * m_stride,
+    // m_codePointOffsets[i] the number of code points before byte i * m_stride.
+    //
+    std::vector<size_t> m_byteOffsets;
+    std::vector<size_t> m_codePointOffsets;
+};
+
+}
+
+#endif
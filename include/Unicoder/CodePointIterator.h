@@ -0,0 +1,407 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_CODE_POINT_ITERATOR_H
+#define UTIL_CODE_POINT_ITERATOR_H
+
+#include <Unicoder/Transcoder.h>
+
+#include <iterator>
+
+namespace Util
+{
+
+namespace TranscoderInternal
+{
+
+//
+// Steps back from position to the start of the previous code point, such
+// that stepping forward from the result with the same Encoding::Decode
+// lands on position again.
+//
+template<int Form>
+struct CodePointRetreater
+{
+    template<typename Encoding, typename unitT>
+    static const unitT* Retreat(const unitT* begin, const unitT* position)
+    {
+        return position - 1;
+    }
+};
+
+template<>
+struct CodePointRetreater<8>
+{
+    template<typename Encoding, typename unitT>
+    static const unitT* Retreat(const unitT* begin, const unitT* position)
+    {
+        const unitT* start = position - 1;
+        int length = 1;
+        while (length < 4 && start > begin && (static_cast<Byte>(*start) & 0xC0) == 0x80)
+        {
+            --start;
+            ++length;
+        }
+
+        //
+        // Only a well-formed sequence ending exactly at position is stepped
+        // over as a whole, anything else was a single ill-formed unit.
+        //
+        const unitT* next = start;
+        UtilInternal::UTF32 ch;
+        if (length > 1 &&
+            Encoding::Decode(next, position, ch, strictConversion) == UtilInternal::conversionOK &&
+            next == position)
+        {
+            return start;
+        }
+        return position - 1;
+    }
+};
+
+template<>
+struct CodePointRetreater<16>
+{
+    template<typename Encoding, typename unitT>
+    static const unitT* Retreat(const unitT* begin, const unitT* position)
+    {
+        UtilInternal::UTF32 low = static_cast<UtilInternal::UTF16>(position[-1]);
+        if (low >= 0xDC00 && low <= 0xDFFF && position - 2 >= begin)
+        {
+            UtilInternal::UTF32 high = static_cast<UtilInternal::UTF16>(position[-2]);
+            if (high >= 0xD800 && high <= 0xDBFF)
+            {
+                return position - 2;
+            }
+        }
+        return position - 1;
+    }
+};
+
+}
+
+//
+// Bidirectional iterator that decodes the code points of a UTF-8, UTF-16 or
+// UTF-32 buffer on the fly, without allocating.
+//
+// In strict mode an ill-formed or truncated sequence raises
+// UTFConversionException when it is dereferenced or stepped over; in
+// lenient mode it yields U+FFFD and counts as one code unit, otherwise the
+// lenient rules of the Encoding apply (e.g. unpaired UTF-16 surrogates are
+// passed through, like ConvertUTF16toUTF8 does).
+//
+template<typename Encoding>
+class CodePointIterator
+{
+public:
+
+    typedef typename Encoding::CodeUnit CodeUnit;
+
+    typedef std::bidirectional_iterator_tag iterator_category;
+    typedef UtilInternal::UTF32             value_type;
+    typedef ptrdiff_t                       difference_type;
+    typedef const UtilInternal::UTF32*      pointer;
+    typedef UtilInternal::UTF32             reference;
+
+    CodePointIterator() :
+        m_position(0),
+        m_begin(0),
+        m_end(0),
+        m_flags(lenientConversion),
+        m_length(0),
+        m_value(0)
+    {
+    }
+
+    CodePointIterator(const CodeUnit* position, const CodeUnit* begin, const CodeUnit* end,
+                      ConversionFlags flags = lenientConversion) :
+        m_position(position),
+        m_begin(begin),
+        m_end(end),
+        m_flags(flags),
+        m_length(0),
+        m_value(0)
+    {
+        assert(begin <= position && position <= end);
+    }
+
+    reference operator*() const
+    {
+        Decode();
+        return m_value;
+    }
+
+    CodePointIterator& operator++()
+    {
+        Decode();
+        m_position += m_length;
+        m_length = 0;
+        return *this;
+    }
+
+    CodePointIterator operator++(int)
+    {
+        CodePointIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    CodePointIterator& operator--()
+    {
+        assert(m_position > m_begin);
+        m_position = TranscoderInternal::CodePointRetreater<Encoding::Form>::template
+            Retreat<Encoding>(m_begin, m_position);
+        m_length = 0;
+        return *this;
+    }
+
+    CodePointIterator operator--(int)
+    {
+        CodePointIterator tmp = *this;
+        --*this;
+        return tmp;
+    }
+
+    bool operator==(const CodePointIterator& rhs) const
+    {
+        return m_position == rhs.m_position;
+    }
+
+    bool operator!=(const CodePointIterator& rhs) const
+    {
+        return m_position != rhs.m_position;
+    }
+
+    //
+    // The code unit the current code point starts at.
+    //
+    const CodeUnit* Base() const
+    {
+        return m_position;
+    }
+
+    //
+    // Number of code units of the current code point.
+    //
+    int Length() const
+    {
+        Decode();
+        return m_length;
+    }
+
+private:
+
+    void Decode() const
+    {
+        if (m_length != 0)
+        {
+            return;
+        }
+        assert(m_position < m_end);
+
+        const CodeUnit* next = m_position;
+        UtilInternal::ConversionResult result = Encoding::Decode(next, m_end, m_value, m_flags);
+        if (result == UtilInternal::conversionOK)
+        {
+            m_length = static_cast<int>(next - m_position);
+        }
+        else if (m_flags == lenientConversion)
+        {
+            m_value = 0xFFFD; // UNI_REPLACEMENT_CHAR
+            m_length = 1;
+        }
+        else
+        {
+            throw UTFConversionException(__FILE__, __LINE__,
+                                         result == UtilInternal::sourceExhausted ? partialCharacter : badEncoding);
+        }
+    }
+
+    const CodeUnit* m_position;
+    const CodeUnit* m_begin;
+    const CodeUnit* m_end;
+    ConversionFlags m_flags;
+
+    //
+    // The decoded code point at m_position, valid if m_length != 0.
+    //
+    mutable int m_length;
+    mutable UtilInternal::UTF32 m_value;
+};
+
+//
+// A lazy view of the code points of [first, last). It only holds the two
+// pointers, so it is as cheap to copy as the iterators, and works with
+// range-based for and the standard algorithms.
+//
+template<typename Encoding>
+class CodePointRange
+{
+public:
+
+    typedef typename Encoding::CodeUnit CodeUnit;
+    typedef CodePointIterator<Encoding> iterator;
+    typedef CodePointIterator<Encoding> const_iterator;
+
+    CodePointRange() :
+        m_first(0),
+        m_last(0),
+        m_flags(lenientConversion)
+    {
+    }
+
+    CodePointRange(const CodeUnit* first, const CodeUnit* last, ConversionFlags flags = lenientConversion) :
+        m_first(first),
+        m_last(last),
+        m_flags(flags)
+    {
+    }
+
+    iterator begin() const
+    {
+        return iterator(m_first, m_first, m_last, m_flags);
+    }
+
+    iterator end() const
+    {
+        return iterator(m_last, m_first, m_last, m_flags);
+    }
+
+    bool empty() const
+    {
+        return m_first == m_last;
+    }
+
+    //
+    // Number of code points, found by walking the whole range.
+    //
+    size_t Count() const
+    {
+        size_t count = 0;
+        for (iterator p = begin(); p != end(); ++p)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+private:
+
+    const CodeUnit* m_first;
+    const CodeUnit* m_last;
+    ConversionFlags m_flags;
+};
+
+typedef CodePointIterator<UTF8Encoding>     UTF8CodePointIterator;
+typedef CodePointIterator<UTF16Encoding>    UTF16CodePointIterator;
+typedef CodePointIterator<WstringEncoding>  WstringCodePointIterator;
+
+typedef CodePointRange<UTF8Encoding>        UTF8CodePointRange;
+typedef CodePointRange<UTF16Encoding>       UTF16CodePointRange;
+typedef CodePointRange<WstringEncoding>     WstringCodePointRange;
+
+inline UTF8CodePointRange
+UTF8CodePoints(const char* first, const char* last, ConversionFlags flags = lenientConversion)
+{
+    return UTF8CodePointRange(reinterpret_cast<const Byte*>(first), reinterpret_cast<const Byte*>(last), flags);
+}
+
+inline UTF8CodePointRange
+UTF8CodePoints(const std::string& str, ConversionFlags flags = lenientConversion)
+{
+    return UTF8CodePoints(str.data(), str.data() + str.size(), flags);
+}
+
+inline UTF16CodePointRange
+UTF16CodePoints(const UtilInternal::UTF16* first, const UtilInternal::UTF16* last,
+                ConversionFlags flags = lenientConversion)
+{
+    return UTF16CodePointRange(first, last, flags);
+}
+
+inline WstringCodePointRange
+WstringCodePoints(const std::wstring& str, ConversionFlags flags = lenientConversion)
+{
+    return WstringCodePointRange(str.data(), str.data() + str.size(), flags);
+}
+
+//
+// Output iterator that encodes the code points assigned to it into the
+// code units of Encoding and writes these to out, e.g.
+//
+//     std::u16string utf16; // or std::vector<UTF16>
+//     std::copy(UTF8CodePoints(str).begin(), UTF8CodePoints(str).end(),
+//               EncodeTo<UTF16Encoding>(std::back_inserter(utf16)));
+//
+// Every code point produced by a CodePointIterator can be encoded, so
+// no error is ever reported.
+//
+template<typename Encoding, typename OutputIterator>
+class CodePointOutputIterator
+{
+public:
+
+    typedef std::output_iterator_tag iterator_category;
+    typedef void                     value_type;
+    typedef ptrdiff_t                difference_type;
+    typedef void                     pointer;
+    typedef void                     reference;
+
+    explicit CodePointOutputIterator(OutputIterator out) :
+        m_out(out)
+    {
+    }
+
+    CodePointOutputIterator& operator=(UtilInternal::UTF32 ch)
+    {
+        typename Encoding::CodeUnit units[Encoding::MaxUnitsPerCodePoint];
+        typename Encoding::CodeUnit* last = units;
+        Encoding::Encode(ch, last, units + Encoding::MaxUnitsPerCodePoint);
+        for (typename Encoding::CodeUnit* p = units; p != last; ++p)
+        {
+            *m_out = *p;
+            ++m_out;
+        }
+        return *this;
+    }
+
+    CodePointOutputIterator& operator*()
+    {
+        return *this;
+    }
+
+    CodePointOutputIterator& operator++()
+    {
+        return *this;
+    }
+
+    CodePointOutputIterator& operator++(int)
+    {
+        return *this;
+    }
+
+    OutputIterator Base() const
+    {
+        return m_out;
+    }
+
+private:
+
+    OutputIterator m_out;
+};
+
+template<typename Encoding, typename OutputIterator>
+inline CodePointOutputIterator<Encoding, OutputIterator>
+EncodeTo(OutputIterator out)
+{
+    return CodePointOutputIterator<Encoding, OutputIterator>(out);
+}
+
+}
+
+#endif
@@ -0,0 +1,160 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_COLLATION_H
+#define UTIL_COLLATION_H
+
+#include <Unicoder/Unicode.h>
+#include <Unicoder/ConvertUTF.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Util
+{
+
+//
+// The levels of differences a Collator takes into account: base letters,
+// then accents, then case and variants.
+//
+enum CollationStrength
+{
+    primaryStrength = 1,
+    secondaryStrength,
+    tertiaryStrength
+};
+
+//
+// Locale-aware ordering of UTF-8 strings according to UTS #10, the
+// Unicode Collation Algorithm, with the Default Unicode Collation Element
+// Table generated by MakeUnicodeTables.pl. Variable weighting is
+// non-ignorable (spaces and punctuation are compared like letters).
+//
+// UTF-8 is decoded inline, text is only normalized (to NFD) if it holds
+// combining marks (or, with tailorings, is not in NFD). Ill-formed bytes
+// are weighed as U+FFFD.
+//
+// To sort many strings, generate their sort keys once (GetSortKey or
+// SortKeyBatch) and compare the keys with memcmp, or std::string's
+// operator<. Compare, on the other hand, only weighs the strings until
+// the first difference and needs no memory.
+//
+class UTIL_API Collator
+{
+public:
+
+    explicit Collator(CollationStrength strength = tertiaryStrength);
+
+    CollationStrength GetStrength() const
+    {
+        return m_strength;
+    }
+
+    //
+    // Basic tailoring: sequence, one or more characters, collates as if it
+    // were reference. The sequence is matched before the default table (the
+    // longest tailored sequence wins) but only contiguously. For example
+    //
+    //     Tailor("\xC3\xA4", "ae");           // German phonebook: a-umlaut as "ae"
+    //     Tailor("ch", "h\xF4\x8F\xBF\xBD");  // Czech: "ch" after all words with "h"
+    //
+    // where the last one uses that unassigned code points sort after all
+    // letters. sequence is matched in NFD, so "\xC3\xA4" and "a\xCC\x88"
+    // tailor the same sequence and both forms of it in the text match.
+    //
+    void Tailor(const std::string& sequence, const std::string& reference);
+
+    //
+    // Returns < 0, 0 or > 0 like strcmp.
+    //
+    int Compare(const char* first1, const char* last1, const char* first2, const char* last2) const;
+    int Compare(const std::string& lhs, const std::string& rhs) const;
+
+    //
+    // Appends the sort key of [first, last) to key: the primary weights,
+    // then the secondary and tertiary ones, each level after a 0x0000
+    // separator. Sort keys compare (with memcmp) like the strings.
+    //
+    void AppendSortKey(const char* first, const char* last, std::string& key) const;
+    std::string GetSortKey(const std::string& utf8) const;
+
+private:
+
+    friend class SortKeyBatch;
+
+    class ElementIterator;
+
+    void AppendSortKey(const char* first, const char* last, std::string& key, std::vector<uint32>& elements) const;
+
+    struct Tailoring
+    {
+        std::vector<UtilInternal::UTF32> sequence;
+        std::vector<uint32> elements;
+    };
+
+    CollationStrength m_strength;
+
+    //
+    // By first code point, longest sequence first.
+    //
+    std::map<UtilInternal::UTF32, std::vector<Tailoring> > m_tailorings;
+};
+
+//
+// The sort keys of many strings, generated into a single buffer: nothing
+// is allocated per key and the keys are contiguous in memory.
+//
+class UTIL_API SortKeyBatch
+{
+public:
+
+    explicit SortKeyBatch(const Collator& collator);
+
+    //
+    // Preallocates room for count keys of the given total size.
+    //
+    void Reserve(size_t count, size_t bytes);
+
+    //
+    // Generates the sort key of a string and returns its index.
+    //
+    size_t Add(const char* first, const char* last);
+    size_t Add(const std::string& utf8);
+
+    size_t Size() const
+    {
+        return m_ends.size();
+    }
+
+    const char* KeyData(size_t index) const;
+    size_t KeySize(size_t index) const;
+
+    //
+    // Compares two keys with memcmp, returns < 0, 0 or > 0.
+    //
+    int Compare(size_t lhs, size_t rhs) const;
+
+    //
+    // Fills order with the indexes of the keys, sorted (stably) by key.
+    //
+    void Sort(std::vector<size_t>& order) const;
+
+    void Clear();
+
+private:
+
+    const Collator& m_collator;
+    std::string m_keys;
+    std::vector<size_t> m_ends;
+    std::vector<uint32> m_elements;
+};
+
+}
+
+#endif
@@ -0,0 +1,117 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_COMPACT_STRING_H
+#define UTIL_COMPACT_STRING_H
+
+#include <Unicoder/Unicode.h>
+#include <Unicoder/ConvertUTF.h>
+
+#include <string>
+#include <vector>
+
+namespace Util
+{
+
+//
+// Immutable sequence of code points stored with the narrowest fixed width
+// that holds its largest code point (the "flexible string representation"
+// of Python's PEP 393):
+//
+//   1 byte  - all code points <= U+00FF (Latin-1, includes ASCII)
+//   2 bytes - all code points <= U+FFFF (UCS-2)
+//   4 bytes - otherwise (UTF-32)
+//
+// Indexing is O(1). Text that is mostly Latin takes a quarter of the memory
+// of a std::wstring with 4-byte wchar_t. The width is always the narrowest
+// possible, so two equal strings also have equal representations.
+//
+// Conversion errors raise UTFConversionException, like StringToWstring.
+//
+class UTIL_API CompactString
+{
+public:
+
+    CompactString();
+
+    explicit CompactString(const std::string& utf8, ConversionFlags = lenientConversion);
+    explicit CompactString(const std::wstring& wstr, ConversionFlags = lenientConversion);
+
+    static CompactString FromUTF8(const char* first, const char* last, ConversionFlags = lenientConversion);
+    static CompactString FromCodePoints(const UtilInternal::UTF32* first, const UtilInternal::UTF32* last);
+
+    std::string ToUTF8() const;
+    std::wstring ToWstring() const;
+
+    //
+    // Number of code points.
+    //
+    size_t Size() const
+    {
+        return m_size;
+    }
+
+    bool Empty() const
+    {
+        return m_size == 0;
+    }
+
+    //
+    // Bytes per code point: 1, 2 or 4.
+    //
+    int Width() const
+    {
+        return m_width;
+    }
+
+    //
+    // Bytes used by the code points, excluding the object itself.
+    //
+    size_t StorageSize() const
+    {
+        return m_data.size();
+    }
+
+    UtilInternal::UTF32 operator[](size_t index) const
+    {
+        assert(index < m_size);
+        switch (m_width)
+        {
+            case 1:
+                return m_data[index];
+            case 2:
+                return reinterpret_cast<const UtilInternal::UTF16*>(&m_data[0])[index];
+            default:
+                return reinterpret_cast<const UtilInternal::UTF32*>(&m_data[0])[index];
+        }
+    }
+
+    //
+    // Code points [pos, pos + count), count is clamped to the end.
+    //
+    CompactString Substr(size_t pos, size_t count = std::string::npos) const;
+
+    bool operator==(const CompactString& rhs) const;
+    bool operator!=(const CompactString& rhs) const;
+    bool operator<(const CompactString& rhs) const;
+
+    void Swap(CompactString& rhs);
+
+private:
+
+    template<typename unitT>
+    void Assign(const unitT* first, const unitT* last);
+
+    std::vector<Byte> m_data;
+    size_t m_size;
+    int m_width;
+};
+
+}
+
+#endif
@@ -0,0 +1,70 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_DISPLAY_WIDTH_H
+#define UTIL_DISPLAY_WIDTH_H
+
+#include <Unicoder/Unicode.h>
+#include <Unicoder/ConvertUTF.h>
+
+#include <string>
+
+namespace Util
+{
+
+//
+// Number of terminal columns taken by a code point, like POSIX wcwidth()
+// but independent of the locale: 0 for NUL, combining marks, format
+// characters and other zero width characters, 2 for East Asian Wide and
+// Fullwidth characters (CJK, most emoji), -1 for the other C0 and C1
+// control characters and 1 otherwise.
+//
+UTIL_API int CodePointWidth(UtilInternal::UTF32 cp);
+
+//
+// Number of terminal columns taken by UTF-8 text, like wcswidth() except
+// that control characters take no columns instead of failing. Like the
+// common terminals, an emoji after U+200D ZERO WIDTH JOINER takes no
+// columns (emoji ZWJ sequences are as wide as their first emoji) and an
+// emoji followed by U+FE0F VARIATION SELECTOR-16 is wide. Ill-formed bytes
+// take one column each, as if replaced by U+FFFD.
+//
+// Runs of ASCII are counted with SIMD instructions, other characters are
+// looked up in the character property table (CharacterData.h).
+//
+UTIL_API size_t DisplayWidth(const char* first, const char* last);
+UTIL_API size_t DisplayWidth(const std::string& utf8);
+
+//
+// Returns the length in bytes of the longest prefix of [utf8, utf8 + size)
+// that fits in columns, without splitting a character or separating one
+// from the zero width characters that follow it (e.g. combining marks).
+// If width is not null it receives the width of that prefix, which can be
+// less than columns if the next character is a wide one.
+//
+UTIL_API size_t ColumnTruncationLength(const char* utf8, size_t size, size_t columns, size_t* width = 0);
+UTIL_API std::string TruncateToColumns(const std::string& utf8, size_t columns);
+
+enum ColumnAlignment
+{
+    alignLeft,
+    alignRight
+};
+
+//
+// Truncates utf8 to columns like TruncateToColumns and fills it up with
+// fill (a single column ASCII character) to exactly columns, on the right
+// with alignLeft and on the left with alignRight. Done in a single pass
+// over utf8.
+//
+UTIL_API std::string PadToColumns(const std::string& utf8, size_t columns,
+                                  ColumnAlignment alignment = alignLeft, char fill = ' ');
+
+}
+
+#endif
@@ -52,6 +52,9 @@ namespace Util
 // The implementation allocates a pair of iconv_t on each thread, to avoid
 // opening / closing iconv_t objects all the time.
 //
+// When charT is a byte and internalCode is UTF-8 (the usual nl_langinfo
+// result on Linux) no iconv_t is ever opened: the conversions validate the
+// input and copy it with a single memcpy.
 //
 template<typename charT>
 class IconvStringConverter : public Util::BasicStringConverter<charT>
@@ -69,6 +72,8 @@ public:
     virtual Util::Byte* ToUTF8(const charT*, const charT*, Util::UTF8Buffer&) const;
     
     virtual void FromUTF8(const Util::Byte*, const Util::Byte*, std::basic_string<charT>&) const;
+
+    virtual bool IsUTF8() const;
     
 private:
 
@@ -84,6 +89,7 @@ private:
     mutable pthread_key_t m_key;
 #endif
     const std::string m_internalCode;
+    const bool m_identity;
 };
 
 //
@@ -99,8 +105,14 @@ extern "C"
 
 template<typename charT>
 IconvStringConverter<charT>::IconvStringConverter(const char* internalCode) :
-    m_internalCode(internalCode)
+    m_internalCode(internalCode),
+    m_identity(sizeof(charT) == 1 && Util::IsUTF8Codeset(internalCode))
 {
+    if (m_identity)
+    {
+        return;
+    }
+
     try
     {
         Close(CreateDescriptors());
@@ -133,6 +145,11 @@ IconvStringConverter<charT>::IconvStringConverter(const char* internalCode) :
 template<typename charT>
 IconvStringConverter<charT>::~IconvStringConverter()
 {
+    if (m_identity)
+    {
+        return;
+    }
+
 #ifdef _WIN32
     void* val = TlsGetValue(m_key);
     if (val != 0)
@@ -238,6 +255,20 @@ IconvStringConverter<charT>::Close(std::pair<iconv_t, iconv_t> cdp)
 template<typename charT> Util::Byte* 
 IconvStringConverter<charT>::ToUTF8(const charT* sourceStart, const charT* sourceEnd, Util::UTF8Buffer& buf) const
 { 
+    if (m_identity)
+    {
+        const Util::Byte* source = reinterpret_cast<const Util::Byte*>(sourceStart);
+        size_t size = static_cast<size_t>(sourceEnd - sourceStart);
+        if (!Util::IsLegalUTF8Sequence(source, source + size))
+        {
+            throw Util::StringConversionException(__FILE__, __LINE__, "UTF-8 string source illegal");
+        }
+
+        Util::Byte* target = buf.GetMoreBytes(std::max(size, size_t(1)), 0);
+        memcpy(target, source, size);
+        return target + size;
+    }
+
     iconv_t cd = GetDescriptors().second;
     
 #ifdef NDEBUG
@@ -285,6 +316,16 @@ template<typename charT> void
 IconvStringConverter<charT>::FromUTF8(const Util::Byte* sourceStart, const Util::Byte* sourceEnd,
                                       std::basic_string<charT>& target) const
 {
+    if (m_identity)
+    {
+        if (!Util::IsLegalUTF8Sequence(sourceStart, sourceEnd))
+        {
+            throw Util::StringConversionException(__FILE__, __LINE__, "UTF-8 string source illegal");
+        }
+        target.assign(reinterpret_cast<const charT*>(sourceStart), sourceEnd - sourceStart);
+        return;
+    }
+
     iconv_t cd = GetDescriptors().first;
     
 #ifdef NDEBUG
@@ -355,6 +396,12 @@ IconvStringConverter<charT>::FromUTF8(const Util::Byte* sourceStart, const Util:
     free(buf);
 }
 
+template<typename charT> bool
+IconvStringConverter<charT>::IsUTF8() const
+{
+    return m_identity;
+}
+
 }
 
 #endif
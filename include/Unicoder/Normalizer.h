@@ -0,0 +1,67 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_NORMALIZER_H
+#define UTIL_NORMALIZER_H
+
+#include <Unicoder/Unicode.h>
+
+#include <string>
+
+namespace Util
+{
+
+//
+// Unicode normalization forms, see UAX #15.
+//
+enum NormalizationForm
+{
+    NFC,
+    NFD,
+    NFKC,
+    NFKD
+};
+
+//
+// Unicode normalization of UTF-8 std::strings and of std::wstrings
+// (UTF-16 or UTF-32 depending on sizeof(wchar_t)).
+//
+// All functions first run the UAX #15 quick check, which settles nearly
+// all strings that are already normalized without decoding more than
+// their non-ASCII characters and without allocating. Otherwise only the
+// part from the last safe starter before the first offending character
+// is decomposed (and recomposed) in a stack buffer.
+//
+// Ill-formed input raises UTFConversionException with strictConversion,
+// from IsNormalized() as well as from Normalize(). With lenientConversion
+// ill-formed UTF-8 is replaced by U+FFFD and lone surrogates in wide
+// strings are kept.
+//
+
+UTIL_API bool IsNormalized(const std::string& utf8, NormalizationForm form,
+                           ConversionFlags flags = lenientConversion);
+UTIL_API bool IsNormalized(const std::wstring& wstr, NormalizationForm form,
+                           ConversionFlags flags = lenientConversion);
+
+UTIL_API std::string Normalize(const std::string& utf8, NormalizationForm form,
+                               ConversionFlags flags = lenientConversion);
+UTIL_API std::wstring Normalize(const std::wstring& wstr, NormalizationForm form,
+                                ConversionFlags flags = lenientConversion);
+
+//
+// Leaves the string untouched (no copy, no allocation) if it is already
+// in the given form.
+//
+UTIL_API void NormalizeInPlace(std::string& utf8, NormalizationForm form,
+                               ConversionFlags flags = lenientConversion);
+UTIL_API void NormalizeInPlace(std::wstring& wstr, NormalizationForm form,
+                               ConversionFlags flags = lenientConversion);
+
+}
+
+#endif
@@ -0,0 +1,237 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_SEGMENTATION_H
+#define UTIL_SEGMENTATION_H
+
+#include <Unicoder/Unicode.h>
+
+#include <iterator>
+#include <string>
+#include <utility>
+
+namespace Util
+{
+
+//
+// Text segmentation of UTF-8 buffers according to UAX #29 "Unicode Text
+// Segmentation": extended grapheme clusters (user-perceived characters,
+// e.g. a base letter with its combining marks, a Hangul syllable or an
+// emoji ZWJ sequence) and words.
+//
+// Both return the end of the segment that starts at first, i.e. the next
+// boundary after first, or last. first must be a segment boundary. A pair
+// of ASCII characters other than CR LF is always a grapheme boundary, so
+// runs of ASCII are split without any table lookup. Ill-formed bytes are
+// segments of their own.
+//
+UTIL_API const char* NextGraphemeBoundary(const char* first, const char* last);
+UTIL_API const char* NextWordBoundary(const char* first, const char* last);
+
+struct GraphemeBoundaries
+{
+    static const char* Next(const char* first, const char* last)
+    {
+        return NextGraphemeBoundary(first, last);
+    }
+};
+
+struct WordBoundaries
+{
+    static const char* Next(const char* first, const char* last)
+    {
+        return NextWordBoundary(first, last);
+    }
+};
+
+//
+// Forward iterator over the segments of a UTF-8 buffer, as pairs of
+// pointers [first, second). Nothing is allocated or copied.
+//
+template<typename Boundaries>
+class SegmentIterator
+{
+public:
+
+    typedef std::forward_iterator_tag                   iterator_category;
+    typedef std::pair<const char*, const char*>         value_type;
+    typedef ptrdiff_t                                   difference_type;
+    typedef const value_type*                           pointer;
+    typedef const value_type&                           reference;
+
+    SegmentIterator() :
+        m_segment(static_cast<const char*>(0), static_cast<const char*>(0)),
+        m_last(0)
+    {
+    }
+
+    //
+    // position must be a segment boundary of [position, last).
+    //
+    SegmentIterator(const char* position, const char* last) :
+        m_segment(position, position == last ? last : Boundaries::Next(position, last)),
+        m_last(last)
+    {
+    }
+
+    reference operator*() const
+    {
+        return m_segment;
+    }
+
+    pointer operator->() const
+    {
+        return &m_segment;
+    }
+
+    SegmentIterator& operator++()
+    {
+        assert(m_segment.first != m_last);
+        m_segment.first = m_segment.second;
+        m_segment.second = m_segment.first == m_last ? m_last : Boundaries::Next(m_segment.first, m_last);
+        return *this;
+    }
+
+    SegmentIterator operator++(int)
+    {
+        SegmentIterator tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    bool operator==(const SegmentIterator& rhs) const
+    {
+        return m_segment.first == rhs.m_segment.first;
+    }
+
+    bool operator!=(const SegmentIterator& rhs) const
+    {
+        return m_segment.first != rhs.m_segment.first;
+    }
+
+    //
+    // The start of the current segment.
+    //
+    const char* Base() const
+    {
+        return m_segment.first;
+    }
+
+    std::string ToString() const
+    {
+        return std::string(m_segment.first, m_segment.second);
+    }
+
+private:
+
+    value_type m_segment;
+    const char* m_last;
+};
+
+//
+// A lazy view of the segments of [first, last), like CodePointRange.
+//
+template<typename Boundaries>
+class SegmentRange
+{
+public:
+
+    typedef SegmentIterator<Boundaries> iterator;
+    typedef SegmentIterator<Boundaries> const_iterator;
+
+    SegmentRange() :
+        m_first(0),
+        m_last(0)
+    {
+    }
+
+    SegmentRange(const char* first, const char* last) :
+        m_first(first),
+        m_last(last)
+    {
+    }
+
+    iterator begin() const
+    {
+        return iterator(m_first, m_last);
+    }
+
+    iterator end() const
+    {
+        return iterator(m_last, m_last);
+    }
+
+    bool empty() const
+    {
+        return m_first == m_last;
+    }
+
+    //
+    // Number of segments, found by walking the whole range.
+    //
+    size_t Count() const
+    {
+        size_t count = 0;
+        for (const char* p = m_first; p != m_last; p = Boundaries::Next(p, m_last))
+        {
+            ++count;
+        }
+        return count;
+    }
+
+private:
+
+    const char* m_first;
+    const char* m_last;
+};
+
+typedef SegmentIterator<GraphemeBoundaries> GraphemeIterator;
+typedef SegmentIterator<WordBoundaries>     WordIterator;
+
+typedef SegmentRange<GraphemeBoundaries>    GraphemeRange;
+typedef SegmentRange<WordBoundaries>        WordRange;
+
+inline GraphemeRange
+Graphemes(const char* first, const char* last)
+{
+    return GraphemeRange(first, last);
+}
+
+inline GraphemeRange
+Graphemes(const std::string& utf8)
+{
+    return GraphemeRange(utf8.data(), utf8.data() + utf8.size());
+}
+
+//
+// The words and the segments between them (spaces, punctuation).
+//
+inline WordRange
+Words(const char* first, const char* last)
+{
+    return WordRange(first, last);
+}
+
+inline WordRange
+Words(const std::string& utf8)
+{
+    return WordRange(utf8.data(), utf8.data() + utf8.size());
+}
+
+//
+// Like UTF8TruncationLength, but never splits a grapheme cluster either,
+// e.g. a letter from its accents or an emoji ZWJ sequence. Only the text
+// from the last certain boundary before maxBytes is examined, usually a
+// single cluster.
+//
+UTIL_API size_t GraphemeTruncationLength(const char* utf8, size_t size, size_t maxBytes);
+UTIL_API std::string TruncateGraphemes(const std::string& utf8, size_t maxBytes);
+
+}
+
+#endif
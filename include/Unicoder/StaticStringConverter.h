@@ -0,0 +1,123 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_STATIC_STRING_CONVERTER_H
+#define UTIL_STATIC_STRING_CONVERTER_H
+
+#include <Unicoder/StringConverter.h>
+#include <Unicoder/Transcoder.h>
+
+namespace Util
+{
+
+//
+// Non-virtual counterpart of BasicStringConverter for callers that know
+// the encoding of their charT strings at compile time, e.g.
+//
+//     StaticStringConverter<wchar_t, WstringEncoding> converter;
+//     converter.FromUTF8(first, last, wstr);
+//
+// ToUTF8 accepts any Buffer type with a GetMoreBytes(size_t, Byte*) member,
+// so with a concrete buffer class nothing on the conversion path goes
+// through a virtual call and the whole Transcoder kernel is inlined.
+// Errors are reported by raising StringConversionException, exactly like
+// the virtual converters, which are implemented as adapters over this class.
+//
+template<typename charT, typename Encoding>
+class StaticStringConverter
+{
+public:
+
+    typedef typename Encoding::CodeUnit CodeUnit;
+
+    explicit StaticStringConverter(ConversionFlags flags = lenientConversion) :
+        m_conversionFlags(flags)
+    {
+    }
+
+    //
+    // Returns a pointer to byte after the last written byte (which may be
+    // past the last byte returned by GetMoreBytes).
+    //
+    template<class Buffer>
+    Byte* ToUTF8(const charT* sourceStart, const charT* sourceEnd, Buffer& buffer) const
+    {
+        typedef Transcoder<Encoding, UTF8Encoding> ToUTF8Transcoder;
+
+        const CodeUnit* source = reinterpret_cast<const CodeUnit*>(sourceStart);
+        const CodeUnit* end = reinterpret_cast<const CodeUnit*>(sourceEnd);
+
+        //
+        // The "chunk size" is the maximum of the number of characters in the
+        // source and 4 (== max bytes necessary to encode one Unicode character).
+        //
+        size_t chunkSize = std::max<size_t>(static_cast<size_t>(end - source), 4);
+
+        Byte* targetStart = buffer.GetMoreBytes(chunkSize, 0);
+        Byte* targetEnd = targetStart + chunkSize;
+
+        UtilInternal::ConversionResult result;
+        while ((result = ToUTF8Transcoder::Convert(source, end, targetStart, targetEnd, m_conversionFlags))
+               == UtilInternal::targetExhausted)
+        {
+            targetStart = buffer.GetMoreBytes(chunkSize, targetStart);
+            targetEnd = targetStart + chunkSize;
+        }
+
+        if (result != UtilInternal::conversionOK)
+        {
+            Raise(result, sizeof(charT) == 1 ? "UTF-8 string source" : "wide string source");
+        }
+        return targetStart;
+    }
+
+    //
+    // Unmarshals a UTF-8 sequence into a basic_string. The string is sized
+    // once for the worst case and converted into in place.
+    //
+    void FromUTF8(const Byte* sourceStart, const Byte* sourceEnd, std::basic_string<charT>& target) const
+    {
+        UtilInternal::ConversionResult result =
+            Transcoder<UTF8Encoding, Encoding>::Convert(sourceStart, sourceEnd, target, m_conversionFlags);
+        if (result != UtilInternal::conversionOK)
+        {
+            Raise(result, "UTF-8 string source");
+        }
+    }
+
+    ConversionFlags Flags() const
+    {
+        return m_conversionFlags;
+    }
+
+private:
+
+    typedef char UnitSizeCheck[sizeof(charT) == sizeof(CodeUnit) ? 1 : -1];
+
+    static void Raise(UtilInternal::ConversionResult result, const char* source)
+    {
+        switch (result)
+        {
+            case UtilInternal::sourceExhausted:
+                throw StringConversionException(__FILE__, __LINE__, std::string(source) + " exhausted");
+            case UtilInternal::sourceIllegal:
+                throw StringConversionException(__FILE__, __LINE__, std::string(source) + " illegal");
+            default:
+            {
+                assert(0);
+                throw StringConversionException(__FILE__, __LINE__);
+            }
+        }
+    }
+
+    ConversionFlags m_conversionFlags;
+};
+
+}
+
+#endif
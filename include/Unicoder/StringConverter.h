@@ -63,6 +63,16 @@ public:
     //
     virtual void FromUTF8(const Byte* sourceStart, const Byte* sourceEnd,
                           std::basic_string<charT>& target) const = 0;
+
+    //
+    // Returns true if charT strings are already UTF-8 encoded, so that
+    // ToUTF8 and FromUTF8 reduce to a (validated) copy which callers that
+    // own the source string may skip altogether.
+    //
+    virtual bool IsUTF8() const
+    {
+        return false;
+    }
 };
 
 typedef BasicStringConverter<char> StringConverter;
@@ -89,6 +99,34 @@ private:
     const Util::ConversionFlags m_conversionFlags;
 };
 
+//
+// Converts narrow strings that are already UTF-8 encoded: ToUTF8 and
+// FromUTF8 copy the bytes with a single memcpy. With validate set the
+// input is first checked with IsLegalUTF8Sequence, which skips ASCII
+// runs 16 bytes at a time; without it the input is trusted.
+//
+class UTIL_API UTF8StringConverter : public StringConverter
+{
+public:
+
+    explicit UTF8StringConverter(bool validate = true);
+
+    virtual Byte* ToUTF8(const char*, const char*, UTF8Buffer&) const;
+
+    virtual void FromUTF8(const Byte*, const Byte*, std::string&) const;
+
+    virtual bool IsUTF8() const;
+
+private:
+    const bool m_validate;
+};
+
+//
+// Returns true if codeset names UTF-8, e.g. "UTF-8", "utf8" or "UTF_8"
+// (case and the '-' / '_' separator are ignored).
+//
+UTIL_API bool IsUTF8Codeset(const std::string& codeset);
+
 #ifdef _WIN32
 
 //
@@ -106,6 +144,8 @@ public:
 
     virtual void FromUTF8(const Byte*, const Byte*, std::string& target) const;
 
+    virtual bool IsUTF8() const;
+
 private:
     int getCodePage(const std::string& internalCode);
 
@@ -114,6 +154,15 @@ private:
 };
 #endif
 
+//
+// Creates a converter for the given native narrow string encoding, or for
+// the encoding of the current locale (Windows: the ANSI code page) when
+// internalCode is empty. If that encoding is UTF-8 a UTF8StringConverter
+// is returned and no iconv / MultiByteToWideChar pass is ever made.
+//
+UTIL_API StringConverterPtr
+CreateStringConverter(const std::string& internalCode = std::string());
+
 //
 // Converts the given string from the native narrow string encoding to
 // UTF8 using the given converter. If the converter is null, returns
@@ -130,6 +179,19 @@ NativeToUTF8(const Util::StringConverterPtr&, const std::string&);
 UTIL_API std::string
 UTF8ToNative(const Util::StringConverterPtr&, const std::string&);
 
+//
+// In-place variants of the two functions above, for callers that own the
+// string. If the converter is null the string is left untouched; if the
+// converter IsUTF8() the string is only checked with IsLegalUTF8Sequence
+// (StringConversionException if it is illegal) and is neither copied nor
+// reallocated.
+//
+UTIL_API void
+NativeToUTF8InPlace(const Util::StringConverterPtr&, std::string&);
+
+UTIL_API void
+UTF8ToNativeInPlace(const Util::StringConverterPtr&, std::string&);
+
 //////////////////////////////////////////////////////////////////////////
 /// StringConversionException
 class UTIL_API StringConversionException : public Exception
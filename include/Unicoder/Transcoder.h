@@ -0,0 +1,468 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_TRANSCODER_H
+#define UTIL_TRANSCODER_H
+
+#include <Unicoder/Unicode.h>
+#include <Unicoder/ConvertUTF.h>
+
+#include <string>
+
+namespace Util
+{
+
+//
+// Compile-time encoding traits. Every encoding provides:
+//
+//   CodeUnit                - the code unit type
+//   Form                    - 8, 16 or 32 (the code unit width in bits)
+//   MaxUnitsPerCodePoint    - worst case number of code units of one code point
+//   UnitsFor(ch)            - number of code units needed to encode ch
+//   Decode / Encode         - convert one code point, with the same error
+//                             semantics as the ConvertUTF functions
+//
+// Decode reads one code point at source and advances source past it; on
+// error source is left untouched. Encode writes ch (which must have been
+// produced by a Decode) at target and advances target; if there is not
+// enough room it returns targetExhausted and leaves target untouched.
+//
+// Everything is inline so that a Transcoder instantiated with two of these
+// compiles down to a single loop without any indirect call.
+//
+
+template<typename unitT>
+struct BasicUTF8Encoding
+{
+    typedef unitT CodeUnit;
+
+    STATIC_CONSTANT(int, Form = 8);
+    STATIC_CONSTANT(int, MaxUnitsPerCodePoint = 4);
+
+    static const char* Name()
+    {
+        return "UTF-8";
+    }
+
+    static UTIL_CONSTEXPR int UnitsFor(UtilInternal::UTF32 ch)
+    {
+        return ch < 0x80 ? 1 : ch < 0x800 ? 2 : ch < 0x10000 ? 3 : 4;
+    }
+
+    static UtilInternal::ConversionResult
+    Decode(const CodeUnit*& source, const CodeUnit* sourceEnd, UtilInternal::UTF32& ch, ConversionFlags)
+    {
+        const CodeUnit* s = source;
+        UtilInternal::UTF32 b0 = static_cast<Byte>(*s);
+        if (b0 < 0x80)
+        {
+            ch = b0;
+            source = s + 1;
+            return UtilInternal::conversionOK;
+        }
+
+        //
+        // Continuation bytes, overlong two-byte leads (C0, C1) and leads
+        // beyond U+10FFFF (F5..FF) can never start a legal sequence.
+        //
+        if (b0 < 0xC2 || b0 > 0xF4)
+        {
+            return UtilInternal::sourceIllegal;
+        }
+
+        int length = b0 < 0xE0 ? 2 : b0 < 0xF0 ? 3 : 4;
+        if (sourceEnd - s < length)
+        {
+            return UtilInternal::sourceExhausted;
+        }
+
+        //
+        // The second byte carries the overlong / surrogate / range checks,
+        // see Table 3-7 "Well-Formed UTF-8 Byte Sequences".
+        //
+        UtilInternal::UTF32 b1 = static_cast<Byte>(s[1]);
+        Byte low = 0x80;
+        Byte high = 0xBF;
+        switch (b0)
+        {
+            case 0xE0: low = 0xA0; break;
+            case 0xED: high = 0x9F; break;
+            case 0xF0: low = 0x90; break;
+            case 0xF4: high = 0x8F; break;
+            default: break;
+        }
+        if (b1 < low || b1 > high)
+        {
+            return UtilInternal::sourceIllegal;
+        }
+
+        switch (length)
+        {
+            case 2:
+            {
+                ch = ((b0 & 0x1F) << 6) | (b1 & 0x3F);
+                break;
+            }
+            case 3:
+            {
+                UtilInternal::UTF32 b2 = static_cast<Byte>(s[2]);
+                if ((b2 & 0xC0) != 0x80)
+                {
+                    return UtilInternal::sourceIllegal;
+                }
+                ch = ((b0 & 0x0F) << 12) | ((b1 & 0x3F) << 6) | (b2 & 0x3F);
+                break;
+            }
+            default:
+            {
+                UtilInternal::UTF32 b2 = static_cast<Byte>(s[2]);
+                UtilInternal::UTF32 b3 = static_cast<Byte>(s[3]);
+                if ((b2 & 0xC0) != 0x80 || (b3 & 0xC0) != 0x80)
+                {
+                    return UtilInternal::sourceIllegal;
+                }
+                ch = ((b0 & 0x07) << 18) | ((b1 & 0x3F) << 12) | ((b2 & 0x3F) << 6) | (b3 & 0x3F);
+                break;
+            }
+        }
+        source = s + length;
+        return UtilInternal::conversionOK;
+    }
+
+    static UtilInternal::ConversionResult
+    Encode(UtilInternal::UTF32 ch, CodeUnit*& target, CodeUnit* targetEnd)
+    {
+        CodeUnit* t = target;
+        if (ch < 0x80)
+        {
+            if (t >= targetEnd)
+            {
+                return UtilInternal::targetExhausted;
+            }
+            *t++ = static_cast<CodeUnit>(ch);
+        }
+        else if (ch < 0x800)
+        {
+            if (targetEnd - t < 2)
+            {
+                return UtilInternal::targetExhausted;
+            }
+            *t++ = static_cast<CodeUnit>(0xC0 | (ch >> 6));
+            *t++ = static_cast<CodeUnit>(0x80 | (ch & 0x3F));
+        }
+        else if (ch < 0x10000)
+        {
+            if (targetEnd - t < 3)
+            {
+                return UtilInternal::targetExhausted;
+            }
+            *t++ = static_cast<CodeUnit>(0xE0 | (ch >> 12));
+            *t++ = static_cast<CodeUnit>(0x80 | ((ch >> 6) & 0x3F));
+            *t++ = static_cast<CodeUnit>(0x80 | (ch & 0x3F));
+        }
+        else
+        {
+            if (targetEnd - t < 4)
+            {
+                return UtilInternal::targetExhausted;
+            }
+            *t++ = static_cast<CodeUnit>(0xF0 | (ch >> 18));
+            *t++ = static_cast<CodeUnit>(0x80 | ((ch >> 12) & 0x3F));
+            *t++ = static_cast<CodeUnit>(0x80 | ((ch >> 6) & 0x3F));
+            *t++ = static_cast<CodeUnit>(0x80 | (ch & 0x3F));
+        }
+        target = t;
+        return UtilInternal::conversionOK;
+    }
+};
+
+template<typename unitT>
+struct BasicUTF16Encoding
+{
+    typedef unitT CodeUnit;
+
+    STATIC_CONSTANT(int, Form = 16);
+    STATIC_CONSTANT(int, MaxUnitsPerCodePoint = 2);
+
+    static const char* Name()
+    {
+        return "UTF-16";
+    }
+
+    static UTIL_CONSTEXPR int UnitsFor(UtilInternal::UTF32 ch)
+    {
+        return ch < 0x10000 ? 1 : 2;
+    }
+
+    static UtilInternal::ConversionResult
+    Decode(const CodeUnit*& source, const CodeUnit* sourceEnd, UtilInternal::UTF32& ch, ConversionFlags flags)
+    {
+        const CodeUnit* s = source;
+        UtilInternal::UTF32 c = static_cast<UtilInternal::UTF16>(*s);
+        if (c >= 0xD800 && c <= 0xDBFF)
+        {
+            if (s + 1 >= sourceEnd)
+            {
+                return UtilInternal::sourceExhausted;
+            }
+            UtilInternal::UTF32 c2 = static_cast<UtilInternal::UTF16>(s[1]);
+            if (c2 >= 0xDC00 && c2 <= 0xDFFF)
+            {
+                ch = ((c - 0xD800) << 10) + (c2 - 0xDC00) + 0x10000;
+                source = s + 2;
+                return UtilInternal::conversionOK;
+            }
+            if (flags == strictConversion)
+            {
+                return UtilInternal::sourceIllegal;
+            }
+        }
+        else if (c >= 0xDC00 && c <= 0xDFFF && flags == strictConversion)
+        {
+            return UtilInternal::sourceIllegal;
+        }
+        ch = c;
+        source = s + 1;
+        return UtilInternal::conversionOK;
+    }
+
+    static UtilInternal::ConversionResult
+    Encode(UtilInternal::UTF32 ch, CodeUnit*& target, CodeUnit* targetEnd)
+    {
+        if (ch < 0x10000)
+        {
+            if (target >= targetEnd)
+            {
+                return UtilInternal::targetExhausted;
+            }
+            *target++ = static_cast<CodeUnit>(ch);
+        }
+        else
+        {
+            if (targetEnd - target < 2)
+            {
+                return UtilInternal::targetExhausted;
+            }
+            ch -= 0x10000;
+            *target++ = static_cast<CodeUnit>((ch >> 10) + 0xD800);
+            *target++ = static_cast<CodeUnit>((ch & 0x3FF) + 0xDC00);
+        }
+        return UtilInternal::conversionOK;
+    }
+};
+
+template<typename unitT>
+struct BasicUTF32Encoding
+{
+    typedef unitT CodeUnit;
+
+    STATIC_CONSTANT(int, Form = 32);
+    STATIC_CONSTANT(int, MaxUnitsPerCodePoint = 1);
+
+    static const char* Name()
+    {
+        return "UTF-32";
+    }
+
+    static UTIL_CONSTEXPR int UnitsFor(UtilInternal::UTF32)
+    {
+        return 1;
+    }
+
+    static UtilInternal::ConversionResult
+    Decode(const CodeUnit*& source, const CodeUnit*, UtilInternal::UTF32& ch, ConversionFlags flags)
+    {
+        UtilInternal::UTF32 c = static_cast<UtilInternal::UTF32>(*source);
+        if (flags == strictConversion && ((c >= 0xD800 && c <= 0xDFFF) || c > 0x10FFFF))
+        {
+            return UtilInternal::sourceIllegal;
+        }
+        ch = c > 0x10FFFF ? 0xFFFD : c; // UNI_REPLACEMENT_CHAR
+        ++source;
+        return UtilInternal::conversionOK;
+    }
+
+    static UtilInternal::ConversionResult
+    Encode(UtilInternal::UTF32 ch, CodeUnit*& target, CodeUnit* targetEnd)
+    {
+        if (target >= targetEnd)
+        {
+            return UtilInternal::targetExhausted;
+        }
+        *target++ = static_cast<CodeUnit>(ch);
+        return UtilInternal::conversionOK;
+    }
+};
+
+typedef BasicUTF8Encoding<Byte>                  UTF8Encoding;
+typedef BasicUTF16Encoding<UtilInternal::UTF16>  UTF16Encoding;
+typedef BasicUTF32Encoding<UtilInternal::UTF32>  UTF32Encoding;
+
+//
+// The encoding of std::wstring: UTF-16 or UTF-32 depending on sizeof(wchar_t).
+//
+#if defined(WCHAR_T_IS_UTF16)
+typedef BasicUTF16Encoding<wchar_t>              WstringEncoding;
+#else
+typedef BasicUTF32Encoding<wchar_t>              WstringEncoding;
+#endif
+
+namespace TranscoderInternal
+{
+
+//
+// Copies the leading run of ASCII code units, which every Unicode encoding
+// maps one to one. A UTF-8 source is scanned with FindNonASCII, and a run
+// between two UTF-8 buffers is copied with memcpy.
+//
+template<int SourceForm, int TargetForm>
+struct ASCIICopier
+{
+    template<typename S, typename T>
+    static void Copy(const S*& source, const S* sourceEnd, T*& target, T* targetEnd)
+    {
+        while (source < sourceEnd && target < targetEnd && static_cast<UtilInternal::UTF32>(*source) < 0x80)
+        {
+            *target++ = static_cast<T>(*source++);
+        }
+    }
+};
+
+template<int TargetForm>
+struct ASCIICopier<8, TargetForm>
+{
+    template<typename S, typename T>
+    static void Copy(const S*& source, const S* sourceEnd, T*& target, T* targetEnd)
+    {
+        const S* end = sourceEnd - source <= targetEnd - target ? sourceEnd : source + (targetEnd - target);
+        const S* stop = reinterpret_cast<const S*>(
+            UtilInternal::FindNonASCII(reinterpret_cast<const Byte*>(source), reinterpret_cast<const Byte*>(end)));
+        while (source < stop)
+        {
+            *target++ = static_cast<T>(*source++);
+        }
+    }
+};
+
+template<>
+struct ASCIICopier<8, 8>
+{
+    template<typename S, typename T>
+    static void Copy(const S*& source, const S* sourceEnd, T*& target, T* targetEnd)
+    {
+        const S* end = sourceEnd - source <= targetEnd - target ? sourceEnd : source + (targetEnd - target);
+        const S* stop = reinterpret_cast<const S*>(
+            UtilInternal::FindNonASCII(reinterpret_cast<const Byte*>(source), reinterpret_cast<const Byte*>(end)));
+        memcpy(target, source, stop - source);
+        target += stop - source;
+        source = stop;
+    }
+};
+
+}
+
+//
+// Converts between two Unicode encodings known at compile time. Convert()
+// has the contract of the ConvertUTF functions: it converts as much of
+// [sourceStart, sourceEnd) as fits into [targetStart, targetEnd), advances
+// both pointers past what was converted and returns the first problem
+// encountered, if any.
+//
+template<typename SourceEncoding, typename TargetEncoding>
+class Transcoder
+{
+public:
+
+    typedef typename SourceEncoding::CodeUnit SourceUnit;
+    typedef typename TargetEncoding::CodeUnit TargetUnit;
+
+    //
+    // Upper bound of the target code units produced per source code unit.
+    //
+    STATIC_CONSTANT(int, MaxExpansion =
+        TargetEncoding::Form == 8
+            ? (SourceEncoding::Form == 8 ? 1 : SourceEncoding::Form == 16 ? 3 : 4)
+            : (TargetEncoding::Form == 16 && SourceEncoding::Form == 32 ? 2 : 1));
+
+    static UTIL_CONSTEXPR size_t MaxTargetSize(size_t sourceSize)
+    {
+        return sourceSize * MaxExpansion;
+    }
+
+    static UtilInternal::ConversionResult
+    Convert(const SourceUnit*& sourceStart, const SourceUnit* sourceEnd,
+            TargetUnit*& targetStart, TargetUnit* targetEnd, ConversionFlags flags)
+    {
+        UtilInternal::ConversionResult result = UtilInternal::conversionOK;
+        const SourceUnit* source = sourceStart;
+        TargetUnit* target = targetStart;
+
+        while (source < sourceEnd)
+        {
+            TranscoderInternal::ASCIICopier<SourceEncoding::Form, TargetEncoding::Form>::Copy(
+                source, sourceEnd, target, targetEnd);
+            if (source == sourceEnd)
+            {
+                break;
+            }
+
+            const SourceUnit* start = source;
+            UtilInternal::UTF32 ch;
+            result = SourceEncoding::Decode(source, sourceEnd, ch, flags);
+            if (result != UtilInternal::conversionOK)
+            {
+                break;
+            }
+            result = TargetEncoding::Encode(ch, target, targetEnd);
+            if (result != UtilInternal::conversionOK)
+            {
+                source = start; // Back up source pointer!
+                break;
+            }
+        }
+
+        sourceStart = source;
+        targetStart = target;
+        return result;
+    }
+
+    //
+    // Converts the whole source, replacing the contents of target.
+    //
+    template<typename charT>
+    static UtilInternal::ConversionResult
+    Convert(const SourceUnit* sourceStart, const SourceUnit* sourceEnd,
+            std::basic_string<charT>& target, ConversionFlags flags)
+    {
+        typedef char UnitSizeCheck[sizeof(charT) == sizeof(TargetUnit) ? 1 : -1];
+        (void)sizeof(UnitSizeCheck);
+
+        std::basic_string<charT> result;
+        result.resize(MaxTargetSize(static_cast<size_t>(sourceEnd - sourceStart)));
+        if (result.empty())
+        {
+            target.swap(result);
+            return UtilInternal::conversionOK;
+        }
+
+        TargetUnit* first = reinterpret_cast<TargetUnit*>(&result[0]);
+        TargetUnit* last = first;
+        UtilInternal::ConversionResult cr =
+            Convert(sourceStart, sourceEnd, last, first + result.size(), flags);
+        if (cr == UtilInternal::conversionOK)
+        {
+            result.resize(last - first);
+            target.swap(result);
+        }
+        return cr;
+    }
+};
+
+}
+
+#endif
@@ -41,6 +41,19 @@ typedef unsigned char Byte;
 UTIL_API bool
 IsLegalUTF8Sequence(const Byte* source, const Byte* end);
 
+//
+// Returns the largest length <= maxBytes at which the UTF-8 string
+// [utf8, utf8 + size) can be cut without splitting a character. Only the
+// bytes just before maxBytes are examined (at most four), the prefix is
+// never decoded. Continuation bytes that do not belong to a character
+// may be cut anywhere.
+//
+UTIL_API size_t
+UTF8TruncationLength(const char* utf8, size_t size, size_t maxBytes);
+
+UTIL_API std::string TruncateUTF8(const std::string& utf8, size_t maxBytes);
+UTIL_API void TruncateUTF8InPlace(std::string& utf8, size_t maxBytes);
+
 enum ConversionErrorType
 {
     partialCharacter,
@@ -97,10 +110,31 @@ UTIL_API ConversionResult
 ConvertUTF8ToUTFWstring(const Util::Byte*& sourceStart, const Util::Byte* sourceEnd, 
                         wchar_t*& targetStart, wchar_t* targetEnd, Util::ConversionFlags flags);
 
+//
+// Converts the whole source and replaces target with it if the result is
+// conversionOK. sourceStart is advanced past what was converted, as with
+// the overload above.
+//
 UTIL_API ConversionResult 
 ConvertUTF8ToUTFWstring(const Util::Byte*& sourceStart, const Util::Byte* sourceEnd, 
                         std::wstring& target, Util::ConversionFlags flags);
 
+//
+// Returns a pointer to the first byte in [begin, end) that is not 7-bit
+// ASCII, or end if there is none. Scans 16 bytes per step with SSE2/NEON
+// and a machine word per step otherwise.
+//
+UTIL_API const Util::Byte*
+FindNonASCII(const Util::Byte* begin, const Util::Byte* end);
+
+//
+// Returns the number of UTF-8 continuation bytes (10xxxxxx) in [begin, end),
+// i.e. the number of bytes minus the number of code points for well-formed
+// input. Vectorized like FindNonASCII.
+//
+UTIL_API size_t
+CountContinuationBytes(const Util::Byte* begin, const Util::Byte* end);
+
 }
 
 #endif
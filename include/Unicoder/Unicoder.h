@@ -13,7 +13,18 @@
 // This file must include *all* other headers of Unicoder.
 //
 #include <Unicoder/Unicode.h>
+#include <Unicoder/Transcoder.h>
+#include <Unicoder/CodePointIterator.h>
+#include <Unicoder/CodePointIndex.h>
+#include <Unicoder/CompactString.h>
+#include <Unicoder/CharacterProperties.h>
+#include <Unicoder/Normalizer.h>
+#include <Unicoder/CaseMapping.h>
+#include <Unicoder/Segmentation.h>
+#include <Unicoder/DisplayWidth.h>
+#include <Unicoder/Collation.h>
 #include <Unicoder/StringConverter.h>
+#include <Unicoder/StaticStringConverter.h>
 #ifndef _WIN32
 #    include <Unicoder/IconvStringConverter.h>
 #endif
@@ -0,0 +1,168 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_BITS_H
+#define UTIL_BITS_H
+
+#include <Util/Config.h>
+
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+namespace Util
+{
+
+//
+// Portable wrappers around the bit scanning, population count and wide
+// multiplication instructions. The scan functions are undefined for a
+// zero argument, exactly like the underlying instructions.
+//
+namespace Bits
+{
+
+inline int CountTrailingZeros32(uint32 value)
+{
+    assert(value != 0);
+#if defined(__GNUC__)
+    return __builtin_ctz(value);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<int>(index);
+#else
+    int n = 0;
+    while (!(value & 1))
+    {
+        value >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline int CountTrailingZeros64(uint64 value)
+{
+    assert(value != 0);
+#if defined(__GNUC__)
+    return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    uint32 low = static_cast<uint32>(value);
+    return low != 0 ? CountTrailingZeros32(low)
+                    : 32 + CountTrailingZeros32(static_cast<uint32>(value >> 32));
+#endif
+}
+
+inline int CountLeadingZeros32(uint32 value)
+{
+    assert(value != 0);
+#if defined(__GNUC__)
+    return __builtin_clz(value);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return 31 - static_cast<int>(index);
+#else
+    int n = 0;
+    while (!(value & 0x80000000u))
+    {
+        value <<= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline int CountLeadingZeros64(uint64 value)
+{
+    assert(value != 0);
+#if defined(__GNUC__)
+    return __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return 63 - static_cast<int>(index);
+#else
+    uint32 high = static_cast<uint32>(value >> 32);
+    return high != 0 ? CountLeadingZeros32(high)
+                     : 32 + CountLeadingZeros32(static_cast<uint32>(value));
+#endif
+}
+
+//
+// The full 128-bit product of two 64-bit values: returns the low half and
+// stores the high half in high.
+//
+inline uint64 Multiply128(uint64 a, uint64 b, uint64& high)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128;
+    uint128 product = static_cast<uint128>(a) * b;
+    high = static_cast<uint64>(product >> 64);
+    return static_cast<uint64>(product);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return _umul128(a, b, &high);
+#else
+    uint64 aLow = a & 0xFFFFFFFF;
+    uint64 aHigh = a >> 32;
+    uint64 bLow = b & 0xFFFFFFFF;
+    uint64 bHigh = b >> 32;
+    uint64 lowLow = aLow * bLow;
+    uint64 lowHigh = aLow * bHigh;
+    uint64 highLow = aHigh * bLow;
+    uint64 middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFF) + (highLow & 0xFFFFFFFF);
+    high = aHigh * bHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    return (middle << 32) | (lowLow & 0xFFFFFFFF);
+#endif
+}
+
+inline int PopCount32(uint32 value)
+{
+#if defined(__GNUC__)
+    return __builtin_popcount(value);
+#else
+    value = value - ((value >> 1) & 0x55555555u);
+    value = (value & 0x33333333u) + ((value >> 2) & 0x33333333u);
+    return static_cast<int>((((value + (value >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+#endif
+}
+
+inline int PopCount64(uint64 value)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(value);
+#else
+    return PopCount32(static_cast<uint32>(value)) + PopCount32(static_cast<uint32>(value >> 32));
+#endif
+}
+
+//
+// Bit i of the result is the xor of bits 0 to i of value. With the quotes
+// of a block as value, this is the mask of the bytes between an opening
+// quote (included) and its closing quote (excluded).
+//
+inline uint64 PrefixXor64(uint64 value)
+{
+    value ^= value << 1;
+    value ^= value << 2;
+    value ^= value << 4;
+    value ^= value << 8;
+    value ^= value << 16;
+    value ^= value << 32;
+    return value;
+}
+
+}
+
+}
+
+#endif
@@ -0,0 +1,189 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_CSV_PARSER_H
+#define UTIL_CSV_PARSER_H
+
+#include <Util/Config.h>
+#include <Util/StringPiece.h>
+
+#include <string>
+#include <vector>
+
+namespace Util
+{
+
+//
+// The records parsed by a CsvParser, stored by column: Column(c)[r] is
+// field c of record r. Records with fewer fields than ColumnCount() have
+// empty fields at the end, FieldCount(r) tells how many they really have.
+//
+// Fields are pieces of the parsed text, which must outlive the batch,
+// except for fields with quotes or escapes, which are unquoted into the
+// batch itself. Clear() keeps the memory, so a batch reused for chunk
+// after chunk of a file stops allocating once it has grown enough.
+//
+class UTIL_API CsvBatch
+{
+public:
+
+    CsvBatch();
+
+    size_t RecordCount() const
+    {
+        return m_fieldCounts.size();
+    }
+
+    size_t ColumnCount() const
+    {
+        return m_columnCount;
+    }
+
+    size_t FieldCount(size_t record) const
+    {
+        assert(record < m_fieldCounts.size());
+        return m_fieldCounts[record];
+    }
+
+    StringPiece Field(size_t record, size_t column) const
+    {
+        assert(record < m_fieldCounts.size() && column < m_columnCount);
+        return m_columns[column][record];
+    }
+
+    const std::vector<StringPiece>& Column(size_t column) const
+    {
+        assert(column < m_columnCount);
+        return m_columns[column];
+    }
+
+    //
+    // False if the text given with last = true ended inside quotes, the
+    // last field then runs to the end of the text.
+    //
+    bool Balanced() const
+    {
+        return m_balanced;
+    }
+
+    //
+    // False if UTF-8 validation is on and some record is not valid UTF-8.
+    //
+    bool ValidUTF8() const
+    {
+        return m_validUTF8;
+    }
+
+    void Clear();
+
+private:
+
+    friend class CsvParser;
+
+    void AddColumn();
+    void SetCopies(size_t first);
+
+    //
+    // A field unquoted into m_buffer, at [offset, offset + size).
+    //
+    struct Copy
+    {
+        size_t column;
+        size_t record;
+        size_t offset;
+        size_t size;
+    };
+
+    //
+    // Only the first m_columnCount columns are in use, the others are kept
+    // for their memory.
+    //
+    std::vector<std::vector<StringPiece> > m_columns;
+    size_t m_columnCount;
+    std::vector<size_t> m_fieldCounts;
+
+    std::string m_buffer;
+    std::vector<Copy> m_copies;
+
+    bool m_balanced;
+    bool m_validUTF8;
+};
+
+//
+// Splits delimiter separated text in records and fields, with the quoting
+// of String::SplitString: text between single or double quotes is part of
+// the field, quotes removed, delimiters and newlines included, and a
+// backslash before a quote makes it a plain character (outside quotes, or
+// inside quotes of the same kind). Records end at a newline outside
+// quotes, a \r before it is dropped, and empty lines are skipped.
+//
+//     CsvParser parser(';');
+//     CsvBatch batch;
+//     while (size != 0)
+//     {
+//         size_t chunk = std::min(size, chunkSize);
+//         size_t consumed = parser.Parse(data, chunk, batch, chunk == size);
+//         Use(batch);
+//         batch.Clear();
+//         data += consumed;
+//         size -= consumed;
+//     }
+//
+// The text is read 64 bytes at a time: quotes, backslashes, delimiters and
+// newlines are compared with all 64 bytes at once (AVX2, SSE2 or NEON) and
+// turned into one bit mask each. The quoted bytes are the prefix xor of the
+// quotes that are not escaped, so delimiters and newlines are found
+// without looking at the text byte by byte; only fields with quotes are
+// then copied, to remove them. Checking UTF-8, if asked for, is done in the
+// same pass: blocks without bytes above 0x7F are not looked at again.
+//
+class UTIL_API CsvParser
+{
+public:
+
+    //
+    // The delimiter cannot be a quote, a backslash or a newline.
+    //
+    explicit CsvParser(char delimiter = ',', bool validateUTF8 = false);
+
+    //
+    // Appends the records of [data, data + size) to batch and returns the
+    // number of bytes used. Unless last is true, the text may stop in the
+    // middle of a record: parsing then stops after the last newline, and
+    // the rest must be given again, with what follows, to the next call;
+    // 0 means that the text does not hold a whole record. The text can be
+    // a file mapped in memory, it is never copied.
+    //
+    size_t Parse(const void* data, size_t size, CsvBatch& batch, bool last = true);
+
+private:
+
+    //
+    // A field at [first, last) of the text, and whether it has quotes.
+    //
+    struct Span
+    {
+        size_t first;
+        size_t last;
+        bool quoted;
+    };
+
+    void AddRecord(const char* text, CsvBatch& batch);
+
+    char m_delimiter;
+    bool m_validateUTF8;
+
+    //
+    // The fields of the current record.
+    //
+    std::vector<Span> m_fields;
+};
+
+}
+
+#endif
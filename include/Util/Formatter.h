@@ -0,0 +1,338 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_FORMATTER_H
+#define UTIL_FORMATTER_H
+
+#include <Util/Config.h>
+
+//
+// Variadic templates are missing from VC100 to VC110.
+//
+#if defined(LANG_CPP11) && (!defined(_MSC_VER) || _MSC_VER >= 1800)
+
+#include <string>
+#include <vector>
+
+namespace Util
+{
+
+//
+// Type safe formatting, the replacement for the printf style Format:
+//
+//     FormatText("{} of {} bytes, {:.1f}%", done, total, 100.0 * done / total)
+//
+// The format has {} where the next argument goes and {{ and }} for
+// literal braces. {:spec} formats the argument with spec, which is
+// [-][0][width][.precision][type]:
+//
+//     -            left align within width, right is the default
+//     0            pad numbers with zeros instead of spaces
+//     width        the minimum size
+//     precision    the digits after the point for floating point, which
+//                  is then fixed; the maximum size for strings
+//     type         x or X (hexadecimal), o (octal) or b (binary) for
+//                  integers, f (fixed, precision 6 by default) for
+//                  floating point
+//
+// Integers are written in decimal, or in the base of their type with a
+// minus sign if negative ({:x} of -255 is -ff), floating point numbers in
+// their shortest form that converts back (see FormatDouble), bool as true
+// or false and pointers in hexadecimal. Everything is written directly in
+// a single pass, without printf or a temporary string.
+//
+// A malformed format, one whose {} do not match the number of arguments,
+// or a type that does not fit its argument (x on a double, f on an
+// integer) throws IllegalArgumentException, and leaves out as it was.
+//
+
+//
+// One argument, erased to one of the types the formatter writes.
+//
+class UTIL_API FormatArgument
+{
+public:
+
+    FormatArgument() :
+        m_kind(noneArgument)
+    {
+    }
+
+    FormatArgument(bool value) :
+        m_kind(boolArgument)
+    {
+        m_value.integer = value ? 1 : 0;
+    }
+
+    FormatArgument(char value) :
+        m_kind(charArgument)
+    {
+        m_value.integer = value;
+    }
+
+    FormatArgument(signed char value) :
+        m_kind(intArgument)
+    {
+        m_value.integer = value;
+    }
+
+    FormatArgument(unsigned char value) :
+        m_kind(unsignedArgument)
+    {
+        m_value.unsignedInteger = value;
+    }
+
+    FormatArgument(short value) :
+        m_kind(intArgument)
+    {
+        m_value.integer = value;
+    }
+
+    FormatArgument(unsigned short value) :
+        m_kind(unsignedArgument)
+    {
+        m_value.unsignedInteger = value;
+    }
+
+    FormatArgument(int value) :
+        m_kind(intArgument)
+    {
+        m_value.integer = value;
+    }
+
+    FormatArgument(unsigned int value) :
+        m_kind(unsignedArgument)
+    {
+        m_value.unsignedInteger = value;
+    }
+
+    FormatArgument(long value) :
+        m_kind(intArgument)
+    {
+        m_value.integer = value;
+    }
+
+    FormatArgument(unsigned long value) :
+        m_kind(unsignedArgument)
+    {
+        m_value.unsignedInteger = value;
+    }
+
+    FormatArgument(long long value) :
+        m_kind(intArgument)
+    {
+        m_value.integer = value;
+    }
+
+    FormatArgument(unsigned long long value) :
+        m_kind(unsignedArgument)
+    {
+        m_value.unsignedInteger = value;
+    }
+
+    FormatArgument(float value) :
+        m_kind(doubleArgument)
+    {
+        m_value.real = value;
+    }
+
+    FormatArgument(double value) :
+        m_kind(doubleArgument)
+    {
+        m_value.real = value;
+    }
+
+    FormatArgument(long double value) :
+        m_kind(doubleArgument)
+    {
+        m_value.real = static_cast<double>(value);
+    }
+
+    FormatArgument(const char* value) :
+        m_kind(stringArgument)
+    {
+        m_value.text.data = value != 0 ? value : "(null)";
+        m_value.text.size = strlen(m_value.text.data);
+    }
+
+    FormatArgument(const std::string& value) :
+        m_kind(stringArgument)
+    {
+        m_value.text.data = value.data();
+        m_value.text.size = value.size();
+    }
+
+    FormatArgument(const void* value) :
+        m_kind(pointerArgument)
+    {
+        m_value.pointer = value;
+    }
+
+private:
+
+    friend class Formatter;
+
+    enum Kind
+    {
+        noneArgument,
+        boolArgument,
+        charArgument,
+        intArgument,
+        unsignedArgument,
+        doubleArgument,
+        stringArgument,
+        pointerArgument
+    };
+
+    Kind m_kind;
+
+    union
+    {
+        int64 integer;
+        uint64 unsignedInteger;
+        double real;
+        const void* pointer;
+
+        struct
+        {
+            const char* data;
+            size_t size;
+        } text;
+    } m_value;
+};
+
+class FormatPattern;
+
+//
+// The part of the formatting functions below that does not depend on the
+// types of the arguments.
+//
+class UTIL_API Formatter
+{
+public:
+
+    //
+    // A parsed {:spec}.
+    //
+    struct Spec
+    {
+        bool left;
+        bool zero;
+        int width;
+        int precision;
+        char type;
+    };
+
+    static void Append(std::string& out, const char* format, const FormatArgument* arguments, size_t count);
+    static void Append(std::string& out, const FormatPattern& pattern, const FormatArgument* arguments,
+                       size_t count);
+
+private:
+
+    friend class FormatPattern;
+
+    static bool ParseSpec(const char*& p, Spec& spec);
+    static bool TypeFits(const Spec& spec, const FormatArgument& argument);
+    static void AppendUnchecked(std::string& out, const char* format, const FormatArgument* arguments,
+                                size_t count);
+    static void AppendArgument(std::string& out, const Spec& spec, const FormatArgument& argument);
+};
+
+//
+// A format parsed once, to format many times without parsing it again.
+//
+class UTIL_API FormatPattern
+{
+public:
+
+    //
+    // Throws IllegalArgumentException if the format is malformed.
+    //
+    explicit FormatPattern(const std::string& format);
+
+    const std::string& Pattern() const
+    {
+        return m_pattern;
+    }
+
+    //
+    // The number of {} in the format.
+    //
+    size_t ArgumentCount() const
+    {
+        return m_elements.size();
+    }
+
+private:
+
+    friend class Formatter;
+
+    //
+    // The literal text before an argument, at [offset, offset + size) in
+    // m_literals, with the braces unescaped, and the spec of the argument.
+    //
+    struct Element
+    {
+        size_t offset;
+        size_t size;
+        Formatter::Spec spec;
+    };
+
+    std::string m_pattern;
+    std::string m_literals;
+    std::vector<Element> m_elements;
+
+    //
+    // The literal text after the last argument starts at m_tail.
+    //
+    size_t m_tail;
+};
+
+//
+// Append the formatted arguments to out. Once out has grown enough,
+// formatting into it again after clear() allocates nothing.
+//
+template <typename... Args>
+inline void
+FormatTo(std::string& out, const char* format, const Args&... args)
+{
+    const FormatArgument arguments[] = { FormatArgument(args)..., FormatArgument() };
+    Formatter::Append(out, format, arguments, sizeof...(Args));
+}
+
+template <typename... Args>
+inline void
+FormatTo(std::string& out, const FormatPattern& pattern, const Args&... args)
+{
+    const FormatArgument arguments[] = { FormatArgument(args)..., FormatArgument() };
+    Formatter::Append(out, pattern, arguments, sizeof...(Args));
+}
+
+template <typename... Args>
+inline std::string
+FormatText(const char* format, const Args&... args)
+{
+    std::string out;
+    FormatTo(out, format, args...);
+    return out;
+}
+
+template <typename... Args>
+inline std::string
+FormatText(const FormatPattern& pattern, const Args&... args)
+{
+    std::string out;
+    FormatTo(out, pattern, args...);
+    return out;
+}
+
+}
+
+#endif
+
+#endif
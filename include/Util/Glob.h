@@ -0,0 +1,214 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_GLOB_H
+#define UTIL_GLOB_H
+
+#include <Util/Config.h>
+
+#include <string>
+#include <vector>
+
+namespace Util
+{
+
+//
+// Glob patterns, matched against whole strings, byte by byte:
+//
+//     *        any sequence of bytes, empty unless emptyStar is false
+//              (then each star of ** takes at least one byte)
+//     ?        any byte
+//     [abc]    one of the bytes listed, a-z is a range; a ] right after
+//              the [ (or the [!) is listed
+//     [!abc]   any byte not listed, [^abc] is the same
+//     \c       c itself
+//
+// A [ without its ] is a literal [.
+//
+// MatchGlob interprets the pattern at every call. It allocates nothing but
+// can take time proportional to the product of the sizes with many stars,
+// a GlobPattern compiles the pattern once for repeated matching.
+//
+UTIL_API bool MatchGlob(const char* first, const char* last, const char* patternFirst, const char* patternLast,
+                        bool emptyStar = true);
+UTIL_API bool MatchGlob(const std::string& s, const std::string& pattern, bool emptyStar = true);
+
+//
+// A compiled glob pattern. The pattern is split at its stars into
+// segments of fixed size: the first one is matched at the start, the last
+// one at the end and those in between at their leftmost occurrence, which
+// is found with FindBytes when the segment starts with literal bytes.
+// Matching allocates nothing.
+//
+class UTIL_API GlobPattern
+{
+public:
+
+    explicit GlobPattern(const std::string& pattern, bool emptyStar = true);
+
+    const std::string& Pattern() const
+    {
+        return m_pattern;
+    }
+
+    bool Match(const char* first, const char* last) const;
+    bool Match(const std::string& s) const;
+
+    //
+    // The literal bytes every match starts and ends with, and the size of
+    // the shortest match.
+    //
+    const std::string& Prefix() const
+    {
+        return m_prefix;
+    }
+
+    const std::string& Suffix() const
+    {
+        return m_suffix;
+    }
+
+    size_t MinSize() const
+    {
+        return m_minSize;
+    }
+
+private:
+
+    enum ElementKind
+    {
+        literalElement,
+        anyElement,
+        classElement
+    };
+
+    //
+    // Literal bytes at [offset, offset + size) in m_literals, any byte, or
+    // a byte of the class at offset in m_classes.
+    //
+    struct Element
+    {
+        ElementKind kind;
+        uint32 offset;
+        uint32 size;
+    };
+
+    //
+    // Elements [first, first + count), matching size bytes.
+    //
+    struct Segment
+    {
+        uint32 first;
+        uint32 count;
+        size_t size;
+    };
+
+    bool MatchSegment(const Segment&, const Byte* p) const;
+    const Byte* FindSegment(const Segment&, const Byte* first, const Byte* last) const;
+
+    std::string m_pattern;
+    std::string m_literals;
+    std::vector<Element> m_elements;
+    std::vector<Segment> m_segments;
+
+    //
+    // 256 bits per class.
+    //
+    std::vector<uint32> m_classes;
+
+    bool m_star;
+    std::string m_prefix;
+    std::string m_suffix;
+    size_t m_minSize;
+};
+
+//
+// A set of glob patterns matched together: the patterns are indexed by
+// their literal prefix, or by their literal suffix if they have no prefix,
+// so a string is only matched against the patterns it starts (ends) right.
+// Patterns like "*" or "*a*" that have neither are matched against every
+// string.
+//
+class UTIL_API GlobSet
+{
+public:
+
+    GlobSet();
+
+    //
+    // Adds a pattern and returns its index.
+    //
+    size_t Add(const std::string& pattern, bool emptyStar = true);
+
+    size_t Size() const
+    {
+        return m_patterns.size();
+    }
+
+    const GlobPattern& Pattern(size_t index) const
+    {
+        return m_patterns[index];
+    }
+
+    //
+    // The lowest index of a pattern that matches, or std::string::npos.
+    // Allocates nothing.
+    //
+    size_t Find(const char* first, const char* last) const;
+    size_t Find(const std::string& s) const;
+
+    //
+    // Appends the indexes of all the patterns that match, in increasing
+    // order, to matches and returns whether there were any.
+    //
+    bool FindAll(const std::string& s, std::vector<size_t>& matches) const;
+
+private:
+
+    //
+    // The patterns by key (their prefix or suffix), sorted by key size,
+    // key and index, with the range of each key size.
+    //
+    struct Entry
+    {
+        std::string key;
+        size_t pattern;
+
+        bool operator<(const Entry&) const;
+    };
+
+    struct KeySize
+    {
+        size_t size;
+        size_t first;
+        size_t last;
+    };
+
+    struct Index
+    {
+        std::vector<Entry> entries;
+        std::vector<KeySize> sizes;
+
+        void Insert(const std::string& key, size_t pattern);
+    };
+
+    //
+    // Returns the lowest index of a matching pattern if matches is 0,
+    // appends all of them otherwise.
+    //
+    size_t Search(const char* first, const char* last, std::vector<size_t>* matches) const;
+
+    std::vector<GlobPattern> m_patterns;
+    Index m_prefixes;
+    Index m_suffixes;
+    std::vector<size_t> m_unindexed;
+};
+
+}
+
+#endif
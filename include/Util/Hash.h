@@ -0,0 +1,91 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_HASH_H
+#define UTIL_HASH_H
+
+#include <Util/Config.h>
+
+namespace Util
+{
+
+//
+// A 64-bit hash of bytes, for hash tables and checksums, not for
+// cryptography. Every byte changes the result and the value is the same
+// on all platforms.
+//
+// Up to 256 bytes, the bytes are read 16 at a time and mixed with a full
+// 64x64 to 128-bit multiplication (wyhash). Longer input goes through
+// eight independent 64-bit accumulators fed 64 bytes at a time with
+// 32x32 to 64-bit multiplications (xxh3), computed with AVX2, SSE2 or
+// NEON where available.
+//
+// Different seeds give unrelated hashes: a table that takes its keys from
+// outside should use a random seed, so that nobody can choose keys that
+// all collide.
+//
+UTIL_API uint64 HashBytes(const void* data, size_t size, uint64 seed = 0);
+
+//
+// HashBytes of data given in pieces:
+//
+//     Hasher hasher(seed);
+//     while (size_t size = Read(buffer))
+//     {
+//         hasher.Update(buffer, size);
+//     }
+//     uint64 hash = hasher.Final();
+//
+// Final() gives the same value as HashBytes of all the pieces put
+// together, whatever the pieces are.
+//
+class UTIL_API Hasher
+{
+public:
+
+    explicit Hasher(uint64 seed = 0);
+
+    void Reset(uint64 seed = 0);
+    void Update(const void* data, size_t size);
+
+    //
+    // The hash of what was given so far; more can be given after.
+    //
+    uint64 Final() const;
+
+    enum
+    {
+        stripeSize = 64,
+        bufferSize = 256,
+        secretSize = 24
+    };
+
+private:
+
+    uint64 m_seed;
+    uint64 m_total;
+    uint64 m_accumulators[8];
+    uint64 m_secret[secretSize];
+
+    //
+    // The stripes accumulated since the accumulators were last scrambled.
+    //
+    size_t m_stripes;
+
+    //
+    // Input not accumulated yet, and the stripe before it, for the last
+    // stripe which ends with the input.
+    //
+    Byte m_buffer[bufferSize];
+    size_t m_buffered;
+    Byte m_previous[stripeSize];
+};
+
+}
+
+#endif
@@ -0,0 +1,93 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_HEX_CODING_H
+#define UTIL_HEX_CODING_H
+
+#include <Util/Config.h>
+
+#include <vector>
+
+namespace Util
+{
+
+//
+// Hexadecimal encoding and decoding into buffers of the caller, the
+// kernels behind String::BytesToString, String::StringToBytes,
+// String::HexStringToBuffer and String::HexDump. 16 bytes are converted
+// at once (SSE2 or NEON): the nibbles become digits with a compare and an
+// add, and the digits are interleaved (encoding), or checked and packed
+// back into bytes (decoding).
+//
+
+//
+// Writes the 2 * size digits of data at target and returns 2 * size.
+//
+UTIL_API size_t EncodeHex(const void* data, size_t size, char* target, bool upper = false);
+
+//
+// Decodes the pairs of hex digits, of either case, at [text, text + size)
+// until a pair with something else, and returns the number of bytes
+// written at target, which has room for size / 2 bytes. If end is not 0
+// it is set after the last pair decoded.
+//
+UTIL_API size_t DecodeHex(const char* text, size_t size, Byte* target, const char** end = 0);
+
+//
+// One line of a hex dump, the layout of String::HexDumpLine:
+//
+//     [00000010h]: 48 65 6C 6C 6F 2C 20 77  6F 72 6C 64 21 0A 00 FF    |Hello, world!...|
+//
+// The size bytes at data (at most lineLength) are shown at offset. Writes
+// at most HexDumpLineCapacity(lineLength) characters at line and returns
+// their number, 19 + 4 * lineLength unless offset needs more than 8 digits.
+//
+UTIL_API size_t FormatHexDumpLine(const void* data, size_t size, uint64 offset, size_t lineLength, char* line);
+
+inline size_t
+HexDumpLineCapacity(size_t lineLength)
+{
+    return 27 + 4 * lineLength;
+}
+
+//
+// Writes the hex dump of [data, data + size), lines ended by '\n', to out,
+// an output iterator of char (a std::ostreambuf_iterator, the
+// back_inserter of a buffer...). The lines are formatted in place, nothing
+// is allocated for lines of up to 64 bytes.
+//
+template <typename OutIt>
+OutIt
+WriteHexDump(const void* data, size_t size, OutIt out, size_t lineLength = 16)
+{
+    char small[27 + 4 * 64];
+    std::vector<char> large;
+    char* line = small;
+    if (lineLength > 64)
+    {
+        large.resize(HexDumpLineCapacity(lineLength));
+        line = &large[0];
+    }
+
+    const Byte* bytes = static_cast<const Byte*>(data);
+    for (size_t offset = 0; offset < size; offset += lineLength)
+    {
+        size_t length = size - offset < lineLength ? size - offset : lineLength;
+        size_t lineSize = FormatHexDumpLine(bytes + offset, length, offset, lineLength, line);
+        for (size_t i = 0; i < lineSize; ++i)
+        {
+            *out++ = line[i];
+        }
+        *out++ = '\n';
+    }
+    return out;
+}
+
+}
+
+#endif
@@ -0,0 +1,209 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_MULTI_STRING_SEARCH_H
+#define UTIL_MULTI_STRING_SEARCH_H
+
+#include <Util/Config.h>
+
+#include <string>
+#include <vector>
+
+namespace Util
+{
+
+//
+// How the patterns of a MultiStringSearcher are compared with the text.
+// asciiCaseInsensitiveMatch only folds A-Z, it costs nothing over an exact
+// search. unicodeCaseInsensitiveMatch applies the full case folding of
+// FoldCase to UTF-8 patterns and text (e.g. "STRASSE" finds U+00DF).
+//
+enum MultiStringCase
+{
+    caseSensitiveMatch,
+    asciiCaseInsensitiveMatch,
+    unicodeCaseInsensitiveMatch
+};
+
+struct MultiStringMatch
+{
+    //
+    // The index of the pattern in the list given to the searcher.
+    //
+    size_t pattern;
+
+    //
+    // The bytes matched, counted from the start of the stream. With
+    // unicodeCaseInsensitiveMatch they cover whole characters, a pattern
+    // "s" matches all two bytes of U+00DF, once although its folding is
+    // "ss".
+    //
+    uint64 offset;
+    uint64 length;
+};
+
+//
+// Finds all occurrences of many patterns at once (Aho-Corasick): the
+// patterns are compiled into an automaton once, then the text is scanned
+// in a single pass whatever the number of patterns.
+//
+// Bytes are mapped to the classes of the bytes the patterns use. Small
+// pattern sets get a dense automaton, a table with a transition for every
+// state and class, so each byte costs one lookup. For larger sets, whose
+// table would exceed 1 MB, only the states near the start are dense, the
+// others keep their sparse trie transitions and failure links.
+//
+// The text can be given in chunks of any size: the position in the
+// automaton (and a character split across chunks) is kept in a State.
+// Matches may overlap, they are reported in the order they end.
+//
+class UTIL_API MultiStringSearcher
+{
+public:
+
+    //
+    // The position in a stream. A default constructed State is at the
+    // start of a stream.
+    //
+    class UTIL_API State
+    {
+    public:
+
+        State();
+
+        void Reset();
+
+        //
+        // The number of bytes scanned so far.
+        //
+        uint64 Offset() const
+        {
+            return m_offset + m_pendingSize;
+        }
+
+    private:
+
+        friend class MultiStringSearcher;
+
+        uint32 m_state;
+        uint64 m_offset;
+
+        //
+        // unicodeCaseInsensitiveMatch only: the number of folded bytes fed
+        // to the automaton, the offset of the character each of the last
+        // ones came from and an incomplete UTF-8 sequence at the end of
+        // the last chunk.
+        //
+        uint64 m_folded;
+        std::vector<uint64> m_starts;
+        Byte m_pending[4];
+        int m_pendingSize;
+    };
+
+    //
+    // Throws IllegalArgumentException if a pattern is empty.
+    //
+    explicit MultiStringSearcher(const std::vector<std::string>& patterns,
+                                 MultiStringCase = caseSensitiveMatch);
+
+    size_t PatternCount() const
+    {
+        return m_patterns.size();
+    }
+
+    const std::string& Pattern(size_t index) const
+    {
+        return m_patterns[index];
+    }
+
+    //
+    // True if the automaton is a full transition table.
+    //
+    bool IsDense() const
+    {
+        return m_sparse.empty();
+    }
+
+    //
+    // Scans the next chunk of a stream, appends the matches that end in it
+    // to matches and returns how many.
+    //
+    size_t Scan(const void* data, size_t size, State& state, std::vector<MultiStringMatch>& matches) const;
+
+    //
+    // Ends a stream. Only needed with unicodeCaseInsensitiveMatch, for the
+    // matches of (ill-formed) patterns ending in an incomplete sequence the
+    // stream ends with.
+    //
+    size_t Finish(State& state, std::vector<MultiStringMatch>& matches) const;
+
+    //
+    // All matches in a single buffer.
+    //
+    void FindAll(const void* data, size_t size, std::vector<MultiStringMatch>& matches) const;
+    void FindAll(const std::string& text, std::vector<MultiStringMatch>& matches) const;
+
+    //
+    // Returns whether any pattern occurs in the buffer, stops at the first
+    // match.
+    //
+    bool Contains(const void* data, size_t size) const;
+    bool Contains(const std::string& text) const;
+
+private:
+
+    class Scanner;
+
+    void Build(const std::vector<std::string>& keys);
+
+    MultiStringCase m_case;
+    std::vector<std::string> m_patterns;
+
+    //
+    // The length of each pattern as matched, after folding.
+    //
+    std::vector<size_t> m_lengths;
+    size_t m_maxLength;
+
+    Byte m_classes[256];
+    uint32 m_classCount;
+
+    //
+    // State 0 is the start state; m_matchFirst and all states after it
+    // end matches. The states before m_denseEnd and from m_denseMatchFirst
+    // on have a row in m_dense, in that order. In a dense automaton states
+    // are numbered premultiplied by m_classCount.
+    //
+    uint32 m_matchFirst;
+    uint32 m_denseEnd;
+    uint32 m_denseMatchFirst;
+    std::vector<uint32> m_dense;
+
+    //
+    // The sparse states, less m_denseEnd, by pairs: where the transitions
+    // of the state start, sorted by class, and its failure link. The
+    // transitions end where those of the next state start.
+    //
+    std::vector<uint32> m_sparse;
+    std::vector<Byte> m_edgeClasses;
+    std::vector<uint32> m_edgeTargets;
+
+    //
+    // By match state (less m_matchFirst, not premultiplied): the patterns
+    // it ends, at [m_outputBegin[i], m_outputBegin[i + 1]) in
+    // m_outputPatterns, and the next state along its failure links that
+    // ends patterns too, or 0.
+    //
+    std::vector<uint32> m_outputBegin;
+    std::vector<uint32> m_outputPatterns;
+    std::vector<uint32> m_outputLink;
+};
+
+}
+
+#endif
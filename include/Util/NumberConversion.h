@@ -0,0 +1,103 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_NUMBER_CONVERSION_H
+#define UTIL_NUMBER_CONVERSION_H
+
+#include <Util/Config.h>
+
+namespace Util
+{
+
+enum NumberParseResult
+{
+    numberOK,
+
+    //
+    // There is no number at the start of the text; the value is 0.
+    //
+    numberInvalid,
+
+    //
+    // The number is too large (small) for the type; the value is the
+    // largest (smallest) one, infinity for floating point.
+    //
+    numberOverflow,
+
+    //
+    // A floating point number that is not zero but too small even for a
+    // denormal; the value is 0.
+    //
+    numberUnderflow
+};
+
+//
+// Parses a decimal floating point number at the start of [first, last):
+// an optional sign, digits with an optional decimal point and an optional
+// exponent, or inf, infinity or nan in any case. Leading white space is
+// not skipped and the locale is not used (the decimal point is '.').
+//
+// end, if not 0, is set after the number, or to first if there is none.
+//
+// The value is correctly rounded, to nearest and ties to even, whatever
+// the number of digits. Nearly all numbers are converted with a single
+// 64 x 128-bit multiplication (the Eisel-Lemire algorithm); those that
+// are too close to the halfway point between two doubles are decided by
+// exact big integer arithmetic.
+//
+UTIL_API NumberParseResult ParseDouble(const char* first, const char* last, double& value, const char** end = 0);
+
+//
+// Parse an integer at the start of [first, last) in base 2 to 36: an
+// optional sign ('+' only for ParseUInt64) and digits, then letters of
+// either case from 'a' on. There is no base prefix and leading white
+// space is not skipped. end works like with ParseDouble; on overflow it
+// is set after all the digits.
+//
+// Decimal digits are converted eight at a time.
+//
+UTIL_API NumberParseResult ParseUInt64(const char* first, const char* last, uint64& value, const char** end = 0,
+                                       int base = 10);
+UTIL_API NumberParseResult ParseInt64(const char* first, const char* last, int64& value, const char** end = 0,
+                                      int base = 10);
+
+//
+// Format an integer in decimal into buffer, which must hold maxInt64Size
+// characters and is not null terminated, and return the number of
+// characters written. Two digits are written per division.
+//
+const size_t maxInt64Size = 20;
+
+UTIL_API size_t FormatUInt64(uint64 value, char* buffer);
+UTIL_API size_t FormatInt64(int64 value, char* buffer);
+
+//
+// Format a double into buffer, which is not null terminated, and return
+// the number of characters written. Nothing is allocated.
+//
+// FormatDouble writes the shortest decimal number that ParseDouble (or
+// strtod) converts back to value, in the layout of JavaScript: plain
+// digits ("1500", "0.000001") for magnitudes from 1e-6 up to but not
+// including 1e21, scientific notation ("1e+21", "1e-7", "9.9e-7")
+// otherwise. The buffer must hold maxShortestDoubleSize characters.
+//
+// FormatDoubleFixed writes value correctly rounded to precision digits
+// after the point, like printf's "%.*f". The buffer must hold
+// maxFixedDoubleSize + precision characters.
+//
+// Infinities and NaNs are written as "inf", "-inf" and "nan".
+//
+const size_t maxShortestDoubleSize = 25;
+const size_t maxFixedDoubleSize = 311;
+
+UTIL_API size_t FormatDouble(double value, char* buffer);
+UTIL_API size_t FormatDoubleFixed(double value, int precision, char* buffer);
+
+}
+
+#endif
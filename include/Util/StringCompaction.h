@@ -0,0 +1,48 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_STRING_COMPACTION_H
+#define UTIL_STRING_COMPACTION_H
+
+#include <Util/Config.h>
+#include <Util/StringPiece.h>
+
+namespace Util
+{
+
+//
+// The kernels behind String::Trim, String::RemoveWhitespace and
+// String::TranslatingCR2LF, which allocate nothing: the output has the
+// same bytes as theirs.
+//
+// The copying functions write to target, which has room for size bytes
+// and may be source itself, and return the size written. 16 bytes are
+// classified at once (8 on NEON); a block with nothing to drop is stored
+// as is, or not at all while working in place, and the others are packed
+// with a shuffle (SSSE3 or NEON) instead of byte by byte.
+//
+
+//
+// s without the space, tab, CR and LF characters at both ends.
+//
+UTIL_API StringPiece TrimWhitespace(const StringPiece& s);
+
+//
+// Copies source without the white space of the "C" locale: space, tab,
+// LF, vertical tab, form feed and CR.
+//
+UTIL_API size_t StripWhitespace(const char* source, size_t size, char* target);
+
+//
+// Copies source with each CR LF pair and each CR alone replaced by LF.
+//
+UTIL_API size_t NormalizeNewlines(const char* source, size_t size, char* target);
+
+}
+
+#endif
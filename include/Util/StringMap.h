@@ -0,0 +1,335 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_STRING_MAP_H
+#define UTIL_STRING_MAP_H
+
+#include <Util/Config.h>
+#include <Util/StringPiece.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Util
+{
+
+//
+// A set of strings numbered 0 to Size() - 1 in the order they were added,
+// the part of StringMap and StringPool that does not depend on the type
+// of the values.
+//
+// It is an open addressing hash table (a Swiss table): each slot has a
+// control byte, empty, deleted or 7 bits of the hash of its key, and
+// slots go by groups of 16 whose control bytes are compared with the
+// hash at once (SSE2 or NEON). A lookup thus compares keys only for
+// slots whose 7 bits match, nearly always only the right one, and stops
+// at the first group with an empty slot. Slots only hold the number of
+// their key, the keys themselves are in an array in order, with their
+// hash so that growing does not hash them again. Keys of up to 12 bytes
+// are stored there, longer ones in an arena of large blocks.
+//
+// The hash is HashBytes with the seed given to the constructor; use a
+// random seed for keys that come from outside.
+//
+class UTIL_API StringTable : public noncopyable
+{
+public:
+
+    static const size_t npos = static_cast<size_t>(-1);
+
+    //
+    // With stableKeys, all keys are in the arena, so that Key() stays
+    // valid until the table is cleared or destroyed, not only until the
+    // next insertion.
+    //
+    explicit StringTable(uint64 seed = 0, bool stableKeys = false);
+    ~StringTable();
+
+    size_t Size() const
+    {
+        return m_entries.size();
+    }
+
+    StringPiece Key(size_t index) const
+    {
+        assert(index < m_entries.size());
+        const Entry& entry = m_entries[index];
+        if (entry.size <= inlineSize && !m_stableKeys)
+        {
+            return StringPiece(entry.data.bytes, entry.size);
+        }
+        return StringPiece(entry.data.pointer, entry.size);
+    }
+
+    //
+    // The number of key, or npos.
+    //
+    size_t Find(const StringPiece& key) const;
+
+    //
+    // The number of key, added with number Size() if it is not there.
+    //
+    size_t Insert(const StringPiece& key, bool& inserted);
+
+    //
+    // Removes key: the last key takes its number, which is stored in
+    // index. Returns false if key is not there. With stableKeys the arena
+    // keeps the copy of a long key until Clear(); otherwise an insertion
+    // compacts the arena once the removed keys fill more of it than the
+    // keys left.
+    //
+    bool Erase(const StringPiece& key, size_t& index);
+
+    void Reserve(size_t size);
+
+    //
+    // The bytes allocated for the arena.
+    //
+    size_t ArenaSize() const
+    {
+        return m_arenaSize;
+    }
+
+    //
+    // Removes all keys and frees the arena, keeping the memory of the
+    // table.
+    //
+    void Clear();
+
+private:
+
+    enum
+    {
+        groupSize = 16,
+        inlineSize = 12
+    };
+
+    struct Entry
+    {
+        uint64 hash;
+        uint32 size;
+
+        union
+        {
+            char bytes[inlineSize];
+            const char* pointer;
+        } data;
+    };
+
+    size_t FindSlot(const StringPiece& key, uint64 hash) const;
+    size_t FreeSlot(uint64 hash) const;
+    void SetSlot(size_t slot, uint64 hash, uint32 index);
+    void Rehash(size_t capacity);
+    const char* Store(const StringPiece& key);
+    void CompactArena();
+
+    uint64 m_seed;
+    bool m_stableKeys;
+
+    //
+    // m_control and m_slots have a capacity, a power of two and a multiple
+    // of groupSize, or are empty.
+    //
+    std::vector<Byte> m_control;
+    std::vector<uint32> m_slots;
+    size_t m_deleted;
+
+    std::vector<Entry> m_entries;
+
+    //
+    // The arena: blocks never move, the last one is filled from m_next.
+    // m_liveBytes are the keys in it, m_deadBytes the removed ones.
+    //
+    std::vector<char*> m_blocks;
+    char* m_next;
+    size_t m_left;
+    size_t m_arenaSize;
+    size_t m_liveBytes;
+    size_t m_deadBytes;
+};
+
+//
+// A hash map from strings to T, for lookups of names (codesets,
+// converters, keywords) without the allocations and the comparisons of
+// std::map<std::string, T>. Lookups take any StringPiece, a const char*
+// or a piece of a larger buffer, without building a std::string.
+//
+// Values are kept in an array in the order their keys were added, index
+// i of Key(i) and Value(i); Erase() moves the last entry to the place of
+// the removed one. Pointers to values are valid until the next insertion
+// or removal.
+//
+template <typename T>
+class StringMap
+{
+public:
+
+    explicit StringMap(uint64 seed = 0) :
+        m_table(seed)
+    {
+    }
+
+    size_t Size() const
+    {
+        return m_values.size();
+    }
+
+    bool Empty() const
+    {
+        return m_values.empty();
+    }
+
+    StringPiece Key(size_t index) const
+    {
+        return m_table.Key(index);
+    }
+
+    T& Value(size_t index)
+    {
+        assert(index < m_values.size());
+        return m_values[index];
+    }
+
+    const T& Value(size_t index) const
+    {
+        assert(index < m_values.size());
+        return m_values[index];
+    }
+
+    //
+    // The value of key, or 0.
+    //
+    T* Find(const StringPiece& key)
+    {
+        size_t index = m_table.Find(key);
+        return index != StringTable::npos ? &m_values[index] : 0;
+    }
+
+    const T* Find(const StringPiece& key) const
+    {
+        size_t index = m_table.Find(key);
+        return index != StringTable::npos ? &m_values[index] : 0;
+    }
+
+    bool Contains(const StringPiece& key) const
+    {
+        return m_table.Find(key) != StringTable::npos;
+    }
+
+    //
+    // Adds key with value, unless key is there already. Returns whether
+    // it was added.
+    //
+    bool Insert(const StringPiece& key, const T& value)
+    {
+        bool inserted;
+        m_table.Insert(key, inserted);
+        if (inserted)
+        {
+            m_values.push_back(value);
+        }
+        return inserted;
+    }
+
+    //
+    // The value of key, added with T() if key is not there.
+    //
+    T& operator[](const StringPiece& key)
+    {
+        bool inserted;
+        size_t index = m_table.Insert(key, inserted);
+        if (inserted)
+        {
+            m_values.push_back(T());
+        }
+        return m_values[index];
+    }
+
+    bool Erase(const StringPiece& key)
+    {
+        size_t index;
+        if (!m_table.Erase(key, index))
+        {
+            return false;
+        }
+        if (index != m_values.size() - 1)
+        {
+            std::swap(m_values[index], m_values.back());
+        }
+        m_values.pop_back();
+        return true;
+    }
+
+    void Reserve(size_t size)
+    {
+        m_table.Reserve(size);
+        m_values.reserve(size);
+    }
+
+    void Clear()
+    {
+        m_table.Clear();
+        m_values.clear();
+    }
+
+private:
+
+    StringTable m_table;
+    std::vector<T> m_values;
+};
+
+//
+// Interns strings: equal strings get the same id, ids are 0, 1, 2... in
+// the order strings are first seen, so they can index plain arrays and
+// compare in one instruction. The strings are copied once, Text(id)
+// stays valid as long as the pool.
+//
+class UTIL_API StringPool
+{
+public:
+
+    static const uint32 invalidId = static_cast<uint32>(-1);
+
+    explicit StringPool(uint64 seed = 0) :
+        m_table(seed, true)
+    {
+    }
+
+    size_t Size() const
+    {
+        return m_table.Size();
+    }
+
+    uint32 Intern(const StringPiece& s)
+    {
+        bool inserted;
+        return static_cast<uint32>(m_table.Insert(s, inserted));
+    }
+
+    //
+    // The id of s, or invalidId if s was never interned.
+    //
+    uint32 Find(const StringPiece& s) const
+    {
+        size_t index = m_table.Find(s);
+        return index != StringTable::npos ? static_cast<uint32>(index) : invalidId;
+    }
+
+    StringPiece Text(uint32 id) const
+    {
+        return m_table.Key(id);
+    }
+
+private:
+
+    StringTable m_table;
+};
+
+}
+
+#endif
@@ -0,0 +1,168 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_STRING_PIECE_H
+#define UTIL_STRING_PIECE_H
+
+#include <Util/Config.h>
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+
+namespace Util
+{
+
+//
+// A view of characters owned by someone else, a std::string or a buffer,
+// which must outlive it. Copying a StringPiece copies two words.
+//
+class StringPiece
+{
+public:
+
+    static const size_t npos = static_cast<size_t>(-1);
+
+    StringPiece() :
+        m_data(""),
+        m_size(0)
+    {
+    }
+
+    StringPiece(const char* s) :
+        m_data(s != 0 ? s : ""),
+        m_size(s != 0 ? strlen(s) : 0)
+    {
+    }
+
+    StringPiece(const std::string& s) :
+        m_data(s.data()),
+        m_size(s.size())
+    {
+    }
+
+    StringPiece(const char* data, size_t size) :
+        m_data(data),
+        m_size(size)
+    {
+    }
+
+    const char* Data() const
+    {
+        return m_data;
+    }
+
+    size_t Size() const
+    {
+        return m_size;
+    }
+
+    bool Empty() const
+    {
+        return m_size == 0;
+    }
+
+    //
+    // For the standard algorithms.
+    //
+    const char* begin() const
+    {
+        return m_data;
+    }
+
+    const char* end() const
+    {
+        return m_data + m_size;
+    }
+
+    char operator[](size_t i) const
+    {
+        assert(i < m_size);
+        return m_data[i];
+    }
+
+    std::string ToString() const
+    {
+        return std::string(m_data, m_size);
+    }
+
+    //
+    // The characters from pos on, at most n of them.
+    //
+    StringPiece Substr(size_t pos, size_t n = npos) const
+    {
+        assert(pos <= m_size);
+        return StringPiece(m_data + pos, std::min(n, m_size - pos));
+    }
+
+    void RemovePrefix(size_t n)
+    {
+        assert(n <= m_size);
+        m_data += n;
+        m_size -= n;
+    }
+
+    void RemoveSuffix(size_t n)
+    {
+        assert(n <= m_size);
+        m_size -= n;
+    }
+
+    int Compare(const StringPiece& rhs) const
+    {
+        int result = memcmp(m_data, rhs.m_data, std::min(m_size, rhs.m_size));
+        if (result != 0)
+        {
+            return result;
+        }
+        return m_size < rhs.m_size ? -1 : (m_size > rhs.m_size ? 1 : 0);
+    }
+
+    bool StartsWith(const StringPiece& prefix) const
+    {
+        return m_size >= prefix.m_size && memcmp(m_data, prefix.m_data, prefix.m_size) == 0;
+    }
+
+    bool EndsWith(const StringPiece& suffix) const
+    {
+        return m_size >= suffix.m_size && memcmp(m_data + m_size - suffix.m_size, suffix.m_data, suffix.m_size) == 0;
+    }
+
+private:
+
+    const char* m_data;
+    size_t m_size;
+};
+
+inline bool
+operator==(const StringPiece& lhs, const StringPiece& rhs)
+{
+    return lhs.Size() == rhs.Size() && memcmp(lhs.Data(), rhs.Data(), lhs.Size()) == 0;
+}
+
+inline bool
+operator!=(const StringPiece& lhs, const StringPiece& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bool
+operator<(const StringPiece& lhs, const StringPiece& rhs)
+{
+    return lhs.Compare(rhs) < 0;
+}
+
+inline std::ostream&
+operator<<(std::ostream& out, const StringPiece& s)
+{
+    return out.write(s.Data(), static_cast<std::streamsize>(s.Size()));
+}
+
+}
+
+#endif
@@ -0,0 +1,124 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_STRING_SEARCH_H
+#define UTIL_STRING_SEARCH_H
+
+#include <Util/Config.h>
+
+#include <string>
+
+namespace Util
+{
+
+//
+// Returns the first occurrence of [needle, needle + needleSize) in
+// [haystack, haystack + size), or 0. An empty needle is found at haystack.
+//
+// Needles of up to 64 bytes are searched with a SIMD filter: 16 or 32
+// positions at a time are checked for the first and the last byte of the
+// needle and only the candidates are compared. Longer needles, and short
+// ones for which the filter yields too many false candidates (e.g. runs of
+// a repeated byte), are searched with the Two-Way algorithm, which is
+// linear in the worst case and needs no memory.
+//
+UTIL_API const Byte* FindBytes(const void* haystack, size_t size, const void* needle, size_t needleSize);
+
+//
+// A needle prepared once for many searches: the Two-Way factorization and
+// a bad character table are computed by the constructor.
+//
+class UTIL_API StringSearcher
+{
+public:
+
+    explicit StringSearcher(const std::string& needle);
+    StringSearcher(const void* needle, size_t size);
+
+    const std::string& Needle() const
+    {
+        return m_needle;
+    }
+
+    //
+    // The first occurrence of the needle in [haystack, haystack + size),
+    // or 0.
+    //
+    const Byte* Find(const void* haystack, size_t size) const;
+
+    //
+    // Like std::string::find: the index of the first occurrence at or
+    // after pos, or std::string::npos.
+    //
+    size_t Find(const std::string& haystack, size_t pos = 0) const;
+
+private:
+
+    void Prepare();
+
+    const Byte* TwoWay(const Byte* haystack, const Byte* last) const;
+
+    std::string m_needle;
+
+    //
+    // The critical factorization: the needle is split after m_critical
+    // bytes, m_period is the period of the needle if m_memory is not 0
+    // (periodic needles remember the matched prefix), a shift otherwise.
+    //
+    size_t m_critical;
+    size_t m_period;
+    size_t m_memory;
+
+    //
+    // How far the window can move for the byte under its last position.
+    //
+    size_t m_shift[256];
+};
+
+//
+// Finds the first byte that belongs to a set, like strpbrk for binary
+// data. Sets of up to eight bytes are scanned 16 or 32 bytes at a time:
+// each block is compared with every byte of the set and the first bit of
+// the resulting mask is the position. Larger sets are scanned byte by
+// byte with a table.
+//
+class UTIL_API ByteSetFinder
+{
+public:
+
+    explicit ByteSetFinder(const std::string& set);
+    ByteSetFinder(const void* set, size_t size);
+
+    bool Contains(Byte b) const
+    {
+        return m_table[b];
+    }
+
+    //
+    // The first byte of [first, first + size) in the set, or 0.
+    //
+    const Byte* Find(const void* first, size_t size) const;
+
+private:
+
+    void Prepare(const Byte* set, size_t size);
+
+    enum { maxVectorSize = 8 };
+
+    //
+    // The distinct bytes of the set, if there are at most maxVectorSize.
+    //
+    Byte m_bytes[maxVectorSize];
+    size_t m_count;
+
+    bool m_table[256];
+};
+
+}
+
+#endif
@@ -0,0 +1,102 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_STRING_TOKENIZER_H
+#define UTIL_STRING_TOKENIZER_H
+
+#include <Util/Config.h>
+#include <Util/StringPiece.h>
+#include <Util/StringSearch.h>
+
+#include <string>
+
+namespace Util
+{
+
+//
+// Splits a text at delimiters, with the quoting of String::SplitString:
+// text between single or double quotes is part of the token, quotes
+// removed, delimiters included, and a backslash before a quote makes it a
+// plain character (outside quotes, or inside quotes of the same kind).
+// Empty tokens are skipped unless keepBlank is true.
+//
+//     StringTokenizer tokens(line, " \t");
+//     while (tokens.Next())
+//     {
+//         Use(tokens.Token());
+//     }
+//
+// Tokens are pieces of the text, nothing is copied, except for tokens
+// that a quote or an escape splits in several pieces: these are joined in
+// a buffer of the tokenizer, reused from token to token. Delimiters,
+// quotes and backslashes are found with a ByteSetFinder.
+//
+class UTIL_API StringTokenizer
+{
+public:
+
+    //
+    // The text must outlive the tokenizer.
+    //
+    StringTokenizer(const StringPiece& text, const StringPiece& delimiters, bool keepBlank = false);
+
+    //
+    // Moves to the next token and returns whether there is one.
+    //
+    bool Next();
+
+    //
+    // The current token, valid until the text is destroyed or, if
+    // IsCopy(), until the next call to Next().
+    //
+    StringPiece Token() const
+    {
+        return m_token;
+    }
+
+    bool IsCopy() const
+    {
+        return m_copied;
+    }
+
+    //
+    // False if the text ended inside quotes, which is known once Next()
+    // returned false.
+    //
+    bool Balanced() const
+    {
+        return m_balanced;
+    }
+
+private:
+
+    void AddPiece(const char* first, const char* last);
+
+    const char* m_next;
+    const char* m_last;
+    bool m_keepBlank;
+    bool m_done;
+    bool m_balanced;
+    bool m_backslashDelimits;
+
+    //
+    // Delimiters, quotes and backslashes outside quotes, and the quote
+    // and backslash inside single or double quotes.
+    //
+    ByteSetFinder m_special;
+    ByteSetFinder m_inSingleQuotes;
+    ByteSetFinder m_inDoubleQuotes;
+
+    StringPiece m_token;
+    bool m_copied;
+    std::string m_buffer;
+};
+
+}
+
+#endif
@@ -65,7 +65,8 @@ public:
 
     //
     // Split a string using the given delimiters. Considers single and double quotes;
-    // returns false for unbalanced quote, true otherwise.
+    // returns false for unbalanced quote, true otherwise. StringTokenizer
+    // splits the same way without copying the tokens.
     //
     static bool SplitString(const std::string& str, const std::string& delim, std::vector<std::string>& result, bool keepblank = false);
 
@@ -75,9 +76,11 @@ public:
     static std::string JoinString(const std::vector<std::string>& values, const std::string& delimiter);
 
     //
-    // Trim white space
+    // Trim white space. TrimInPlace allocates nothing, TrimWhitespace
+    // (StringCompaction.h) returns a piece of the string instead of a copy.
     //
     static std::string Trim(const std::string& src);
+    static void TrimInPlace(std::string& s);
 
     //
     // If a single or double quotation mark is found at the start
@@ -91,10 +94,11 @@ public:
     static std::string::size_type ExistQuote(const std::string&, std::string::size_type = 0);
 
     //
-    // Match `s' against the pattern `pat'. A * in the pattern acts
-    // as a wildcard: it matches any non-empty sequence of characters
-    // other than a period (`.'). We match by hand here because
-    // it's portable across platforms (whereas regex() isn't).
+    // Match `s' against the glob pattern `pat' (see MatchGlob): a * matches
+    // any sequence of characters, non-empty unless the last argument is
+    // true, a ? any character and [...] one of a class. To match a pattern
+    // many times compile it into a GlobPattern, or many patterns into a
+    // GlobSet.
     //
     static bool Match(const std::string& s, const std::string& pat, bool = false);
 
@@ -105,6 +109,7 @@ public:
     //    CR (Carriage return, '\r', 0x0D, 13 in decimal) 
     //
     static std::string TranslatingCR2LF(const std::string& src);
+    static void TranslatingCR2LFInPlace(std::string& s);
 
     //static std::string ToHexString(unsigned long n, bool bupper = false);
 
@@ -125,19 +130,24 @@ public:
     std::string ToBinaryString(T n);
 
     //
-    // Functions to convert to lower/upper case. These functions accept
-    // UTF8 string/characters but ignore non ASCII characters. Unlike, the
-    // C methods, these methods are not local dependent.
+    // Functions to convert UTF8 strings to lower/upper case, with the full
+    // Unicode case mappings (see ToLowerCase / ToUpperCase). Unlike the C
+    // methods, these methods are not locale dependent.
     //
     static std::string ToLower(const std::string&);
     static std::string ToUpper(const std::string&);
 
+    //
+    // HashBytes (Hash.h) of the string, cut to unsigned long.
+    //
     static unsigned long Hash(const std::string&);
 
     //
-    // Remove all whitespace from a string
+    // Remove all whitespace from a string: space, tab, LF, vertical tab,
+    // form feed and CR, as isspace in the "C" locale.
     //
     static std::string RemoveWhitespace(const std::string&);
+    static void RemoveWhitespaceInPlace(std::string& s);
 
     //////////////////////////////////////////////////////////////////////////
     /// string & data convert
@@ -171,6 +181,11 @@ public:
 
     static long ToLong(const std::string& strval, size_t* endindex = 0, unsigned int base = 10);
 
+    //
+    // Skips leading whitespace and converts the number after it with
+    // ParseDouble, correctly rounded; precision is ignored. *endindex is 0
+    // if there is no number.
+    //
     static double ToDouble(const std::string& strval, size_t* endindex = 0, int precision = 6);
 
     template <typename T>
@@ -191,6 +206,10 @@ public:
     //
     static  int GetIntInString(const char* s, char** endptr, int base);
 
+    //
+    // Returns the first occurrence of strSearch in the buffer, or NULL. To
+    // look for many strings at once use MultiStringSearcher.
+    //
     static const Util::Byte* FindStringInBuffer(Util::Byte* pBuff, size_t iBuffSize, const std::string& strSearch);
 
     //
@@ -203,6 +222,10 @@ public:
     //
     static inline void ReverseBuffer(unsigned char* begin, unsigned char* end);
 
+    //
+    // Lowercase hex digits of the bytes, and back. EncodeHex and DecodeHex
+    // (HexCoding.h) write into buffers of the caller.
+    //
     static std::string BytesToString(const Util::Byte* src, size_t size);
     static std::string BytesToString(const Util::ByteSeq& bytes);
     static Util::ByteSeq StringToBytes(const std::string&);
@@ -384,7 +407,8 @@ void String::BinDump(const void* ptr, size_t size, OutIt out, size_t linelength/
 }
 
 //
-// Global Format utility
+// Global Format utility, printf style. FormatText in Util/Formatter.h is
+// type safe and does not parse a printf format at run time.
 // 
 UTIL_API std::string Format( const char* format, ...);
 
@@ -443,8 +467,8 @@ UTIL_API bool WideCStringEquals(const wchar_t * lhs, const wchar_t * rhs);
 // including the empty string.
 UTIL_API bool CStringEquals(const char * lhs, const char * rhs);
 
-// Compares two C strings, ignoring case.  Returns true iff they have
-// the same content.
+// Compares two UTF8 C strings, ignoring case with full Unicode case
+// folding.  Returns true iff they have the same content.
 //
 // Unlike strcasecmp(), this function can handle NULL argument(s).  A
 // NULL C string is considered different to any non-NULL C string,
@@ -469,7 +493,20 @@ UTIL_API bool CaseInsensitiveWideCStringEquals(const wchar_t* lhs, const wchar_t
 // Any string is considered to end with an empty suffix.
 UTIL_API bool EndsWithCaseInsensitive(const std::string& str, const std::string& suffix);
 
+//
+// The shortest string that converts back to value, see FormatDouble.
+//
+UTIL_API std::string Double2String(double value);
+
+//
+// value with precision digits after the point, see FormatDoubleFixed.
+// precision is clamped to 0 to 16.
+//
 UTIL_API std::string Double2String(double value, int precision);
+
+//
+// The number at the start of str, see ParseDouble, or 0.
+//
 UTIL_API double String2Double(const std::string& str);
 
 
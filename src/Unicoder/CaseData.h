@@ -0,0 +1,375 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+//
+// Generated by MakeUnicodeTables.pl from the Unicode Character Database
+// 14.0.0 - do not edit.
+//
+
+#ifndef UTIL_CASE_DATA_H
+#define UTIL_CASE_DATA_H
+
+#include <Util/Config.h>
+#include <Unicoder/ConvertUTF.h>
+
+//
+// Only included by the source file that uses the tables.
+//
+namespace
+{
+
+//
+// Full case mappings (SpecialCasing.txt without the conditional and
+// language specific entries) and full case folding (status C + F). The
+// character record of a code point (CharacterData.h) holds the index of
+// its CaseRecord, record 0 is no mapping. lower, upper and fold are deltas
+// to the mapped code point unless the matching special flag is set, then
+// they are (offset << 2) | length into caseSpecialData.
+//
+const uint8 caseLowerSpecial = 0x01;
+const uint8 caseUpperSpecial = 0x02;
+const uint8 caseFoldSpecial  = 0x04;
+
+struct CaseRecord
+{
+    int32 lower;
+    int32 upper;
+    int32 fold;
+    uint8 flags;
+};
+
+static const CaseRecord caseRecords[279] =
+{
+    { 0, 0, 0, 0x00 },
+    { 32, 0, 32, 0x00 },
+    { 0, -32, 0, 0x00 },
+    { 0, 743, 775, 0x00 },
+    { 0, 2, 10, 0x06 },
+    { 0, 121, 0, 0x00 },
+    { 1, 0, 1, 0x00 },
+    { 0, -1, 0, 0x00 },
+    { 18, 0, 18, 0x05 },
+    { 0, -232, 0, 0x00 },
+    { 0, 26, 34, 0x06 },
+    { -121, 0, -121, 0x00 },
+    { 0, -300, -268, 0x00 },
+    { 0, 195, 0, 0x00 },
+    { 210, 0, 210, 0x00 },
+    { 206, 0, 206, 0x00 },
+    { 205, 0, 205, 0x00 },
+    { 79, 0, 79, 0x00 },
+    { 202, 0, 202, 0x00 },
+    { 203, 0, 203, 0x00 },
+    { 207, 0, 207, 0x00 },
+    { 0, 97, 0, 0x00 },
+    { 211, 0, 211, 0x00 },
+    { 209, 0, 209, 0x00 },
+    { 0, 163, 0, 0x00 },
+    { 213, 0, 213, 0x00 },
+    { 0, 130, 0, 0x00 },
+    { 214, 0, 214, 0x00 },
+    { 218, 0, 218, 0x00 },
+    { 217, 0, 217, 0x00 },
+    { 219, 0, 219, 0x00 },
+    { 0, 56, 0, 0x00 },
+    { 2, 0, 2, 0x00 },
+    { 1, -1, 1, 0x00 },
+    { 0, -2, 0, 0x00 },
+    { 0, -79, 0, 0x00 },
+    { 0, 42, 50, 0x06 },
+    { -97, 0, -97, 0x00 },
+    { -56, 0, -56, 0x00 },
+    { -130, 0, -130, 0x00 },
+    { 10795, 0, 10795, 0x00 },
+    { -163, 0, -163, 0x00 },
+    { 10792, 0, 10792, 0x00 },
+    { 0, 10815, 0, 0x00 },
+    { -195, 0, -195, 0x00 },
+    { 69, 0, 69, 0x00 },
+    { 71, 0, 71, 0x00 },
+    { 0, 10783, 0, 0x00 },
+    { 0, 10780, 0, 0x00 },
+    { 0, 10782, 0, 0x00 },
+    { 0, -210, 0, 0x00 },
+    { 0, -206, 0, 0x00 },
+    { 0, -205, 0, 0x00 },
+    { 0, -202, 0, 0x00 },
+    { 0, -203, 0, 0x00 },
+    { 0, 42319, 0, 0x00 },
+    { 0, 42315, 0, 0x00 },
+    { 0, -207, 0, 0x00 },
+    { 0, 42280, 0, 0x00 },
+    { 0, 42308, 0, 0x00 },
+    { 0, -209, 0, 0x00 },
+    { 0, -211, 0, 0x00 },
+    { 0, 10743, 0, 0x00 },
+    { 0, 42305, 0, 0x00 },
+    { 0, 10749, 0, 0x00 },
+    { 0, -213, 0, 0x00 },
+    { 0, -214, 0, 0x00 },
+    { 0, 10727, 0, 0x00 },
+    { 0, -218, 0, 0x00 },
+    { 0, 42307, 0, 0x00 },
+    { 0, 42282, 0, 0x00 },
+    { 0, -69, 0, 0x00 },
+    { 0, -217, 0, 0x00 },
+    { 0, -71, 0, 0x00 },
+    { 0, -219, 0, 0x00 },
+    { 0, 42261, 0, 0x00 },
+    { 0, 42258, 0, 0x00 },
+    { 0, 84, 116, 0x00 },
+    { 116, 0, 116, 0x00 },
+    { 38, 0, 38, 0x00 },
+    { 37, 0, 37, 0x00 },
+    { 64, 0, 64, 0x00 },
+    { 63, 0, 63, 0x00 },
+    { 0, 59, 71, 0x06 },
+    { 0, -38, 0, 0x00 },
+    { 0, -37, 0, 0x00 },
+    { 0, 83, 95, 0x06 },
+    { 0, -31, 1, 0x00 },
+    { 0, -64, 0, 0x00 },
+    { 0, -63, 0, 0x00 },
+    { 8, 0, 8, 0x00 },
+    { 0, -62, -30, 0x00 },
+    { 0, -57, -25, 0x00 },
+    { 0, -47, -15, 0x00 },
+    { 0, -54, -22, 0x00 },
+    { 0, -8, 0, 0x00 },
+    { 0, -86, -54, 0x00 },
+    { 0, -80, -48, 0x00 },
+    { 0, 7, 0, 0x00 },
+    { 0, -116, 0, 0x00 },
+    { -60, 0, -60, 0x00 },
+    { 0, -96, -64, 0x00 },
+    { -7, 0, -7, 0x00 },
+    { 80, 0, 80, 0x00 },
+    { 0, -80, 0, 0x00 },
+    { 15, 0, 15, 0x00 },
+    { 0, -15, 0, 0x00 },
+    { 48, 0, 48, 0x00 },
+    { 0, -48, 0, 0x00 },
+    { 0, 106, 114, 0x06 },
+    { 7264, 0, 7264, 0x00 },
+    { 0, 3008, 0, 0x00 },
+    { 38864, 0, 0, 0x00 },
+    { 8, 0, 0, 0x00 },
+    { 0, -8, -8, 0x00 },
+    { 0, -6254, -6222, 0x00 },
+    { 0, -6253, -6221, 0x00 },
+    { 0, -6244, -6212, 0x00 },
+    { 0, -6242, -6210, 0x00 },
+    { 0, -6243, -6211, 0x00 },
+    { 0, -6236, -6204, 0x00 },
+    { 0, -6181, -6180, 0x00 },
+    { 0, 35266, 35267, 0x00 },
+    { -3008, 0, -3008, 0x00 },
+    { 0, 35332, 0, 0x00 },
+    { 0, 3814, 0, 0x00 },
+    { 0, 35384, 0, 0x00 },
+    { 0, 122, 130, 0x06 },
+    { 0, 138, 146, 0x06 },
+    { 0, 154, 162, 0x06 },
+    { 0, 170, 178, 0x06 },
+    { 0, 186, 194, 0x06 },
+    { 0, -59, -58, 0x00 },
+    { -7615, 0, 10, 0x04 },
+    { 0, 8, 0, 0x00 },
+    { -8, 0, -8, 0x00 },
+    { 0, 202, 210, 0x06 },
+    { 0, 219, 231, 0x06 },
+    { 0, 243, 255, 0x06 },
+    { 0, 267, 279, 0x06 },
+    { 0, 74, 0, 0x00 },
+    { 0, 86, 0, 0x00 },
+    { 0, 100, 0, 0x00 },
+    { 0, 128, 0, 0x00 },
+    { 0, 112, 0, 0x00 },
+    { 0, 126, 0, 0x00 },
+    { 0, 290, 298, 0x06 },
+    { 0, 306, 314, 0x06 },
+    { 0, 322, 330, 0x06 },
+    { 0, 338, 346, 0x06 },
+    { 0, 354, 362, 0x06 },
+    { 0, 370, 378, 0x06 },
+    { 0, 386, 394, 0x06 },
+    { 0, 402, 410, 0x06 },
+    { -8, 290, 298, 0x06 },
+    { -8, 306, 314, 0x06 },
+    { -8, 322, 330, 0x06 },
+    { -8, 338, 346, 0x06 },
+    { -8, 354, 362, 0x06 },
+    { -8, 370, 378, 0x06 },
+    { -8, 386, 394, 0x06 },
+    { -8, 402, 410, 0x06 },
+    { 0, 418, 426, 0x06 },
+    { 0, 434, 442, 0x06 },
+    { 0, 450, 458, 0x06 },
+    { 0, 466, 474, 0x06 },
+    { 0, 482, 490, 0x06 },
+    { 0, 498, 506, 0x06 },
+    { 0, 514, 522, 0x06 },
+    { 0, 530, 538, 0x06 },
+    { -8, 418, 426, 0x06 },
+    { -8, 434, 442, 0x06 },
+    { -8, 450, 458, 0x06 },
+    { -8, 466, 474, 0x06 },
+    { -8, 482, 490, 0x06 },
+    { -8, 498, 506, 0x06 },
+    { -8, 514, 522, 0x06 },
+    { -8, 530, 538, 0x06 },
+    { 0, 546, 554, 0x06 },
+    { 0, 562, 570, 0x06 },
+    { 0, 578, 586, 0x06 },
+    { 0, 594, 602, 0x06 },
+    { 0, 610, 618, 0x06 },
+    { 0, 626, 634, 0x06 },
+    { 0, 642, 650, 0x06 },
+    { 0, 658, 666, 0x06 },
+    { -8, 546, 554, 0x06 },
+    { -8, 562, 570, 0x06 },
+    { -8, 578, 586, 0x06 },
+    { -8, 594, 602, 0x06 },
+    { -8, 610, 618, 0x06 },
+    { -8, 626, 634, 0x06 },
+    { -8, 642, 650, 0x06 },
+    { -8, 658, 666, 0x06 },
+    { 0, 674, 682, 0x06 },
+    { 0, 690, 698, 0x06 },
+    { 0, 706, 714, 0x06 },
+    { 0, 722, 730, 0x06 },
+    { 0, 739, 751, 0x06 },
+    { -74, 0, -74, 0x00 },
+    { -9, 690, 698, 0x06 },
+    { 0, -7205, -7173, 0x00 },
+    { 0, 762, 770, 0x06 },
+    { 0, 778, 786, 0x06 },
+    { 0, 794, 802, 0x06 },
+    { 0, 810, 818, 0x06 },
+    { 0, 827, 839, 0x06 },
+    { -86, 0, -86, 0x00 },
+    { -9, 778, 786, 0x06 },
+    { 0, 851, 863, 0x06 },
+    { 0, 874, 882, 0x06 },
+    { 0, 891, 903, 0x06 },
+    { -100, 0, -100, 0x00 },
+    { 0, 915, 927, 0x06 },
+    { 0, 938, 946, 0x06 },
+    { 0, 954, 962, 0x06 },
+    { 0, 971, 983, 0x06 },
+    { -112, 0, -112, 0x00 },
+    { 0, 994, 1002, 0x06 },
+    { 0, 1010, 1018, 0x06 },
+    { 0, 1026, 1034, 0x06 },
+    { 0, 1042, 1050, 0x06 },
+    { 0, 1059, 1071, 0x06 },
+    { -128, 0, -128, 0x00 },
+    { -126, 0, -126, 0x00 },
+    { -9, 1010, 1018, 0x06 },
+    { -7517, 0, -7517, 0x00 },
+    { -8383, 0, -8383, 0x00 },
+    { -8262, 0, -8262, 0x00 },
+    { 28, 0, 28, 0x00 },
+    { 0, -28, 0, 0x00 },
+    { 16, 0, 16, 0x00 },
+    { 0, -16, 0, 0x00 },
+    { 26, 0, 26, 0x00 },
+    { 0, -26, 0, 0x00 },
+    { -10743, 0, -10743, 0x00 },
+    { -3814, 0, -3814, 0x00 },
+    { -10727, 0, -10727, 0x00 },
+    { 0, -10795, 0, 0x00 },
+    { 0, -10792, 0, 0x00 },
+    { -10780, 0, -10780, 0x00 },
+    { -10749, 0, -10749, 0x00 },
+    { -10783, 0, -10783, 0x00 },
+    { -10782, 0, -10782, 0x00 },
+    { -10815, 0, -10815, 0x00 },
+    { 0, -7264, 0, 0x00 },
+    { -35332, 0, -35332, 0x00 },
+    { -42280, 0, -42280, 0x00 },
+    { 0, 48, 0, 0x00 },
+    { -42308, 0, -42308, 0x00 },
+    { -42319, 0, -42319, 0x00 },
+    { -42315, 0, -42315, 0x00 },
+    { -42305, 0, -42305, 0x00 },
+    { -42258, 0, -42258, 0x00 },
+    { -42282, 0, -42282, 0x00 },
+    { -42261, 0, -42261, 0x00 },
+    { 928, 0, 928, 0x00 },
+    { -48, 0, -48, 0x00 },
+    { -42307, 0, -42307, 0x00 },
+    { -35384, 0, -35384, 0x00 },
+    { 0, -928, 0, 0x00 },
+    { 0, -38864, -38864, 0x00 },
+    { 0, 1082, 1090, 0x06 },
+    { 0, 1098, 1106, 0x06 },
+    { 0, 1114, 1122, 0x06 },
+    { 0, 1131, 1143, 0x06 },
+    { 0, 1155, 1167, 0x06 },
+    { 0, 1178, 1186, 0x06 },
+    { 0, 1194, 1202, 0x06 },
+    { 0, 1210, 1218, 0x06 },
+    { 0, 1226, 1234, 0x06 },
+    { 0, 1242, 1250, 0x06 },
+    { 0, 1258, 1266, 0x06 },
+    { 40, 0, 40, 0x00 },
+    { 0, -40, 0, 0x00 },
+    { 39, 0, 39, 0x00 },
+    { 0, -39, 0, 0x00 },
+    { 34, 0, 34, 0x00 },
+    { 0, -34, 0, 0x00 }
+};
+
+static const UtilInternal::UTF32 caseSpecialData[318] =
+{
+    0x00053, 0x00053, 0x00073, 0x00073, 0x00069, 0x00307, 0x002BC, 0x0004E,
+    0x002BC, 0x0006E, 0x0004A, 0x0030C, 0x0006A, 0x0030C, 0x00399, 0x00308,
+    0x00301, 0x003B9, 0x00308, 0x00301, 0x003A5, 0x00308, 0x00301, 0x003C5,
+    0x00308, 0x00301, 0x00535, 0x00552, 0x00565, 0x00582, 0x00048, 0x00331,
+    0x00068, 0x00331, 0x00054, 0x00308, 0x00074, 0x00308, 0x00057, 0x0030A,
+    0x00077, 0x0030A, 0x00059, 0x0030A, 0x00079, 0x0030A, 0x00041, 0x002BE,
+    0x00061, 0x002BE, 0x003A5, 0x00313, 0x003C5, 0x00313, 0x003A5, 0x00313,
+    0x00300, 0x003C5, 0x00313, 0x00300, 0x003A5, 0x00313, 0x00301, 0x003C5,
+    0x00313, 0x00301, 0x003A5, 0x00313, 0x00342, 0x003C5, 0x00313, 0x00342,
+    0x01F08, 0x00399, 0x01F00, 0x003B9, 0x01F09, 0x00399, 0x01F01, 0x003B9,
+    0x01F0A, 0x00399, 0x01F02, 0x003B9, 0x01F0B, 0x00399, 0x01F03, 0x003B9,
+    0x01F0C, 0x00399, 0x01F04, 0x003B9, 0x01F0D, 0x00399, 0x01F05, 0x003B9,
+    0x01F0E, 0x00399, 0x01F06, 0x003B9, 0x01F0F, 0x00399, 0x01F07, 0x003B9,
+    0x01F28, 0x00399, 0x01F20, 0x003B9, 0x01F29, 0x00399, 0x01F21, 0x003B9,
+    0x01F2A, 0x00399, 0x01F22, 0x003B9, 0x01F2B, 0x00399, 0x01F23, 0x003B9,
+    0x01F2C, 0x00399, 0x01F24, 0x003B9, 0x01F2D, 0x00399, 0x01F25, 0x003B9,
+    0x01F2E, 0x00399, 0x01F26, 0x003B9, 0x01F2F, 0x00399, 0x01F27, 0x003B9,
+    0x01F68, 0x00399, 0x01F60, 0x003B9, 0x01F69, 0x00399, 0x01F61, 0x003B9,
+    0x01F6A, 0x00399, 0x01F62, 0x003B9, 0x01F6B, 0x00399, 0x01F63, 0x003B9,
+    0x01F6C, 0x00399, 0x01F64, 0x003B9, 0x01F6D, 0x00399, 0x01F65, 0x003B9,
+    0x01F6E, 0x00399, 0x01F66, 0x003B9, 0x01F6F, 0x00399, 0x01F67, 0x003B9,
+    0x01FBA, 0x00399, 0x01F70, 0x003B9, 0x00391, 0x00399, 0x003B1, 0x003B9,
+    0x00386, 0x00399, 0x003AC, 0x003B9, 0x00391, 0x00342, 0x003B1, 0x00342,
+    0x00391, 0x00342, 0x00399, 0x003B1, 0x00342, 0x003B9, 0x01FCA, 0x00399,
+    0x01F74, 0x003B9, 0x00397, 0x00399, 0x003B7, 0x003B9, 0x00389, 0x00399,
+    0x003AE, 0x003B9, 0x00397, 0x00342, 0x003B7, 0x00342, 0x00397, 0x00342,
+    0x00399, 0x003B7, 0x00342, 0x003B9, 0x00399, 0x00308, 0x00300, 0x003B9,
+    0x00308, 0x00300, 0x00399, 0x00342, 0x003B9, 0x00342, 0x00399, 0x00308,
+    0x00342, 0x003B9, 0x00308, 0x00342, 0x003A5, 0x00308, 0x00300, 0x003C5,
+    0x00308, 0x00300, 0x003A1, 0x00313, 0x003C1, 0x00313, 0x003A5, 0x00342,
+    0x003C5, 0x00342, 0x003A5, 0x00308, 0x00342, 0x003C5, 0x00308, 0x00342,
+    0x01FFA, 0x00399, 0x01F7C, 0x003B9, 0x003A9, 0x00399, 0x003C9, 0x003B9,
+    0x0038F, 0x00399, 0x003CE, 0x003B9, 0x003A9, 0x00342, 0x003C9, 0x00342,
+    0x003A9, 0x00342, 0x00399, 0x003C9, 0x00342, 0x003B9, 0x00046, 0x00046,
+    0x00066, 0x00066, 0x00046, 0x00049, 0x00066, 0x00069, 0x00046, 0x0004C,
+    0x00066, 0x0006C, 0x00046, 0x00046, 0x00049, 0x00066, 0x00066, 0x00069,
+    0x00046, 0x00046, 0x0004C, 0x00066, 0x00066, 0x0006C, 0x00053, 0x00054,
+    0x00073, 0x00074, 0x00544, 0x00546, 0x00574, 0x00576, 0x00544, 0x00535,
+    0x00574, 0x00565, 0x00544, 0x0053B, 0x00574, 0x0056B, 0x0054E, 0x00546,
+    0x0057E, 0x00576, 0x00544, 0x0053D, 0x00574, 0x0056D
+};
+
+}
+
+#endif
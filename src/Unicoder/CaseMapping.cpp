@@ -0,0 +1,544 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/CaseMapping.h>
+#include <Unicoder/Transcoder.h>
+#include <Unicoder/CharacterProperties.h>
+
+#include "CaseData.h"
+
+#include <cstring>
+
+#if defined(ARCH_CPU_AVX2)
+#    include <immintrin.h>
+#elif defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+enum CaseOperation
+{
+    lowerCase,
+    upperCase,
+    foldCase
+};
+
+const UTF32 capitalSigma = 0x03A3;
+const UTF32 finalSigma = 0x03C2;
+const UTF32 dotlessI = 0x0131;
+const UTF32 dottedCapitalI = 0x0130;
+
+//
+// Ill-formed bytes are compared and hashed as values above U+10FFFF, so
+// they never match a character.
+//
+const UTF32 illegalByteBase = 0x110000;
+
+inline const CaseRecord&
+GetCaseRecord(UTF32 cp)
+{
+    return caseRecords[(GetCharacterRecord(cp) >> characterCaseMappingShift) & characterCaseMappingMask];
+}
+
+//
+// The character an ASCII run ends at for the turkic rules: those of I and
+// i differ from the defaults.
+//
+inline char
+TurkicASCII(CaseOperation operation)
+{
+    return operation == upperCase ? 'i' : 'I';
+}
+
+//
+// Writes the mapping of cp (at most 3 code points) to target and returns
+// its length.
+//
+int
+MapCodePoint(UTF32 cp, CaseOperation operation, CaseMappingLocale locale, UTF32* target)
+{
+    if (locale == turkicCaseMapping)
+    {
+        if (operation == upperCase)
+        {
+            if (cp == 'i')
+            {
+                target[0] = dottedCapitalI;
+                return 1;
+            }
+        }
+        else if (cp == 'I')
+        {
+            target[0] = dotlessI;
+            return 1;
+        }
+        else if (cp == dottedCapitalI)
+        {
+            target[0] = 'i';
+            return 1;
+        }
+    }
+
+    const CaseRecord& record = GetCaseRecord(cp);
+    int32 value;
+    uint8 special;
+    switch (operation)
+    {
+        case lowerCase:
+            value = record.lower;
+            special = caseLowerSpecial;
+            break;
+        case upperCase:
+            value = record.upper;
+            special = caseUpperSpecial;
+            break;
+        default:
+            value = record.fold;
+            special = caseFoldSpecial;
+            break;
+    }
+
+    if (record.flags & special)
+    {
+        const UTF32* mapping = caseSpecialData + (value >> 2);
+        int length = value & 3;
+        std::copy(mapping, mapping + length, target);
+        return length;
+    }
+    target[0] = static_cast<UTF32>(static_cast<int32>(cp) + value);
+    return 1;
+}
+
+inline Byte
+FoldASCII(Byte b)
+{
+    return static_cast<Byte>(b - 'A') < 26 ? static_cast<Byte>(b | 0x20) : b;
+}
+
+//
+// Copies [first, last) to target, flipping the case of the 26 letters
+// starting at lowest ('A' to lowercase, 'a' to uppercase). Works on any
+// bytes, but is only given ASCII.
+//
+void
+ConvertASCII(const Byte* first, const Byte* last, Byte* target, Byte lowest)
+{
+    //
+    // Adding 0x80 - lowest moves the letters to the 26 smallest signed
+    // bytes, so one signed compare finds them.
+    //
+#if defined(ARCH_CPU_AVX2)
+    const __m256i shift32 = _mm256_set1_epi8(static_cast<char>(0x80 - lowest));
+    const __m256i limit32 = _mm256_set1_epi8(static_cast<char>(-128 + 26));
+    const __m256i flip32 = _mm256_set1_epi8(0x20);
+    for (; last - first >= 32; first += 32, target += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        __m256i letters = _mm256_cmpgt_epi8(limit32, _mm256_add_epi8(v, shift32));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(target),
+                            _mm256_xor_si256(v, _mm256_and_si256(letters, flip32)));
+    }
+#endif
+#if defined(ARCH_CPU_SSE2)
+    const __m128i shift = _mm_set1_epi8(static_cast<char>(0x80 - lowest));
+    const __m128i limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+    const __m128i flip = _mm_set1_epi8(0x20);
+    for (; last - first >= 16; first += 16, target += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        __m128i letters = _mm_cmplt_epi8(_mm_add_epi8(v, shift), limit);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(target), _mm_xor_si128(v, _mm_and_si128(letters, flip)));
+    }
+#elif defined(ARCH_CPU_NEON)
+    const uint8x16_t low = vdupq_n_u8(lowest);
+    const uint8x16_t count = vdupq_n_u8(26);
+    const uint8x16_t flip = vdupq_n_u8(0x20);
+    for (; last - first >= 16; first += 16, target += 16)
+    {
+        uint8x16_t v = vld1q_u8(first);
+        uint8x16_t letters = vcltq_u8(vsubq_u8(v, low), count);
+        vst1q_u8(target, veorq_u8(v, vandq_u8(letters, flip)));
+    }
+#endif
+
+    for (; first != last; ++first, ++target)
+    {
+        Byte b = *first;
+        *target = static_cast<Byte>(b - lowest) < 26 ? static_cast<Byte>(b ^ 0x20) : b;
+    }
+}
+
+//
+// Final_Sigma context, see "Default Case Conversion" in chapter 3 of the
+// Unicode Standard: a capital sigma lowercases to final sigma if it is
+// preceded by a cased character and not followed by one, case ignorable
+// characters in between are skipped either way.
+//
+inline bool
+UpdateAfterCased(bool afterCased, UTF32 cp)
+{
+    uint64 record = GetCharacterRecord(cp);
+    return (record & characterCased) != 0 || (afterCased && (record & characterCaseIgnorable) != 0);
+}
+
+bool
+AfterCased(bool afterCased, const Byte* first, const Byte* last)
+{
+    while (last != first)
+    {
+        uint64 record = GetCharacterRecord(*--last);
+        if (record & characterCased)
+        {
+            return true;
+        }
+        if (!(record & characterCaseIgnorable))
+        {
+            return false;
+        }
+    }
+    return afterCased;
+}
+
+bool
+FollowedByCased(const Byte* p, const Byte* last)
+{
+    while (p != last)
+    {
+        UTF32 cp;
+        if (UTF8Encoding::Decode(p, last, cp, strictConversion) != conversionOK)
+        {
+            return false;
+        }
+        uint64 record = GetCharacterRecord(cp);
+        if (record & characterCased)
+        {
+            return true;
+        }
+        if (!(record & characterCaseIgnorable))
+        {
+            return false;
+        }
+    }
+    return false;
+}
+
+inline void
+AppendUTF8(UTF32 cp, string& target)
+{
+    Byte buffer[UTF8Encoding::MaxUnitsPerCodePoint];
+    Byte* end = buffer;
+    UTF8Encoding::Encode(cp, end, buffer + sizeof(buffer));
+    target.append(reinterpret_cast<const char*>(buffer), end - buffer);
+}
+
+string
+MapString(const string& utf8, CaseOperation operation, CaseMappingLocale locale)
+{
+    const Byte* p = reinterpret_cast<const Byte*>(utf8.data());
+    const Byte* last = p + utf8.size();
+    const Byte lowest = operation == upperCase ? 'a' : 'A';
+
+    string result;
+    result.reserve(utf8.size());
+    bool afterCased = false;
+
+    while (p != last)
+    {
+        const Byte* ascii = FindNonASCII(p, last);
+        if (locale == turkicCaseMapping)
+        {
+            const void* special = memchr(p, TurkicASCII(operation), ascii - p);
+            if (special != 0)
+            {
+                ascii = static_cast<const Byte*>(special);
+            }
+        }
+        if (ascii != p)
+        {
+            size_t size = result.size();
+            result.resize(size + (ascii - p));
+            ConvertASCII(p, ascii, reinterpret_cast<Byte*>(&result[size]), lowest);
+            if (operation == lowerCase)
+            {
+                afterCased = AfterCased(afterCased, p, ascii);
+            }
+            p = ascii;
+            if (p == last)
+            {
+                break;
+            }
+        }
+
+        const Byte* start = p;
+        UTF32 cp;
+        if (UTF8Encoding::Decode(p, last, cp, strictConversion) != conversionOK)
+        {
+            result += static_cast<char>(*p++);
+            afterCased = false;
+            continue;
+        }
+
+        if (operation == lowerCase)
+        {
+            if (cp == capitalSigma && afterCased && !FollowedByCased(p, last))
+            {
+                AppendUTF8(finalSigma, result);
+                continue;
+            }
+
+            //
+            // Turkic I followed by a combining dot above is a dotted i.
+            //
+            if (locale == turkicCaseMapping && cp == 'I' && last - p >= 2 && p[0] == 0xCC && p[1] == 0x87)
+            {
+                result += 'i';
+                p += 2;
+                afterCased = true;
+                continue;
+            }
+            afterCased = UpdateAfterCased(afterCased, cp);
+        }
+
+        UTF32 mapping[3];
+        int length = MapCodePoint(cp, operation, locale, mapping);
+        if (length == 1 && mapping[0] == cp)
+        {
+            result.append(reinterpret_cast<const char*>(start), p - start);
+            continue;
+        }
+        for (int i = 0; i < length; ++i)
+        {
+            AppendUTF8(mapping[i], result);
+        }
+    }
+    return result;
+}
+
+//
+// Produces the code points of the case folding of a UTF-8 string one by
+// one, with a buffer for the rest of a multi-character folding.
+//
+class FoldedCodePoints
+{
+public:
+
+    FoldedCodePoints(const char* first, const char* last, CaseMappingLocale locale) :
+        m_p(reinterpret_cast<const Byte*>(first)),
+        m_last(reinterpret_cast<const Byte*>(last)),
+        m_turkic(locale == turkicCaseMapping),
+        m_pending(0),
+        m_pendingEnd(0)
+    {
+    }
+
+    bool AtEnd() const
+    {
+        return m_pending == m_pendingEnd && m_p == m_last;
+    }
+
+    //
+    // True if the next code point is an ASCII character that folds like
+    // in the default rules; then Next() is FoldASCII of the next byte.
+    //
+    bool AtASCII() const
+    {
+        return m_pending == m_pendingEnd && m_p != m_last && *m_p < 0x80 && !(m_turkic && *m_p == 'I');
+    }
+
+    const Byte* Position() const
+    {
+        return m_p;
+    }
+
+    void Advance(size_t count)
+    {
+        m_p += count;
+    }
+
+    UTF32 Next()
+    {
+        assert(!AtEnd());
+        if (m_pending != m_pendingEnd)
+        {
+            return *m_pending++;
+        }
+
+        UTF32 cp;
+        if (UTF8Encoding::Decode(m_p, m_last, cp, strictConversion) != conversionOK)
+        {
+            return illegalByteBase + *m_p++;
+        }
+        int length = MapCodePoint(cp, foldCase, m_turkic ? turkicCaseMapping : defaultCaseMapping, m_buffer);
+        m_pending = m_buffer + 1;
+        m_pendingEnd = m_buffer + length;
+        return m_buffer[0];
+    }
+
+private:
+
+    const Byte* m_p;
+    const Byte* m_last;
+    bool m_turkic;
+    UTF32 m_buffer[3];
+    const UTF32* m_pending;
+    const UTF32* m_pendingEnd;
+};
+
+//
+// Number of leading bytes of lhs and rhs, both ASCII, that are equal once
+// folded. Stops early at a turkic I.
+//
+size_t
+CommonFoldedASCII(const Byte* lhs, const Byte* rhs, size_t size, bool turkic)
+{
+    size_t i = 0;
+#if defined(ARCH_CPU_SSE2)
+    if (!turkic)
+    {
+        const __m128i shift = _mm_set1_epi8(static_cast<char>(0x80 - 'A'));
+        const __m128i limit = _mm_set1_epi8(static_cast<char>(-128 + 26));
+        const __m128i flip = _mm_set1_epi8(0x20);
+        for (; size - i >= 16; i += 16)
+        {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+            if (_mm_movemask_epi8(_mm_or_si128(a, b)) != 0)
+            {
+                break;
+            }
+            a = _mm_or_si128(a, _mm_and_si128(_mm_cmplt_epi8(_mm_add_epi8(a, shift), limit), flip));
+            b = _mm_or_si128(b, _mm_and_si128(_mm_cmplt_epi8(_mm_add_epi8(b, shift), limit), flip));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xFFFF)
+            {
+                break;
+            }
+        }
+    }
+#endif
+    for (; i < size; ++i)
+    {
+        Byte a = lhs[i];
+        Byte b = rhs[i];
+        if (a >= 0x80 || b >= 0x80 || FoldASCII(a) != FoldASCII(b) || (turkic && (a == 'I' || b == 'I')))
+        {
+            break;
+        }
+    }
+    return i;
+}
+
+}
+
+string
+Util::ToLowerCase(const string& utf8, CaseMappingLocale locale)
+{
+    return MapString(utf8, lowerCase, locale);
+}
+
+string
+Util::ToUpperCase(const string& utf8, CaseMappingLocale locale)
+{
+    return MapString(utf8, upperCase, locale);
+}
+
+string
+Util::FoldCase(const string& utf8, CaseMappingLocale locale)
+{
+    return MapString(utf8, foldCase, locale);
+}
+
+int
+Util::FoldCase(UTF32 cp, UTF32* target, CaseMappingLocale locale)
+{
+    return MapCodePoint(cp, foldCase, locale, target);
+}
+
+int
+Util::CompareCaseInsensitive(const char* lhsFirst, const char* lhsLast,
+                             const char* rhsFirst, const char* rhsLast,
+                             CaseMappingLocale locale)
+{
+    FoldedCodePoints lhs(lhsFirst, lhsLast, locale);
+    FoldedCodePoints rhs(rhsFirst, rhsLast, locale);
+    while (true)
+    {
+        if (lhs.AtASCII() && rhs.AtASCII())
+        {
+            size_t size = std::min(static_cast<size_t>(lhsLast - reinterpret_cast<const char*>(lhs.Position())),
+                                   static_cast<size_t>(rhsLast - reinterpret_cast<const char*>(rhs.Position())));
+            size_t common = CommonFoldedASCII(lhs.Position(), rhs.Position(), size, locale == turkicCaseMapping);
+            lhs.Advance(common);
+            rhs.Advance(common);
+        }
+
+        if (lhs.AtEnd() || rhs.AtEnd())
+        {
+            return lhs.AtEnd() ? (rhs.AtEnd() ? 0 : -1) : 1;
+        }
+
+        UTF32 a = lhs.Next();
+        UTF32 b = rhs.Next();
+        if (a != b)
+        {
+            return a < b ? -1 : 1;
+        }
+    }
+}
+
+int
+Util::CompareCaseInsensitive(const string& lhs, const string& rhs, CaseMappingLocale locale)
+{
+    return CompareCaseInsensitive(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size(), locale);
+}
+
+bool
+Util::EqualsCaseInsensitive(const string& lhs, const string& rhs, CaseMappingLocale locale)
+{
+    return CompareCaseInsensitive(lhs, rhs, locale) == 0;
+}
+
+unsigned long
+Util::HashCaseInsensitive(const char* first, const char* last, CaseMappingLocale locale)
+{
+    //
+    // FNV-1a over the folded code points.
+    //
+    uint64 hash = UTIL_UINT64(0xCBF29CE484222325);
+    const uint64 prime = UTIL_UINT64(0x100000001B3);
+
+    FoldedCodePoints codePoints(first, last, locale);
+    while (!codePoints.AtEnd())
+    {
+        UTF32 cp;
+        if (codePoints.AtASCII())
+        {
+            cp = FoldASCII(*codePoints.Position());
+            codePoints.Advance(1);
+        }
+        else
+        {
+            cp = codePoints.Next();
+        }
+        hash = (hash ^ cp) * prime;
+    }
+    return static_cast<unsigned long>(hash ^ (hash >> 32));
+}
+
+unsigned long
+Util::HashCaseInsensitive(const string& utf8, CaseMappingLocale locale)
+{
+    return HashCaseInsensitive(utf8.data(), utf8.data() + utf8.size(), locale);
+}
@@ -0,0 +1,27 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/CharacterProperties.h>
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+#if defined(LANG_CPP11)
+static_assert(GetGeneralCategory('A') == categoryLu, "CharacterData.h does not match GeneralCategory");
+static_assert(GetGeneralCategory(0x10FFFF) == categoryCn, "CharacterData.h does not match GeneralCategory");
+static_assert(GetCombiningClass(0x0301) == 230, "CharacterData.h does not match the combining classes");
+#endif
+
+size_t
+Util::CharacterPropertiesTableSize()
+{
+    return sizeof(CharacterTables<void>::index1) + sizeof(CharacterTables<void>::index2) +
+           sizeof(CharacterTables<void>::data) + sizeof(CharacterTables<void>::records) +
+           sizeof(CharacterTables<void>::scriptCodes) + sizeof(CharacterTables<void>::categoryNames);
+}
@@ -0,0 +1,194 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/CodePointIndex.h>
+#include <Util/Bits.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+inline bool
+IsLeadByte(Byte b)
+{
+    return (b & 0xC0) != 0x80;
+}
+
+//
+// Returns the start of the code point that comes n code points after the
+// first code point at or after p, or end if there are not that many.
+// Whole words that hold no more than n lead bytes are skipped at once.
+//
+const Byte*
+SkipCodePoints(const Byte* p, const Byte* end, size_t n)
+{
+    const uint64 highBits = 0x8080808080808080ULL;
+    while (end - p >= 8)
+    {
+        uint64 word;
+        memcpy(&word, p, sizeof(word));
+        size_t leads = static_cast<size_t>(Bits::PopCount64((~word | (word << 1)) & highBits));
+        if (leads > n)
+        {
+            break;
+        }
+        n -= leads;
+        p += 8;
+    }
+
+    for (; p != end; ++p)
+    {
+        if (IsLeadByte(*p))
+        {
+            if (n == 0)
+            {
+                return p;
+            }
+            --n;
+        }
+    }
+    return end;
+}
+
+inline size_t
+CountCodePoints(const Byte* begin, const Byte* end)
+{
+    return static_cast<size_t>(end - begin) - CountContinuationBytes(begin, end);
+}
+
+}
+
+CodePointIndex::CodePointIndex(size_t stride) :
+    m_data(0),
+    m_size(0),
+    m_count(0),
+    m_stride(stride)
+{
+    if (stride == 0)
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "stride must not be 0");
+    }
+}
+
+void
+CodePointIndex::Build(const char* data, size_t size)
+{
+    m_byteOffsets.clear();
+    m_codePointOffsets.clear();
+    Update(data, size, 0);
+}
+
+void
+CodePointIndex::Build(const string& str)
+{
+    Build(str.data(), str.size());
+}
+
+void
+CodePointIndex::Update(const char* data, size_t size, size_t editOffset)
+{
+    assert(editOffset <= size);
+    m_data = reinterpret_cast<const Byte*>(data);
+    m_size = size;
+
+    //
+    // Entries that only depend on bytes before the edit stay valid.
+    //
+    size_t blocks = std::min(m_codePointOffsets.size(), editOffset / m_stride + 1);
+    m_codePointOffsets.resize(blocks);
+
+    vector<size_t>::iterator p = lower_bound(m_byteOffsets.begin(), m_byteOffsets.end(), editOffset);
+    m_byteOffsets.erase(p, m_byteOffsets.end());
+
+    Reindex();
+}
+
+size_t
+CodePointIndex::Size() const
+{
+    return m_count;
+}
+
+size_t
+CodePointIndex::ByteOffset(size_t codePoint) const
+{
+    assert(codePoint <= m_count);
+    if (codePoint >= m_count)
+    {
+        return m_size;
+    }
+
+    size_t start = m_byteOffsets[codePoint / m_stride];
+    const Byte* p = SkipCodePoints(m_data + start, m_data + m_size, codePoint % m_stride);
+    return static_cast<size_t>(p - m_data);
+}
+
+size_t
+CodePointIndex::CodePointOffset(size_t byteOffset) const
+{
+    assert(byteOffset <= m_size);
+    if (byteOffset >= m_size)
+    {
+        return m_count;
+    }
+
+    size_t block = byteOffset / m_stride;
+    const Byte* start = m_data + block * m_stride;
+    return m_codePointOffsets[block] + CountCodePoints(start, m_data + byteOffset);
+}
+
+string
+CodePointIndex::Substring(size_t first, size_t count) const
+{
+    first = std::min(first, m_count);
+    count = std::min(count, m_count - first);
+    size_t begin = ByteOffset(first);
+    size_t end = ByteOffset(first + count);
+    return string(reinterpret_cast<const char*>(m_data) + begin, end - begin);
+}
+
+void
+CodePointIndex::Reindex()
+{
+    const Byte* end = m_data + m_size;
+
+    //
+    // Code points before every stride-th byte.
+    //
+    if (m_codePointOffsets.empty())
+    {
+        m_codePointOffsets.push_back(0);
+    }
+    size_t position = (m_codePointOffsets.size() - 1) * m_stride;
+    size_t count = m_codePointOffsets.back();
+    while (m_size - position >= m_stride)
+    {
+        count += CountCodePoints(m_data + position, m_data + position + m_stride);
+        position += m_stride;
+        m_codePointOffsets.push_back(count);
+    }
+    m_count = count + CountCodePoints(m_data + position, end);
+
+    //
+    // Byte offset of every stride-th code point.
+    //
+    if (m_byteOffsets.empty() && m_count > 0)
+    {
+        m_byteOffsets.push_back(static_cast<size_t>(SkipCodePoints(m_data, end, 0) - m_data));
+    }
+    while (m_byteOffsets.size() * m_stride < m_count)
+    {
+        const Byte* p = SkipCodePoints(m_data + m_byteOffsets.back(), end, m_stride);
+        m_byteOffsets.push_back(static_cast<size_t>(p - m_data));
+    }
+}
@@ -0,0 +1,720 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/Collation.h>
+#include <Unicoder/CharacterProperties.h>
+#include <Unicoder/Normalizer.h>
+#include <Unicoder/Transcoder.h>
+#include <Util/Exception.h>
+
+#include "CollationData.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+const UTF32 replacementCharacter = 0xFFFD;
+
+const UTF32 hangulBase = 0xAC00;
+const UTF32 jamoLBase = 0x1100;
+const UTF32 jamoVBase = 0x1161;
+const UTF32 jamoTBase = 0x11A7;
+const UTF32 jamoVCount = 21;
+const UTF32 jamoTCount = 28;
+
+//
+// The most combining marks after a contraction starter that are looked at
+// for a discontiguous match, like the stack buffers of the normalizer.
+//
+const int maxDiscontiguousMarks = 32;
+
+//
+// The most combining marks consumed ahead of the current position.
+//
+const int maxConsumed = 8;
+
+inline uint32
+GetCollationValue(UTF32 cp)
+{
+    if (cp >= collationLimit)
+    {
+        return collationImplicit;
+    }
+    return collationData[collationIndex[cp >> collationShift] + (cp & ((1 << collationShift) - 1))];
+}
+
+inline uint32
+PrimaryWeight(uint32 element)
+{
+    return element >> 14;
+}
+
+inline uint32
+SecondaryWeight(uint32 element)
+{
+    return (element >> 5) & 0x1FF;
+}
+
+inline uint32
+TertiaryWeight(uint32 element)
+{
+    return element & 0x1F;
+}
+
+inline uint32
+Weight(uint32 element, int level)
+{
+    return level == primaryStrength ? PrimaryWeight(element) :
+           level == secondaryStrength ? SecondaryWeight(element) : TertiaryWeight(element);
+}
+
+//
+// Decodes the code point at p and moves p after it. An ill-formed byte is
+// U+FFFD.
+//
+inline UTF32
+DecodeNext(const Byte*& p, const Byte* last)
+{
+    if (*p < 0x80)
+    {
+        return *p++;
+    }
+    UTF32 cp;
+    if (UTF8Encoding::Decode(p, last, cp, strictConversion) != conversionOK)
+    {
+        ++p;
+        cp = replacementCharacter;
+    }
+    return cp;
+}
+
+//
+// Canonical reordering changes the collation elements only if the text
+// holds combining marks, or the few starters that decompose to some;
+// otherwise the table gives precomposed characters the elements of their
+// decompositions. Tailored sequences are matched in NFD, so with tailorings
+// any text not in NFD is normalized as well.
+//
+bool
+NeedsNormalization(const Byte* first, const Byte* last, bool tailored)
+{
+    const UTF32* reorderedEnd = collationReorderedStarters +
+                                sizeof(collationReorderedStarters) / sizeof(collationReorderedStarters[0]);
+    const Byte* p = FindNonASCII(first, last);
+    if (p == last)
+    {
+        return false;
+    }
+    while (p != last)
+    {
+        UTF32 cp = DecodeNext(p, last);
+        if (GetCombiningClass(cp) != 0 || find(collationReorderedStarters, reorderedEnd, cp) != reorderedEnd)
+        {
+            return true;
+        }
+        p = FindNonASCII(p, last);
+    }
+    return tailored && !IsNormalized(string(reinterpret_cast<const char*>(first), reinterpret_cast<const char*>(last)),
+                                     NFD);
+}
+
+//
+// [first, last) in a form the collation elements can be taken from: in
+// place, or normalized into storage.
+//
+void
+PrepareText(const char*& first, const char*& last, string& storage, bool tailored)
+{
+    if (NeedsNormalization(reinterpret_cast<const Byte*>(first), reinterpret_cast<const Byte*>(last), tailored))
+    {
+        storage = Normalize(string(first, last), NFD);
+        first = storage.data();
+        last = first + storage.size();
+    }
+}
+
+void
+AppendWeight16(string& key, uint32 weight)
+{
+    key += static_cast<char>(weight >> 8);
+    key += static_cast<char>(weight & 0xFF);
+}
+
+struct KeyLess
+{
+    KeyLess(const SortKeyBatch& batch) :
+        batch(batch)
+    {
+    }
+
+    bool operator()(size_t lhs, size_t rhs) const
+    {
+        return batch.Compare(lhs, rhs) < 0;
+    }
+
+    const SortKeyBatch& batch;
+};
+
+}
+
+//
+// Produces the collation elements of UTF-8 text one by one (steps S2.1 to
+// S2.4 of UTS #10). Contractions are matched contiguously first and then,
+// as the algorithm requires, with unblocked combining marks further on:
+// those marks are remembered in m_consumed and skipped when reached.
+//
+class Collator::ElementIterator
+{
+public:
+
+    ElementIterator(const Collator& collator, const char* first, const char* last) :
+        m_collator(collator),
+        m_p(reinterpret_cast<const Byte*>(first)),
+        m_last(reinterpret_cast<const Byte*>(last)),
+        m_next(0),
+        m_end(0),
+        m_consumedCount(0)
+    {
+    }
+
+    bool Next(uint32& element)
+    {
+        while (m_next == m_end)
+        {
+            if (m_p == m_last)
+            {
+                return false;
+            }
+            Fill();
+        }
+        element = *m_next++;
+        return true;
+    }
+
+    //
+    // The next non-zero weight at level, or 0 at the end.
+    //
+    uint32 NextWeight(int level)
+    {
+        uint32 element;
+        while (Next(element))
+        {
+            uint32 weight = Weight(element, level);
+            if (weight != 0)
+            {
+                return weight;
+            }
+        }
+        return 0;
+    }
+
+private:
+
+    //
+    // Moves p over the code points consumed by discontiguous contractions.
+    //
+    void SkipConsumed(const Byte*& p) const
+    {
+        for (int i = 0; i < m_consumedCount; ++i)
+        {
+            if (m_consumed[i] == p)
+            {
+                DecodeNext(p, m_last);
+            }
+        }
+    }
+
+    //
+    // Decodes the code point at p unless it was consumed, returns false at
+    // the end.
+    //
+    bool NextCodePoint(const Byte*& p, UTF32& cp) const
+    {
+        SkipConsumed(p);
+        if (p == m_last)
+        {
+            return false;
+        }
+        cp = DecodeNext(p, m_last);
+        return true;
+    }
+
+    void Fill()
+    {
+        //
+        // Drop the consumed marks that were passed over (by a longer match)
+        // and skip the one at the current position.
+        //
+        int passed = 0;
+        while (passed < m_consumedCount && m_consumed[passed] <= m_p)
+        {
+            ++passed;
+        }
+        if (passed > 0)
+        {
+            bool skip = m_consumed[passed - 1] == m_p;
+            m_consumedCount -= passed;
+            copy(m_consumed + passed, m_consumed + passed + m_consumedCount, m_consumed);
+            if (skip)
+            {
+                DecodeNext(m_p, m_last);
+                return;
+            }
+        }
+
+        UTF32 cp = DecodeNext(m_p, m_last);
+        if (!m_collator.m_tailorings.empty() && MatchTailoring(cp))
+        {
+            return;
+        }
+
+        uint32 value = GetCollationValue(cp);
+        if ((value & collationTagMask) == collationContraction)
+        {
+            value = MatchContraction(value);
+        }
+        switch (value & collationTagMask)
+        {
+            case collationSingle:
+            {
+                m_local[0] = value & ~collationTagMask;
+                m_next = m_local;
+                m_end = m_local + 1;
+                break;
+            }
+            case collationExpansion:
+            {
+                m_next = collationElements + ((value & ~collationTagMask) >> 5);
+                m_end = m_next + (value & 0x1F);
+                break;
+            }
+            default:
+            {
+                if (value == collationHangul)
+                {
+                    Hangul(cp);
+                }
+                else
+                {
+                    Implicit(cp, value);
+                }
+                break;
+            }
+        }
+    }
+
+    bool MatchTailoring(UTF32 cp)
+    {
+        map<UTF32, vector<Tailoring> >::const_iterator p = m_collator.m_tailorings.find(cp);
+        if (p == m_collator.m_tailorings.end())
+        {
+            return false;
+        }
+        for (vector<Tailoring>::const_iterator t = p->second.begin(); t != p->second.end(); ++t)
+        {
+            const Byte* q = m_p;
+            size_t matched = 1;
+            UTF32 next;
+            while (matched < t->sequence.size() && NextCodePoint(q, next) && next == t->sequence[matched])
+            {
+                ++matched;
+            }
+            if (matched == t->sequence.size())
+            {
+                m_p = q;
+                m_next = t->elements.empty() ? 0 : &t->elements[0];
+                m_end = m_next + t->elements.size();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    //
+    // The entry of collationContractions for the matched[1..count) code
+    // points after the starter, or 0.
+    //
+    static const uint32* FindContraction(const uint32* entries, size_t size, const UTF32* matched, size_t count)
+    {
+        for (const uint32* e = entries; e != entries + size * 3; e += 3)
+        {
+            if (count == 1 ? e[0] == 0 :
+                count == 2 ? e[0] == matched[1] && e[1] == 0 : e[0] == matched[1] && e[1] == matched[2])
+            {
+                return e;
+            }
+        }
+        return 0;
+    }
+
+    uint32 MatchContraction(uint32 value)
+    {
+        const uint32* entries = collationContractions + ((value & ~collationTagMask) >> 6) * 3;
+        size_t size = value & 0x3F;
+
+        //
+        // The longest contiguous match; the starter alone always matches.
+        //
+        UTF32 matched[3] = { 0, 0, 0 };
+        size_t count = 1;
+        const Byte* ends[3] = { m_p, 0, 0 };
+        while (count < 3)
+        {
+            const Byte* q = ends[count - 1];
+            if (!NextCodePoint(q, matched[count]) || !FindPrefix(entries, size, matched, count + 1))
+            {
+                break;
+            }
+            ends[count++] = q;
+        }
+        const uint32* entry = 0;
+        while ((entry = FindContraction(entries, size, matched, count)) == 0)
+        {
+            --count;
+        }
+        m_p = ends[count - 1];
+
+        //
+        // Discontiguous matches with the unblocked combining marks that
+        // follow.
+        //
+        const Byte* q = m_p;
+        int blocking = 0;
+        for (int marks = 0; count < 3 && m_consumedCount < maxConsumed && marks < maxDiscontiguousMarks; ++marks)
+        {
+            SkipConsumed(q);
+            if (q == m_last)
+            {
+                break;
+            }
+            const Byte* start = q;
+            UTF32 mark = DecodeNext(q, m_last);
+            int combiningClass = GetCombiningClass(mark);
+            if (combiningClass == 0)
+            {
+                break;
+            }
+            if (combiningClass > blocking)
+            {
+                matched[count] = mark;
+                const uint32* longer = FindContraction(entries, size, matched, count + 1);
+                if (longer != 0)
+                {
+                    entry = longer;
+                    ++count;
+                    Consume(start);
+                    continue;
+                }
+            }
+            blocking = max(blocking, combiningClass);
+        }
+        return entry[2];
+    }
+
+    //
+    // Whether some entry starts with matched[1..count).
+    //
+    static bool FindPrefix(const uint32* entries, size_t size, const UTF32* matched, size_t count)
+    {
+        for (const uint32* e = entries; e != entries + size * 3; e += 3)
+        {
+            if (e[0] == matched[1] && (count == 2 || e[1] == matched[2]))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Consume(const Byte* p)
+    {
+        assert(m_consumedCount < maxConsumed);
+        int i = m_consumedCount++;
+        for (; i > 0 && m_consumed[i - 1] > p; --i)
+        {
+            m_consumed[i] = m_consumed[i - 1];
+        }
+        m_consumed[i] = p;
+    }
+
+    //
+    // Hangul syllables are weighed as their conjoining jamo.
+    //
+    void Hangul(UTF32 cp)
+    {
+        UTF32 index = cp - hangulBase;
+        UTF32 t = index % jamoTCount;
+        m_local[0] = GetCollationValue(jamoLBase + index / (jamoVCount * jamoTCount)) & ~collationTagMask;
+        m_local[1] = GetCollationValue(jamoVBase + (index % (jamoVCount * jamoTCount)) / jamoTCount) & ~collationTagMask;
+        m_local[2] = GetCollationValue(jamoTBase + t) & ~collationTagMask;
+        m_next = m_local;
+        m_end = m_local + (t == 0 ? 2 : 3);
+    }
+
+    //
+    // Code points without an entry get two elements derived from the code
+    // point (UTS #10 section 10.1).
+    //
+    void Implicit(UTF32 cp, uint32 kind)
+    {
+        uint32 base = collationImplicitBases[kind];
+        UTF32 origin = collationImplicitOrigins[kind];
+        uint32 high = origin == 0 ? base + (cp >> 15) : base;
+        uint32 low = (origin == 0 ? cp & 0x7FFF : cp - origin) | 0x8000;
+        m_local[0] = (high << 14) | (0x20 << 5) | 0x02;
+        m_local[1] = low << 14;
+        m_next = m_local;
+        m_end = m_local + 2;
+    }
+
+    const Collator& m_collator;
+    const Byte* m_p;
+    const Byte* m_last;
+
+    const uint32* m_next;
+    const uint32* m_end;
+    uint32 m_local[3];
+
+    const Byte* m_consumed[maxConsumed];
+    int m_consumedCount;
+};
+
+Util::Collator::Collator(CollationStrength strength) :
+    m_strength(strength)
+{
+}
+
+void
+Util::Collator::Tailor(const string& sequence, const string& reference)
+{
+    Tailoring tailoring;
+    const string decomposed = Normalize(sequence, NFD);
+    const Byte* p = reinterpret_cast<const Byte*>(decomposed.data());
+    const Byte* last = p + decomposed.size();
+    while (p != last)
+    {
+        tailoring.sequence.push_back(DecodeNext(p, last));
+    }
+    if (tailoring.sequence.empty())
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__, "tailored sequence must not be empty");
+    }
+
+    string storage;
+    const char* first = reference.data();
+    const char* end = first + reference.size();
+    PrepareText(first, end, storage, !m_tailorings.empty());
+    ElementIterator elements(*this, first, end);
+    uint32 element;
+    while (elements.Next(element))
+    {
+        tailoring.elements.push_back(element);
+    }
+
+    vector<Tailoring>& tailorings = m_tailorings[tailoring.sequence[0]];
+    vector<Tailoring>::iterator q = tailorings.begin();
+    while (q != tailorings.end() && q->sequence.size() > tailoring.sequence.size())
+    {
+        ++q;
+    }
+    for (vector<Tailoring>::iterator r = q; r != tailorings.end() && r->sequence.size() == tailoring.sequence.size(); ++r)
+    {
+        if (r->sequence == tailoring.sequence)
+        {
+            r->elements.swap(tailoring.elements);
+            return;
+        }
+    }
+    tailorings.insert(q, tailoring);
+}
+
+int
+Util::Collator::Compare(const char* first1, const char* last1, const char* first2, const char* last2) const
+{
+    if (last1 - first1 == last2 - first2 && memcmp(first1, first2, static_cast<size_t>(last1 - first1)) == 0)
+    {
+        return 0;
+    }
+
+    string storage1;
+    string storage2;
+    PrepareText(first1, last1, storage1, !m_tailorings.empty());
+    PrepareText(first2, last2, storage2, !m_tailorings.empty());
+
+    //
+    // One level at a time, so that most comparisons end at the first
+    // differing primary weight.
+    //
+    for (int level = primaryStrength; level <= m_strength; ++level)
+    {
+        ElementIterator lhs(*this, first1, last1);
+        ElementIterator rhs(*this, first2, last2);
+        for (;;)
+        {
+            uint32 lhsWeight = lhs.NextWeight(level);
+            uint32 rhsWeight = rhs.NextWeight(level);
+            if (lhsWeight != rhsWeight)
+            {
+                return lhsWeight < rhsWeight ? -1 : 1;
+            }
+            if (lhsWeight == 0)
+            {
+                break;
+            }
+        }
+    }
+    return 0;
+}
+
+int
+Util::Collator::Compare(const string& lhs, const string& rhs) const
+{
+    return Compare(lhs.data(), lhs.data() + lhs.size(), rhs.data(), rhs.data() + rhs.size());
+}
+
+void
+Util::Collator::AppendSortKey(const char* first, const char* last, string& key) const
+{
+    vector<uint32> elements;
+    AppendSortKey(first, last, key, elements);
+}
+
+void
+Util::Collator::AppendSortKey(const char* first, const char* last, string& key, vector<uint32>& elements) const
+{
+    string storage;
+    PrepareText(first, last, storage, !m_tailorings.empty());
+
+    elements.clear();
+    ElementIterator iterator(*this, first, last);
+    uint32 element;
+    while (iterator.Next(element))
+    {
+        uint32 primary = PrimaryWeight(element);
+        if (primary != 0)
+        {
+            AppendWeight16(key, primary);
+        }
+        if (m_strength > primaryStrength)
+        {
+            elements.push_back(element);
+        }
+    }
+
+    if (m_strength >= secondaryStrength)
+    {
+        AppendWeight16(key, 0);
+        for (vector<uint32>::const_iterator p = elements.begin(); p != elements.end(); ++p)
+        {
+            uint32 secondary = SecondaryWeight(*p);
+            if (secondary != 0)
+            {
+                AppendWeight16(key, secondary);
+            }
+        }
+    }
+    if (m_strength >= tertiaryStrength)
+    {
+        //
+        // Tertiary weights fit in a byte.
+        //
+        AppendWeight16(key, 0);
+        for (vector<uint32>::const_iterator p = elements.begin(); p != elements.end(); ++p)
+        {
+            uint32 tertiary = TertiaryWeight(*p);
+            if (tertiary != 0)
+            {
+                key += static_cast<char>(tertiary);
+            }
+        }
+    }
+}
+
+string
+Util::Collator::GetSortKey(const string& utf8) const
+{
+    string key;
+    AppendSortKey(utf8.data(), utf8.data() + utf8.size(), key);
+    return key;
+}
+
+Util::SortKeyBatch::SortKeyBatch(const Collator& collator) :
+    m_collator(collator)
+{
+}
+
+void
+Util::SortKeyBatch::Reserve(size_t count, size_t bytes)
+{
+    m_ends.reserve(count);
+    m_keys.reserve(bytes);
+}
+
+size_t
+Util::SortKeyBatch::Add(const char* first, const char* last)
+{
+    m_collator.AppendSortKey(first, last, m_keys, m_elements);
+    m_ends.push_back(m_keys.size());
+    return m_ends.size() - 1;
+}
+
+size_t
+Util::SortKeyBatch::Add(const string& utf8)
+{
+    return Add(utf8.data(), utf8.data() + utf8.size());
+}
+
+const char*
+Util::SortKeyBatch::KeyData(size_t index) const
+{
+    assert(index < m_ends.size());
+    return m_keys.data() + (index == 0 ? 0 : m_ends[index - 1]);
+}
+
+size_t
+Util::SortKeyBatch::KeySize(size_t index) const
+{
+    assert(index < m_ends.size());
+    return m_ends[index] - (index == 0 ? 0 : m_ends[index - 1]);
+}
+
+int
+Util::SortKeyBatch::Compare(size_t lhs, size_t rhs) const
+{
+    size_t lhsSize = KeySize(lhs);
+    size_t rhsSize = KeySize(rhs);
+    int result = memcmp(KeyData(lhs), KeyData(rhs), min(lhsSize, rhsSize));
+    if (result != 0)
+    {
+        return result;
+    }
+    return lhsSize < rhsSize ? -1 : lhsSize > rhsSize ? 1 : 0;
+}
+
+void
+Util::SortKeyBatch::Sort(vector<size_t>& order) const
+{
+    order.resize(m_ends.size());
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), KeyLess(*this));
+}
+
+void
+Util::SortKeyBatch::Clear()
+{
+    m_keys.clear();
+    m_ends.clear();
+}
@@ -0,0 +1,7436 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+//
+// Generated by MakeUnicodeTables.pl from the Unicode Character Database
+// 14.0.0 - do not edit.
+//
+
+#ifndef UTIL_COLLATION_DATA_H
+#define UTIL_COLLATION_DATA_H
+
+#include <Util/Config.h>
+#include <Unicoder/ConvertUTF.h>
+
+//
+// Only included by the source file that uses the tables.
+//
+namespace
+{
+
+//
+// The Default Unicode Collation Element Table (DUCET) 13.0.0 of UTS #10.
+//
+//     value(cp) = collationData[collationIndex[cp >> collationShift] + (cp & ((1 << collationShift) - 1))]
+//
+// The top two bits of a value tell what the others are:
+//
+//     collationImplicit     the kind of implicit weights, an index in
+//                           collationImplicitBases, or collationHangul for
+//                           Hangul syllables (weighed as their jamo)
+//     collationSingle       a single collation element
+//     collationExpansion    (offset << 5) | length in collationElements
+//     collationContraction  (offset << 6) | count in collationContractions,
+//                           in triples
+//
+// Code points at or above collationLimit have the implicit weights of
+// kind 0. A collation element holds the primary weight in bits 14-29, the
+// secondary in bits 5-13 and the tertiary in bits 0-4.
+//
+const int collationShift = 7;
+const UtilInternal::UTF32 collationLimit = 918016;
+
+const uint32 collationTagMask = 0xC0000000;
+const uint32 collationImplicit = 0x00000000;
+const uint32 collationSingle = 0x40000000;
+const uint32 collationExpansion = 0x80000000;
+const uint32 collationContraction = 0xC0000000;
+
+const uint32 collationHangul = 6;
+
+static const uint16 collationImplicitBases[6] =
+{
+    0xFBC0, 0xFB40, 0xFB80, 0xFB00, 0xFB01, 0xFB02
+};
+
+static const UtilInternal::UTF32 collationImplicitOrigins[6] =
+{
+    0x00000, 0x00000, 0x00000, 0x17000, 0x1B170, 0x18B00
+};
+
+//
+// Starters with a canonical decomposition that starts with a combining mark.
+//
+static const UtilInternal::UTF32 collationReorderedStarters[3] =
+{
+    0x00F73, 0x00F75, 0x00F81
+};
+
+static const uint16 collationIndex[7172] =
+{
+    0x0000, 0x0080, 0x0100, 0x0180, 0x0200, 0x0280, 0x0300, 0x0380, 0x0400, 0x0480, 0x0500, 0x0580,
+    0x0600, 0x0680, 0x0700, 0x0780, 0x0800, 0x0880, 0x0900, 0x0980, 0x0A00, 0x0A80, 0x0B00, 0x0B80,
+    0x0C00, 0x0C80, 0x0D00, 0x0D80, 0x0E00, 0x0E80, 0x0F00, 0x0F80, 0x1000, 0x1080, 0x1100, 0x1180,
+    0x1200, 0x1280, 0x1300, 0x1380, 0x1400, 0x1480, 0x1500, 0x1580, 0x1600, 0x1680, 0x1700, 0x1780,
+    0x1800, 0x1880, 0x1900, 0x1980, 0x1A00, 0x1A80, 0x1B00, 0x1B80, 0x1C00, 0x1C80, 0x1D00, 0x1D80,
+    0x1E00, 0x1E80, 0x1F00, 0x1F80, 0x2000, 0x2080, 0x2100, 0x2180, 0x2200, 0x2280, 0x2300, 0x2380,
+    0x2400, 0x2480, 0x2500, 0x2580, 0x2600, 0x2680, 0x2700, 0x2780, 0x2800, 0x2880, 0x2900, 0x2980,
+    0x2A00, 0x2A80, 0x2B00, 0x2B80, 0x2C00, 0x2C80, 0x2D00, 0x2D80, 0x2E00, 0x2E80, 0x2F00, 0x2F80,
+    0x3000, 0x3080, 0x3100, 0x3180, 0x3200, 0x3280, 0x3300, 0x3380, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3480,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500,
+    0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3500, 0x3580, 0x3600, 0x3680, 0x3700,
+    0x3780, 0x3800, 0x3880, 0x3900, 0x3980, 0x3A00, 0x3A80, 0x3B00, 0x3B80, 0x3C00, 0x3C80, 0x3D00,
+    0x3D80, 0x3E00, 0x3E80, 0x3F00, 0x3F80, 0x4000, 0x4080, 0x4100, 0x4180, 0x4180, 0x4180, 0x4180,
+    0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180,
+    0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180,
+    0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180,
+    0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180,
+    0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180,
+    0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180,
+    0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4180, 0x4200,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4300, 0x4380, 0x4400, 0x4480, 0x4500, 0x4580,
+    0x4600, 0x4680, 0x4700, 0x4780, 0x4800, 0x4880, 0x4900, 0x4980, 0x4A00, 0x4A80, 0x4B00, 0x4B80,
+    0x4280, 0x4C00, 0x4C80, 0x4D00, 0x4D80, 0x4E00, 0x4E80, 0x4280, 0x4F00, 0x4F80, 0x5000, 0x4280,
+    0x5080, 0x5100, 0x5180, 0x5200, 0x5280, 0x5300, 0x5380, 0x5400, 0x5480, 0x5500, 0x5580, 0x4280,
+    0x5600, 0x5680, 0x5700, 0x5780, 0x5800, 0x5880, 0x5900, 0x5980, 0x5A00, 0x5A80, 0x5B00, 0x4280,
+    0x5B80, 0x5C00, 0x4280, 0x5C80, 0x5D00, 0x5D80, 0x5E00, 0x4280, 0x5E80, 0x5F00, 0x5F80, 0x6000,
+    0x6080, 0x6100, 0x4280, 0x4280, 0x6180, 0x6200, 0x6280, 0x6300, 0x4280, 0x6380, 0x4280, 0x6400,
+    0x6480, 0x6500, 0x6580, 0x6600, 0x6680, 0x6700, 0x6780, 0x6800, 0x6880, 0x6900, 0x6980, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x6A00, 0x6A80, 0x6B00, 0x6B80,
+    0x6C00, 0x6C80, 0x6D00, 0x6D80, 0x6E00, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x6E80, 0x6F00, 0x6F80, 0x7000, 0x7080, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x7100, 0x7180, 0x7200, 0x7280, 0x7300, 0x7380, 0x7400, 0x7480, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x7500, 0x7580, 0x7600, 0x7680, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700,
+    0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700,
+    0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700,
+    0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700,
+    0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7700, 0x7780, 0x7780,
+    0x7780, 0x7780, 0x7700, 0x7800, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x7880, 0x7900, 0x7980, 0x7A00, 0x7A00, 0x7A00, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x7A80, 0x7B00, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x7B80, 0x7C00, 0x7C80, 0x7D00, 0x7D80, 0x7E00, 0x7E80, 0x4280,
+    0x7F00, 0x7F80, 0x8000, 0x8080, 0x8100, 0x8180, 0x8200, 0x8280, 0x8300, 0x8380, 0x8400, 0x8480,
+    0x8500, 0x8580, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x8600, 0x4280, 0x8680, 0x4280, 0x4280, 0x8700, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x8780, 0x8800, 0x8880, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x8900, 0x8980, 0x8A00, 0x4280, 0x8A80, 0x8B00, 0x4280, 0x4280, 0x8B80, 0x8C00, 0x8C80, 0x8D00,
+    0x8D80, 0x4280, 0x8E00, 0x8E80, 0x8F00, 0x8F80, 0x9000, 0x9080, 0x9100, 0x9180, 0x9200, 0x9280,
+    0x9300, 0x9380, 0x9400, 0x9480, 0x9500, 0x9580, 0x9600, 0x9680, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x9700, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x9780, 0x3400,
+    0x9800, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x9880, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x9900, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x9980, 0x9A00, 0x9A80, 0x9B00,
+    0x9B80, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400, 0x3400,
+    0x3400, 0x3400, 0x9C00, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280, 0x4280,
+    0x4280, 0x4280, 0x4280, 0x4280, 0x9C80, 0x4280, 0x9D00, 0x9D80
+};
+
+static const uint32 collationData[40448] =
+{
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40804402, 0x40808402, 0x4080C402, 0x40810402, 0x40814402, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40824402, 0x4099C402, 0x40C74402, 0x40EB0402, 0x47D90402, 0x40EB4402, 0x40EA4402, 0x40C58402,
+    0x40CA0402, 0x40CA4402, 0x40E84402, 0x41998402, 0x4088C402, 0x40834402, 0x409F8402, 0x40E98402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x40900402, 0x408E8402, 0x419A8402, 0x419AC402, 0x419B0402, 0x409B4402,
+    0x40E80402, 0x47E88408, 0x47EF0408, 0x47F58408, 0x47FAC408, 0x4801C408, 0x48108408, 0x48144408,
+    0x481D4408, 0x48240408, 0x482AC408, 0x48310408, 0xC0000003, 0x48424408, 0x48460408, 0x484F0408,
+    0x485AC408, 0x48600408, 0x4864C408, 0x48748408, 0x487DC408, 0x4885C408, 0x4891C408, 0x48964408,
+    0x48990408, 0x489C0408, 0x48A18408, 0x40CA8402, 0x40E9C402, 0x40CAC402, 0x412DC402, 0x4082C402,
+    0x412D0402, 0x47E88402, 0x47EF0402, 0x47F58402, 0x47FAC402, 0x4801C402, 0x48108402, 0x48144402,
+    0x481D4402, 0x48240402, 0x482AC402, 0x48310402, 0xC00000C3, 0x48424402, 0x48460402, 0x484F0402,
+    0x485AC402, 0x48600402, 0x4864C402, 0x48748402, 0x487DC402, 0x4885C402, 0x4891C402, 0x48964402,
+    0x48990402, 0x489C0402, 0x48A18402, 0x40CB0402, 0x419B8402, 0x40CB4402, 0x419C0402, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40818402, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x4082441B, 0x409A0402, 0x47D8C402, 0x47D94402, 0x47D88402, 0x47D98402, 0x419BC402, 0x40E68402,
+    0x412EC402, 0x41748402, 0x47E88414, 0x40C98402, 0x419B4402, 0x40000000, 0x41750402, 0x412E0402,
+    0x414A8402, 0x4199C402, 0x47E68414, 0x47E6C414, 0x412D4402, 0x48CC0404, 0x40E70402, 0x40A4C402,
+    0x412F8402, 0x47E64414, 0x484F0414, 0x40C9C402, 0x8000DB83, 0x8000DBE3, 0x8000DC43, 0x409B8402,
+    0x8000DCA2, 0x8000DCE2, 0x8000DD22, 0x8000DD62, 0x8000DDA2, 0x8000DDE2, 0x8000DE23, 0x8000DE82,
+    0x8000DEC2, 0x8000DF02, 0x8000DF42, 0x8000DF82, 0x8000DFC2, 0x8000E002, 0x8000E042, 0x8000E082,
+    0x8000E0C2, 0x8000E102, 0x8000E142, 0x8000E182, 0x8000E1C2, 0x8000E202, 0x8000E242, 0x419A4402,
+    0x8000E282, 0x8000E2C2, 0x8000E302, 0x8000E342, 0x8000E382, 0x8000E3C2, 0x48AD4408, 0x8000E403,
+    0x8000E462, 0x8000E4A2, 0x8000E4E2, 0x8000E522, 0x8000E562, 0x8000E5A2, 0x8000E5E3, 0x8000E642,
+    0x8000E682, 0x8000E6C2, 0x8000E702, 0x8000E742, 0x8000E782, 0x8000E7C2, 0x8000E802, 0x8000E842,
+    0x8000E882, 0x8000E8C2, 0x8000E902, 0x8000E942, 0x8000E982, 0x8000E9C2, 0x8000EA02, 0x419A0402,
+    0x8000EA42, 0x8000EA82, 0x8000EAC2, 0x8000EB02, 0x8000EB42, 0x8000EB82, 0x48AD4402, 0x8000EBC2,
+    0x8000EC02, 0x8000EC42, 0x8000EC82, 0x8000ECC2, 0x8000ED02, 0x8000ED42, 0x8000ED82, 0x8000EDC2,
+    0x8000EE02, 0x8000EE42, 0x8000EE82, 0x8000EEC2, 0x8000EF02, 0x8000EF42, 0x8000EF82, 0x8000EFC2,
+    0x8000F002, 0x8000F042, 0x8000F082, 0x8000F0C2, 0x8000F102, 0x8000F142, 0x8000F182, 0x8000F1C2,
+    0x8000F202, 0x8000F242, 0x8000F282, 0x8000F2C2, 0x8000F302, 0x8000F342, 0x8000F382, 0x8000F3C2,
+    0x8000F402, 0x8000F442, 0x8000F482, 0x8000F4C2, 0x8000F502, 0x8000F542, 0x8000F582, 0x8000F5C2,
+    0x8000F602, 0x8000F642, 0x8000F682, 0x8000F6C2, 0x8000F702, 0x8000F742, 0x8000F782, 0x8000F7C2,
+    0x8000F802, 0x48250402, 0x8000F842, 0x8000F882, 0x8000F8C2, 0x8000F902, 0x8000F942, 0x8000F982,
+    0x4863C402, 0x8000F9C2, 0x8000FA02, 0x8000FA42, 0x8000FA82, 0x8000FAC2, 0x8000FB02, 0x80000002,
+    0x80000042, 0x8000FB42, 0x8000FB82, 0x8000FBC2, 0x8000FC02, 0x8000FC42, 0x8000FC82, 0x8000FCC2,
+    0x8000FD02, 0x8000FD42, 0x484DC408, 0x484DC402, 0x8000FD82, 0x8000FDC2, 0x8000FE02, 0x8000FE42,
+    0x8000FE82, 0x8000FEC2, 0x8000FF03, 0x8000FF63, 0x8000FFC2, 0x80010002, 0x80010042, 0x80010082,
+    0x800100C2, 0x80010102, 0x80010142, 0x80010182, 0x800101C2, 0x80010202, 0x80010242, 0x80010282,
+    0x800102C2, 0x80010302, 0x80010342, 0x80010382, 0x800103C2, 0x80010402, 0x487F0408, 0x487F0402,
+    0x80010442, 0x80010482, 0x800104C2, 0x80010502, 0x80010542, 0x80010582, 0x800105C2, 0x80010602,
+    0x80010642, 0x80010682, 0x800106C2, 0x80010702, 0x80010742, 0x80010782, 0x800107C2, 0x80010802,
+    0x80010842, 0x80010882, 0x800108C2, 0x80010902, 0x80010942, 0x80010982, 0x800109C2, 0x80010A02,
+    0x47F10402, 0x47F34408, 0x47F44408, 0x47F44402, 0x48B58408, 0x48B58402, 0x4853C408, 0x47F84408,
+    0x47F84402, 0x47FD0408, 0x47FE0408, 0x47FF4408, 0x47FF4402, 0x80010A42, 0x48054408, 0x48068408,
+    0x4807C408, 0x4812C408, 0x4812C402, 0x4818C408, 0x481B4408, 0x481F4402, 0x48298408, 0x4827C408,
+    0x48328408, 0x48328402, 0x48384402, 0x48404402, 0x488E0408, 0x4848C408, 0x4849C402, 0x48570408,
+    0x80010A82, 0x80010AC2, 0x481C4408, 0x481C4402, 0x485D0408, 0x485D0402, 0x48660408, 0x48B38408,
+    0x48B38402, 0x48790408, 0x487A8402, 0x48808402, 0x48818408, 0x48818402, 0x48828408, 0x80010B02,
+    0x80010B42, 0x48908408, 0x48938408, 0x489F0408, 0x489F0402, 0x48A2C408, 0x48A2C402, 0x48A8C408,
+    0x48AA0408, 0x48AA0402, 0x48AB4402, 0x48B1C402, 0x48B48408, 0x48B48402, 0x80010B82, 0x48AEC402,
+    0x48BF8402, 0x48C08402, 0x48C18402, 0x48C28402, 0x80010BC3, 0x80010C23, 0x80010C83, 0x80010CE2,
+    0x80010D22, 0x80010D62, 0x80010DA2, 0x80010DE2, 0x80010E22, 0x80010E62, 0x80010EA2, 0x80010EE2,
+    0x80010F22, 0x80010F62, 0x80010FA2, 0x80010FE2, 0x80011022, 0x80011063, 0x800110C3, 0x80011123,
+    0x80011183, 0x800111E3, 0x80011243, 0x800112A3, 0x80011303, 0x48054402, 0x80011363, 0x800113C3,
+    0x80011423, 0x80011483, 0x800114E4, 0x80011564, 0x48178408, 0x48178402, 0x800115E2, 0x80011622,
+    0x80011662, 0x800116A2, 0x800116E2, 0x80011722, 0x80011763, 0x800117C3, 0x80011822, 0x80011862,
+    0x800118A2, 0x800118E2, 0x80011922, 0x80011962, 0x800119A2, 0x800119E2, 0x481F4408, 0x48AEC408,
+    0x80011A22, 0x80011A62, 0x80011AA3, 0x80011B03, 0x80011B64, 0x80011BE4, 0x80011C63, 0x80011CC3,
+    0x80011D22, 0x80011D62, 0x80011DA2, 0x80011DE2, 0x80011E22, 0x80011E62, 0x80011EA2, 0x80011EE2,
+    0x80011F22, 0x80011F62, 0x80011FA2, 0x80011FE2, 0x80012022, 0x80012062, 0x800120A2, 0x800120E2,
+    0x80012122, 0x80012162, 0x800121A2, 0x800121E2, 0x80012222, 0x80012262, 0x800122A2, 0x800122E2,
+    0x80012322, 0x80012362, 0x800123A2, 0x800123E2, 0x48A08408, 0x48A08402, 0x80012422, 0x80012462,
+    0x4849C408, 0x48004402, 0x48598408, 0x48598402, 0x48A44408, 0x48A44402, 0x800124A2, 0x800124E2,
+    0x80012522, 0x80012562, 0x800125A3, 0x80012603, 0x80012663, 0x800126C3, 0x80012722, 0x80012762,
+    0x800127A3, 0x80012803, 0x80012862, 0x800128A2, 0x483DC402, 0x484C4402, 0x48838402, 0x482BC402,
+    0x800128E2, 0x80012922, 0x47E9C408, 0x47F6C408, 0x47F6C402, 0x48384408, 0x48800408, 0x48778402,
+    0x48A74402, 0x48B78408, 0x48B78402, 0x47F10408, 0x48888408, 0x48954408, 0x48038408, 0x48038402,
+    0x482D0408, 0x482D0402, 0x4862C408, 0x4862C402, 0x4867C408, 0x4867C402, 0x489E0408, 0x489E0402,
+    0x47EB4402, 0x47EC4402, 0x47EDC402, 0x47F34402, 0x4853C402, 0x47F94402, 0x47FD0402, 0x47FE0402,
+    0x48090402, 0x48068402, 0x480A0402, 0x4807C402, 0x480B0402, 0x480C8402, 0x480D8402, 0x482F0402,
+    0x4818C402, 0x48154402, 0x48168402, 0x481B4402, 0x480F8402, 0x488B0402, 0x48208402, 0x48228402,
+    0x4827C402, 0x48298402, 0x48260402, 0x48398402, 0x483B0402, 0x483C8402, 0x483F0402, 0x488E0402,
+    0x488F8402, 0x48440402, 0x4848C402, 0x484B4402, 0x48470402, 0x48570402, 0x4850C402, 0x48584402,
+    0x485EC402, 0x48690402, 0x486A4402, 0x486B8402, 0x486CC402, 0x486DC402, 0x486F0402, 0x48704402,
+    0x48660402, 0x48728402, 0x48768402, 0x48790402, 0x48300402, 0x487B8402, 0x487CC402, 0x4884C402,
+    0x48828402, 0x48888402, 0x48908402, 0x48938402, 0x48954402, 0x48980402, 0x48414402, 0x489D0402,
+    0x48A54402, 0x48A64402, 0x48A8C402, 0x48AC4402, 0x48B68402, 0x48BA4402, 0x48BE8402, 0x48C38402,
+    0x48C48402, 0x47F00402, 0x480E8402, 0x4819C402, 0x481E4402, 0x482E0402, 0x48348402, 0x48368402,
+    0x4861C402, 0x48BC8402, 0x48BD8402, 0x80011962, 0x80012962, 0x800129A2, 0x80010B82, 0x800129E2,
+    0x80012A22, 0x80012A62, 0x80012AA2, 0x80012AE2, 0x48C58402, 0x48C68402, 0x488C0402, 0x488D0402,
+    0x481D4414, 0x48208414, 0x482AC414, 0x4864C414, 0x48690414, 0x486B8414, 0x48728414, 0x48964414,
+    0x489C0414, 0x41314402, 0x4131C402, 0x48238402, 0x48B8C402, 0x4823C402, 0x48B94402, 0x48BB4402,
+    0x48B88402, 0x48BB8402, 0x41320402, 0x41324402, 0x41328402, 0x4132C402, 0x41330402, 0x41334402,
+    0x41338402, 0x4133C402, 0x41340402, 0x41344402, 0x41348402, 0x4134C402, 0x41350402, 0x41354402,
+    0x47D18402, 0x47D1C402, 0x41358402, 0x4135C402, 0x41360402, 0x41364402, 0x41370402, 0x41374402,
+    0x412E4402, 0x412E8402, 0x412F0402, 0x412FC402, 0x412D8402, 0x412F4402, 0x41378402, 0x4137C402,
+    0x481B4414, 0x48358414, 0x48748414, 0x48990414, 0x48BA4414, 0x41380402, 0x41384402, 0x41388402,
+    0x4138C402, 0x41390402, 0x41394402, 0x41398402, 0x4139C402, 0x413A0402, 0x48B90402, 0x413A4402,
+    0x413A8402, 0x413AC402, 0x413B0402, 0x413B4402, 0x413B8402, 0x413BC402, 0x413C0402, 0x413C4402,
+    0x413C8402, 0x413CC402, 0x413D0402, 0x413D4402, 0x413D8402, 0x413DC402, 0x413E0402, 0x413E4402,
+    0x400004A2, 0x40000482, 0x400004E2, 0x400005A2, 0x40000642, 0x40000742, 0x400004C2, 0x400005C2,
+    0x40000562, 0x40000762, 0x40000522, 0x40000582, 0x40000502, 0x40000662, 0x40000662, 0x40000782,
+    0x400007A2, 0x400007C2, 0x40000662, 0x40000442, 0x40000462, 0x40000662, 0x40000682, 0x40000682,
+    0x40000682, 0x40000682, 0x40000662, 0x400007E2, 0x40000682, 0x40000682, 0x40000682, 0x40000682,
+    0x40000682, 0x40000802, 0x40000822, 0x40000842, 0x40000862, 0x40000882, 0x400008A2, 0x40000602,
+    0x40000622, 0x40000682, 0x40000682, 0x40000682, 0x40000682, 0x400008C2, 0x400008E2, 0x40000682,
+    0x40000902, 0x40000922, 0x40000422, 0x40000682, 0x40000942, 0x40000722, 0x400006A2, 0x400006A2,
+    0x400005E2, 0x40000962, 0x40000682, 0x40000682, 0x40000682, 0x40000662, 0x40000662, 0x40000662,
+    0x400004A2, 0x40000482, 0x40000542, 0x40000442, 0x80012B22, 0x40000982, 0x40000662, 0x40000682,
+    0x40000682, 0x40000682, 0x40000662, 0x40000662, 0x40000662, 0x40000682, 0x40000682, 0x40000000,
+    0x40000662, 0x40000662, 0x40000662, 0x40000682, 0x40000682, 0x40000682, 0x40000682, 0x40000662,
+    0x400009A2, 0x40000682, 0x40000682, 0x40000662, 0x40000682, 0x40000662, 0x40000662, 0x40000682,
+    0x400009C2, 0x400009E2, 0x40000682, 0x47E88404, 0x4801C404, 0x48240404, 0x484F0404, 0x4885C404,
+    0x47F58404, 0x47FAC404, 0x481D4404, 0x48424404, 0x4864C404, 0x487DC404, 0x4891C404, 0x48990404,
+    0x48CA0408, 0x48CA0402, 0x48D24408, 0x48D24402, 0x41314402, 0x41318402, 0x48C94408, 0x48C94402,
+    0x00000000, 0x00000000, 0x48CAC404, 0x48CF8402, 0x48CF4402, 0x48CFC402, 0x408E8402, 0x48CB0408,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x412D4402, 0x80012B62, 0x80012BA2, 0x40A4C402,
+    0x80012BE2, 0x80012C22, 0x80012C62, 0x00000000, 0x80012CA2, 0x00000000, 0x80012CE2, 0x80012D22,
+    0x80012D63, 0x48C78408, 0x48C7C408, 0x48C80408, 0x48C88408, 0x48C8C408, 0x48C9C408, 0x48CA4408,
+    0x48CA8408, 0x48CAC408, 0x48CB4408, 0x48CB8408, 0x48CC0408, 0x48CC4408, 0x48CC8408, 0x48CCC408,
+    0x48CD0408, 0x48CE4408, 0x00000000, 0x48CF0408, 0x48D00408, 0x48D04408, 0x48D08408, 0x48D0C408,
+    0x48D10408, 0x48D18408, 0x80012DC2, 0x80012E02, 0x80012E42, 0x80012E82, 0x80012EC2, 0x80012F02,
+    0x80012F43, 0x48C78402, 0x48C7C402, 0x48C80402, 0x48C88402, 0x48C8C402, 0x48C9C402, 0x48CA4402,
+    0x48CA8402, 0x48CAC402, 0x48CB4402, 0x48CB8402, 0x48CC0402, 0x48CC4402, 0x48CC8402, 0x48CCC402,
+    0x48CD0402, 0x48CE4402, 0x48CF0419, 0x48CF0402, 0x48D00402, 0x48D04402, 0x48D08402, 0x48D0C402,
+    0x48D10402, 0x48D18402, 0x80012FA2, 0x80012FE2, 0x80013022, 0x80013062, 0x800130A2, 0x800130E3,
+    0x48C7C404, 0x48CA8404, 0x48D0440A, 0x80013142, 0x80013182, 0x48D08404, 0x48CD0404, 0x800131C3,
+    0x48CE0408, 0x48CE0402, 0x48C98408, 0x48C98402, 0x48C90408, 0x48C90402, 0x48CDC408, 0x48CDC402,
+    0x48D20408, 0x48D20402, 0x48DA8408, 0x48DA8402, 0x48DBC408, 0x48DBC402, 0x48DC0408, 0x48DC0402,
+    0x48DCC408, 0x48DCC402, 0x48DE8408, 0x48DE8402, 0x48DF4408, 0x48DF4402, 0x48E04408, 0x48E04402,
+    0x48CB4404, 0x48CE4404, 0x48CF0404, 0x48CB0402, 0x48CA840A, 0x48C8C404, 0x41984402, 0x48D28408,
+    0x48D28402, 0x48CF040A, 0x48CD8408, 0x48CD8402, 0x48CEC402, 0x48CF8408, 0x48CF4408, 0x48CFC408,
+    0x80013222, 0x80013262, 0x48ED4408, 0x800132A2, 0x48F0C408, 0x48F64408, 0x48FB4408, 0x800132E2,
+    0x48FD8408, 0x49084408, 0x4911C408, 0x491F8408, 0x80013322, 0x80013362, 0x800133A2, 0x49390408,
+    0x48E1C408, 0x48E4C408, 0x48E5C408, 0x48E6C408, 0x48EBC408, 0x48EFC408, 0x48F1C408, 0x48F44408,
+    0xC0000182, 0x48FC8408, 0x48FEC408, 0x49054408, 0x490A0408, 0x490C4408, 0x49130408, 0x49150408,
+    0x49184408, 0x491A8408, 0x491CC408, 0x49208408, 0x4924C408, 0x4925C408, 0x492F8408, 0x49324408,
+    0x493A0408, 0x493B4408, 0x493D0408, 0x493E4408, 0x493F4408, 0x49428408, 0x49438408, 0x49450408,
+    0x48E1C402, 0x48E4C402, 0x48E5C402, 0x48E6C402, 0x48EBC402, 0x48EFC402, 0x48F1C402, 0x48F44402,
+    0xC0000202, 0x48FC8402, 0x48FEC402, 0x49054402, 0x490A0402, 0x490C4402, 0x49130402, 0x49150402,
+    0x49184402, 0x491A8402, 0x491CC402, 0x49208402, 0x4924C402, 0x4925C402, 0x492F8402, 0x49324402,
+    0x493A0402, 0x493B4402, 0x493D0402, 0x493E4402, 0x493F4402, 0x49428402, 0x49438402, 0x49450402,
+    0x800133E2, 0x80013422, 0x48ED4402, 0x80013462, 0x48F0C402, 0x48F64402, 0x48FB4402, 0x800134A2,
+    0x48FD8402, 0x49084402, 0x4911C402, 0x491F8402, 0x800134E2, 0x80013522, 0x80013562, 0x49390402,
+    0x492B4408, 0x492B4402, 0x49414408, 0x49414402, 0x49464408, 0x49464402, 0x49474408, 0x49474402,
+    0x4949C408, 0x4949C402, 0x49488408, 0x49488402, 0x494B0408, 0x494B0402, 0x494C0408, 0x494C0402,
+    0x494D0408, 0x494D0402, 0x494E0408, 0x494E0402, 0x494F0408, 0x494F0402, 0x800135A2, 0x800135E2,
+    0x4923C408, 0x4923C402, 0x492E8408, 0x492E8402, 0x492D8408, 0x492D8402, 0x492C4408, 0x492C4402,
+    0x49174408, 0x49174402, 0x414AC402, 0x40000A02, 0x40000662, 0x40000462, 0x40000442, 0x40000662,
+    0x40000000, 0x40000000, 0x48FA4408, 0x48FA4402, 0x49404408, 0x49404402, 0x49194408, 0x49194402,
+    0x80013622, 0x80013662, 0x48E7C408, 0x48E7C402, 0x48E9C408, 0x48E9C402, 0x48F34408, 0x48F34402,
+    0x48EEC408, 0x48EEC402, 0x48FFC408, 0x48FFC402, 0x4903C408, 0x4903C402, 0x4902C408, 0x4902C402,
+    0x4901C408, 0x4901C402, 0x490E8408, 0x490E8402, 0x4910C408, 0x4910C402, 0x49164408, 0x49164402,
+    0x49504408, 0x49504402, 0x491BC408, 0x491BC402, 0x491E4408, 0x491E4402, 0x49218408, 0x49218402,
+    0x49228408, 0x49228402, 0x4928C408, 0x4928C402, 0x49310408, 0x49310402, 0x4933C408, 0x4933C402,
+    0x4935C408, 0x4935C402, 0x4929C408, 0x4929C402, 0x49370408, 0x49370402, 0x49380408, 0x49380402,
+    0x49518408, 0x800136A2, 0x800136E2, 0x4900C408, 0x4900C402, 0x49068408, 0x49068402, 0x490F8408,
+    0x490F8402, 0x490D8408, 0x490D8402, 0x4934C408, 0x4934C402, 0x490B0408, 0x490B0402, 0x49518402,
+    0x80013722, 0x80013762, 0x800137A2, 0x800137E2, 0x48E3C408, 0x48E3C402, 0x80013822, 0x80013862,
+    0x48E2C408, 0x48E2C402, 0x800138A2, 0x800138E2, 0x80013922, 0x80013962, 0x800139A2, 0x800139E2,
+    0x48F78408, 0x48F78402, 0x80013A22, 0x80013A62, 0x80013AA2, 0x80013AE2, 0x80013B22, 0x80013B62,
+    0x49140408, 0x49140402, 0x80013BA2, 0x80013BE2, 0x80013C22, 0x80013C62, 0x80013CA2, 0x80013CE2,
+    0x80013D22, 0x80013D62, 0x80013DA2, 0x80013DE2, 0x80013E22, 0x80013E62, 0x48EAC408, 0x48EAC402,
+    0x80013EA2, 0x80013EE2, 0x48E8C408, 0x48E8C402, 0x4926C408, 0x4926C402, 0x4927C408, 0x4927C402,
+    0x48ECC408, 0x48ECC402, 0x48EE8408, 0x48EE8402, 0x48F58408, 0x48F58402, 0x48F8C408, 0x48F8C402,
+    0x49098408, 0x49098402, 0x4912C408, 0x4912C402, 0x491B8408, 0x491B8402, 0x491E0408, 0x491E0402,
+    0x48F5C408, 0x48F5C402, 0x4907C408, 0x4907C402, 0x4909C408, 0x4909C402, 0x491A4408, 0x491A4402,
+    0x49460408, 0x49460402, 0x49050408, 0x49050402, 0x49514408, 0x49514402, 0x4904C408, 0x4904C402,
+    0x49080408, 0x49080402, 0x49108408, 0x49108402, 0x49160408, 0x49160402, 0x492AC408, 0x492AC402,
+    0x490D4408, 0x490D4402, 0x48F2C408, 0x48F2C402, 0x49334408, 0x49334402, 0x49078408, 0x49078402,
+    0x00000000, 0x497D4408, 0x497DC408, 0x497E0408, 0x497E4408, 0x497E8408, 0x497EC408, 0x497F0408,
+    0x497F4408, 0x497F8408, 0x497FC408, 0x49800408, 0x49804408, 0x49808408, 0x4980C408, 0x49810408,
+    0x49814408, 0x49818408, 0x4981C408, 0x49820408, 0x49824408, 0x49828408, 0x49830408, 0x49834408,
+    0x49838408, 0x4983C408, 0x49840408, 0x49844408, 0x49848408, 0x4984C408, 0x49850408, 0x49854408,
+    0x49858408, 0x4985C408, 0x49860408, 0x49864408, 0x49868408, 0x4986C408, 0x49870408, 0x00000000,
+    0x00000000, 0x49874402, 0x40F90402, 0x40F94402, 0x409A4402, 0x408A8402, 0x409C0402, 0x40F98402,
+    0x497D8402, 0x497D4402, 0x497DC402, 0x497E0402, 0x497E4402, 0x497E8402, 0x497EC402, 0x497F0402,
+    0x497F4402, 0x497F8402, 0x497FC402, 0x49800402, 0x49804402, 0x49808402, 0x4980C402, 0x49810402,
+    0x49814402, 0x49818402, 0x4981C402, 0x49820402, 0x49824402, 0x49828402, 0x49830402, 0x49834402,
+    0x49838402, 0x4983C402, 0x49840402, 0x49844402, 0x49848402, 0x4984C402, 0x49850402, 0x49854402,
+    0x49858402, 0x4985C402, 0x49860402, 0x49864402, 0x49868402, 0x4986C402, 0x49870402, 0x80013F22,
+    0x4982C402, 0x40904402, 0x40838402, 0x00000000, 0x00000000, 0x414B0402, 0x414B4402, 0x47D9C402,
+    0x00000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000A42, 0x40000A62, 0x40000A82, 0x40000AA2, 0x40000AC2, 0x40000AE2, 0x40000B02, 0x40000B22,
+    0x40000B42, 0x40000B62, 0x40000B62, 0x40000B82, 0x40000BE2, 0x40000000, 0x40F9C402, 0x40000C02,
+    0x40FA0402, 0x40000BC2, 0x40000BA2, 0x40FA4402, 0x40000000, 0x40000000, 0x40FA8402, 0x40000B42,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x49878402, 0x4987C402, 0x49880402, 0x49884402, 0x49888402, 0x4988C402, 0x49890402, 0x49894402,
+    0x49898402, 0x4989C402, 0x498A0419, 0x498A0402, 0x498A4402, 0x498A8419, 0x498A8402, 0x498AC419,
+    0x498AC402, 0x498B0402, 0x498B4402, 0x498B8419, 0x498B8402, 0x498BC419, 0x498BC402, 0x498C0402,
+    0x498C4402, 0x498C8402, 0x498CC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80013F64,
+    0x80013FE2, 0x80014022, 0x80014062, 0x40FAC402, 0x40FB0402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x419F4402, 0x419FC402,
+    0x414B8402, 0x40EC0402, 0x40EC8402, 0x47DA0402, 0x408AC402, 0x408B0402, 0x414C4402, 0x414C8402,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x408EC402, 0x40000000, 0x00000000, 0x40908402, 0x409C4402,
+    0x49D00402, 0x49990402, 0x49994402, 0x49998402, 0x499A4402, 0x499A8402, 0x499B8402, 0xC0000284,
+    0x499D0402, 0x49A10402, 0x49A14402, 0x49A18402, 0x49A3C402, 0x49A64402, 0x49A68402, 0x49A90402,
+    0x49A94402, 0x49ACC402, 0x49AD0402, 0x49B18402, 0x49B1C402, 0x49B44402, 0x49B48402, 0x49B5C402,
+    0x49B60402, 0x49B6C402, 0x49B70402, 0x49C1C402, 0x49C20402, 0x49CF4402, 0x49CF8402, 0x49CFC402,
+    0x40000000, 0x49B90402, 0x49BC0402, 0x49BD8402, 0x49C30402, 0x49C50402, 0x49C60402, 0x49C88402,
+    0xC0000382, 0x49CD8402, 0xC0000402, 0x40000DA2, 0x40000E02, 0x40000E62, 0x40000EC2, 0x40000F42,
+    0x40000FA2, 0x40001002, 0x40001022, 0x40001042, 0x40001062, 0x40001082, 0x400010C2, 0x400010E2,
+    0x40001102, 0x40001142, 0x40001162, 0x40001182, 0x400011A2, 0x400011C2, 0x400011E2, 0x400010A2,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x40EB8402, 0x408B4402, 0x408B8402, 0x40E90402, 0x499CC402, 0x49BBC402,
+    0x40001302, 0x499A0402, 0x4999C402, 0x499AC402, 0x49990404, 0x800140A2, 0x800140E2, 0x80014122,
+    0x80014162, 0x49A1C402, 0x49A20402, 0x499D4402, 0x49A24402, 0x49A28402, 0x499D8402, 0x49A2C402,
+    0x499DC402, 0x49A6C402, 0x49A70402, 0x49A40402, 0x49A44402, 0x49A74402, 0x49A48402, 0x49A50402,
+    0x49A98402, 0x49A9C402, 0x49AA0402, 0x49AA4402, 0x49AA8402, 0x49AAC402, 0x49AB4402, 0x49AB8402,
+    0x49ABC402, 0x49AD4402, 0x49AD8402, 0x49ADC402, 0x49AE0402, 0x49AE4402, 0x49AE8402, 0x49AEC402,
+    0x49AF0402, 0x49AF4402, 0x49B20402, 0x49B24402, 0x49B28402, 0x49B4C402, 0x49B54402, 0x49B64402,
+    0x49B74402, 0x49B94402, 0x49B98402, 0x49BA0402, 0x49BA4402, 0x49BAC402, 0x49BB0402, 0x49BC4402,
+    0x49BCC402, 0x49BDC402, 0x49BE0402, 0x49BE4402, 0x49BE8402, 0x49BF0402, 0x49BF4402, 0x49BFC402,
+    0x49C04402, 0x49C08402, 0x49C0C402, 0x49C10402, 0x49C14402, 0x49C34402, 0x49C38402, 0x49C3C402,
+    0x49C40402, 0x49C78402, 0x49C64402, 0x49C6C402, 0x49C70402, 0x49C74402, 0x49C8C402, 0x49A4C402,
+    0x800141A2, 0x49C90402, 0x800141E2, 0x49C94402, 0x49CA4402, 0x49CA8402, 0x49CAC402, 0x49CB0402,
+    0x49CB4402, 0x49CB8402, 0x49CBC402, 0x49CC0402, 0x49CE0402, 0x49CE4402, 0x49CE8402, 0x49CC8402,
+    0x49CEC402, 0x49CF0402, 0x49D14402, 0x80014222, 0x40A00402, 0x49C9C402, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x414CC402, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x49CA0404, 0x49CDC404, 0x40000000,
+    0x40000000, 0x414D0402, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x49AC0402, 0x49AF8402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x49B2C402, 0x49B58402, 0x49B7C402, 0x80014262, 0x800142A2, 0x49C98402,
+    0x40B34402, 0x40A04402, 0x40A08402, 0x4090C402, 0x40910402, 0x40914402, 0x40918402, 0x4091C402,
+    0x40920402, 0x409C8402, 0x40FB4402, 0x40FB8402, 0x40FBC402, 0x40FC0402, 0x00000000, 0x40000000,
+    0x49D20402, 0x40001322, 0x49D24402, 0x49D28402, 0x800142E2, 0x49D30402, 0x49D2C402, 0x49D34402,
+    0x49D38402, 0x49D3C402, 0x49D44402, 0x49D48402, 0x80014322, 0x49D4C402, 0x49D50402, 0x49D54402,
+    0x49D5C402, 0x49D60402, 0x49D64402, 0x49D68402, 0x49D68419, 0x49D6C402, 0x49D70402, 0x80014362,
+    0x49D78402, 0x49D7C402, 0x49D80402, 0x49D84402, 0x49D88402, 0x800143A2, 0x800143E2, 0x80014422,
+    0x40001342, 0x40001362, 0x40001382, 0x400013A2, 0x400013C2, 0x400013E2, 0x40001402, 0x40001422,
+    0x40001442, 0x40001462, 0x40001482, 0x400014A2, 0x400014C2, 0x400014E2, 0x40001502, 0x40001522,
+    0x40000000, 0x40000662, 0x40000682, 0x40000000, 0x40000000, 0x40000662, 0x40000682, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x00000000, 0x00000000, 0x49D40402, 0x49D58402, 0x49D74402,
+    0x499E0402, 0x499E4402, 0x499E8402, 0x499EC402, 0x499F0402, 0x499F4402, 0x499FC402, 0x49A78402,
+    0x49A7C402, 0x49AC4402, 0x49AC8402, 0x49AFC402, 0x49B30402, 0x49B80402, 0x49B84402, 0x49B88402,
+    0x49BB4402, 0x49BB8402, 0x49C18402, 0x49C24402, 0x49C28402, 0x49C54402, 0x49C58402, 0x49C7C402,
+    0x49C80402, 0x49C84402, 0x49C44402, 0x49B00402, 0x49B04402, 0x49B34402, 0x49A80402, 0x49A84402,
+    0x49B38402, 0x49B08402, 0x49A88402, 0x499B0402, 0x499B4402, 0x49D04402, 0x49D08402, 0x49D0C402,
+    0x49CCC402, 0x49CD0402, 0x49D18402, 0x49D1C402, 0x49A8C402, 0x49B3C402, 0x49B40402, 0x49BEC402,
+    0x49E1C402, 0x49E28402, 0x49E2C402, 0x49E30402, 0x49E38402, 0x49E3C402, 0x49E40402, 0x49E44402,
+    0x49E50402, 0x49E58402, 0x49E5C402, 0x49E60402, 0x49E68402, 0x49E78402, 0x49E7C402, 0x49E84402,
+    0x49E88402, 0x49E98402, 0x49E9C402, 0x49EA0402, 0x49EA4402, 0x49EA8402, 0x49EAC402, 0x49EB0402,
+    0x49E6C402, 0x49E20402, 0x49E24402, 0x49E64402, 0x49E34402, 0x49E8C402, 0x49E90402, 0x49E94402,
+    0x49E70402, 0x49E74402, 0x49E48402, 0x49E4C402, 0x49E80402, 0x49E54402, 0x49EB8402, 0x49EBC402,
+    0x49EC0402, 0x49EC4402, 0x49EC8402, 0x49ECC402, 0x49ED0402, 0x49ED4402, 0x49ED8402, 0x49EDC402,
+    0x49EE0402, 0x49EB4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x49EE4402, 0x49EE8402, 0x49EEC402, 0x49EF0402, 0x49EF4402, 0x49EF8402,
+    0x49EFC402, 0x49F00402, 0x49F04402, 0x49F08402, 0x49F0C402, 0x49F10402, 0x49F14402, 0x49F18402,
+    0x49F1C402, 0x49F20402, 0x49F24402, 0x49F28402, 0x49F2C402, 0x49F30402, 0x49F34402, 0x49F38402,
+    0x49F3C402, 0x49F40402, 0x49F44402, 0x49F48402, 0x49F4C402, 0x49F50402, 0x49F54402, 0x49F58402,
+    0x80014462, 0x800144A2, 0x800144E2, 0x40001542, 0x40001562, 0x40001582, 0x400015A2, 0x400015C2,
+    0x400015E2, 0x40001602, 0x40001622, 0x40001642, 0x49F5C402, 0x49F60402, 0x41518402, 0x40B38402,
+    0x408BC402, 0x409A8402, 0x40000000, 0x00000000, 0x00000000, 0x40000682, 0x47DA4402, 0x47DA8402,
+    0x49928402, 0x4992C402, 0x49930402, 0x49934402, 0x49938402, 0x4993C402, 0x49940402, 0x49944402,
+    0x49948402, 0x4994C402, 0x49950402, 0x49954402, 0x49958402, 0x4995C402, 0x49960402, 0x49964402,
+    0x49968402, 0x4996C402, 0x49970402, 0x49974402, 0x49978402, 0x4997C402, 0x49980402, 0x49984402,
+    0x40000D42, 0x40000D62, 0x49988402, 0x4998C402, 0x40000C42, 0x40000C42, 0x40000C62, 0x40000C62,
+    0x40000C62, 0x40000C82, 0x40000C82, 0x40000C82, 0x40000CA2, 0x40000CA2, 0x40000CC2, 0x40000CC2,
+    0x40000CE2, 0x40000CE2, 0x40000CE2, 0x40000D02, 0x40000D22, 0x40000D82, 0x00000000, 0x00000000,
+    0x40924402, 0x40928402, 0x4092C402, 0x40930402, 0x40934402, 0x40938402, 0x4093C402, 0x40940402,
+    0x40944402, 0x40948402, 0x4094C402, 0x40950402, 0x40954402, 0x40958402, 0x4095C402, 0x00000000,
+    0x49DB8402, 0x49DBC402, 0x49DC0402, 0x49DC4402, 0x49DC8402, 0x49DCC402, 0x49DD0402, 0x49DD4402,
+    0x49DD8402, 0x49DDC402, 0x49DE0402, 0x49DE4402, 0x49DE8402, 0x49DEC402, 0x49DF0402, 0x49DF4402,
+    0x49DF8402, 0x49DFC402, 0x49E00402, 0x49E04402, 0x49E08402, 0x49E0C402, 0x49E10402, 0x49E14402,
+    0x49E18402, 0x40000682, 0x40000682, 0x40000682, 0x00000000, 0x00000000, 0x40FC4402, 0x00000000,
+    0x49D8C402, 0x49D90402, 0x49D94402, 0x49D98402, 0x49D9C402, 0x49DA0402, 0x49DA4402, 0x49DA8402,
+    0x49DAC402, 0x49DB0402, 0x49DB4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x499F8402, 0x49A04402, 0x49A54402, 0x49B68402, 0x49BA8402, 0x49BD4402, 0x49C48402, 0x49C5C402,
+    0x499BC402, 0x499C0402, 0x49B0C402, 0x49CD4402, 0x499C4402, 0x499C8404, 0x49AB0402, 0x49B50402,
+    0x49C00402, 0x49CC4402, 0x49B10402, 0x49B8C402, 0x49BF8402, 0x00000000, 0x49A08402, 0x49A0C402,
+    0x49A30402, 0x49B14402, 0x49D10402, 0x49B9C402, 0x49BC8402, 0x49C68402, 0x49A00402, 0x49A34402,
+    0x49A38402, 0x49A58402, 0x49C2C402, 0x49B78402, 0x49BD0402, 0x49A5C402, 0x49A60402, 0x49C4C402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40001202, 0x40000EE2, 0x40000F62, 0x40000FC2, 0x40000DE2,
+    0x40000E42, 0x40000EA2, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000DC2, 0x40000E22, 0x40000E82, 0x40000000, 0x40000F02, 0x40000F22, 0x40000FE2, 0x40001222,
+    0x40001242, 0x400012C2, 0x400012E2, 0x40001282, 0x400012A2, 0x40001262, 0x40000F82, 0x40001122,
+    0x40001862, 0x40001862, 0x40001882, 0x400018A2, 0x4A768402, 0x4A76C402, 0x4A770402, 0x4A788402,
+    0x4A78C402, 0x4A790402, 0x4A794402, 0x4A798402, 0x4A7A0402, 0x4A7A8402, 0x4A7AC402, 0x4A7B0402,
+    0x4A7B4402, 0x4A7BC402, 0x4A7C0402, 0x4A7C4402, 0x4A7C8402, 0x4A7CC402, 0x4A7D0402, 0x4A7D4402,
+    0x4A7DC402, 0x4A7E0402, 0x4A7E4402, 0x4A7E8402, 0x4A7EC402, 0x4A7F8402, 0x4A7FC402, 0x4A800402,
+    0x4A804402, 0x4A80C402, 0x4A814402, 0x4A818402, 0x4A81C402, 0x4A820402, 0x4A824402, 0x4A828402,
+    0x4A82C402, 0x80014522, 0x4A830402, 0x4A834402, 0x4A838402, 0x4A840402, 0x4A844402, 0x4A848402,
+    0x4A850402, 0x80014562, 0x4A854402, 0x4A858402, 0x800145A2, 0x4A85C402, 0x4A860402, 0x4A864402,
+    0x4A868402, 0x4A86C402, 0x4A890402, 0x4A894402, 0x40001842, 0x4A870402, 0x4A88C402, 0x4A8A4402,
+    0x4A8A8402, 0x4A8AC402, 0x4A8B0402, 0x4A8B4402, 0x4A8B8402, 0x4A8C4402, 0x4A8CC402, 0x4A8D0402,
+    0x4A8D8402, 0x4A8E0402, 0x4A8E4402, 0x4A8E8402, 0x4A8EC402, 0x4A8F0402, 0x4A8D4402, 0x4A898402,
+    0x4A75C402, 0x40000000, 0x40000000, 0x400004A2, 0x40000482, 0x4A8C8402, 0x4A89C402, 0x4A8A0402,
+    0x800145E2, 0x80014622, 0x80014662, 0x800146A2, 0x800146E2, 0x80014722, 0x80014762, 0x800147A2,
+    0x4A79C402, 0x4A7A4402, 0x4A8BC402, 0x4A8C0402, 0x40A58402, 0x40A5C402, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x41000402, 0x47D20402, 0x4A764402, 0x4A774402, 0x4A778402, 0x4A77C402, 0x4A780402, 0x4A784402,
+    0x4A808402, 0x4A7F0402, 0x4A84C402, 0x4A7D8402, 0x4A7F4402, 0x4A874402, 0x4A810402, 0x4A83C402,
+    0x4A8F4402, 0x40001862, 0x40001882, 0x400018A2, 0x00000000, 0x4A8F8402, 0x4A8FC402, 0x4A900402,
+    0x4A904402, 0x4A908402, 0x4A90C402, 0x4A910402, 0x4A918402, 0x00000000, 0x00000000, 0x4A920402,
+    0x4A924402, 0x00000000, 0x00000000, 0x4A928402, 0x4A92C402, 0x4A930402, 0x4A934402, 0x4A938402,
+    0x4A93C402, 0x4A940402, 0x4A944402, 0x4A948402, 0x4A94C402, 0x4A950402, 0x4A954402, 0x4A958402,
+    0x4A95C402, 0x4A960402, 0x4A964402, 0x4A968402, 0x4A96C402, 0x4A970402, 0x4A974402, 0x4A978402,
+    0x4A97C402, 0x00000000, 0x4A980402, 0x4A984402, 0x4A988402, 0x4A98C402, 0x4A990402, 0x4A994402,
+    0x4A998402, 0x00000000, 0x4A9A0402, 0x00000000, 0x00000000, 0x00000000, 0x4A9A8402, 0x4A9AC402,
+    0x4A9B0402, 0x4A9B4402, 0x00000000, 0x00000000, 0x40001842, 0x4A9B8402, 0x4A9BC402, 0x4A9C0402,
+    0x4A9C4402, 0x4A9C8402, 0x4A9CC402, 0x4A9D0402, 0x4A9D4402, 0x00000000, 0x00000000, 0xC0000483,
+    0x4A9E4402, 0x00000000, 0x00000000, 0x4A9E8402, 0x4A9EC402, 0x4A9F0402, 0x800147E2, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4A9F4402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80014822, 0x80014862, 0x00000000, 0x800148A2,
+    0x4A914402, 0x4A91C402, 0x4A9D8402, 0x4A9DC402, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x4A99C402, 0x4A9A4402, 0x47DAC402, 0x47DB0402, 0x47558402, 0x4755C402, 0x47560402, 0x47564402,
+    0x47568402, 0x4756C402, 0x4151C402, 0x47DB4402, 0x4A9F8402, 0x41014402, 0x400018C2, 0x00000000,
+    0x00000000, 0x40001862, 0x40001882, 0x400018A2, 0x00000000, 0x4AA10402, 0x4AA14402, 0x4AA24402,
+    0x4AA28402, 0x4AA04402, 0x4AA08402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4AA2C402,
+    0x4AA18402, 0x00000000, 0x00000000, 0x4AA0C402, 0x4AA1C402, 0x4AA3C402, 0x4AA40402, 0x4AA44402,
+    0x4AA48402, 0x4AA4C402, 0x4AA50402, 0x4AA54402, 0x4AA58402, 0x4AA5C402, 0x4AA60402, 0x4AA64402,
+    0x4AA68402, 0x4AA6C402, 0x4AA70402, 0x4AA74402, 0x4AA78402, 0x4AA7C402, 0x4AA80402, 0x4AA84402,
+    0x4AA88402, 0x00000000, 0x4AA8C402, 0x4AA90402, 0x4AA94402, 0x4AA98402, 0x4AA9C402, 0x4AAA0402,
+    0x4AAA8402, 0x00000000, 0x4AAAC402, 0x800148E2, 0x00000000, 0x4AAB0402, 0x80014922, 0x00000000,
+    0x4AA30402, 0x4AA34402, 0x00000000, 0x00000000, 0x40001842, 0x00000000, 0x4AAB8402, 0x4AABC402,
+    0x4AAC0402, 0x4AAC4402, 0x4AAC8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4AACC402,
+    0x4AAD0402, 0x00000000, 0x00000000, 0x4AAD4402, 0x4AAD8402, 0x4AADC402, 0x00000000, 0x00000000,
+    0x00000000, 0x4AA38402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x80014962, 0x800149A2, 0x800149E2, 0x4AAB4402, 0x00000000, 0x80014A22, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x400018E2, 0x40001902, 0x4AA20402, 0x4AA00402, 0x4A9FC402, 0x4AAA4402, 0x41018402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x40001862, 0x40001882, 0x400018A2, 0x00000000, 0x4AAE4402, 0x4AAE8402, 0x4AAEC402,
+    0x4AAF0402, 0x4AAF4402, 0x4AAF8402, 0x4AAFC402, 0x4AB04402, 0x4AB0C402, 0x00000000, 0x4AB10402,
+    0x4AB14402, 0x4AB18402, 0x00000000, 0x4AB1C402, 0x4AB20402, 0x4AB24402, 0x4AB28402, 0x4AB2C402,
+    0x4AB30402, 0x4AB34402, 0x4AB38402, 0x4AB3C402, 0x4AB40402, 0x4AB48402, 0x4AB4C402, 0x4AB50402,
+    0x4AB54402, 0x4AB58402, 0x4AB5C402, 0x4AB60402, 0x4AB64402, 0x4AB68402, 0x4AB6C402, 0x4AB70402,
+    0x4AB74402, 0x00000000, 0x4AB78402, 0x4AB7C402, 0x4AB80402, 0x4AB84402, 0x4AB88402, 0x4AB8C402,
+    0x4AB90402, 0x00000000, 0x4AB94402, 0x4ABAC402, 0x00000000, 0x4AB98402, 0x4AB9C402, 0x4ABA0402,
+    0x4ABA4402, 0x4ABA8402, 0x00000000, 0x00000000, 0x40001842, 0x4ABB0402, 0x4ABB4402, 0x4ABB8402,
+    0x4ABBC402, 0x4ABC0402, 0x4ABC4402, 0x4ABC8402, 0x4ABCC402, 0x4ABD8402, 0x00000000, 0x4ABDC402,
+    0x4ABE0402, 0x4ABE4402, 0x00000000, 0x4ABE8402, 0x4ABEC402, 0x4ABF0402, 0x00000000, 0x00000000,
+    0x4AAE0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4AB00402, 0x4AB08402, 0x4ABD0402, 0x4ABD4402, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x4101C402, 0x47DB8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x4AB44402, 0x40001022, 0x40001002, 0x40001042, 0x40001842, 0x40001842, 0x40001842,
+    0x00000000, 0x40001862, 0x40001882, 0x400018A2, 0x00000000, 0x4ABF4402, 0x4ABF8402, 0x4ABFC402,
+    0x4AC00402, 0x4AC04402, 0x4AC08402, 0x4AC0C402, 0x4AC14402, 0x00000000, 0x00000000, 0x4AC1C402,
+    0x4AC20402, 0x00000000, 0x00000000, 0x4AC24402, 0x4AC28402, 0x4AC2C402, 0x4AC30402, 0x4AC34402,
+    0x4AC38402, 0x4AC3C402, 0x4AC40402, 0x4AC44402, 0x4AC48402, 0x4AC4C402, 0x4AC50402, 0x4AC54402,
+    0x4AC58402, 0x4AC5C402, 0x4AC60402, 0x4AC64402, 0x4AC68402, 0x4AC6C402, 0x4AC70402, 0x4AC74402,
+    0x4AC78402, 0x00000000, 0x4AC7C402, 0x4AC80402, 0x4AC84402, 0x4AC88402, 0x4AC8C402, 0x4AC90402,
+    0x4AC98402, 0x00000000, 0x4AC9C402, 0x4ACA0402, 0x00000000, 0x4ACA4402, 0x4ACAC402, 0x4ACB0402,
+    0x4ACB4402, 0x4ACB8402, 0x00000000, 0x00000000, 0x40001842, 0x4ACBC402, 0x4ACC0402, 0x4ACC4402,
+    0x4ACC8402, 0x4ACCC402, 0x4ACD0402, 0x4ACD4402, 0x4ACD8402, 0x00000000, 0x00000000, 0xC0000544,
+    0x4ACE8402, 0x00000000, 0x00000000, 0x4ACEC402, 0x4ACF0402, 0x4ACF4402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000662, 0x4ACF8402, 0x4ACFC402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80014A62, 0x80014AA2, 0x00000000, 0x4AC94402,
+    0x4AC10402, 0x4AC18402, 0x4ACDC402, 0x4ACE0402, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x41520402, 0x4ACA8402, 0x47570402, 0x47574402, 0x47578402, 0x4757C402, 0x47580402, 0x47584402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x40001882, 0x4AD34402, 0x00000000, 0x4AD04402, 0x4AD08402, 0x4AD0C402,
+    0x4AD10402, 0x4AD14402, 0x4AD18402, 0x00000000, 0x00000000, 0x00000000, 0x4AD1C402, 0x4AD20402,
+    0x4AD24402, 0x00000000, 0xC0000642, 0x4AD2C402, 0x4AD30402, 0x4AD38402, 0x00000000, 0x00000000,
+    0x00000000, 0x4AD3C402, 0x4AD40402, 0x00000000, 0x4AD80402, 0x00000000, 0x4AD44402, 0x4AD48402,
+    0x00000000, 0x00000000, 0x00000000, 0x4AD4C402, 0x4AD50402, 0x00000000, 0x00000000, 0x00000000,
+    0x4AD54402, 0x4AD7C402, 0x4AD58402, 0x00000000, 0x00000000, 0x00000000, 0x4AD5C402, 0x4AD60402,
+    0x4AD64402, 0x4AD78402, 0x4AD68402, 0x4AD74402, 0x4AD70402, 0x4AD6C402, 0x4AD84402, 0x4AD88402,
+    0x4AD8C402, 0x4AD90402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4AD94402, 0x4AD98402,
+    0x4AD9C402, 0x4ADA0402, 0x4ADA4402, 0x00000000, 0x00000000, 0x00000000, 0xC00006C3, 0xC0000782,
+    0x4ADB0402, 0x00000000, 0x4ADB4402, 0x4ADB8402, 0x4ADBC402, 0x4ADC0402, 0x00000000, 0x00000000,
+    0x4AD00402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4ADC4402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x475A0402, 0x475A4402, 0x475A8402, 0x41524402, 0x41528402, 0x4152C402, 0x41530402, 0x41534402,
+    0x41538402, 0x47DC0402, 0x4153C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001862, 0x40001862, 0x40001882, 0x400018A2, 0x40001882, 0x4ADC8402, 0x4ADCC402, 0x4ADD0402,
+    0x4ADD4402, 0x4ADD8402, 0x4ADDC402, 0x4ADE0402, 0x4ADE8402, 0x00000000, 0x4ADF0402, 0x4ADF4402,
+    0x4ADF8402, 0x00000000, 0x4ADFC402, 0x4AE00402, 0x4AE04402, 0x4AE08402, 0x4AE0C402, 0x4AE10402,
+    0x4AE14402, 0x4AE18402, 0x4AE1C402, 0x4AE24402, 0x4AE28402, 0x4AE30402, 0x4AE34402, 0x4AE38402,
+    0x4AE3C402, 0x4AE40402, 0x4AE44402, 0x4AE48402, 0x4AE4C402, 0x4AE50402, 0x4AE54402, 0x4AE58402,
+    0x4AE5C402, 0x00000000, 0x4AE60402, 0x4AE64402, 0x4AE68402, 0x4AE6C402, 0x4AE70402, 0x4AE74402,
+    0x4AE78402, 0x4AE7C402, 0x4AE80402, 0x4AE98402, 0x4AE9C402, 0x4AE84402, 0x4AE88402, 0x4AE8C402,
+    0x4AE90402, 0x4AE94402, 0x00000000, 0x00000000, 0x00000000, 0x4AEA4402, 0x4AEA8402, 0x4AEAC402,
+    0x4AEB0402, 0x4AEB4402, 0x4AEB8402, 0x4AEBC402, 0x4AEC0402, 0x00000000, 0xC0000802, 0x4AED0402,
+    0x4AED4402, 0x00000000, 0x4AED8402, 0x4AEDC402, 0x4AEE0402, 0x4AEE4402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4AEE8402, 0x4AEEC402, 0x00000000,
+    0x4AE20402, 0x4AE2C402, 0x4AEA0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4ADE4402, 0x4ADEC402, 0x4AEC4402, 0x4AEC8402, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x41020402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x415A4402,
+    0x4AFCC402, 0x40001862, 0x40001882, 0x400018A2, 0x41024402, 0x4AEF0402, 0x4AEF4402, 0x4AEF8402,
+    0x4AEFC402, 0x4AF00402, 0x4AF04402, 0x4AF08402, 0x4AF10402, 0x00000000, 0x4AF18402, 0x4AF1C402,
+    0x4AF20402, 0x00000000, 0x4AF24402, 0x4AF28402, 0x4AF2C402, 0x4AF30402, 0x4AF34402, 0x4AF38402,
+    0x4AF3C402, 0x4AF40402, 0x4AF44402, 0x4AF48402, 0x4AF4C402, 0x4AF50402, 0x4AF54402, 0x4AF58402,
+    0x4AF5C402, 0x4AF60402, 0x4AF64402, 0x4AF68402, 0x4AF6C402, 0x4AF70402, 0x4AF74402, 0x4AF78402,
+    0x4AF7C402, 0x00000000, 0x4AF80402, 0x4AF84402, 0x4AF88402, 0x4AF8C402, 0x4AF90402, 0x4AF94402,
+    0x4AF98402, 0x4AF9C402, 0x4AFA0402, 0x4AFB8402, 0x00000000, 0x4AFA4402, 0x4AFA8402, 0x4AFAC402,
+    0x4AFB0402, 0x4AFB4402, 0x00000000, 0x00000000, 0x40001842, 0x4AFC0402, 0x4AFD0402, 0xC0000882,
+    0x4AFD8402, 0x4AFDC402, 0x4AFE0402, 0x4AFE4402, 0x4AFE8402, 0x00000000, 0xC0000905, 0x4AFF8402,
+    0x4AFFC402, 0x00000000, 0xC0000A42, 0x4B004402, 0x4B008402, 0x4B00C402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4B010402, 0x4B014402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4AFBC402, 0x00000000,
+    0x4AF0C402, 0x4AF14402, 0x4AFEC402, 0x4AFF0402, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x00000000, 0x4AFC4402, 0x4AFC8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001882, 0x40001862, 0x40001882, 0x400018A2, 0x4B0F8402, 0x4B018402, 0x4B01C402, 0x4B020402,
+    0x4B024402, 0x4B02C402, 0x4B030402, 0x4B034402, 0x4B03C402, 0x00000000, 0x4B044402, 0x4B048402,
+    0x4B04C402, 0x00000000, 0x4B050402, 0x4B054402, 0x4B058402, 0x4B05C402, 0x4B060402, 0x4B064402,
+    0x4B068402, 0x4B06C402, 0x4B070402, 0x4B074402, 0x4B078402, 0x4B07C402, 0x4B080402, 0x4B084402,
+    0x4B088402, 0x4B08C402, 0x4B090402, 0x4B094402, 0x4B098402, 0x4B09C402, 0x4B0A0402, 0x4B0A4402,
+    0x4B0A8402, 0x4B0AC402, 0x4B0B0402, 0x4B0B4402, 0x4B0B8402, 0x4B0BC402, 0x4B0C0402, 0x4B0C4402,
+    0x4B0C8402, 0x4B0EC402, 0x4B0CC402, 0x4B0E4402, 0x4B0E8402, 0x4B0D0402, 0x4B0D4402, 0x4B0D8402,
+    0x4B0DC402, 0x4B0E0402, 0x4B0F0402, 0x4B13C404, 0x4B13C404, 0x4B0F4402, 0x4B0FC402, 0x4B100402,
+    0x4B104402, 0x4B108402, 0x4B10C402, 0x4B110402, 0x4B114402, 0x00000000, 0xC0000AC3, 0xC0000B82,
+    0x4B128402, 0x00000000, 0x4B12C402, 0x4B130402, 0x4B134402, 0x4B13C402, 0x80014AE2, 0x415A8402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80014B22, 0x80014B62, 0x80014BA2, 0x4B138402,
+    0x47600402, 0x47604402, 0x47608402, 0x4760C402, 0x47610402, 0x47614402, 0x47618402, 0x4B028402,
+    0x4B038402, 0x4B040402, 0x4B118402, 0x4B11C402, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x4761C402, 0x47620402, 0x47624402, 0x47628402, 0x4762C402, 0x47630402, 0x47634402, 0x47638402,
+    0x4763C402, 0x415AC402, 0x80014BE2, 0x80014C22, 0x80014AE2, 0x80014C62, 0x80014CA2, 0x80014CE2,
+    0x00000000, 0x40001862, 0x40001882, 0x400018A2, 0x00000000, 0x4B140402, 0x4B144402, 0x4B148402,
+    0x4B14C402, 0x4B150402, 0x4B154402, 0x4B158402, 0x4B15C402, 0x4B160402, 0x4B164402, 0x4B168402,
+    0x4B16C402, 0x4B170402, 0x4B174402, 0x4B178402, 0x4B17C402, 0x4B180402, 0x4B184402, 0x00000000,
+    0x00000000, 0x00000000, 0x4B188402, 0x4B18C402, 0x4B190402, 0x4B194402, 0x4B198402, 0x4B19C402,
+    0x4B1A0402, 0x4B1A4402, 0x4B1A8402, 0x4B1AC402, 0x4B1B0402, 0x4B1B4402, 0x4B1B8402, 0x4B1BC402,
+    0x4B1C0402, 0x4B1C4402, 0x4B1C8402, 0x4B1CC402, 0x4B1D0402, 0x4B1D4402, 0x4B1D8402, 0x4B1DC402,
+    0x4B1E0402, 0x4B1E4402, 0x00000000, 0x4B1E8402, 0x4B1EC402, 0x4B1F0402, 0x4B1F4402, 0x4B1F8402,
+    0x4B1FC402, 0x4B200402, 0x4B204402, 0x4B208402, 0x00000000, 0x4B20C402, 0x00000000, 0x00000000,
+    0x4B210402, 0x4B214402, 0x4B218402, 0x4B21C402, 0x4B220402, 0x4B224402, 0x4B228402, 0x00000000,
+    0x00000000, 0x00000000, 0x4B270402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4B22C402,
+    0x4B230402, 0x4B234402, 0x4B238402, 0x4B23C402, 0x4B240402, 0x00000000, 0x4B244402, 0x00000000,
+    0x4B248402, 0xC0000C05, 0x4B25C402, 0x4B260402, 0xC0000D42, 0x4B268402, 0x4B26C402, 0x4B250402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x00000000, 0x00000000, 0x4B24C402, 0x4B254402, 0x41028402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x4C85C402, 0x4C860402, 0x4C864402, 0x4C868402, 0x4C86C402, 0x4C870402, 0x4C874402,
+    0x4C878402, 0x4C87C402, 0x4C880402, 0x4C884402, 0x4C888402, 0x4C88C402, 0x4C890402, 0x4C894402,
+    0x4C898402, 0x4C89C402, 0x4C8A0402, 0x4C8A4402, 0x4C8A8402, 0x4C8AC402, 0x4C8B0402, 0x4C8B4402,
+    0x4C8B8402, 0x4C8BC402, 0x4C8C0402, 0x4C8C4402, 0x4C8C8402, 0x4C8CC402, 0x4C8D0402, 0x4C8D4402,
+    0x4C8D8402, 0x4C8DC402, 0x4C8E0402, 0x4C8E4402, 0x4C8E8402, 0x4C8EC402, 0x4C8F0402, 0x4C8F4402,
+    0x4C8F8402, 0x4C8FC402, 0x4C900402, 0x4C904402, 0x4C908402, 0x4C90C402, 0x4C910402, 0x4C914402,
+    0x4C918402, 0x4C91C402, 0x4C920402, 0x4C924402, 0x4C928402, 0x4C92C402, 0x4C930402, 0x4C934402,
+    0x4C938402, 0x4C93C402, 0x4C940402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47DD4402,
+    0xC0000DEF, 0xC00019AF, 0xC000256F, 0xC000312F, 0xC0003CEF, 0x4C958402, 0x47D24402, 0x40001A82,
+    0x40001AA2, 0x40001AC2, 0x40001AE2, 0x40001B02, 0x40001B22, 0xC0004882, 0x40001A62, 0x4102C402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x41030402, 0x41034402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x4C960402, 0x4C964402, 0x00000000, 0x4C968402, 0x00000000, 0x4C96C402, 0x4C970402,
+    0x4C974402, 0x4C978402, 0x4C980402, 0x00000000, 0x4C984402, 0x4C990402, 0x4C988402, 0x4C994402,
+    0x4C998402, 0x4C99C402, 0x4C9A0402, 0x4C9A4402, 0x4C9A8402, 0x4C9AC402, 0x4C9B0402, 0x4C9B4402,
+    0x4C9B8402, 0x4C9BC402, 0x4C9C0402, 0x4C9C4402, 0x4C9C8402, 0x4C9CC402, 0x4C9D0402, 0x4C9D4402,
+    0x4C9D8402, 0x4C9DC402, 0x4C9E0402, 0x4C9E4402, 0x00000000, 0x4C9E8402, 0x00000000, 0x4C9EC402,
+    0x4C9F0402, 0x4C9F4402, 0x4C97C402, 0x4C9F8402, 0x4C9FC402, 0x4CA00402, 0x4CA04402, 0x4CA08402,
+    0x4CA0C402, 0x4CA10402, 0x4CA14402, 0x4CA18402, 0x4CA1C402, 0x4CA20402, 0x4CA24402, 0x4CA28402,
+    0x4CA2C402, 0x4CA30402, 0x4CA34402, 0x4CA38402, 0x4CA3C402, 0x4CA40402, 0x00000000, 0x00000000,
+    0xC000492E, 0xC00054AE, 0xC000602E, 0xC0006BAE, 0xC000772E, 0x00000000, 0x47D28402, 0x00000000,
+    0x40001B62, 0x40001B82, 0x40001BA2, 0x40001BC2, 0x40001BE2, 0xC0008282, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x80014D22, 0x80014D62, 0x4C95C402, 0x4C98C402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80014DA3, 0x415CC402, 0x415D0402, 0x415D4402, 0x41040402, 0x41044402, 0x41048402, 0x4104C402,
+    0x41050402, 0x41054402, 0x41058402, 0x41064402, 0x4106441B, 0x41068402, 0x4106C402, 0x41070402,
+    0x41074402, 0x41078402, 0x4107C402, 0x415D8402, 0x4097C402, 0x415DC402, 0x415E0402, 0x415E4402,
+    0x40000000, 0x40000000, 0x415E8402, 0x415EC402, 0x415F0402, 0x415F4402, 0x415F8402, 0x415FC402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47E64404, 0x47E68404, 0x47E6C404, 0x47E70404, 0x47E74404, 0x47E78404,
+    0x47E7C404, 0x47E80404, 0x47E84404, 0x47E60404, 0x41600402, 0x40000000, 0x41604402, 0x40000000,
+    0x41608402, 0x40001C62, 0x40CB8402, 0x40CBC402, 0x40CC0402, 0x40CC4402, 0x40000000, 0x40000000,
+    0x4CB64402, 0x4CB70402, 0x4CB78402, 0x80014E02, 0x4CB80402, 0x4CB88402, 0x4CB90402, 0x4CB98402,
+    0x00000000, 0x4CBA0402, 0x4CBA8402, 0x4CBB0402, 0x4CBB8402, 0x80014E42, 0x4CBC0402, 0x4CBC8402,
+    0x4CBD0402, 0x4CBD8402, 0x80014E82, 0x4CBE0402, 0x4CBE8402, 0x4CBF0402, 0x4CBF8402, 0x80014EC2,
+    0x4CC00402, 0x4CC08402, 0x4CC10402, 0x4CC18402, 0x80014F02, 0x4CC20402, 0x4CC28402, 0x4CC30402,
+    0x4CC38402, 0x4CC40402, 0x4CC48402, 0x4CC54402, 0x4CC5C402, 0x4CC64402, 0x4CC6C402, 0x4CC74402,
+    0x4CC7C402, 0x80014F42, 0x80014F82, 0x4CB6C402, 0x4CC50402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0xC0008304, 0x4CCA8402, 0x4CCAC402, 0x4CCB8402, 0x4CCBC402, 0x4CCC0402, 0x4CCC4402,
+    0x4CCC8402, 0x4CCCC402, 0x4CCD0402, 0x4CCD4402, 0x4CCD8402, 0x4CCDC402, 0x40001882, 0x400018A2,
+    0x4CCB0402, 0x4CCB4402, 0x40000000, 0x40000000, 0x4CCE0402, 0x41080402, 0x40000000, 0x40000000,
+    0x4CC84402, 0x4CC8C402, 0x4CC9C402, 0x4CCA0402, 0x4CC94402, 0x4CC88402, 0x4CC90402, 0x4CC98402,
+    0x4CB68402, 0x4CB74402, 0x4CB7C402, 0x80014FC2, 0x4CB84402, 0x4CB8C402, 0x4CB94402, 0x4CB9C402,
+    0x00000000, 0x4CBA4402, 0x4CBAC402, 0x4CBB4402, 0x4CBBC402, 0x80015002, 0x4CBC4402, 0x4CBCC402,
+    0x4CBD4402, 0x4CBDC402, 0x80015042, 0x4CBE4402, 0x4CBEC402, 0x4CBF4402, 0x4CBFC402, 0x80015082,
+    0x4CC04402, 0x4CC0C402, 0x4CC14402, 0x4CC1C402, 0x800150C2, 0x4CC24402, 0x4CC2C402, 0x4CC34402,
+    0x4CC3C402, 0x4CC44402, 0xC0008404, 0xC0008504, 0x4CC60402, 0x4CC68402, 0x4CC70402, 0x4CC78402,
+    0x4CC80402, 0x80015102, 0x80015142, 0x80015182, 0x800151C2, 0x00000000, 0x4160C402, 0x41610402,
+    0x41614402, 0x41618402, 0x4161C402, 0x41620402, 0x41624402, 0x41628402, 0x40000000, 0x4162C402,
+    0x41630402, 0x41634402, 0x41638402, 0x4163C402, 0x41640402, 0x00000000, 0x41644402, 0x41648402,
+    0x4105C402, 0x41060402, 0x41084402, 0x41088402, 0x4108C402, 0x4164C402, 0x41650402, 0x41654402,
+    0x41658402, 0x41090402, 0x41094402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D5B0402, 0x4D5B8402, 0x4D5C0402, 0x4D5D0402, 0x4D5DC402, 0x4D5E4402, 0x4D5F0402, 0x4D600402,
+    0x4D614402, 0x4D630402, 0x4D640402, 0x4D644402, 0x4D64C402, 0x4D654402, 0x4D660402, 0x4D66C402,
+    0x4D67C402, 0x4D680402, 0x4D684402, 0x4D690402, 0x4D69C402, 0x4D6AC402, 0x4D6B0402, 0x4D6C8402,
+    0x4D6D4402, 0x4D6E0402, 0x4D6E8402, 0x4D6F0402, 0x4D700402, 0x4D708402, 0x4D724402, 0x4D72C402,
+    0x4D744402, 0x4D760402, 0x4D764402, 0x4D768402, 0x4D76C402, 0xC0008602, 0x4D774402, 0x4D788402,
+    0x4D78C402, 0x4D790402, 0x4D794402, 0x4D798404, 0x4D798402, 0x4D7A8402, 0x4D7B0402, 0x4D7B8402,
+    0x4D7C4402, 0x4D7D8402, 0x4D7E8402, 0x4D7B4402, 0x4D7F0402, 0x4D7E0402, 0x40001882, 0x40001CE2,
+    0x400018A2, 0x4D808402, 0x4D80C402, 0x4D6EC402, 0x4D6FC402, 0x4D70C402, 0x4D738402, 0x80015203,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x40A84402, 0x40A88402, 0x410EC402, 0x410F0402, 0x410F4402, 0x410F8402,
+    0x4D718402, 0x4D71C402, 0x4D778402, 0x4D77C402, 0x4D780402, 0x4D784402, 0x4D7C8402, 0x4D7CC402,
+    0x4D7D0402, 0x4D7D4402, 0x4D5E0402, 0x4D618402, 0x4D74C402, 0x4D750402, 0x4D6A8402, 0x4D6E4402,
+    0x4D704402, 0x4D628402, 0x4D7F4402, 0x4D810402, 0x4D814402, 0x4D720402, 0x4D75C402, 0x4D7F8402,
+    0x4D7FC402, 0x4D818402, 0x4D81C402, 0x4D820402, 0x4D824402, 0x4D828402, 0x4D670402, 0x4D754402,
+    0x4D758402, 0x4D7AC402, 0x4D7A0402, 0x4D7BC402, 0x4D7C0402, 0x4D5B4402, 0x4D5BC402, 0x4D5C4402,
+    0x4D5E8402, 0x4D60C402, 0x4D634402, 0x4D688402, 0x4D6A0402, 0x4D6B4402, 0x4D6B8402, 0x4D6CC402,
+    0x4D714402, 0x4D730402, 0x4D710402, 0x4D79C402, 0x4D7DC402, 0x4D7E4402, 0x4D804402, 0x4D82C402,
+    0x4D834402, 0x4D840402, 0x4D844402, 0x4D830402, 0x4D838402, 0x4D83C402, 0x4D6C0402, 0x4D848402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4D84C402, 0x4D850402, 0x4D7A4402, 0x4D7EC402, 0x41664402, 0x41668402,
+    0x49680408, 0x49688408, 0x49690408, 0x49698408, 0x496A0408, 0x496A8408, 0x496B0408, 0x496C0408,
+    0x496C8408, 0x496D0408, 0x496D8408, 0x496E0408, 0x496E8408, 0x496F8408, 0x49700408, 0x49708408,
+    0x49710408, 0x49718408, 0x49720408, 0x49730408, 0x49738408, 0x49740408, 0x49748408, 0x49750408,
+    0x49758408, 0x49760408, 0x49768408, 0x49770408, 0x49778408, 0x49780408, 0x49788408, 0x49798408,
+    0x497A0408, 0x496B8408, 0x496F0408, 0x49728408, 0x49790408, 0x497A8408, 0x00000000, 0x497B4408,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x497C8408, 0x00000000, 0x00000000,
+    0x4967C402, 0x49684402, 0x4968C402, 0x49694402, 0x4969C402, 0x496A4402, 0x496AC402, 0x496BC402,
+    0x496C4402, 0x496CC402, 0x496D4402, 0x496DC402, 0x496E4402, 0x496F4402, 0x496FC402, 0x49704402,
+    0x4970C402, 0x49714402, 0x4971C402, 0x4972C402, 0x49734402, 0x4973C402, 0x49744402, 0x4974C402,
+    0x49754402, 0x4975C402, 0x49764402, 0x4976C402, 0x49774402, 0x4977C402, 0x49784402, 0x49794402,
+    0x4979C402, 0x496B4402, 0x496EC402, 0x49724402, 0x4978C402, 0x497A4402, 0x497AC402, 0x497B0402,
+    0x497B8402, 0x497BC402, 0x497C0402, 0x40B3C402, 0x496E4414, 0x497C4402, 0x497CC402, 0x497D0402,
+    0x505D4402, 0x505D8402, 0x505DC402, 0x505E0402, 0x505E4402, 0x505E8402, 0x505EC402, 0x505F0402,
+    0x505F4402, 0x505F8402, 0x505FC402, 0x50600402, 0x50604402, 0x50608402, 0x5060C402, 0x50610402,
+    0x50614402, 0x50618402, 0x5061C402, 0x50620402, 0x50624402, 0x50628402, 0x5062C402, 0x50630402,
+    0x50634402, 0x50638402, 0x5063C402, 0x50640402, 0x50644402, 0x50648402, 0x5064C402, 0x50650402,
+    0x50654402, 0x50658402, 0x5065C402, 0x50660402, 0x50664402, 0x50668402, 0x5066C402, 0x50670402,
+    0x50674402, 0x50678402, 0x5067C402, 0x50680402, 0x50684402, 0x50688402, 0x5068C402, 0x50690402,
+    0x50694402, 0x50698402, 0x5069C402, 0x506A0402, 0x506A4402, 0x506A8402, 0x506AC402, 0x506B0402,
+    0x506B4402, 0x506B8402, 0x506BC402, 0x506C0402, 0x506C4402, 0x506C8402, 0x506CC402, 0x506D0402,
+    0x506D4402, 0x506D8402, 0x506DC402, 0x506E0402, 0x506E4402, 0x506E8402, 0x506EC402, 0x506F0402,
+    0x506F4402, 0x506F8402, 0x506FC402, 0x50700402, 0x50704402, 0x50708402, 0x5070C402, 0x50710402,
+    0x50714402, 0x50718402, 0x5071C402, 0x50720402, 0x50724402, 0x50728402, 0x5072C402, 0x50730402,
+    0x50734402, 0x50738402, 0x5073C402, 0x50740402, 0x50744402, 0x50748402, 0x5074C402, 0x507C4402,
+    0x507C8402, 0x507CC402, 0x507D0402, 0x507D4402, 0x507D8402, 0x507DC402, 0x507E0402, 0x507E4402,
+    0x507E8402, 0x507EC402, 0x507F0402, 0x507F4402, 0x507F8402, 0x507FC402, 0x50800402, 0x50804402,
+    0x50808402, 0x5080C402, 0x50810402, 0x50814402, 0x50818402, 0x5081C402, 0x50820402, 0x50824402,
+    0x50828402, 0x5082C402, 0x50830402, 0x50834402, 0x50838402, 0x5083C402, 0x50840402, 0x50844402,
+    0x50848402, 0x5084C402, 0x50850402, 0x50854402, 0x50858402, 0x5085C402, 0x50860402, 0x50864402,
+    0x50868402, 0x5086C402, 0x50870402, 0x50874402, 0x50878402, 0x5087C402, 0x50880402, 0x50884402,
+    0x50888402, 0x5088C402, 0x50890402, 0x50894402, 0x50898402, 0x5089C402, 0x508A0402, 0x508A4402,
+    0x508A8402, 0x508AC402, 0x508B0402, 0x508B4402, 0x508B8402, 0x508BC402, 0x508C0402, 0x508C4402,
+    0x508C8402, 0x508CC402, 0x508D0402, 0x508D4402, 0x508D8402, 0x508DC402, 0x508E0402, 0x508E4402,
+    0x50944402, 0x50948402, 0x5094C402, 0x50950402, 0x50954402, 0x50958402, 0x5095C402, 0x50960402,
+    0x50964402, 0x50968402, 0x5096C402, 0x50970402, 0x50974402, 0x50978402, 0x5097C402, 0x50980402,
+    0x50984402, 0x50988402, 0x5098C402, 0x50990402, 0x50994402, 0x50998402, 0x5099C402, 0x509A0402,
+    0x509A4402, 0x509A8402, 0x509AC402, 0x509B0402, 0x509B4402, 0x509B8402, 0x509BC402, 0x509C0402,
+    0x509C4402, 0x509C8402, 0x509CC402, 0x509D0402, 0x509D4402, 0x509D8402, 0x509DC402, 0x509E0402,
+    0x509E4402, 0x509E8402, 0x509EC402, 0x509F0402, 0x509F4402, 0x509F8402, 0x509FC402, 0x50A00402,
+    0x50A04402, 0x50A08402, 0x50A0C402, 0x50A10402, 0x50A14402, 0x50A18402, 0x50A1C402, 0x50A20402,
+    0x50A24402, 0x50A28402, 0x50A2C402, 0x50A30402, 0x50A34402, 0x50A38402, 0x50A3C402, 0x50A40402,
+    0x50A44402, 0x50A48402, 0x50A4C402, 0x50A50402, 0x50A54402, 0x50A58402, 0x50A5C402, 0x50A60402,
+    0x50A64402, 0x50A68402, 0x50A6C402, 0x50A70402, 0x50A74402, 0x50A78402, 0x50A7C402, 0x50A80402,
+    0x50A84402, 0x50A88402, 0x50A8C402, 0x50A90402, 0x50A94402, 0x50A98402, 0x50A9C402, 0x50AA0402,
+    0x4A048402, 0x4A04C402, 0x4A050402, 0x4A054402, 0x4A058402, 0x4A05C402, 0x4A060402, 0x4A064402,
+    0x4A068402, 0x4A06C402, 0x4A070402, 0x4A074402, 0x4A078402, 0x4A07C402, 0x4A080402, 0x4A084402,
+    0x4A08C402, 0x4A090402, 0x4A094402, 0x4A098402, 0x4A09C402, 0x4A0A0402, 0x4A0A4402, 0x4A0A8402,
+    0x4A0AC402, 0x4A0B0402, 0x4A0B4402, 0x4A0B8402, 0x4A0BC402, 0x4A0C0402, 0x4A0C4402, 0x4A0C8402,
+    0x4A0E0402, 0x4A0E4402, 0x4A0E8402, 0x4A0EC402, 0x4A0F0402, 0x4A0F4402, 0x4A0F8402, 0x4A0FC402,
+    0x4A100402, 0x4A104402, 0x4A108402, 0x4A10C402, 0x4A110402, 0x4A114402, 0x4A118402, 0x4A11C402,
+    0x4A124402, 0x4A128402, 0x4A12C402, 0x4A130402, 0x4A134402, 0x4A138402, 0x4A13C402, 0x4A140402,
+    0x4A160402, 0x4A164402, 0x4A168402, 0x4A16C402, 0x4A170402, 0x4A174402, 0x4A178402, 0x4A17C402,
+    0x4A184402, 0x4A188402, 0x4A18C402, 0x4A190402, 0x4A194402, 0x4A198402, 0x4A19C402, 0x4A1A0402,
+    0x4A1A4402, 0x00000000, 0x4A1A8402, 0x4A1AC402, 0x4A1B0402, 0x4A1B4402, 0x00000000, 0x00000000,
+    0x4A1B8402, 0x4A1BC402, 0x4A1C0402, 0x4A1C4402, 0x4A1C8402, 0x4A1CC402, 0x4A1D0402, 0x00000000,
+    0x4A1D4402, 0x00000000, 0x4A1D8402, 0x4A1DC402, 0x4A1E0402, 0x4A1E4402, 0x00000000, 0x00000000,
+    0x4A1E8402, 0x4A1EC402, 0x4A1F0402, 0x4A1F4402, 0x4A1F8402, 0x4A1FC402, 0x4A200402, 0x4A204402,
+    0x4A21C402, 0x4A220402, 0x4A224402, 0x4A228402, 0x4A22C402, 0x4A230402, 0x4A234402, 0x4A238402,
+    0x4A23C402, 0x4A240402, 0x4A244402, 0x4A248402, 0x4A24C402, 0x4A250402, 0x4A254402, 0x4A258402,
+    0x4A260402, 0x4A264402, 0x4A268402, 0x4A26C402, 0x4A270402, 0x4A274402, 0x4A278402, 0x4A27C402,
+    0x4A284402, 0x4A288402, 0x4A28C402, 0x4A290402, 0x4A294402, 0x4A298402, 0x4A29C402, 0x4A2A0402,
+    0x4A2A4402, 0x00000000, 0x4A2A8402, 0x4A2AC402, 0x4A2B0402, 0x4A2B4402, 0x00000000, 0x00000000,
+    0x4A2B8402, 0x4A2BC402, 0x4A2C0402, 0x4A2C4402, 0x4A2C8402, 0x4A2CC402, 0x4A2D0402, 0x4A2D4402,
+    0x4A2DC402, 0x4A2E0402, 0x4A2E4402, 0x4A2E8402, 0x4A2EC402, 0x4A2F0402, 0x4A2F4402, 0x4A2F8402,
+    0x4A300402, 0x4A304402, 0x4A308402, 0x4A30C402, 0x4A310402, 0x4A314402, 0x4A318402, 0x4A31C402,
+    0x4A324402, 0x4A328402, 0x4A32C402, 0x4A330402, 0x4A334402, 0x4A338402, 0x4A33C402, 0x4A340402,
+    0x4A344402, 0x00000000, 0x4A348402, 0x4A34C402, 0x4A350402, 0x4A354402, 0x00000000, 0x00000000,
+    0x4A358402, 0x4A35C402, 0x4A360402, 0x4A364402, 0x4A368402, 0x4A36C402, 0x4A370402, 0x00000000,
+    0x4A374402, 0x00000000, 0x4A378402, 0x4A37C402, 0x4A380402, 0x4A384402, 0x00000000, 0x00000000,
+    0x4A388402, 0x4A38C402, 0x4A390402, 0x4A394402, 0x4A398402, 0x4A39C402, 0x4A3A0402, 0x4A3A4402,
+    0x4A3A8402, 0x4A3AC402, 0x4A3B0402, 0x4A3B4402, 0x4A3B8402, 0x4A3BC402, 0x4A3C0402, 0x00000000,
+    0x4A3C4402, 0x4A3C8402, 0x4A3CC402, 0x4A3D0402, 0x4A3D4402, 0x4A3D8402, 0x4A3DC402, 0x4A3E0402,
+    0x4A400402, 0x4A404402, 0x4A408402, 0x4A40C402, 0x4A410402, 0x4A414402, 0x4A418402, 0x4A41C402,
+    0x4A420402, 0x4A424402, 0x4A428402, 0x4A42C402, 0x4A430402, 0x4A434402, 0x4A438402, 0x4A43C402,
+    0x4A440402, 0x4A444402, 0x4A448402, 0x4A44C402, 0x4A450402, 0x4A454402, 0x4A458402, 0x4A45C402,
+    0x4A47C402, 0x4A480402, 0x4A484402, 0x4A488402, 0x4A48C402, 0x4A490402, 0x4A494402, 0x4A498402,
+    0x4A4A0402, 0x4A4A4402, 0x4A4A8402, 0x4A4AC402, 0x4A4B0402, 0x4A4B4402, 0x4A4B8402, 0x4A4BC402,
+    0x4A4C4402, 0x4A4C8402, 0x4A4CC402, 0x4A4D0402, 0x4A4D4402, 0x4A4D8402, 0x4A4DC402, 0x4A4E0402,
+    0x4A4E4402, 0x00000000, 0x4A4E8402, 0x4A4EC402, 0x4A4F0402, 0x4A4F4402, 0x00000000, 0x00000000,
+    0x4A4F8402, 0x4A4FC402, 0x4A500402, 0x4A504402, 0x4A508402, 0x4A50C402, 0x4A510402, 0x4A514402,
+    0x4A528402, 0x4A52C402, 0x4A530402, 0x4A534402, 0x4A538402, 0x4A53C402, 0x4A540402, 0x4A544402,
+    0x4A54C402, 0x4A550402, 0x4A554402, 0x4A558402, 0x4A55C402, 0x4A560402, 0x4A564402, 0x4A568402,
+    0x4A58C402, 0x4A590402, 0x4A594402, 0x4A598402, 0x4A59C402, 0x4A5A0402, 0x4A5A4402, 0x4A5A8402,
+    0x4A5B0402, 0x4A5B4402, 0x4A5B8402, 0x4A5BC402, 0x4A5C0402, 0x4A5C4402, 0x4A5C8402, 0x4A5CC402,
+    0x4A5EC402, 0x4A5F0402, 0x4A5F4402, 0x4A5F8402, 0x4A5FC402, 0x4A600402, 0x4A604402, 0x4A608402,
+    0x4A60C402, 0x4A610402, 0x4A614402, 0x4A618402, 0x4A61C402, 0x4A620402, 0x4A624402, 0x4A628402,
+    0x4A63C402, 0x4A640402, 0x4A644402, 0x4A648402, 0x4A64C402, 0x4A650402, 0x4A654402, 0x4A658402,
+    0x4A670402, 0x4A674402, 0x4A678402, 0x00000000, 0x00000000, 0x400016A2, 0x40001682, 0x40001662,
+    0x40B40402, 0x40960402, 0x40A0C402, 0x40964402, 0x40968402, 0x4096C402, 0x40970402, 0x409CC402,
+    0x40B44402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47640402, 0x47644402, 0x47648402, 0x4764C402, 0x47650402, 0x47654402,
+    0x47658402, 0x4765C402, 0x47660402, 0x47664402, 0x47668402, 0x00000000, 0x00000000, 0x00000000,
+    0x4A0CC402, 0x4A0D0402, 0x4A0D4402, 0x4A0D8402, 0x4A208402, 0x4A20C402, 0x4A210402, 0x4A214402,
+    0x4A62C402, 0x4A630402, 0x4A634402, 0x4A638402, 0x4A65C402, 0x4A660402, 0x4A664402, 0x4A668402,
+    0x413E8402, 0x413EC402, 0x413F0402, 0x413F4402, 0x413F8402, 0x413FC402, 0x41400402, 0x41404402,
+    0x41408402, 0x4140C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4E378408, 0x4E37C408, 0x4E380408, 0x4E384408, 0x4E388408, 0x4E38C408, 0x4E390408, 0x4E394408,
+    0x4E398408, 0x4E39C408, 0x4E3A0408, 0x4E3A4408, 0x4E3A8408, 0x4E3AC408, 0x4E3B0408, 0x4E3B4408,
+    0x4E3B8408, 0x4E3BC408, 0x4E3C0408, 0x4E3C4408, 0x4E3C8408, 0x4E3CC408, 0x4E3D0408, 0x4E3D4408,
+    0x4E3D8408, 0x4E3DC408, 0x4E3E0408, 0x4E3E4408, 0x4E3E8408, 0x4E3EC408, 0x4E3F0408, 0x4E3F4408,
+    0x4E3F8408, 0x4E3FC408, 0x4E400408, 0x4E404408, 0x4E408408, 0x4E40C408, 0x4E410408, 0x4E414408,
+    0x4E418408, 0x4E41C408, 0x4E420408, 0x4E424408, 0x4E428408, 0x4E42C408, 0x4E430408, 0x4E434408,
+    0x4E438408, 0x4E43C408, 0x4E440408, 0x4E444408, 0x4E448408, 0x4E44C408, 0x4E450408, 0x4E454408,
+    0x4E458408, 0x4E45C408, 0x4E460408, 0x4E464408, 0x4E468408, 0x4E46C408, 0x4E470408, 0x4E474408,
+    0x4E478408, 0x4E47C408, 0x4E480408, 0x4E484408, 0x4E488408, 0x4E48C408, 0x4E490408, 0x4E494408,
+    0x4E498408, 0x4E49C408, 0x4E4A0408, 0x4E4A4408, 0x4E4A8408, 0x4E4AC408, 0x4E4B0408, 0x4E4B4408,
+    0x4E4B8408, 0x4E4BC408, 0x4E4C0408, 0x4E4C4408, 0x4E4C8408, 0x4E4CC408, 0x00000000, 0x00000000,
+    0x4E4B8402, 0x4E4BC402, 0x4E4C0402, 0x4E4C4402, 0x4E4C8402, 0x4E4CC402, 0x00000000, 0x00000000,
+    0x4083C402, 0x4E560402, 0x4E564402, 0x4E568402, 0x4E56C402, 0x4E570402, 0x4E574402, 0x4E578402,
+    0x4E57C402, 0x4E580402, 0x4E584402, 0x4E588402, 0x4E58C402, 0x4E590402, 0x4E594402, 0x4E598402,
+    0x4E59C402, 0x4E5A0402, 0x4E5A4402, 0x4E5A8402, 0x4E5AC402, 0x4E5B0402, 0x4E5B4402, 0x4E5B8402,
+    0x4E5BC402, 0x4E5C0402, 0x4E5C4402, 0x4E5C8402, 0x4E5CC402, 0x4E5D0402, 0x4E5D4402, 0x4E5D8402,
+    0x4E5DC402, 0x4E5E0402, 0x4E5E4402, 0x4E5E8402, 0x4E5EC402, 0x4E5F0402, 0x4E5F4402, 0x4E5F8402,
+    0x4E5FC402, 0x4E600402, 0x4E604402, 0x4E608402, 0x4E60C402, 0x4E610402, 0x4E614402, 0x4E618402,
+    0x4E61C402, 0x4E620402, 0x4E624402, 0x4E628402, 0x4E62C402, 0x4E630402, 0x4E634402, 0x4E638402,
+    0x4E63C402, 0x4E640402, 0x4E644402, 0x4E648402, 0x4E64C402, 0x4E650402, 0x4E654402, 0x4E658402,
+    0x4E65C402, 0x4E660402, 0x4E664402, 0x4E668402, 0x4E66C402, 0x4E670402, 0x4E674402, 0x4E678402,
+    0x4E67C402, 0x4E680402, 0x4E684402, 0x4E688402, 0x4E68C402, 0x4E690402, 0x4E694402, 0x4E698402,
+    0x4E69C402, 0x4E6A0402, 0x4E6A4402, 0x4E6A8402, 0x4E6AC402, 0x4E6B0402, 0x4E6B4402, 0x4E6B8402,
+    0x4E6BC402, 0x4E6C0402, 0x4E6C4402, 0x4E6C8402, 0x4E6CC402, 0x4E6D0402, 0x4E6D4402, 0x4E6D8402,
+    0x4E6DC402, 0x4E6E0402, 0x4E6E4402, 0x4E6E8402, 0x4E6EC402, 0x4E6F0402, 0x4E6F4402, 0x4E6F8402,
+    0x4E6FC402, 0x4E700402, 0x4E704402, 0x4E708402, 0x4E70C402, 0x4E710402, 0x4E714402, 0x4E718402,
+    0x4E71C402, 0x4E720402, 0x4E724402, 0x4E728402, 0x4E72C402, 0x4E730402, 0x4E734402, 0x4E738402,
+    0x4E73C402, 0x4E740402, 0x4E744402, 0x4E748402, 0x4E74C402, 0x4E750402, 0x4E754402, 0x4E758402,
+    0x4E75C402, 0x4E760402, 0x4E764402, 0x4E768402, 0x4E76C402, 0x4E770402, 0x4E774402, 0x4E778402,
+    0x4E77C402, 0x4E780402, 0x4E784402, 0x4E788402, 0x4E78C402, 0x4E790402, 0x4E794402, 0x4E798402,
+    0x4E79C402, 0x4E7A0402, 0x4E7A4402, 0x4E7A8402, 0x4E7AC402, 0x4E7B0402, 0x4E7B4402, 0x4E7B8402,
+    0x4E7BC402, 0x4E7C0402, 0x4E7C4402, 0x4E7C8402, 0x4E7CC402, 0x4E7D0402, 0x4E7D4402, 0x4E7D8402,
+    0x4E7DC402, 0x4E7E0402, 0x4E7E4402, 0x4E7E8402, 0x4E7EC402, 0x4E7F0402, 0x4E7F4402, 0x4E7F8402,
+    0x4E7FC402, 0x4E800402, 0x4E804402, 0x4E808402, 0x4E80C402, 0x4E810402, 0x4E814402, 0x4E818402,
+    0x4E81C402, 0x4E820402, 0x4E824402, 0x4E828402, 0x4E82C402, 0x4E830402, 0x4E834402, 0x4E838402,
+    0x4E83C402, 0x4E840402, 0x4E844402, 0x4E848402, 0x4E84C402, 0x4E850402, 0x4E854402, 0x4E858402,
+    0x4E85C402, 0x4E860402, 0x4E864402, 0x4E868402, 0x4E86C402, 0x4E870402, 0x4E874402, 0x4E878402,
+    0x4E87C402, 0x4E880402, 0x4E884402, 0x4E888402, 0x4E88C402, 0x4E890402, 0x4E894402, 0x4E898402,
+    0x4E89C402, 0x4E8A0402, 0x4E8A4402, 0x4E8A8402, 0x4E8AC402, 0x4E8B0402, 0x4E8B4402, 0x4E8B8402,
+    0x4E8BC402, 0x4E8C0402, 0x4E8C4402, 0x4E8C8402, 0x4E8CC402, 0x4E8D0402, 0x4E8D4402, 0x4E8D8402,
+    0x4E8DC402, 0x4E8E0402, 0x4E8E4402, 0x4E8E8402, 0x4E8EC402, 0x4E8F0402, 0x4E8F4402, 0x4E8F8402,
+    0x4E8FC402, 0x4E900402, 0x4E904402, 0x4E908402, 0x4E90C402, 0x4E910402, 0x4E914402, 0x4E918402,
+    0x4E91C402, 0x4E920402, 0x4E924402, 0x4E928402, 0x4E92C402, 0x4E930402, 0x4E934402, 0x4E938402,
+    0x4E93C402, 0x4E940402, 0x4E944402, 0x4E948402, 0x4E94C402, 0x4E950402, 0x4E954402, 0x4E958402,
+    0x4E95C402, 0x4E960402, 0x4E964402, 0x4E968402, 0x4E96C402, 0x4E970402, 0x4E974402, 0x4E978402,
+    0x4E97C402, 0x4E980402, 0x4E984402, 0x4E988402, 0x4E98C402, 0x4E990402, 0x4E994402, 0x4E998402,
+    0x4E99C402, 0x4E9A0402, 0x4E9A4402, 0x4E9A8402, 0x4E9AC402, 0x4E9B0402, 0x4E9B4402, 0x4E9B8402,
+    0x4E9BC402, 0x4E9C0402, 0x4E9C4402, 0x4E9C8402, 0x4E9CC402, 0x4E9D0402, 0x4E9D4402, 0x4E9D8402,
+    0x4E9DC402, 0x4E9E0402, 0x4E9E4402, 0x4E9E8402, 0x4E9EC402, 0x4E9F0402, 0x4E9F4402, 0x4E9F8402,
+    0x4E9FC402, 0x4EA00402, 0x4EA04402, 0x4EA08402, 0x4EA0C402, 0x4EA10402, 0x4EA14402, 0x4EA18402,
+    0x4EA1C402, 0x4EA20402, 0x4EA24402, 0x4EA28402, 0x4EA2C402, 0x4EA30402, 0x4EA34402, 0x4EA38402,
+    0x4EA3C402, 0x4EA40402, 0x4EA44402, 0x4EA48402, 0x4EA4C402, 0x4EA50402, 0x4EA54402, 0x4EA58402,
+    0x4EA5C402, 0x4EA60402, 0x4EA64402, 0x4EA68402, 0x4EA6C402, 0x4EA70402, 0x4EA74402, 0x4EA78402,
+    0x4EA7C402, 0x4EA80402, 0x4EA84402, 0x4EA88402, 0x4EA8C402, 0x4EA90402, 0x4EA94402, 0x4EA98402,
+    0x4EA9C402, 0x4EAA0402, 0x4EAA4402, 0x4EAA8402, 0x4EAAC402, 0x4EAB0402, 0x4EAB4402, 0x4EAB8402,
+    0x4EABC402, 0x4EAC0402, 0x4EAC4402, 0x4EAC8402, 0x4EACC402, 0x4EAD0402, 0x4EAD4402, 0x4EAD8402,
+    0x4EADC402, 0x4EAE0402, 0x4EAE4402, 0x4EAE8402, 0x4EAEC402, 0x4EAF0402, 0x4EAF4402, 0x4EAF8402,
+    0x4EAFC402, 0x4EB00402, 0x4EB04402, 0x4EB08402, 0x4EB0C402, 0x4EB10402, 0x4EB14402, 0x4EB18402,
+    0x4EB1C402, 0x4EB20402, 0x4EB24402, 0x4EB28402, 0x4EB2C402, 0x4EB30402, 0x4EB34402, 0x4EB38402,
+    0x4EB3C402, 0x4EB40402, 0x4EB44402, 0x4EB48402, 0x4EC14402, 0x4EB4C402, 0x4EB54402, 0x4EB58402,
+    0x4EB5C402, 0x4EB60402, 0x4EB64402, 0x4EB68402, 0x4EB6C402, 0x4EB70402, 0x4EB74402, 0x4EB78402,
+    0x4EB7C402, 0x4EB80402, 0x4EB84402, 0x4EB88402, 0x4EB8C402, 0x4EB90402, 0x4EB98402, 0x4EB9C402,
+    0x4EBA0402, 0x4EBA4402, 0x4EBA8402, 0x4EBAC402, 0x4EBB0402, 0x4EBB4402, 0x4EBD0402, 0x4EBD4402,
+    0x4EBD8402, 0x4EBDC402, 0x4EBE0402, 0x4EBE4402, 0x4EBE8402, 0x4EBEC402, 0x4EBF0402, 0x4EBF4402,
+    0x4EBF8402, 0x4EBFC402, 0x4EC00402, 0x4EC04402, 0x4EC08402, 0x4EC0C402, 0x4EC10402, 0x4EC18402,
+    0x4EC1C402, 0x4EC20402, 0x4EC24402, 0x4EC28402, 0x4EC2C402, 0x4EC30402, 0x4EC34402, 0x4EC38402,
+    0x4EC3C402, 0x4EC40402, 0x4EC44402, 0x4EC48402, 0x4EC4C402, 0x4EC50402, 0x4EC54402, 0x4EC58402,
+    0x4EC5C402, 0x4EC60402, 0x4EC64402, 0x4EC68402, 0x4EC6C402, 0x4EC70402, 0x4EC74402, 0x4EC78402,
+    0x4EC7C402, 0x4EC80402, 0x4EC84402, 0x4EC88402, 0x4EC8C402, 0x4EC90402, 0x4EC94402, 0x4EC98402,
+    0x4EC9C402, 0x4ECA0402, 0x4ECA4402, 0x4ECA8402, 0x4ECAC402, 0x4ECB0402, 0x4ECB4402, 0x4ECB8402,
+    0x4ECBC402, 0x4ECC0402, 0x4ECC4402, 0x4ECC8402, 0x4ECCC402, 0x4ECD0402, 0x4ECD4402, 0x4ECD8402,
+    0x4ECDC402, 0x4ECE0402, 0x4ECE4402, 0x4ECE8402, 0x4ECEC402, 0x4ECF0402, 0x4ECF4402, 0x4ECF8402,
+    0x4ECFC402, 0x4ED00402, 0x4ED04402, 0x4ED08402, 0x4ED0C402, 0x4ED10402, 0x4ED14402, 0x4ED18402,
+    0x4ED1C402, 0x4ED20402, 0x4ED24402, 0x4ED28402, 0x4ED2C402, 0x4ED30402, 0x4ED34402, 0x4ED38402,
+    0x4ED3C402, 0x4ED40402, 0x4ED44402, 0x4ED48402, 0x4ED4C402, 0x4ED50402, 0x4ED54402, 0x4ED58402,
+    0x4ED5C402, 0x4ED60402, 0x4ED64402, 0x4ED68402, 0x4ED6C402, 0x4ED70402, 0x4ED74402, 0x4ED78402,
+    0x4ED7C402, 0x4ED80402, 0x4ED84402, 0x4ED88402, 0x4ED8C402, 0x4ED90402, 0x4ED94402, 0x4ED98402,
+    0x4ED9C402, 0x4EDA0402, 0x4EDA4402, 0x4EDA8402, 0x4EDAC402, 0x4EDB0402, 0x4EDB4402, 0x4EDB8402,
+    0x4EDBC402, 0x4EDC0402, 0x4EDC4402, 0x4EDC8402, 0x4EDCC402, 0x4EDD0402, 0x4EDD4402, 0x4EDD8402,
+    0x4EDDC402, 0x4EDE0402, 0x4EDE4402, 0x4EDE8402, 0x4EDEC402, 0x4EDF0402, 0x4EDF4402, 0x4EDF8402,
+    0x4EDFC402, 0x4EE00402, 0x4EE04402, 0x4EE08402, 0x4EE0C402, 0x4EE10402, 0x4EE14402, 0x4EE18402,
+    0x4EE1C402, 0x4EE20402, 0x4EE24402, 0x4EE28402, 0x4EE2C402, 0x4EE30402, 0x4EE34402, 0x4EE38402,
+    0x4EE3C402, 0x4EE40402, 0x4EE44402, 0x4EE48402, 0x4EE4C402, 0x4EE50402, 0x4EE54402, 0x4EE58402,
+    0x4EE5C402, 0x4EE60402, 0x4EE64402, 0x4EE68402, 0x4EE6C402, 0x4EE70402, 0x4EE74402, 0x4EE78402,
+    0x4EE7C402, 0x4EE80402, 0x4EE84402, 0x4EE88402, 0x4EE8C402, 0x4EE90402, 0x4EE94402, 0x4EE98402,
+    0x4EE9C402, 0x4EEA0402, 0x4EEA4402, 0x4EEA8402, 0x4EEAC402, 0x4EEB0402, 0x4EEB4402, 0x4EEB8402,
+    0x4EEBC402, 0x4EEC0402, 0x4EEC4402, 0x4EEC8402, 0x4EECC402, 0x4EED0402, 0x4EED4402, 0x4EED8402,
+    0x4EEDC402, 0x4EEE0402, 0x4EEE4402, 0x4EEE8402, 0x4EEEC402, 0x4EEF0402, 0x4EEF4402, 0x4EEF8402,
+    0x4EEFC402, 0x4EF00402, 0x4EF04402, 0x4EF08402, 0x4EF0C402, 0x4EF10402, 0x4EF14402, 0x4EF18402,
+    0x4EF1C402, 0x4EF20402, 0x4EF24402, 0x4EF28402, 0x4EF2C402, 0x4165C402, 0x40A18402, 0x4EB50402,
+    0x4EB94402, 0x4EBB8402, 0x4EBBC402, 0x4EBC0402, 0x4EBC4402, 0x4EBC8402, 0x4EBCC402, 0x4EF30402,
+    0x4EF34402, 0x4EF38402, 0x4EF3C402, 0x4EF40402, 0x4EF44402, 0x4EF48402, 0x4EF4C402, 0x4EF50402,
+    0x40824404, 0x4F06C402, 0x4F070402, 0x4F074402, 0x4F078402, 0x4F07C402, 0x4F080402, 0x4F084402,
+    0x4F088402, 0x4F08C402, 0x4F090402, 0x4F094402, 0x4F098402, 0x4F09C402, 0x4F0A0402, 0x4F0A4402,
+    0x4F0A8402, 0x4F0AC402, 0x4F0B0402, 0x4F0B4402, 0x4F0B8402, 0x4F0BC402, 0x4F0C0402, 0x4F0C4402,
+    0x4F0C8402, 0x4F0CC402, 0x4F0D0402, 0x40CC8402, 0x40CCC402, 0x00000000, 0x00000000, 0x00000000,
+    0x4F0D4402, 0x80015262, 0x4F0D8402, 0x4F168402, 0x800152A2, 0x800152E2, 0x4F0DC402, 0x80015322,
+    0x4F0E0402, 0x80015362, 0x4F158402, 0x4F160402, 0x800153A2, 0x800153E2, 0x80015422, 0x4F0E8402,
+    0x4F0EC402, 0x4F0F0402, 0x4F0F4402, 0x80015462, 0x800154A2, 0x800154E2, 0x80015522, 0x4F0FC402,
+    0x4F174402, 0x4F100402, 0x4F104402, 0x80015562, 0x800155A2, 0x800155E2, 0x4F108402, 0x80015622,
+    0x80015662, 0x4F10C402, 0x800156A2, 0x4F114402, 0x800156E2, 0x4F118402, 0x80015722, 0x4F11C402,
+    0x4F120402, 0x4F124402, 0x4F128402, 0x80015762, 0x800157A2, 0x800157E2, 0x80015822, 0x4F130402,
+    0x80015862, 0x800158A2, 0x4F134402, 0x800158E2, 0x80015922, 0x80015962, 0x4F138402, 0x4F140402,
+    0x800159A2, 0x800159E2, 0x4F144402, 0x80015A22, 0x4F148402, 0x80015A62, 0x4F14C402, 0x4F150402,
+    0x4F16C402, 0x4F17C402, 0x4F180402, 0x4F170402, 0x4F178402, 0x4F184402, 0x4F188402, 0x80015AA2,
+    0x80015AE2, 0x80015B22, 0x80015B62, 0x4098C402, 0x40990402, 0x40994402, 0x80015BA2, 0x80015BE4,
+    0x80015C62, 0x4F0F8402, 0x4F12C402, 0x4F154402, 0x4F0E4402, 0x4F110402, 0x4F13C402, 0x4F15C402,
+    0x4F164402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D218402, 0x4D21C402, 0x4D220402, 0x4D224402, 0x4D228402, 0x4D22C402, 0x4D230402, 0x4D234402,
+    0x4D238402, 0x4D23C402, 0x4D240402, 0x4D244402, 0x4D248402, 0x00000000, 0x4D24C402, 0x4D250402,
+    0x4D254402, 0x4D258402, 0x4D25C402, 0x4D260402, 0x4D264402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D268402, 0x4D26C402, 0x4D270402, 0x4D274402, 0x4D278402, 0x4D27C402, 0x4D280402, 0x4D284402,
+    0x4D288402, 0x4D28C402, 0x4D290402, 0x4D294402, 0x4D298402, 0x4D29C402, 0x4D2A0402, 0x4D2A4402,
+    0x4D2A8402, 0x4D2AC402, 0x4D2B0402, 0x4D2B4402, 0x4D2B8402, 0x40A78402, 0x40A7C402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D2BC402, 0x4D2C0402, 0x4D2C4402, 0x4D2C8402, 0x4D2CC402, 0x4D2D0402, 0x4D2D4402, 0x4D2D8402,
+    0x4D2DC402, 0x4D2E0402, 0x4D2E4402, 0x4D2E8402, 0x4D2EC402, 0x4D2F0402, 0x4D2F4402, 0x4D2F8402,
+    0x4D2FC402, 0x4D300402, 0x4D304402, 0x4D308402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D30C402, 0x4D310402, 0x4D314402, 0x4D318402, 0x4D31C402, 0x4D320402, 0x4D324402, 0x4D328402,
+    0x4D32C402, 0x4D330402, 0x4D334402, 0x4D338402, 0x4D33C402, 0x00000000, 0x4D340402, 0x4D344402,
+    0x4D348402, 0x00000000, 0x4D34C402, 0x4D350402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D9D4402, 0x4D9D8402, 0x4D9DC402, 0x4D9E0402, 0x4D9E4402, 0x4D9E8402, 0x4D9EC402, 0x4D9F0402,
+    0x4D9F4402, 0x4D9F8402, 0x4D9FC402, 0x4DA00402, 0x4DA04402, 0x4DA08402, 0x4DA0C402, 0x4DA10402,
+    0x4DA14402, 0x4DA18402, 0x4DA1C402, 0x4DA20402, 0x4DA24402, 0x4DA28402, 0x4DA2C402, 0x4DA30402,
+    0x4DA34402, 0x4DA38402, 0x4DA3C402, 0x4DA40402, 0x4DA44402, 0x4DA48402, 0x4DA4C402, 0x4DA50402,
+    0x4DA54402, 0x4DA58402, 0x4DA5C402, 0x4DA64402, 0x4DA68402, 0x4DA6C402, 0x4DA70402, 0x4DA74402,
+    0x4DA78402, 0x4DA7C402, 0x4DA80402, 0x4DA84402, 0x4DA88402, 0x4DA8C402, 0x4DA90402, 0x4DA94402,
+    0x4DA98402, 0x4DA9C402, 0x4DAA0402, 0x4DAA4402, 0x40000000, 0x40000000, 0x4DAA8402, 0x4DAAC402,
+    0x4DAB0402, 0x4DAB4402, 0x4DAB8402, 0x4DABC402, 0x4DAC0402, 0x4DAC4402, 0x4DAC8402, 0x4DACC402,
+    0x4DAD0402, 0x4DAD4402, 0x4DAD8402, 0x4DADC402, 0x4DAE0402, 0x4DAE4402, 0x40001882, 0x400018A2,
+    0x40001D02, 0x40001D22, 0x40001D42, 0x40000662, 0x40000662, 0x40000662, 0x40000662, 0x40000662,
+    0x40000662, 0x40000662, 0x4DAE8402, 0x40000000, 0x40A8C402, 0x40A90402, 0x40980402, 0x47D2C402,
+    0x410FC402, 0x41100402, 0x41104402, 0x47DD8402, 0x4DA60402, 0x40000662, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40FC8402, 0x409FC402, 0x408C0402, 0x40A10402, 0x40974402, 0x40978402, 0x40844402, 0x40848402,
+    0x408C4402, 0x40A14402, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4E0F8402, 0x4E100402, 0x4E10C402, 0x4E124402, 0x4E12C402, 0x4E138402, 0x4E140402, 0x4E14C402,
+    0x4E150402, 0x4E154402, 0x4E168402, 0x4E170402, 0x4E17C402, 0x4E184402, 0x4E198402, 0x4E1A0402,
+    0x4E1A4402, 0x4E1A8402, 0x4E1C4402, 0x4E1D0402, 0x4E1DC402, 0x4E1F4402, 0x4E204402, 0x4E210402,
+    0x4E218402, 0x4E220402, 0x4E22C402, 0x4E240402, 0x4E244402, 0x4E250402, 0x4E260402, 0x4E26C402,
+    0x4E270402, 0x4E274402, 0x4E278402, 0x4E0F4402, 0x4E104402, 0x4E110402, 0x4E128402, 0x4E130402,
+    0x4E13C402, 0x4E144402, 0x4E158402, 0x4E16C402, 0x4E174402, 0x4E180402, 0x4E188402, 0x4E19C402,
+    0x4E1C8402, 0x4E1D4402, 0x4E1E0402, 0x4E1F8402, 0x4E248402, 0x4E208402, 0x4E21C402, 0x4E230402,
+    0x4E258402, 0x4E264402, 0x4E27C402, 0x4E280402, 0x4E1EC402, 0x4E108402, 0x4E114402, 0x4E120402,
+    0x4E148402, 0x4E134402, 0x4E15C402, 0x4E234402, 0x4E18C402, 0x4E194402, 0x4E178402, 0x4E1AC402,
+    0x4E1CC402, 0x4E1D8402, 0x4E1FC402, 0x4E224402, 0x4E25C402, 0x4E268402, 0x4E24C402, 0x4E254402,
+    0x4E284402, 0x4E1E4402, 0x4E20C402, 0x4E118402, 0x4E238402, 0x4E214402, 0x4E228402, 0x4E200402,
+    0x4E1E8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4E0D8402, 0x4E0DC402, 0x4E0E0402, 0x4E0E4402, 0x4E0E8402, 0x4E0EC402, 0x4E0F0402, 0x4E0FC402,
+    0x4E11C402, 0x4E23C402, 0x4E160402, 0x4E1F0402, 0x4E288402, 0x4E290402, 0x4E294402, 0x4E29C402,
+    0x4E2A0402, 0x4E2AC402, 0x4E2B4402, 0x4E2B8402, 0x4E2C0402, 0x4E2C8402, 0x4E2D0402, 0x4E2D4402,
+    0x4E2A4402, 0x4E2CC402, 0x4E190402, 0x4E164402, 0x4E1B0402, 0x4E1B4402, 0x4E28C402, 0x4E298402,
+    0x4E2A8402, 0x4E2B0402, 0x4E1B8402, 0x4E2C4402, 0x4E1BC402, 0x4E1C0402, 0x4E2D8402, 0x4E2DC402,
+    0x4E2BC402, 0x4E2E4402, 0x4E2E0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4EF54402, 0x4EF58402, 0x4EF5C402, 0x4EF60402, 0x4EF64402, 0x4EF68402, 0x4EF6C402, 0x4EF70402,
+    0x4EF74402, 0x4EF78402, 0x4EF7C402, 0x4EF80402, 0x4EF84402, 0x4EF88402, 0x4EF8C402, 0x4EF90402,
+    0x4EF94402, 0x4EF98402, 0x4EF9C402, 0x4EFA0402, 0x4EFA4402, 0x4EFA8402, 0x4EFAC402, 0x4EFB0402,
+    0x4EFB4402, 0x4EFB8402, 0x4EFBC402, 0x4EFC0402, 0x4EFC4402, 0x4EFC8402, 0x4EFCC402, 0x4EFD0402,
+    0x4EFD4402, 0x4EFD8402, 0x4EFDC402, 0x4EFE0402, 0x4EFE4402, 0x4EFE8402, 0x4EFEC402, 0x4EFF0402,
+    0x4EFF4402, 0x4EFF8402, 0x4EFFC402, 0x4F000402, 0x4F004402, 0x4F008402, 0x4F00C402, 0x4F010402,
+    0x4F014402, 0x4F018402, 0x4F01C402, 0x4F020402, 0x4F024402, 0x4F028402, 0x4F02C402, 0x4F030402,
+    0x4F034402, 0x4F038402, 0x4F03C402, 0x4F040402, 0x4F044402, 0x4F048402, 0x4F04C402, 0x4F050402,
+    0x4F054402, 0x4F058402, 0x4F05C402, 0x4F060402, 0x4F064402, 0x4F068402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D150402, 0x4D154402, 0x4D158402, 0x4D15C402, 0x4D160402, 0x4D164402, 0x4D168402, 0x4D16C402,
+    0x4D170402, 0x4D174402, 0x4D178402, 0x4D17C402, 0x4D180402, 0x4D184402, 0x4D188402, 0x4D18C402,
+    0x4D190402, 0x4D194402, 0x4D198402, 0x4D19C402, 0x4D1A0402, 0x4D1A4402, 0x4D1A8402, 0x4D1AC402,
+    0x4D1B0402, 0x4D1B4402, 0x4D1B8402, 0x4D1BC402, 0x4D1C0402, 0x80015CA2, 0x80015CE2, 0x00000000,
+    0x4D1C4402, 0x4D1C8402, 0x4D1CC402, 0x4D1D0402, 0x4D1D4402, 0x4D1D8402, 0x4D1DC402, 0x4D1E0402,
+    0x4D1E4402, 0x4D1E8402, 0x4D1EC402, 0x4D1F0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D1F4402, 0x4D1F8402, 0x4D1FC402, 0x4D200402, 0x4D204402, 0x4D208402, 0x4D20C402, 0x4D210402,
+    0x4D214402, 0x40001E62, 0x40001E82, 0x40001EA2, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x41660402, 0x00000000, 0x00000000, 0x00000000, 0x409AC402, 0x409D0402, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x4DAEC402, 0x4DAF0402, 0x4DAF4402, 0x4DAF8402, 0x4DAFC402, 0x4DB00402, 0x4DB04402, 0x4DB08402,
+    0x4DB0C402, 0x4DB10402, 0x4DB14402, 0x4DB18402, 0x4DB1C402, 0x4DB20402, 0x4DB24402, 0x4DB28402,
+    0x4DB2C402, 0x4DB30402, 0x4DB34402, 0x4DB38402, 0x4DB3C402, 0x4DB40402, 0x4DB44402, 0x4DB48402,
+    0x4DB4C402, 0x4DB50402, 0x4DB54402, 0x4DB58402, 0x4DB5C402, 0x4DB60402, 0x00000000, 0x00000000,
+    0x4DB64402, 0x4DB68402, 0x4DB6C402, 0x4DB70402, 0x4DB74402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4DB78402, 0x4DB7C402, 0x4DB80402, 0x4DB84402, 0x4DB88402, 0x4DB8C402, 0x4DB90402, 0x4DB94402,
+    0x4DB98402, 0x4DB9C402, 0x4DBA0402, 0x4DBA4402, 0x4DBA8402, 0x4DBAC402, 0x4DBB0402, 0x4DBB4402,
+    0x4DBB8402, 0x4DBBC402, 0x4DBC0402, 0x4DBC4402, 0x4DBC8402, 0x4DBCC402, 0x4DBD0402, 0x4DBD4402,
+    0x4DBD8402, 0x4DBDC402, 0x4DBE0402, 0x4DBE4402, 0x4DBE8402, 0x4DBEC402, 0x4DBF0402, 0x4DBF4402,
+    0x4DBF8402, 0x4DBFC402, 0x4DC00402, 0x4DC04402, 0x4DC08402, 0x4DC0C402, 0x4DC10402, 0x4DC14402,
+    0x4DC18402, 0x4DC1C402, 0x4DC20402, 0x4DC24402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4DC28402, 0x4DC2C402, 0x4DC30402, 0x4DC34402, 0x4DC38402, 0xC00086AD, 0xC00091ED, 0xC0009D2D,
+    0x4DC48402, 0x4DC4C402, 0xC000A86D, 0x4DC54402, 0x4DC58402, 0x4DC5C402, 0x4DC60402, 0x4DC64402,
+    0x4DC68402, 0x4DC6C402, 0x4DC70402, 0x4DC74402, 0x4DC78402, 0x4DC7C402, 0x4DC80402, 0x4DC84402,
+    0x4DC88402, 0x4DC8C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47E64402, 0x00000000, 0x00000000, 0x00000000, 0x80015D22, 0x80015D63,
+    0x4167C402, 0x41680402, 0x41684402, 0x41688402, 0x4168C402, 0x41690402, 0x41694402, 0x41698402,
+    0x4169C402, 0x416A0402, 0x416A4402, 0x416A8402, 0x416AC402, 0x416B0402, 0x416B4402, 0x416B8402,
+    0x416BC402, 0x416C0402, 0x416C4402, 0x416C8402, 0x416CC402, 0x416D0402, 0x416D4402, 0x416D8402,
+    0x416DC402, 0x416E0402, 0x416E4402, 0x416E8402, 0x416EC402, 0x416F0402, 0x416F4402, 0x416F8402,
+    0x4D354402, 0x4D358402, 0x4D35C402, 0x4D360402, 0x4D364402, 0x4D368402, 0x4D36C402, 0x4D370402,
+    0x4D374402, 0x4D378402, 0x4D37C402, 0x4D380402, 0x4D384402, 0x4D388402, 0x4D38C402, 0x4D390402,
+    0x4D394402, 0x4D398402, 0x4D39C402, 0x4D3A0402, 0x4D3A4402, 0x4D3A8402, 0x4D3AC402, 0x4D3B0402,
+    0x4D3B4402, 0x4D3B8402, 0x4D3BC402, 0x4D3C0402, 0x00000000, 0x00000000, 0x40B48402, 0x40B4C402,
+    0x4DC90402, 0x4DC94402, 0x4DC98402, 0x4DC9C402, 0x4DCA0402, 0x4DCA4402, 0x4DCA8402, 0x4DCAC402,
+    0x4DCB0402, 0x4DCB4402, 0x4DCB8402, 0x4DCBC402, 0x4DCC0402, 0x4DCC4402, 0x4DCC8402, 0x4DCCC402,
+    0x4DCD0402, 0x4DCD4402, 0x4DCD8402, 0x4DCDC402, 0x4DCE0402, 0x4DCE4402, 0x4DCE8402, 0x4DCEC402,
+    0x4DCF0402, 0x4DCF4402, 0x4DCF8402, 0x4DCFC402, 0x4DD00402, 0x4DD04402, 0x4DD08402, 0x4DD0C402,
+    0x4DD10402, 0x4DD14402, 0x4DD18402, 0x4DD1C402, 0x4DD20402, 0x4DD24402, 0x4DD28402, 0x4DD2C402,
+    0x4DD30402, 0x4DD34402, 0x4DD38402, 0x4DD3C402, 0x4DD40402, 0x4DD64402, 0x4DD68402, 0x4DD6C402,
+    0x4DD70402, 0x4DD74402, 0x4DD78402, 0x4DD44402, 0x80015DC3, 0x4DD4C402, 0x4DD50402, 0x4DD54402,
+    0x4DCA8404, 0x4DCA8404, 0x4DCFC404, 0x4DCFC404, 0x4DD58402, 0x4DD5C402, 0x4DD60402, 0x00000000,
+    0x4DDC0402, 0x4DD7C402, 0x4DD84402, 0x4DD88402, 0x4DD88404, 0x4DD8C402, 0x4DD90402, 0x4DD94402,
+    0x4DD98402, 0x4DD9C402, 0x4DDA0402, 0x4DD48402, 0x4DD80402, 0x4DDBC402, 0x4DDA4402, 0x4DDA8402,
+    0x4DDB0402, 0x4DDB4402, 0x4DDB8402, 0x4DDAC402, 0x40001882, 0x40001D62, 0x40001D82, 0x40001DA2,
+    0x40001DC2, 0x40001DE2, 0x40001E02, 0x40001E22, 0x40001E42, 0x00000000, 0x00000000, 0x40000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x41108402, 0x4110C402, 0x41110402, 0x41114402, 0x41118402, 0x4111C402, 0x41120402, 0x47D30402,
+    0x40A94402, 0x40A98402, 0x40A9C402, 0x40AA0402, 0x41124402, 0x41128402, 0x00000000, 0x00000000,
+    0x40000662, 0x40000662, 0x40000662, 0x40000662, 0x40000662, 0x40000682, 0x40000682, 0x40000682,
+    0x40000682, 0x40000682, 0x40000682, 0x40000662, 0x40000662, 0x40000682, 0x400006C2, 0x48964404,
+    0x48980404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001862, 0x40001862, 0x40001882, 0x40001922, 0x400018A2, 0xC000B382, 0x4DEDC402, 0xC000B402,
+    0x4DEE4402, 0xC000B482, 0x4DEEC402, 0xC000B502, 0x4DEF4402, 0xC000B582, 0x4DEFC402, 0x4DF00402,
+    0x4DF04402, 0xC000B602, 0x4DF0C402, 0x4DF10402, 0x4DF1C402, 0x4DF20402, 0x4DF24402, 0x4DF28402,
+    0x4DF2C402, 0x4DF30402, 0x4DF34402, 0x4DF38402, 0x4DF3C402, 0x4DF40402, 0x4DF44402, 0x4DF48402,
+    0x4DF4C402, 0x4DF50402, 0x4DF54402, 0x4DF5C402, 0x4DF60402, 0x4DF64402, 0x4DF68402, 0x4DF6C402,
+    0x4DF74402, 0x4DF78402, 0x4DF7C402, 0x4DF80402, 0x4DF84402, 0x4DF88402, 0x4DF8C402, 0x4DF90402,
+    0x4DF98402, 0x4DF9C402, 0x4DFA0402, 0x4DFAC402, 0x40001842, 0x4DFB0402, 0x4DFB4402, 0x4DFB8402,
+    0x4DFBC402, 0x4DFC0402, 0xC000B682, 0x4DFC8402, 0xC000B702, 0x4DFD0402, 0xC000B782, 0xC000B802,
+    0x4DFDC402, 0x4DFE0402, 0xC000B882, 0x4DFE8402, 0x4DFEC402, 0x4DF14402, 0x4DF18402, 0x4DF58402,
+    0x4DF70402, 0x4DF94402, 0x4DFA4402, 0x4DFA8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x40B50402, 0x40B54402, 0x40A1C402, 0x40984402, 0x40AA4402, 0x40AA8402,
+    0x40840402, 0x416FC402, 0x41700402, 0x41704402, 0x41708402, 0x4170C402, 0x41710402, 0x41714402,
+    0x41718402, 0x4171C402, 0x41720402, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x41724402, 0x41728402, 0x4172C402, 0x41730402,
+    0x41734402, 0x41738402, 0x4173C402, 0x41740402, 0x41744402, 0x00000000, 0x00000000, 0x00000000,
+    0x40001882, 0x40001962, 0x400018A2, 0x4C4E8402, 0x4C4EC402, 0x4C4F0402, 0x4C4F4402, 0x4C4F8402,
+    0x4C4FC402, 0x4C500402, 0x4C504402, 0x4C50C402, 0x4C510402, 0x4C514402, 0x4C518402, 0x4C51C402,
+    0x4C520402, 0x4C524402, 0x4C528402, 0x4C52C402, 0x4C530402, 0x4C534402, 0x4C538402, 0x4C53C402,
+    0x4C540402, 0x4C548402, 0x4C550402, 0x4C558402, 0x4C564402, 0x4C570402, 0x4C578402, 0x4C57C402,
+    0x4C584402, 0x4C554402, 0x4C55C402, 0x4C568402, 0x4C588402, 0x4C58C402, 0x4C590402, 0x4C594402,
+    0x4C598402, 0x4C59C402, 0x4C5A0402, 0x4C5A4402, 0x4C54C402, 0x4C574402, 0x4C508402, 0x4C580402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4C4E8404, 0x4C560402, 0x4C56C402, 0x4C544402, 0x4C504419, 0x4C548419,
+    0x4D420402, 0x4D420404, 0x4D424402, 0x4D424404, 0x4D424404, 0x4D428402, 0x4D428404, 0x4D42C402,
+    0x4D42C404, 0x4D430402, 0x4D430404, 0x4D434402, 0x4D434404, 0x4D434404, 0x4D438402, 0x4D438404,
+    0x4D43C402, 0x4D440402, 0x4D444402, 0x4D444404, 0x4D448402, 0x4D448404, 0x4D44C402, 0x4D44C404,
+    0x4D450402, 0x4D450404, 0x4D450404, 0x4D454402, 0x4D454404, 0x4D458402, 0x4D45C402, 0x4D45C404,
+    0x4D460402, 0x4D464402, 0x4D468402, 0x4D46C402, 0x4D470402, 0x4D474402, 0x40001842, 0x4D478402,
+    0x4D478404, 0x4D47C402, 0x4D480402, 0x4D480404, 0x4D484402, 0x4D484404, 0x4D488402, 0x4D488404,
+    0x4D48C402, 0x4D490402, 0x4D494402, 0x4D498402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x41158402, 0x4115C402, 0x41160402, 0x41164402,
+    0x4CF98402, 0x4CF9C402, 0x4CFA0402, 0x4CFA4402, 0x4CFA8402, 0x4CFAC402, 0x4CFB0402, 0x4CFB4402,
+    0x4CFB8402, 0x4CFBC402, 0x4CFCC402, 0x4CFD0402, 0x4CFD4402, 0x4CFD8402, 0x4CFDC402, 0x4CFE0402,
+    0x4CFE4402, 0x4CFE8402, 0x4CFEC402, 0x4CFF0402, 0x4CFF4402, 0x4CFF8402, 0x4CFFC402, 0x4D000402,
+    0x4D004402, 0x4D008402, 0x4D00C402, 0x4D014402, 0x4D01C402, 0x4D020402, 0x4D024402, 0x4D028402,
+    0x4D02C402, 0x4D030402, 0x4D034402, 0x4D038402, 0x4D010402, 0x4D018402, 0x4D040402, 0x4D044402,
+    0x4D048402, 0x4D04C402, 0x4D050402, 0x4D054402, 0x4D058402, 0x4D05C402, 0x4D060402, 0x4D064402,
+    0x4D068402, 0x4D06C402, 0x4D070402, 0x4D074402, 0x4D078402, 0x4D07C402, 0x4D03C402, 0x40001842,
+    0x00000000, 0x00000000, 0x00000000, 0x40A68402, 0x40A6C402, 0x410E0402, 0x410E4402, 0x410E8402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x4CFC0402, 0x4CFC4402, 0x4CFC8402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4E2E8402, 0x4E2EC402, 0x4E2F0402, 0x4E2F4402, 0x4E2F8402, 0x4E2FC402,
+    0x4E300402, 0x4E304402, 0x4E308402, 0x4E30C402, 0x4E310402, 0x4E314402, 0x4E318402, 0x4E31C402,
+    0x4E320402, 0x4E324402, 0x4E328402, 0x4E32C402, 0x4E330402, 0x4E334402, 0x4E338402, 0x4E33C402,
+    0x4E340402, 0x4E344402, 0x4E348402, 0x4E34C402, 0x4E350402, 0x4E354402, 0x4E358402, 0x4E35C402,
+    0x4E360402, 0x4E364402, 0x4E368402, 0x4E36C402, 0x4E370402, 0x4E374402, 0x40B2C402, 0x40B30402,
+    0x48E5C404, 0x48EBC404, 0x49130404, 0x491A8404, 0x491CC404, 0x491CC404, 0x493D0404, 0x49414404,
+    0x49238404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4967C408, 0x49684408, 0x4968C408, 0x49694408, 0x4969C408, 0x496A4408, 0x496AC408, 0x496BC408,
+    0x496C4408, 0x496CC408, 0x496D4408, 0x496DC408, 0x496E4408, 0x496F4408, 0x496FC408, 0x49704408,
+    0x4970C408, 0x49714408, 0x4971C408, 0x4972C408, 0x49734408, 0x4973C408, 0x49744408, 0x4974C408,
+    0x49754408, 0x4975C408, 0x49764408, 0x4976C408, 0x49774408, 0x4977C408, 0x49784408, 0x49794408,
+    0x4979C408, 0x496B4408, 0x496EC408, 0x49724408, 0x4978C408, 0x497A4408, 0x497AC408, 0x497B0408,
+    0x497B8408, 0x497BC408, 0x497C0408, 0x00000000, 0x00000000, 0x497C4408, 0x497CC408, 0x497D0408,
+    0x4112C402, 0x41130402, 0x41134402, 0x41138402, 0x4113C402, 0x41140402, 0x41144402, 0x41148402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x4A878402, 0x4A878404, 0x4A878404, 0x4A878404, 0x40001882, 0x4A878404, 0x4A878404,
+    0x4A878404, 0x4A878404, 0x400018A2, 0x400018A2, 0x40000000, 0x4A87C402, 0x4A880402, 0x40000000,
+    0x40000000, 0x40000000, 0x4A878404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E98402, 0x47EA8402, 0x47EAC402, 0x47F24402, 0x47F68402, 0x47FBC402, 0x47FC0402, 0x4802C402,
+    0x480C4402, 0x48278402, 0x482CC402, 0x48320402, 0x4837C402, 0x48434402, 0x48484402, 0x48500402,
+    0x4854C402, 0x48504402, 0x48550402, 0x48534402, 0x4851C402, 0x485A8402, 0x48564402, 0x48568402,
+    0x485BC402, 0x48678402, 0x486A0402, 0x487EC402, 0x4886C402, 0x48874402, 0x48878402, 0x488F4402,
+    0x4892C402, 0x48974402, 0x48A28402, 0x48A9C402, 0x48BBC402, 0x48BC0402, 0x48C84402, 0x48CBC402,
+    0x48CD4402, 0x48CE8402, 0x48D14402, 0x49064402, 0x47E8841D, 0x80015E23, 0x47EF041D, 0x47F20402,
+    0x47FAC41D, 0x4801C41D, 0x4805441D, 0x4814441D, 0x481D441D, 0x4824041D, 0x482AC41D, 0x4831041D,
+    0x4835841D, 0x4842441D, 0x4846041D, 0x48480402, 0x484F041D, 0x4859841D, 0x485AC41D, 0x4864C41D,
+    0x487DC41D, 0x4885C41D, 0x4896441D, 0x47E88414, 0x47EB4414, 0x47EC4414, 0x47EAC414, 0x47EF0414,
+    0x47FAC414, 0x4801C414, 0x48068414, 0x4807C414, 0x480C4414, 0x48144414, 0x48278414, 0x48310414,
+    0x48424414, 0x484DC414, 0x484F0414, 0x4853C414, 0x48564414, 0x48568414, 0x485AC414, 0x487DC414,
+    0x4885C414, 0x48874414, 0x488E0414, 0x4891C414, 0x48BC0414, 0x48C7C414, 0x48C80414, 0x48C88414,
+    0x48D08414, 0x48D0C414, 0x48240415, 0x4864C415, 0x4885C415, 0x4891C415, 0x48C7C415, 0x48C80415,
+    0x48CE4415, 0x48D08415, 0x48D0C415, 0x4887C402, 0x47F28402, 0x47FC8402, 0x48124402, 0x48438402,
+    0x48488402, 0x485C8402, 0x4868C402, 0x48700402, 0x48760402, 0x48804402, 0x48A3C402, 0x481AC402,
+    0x490C4414, 0x80015E82, 0x80015EC3, 0x4828C402, 0x482A8402, 0x485C0402, 0x488A0402, 0x48918402,
+    0x47F30402, 0x47FCC402, 0x48128402, 0x48188402, 0x48324402, 0x483C4402, 0x4843C402, 0x484B0402,
+    0x485CC402, 0x486B4402, 0x48764402, 0x487A4402, 0x48934402, 0x489A0402, 0x48A40402, 0x47EA0402,
+    0x47ED8402, 0x47FF0402, 0x48048402, 0x4808C402, 0x480C0402, 0x48078402, 0x48290402, 0x48558402,
+    0x487C8402, 0x488A4402, 0x48AB0402, 0x47EDC414, 0x47F58414, 0x47F94414, 0x80015F22, 0x480B0414,
+    0x48108414, 0x482F0414, 0x48154414, 0x488B0414, 0x4827C414, 0x48298414, 0x48260414, 0x4828C414,
+    0x482E0414, 0x483C8414, 0x483C4414, 0x48368414, 0x48440414, 0x488F8414, 0x4848C414, 0x484B4414,
+    0x48470414, 0x48570414, 0x485EC414, 0x48768414, 0x48790414, 0x48808414, 0x48888414, 0x48908414,
+    0x4886C414, 0x48938414, 0x48954414, 0x48A18414, 0x48A54414, 0x48A64414, 0x48A8C414, 0x48CA8414,
+    0x40000662, 0x40000662, 0x40000682, 0x40000662, 0x40000662, 0x40000662, 0x40000662, 0x40000662,
+    0x40000662, 0x40000662, 0x4864C404, 0x40000662, 0x40000662, 0x40000662, 0x40000662, 0x40000682,
+    0x40000682, 0x40000662, 0x48B14404, 0x80015F62, 0x8000E5E3, 0x80015FA2, 0x80015FE2, 0x80016022,
+    0x80016062, 0x8000E882, 0x48144404, 0x48168404, 0x48310404, 0x48358404, 0x48368404, 0x48434404,
+    0x48460404, 0x48470404, 0x48660404, 0x48674404, 0x48748404, 0x80010A02, 0x48A18404, 0x47EC4404,
+    0x47EF0404, 0x47F54404, 0x48068404, 0x48108404, 0x483A8404, 0x800160A2, 0x485AC404, 0x48790404,
+    0x800160E2, 0x48964404, 0x80016122, 0x80016162, 0x800161A2, 0x40000662, 0x40000662, 0x40000662,
+    0x40000662, 0x40000682, 0x00000000, 0x40000662, 0x40000682, 0x40000682, 0x40000662, 0x40000682,
+    0x800161E2, 0x80016222, 0x80016262, 0x800162A2, 0x800162E2, 0x80016322, 0x80016362, 0x800163A2,
+    0x800163E3, 0x80016443, 0x800164A2, 0x800164E2, 0x80016522, 0x80016562, 0x800165A2, 0x800165E2,
+    0x80016622, 0x80016662, 0x800166A2, 0x800166E2, 0x80016723, 0x80016783, 0x800167E3, 0x80016843,
+    0x800168A2, 0x800168E2, 0x80016922, 0x80016962, 0x800169A3, 0x80016A03, 0x80016A62, 0x80016AA2,
+    0x80016AE2, 0x80016B22, 0x80016B62, 0x80016BA2, 0x80016BE2, 0x80016C22, 0x80016C62, 0x80016CA2,
+    0x80016CE2, 0x80016D22, 0x80016D62, 0x80016DA2, 0x80016DE2, 0x80016E22, 0x80016E63, 0x80016EC3,
+    0x80016F22, 0x80016F62, 0x80016FA2, 0x80016FE2, 0x80017022, 0x80017062, 0x800170A2, 0x800170E2,
+    0x80017123, 0x80017183, 0x800171E2, 0x80017222, 0x80017262, 0x800172A2, 0x800172E2, 0x80017322,
+    0x80017362, 0x800173A2, 0x800173E2, 0x80017422, 0x80017462, 0x800174A2, 0x800174E2, 0x80017522,
+    0x80017562, 0x800175A2, 0x800175E2, 0x80017622, 0x80017663, 0x800176C3, 0x80017723, 0x80017783,
+    0x800177E3, 0x80017843, 0x800178A3, 0x80017903, 0x80017962, 0x800179A2, 0x800179E2, 0x80017A22,
+    0x80017A62, 0x80017AA2, 0x80017AE2, 0x80017B22, 0x80017B63, 0x80017BC3, 0x80017C22, 0x80017C62,
+    0x80017CA2, 0x80017CE2, 0x80017D22, 0x80017D62, 0x80017DA3, 0x80017E03, 0x80017E63, 0x80017EC3,
+    0x80017F23, 0x80017F83, 0x80017FE2, 0x80018022, 0x80018062, 0x800180A2, 0x800180E2, 0x80018122,
+    0x80018162, 0x800181A2, 0x800181E2, 0x80018222, 0x80018262, 0x800182A2, 0x800182E2, 0x80018322,
+    0x80018363, 0x800183C3, 0x80018423, 0x80018483, 0x800184E2, 0x80018522, 0x80018562, 0x800185A2,
+    0x800185E2, 0x80018622, 0x80018662, 0x800186A2, 0x800186E2, 0x80018722, 0x80018762, 0x800187A2,
+    0x800187E2, 0x80018822, 0x80018862, 0x800188A2, 0x800188E2, 0x80018922, 0x80018962, 0x800189A2,
+    0x800189E2, 0x80018A22, 0x80018A62, 0x80018AA2, 0x80018AE2, 0x80018B22, 0x80018B62, 0x80018BA2,
+    0x80018BE2, 0x80018C22, 0x80018C62, 0x80018CA3, 0x48788402, 0x4878C402, 0x80018D03, 0x48018402,
+    0x80018D62, 0x80018DA2, 0x80018DE2, 0x80018E22, 0x80018E63, 0x80018EC3, 0x80018F23, 0x80018F83,
+    0x80018FE3, 0x80019043, 0x800190A3, 0x80019103, 0x80019163, 0x800191C3, 0x80019223, 0x80019283,
+    0x800192E3, 0x80019343, 0x800193A3, 0x80019403, 0x80019463, 0x800194C3, 0x80019523, 0x80019583,
+    0x800195E2, 0x80019622, 0x80019662, 0x800196A2, 0x800196E2, 0x80019722, 0x80019763, 0x800197C3,
+    0x80019823, 0x80019883, 0x800198E3, 0x80019943, 0x800199A3, 0x80019A03, 0x80019A63, 0x80019AC3,
+    0x80019B22, 0x80019B62, 0x80019BA2, 0x80019BE2, 0x80019C22, 0x80019C62, 0x80019CA2, 0x80019CE2,
+    0x80019D23, 0x80019D83, 0x80019DE3, 0x80019E43, 0x80019EA3, 0x80019F03, 0x80019F63, 0x80019FC3,
+    0x8001A023, 0x8001A083, 0x8001A0E3, 0x8001A143, 0x8001A1A3, 0x8001A203, 0x8001A263, 0x8001A2C3,
+    0x8001A323, 0x8001A383, 0x8001A3E3, 0x8001A443, 0x8001A4A2, 0x8001A4E2, 0x8001A522, 0x8001A562,
+    0x8001A5A3, 0x8001A603, 0x8001A663, 0x8001A6C3, 0x8001A723, 0x8001A783, 0x8001A7E3, 0x8001A843,
+    0x8001A8A3, 0x8001A903, 0x8001A962, 0x8001A9A2, 0x8001A9E2, 0x8001AA22, 0x8001AA62, 0x8001AAA2,
+    0x8001AAE2, 0x8001AB22, 0x8001AB62, 0x8001ABA2, 0x48950408, 0x48950402, 0x48A00408, 0x48A00402,
+    0x8001ABE2, 0x8001AC22, 0x8001AC63, 0x8001ACC3, 0x8001AD23, 0x8001AD83, 0x8001ADE3, 0x8001AE43,
+    0x8001AEA2, 0x8001AEE2, 0x8001AF23, 0x8001AF83, 0x8001AFE3, 0x8001B043, 0x8001B0A3, 0x8001B103,
+    0x8001B162, 0x8001B1A2, 0x8001B1E3, 0x8001B243, 0x8001B2A3, 0x8001B303, 0x00000000, 0x00000000,
+    0x8001B362, 0x8001B3A2, 0x8001B3E3, 0x8001B443, 0x8001B4A3, 0x8001B503, 0x00000000, 0x00000000,
+    0x8001B562, 0x8001B5A2, 0x8001B5E3, 0x8001B643, 0x8001B6A3, 0x8001B703, 0x8001B763, 0x8001B7C3,
+    0x8001B822, 0x8001B862, 0x8001B8A3, 0x8001B903, 0x8001B963, 0x8001B9C3, 0x8001BA23, 0x8001BA83,
+    0x8001BAE2, 0x8001BB22, 0x8001BB63, 0x8001BBC3, 0x8001BC23, 0x8001BC83, 0x8001BCE3, 0x8001BD43,
+    0x8001BDA2, 0x8001BDE2, 0x8001BE23, 0x8001BE83, 0x8001BEE3, 0x8001BF43, 0x8001BFA3, 0x8001C003,
+    0x8001C062, 0x8001C0A2, 0x8001C0E3, 0x8001C143, 0x8001C1A3, 0x8001C203, 0x00000000, 0x00000000,
+    0x8001C262, 0x8001C2A2, 0x8001C2E3, 0x8001C343, 0x8001C3A3, 0x8001C403, 0x00000000, 0x00000000,
+    0x8001C462, 0x8001C4A2, 0x8001C4E3, 0x8001C543, 0x8001C5A3, 0x8001C603, 0x8001C663, 0x8001C6C3,
+    0x00000000, 0x8001C722, 0x00000000, 0x8001C763, 0x00000000, 0x8001C7C3, 0x00000000, 0x8001C823,
+    0x8001C882, 0x8001C8C2, 0x8001C903, 0x8001C963, 0x8001C9C3, 0x8001CA23, 0x8001CA83, 0x8001CAE3,
+    0x8001CB42, 0x8001CB82, 0x8001CBC3, 0x8001CC23, 0x8001CC83, 0x8001CCE3, 0x8001CD43, 0x8001CDA3,
+    0x8001CE02, 0x80012E42, 0x8001CE42, 0x80012E82, 0x8001CE82, 0x80012EC2, 0x8001CEC2, 0x80012F02,
+    0x8001CF02, 0x80013022, 0x8001CF42, 0x80013062, 0x8001CF82, 0x800130A2, 0x00000000, 0x00000000,
+    0x8001CFC3, 0x8001D023, 0x8001D084, 0x8001D104, 0x8001D184, 0x8001D204, 0x8001D284, 0x8001D304,
+    0x8001D383, 0x8001D3E3, 0x8001D444, 0x8001D4C4, 0x8001D544, 0x8001D5C4, 0x8001D644, 0x8001D6C4,
+    0x8001D743, 0x8001D7A3, 0x8001D804, 0x8001D884, 0x8001D904, 0x8001D984, 0x8001DA04, 0x8001DA84,
+    0x8001DB03, 0x8001DB63, 0x8001DBC4, 0x8001DC44, 0x8001DCC4, 0x8001DD44, 0x8001DDC4, 0x8001DE44,
+    0x8001DEC3, 0x8001DF23, 0x8001DF84, 0x8001E004, 0x8001E084, 0x8001E104, 0x8001E184, 0x8001E204,
+    0x8001E283, 0x8001E2E3, 0x8001E344, 0x8001E3C4, 0x8001E444, 0x8001E4C4, 0x8001E544, 0x8001E5C4,
+    0x8001E642, 0x8001E682, 0x8001E6C3, 0x8001E722, 0x8001E763, 0x00000000, 0x8001E7C2, 0x8001E803,
+    0x8001E862, 0x8001E8A2, 0x8001E8E2, 0x80012BA2, 0x8001E922, 0x41300402, 0x48CAC402, 0x41300402,
+    0x41308402, 0x8001E962, 0x8001E9A3, 0x8001EA02, 0x8001EA43, 0x00000000, 0x8001EAA2, 0x8001EAE3,
+    0x8001EB42, 0x80012BE2, 0x8001EB82, 0x80012C22, 0x8001EBC2, 0x8001EC02, 0x8001EC42, 0x8001EC82,
+    0x8001ECC2, 0x8001ED02, 0x8001ED43, 0x80012D63, 0x00000000, 0x00000000, 0x8001EDA2, 0x8001EDE3,
+    0x8001EE42, 0x8001EE82, 0x8001EEC2, 0x80012C62, 0x00000000, 0x8001EF02, 0x8001EF42, 0x8001EF82,
+    0x8001EFC2, 0x8001F002, 0x8001F043, 0x80012F43, 0x8001F0A2, 0x8001F0E2, 0x8001F122, 0x8001F163,
+    0x8001F1C2, 0x8001F202, 0x8001F242, 0x80012CE2, 0x8001F282, 0x8001F2C2, 0x80012B62, 0x412D0402,
+    0x00000000, 0x00000000, 0x8001F303, 0x8001F362, 0x8001F3A3, 0x00000000, 0x8001F402, 0x8001F443,
+    0x8001F4A2, 0x80012CA2, 0x8001F4E2, 0x80012D22, 0x8001F522, 0x412D4402, 0x41304402, 0x00000000,
+    0x40824404, 0x40824404, 0x40824404, 0x40824404, 0x40824404, 0x40824404, 0x40824404, 0x4082441B,
+    0x40824404, 0x40824404, 0x40824404, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x4084C402, 0x4084C41B, 0x40850402, 0x40854402, 0x40858402, 0x4085C402, 0x40E50402, 0x40830402,
+    0x40C5C402, 0x40C60402, 0x40C64402, 0x40C68402, 0x40C78402, 0x40C7C402, 0x40C80402, 0x40C84402,
+    0x40ECC402, 0x40ED0402, 0x40EE4402, 0x40EE8402, 0x409F8404, 0x8001F562, 0x8001F5A3, 0x40EEC402,
+    0x4081C402, 0x40820402, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x4082441B,
+    0x40EBC402, 0x40EC4402, 0x40EFC402, 0x8001F602, 0x8001F643, 0x40F00402, 0x8001F6A2, 0x8001F6E3,
+    0x40F0C402, 0x40C6C402, 0x40C70402, 0x40F10402, 0x8001F742, 0x409F0402, 0x40828402, 0x40F14402,
+    0x40F1C402, 0x40F24402, 0x40F28402, 0x40EF0402, 0x419D8402, 0x40CD0402, 0x40CD4402, 0x8001F782,
+    0x8001F7C2, 0x8001F802, 0x40EA8402, 0x40E74402, 0x40EF4402, 0x40EF8402, 0x40E88402, 0x408F0402,
+    0x40F20402, 0x40E8C402, 0x419C8402, 0x40868402, 0x40F18402, 0x40BE4402, 0x40BE8402, 0x8001F844,
+    0x40BEC402, 0x40BF0402, 0x40BF4402, 0x40BF8402, 0x40BFC402, 0x40C00402, 0x40C04402, 0x40824404,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x00000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x47E60414, 0x48240414, 0x00000000, 0x00000000, 0x47E70414, 0x47E74414, 0x47E78414, 0x47E7C414,
+    0x47E80414, 0x47E84414, 0x41998414, 0x419C4414, 0x419AC414, 0x40CA0414, 0x40CA4414, 0x48460414,
+    0x47E60415, 0x47E64415, 0x47E68415, 0x47E6C415, 0x47E70415, 0x47E74415, 0x47E78415, 0x47E7C415,
+    0x47E80415, 0x47E84415, 0x41998415, 0x419C4415, 0x419AC415, 0x40CA0415, 0x40CA4415, 0x00000000,
+    0x47E88415, 0x4801C415, 0x484F0415, 0x48990415, 0x48068415, 0x481D4415, 0x48310415, 0x48358415,
+    0x48424415, 0x48460415, 0x485AC415, 0x48748415, 0x487DC415, 0x00000000, 0x00000000, 0x00000000,
+    0x47DE0402, 0x47DE4402, 0x47DE8402, 0x47DEC402, 0x47DF0402, 0x47DF4402, 0x47DF8402, 0x47DFC402,
+    0x8001F8C2, 0x47E00402, 0x47E04402, 0x47E08402, 0x47E0C402, 0x47E10402, 0x47E14402, 0x47E18402,
+    0x47E1C402, 0x47E20402, 0x47E24402, 0x47E28402, 0x47E2C402, 0x47E30402, 0x47E34402, 0x47E38402,
+    0x47E3C402, 0x47E40402, 0x47E48402, 0x47E4C402, 0x47E50402, 0x47E54402, 0x47E58402, 0x47E5C402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40002122, 0x40002142, 0x40002162, 0x40002162, 0x40002182, 0x400021A2, 0x400021C2, 0x400021E2,
+    0x400006A2, 0x400006A2, 0x400006A2, 0x40002202, 0x40002222, 0x400006C2, 0x400006C2, 0x400006C2,
+    0x400006C2, 0x40002242, 0x400006C2, 0x400006C2, 0x400006C2, 0x400006A2, 0x40002262, 0x40002282,
+    0x400022A2, 0x400022C2, 0x400006A2, 0x400006A2, 0x40000682, 0x40000682, 0x40000682, 0x40000682,
+    0x40000662, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x8001F903, 0x8001F963, 0x47F5840B, 0x8001F9C2, 0x41758402, 0x8001FA03, 0x8001FA63, 0x4807C40A,
+    0x4175C402, 0x8001FAC2, 0x48144405, 0x481D440B, 0x481D440B, 0x481D440B, 0x481D4405, 0x8000F5C2,
+    0x4824040B, 0x4824040B, 0x4835840B, 0x48358405, 0x41760402, 0x4846040B, 0x8001FB02, 0x41764402,
+    0x41768402, 0x485AC40B, 0x4860040B, 0x4864C40B, 0x4864C40B, 0x4864C40B, 0x4176C402, 0x41770402,
+    0x8001FB42, 0x8001FB83, 0x8001FBE2, 0x41774402, 0x48A1840B, 0x41778402, 0x48D18408, 0x4177C402,
+    0x48A1840B, 0x41780402, 0x48310408, 0x8000DDE2, 0x47EF040B, 0x47F5840B, 0x41784402, 0x4801C405,
+    0x4801C40B, 0x4810840B, 0x4813C408, 0x4842440B, 0x484F0405, 0x49878404, 0x4987C404, 0x49880404,
+    0x49884404, 0x48240405, 0x41788402, 0x8001FC23, 0x48CD0405, 0x48C80405, 0x48C8040B, 0x48CD040B,
+    0x41994405, 0x4178C402, 0x41790402, 0x41794402, 0x41798402, 0x47FAC40B, 0x47FAC405, 0x4801C405,
+    0x48240405, 0x482AC405, 0x4179C402, 0x41C04402, 0x417A0402, 0x8001FC83, 0x4813C402, 0x417A4402,
+    0x8001FCE3, 0x8001FD43, 0x8001FDA4, 0x8001FE23, 0x8001FE83, 0x8001FEE3, 0x8001FF43, 0x8001FFA3,
+    0x80020003, 0x80020063, 0x800200C3, 0x80020123, 0x80020183, 0x800201E3, 0x80020243, 0x800202A2,
+    0x4824040A, 0x800202E2, 0x80020323, 0x80020382, 0x4891C40A, 0x800203C2, 0x80020403, 0x80020464,
+    0x800204E2, 0x4899040A, 0x80020522, 0x80020563, 0x4835840A, 0x47F5840A, 0x47FAC40A, 0x4842440A,
+    0x48240404, 0x800205C2, 0x80020603, 0x80020662, 0x4891C404, 0x800206A2, 0x800206E3, 0x80020744,
+    0x800207C2, 0x48990404, 0x80020802, 0x80020843, 0x48358404, 0x47F58404, 0x47FAC404, 0x48424404,
+    0x4766C402, 0x47670402, 0x47674402, 0x47FA4408, 0x47FA4402, 0x47E78402, 0x47678402, 0x4767C402,
+    0x47680402, 0x800208A3, 0x417A8402, 0x417AC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x417B0402, 0x417B8402, 0x417B4402, 0x417BC402, 0x417C0402, 0x417C4402, 0x417C8402, 0x417CC402,
+    0x417D0402, 0x417D4402, 0x80020902, 0x80020942, 0x417D8402, 0x417DC402, 0x417E0402, 0x417E4402,
+    0x417E8402, 0x417EC402, 0x417F0402, 0x417F4402, 0x417F8402, 0x417FC402, 0x41800402, 0x41804402,
+    0x41808402, 0x4180C402, 0x41810402, 0x41814402, 0x41818402, 0x4181C402, 0x80020982, 0x41820402,
+    0x41824402, 0x41828402, 0x4182C402, 0x41830402, 0x41834402, 0x41838402, 0x4183C402, 0x41840402,
+    0x41844402, 0x41848402, 0x4184C402, 0x41850402, 0x41854402, 0x41858402, 0x4185C402, 0x41860402,
+    0x41864402, 0x41868402, 0x4186C402, 0x41870402, 0x41874402, 0x41878402, 0x4187C402, 0x41880402,
+    0x41884402, 0x41888402, 0x4188C402, 0x41890402, 0x41894402, 0x800209C2, 0x80020A02, 0x80020A42,
+    0x41898402, 0x4189C402, 0x418A0402, 0x418A4402, 0x418A8402, 0x418AC402, 0x418B0402, 0x418B4402,
+    0x418B8402, 0x418BC402, 0x418C0402, 0x418C4402, 0x418C8402, 0x418CC402, 0x418D0402, 0x418D4402,
+    0x418D8402, 0x418DC402, 0x418E0402, 0x418E4402, 0x418E8402, 0x418EC402, 0x418F0402, 0x418F4402,
+    0x418F8402, 0x418FC402, 0x41900402, 0x41904402, 0x41908402, 0x4190C402, 0x41910402, 0x41914402,
+    0x41918402, 0x4191C402, 0x41920402, 0x41924402, 0x41928402, 0x4192C402, 0x41930402, 0x41934402,
+    0x41938402, 0x4193C402, 0x41940402, 0x41944402, 0x41948402, 0x4194C402, 0x41950402, 0x41954402,
+    0x41958402, 0x4195C402, 0x41960402, 0x41964402, 0x80020A82, 0x41968402, 0x4196C402, 0x41970402,
+    0x41974402, 0x80020AC2, 0x41978402, 0x4197C402, 0x80020B02, 0x41980402, 0x41988402, 0x4198C402,
+    0x41990402, 0x41994402, 0x419C4402, 0x419CC402, 0x419D0402, 0x419D4402, 0x419DC402, 0x419E0402,
+    0x419E4402, 0x419E8402, 0x419EC402, 0x419F0402, 0x419F8402, 0x41A00402, 0x41A04402, 0x41A08402,
+    0x41A0C402, 0x41A10402, 0x41A14402, 0x41A18402, 0x80020B42, 0x41A1C402, 0x80020B82, 0x41A20402,
+    0x41A24402, 0x41A28402, 0x41A2C402, 0x41A30402, 0x80020BC2, 0x80020C03, 0x41A34402, 0x80020C62,
+    0x80020CA3, 0x41A38402, 0x41A3C402, 0x41A40402, 0x41A44402, 0x41A48402, 0x41A4C402, 0x41A50402,
+    0x41A54402, 0x41A58402, 0x41A5C402, 0x41A60402, 0x41A64402, 0x41A68402, 0x41A6C402, 0x41A70402,
+    0x41A74402, 0x80020D02, 0x41A78402, 0x41A7C402, 0x80020D42, 0x41A80402, 0x41A84402, 0x80020D82,
+    0x41A88402, 0x80020DC2, 0x41A8C402, 0x41A90402, 0x41A94402, 0x41A98402, 0x41A9C402, 0x41AA0402,
+    0x41AA4402, 0x41AA8402, 0x41AAC402, 0x41AB0402, 0x41AB4402, 0x41AB8402, 0x41ABC402, 0x41AC0402,
+    0x41AC4402, 0x41AC8402, 0x41ACC402, 0x41AD0402, 0x41AD4402, 0x41AD8402, 0x41ADC402, 0x41AE0402,
+    0x80020E02, 0x41AE4402, 0x80020E42, 0x41AE8402, 0x41AEC402, 0x41AF0402, 0x41AF4402, 0x41AF8402,
+    0x41AFC402, 0x41B00402, 0x41B04402, 0x41B08402, 0x41B0C402, 0x80020E82, 0x80020EC2, 0x80020F02,
+    0x80020F42, 0x80020F82, 0x41B10402, 0x41B14402, 0x80020FC2, 0x80021002, 0x41B18402, 0x41B1C402,
+    0x80021042, 0x80021082, 0x41B20402, 0x41B24402, 0x41B28402, 0x41B2C402, 0x41B30402, 0x41B34402,
+    0x800210C2, 0x80021102, 0x41B38402, 0x41B3C402, 0x80021142, 0x80021182, 0x41B40402, 0x41B44402,
+    0x800211C2, 0x80021202, 0x41B48402, 0x41B4C402, 0x41B50402, 0x41B54402, 0x41B58402, 0x41B5C402,
+    0x41B60402, 0x41B64402, 0x41B68402, 0x41B6C402, 0x41B70402, 0x41B74402, 0x41B78402, 0x41B7C402,
+    0x41B80402, 0x41B84402, 0x41B88402, 0x41B8C402, 0x41B90402, 0x41B94402, 0x41B98402, 0x41B9C402,
+    0x41BA0402, 0x41BA4402, 0x41BA8402, 0x41BAC402, 0x41BB0402, 0x41BB4402, 0x41BB8402, 0x41BBC402,
+    0x41BC0402, 0x41BC4402, 0x41BC8402, 0x41BCC402, 0x80021242, 0x80021282, 0x800212C2, 0x80021302,
+    0x41BD0402, 0x41BD4402, 0x41BD8402, 0x41BDC402, 0x41BE0402, 0x41BE4402, 0x41BE8402, 0x41BEC402,
+    0x41BF0402, 0x41BF4402, 0x41BF8402, 0x41BFC402, 0x41C00402, 0x41C08402, 0x41C0C402, 0x41C10402,
+    0x41C14402, 0x41C18402, 0x41C1C402, 0x41C20402, 0x41C24402, 0x41C28402, 0x41C2C402, 0x41C30402,
+    0x41C34402, 0x41C38402, 0x41C3C402, 0x41C40402, 0x41C44402, 0x41C48402, 0x41C4C402, 0x41C50402,
+    0x41C54402, 0x41C58402, 0x41C5C402, 0x41C60402, 0x41C64402, 0x41C68402, 0x41C6C402, 0x41C70402,
+    0x41C74402, 0x41C78402, 0x41C7C402, 0x41C80402, 0x41C84402, 0x41C88402, 0x41C8C402, 0x41C90402,
+    0x80021342, 0x80021382, 0x800213C2, 0x80021402, 0x41C94402, 0x41C98402, 0x41C9C402, 0x41CA0402,
+    0x41CA4402, 0x41CA8402, 0x80021442, 0x80021482, 0x800214C2, 0x80021502, 0x41CAC402, 0x41CB0402,
+    0x41CB4402, 0x41CB8402, 0x41CBC402, 0x41CC0402, 0x41CC4402, 0x41CC8402, 0x41CCC402, 0x41CD0402,
+    0x41CD4402, 0x41CD8402, 0x41CDC402, 0x41CE0402, 0x41CE4402, 0x41CE8402, 0x41CEC402, 0x41CF0402,
+    0x41CF4402, 0x41CF8402, 0x41CFC402, 0x41D00402, 0x41D04402, 0x41D08402, 0x41D0C402, 0x41D10402,
+    0x40CD8402, 0x40CDC402, 0x40CE0402, 0x40CE4402, 0x41D14402, 0x41D18402, 0x41D1C402, 0x41D20402,
+    0x41D24402, 0x41D28402, 0x41D2C402, 0x41D30402, 0x41D34402, 0x41D38402, 0x41D3C402, 0x41D40402,
+    0x41D44402, 0x41D48402, 0x41D4C402, 0x41D50402, 0x41D54402, 0x41D58402, 0x41D5C402, 0x41D60402,
+    0x41D64402, 0x41D68402, 0x41D6C402, 0x41D70402, 0x41D74402, 0x41D78402, 0x41D7C402, 0x41D80402,
+    0x41D84402, 0x40E00402, 0x40E04402, 0x41D88402, 0x41D8C402, 0x41D90402, 0x41D94402, 0x41D98402,
+    0x41D9C402, 0x41DA0402, 0x41DA4402, 0x41DA8402, 0x41DAC402, 0x41DB0402, 0x41DB4402, 0x41DB8402,
+    0x41DBC402, 0x41DC0402, 0x41DC4402, 0x41DC8402, 0x41DCC402, 0x41DD0402, 0x41DD4402, 0x41DD8402,
+    0x41DDC402, 0x41DE0402, 0x41DE4402, 0x41DE8402, 0x41DEC402, 0x41DF0402, 0x41DF4402, 0x41DF8402,
+    0x41DFC402, 0x41E00402, 0x41E04402, 0x41E08402, 0x41E0C402, 0x41E10402, 0x41E14402, 0x41E18402,
+    0x41E1C402, 0x41E20402, 0x41E24402, 0x41E28402, 0x41E2C402, 0x41E30402, 0x41E34402, 0x41E38402,
+    0x41E3C402, 0x41E40402, 0x41E44402, 0x41E48402, 0x41E4C402, 0x41E50402, 0x41E54402, 0x41E58402,
+    0x41E5C402, 0x41E60402, 0x41E64402, 0x41E68402, 0x41E6C402, 0x41E70402, 0x41E74402, 0x41E78402,
+    0x41E7C402, 0x41E80402, 0x41E84402, 0x41E88402, 0x41E8C402, 0x41E90402, 0x41E94402, 0x41E98402,
+    0x41E9C402, 0x41EA0402, 0x41EA4402, 0x41EA8402, 0x41EAC402, 0x41EB0402, 0x41EB4402, 0x41EB8402,
+    0x41EBC402, 0x41EC0402, 0x41EC4402, 0x41EC8402, 0x41ECC402, 0x41ED0402, 0x41ED4402, 0x41ED8402,
+    0x41EDC402, 0x41EE0402, 0x41EE4402, 0x41EE8402, 0x41EEC402, 0x41EF0402, 0x41EF4402, 0x41EF8402,
+    0x41EFC402, 0x41F00402, 0x41F04402, 0x41F08402, 0x41F0C402, 0x41F10402, 0x41F14402, 0x41F18402,
+    0x41F1C402, 0x41F20402, 0x41F24402, 0x41F28402, 0x41F2C402, 0x41F30402, 0x41F34402, 0x41F38402,
+    0x41F3C402, 0x41F40402, 0x41F44402, 0x41F48402, 0x41F4C402, 0x41F50402, 0x41F54402, 0x41F58402,
+    0x41F5C402, 0x41F60402, 0x41F64402, 0x41F68402, 0x41F6C402, 0x41F70402, 0x41F74402, 0x41F78402,
+    0x41F7C402, 0x41F80402, 0x41F84402, 0x41F88402, 0x41F8C402, 0x41F90402, 0x41F94402, 0x41F98402,
+    0x41F9C402, 0x41FA0402, 0x41FA4402, 0x41FA8402, 0x41FAC402, 0x41FB0402, 0x41FB4402, 0x41FB8402,
+    0x41FBC402, 0x41FC0402, 0x41FC4402, 0x41FC8402, 0x41FCC402, 0x41FD0402, 0x41FD4402, 0x41FD8402,
+    0x41FDC402, 0x41FE0402, 0x41FE4402, 0x41FE8402, 0x41FEC402, 0x41FF0402, 0x41FF4402, 0x41FF8402,
+    0x41FFC402, 0x42000402, 0x42004402, 0x42008402, 0x4200C402, 0x42010402, 0x42014402, 0x42018402,
+    0x4201C402, 0x42020402, 0x42024402, 0x42028402, 0x4202C402, 0x42030402, 0x42034402, 0x42038402,
+    0x4203C402, 0x42040402, 0x42044402, 0x42048402, 0x4204C402, 0x42050402, 0x42054402, 0x42058402,
+    0x4205C402, 0x42060402, 0x42064402, 0x42068402, 0x4206C402, 0x42070402, 0x42074402, 0x42078402,
+    0x4207C402, 0x42080402, 0x42084402, 0x42088402, 0x4208C402, 0x42090402, 0x42094402, 0x42098402,
+    0x4209C402, 0x420A0402, 0x420A4402, 0x420A8402, 0x420AC402, 0x420B0402, 0x420B4402, 0x420B8402,
+    0x420BC402, 0x420C0402, 0x420C4402, 0x420C8402, 0x420CC402, 0x420D0402, 0x420D4402, 0x420D8402,
+    0x420DC402, 0x420E0402, 0x420E4402, 0x420E8402, 0x420EC402, 0x420F0402, 0x420F4402, 0x420F8402,
+    0x420FC402, 0x42100402, 0x42104402, 0x42108402, 0x4210C402, 0x42110402, 0x42114402, 0x42118402,
+    0x4211C402, 0x42120402, 0x42124402, 0x42128402, 0x4212C402, 0x42130402, 0x42134402, 0x42138402,
+    0x4213C402, 0x42140402, 0x42144402, 0x42148402, 0x4214C402, 0x42150402, 0x42154402, 0x42158402,
+    0x4215C402, 0x42160402, 0x42164402, 0x42168402, 0x4216C402, 0x42170402, 0x42174402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x42178402, 0x4217C402, 0x42180402, 0x42184402, 0x42188402, 0x4218C402, 0x42190402, 0x42194402,
+    0x42198402, 0x4219C402, 0x421A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E64406, 0x47E68406, 0x47E6C406, 0x47E70406, 0x47E74406, 0x47E78406, 0x47E7C406, 0x47E80406,
+    0x47E84406, 0x80021542, 0x80021582, 0x800215C2, 0x80021602, 0x80021642, 0x80021682, 0x800216C2,
+    0x80021702, 0x80021742, 0x80021782, 0x800217C2, 0x80021803, 0x80021863, 0x800218C3, 0x80021923,
+    0x80021983, 0x800219E3, 0x80021A43, 0x80021AA3, 0x80021B03, 0x80021B64, 0x80021BE4, 0x80021C64,
+    0x80021CE4, 0x80021D64, 0x80021DE4, 0x80021E64, 0x80021EE4, 0x80021F64, 0x80021FE4, 0x80022064,
+    0x800220E2, 0x80022122, 0x80022162, 0x800221A2, 0x800221E2, 0x80022222, 0x80022262, 0x800222A2,
+    0x800222E2, 0x80022323, 0x80022383, 0x800223E3, 0x80022443, 0x800224A3, 0x80022503, 0x80022563,
+    0x800225C3, 0x80022623, 0x80022683, 0x800226E3, 0x80022743, 0x800227A3, 0x80022803, 0x80022863,
+    0x800228C3, 0x80022923, 0x80022983, 0x800229E3, 0x80022A43, 0x80022AA3, 0x80022B03, 0x80022B63,
+    0x80022BC3, 0x80022C23, 0x80022C83, 0x80022CE3, 0x80022D43, 0x80022DA3, 0x80022E03, 0x80022E63,
+    0x80022EC3, 0x80022F23, 0x80022F83, 0x80022FE3, 0x80023043, 0x800230A3, 0x47E8840C, 0x47EF040C,
+    0x47F5840C, 0x47FAC40C, 0x4801C40C, 0x4810840C, 0x4814440C, 0x481D440C, 0x4824040C, 0x482AC40C,
+    0x4831040C, 0x4835840C, 0x4842440C, 0x4846040C, 0x484F040C, 0x485AC40C, 0x4860040C, 0x4864C40C,
+    0x4874840C, 0x487DC40C, 0x4885C40C, 0x4891C40C, 0x4896440C, 0x4899040C, 0x489C040C, 0x48A1840C,
+    0x47E88406, 0x47EF0406, 0x47F58406, 0x47FAC406, 0x4801C406, 0x48108406, 0x48144406, 0x481D4406,
+    0x48240406, 0x482AC406, 0x48310406, 0x48358406, 0x48424406, 0x48460406, 0x484F0406, 0x485AC406,
+    0x48600406, 0x4864C406, 0x48748406, 0x487DC406, 0x4885C406, 0x4891C406, 0x48964406, 0x48990406,
+    0x489C0406, 0x48A18406, 0x47E60406, 0x80021582, 0x800215C2, 0x80021602, 0x80021642, 0x80021682,
+    0x800216C2, 0x80021702, 0x80021742, 0x80021782, 0x800217C2, 0x47E64406, 0x47E68406, 0x47E6C406,
+    0x47E70406, 0x47E74406, 0x47E78406, 0x47E7C406, 0x47E80406, 0x47E84406, 0x80021542, 0x47E60406,
+    0x421A4402, 0x421A8402, 0x421AC402, 0x421B0402, 0x421B4402, 0x421B8402, 0x421BC402, 0x421C0402,
+    0x421C4402, 0x421C8402, 0x421CC402, 0x421D0402, 0x421D4402, 0x421D8402, 0x421DC402, 0x421E0402,
+    0x421E4402, 0x421E8402, 0x421EC402, 0x421F0402, 0x421F4402, 0x421F8402, 0x421FC402, 0x42200402,
+    0x42204402, 0x42208402, 0x4220C402, 0x42210402, 0x42214402, 0x42218402, 0x4221C402, 0x42220402,
+    0x42224402, 0x42228402, 0x4222C402, 0x42230402, 0x42234402, 0x42238402, 0x4223C402, 0x42240402,
+    0x42244402, 0x42248402, 0x4224C402, 0x42250402, 0x42254402, 0x42258402, 0x4225C402, 0x42260402,
+    0x42264402, 0x42268402, 0x4226C402, 0x42270402, 0x42274402, 0x42278402, 0x4227C402, 0x42280402,
+    0x42284402, 0x42288402, 0x4228C402, 0x42290402, 0x42294402, 0x42298402, 0x4229C402, 0x422A0402,
+    0x422A4402, 0x422A8402, 0x422AC402, 0x422B0402, 0x422B4402, 0x422B8402, 0x422BC402, 0x422C0402,
+    0x422C4402, 0x422C8402, 0x422CC402, 0x422D0402, 0x422D4402, 0x422D8402, 0x422DC402, 0x422E0402,
+    0x422E4402, 0x422E8402, 0x422EC402, 0x422F0402, 0x422F4402, 0x422F8402, 0x422FC402, 0x42300402,
+    0x42304402, 0x42308402, 0x4230C402, 0x42310402, 0x42314402, 0x42318402, 0x4231C402, 0x42320402,
+    0x42324402, 0x42328402, 0x4232C402, 0x42330402, 0x42334402, 0x42338402, 0x4233C402, 0x42340402,
+    0x42344402, 0x42348402, 0x4234C402, 0x42350402, 0x42354402, 0x42358402, 0x4235C402, 0x42360402,
+    0x42364402, 0x42368402, 0x4236C402, 0x42370402, 0x42374402, 0x42378402, 0x4237C402, 0x42380402,
+    0x42384402, 0x42388402, 0x4238C402, 0x42390402, 0x42394402, 0x42398402, 0x4239C402, 0x423A0402,
+    0x423A4402, 0x423A8402, 0x423AC402, 0x423B0402, 0x423B4402, 0x423B8402, 0x423BC402, 0x423C0402,
+    0x423C4402, 0x423C8402, 0x423CC402, 0x423D0402, 0x423D4402, 0x423D8402, 0x423DC402, 0x423E0402,
+    0x423E4402, 0x423E8402, 0x423EC402, 0x423F0402, 0x423F4402, 0x423F8402, 0x423FC402, 0x42400402,
+    0x42404402, 0x42408402, 0x4240C402, 0x42410402, 0x42414402, 0x42418402, 0x4241C402, 0x42420402,
+    0x42424402, 0x42428402, 0x4242C402, 0x42430402, 0x42434402, 0x42438402, 0x4243C402, 0x42440402,
+    0x42444402, 0x42448402, 0x4244C402, 0x42450402, 0x42454402, 0x42458402, 0x4245C402, 0x42460402,
+    0x42464402, 0x42468402, 0x4246C402, 0x42470402, 0x42474402, 0x42478402, 0x4247C402, 0x42480402,
+    0x42484402, 0x42488402, 0x4248C402, 0x42490402, 0x42494402, 0x42498402, 0x4249C402, 0x424A0402,
+    0x424A4402, 0x424A8402, 0x424AC402, 0x424B0402, 0x424B4402, 0x424B8402, 0x424BC402, 0x424C0402,
+    0x424C4402, 0x424C8402, 0x424CC402, 0x424D0402, 0x424D4402, 0x424D8402, 0x424DC402, 0x424E0402,
+    0x424E4402, 0x424E8402, 0x424EC402, 0x424F0402, 0x424F4402, 0x424F8402, 0x424FC402, 0x42500402,
+    0x42504402, 0x42508402, 0x4250C402, 0x42510402, 0x42514402, 0x42518402, 0x4251C402, 0x42520402,
+    0x42524402, 0x42528402, 0x4252C402, 0x42530402, 0x42534402, 0x42538402, 0x4253C402, 0x42540402,
+    0x42544402, 0x42548402, 0x4254C402, 0x42550402, 0x42554402, 0x42558402, 0x4255C402, 0x42560402,
+    0x42564402, 0x42568402, 0x4256C402, 0x42570402, 0x42574402, 0x42578402, 0x4257C402, 0x42580402,
+    0x42584402, 0x42588402, 0x4258C402, 0x42590402, 0x42594402, 0x42598402, 0x4259C402, 0x425A0402,
+    0x428CC402, 0x428D0402, 0x428D4402, 0x428D8402, 0x428DC402, 0x428E0402, 0x428E4402, 0x428E8402,
+    0x428EC402, 0x428F0402, 0x428F4402, 0x428F8402, 0x428FC402, 0x42900402, 0x42904402, 0x42908402,
+    0x4290C402, 0x42910402, 0x42914402, 0x42918402, 0x4291C402, 0x42920402, 0x42924402, 0x42928402,
+    0x4292C402, 0x42930402, 0x42934402, 0x42938402, 0x4293C402, 0x42940402, 0x42944402, 0x42948402,
+    0x4294C402, 0x42950402, 0x42954402, 0x42958402, 0x4295C402, 0x42960402, 0x42964402, 0x42968402,
+    0x4296C402, 0x42970402, 0x42974402, 0x42978402, 0x4297C402, 0x42980402, 0x42984402, 0x42988402,
+    0x43FB8402, 0x43FBC402, 0x43FC0402, 0x43FC4402, 0x43FC8402, 0x43FCC402, 0x43FD0402, 0x43FD4402,
+    0x4298C402, 0x42990402, 0x42994402, 0x42998402, 0x4299C402, 0x429A0402, 0x429A4402, 0x429A8402,
+    0x429AC402, 0x429B0402, 0x429B4402, 0x429B8402, 0x429BC402, 0x429C0402, 0x429C4402, 0x429C8402,
+    0x429CC402, 0x429D0402, 0x429D4402, 0x429D8402, 0x429DC402, 0x429E0402, 0x429E4402, 0x429E8402,
+    0x429EC402, 0x429F0402, 0x429F4402, 0x429F8402, 0x429FC402, 0x42A00402, 0x42A04402, 0x42A08402,
+    0x42A0C402, 0x42A10402, 0x42A14402, 0x42A18402, 0x42A1C402, 0x42A20402, 0x42A24402, 0x42A28402,
+    0x42A2C402, 0x42A30402, 0x42A34402, 0x42A38402, 0x42A3C402, 0x42A40402, 0x42A44402, 0x42A48402,
+    0x42A4C402, 0x42A50402, 0x42A54402, 0x42A58402, 0x42A5C402, 0x44904402, 0x44908402, 0x4490C402,
+    0x42A60402, 0x42A64402, 0x42A68402, 0x42A6C402, 0x42A70402, 0x42A74402, 0x42A78402, 0x42A7C402,
+    0x42A80402, 0x42A84402, 0x42A88402, 0x42A8C402, 0x42A90402, 0x42A94402, 0x42A98402, 0x42A9C402,
+    0x42AA0402, 0x42AA4402, 0x42AA8402, 0x42AAC402, 0x42AB0402, 0x42AB4402, 0x42AB8402, 0x42ABC402,
+    0x42AC0402, 0x42AC4402, 0x43FA0402, 0x43FA4402, 0x43FA8402, 0x43FAC402, 0x43FB0402, 0x43FB4402,
+    0x42AC8402, 0x42ACC402, 0x42AD0402, 0x42AD4402, 0x42AD8402, 0x42ADC402, 0x42AE0402, 0x42AE4402,
+    0x42AE8402, 0x42AEC402, 0x42AF0402, 0x42AF4402, 0x42AF8402, 0x42AFC402, 0x42B00402, 0x42B04402,
+    0x42B08402, 0x42B0C402, 0x42B10402, 0x42B14402, 0x42B18402, 0x42B1C402, 0x42B20402, 0x42B24402,
+    0x42B28402, 0x42B2C402, 0x42B30402, 0x42B34402, 0x42B38402, 0x42B3C402, 0x42B40402, 0x42B44402,
+    0x42B48402, 0x42B4C402, 0x42B50402, 0x42B54402, 0x42B58402, 0x42B5C402, 0x42B60402, 0x42B64402,
+    0x42B68402, 0x42B6C402, 0x42B70402, 0x42B74402, 0x42B78402, 0x42B7C402, 0x42B80402, 0x42B84402,
+    0x42B88402, 0x42B8C402, 0x42B90402, 0x42B94402, 0x42B98402, 0x42B9C402, 0x42BA0402, 0x42BA4402,
+    0x42BA8402, 0x42BAC402, 0x42BB0402, 0x42BB4402, 0x42BB8402, 0x42BBC402, 0x42BC0402, 0x42BC4402,
+    0x42BC8402, 0x42BCC402, 0x42BD0402, 0x42BD4402, 0x42BD8402, 0x42BDC402, 0x42BE0402, 0x42BE4402,
+    0x42BE8402, 0x42BEC402, 0x42BF0402, 0x42BF4402, 0x42BF8402, 0x42BFC402, 0x42C00402, 0x42C04402,
+    0x42C08402, 0x42C0C402, 0x42C10402, 0x42C14402, 0x42C18402, 0x42C1C402, 0x42C20402, 0x42C24402,
+    0x42C28402, 0x42C2C402, 0x42C30402, 0x42C34402, 0x42C38402, 0x42C3C402, 0x42C40402, 0x42C44402,
+    0x42C48402, 0x42C4C402, 0x42C50402, 0x42C54402, 0x42C58402, 0x42C5C402, 0x42C60402, 0x42C64402,
+    0x42C68402, 0x42C6C402, 0x42C70402, 0x42C74402, 0x42C78402, 0x42C7C402, 0x42C80402, 0x42C84402,
+    0x42CF0402, 0x42CF4402, 0x42CF8402, 0x42CFC402, 0x42D00402, 0x42D04402, 0x42D08402, 0x42D0C402,
+    0x42D10402, 0x42D14402, 0x42D18402, 0x42D1C402, 0x42D20402, 0x42D24402, 0x42D28402, 0x42D2C402,
+    0x42D30402, 0x42D34402, 0x42D38402, 0x42D3C402, 0x42D40402, 0x42D44402, 0x42D48402, 0x42D4C402,
+    0x42D50402, 0x42D54402, 0x42D58402, 0x42D5C402, 0x42D60402, 0x42D64402, 0x42D68402, 0x42D6C402,
+    0x42D70402, 0x42D7C402, 0x42D80402, 0x42D84402, 0x42D88402, 0x42D8C402, 0x42D90402, 0x42D94402,
+    0x42D98402, 0x42D9C402, 0x42DA0402, 0x42DA4402, 0x42DA8402, 0x42DAC402, 0x42DB0402, 0x42DB4402,
+    0x42DB8402, 0x42DBC402, 0x42DC0402, 0x42DC4402, 0x42DC8402, 0x42DCC402, 0x42DD0402, 0x42DD4402,
+    0x42DD8402, 0x42DDC402, 0x42DE0402, 0x42DE4402, 0x42DE8402, 0x42DEC402, 0x42DF0402, 0x42DF4402,
+    0x42DF8402, 0x42DFC402, 0x42E00402, 0x42E04402, 0x42E08402, 0x42E0C402, 0x42E10402, 0x42E14402,
+    0x42E18402, 0x42E1C402, 0x42E20402, 0x42E24402, 0x42E28402, 0x42E2C402, 0x42E30402, 0x42E34402,
+    0x42E38402, 0x42E3C402, 0x42E40402, 0x42E44402, 0x42E48402, 0x42E4C402, 0x42E50402, 0x42E54402,
+    0x42E58402, 0x42E5C402, 0x42E60402, 0x42E64402, 0x42E68402, 0x42E6C402, 0x42E70402, 0x42E74402,
+    0x42E78402, 0x42E7C402, 0x42E80402, 0x42E84402, 0x42E88402, 0x42E8C402, 0x42E90402, 0x42E94402,
+    0x40D78402, 0x40D7C402, 0x40D80402, 0x40D84402, 0x40D88402, 0x40D8C402, 0x40D90402, 0x40D94402,
+    0x40D98402, 0x40D9C402, 0x40DA0402, 0x40DA4402, 0x40DA8402, 0x40DAC402, 0x47E64406, 0x47E68406,
+    0x47E6C406, 0x47E70406, 0x47E74406, 0x47E78406, 0x47E7C406, 0x47E80406, 0x47E84406, 0x80021542,
+    0x47E64406, 0x47E68406, 0x47E6C406, 0x47E70406, 0x47E74406, 0x47E78406, 0x47E7C406, 0x47E80406,
+    0x47E84406, 0x80021542, 0x47E64406, 0x47E68406, 0x47E6C406, 0x47E70406, 0x47E74406, 0x47E78406,
+    0x47E7C406, 0x47E80406, 0x47E84406, 0x80021542, 0x42E98402, 0x42E9C402, 0x42EA0402, 0x42EA4402,
+    0x42EA8402, 0x42EAC402, 0x42EB0402, 0x42EB4402, 0x42EB8402, 0x42EBC402, 0x42EC0402, 0x42EC4402,
+    0x42EC8402, 0x42ECC402, 0x42ED0402, 0x42ED4402, 0x42ED8402, 0x42EDC402, 0x42EE0402, 0x42EE4402,
+    0x42EE8402, 0x42EEC402, 0x42EF0402, 0x42EF4402, 0x42EF8402, 0x42EFC402, 0x42F00402, 0x42F04402,
+    0x42F08402, 0x42F0C402, 0x42F10402, 0x42F14402, 0x42F18402, 0x42F1C402, 0x42F20402, 0x42F24402,
+    0x42F28402, 0x42F2C402, 0x42F30402, 0x42F34402, 0x42F38402, 0x42F3C402, 0x42F40402, 0x42F44402,
+    0x42F48402, 0x42F4C402, 0x42F50402, 0x42F54402, 0x42F58402, 0x40D48402, 0x40D4C402, 0x42F5C402,
+    0x42F60402, 0x42F64402, 0x42F68402, 0x42F6C402, 0x42F70402, 0x42F74402, 0x42F78402, 0x42F7C402,
+    0x42F80402, 0x42F84402, 0x42F88402, 0x42F8C402, 0x42F90402, 0x42F94402, 0x42F98402, 0x42F9C402,
+    0x42FA0402, 0x42FA4402, 0x42FA8402, 0x42FAC402, 0x42FB0402, 0x42FB4402, 0x42FB8402, 0x42FBC402,
+    0x42FC0402, 0x42FC4402, 0x42FC8402, 0x42FCC402, 0x42FD0402, 0x42FD4402, 0x40D50402, 0x40D54402,
+    0x40D58402, 0x40D5C402, 0x40D60402, 0x40D64402, 0x40D68402, 0x40D6C402, 0x40D70402, 0x40D74402,
+    0x42FD8402, 0x42FDC402, 0x42FE0402, 0x42FE4402, 0x42FE8402, 0x42FEC402, 0x42FF0402, 0x42FF4402,
+    0x42FF8402, 0x42FFC402, 0x43000402, 0x43004402, 0x43008402, 0x4300C402, 0x43010402, 0x43014402,
+    0x43BA0402, 0x43BA4402, 0x43BA8402, 0x43BAC402, 0x43BB0402, 0x43BB4402, 0x43BB8402, 0x43BBC402,
+    0x43BC0402, 0x43BC4402, 0x43BC8402, 0x43BCC402, 0x43BD0402, 0x43BD4402, 0x43BD8402, 0x43BDC402,
+    0x43BE0402, 0x43BE4402, 0x43BE8402, 0x43BEC402, 0x43BF0402, 0x43BF4402, 0x43BF8402, 0x43BFC402,
+    0x43C00402, 0x43C04402, 0x43C08402, 0x43C0C402, 0x43C10402, 0x43C14402, 0x43C18402, 0x43C1C402,
+    0x43C20402, 0x43C24402, 0x43C28402, 0x43C2C402, 0x43C30402, 0x43C34402, 0x43C38402, 0x43C3C402,
+    0x43C40402, 0x43C44402, 0x43C48402, 0x43C4C402, 0x43C50402, 0x43C54402, 0x43C58402, 0x43C5C402,
+    0x43C60402, 0x43C64402, 0x43C68402, 0x43C6C402, 0x43C70402, 0x43C74402, 0x43C78402, 0x43C7C402,
+    0x43C80402, 0x43C84402, 0x43C88402, 0x43C8C402, 0x43C90402, 0x43C94402, 0x43C98402, 0x43C9C402,
+    0x43CA0402, 0x43CA4402, 0x43CA8402, 0x43CAC402, 0x43CB0402, 0x43CB4402, 0x43CB8402, 0x43CBC402,
+    0x43CC0402, 0x43CC4402, 0x43CC8402, 0x43CCC402, 0x43CD0402, 0x43CD4402, 0x43CD8402, 0x43CDC402,
+    0x43CE0402, 0x43CE4402, 0x43CE8402, 0x43CEC402, 0x43CF0402, 0x43CF4402, 0x43CF8402, 0x43CFC402,
+    0x43D00402, 0x43D04402, 0x43D08402, 0x43D0C402, 0x43D10402, 0x43D14402, 0x43D18402, 0x43D1C402,
+    0x43D20402, 0x43D24402, 0x43D28402, 0x43D2C402, 0x43D30402, 0x43D34402, 0x43D38402, 0x43D3C402,
+    0x43D40402, 0x43D44402, 0x43D48402, 0x43D4C402, 0x43D50402, 0x43D54402, 0x43D58402, 0x43D5C402,
+    0x43D60402, 0x43D64402, 0x43D68402, 0x43D6C402, 0x43D70402, 0x43D74402, 0x43D78402, 0x43D7C402,
+    0x43D80402, 0x43D84402, 0x43D88402, 0x43D8C402, 0x43D90402, 0x43D94402, 0x43D98402, 0x43D9C402,
+    0x43DA0402, 0x43DA4402, 0x43DA8402, 0x43DAC402, 0x43DB0402, 0x43DB4402, 0x43DB8402, 0x43DBC402,
+    0x43DC0402, 0x43DC4402, 0x43DC8402, 0x43DCC402, 0x43DD0402, 0x43DD4402, 0x43DD8402, 0x43DDC402,
+    0x43DE0402, 0x43DE4402, 0x43DE8402, 0x43DEC402, 0x43DF0402, 0x43DF4402, 0x43DF8402, 0x43DFC402,
+    0x43E00402, 0x43E04402, 0x43E08402, 0x43E0C402, 0x43E10402, 0x43E14402, 0x43E18402, 0x43E1C402,
+    0x43E20402, 0x43E24402, 0x43E28402, 0x43E2C402, 0x43E30402, 0x43E34402, 0x43E38402, 0x43E3C402,
+    0x43E40402, 0x43E44402, 0x43E48402, 0x43E4C402, 0x43E50402, 0x43E54402, 0x43E58402, 0x43E5C402,
+    0x43E60402, 0x43E64402, 0x43E68402, 0x43E6C402, 0x43E70402, 0x43E74402, 0x43E78402, 0x43E7C402,
+    0x43E80402, 0x43E84402, 0x43E88402, 0x43E8C402, 0x43E90402, 0x43E94402, 0x43E98402, 0x43E9C402,
+    0x43EA0402, 0x43EA4402, 0x43EA8402, 0x43EAC402, 0x43EB0402, 0x43EB4402, 0x43EB8402, 0x43EBC402,
+    0x43EC0402, 0x43EC4402, 0x43EC8402, 0x43ECC402, 0x43ED0402, 0x43ED4402, 0x43ED8402, 0x43EDC402,
+    0x43EE0402, 0x43EE4402, 0x43EE8402, 0x43EEC402, 0x43EF0402, 0x43EF4402, 0x43EF8402, 0x43EFC402,
+    0x43F00402, 0x43F04402, 0x43F08402, 0x43F0C402, 0x43F10402, 0x43F14402, 0x43F18402, 0x43F1C402,
+    0x43F20402, 0x43F24402, 0x43F28402, 0x43F2C402, 0x43F30402, 0x43F34402, 0x43F38402, 0x43F3C402,
+    0x43F40402, 0x43F44402, 0x43F48402, 0x43F4C402, 0x43F50402, 0x43F54402, 0x43F58402, 0x43F5C402,
+    0x43F60402, 0x43F64402, 0x43F68402, 0x43F6C402, 0x43F70402, 0x43F74402, 0x43F78402, 0x43F7C402,
+    0x43F80402, 0x43F84402, 0x43F88402, 0x43F8C402, 0x43F90402, 0x43F94402, 0x43F98402, 0x43F9C402,
+    0x43018402, 0x4301C402, 0x43020402, 0x43024402, 0x43028402, 0x4302C402, 0x43030402, 0x43034402,
+    0x43038402, 0x4303C402, 0x43040402, 0x43044402, 0x43048402, 0x4304C402, 0x43050402, 0x43054402,
+    0x43058402, 0x4305C402, 0x43060402, 0x43064402, 0x43068402, 0x4306C402, 0x43070402, 0x43074402,
+    0x43078402, 0x4307C402, 0x43080402, 0x43084402, 0x43088402, 0x4308C402, 0x43090402, 0x43094402,
+    0x43098402, 0x4309C402, 0x430A0402, 0x430A4402, 0x430A8402, 0x430AC402, 0x430B0402, 0x430B4402,
+    0x430B8402, 0x430BC402, 0x430C0402, 0x430C4402, 0x430C8402, 0x430CC402, 0x430D0402, 0x430D4402,
+    0x430D8402, 0x430DC402, 0x430E0402, 0x430E4402, 0x430E8402, 0x430EC402, 0x430F0402, 0x430F4402,
+    0x430F8402, 0x430FC402, 0x43100402, 0x43104402, 0x43108402, 0x4310C402, 0x43110402, 0x43114402,
+    0x43118402, 0x4311C402, 0x43120402, 0x43124402, 0x43128402, 0x4312C402, 0x43130402, 0x43134402,
+    0x43138402, 0x4313C402, 0x43140402, 0x43144402, 0x43148402, 0x4314C402, 0x43150402, 0x43154402,
+    0x43158402, 0x4315C402, 0x43160402, 0x43164402, 0x43168402, 0x4316C402, 0x43170402, 0x43174402,
+    0x43178402, 0x4317C402, 0x43180402, 0x43184402, 0x43188402, 0x4318C402, 0x43190402, 0x43194402,
+    0x43198402, 0x4319C402, 0x431A0402, 0x431A4402, 0x431A8402, 0x431AC402, 0x431B0402, 0x431B4402,
+    0x431B8402, 0x431BC402, 0x431C0402, 0x431C4402, 0x431C8402, 0x431CC402, 0x431D0402, 0x431D4402,
+    0x431D8402, 0x431DC402, 0x431E0402, 0x431E4402, 0x431E8402, 0x431EC402, 0x431F0402, 0x431F4402,
+    0x431F8402, 0x431FC402, 0x43200402, 0x43204402, 0x43208402, 0x4320C402, 0x43210402, 0x43214402,
+    0x43218402, 0x4321C402, 0x43220402, 0x40CF0402, 0x40CF4402, 0x40CF8402, 0x40CFC402, 0x40D00402,
+    0x40D04402, 0x40D08402, 0x40D0C402, 0x40D10402, 0x40D14402, 0x40D18402, 0x40D1C402, 0x40D20402,
+    0x40D24402, 0x40D28402, 0x40D2C402, 0x40D30402, 0x40D34402, 0x40D38402, 0x40D3C402, 0x40D40402,
+    0x40D44402, 0x43224402, 0x43228402, 0x4322C402, 0x43230402, 0x43234402, 0x43238402, 0x4323C402,
+    0x43240402, 0x43244402, 0x43248402, 0x4324C402, 0x43250402, 0x43254402, 0x43258402, 0x4325C402,
+    0x43260402, 0x43264402, 0x43268402, 0x4326C402, 0x43270402, 0x43274402, 0x43278402, 0x4327C402,
+    0x43280402, 0x43284402, 0x43288402, 0x4328C402, 0x43290402, 0x43294402, 0x43298402, 0x4329C402,
+    0x432A0402, 0x432A4402, 0x432A8402, 0x432AC402, 0x432B0402, 0x432B4402, 0x432B8402, 0x432BC402,
+    0x432C0402, 0x432C4402, 0x432C8402, 0x432CC402, 0x432D0402, 0x432D4402, 0x432D8402, 0x432DC402,
+    0x432E0402, 0x432E4402, 0x432E8402, 0x432EC402, 0x432F0402, 0x432F4402, 0x432F8402, 0x432FC402,
+    0x43300402, 0x43304402, 0x43308402, 0x4330C402, 0x43310402, 0x43314402, 0x43318402, 0x4331C402,
+    0x40E58402, 0x40E5C402, 0x40E60402, 0x40E64402, 0x43320402, 0x43324402, 0x43328402, 0x4332C402,
+    0x43330402, 0x43334402, 0x43338402, 0x4333C402, 0x43340402, 0x43344402, 0x43348402, 0x4334C402,
+    0x43350402, 0x43354402, 0x43358402, 0x4335C402, 0x43360402, 0x43364402, 0x43368402, 0x4336C402,
+    0x43370402, 0x43374402, 0x43378402, 0x4337C402, 0x43380402, 0x43384402, 0x43388402, 0x4338C402,
+    0x43390402, 0x43394402, 0x43398402, 0x4339C402, 0x40CE8402, 0x40CEC402, 0x433A0402, 0x433A4402,
+    0x433A8402, 0x433AC402, 0x433B0402, 0x433B4402, 0x433B8402, 0x433BC402, 0x433C0402, 0x433C4402,
+    0x433C8402, 0x433CC402, 0x433D0402, 0x433D4402, 0x80023104, 0x433D8402, 0x433DC402, 0x433E0402,
+    0x433E4402, 0x433E8402, 0x433EC402, 0x433F0402, 0x433F4402, 0x433F8402, 0x433FC402, 0x43400402,
+    0x43404402, 0x43408402, 0x4340C402, 0x43410402, 0x43414402, 0x43418402, 0x4341C402, 0x43420402,
+    0x43424402, 0x43428402, 0x4342C402, 0x43430402, 0x43434402, 0x43438402, 0x4343C402, 0x43440402,
+    0x43444402, 0x43448402, 0x4344C402, 0x43450402, 0x43454402, 0x43458402, 0x4345C402, 0x43460402,
+    0x43464402, 0x43468402, 0x4346C402, 0x43470402, 0x43474402, 0x43478402, 0x4347C402, 0x43480402,
+    0x43484402, 0x43488402, 0x4348C402, 0x43490402, 0x43494402, 0x43498402, 0x4349C402, 0x434A0402,
+    0x434A4402, 0x434A8402, 0x434AC402, 0x434B0402, 0x434B4402, 0x434B8402, 0x434BC402, 0x434C0402,
+    0x434C4402, 0x434C8402, 0x434CC402, 0x434D0402, 0x434D4402, 0x434D8402, 0x434DC402, 0x434E0402,
+    0x434E4402, 0x434E8402, 0x434EC402, 0x434F0402, 0x434F4402, 0x434F8402, 0x434FC402, 0x43500402,
+    0x43504402, 0x43508402, 0x4350C402, 0x43510402, 0x43514402, 0x43518402, 0x4351C402, 0x43520402,
+    0x43524402, 0x43528402, 0x4352C402, 0x43530402, 0x43534402, 0x43538402, 0x4353C402, 0x43540402,
+    0x43544402, 0x43548402, 0x4354C402, 0x43550402, 0x43554402, 0x43558402, 0x4355C402, 0x43560402,
+    0x43564402, 0x43568402, 0x4356C402, 0x43570402, 0x80023183, 0x800231E2, 0x80023223, 0x43574402,
+    0x43578402, 0x4357C402, 0x43580402, 0x43584402, 0x43588402, 0x4358C402, 0x43590402, 0x43594402,
+    0x43598402, 0x4359C402, 0x435A0402, 0x435A4402, 0x435A8402, 0x435AC402, 0x435B0402, 0x435B4402,
+    0x435B8402, 0x435BC402, 0x435C0402, 0x435C4402, 0x435C8402, 0x435CC402, 0x435D0402, 0x435D4402,
+    0x435D8402, 0x435DC402, 0x435E0402, 0x435E4402, 0x435E8402, 0x435EC402, 0x435F0402, 0x435F4402,
+    0x435F8402, 0x435FC402, 0x43600402, 0x43604402, 0x43608402, 0x4360C402, 0x43610402, 0x43614402,
+    0x43618402, 0x4361C402, 0x43620402, 0x43624402, 0x43628402, 0x4362C402, 0x43630402, 0x43634402,
+    0x43638402, 0x4363C402, 0x43640402, 0x43644402, 0x43648402, 0x4364C402, 0x43650402, 0x43654402,
+    0x43658402, 0x4365C402, 0x43660402, 0x43664402, 0x43668402, 0x4366C402, 0x43670402, 0x43674402,
+    0x43678402, 0x4367C402, 0x43680402, 0x43684402, 0x43688402, 0x4368C402, 0x43690402, 0x43694402,
+    0x43698402, 0x4369C402, 0x436A0402, 0x436A4402, 0x436A8402, 0x436AC402, 0x436B0402, 0x436B4402,
+    0x436B8402, 0x436BC402, 0x436C0402, 0x436C4402, 0x436C8402, 0x436CC402, 0x436D0402, 0x436D4402,
+    0x436D8402, 0x436DC402, 0x436E0402, 0x436E4402, 0x436E8402, 0x436EC402, 0x436F0402, 0x436F4402,
+    0x436F8402, 0x436FC402, 0x43700402, 0x43704402, 0x80023282, 0x43708402, 0x4370C402, 0x43710402,
+    0x43714402, 0x43718402, 0x4371C402, 0x43720402, 0x43724402, 0x43728402, 0x4372C402, 0x43730402,
+    0x43734402, 0x43738402, 0x4373C402, 0x43740402, 0x43744402, 0x43748402, 0x4374C402, 0x43750402,
+    0x43754402, 0x43758402, 0x4375C402, 0x43760402, 0x43764402, 0x43768402, 0x4376C402, 0x43770402,
+    0x43774402, 0x43778402, 0x4377C402, 0x43780402, 0x43784402, 0x43788402, 0x4378C402, 0x43790402,
+    0x43794402, 0x43798402, 0x4379C402, 0x437A0402, 0x437A4402, 0x437A8402, 0x437AC402, 0x437B0402,
+    0x437B4402, 0x437B8402, 0x437BC402, 0x437C0402, 0x437C4402, 0x437C8402, 0x437CC402, 0x437D0402,
+    0x437D4402, 0x437D8402, 0x437DC402, 0x437E0402, 0x437E4402, 0x437E8402, 0x437EC402, 0x437F0402,
+    0x437F4402, 0x437F8402, 0x437FC402, 0x43800402, 0x43804402, 0x43808402, 0x4380C402, 0x43810402,
+    0x43814402, 0x43818402, 0x4381C402, 0x43820402, 0x43824402, 0x43828402, 0x4382C402, 0x43830402,
+    0x43834402, 0x43838402, 0x4383C402, 0x43840402, 0x43844402, 0x43848402, 0x4384C402, 0x43850402,
+    0x43854402, 0x43858402, 0x4385C402, 0x43860402, 0x43864402, 0x43868402, 0x4386C402, 0x43870402,
+    0x43874402, 0x43878402, 0x4387C402, 0x43880402, 0x43884402, 0x43888402, 0x4388C402, 0x43890402,
+    0x43894402, 0x43898402, 0x4389C402, 0x438A0402, 0x438A4402, 0x438A8402, 0x438AC402, 0x438B0402,
+    0x438B4402, 0x438B8402, 0x438BC402, 0x438C0402, 0x438C4402, 0x438C8402, 0x438CC402, 0x438D0402,
+    0x438D4402, 0x438D8402, 0x438DC402, 0x438E0402, 0x438E4402, 0x438E8402, 0x438EC402, 0x438F0402,
+    0x438F4402, 0x438F8402, 0x438FC402, 0x43900402, 0x43904402, 0x43908402, 0x4390C402, 0x43910402,
+    0x43914402, 0x43918402, 0x4391C402, 0x43920402, 0x43924402, 0x43928402, 0x4392C402, 0x43930402,
+    0x43934402, 0x43938402, 0x4393C402, 0x43940402, 0x43944402, 0x43948402, 0x4394C402, 0x43950402,
+    0x43954402, 0x43958402, 0x4395C402, 0x43960402, 0x00000000, 0x00000000, 0x43964402, 0x43968402,
+    0x4396C402, 0x43970402, 0x43974402, 0x43978402, 0x4397C402, 0x43980402, 0x43984402, 0x43988402,
+    0x4398C402, 0x43990402, 0x43994402, 0x43998402, 0x4399C402, 0x439A0402, 0x439A4402, 0x439A8402,
+    0x439AC402, 0x439B0402, 0x439B4402, 0x439B8402, 0x439BC402, 0x439C0402, 0x439C4402, 0x439C8402,
+    0x439CC402, 0x439D0402, 0x439D4402, 0x439D8402, 0x439DC402, 0x439E0402, 0x00000000, 0x439E4402,
+    0x439E8402, 0x439EC402, 0x439F0402, 0x439F4402, 0x439F8402, 0x439FC402, 0x43A00402, 0x43A04402,
+    0x43A08402, 0x43A0C402, 0x43A10402, 0x43A14402, 0x43A18402, 0x43A1C402, 0x43A20402, 0x43A24402,
+    0x43A28402, 0x43A2C402, 0x43A30402, 0x43A34402, 0x43A38402, 0x43A3C402, 0x43A40402, 0x43A44402,
+    0x43A48402, 0x43A4C402, 0x43A50402, 0x43A54402, 0x43A58402, 0x43A5C402, 0x43A60402, 0x43A64402,
+    0x43A68402, 0x43A6C402, 0x43A70402, 0x43A74402, 0x43A78402, 0x43A7C402, 0x43A80402, 0x43A84402,
+    0x43A88402, 0x43A8C402, 0x43A90402, 0x43A94402, 0x43A98402, 0x43A9C402, 0x43AA0402, 0x43AA4402,
+    0x43AA8402, 0x43AAC402, 0x43AB0402, 0x43AB4402, 0x43AB8402, 0x43ABC402, 0x43AC0402, 0x43AC4402,
+    0x43AC8402, 0x43ACC402, 0x43AD0402, 0x43AD4402, 0x43AD8402, 0x43ADC402, 0x43AE0402, 0x43AE4402,
+    0x43AE8402, 0x43AEC402, 0x43AF0402, 0x43AF4402, 0x43AF8402, 0x43AFC402, 0x43B00402, 0x43B04402,
+    0x43B08402, 0x43B0C402, 0x43B10402, 0x43B14402, 0x43B18402, 0x43B1C402, 0x43B20402, 0x43B24402,
+    0x43B28402, 0x43B2C402, 0x43B30402, 0x43B34402, 0x43B38402, 0x43B3C402, 0x43B40402, 0x43B44402,
+    0x43B48402, 0x43B4C402, 0x43B50402, 0x43B54402, 0x43B58402, 0x43B5C402, 0x43B60402, 0x43B64402,
+    0x43B68402, 0x43B6C402, 0x43B70402, 0x43B74402, 0x43B78402, 0x43B7C402, 0x43B80402, 0x43B84402,
+    0x49528408, 0x4952C408, 0x49530408, 0x49534408, 0x49538408, 0x4953C408, 0x49540408, 0x49544408,
+    0x49548408, 0x4954C408, 0x49550408, 0x49554408, 0x49558408, 0x4955C408, 0x49560408, 0x49564408,
+    0x49568408, 0x4956C408, 0x49570408, 0x49574408, 0x49578408, 0x4957C408, 0x49580408, 0x49584408,
+    0x49588408, 0x4958C408, 0x49590408, 0x49594408, 0x49598408, 0x4959C408, 0x495A0408, 0x495A4408,
+    0x495A8408, 0x495AC408, 0x495B0408, 0x495B4408, 0x495B8408, 0x495BC408, 0x495C0408, 0x495C4408,
+    0x495C8408, 0x495CC408, 0x495D0408, 0x495D4408, 0x495D8408, 0x495DC408, 0x495E0408, 0x00000000,
+    0x49528402, 0x4952C402, 0x49530402, 0x49534402, 0x49538402, 0x4953C402, 0x49540402, 0x49544402,
+    0x49548402, 0x4954C402, 0x49550402, 0x49554402, 0x49558402, 0x4955C402, 0x49560402, 0x49564402,
+    0x49568402, 0x4956C402, 0x49570402, 0x49574402, 0x49578402, 0x4957C402, 0x49580402, 0x49584402,
+    0x49588402, 0x4958C402, 0x49590402, 0x49594402, 0x49598402, 0x4959C402, 0x495A0402, 0x495A4402,
+    0x495A8402, 0x495AC402, 0x495B0402, 0x495B4402, 0x495B8402, 0x495BC402, 0x495C0402, 0x495C4402,
+    0x495C8402, 0x495CC402, 0x495D0402, 0x495D4402, 0x495D8402, 0x495DC402, 0x495E0402, 0x00000000,
+    0x48394408, 0x48394402, 0x48398408, 0x485C0408, 0x486DC408, 0x47E9C402, 0x48800402, 0x48218408,
+    0x48218402, 0x48338408, 0x48338402, 0x48A84408, 0x48A84402, 0x47EC4408, 0x48440408, 0x47EB4408,
+    0x47EDC408, 0x48948402, 0x4897C408, 0x4897C402, 0x4894C402, 0x4821C408, 0x4821C402, 0x485FC402,
+    0x48050402, 0x486C8402, 0x4856C402, 0x48064402, 0x482AC415, 0x4891C41D, 0x48778408, 0x48A74408,
+    0x48D2C408, 0x48D2C402, 0x48D30408, 0x48D30402, 0x48D34408, 0x48D34402, 0x48D38408, 0x48D38402,
+    0x48D3C408, 0x48D3C402, 0x48D44408, 0x48D44402, 0x48D48408, 0x48D48402, 0x48D4C408, 0x48D4C402,
+    0x48D50408, 0x48D50402, 0x48D54408, 0x48D54402, 0x48D58408, 0x48D58402, 0x48D60408, 0x48D60402,
+    0x48D64408, 0x48D64402, 0x48D68408, 0x48D68402, 0x48D74408, 0x48D74402, 0x48D78408, 0x48D78402,
+    0x48D7C408, 0x48D7C402, 0x48D80408, 0x48D80402, 0x48D84408, 0x48D84402, 0x48D88408, 0x48D88402,
+    0x48D8C408, 0x48D8C402, 0x48D90408, 0x48D90402, 0x48D94408, 0x48D94402, 0x48D98408, 0x48D98402,
+    0x48D9C408, 0x48D9C402, 0x48E08408, 0x48E08402, 0x48E0C408, 0x48E0C402, 0x48D40408, 0x48D40402,
+    0x48D5C408, 0x48D5C402, 0x48D6C408, 0x48D6C402, 0x48D70408, 0x48D70402, 0x48DA0408, 0x48DA0402,
+    0x48DA4408, 0x48DA4402, 0x48DB0408, 0x48DB0402, 0x48DB4408, 0x48DB4402, 0x48DB8408, 0x48DB8402,
+    0x48DC8408, 0x48DC8402, 0x48DD0408, 0x48DD0402, 0x48DD4408, 0x48DD4402, 0x48DD8408, 0x48DD8402,
+    0x48DDC408, 0x48DDC402, 0x48DE0408, 0x48DE0402, 0x48DE4408, 0x48DE4402, 0x48DF0408, 0x48DF0402,
+    0x48DF8408, 0x48DF8402, 0x48DFC408, 0x48DFC402, 0x48E00408, 0x48E00402, 0x48E10408, 0x48E10402,
+    0x48E14408, 0x48E14402, 0x48E18408, 0x48E18402, 0x800232C3, 0x43B88402, 0x43B8C402, 0x43B90402,
+    0x43B94402, 0x43B98402, 0x43B9C402, 0x48DAC408, 0x48DAC402, 0x48DEC408, 0x48DEC402, 0x40000662,
+    0x40000462, 0x40000442, 0x48DC4408, 0x48DC4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x40A20402, 0x409D4402, 0x409D8402, 0x40C1C402, 0x476DC402, 0x40A24402, 0x40C20402,
+    0x49680402, 0x49688402, 0x49690402, 0x49698402, 0x496A0402, 0x496A8402, 0x496B0402, 0x496C0402,
+    0x496C8402, 0x496D0402, 0x496D8402, 0x496E0402, 0x496E8402, 0x496F8402, 0x49700402, 0x49708402,
+    0x49710402, 0x49718402, 0x49720402, 0x49730402, 0x49738402, 0x49740402, 0x49748402, 0x49750402,
+    0x49758402, 0x49760402, 0x49768402, 0x49770402, 0x49778402, 0x49780402, 0x49788402, 0x49798402,
+    0x497A0402, 0x496B8402, 0x496F0402, 0x49728402, 0x49790402, 0x497A8402, 0x00000000, 0x497B4402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x497C8402, 0x00000000, 0x00000000,
+    0x49F64402, 0x49F68402, 0x49F6C402, 0x49F70402, 0x49F74402, 0x49F78402, 0x49F7C402, 0x49F80402,
+    0x49F84402, 0x49F88402, 0x49F8C402, 0x49F90402, 0x49F98402, 0x49F9C402, 0x49FA0402, 0x49FA4402,
+    0x49FA8402, 0x49FAC402, 0x49FB0402, 0x49FB4402, 0x49FB8402, 0x49FBC402, 0x49FC0402, 0x49FC4402,
+    0x49FC8402, 0x49FCC402, 0x49FD0402, 0x49FD4402, 0x49FD8402, 0x49FDC402, 0x49FE0402, 0x49FE4402,
+    0x49FE8402, 0x49FEC402, 0x49FF0402, 0x49FF4402, 0x49FFC402, 0x4A000402, 0x4A004402, 0x4A008402,
+    0x4A00C402, 0x4A010402, 0x4A014402, 0x4A018402, 0x4A01C402, 0x4A020402, 0x4A024402, 0x4A028402,
+    0x4A02C402, 0x4A030402, 0x4A034402, 0x4A038402, 0x4A03C402, 0x4A040402, 0x49F94402, 0x49FF8402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4A044402,
+    0x4114C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000,
+    0x4A088402, 0x4A0DC402, 0x4A120402, 0x4A144402, 0x4A180402, 0x4A218402, 0x4A25C402, 0x4A280402,
+    0x4A2D8402, 0x4A2FC402, 0x4A320402, 0x4A3E4402, 0x4A460402, 0x4A49C402, 0x4A4C0402, 0x4A548402,
+    0x4A56C402, 0x4A5AC402, 0x4A66C402, 0x4A518402, 0x4A51C402, 0x4A520402, 0x4A524402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4A67C402, 0x4A680402, 0x4A684402, 0x4A688402, 0x4A68C402, 0x4A690402, 0x4A694402, 0x00000000,
+    0x4A698402, 0x4A69C402, 0x4A6A0402, 0x4A6A4402, 0x4A6A8402, 0x4A6AC402, 0x4A6B0402, 0x00000000,
+    0x4A6B4402, 0x4A6B8402, 0x4A6BC402, 0x4A6C0402, 0x4A6C4402, 0x4A6C8402, 0x4A6CC402, 0x00000000,
+    0x4A6D0402, 0x4A6D4402, 0x4A6D8402, 0x4A6DC402, 0x4A6E0402, 0x4A6E4402, 0x4A6E8402, 0x00000000,
+    0x4A6EC402, 0x4A6F0402, 0x4A6F4402, 0x4A6F8402, 0x4A6FC402, 0x4A700402, 0x4A704402, 0x00000000,
+    0x4A708402, 0x4A70C402, 0x4A710402, 0x4A714402, 0x4A718402, 0x4A71C402, 0x4A720402, 0x00000000,
+    0x4A724402, 0x4A728402, 0x4A72C402, 0x4A730402, 0x4A734402, 0x4A738402, 0x4A73C402, 0x00000000,
+    0x4A740402, 0x4A744402, 0x4A748402, 0x4A74C402, 0x4A750402, 0x4A754402, 0x4A758402, 0x00000000,
+    0x48E4C404, 0x48E5C404, 0x48E6C404, 0x48EBC404, 0x48F1C404, 0x48F44404, 0x48FEC404, 0x49054404,
+    0x490A0404, 0x490C4404, 0x49130404, 0x49150404, 0x49184404, 0x491A8404, 0x491CC404, 0x4925C404,
+    0x492F8404, 0x49324404, 0x493A0404, 0x493B4404, 0x494E0404, 0x80023322, 0x48E1C404, 0x48EFC404,
+    0x48FE8404, 0x49238404, 0x49414404, 0x49438404, 0x4944C404, 0x49474404, 0x49488404, 0x494B0404,
+    0x40F2C402, 0x40F30402, 0x40DB0402, 0x40DB4402, 0x40DB8402, 0x40DBC402, 0x40F34402, 0x40F38402,
+    0x40F3C402, 0x40DC0402, 0x40DC4402, 0x40F40402, 0x40DC8402, 0x40DCC402, 0x40F44402, 0x40F48402,
+    0x40F4C402, 0x40F50402, 0x40F54402, 0x40F58402, 0x40F5C402, 0x40F60402, 0x40F64402, 0x40870402,
+    0x409F4402, 0x40C24402, 0x40F68402, 0x40F6C402, 0x40DD0402, 0x40DD4402, 0x40F70402, 0x40F74402,
+    0x40DD8402, 0x40DDC402, 0x40DE0402, 0x40DE4402, 0x40DE8402, 0x40DEC402, 0x40DF0402, 0x40DF4402,
+    0x40DF8402, 0x40DFC402, 0x40C08402, 0x40C0C402, 0x40C10402, 0x40C14402, 0x409BC402, 0x493C8402,
+    0x40A28402, 0x40A50402, 0x40894402, 0x40A54402, 0x40890402, 0x408F4402, 0x40ED4402, 0x40ED8402,
+    0x40EDC402, 0x40E6C402, 0x40860402, 0x40864402, 0x40A2C402, 0x40C18402, 0x40E54402, 0x40E7C402,
+    0x40874402, 0x40898402, 0x40C88402, 0x4086C402, 0x40F78402, 0x40F7C402, 0x40F80402, 0x40F84402,
+    0x40F88402, 0x408FC402, 0x40EA0402, 0x40EE0402, 0x4089C402, 0x40E78402, 0x408A0402, 0x408A4402,
+    0x42D74402, 0x42D78402, 0x40EAC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80023363, 0x800233C3, 0x80023422, 0x80023462, 0x800234A3, 0x80023502, 0x80023543, 0x800235A3,
+    0x80023603, 0x80023662, 0x800236A3, 0x80023703, 0x80023763, 0x800237C3, 0x80023823, 0x80023882,
+    0x800238C2, 0x80023903, 0x80023962, 0x800239A2, 0x800239E2, 0x80023A23, 0x80023A82, 0x80023AC3,
+    0x80023B22, 0x80023B62, 0x00000000, 0x80023BA2, 0x80023BE3, 0x80023C43, 0x80023CA3, 0x80023D02,
+    0x80023D42, 0x80023D82, 0x80023DC2, 0x80023E02, 0x80023E42, 0x80023E83, 0x80023EE2, 0x80023F23,
+    0x80023F82, 0x80023FC3, 0x80024023, 0x80024083, 0x800240E3, 0x80024142, 0x80024183, 0x800241E2,
+    0x80024222, 0x80024262, 0x800242A2, 0x800242E3, 0x80024343, 0x800243A3, 0x80024403, 0x80024463,
+    0x800244C2, 0x80024502, 0x80024542, 0x80024583, 0x800245E3, 0x80024643, 0x800246A2, 0x800246E3,
+    0x80024743, 0x800247A2, 0x800247E2, 0x80024822, 0x80024862, 0x800248A2, 0x800248E2, 0x80024923,
+    0x80024982, 0x800249C2, 0x80024A03, 0x80024A62, 0x80024AA2, 0x80024AE3, 0x80024B43, 0x80024BA3,
+    0x80024C02, 0x80024C42, 0x80024C82, 0x80024CC2, 0x80024D02, 0x80024D43, 0x80024DA2, 0x80024DE3,
+    0x80024E42, 0x80024E82, 0x80024EC2, 0x80024F02, 0x80024F42, 0x80024F82, 0x80024FC3, 0x80025022,
+    0x80025062, 0x800250A3, 0x80025102, 0x80025143, 0x800251A3, 0x80025202, 0x80025242, 0x80025283,
+    0x800252E2, 0x80025322, 0x80025362, 0x800253A3, 0x80025402, 0x80025443, 0x800254A2, 0x800254E3,
+    0x80025542, 0x80025583, 0x800255E3, 0x80025642, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80025682, 0x800256C2, 0x80025702, 0x80025742, 0x80025782, 0x800257C2, 0x80025802, 0x80025842,
+    0x80025882, 0x800258C2, 0x80025902, 0x80025942, 0x80025982, 0x800259C2, 0x80025A02, 0x80025A42,
+    0x80025A82, 0x80025AC2, 0x80025B02, 0x80025B42, 0x80025B82, 0x80025BC2, 0x80025C02, 0x80025C42,
+    0x80025C82, 0x80025CC2, 0x80025D02, 0x80025D42, 0x80025D82, 0x80025DC2, 0x80025E02, 0x80025E42,
+    0x80025E82, 0x80025EC2, 0x80025F02, 0x80025F42, 0x80025F82, 0x80025FC2, 0x80026002, 0x80026042,
+    0x80026082, 0x800260C2, 0x800238C2, 0x80026102, 0x80026142, 0x80026182, 0x800261C2, 0x80026202,
+    0x80026242, 0x80026282, 0x800262C2, 0x800239A2, 0x80026302, 0x80026342, 0x80026382, 0x800263C2,
+    0x80026402, 0x80026442, 0x80026482, 0x800264C2, 0x80026502, 0x80026542, 0x80026582, 0x800265C2,
+    0x80026602, 0x80026642, 0x80026682, 0x800266C2, 0x80026702, 0x80026742, 0x80026782, 0x800267C2,
+    0x80026802, 0x80026842, 0x80026882, 0x800268C2, 0x80026902, 0x80026942, 0x80026982, 0x800269C2,
+    0x80026A02, 0x80026A42, 0x80026A82, 0x80026AC2, 0x80026B02, 0x80026B42, 0x80026B82, 0x80026BC2,
+    0x80026C02, 0x80026C42, 0x80026C82, 0x80026CC2, 0x80026D02, 0x80026D42, 0x80026D82, 0x80026DC2,
+    0x80026E02, 0x80026E42, 0x80026E82, 0x80026EC2, 0x80026F02, 0x80026F42, 0x80026F82, 0x80026FC2,
+    0x80027002, 0x80027042, 0x80027082, 0x800270C2, 0x80027102, 0x80027142, 0x80027182, 0x800271C2,
+    0x80027202, 0x80027242, 0x80027282, 0x800272C2, 0x80027302, 0x80027342, 0x80027382, 0x800273C2,
+    0x80027402, 0x80027442, 0x80027482, 0x800274C2, 0x80027502, 0x80027542, 0x80027582, 0x800275C2,
+    0x80027602, 0x80027642, 0x80027682, 0x800276C2, 0x80027702, 0x80027742, 0x80027782, 0x800277C2,
+    0x80027802, 0x80027842, 0x80027882, 0x800278C2, 0x80027902, 0x80027942, 0x80027982, 0x800279C2,
+    0x80027A02, 0x80027A42, 0x80027A82, 0x800248E2, 0x80027AC2, 0x80027B02, 0x80027B42, 0x80027B82,
+    0x80027BC2, 0x80027C02, 0x80027C42, 0x80027C82, 0x80027CC2, 0x80027D02, 0x80027D42, 0x80027D82,
+    0x80027DC2, 0x80027E02, 0x80027E42, 0x80027E82, 0x80027EC2, 0x80027F02, 0x80027F42, 0x80024C42,
+    0x80027F82, 0x80027FC2, 0x80028002, 0x80028042, 0x80028082, 0x800280C2, 0x80028102, 0x80028142,
+    0x80028182, 0x800281C2, 0x80028202, 0x80028242, 0x80028282, 0x800282C2, 0x80028302, 0x80024F82,
+    0x80028342, 0x80028382, 0x800283C2, 0x80028402, 0x80028442, 0x80028482, 0x800284C2, 0x80028502,
+    0x80028542, 0x80028582, 0x800285C2, 0x80028602, 0x80028642, 0x80028682, 0x800286C2, 0x80028702,
+    0x80028742, 0x80028782, 0x800287C2, 0x80028802, 0x80028842, 0x80028882, 0x800288C2, 0x80028902,
+    0x80028942, 0x80028982, 0x800289C2, 0x80028A02, 0x80028A42, 0x80028A82, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4746C402, 0x47470402, 0x47474402, 0x47478402, 0x4747C402, 0x47480402, 0x47484402, 0x47488402,
+    0x4748C402, 0x47490402, 0x47494402, 0x47498402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40824403, 0x408D8402, 0x40A48402, 0x40F04402, 0x4752C402, 0x47D5C402, 0x80028AC2, 0x47E60402,
+    0x40E00402, 0x40E04402, 0x40E08402, 0x40E0C402, 0x40E10402, 0x40E14402, 0x40E18402, 0x40E1C402,
+    0x40E20402, 0x40E24402, 0x47530402, 0x47534402, 0x40E28402, 0x40E2C402, 0x40E30402, 0x40E34402,
+    0x40E38402, 0x40E3C402, 0x40E40402, 0x40E44402, 0x40878402, 0x40C8C402, 0x40C90402, 0x40C94402,
+    0x47538402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x40002022, 0x40002042, 0x40002062, 0x40002082, 0x400020A2, 0x400020C2,
+    0x4087C402, 0x47D70402, 0x80028B02, 0x47D74402, 0x80028B42, 0x47D78402, 0x47530404, 0x4753C402,
+    0x80025C42, 0x80028B82, 0x80028BC2, 0x47D60402, 0x80028C02, 0x40F08402, 0x47540402, 0x47544402,
+    0x00000000, 0x50B6840D, 0x50B6840E, 0x50B6C40D, 0x50B6C40E, 0x50B7040D, 0x50B7040E, 0x50B7840D,
+    0x50B7840E, 0x50B7C40D, 0x50B7C40E, 0x50B8040E, 0x80028C42, 0x50B8440E, 0x80028C82, 0x50B8840E,
+    0x80028CC2, 0x50B8C40E, 0x80028D02, 0x50B9040E, 0x80028D42, 0x50B9440E, 0x80028D82, 0x50B9840E,
+    0x80028DC2, 0x50B9C40E, 0x80028E02, 0x50BA040E, 0x80028E42, 0x50BA440E, 0x80028E82, 0x50BA840E,
+    0x80028EC2, 0x50BAC40E, 0x80028F02, 0x50BB040D, 0x50BB040E, 0x80028F42, 0x50BB440E, 0x80028F82,
+    0x50BB840E, 0x80028FC2, 0x50BBC40E, 0x50BC040E, 0x50BC440E, 0x50BC840E, 0x50BCC40E, 0x50BD040E,
+    0x80029002, 0x80029042, 0x50BD440E, 0x80029082, 0x800290C2, 0x50BD840E, 0x80029102, 0x80029142,
+    0x50BDC40E, 0x80029182, 0x800291C2, 0x50BE040E, 0x80029202, 0x80029242, 0x50BE440E, 0x50BE840E,
+    0x50BEC40E, 0x50BF040E, 0x50BF440E, 0x50BF840D, 0x50BF840E, 0x50BFC40D, 0x50BFC40E, 0x50C0040D,
+    0x50C0040E, 0x50C0440E, 0x50C0840E, 0x50C0C40E, 0x50C1040E, 0x50C1440E, 0x50C1840D, 0x50C1840E,
+    0x50C1C40E, 0x50C2040E, 0x50C2440E, 0x50C2840E, 0x80029282, 0x50B8040D, 0x50B8C40D, 0x00000000,
+    0x00000000, 0x400006E2, 0x40000702, 0x4130C402, 0x41310402, 0x47D7C402, 0x800292C2, 0x80029302,
+    0x40880402, 0x50B6840F, 0x50B68411, 0x50B6C40F, 0x50B6C411, 0x50B7040F, 0x50B70411, 0x50B7840F,
+    0x50B78411, 0x50B7C40F, 0x50B7C411, 0x50B80411, 0x80029342, 0x50B84411, 0x80029382, 0x50B88411,
+    0x800293C2, 0x50B8C411, 0x80029402, 0x50B90411, 0x80029442, 0x50B94411, 0x80029482, 0x50B98411,
+    0x800294C2, 0x50B9C411, 0x80029502, 0x50BA0411, 0x80029542, 0x50BA4411, 0x80029582, 0x50BA8411,
+    0x800295C2, 0x50BAC411, 0x80029602, 0x50BB040F, 0x50BB0411, 0x80029642, 0x50BB4411, 0x80029682,
+    0x50BB8411, 0x800296C2, 0x50BBC411, 0x50BC0411, 0x50BC4411, 0x50BC8411, 0x50BCC411, 0x50BD0411,
+    0x80029702, 0x80029742, 0x50BD4411, 0x80029782, 0x800297C2, 0x50BD8411, 0x80029802, 0x80029842,
+    0x50BDC411, 0x80029882, 0x800298C2, 0x50BE0411, 0x80029902, 0x80029942, 0x50BE4411, 0x50BE8411,
+    0x50BEC411, 0x50BF0411, 0x50BF4411, 0x50BF840F, 0x50BF8411, 0x50BFC40F, 0x50BFC411, 0x50C0040F,
+    0x50C00411, 0x50C04411, 0x50C08411, 0x50C0C411, 0x50C10411, 0x50C14411, 0x50C1840F, 0x50C18411,
+    0x50C1C411, 0x50C20411, 0x50C24411, 0x50C28411, 0x80029982, 0x50B8040F, 0x50B8C40F, 0x800299C2,
+    0x80029A02, 0x80029A42, 0x80029A82, 0x40884402, 0x47D80402, 0x47D84402, 0x80029AC2, 0x80029B02,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x510A4402, 0x510A8402, 0x510AC402,
+    0x510B4402, 0x510BC402, 0x510C0402, 0x510C4402, 0x510CC402, 0x510D0402, 0x510D4402, 0x510E0402,
+    0x510E4402, 0x510E8402, 0x510EC402, 0x510FC402, 0x51100402, 0x51104402, 0x51108402, 0x5110C402,
+    0x51110402, 0x51114402, 0x51124402, 0x51128402, 0x51130402, 0x51134402, 0x5113C402, 0x51140402,
+    0x51144402, 0x51148402, 0x5114C402, 0x51150402, 0x51154402, 0x5115C402, 0x51168402, 0x5116C402,
+    0x51170402, 0x51174402, 0x510B8402, 0x510D8402, 0x510F0402, 0x51178402, 0x51130404, 0x510C8402,
+    0x00000000, 0x505D4404, 0x505D8404, 0x5094C404, 0x505DC404, 0x50954404, 0x50958404, 0x505E0404,
+    0x505E4404, 0x505E8404, 0x50964404, 0x50968404, 0x5096C404, 0x50970404, 0x50974404, 0x50978404,
+    0x5063C404, 0x505EC404, 0x505F0404, 0x505F4404, 0x50658404, 0x505F8404, 0x505FC404, 0x50600404,
+    0x50604404, 0x50608404, 0x5060C404, 0x50610404, 0x50614404, 0x50618404, 0x5061C404, 0x507CC404,
+    0x507D0404, 0x507D4404, 0x507D8404, 0x507DC404, 0x507E0404, 0x507E4404, 0x507E8404, 0x507EC404,
+    0x507F0404, 0x507F4404, 0x507F8404, 0x507FC404, 0x50800404, 0x50804404, 0x50808404, 0x5080C404,
+    0x50810404, 0x50814404, 0x50818404, 0x5081C404, 0x507C8404, 0x50624404, 0x50628404, 0x509C0404,
+    0x509C4404, 0x509D4404, 0x509DC404, 0x509F0404, 0x50A00404, 0x50A08404, 0x50644404, 0x50A18404,
+    0x50A20404, 0x50648404, 0x5064C404, 0x50654404, 0x5065C404, 0x50660404, 0x50670404, 0x50678404,
+    0x50680404, 0x50684404, 0x50688404, 0x5068C404, 0x50690404, 0x5069C404, 0x506AC404, 0x506D4404,
+    0x506F0404, 0x50704404, 0x50A68404, 0x50A6C404, 0x50730404, 0x50734404, 0x50738404, 0x50858404,
+    0x5085C404, 0x50868404, 0x5088C404, 0x50890404, 0x50898404, 0x508C0404, 0x508CC404, 0x00000000,
+    0x47548402, 0x4754C402, 0x80029B42, 0x80029B82, 0x80029BC2, 0x80029C02, 0x80029C42, 0x80029C82,
+    0x80029CC2, 0x80029D02, 0x80029D42, 0x80029D82, 0x80029DC2, 0x80029E02, 0x80029E42, 0x80029E82,
+    0x80029EC2, 0x80029F02, 0x80029F42, 0x80029F82, 0x51138402, 0x80029FC2, 0x5112C402, 0x8002A002,
+    0x8002A042, 0x8002A082, 0x8002A0C2, 0x8002A102, 0x510B0402, 0x510DC402, 0x8002A142, 0x8002A182,
+    0x51160402, 0x51164402, 0x51158402, 0x8002A1C2, 0x510A8419, 0x510C0419, 0x510D4419, 0x510E0419,
+    0x51118402, 0x5111C402, 0x51120402, 0x510D0419, 0x510F4402, 0x510F8402, 0x5117C402, 0x51180402,
+    0x4749C402, 0x474A0402, 0x474A4402, 0x474A8402, 0x474AC402, 0x474B0402, 0x474B4402, 0x474B8402,
+    0x474BC402, 0x474C0402, 0x474C4402, 0x474C8402, 0x474CC402, 0x474D0402, 0x474D4402, 0x474D8402,
+    0x474DC402, 0x474E0402, 0x474E4402, 0x474E8402, 0x474EC402, 0x474F0402, 0x474F4402, 0x474F8402,
+    0x474FC402, 0x47500402, 0x47504402, 0x47508402, 0x4750C402, 0x47510402, 0x47514402, 0x47518402,
+    0x4751C402, 0x47520402, 0x47524402, 0x47528402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x50B8840F, 0x50B9840F, 0x50B9C40F, 0x50BB840F, 0x50BC440F, 0x50BD040F, 0x50BD440F, 0x50BD840F,
+    0x50BDC40F, 0x50BE040F, 0x50BEC40F, 0x50C0440F, 0x50C0840F, 0x50C0C40F, 0x50C1040F, 0x50C1440F,
+    0x8002A203, 0x8002A263, 0x8002A2C3, 0x8002A323, 0x8002A383, 0x8002A3E3, 0x8002A443, 0x8002A4A3,
+    0x8002A503, 0x8002A563, 0x8002A5C3, 0x8002A623, 0x8002A683, 0x8002A6E3, 0x8002A744, 0x8002A7C4,
+    0x8002A844, 0x8002A8C4, 0x8002A944, 0x8002A9C4, 0x8002AA44, 0x8002AAC4, 0x8002AB44, 0x8002ABC4,
+    0x8002AC44, 0x8002ACC4, 0x8002AD44, 0x8002ADC4, 0x8002AE44, 0x8002AEC7, 0x8002AFA6, 0x00000000,
+    0x8002B064, 0x8002B0E4, 0x8002B164, 0x8002B1E4, 0x8002B264, 0x8002B2E4, 0x8002B364, 0x8002B3E4,
+    0x8002B464, 0x8002B4E4, 0x8002B564, 0x8002B5E4, 0x8002B664, 0x8002B6E4, 0x8002B764, 0x8002B7E4,
+    0x8002B864, 0x8002B8E4, 0x8002B964, 0x8002B9E4, 0x8002BA64, 0x8002BAE4, 0x8002BB64, 0x8002BBE4,
+    0x8002BC64, 0x8002BCE4, 0x8002BD64, 0x8002BDE4, 0x8002BE64, 0x8002BEE4, 0x8002BF64, 0x8002BFE4,
+    0x8002C064, 0x8002C0E4, 0x8002C164, 0x8002C1E4, 0x8002C262, 0x8002C2A2, 0x8002C2E2, 0x8002C322,
+    0x80021542, 0x800217C2, 0x8002C362, 0x8002C3A2, 0x8002C3E2, 0x8002C422, 0x8002C462, 0x8002C4A2,
+    0x8002C4E3, 0x8002C542, 0x8002C582, 0x8002C5C2, 0x8002C602, 0x8002C642, 0x8002C682, 0x8002C6C2,
+    0x8002C702, 0x8002C742, 0x8002C362, 0x8002C782, 0x8002C7C2, 0x8002C802, 0x8002C842, 0x8002C882,
+    0x505D4406, 0x505DC406, 0x505E0406, 0x505E8406, 0x505EC406, 0x505F0406, 0x505F8406, 0x50600406,
+    0x50604406, 0x5060C406, 0x50610406, 0x50614406, 0x50618406, 0x5061C406, 0x8002C8C2, 0x8002C902,
+    0x8002C942, 0x8002C982, 0x8002C9C2, 0x8002CA02, 0x8002CA42, 0x8002CA82, 0x8002CAC2, 0x8002CB02,
+    0x8002CB42, 0x8002CB82, 0x8002CBC2, 0x8002CC02, 0x8002CC45, 0x8002CCE4, 0x8002CD62, 0x47550402,
+    0x8002CDA2, 0x8002CDE2, 0x8002CE22, 0x8002CE62, 0x8002CEA2, 0x8002CEE2, 0x8002CF22, 0x8002CF62,
+    0x8002CFA2, 0x8002CFE2, 0x8002D022, 0x8002D062, 0x8002D0A2, 0x8002D0E2, 0x8002D122, 0x8002D162,
+    0x8002D1A2, 0x8002D1E2, 0x8002D222, 0x8002D262, 0x8002D2A2, 0x8002D2E2, 0x8002D322, 0x8002D362,
+    0x8002D3A2, 0x8002D3E2, 0x8002D422, 0x8002D462, 0x8002D4A2, 0x8002D4E2, 0x8002D522, 0x8002D562,
+    0x8002D5A2, 0x8002D5E2, 0x8002D622, 0x8002D662, 0x8002D6A2, 0x8002D6E2, 0x8002D722, 0x8002D762,
+    0x8002D7A2, 0x8002D7E2, 0x8002D822, 0x8002D862, 0x8002D8A2, 0x8002D8E2, 0x8002D922, 0x8002D962,
+    0x8002D9A2, 0x8002D9E2, 0x8002DA22, 0x8002DA62, 0x8002DAA2, 0x8002C3A2, 0x8002DAE2, 0x8002DB22,
+    0x8002DB62, 0x8002DBA2, 0x8002DBE2, 0x8002DC22, 0x8002DC62, 0x8002DCA2, 0x8002DCE2, 0x8002C3E2,
+    0x8002DD23, 0x8002DD83, 0x8002DDE3, 0x8002DE43, 0x8002DEA3, 0x8002DF03, 0x8002DF63, 0x8002DFC3,
+    0x8002E023, 0x8002E084, 0x8002E104, 0x8002E184, 0x8002E202, 0x8002E243, 0x8002E2A2, 0x8002E2E3,
+    0x50B68413, 0x50B6C413, 0x50B70413, 0x50B78413, 0x50B7C413, 0x50B80413, 0x50B84413, 0x50B88413,
+    0x50B8C413, 0x50B90413, 0x50B94413, 0x50B98413, 0x50B9C413, 0x50BA0413, 0x50BA4413, 0x50BA8413,
+    0x50BAC413, 0x50BB0413, 0x50BB4413, 0x50BB8413, 0x50BBC413, 0x50BC0413, 0x50BC4413, 0x50BC8413,
+    0x50BCC413, 0x50BD0413, 0x50BD4413, 0x50BD8413, 0x50BDC413, 0x50BE0413, 0x50BE4413, 0x50BE8413,
+    0x50BEC413, 0x50BF0413, 0x50BF4413, 0x50BF8413, 0x50BFC413, 0x50C00413, 0x50C04413, 0x50C08413,
+    0x50C0C413, 0x50C10413, 0x50C14413, 0x50C18413, 0x50C1C413, 0x50C20413, 0x50C24413, 0x8002E344,
+    0x8002E3C5, 0x8002E464, 0x8002E4E5, 0x8002E583, 0x8002E5E5, 0x8002E683, 0x8002E6E3, 0x8002E746,
+    0x8002E804, 0x8002E883, 0x8002E8E3, 0x8002E943, 0x8002E9A4, 0x8002EA24, 0x8002EAA4, 0x8002EB24,
+    0x8002EBA4, 0x8002EC24, 0x8002ECA4, 0x8002ED26, 0x8002EDE2, 0x8002EE26, 0x8002EEE6, 0x8002EFA5,
+    0x8002F044, 0x8002F0C6, 0x8002F186, 0x8002F244, 0x8002F2C3, 0x8002F323, 0x8002F384, 0x8002F404,
+    0x8002F485, 0x8002F525, 0x8002F5C3, 0x8002F623, 0x8002F684, 0x8002F703, 0x8002F763, 0x8002F7C2,
+    0x8002F802, 0x8002F843, 0x8002F8A3, 0x8002F906, 0x8002F9C4, 0x8002FA45, 0x8002FAE6, 0x8002FBA4,
+    0x8002FC23, 0x8002FC83, 0x8002FCE6, 0x8002FDA4, 0x8002FE26, 0x8002FEE3, 0x8002FF45, 0x8002FFE3,
+    0x80030044, 0x800300C3, 0x80030124, 0x800301A5, 0x80030244, 0x800302C5, 0x80030364, 0x800303E2,
+    0x80030425, 0x800304C3, 0x80030523, 0x80030584, 0x80030603, 0x80030663, 0x800306C3, 0x80030725,
+    0x800307C4, 0x80030842, 0x80030886, 0x80030943, 0x800309A5, 0x80030A44, 0x80030AC4, 0x80030B43,
+    0x80030BA3, 0x80030C04, 0x80030C82, 0x80030CC4, 0x80030D45, 0x80030DE2, 0x80030E26, 0x80030EE3,
+    0x80030F43, 0x80030FA3, 0x80031003, 0x80031063, 0x800310C3, 0x80031123, 0x80031183, 0x800311E3,
+    0x80031243, 0x800312A3, 0x80031304, 0x80031384, 0x80031404, 0x80031484, 0x80031504, 0x80031584,
+    0x80031604, 0x80031684, 0x80031704, 0x80031784, 0x80031804, 0x80031884, 0x80031904, 0x80031984,
+    0x80031A04, 0x80031A83, 0x80031AE2, 0x80031B22, 0x80031B63, 0x80031BC2, 0x80031C02, 0x80031C42,
+    0x80031C83, 0x80031CE3, 0x80031D42, 0x80031D84, 0x80031E04, 0x80031E84, 0x80031F04, 0x80031F88,
+    0x80032082, 0x800320C2, 0x80032102, 0x80032142, 0x80032182, 0x800321C2, 0x80032202, 0x80032242,
+    0x80032283, 0x800322E4, 0x80032362, 0x800323A2, 0x800323E2, 0x80032422, 0x80032462, 0x800324A2,
+    0x800324E2, 0x80032523, 0x80032583, 0x800325E3, 0x80032643, 0x800326A2, 0x800326E2, 0x80032722,
+    0x80032762, 0x800327A2, 0x800327E2, 0x80032822, 0x80032862, 0x800328A2, 0x800328E2, 0x80032923,
+    0x80032983, 0x800329E2, 0x80032A23, 0x80032A83, 0x80032AE3, 0x80032B42, 0x80032B83, 0x80032BE3,
+    0x80032C44, 0x80032CC2, 0x80032D03, 0x80032D63, 0x80032DC3, 0x80032E23, 0x80032E85, 0x80032F26,
+    0x80032FE2, 0x80033022, 0x80033062, 0x800330A2, 0x800330E2, 0x80033122, 0x80033162, 0x800331A2,
+    0x800331E2, 0x80033222, 0x80033262, 0x800332A2, 0x800332E2, 0x80033322, 0x80033362, 0x800333A2,
+    0x800333E2, 0x80033422, 0x80033464, 0x800334E2, 0x80033522, 0x80033562, 0x800335A4, 0x80033623,
+    0x80033682, 0x800336C2, 0x80033702, 0x80033742, 0x80033782, 0x800337C2, 0x80033802, 0x80033842,
+    0x80033882, 0x800338C2, 0x80033903, 0x80033962, 0x800339A2, 0x800339E3, 0x80033A43, 0x80033AA2,
+    0x80033AE4, 0x80033B63, 0x80033BC2, 0x80033C02, 0x80033C42, 0x80033C82, 0x80033CC3, 0x80033D23,
+    0x80033D83, 0x80033DE3, 0x80033E43, 0x80033EA3, 0x80033F03, 0x80033F63, 0x80033FC3, 0x80034023,
+    0x80034083, 0x800340E4, 0x80034164, 0x800341E4, 0x80034264, 0x800342E4, 0x80034364, 0x800343E4,
+    0x80034464, 0x800344E4, 0x80034564, 0x800345E4, 0x80034664, 0x800346E4, 0x80034764, 0x800347E4,
+    0x80034864, 0x800348E4, 0x80034964, 0x800349E4, 0x80034A64, 0x80034AE4, 0x80034B64, 0x80034BE3,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x43FD8402, 0x43FDC402, 0x43FE0402, 0x43FE4402, 0x43FE8402, 0x43FEC402, 0x43FF0402, 0x43FF4402,
+    0x43FF8402, 0x43FFC402, 0x44000402, 0x44004402, 0x44008402, 0x4400C402, 0x44010402, 0x44014402,
+    0x44018402, 0x4401C402, 0x44020402, 0x44024402, 0x44028402, 0x4402C402, 0x44030402, 0x44034402,
+    0x44038402, 0x4403C402, 0x44040402, 0x44044402, 0x44048402, 0x4404C402, 0x44050402, 0x44054402,
+    0x44058402, 0x4405C402, 0x44060402, 0x44064402, 0x44068402, 0x4406C402, 0x44070402, 0x44074402,
+    0x44078402, 0x4407C402, 0x44080402, 0x44084402, 0x44088402, 0x4408C402, 0x44090402, 0x44094402,
+    0x44098402, 0x4409C402, 0x440A0402, 0x440A4402, 0x440A8402, 0x440AC402, 0x440B0402, 0x440B4402,
+    0x440B8402, 0x440BC402, 0x440C0402, 0x440C4402, 0x440C8402, 0x440CC402, 0x440D0402, 0x440D4402,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001, 0x00000001,
+    0x51184402, 0x51188402, 0x5118C402, 0x51190402, 0x51194402, 0x51198402, 0x5119C402, 0x511A0402,
+    0x511A4402, 0x511A8402, 0x511AC402, 0x511B0402, 0x511B4402, 0x511B8402, 0x511BC402, 0x511C0402,
+    0x511C4402, 0x511C8402, 0x511CC402, 0x511D0402, 0x511D4402, 0x511D8402, 0x511DC402, 0x511E0402,
+    0x511E4402, 0x511E8402, 0x511EC402, 0x511F0402, 0x511F4402, 0x511F8402, 0x511FC402, 0x51200402,
+    0x51204402, 0x51208402, 0x5120C402, 0x51210402, 0x51214402, 0x51218402, 0x5121C402, 0x51220402,
+    0x51224402, 0x51228402, 0x5122C402, 0x51230402, 0x51234402, 0x51238402, 0x5123C402, 0x51240402,
+    0x51244402, 0x51248402, 0x5124C402, 0x51250402, 0x51254402, 0x51258402, 0x5125C402, 0x51260402,
+    0x51264402, 0x51268402, 0x5126C402, 0x51270402, 0x51274402, 0x51278402, 0x5127C402, 0x51280402,
+    0x51284402, 0x51288402, 0x5128C402, 0x51290402, 0x51294402, 0x51298402, 0x5129C402, 0x512A0402,
+    0x512A4402, 0x512A8402, 0x512AC402, 0x512B0402, 0x512B4402, 0x512B8402, 0x512BC402, 0x512C0402,
+    0x512C4402, 0x512C8402, 0x512CC402, 0x512D0402, 0x512D4402, 0x512D8402, 0x512DC402, 0x512E0402,
+    0x512E4402, 0x512E8402, 0x512EC402, 0x512F0402, 0x512F4402, 0x512F8402, 0x512FC402, 0x51300402,
+    0x51304402, 0x51308402, 0x5130C402, 0x51310402, 0x51314402, 0x51318402, 0x5131C402, 0x51320402,
+    0x51324402, 0x51328402, 0x5132C402, 0x51330402, 0x51334402, 0x51338402, 0x5133C402, 0x51340402,
+    0x51344402, 0x51348402, 0x5134C402, 0x51350402, 0x51354402, 0x51358402, 0x5135C402, 0x51360402,
+    0x51364402, 0x51368402, 0x5136C402, 0x51370402, 0x51374402, 0x51378402, 0x5137C402, 0x51380402,
+    0x51384402, 0x51388402, 0x5138C402, 0x51390402, 0x51394402, 0x51398402, 0x5139C402, 0x513A0402,
+    0x513A4402, 0x513A8402, 0x513AC402, 0x513B0402, 0x513B4402, 0x513B8402, 0x513BC402, 0x513C0402,
+    0x513C4402, 0x513C8402, 0x513CC402, 0x513D0402, 0x513D4402, 0x513D8402, 0x513DC402, 0x513E0402,
+    0x513E4402, 0x513E8402, 0x513EC402, 0x513F0402, 0x513F4402, 0x513F8402, 0x513FC402, 0x51400402,
+    0x51404402, 0x51408402, 0x5140C402, 0x51410402, 0x51414402, 0x51418402, 0x5141C402, 0x51420402,
+    0x51424402, 0x51428402, 0x5142C402, 0x51430402, 0x51434402, 0x51438402, 0x5143C402, 0x51440402,
+    0x51444402, 0x51448402, 0x5144C402, 0x51450402, 0x51454402, 0x51458402, 0x5145C402, 0x51460402,
+    0x51464402, 0x51468402, 0x5146C402, 0x51470402, 0x51474402, 0x51478402, 0x5147C402, 0x51480402,
+    0x51484402, 0x51488402, 0x5148C402, 0x51490402, 0x51494402, 0x51498402, 0x5149C402, 0x514A0402,
+    0x514A4402, 0x514A8402, 0x514AC402, 0x514B0402, 0x514B4402, 0x514B8402, 0x514BC402, 0x514C0402,
+    0x514C4402, 0x514C8402, 0x514CC402, 0x514D0402, 0x514D4402, 0x514D8402, 0x514DC402, 0x514E0402,
+    0x514E4402, 0x514E8402, 0x514EC402, 0x514F0402, 0x514F4402, 0x514F8402, 0x514FC402, 0x51500402,
+    0x51504402, 0x51508402, 0x5150C402, 0x51510402, 0x51514402, 0x51518402, 0x5151C402, 0x51520402,
+    0x51524402, 0x51528402, 0x5152C402, 0x51530402, 0x51534402, 0x51538402, 0x5153C402, 0x51540402,
+    0x51544402, 0x51548402, 0x5154C402, 0x51550402, 0x51554402, 0x51558402, 0x5155C402, 0x51560402,
+    0x51564402, 0x51568402, 0x5156C402, 0x51570402, 0x51574402, 0x51578402, 0x5157C402, 0x51580402,
+    0x51584402, 0x51588402, 0x5158C402, 0x51590402, 0x51594402, 0x51598402, 0x5159C402, 0x515A0402,
+    0x515A4402, 0x515A8402, 0x515AC402, 0x515B0402, 0x515B4402, 0x515B8402, 0x515BC402, 0x515C0402,
+    0x515C4402, 0x515C8402, 0x515CC402, 0x515D0402, 0x515D4402, 0x515D8402, 0x515DC402, 0x515E0402,
+    0x515E4402, 0x515E8402, 0x515EC402, 0x515F0402, 0x515F4402, 0x515F8402, 0x515FC402, 0x51600402,
+    0x51604402, 0x51608402, 0x5160C402, 0x51610402, 0x51614402, 0x51618402, 0x5161C402, 0x51620402,
+    0x51624402, 0x51628402, 0x5162C402, 0x51630402, 0x51634402, 0x51638402, 0x5163C402, 0x51640402,
+    0x51644402, 0x51648402, 0x5164C402, 0x51650402, 0x51654402, 0x51658402, 0x5165C402, 0x51660402,
+    0x51664402, 0x51668402, 0x5166C402, 0x51670402, 0x51674402, 0x51678402, 0x5167C402, 0x51680402,
+    0x51684402, 0x51688402, 0x5168C402, 0x51690402, 0x51694402, 0x51698402, 0x5169C402, 0x516A0402,
+    0x516A4402, 0x516A8402, 0x516AC402, 0x516B0402, 0x516B4402, 0x516B8402, 0x516BC402, 0x516C0402,
+    0x516C4402, 0x516C8402, 0x516CC402, 0x516D0402, 0x516D4402, 0x516D8402, 0x516DC402, 0x516E0402,
+    0x516E4402, 0x516E8402, 0x516EC402, 0x516F0402, 0x516F4402, 0x516F8402, 0x516FC402, 0x51700402,
+    0x51704402, 0x51708402, 0x5170C402, 0x51710402, 0x51714402, 0x51718402, 0x5171C402, 0x51720402,
+    0x51724402, 0x51728402, 0x5172C402, 0x51730402, 0x51734402, 0x51738402, 0x5173C402, 0x51740402,
+    0x51744402, 0x51748402, 0x5174C402, 0x51750402, 0x51754402, 0x51758402, 0x5175C402, 0x51760402,
+    0x51764402, 0x51768402, 0x5176C402, 0x51770402, 0x51774402, 0x51778402, 0x5177C402, 0x51780402,
+    0x51784402, 0x51788402, 0x5178C402, 0x51790402, 0x51794402, 0x51798402, 0x5179C402, 0x517A0402,
+    0x517A4402, 0x517A8402, 0x517AC402, 0x517B0402, 0x517B4402, 0x517B8402, 0x517BC402, 0x517C0402,
+    0x517C4402, 0x517C8402, 0x517CC402, 0x517D0402, 0x517D4402, 0x517D8402, 0x517DC402, 0x517E0402,
+    0x517E4402, 0x517E8402, 0x517EC402, 0x517F0402, 0x517F4402, 0x517F8402, 0x517FC402, 0x51800402,
+    0x51804402, 0x51808402, 0x5180C402, 0x51810402, 0x51814402, 0x51818402, 0x5181C402, 0x51820402,
+    0x51824402, 0x51828402, 0x5182C402, 0x51830402, 0x51834402, 0x51838402, 0x5183C402, 0x51840402,
+    0x51844402, 0x51848402, 0x5184C402, 0x51850402, 0x51854402, 0x51858402, 0x5185C402, 0x51860402,
+    0x51864402, 0x51868402, 0x5186C402, 0x51870402, 0x51874402, 0x51878402, 0x5187C402, 0x51880402,
+    0x51884402, 0x51888402, 0x5188C402, 0x51890402, 0x51894402, 0x51898402, 0x5189C402, 0x518A0402,
+    0x518A4402, 0x518A8402, 0x518AC402, 0x518B0402, 0x518B4402, 0x518B8402, 0x518BC402, 0x518C0402,
+    0x518C4402, 0x518C8402, 0x518CC402, 0x518D0402, 0x518D4402, 0x518D8402, 0x518DC402, 0x518E0402,
+    0x518E4402, 0x518E8402, 0x518EC402, 0x518F0402, 0x518F4402, 0x518F8402, 0x518FC402, 0x51900402,
+    0x51904402, 0x51908402, 0x5190C402, 0x51910402, 0x51914402, 0x51918402, 0x5191C402, 0x51920402,
+    0x51924402, 0x51928402, 0x5192C402, 0x51930402, 0x51934402, 0x51938402, 0x5193C402, 0x51940402,
+    0x51944402, 0x51948402, 0x5194C402, 0x51950402, 0x51954402, 0x51958402, 0x5195C402, 0x51960402,
+    0x51964402, 0x51968402, 0x5196C402, 0x51970402, 0x51974402, 0x51978402, 0x5197C402, 0x51980402,
+    0x51984402, 0x51988402, 0x5198C402, 0x51990402, 0x51994402, 0x51998402, 0x5199C402, 0x519A0402,
+    0x519A4402, 0x519A8402, 0x519AC402, 0x519B0402, 0x519B4402, 0x519B8402, 0x519BC402, 0x519C0402,
+    0x519C4402, 0x519C8402, 0x519CC402, 0x519D0402, 0x519D4402, 0x519D8402, 0x519DC402, 0x519E0402,
+    0x519E4402, 0x519E8402, 0x519EC402, 0x519F0402, 0x519F4402, 0x519F8402, 0x519FC402, 0x51A00402,
+    0x51A04402, 0x51A08402, 0x51A0C402, 0x51A10402, 0x51A14402, 0x51A18402, 0x51A1C402, 0x51A20402,
+    0x51A24402, 0x51A28402, 0x51A2C402, 0x51A30402, 0x51A34402, 0x51A38402, 0x51A3C402, 0x51A40402,
+    0x51A44402, 0x51A48402, 0x51A4C402, 0x51A50402, 0x51A54402, 0x51A58402, 0x51A5C402, 0x51A60402,
+    0x51A64402, 0x51A68402, 0x51A6C402, 0x51A70402, 0x51A74402, 0x51A78402, 0x51A7C402, 0x51A80402,
+    0x51A84402, 0x51A88402, 0x51A8C402, 0x51A90402, 0x51A94402, 0x51A98402, 0x51A9C402, 0x51AA0402,
+    0x51AA4402, 0x51AA8402, 0x51AAC402, 0x51AB0402, 0x51AB4402, 0x51AB8402, 0x51ABC402, 0x51AC0402,
+    0x51AC4402, 0x51AC8402, 0x51ACC402, 0x51AD0402, 0x51AD4402, 0x51AD8402, 0x51ADC402, 0x51AE0402,
+    0x51AE4402, 0x51AE8402, 0x51AEC402, 0x51AF0402, 0x51AF4402, 0x51AF8402, 0x51AFC402, 0x51B00402,
+    0x51B04402, 0x51B08402, 0x51B0C402, 0x51B10402, 0x51B14402, 0x51B18402, 0x51B1C402, 0x51B20402,
+    0x51B24402, 0x51B28402, 0x51B2C402, 0x51B30402, 0x51B34402, 0x51B38402, 0x51B3C402, 0x51B40402,
+    0x51B44402, 0x51B48402, 0x51B4C402, 0x51B50402, 0x51B54402, 0x51B58402, 0x51B5C402, 0x51B60402,
+    0x51B64402, 0x51B68402, 0x51B6C402, 0x51B70402, 0x51B74402, 0x51B78402, 0x51B7C402, 0x51B80402,
+    0x51B84402, 0x51B88402, 0x51B8C402, 0x51B90402, 0x51B94402, 0x51B98402, 0x51B9C402, 0x51BA0402,
+    0x51BA4402, 0x51BA8402, 0x51BAC402, 0x51BB0402, 0x51BB4402, 0x51BB8402, 0x51BBC402, 0x51BC0402,
+    0x51BC4402, 0x51BC8402, 0x51BCC402, 0x51BD0402, 0x51BD4402, 0x51BD8402, 0x51BDC402, 0x51BE0402,
+    0x51BE4402, 0x51BE8402, 0x51BEC402, 0x51BF0402, 0x51BF4402, 0x51BF8402, 0x51BFC402, 0x51C00402,
+    0x51C04402, 0x51C08402, 0x51C0C402, 0x51C10402, 0x51C14402, 0x51C18402, 0x51C1C402, 0x51C20402,
+    0x51C24402, 0x51C28402, 0x51C2C402, 0x51C30402, 0x51C34402, 0x51C38402, 0x51C3C402, 0x51C40402,
+    0x51C44402, 0x51C48402, 0x51C4C402, 0x51C50402, 0x51C54402, 0x51C58402, 0x51C5C402, 0x51C60402,
+    0x51C64402, 0x51C68402, 0x51C6C402, 0x51C70402, 0x51C74402, 0x51C78402, 0x51C7C402, 0x51C80402,
+    0x51C84402, 0x51C88402, 0x51C8C402, 0x51C90402, 0x51C94402, 0x51C98402, 0x51C9C402, 0x51CA0402,
+    0x51CA4402, 0x51CA8402, 0x51CAC402, 0x51CB0402, 0x51CB4402, 0x51CB8402, 0x51CBC402, 0x51CC0402,
+    0x51CC4402, 0x51CC8402, 0x51CCC402, 0x51CD0402, 0x51CD4402, 0x51CD8402, 0x51CDC402, 0x51CE0402,
+    0x51CE4402, 0x51CE8402, 0x51CEC402, 0x51CF0402, 0x51CF4402, 0x51CF8402, 0x51CFC402, 0x51D00402,
+    0x51D04402, 0x51D08402, 0x51D0C402, 0x51D10402, 0x51D14402, 0x51D18402, 0x51D1C402, 0x51D20402,
+    0x51D24402, 0x51D28402, 0x51D2C402, 0x51D30402, 0x51D34402, 0x51D38402, 0x51D3C402, 0x51D40402,
+    0x51D44402, 0x51D48402, 0x51D4C402, 0x51D50402, 0x51D54402, 0x51D58402, 0x51D5C402, 0x51D60402,
+    0x51D64402, 0x51D68402, 0x51D6C402, 0x51D70402, 0x51D74402, 0x51D78402, 0x51D7C402, 0x51D80402,
+    0x51D84402, 0x51D88402, 0x51D8C402, 0x51D90402, 0x51D94402, 0x51D98402, 0x51D9C402, 0x51DA0402,
+    0x51DA4402, 0x51DA8402, 0x51DAC402, 0x51DB0402, 0x51DB4402, 0x51DB8402, 0x51DBC402, 0x51DC0402,
+    0x51DC4402, 0x51DC8402, 0x51DCC402, 0x51DD0402, 0x51DD4402, 0x51DD8402, 0x51DDC402, 0x51DE0402,
+    0x51DE4402, 0x51DE8402, 0x51DEC402, 0x51DF0402, 0x51DF4402, 0x51DF8402, 0x51DFC402, 0x51E00402,
+    0x51E04402, 0x51E08402, 0x51E0C402, 0x51E10402, 0x51E14402, 0x51E18402, 0x51E1C402, 0x51E20402,
+    0x51E24402, 0x51E28402, 0x51E2C402, 0x51E30402, 0x51E34402, 0x51E38402, 0x51E3C402, 0x51E40402,
+    0x51E44402, 0x51E48402, 0x51E4C402, 0x51E50402, 0x51E54402, 0x51E58402, 0x51E5C402, 0x51E60402,
+    0x51E64402, 0x51E68402, 0x51E6C402, 0x51E70402, 0x51E74402, 0x51E78402, 0x51E7C402, 0x51E80402,
+    0x51E84402, 0x51E88402, 0x51E8C402, 0x51E90402, 0x51E94402, 0x51E98402, 0x51E9C402, 0x51EA0402,
+    0x51EA4402, 0x51EA8402, 0x51EAC402, 0x51EB0402, 0x51EB4402, 0x51EB8402, 0x51EBC402, 0x51EC0402,
+    0x51EC4402, 0x51EC8402, 0x51ECC402, 0x51ED0402, 0x51ED4402, 0x51ED8402, 0x51EDC402, 0x51EE0402,
+    0x51EE4402, 0x51EE8402, 0x51EEC402, 0x51EF0402, 0x51EF4402, 0x51EF8402, 0x51EFC402, 0x51F00402,
+    0x51F04402, 0x51F08402, 0x51F0C402, 0x51F10402, 0x51F14402, 0x51F18402, 0x51F1C402, 0x51F20402,
+    0x51F24402, 0x51F28402, 0x51F2C402, 0x51F30402, 0x51F34402, 0x51F38402, 0x51F3C402, 0x51F40402,
+    0x51F44402, 0x51F48402, 0x51F4C402, 0x51F50402, 0x51F54402, 0x51F58402, 0x51F5C402, 0x51F60402,
+    0x51F64402, 0x51F68402, 0x51F6C402, 0x51F70402, 0x51F74402, 0x51F78402, 0x51F7C402, 0x51F80402,
+    0x51F84402, 0x51F88402, 0x51F8C402, 0x51F90402, 0x51F94402, 0x51F98402, 0x51F9C402, 0x51FA0402,
+    0x51FA4402, 0x51FA8402, 0x51FAC402, 0x51FB0402, 0x51FB4402, 0x51FB8402, 0x51FBC402, 0x51FC0402,
+    0x51FC4402, 0x51FC8402, 0x51FCC402, 0x51FD0402, 0x51FD4402, 0x51FD8402, 0x51FDC402, 0x51FE0402,
+    0x51FE4402, 0x51FE8402, 0x51FEC402, 0x51FF0402, 0x51FF4402, 0x51FF8402, 0x51FFC402, 0x52000402,
+    0x52004402, 0x52008402, 0x5200C402, 0x52010402, 0x52014402, 0x52018402, 0x5201C402, 0x52020402,
+    0x52024402, 0x52028402, 0x5202C402, 0x52030402, 0x52034402, 0x52038402, 0x5203C402, 0x52040402,
+    0x52044402, 0x52048402, 0x5204C402, 0x52050402, 0x52054402, 0x52058402, 0x5205C402, 0x52060402,
+    0x52064402, 0x52068402, 0x5206C402, 0x52070402, 0x52074402, 0x52078402, 0x5207C402, 0x52080402,
+    0x52084402, 0x52088402, 0x5208C402, 0x52090402, 0x52094402, 0x52098402, 0x5209C402, 0x520A0402,
+    0x520A4402, 0x520A8402, 0x520AC402, 0x520B0402, 0x520B4402, 0x520B8402, 0x520BC402, 0x520C0402,
+    0x520C4402, 0x520C8402, 0x520CC402, 0x520D0402, 0x520D4402, 0x520D8402, 0x520DC402, 0x520E0402,
+    0x520E4402, 0x520E8402, 0x520EC402, 0x520F0402, 0x520F4402, 0x520F8402, 0x520FC402, 0x52100402,
+    0x52104402, 0x52108402, 0x5210C402, 0x52110402, 0x52114402, 0x52118402, 0x5211C402, 0x52120402,
+    0x52124402, 0x52128402, 0x5212C402, 0x52130402, 0x52134402, 0x52138402, 0x5213C402, 0x52140402,
+    0x52144402, 0x52148402, 0x5214C402, 0x52150402, 0x52154402, 0x52158402, 0x5215C402, 0x52160402,
+    0x52164402, 0x52168402, 0x5216C402, 0x52170402, 0x52174402, 0x52178402, 0x5217C402, 0x52180402,
+    0x52184402, 0x52188402, 0x5218C402, 0x52190402, 0x52194402, 0x52198402, 0x5219C402, 0x521A0402,
+    0x521A4402, 0x521A8402, 0x521AC402, 0x521B0402, 0x521B4402, 0x521B8402, 0x521BC402, 0x521C0402,
+    0x521C4402, 0x521C8402, 0x521CC402, 0x521D0402, 0x521D4402, 0x521D8402, 0x521DC402, 0x521E0402,
+    0x521E4402, 0x521E8402, 0x521EC402, 0x521F0402, 0x521F4402, 0x521F8402, 0x521FC402, 0x52200402,
+    0x52204402, 0x52208402, 0x5220C402, 0x52210402, 0x52214402, 0x52218402, 0x5221C402, 0x52220402,
+    0x52224402, 0x52228402, 0x5222C402, 0x52230402, 0x52234402, 0x52238402, 0x5223C402, 0x52240402,
+    0x52244402, 0x52248402, 0x5224C402, 0x52250402, 0x52254402, 0x52258402, 0x5225C402, 0x52260402,
+    0x52264402, 0x52268402, 0x5226C402, 0x52270402, 0x52274402, 0x52278402, 0x5227C402, 0x52280402,
+    0x52284402, 0x52288402, 0x5228C402, 0x52290402, 0x52294402, 0x52298402, 0x5229C402, 0x522A0402,
+    0x522A4402, 0x522A8402, 0x522AC402, 0x522B0402, 0x522B4402, 0x522B8402, 0x522BC402, 0x522C0402,
+    0x522C4402, 0x522C8402, 0x522CC402, 0x522D0402, 0x522D4402, 0x522D8402, 0x522DC402, 0x522E0402,
+    0x522E4402, 0x522E8402, 0x522EC402, 0x522F0402, 0x522F4402, 0x522F8402, 0x522FC402, 0x52300402,
+    0x52304402, 0x52308402, 0x5230C402, 0x52310402, 0x52314402, 0x52318402, 0x5231C402, 0x52320402,
+    0x52324402, 0x52328402, 0x5232C402, 0x52330402, 0x52334402, 0x52338402, 0x5233C402, 0x52340402,
+    0x52344402, 0x52348402, 0x5234C402, 0x52350402, 0x52354402, 0x52358402, 0x5235C402, 0x52360402,
+    0x52364402, 0x52368402, 0x5236C402, 0x52370402, 0x52374402, 0x52378402, 0x5237C402, 0x52380402,
+    0x52384402, 0x52388402, 0x5238C402, 0x52390402, 0x52394402, 0x52398402, 0x5239C402, 0x523A0402,
+    0x523A4402, 0x523A8402, 0x523AC402, 0x523B0402, 0x523B4402, 0x00000000, 0x00000000, 0x00000000,
+    0x44234402, 0x44238402, 0x4423C402, 0x44240402, 0x44244402, 0x44248402, 0x4424C402, 0x44250402,
+    0x44254402, 0x44258402, 0x4425C402, 0x44260402, 0x44264402, 0x44268402, 0x4426C402, 0x44270402,
+    0x44274402, 0x44278402, 0x4427C402, 0x44280402, 0x44284402, 0x44288402, 0x4428C402, 0x44290402,
+    0x44294402, 0x44298402, 0x4429C402, 0x442A0402, 0x442A4402, 0x442A8402, 0x442AC402, 0x442B0402,
+    0x442B4402, 0x442B8402, 0x442BC402, 0x442C0402, 0x442C4402, 0x442C8402, 0x442CC402, 0x442D0402,
+    0x442D4402, 0x442D8402, 0x442DC402, 0x442E0402, 0x442E4402, 0x442E8402, 0x442EC402, 0x442F0402,
+    0x442F4402, 0x442F8402, 0x442FC402, 0x44300402, 0x44304402, 0x44308402, 0x4430C402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x523D0402, 0x523D4402, 0x523D8402, 0x523DC402, 0x523E0402, 0x523E4402, 0x523E8402, 0x523EC402,
+    0x523F0402, 0x523F4402, 0x523F8402, 0x523FC402, 0x52400402, 0x52404402, 0x52408402, 0x5240C402,
+    0x52410402, 0x52414402, 0x52418402, 0x5241C402, 0x52420402, 0x52424402, 0x52428402, 0x5242C402,
+    0x52430402, 0x52434402, 0x52440402, 0x52438402, 0x52444402, 0x5243C402, 0x5244C402, 0x52450402,
+    0x52454402, 0x52458402, 0x5245C402, 0x52460402, 0x52464402, 0x52468402, 0x5246C402, 0x52470402,
+    0x523B8402, 0x523BC402, 0x523C0402, 0x523C4402, 0x523CC402, 0x523C8402, 0x408C8402, 0x40A30402,
+    0x4F2E4402, 0x4F2E8402, 0x4F2EC402, 0x4F2F0402, 0x4F2F4402, 0x4F2F8402, 0x4F2FC402, 0x4F300402,
+    0x4F304402, 0x4F308402, 0x4F30C402, 0x4F310402, 0x4F314402, 0x4F318402, 0x4F31C402, 0x4F320402,
+    0x4F324402, 0x4F328402, 0x4F32C402, 0x4F330402, 0x4F334402, 0x4F338402, 0x4F33C402, 0x4F340402,
+    0x4F344402, 0x4F348402, 0x4F34C402, 0x4F350402, 0x4F354402, 0x4F358402, 0x4F35C402, 0x4F360402,
+    0x4F364402, 0x4F368402, 0x4F36C402, 0x4F370402, 0x4F374402, 0x4F378402, 0x4F37C402, 0x4F380402,
+    0x4F384402, 0x4F388402, 0x4F38C402, 0x4F390402, 0x4F394402, 0x4F398402, 0x4F39C402, 0x4F3A0402,
+    0x4F3A4402, 0x4F3A8402, 0x4F3AC402, 0x4F3B0402, 0x4F3B4402, 0x4F3B8402, 0x4F3BC402, 0x4F3C0402,
+    0x4F3C4402, 0x4F3C8402, 0x4F3CC402, 0x4F3D0402, 0x4F3D4402, 0x4F3D8402, 0x4F3DC402, 0x4F3E0402,
+    0x4F3E4402, 0x4F3E8402, 0x4F3EC402, 0x4F3F0402, 0x4F3F4402, 0x4F3F8402, 0x4F3FC402, 0x4F400402,
+    0x4F404402, 0x4F408402, 0x4F40C402, 0x4F410402, 0x4F414402, 0x4F418402, 0x4F41C402, 0x4F420402,
+    0x4F424402, 0x4F428402, 0x4F42C402, 0x4F430402, 0x4F434402, 0x4F438402, 0x4F43C402, 0x4F440402,
+    0x4F444402, 0x4F448402, 0x4F44C402, 0x4F450402, 0x4F454402, 0x4F458402, 0x4F45C402, 0x4F460402,
+    0x4F464402, 0x4F468402, 0x4F46C402, 0x4F470402, 0x4F474402, 0x4F478402, 0x4F47C402, 0x4F480402,
+    0x4F484402, 0x4F488402, 0x4F48C402, 0x4F490402, 0x4F494402, 0x4F498402, 0x4F49C402, 0x4F4A0402,
+    0x4F4A4402, 0x4F4A8402, 0x4F4AC402, 0x4F4B0402, 0x4F4B4402, 0x4F4B8402, 0x4F4BC402, 0x4F4C0402,
+    0x4F4C4402, 0x4F4C8402, 0x4F4CC402, 0x4F4D0402, 0x4F4D4402, 0x4F4D8402, 0x4F4DC402, 0x4F4E0402,
+    0x4F4E4402, 0x4F4E8402, 0x4F4EC402, 0x4F4F0402, 0x4F4F4402, 0x4F4F8402, 0x4F4FC402, 0x4F500402,
+    0x4F504402, 0x4F508402, 0x4F50C402, 0x4F510402, 0x4F514402, 0x4F518402, 0x4F51C402, 0x4F520402,
+    0x4F524402, 0x4F528402, 0x4F52C402, 0x4F530402, 0x4F534402, 0x4F538402, 0x4F53C402, 0x4F540402,
+    0x4F544402, 0x4F548402, 0x4F54C402, 0x4F550402, 0x4F554402, 0x4F558402, 0x4F55C402, 0x4F560402,
+    0x4F564402, 0x4F568402, 0x4F56C402, 0x4F570402, 0x4F574402, 0x4F578402, 0x4F57C402, 0x4F580402,
+    0x4F584402, 0x4F588402, 0x4F58C402, 0x4F590402, 0x4F594402, 0x4F598402, 0x4F59C402, 0x4F5A0402,
+    0x4F5A4402, 0x4F5A8402, 0x4F5AC402, 0x4F5B0402, 0x4F5B4402, 0x4F5B8402, 0x4F5BC402, 0x4F5C0402,
+    0x4F5C4402, 0x4F5C8402, 0x4F5CC402, 0x4F5D0402, 0x4F5D4402, 0x4F5D8402, 0x4F5DC402, 0x4F5E0402,
+    0x4F5E4402, 0x4F5E8402, 0x4F5EC402, 0x4F5F0402, 0x4F5F4402, 0x4F5F8402, 0x4F5FC402, 0x4F600402,
+    0x4F604402, 0x4F608402, 0x4F60C402, 0x4F610402, 0x4F614402, 0x4F618402, 0x4F61C402, 0x4F620402,
+    0x4F624402, 0x4F628402, 0x4F62C402, 0x4F630402, 0x4F634402, 0x4F638402, 0x4F63C402, 0x4F640402,
+    0x4F644402, 0x4F648402, 0x4F64C402, 0x4F650402, 0x4F654402, 0x4F658402, 0x4F65C402, 0x4F660402,
+    0x4F664402, 0x4F668402, 0x4F66C402, 0x4F670402, 0x4F674402, 0x4F678402, 0x4F67C402, 0x4F680402,
+    0x4F684402, 0x4F688402, 0x4F68C402, 0x4F690402, 0x4F694402, 0x4F698402, 0x4F69C402, 0x4F6A0402,
+    0x4F6A4402, 0x4F6A8402, 0x4F6AC402, 0x4F6B0402, 0x4F6B4402, 0x4F6B8402, 0x4F6BC402, 0x4F6C0402,
+    0x4F6C4402, 0x4F6C8402, 0x4F6CC402, 0x4F6D0402, 0x4F6D4402, 0x4F6D8402, 0x4F6DC402, 0x4F6E0402,
+    0x4F6E4402, 0x4F6E8402, 0x4F6EC402, 0x4F6F0402, 0x4F6F4402, 0x4F6F8402, 0x4F6FC402, 0x4F700402,
+    0x4F704402, 0x4F708402, 0x4F70C402, 0x4F710402, 0x4F714402, 0x408CC402, 0x40A34402, 0x409DC402,
+    0x4F444404, 0x4F48C404, 0x4F500404, 0x80034C42, 0x80034C82, 0x80034CC2, 0x80034D02, 0x80034D42,
+    0x80034D82, 0x80034DC2, 0x80034E02, 0x80034E42, 0x80034E82, 0x80034EC2, 0x80034F02, 0x80034F42,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4F49C404, 0x4F628404, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x48F54408, 0x48F54402, 0x48F60408, 0x48F60402, 0x48F74408, 0x48F74402, 0x48FC4408, 0x48FC4402,
+    0x48FE8408, 0x48FE8402, 0x49238408, 0x49238402, 0x492D4408, 0x492D4402, 0x493C4408, 0x493C4402,
+    0x493E0408, 0x493E0402, 0x49424408, 0x49424402, 0x49448408, 0x49448402, 0x4944C408, 0x4944C402,
+    0x49484408, 0x49484402, 0x49498408, 0x49498402, 0x494AC408, 0x494AC402, 0x49500408, 0x49500402,
+    0x49308408, 0x49308402, 0x48EE4408, 0x48EE4402, 0x49094408, 0x49094402, 0x490C0408, 0x490C0402,
+    0x4913040A, 0x49130404, 0x4913040A, 0x49130404, 0x4913040A, 0x49130404, 0x49130404, 0x40000A22,
+    0x40000000, 0x40000000, 0x40000000, 0x40E94402, 0x48F0C404, 0x48F94404, 0x80034F82, 0x49208404,
+    0x493D0404, 0x493E4404, 0x493F4404, 0x492B4404, 0x40000662, 0x40000662, 0x40F8C402, 0x493CC402,
+    0x48ED0408, 0x48ED0402, 0x48F90408, 0x48F90402, 0x48F30408, 0x48F30402, 0x4936C408, 0x4936C402,
+    0x48F88408, 0x48F88402, 0x491F4408, 0x491F4402, 0x491DC408, 0x491DC402, 0x4930C408, 0x4930C402,
+    0x49320408, 0x49320402, 0x49338408, 0x49338402, 0x492B0408, 0x492B0402, 0x493B0408, 0x493B0402,
+    0x4913040A, 0x49130404, 0x4913040A, 0x49130404, 0x493D0414, 0x493F4414, 0x4924C404, 0x49464404,
+    0x4F718402, 0x4F71C402, 0x4F720402, 0x4F724402, 0x4F728402, 0x4F72C402, 0x4F730402, 0x4F734402,
+    0x4F738402, 0x4F73C402, 0x4F740402, 0x4F744402, 0x4F748402, 0x4F74C402, 0x4F750402, 0x4F754402,
+    0x4F758402, 0x4F75C402, 0x4F760402, 0x4F764402, 0x4F768402, 0x4F76C402, 0x4F770402, 0x4F774402,
+    0x4F778402, 0x4F77C402, 0x4F780402, 0x4F784402, 0x4F788402, 0x4F78C402, 0x4F790402, 0x4F794402,
+    0x4F798402, 0x4F79C402, 0x4F7A0402, 0x4F7A4402, 0x4F7A8402, 0x4F7AC402, 0x4F7B0402, 0x4F7B4402,
+    0x4F7B8402, 0x4F7BC402, 0x4F7C0402, 0x4F7C4402, 0x4F7C8402, 0x4F7CC402, 0x4F7D0402, 0x4F7D4402,
+    0x4F7D8402, 0x4F7DC402, 0x4F7E0402, 0x4F7E4402, 0x4F7E8402, 0x4F7EC402, 0x4F7F0402, 0x4F7F4402,
+    0x4F7F8402, 0x4F7FC402, 0x4F800402, 0x4F804402, 0x4F808402, 0x4F80C402, 0x4F810402, 0x4F814402,
+    0x4F818402, 0x4F81C402, 0x4F820402, 0x4F824402, 0x4F828402, 0x4F82C402, 0x4F830402, 0x4F834402,
+    0x4F838402, 0x4F83C402, 0x4F840402, 0x4F844402, 0x4F848402, 0x4F84C402, 0x4F850402, 0x4F854402,
+    0x400016C2, 0x400016E2, 0x40B80402, 0x40A38402, 0x40998402, 0x408D0402, 0x408F8402, 0x409E0402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x41410402, 0x41414402, 0x41418402, 0x4141C402, 0x41420402, 0x41424402, 0x41428402, 0x4142C402,
+    0x41430402, 0x41434402, 0x41438402, 0x4143C402, 0x41440402, 0x41444402, 0x41448402, 0x4144C402,
+    0x41450402, 0x41454402, 0x41458402, 0x4145C402, 0x41460402, 0x41464402, 0x41468402, 0x4146C402,
+    0x41470402, 0x41474402, 0x41478402, 0x4147C402, 0x41480402, 0x41484402, 0x41488402, 0x4148C402,
+    0x41490402, 0x41494402, 0x48B98408, 0x48B98402, 0x48BC4408, 0x48BC4402, 0x48224408, 0x48224402,
+    0x80034FC2, 0x80035002, 0x48B2C408, 0x48B2C402, 0x48B30408, 0x48B30402, 0x48B34408, 0x48B34402,
+    0x48118402, 0x48758402, 0x80035042, 0x80035082, 0x800350C2, 0x80015FA2, 0x80035102, 0x80035142,
+    0x80035182, 0x80015FE2, 0x800351C3, 0x80035223, 0x80035282, 0x800352C2, 0x47FA8408, 0x47FA8402,
+    0x4833C408, 0x4833C402, 0x48340408, 0x48340402, 0x48344408, 0x48344402, 0x48378408, 0x48378402,
+    0x48380408, 0x48380402, 0x48580408, 0x48580402, 0x48560408, 0x48560402, 0x80035302, 0x80035342,
+    0x485C4408, 0x485C4402, 0x485E0408, 0x485E0402, 0x485E4408, 0x485E4402, 0x48614408, 0x48614402,
+    0x48618408, 0x48618402, 0x48674408, 0x48674402, 0x48744408, 0x48744402, 0x48930408, 0x48930402,
+    0x80035382, 0x800353C2, 0x48A88408, 0x48A88402, 0x48AE4408, 0x48AE4402, 0x48AE8408, 0x48AE8402,
+    0x48AFC408, 0x48AFC402, 0x48B0C408, 0x48B0C402, 0x48B10408, 0x48B10402, 0x48B14408, 0x48B14402,
+    0x48B14414, 0x48014402, 0x483EC402, 0x4845C402, 0x484D8402, 0x4873C402, 0x48740402, 0x48848402,
+    0x48B18402, 0x80035402, 0x80016062, 0x80035442, 0x80035482, 0x800354C2, 0x481B0408, 0x481B0402,
+    0x48400408, 0x48400402, 0x80035502, 0x80035542, 0x80035582, 0x80010A02, 0x800355C2, 0x80035602,
+    0x41498402, 0x4149C402, 0x414A0402, 0x48B9C408, 0x48B9C402, 0x488B0408, 0x483D8402, 0x48BA0402,
+    0x484AC408, 0x484AC402, 0x47F7C408, 0x47F7C402, 0x47F80402, 0x48204402, 0x47F2C408, 0x47F2C402,
+    0x48120408, 0x48120402, 0x80035642, 0x80016122, 0x80035682, 0x80016162, 0x800356C2, 0x800161A2,
+    0x80035702, 0x80035742, 0x80035782, 0x800357C2, 0x80035802, 0x80035842, 0x80035882, 0x800358C2,
+    0x80035902, 0x80035942, 0x48208408, 0x480B0408, 0x48154408, 0x483B0408, 0x48260408, 0x48610402,
+    0x48348408, 0x4884C408, 0x482E0408, 0x489B4408, 0x47F54408, 0x47F54402, 0x48594408, 0x48594402,
+    0x4889C408, 0x4889C402, 0x47EA4408, 0x47EA4402, 0x48294408, 0x48294402, 0x488AC408, 0x488AC402,
+    0x00000000, 0x00000000, 0x48978408, 0x48978402, 0x47F80408, 0x48768408, 0x48A40408, 0x47FC4408,
+    0x47FC4402, 0x4875C408, 0x4875C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x48220408, 0x48220402, 0x48274402,
+    0x80035982, 0x800359C3, 0x488F0402, 0x48140402, 0x485E8402, 0x48454402, 0x48270402, 0x48458402,
+    0x4B370402, 0x4B374402, 0x4B378402, 0x4B37C402, 0x4B380402, 0x4B384402, 0x4B388402, 0x4B390402,
+    0x4B394402, 0x4B398402, 0x4B39C402, 0x40001882, 0x4B3A0402, 0x4B3A4402, 0x4B3A8402, 0x4B3AC402,
+    0x4B3B0402, 0x4B3B4402, 0x4B3B8402, 0x4B3BC402, 0x4B3C0402, 0x4B3C4402, 0x4B3C8402, 0x4B3CC402,
+    0x4B3D0402, 0x4B3D4402, 0x4B3D8402, 0x4B3DC402, 0x4B3E0402, 0x4B3E4402, 0x4B3E8402, 0x4B3EC402,
+    0x4B3F0402, 0x4B3F4402, 0x4B3F8402, 0x4B3FC402, 0x4B400402, 0x4B404402, 0x4B408402, 0x4B40C402,
+    0x415B0402, 0x415B4402, 0x415B8402, 0x415BC402, 0x4B38C402, 0x00000000, 0x00000000, 0x00000000,
+    0x47588402, 0x4758C402, 0x47590402, 0x47594402, 0x47598402, 0x4759C402, 0x415C0402, 0x415C4402,
+    0x47DBC402, 0x415C8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D080402, 0x4D084402, 0x4D088402, 0x4D08C402, 0x4D090402, 0x4D094402, 0x4D098402, 0x4D09C402,
+    0x4D0B0402, 0x4D0B4402, 0x4D0B8402, 0x4D0BC402, 0x4D0C0402, 0x4D0C4402, 0x4D0C8402, 0x4D0CC402,
+    0x4D0D0402, 0x4D0D4402, 0x4D0D8402, 0x4D0DC402, 0x4D0E4402, 0x4D0E8402, 0x4D0EC402, 0x4D0F0402,
+    0x4D0FC402, 0x4D108402, 0x4D10C402, 0x4D114402, 0x4D118402, 0x4D124402, 0x4D138402, 0x4D13C402,
+    0x4D140402, 0x4D144402, 0x4D128402, 0x4D12C402, 0x4D130402, 0x4D134402, 0x4D148402, 0x4D0E0402,
+    0x4D0F4402, 0x4D0A0402, 0x4D0A4402, 0x4D0A8402, 0x4D0AC402, 0x4D0F8402, 0x4D110402, 0x4D11C402,
+    0x4D120402, 0x4D100402, 0x4D104402, 0x4D14C402, 0x41150402, 0x41154402, 0x40A70402, 0x40A74402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001882, 0x400018A2, 0x4B410402, 0x4B414402, 0x4B418402, 0x4B41C402, 0x4B420402, 0x4B424402,
+    0x4B428402, 0x4B42C402, 0x4B430402, 0x4B434402, 0x4B438402, 0x4B43C402, 0x4B440402, 0x4B444402,
+    0x4B448402, 0x4B44C402, 0x4B450402, 0x4B454402, 0x4B458402, 0x4B45C402, 0x4B460402, 0x4B464402,
+    0x4B468402, 0x4B46C402, 0x4B470402, 0x4B474402, 0x4B478402, 0x4B47C402, 0x4B480402, 0x4B484402,
+    0x4B488402, 0x4B48C402, 0x4B490402, 0x4B494402, 0x4B498402, 0x4B49C402, 0x4B4A0402, 0x4B4A4402,
+    0x4B4A8402, 0x4B4AC402, 0x4B4B0402, 0x4B4B4402, 0x4B4B8402, 0x4B4BC402, 0x4B4C0402, 0x4B4C4402,
+    0x4B4C8402, 0x4B4CC402, 0x4B4D0402, 0x4B4D4402, 0x4B4D8402, 0x4B4DC402, 0x4B4E0402, 0x4B4E4402,
+    0x4B4E8402, 0x4B4EC402, 0x4B4F0402, 0x4B4F4402, 0x4B4F8402, 0x4B4FC402, 0x4B500402, 0x4B504402,
+    0x4B508402, 0x4B50C402, 0x4B510402, 0x4B514402, 0x4B518402, 0x40001862, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40A60402, 0x40A64402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x4A884402, 0x4A884404, 0x4A884404, 0x4A884404, 0x4A884404, 0x4A884404,
+    0x41004402, 0x41008402, 0x4100C402, 0x4A888402, 0x41010402, 0x4A760402, 0x4A7B8402, 0x4A8DC402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4D52C402, 0x4D530402, 0x4D534402, 0x4D538402, 0x4D53C402, 0x4D540402,
+    0x4D544402, 0x4D548402, 0x4D54C402, 0x4D550402, 0x4D554402, 0x4D558402, 0x4D55C402, 0x4D560402,
+    0x4D564402, 0x4D568402, 0x4D56C402, 0x4D570402, 0x4D574402, 0x4D578402, 0x4D57C402, 0x4D580402,
+    0x4D584402, 0x4D588402, 0x4D58C402, 0x4D590402, 0x4D594402, 0x4D598402, 0x4D59C402, 0x4D5A0402,
+    0x4D5A4402, 0x4D5A8402, 0x4D5AC402, 0x40001C82, 0x40001CA2, 0x40001CC2, 0x41168402, 0x40A80402,
+    0x4D49C402, 0x4D4A0402, 0x4D4A4402, 0x4D4A8402, 0x4D4AC402, 0x4D4B0402, 0x4D4B4402, 0x4D4B8402,
+    0x4D4BC402, 0x4D4C0402, 0x4D4C4402, 0x4D4C8402, 0x4D4CC402, 0x4D4D0402, 0x4D4D4402, 0x4D4D8402,
+    0x4D4DC402, 0x4D4E0402, 0x4D4E4402, 0x4D4E8402, 0x4D4EC402, 0x4D4F0402, 0x4D4F4402, 0x4D4F8402,
+    0x4D4FC402, 0x4D500402, 0x4D504402, 0x4D508402, 0x4D50C402, 0x4D510402, 0x4D514402, 0x4D518402,
+    0x4D51C402, 0x4D520402, 0x4D524402, 0x4D528402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40B84402,
+    0x50750402, 0x50754402, 0x50758402, 0x5075C402, 0x50760402, 0x50764402, 0x50768402, 0x5076C402,
+    0x50770402, 0x50774402, 0x50778402, 0x5077C402, 0x50780402, 0x50784402, 0x50788402, 0x5078C402,
+    0x50790402, 0x50794402, 0x50798402, 0x5079C402, 0x507A0402, 0x507A4402, 0x507A8402, 0x507AC402,
+    0x507B0402, 0x507B4402, 0x507B8402, 0x507BC402, 0x507C0402, 0x00000000, 0x00000000, 0x00000000,
+    0x40001862, 0x40001882, 0x40001942, 0x400018A2, 0x4DFF0402, 0x4DFF4402, 0x4DFF8402, 0x4DFFC402,
+    0x4E000402, 0x4E004402, 0x4E008402, 0x4E00C402, 0x4E010402, 0x4E014402, 0x4E018402, 0x4E01C402,
+    0x4E020402, 0x4E024402, 0x4E028402, 0x4E02C402, 0x4E030402, 0x4E034402, 0x4E038402, 0x4E03C402,
+    0x4E040402, 0x4E044402, 0x4E048402, 0x4E04C402, 0x4E050402, 0x4E054402, 0x4E058402, 0x4E05C402,
+    0x4E060402, 0x4E064402, 0x4E068402, 0x4E06C402, 0x4E070402, 0x4E074402, 0x4E078402, 0x4E07C402,
+    0x4E080402, 0x4E084402, 0x4E088402, 0x4E090402, 0x4E090404, 0x4E098402, 0x4E09C402, 0x4E0A0402,
+    0x4E0A4402, 0x4E0A8402, 0x4E0AC402, 0x40001842, 0x4E0B0402, 0x4E0B0404, 0x4E0B8402, 0x4E0BC402,
+    0x4E0C0402, 0x4E0C4402, 0x4E0CC402, 0x4E0D0402, 0x4E0B4402, 0x4E0C8402, 0x4E08C402, 0x4E094402,
+    0x4E0D4402, 0x40B58402, 0x40B5C402, 0x40B60402, 0x40B64402, 0x40B68402, 0x40B6C402, 0x40988402,
+    0x40AAC402, 0x40AB0402, 0x40B70402, 0x40B74402, 0x40B78402, 0x40B7C402, 0x00000000, 0x47D34402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4116C402, 0x41170402,
+    0x4D5D4402, 0x4D5F4402, 0x4D61C402, 0x4D674402, 0x4D6D8402, 0x4D800402, 0x47D38402, 0x4D63C402,
+    0x4D6C4402, 0x4D5CC402, 0x4D5D8402, 0x4D608402, 0x4D624402, 0x4D65C402, 0x4D668402, 0x4D678402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4D748402, 0x4D68C402, 0x4D698402, 0x4D6D0402, 0x4D6DC402, 0x00000000,
+    0x4DDC4402, 0x4DDC8402, 0x4DDCC402, 0x4DDD0402, 0x4DDD4402, 0x4DDD8402, 0x4DDDC402, 0x4DDE0402,
+    0x4DDE4402, 0x4DDE8402, 0x4DDEC402, 0x4DDF0402, 0x4DDF4402, 0x4DDF8402, 0x4DDFC402, 0x4DE00402,
+    0x4DE04402, 0x4DE08402, 0x4DE0C402, 0x4DE10402, 0x4DE14402, 0x4DE18402, 0x4DE1C402, 0x4DE20402,
+    0x4DE24402, 0x4DE28402, 0x4DE2C402, 0x4DE30402, 0x4DE34402, 0x4DE38402, 0x4DE3C402, 0x4DE40402,
+    0x4DE44402, 0x4DE48402, 0x4DE4C402, 0x4DE50402, 0x4DE54402, 0x4DE58402, 0x4DE5C402, 0x4DE60402,
+    0x4DE64402, 0x4DE78402, 0x4DE7C402, 0x4DE80402, 0x4DE84402, 0x4DE88402, 0x4DE8C402, 0x4DE90402,
+    0x4DE94402, 0x4DE98402, 0x4DE9C402, 0x4DE68402, 0x4DE6C402, 0x4DE70402, 0x4DE74402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4DEA0402, 0x4DEA4402, 0x4DEA8402, 0x4DEAC402, 0x4DEB0402, 0x4DEB4402, 0x4DEB8402, 0x4DEBC402,
+    0x4DEC0402, 0x4DEC4402, 0x4DEC8402, 0x4DECC402, 0x4DED0402, 0x4DED4402, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x41174402, 0x40AB4402, 0x40AB8402, 0x40ABC402,
+    0x4D5C8402, 0x4D5EC402, 0x4D5F8402, 0x4D604402, 0x4D620402, 0x4D638402, 0x4D648402, 0x4D650402,
+    0x4D658402, 0x4D664402, 0x4D694402, 0x4D6A4402, 0x4D728402, 0x4D734402, 0x4D73C402, 0x4D6BC402,
+    0x47D3C402, 0x4D740402, 0x4D610402, 0x4D6F4402, 0x4D860402, 0x4D864402, 0x4D868402, 0x4166C402,
+    0x41670402, 0x41674402, 0x4D6F8402, 0x4D854402, 0x4D858402, 0x4D85C402, 0x4D5FC402, 0x4D62C402,
+    0x4CA58402, 0x4CA5C402, 0x4CA60402, 0x4CA64402, 0x4CA68402, 0x4CA6C402, 0x4CA70402, 0x4CA74402,
+    0x4CA78402, 0x4CA7C402, 0x4CA80402, 0x4CA84402, 0x4CA88402, 0x4CA8C402, 0x4CA90402, 0x4CA94402,
+    0x4CA98402, 0x4CA9C402, 0x4CAA0402, 0x4CAA4402, 0x4CAA8402, 0x4CAAC402, 0x4CAB0402, 0x4CAB4402,
+    0x4CAB8402, 0x4CABC402, 0x4CAC0402, 0x4CAC4402, 0x4CAC8402, 0x4CACC402, 0x4CAD0402, 0x4CAD4402,
+    0x4CAD8402, 0x4CADC402, 0x4CAE0402, 0x4CAE4402, 0x4CAE8402, 0x4CAEC402, 0x4CAF0402, 0x4CAF4402,
+    0x4CAF8402, 0x4CAFC402, 0x4CB00402, 0x4CB04402, 0x4CB08402, 0x4CB0C402, 0x4CB10402, 0x4CB14402,
+    0x4CB18402, 0x4CB1C402, 0x4CB20402, 0x4CB24402, 0x4CB28402, 0xC000B931, 0xC000C571, 0x4CB34402,
+    0x4CB38402, 0xC000D1B1, 0x4CB40402, 0xC000DDF1, 0xC000EA31, 0x4CB4C402, 0x4CB50402, 0x40001C22,
+    0x4CB54402, 0x40001C42, 0x4CB58402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x4CB5C402, 0x4CB60402, 0x47D40402, 0x41038402, 0x4103C402,
+    0x4B2E4402, 0x4B2E8402, 0x4B2EC402, 0x4B2F0402, 0x4B2F4402, 0x4B2F8402, 0x4B2FC402, 0x4B300402,
+    0x4B304402, 0x4B308402, 0x4B30C402, 0x4B330402, 0x4B334402, 0x4B338402, 0x4B33C402, 0x4B340402,
+    0x40AC0402, 0x409E4402, 0x4B274402, 0x47D44402, 0x47D48402, 0x4B344402, 0x4B36C402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x4A148402, 0x4A14C402, 0x4A150402, 0x4A154402, 0x4A158402, 0x4A15C402, 0x00000000,
+    0x00000000, 0x4A464402, 0x4A468402, 0x4A46C402, 0x4A470402, 0x4A474402, 0x4A478402, 0x00000000,
+    0x00000000, 0x4A3E8402, 0x4A3EC402, 0x4A3F0402, 0x4A3F4402, 0x4A3F8402, 0x4A3FC402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4A570402, 0x4A574402, 0x4A578402, 0x4A57C402, 0x4A580402, 0x4A584402, 0x4A588402, 0x00000000,
+    0x4A5D0402, 0x4A5D4402, 0x4A5D8402, 0x4A5DC402, 0x4A5E0402, 0x4A5E4402, 0x4A5E8402, 0x00000000,
+    0x47ED4402, 0x47EB0402, 0x48030402, 0x48034402, 0x4804C402, 0x4811C402, 0x48164402, 0x483C0402,
+    0x483A8402, 0x483AC402, 0x48450402, 0x484D4402, 0x484EC402, 0x48508402, 0x48538402, 0x48554402,
+    0x48528402, 0x48520402, 0x48524402, 0x4852C402, 0x48530402, 0x4865C402, 0x48670402, 0x48714402,
+    0x48718402, 0x486EC402, 0x4871C402, 0x48720402, 0x48724402, 0x487A0402, 0x48870402, 0x48898402,
+    0x48880402, 0x48884402, 0x488A8402, 0x489B4402, 0x489B8402, 0x489BC402, 0x489A4402, 0x489A8402,
+    0x489AC402, 0x489B0402, 0x48A04402, 0x414A4402, 0x48224414, 0x483C0414, 0x48398414, 0x488A8414,
+    0x48B00402, 0x48B04402, 0x4855C402, 0x48B08402, 0x47EEC402, 0x48D1C402, 0x80035A22, 0x80035A62,
+    0x48738402, 0x48980414, 0x41368402, 0x4136C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4E378402, 0x4E37C402, 0x4E380402, 0x4E384402, 0x4E388402, 0x4E38C402, 0x4E390402, 0x4E394402,
+    0x4E398402, 0x4E39C402, 0x4E3A0402, 0x4E3A4402, 0x4E3A8402, 0x4E3AC402, 0x4E3B0402, 0x4E3B4402,
+    0x4E3B8402, 0x4E3BC402, 0x4E3C0402, 0x4E3C4402, 0x4E3C8402, 0x4E3CC402, 0x4E3D0402, 0x4E3D4402,
+    0x4E3D8402, 0x4E3DC402, 0x4E3E0402, 0x4E3E4402, 0x4E3E8402, 0x4E3EC402, 0x4E3F0402, 0x4E3F4402,
+    0x4E3F8402, 0x4E3FC402, 0x4E400402, 0x4E404402, 0x4E408402, 0x4E40C402, 0x4E410402, 0x4E414402,
+    0x4E418402, 0x4E41C402, 0x4E420402, 0x4E424402, 0x4E428402, 0x4E42C402, 0x4E430402, 0x4E434402,
+    0x4E438402, 0x4E43C402, 0x4E440402, 0x4E444402, 0x4E448402, 0x4E44C402, 0x4E450402, 0x4E454402,
+    0x4E458402, 0x4E45C402, 0x4E460402, 0x4E464402, 0x4E468402, 0x4E46C402, 0x4E470402, 0x4E474402,
+    0x4E478402, 0x4E47C402, 0x4E480402, 0x4E484402, 0x4E488402, 0x4E48C402, 0x4E490402, 0x4E494402,
+    0x4E498402, 0x4E49C402, 0x4E4A0402, 0x4E4A4402, 0x4E4A8402, 0x4E4AC402, 0x4E4B0402, 0x4E4B4402,
+    0x4B278402, 0x4B27C402, 0x4B280402, 0x4B284402, 0x4B288402, 0x4B28C402, 0x4B290402, 0x4B294402,
+    0x4B298402, 0x4B29C402, 0x4B2A0402, 0x4B2A4402, 0x4B2A8402, 0x4B2AC402, 0x4B2B0402, 0x4B2B4402,
+    0x4B2B8402, 0x4B2BC402, 0x4B2C0402, 0x4B2C4402, 0x4B2C8402, 0x4B2CC402, 0x4B2D0402, 0x4B2D4402,
+    0x4B2D8402, 0x4B2DC402, 0x4B2E0402, 0x4B348402, 0x4B34C402, 0x4B350402, 0x4B354402, 0x4B358402,
+    0x4B35C402, 0x4B360402, 0x4B364402, 0x4B310402, 0x4B314402, 0x4B318402, 0x4B31C402, 0x4B320402,
+    0x4B324402, 0x4B328402, 0x4B32C402, 0x40AC4402, 0x40001982, 0x4B368402, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000006,
+    0x00000006, 0x00000006, 0x00000006, 0x00000006, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x508E8402, 0x508EC402, 0x508F0402, 0x508F4402, 0x508F8402, 0x508FC402, 0x50900402, 0x50904402,
+    0x50908402, 0x5090C402, 0x50910402, 0x50914402, 0x50918402, 0x5091C402, 0x50920402, 0x50924402,
+    0x50928402, 0x5092C402, 0x50930402, 0x50934402, 0x50938402, 0x5093C402, 0x50940402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x50AA4402, 0x50AA8402, 0x50AAC402, 0x50AB0402, 0x50AB4402,
+    0x50AB8402, 0x50ABC402, 0x50AC0402, 0x50AC4402, 0x50AC8402, 0x50ACC402, 0x50AD0402, 0x50AD4402,
+    0x50AD8402, 0x50ADC402, 0x50AE0402, 0x50AE4402, 0x50AE8402, 0x50AEC402, 0x50AF0402, 0x50AF4402,
+    0x50AF8402, 0x50AFC402, 0x50B00402, 0x50B04402, 0x50B08402, 0x50B0C402, 0x50B10402, 0x50B14402,
+    0x50B18402, 0x50B1C402, 0x50B20402, 0x50B24402, 0x50B28402, 0x50B2C402, 0x50B30402, 0x50B34402,
+    0x50B38402, 0x50B3C402, 0x50B40402, 0x50B44402, 0x50B48402, 0x50B4C402, 0x50B50402, 0x50B54402,
+    0x50B58402, 0x50B5C402, 0x50B60402, 0x50B64402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80035AA2, 0x80035AE2, 0x80035B22, 0x80035B62, 0x80035BA2, 0x80035BE2, 0x80035C22, 0x80035C62,
+    0x80035C62, 0x80035CA2, 0x80035CE2, 0x80035D22, 0x80035D62, 0x80035DA2, 0x80035DE2, 0x80035E22,
+    0x80035E62, 0x80035EA2, 0x80035EE2, 0x80035F22, 0x80035F62, 0x80035FA2, 0x80035FE2, 0x80036022,
+    0x80036062, 0x800360A2, 0x800360E2, 0x80036122, 0x80036162, 0x800361A2, 0x800361E2, 0x80036222,
+    0x80036262, 0x800362A2, 0x800362E2, 0x80036322, 0x80036362, 0x800363A2, 0x800363E2, 0x80036422,
+    0x80036462, 0x800364A2, 0x800364E2, 0x80036522, 0x80036562, 0x800365A2, 0x800365E2, 0x80036622,
+    0x80036662, 0x800366A2, 0x800366E2, 0x80036722, 0x80036762, 0x800367A2, 0x800367E2, 0x80036822,
+    0x80036862, 0x800368A2, 0x800368E2, 0x80036922, 0x80036962, 0x800369A2, 0x800369E2, 0x80036A22,
+    0x80036A62, 0x80036AA2, 0x80036AE2, 0x80036B22, 0x80036B62, 0x80036BA2, 0x80036BE2, 0x80036C22,
+    0x80036C62, 0x80036CA2, 0x80036CE2, 0x80036D22, 0x80036D62, 0x80036DA2, 0x80036DE2, 0x80036E22,
+    0x80036E62, 0x80036EA2, 0x80036EE2, 0x80036F22, 0x80036F62, 0x80036FA2, 0x80036FE2, 0x80037022,
+    0x80037062, 0x800370A2, 0x800370E2, 0x80037122, 0x80035F62, 0x80037162, 0x800371A2, 0x800371E2,
+    0x80037222, 0x80037262, 0x800372A2, 0x800372E2, 0x80037322, 0x80037362, 0x800373A2, 0x800373E2,
+    0x80037422, 0x80037462, 0x800374A2, 0x800374E2, 0x80037522, 0x80037562, 0x800375A2, 0x800375E2,
+    0x80037622, 0x80037662, 0x800376A2, 0x800376E2, 0x80037722, 0x80037762, 0x800377A2, 0x800377E2,
+    0x80037822, 0x80037862, 0x800378A2, 0x800378E2, 0x80037922, 0x80037962, 0x800379A2, 0x800379E2,
+    0x80037A22, 0x80037A62, 0x80037AA2, 0x80037AE2, 0x80037B22, 0x80037B62, 0x80037BA2, 0x80037BE2,
+    0x80037C22, 0x80037C62, 0x80037CA2, 0x80037CE2, 0x80037D22, 0x80037D62, 0x80037DA2, 0x80037DE2,
+    0x80037E22, 0x80037E62, 0x80037EA2, 0x80037EE2, 0x80037F22, 0x80037F62, 0x80037FA2, 0x80037FE2,
+    0x80038022, 0x80038062, 0x800380A2, 0x800380E2, 0x80038122, 0x80038162, 0x800381A2, 0x800381E2,
+    0x80038222, 0x800375E2, 0x80038262, 0x800382A2, 0x800382E2, 0x80038322, 0x80038362, 0x800383A2,
+    0x800383E2, 0x80038422, 0x800371E2, 0x80038462, 0x800384A2, 0x800384E2, 0x80038522, 0x80038562,
+    0x800385A2, 0x800385E2, 0x80038622, 0x80038662, 0x800386A2, 0x800386E2, 0x80038722, 0x80038762,
+    0x800387A2, 0x800387E2, 0x80038822, 0x80038862, 0x800388A2, 0x800388E2, 0x80038922, 0x80035F62,
+    0x80038962, 0x800389A2, 0x800389E2, 0x80038A22, 0x80038A62, 0x80038AA2, 0x80038AE2, 0x80038B22,
+    0x80038B62, 0x80038BA2, 0x80038BE2, 0x80038C22, 0x80038C62, 0x80038CA2, 0x80038CE2, 0x80038D22,
+    0x80038D62, 0x80038DA2, 0x80038DE2, 0x80038E22, 0x80038E62, 0x80038EA2, 0x80038EE2, 0x80038F22,
+    0x80038F62, 0x80038FA2, 0x80038FE2, 0x80037262, 0x80039022, 0x80039062, 0x800390A2, 0x800390E2,
+    0x80039122, 0x80039162, 0x800391A2, 0x800391E2, 0x80039222, 0x80039262, 0x800392A2, 0x800392E2,
+    0x80039322, 0x80039362, 0x800393A2, 0x800393E2, 0x80039422, 0x80039462, 0x800394A2, 0x800394E2,
+    0x80039522, 0x80039562, 0x800395A2, 0x800395E2, 0x80039622, 0x80039662, 0x800396A2, 0x800396E2,
+    0x80039722, 0x80039762, 0x800397A2, 0x800397E2, 0x80039822, 0x80039862, 0x800398A2, 0x800398E2,
+    0x80039922, 0x80039962, 0x800399A2, 0x800399E2, 0x80039A22, 0x80039A62, 0x80039AA2, 0x80039AE2,
+    0x80039B22, 0x80039B62, 0x80039BA2, 0x80039BE2, 0x80039C22, 0x80039C62, 0x80039CA2, 0x80039CE2,
+    0x80039D22, 0x80039D62, 0x80039DA2, 0x80039DE2, 0x80039E22, 0x80039E62, 0x80039EA2, 0x80039EE2,
+    0x80039F22, 0x80039F62, 0x80039FA2, 0x80039FE2, 0x8003A022, 0x8003A062, 0x8003A0A2, 0x8003A0E2,
+    0x8003A122, 0x8003A162, 0x8003A1A2, 0x8003A1E2, 0x8003A222, 0x8003A262, 0x8003A2A2, 0x8003A2E2,
+    0x8003A322, 0x8003A362, 0x8003A3A2, 0x8003A3E2, 0x8003A422, 0x8003A462, 0x8003A4A2, 0x8003A4E2,
+    0x8003A522, 0x8003A562, 0x8003A5A2, 0x8003A5E2, 0x8003A622, 0x8003A662, 0x8003A6A2, 0x8003A6E2,
+    0x8003A722, 0x8003A762, 0x8003A7A2, 0x8003A7E2, 0x8003A822, 0x8003A862, 0x8003A8A2, 0x8003A8E2,
+    0x8003A922, 0x8003A962, 0x8003A9A2, 0x8003A9E2, 0x8003AA22, 0x8003AA62, 0x8003AAA2, 0x8003AAE2,
+    0x8003AB22, 0x8003AB62, 0x8003ABA2, 0x8003ABE2, 0x8003AC22, 0x8003AC62, 0x8003ACA2, 0x8003ACE2,
+    0x8003AD22, 0x8003AD62, 0x8003ADA2, 0x8003ADE2, 0x8003AE22, 0x8003AE62, 0x8003AEA2, 0x80037FA2,
+    0x8003AEE2, 0x8003AF22, 0x8003AF62, 0x8003AFA2, 0x8003AFE2, 0x8003B022, 0x8003B022, 0x8003B062,
+    0x8003B0A2, 0x8003B0E2, 0x8003B122, 0x8003B162, 0x8003B1A2, 0x8003B1E2, 0x8003B222, 0x8003A262,
+    0x8003B262, 0x8003B2A2, 0x8003B2E2, 0x8003B322, 0x8003B362, 0x8003B3A2, 0x00000000, 0x00000000,
+    0x8003B3E2, 0x8003B422, 0x8003B462, 0x8003B4A2, 0x8003B4E2, 0x8003B522, 0x8003B562, 0x8003B5A2,
+    0x8003A6A2, 0x8003B5E2, 0x8003B622, 0x8003B662, 0x80039D22, 0x8003B6A2, 0x8003B6E2, 0x8003B722,
+    0x8003B762, 0x8003B7A2, 0x8003B7E2, 0x8003B822, 0x8003B862, 0x8003B8A2, 0x8003B8E2, 0x8003B922,
+    0x8003B962, 0x8003A8E2, 0x8003B9A2, 0x8003A922, 0x8003B9E2, 0x8003BA22, 0x8003BA62, 0x8003BAA2,
+    0x8003BAE2, 0x80039DA2, 0x800364A2, 0x8003BB22, 0x8003BB62, 0x8003BBA2, 0x80037622, 0x80038BE2,
+    0x8003BBE2, 0x8003BC22, 0x8003AAE2, 0x8003BC62, 0x8003AB22, 0x8003BCA2, 0x8003BCE2, 0x8003BD22,
+    0x80039EA2, 0x8003BD62, 0x8003BDA2, 0x8003BDE2, 0x8003BE22, 0x8003BE62, 0x80039EE2, 0x8003BEA2,
+    0x8003BEE2, 0x8003BF22, 0x8003BF62, 0x8003BFA2, 0x8003BFE2, 0x8003AEA2, 0x8003C022, 0x8003C062,
+    0x80037FA2, 0x8003C0A2, 0x8003AFA2, 0x8003C0E2, 0x8003C122, 0x8003C162, 0x8003C1A2, 0x8003C1E2,
+    0x8003B0E2, 0x8003C222, 0x8003A1A2, 0x8003C262, 0x8003B122, 0x80037162, 0x8003C2A2, 0x8003B162,
+    0x8003C2E2, 0x8003B1E2, 0x8003C322, 0x8003C362, 0x8003C3A2, 0x8003C3E2, 0x8003C422, 0x8003B262,
+    0x8003A022, 0x8003C462, 0x8003B2A2, 0x8003C4A2, 0x8003B2E2, 0x8003C4E2, 0x80035C62, 0x8003C522,
+    0x8003C562, 0x8003C5A2, 0x8003C5E2, 0x8003C622, 0x8003C662, 0x8003C6A2, 0x8003C6E2, 0x8003C722,
+    0x8003C762, 0x8003C7A2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x8003C7E2, 0x8003C822, 0x8003C862, 0x8003C8A3, 0x8003C903, 0x8003C963, 0x8003C9C2, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x8003CA02, 0x8003CA42, 0x8003CA82, 0x8003CAC2, 0x8003CB02,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x8003CB42, 0x40000C22, 0x8003CB83,
+    0x498B4405, 0x49878405, 0x49884405, 0x49888405, 0x498A0405, 0x498A4405, 0x498A8405, 0x498C4405,
+    0x498CC405, 0x41998405, 0x8003CBE2, 0x8003CC22, 0x8003CC63, 0x8003CCC3, 0x8003CD22, 0x8003CD62,
+    0x8003CDA2, 0x8003CDE2, 0x8003CE22, 0x8003CE62, 0x8003CEA2, 0x8003CEE2, 0x8003CF22, 0x00000000,
+    0x8003CF62, 0x8003CFA2, 0x8003CFE2, 0x8003D022, 0x8003D062, 0x00000000, 0x8003D0A2, 0x00000000,
+    0x8003D0E2, 0x8003D122, 0x00000000, 0x8003D162, 0x8003D1A2, 0x00000000, 0x8003D1E2, 0x8003D222,
+    0x8003D262, 0x8003D2A2, 0x8003D2E2, 0x8003D322, 0x8003D362, 0x8003D3A2, 0x8003D3E2, 0x8003D422,
+    0x499A041A, 0x499A0419, 0x499D441A, 0x499D4419, 0x499D4417, 0x499D4418, 0x499D841A, 0x499D8419,
+    0x499D8417, 0x499D8418, 0x499DC41A, 0x499DC419, 0x499DC417, 0x499DC418, 0x49A2041A, 0x49A20419,
+    0x49A20417, 0x49A20418, 0x49A2C41A, 0x49A2C419, 0x49A2C417, 0x49A2C418, 0x49A1C41A, 0x49A1C419,
+    0x49A1C417, 0x49A1C418, 0x49BA441A, 0x49BA4419, 0x49BA4417, 0x49BA4418, 0x49BB041A, 0x49BB0419,
+    0x49BB0417, 0x49BB0418, 0x49A4441A, 0x49A44419, 0x49A44417, 0x49A44418, 0x49A4041A, 0x49A40419,
+    0x49A40417, 0x49A40418, 0x49A4841A, 0x49A48419, 0x49A48417, 0x49A48418, 0x49A5041A, 0x49A50419,
+    0x49A50417, 0x49A50418, 0x49AAC41A, 0x49AAC419, 0x49AA841A, 0x49AA8419, 0x49AB441A, 0x49AB4419,
+    0x49A9841A, 0x49A98419, 0x49AF041A, 0x49AF0419, 0x49AD441A, 0x49AD4419, 0x49BDC41A, 0x49BDC419,
+    0x49BDC417, 0x49BDC418, 0x49BFC41A, 0x49BFC419, 0x49BFC417, 0x49BFC418, 0x49C1041A, 0x49C10419,
+    0x49C10417, 0x49C10418, 0x49C0841A, 0x49C08419, 0x49C08417, 0x49C08418, 0x49C6441A, 0x49C64419,
+    0x49C6C41A, 0x49C6C419, 0x49C6C417, 0x49C6C418, 0x8003D462, 0x8003D4A2, 0x49C9041A, 0x49C90419,
+    0x49C90417, 0x49C90418, 0x49C8C41A, 0x49C8C419, 0x49C8C417, 0x49C8C418, 0x49D1441A, 0x49D14419,
+    0x8003D4E2, 0x8003D522, 0x414D8402, 0x414DC402, 0x414E0402, 0x414E4402, 0x414E8402, 0x414EC402,
+    0x414F0402, 0x414F4402, 0x414F8402, 0x414FC402, 0x41500402, 0x41504402, 0x41508402, 0x4150C402,
+    0x41510402, 0x41514402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x49BF041A, 0x49BF0419, 0x49BF0417, 0x49BF0418, 0x49CB041A,
+    0x49CB0419, 0x49CAC41A, 0x49CAC419, 0x49CB441A, 0x49CB4419, 0x8003D562, 0x49CC041A, 0x49CC0419,
+    0x49CA841A, 0x49CA8419, 0x49CB841A, 0x49CB8419, 0x49CEC41A, 0x49CEC419, 0x49CEC417, 0x49CEC418,
+    0x49CD8417, 0x49CD8418, 0x8003D5A2, 0x8003D5E2, 0x8003D622, 0x8003D662, 0x8003D6A2, 0x8003D6E2,
+    0x8003D722, 0x8003D762, 0x8003D7A2, 0x8003D7E2, 0x8003D822, 0x8003D862, 0x8003D8A2, 0x8003D8E2,
+    0x8003D922, 0x8003D962, 0x8003D9A2, 0x8003D9E2, 0x49CE041A, 0x49CE0419, 0x49CE0417, 0x49CE0418,
+    0x8003DA22, 0x8003DA62, 0x8003DAA2, 0x8003D962, 0x8003DAE2, 0x8003DB22, 0x8003DB62, 0x8003DBA2,
+    0x8003DBE2, 0x8003DC22, 0x8003DC62, 0x8003DCA2, 0x8003DCE2, 0x8003DD22, 0x8003DD62, 0x8003DDA2,
+    0x8003DDE2, 0x8003DE22, 0x8003DE62, 0x8003DEA2, 0x8003DEE2, 0x8003DF22, 0x8003DF62, 0x8003DFA2,
+    0x8003DFE2, 0x8003E022, 0x8003E062, 0x8003E0A2, 0x8003E0E2, 0x8003E122, 0x8003E162, 0x8003E1A2,
+    0x8003E1E2, 0x8003E222, 0x8003E262, 0x8003E2A2, 0x8003E2E2, 0x8003E322, 0x8003E362, 0x8003E3A2,
+    0x8003E3E2, 0x8003E422, 0x8003E462, 0x8003E4A2, 0x8003E4E2, 0x8003E522, 0x8003E562, 0x8003E5A2,
+    0x8003E5E2, 0x8003E622, 0x8003E662, 0x8003E6A2, 0x8003E6E2, 0x8003E722, 0x8003E762, 0x8003E7A2,
+    0x8003E7E2, 0x8003E822, 0x8003E862, 0x8003E8A2, 0x8003E8E2, 0x8003E922, 0x8003E962, 0x8003E9A2,
+    0x8003E9E2, 0x8003EA22, 0x8003EA62, 0x8003EAA2, 0x8003EAE2, 0x8003EB22, 0x8003EB62, 0x8003EBA2,
+    0x8003EBE2, 0x8003EC22, 0x8003EC62, 0x8003ECA2, 0x8003ECE2, 0x8003ED22, 0x8003ED62, 0x8003EDA2,
+    0x8003EDE2, 0x8003EE22, 0x8003EE62, 0x8003EEA2, 0x8003EEE2, 0x8003EF22, 0x8003EF62, 0x8003EFA2,
+    0x8003EFE2, 0x8003F022, 0x8003F062, 0x8003F0A2, 0x8003F0E2, 0x8003F122, 0x8003F162, 0x8003F1A2,
+    0x8003F1E2, 0x8003F222, 0x8003F262, 0x8003F2A2, 0x8003F2E2, 0x8003F322, 0x8003F362, 0x8003F3A2,
+    0x8003D9A2, 0x8003F3E2, 0x8003F422, 0x8003F462, 0x8003F4A2, 0x8003F4E2, 0x8003F522, 0x8003F562,
+    0x8003F5A2, 0x8003F5E2, 0x8003F622, 0x8003F662, 0x8003F6A2, 0x8003F6E2, 0x8003F722, 0x8003F762,
+    0x8003F7A2, 0x8003F7E2, 0x8003F822, 0x8003F862, 0x8003F8A2, 0x8003F8E2, 0x8003F922, 0x8003F962,
+    0x8003F9A2, 0x8003F9E2, 0x8003FA22, 0x8003FA62, 0x8003FAA2, 0x8003FAE2, 0x8003FB22, 0x8003FB62,
+    0x8003FBA2, 0x8003FBE2, 0x8003FC22, 0x8003FC62, 0x8003FCA2, 0x8003FCE2, 0x8003FD22, 0x8003FD62,
+    0x8003FDA2, 0x8003FDE2, 0x8003FE22, 0x8003FE62, 0x8003FEA2, 0x8003FEE2, 0x8003FF22, 0x8003FF62,
+    0x8003FFA2, 0x8003FFE2, 0x80040022, 0x80040062, 0x800400A2, 0x800400E2, 0x80040122, 0x80040162,
+    0x800401A2, 0x800401E2, 0x80040222, 0x80040262, 0x800402A2, 0x800402E2, 0x80040322, 0x80040362,
+    0x800403A2, 0x800403E2, 0x80040422, 0x80040462, 0x800404A2, 0x800404E2, 0x80040522, 0x80040562,
+    0x800405A2, 0x800405E2, 0x80040622, 0x80040662, 0x800406A2, 0x800406E2, 0x80040722, 0x80040762,
+    0x800407A2, 0x800407E2, 0x80040822, 0x80040862, 0x800408A2, 0x800408E2, 0x80040922, 0x80040962,
+    0x800409A2, 0x800409E2, 0x80040A22, 0x80040A62, 0x80040AA2, 0x80040AE2, 0x80040B22, 0x80040B62,
+    0x80040BA2, 0x80040BE2, 0x80040C22, 0x80040C62, 0x80040CA2, 0x80040CE2, 0x80040D22, 0x80040D62,
+    0x80040DA2, 0x80040DE2, 0x80040E22, 0x80040E62, 0x80040EA2, 0x80040EE2, 0x80040F22, 0x80040F62,
+    0x80040FA2, 0x80040FE2, 0x80041022, 0x80041062, 0x800410A2, 0x800410E2, 0x80041122, 0x80041162,
+    0x800411A2, 0x800411E2, 0x80041222, 0x80041262, 0x800412A2, 0x800412E2, 0x80041322, 0x80041362,
+    0x800413A2, 0x800413E2, 0x80041422, 0x80041462, 0x800414A2, 0x800414E2, 0x80041522, 0x80041562,
+    0x800415A2, 0x800415E2, 0x80041622, 0x80041662, 0x800416A2, 0x800416E2, 0x80041722, 0x80041762,
+    0x800417A2, 0x800417E2, 0x80041822, 0x80041862, 0x800418A2, 0x800418E2, 0x80041922, 0x80041962,
+    0x800419A2, 0x800419E2, 0x80041A22, 0x80041A62, 0x80041AA2, 0x80041AE2, 0x80041B22, 0x80041B62,
+    0x80041BA2, 0x80041BE2, 0x80041C22, 0x80041C62, 0x80041CA2, 0x80041CE2, 0x80041D22, 0x80041D62,
+    0x80041DA2, 0x80041DE2, 0x80041E22, 0x80041E62, 0x80041EA2, 0x80041EE2, 0x80041F22, 0x80041F62,
+    0x80041FA2, 0x80041FE2, 0x80042022, 0x80042062, 0x800420A2, 0x800420E2, 0x80042122, 0x80042162,
+    0x800421A2, 0x800421E2, 0x80042222, 0x80042262, 0x800422A2, 0x800422E2, 0x80042322, 0x80042362,
+    0x800423A2, 0x800423E2, 0x80042422, 0x80042462, 0x800424A2, 0x800424E2, 0x80042522, 0x80042562,
+    0x800425A2, 0x800425E2, 0x80042622, 0x80042662, 0x800426A2, 0x800426E2, 0x80042722, 0x80042762,
+    0x800427A2, 0x800427E2, 0x80042822, 0x80042862, 0x800428A2, 0x800428E2, 0x40E48402, 0x40E4C402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80042923, 0x80042983, 0x800429E3, 0x80042A43, 0x80042AA3, 0x80042B03, 0x80042B63, 0x80042BC3,
+    0x80042C23, 0x80042C83, 0x80042CE3, 0x80042D43, 0x80042DA3, 0x80042E03, 0x80042E63, 0x80042EC3,
+    0x80042F23, 0x80042F83, 0x80042FE3, 0x80043043, 0x800430A3, 0x80043103, 0x80043163, 0x800431C3,
+    0x80043223, 0x80043283, 0x800432E3, 0x80043343, 0x800433A3, 0x80043403, 0x80043463, 0x800434C3,
+    0x80043523, 0x80043583, 0x800435E3, 0x80043643, 0x800436A3, 0x80043703, 0x80043763, 0x800437C3,
+    0x80043823, 0x80043883, 0x800438E3, 0x80043943, 0x800439A3, 0x80043A03, 0x80043A63, 0x80043AC3,
+    0x80043B23, 0x80043B83, 0x80043BE3, 0x80043C43, 0x80043CA3, 0x80043D03, 0x80043D63, 0x80043DC3,
+    0x80043E23, 0x80043E83, 0x80043EE3, 0x80043F43, 0x80043FA3, 0x80044003, 0x80044063, 0x800440C3,
+    0x00000000, 0x00000000, 0x80044123, 0x80044183, 0x800441E3, 0x80044243, 0x800442A3, 0x80044303,
+    0x80044363, 0x800443C3, 0x80044423, 0x80044483, 0x800444E3, 0x80044543, 0x800445A3, 0x80044603,
+    0x80044663, 0x800446C3, 0x80044723, 0x80044783, 0x800447E3, 0x80044843, 0x800448A3, 0x80044903,
+    0x80044963, 0x800449C3, 0x80044A23, 0x80044A83, 0x80044AE3, 0x80044B43, 0x80044BA3, 0x80044C03,
+    0x80044C63, 0x80044CC3, 0x80044D23, 0x80044D83, 0x80044DE3, 0x80044E43, 0x80044EA3, 0x80044F03,
+    0x80044F63, 0x80044FC3, 0x80045023, 0x80045083, 0x800450E3, 0x80045143, 0x800451A3, 0x80045203,
+    0x80045263, 0x800452C3, 0x80045323, 0x80045383, 0x800453E3, 0x80045443, 0x800454A3, 0x80045503,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80045563, 0x800455C3, 0x80045624, 0x800456A4, 0x80045724, 0x800457A4, 0x80045824, 0x800458A4,
+    0x80045924, 0x800459A3, 0x80045A12, 0x80045C48, 0x80045D44, 0x414D4402, 0x00000000, 0x00000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x4088C416, 0x408D8416, 0x40A48416, 0x40900416, 0x408E8416, 0x4099C416, 0x409B4416, 0x40E30416,
+    0x40E34416, 0x80045DC3, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x400009E2, 0x40000000, 0x400009C2, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000682,
+    0x40000000, 0x400009C2, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000A02, 0x40000000,
+    0x80045E22, 0x40858416, 0x40854416, 0x4082C416, 0x4082C416, 0x40CA0416, 0x40CA4416, 0x40CB0416,
+    0x40CB4416, 0x40E28416, 0x40E2C416, 0x40E20416, 0x40E24416, 0x40E08416, 0x40E0C416, 0x40E00416,
+    0x40E04416, 0x40E10416, 0x40E14416, 0x40E18416, 0x40E1C416, 0x408DC402, 0x408E0402, 0x40CA8416,
+    0x40CAC416, 0x40828404, 0x40828404, 0x40828404, 0x40828404, 0x4082C404, 0x4082C404, 0x4082C404,
+    0x4088C40F, 0x408D840F, 0x409F840F, 0x00000000, 0x408E840F, 0x4090040F, 0x409B440F, 0x4099C40F,
+    0x4085840F, 0x40CA040F, 0x40CA440F, 0x40CB040F, 0x40CB440F, 0x40E2840F, 0x40E2C40F, 0x40EB040F,
+    0x40EA440F, 0x40E8440F, 0x4199840F, 0x4083440F, 0x419A840F, 0x419B040F, 0x419AC40F, 0x00000000,
+    0x40E9C40F, 0x47D9040F, 0x40EB440F, 0x40E8040F, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40000DBA, 0x40000DB8, 0x40000E1A, 0x40000000, 0x40000E7A, 0x00000000, 0x40000EDA, 0x40000ED8,
+    0x40000F5A, 0x40000F58, 0x40000FBA, 0x40000FB8, 0x4000101A, 0x40001018, 0x4000103A, 0x40001038,
+    0x4999041A, 0x4999441A, 0x49994419, 0x4999841A, 0x49998419, 0x499A441A, 0x499A4419, 0x499A841A,
+    0x499A8419, 0x499B841A, 0x499B8419, 0x499B8417, 0x499B8418, 0x499C841A, 0x499C8419, 0x499D041A,
+    0x499D0419, 0x499D0417, 0x499D0418, 0x49A1041A, 0x49A10419, 0x49A1441A, 0x49A14419, 0x49A14417,
+    0x49A14418, 0x49A1841A, 0x49A18419, 0x49A18417, 0x49A18418, 0x49A3C41A, 0x49A3C419, 0x49A3C417,
+    0x49A3C418, 0x49A6441A, 0x49A64419, 0x49A64417, 0x49A64418, 0x49A6841A, 0x49A68419, 0x49A68417,
+    0x49A68418, 0x49A9041A, 0x49A90419, 0x49A9441A, 0x49A94419, 0x49ACC41A, 0x49ACC419, 0x49AD041A,
+    0x49AD0419, 0x49B1841A, 0x49B18419, 0x49B18417, 0x49B18418, 0x49B1C41A, 0x49B1C419, 0x49B1C417,
+    0x49B1C418, 0x49B4441A, 0x49B44419, 0x49B44417, 0x49B44418, 0x49B4841A, 0x49B48419, 0x49B48417,
+    0x49B48418, 0x49B5C41A, 0x49B5C419, 0x49B5C417, 0x49B5C418, 0x49B6041A, 0x49B60419, 0x49B60417,
+    0x49B60418, 0x49B6C41A, 0x49B6C419, 0x49B6C417, 0x49B6C418, 0x49B7041A, 0x49B70419, 0x49B70417,
+    0x49B70418, 0x49B9041A, 0x49B90419, 0x49B90417, 0x49B90418, 0x49BC041A, 0x49BC0419, 0x49BC0417,
+    0x49BC0418, 0x49BD841A, 0x49BD8419, 0x49BD8417, 0x49BD8418, 0x49C3041A, 0x49C30419, 0x49C30417,
+    0x49C30418, 0x49C5041A, 0x49C50419, 0x49C50417, 0x49C50418, 0x49C6041A, 0x49C60419, 0x49C60417,
+    0x49C60418, 0x49C8841A, 0x49C88419, 0x49C88417, 0x49C88418, 0x49CA041A, 0x49CA0419, 0x49CD841A,
+    0x49CD8419, 0x49CDC41A, 0x49CDC419, 0x49CDC417, 0x49CDC418, 0x80045E62, 0x80045EA2, 0x80045EE2,
+    0x80045F22, 0x80045F62, 0x80045FA2, 0x80045FE2, 0x80046022, 0x00000000, 0x00000000, 0x40000000,
+    0x00000000, 0x4099C403, 0x40C74403, 0x40EB0403, 0x47D90403, 0x40EB4403, 0x40EA4403, 0x40C58403,
+    0x40CA0403, 0x40CA4403, 0x40E84403, 0x41998403, 0x4088C403, 0x40834403, 0x409F8403, 0x40E98403,
+    0x47E60403, 0x47E64403, 0x47E68403, 0x47E6C403, 0x47E70403, 0x47E74403, 0x47E78403, 0x47E7C403,
+    0x47E80403, 0x47E84403, 0x40900403, 0x408E8403, 0x419A8403, 0x419AC403, 0x419B0403, 0x409B4403,
+    0x40E80403, 0x47E88409, 0x47EF0409, 0x47F58409, 0x47FAC409, 0x4801C409, 0x48108409, 0x48144409,
+    0x481D4409, 0x48240409, 0x482AC409, 0x48310409, 0x48358409, 0x48424409, 0x48460409, 0x484F0409,
+    0x485AC409, 0x48600409, 0x4864C409, 0x48748409, 0x487DC409, 0x4885C409, 0x4891C409, 0x48964409,
+    0x48990409, 0x489C0409, 0x48A18409, 0x40CA8403, 0x40E9C403, 0x40CAC403, 0x412DC403, 0x4082C403,
+    0x412D0403, 0x47E88403, 0x47EF0403, 0x47F58403, 0x47FAC403, 0x4801C403, 0x48108403, 0x48144403,
+    0x481D4403, 0x48240403, 0x482AC403, 0x48310403, 0x48358403, 0x48424403, 0x48460403, 0x484F0403,
+    0x485AC403, 0x48600403, 0x4864C403, 0x48748403, 0x487DC403, 0x4885C403, 0x4891C403, 0x48964403,
+    0x48990403, 0x489C0403, 0x48A18403, 0x40CB0403, 0x419B8403, 0x40CB4403, 0x419C0403, 0x40CF8403,
+    0x40CFC403, 0x40A48412, 0x40E10412, 0x40E14412, 0x408D8412, 0x40884412, 0x50C24412, 0x50B68410,
+    0x50B6C410, 0x50B70410, 0x50B78410, 0x50B7C410, 0x50BF8410, 0x50BFC410, 0x50C00410, 0x50BB0410,
+    0x47D80412, 0x50B68412, 0x50B6C412, 0x50B70412, 0x50B78412, 0x50B7C412, 0x50B80412, 0x50B84412,
+    0x50B88412, 0x50B8C412, 0x50B90412, 0x50B94412, 0x50B98412, 0x50B9C412, 0x50BA0412, 0x50BA4412,
+    0x50BA8412, 0x50BAC412, 0x50BB0412, 0x50BB4412, 0x50BB8412, 0x50BBC412, 0x50BC0412, 0x50BC4412,
+    0x50BC8412, 0x50BCC412, 0x50BD0412, 0x50BD4412, 0x50BD8412, 0x50BDC412, 0x50BE0412, 0x50BE4412,
+    0x50BE8412, 0x50BEC412, 0x50BF0412, 0x50BF4412, 0x50BF8412, 0x50BFC412, 0x50C00412, 0x50C04412,
+    0x50C08412, 0x50C0C412, 0x50C10412, 0x50C14412, 0x50C18412, 0x50C28412, 0x400006F2, 0x40000712,
+    0x507C8412, 0x505D4412, 0x505D8412, 0x5094C412, 0x505DC412, 0x50954412, 0x50958412, 0x505E0412,
+    0x505E4412, 0x505E8412, 0x50964412, 0x50968412, 0x5096C412, 0x50970412, 0x50974412, 0x50978412,
+    0x5063C412, 0x505EC412, 0x505F0412, 0x505F4412, 0x50658412, 0x505F8412, 0x505FC412, 0x50600412,
+    0x50604412, 0x50608412, 0x5060C412, 0x50610412, 0x50614412, 0x50618412, 0x5061C412, 0x00000000,
+    0x00000000, 0x00000000, 0x507CC412, 0x507D0412, 0x507D4412, 0x507D8412, 0x507DC412, 0x507E0412,
+    0x00000000, 0x00000000, 0x507E4412, 0x507E8412, 0x507EC412, 0x507F0412, 0x507F4412, 0x507F8412,
+    0x00000000, 0x00000000, 0x507FC412, 0x50800412, 0x50804412, 0x50808412, 0x5080C412, 0x50810412,
+    0x00000000, 0x00000000, 0x50814412, 0x50818412, 0x5081C412, 0x00000000, 0x00000000, 0x00000000,
+    0x47D8C403, 0x47D94403, 0x419B4403, 0x412E0403, 0x419BC403, 0x47D98403, 0x47E00403, 0x00000000,
+    0x421AC412, 0x417B0412, 0x417B8412, 0x417B4412, 0x417BC412, 0x42424412, 0x424D0412, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x40000000, 0x40000000, 0x40000000, 0x47554402, 0x7FFF4402, 0x00000000, 0x00000000,
+    0x533F0402, 0x533F4402, 0x533F8402, 0x533FC402, 0x53400402, 0x53404402, 0x53408402, 0x5340C402,
+    0x53410402, 0x53414402, 0x53418402, 0x5341C402, 0x00000000, 0x53420402, 0x53424402, 0x53428402,
+    0x5342C402, 0x53430402, 0x53434402, 0x53438402, 0x5343C402, 0x53440402, 0x53444402, 0x53448402,
+    0x5344C402, 0x53450402, 0x53454402, 0x53458402, 0x5345C402, 0x53460402, 0x53464402, 0x53468402,
+    0x5346C402, 0x53470402, 0x53474402, 0x53478402, 0x5347C402, 0x53480402, 0x53484402, 0x00000000,
+    0x53488402, 0x5348C402, 0x53490402, 0x53494402, 0x53498402, 0x5349C402, 0x534A0402, 0x534A4402,
+    0x534A8402, 0x534AC402, 0x534B0402, 0x534B4402, 0x534B8402, 0x534BC402, 0x534C0402, 0x534C4402,
+    0x534C8402, 0x534CC402, 0x534D0402, 0x00000000, 0x534D4402, 0x534D8402, 0x00000000, 0x534DC402,
+    0x534E0402, 0x534E4402, 0x534E8402, 0x534EC402, 0x534F0402, 0x534F4402, 0x534F8402, 0x534FC402,
+    0x53500402, 0x53504402, 0x53508402, 0x5350C402, 0x53510402, 0x53514402, 0x00000000, 0x00000000,
+    0x53518402, 0x5351C402, 0x53520402, 0x53524402, 0x53528402, 0x5352C402, 0x53530402, 0x53534402,
+    0x53538402, 0x5353C402, 0x53540402, 0x53544402, 0x53548402, 0x5354C402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53550402, 0x53554402, 0x53558402, 0x5355C402, 0x53560402, 0x53564402, 0x53568402, 0x5356C402,
+    0x53570402, 0x53574402, 0x53578402, 0x5357C402, 0x53580402, 0x53584402, 0x53588402, 0x5358C402,
+    0x53590402, 0x53594402, 0x53598402, 0x5359C402, 0x535A0402, 0x535A4402, 0x535A8402, 0x535AC402,
+    0x535B0402, 0x535B4402, 0x535B8402, 0x535BC402, 0x535C0402, 0x535C4402, 0x535C8402, 0x535CC402,
+    0x535D0402, 0x535D4402, 0x535D8402, 0x535DC402, 0x535E0402, 0x535E4402, 0x535E8402, 0x535EC402,
+    0x535F0402, 0x535F4402, 0x535F8402, 0x535FC402, 0x53600402, 0x53604402, 0x53608402, 0x5360C402,
+    0x53610402, 0x53614402, 0x53618402, 0x5361C402, 0x53620402, 0x53624402, 0x53628402, 0x5362C402,
+    0x53630402, 0x53634402, 0x53638402, 0x5363C402, 0x53640402, 0x53644402, 0x53648402, 0x5364C402,
+    0x53650402, 0x53654402, 0x53658402, 0x5365C402, 0x53660402, 0x53664402, 0x53668402, 0x5366C402,
+    0x53670402, 0x53674402, 0x53678402, 0x5367C402, 0x53680402, 0x53684402, 0x53688402, 0x5368C402,
+    0x53690402, 0x53694402, 0x53698402, 0x5369C402, 0x536A0402, 0x536A4402, 0x536A8402, 0x536AC402,
+    0x536B0402, 0x536B4402, 0x536B8402, 0x536BC402, 0x536C0402, 0x536C4402, 0x536C8402, 0x536CC402,
+    0x536D0402, 0x536D4402, 0x536D8402, 0x536DC402, 0x536E0402, 0x536E4402, 0x536E8402, 0x536EC402,
+    0x536F0402, 0x536F4402, 0x536F8402, 0x536FC402, 0x53700402, 0x53704402, 0x53708402, 0x5370C402,
+    0x53710402, 0x53714402, 0x53718402, 0x5371C402, 0x53720402, 0x53724402, 0x53728402, 0x5372C402,
+    0x53730402, 0x53734402, 0x53738402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40C2C402, 0x40C30402, 0x40C34402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x476F8402, 0x476FC402, 0x47700402, 0x47704402, 0x47708402, 0x4770C402, 0x47710402, 0x47714402,
+    0x47718402, 0x4771C402, 0x47720402, 0x47724402, 0x47728402, 0x4772C402, 0x47730402, 0x47734402,
+    0x47738402, 0x4773C402, 0x47740402, 0x47744402, 0x47748402, 0x4774C402, 0x47750402, 0x47754402,
+    0x47758402, 0x4775C402, 0x47760402, 0x47764402, 0x47768402, 0x4776C402, 0x47770402, 0x47774402,
+    0x47778402, 0x4777C402, 0x47780402, 0x47784402, 0x00000000, 0x00000000, 0x00000000, 0x44310402,
+    0x44314402, 0x44318402, 0x4431C402, 0x44320402, 0x44324402, 0x44328402, 0x4432C402, 0x44330402,
+    0x47788402, 0x4778C402, 0x47E64402, 0x47E74402, 0x47790402, 0x47794402, 0x47798402, 0x4779C402,
+    0x47E74402, 0x477A0402, 0x477A4402, 0x477A8402, 0x477AC402, 0x477B0402, 0x477B4402, 0x47E74402,
+    0x477B8402, 0x477BC402, 0x477C0402, 0x477C4402, 0x477C8402, 0x477CC402, 0x477D0402, 0x477D4402,
+    0x47E64402, 0x47E64402, 0x47E64402, 0x47E68402, 0x47E68402, 0x47E68402, 0x47E68402, 0x47E74402,
+    0x477D8402, 0x477DC402, 0x477E0402, 0x477E4402, 0x477E8402, 0x477EC402, 0x477F0402, 0x477F4402,
+    0x477F8402, 0x477FC402, 0x47800402, 0x47804402, 0x47808402, 0x4780C402, 0x47810402, 0x47814402,
+    0x47818402, 0x4781C402, 0x47820402, 0x47E74402, 0x47824402, 0x47828402, 0x4782C402, 0x47830402,
+    0x47834402, 0x44334402, 0x44338402, 0x4433C402, 0x44340402, 0x44344402, 0x44348402, 0x4434C402,
+    0x44350402, 0x44354402, 0x44358402, 0x4435C402, 0x44360402, 0x44364402, 0x44368402, 0x4436C402,
+    0x44370402, 0x44374402, 0x47E60402, 0x47838402, 0x44378402, 0x4437C402, 0x44380402, 0x00000000,
+    0x44384402, 0x44388402, 0x4438C402, 0x44390402, 0x44394402, 0x44398402, 0x4439C402, 0x443A0402,
+    0x443A4402, 0x443A8402, 0x443AC402, 0x443B0402, 0x443B4402, 0x00000000, 0x00000000, 0x00000000,
+    0x443B8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x443BC402, 0x443C0402, 0x443C4402, 0x443C8402, 0x443CC402, 0x443D0402, 0x443D4402, 0x443D8402,
+    0x443DC402, 0x443E0402, 0x443E4402, 0x443E8402, 0x443EC402, 0x443F0402, 0x443F4402, 0x443F8402,
+    0x443FC402, 0x44400402, 0x44404402, 0x44408402, 0x4440C402, 0x44410402, 0x44414402, 0x44418402,
+    0x4441C402, 0x44420402, 0x44424402, 0x44428402, 0x4442C402, 0x44430402, 0x44434402, 0x44438402,
+    0x4443C402, 0x44440402, 0x44444402, 0x44448402, 0x4444C402, 0x44450402, 0x44454402, 0x44458402,
+    0x4445C402, 0x44460402, 0x44464402, 0x44468402, 0x4446C402, 0x400022E2, 0x00000000, 0x00000000,
+    0x52B04402, 0x52B08402, 0x52B0C402, 0x52B10402, 0x52B14402, 0x52B18402, 0x52B1C402, 0x52B20402,
+    0x52B24402, 0x52B28402, 0x52B2C402, 0x52B30402, 0x52B34402, 0x52B38402, 0x52B3C402, 0x52B40402,
+    0x52B44402, 0x52B48402, 0x52B4C402, 0x52B50402, 0x52B54402, 0x52B58402, 0x52B5C402, 0x52B60402,
+    0x52B64402, 0x52B68402, 0x52B6C402, 0x52B70402, 0x52B74402, 0x00000000, 0x00000000, 0x00000000,
+    0x52B78402, 0x52B7C402, 0x52B80402, 0x52B84402, 0x52B88402, 0x52B8C402, 0x52B90402, 0x52B94402,
+    0x52B98402, 0x52B9C402, 0x52BA0402, 0x52BA4402, 0x52BA8402, 0x52BAC402, 0x52BB0402, 0x52BB4402,
+    0x52BB8402, 0x52BBC402, 0x52BC0402, 0x52BC4402, 0x52BC8402, 0x52BCC402, 0x52BD0402, 0x52BD4402,
+    0x52BD8402, 0x52BDC402, 0x52BE0402, 0x52BE4402, 0x52BE8402, 0x52BEC402, 0x52BF0402, 0x52BF4402,
+    0x52BF8402, 0x52BFC402, 0x52C00402, 0x52C04402, 0x52C08402, 0x52C0C402, 0x52C10402, 0x52C14402,
+    0x52C18402, 0x52C1C402, 0x52C20402, 0x52C24402, 0x52C28402, 0x52C2C402, 0x52C30402, 0x52C34402,
+    0x52C38402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40000000, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4783C402, 0x47840402, 0x47844402, 0x47848402, 0x4784C402, 0x47850402,
+    0x47854402, 0x47858402, 0x4785C402, 0x47860402, 0x47864402, 0x47868402, 0x4786C402, 0x47870402,
+    0x47874402, 0x47878402, 0x4787C402, 0x47880402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52CA4402, 0x52CA8402, 0x52CAC402, 0x52CB0402, 0x52CB4402, 0x52CB8402, 0x52CBC402, 0x52CC0402,
+    0x52CC4402, 0x52CC8402, 0x52CCC402, 0x52CD0402, 0x52CD4402, 0x52CD8402, 0x52CDC402, 0x52CE4402,
+    0x52CE8402, 0x52CEC402, 0x52CF0402, 0x52CF4402, 0x52CF8402, 0x52CFC402, 0x52D00402, 0x52D04402,
+    0x52D08402, 0x52D0C402, 0x52D10402, 0x52D14402, 0x52D18402, 0x52D1C402, 0x52D20402, 0x52CE0402,
+    0x47E64402, 0x47E74402, 0x476E0402, 0x476E4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x52D24402, 0x52D28402, 0x52D2C402,
+    0x52D30402, 0x52D34402, 0x52D38402, 0x52D3C402, 0x52D40402, 0x52D44402, 0x52D48402, 0x52D4C402,
+    0x52D50402, 0x52D54402, 0x52D58402, 0x52D5C402, 0x52D60402, 0x52D64402, 0x52D68402, 0x52D6C402,
+    0x52D70402, 0x52D74402, 0x52D78402, 0x52D7C402, 0x52D80402, 0x52D84402, 0x52D88402, 0x52D8C402,
+    0x52D90402, 0x52D94402, 0x52D98402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x495E4402, 0x495E8402, 0x495EC402, 0x495F0402, 0x495F4402, 0x495F8402, 0x495FC402, 0x49600402,
+    0x49604402, 0x49608402, 0x4960C402, 0x49610402, 0x49614402, 0x49618402, 0x4961C402, 0x49620402,
+    0x49624402, 0x49628402, 0x4962C402, 0x49630402, 0x49634402, 0x49638402, 0x4963C402, 0x49640402,
+    0x49644402, 0x49648402, 0x4964C402, 0x49650402, 0x49654402, 0x49658402, 0x4965C402, 0x49660402,
+    0x49664402, 0x49668402, 0x4966C402, 0x49670402, 0x49674402, 0x49678402, 0x495E4404, 0x495F0404,
+    0x49600404, 0x49618404, 0x49628404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x543FC402, 0x54400402, 0x54404402, 0x54408402, 0x5440C402, 0x54410402, 0x54414402, 0x54418402,
+    0x5441C402, 0x54420402, 0x54424402, 0x54428402, 0x5442C402, 0x54430402, 0x54434402, 0x54438402,
+    0x5443C402, 0x54440402, 0x54444402, 0x54448402, 0x5444C402, 0x54450402, 0x54454402, 0x54458402,
+    0x5445C402, 0x54460402, 0x54464402, 0x54468402, 0x5446C402, 0x54470402, 0x00000000, 0x40C38402,
+    0x54474402, 0x54478402, 0x5447C402, 0x54480402, 0x54484402, 0x54488402, 0x5448C402, 0x54490402,
+    0x54494402, 0x54498402, 0x5449C402, 0x544A0402, 0x544A4402, 0x544A8402, 0x544AC402, 0x544B0402,
+    0x544B4402, 0x544B8402, 0x544BC402, 0x544C0402, 0x544C4402, 0x544C8402, 0x544CC402, 0x544D0402,
+    0x544D4402, 0x544D8402, 0x544DC402, 0x544E0402, 0x544E4402, 0x544E8402, 0x544EC402, 0x544F0402,
+    0x544F4402, 0x544F8402, 0x544FC402, 0x54500402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x54504402, 0x54508402, 0x5450C402, 0x54510402, 0x54514402, 0x54518402, 0x5451C402, 0x54520402,
+    0x40C3C402, 0x47E64402, 0x47E68402, 0x47884402, 0x47888402, 0x4788C402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52D9C408, 0x52DA0408, 0x52DA4408, 0x52DA8408, 0x52DAC408, 0x52DB0408, 0x52DB4408, 0x52DB8408,
+    0x52DBC408, 0x52DC0408, 0x52DC4408, 0x52DC8408, 0x52DCC408, 0x52DD0408, 0x52DD4408, 0x52DD8408,
+    0x52DDC408, 0x52DE0408, 0x52DE4408, 0x52DE8408, 0x52DEC408, 0x52DF0408, 0x52DF4408, 0x52DF8408,
+    0x52DFC408, 0x52E00408, 0x52E04408, 0x52E08408, 0x52E0C408, 0x52E10408, 0x52E14408, 0x52E18408,
+    0x52E1C408, 0x52E20408, 0x52E24408, 0x52E28408, 0x52E2C408, 0x52E30408, 0x52E34408, 0x52E38408,
+    0x52D9C402, 0x52DA0402, 0x52DA4402, 0x52DA8402, 0x52DAC402, 0x52DB0402, 0x52DB4402, 0x52DB8402,
+    0x52DBC402, 0x52DC0402, 0x52DC4402, 0x52DC8402, 0x52DCC402, 0x52DD0402, 0x52DD4402, 0x52DD8402,
+    0x52DDC402, 0x52DE0402, 0x52DE4402, 0x52DE8402, 0x52DEC402, 0x52DF0402, 0x52DF4402, 0x52DF8402,
+    0x52DFC402, 0x52E00402, 0x52E04402, 0x52E08402, 0x52E0C402, 0x52E10402, 0x52E14402, 0x52E18402,
+    0x52E1C402, 0x52E20402, 0x52E24402, 0x52E28402, 0x52E2C402, 0x52E30402, 0x52E34402, 0x52E38402,
+    0x52E3C402, 0x52E40402, 0x52E44402, 0x52E48402, 0x52E4C402, 0x52E50402, 0x52E54402, 0x52E58402,
+    0x52E5C402, 0x52E60402, 0x52E64402, 0x52E68402, 0x52E6C402, 0x52E70402, 0x52E74402, 0x52E78402,
+    0x52E7C402, 0x52E80402, 0x52E84402, 0x52E88402, 0x52E8C402, 0x52E90402, 0x52E94402, 0x52E98402,
+    0x52E9C402, 0x52EA0402, 0x52EA4402, 0x52EA8402, 0x52EAC402, 0x52EB0402, 0x52EB4402, 0x52EB8402,
+    0x52EBC402, 0x52EC0402, 0x52EC4402, 0x52EC8402, 0x52ECC402, 0x52ED0402, 0x52ED4402, 0x52ED8402,
+    0x52EDC402, 0x52EE0402, 0x52EE4402, 0x52EE8402, 0x52EEC402, 0x52EF0402, 0x52EF4402, 0x52EF8402,
+    0x53128402, 0x5312C402, 0x53130402, 0x53134402, 0x53138402, 0x5313C402, 0x53140402, 0x53144402,
+    0x53148402, 0x5314C402, 0x53150402, 0x53154402, 0x53158402, 0x5315C402, 0x53160402, 0x53164402,
+    0x53168402, 0x5316C402, 0x53170402, 0x53174402, 0x53178402, 0x5317C402, 0x53180402, 0x53184402,
+    0x53188402, 0x5318C402, 0x53190402, 0x53194402, 0x53198402, 0x5319C402, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4E4D0408, 0x4E4D4408, 0x4E4D8408, 0x4E4DC408, 0x4E4E0408, 0x4E4E4408, 0x4E4E8408, 0x4E4EC408,
+    0x4E4F0408, 0x4E4F4408, 0x4E4F8408, 0x4E4FC408, 0x4E500408, 0x4E504408, 0x4E508408, 0x4E50C408,
+    0x4E510408, 0x4E514408, 0x4E518408, 0x4E51C408, 0x4E520408, 0x4E524408, 0x4E528408, 0x4E52C408,
+    0x4E530408, 0x4E534408, 0x4E538408, 0x4E53C408, 0x4E540408, 0x4E544408, 0x4E548408, 0x4E54C408,
+    0x4E550408, 0x4E554408, 0x4E558408, 0x4E55C408, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4E4D0402, 0x4E4D4402, 0x4E4D8402, 0x4E4DC402, 0x4E4E0402, 0x4E4E4402, 0x4E4E8402, 0x4E4EC402,
+    0x4E4F0402, 0x4E4F4402, 0x4E4F8402, 0x4E4FC402, 0x4E500402, 0x4E504402, 0x4E508402, 0x4E50C402,
+    0x4E510402, 0x4E514402, 0x4E518402, 0x4E51C402, 0x4E520402, 0x4E524402, 0x4E528402, 0x4E52C402,
+    0x4E530402, 0x4E534402, 0x4E538402, 0x4E53C402, 0x4E540402, 0x4E544402, 0x4E548402, 0x4E54C402,
+    0x4E550402, 0x4E554402, 0x4E558402, 0x4E55C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x531A0402, 0x531A4402, 0x531A8402, 0x531AC402, 0x531B0402, 0x531B4402, 0x531B8402, 0x531BC402,
+    0x531C0402, 0x531C4402, 0x531C8402, 0x531CC402, 0x531D0402, 0x531D4402, 0x531D8402, 0x531DC402,
+    0x531E0402, 0x531E4402, 0x531E8402, 0x531EC402, 0x531F0402, 0x531F4402, 0x531F8402, 0x531FC402,
+    0x53200402, 0x53204402, 0x53208402, 0x5320C402, 0x53210402, 0x53214402, 0x53218402, 0x5321C402,
+    0x53220402, 0x53224402, 0x53228402, 0x5322C402, 0x53230402, 0x53234402, 0x53238402, 0x5323C402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53240402, 0x53244402, 0x53248402, 0x5324C402, 0x53250402, 0x53254402, 0x53258402, 0x5325C402,
+    0x53260402, 0x53264402, 0x53268402, 0x5326C402, 0x53270402, 0x53274402, 0x53278402, 0x5327C402,
+    0x53280402, 0x53284402, 0x53288402, 0x5328C402, 0x53290402, 0x53294402, 0x53298402, 0x5329C402,
+    0x532A0402, 0x532A4402, 0x532A8402, 0x532AC402, 0x532B0402, 0x532B4402, 0x532B8402, 0x532BC402,
+    0x532C0402, 0x532C4402, 0x532C8402, 0x532CC402, 0x532D0402, 0x532D4402, 0x532D8402, 0x532DC402,
+    0x532E0402, 0x532E4402, 0x532E8402, 0x532EC402, 0x532F0402, 0x532F4402, 0x532F8402, 0x532FC402,
+    0x53300402, 0x53304402, 0x53308402, 0x5330C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x41178402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x5373C402, 0x53740402, 0x53744402, 0x53748402, 0x5374C402, 0x53750402, 0x53754402, 0x53758402,
+    0x5375C402, 0x53760402, 0x53764402, 0x53768402, 0x5376C402, 0x53770402, 0x53774402, 0x53778402,
+    0x5377C402, 0x53780402, 0x53784402, 0x53788402, 0x5378C402, 0x53790402, 0x53794402, 0x53798402,
+    0x5379C402, 0x537A0402, 0x537A4402, 0x537A8402, 0x537AC402, 0x537B0402, 0x537B4402, 0x537B8402,
+    0x537BC402, 0x537C0402, 0x537C4402, 0x537C8402, 0x537CC402, 0x537D0402, 0x537D4402, 0x537D8402,
+    0x537DC402, 0x537E0402, 0x537E4402, 0x537E8402, 0x537EC402, 0x537F0402, 0x537F4402, 0x537F8402,
+    0x537FC402, 0x53800402, 0x53804402, 0x53808402, 0x5380C402, 0x53810402, 0x53814402, 0x53818402,
+    0x5381C402, 0x53820402, 0x53824402, 0x53828402, 0x5382C402, 0x53830402, 0x53834402, 0x53838402,
+    0x5383C402, 0x53840402, 0x53844402, 0x53848402, 0x5384C402, 0x53850402, 0x53854402, 0x53858402,
+    0x5385C402, 0x53860402, 0x53864402, 0x53868402, 0x5386C402, 0x53870402, 0x53874402, 0x53878402,
+    0x5387C402, 0x53880402, 0x53884402, 0x53888402, 0x5388C402, 0x53890402, 0x53894402, 0x53898402,
+    0x5389C402, 0x538A0402, 0x538A4402, 0x538A8402, 0x538AC402, 0x538B0402, 0x538B4402, 0x538B8402,
+    0x538BC402, 0x538C0402, 0x538C4402, 0x538C8402, 0x538CC402, 0x538D0402, 0x538D4402, 0x538D8402,
+    0x538DC402, 0x538E0402, 0x538E4402, 0x538E8402, 0x538EC402, 0x538F0402, 0x538F4402, 0x538F8402,
+    0x538FC402, 0x53900402, 0x53904402, 0x53908402, 0x5390C402, 0x53910402, 0x53914402, 0x53918402,
+    0x5391C402, 0x53920402, 0x53924402, 0x53928402, 0x5392C402, 0x53930402, 0x53934402, 0x53938402,
+    0x5393C402, 0x53940402, 0x53944402, 0x53948402, 0x5394C402, 0x53950402, 0x53954402, 0x53958402,
+    0x5395C402, 0x53960402, 0x53964402, 0x53968402, 0x5396C402, 0x53970402, 0x53974402, 0x53978402,
+    0x5397C402, 0x53980402, 0x53984402, 0x53988402, 0x5398C402, 0x53990402, 0x53994402, 0x53998402,
+    0x5399C402, 0x539A0402, 0x539A4402, 0x539A8402, 0x539AC402, 0x539B0402, 0x539B4402, 0x539B8402,
+    0x539BC402, 0x539C0402, 0x539C4402, 0x539C8402, 0x539CC402, 0x539D0402, 0x539D4402, 0x539D8402,
+    0x539DC402, 0x539E0402, 0x539E4402, 0x539E8402, 0x539EC402, 0x539F0402, 0x539F4402, 0x539F8402,
+    0x539FC402, 0x53A00402, 0x53A04402, 0x53A08402, 0x53A0C402, 0x53A10402, 0x53A14402, 0x53A18402,
+    0x53A1C402, 0x53A20402, 0x53A24402, 0x53A28402, 0x53A2C402, 0x53A30402, 0x53A34402, 0x53A38402,
+    0x53A3C402, 0x53A40402, 0x53A44402, 0x53A48402, 0x53A4C402, 0x53A50402, 0x53A54402, 0x53A58402,
+    0x53A5C402, 0x53A60402, 0x53A64402, 0x53A68402, 0x53A6C402, 0x53A70402, 0x53A74402, 0x53A78402,
+    0x53A7C402, 0x53A80402, 0x53A84402, 0x53A88402, 0x53A8C402, 0x53A90402, 0x53A94402, 0x53A98402,
+    0x53A9C402, 0x53AA0402, 0x53AA4402, 0x53AA8402, 0x53AAC402, 0x53AB0402, 0x53AB4402, 0x53AB8402,
+    0x53ABC402, 0x53AC0402, 0x53AC4402, 0x53AC8402, 0x53ACC402, 0x53AD0402, 0x53AD4402, 0x53AD8402,
+    0x53ADC402, 0x53AE0402, 0x53AE4402, 0x53AE8402, 0x53AEC402, 0x53AF0402, 0x53AF4402, 0x53AF8402,
+    0x53AFC402, 0x53B00402, 0x53B04402, 0x53B08402, 0x53B0C402, 0x53B10402, 0x53B14402, 0x53B18402,
+    0x53B1C402, 0x53B20402, 0x53B24402, 0x53B28402, 0x53B2C402, 0x53B30402, 0x53B34402, 0x53B38402,
+    0x53B3C402, 0x53B40402, 0x53B44402, 0x53B48402, 0x53B4C402, 0x53B50402, 0x53B54402, 0x53B58402,
+    0x53B5C402, 0x53B60402, 0x53B64402, 0x53B68402, 0x53B6C402, 0x53B70402, 0x53B74402, 0x53B78402,
+    0x53B7C402, 0x53B80402, 0x53B84402, 0x53B88402, 0x53B8C402, 0x53B90402, 0x53B94402, 0x53B98402,
+    0x53B9C402, 0x53BA0402, 0x53BA4402, 0x53BA8402, 0x53BAC402, 0x53BB0402, 0x53BB4402, 0x53BB8402,
+    0x53BBC402, 0x53BC0402, 0x53BC4402, 0x53BC8402, 0x53BCC402, 0x53BD0402, 0x53BD4402, 0x53BD8402,
+    0x53BDC402, 0x53BE0402, 0x53BE4402, 0x53BE8402, 0x53BEC402, 0x53BF0402, 0x53BF4402, 0x53BF8402,
+    0x53BFC402, 0x53C00402, 0x53C04402, 0x53C08402, 0x53C0C402, 0x53C10402, 0x53C14402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53C18402, 0x53C1C402, 0x53C20402, 0x53C24402, 0x53C28402, 0x53C2C402, 0x53C30402, 0x53C34402,
+    0x53C38402, 0x53C3C402, 0x53C40402, 0x53C44402, 0x53C48402, 0x53C4C402, 0x53C50402, 0x53C54402,
+    0x53C58402, 0x53C5C402, 0x53C60402, 0x53C64402, 0x53C68402, 0x53C6C402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53C70402, 0x53C74402, 0x53C78402, 0x53C7C402, 0x53C80402, 0x53C84402, 0x53C88402, 0x53C8C402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53C90402, 0x53C94402, 0x53C98402, 0x53C9C402, 0x53CA0402, 0x53CA4402, 0x00000000, 0x00000000,
+    0x53CA8402, 0x00000000, 0x53CAC402, 0x53CB0402, 0x53CB4402, 0x53CB8402, 0x53CBC402, 0x53CC0402,
+    0x53CC4402, 0x53CC8402, 0x53CCC402, 0x53CD0402, 0x53CD4402, 0x53CD8402, 0x53CDC402, 0x53CE0402,
+    0x53CE4402, 0x53CE8402, 0x53CEC402, 0x53CF0402, 0x53CF4402, 0x53CF8402, 0x53CFC402, 0x53D00402,
+    0x53D04402, 0x53D08402, 0x53D0C402, 0x53D10402, 0x53D14402, 0x53D18402, 0x53D1C402, 0x53D20402,
+    0x53D24402, 0x53D28402, 0x53D2C402, 0x53D30402, 0x53D34402, 0x53D38402, 0x53D3C402, 0x53D40402,
+    0x53D44402, 0x53D48402, 0x53D4C402, 0x53D50402, 0x53D54402, 0x53D58402, 0x00000000, 0x53D5C402,
+    0x53D60402, 0x00000000, 0x00000000, 0x00000000, 0x53D64402, 0x00000000, 0x00000000, 0x53D68402,
+    0x5402C402, 0x54030402, 0x54034402, 0x54038402, 0x5403C402, 0x54040402, 0x54044402, 0x54048402,
+    0x5404C402, 0x54050402, 0x54054402, 0x54058402, 0x5405C402, 0x54060402, 0x54064402, 0x54068402,
+    0x5406C402, 0x54070402, 0x54074402, 0x54078402, 0x5407C402, 0x54080402, 0x00000000, 0x40B88402,
+    0x47E64402, 0x47E68402, 0x47E6C402, 0x478CC402, 0x478D0402, 0x478D4402, 0x478D8402, 0x478DC402,
+    0x53F28402, 0x53F2C402, 0x53F30402, 0x53F34402, 0x53F38402, 0x53F3C402, 0x53F40402, 0x53F44402,
+    0x53F48402, 0x53F4C402, 0x53F50402, 0x53F54402, 0x53F58402, 0x53F5C419, 0x53F5C402, 0x53F60402,
+    0x53F64402, 0x53F68402, 0x53F6C402, 0x53F70402, 0x53F74402, 0x53F78402, 0x53F7C402, 0x44470402,
+    0x44474402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47890402, 0x47894402,
+    0x53F80419, 0x53F80402, 0x53F84419, 0x53F84402, 0x53F88402, 0x53F8C402, 0x53F90419, 0x53F90402,
+    0x53F94402, 0x53F98402, 0x53F9C402, 0x53FA0402, 0x53FA4419, 0x53FA4402, 0x53FA8419, 0x53FA8402,
+    0x53FAC419, 0x53FAC402, 0x53FB0419, 0x53FB0402, 0x53FB4419, 0x53FB4402, 0x53FB8402, 0x53FBC402,
+    0x53FC0402, 0x53FC4402, 0x53FC8402, 0x53FCC402, 0x53FD0419, 0x53FD0402, 0x53FD4402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E70402, 0x47E74402, 0x47898402, 0x4789C402, 0x478A0402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53FD8402, 0x53FDC402, 0x53FE0402, 0x53FE4402, 0x53FE8402, 0x53FEC402, 0x53FF0402, 0x53FF4402,
+    0x53FF8402, 0x53FFC402, 0x54000402, 0x54004402, 0x54008402, 0x5400C402, 0x54010402, 0x54014402,
+    0x54018402, 0x5401C402, 0x54020402, 0x00000000, 0x54024402, 0x54028402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x47E64402, 0x47E74402, 0x478A4402, 0x478A8402, 0x478AC402,
+    0x498D0402, 0x498D4402, 0x498D8402, 0x498DC402, 0x498E0402, 0x498E4402, 0x498E8402, 0x498EC402,
+    0x498F0402, 0x498F4402, 0x498F8402, 0x498FC402, 0x49900402, 0x49904402, 0x49908402, 0x4990C402,
+    0x49910402, 0x49914402, 0x49918402, 0x4991C402, 0x49920402, 0x49924402, 0x47E64402, 0x478C0402,
+    0x478C4402, 0x478C8402, 0x47E68402, 0x47E6C402, 0x00000000, 0x00000000, 0x00000000, 0x40C40402,
+    0x52C3C402, 0x52C40402, 0x52C44402, 0x52C48402, 0x52C4C402, 0x52C50402, 0x52C54402, 0x52C58402,
+    0x52C5C402, 0x52C60402, 0x52C64402, 0x52C68402, 0x52C6C402, 0x52C70402, 0x52C74402, 0x52C78402,
+    0x52C7C402, 0x52C80402, 0x52C84402, 0x52C88402, 0x52C8C402, 0x52C90402, 0x52C94402, 0x52C98402,
+    0x52C9C402, 0x52CA0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40C28402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80046062, 0x800460A2, 0x800460E2, 0x80046122, 0x80046162, 0x800461A2, 0x800461E2, 0x80046222,
+    0x80046262, 0x800462A2, 0x800462E2, 0x80046322, 0x80046362, 0x800463A2, 0x800463E2, 0x80046422,
+    0x80046462, 0x800464A2, 0x800464E2, 0x80046522, 0x80046562, 0x800465A2, 0x800465E2, 0x80046622,
+    0x80046662, 0x800466A2, 0x800466E2, 0x80046722, 0x80046762, 0x800467A2, 0x567BC402, 0x567C0402,
+    0x56758402, 0x5675C402, 0x56760402, 0x56764402, 0x56768402, 0x5676C402, 0x56770402, 0x56774402,
+    0x56778402, 0x5677C402, 0x56780402, 0x56784402, 0x56788402, 0x5678C402, 0x56790402, 0x56794402,
+    0x800467E2, 0x56798402, 0x5679C402, 0x567A0402, 0x567A4402, 0x567A8402, 0x567AC402, 0x567B0402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47CAC402, 0x47C80402, 0x567B4402, 0x567B8402,
+    0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402,
+    0x47E84402, 0x47BD4402, 0x47BD8402, 0x47BDC402, 0x47BE0402, 0x47BE4402, 0x47BE8402, 0x47BEC402,
+    0x00000000, 0x00000000, 0x47BF0402, 0x47BF4402, 0x47BF8402, 0x47BFC402, 0x47C00402, 0x47C04402,
+    0x47C08402, 0x47C0C402, 0x47C10402, 0x47C14402, 0x47C18402, 0x47C1C402, 0x47C20402, 0x47C24402,
+    0x47C28402, 0x47C2C402, 0x47C30402, 0x47C34402, 0x47C38402, 0x47C3C402, 0x47C40402, 0x47C44402,
+    0x47C48402, 0x47C4C402, 0x47C50402, 0x47C54402, 0x47C58402, 0x47C5C402, 0x47C60402, 0x47C64402,
+    0x47C68402, 0x47C6C402, 0x47C70402, 0x47C74402, 0x47C78402, 0x47C7C402, 0x47C84402, 0x47C88402,
+    0x47C8C402, 0x47C90402, 0x47C94402, 0x47C98402, 0x47C9C402, 0x47CA0402, 0x47CA4402, 0x47CA8402,
+    0x4C6BC402, 0x4C6C0402, 0x4C6C4402, 0x4C6C8402, 0x00000000, 0x4C6CC402, 0x4C6D0402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4C6D4402, 0x40000682, 0x40001882, 0x400018A2,
+    0x4C6D8402, 0x4C6E0402, 0x4C6E4402, 0x4C6E8402, 0x00000000, 0x4C6EC402, 0x4C6F0402, 0x4C6F4402,
+    0x00000000, 0x4C6F8402, 0x4C6FC402, 0x4C704402, 0x4C70C402, 0x4C710402, 0x4C714402, 0x4C718402,
+    0x4C71C402, 0x4C720402, 0x4C724402, 0x4C728402, 0x4C72C402, 0x4C730402, 0x4C734402, 0x4C738402,
+    0x4C73C402, 0x4C740402, 0x4C744402, 0x4C748402, 0x4C74C402, 0x4C754402, 0x4C758402, 0x4C75C402,
+    0x4C760402, 0x4C764402, 0x4C6DC402, 0x4C708402, 0x4C700402, 0x4C750402, 0x00000000, 0x00000000,
+    0x400019A2, 0x400019C2, 0x400019E2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4C768402,
+    0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47978402, 0x4797C402, 0x47980402, 0x47984402,
+    0x47988402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x41190402, 0x41194402, 0x41198402, 0x4119C402, 0x411A0402, 0x411A4402, 0x40AC8402, 0x40ACC402,
+    0x411A8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53D6C402, 0x53D70402, 0x53D74402, 0x53D78402, 0x53D7C402, 0x53D80402, 0x53D84402, 0x53D88402,
+    0x53D8C402, 0x53D90402, 0x53D94402, 0x53D98402, 0x53D9C402, 0x53DA0402, 0x53DA4402, 0x53DA8402,
+    0x53DAC402, 0x53DB0402, 0x53DB4402, 0x53DB8402, 0x53DBC402, 0x53DC0402, 0x53DC4402, 0x53DC8402,
+    0x53DCC402, 0x53DD0402, 0x53DD4402, 0x53DD8402, 0x53DDC402, 0x47E64402, 0x478B0402, 0x478B4402,
+    0x53DE0402, 0x53DE4402, 0x53DE8402, 0x53DEC402, 0x53DF0402, 0x53DF4402, 0x53DF8402, 0x53DFC402,
+    0x53E00402, 0x53E04402, 0x53E08402, 0x53E0C402, 0x53E10402, 0x53E14402, 0x53E18402, 0x53E1C402,
+    0x53E20402, 0x53E24402, 0x53E28402, 0x53E2C402, 0x53E30402, 0x53E34402, 0x53E38402, 0x53E3C402,
+    0x53E40402, 0x53E44402, 0x53E48402, 0x53E4C402, 0x53E50402, 0x47E64402, 0x478B8402, 0x478BC402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x541C8402, 0x541CC402, 0x541D0402, 0x541D4402, 0x541D8402, 0x541DC402, 0x541E0402, 0x541E4402,
+    0x80046822, 0x541E8402, 0x541EC402, 0x541F0402, 0x541F4402, 0x541F8402, 0x541FC402, 0x54200402,
+    0x54204402, 0x54208402, 0x5420C402, 0x54210402, 0x54214402, 0x54218402, 0x5421C402, 0x54220402,
+    0x54224402, 0x54228402, 0x5422C402, 0x54230402, 0x54234402, 0x54238402, 0x5423C402, 0x54240402,
+    0x54244402, 0x54248402, 0x5424C402, 0x54250402, 0x54254402, 0x40000662, 0x40000682, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x47E64402, 0x47E74402, 0x478E0402, 0x478E4402, 0x478E8402,
+    0x411BC402, 0x411C0402, 0x411C4402, 0x411C8402, 0x411CC402, 0x411D0402, 0x411D4402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53E54402, 0x53E58402, 0x53E5C402, 0x53E60402, 0x53E64402, 0x53E68402, 0x53E6C402, 0x53E70402,
+    0x53E74402, 0x53E78402, 0x53E7C402, 0x53E80402, 0x53E84402, 0x53E88402, 0x53E8C402, 0x53E90402,
+    0x53E94402, 0x53E98402, 0x53E9C402, 0x53EA0402, 0x53EA4402, 0x53EA8402, 0x53EAC402, 0x53EB0402,
+    0x53EB4402, 0x53EB8402, 0x53EBC402, 0x53EC0402, 0x53EC4402, 0x53EC8402, 0x53ECC402, 0x53ED0402,
+    0x53ED4402, 0x53ED8402, 0x53EDC402, 0x53EE0402, 0x53EE4402, 0x53EE8402, 0x53EEC402, 0x53EF0402,
+    0x53EF4402, 0x53EF8402, 0x53EFC402, 0x53F00402, 0x53F04402, 0x53F08402, 0x80046862, 0x53F0C402,
+    0x53F10402, 0x53F14402, 0x53F18402, 0x53F1C402, 0x53F20402, 0x53F24402, 0x00000000, 0x00000000,
+    0x00000000, 0x411B8402, 0x40B8C402, 0x40B90402, 0x40B94402, 0x40B98402, 0x40B9C402, 0x40BA0402,
+    0x54084402, 0x54088402, 0x5408C402, 0x54090402, 0x54094402, 0x54098402, 0x5409C402, 0x540A0402,
+    0x540A4402, 0x540A8402, 0x540AC402, 0x540B0402, 0x540B4402, 0x540B8402, 0x540BC402, 0x540C0402,
+    0x540C4402, 0x540C8402, 0x540CC402, 0x540D0402, 0x540D4402, 0x540D8402, 0x00000000, 0x00000000,
+    0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x478EC402, 0x478F0402, 0x478F4402, 0x478F8402,
+    0x540DC402, 0x540E0402, 0x540E4402, 0x540E8402, 0x540EC402, 0x540F0402, 0x540F4402, 0x540F8402,
+    0x540FC402, 0x54100402, 0x54104402, 0x54108402, 0x5410C402, 0x54110402, 0x54114402, 0x54118402,
+    0x5411C402, 0x54120402, 0x54124402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x478FC402, 0x47900402, 0x47904402, 0x47908402,
+    0x54128402, 0x5412C402, 0x54130402, 0x54134402, 0x54138402, 0x5413C402, 0x54140402, 0x54144402,
+    0x54148402, 0x5414C402, 0x54150402, 0x54154402, 0x54158402, 0x5415C402, 0x54160402, 0x54164402,
+    0x54168402, 0x5416C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x411D8402, 0x411DC402, 0x411E0402, 0x411E4402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x4790C402, 0x47910402, 0x47914402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4F230402, 0x800468A2, 0x4F234402, 0x4F238402, 0x800468E2, 0x4F23C402, 0x4F240402, 0x4F244402,
+    0x80046922, 0x4F248402, 0x80046962, 0x4F24C402, 0x800469A2, 0x4F250402, 0x800469E2, 0x4F254402,
+    0x80046A22, 0x4F258402, 0x80046A62, 0x4F25C402, 0x4F260402, 0x80046AA2, 0x4F264402, 0x80046AE2,
+    0x4F268402, 0x80046B22, 0x4F26C402, 0x80046B62, 0x4F270402, 0x80046BA2, 0x4F274402, 0x80046BE2,
+    0x4F278402, 0x4F27C402, 0x4F280402, 0x4F284402, 0x4F288402, 0x80046C22, 0x4F28C402, 0x80046C62,
+    0x4F290402, 0x80046CA2, 0x4F294402, 0x80046CE2, 0x4F298402, 0x4F29C402, 0x80046D22, 0x4F2A0402,
+    0x4F2A4402, 0x4F2A8402, 0x4F2AC402, 0x80046D62, 0x4F2B0402, 0x80046DA2, 0x4F2B4402, 0x80046DE2,
+    0x4F2B8402, 0x80046E22, 0x4F2BC402, 0x80046E62, 0x4F2C0402, 0x4F2C4402, 0x4F2C8402, 0x4F2CC402,
+    0x80046EA2, 0x4F2D0402, 0x80046EE2, 0x4F2D4402, 0x80046F22, 0x4F2D8402, 0x80046F62, 0x4F2DC402,
+    0x4F2E0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4F18C408, 0x80046FA2, 0x4F190408, 0x4F194408, 0x4F198408, 0x4F19C408, 0x4F1A0408, 0x4F1A4408,
+    0x4F1A8408, 0x4F1AC408, 0x80046FE2, 0x80047022, 0x4F1B0408, 0x4F1B4408, 0x4F1B8408, 0x4F1BC408,
+    0x4F1C0408, 0x80047062, 0x4F1C4408, 0x4F1C8408, 0x4F1CC408, 0x4F1D0408, 0x4F1D4408, 0x4F1D8408,
+    0x4F1DC408, 0x4F1E0408, 0x4F1E4408, 0x4F1E8408, 0x800470A2, 0x4F1EC408, 0x800470E2, 0x80047122,
+    0x4F1F0408, 0x4F1F4408, 0x4F1F8408, 0x80047162, 0x4F1FC408, 0x4F200408, 0x4F204408, 0x4F208408,
+    0x4F20C408, 0x4F210408, 0x4F214408, 0x800471A2, 0x4F218408, 0x800471E2, 0x4F21C408, 0x4F220408,
+    0x4F224408, 0x4F228408, 0x4F22C408, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4F18C402, 0x80047222, 0x4F190402, 0x4F194402, 0x4F198402, 0x4F19C402, 0x4F1A0402, 0x4F1A4402,
+    0x4F1A8402, 0x4F1AC402, 0x80047262, 0x800472A2, 0x4F1B0402, 0x4F1B4402, 0x4F1B8402, 0x4F1BC402,
+    0x4F1C0402, 0x800472E2, 0x4F1C4402, 0x4F1C8402, 0x4F1CC402, 0x4F1D0402, 0x4F1D4402, 0x4F1D8402,
+    0x4F1DC402, 0x4F1E0402, 0x4F1E4402, 0x4F1E8402, 0x80047322, 0x4F1EC402, 0x80047362, 0x800473A2,
+    0x4F1F0402, 0x4F1F4402, 0x4F1F8402, 0x800473E2, 0x4F1FC402, 0x4F200402, 0x4F204402, 0x4F208402,
+    0x4F20C402, 0x4F210402, 0x4F214402, 0x80047422, 0x4F218402, 0x80047462, 0x4F21C402, 0x4F220402,
+    0x4F224402, 0x4F228402, 0x4F22C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x47E64402, 0x47E74402, 0x476E8402, 0x476EC402, 0x476F0402, 0x476F4402,
+    0x4D86C402, 0x4D884402, 0x4D888402, 0x4D88C402, 0x4D890402, 0x4D894402, 0x4D898402, 0x4D89C402,
+    0x4D8A0402, 0x4D8A4402, 0x4D8A8402, 0x4D8AC402, 0x4D8B0402, 0x4D8B4402, 0x4D8B8402, 0x4D8BC402,
+    0x4D8C0402, 0x4D8C4402, 0x4D8C8402, 0x4D8CC402, 0x4D8D0402, 0x4D8D4402, 0x4D8D8402, 0x4D8DC402,
+    0x4D8E0402, 0x4D8E4402, 0x4D8E8402, 0x4D8EC402, 0x4D8F0402, 0x4D870402, 0x4D874402, 0x4D878402,
+    0x4D87C402, 0x4D880402, 0x4D8F4402, 0x4D8F8402, 0x40000662, 0x40000662, 0x40000662, 0x40000662,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402,
+    0x47E84402, 0x47684402, 0x47688402, 0x4768C402, 0x47690402, 0x47694402, 0x47698402, 0x4769C402,
+    0x476A0402, 0x476A4402, 0x476A8402, 0x476AC402, 0x476B0402, 0x476B4402, 0x476B8402, 0x476BC402,
+    0x476C0402, 0x476C4402, 0x476C8402, 0x476CC402, 0x476D0402, 0x476D4402, 0x476D8402, 0x00000000,
+    0x542F8402, 0x542FC402, 0x54300402, 0x54304402, 0x54308402, 0x5430C402, 0x54310402, 0x54314402,
+    0x54318402, 0x5431C402, 0x54320402, 0x54324402, 0x54328402, 0x5432C402, 0x54330402, 0x54334402,
+    0x54338402, 0x5433C402, 0x54340402, 0x54344402, 0x54348402, 0x5434C402, 0x54350402, 0x54354402,
+    0x54358402, 0x5435C402, 0x54360402, 0x54364402, 0x54368402, 0x5436C402, 0x54370402, 0x54374402,
+    0x54378402, 0x54380402, 0x54384402, 0x54388402, 0x5438C402, 0x54390402, 0x54394402, 0x54398402,
+    0x5439C402, 0x543A4402, 0x00000000, 0x40001062, 0x40001042, 0x40888402, 0x00000000, 0x00000000,
+    0x5437C402, 0x543A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x54258402, 0x54258419, 0x5425C402, 0x5425C419, 0x54260402, 0x54264402, 0x54264419, 0x54268402,
+    0x5426C402, 0x54270402, 0x54274402, 0x54278402, 0x5427C402, 0x54280402, 0x54284402, 0x54284419,
+    0x800474A2, 0x54288402, 0x5428C402, 0x800474E2, 0x54290402, 0x54294402, 0x54294419, 0x80047522,
+    0x54298402, 0x5429C402, 0x542A0402, 0x542A0419, 0x80047562, 0x47E64402, 0x47E68402, 0x47E6C402,
+    0x47E70402, 0x47E74402, 0x47918402, 0x4791C402, 0x47920402, 0x47924402, 0x47928402, 0x800475A2,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x542A4402, 0x542A8402, 0x542AC402, 0x542B0402, 0x542B4402, 0x542B8402, 0x542BC402, 0x542C0402,
+    0x542C4402, 0x542C8402, 0x542CC402, 0x542D0402, 0x542D4402, 0x542D8402, 0x542DC402, 0x542E0402,
+    0x542E4402, 0x542E8402, 0x542EC402, 0x542F0402, 0x542F4402, 0x800475E2, 0x40000682, 0x40000682,
+    0x40000662, 0x40000662, 0x40000662, 0x40000682, 0x40000662, 0x40000682, 0x40000682, 0x40000682,
+    0x40000682, 0x47E64402, 0x4792C402, 0x47930402, 0x47934402, 0x40BA4402, 0x40BA8402, 0x40BAC402,
+    0x40BB0402, 0x40BB4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x543A8402, 0x543AC402, 0x543B0402, 0x543B4402, 0x543B8402, 0x543BC402, 0x543C0402, 0x543C4402,
+    0x543C8402, 0x543CC402, 0x543D0402, 0x543D4402, 0x543D8402, 0x543DC402, 0x543E0402, 0x543E4402,
+    0x543E8402, 0x543EC402, 0x543F0402, 0x543F4402, 0x543F8402, 0x47E64402, 0x47E68402, 0x47E6C402,
+    0x47E70402, 0x47938402, 0x4793C402, 0x47940402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x54170402, 0x54174402, 0x54178402, 0x5417C402, 0x54180402, 0x54184402, 0x54188402, 0x5418C402,
+    0x54190402, 0x54194402, 0x54198402, 0x5419C402, 0x541A0402, 0x541A4402, 0x541A8402, 0x541AC402,
+    0x541B0402, 0x541B4402, 0x541B8402, 0x541BC402, 0x541C0402, 0x541C4402, 0x80047622, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001862, 0x40001882, 0x400018A2, 0x4C664402, 0x4C668402, 0x4C5A8402, 0x4C5AC402, 0x4C5B0402,
+    0x4C5B4402, 0x4C5B8402, 0x4C5BC402, 0x4C5C0402, 0x4C5C4402, 0x4C5C8402, 0x4C5CC402, 0x4C5D0402,
+    0x4C5D4402, 0x4C5D8402, 0x4C5DC402, 0x4C5E0402, 0x4C5E4402, 0x4C5E8402, 0x4C5EC402, 0x4C5F0402,
+    0x4C5F4402, 0x4C5F8402, 0x4C5FC402, 0x4C600402, 0x4C604402, 0x4C608402, 0x4C60C402, 0x4C610402,
+    0x4C614402, 0x4C618402, 0x4C61C402, 0x4C620402, 0x4C624402, 0x4C628402, 0x4C62C402, 0x4C630402,
+    0x4C634402, 0x4C638402, 0x4C63C402, 0x4C640402, 0x4C644402, 0x4C648402, 0x4C64C402, 0x4C650402,
+    0x4C654402, 0x4C658402, 0x4C65C402, 0x4C660402, 0x4C66C402, 0x4C670402, 0x4C674402, 0x4C678402,
+    0x4C67C402, 0x4C680402, 0x4C684402, 0x4C688402, 0x4C68C402, 0x4C690402, 0x4C694402, 0x4C698402,
+    0x4C69C402, 0x4C6A0402, 0x4C6A4402, 0x4C6A8402, 0x4C6AC402, 0x4C6B0402, 0x4C6B4402, 0x40AD0402,
+    0x40AD4402, 0x4117C402, 0x41180402, 0x41184402, 0x41188402, 0x4118C402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402,
+    0x47E7C402, 0x47E80402, 0x47E84402, 0x4794C402, 0x47950402, 0x47954402, 0x47958402, 0x4795C402,
+    0x47960402, 0x47964402, 0x47968402, 0x4796C402, 0x47970402, 0x47974402, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4C6B8402,
+    0x40001862, 0x40001882, 0x400018A2, 0x4B51C402, 0x4B520402, 0x4B524402, 0x4B528402, 0x4B52C402,
+    0x4B530402, 0x4B534402, 0x4B538402, 0x4B53C402, 0x4B540402, 0x4B544402, 0x4B548402, 0x4B54C402,
+    0x4B550402, 0x4B554402, 0x4B558402, 0x4B55C402, 0x4B560402, 0x4B564402, 0x4B568402, 0x4B56C402,
+    0x4B570402, 0x4B574402, 0x80047662, 0x4B578402, 0x800476A2, 0x4B57C402, 0x4B580402, 0x4B584402,
+    0x4B588402, 0x4B58C402, 0x4B590402, 0x4B594402, 0x4B598402, 0x4B59C402, 0x4B5A0402, 0x4B5A4402,
+    0x4B5A8402, 0x4B5AC402, 0x4B5B0402, 0x800476E2, 0x4B5B4402, 0x4B5B8402, 0x4B5BC402, 0x4B5C0402,
+    0x4B5C4402, 0x4B5C8402, 0x4B5CC402, 0x4B5D0402, 0x4B5D4402, 0x4B5D8402, 0x4B5DC402, 0x4B5E0402,
+    0x4B5E4402, 0x4B5E8402, 0x40001842, 0x411E8402, 0x411EC402, 0x40000000, 0x40BB8402, 0x40BBC402,
+    0x40AD8402, 0x40ADC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x00000000, 0x00000000,
+    0x53310402, 0x53314402, 0x53318402, 0x5331C402, 0x53320402, 0x53324402, 0x53328402, 0x5332C402,
+    0x53330402, 0x53334402, 0x53338402, 0x5333C402, 0x53340402, 0x53344402, 0x53348402, 0x5334C402,
+    0x53350402, 0x53354402, 0x53358402, 0x5335C402, 0x53360402, 0x53364402, 0x53368402, 0x5336C402,
+    0x53370402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001862, 0x40001882, 0x400018A2, 0x4D8FC402, 0x4D900402, 0x4D904402, 0x4D908402, 0x4D90C402,
+    0x4D910402, 0x4D914402, 0x4D918402, 0x4D91C402, 0x4D920402, 0x4D924402, 0x4D928402, 0x4D92C402,
+    0x4D930402, 0x4D934402, 0x4D938402, 0x4D93C402, 0x4D940402, 0x4D944402, 0x4D948402, 0x4D94C402,
+    0x4D950402, 0x4D954402, 0x4D958402, 0x4D95C402, 0x4D960402, 0x4D964402, 0x4D968402, 0x4D96C402,
+    0x4D970402, 0x4D974402, 0x4D978402, 0x4D97C402, 0x4D984402, 0x4D988402, 0x4D98C402, 0x4D994402,
+    0x4D998402, 0x4D99C402, 0x4D9A0402, 0x4D9A4402, 0x4D9A8402, 0x4D9AC402, 0x4D9B0402, 0x4D9B4402,
+    0x4D9B8402, 0xC000F642, 0xC000F6C2, 0x4D9CC402, 0x4D9D0402, 0x00000000, 0x47E60402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x40BC0402, 0x40AE0402, 0x40AE4402, 0x409E8402, 0x4D990402, 0x4D9C4402, 0x4D9C8402, 0x4D980402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4B5EC402, 0x4B5F0402, 0x4B5F4402, 0x4B5F8402, 0x4B5FC402, 0x4B600402, 0x4B604402, 0x4B608402,
+    0x4B60C402, 0x4B610402, 0x4B614402, 0x4B618402, 0x4B61C402, 0x4B620402, 0x4B624402, 0x4B628402,
+    0x4B62C402, 0x4B630402, 0x4B634402, 0x4B638402, 0x4B63C402, 0x4B640402, 0x4B644402, 0x4B648402,
+    0x4B64C402, 0x4B650402, 0x4B654402, 0x4B658402, 0x4B65C402, 0x4B660402, 0x4B664402, 0x4B668402,
+    0x4B670402, 0x4B674402, 0x4B678402, 0x40001842, 0x411F0402, 0x411F4402, 0x4B66C402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001862, 0x40001882, 0x400018A2, 0x4B684402, 0x4B688402, 0x4B68C402, 0x4B690402, 0x4B694402,
+    0x4B698402, 0x4B69C402, 0x4B6A0402, 0x4B6A4402, 0x4B6A8402, 0x4B6AC402, 0x4B6B0402, 0x4B6B4402,
+    0x4B6B8402, 0x4B6BC402, 0x4B6C0402, 0x4B6C4402, 0x4B6C8402, 0x4B6CC402, 0x4B6D0402, 0x4B6D4402,
+    0x4B6D8402, 0x4B6DC402, 0x4B6E0402, 0x4B6E4402, 0x4B6E8402, 0x4B6EC402, 0x4B6F0402, 0x4B6F4402,
+    0x4B6F8402, 0x4B6FC402, 0x4B700402, 0x4B704402, 0x4B708402, 0x4B70C402, 0x4B710402, 0x4B714402,
+    0x4B718402, 0x4B71C402, 0x4B720402, 0x4B724402, 0x4B728402, 0x4B72C402, 0x4B730402, 0x4B734402,
+    0x4B738402, 0x4B73C402, 0x4B740402, 0x4B754402, 0x4B758402, 0x4B75C402, 0x4B760402, 0x4B764402,
+    0x4B768402, 0x4B76C402, 0x4B770402, 0x4B774402, 0x4B778402, 0x4B780402, 0x4B784402, 0x4B788402,
+    0x4B78C402, 0x4B744402, 0x4B748402, 0x4B74C402, 0x4B67C402, 0x40AE8402, 0x40AEC402, 0x411FC402,
+    0x40BC4402, 0x400018C2, 0x40001842, 0x40001A02, 0x40001A22, 0x411F8402, 0x4B77C402, 0x40001862,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4B680402, 0x41200402, 0x4B750402, 0x41204402, 0x40BC8402, 0x40BCC402,
+    0x00000000, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x479B4402, 0x479B8402, 0x479BC402, 0x479C0402, 0x479C4402, 0x479C8402,
+    0x479CC402, 0x479D0402, 0x479D4402, 0x479D8402, 0x479DC402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4B790402, 0x4B794402, 0x4B798402, 0x4B79C402, 0x4B7A0402, 0x4B7A4402, 0x4B7A8402, 0x4B7AC402,
+    0x4B7B0402, 0x4B7B4402, 0x4B7B8402, 0x4B7BC402, 0x4B7C0402, 0x4B7C4402, 0x4B7C8402, 0x4B7CC402,
+    0x4B7D0402, 0x4B7D4402, 0x00000000, 0x4B7D8402, 0x4B7DC402, 0x4B7E0402, 0x4B7E4402, 0x4B7E8402,
+    0x4B7EC402, 0x4B7F0402, 0x4B7F4402, 0x4B7F8402, 0x4B7FC402, 0x4B800402, 0x4B804402, 0x4B808402,
+    0x4B80C402, 0x4B810402, 0x4B814402, 0x4B818402, 0x4B81C402, 0x4B820402, 0x4B824402, 0x4B828402,
+    0x4B82C402, 0x4B830402, 0x4B834402, 0x4B838402, 0x4B83C402, 0x4B840402, 0x4B844402, 0x4B848402,
+    0x4B84C402, 0x4B850402, 0x4B854402, 0x4B858402, 0x40001882, 0x4B85C402, 0x40001842, 0x40001002,
+    0x40AF0402, 0x40AF4402, 0x41208402, 0x4120C402, 0x41210402, 0x41214402, 0x40001022, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4B944402, 0x4B948402, 0x4B94C402, 0x4B950402, 0x4B95C402, 0x4B960402, 0x4B964402, 0x00000000,
+    0x4B968402, 0x00000000, 0x4B96C402, 0x4B970402, 0x4B974402, 0x4B978402, 0x00000000, 0x4B97C402,
+    0x4B980402, 0x4B984402, 0x4B988402, 0x4B98C402, 0x4B990402, 0x4B994402, 0x4B998402, 0x4B99C402,
+    0x4B9A0402, 0x4B9A4402, 0x4B9A8402, 0x4B9AC402, 0x4B9B0402, 0x4B9B4402, 0x00000000, 0x4B9B8402,
+    0x4B9BC402, 0x4B9C0402, 0x4B9C4402, 0x4B9C8402, 0x4B9CC402, 0x4B954402, 0x4B958402, 0x4B9D0402,
+    0x4B9D4402, 0x40BD0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4B860402, 0x4B864402, 0x4B868402, 0x4B86C402, 0x4B870402, 0x4B874402, 0x4B878402, 0x4B87C402,
+    0x4B880402, 0x4B884402, 0x4B888402, 0x4B88C402, 0x4B890402, 0x4B894402, 0x4B898402, 0x4B89C402,
+    0x4B8A0402, 0x4B8A4402, 0x4B8A8402, 0x4B8AC402, 0x4B8B0402, 0x4B8B4402, 0x4B8B8402, 0x4B8BC402,
+    0x4B8C0402, 0x4B8C4402, 0x4B8C8402, 0x4B8CC402, 0x4B8D0402, 0x4B8D4402, 0x4B8D8402, 0x4B8DC402,
+    0x4B8E0402, 0x4B8E4402, 0x4B8E8402, 0x4B8EC402, 0x4B8F0402, 0x4B8F4402, 0x4B8F8402, 0x4B8FC402,
+    0x4B900402, 0x4B904402, 0x4B908402, 0x4B90C402, 0x4B910402, 0x4B914402, 0x4B918402, 0x40001882,
+    0x4B91C402, 0x4B920402, 0x4B924402, 0x4B928402, 0x4B92C402, 0x4B930402, 0x4B934402, 0x4B938402,
+    0x4B93C402, 0x40001842, 0x4B940402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40001882, 0x40001862, 0x40001882, 0x400018A2, 0x00000000, 0x4B9DC402, 0x4B9E0402, 0x4B9E4402,
+    0x4B9E8402, 0x4B9EC402, 0x4B9F0402, 0x4B9F4402, 0x4B9FC402, 0x00000000, 0x00000000, 0x4BA04402,
+    0x4BA08402, 0x00000000, 0x00000000, 0x4BA0C402, 0x4BA10402, 0x4BA14402, 0x4BA18402, 0x4BA1C402,
+    0x4BA20402, 0x4BA24402, 0x4BA28402, 0x4BA2C402, 0x4BA30402, 0x4BA34402, 0x4BA38402, 0x4BA3C402,
+    0x4BA40402, 0x4BA44402, 0x4BA48402, 0x4BA4C402, 0x4BA50402, 0x4BA54402, 0x4BA58402, 0x4BA5C402,
+    0x4BA60402, 0x00000000, 0x4BA64402, 0x4BA68402, 0x4BA6C402, 0x4BA70402, 0x4BA74402, 0x4BA78402,
+    0x4BA7C402, 0x00000000, 0x4BA80402, 0x4BA84402, 0x00000000, 0x4BA88402, 0x4BA8C402, 0x4BA90402,
+    0x4BA94402, 0x4BA98402, 0x00000000, 0x40001842, 0x40001842, 0x4BA9C402, 0x4BAA8402, 0x4BAAC402,
+    0x4BAB0402, 0x4BAB4402, 0x4BAB8402, 0x4BABC402, 0x4BAC0402, 0x00000000, 0x00000000, 0xC000F743,
+    0x4BAD0402, 0x00000000, 0x00000000, 0x4BAD4402, 0x4BAD8402, 0x4BADC402, 0x00000000, 0x00000000,
+    0x4B9D8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4BAE0402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x4BAE4402, 0x4BAA0402, 0x4BAA4402,
+    0x4B9F8402, 0x4BA00402, 0x4BAC4402, 0x4BAC8402, 0x00000000, 0x00000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4BAF0402, 0x4BAF4402, 0x4BAF8402, 0x4BAFC402, 0x4BB00402, 0x4BB04402, 0x4BB08402, 0x4BB0C402,
+    0x4BB10402, 0x4BB14402, 0x4BB18402, 0x4BB1C402, 0x4BB20402, 0x4BB24402, 0x4BB28402, 0x4BB2C402,
+    0x4BB30402, 0x4BB34402, 0x4BB38402, 0x4BB3C402, 0x4BB40402, 0x4BB44402, 0x4BB48402, 0x4BB4C402,
+    0x4BB50402, 0x4BB54402, 0x4BB58402, 0x4BB5C402, 0x4BB60402, 0x4BB64402, 0x4BB68402, 0x4BB6C402,
+    0x4BB70402, 0x4BB74402, 0x4BB78402, 0x4BB7C402, 0x4BB80402, 0x4BB84402, 0x4BB88402, 0x4BB8C402,
+    0x4BB90402, 0x4BB94402, 0x4BB98402, 0x4BB9C402, 0x4BBA0402, 0x4BBA4402, 0x4BBA8402, 0x4BBAC402,
+    0x4BBB0402, 0x4BBB4402, 0x4BBB8402, 0x4BBBC402, 0x4BBC0402, 0x4BBD8402, 0x4BBDC402, 0x4BBE0402,
+    0x4BBE4402, 0x4BBE8402, 0x4BBEC402, 0x4BBF0402, 0x4BBF4402, 0x4BBF8402, 0x4BBFC402, 0x4BC00402,
+    0x4BC04402, 0x4BC08402, 0x4BC0C402, 0x40001862, 0x40001882, 0x400018A2, 0x40001842, 0x4BBC4402,
+    0x4BBD0402, 0x4BAE8402, 0x4BAEC402, 0x40AF8402, 0x40AFC402, 0x41218402, 0x41220402, 0x41224402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x4121C402, 0x41228402, 0x00000000, 0x4122C402, 0x400018C2, 0x4BBD4402,
+    0x4BBC8402, 0x4BBCC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4BC14402, 0x4BC18402, 0x4BC1C402, 0x4BC20402, 0x4BC24402, 0x4BC28402, 0x4BC2C402, 0x4BC30402,
+    0x4BC34402, 0x4BC38402, 0x4BC3C402, 0x4BC40402, 0x4BC44402, 0x4BC48402, 0x4BC4C402, 0x4BC50402,
+    0x4BC54402, 0x4BC58402, 0x4BC5C402, 0x4BC60402, 0x4BC64402, 0x4BC68402, 0x4BC6C402, 0x4BC70402,
+    0x4BC74402, 0x4BC78402, 0x4BC7C402, 0x4BC80402, 0x4BC84402, 0x4BC88402, 0x4BC8C402, 0x4BC90402,
+    0x4BC94402, 0x4BC98402, 0x4BC9C402, 0x4BCA0402, 0x4BCA4402, 0x4BCA8402, 0x4BCAC402, 0x4BCB0402,
+    0x4BCB4402, 0x4BCB8402, 0x4BCBC402, 0x4BCC0402, 0x4BCC4402, 0x4BCC8402, 0x4BCCC402, 0x4BCD0402,
+    0x4BCDC402, 0x4BCE0402, 0x4BCE4402, 0x4BCE8402, 0x4BCEC402, 0x4BCF0402, 0x4BCF4402, 0x4BCF8402,
+    0x4BCFC402, 0xC000F804, 0x4BD04402, 0x4BD08402, 0x4BD0C402, 0x4BD10402, 0x4BD14402, 0x40001862,
+    0x40001882, 0x400018A2, 0x4BD18402, 0x40001842, 0x4BCD4402, 0x4BCD8402, 0x41230402, 0x4BC10402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4BD1C402, 0x4BD20402, 0x4BD24402, 0x4BD28402, 0x4BD2C402, 0x4BD30402, 0x4BD34402, 0x4BD38402,
+    0x4BD3C402, 0x4BD40402, 0x4BD44402, 0x4BD48402, 0x4BD4C402, 0x4BD50402, 0x4BD54402, 0x4BD58402,
+    0x4BD5C402, 0x4BD60402, 0x4BD64402, 0x4BD68402, 0x4BD6C402, 0x4BD70402, 0x4BD74402, 0x4BD78402,
+    0x4BD7C402, 0x4BD80402, 0x4BD84402, 0x4BD88402, 0x4BD8C402, 0x4BD90402, 0x4BD94402, 0x4BD98402,
+    0x4BD9C402, 0x4BDA0402, 0x4BDA4402, 0x4BDA8402, 0x4BDAC402, 0x4BDB0402, 0x4BDB4402, 0x4BDB8402,
+    0x4BDBC402, 0x4BDC0402, 0x4BDC4402, 0x4BDC8402, 0x4BDCC402, 0x4BDD0402, 0x4BDD4402, 0x4BDD8402,
+    0x4BDDC402, 0x4BDE0402, 0x4BDE4402, 0x4BDE8402, 0x4BDEC402, 0x4BDF0402, 0x00000000, 0x00000000,
+    0xC000F902, 0xC000F982, 0x4BDFC402, 0x4BE00402, 0x40001862, 0x40001882, 0x400018A2, 0x4BE04402,
+    0x40001842, 0x41234402, 0x40B00402, 0x40B04402, 0x41238402, 0x4123C402, 0x41240402, 0x41244402,
+    0x41248402, 0x4124C402, 0x41250402, 0x41254402, 0x41258402, 0x4125C402, 0x41260402, 0x41264402,
+    0x41268402, 0x4126C402, 0x41270402, 0x41274402, 0x41278402, 0x4127C402, 0x41280402, 0x41284402,
+    0x80047722, 0x80047762, 0x800477A2, 0x800477E2, 0x80047822, 0x80047862, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4BE08402, 0x4BE0C402, 0x4BE10402, 0x4BE14402, 0x4BE18402, 0x4BE1C402, 0x4BE20402, 0x4BE24402,
+    0x4BE28402, 0x4BE2C402, 0x4BE30402, 0x4BE34402, 0x4BE38402, 0x4BE3C402, 0x4BE40402, 0x4BE44402,
+    0x4BE48402, 0x4BE4C402, 0x4BE50402, 0x4BE54402, 0x4BE58402, 0x4BE5C402, 0x4BE60402, 0x4BE64402,
+    0x4BE68402, 0x4BE6C402, 0x4BE70402, 0x4BE74402, 0x4BE78402, 0x4BE7C402, 0x4BE80402, 0x4BE84402,
+    0x4BE88402, 0x4BE8C402, 0x4BE90402, 0x4BE94402, 0x4BE98402, 0x4BE9C402, 0x4BEA0402, 0x4BEA4402,
+    0x4BEA8402, 0x4BEAC402, 0x4BEB0402, 0x4BEB4402, 0x4BEB8402, 0x4BEBC402, 0x4BEC0402, 0x4BEC4402,
+    0x4BEC8402, 0x4BECC402, 0x4BED0402, 0x4BED4402, 0x4BED8402, 0x4BEDC402, 0x4BEE0402, 0x4BEE4402,
+    0x4BEE8402, 0x4BEEC402, 0x4BEF0402, 0x4BEF4402, 0x4BEF8402, 0x40001882, 0x400018A2, 0x4BEFC402,
+    0x40001862, 0x40B08402, 0x40B0C402, 0x41288402, 0x4BF00402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40FCC402, 0x40FD0402, 0x40FD4402, 0x40FD8402, 0x40FDC402, 0x40FE0402, 0x40FE4402, 0x40FE8402,
+    0x40FEC402, 0x40FF0402, 0x40FF4402, 0x40FF8402, 0x40FFC402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4BF04402, 0x4BF08402, 0x4BF0C402, 0x4BF10402, 0x4BF14402, 0x4BF18402, 0x4BF1C402, 0x4BF20402,
+    0x4BF24402, 0x4BF28402, 0x4BF38402, 0x4BF3C402, 0x4BF44402, 0x4BF48402, 0x4BF4C402, 0x4BF50402,
+    0x4BF54402, 0x4BF58402, 0x4BF5C402, 0x4BF60402, 0x4BF64402, 0x4BF68402, 0x4BF6C402, 0x4BF70402,
+    0x4BF74402, 0x4BF78402, 0x4BF7C402, 0x4BF80402, 0x4BF84402, 0x4BF88402, 0x4BF8C402, 0x4BF90402,
+    0x4BF94402, 0x4BF98402, 0x4BF9C402, 0x4BFA0402, 0x4BFA4402, 0x4BFA8402, 0x4BFAC402, 0x4BF30402,
+    0x4BF2C402, 0x4BF34402, 0x4BFB0402, 0x40001882, 0x400018A2, 0x4BFB4402, 0x4BFB8402, 0x4BFBC402,
+    0x4BFC0402, 0x4BFC4402, 0x4BFC8402, 0x4BFCC402, 0x4BFD0402, 0x4BFD4402, 0x4BFD8402, 0x40001842,
+    0x4BF40402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4C294402, 0x4C298402, 0x4C29C402, 0x4C2A0402, 0x4C2A4402, 0x800478A2, 0x4C2A8402, 0x4C2AC402,
+    0x4C2B0402, 0x4C2B4402, 0x4C2B8402, 0x4C2BC402, 0x4C2C0402, 0x4C2C4402, 0x4C2C8402, 0x4C2CC402,
+    0x4C2D0402, 0x4C2D4402, 0x4C2D8402, 0x4C2DC402, 0x4C2E0402, 0x4C2E4402, 0x800478E2, 0x4C2E8402,
+    0x4C2EC402, 0x4C2F0402, 0x80047922, 0x00000000, 0x00000000, 0x4C324402, 0x4C328402, 0x4C32C402,
+    0x4C2F4402, 0x4C2F8402, 0x4C2FC402, 0x4C300402, 0x4C304402, 0x4C308402, 0x4C30C402, 0x4C310402,
+    0x4C314402, 0x4C318402, 0x4C31C402, 0x4C320402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47944402, 0x47948402, 0x40B10402, 0x40B14402, 0x40BD4402, 0x41678402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4C1B4402, 0x4C1B8402, 0x4C1BC402, 0x4C1C0402, 0x4C1C4402, 0x4C1C8402, 0x4C1CC402, 0x4C1D0402,
+    0x4C1D4402, 0x4C1D8402, 0x4C1DC402, 0x4C1E0402, 0x4C1E4402, 0x4C1E8402, 0x4C1EC402, 0x4C1F0402,
+    0x4C1F4402, 0x4C1F8402, 0x4C1FC402, 0x4C200402, 0x4C204402, 0x4C208402, 0x4C20C402, 0x4C210402,
+    0x4C214402, 0x4C218402, 0x4C21C402, 0x4C220402, 0x4C224402, 0x4C228402, 0x4C22C402, 0x4C230402,
+    0x4C234402, 0x4C238402, 0x4C23C402, 0x4C240402, 0x4C244402, 0x4C248402, 0x4C24C402, 0x4C250402,
+    0x4C254402, 0x4C258402, 0x4C25C402, 0x4C260402, 0x4C264402, 0x4C268402, 0x4C26C402, 0x4C270402,
+    0x4C274402, 0x4C278402, 0x4C27C402, 0x4C280402, 0x4C284402, 0x4C288402, 0x4C28C402, 0x40001882,
+    0x400018A2, 0x4C290402, 0x40001842, 0x4128C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x526BC408, 0x526C0408, 0x526C4408, 0x526C8408, 0x526CC408, 0x526D0408, 0x526D4408, 0x526D8408,
+    0x526DC408, 0x526E0408, 0x526E4408, 0x526E8408, 0x526EC408, 0x526F0408, 0x526F4408, 0x526F8408,
+    0x526FC408, 0x52700408, 0x52704408, 0x52708408, 0x5270C408, 0x52710408, 0x52714408, 0x52718408,
+    0x5271C408, 0x52720408, 0x52724408, 0x52728408, 0x5272C408, 0x52730408, 0x52734408, 0x52738408,
+    0x526BC402, 0x526C0402, 0x526C4402, 0x526C8402, 0x526CC402, 0x526D0402, 0x526D4402, 0x526D8402,
+    0x526DC402, 0x526E0402, 0x526E4402, 0x526E8402, 0x526EC402, 0x526F0402, 0x526F4402, 0x526F8402,
+    0x526FC402, 0x52700402, 0x52704402, 0x52708402, 0x5270C402, 0x52710402, 0x52714402, 0x52718402,
+    0x5271C402, 0x52720402, 0x52724402, 0x52728402, 0x5272C402, 0x52730402, 0x52734402, 0x52738402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x479E0402, 0x479E4402, 0x479E8402, 0x479EC402, 0x479F0402, 0x479F4402,
+    0x479F8402, 0x479FC402, 0x47A00402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x526B8402,
+    0x4BFDC402, 0x4BFE0402, 0x4BFE4402, 0x4BFE8402, 0x4BFEC402, 0x4BFF0402, 0x4BFF4402, 0x00000000,
+    0x00000000, 0x4BFF8402, 0x00000000, 0x00000000, 0x4BFFC402, 0x4C000402, 0x4C004402, 0x4C008402,
+    0x4C00C402, 0x4C014402, 0x4C018402, 0x4C01C402, 0x00000000, 0x4C020402, 0x4C024402, 0x00000000,
+    0x4C028402, 0x4C02C402, 0x4C030402, 0x4C034402, 0x4C038402, 0x4C03C402, 0x4C040402, 0x4C044402,
+    0x4C048402, 0x4C04C402, 0x4C050402, 0x4C054402, 0x4C058402, 0x4C05C402, 0x4C064402, 0x4C06C402,
+    0x4C074402, 0x4C078402, 0x4C07C402, 0x4C080402, 0x4C084402, 0x4C088402, 0x4C08C402, 0x4C090402,
+    0x4C094402, 0x4C098402, 0x4C09C402, 0x4C0A0402, 0x4C0A4402, 0xC000FA02, 0x00000000, 0x4C0AC402,
+    0x4C0B0402, 0x00000000, 0x00000000, 0x40001882, 0x40001862, 0x4C0B4402, 0x4C0B8402, 0x4C010402,
+    0x4C060402, 0x4C068402, 0x4C070402, 0x40001842, 0x40B18402, 0x41290402, 0x40BD8402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4C0BC402, 0x4C0C0402, 0x4C0C4402, 0x4C0C8402, 0x4C0CC402, 0x4C0D0402, 0x4C0D4402, 0x4C0D8402,
+    0x00000000, 0x00000000, 0x4C0DC402, 0x4C0E0402, 0x4C0E4402, 0x4C0E8402, 0x4C0EC402, 0x4C0F0402,
+    0x4C0F4402, 0x4C0F8402, 0x4C0FC402, 0x4C100402, 0x4C104402, 0x4C108402, 0x4C10C402, 0x4C110402,
+    0x4C114402, 0x4C118402, 0x4C11C402, 0x4C120402, 0x4C124402, 0x4C128402, 0x4C12C402, 0x4C130402,
+    0x4C134402, 0x4C138402, 0x4C13C402, 0x4C140402, 0x4C144402, 0x4C148402, 0x4C14C402, 0x4C150402,
+    0x4C154402, 0x4C158402, 0x4C15C402, 0x4C160402, 0x4C164402, 0x4C168402, 0x4C16C402, 0x4C170402,
+    0x4C174402, 0x4C180402, 0x4C184402, 0x4C188402, 0x4C18C402, 0x4C190402, 0x4C194402, 0x4C198402,
+    0x00000000, 0x00000000, 0x4C19C402, 0x4C1A4402, 0x4C1A8402, 0x4C1AC402, 0x40001882, 0x400018A2,
+    0x4C1B0402, 0x4C178402, 0x41294402, 0x4C17C402, 0x4C1A0402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4CD84402, 0x4CD88402, 0x4CD8C402, 0x4CD90402, 0x4CD94402, 0x4CD98402, 0x4CD9C402, 0x4CDA0402,
+    0x4CDA4402, 0x4CDA8402, 0x4CDAC402, 0x4CCE4402, 0x4CCEC402, 0x4CCF0402, 0x4CCF4402, 0x4CCF8402,
+    0x4CCFC402, 0x4CD00402, 0x4CD04402, 0x4CD08402, 0x4CD0C402, 0x4CD10402, 0x4CD14402, 0x4CD18402,
+    0x4CD1C402, 0x4CD20402, 0x4CD24402, 0x4CD28402, 0x4CD2C402, 0x4CD30402, 0x4CD34402, 0x4CD38402,
+    0x4CD3C402, 0x4CD40402, 0x4CD44402, 0x4CD48402, 0x4CD4C402, 0x4CD50402, 0x4CD54402, 0x4CD58402,
+    0x4CD5C402, 0x4CD60402, 0x4CD64402, 0x4CD68402, 0x4CD6C402, 0x4CD70402, 0x4CD74402, 0x4CD78402,
+    0x4CD7C402, 0x4CD80402, 0x4CCE8402, 0x40001842, 0x4CDB0402, 0x40001862, 0x40001862, 0x40001862,
+    0x40001882, 0x400018A2, 0x4CD68417, 0x4CD64419, 0x4CD68419, 0x4CD6C419, 0x4CD70419, 0x41098402,
+    0x4109C402, 0x410A0402, 0x410A4402, 0x410A8402, 0x410AC402, 0x410B0402, 0x410B4402, 0x4CDB4402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4CDB8402, 0x4CDBC402, 0x4CDC0402, 0x4CDC4402, 0x4CDD0402, 0x4CDD8402, 0x4CDD4402, 0x4CDDC402,
+    0x4CDE0402, 0x4CDC8402, 0x4CDCC402, 0x4CDE4402, 0x4CDE8402, 0x4CDF0402, 0x4CDF4402, 0x4CDF8402,
+    0x4CDFC402, 0x4CE00402, 0x4CE04402, 0x4CE08402, 0x4CE0C402, 0x4CE10402, 0x4CE14402, 0x4CE18402,
+    0x4CE1C402, 0x4CE20402, 0x4CE24402, 0x4CE28402, 0x4CE2C402, 0x4CE30402, 0x4CE34402, 0x4CE38402,
+    0x4CE3C402, 0x4CE40402, 0x4CE44402, 0x4CE48402, 0x4CE4C402, 0x4CE50402, 0x4CE54402, 0x4CE58402,
+    0x4CE5C402, 0x4CE60402, 0x4CE64402, 0x4CE68402, 0x4CE6C402, 0x4CE70402, 0x4CE74402, 0x4CE78402,
+    0x4CE7C402, 0x4CE80402, 0x4CE84402, 0x4CDEC402, 0x4CE88402, 0x4CE8C402, 0x4CE6C417, 0x4CE70417,
+    0x4CE78417, 0x4CE80417, 0x4CDE8419, 0x4CDF0419, 0x4CDFC419, 0x4CE28419, 0x4CE38419, 0x4CE3C419,
+    0x4CE4C419, 0x4CE6C419, 0x4CE70419, 0x4CE78419, 0x4CE80419, 0x4CE64419, 0x40001882, 0x400018A2,
+    0x40001A42, 0x4CE90402, 0x410B8402, 0x410BC402, 0x410C0402, 0x4CE94402, 0x410C4402, 0x410C8402,
+    0x410CC402, 0x410D0402, 0x410D4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52758402, 0x5275C402, 0x52760402, 0x52764402, 0x52768402, 0x5276C402, 0x52770402, 0x52774402,
+    0x52778402, 0x5277C402, 0x52780402, 0x52784402, 0x52788402, 0x5278C402, 0x52790402, 0x52794402,
+    0x52798402, 0x5279C402, 0x527A0402, 0x527A4402, 0x527A8402, 0x5273C402, 0x52740402, 0x52744402,
+    0x52748402, 0x5274C402, 0x52750402, 0x52754402, 0x527AC402, 0x527B0402, 0x527C8402, 0x527B4402,
+    0x527B8402, 0x527BC402, 0x527C0402, 0x527C4402, 0x527CC402, 0x527E4402, 0x527DC402, 0x52814402,
+    0x527E8402, 0x527E0402, 0x52818402, 0x52804402, 0x527FC402, 0x52808402, 0x52800402, 0x527D0402,
+    0x5281C402, 0x527D8402, 0x527D4402, 0x527F4402, 0x527EC402, 0x5280C402, 0x527F8402, 0x527F0402,
+    0x52810402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4C76C402, 0x4C770402, 0x4C774402, 0x4C778402, 0x4C77C402, 0x4C780402, 0x4C784402, 0x4C788402,
+    0x4C78C402, 0x00000000, 0x4C790402, 0x4C794402, 0x4C798402, 0x4C79C402, 0x4C7A0402, 0x4C7A4402,
+    0x4C7A8402, 0x4C7AC402, 0x4C7B0402, 0x4C7B4402, 0x4C7B8402, 0x4C7BC402, 0x4C7C0402, 0x4C7C4402,
+    0x4C7C8402, 0x4C7CC402, 0x4C7D0402, 0x4C7D4402, 0x4C7D8402, 0x4C7DC402, 0x4C7E0402, 0x4C7E4402,
+    0x4C7E8402, 0x4C7EC402, 0x4C7F0402, 0x4C7F4402, 0x4C7F8402, 0x4C7FC402, 0x4C800402, 0x4C804402,
+    0x4C808402, 0x4C80C402, 0x4C810402, 0x4C814402, 0x4C818402, 0x4C81C402, 0x4C820402, 0x4C828402,
+    0x4C82C402, 0x4C830402, 0x4C834402, 0x4C838402, 0x4C83C402, 0x4C840402, 0x4C844402, 0x00000000,
+    0x4C848402, 0x4C84C402, 0x4C850402, 0x4C854402, 0x40001862, 0x40001882, 0x400018A2, 0x4C858402,
+    0x4C824402, 0x40B1C402, 0x40B20402, 0x411AC402, 0x411B0402, 0x411B4402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402,
+    0x47E7C402, 0x47E80402, 0x47E84402, 0x4798C402, 0x47990402, 0x47994402, 0x47998402, 0x4799C402,
+    0x479A0402, 0x479A4402, 0x479A8402, 0x479AC402, 0x479B0402, 0x00000000, 0x00000000, 0x00000000,
+    0x410D8402, 0x410DC402, 0x4CE98402, 0x4CEA0402, 0x4CEA8402, 0x4CEB0402, 0x4CEB8402, 0x4CEC0402,
+    0x4CEC8402, 0x4CED0402, 0x4CED8402, 0x4CEE0402, 0x4CEE8402, 0x4CEF0402, 0x4CEF8402, 0x4CF00402,
+    0x4CF08402, 0x4CF10402, 0x4CF18402, 0x4CF20402, 0x4CF28402, 0x4CF30402, 0x4CF38402, 0x4CF40402,
+    0x4CF48402, 0x4CF4C402, 0x4CF54402, 0x4CF5C402, 0x4CF64402, 0x4CF6C402, 0x4CF74402, 0x4CF7C402,
+    0x00000000, 0x00000000, 0x4CE9C402, 0x4CEA4402, 0x4CEAC402, 0x4CEB4402, 0x4CEBC402, 0x4CEC4402,
+    0x4CECC402, 0x4CED4402, 0x4CEDC402, 0x4CEE4402, 0x4CEEC402, 0x4CEF4402, 0x4CEFC402, 0x4CF04402,
+    0x4CF0C402, 0x4CF14402, 0x4CF1C402, 0x4CF24402, 0x4CF2C402, 0x4CF34402, 0x4CF3C402, 0x4CF44402,
+    0x00000000, 0x4CF50402, 0x4CF58402, 0x4CF60402, 0x4CF68402, 0x4CF70402, 0x4CF78402, 0x4CF80402,
+    0x4CF84402, 0x4CF88402, 0x4CF8C402, 0x4CF90402, 0x4CF94402, 0x40001882, 0x40001862, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4C330402, 0x4C334402, 0x4C338402, 0x4C33C402, 0x4C340402, 0x4C344402, 0x4C348402, 0x00000000,
+    0x4C34C402, 0x4C350402, 0x00000000, 0x4C354402, 0x4C358402, 0x4C35C402, 0x4C360402, 0x4C364402,
+    0x4C368402, 0x4C36C402, 0x4C370402, 0x4C374402, 0x4C378402, 0x4C37C402, 0x4C380402, 0x4C384402,
+    0x4C388402, 0x4C38C402, 0x4C390402, 0x4C394402, 0x4C398402, 0x4C39C402, 0x4C3A0402, 0x4C3A4402,
+    0x4C3A8402, 0x4C3AC402, 0x4C3B0402, 0x4C3B4402, 0x4C3B8402, 0x4C3BC402, 0x4C3C0402, 0x4C3C4402,
+    0x4C3C8402, 0x4C3CC402, 0x4C3D0402, 0x4C3D4402, 0x4C3D8402, 0x4C3DC402, 0x4C3E0402, 0x4C3E4402,
+    0x4C3E8402, 0x4C3EC402, 0x4C3F0402, 0x4C3F4402, 0x4C3F8402, 0x4C3FC402, 0x4C400402, 0x00000000,
+    0x00000000, 0x00000000, 0x4C404402, 0x00000000, 0x4C408402, 0x4C40C402, 0x00000000, 0x4C410402,
+    0x40001882, 0x400018A2, 0x40001842, 0x40001862, 0x4C414402, 0x4C418402, 0x4C3C0417, 0x4C3C0419,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4C420402, 0x4C424402, 0x4C428402, 0x4C42C402, 0x4C430402, 0x4C434402, 0x00000000, 0x4C438402,
+    0x4C43C402, 0x00000000, 0x4C440402, 0x4C444402, 0x4C448402, 0x4C44C402, 0x4C450402, 0x4C454402,
+    0x4C458402, 0x4C45C402, 0x4C460402, 0x4C464402, 0x4C468402, 0x4C46C402, 0x4C470402, 0x4C474402,
+    0x4C478402, 0x4C47C402, 0x4C480402, 0x4C484402, 0x4C488402, 0x4C48C402, 0x4C490402, 0x4C494402,
+    0x4C498402, 0x4C49C402, 0x4C4A0402, 0x4C4A4402, 0x4C4A8402, 0x4C4AC402, 0x4C4B0402, 0x4C4B4402,
+    0x4C4B8402, 0x4C4BC402, 0x4C4C0402, 0x4C4C4402, 0x4C4C8402, 0x4C4CC402, 0x4C4D0402, 0x00000000,
+    0x4C4D4402, 0x4C4D8402, 0x00000000, 0x4C4DC402, 0x4C4E0402, 0x40001882, 0x400018A2, 0x4C4E4402,
+    0x4C41C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4D3C4402, 0x4D3C8402, 0x4D3CC402, 0x4D3D0402, 0x4D3D4402, 0x4D3D8402, 0x4D3DC402, 0x4D3E0402,
+    0x4D3E4402, 0x4D3E8402, 0x4D3EC402, 0x4D3F0402, 0x4D3F4402, 0x4D3F8402, 0x4D3FC402, 0x4D400402,
+    0x4D404402, 0x4D408402, 0x4D40C402, 0x4D410402, 0x4D414402, 0x4D418402, 0x4D41C402, 0x40BDC402,
+    0x40BE0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52448402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x475AC402, 0x475B0402, 0x475B4402, 0x475B8402, 0x475BC402, 0x475C0402, 0x475C4402, 0x475C8402,
+    0x475CC402, 0x475D0402, 0x475D4402, 0x475D8402, 0x475DC402, 0x475E0402, 0x475E4402, 0x475E8402,
+    0x475EC402, 0x475F0402, 0x475F4402, 0x475F8402, 0x475FC402, 0x41540402, 0x41544402, 0x41548402,
+    0x4154C402, 0x41550402, 0x41554402, 0x41558402, 0x4155C402, 0x47DC4402, 0x47DC8402, 0x47DCC402,
+    0x47DD0402, 0x41560402, 0x41564402, 0x41568402, 0x4156C402, 0x41570402, 0x41574402, 0x41578402,
+    0x4157C402, 0x41580402, 0x41584402, 0x41588402, 0x4158C402, 0x41590402, 0x41594402, 0x41598402,
+    0x4159C402, 0x415A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x41298402,
+    0x54524402, 0x54528402, 0x5452C402, 0x54530402, 0x54534402, 0x54538402, 0x5453C402, 0x54540402,
+    0x54544402, 0x54548402, 0x5454C402, 0x54550402, 0x54554402, 0x54558402, 0x5455C402, 0x54560402,
+    0x54564402, 0x54568402, 0x5456C402, 0x54570402, 0x54574402, 0x54578402, 0x5457C402, 0x54580402,
+    0x54584402, 0x54588402, 0x5458C402, 0x54590402, 0x54594402, 0x54598402, 0x5459C402, 0x545A0402,
+    0x545A4402, 0x545A8402, 0x545AC402, 0x545B0402, 0x545B4402, 0x545B8402, 0x545BC402, 0x545C0402,
+    0x545C4402, 0x545C8402, 0x545CC402, 0x545D0402, 0x545D4402, 0x545D8402, 0x545DC402, 0x545E0402,
+    0x545E4402, 0x545E8402, 0x545EC402, 0x545F0402, 0x545F4402, 0x545F8402, 0x545FC402, 0x54600402,
+    0x54604402, 0x54608402, 0x5460C402, 0x54610402, 0x54614402, 0x54618402, 0x5461C402, 0x54620402,
+    0x54624402, 0x54628402, 0x5462C402, 0x54630402, 0x54634402, 0x54638402, 0x5463C402, 0x54640402,
+    0x54644402, 0x54648402, 0x5464C402, 0x54650402, 0x54654402, 0x54658402, 0x5465C402, 0x54660402,
+    0x54664402, 0x54668402, 0x5466C402, 0x54670402, 0x54674402, 0x54678402, 0x5467C402, 0x54680402,
+    0x54684402, 0x54688402, 0x5468C402, 0x54690402, 0x54694402, 0x54698402, 0x5469C402, 0x546A0402,
+    0x546A4402, 0x546A8402, 0x546AC402, 0x546B0402, 0x546B4402, 0x546B8402, 0x546BC402, 0x546C0402,
+    0x546C4402, 0x546C8402, 0x546CC402, 0x546D0402, 0x546D4402, 0x546D8402, 0x546DC402, 0x546E0402,
+    0x546E4402, 0x546E8402, 0x546EC402, 0x546F0402, 0x546F4402, 0x546F8402, 0x546FC402, 0x54700402,
+    0x54704402, 0x54708402, 0x5470C402, 0x54710402, 0x54714402, 0x54718402, 0x5471C402, 0x54720402,
+    0x54724402, 0x54728402, 0x5472C402, 0x54730402, 0x54734402, 0x54738402, 0x5473C402, 0x54740402,
+    0x54744402, 0x54748402, 0x5474C402, 0x54750402, 0x54754402, 0x54758402, 0x5475C402, 0x54760402,
+    0x54764402, 0x54768402, 0x5476C402, 0x54770402, 0x54774402, 0x54778402, 0x5477C402, 0x54780402,
+    0x54784402, 0x54788402, 0x5478C402, 0x54790402, 0x54794402, 0x54798402, 0x5479C402, 0x547A0402,
+    0x547A4402, 0x547A8402, 0x547AC402, 0x547B0402, 0x547B4402, 0x547B8402, 0x547BC402, 0x547C0402,
+    0x547C4402, 0x547C8402, 0x547CC402, 0x547D0402, 0x547D4402, 0x547D8402, 0x547DC402, 0x547E0402,
+    0x547E4402, 0x547E8402, 0x547EC402, 0x547F0402, 0x547F4402, 0x547F8402, 0x547FC402, 0x54800402,
+    0x54804402, 0x54808402, 0x5480C402, 0x54810402, 0x54814402, 0x54818402, 0x5481C402, 0x54820402,
+    0x54824402, 0x54828402, 0x5482C402, 0x54830402, 0x54834402, 0x54838402, 0x5483C402, 0x54840402,
+    0x54844402, 0x54848402, 0x5484C402, 0x54850402, 0x54854402, 0x54858402, 0x5485C402, 0x54860402,
+    0x54864402, 0x54868402, 0x5486C402, 0x54870402, 0x54874402, 0x54878402, 0x5487C402, 0x54880402,
+    0x54884402, 0x54888402, 0x5488C402, 0x54890402, 0x54894402, 0x54898402, 0x5489C402, 0x548A0402,
+    0x548A4402, 0x548A8402, 0x548AC402, 0x548B0402, 0x548B4402, 0x548B8402, 0x548BC402, 0x548C0402,
+    0x548C4402, 0x548C8402, 0x548CC402, 0x548D0402, 0x548D4402, 0x548D8402, 0x548DC402, 0x548E0402,
+    0x548E4402, 0x548E8402, 0x548EC402, 0x548F0402, 0x548F4402, 0x548F8402, 0x548FC402, 0x54900402,
+    0x54904402, 0x54908402, 0x5490C402, 0x54910402, 0x54914402, 0x54918402, 0x5491C402, 0x54920402,
+    0x54924402, 0x54928402, 0x5492C402, 0x54930402, 0x54934402, 0x54938402, 0x5493C402, 0x54940402,
+    0x54944402, 0x54948402, 0x5494C402, 0x54950402, 0x54954402, 0x54958402, 0x5495C402, 0x54960402,
+    0x54964402, 0x54968402, 0x5496C402, 0x54970402, 0x54974402, 0x54978402, 0x5497C402, 0x54980402,
+    0x54984402, 0x54988402, 0x5498C402, 0x54990402, 0x54994402, 0x54998402, 0x5499C402, 0x549A0402,
+    0x549A4402, 0x549A8402, 0x549AC402, 0x549B0402, 0x549B4402, 0x549B8402, 0x549BC402, 0x549C0402,
+    0x549C4402, 0x549C8402, 0x549CC402, 0x549D0402, 0x549D4402, 0x549D8402, 0x549DC402, 0x549E0402,
+    0x549E4402, 0x549E8402, 0x549EC402, 0x549F0402, 0x549F4402, 0x549F8402, 0x549FC402, 0x54A00402,
+    0x54A04402, 0x54A08402, 0x54A0C402, 0x54A10402, 0x54A14402, 0x54A18402, 0x54A1C402, 0x54A20402,
+    0x54A24402, 0x54A28402, 0x54A2C402, 0x54A30402, 0x54A34402, 0x54A38402, 0x54A3C402, 0x54A40402,
+    0x54A44402, 0x54A48402, 0x54A4C402, 0x54A50402, 0x54A54402, 0x54A58402, 0x54A5C402, 0x54A60402,
+    0x54A64402, 0x54A68402, 0x54A6C402, 0x54A70402, 0x54A74402, 0x54A78402, 0x54A7C402, 0x54A80402,
+    0x54A84402, 0x54A88402, 0x54A8C402, 0x54A90402, 0x54A94402, 0x54A98402, 0x54A9C402, 0x54AA0402,
+    0x54AA4402, 0x54AA8402, 0x54AAC402, 0x54AB0402, 0x54AB4402, 0x54AB8402, 0x54ABC402, 0x54AC0402,
+    0x54AC4402, 0x54AC8402, 0x54ACC402, 0x54AD0402, 0x54AD4402, 0x54AD8402, 0x54ADC402, 0x54AE0402,
+    0x54AE4402, 0x54AE8402, 0x54AEC402, 0x54AF0402, 0x54AF4402, 0x54AF8402, 0x54AFC402, 0x54B00402,
+    0x54B04402, 0x54B08402, 0x54B0C402, 0x54B10402, 0x54B14402, 0x54B18402, 0x54B1C402, 0x54B20402,
+    0x54B24402, 0x54B28402, 0x54B2C402, 0x54B30402, 0x54B34402, 0x54B38402, 0x54B3C402, 0x54B40402,
+    0x54B44402, 0x54B48402, 0x54B4C402, 0x54B50402, 0x54B54402, 0x54B58402, 0x54B5C402, 0x54B60402,
+    0x54B64402, 0x54B68402, 0x54B6C402, 0x54B70402, 0x54B74402, 0x54B78402, 0x54B7C402, 0x54B80402,
+    0x54B84402, 0x54B88402, 0x54B8C402, 0x54B90402, 0x54B94402, 0x54B98402, 0x54B9C402, 0x54BA0402,
+    0x54BA4402, 0x54BA8402, 0x54BAC402, 0x54BB0402, 0x54BB4402, 0x54BB8402, 0x54BBC402, 0x54BC0402,
+    0x54BC4402, 0x54BC8402, 0x54BCC402, 0x54BD0402, 0x54BD4402, 0x54BD8402, 0x54BDC402, 0x54BE0402,
+    0x54BE4402, 0x54BE8402, 0x54BEC402, 0x54BF0402, 0x54BF4402, 0x54BF8402, 0x54BFC402, 0x54C00402,
+    0x54C04402, 0x54C08402, 0x54C0C402, 0x54C10402, 0x54C14402, 0x54C18402, 0x54C1C402, 0x54C20402,
+    0x54C24402, 0x54C28402, 0x54C2C402, 0x54C30402, 0x54C34402, 0x54C38402, 0x54C3C402, 0x54C40402,
+    0x54C44402, 0x54C48402, 0x54C4C402, 0x54C50402, 0x54C54402, 0x54C58402, 0x54C5C402, 0x54C60402,
+    0x54C64402, 0x54C68402, 0x54C6C402, 0x54C70402, 0x54C74402, 0x54C78402, 0x54C7C402, 0x54C80402,
+    0x54C84402, 0x54C88402, 0x54C8C402, 0x54C90402, 0x54C94402, 0x54C98402, 0x54C9C402, 0x54CA0402,
+    0x54CA4402, 0x54CA8402, 0x54CAC402, 0x54CB0402, 0x54CB4402, 0x54CB8402, 0x54CBC402, 0x54CC0402,
+    0x54CC4402, 0x54CC8402, 0x54CCC402, 0x54CD0402, 0x54CD4402, 0x54CD8402, 0x54CDC402, 0x54CE0402,
+    0x54CE4402, 0x54CE8402, 0x54CEC402, 0x54CF0402, 0x54CF4402, 0x54CF8402, 0x54CFC402, 0x54D00402,
+    0x54D04402, 0x54D08402, 0x54D0C402, 0x54D10402, 0x54D14402, 0x54D18402, 0x54D1C402, 0x54D20402,
+    0x54D24402, 0x54D28402, 0x54D2C402, 0x54D30402, 0x54D34402, 0x54D38402, 0x54D3C402, 0x54D40402,
+    0x54D44402, 0x54D48402, 0x54D4C402, 0x54D50402, 0x54D54402, 0x54D58402, 0x54D5C402, 0x54D60402,
+    0x54D64402, 0x54D68402, 0x54D6C402, 0x54D70402, 0x54D74402, 0x54D78402, 0x54D7C402, 0x54D80402,
+    0x54D84402, 0x54D88402, 0x54D8C402, 0x54D90402, 0x54D94402, 0x54D98402, 0x54D9C402, 0x54DA0402,
+    0x54DA4402, 0x54DA8402, 0x54DAC402, 0x54DB0402, 0x54DB4402, 0x54DB8402, 0x54DBC402, 0x54DC0402,
+    0x54DC4402, 0x54DC8402, 0x54DCC402, 0x54DD0402, 0x54DD4402, 0x54DD8402, 0x54DDC402, 0x54DE0402,
+    0x54DE4402, 0x54DE8402, 0x54DEC402, 0x54DF0402, 0x54DF4402, 0x54DF8402, 0x54DFC402, 0x54E00402,
+    0x54E04402, 0x54E08402, 0x54E0C402, 0x54E10402, 0x54E14402, 0x54E18402, 0x54E1C402, 0x54E20402,
+    0x54E24402, 0x54E28402, 0x54E2C402, 0x54E30402, 0x54E34402, 0x54E38402, 0x54E3C402, 0x54E40402,
+    0x54E44402, 0x54E48402, 0x54E4C402, 0x54E50402, 0x54E54402, 0x54E58402, 0x54E5C402, 0x54E60402,
+    0x54E64402, 0x54E68402, 0x54E6C402, 0x54E70402, 0x54E74402, 0x54E78402, 0x54E7C402, 0x54E80402,
+    0x54E84402, 0x54E88402, 0x54E8C402, 0x54E90402, 0x54E94402, 0x54E98402, 0x54E9C402, 0x54EA0402,
+    0x54EA4402, 0x54EA8402, 0x54EAC402, 0x54EB8402, 0x54EBC402, 0x54EC0402, 0x54EC4402, 0x54EC8402,
+    0x54ECC402, 0x54ED0402, 0x54ED4402, 0x54ED8402, 0x54EDC402, 0x54EE0402, 0x54EE4402, 0x54EE8402,
+    0x54EEC402, 0x54EF0402, 0x54EF4402, 0x54EF8402, 0x54EFC402, 0x54F00402, 0x54F04402, 0x54F08402,
+    0x54F0C402, 0x54F10402, 0x54F14402, 0x54F18402, 0x54F1C402, 0x54F20402, 0x54F24402, 0x54F28402,
+    0x54F2C402, 0x54F30402, 0x54F34402, 0x54F38402, 0x54F3C402, 0x54F40402, 0x54F44402, 0x54F48402,
+    0x54F4C402, 0x54F50402, 0x54F54402, 0x54F58402, 0x54F5C402, 0x54F60402, 0x54F64402, 0x54F68402,
+    0x54F6C402, 0x54F70402, 0x54F74402, 0x54F78402, 0x54F7C402, 0x54F80402, 0x54F84402, 0x54F88402,
+    0x54F8C402, 0x54F90402, 0x54F94402, 0x54F98402, 0x54F9C402, 0x54FA0402, 0x54FA4402, 0x54FA8402,
+    0x54FAC402, 0x54FB0402, 0x54FB4402, 0x54FB8402, 0x54FBC402, 0x54FC0402, 0x54FC4402, 0x54FC8402,
+    0x54FCC402, 0x54FD0402, 0x54FD4402, 0x54FD8402, 0x54FDC402, 0x54FE0402, 0x54FE4402, 0x54FE8402,
+    0x54FEC402, 0x54FF0402, 0x54FF4402, 0x54FF8402, 0x54FFC402, 0x55000402, 0x55004402, 0x55008402,
+    0x5500C402, 0x55010402, 0x55014402, 0x55018402, 0x5501C402, 0x55020402, 0x55024402, 0x55028402,
+    0x5502C402, 0x55030402, 0x55034402, 0x55038402, 0x5503C402, 0x55040402, 0x55044402, 0x55048402,
+    0x5504C402, 0x55050402, 0x55054402, 0x55058402, 0x5505C402, 0x55060402, 0x55064402, 0x55068402,
+    0x5506C402, 0x55070402, 0x55074402, 0x55078402, 0x54EB0402, 0x54EB4402, 0x5507C402, 0x55080402,
+    0x55084402, 0x55088402, 0x5508C402, 0x55090402, 0x55094402, 0x55098402, 0x5509C402, 0x550A0402,
+    0x550A4402, 0x550A8402, 0x550AC402, 0x550B0402, 0x550B4402, 0x550B8402, 0x550BC402, 0x550C0402,
+    0x550C4402, 0x550C8402, 0x550CC402, 0x550D0402, 0x550D4402, 0x550D8402, 0x550DC402, 0x550E0402,
+    0x550E4402, 0x550E8402, 0x550EC402, 0x550F0402, 0x550F4402, 0x550F8402, 0x550FC402, 0x55100402,
+    0x55104402, 0x55108402, 0x5510C402, 0x55110402, 0x55114402, 0x55118402, 0x5511C402, 0x55120402,
+    0x55124402, 0x55128402, 0x5512C402, 0x55130402, 0x55134402, 0x55138402, 0x5513C402, 0x55140402,
+    0x55144402, 0x55148402, 0x5514C402, 0x55150402, 0x55154402, 0x55158402, 0x5515C402, 0x55160402,
+    0x55164402, 0x55168402, 0x5516C402, 0x55170402, 0x55174402, 0x55178402, 0x5517C402, 0x55180402,
+    0x55184402, 0x55188402, 0x5518C402, 0x55190402, 0x55194402, 0x55198402, 0x5519C402, 0x551A0402,
+    0x551A4402, 0x551A8402, 0x551AC402, 0x551B0402, 0x551B4402, 0x551B8402, 0x551BC402, 0x551C0402,
+    0x551C4402, 0x551C8402, 0x551CC402, 0x551D0402, 0x551D4402, 0x551D8402, 0x551DC402, 0x551E0402,
+    0x551E4402, 0x551E8402, 0x551EC402, 0x551F0402, 0x551F4402, 0x551F8402, 0x551FC402, 0x55200402,
+    0x55204402, 0x55208402, 0x5520C402, 0x55210402, 0x55214402, 0x55218402, 0x5521C402, 0x55220402,
+    0x55224402, 0x55228402, 0x5522C402, 0x55230402, 0x55234402, 0x55238402, 0x5523C402, 0x55240402,
+    0x55244402, 0x55248402, 0x5524C402, 0x55250402, 0x55254402, 0x55258402, 0x5525C402, 0x55260402,
+    0x55264402, 0x55268402, 0x5526C402, 0x55270402, 0x55274402, 0x55278402, 0x5527C402, 0x55280402,
+    0x55284402, 0x55288402, 0x5528C402, 0x55290402, 0x55294402, 0x55298402, 0x5529C402, 0x552A0402,
+    0x552A4402, 0x552A8402, 0x552AC402, 0x552B0402, 0x552B4402, 0x552B8402, 0x552BC402, 0x552C0402,
+    0x552C4402, 0x552C8402, 0x552CC402, 0x552D0402, 0x552D4402, 0x552D8402, 0x552DC402, 0x552E0402,
+    0x552E4402, 0x552E8402, 0x552EC402, 0x552F0402, 0x552F4402, 0x552F8402, 0x552FC402, 0x55300402,
+    0x55304402, 0x55308402, 0x5530C402, 0x55310402, 0x55314402, 0x55318402, 0x5531C402, 0x55320402,
+    0x55324402, 0x55328402, 0x5532C402, 0x55330402, 0x55334402, 0x55338402, 0x5533C402, 0x55340402,
+    0x55344402, 0x55348402, 0x5534C402, 0x55350402, 0x55354402, 0x55358402, 0x5535C402, 0x55360402,
+    0x55364402, 0x55368402, 0x5536C402, 0x55370402, 0x55374402, 0x55378402, 0x5537C402, 0x55380402,
+    0x55384402, 0x55388402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402, 0x47E70402,
+    0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402, 0x47E64402, 0x47E68402, 0x47E6C402,
+    0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402, 0x47E64402, 0x47E68402,
+    0x47E6C402, 0x47E70402, 0x47E74402, 0x47E68402, 0x47E6C402, 0x47E6C402, 0x47E70402, 0x47E74402,
+    0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E6C402,
+    0x47E70402, 0x47E74402, 0x47CB0402, 0x47CB4402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E6C402,
+    0x47E70402, 0x47E74402, 0x47E6C402, 0x47E6C402, 0x47E70402, 0x47E70402, 0x47E70402, 0x47E70402,
+    0x47E78402, 0x47E7C402, 0x47E7C402, 0x47E7C402, 0x47E80402, 0x47E80402, 0x47E84402, 0x47E84402,
+    0x47E84402, 0x47E84402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E70402, 0x47E74402, 0x47E74402, 0x47E68402, 0x47E6C402,
+    0x47E64402, 0x47E68402, 0x47CB8402, 0x47CBC402, 0x47CC0402, 0x47CC4402, 0x47CC8402, 0x47CCC402,
+    0x47CD0402, 0x47CD4402, 0x47CD8402, 0x47CDC402, 0x47CE0402, 0x47CE4402, 0x47CE8402, 0x47CEC402,
+    0x47CF0402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402, 0x00000000,
+    0x40C44402, 0x40C48402, 0x40C4C402, 0x40C50402, 0x40C54402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x5538C402, 0x55390402, 0x55394402, 0x55398402, 0x5539C402, 0x553A0402, 0x553A4402, 0x553A8402,
+    0x553AC402, 0x553B0402, 0x553B4402, 0x553B8402, 0x553BC402, 0x553C0402, 0x553C4402, 0x553C8402,
+    0x553CC402, 0x553D0402, 0x553D4402, 0x553D8402, 0x553DC402, 0x553E0402, 0x553E4402, 0x553E8402,
+    0x553EC402, 0x553F0402, 0x553F4402, 0x553F8402, 0x553FC402, 0x55400402, 0x55404402, 0x55408402,
+    0x5540C402, 0x55410402, 0x55414402, 0x55418402, 0x5541C402, 0x55420402, 0x55424402, 0x55428402,
+    0x5542C402, 0x55430402, 0x55434402, 0x55438402, 0x5543C402, 0x55440402, 0x55444402, 0x55448402,
+    0x5544C402, 0x55450402, 0x55454402, 0x55458402, 0x5545C402, 0x55460402, 0x55464402, 0x55468402,
+    0x5546C402, 0x55470402, 0x55474402, 0x55478402, 0x5547C402, 0x55480402, 0x55484402, 0x55488402,
+    0x5548C402, 0x55490402, 0x55494402, 0x55498402, 0x5549C402, 0x554A0402, 0x554A4402, 0x554A8402,
+    0x554AC402, 0x554B0402, 0x554B4402, 0x554B8402, 0x554BC402, 0x554C0402, 0x554C4402, 0x554C8402,
+    0x554CC402, 0x554D0402, 0x554D4402, 0x554D8402, 0x554DC402, 0x554E0402, 0x554E4402, 0x554E8402,
+    0x554EC402, 0x554F0402, 0x554F4402, 0x554F8402, 0x554FC402, 0x55500402, 0x55504402, 0x55508402,
+    0x5550C402, 0x55510402, 0x55514402, 0x55518402, 0x5551C402, 0x55520402, 0x55524402, 0x55528402,
+    0x5552C402, 0x55530402, 0x55534402, 0x55538402, 0x5553C402, 0x55540402, 0x55544402, 0x55548402,
+    0x5554C402, 0x55550402, 0x55554402, 0x55558402, 0x5555C402, 0x55560402, 0x55564402, 0x55568402,
+    0x5556C402, 0x55570402, 0x55574402, 0x55578402, 0x5557C402, 0x55580402, 0x55584402, 0x55588402,
+    0x5558C402, 0x55590402, 0x55594402, 0x55598402, 0x5559C402, 0x555A0402, 0x555A4402, 0x555A8402,
+    0x555AC402, 0x555B0402, 0x555B4402, 0x555B8402, 0x555BC402, 0x555C0402, 0x555C4402, 0x555C8402,
+    0x555CC402, 0x555D0402, 0x555D4402, 0x555D8402, 0x555DC402, 0x555E0402, 0x555E4402, 0x555E8402,
+    0x555EC402, 0x555F0402, 0x555F4402, 0x555F8402, 0x555FC402, 0x55600402, 0x55604402, 0x55608402,
+    0x5560C402, 0x55610402, 0x55614402, 0x55618402, 0x5561C402, 0x55620402, 0x55624402, 0x55628402,
+    0x5562C402, 0x55630402, 0x55634402, 0x55638402, 0x5563C402, 0x55640402, 0x55644402, 0x55648402,
+    0x5564C402, 0x55650402, 0x55654402, 0x55658402, 0x5565C402, 0x55660402, 0x55664402, 0x55668402,
+    0x5566C402, 0x55670402, 0x55674402, 0x55678402, 0x5567C402, 0x55680402, 0x55684402, 0x55688402,
+    0x5568C402, 0x55690402, 0x55694402, 0x55698402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x5569C402, 0x556A0402, 0x556A4402, 0x556A8402, 0x556AC402, 0x556B0402, 0x556B4402, 0x556B8402,
+    0x556BC402, 0x556C0402, 0x556C4402, 0x556C8402, 0x556CC402, 0x556D0402, 0x556D4402, 0x556D8402,
+    0x556DC402, 0x556E0402, 0x556E4402, 0x556E8402, 0x556EC402, 0x556F0402, 0x556F4402, 0x556F8402,
+    0x556FC402, 0x55700402, 0x55704402, 0x55708402, 0x5570C402, 0x55710402, 0x55714402, 0x55718402,
+    0x5571C402, 0x55720402, 0x55724402, 0x55728402, 0x5572C402, 0x55730402, 0x55734402, 0x55738402,
+    0x5573C402, 0x55740402, 0x55744402, 0x55748402, 0x5574C402, 0x55750402, 0x55754402, 0x55758402,
+    0x5575C402, 0x55760402, 0x55764402, 0x55768402, 0x5576C402, 0x55770402, 0x55774402, 0x55778402,
+    0x5577C402, 0x55780402, 0x55784402, 0x55788402, 0x5578C402, 0x55790402, 0x55794402, 0x55798402,
+    0x5579C402, 0x557A0402, 0x557A4402, 0x557A8402, 0x557AC402, 0x557B0402, 0x557B4402, 0x557B8402,
+    0x557BC402, 0x557C0402, 0x557C4402, 0x557C8402, 0x557CC402, 0x557D0402, 0x557D4402, 0x557D8402,
+    0x557DC402, 0x557E0402, 0x557E4402, 0x557E8402, 0x557EC402, 0x557F0402, 0x557F4402, 0x557F8402,
+    0x557FC402, 0x55800402, 0x55804402, 0x55808402, 0x5580C402, 0x55810402, 0x55814402, 0x55818402,
+    0x5581C402, 0x55820402, 0x55824402, 0x55828402, 0x5582C402, 0x55830402, 0x55834402, 0x55838402,
+    0x5583C402, 0x55840402, 0x55844402, 0x55848402, 0x5584C402, 0x55850402, 0x55854402, 0x55858402,
+    0x5585C402, 0x55860402, 0x55864402, 0x55868402, 0x5586C402, 0x55870402, 0x55874402, 0x55878402,
+    0x5587C402, 0x55880402, 0x55884402, 0x55888402, 0x5588C402, 0x55890402, 0x55894402, 0x55898402,
+    0x5589C402, 0x558A0402, 0x558A4402, 0x558A8402, 0x558AC402, 0x558B0402, 0x558B4402, 0x558B8402,
+    0x558BC402, 0x558C0402, 0x558C4402, 0x558C8402, 0x558CC402, 0x558D0402, 0x558D4402, 0x558D8402,
+    0x558DC402, 0x558E0402, 0x558E4402, 0x558E8402, 0x558EC402, 0x558F0402, 0x558F4402, 0x558F8402,
+    0x558FC402, 0x55900402, 0x55904402, 0x55908402, 0x5590C402, 0x55910402, 0x55914402, 0x55918402,
+    0x5591C402, 0x55920402, 0x55924402, 0x55928402, 0x5592C402, 0x55930402, 0x55934402, 0x55938402,
+    0x5593C402, 0x55940402, 0x55944402, 0x55948402, 0x5594C402, 0x55950402, 0x55954402, 0x55958402,
+    0x5595C402, 0x55960402, 0x55964402, 0x55968402, 0x5596C402, 0x55970402, 0x55974402, 0x55978402,
+    0x5597C402, 0x55980402, 0x55984402, 0x55988402, 0x5598C402, 0x55990402, 0x55994402, 0x55998402,
+    0x5599C402, 0x559A0402, 0x559A4402, 0x559A8402, 0x559AC402, 0x559B0402, 0x559B4402, 0x559B8402,
+    0x559BC402, 0x559C0402, 0x559C4402, 0x559C8402, 0x559CC402, 0x559D0402, 0x559D4402, 0x559D8402,
+    0x559DC402, 0x559E0402, 0x559E4402, 0x559E8402, 0x559EC402, 0x559F0402, 0x559F4402, 0x559F8402,
+    0x559FC402, 0x55A00402, 0x55A04402, 0x55A08402, 0x55A0C402, 0x55A10402, 0x55A14402, 0x55A18402,
+    0x55A1C402, 0x55A20402, 0x55A24402, 0x55A28402, 0x55A2C402, 0x55A30402, 0x55A34402, 0x55A38402,
+    0x55A3C402, 0x55A40402, 0x55A44402, 0x55A48402, 0x55A4C402, 0x55A50402, 0x55A54402, 0x55A58402,
+    0x55A5C402, 0x55A60402, 0x55A64402, 0x55A68402, 0x55A6C402, 0x55A70402, 0x55A74402, 0x55A78402,
+    0x55A7C402, 0x55A80402, 0x55A84402, 0x55A88402, 0x55A8C402, 0x55A90402, 0x55A94402, 0x55A98402,
+    0x55A9C402, 0x55AA0402, 0x55AA4402, 0x55AA8402, 0x55AAC402, 0x55AB0402, 0x55AB4402, 0x55AB8402,
+    0x55ABC402, 0x55AC0402, 0x55AC4402, 0x55AC8402, 0x55ACC402, 0x55AD0402, 0x55AD4402, 0x55AD8402,
+    0x55ADC402, 0x55AE0402, 0x55AE4402, 0x55AE8402, 0x55AEC402, 0x55AF0402, 0x55AF4402, 0x55AF8402,
+    0x55AFC402, 0x55B00402, 0x55B04402, 0x55B08402, 0x55B0C402, 0x55B10402, 0x55B14402, 0x55B18402,
+    0x55B1C402, 0x55B20402, 0x55B24402, 0x55B28402, 0x55B2C402, 0x55B30402, 0x55B34402, 0x55B38402,
+    0x55B3C402, 0x55B40402, 0x55B44402, 0x55B48402, 0x55B4C402, 0x55B50402, 0x55B54402, 0x55B58402,
+    0x55B5C402, 0x55B60402, 0x55B64402, 0x55B68402, 0x55B6C402, 0x55B70402, 0x55B74402, 0x55B78402,
+    0x55B7C402, 0x55B80402, 0x55B84402, 0x55B88402, 0x55B8C402, 0x55B90402, 0x55B94402, 0x55B98402,
+    0x55B9C402, 0x55BA0402, 0x55BA4402, 0x55BA8402, 0x55BAC402, 0x55BB0402, 0x55BB4402, 0x55BB8402,
+    0x55BBC402, 0x55BC0402, 0x55BC4402, 0x55BC8402, 0x55BCC402, 0x55BD0402, 0x55BD4402, 0x55BD8402,
+    0x55BDC402, 0x55BE0402, 0x55BE4402, 0x55BE8402, 0x55BEC402, 0x55BF0402, 0x55BF4402, 0x55BF8402,
+    0x55BFC402, 0x55C00402, 0x55C04402, 0x55C08402, 0x55C0C402, 0x55C10402, 0x55C14402, 0x55C18402,
+    0x55C1C402, 0x55C20402, 0x55C24402, 0x55C28402, 0x55C2C402, 0x55C30402, 0x55C34402, 0x55C38402,
+    0x55C3C402, 0x55C40402, 0x55C44402, 0x55C48402, 0x55C4C402, 0x55C50402, 0x55C54402, 0x55C58402,
+    0x55C5C402, 0x55C60402, 0x55C64402, 0x55C68402, 0x55C6C402, 0x55C70402, 0x55C74402, 0x55C78402,
+    0x55C7C402, 0x55C80402, 0x55C84402, 0x55C88402, 0x55C8C402, 0x55C90402, 0x55C94402, 0x55C98402,
+    0x55C9C402, 0x55CA0402, 0x55CA4402, 0x55CA8402, 0x55CAC402, 0x55CB0402, 0x55CB4402, 0x55CB8402,
+    0x55CBC402, 0x55CC0402, 0x55CC4402, 0x55CC8402, 0x55CCC402, 0x55CD0402, 0x55CD4402, 0x55CD8402,
+    0x55CDC402, 0x55CE0402, 0x55CE4402, 0x55CE8402, 0x55CEC402, 0x55CF0402, 0x55CF4402, 0x55CF8402,
+    0x55CFC402, 0x55D00402, 0x55D04402, 0x55D08402, 0x55D0C402, 0x55D10402, 0x55D14402, 0x55D18402,
+    0x55D1C402, 0x55D20402, 0x55D24402, 0x55D28402, 0x55D2C402, 0x55D30402, 0x55D34402, 0x55D38402,
+    0x55D3C402, 0x55D40402, 0x55D44402, 0x55D48402, 0x55D4C402, 0x55D50402, 0x55D54402, 0x55D58402,
+    0x55D5C402, 0x55D60402, 0x55D64402, 0x55D68402, 0x55D6C402, 0x55D70402, 0x55D74402, 0x55D78402,
+    0x55D7C402, 0x55D80402, 0x55D84402, 0x55D88402, 0x55D8C402, 0x55D90402, 0x55D94402, 0x55D98402,
+    0x55D9C402, 0x55DA0402, 0x55DA4402, 0x55DA8402, 0x55DAC402, 0x55DB0402, 0x55DB4402, 0x55DB8402,
+    0x55DBC402, 0x55DC0402, 0x55DC4402, 0x55DC8402, 0x55DCC402, 0x55DD0402, 0x55DD4402, 0x55DD8402,
+    0x55DDC402, 0x55DE0402, 0x55DE4402, 0x55DE8402, 0x55DEC402, 0x55DF0402, 0x55DF4402, 0x55DF8402,
+    0x55DFC402, 0x55E00402, 0x55E04402, 0x55E08402, 0x55E0C402, 0x55E10402, 0x55E14402, 0x55E18402,
+    0x55E1C402, 0x55E20402, 0x55E24402, 0x55E28402, 0x55E2C402, 0x55E30402, 0x55E34402, 0x55E38402,
+    0x55E3C402, 0x55E40402, 0x55E44402, 0x55E48402, 0x55E4C402, 0x55E50402, 0x55E54402, 0x55E58402,
+    0x55E5C402, 0x55E60402, 0x55E64402, 0x55E68402, 0x55E6C402, 0x55E70402, 0x55E74402, 0x55E78402,
+    0x55E7C402, 0x55E80402, 0x55E84402, 0x55E88402, 0x55E8C402, 0x55E90402, 0x55E94402, 0x55E98402,
+    0x55E9C402, 0x55EA0402, 0x55EA4402, 0x55EA8402, 0x55EAC402, 0x55EB0402, 0x55EB4402, 0x55EB8402,
+    0x55EBC402, 0x55EC0402, 0x55EC4402, 0x55EC8402, 0x55ECC402, 0x55ED0402, 0x55ED4402, 0x55ED8402,
+    0x55EDC402, 0x55EE0402, 0x55EE4402, 0x55EE8402, 0x55EEC402, 0x55EF0402, 0x55EF4402, 0x55EF8402,
+    0x55EFC402, 0x55F00402, 0x55F04402, 0x55F08402, 0x55F0C402, 0x55F10402, 0x55F14402, 0x55F18402,
+    0x55F1C402, 0x55F20402, 0x55F24402, 0x55F28402, 0x55F2C402, 0x55F30402, 0x55F34402, 0x55F38402,
+    0x55F3C402, 0x55F40402, 0x55F44402, 0x55F48402, 0x55F4C402, 0x55F50402, 0x55F54402, 0x55F58402,
+    0x55F5C402, 0x55F60402, 0x55F64402, 0x55F68402, 0x55F6C402, 0x55F70402, 0x55F74402, 0x55F78402,
+    0x55F7C402, 0x55F80402, 0x55F84402, 0x55F88402, 0x55F8C402, 0x55F90402, 0x55F94402, 0x55F98402,
+    0x55F9C402, 0x55FA0402, 0x55FA4402, 0x55FA8402, 0x55FAC402, 0x55FB0402, 0x55FB4402, 0x55FB8402,
+    0x55FBC402, 0x55FC0402, 0x55FC4402, 0x55FC8402, 0x55FCC402, 0x55FD0402, 0x55FD4402, 0x55FD8402,
+    0x55FDC402, 0x55FE0402, 0x55FE4402, 0x55FE8402, 0x55FEC402, 0x55FF0402, 0x55FF4402, 0x55FF8402,
+    0x55FFC402, 0x56000402, 0x56004402, 0x56008402, 0x5600C402, 0x56010402, 0x56014402, 0x56018402,
+    0x5601C402, 0x56020402, 0x56024402, 0x56028402, 0x5602C402, 0x56030402, 0x56034402, 0x56038402,
+    0x5603C402, 0x56040402, 0x56044402, 0x56048402, 0x5604C402, 0x56050402, 0x56054402, 0x56058402,
+    0x5605C402, 0x56060402, 0x56064402, 0x56068402, 0x5606C402, 0x56070402, 0x56074402, 0x56078402,
+    0x5607C402, 0x56080402, 0x56084402, 0x56088402, 0x5608C402, 0x56090402, 0x56094402, 0x56098402,
+    0x5609C402, 0x560A0402, 0x560A4402, 0x560A8402, 0x560AC402, 0x560B0402, 0x560B4402, 0x560B8402,
+    0x560BC402, 0x560C0402, 0x560C4402, 0x560C8402, 0x560CC402, 0x560D0402, 0x560D4402, 0x560D8402,
+    0x560DC402, 0x560E0402, 0x560E4402, 0x560E8402, 0x560EC402, 0x560F0402, 0x560F4402, 0x560F8402,
+    0x560FC402, 0x56100402, 0x56104402, 0x56108402, 0x5610C402, 0x56110402, 0x56114402, 0x56118402,
+    0x5611C402, 0x56120402, 0x56124402, 0x56128402, 0x5612C402, 0x56130402, 0x56134402, 0x56138402,
+    0x5613C402, 0x56140402, 0x56144402, 0x56148402, 0x5614C402, 0x56150402, 0x56154402, 0x56158402,
+    0x5615C402, 0x56160402, 0x56164402, 0x56168402, 0x5616C402, 0x56170402, 0x56174402, 0x56178402,
+    0x5617C402, 0x56180402, 0x56184402, 0x56188402, 0x5618C402, 0x56190402, 0x56194402, 0x56198402,
+    0x5619C402, 0x561A0402, 0x561A4402, 0x561A8402, 0x561AC402, 0x561B0402, 0x561B4402, 0x561B8402,
+    0x561BC402, 0x561C0402, 0x561C4402, 0x561C8402, 0x561CC402, 0x561D0402, 0x561D4402, 0x561D8402,
+    0x561DC402, 0x561E0402, 0x561E4402, 0x561E8402, 0x561EC402, 0x561F0402, 0x561F4402, 0x561F8402,
+    0x561FC402, 0x56200402, 0x56204402, 0x56208402, 0x5620C402, 0x56210402, 0x56214402, 0x56218402,
+    0x5621C402, 0x56220402, 0x56224402, 0x56228402, 0x5622C402, 0x56230402, 0x56234402, 0x56238402,
+    0x5623C402, 0x56240402, 0x56244402, 0x56248402, 0x5624C402, 0x56250402, 0x56254402, 0x56258402,
+    0x5625C402, 0x56260402, 0x56264402, 0x56268402, 0x5626C402, 0x56270402, 0x56274402, 0x56278402,
+    0x5627C402, 0x56280402, 0x56284402, 0x56288402, 0x5628C402, 0x56290402, 0x56294402, 0x56298402,
+    0x5629C402, 0x562A0402, 0x562A4402, 0x562A8402, 0x562AC402, 0x562B0402, 0x562B4402, 0x562B8402,
+    0x562BC402, 0x562C0402, 0x562C4402, 0x562C8402, 0x562CC402, 0x562D0402, 0x562D4402, 0x562D8402,
+    0x562DC402, 0x562E0402, 0x562E4402, 0x562E8402, 0x562EC402, 0x562F0402, 0x562F4402, 0x562F8402,
+    0x562FC402, 0x56300402, 0x56304402, 0x56308402, 0x5630C402, 0x56310402, 0x56314402, 0x56318402,
+    0x5631C402, 0x56320402, 0x56324402, 0x56328402, 0x5632C402, 0x56330402, 0x56334402, 0x56338402,
+    0x5633C402, 0x56340402, 0x56344402, 0x56348402, 0x5634C402, 0x56350402, 0x56354402, 0x56358402,
+    0x5635C402, 0x56360402, 0x56364402, 0x56368402, 0x5636C402, 0x56370402, 0x56374402, 0x56378402,
+    0x5637C402, 0x56380402, 0x56384402, 0x56388402, 0x5638C402, 0x56390402, 0x56394402, 0x56398402,
+    0x5639C402, 0x563A0402, 0x563A4402, 0x563A8402, 0x563AC402, 0x563B0402, 0x563B4402, 0x563B8402,
+    0x563BC402, 0x563C0402, 0x563C4402, 0x563C8402, 0x563CC402, 0x563D0402, 0x563D4402, 0x563D8402,
+    0x563DC402, 0x563E0402, 0x563E4402, 0x563E8402, 0x563EC402, 0x563F0402, 0x563F4402, 0x563F8402,
+    0x563FC402, 0x56400402, 0x56404402, 0x56408402, 0x5640C402, 0x56410402, 0x56414402, 0x56418402,
+    0x5641C402, 0x56420402, 0x56424402, 0x56428402, 0x5642C402, 0x56430402, 0x56434402, 0x56438402,
+    0x5643C402, 0x56440402, 0x56444402, 0x56448402, 0x5644C402, 0x56450402, 0x56454402, 0x56458402,
+    0x5645C402, 0x56460402, 0x56464402, 0x56468402, 0x5646C402, 0x56470402, 0x56474402, 0x56478402,
+    0x5647C402, 0x56480402, 0x56484402, 0x56488402, 0x5648C402, 0x56490402, 0x56494402, 0x56498402,
+    0x5649C402, 0x564A0402, 0x564A4402, 0x564A8402, 0x564AC402, 0x564B0402, 0x564B4402, 0x564B8402,
+    0x564BC402, 0x564C0402, 0x564C4402, 0x564C8402, 0x564CC402, 0x564D0402, 0x564D4402, 0x564D8402,
+    0x564DC402, 0x564E0402, 0x564E4402, 0x564E8402, 0x564EC402, 0x564F0402, 0x564F4402, 0x564F8402,
+    0x564FC402, 0x56500402, 0x56504402, 0x56508402, 0x5650C402, 0x56510402, 0x56514402, 0x56518402,
+    0x5651C402, 0x56520402, 0x56524402, 0x56528402, 0x5652C402, 0x56530402, 0x56534402, 0x56538402,
+    0x5653C402, 0x56540402, 0x56544402, 0x56548402, 0x5654C402, 0x56550402, 0x56554402, 0x56558402,
+    0x5655C402, 0x56560402, 0x56564402, 0x56568402, 0x5656C402, 0x56570402, 0x56574402, 0x56578402,
+    0x5657C402, 0x56580402, 0x56584402, 0x56588402, 0x5658C402, 0x56590402, 0x56594402, 0x56598402,
+    0x5659C402, 0x565A0402, 0x565A4402, 0x565A8402, 0x565AC402, 0x565B0402, 0x565B4402, 0x565B8402,
+    0x565BC402, 0x565C0402, 0x565C4402, 0x565C8402, 0x565CC402, 0x565D0402, 0x565D4402, 0x565D8402,
+    0x565DC402, 0x565E0402, 0x565E4402, 0x565E8402, 0x565EC402, 0x565F0402, 0x565F4402, 0x565F8402,
+    0x565FC402, 0x56600402, 0x56604402, 0x56608402, 0x5660C402, 0x56610402, 0x56614402, 0x56618402,
+    0x5661C402, 0x56620402, 0x56624402, 0x56628402, 0x5662C402, 0x56630402, 0x56634402, 0x56638402,
+    0x5663C402, 0x56640402, 0x56644402, 0x56648402, 0x5664C402, 0x56650402, 0x56654402, 0x56658402,
+    0x5665C402, 0x56660402, 0x56664402, 0x56668402, 0x5666C402, 0x56670402, 0x56674402, 0x56678402,
+    0x5667C402, 0x56680402, 0x56684402, 0x56688402, 0x5668C402, 0x56690402, 0x56694402, 0x56698402,
+    0x5669C402, 0x566A0402, 0x566A4402, 0x566A8402, 0x566AC402, 0x566B0402, 0x566B4402, 0x566B8402,
+    0x566BC402, 0x566C0402, 0x566C4402, 0x566C8402, 0x566CC402, 0x566D0402, 0x566D4402, 0x566D8402,
+    0x566DC402, 0x566E0402, 0x566E4402, 0x566E8402, 0x566EC402, 0x566F0402, 0x566F4402, 0x566F8402,
+    0x566FC402, 0x56700402, 0x56704402, 0x56708402, 0x5670C402, 0x56710402, 0x56714402, 0x56718402,
+    0x5671C402, 0x56720402, 0x56724402, 0x56728402, 0x5672C402, 0x56730402, 0x56734402, 0x56738402,
+    0x5673C402, 0x56740402, 0x56744402, 0x56748402, 0x5674C402, 0x56750402, 0x56754402, 0x00000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x567C4402, 0x567C8402, 0x567CC402, 0x567D0402, 0x567D4402, 0x567D8402, 0x567DC402, 0x567E0402,
+    0x567E4402, 0x567E8402, 0x567EC402, 0x567F0402, 0x567F4402, 0x567F8402, 0x567FC402, 0x56800402,
+    0x56804402, 0x56808402, 0x5680C402, 0x56810402, 0x56814402, 0x56818402, 0x5681C402, 0x56820402,
+    0x56824402, 0x56828402, 0x5682C402, 0x56830402, 0x56834402, 0x56838402, 0x5683C402, 0x56840402,
+    0x56844402, 0x56848402, 0x5684C402, 0x56850402, 0x56854402, 0x56858402, 0x5685C402, 0x56860402,
+    0x56864402, 0x56868402, 0x5686C402, 0x56870402, 0x56874402, 0x56878402, 0x5687C402, 0x56880402,
+    0x56884402, 0x56888402, 0x5688C402, 0x56890402, 0x56894402, 0x56898402, 0x5689C402, 0x568A0402,
+    0x568A4402, 0x568A8402, 0x568AC402, 0x568B0402, 0x568B4402, 0x568B8402, 0x568BC402, 0x568C0402,
+    0x568C4402, 0x568C8402, 0x568CC402, 0x568D0402, 0x568D4402, 0x568D8402, 0x568DC402, 0x568E0402,
+    0x568E4402, 0x568E8402, 0x568EC402, 0x568F0402, 0x568F4402, 0x568F8402, 0x568FC402, 0x56900402,
+    0x56904402, 0x56908402, 0x5690C402, 0x56910402, 0x56914402, 0x56918402, 0x5691C402, 0x56920402,
+    0x56924402, 0x56928402, 0x5692C402, 0x56930402, 0x56934402, 0x56938402, 0x5693C402, 0x56940402,
+    0x56944402, 0x56948402, 0x5694C402, 0x56950402, 0x56954402, 0x56958402, 0x5695C402, 0x56960402,
+    0x56964402, 0x56968402, 0x5696C402, 0x56970402, 0x56974402, 0x56978402, 0x5697C402, 0x56980402,
+    0x56984402, 0x56988402, 0x5698C402, 0x56990402, 0x56994402, 0x56998402, 0x5699C402, 0x569A0402,
+    0x569A4402, 0x569A8402, 0x569AC402, 0x569B0402, 0x569B4402, 0x569B8402, 0x569BC402, 0x569C0402,
+    0x569C4402, 0x569C8402, 0x569CC402, 0x569D0402, 0x569D4402, 0x569D8402, 0x569DC402, 0x569E0402,
+    0x569E4402, 0x569E8402, 0x569EC402, 0x569F0402, 0x569F4402, 0x569F8402, 0x569FC402, 0x56A00402,
+    0x56A04402, 0x56A08402, 0x56A0C402, 0x56A10402, 0x56A14402, 0x56A18402, 0x56A1C402, 0x56A20402,
+    0x56A24402, 0x56A28402, 0x56A2C402, 0x56A30402, 0x56A34402, 0x56A38402, 0x56A3C402, 0x56A40402,
+    0x56A44402, 0x56A48402, 0x56A4C402, 0x56A50402, 0x56A54402, 0x56A58402, 0x56A5C402, 0x56A60402,
+    0x56A64402, 0x56A68402, 0x56A6C402, 0x56A70402, 0x56A74402, 0x56A78402, 0x56A7C402, 0x56A80402,
+    0x56A84402, 0x56A88402, 0x56A8C402, 0x56A90402, 0x56A94402, 0x56A98402, 0x56A9C402, 0x56AA0402,
+    0x56AA4402, 0x56AA8402, 0x56AAC402, 0x56AB0402, 0x56AB4402, 0x56AB8402, 0x56ABC402, 0x56AC0402,
+    0x56AC4402, 0x56AC8402, 0x56ACC402, 0x56AD0402, 0x56AD4402, 0x56AD8402, 0x56ADC402, 0x56AE0402,
+    0x56AE4402, 0x56AE8402, 0x56AEC402, 0x56AF0402, 0x56AF4402, 0x56AF8402, 0x56AFC402, 0x56B00402,
+    0x56B04402, 0x56B08402, 0x56B0C402, 0x56B10402, 0x56B14402, 0x56B18402, 0x56B1C402, 0x56B20402,
+    0x56B24402, 0x56B28402, 0x56B2C402, 0x56B30402, 0x56B34402, 0x56B38402, 0x56B3C402, 0x56B40402,
+    0x56B44402, 0x56B48402, 0x56B4C402, 0x56B50402, 0x56B54402, 0x56B58402, 0x56B5C402, 0x56B60402,
+    0x56B64402, 0x56B68402, 0x56B6C402, 0x56B70402, 0x56B74402, 0x56B78402, 0x56B7C402, 0x56B80402,
+    0x56B84402, 0x56B88402, 0x56B8C402, 0x56B90402, 0x56B94402, 0x56B98402, 0x56B9C402, 0x56BA0402,
+    0x56BA4402, 0x56BA8402, 0x56BAC402, 0x56BB0402, 0x56BB4402, 0x56BB8402, 0x56BBC402, 0x56BC0402,
+    0x56BC4402, 0x56BC8402, 0x56BCC402, 0x56BD0402, 0x56BD4402, 0x56BD8402, 0x56BDC402, 0x56BE0402,
+    0x56BE4402, 0x56BE8402, 0x56BEC402, 0x56BF0402, 0x56BF4402, 0x56BF8402, 0x56BFC402, 0x56C00402,
+    0x56C04402, 0x56C08402, 0x56C0C402, 0x56C10402, 0x56C14402, 0x56C18402, 0x56C1C402, 0x56C20402,
+    0x56C24402, 0x56C28402, 0x56C2C402, 0x56C30402, 0x56C34402, 0x56C38402, 0x56C3C402, 0x56C40402,
+    0x56C44402, 0x56C48402, 0x56C4C402, 0x56C50402, 0x56C54402, 0x56C58402, 0x56C5C402, 0x56C60402,
+    0x56C64402, 0x56C68402, 0x56C6C402, 0x56C70402, 0x56C74402, 0x56C78402, 0x56C7C402, 0x56C80402,
+    0x56C84402, 0x56C88402, 0x56C8C402, 0x56C90402, 0x56C94402, 0x56C98402, 0x56C9C402, 0x56CA0402,
+    0x56CA4402, 0x56CA8402, 0x56CAC402, 0x56CB0402, 0x56CB4402, 0x56CB8402, 0x56CBC402, 0x56CC0402,
+    0x56CC4402, 0x56CC8402, 0x56CCC402, 0x56CD0402, 0x56CD4402, 0x56CD8402, 0x56CDC402, 0x56CE0402,
+    0x56CE4402, 0x56CE8402, 0x56CEC402, 0x56CF0402, 0x56CF4402, 0x56CF8402, 0x56CFC402, 0x56D00402,
+    0x56D04402, 0x56D08402, 0x56D0C402, 0x56D10402, 0x56D14402, 0x56D18402, 0x56D1C402, 0x56D20402,
+    0x56D24402, 0x56D28402, 0x56D2C402, 0x56D30402, 0x56D34402, 0x56D38402, 0x56D3C402, 0x56D40402,
+    0x56D44402, 0x56D48402, 0x56D4C402, 0x56D50402, 0x56D54402, 0x56D58402, 0x56D5C402, 0x56D60402,
+    0x56D64402, 0x56D68402, 0x56D6C402, 0x56D70402, 0x56D74402, 0x56D78402, 0x56D7C402, 0x56D80402,
+    0x56D84402, 0x56D88402, 0x56D8C402, 0x56D90402, 0x56D94402, 0x56D98402, 0x56D9C402, 0x56DA0402,
+    0x56DA4402, 0x56DA8402, 0x56DAC402, 0x56DB0402, 0x56DB4402, 0x56DB8402, 0x56DBC402, 0x56DC0402,
+    0x56DC4402, 0x56DC8402, 0x56DCC402, 0x56DD0402, 0x56DD4402, 0x56DD8402, 0x56DDC402, 0x56DE0402,
+    0x56DE4402, 0x56DE8402, 0x56DEC402, 0x56DF0402, 0x56DF4402, 0x56DF8402, 0x56DFC402, 0x56E00402,
+    0x56E04402, 0x56E08402, 0x56E0C402, 0x56E10402, 0x56E14402, 0x56E18402, 0x56E1C402, 0x56E20402,
+    0x56E24402, 0x56E28402, 0x56E2C402, 0x56E30402, 0x56E34402, 0x56E38402, 0x56E3C402, 0x56E40402,
+    0x56E44402, 0x56E48402, 0x56E4C402, 0x56E50402, 0x56E54402, 0x56E58402, 0x56E5C402, 0x56E60402,
+    0x56E64402, 0x56E68402, 0x56E6C402, 0x56E70402, 0x56E74402, 0x56E78402, 0x56E7C402, 0x56E80402,
+    0x56E84402, 0x56E88402, 0x56E8C402, 0x56E90402, 0x56E94402, 0x56E98402, 0x56E9C402, 0x56EA0402,
+    0x56EA4402, 0x56EA8402, 0x56EAC402, 0x56EB0402, 0x56EB4402, 0x56EB8402, 0x56EBC402, 0x56EC0402,
+    0x56EC4402, 0x56EC8402, 0x56ECC402, 0x56ED0402, 0x56ED4402, 0x56ED8402, 0x56EDC402, 0x56EE0402,
+    0x56EE4402, 0x56EE8402, 0x56EEC402, 0x56EF0402, 0x56EF4402, 0x56EF8402, 0x56EFC402, 0x56F00402,
+    0x56F04402, 0x56F08402, 0x56F0C402, 0x56F10402, 0x56F14402, 0x56F18402, 0x56F1C402, 0x56F20402,
+    0x56F24402, 0x56F28402, 0x56F2C402, 0x56F30402, 0x56F34402, 0x56F38402, 0x56F3C402, 0x56F40402,
+    0x56F44402, 0x56F48402, 0x56F4C402, 0x56F50402, 0x56F54402, 0x56F58402, 0x56F5C402, 0x56F60402,
+    0x56F64402, 0x56F68402, 0x56F6C402, 0x56F70402, 0x56F74402, 0x56F78402, 0x56F7C402, 0x56F80402,
+    0x56F84402, 0x56F88402, 0x56F8C402, 0x56F90402, 0x56F94402, 0x56F98402, 0x56F9C402, 0x56FA0402,
+    0x56FA4402, 0x56FA8402, 0x56FAC402, 0x56FB0402, 0x56FB4402, 0x56FB8402, 0x56FBC402, 0x56FC0402,
+    0x56FC4402, 0x56FC8402, 0x56FCC402, 0x56FD0402, 0x56FD4402, 0x56FD8402, 0x56FDC402, 0x56FE0402,
+    0x56FE4402, 0x56FE8402, 0x56FEC402, 0x56FF0402, 0x56FF4402, 0x56FF8402, 0x56FFC402, 0x57000402,
+    0x57004402, 0x57008402, 0x5700C402, 0x57010402, 0x57014402, 0x57018402, 0x5701C402, 0x57020402,
+    0x57024402, 0x57028402, 0x5702C402, 0x57030402, 0x57034402, 0x57038402, 0x5703C402, 0x57040402,
+    0x57044402, 0x57048402, 0x5704C402, 0x57050402, 0x57054402, 0x57058402, 0x5705C402, 0x57060402,
+    0x57064402, 0x57068402, 0x5706C402, 0x57070402, 0x57074402, 0x57078402, 0x5707C402, 0x57080402,
+    0x57084402, 0x57088402, 0x5708C402, 0x57090402, 0x57094402, 0x57098402, 0x5709C402, 0x570A0402,
+    0x570A4402, 0x570A8402, 0x570AC402, 0x570B0402, 0x570B4402, 0x570B8402, 0x570BC402, 0x570C0402,
+    0x570C4402, 0x570C8402, 0x570CC402, 0x570D0402, 0x570D4402, 0x570D8402, 0x570DC402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4F858402, 0x4F85C402, 0x4F860402, 0x4F864402, 0x4F868402, 0x4F86C402, 0x4F870402, 0x4F874402,
+    0x4F878402, 0x4F87C402, 0x4F880402, 0x4F884402, 0x4F888402, 0x4F88C402, 0x4F890402, 0x4F894402,
+    0x4F898402, 0x4F89C402, 0x4F8A0402, 0x4F8A4402, 0x4F8A8402, 0x4F8AC402, 0x4F8B0402, 0x4F8B4402,
+    0x4F8B8402, 0x4F8BC402, 0x4F8C0402, 0x4F8C4402, 0x4F8C8402, 0x4F8CC402, 0x4F8D0402, 0x4F8D4402,
+    0x4F8D8402, 0x4F8DC402, 0x4F8E0402, 0x4F8E4402, 0x4F8E8402, 0x4F8EC402, 0x4F8F0402, 0x4F8F4402,
+    0x4F8F8402, 0x4F8FC402, 0x4F900402, 0x4F904402, 0x4F908402, 0x4F90C402, 0x4F910402, 0x4F914402,
+    0x4F918402, 0x4F91C402, 0x4F920402, 0x4F924402, 0x4F928402, 0x4F92C402, 0x4F930402, 0x4F934402,
+    0x4F938402, 0x4F93C402, 0x4F940402, 0x4F944402, 0x4F948402, 0x4F94C402, 0x4F950402, 0x4F954402,
+    0x4F958402, 0x4F95C402, 0x4F960402, 0x4F964402, 0x4F968402, 0x4F96C402, 0x4F970402, 0x4F974402,
+    0x4F978402, 0x4F97C402, 0x4F980402, 0x4F984402, 0x4F988402, 0x4F98C402, 0x4F990402, 0x4F994402,
+    0x4F998402, 0x4F99C402, 0x4F9A0402, 0x4F9A4402, 0x4F9A8402, 0x4F9AC402, 0x4F9B0402, 0x4F9B4402,
+    0x4F9B8402, 0x4F9BC402, 0x4F9C0402, 0x4F9C4402, 0x4F9C8402, 0x4F9CC402, 0x4F9D0402, 0x4F9D4402,
+    0x4F9D8402, 0x4F9DC402, 0x4F9E0402, 0x4F9E4402, 0x4F9E8402, 0x4F9EC402, 0x4F9F0402, 0x4F9F4402,
+    0x4F9F8402, 0x4F9FC402, 0x4FA00402, 0x4FA04402, 0x4FA08402, 0x4FA0C402, 0x4FA10402, 0x4FA14402,
+    0x4FA18402, 0x4FA1C402, 0x4FA20402, 0x4FA24402, 0x4FA28402, 0x4FA2C402, 0x4FA30402, 0x4FA34402,
+    0x4FA38402, 0x4FA3C402, 0x4FA40402, 0x4FA44402, 0x4FA48402, 0x4FA4C402, 0x4FA50402, 0x4FA54402,
+    0x4FA58402, 0x4FA5C402, 0x4FA60402, 0x4FA64402, 0x4FA68402, 0x4FA6C402, 0x4FA70402, 0x4FA74402,
+    0x4FA78402, 0x4FA7C402, 0x4FA80402, 0x4FA84402, 0x4FA88402, 0x4FA8C402, 0x4FA90402, 0x4FA94402,
+    0x4FA98402, 0x4FA9C402, 0x4FAA0402, 0x4FAA4402, 0x4FAA8402, 0x4FAAC402, 0x4FAB0402, 0x4FAB4402,
+    0x4FAB8402, 0x4FABC402, 0x4FAC0402, 0x4FAC4402, 0x4FAC8402, 0x4FACC402, 0x4FAD0402, 0x4FAD4402,
+    0x4FAD8402, 0x4FADC402, 0x4FAE0402, 0x4FAE4402, 0x4FAE8402, 0x4FAEC402, 0x4FAF0402, 0x4FAF4402,
+    0x4FAF8402, 0x4FAFC402, 0x4FB00402, 0x4FB04402, 0x4FB08402, 0x4FB0C402, 0x4FB10402, 0x4FB14402,
+    0x4FB18402, 0x4FB1C402, 0x4FB20402, 0x4FB24402, 0x4FB28402, 0x4FB2C402, 0x4FB30402, 0x4FB34402,
+    0x4FB38402, 0x4FB3C402, 0x4FB40402, 0x4FB44402, 0x4FB48402, 0x4FB4C402, 0x4FB50402, 0x4FB54402,
+    0x4FB58402, 0x4FB5C402, 0x4FB60402, 0x4FB64402, 0x4FB68402, 0x4FB6C402, 0x4FB70402, 0x4FB74402,
+    0x4FB78402, 0x4FB7C402, 0x4FB80402, 0x4FB84402, 0x4FB88402, 0x4FB8C402, 0x4FB90402, 0x4FB94402,
+    0x4FB98402, 0x4FB9C402, 0x4FBA0402, 0x4FBA4402, 0x4FBA8402, 0x4FBAC402, 0x4FBB0402, 0x4FBB4402,
+    0x4FBB8402, 0x4FBBC402, 0x4FBC0402, 0x4FBC4402, 0x4FBC8402, 0x4FBCC402, 0x4FBD0402, 0x4FBD4402,
+    0x4FBD8402, 0x4FBDC402, 0x4FBE0402, 0x4FBE4402, 0x4FBE8402, 0x4FBEC402, 0x4FBF0402, 0x4FBF4402,
+    0x4FBF8402, 0x4FBFC402, 0x4FC00402, 0x4FC04402, 0x4FC08402, 0x4FC0C402, 0x4FC10402, 0x4FC14402,
+    0x4FC18402, 0x4FC1C402, 0x4FC20402, 0x4FC24402, 0x4FC28402, 0x4FC2C402, 0x4FC30402, 0x4FC34402,
+    0x4FC38402, 0x4FC3C402, 0x4FC40402, 0x4FC44402, 0x4FC48402, 0x4FC4C402, 0x4FC50402, 0x4FC54402,
+    0x4FC58402, 0x4FC5C402, 0x4FC60402, 0x4FC64402, 0x4FC68402, 0x4FC6C402, 0x4FC70402, 0x4FC74402,
+    0x4FC78402, 0x4FC7C402, 0x4FC80402, 0x4FC84402, 0x4FC88402, 0x4FC8C402, 0x4FC90402, 0x4FC94402,
+    0x4FC98402, 0x4FC9C402, 0x4FCA0402, 0x4FCA4402, 0x4FCA8402, 0x4FCAC402, 0x4FCB0402, 0x4FCB4402,
+    0x4FCB8402, 0x4FCBC402, 0x4FCC0402, 0x4FCC4402, 0x4FCC8402, 0x4FCCC402, 0x4FCD0402, 0x4FCD4402,
+    0x4FCD8402, 0x4FCDC402, 0x4FCE0402, 0x4FCE4402, 0x4FCE8402, 0x4FCEC402, 0x4FCF0402, 0x4FCF4402,
+    0x4FCF8402, 0x4FCFC402, 0x4FD00402, 0x4FD04402, 0x4FD08402, 0x4FD0C402, 0x4FD10402, 0x4FD14402,
+    0x4FD18402, 0x4FD1C402, 0x4FD20402, 0x4FD24402, 0x4FD28402, 0x4FD2C402, 0x4FD30402, 0x4FD34402,
+    0x4FD38402, 0x4FD3C402, 0x4FD40402, 0x4FD44402, 0x4FD48402, 0x4FD4C402, 0x4FD50402, 0x4FD54402,
+    0x4FD58402, 0x4FD5C402, 0x4FD60402, 0x4FD64402, 0x4FD68402, 0x4FD6C402, 0x4FD70402, 0x4FD74402,
+    0x4FD78402, 0x4FD7C402, 0x4FD80402, 0x4FD84402, 0x4FD88402, 0x4FD8C402, 0x4FD90402, 0x4FD94402,
+    0x4FD98402, 0x4FD9C402, 0x4FDA0402, 0x4FDA4402, 0x4FDA8402, 0x4FDAC402, 0x4FDB0402, 0x4FDB4402,
+    0x4FDB8402, 0x4FDBC402, 0x4FDC0402, 0x4FDC4402, 0x4FDC8402, 0x4FDCC402, 0x4FDD0402, 0x4FDD4402,
+    0x4FDD8402, 0x4FDDC402, 0x4FDE0402, 0x4FDE4402, 0x4FDE8402, 0x4FDEC402, 0x4FDF0402, 0x4FDF4402,
+    0x4FDF8402, 0x4FDFC402, 0x4FE00402, 0x4FE04402, 0x4FE08402, 0x4FE0C402, 0x4FE10402, 0x4FE14402,
+    0x4FE18402, 0x4FE1C402, 0x4FE20402, 0x4FE24402, 0x4FE28402, 0x4FE2C402, 0x4FE30402, 0x4FE34402,
+    0x4FE38402, 0x4FE3C402, 0x4FE40402, 0x4FE44402, 0x4FE48402, 0x4FE4C402, 0x4FE50402, 0x4FE54402,
+    0x4FE58402, 0x4FE5C402, 0x4FE60402, 0x4FE64402, 0x4FE68402, 0x4FE6C402, 0x4FE70402, 0x4FE74402,
+    0x4FE78402, 0x4FE7C402, 0x4FE80402, 0x4FE84402, 0x4FE88402, 0x4FE8C402, 0x4FE90402, 0x4FE94402,
+    0x4FE98402, 0x4FE9C402, 0x4FEA0402, 0x4FEA4402, 0x4FEA8402, 0x4FEAC402, 0x4FEB0402, 0x4FEB4402,
+    0x4FEB8402, 0x4FEBC402, 0x4FEC0402, 0x4FEC4402, 0x4FEC8402, 0x4FECC402, 0x4FED0402, 0x4FED4402,
+    0x4FED8402, 0x4FEDC402, 0x4FEE0402, 0x4FEE4402, 0x4FEE8402, 0x4FEEC402, 0x4FEF0402, 0x4FEF4402,
+    0x4FEF8402, 0x4FEFC402, 0x4FF00402, 0x4FF04402, 0x4FF08402, 0x4FF0C402, 0x4FF10402, 0x4FF14402,
+    0x4FF18402, 0x4FF1C402, 0x4FF20402, 0x4FF24402, 0x4FF28402, 0x4FF2C402, 0x4FF30402, 0x4FF34402,
+    0x4FF38402, 0x4FF3C402, 0x4FF40402, 0x4FF44402, 0x4FF48402, 0x4FF4C402, 0x4FF50402, 0x4FF54402,
+    0x4FF58402, 0x4FF5C402, 0x4FF60402, 0x4FF64402, 0x4FF68402, 0x4FF6C402, 0x4FF70402, 0x4FF74402,
+    0x4FF78402, 0x4FF7C402, 0x4FF80402, 0x4FF84402, 0x4FF88402, 0x4FF8C402, 0x4FF90402, 0x4FF94402,
+    0x4FF98402, 0x4FF9C402, 0x4FFA0402, 0x4FFA4402, 0x4FFA8402, 0x4FFAC402, 0x4FFB0402, 0x4FFB4402,
+    0x4FFB8402, 0x4FFBC402, 0x4FFC0402, 0x4FFC4402, 0x4FFC8402, 0x4FFCC402, 0x4FFD0402, 0x4FFD4402,
+    0x4FFD8402, 0x4FFDC402, 0x4FFE0402, 0x4FFE4402, 0x4FFE8402, 0x4FFEC402, 0x4FFF0402, 0x4FFF4402,
+    0x4FFF8402, 0x4FFFC402, 0x50000402, 0x50004402, 0x50008402, 0x5000C402, 0x50010402, 0x50014402,
+    0x50018402, 0x5001C402, 0x50020402, 0x50024402, 0x50028402, 0x5002C402, 0x50030402, 0x50034402,
+    0x50038402, 0x5003C402, 0x50040402, 0x50044402, 0x50048402, 0x5004C402, 0x50050402, 0x50054402,
+    0x50058402, 0x5005C402, 0x50060402, 0x50064402, 0x50068402, 0x5006C402, 0x50070402, 0x50074402,
+    0x50078402, 0x5007C402, 0x50080402, 0x50084402, 0x50088402, 0x5008C402, 0x50090402, 0x50094402,
+    0x50098402, 0x5009C402, 0x500A0402, 0x500A4402, 0x500A8402, 0x500AC402, 0x500B0402, 0x500B4402,
+    0x500B8402, 0x500BC402, 0x500C0402, 0x500C4402, 0x500C8402, 0x500CC402, 0x500D0402, 0x500D4402,
+    0x500D8402, 0x500DC402, 0x500E0402, 0x500E4402, 0x500E8402, 0x500EC402, 0x500F0402, 0x500F4402,
+    0x500F8402, 0x500FC402, 0x50100402, 0x50104402, 0x50108402, 0x5010C402, 0x50110402, 0x50114402,
+    0x50118402, 0x5011C402, 0x50120402, 0x50124402, 0x50128402, 0x5012C402, 0x50130402, 0x50134402,
+    0x50138402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53374402, 0x53378402, 0x5337C402, 0x53380402, 0x53384402, 0x53388402, 0x5338C402, 0x53390402,
+    0x53394402, 0x53398402, 0x5339C402, 0x533A0402, 0x533A4402, 0x533A8402, 0x533AC402, 0x533B0402,
+    0x533B4402, 0x533B8402, 0x533BC402, 0x533C0402, 0x533C4402, 0x533C8402, 0x533CC402, 0x533D0402,
+    0x533D4402, 0x533D8402, 0x533DC402, 0x533E0402, 0x533E4402, 0x533E8402, 0x533EC402, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x40B24402, 0x40B28402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x5013C402, 0x50140402, 0x50144402, 0x50148402, 0x5014C402, 0x50150402, 0x50154402, 0x50158402,
+    0x5015C402, 0x50160402, 0x50164402, 0x50168402, 0x5016C402, 0x50170402, 0x50174402, 0x50178402,
+    0x5017C402, 0x50180402, 0x50184402, 0x50188402, 0x5018C402, 0x50190402, 0x50194402, 0x50198402,
+    0x5019C402, 0x501A0402, 0x501A4402, 0x501A8402, 0x501AC402, 0x501B0402, 0x00000000, 0x00000000,
+    0x40001702, 0x40001722, 0x40001742, 0x40001762, 0x40001782, 0x40A3C402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52820402, 0x52824402, 0x52828402, 0x5282C402, 0x52830402, 0x52834402, 0x52838402, 0x5283C402,
+    0x52840402, 0x52844402, 0x52848402, 0x5284C402, 0x52850402, 0x52854402, 0x52858402, 0x5285C402,
+    0x52860402, 0x52864402, 0x52868402, 0x5286C402, 0x52870402, 0x52874402, 0x52878402, 0x5287C402,
+    0x52880402, 0x52884402, 0x52888402, 0x5288C402, 0x52890402, 0x52894402, 0x52898402, 0x5289C402,
+    0x528A0402, 0x528A4402, 0x528A8402, 0x528AC402, 0x528B0402, 0x528B4402, 0x528B8402, 0x528BC402,
+    0x528C0402, 0x528C4402, 0x528C8402, 0x528CC402, 0x528D0402, 0x528D4402, 0x528D8402, 0x528DC402,
+    0x40001EC2, 0x40001EE2, 0x40001F02, 0x40001F22, 0x40001F42, 0x40001F62, 0x40001F82, 0x4129C402,
+    0x412A0402, 0x412A4402, 0x412A8402, 0x412AC402, 0x44478402, 0x4447C402, 0x44480402, 0x44484402,
+    0x528E0402, 0x528E4402, 0x47D4C402, 0x47D50402, 0x412B0402, 0x44488402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x47A04402, 0x47A08402, 0x47A0C402, 0x47A10402, 0x47A14402,
+    0x47A18402, 0x47A1C402, 0x00000000, 0x528E8402, 0x528EC402, 0x528F0402, 0x528F4402, 0x528F8402,
+    0x528FC402, 0x52900402, 0x52904402, 0x52908402, 0x5290C402, 0x52910402, 0x52914402, 0x52918402,
+    0x5291C402, 0x52920402, 0x52924402, 0x52928402, 0x5292C402, 0x52930402, 0x52934402, 0x52938402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x5293C402, 0x52940402, 0x52944402,
+    0x52948402, 0x5294C402, 0x52950402, 0x52954402, 0x52958402, 0x5295C402, 0x52960402, 0x52964402,
+    0x52968402, 0x5296C402, 0x52970402, 0x52974402, 0x52978402, 0x5297C402, 0x52980402, 0x52984402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x504C8408, 0x504CC408, 0x504D0408, 0x504D4408, 0x504D8408, 0x504DC408, 0x504E0408, 0x504E4408,
+    0x504E8408, 0x504EC408, 0x504F0408, 0x504F4408, 0x504F8408, 0x504FC408, 0x50500408, 0x50504408,
+    0x50508408, 0x5050C408, 0x50510408, 0x50514408, 0x50518408, 0x5051C408, 0x50520408, 0x50524408,
+    0x50528408, 0x5052C408, 0x50530408, 0x50534408, 0x50538408, 0x5053C408, 0x50540408, 0x50544408,
+    0x504C8402, 0x504CC402, 0x504D0402, 0x504D4402, 0x504D8402, 0x504DC402, 0x504E0402, 0x504E4402,
+    0x504E8402, 0x504EC402, 0x504F0402, 0x504F4402, 0x504F8402, 0x504FC402, 0x50500402, 0x50504402,
+    0x50508402, 0x5050C402, 0x50510402, 0x50514402, 0x50518402, 0x5051C402, 0x50520402, 0x50524402,
+    0x50528402, 0x5052C402, 0x50530402, 0x50534402, 0x50538402, 0x5053C402, 0x50540402, 0x50544402,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47A20402, 0x47A24402, 0x47A28402, 0x47A2C402, 0x47A30402, 0x47A34402,
+    0x47A38402, 0x47A3C402, 0x47A40402, 0x47A44402, 0x80047962, 0x800479A2, 0x800479E2, 0x408D4402,
+    0x40A40402, 0x412B4402, 0x412B8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52474402, 0x52478402, 0x5247C402, 0x52480402, 0x52488402, 0x5248C402, 0x52488404, 0x52490402,
+    0x52494402, 0x52498402, 0x5249C402, 0x524A0402, 0x524A4402, 0x524A8402, 0x524B0402, 0x524B4402,
+    0x524BC402, 0x524C0402, 0x524C4402, 0x524BC404, 0x524C8402, 0x524CC402, 0x524D0402, 0x524D4402,
+    0x524D8402, 0x524DC402, 0x524E0402, 0x524E4402, 0x524E8402, 0x524EC402, 0x524F0402, 0x524F4402,
+    0x524F8402, 0x524FC402, 0x52500402, 0x52504402, 0x52508402, 0x52504404, 0x5250C402, 0x52510402,
+    0x52514402, 0x52518402, 0x5251C402, 0x52520402, 0x52524402, 0x52528402, 0x5252C402, 0x52530402,
+    0x52534402, 0x52538402, 0x5253C402, 0x52544402, 0x5254C402, 0x52550402, 0x52554402, 0x52558402,
+    0x5255C402, 0x52560402, 0x52568402, 0x5256C402, 0x52570402, 0x52574402, 0x52578402, 0x52574404,
+    0x5257C402, 0x52580402, 0x52584402, 0x52588402, 0x5258C402, 0x52484402, 0x52548402, 0x52540402,
+    0x524AC402, 0x52564402, 0x524B8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x525A0402,
+    0x52590402, 0x52594402, 0x52598402, 0x5259C402, 0x525A4402, 0x525A8402, 0x525AC402, 0x525B0402,
+    0x525B4402, 0x525BC402, 0x525C0402, 0x525C4402, 0x525C8402, 0x525D0402, 0x525D4402, 0x525D8402,
+    0x525DC402, 0x525E4402, 0x525E8402, 0x525EC402, 0x525F0402, 0x525F4402, 0x525FC402, 0x52600402,
+    0x52604402, 0x52608402, 0x5260C402, 0x52610402, 0x52614402, 0x52618402, 0x52624402, 0x52628402,
+    0x5262C402, 0x52630402, 0x52634402, 0x5263C402, 0x52640402, 0x5264C402, 0x52650402, 0x52654402,
+    0x52658402, 0x5265C402, 0x52660402, 0x52664402, 0x52668402, 0x5266C402, 0x52670402, 0x5261C402,
+    0x52638402, 0x525B8402, 0x52648402, 0x525CC402, 0x525E0402, 0x52644402, 0x525F8402, 0x52620402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x52674402,
+    0x52678402, 0x5267C402, 0x52680402, 0x52684402, 0x52688402, 0x5268C402, 0x52690402, 0x52694402,
+    0x52698402, 0x5269C402, 0x526A0402, 0x526A4402, 0x526A8402, 0x526AC402, 0x526B0402, 0x526B4402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47D64402, 0x47D68402, 0x408E4402, 0x47D6C402, 0x40000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x400020E2, 0x40002102, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005, 0x00000005,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003, 0x00000003,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x50B74411, 0x50C60402, 0x50C2C402, 0x50C30402, 0x50C34402, 0x50C38402, 0x50C3C402, 0x50C40402,
+    0x50C44402, 0x50C48402, 0x50C4C402, 0x50C50402, 0x50C54402, 0x50C58402, 0x50C5C402, 0x50C64402,
+    0x50C68402, 0x50C6C402, 0x50C70402, 0x50C74402, 0x50C78402, 0x50C7C402, 0x50C80402, 0x50C84402,
+    0x50C88402, 0x50C8C402, 0x50C90402, 0x50C94402, 0x50C98402, 0x50C9C402, 0x50CA0402, 0x50CA4402,
+    0x50CA8402, 0x50CAC402, 0x50CB0402, 0x50CB4402, 0x50CB8402, 0x50CBC402, 0x50CC0402, 0x50CC4402,
+    0x50CC8402, 0x50CCC402, 0x50CD0402, 0x50CD4402, 0x50CD8402, 0x50CDC402, 0x50CE0402, 0x50CE4402,
+    0x50CE8402, 0x50CEC402, 0x50CF0402, 0x50CF4402, 0x50CF8402, 0x50CFC402, 0x50D00402, 0x50D04402,
+    0x50D08402, 0x50D0C402, 0x50D10402, 0x50D14402, 0x50D18402, 0x50D1C402, 0x50D20402, 0x50D24402,
+    0x50D28402, 0x50D2C402, 0x50D30402, 0x50D34402, 0x50D38402, 0x50D3C402, 0x50D40402, 0x50D44402,
+    0x50D48402, 0x50D4C402, 0x50D50402, 0x50D54402, 0x50D58402, 0x50D5C402, 0x50D60402, 0x50D64402,
+    0x50D68402, 0x50D6C402, 0x50D70402, 0x50D74402, 0x50D78402, 0x50D7C402, 0x50D80402, 0x50D84402,
+    0x50D88402, 0x50D8C402, 0x50D90402, 0x50D94402, 0x50D98402, 0x50D9C402, 0x50DA0402, 0x50DA4402,
+    0x50DA8402, 0x50DAC402, 0x50DB0402, 0x50DB4402, 0x50DB8402, 0x50DBC402, 0x50DC0402, 0x50DC4402,
+    0x50DC8402, 0x50DCC402, 0x50DD0402, 0x50DD4402, 0x50DD8402, 0x50DDC402, 0x50DE0402, 0x50DE4402,
+    0x50DE8402, 0x50DEC402, 0x50DF0402, 0x50DF4402, 0x50DF8402, 0x50DFC402, 0x50E00402, 0x50E04402,
+    0x50E08402, 0x50E0C402, 0x50E10402, 0x50E14402, 0x50E18402, 0x50E1C402, 0x50E20402, 0x50E24402,
+    0x50E28402, 0x50E2C402, 0x50E30402, 0x50E34402, 0x50E38402, 0x50E3C402, 0x50E40402, 0x50E44402,
+    0x50E48402, 0x50E4C402, 0x50E50402, 0x50E54402, 0x50E58402, 0x50E5C402, 0x50E60402, 0x50E64402,
+    0x50E68402, 0x50E6C402, 0x50E70402, 0x50E74402, 0x50E78402, 0x50E7C402, 0x50E80402, 0x50E84402,
+    0x50E88402, 0x50E8C402, 0x50E90402, 0x50E94402, 0x50E98402, 0x50E9C402, 0x50EA0402, 0x50EA4402,
+    0x50EA8402, 0x50EAC402, 0x50EB0402, 0x50EB4402, 0x50EB8402, 0x50EBC402, 0x50EC0402, 0x50EC4402,
+    0x50EC8402, 0x50ECC402, 0x50ED0402, 0x50ED4402, 0x50ED8402, 0x50EDC402, 0x50EE0402, 0x50EE4402,
+    0x50EE8402, 0x50EEC402, 0x50EF0402, 0x50EF4402, 0x50EF8402, 0x50EFC402, 0x50F00402, 0x50F04402,
+    0x50F08402, 0x50F0C402, 0x50F10402, 0x50F14402, 0x50F18402, 0x50F1C402, 0x50F20402, 0x50F24402,
+    0x50F28402, 0x50F2C402, 0x50F30402, 0x50F34402, 0x50F38402, 0x50F3C402, 0x50F40402, 0x50F44402,
+    0x50F48402, 0x50F4C402, 0x50F50402, 0x50F54402, 0x50F58402, 0x50F5C402, 0x50F60402, 0x50F64402,
+    0x50F68402, 0x50F6C402, 0x50F70402, 0x50F74402, 0x50F78402, 0x50F7C402, 0x50F80402, 0x50F84402,
+    0x50F88402, 0x50F8C402, 0x50F90402, 0x50F94402, 0x50F98402, 0x50F9C402, 0x50FA0402, 0x50FA4402,
+    0x50FA8402, 0x50FAC402, 0x50FB0402, 0x50FB4402, 0x50FB8402, 0x50FBC402, 0x50FC0402, 0x50FC4402,
+    0x50FC8402, 0x50FCC402, 0x50FD0402, 0x50FD4402, 0x50FD8402, 0x50FDC402, 0x50FE0402, 0x50FE4402,
+    0x50FE8402, 0x50FEC402, 0x50FF0402, 0x50FF4402, 0x50FF8402, 0x50FFC402, 0x51000402, 0x51004402,
+    0x51008402, 0x5100C402, 0x51010402, 0x51014402, 0x51018402, 0x5101C402, 0x51020402, 0x51024402,
+    0x51028402, 0x5102C402, 0x51030402, 0x51034402, 0x51038402, 0x5103C402, 0x51040402, 0x51044402,
+    0x51048402, 0x5104C402, 0x51050402, 0x51054402, 0x51058402, 0x5105C402, 0x51060402, 0x51064402,
+    0x51068402, 0x5106C402, 0x51070402, 0x51074402, 0x51078402, 0x5107C402, 0x51080402, 0x51084402,
+    0x51088402, 0x5108C402, 0x51090402, 0x51094402, 0x51098402, 0x5109C402, 0x510A0402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x50C1C40D, 0x50C2040D, 0x50C2440D, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x50C1C40F, 0x50C2040F, 0x50C2440F, 0x50C2840F,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004, 0x00000004,
+    0x52EFC402, 0x52F00402, 0x52F04402, 0x52F08402, 0x52F0C402, 0x52F10402, 0x52F14402, 0x52F18402,
+    0x52F1C402, 0x52F20402, 0x52F24402, 0x52F28402, 0x52F2C402, 0x52F30402, 0x52F34402, 0x52F38402,
+    0x52F3C402, 0x52F40402, 0x52F44402, 0x52F48402, 0x52F4C402, 0x52F50402, 0x52F54402, 0x52F58402,
+    0x52F5C402, 0x52F60402, 0x52F64402, 0x52F68402, 0x52F6C402, 0x52F70402, 0x52F74402, 0x52F78402,
+    0x52F7C402, 0x52F80402, 0x52F84402, 0x52F88402, 0x52F8C402, 0x52F90402, 0x52F94402, 0x52F98402,
+    0x52F9C402, 0x52FA0402, 0x52FA4402, 0x52FA8402, 0x52FAC402, 0x52FB0402, 0x52FB4402, 0x52FB8402,
+    0x52FBC402, 0x52FC0402, 0x52FC4402, 0x52FC8402, 0x52FCC402, 0x52FD0402, 0x52FD4402, 0x52FD8402,
+    0x52FDC402, 0x52FE0402, 0x52FE4402, 0x52FE8402, 0x52FEC402, 0x52FF0402, 0x52FF4402, 0x52FF8402,
+    0x52FFC402, 0x53000402, 0x53004402, 0x53008402, 0x5300C402, 0x53010402, 0x53014402, 0x53018402,
+    0x5301C402, 0x53020402, 0x53024402, 0x53028402, 0x5302C402, 0x53030402, 0x53034402, 0x53038402,
+    0x5303C402, 0x53040402, 0x53044402, 0x53048402, 0x5304C402, 0x53050402, 0x53054402, 0x53058402,
+    0x5305C402, 0x53060402, 0x53064402, 0x53068402, 0x5306C402, 0x53070402, 0x53074402, 0x53078402,
+    0x5307C402, 0x53080402, 0x53084402, 0x53088402, 0x5308C402, 0x53090402, 0x53094402, 0x53098402,
+    0x5309C402, 0x530A0402, 0x530A4402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x530A8402, 0x530AC402, 0x530B0402, 0x530B4402, 0x530B8402, 0x530BC402, 0x530C0402, 0x530C4402,
+    0x530C8402, 0x530CC402, 0x530D0402, 0x530D4402, 0x530D8402, 0x00000000, 0x00000000, 0x00000000,
+    0x530DC402, 0x530E0402, 0x530E4402, 0x530E8402, 0x530EC402, 0x530F0402, 0x530F4402, 0x530F8402,
+    0x530FC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x53100402, 0x53104402, 0x53108402, 0x5310C402, 0x53110402, 0x53114402, 0x53118402, 0x5311C402,
+    0x53120402, 0x53124402, 0x00000000, 0x00000000, 0x44C50402, 0x40000662, 0x400006A2, 0x40A44402,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x44490402, 0x44494402, 0x44498402, 0x4449C402, 0x444A0402, 0x444A4402, 0x444A8402, 0x444AC402,
+    0x444B0402, 0x444B4402, 0x444B8402, 0x444BC402, 0x444C0402, 0x444C4402, 0x444C8402, 0x444CC402,
+    0x444D0402, 0x444D4402, 0x444D8402, 0x444DC402, 0x444E0402, 0x444E4402, 0x444E8402, 0x444EC402,
+    0x444F0402, 0x444F4402, 0x444F8402, 0x444FC402, 0x44500402, 0x44504402, 0x44508402, 0x4450C402,
+    0x44510402, 0x44514402, 0x44518402, 0x4451C402, 0x44520402, 0x44524402, 0x44528402, 0x4452C402,
+    0x44530402, 0x44534402, 0x44538402, 0x4453C402, 0x44540402, 0x44544402, 0x44548402, 0x4454C402,
+    0x44550402, 0x44554402, 0x44558402, 0x4455C402, 0x44560402, 0x44564402, 0x44568402, 0x4456C402,
+    0x44570402, 0x44574402, 0x44578402, 0x4457C402, 0x44580402, 0x44584402, 0x44588402, 0x4458C402,
+    0x44590402, 0x44594402, 0x44598402, 0x4459C402, 0x445A0402, 0x445A4402, 0x445A8402, 0x445AC402,
+    0x445B0402, 0x445B4402, 0x445B8402, 0x445BC402, 0x445C0402, 0x445C4402, 0x445C8402, 0x445CC402,
+    0x445D0402, 0x445D4402, 0x445D8402, 0x445DC402, 0x445E0402, 0x445E4402, 0x445E8402, 0x445EC402,
+    0x445F0402, 0x445F4402, 0x445F8402, 0x445FC402, 0x44600402, 0x44604402, 0x44608402, 0x4460C402,
+    0x44610402, 0x44614402, 0x44618402, 0x4461C402, 0x44620402, 0x44624402, 0x44628402, 0x4462C402,
+    0x44630402, 0x44634402, 0x44638402, 0x4463C402, 0x44640402, 0x44644402, 0x44648402, 0x4464C402,
+    0x44650402, 0x44654402, 0x44658402, 0x4465C402, 0x44660402, 0x44664402, 0x44668402, 0x4466C402,
+    0x44670402, 0x44674402, 0x44678402, 0x4467C402, 0x44680402, 0x44684402, 0x44688402, 0x4468C402,
+    0x44690402, 0x44694402, 0x44698402, 0x4469C402, 0x446A0402, 0x446A4402, 0x446A8402, 0x446AC402,
+    0x446B0402, 0x446B4402, 0x446B8402, 0x446BC402, 0x446C0402, 0x446C4402, 0x446C8402, 0x446CC402,
+    0x446D0402, 0x446D4402, 0x446D8402, 0x446DC402, 0x446E0402, 0x446E4402, 0x446E8402, 0x446EC402,
+    0x446F0402, 0x446F4402, 0x446F8402, 0x446FC402, 0x44700402, 0x44704402, 0x44708402, 0x4470C402,
+    0x44710402, 0x44714402, 0x44718402, 0x4471C402, 0x44720402, 0x44724402, 0x44728402, 0x4472C402,
+    0x44730402, 0x44734402, 0x44738402, 0x4473C402, 0x44740402, 0x44744402, 0x44748402, 0x4474C402,
+    0x44750402, 0x44754402, 0x44758402, 0x4475C402, 0x44760402, 0x44764402, 0x44768402, 0x4476C402,
+    0x44770402, 0x44774402, 0x44778402, 0x4477C402, 0x44780402, 0x44784402, 0x44788402, 0x4478C402,
+    0x44790402, 0x44794402, 0x44798402, 0x4479C402, 0x447A0402, 0x447A4402, 0x447A8402, 0x447AC402,
+    0x447B0402, 0x447B4402, 0x447B8402, 0x447BC402, 0x447C0402, 0x447C4402, 0x447C8402, 0x447CC402,
+    0x447D0402, 0x447D4402, 0x447D8402, 0x447DC402, 0x447E0402, 0x447E4402, 0x447E8402, 0x447EC402,
+    0x447F0402, 0x447F4402, 0x447F8402, 0x447FC402, 0x44800402, 0x44804402, 0x44808402, 0x4480C402,
+    0x44810402, 0x44814402, 0x44818402, 0x4481C402, 0x44820402, 0x44824402, 0x44828402, 0x4482C402,
+    0x44830402, 0x44834402, 0x44838402, 0x4483C402, 0x44840402, 0x44844402, 0x44848402, 0x4484C402,
+    0x44850402, 0x44854402, 0x44858402, 0x4485C402, 0x44860402, 0x44864402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x44868402, 0x4486C402, 0x44870402, 0x44874402, 0x44878402, 0x4487C402, 0x44880402, 0x44884402,
+    0x44888402, 0x4488C402, 0x44890402, 0x44894402, 0x44898402, 0x4489C402, 0x448A0402, 0x448A4402,
+    0x448A8402, 0x448AC402, 0x448B0402, 0x448B4402, 0x448B8402, 0x448BC402, 0x448C0402, 0x448C4402,
+    0x448C8402, 0x448CC402, 0x448D0402, 0x448D4402, 0x448D8402, 0x448DC402, 0x448E0402, 0x448E4402,
+    0x448E8402, 0x448EC402, 0x448F0402, 0x448F4402, 0x448F8402, 0x448FC402, 0x44900402, 0x00000000,
+    0x00000000, 0x44950402, 0x44910402, 0x44914402, 0x44918402, 0x4491C402, 0x44920402, 0x44924402,
+    0x44928402, 0x4492C402, 0x44930402, 0x44934402, 0x44938402, 0x4493C402, 0x44940402, 0x44944402,
+    0x44948402, 0x4494C402, 0x44954402, 0x44958402, 0x4495C402, 0x44960402, 0x44964402, 0x44968402,
+    0x4496C402, 0x44970402, 0x44974402, 0x44978402, 0x4497C402, 0x44980402, 0x44984402, 0x44988402,
+    0x4498C402, 0x44990402, 0x44994402, 0x44998402, 0x4499C402, 0x449A0402, 0x449A4402, 0x449A8402,
+    0x449AC402, 0x449B0402, 0x449B4402, 0x449B8402, 0x449BC402, 0x449C0402, 0x449C4402, 0x449C8402,
+    0x449CC402, 0x449D0402, 0x449D4402, 0x449D8402, 0x449DC402, 0x449E0402, 0x80047A22, 0x80047A62,
+    0x80047AA3, 0x80047AA3, 0x80047AA3, 0x80047AA3, 0x80047AA3, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x449E4402, 0x449E8402, 0x449EC402, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x449F0402, 0x449F4402, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x449F8402, 0x449FC402, 0x44A00402, 0x44A04402,
+    0x44A08402, 0x44A0C402, 0x44A10402, 0x44A14402, 0x44A18402, 0x44A1C402, 0x44A20402, 0x44A24402,
+    0x44A28402, 0x44A2C402, 0x44A30402, 0x44A34402, 0x44A38402, 0x44A3C402, 0x44A40402, 0x44A44402,
+    0x44A48402, 0x44A4C402, 0x44A50402, 0x44A54402, 0x44A58402, 0x44A5C402, 0x44A60402, 0x44A64402,
+    0x44A68402, 0x44A6C402, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x44A70402, 0x44A74402,
+    0x44A78402, 0x44A7C402, 0x44A80402, 0x44A84402, 0x44A88402, 0x44A8C402, 0x44A90402, 0x44A94402,
+    0x44A98402, 0x44A9C402, 0x44AA0402, 0x80047B02, 0x80047B42, 0x80047B83, 0x80047BE3, 0x80047B83,
+    0x80047BE3, 0x44AA4402, 0x44AA8402, 0x44AAC402, 0x44AB0402, 0x44AB4402, 0x44AB8402, 0x44ABC402,
+    0x44AC0402, 0x44AC4402, 0x44AC8402, 0x44ACC402, 0x44AD0402, 0x44AD4402, 0x44AD8402, 0x44ADC402,
+    0x44AE0402, 0x44AE4402, 0x44AE8402, 0x44AEC402, 0x44AF0402, 0x44AF4402, 0x44AF8402, 0x44AFC402,
+    0x44B00402, 0x44B04402, 0x44B08402, 0x44B0C402, 0x44B10402, 0x44B14402, 0x44B18402, 0x44B1C402,
+    0x44B20402, 0x44B24402, 0x44B28402, 0x44B2C402, 0x44B30402, 0x44B34402, 0x44B38402, 0x44B3C402,
+    0x44B40402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x44B44402, 0x44B48402, 0x44B4C402, 0x44B50402, 0x44B54402, 0x44B58402, 0x44B5C402, 0x44B60402,
+    0x44B64402, 0x44B68402, 0x44B6C402, 0x44B70402, 0x44B74402, 0x44B78402, 0x44B7C402, 0x44B80402,
+    0x44B84402, 0x44B88402, 0x44B8C402, 0x44B90402, 0x44B94402, 0x44B98402, 0x44B9C402, 0x44BA0402,
+    0x44BA4402, 0x44BA8402, 0x44BAC402, 0x44BB0402, 0x44BB4402, 0x44BB8402, 0x44BBC402, 0x44BC0402,
+    0x44BC4402, 0x44BC8402, 0x44BCC402, 0x44BD0402, 0x44BD4402, 0x44BD8402, 0x44BDC402, 0x44BE0402,
+    0x44BE4402, 0x44BE8402, 0x44BEC402, 0x44BF0402, 0x44BF4402, 0x44BF8402, 0x44BFC402, 0x44C00402,
+    0x44C04402, 0x44C08402, 0x44C0C402, 0x44C10402, 0x44C14402, 0x44C18402, 0x44C1C402, 0x44C20402,
+    0x44C24402, 0x44C28402, 0x44C2C402, 0x44C30402, 0x44C34402, 0x44C38402, 0x44C3C402, 0x44C40402,
+    0x44C44402, 0x44C48402, 0x40000000, 0x40000000, 0x40000000, 0x44C4C402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47A48402, 0x47A4C402, 0x47A50402, 0x47A54402, 0x47A58402, 0x47A5C402,
+    0x47A60402, 0x47A64402, 0x47A68402, 0x47A6C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x440D8402, 0x440DC402, 0x440E0402, 0x440E4402, 0x440E8402, 0x440EC402, 0x440F0402, 0x440F4402,
+    0x440F8402, 0x440FC402, 0x44100402, 0x44104402, 0x44108402, 0x4410C402, 0x44110402, 0x44114402,
+    0x44118402, 0x4411C402, 0x44120402, 0x44124402, 0x44128402, 0x4412C402, 0x44130402, 0x44134402,
+    0x44138402, 0x4413C402, 0x44140402, 0x44144402, 0x44148402, 0x4414C402, 0x44150402, 0x44154402,
+    0x44158402, 0x4415C402, 0x44160402, 0x44164402, 0x44168402, 0x4416C402, 0x44170402, 0x44174402,
+    0x44178402, 0x4417C402, 0x44180402, 0x44184402, 0x44188402, 0x4418C402, 0x44190402, 0x44194402,
+    0x44198402, 0x4419C402, 0x441A0402, 0x441A4402, 0x441A8402, 0x441AC402, 0x441B0402, 0x441B4402,
+    0x441B8402, 0x441BC402, 0x441C0402, 0x441C4402, 0x441C8402, 0x441CC402, 0x441D0402, 0x441D4402,
+    0x441D8402, 0x441DC402, 0x441E0402, 0x441E4402, 0x441E8402, 0x441EC402, 0x441F0402, 0x441F4402,
+    0x441F8402, 0x441FC402, 0x44200402, 0x44204402, 0x44208402, 0x4420C402, 0x44210402, 0x44214402,
+    0x44218402, 0x4421C402, 0x44220402, 0x44224402, 0x44228402, 0x4422C402, 0x44230402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402,
+    0x47E84402, 0x47CF4402, 0x47CF8402, 0x47CFC402, 0x47D00402, 0x47D04402, 0x47D08402, 0x47D0C402,
+    0x47D10402, 0x47D14402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E64402,
+    0x47E74402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B, 0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B,
+    0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B, 0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B,
+    0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B, 0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B,
+    0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405, 0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405,
+    0x48144405, 0x481D4405, 0x48240405, 0x482AC405, 0x48310405, 0x48358405, 0x48424405, 0x48460405,
+    0x484F0405, 0x485AC405, 0x48600405, 0x4864C405, 0x48748405, 0x487DC405, 0x4885C405, 0x4891C405,
+    0x48964405, 0x48990405, 0x489C0405, 0x48A18405, 0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B,
+    0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B, 0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B,
+    0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B, 0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B,
+    0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B, 0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405,
+    0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405, 0x48144405, 0x00000000, 0x48240405, 0x482AC405,
+    0x48310405, 0x48358405, 0x48424405, 0x48460405, 0x484F0405, 0x485AC405, 0x48600405, 0x4864C405,
+    0x48748405, 0x487DC405, 0x4885C405, 0x4891C405, 0x48964405, 0x48990405, 0x489C0405, 0x48A18405,
+    0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B, 0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B,
+    0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B, 0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B,
+    0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B, 0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B,
+    0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405, 0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405,
+    0x48144405, 0x481D4405, 0x48240405, 0x482AC405, 0x48310405, 0x48358405, 0x48424405, 0x48460405,
+    0x484F0405, 0x485AC405, 0x48600405, 0x4864C405, 0x48748405, 0x487DC405, 0x4885C405, 0x4891C405,
+    0x48964405, 0x48990405, 0x489C0405, 0x48A18405, 0x47E8840B, 0x00000000, 0x47F5840B, 0x47FAC40B,
+    0x00000000, 0x00000000, 0x4814440B, 0x00000000, 0x00000000, 0x482AC40B, 0x4831040B, 0x00000000,
+    0x00000000, 0x4846040B, 0x484F040B, 0x485AC40B, 0x4860040B, 0x00000000, 0x4874840B, 0x487DC40B,
+    0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B, 0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405,
+    0x47F58405, 0x47FAC405, 0x00000000, 0x48108405, 0x00000000, 0x481D4405, 0x48240405, 0x482AC405,
+    0x48310405, 0x48358405, 0x48424405, 0x48460405, 0x00000000, 0x485AC405, 0x48600405, 0x4864C405,
+    0x48748405, 0x487DC405, 0x4885C405, 0x4891C405, 0x48964405, 0x48990405, 0x489C0405, 0x48A18405,
+    0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B, 0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B,
+    0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B, 0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B,
+    0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B, 0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B,
+    0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405, 0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405,
+    0x48144405, 0x481D4405, 0x48240405, 0x482AC405, 0x48310405, 0x48358405, 0x48424405, 0x48460405,
+    0x484F0405, 0x485AC405, 0x48600405, 0x4864C405, 0x48748405, 0x487DC405, 0x4885C405, 0x4891C405,
+    0x48964405, 0x48990405, 0x489C0405, 0x48A18405, 0x47E8840B, 0x47EF040B, 0x00000000, 0x47FAC40B,
+    0x4801C40B, 0x4810840B, 0x4814440B, 0x00000000, 0x00000000, 0x482AC40B, 0x4831040B, 0x4835840B,
+    0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B, 0x4860040B, 0x00000000, 0x4874840B, 0x487DC40B,
+    0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B, 0x489C040B, 0x00000000, 0x47E88405, 0x47EF0405,
+    0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405, 0x48144405, 0x481D4405, 0x48240405, 0x482AC405,
+    0x48310405, 0x48358405, 0x48424405, 0x48460405, 0x484F0405, 0x485AC405, 0x48600405, 0x4864C405,
+    0x48748405, 0x487DC405, 0x4885C405, 0x4891C405, 0x48964405, 0x48990405, 0x489C0405, 0x48A18405,
+    0x47E8840B, 0x47EF040B, 0x00000000, 0x47FAC40B, 0x4801C40B, 0x4810840B, 0x4814440B, 0x00000000,
+    0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B, 0x4842440B, 0x00000000, 0x484F040B, 0x00000000,
+    0x00000000, 0x00000000, 0x4874840B, 0x487DC40B, 0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B,
+    0x489C040B, 0x00000000, 0x47E88405, 0x47EF0405, 0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405,
+    0x48144405, 0x481D4405, 0x48240405, 0x482AC405, 0x48310405, 0x48358405, 0x48424405, 0x48460405,
+    0x484F0405, 0x485AC405, 0x48600405, 0x4864C405, 0x48748405, 0x487DC405, 0x4885C405, 0x4891C405,
+    0x48964405, 0x48990405, 0x489C0405, 0x48A18405, 0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B,
+    0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B, 0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B,
+    0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B, 0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B,
+    0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B, 0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405,
+    0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405, 0x48144405, 0x481D4405, 0x48240405, 0x482AC405,
+    0x48310405, 0x48358405, 0x48424405, 0x48460405, 0x484F0405, 0x485AC405, 0x48600405, 0x4864C405,
+    0x48748405, 0x487DC405, 0x4885C405, 0x4891C405, 0x48964405, 0x48990405, 0x489C0405, 0x48A18405,
+    0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B, 0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B,
+    0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B, 0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B,
+    0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B, 0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B,
+    0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405, 0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405,
+    0x48144405, 0x481D4405, 0x48240405, 0x482AC405, 0x48310405, 0x48358405, 0x48424405, 0x48460405,
+    0x484F0405, 0x485AC405, 0x48600405, 0x4864C405, 0x48748405, 0x487DC405, 0x4885C405, 0x4891C405,
+    0x48964405, 0x48990405, 0x489C0405, 0x48A18405, 0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B,
+    0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B, 0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B,
+    0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B, 0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B,
+    0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B, 0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405,
+    0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405, 0x48144405, 0x481D4405, 0x48240405, 0x482AC405,
+    0x48310405, 0x48358405, 0x48424405, 0x48460405, 0x484F0405, 0x485AC405, 0x48600405, 0x4864C405,
+    0x48748405, 0x487DC405, 0x4885C405, 0x4891C405, 0x48964405, 0x48990405, 0x489C0405, 0x48A18405,
+    0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B, 0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B,
+    0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B, 0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B,
+    0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B, 0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B,
+    0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405, 0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405,
+    0x48144405, 0x481D4405, 0x48240405, 0x482AC405, 0x48310405, 0x48358405, 0x48424405, 0x48460405,
+    0x484F0405, 0x485AC405, 0x48600405, 0x4864C405, 0x48748405, 0x487DC405, 0x4885C405, 0x4891C405,
+    0x48964405, 0x48990405, 0x489C0405, 0x48A18405, 0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B,
+    0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B, 0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B,
+    0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B, 0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B,
+    0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B, 0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405,
+    0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405, 0x48144405, 0x481D4405, 0x48240405, 0x482AC405,
+    0x48310405, 0x48358405, 0x48424405, 0x48460405, 0x484F0405, 0x485AC405, 0x48600405, 0x4864C405,
+    0x48748405, 0x487DC405, 0x4885C405, 0x4891C405, 0x48964405, 0x48990405, 0x489C0405, 0x48A18405,
+    0x47E8840B, 0x47EF040B, 0x47F5840B, 0x47FAC40B, 0x4801C40B, 0x4810840B, 0x4814440B, 0x481D440B,
+    0x4824040B, 0x482AC40B, 0x4831040B, 0x4835840B, 0x4842440B, 0x4846040B, 0x484F040B, 0x485AC40B,
+    0x4860040B, 0x4864C40B, 0x4874840B, 0x487DC40B, 0x4885C40B, 0x4891C40B, 0x4896440B, 0x4899040B,
+    0x489C040B, 0x48A1840B, 0x47E88405, 0x47EF0405, 0x47F58405, 0x47FAC405, 0x4801C405, 0x48108405,
+    0x48144405, 0x481D4405, 0x48240405, 0x482AC405, 0x48310405, 0x48358405, 0x48424405, 0x48460405,
+    0x484F0405, 0x485AC405, 0x48600405, 0x4864C405, 0x48748405, 0x487DC405, 0x4885C405, 0x4891C405,
+    0x48964405, 0x48990405, 0x489C0405, 0x48A18405, 0x48250405, 0x482BC405, 0x00000000, 0x00000000,
+    0x48C7840B, 0x48C7C40B, 0x48C8040B, 0x48C8840B, 0x48C8C40B, 0x48C9C40B, 0x48CA440B, 0x48CA840B,
+    0x48CAC40B, 0x48CB440B, 0x48CB840B, 0x48CC040B, 0x48CC440B, 0x48CC840B, 0x48CCC40B, 0x48CD040B,
+    0x48CE440B, 0x48CA840B, 0x48CF040B, 0x48D0040B, 0x48D0440B, 0x48D0840B, 0x48D0C40B, 0x48D1040B,
+    0x48D1840B, 0x41970405, 0x48C78405, 0x48C7C405, 0x48C80405, 0x48C88405, 0x48C8C405, 0x48C9C405,
+    0x48CA4405, 0x48CA8405, 0x48CAC405, 0x48CB4405, 0x48CB8405, 0x48CC0405, 0x48CC4405, 0x48CC8405,
+    0x48CCC405, 0x48CD0405, 0x48CE4405, 0x48CF0405, 0x48CF0405, 0x48D00405, 0x48D04405, 0x48D08405,
+    0x48D0C405, 0x48D10405, 0x48D18405, 0x41960405, 0x48C8C405, 0x48CA8405, 0x48CB4405, 0x48D08405,
+    0x48CE4405, 0x48CD0405, 0x48C7840B, 0x48C7C40B, 0x48C8040B, 0x48C8840B, 0x48C8C40B, 0x48C9C40B,
+    0x48CA440B, 0x48CA840B, 0x48CAC40B, 0x48CB440B, 0x48CB840B, 0x48CC040B, 0x48CC440B, 0x48CC840B,
+    0x48CCC40B, 0x48CD040B, 0x48CE440B, 0x48CA840B, 0x48CF040B, 0x48D0040B, 0x48D0440B, 0x48D0840B,
+    0x48D0C40B, 0x48D1040B, 0x48D1840B, 0x41970405, 0x48C78405, 0x48C7C405, 0x48C80405, 0x48C88405,
+    0x48C8C405, 0x48C9C405, 0x48CA4405, 0x48CA8405, 0x48CAC405, 0x48CB4405, 0x48CB8405, 0x48CC0405,
+    0x48CC4405, 0x48CC8405, 0x48CCC405, 0x48CD0405, 0x48CE4405, 0x48CF0405, 0x48CF0405, 0x48D00405,
+    0x48D04405, 0x48D08405, 0x48D0C405, 0x48D10405, 0x48D18405, 0x41960405, 0x48C8C405, 0x48CA8405,
+    0x48CB4405, 0x48D08405, 0x48CE4405, 0x48CD0405, 0x48C7840B, 0x48C7C40B, 0x48C8040B, 0x48C8840B,
+    0x48C8C40B, 0x48C9C40B, 0x48CA440B, 0x48CA840B, 0x48CAC40B, 0x48CB440B, 0x48CB840B, 0x48CC040B,
+    0x48CC440B, 0x48CC840B, 0x48CCC40B, 0x48CD040B, 0x48CE440B, 0x48CA840B, 0x48CF040B, 0x48D0040B,
+    0x48D0440B, 0x48D0840B, 0x48D0C40B, 0x48D1040B, 0x48D1840B, 0x41970405, 0x48C78405, 0x48C7C405,
+    0x48C80405, 0x48C88405, 0x48C8C405, 0x48C9C405, 0x48CA4405, 0x48CA8405, 0x48CAC405, 0x48CB4405,
+    0x48CB8405, 0x48CC0405, 0x48CC4405, 0x48CC8405, 0x48CCC405, 0x48CD0405, 0x48CE4405, 0x48CF0405,
+    0x48CF0405, 0x48D00405, 0x48D04405, 0x48D08405, 0x48D0C405, 0x48D10405, 0x48D18405, 0x41960405,
+    0x48C8C405, 0x48CA8405, 0x48CB4405, 0x48D08405, 0x48CE4405, 0x48CD0405, 0x48C7840B, 0x48C7C40B,
+    0x48C8040B, 0x48C8840B, 0x48C8C40B, 0x48C9C40B, 0x48CA440B, 0x48CA840B, 0x48CAC40B, 0x48CB440B,
+    0x48CB840B, 0x48CC040B, 0x48CC440B, 0x48CC840B, 0x48CCC40B, 0x48CD040B, 0x48CE440B, 0x48CA840B,
+    0x48CF040B, 0x48D0040B, 0x48D0440B, 0x48D0840B, 0x48D0C40B, 0x48D1040B, 0x48D1840B, 0x41970405,
+    0x48C78405, 0x48C7C405, 0x48C80405, 0x48C88405, 0x48C8C405, 0x48C9C405, 0x48CA4405, 0x48CA8405,
+    0x48CAC405, 0x48CB4405, 0x48CB8405, 0x48CC0405, 0x48CC4405, 0x48CC8405, 0x48CCC405, 0x48CD0405,
+    0x48CE4405, 0x48CF0405, 0x48CF0405, 0x48D00405, 0x48D04405, 0x48D08405, 0x48D0C405, 0x48D10405,
+    0x48D18405, 0x41960405, 0x48C8C405, 0x48CA8405, 0x48CB4405, 0x48D08405, 0x48CE4405, 0x48CD0405,
+    0x48C7840B, 0x48C7C40B, 0x48C8040B, 0x48C8840B, 0x48C8C40B, 0x48C9C40B, 0x48CA440B, 0x48CA840B,
+    0x48CAC40B, 0x48CB440B, 0x48CB840B, 0x48CC040B, 0x48CC440B, 0x48CC840B, 0x48CCC40B, 0x48CD040B,
+    0x48CE440B, 0x48CA840B, 0x48CF040B, 0x48D0040B, 0x48D0440B, 0x48D0840B, 0x48D0C40B, 0x48D1040B,
+    0x48D1840B, 0x41970405, 0x48C78405, 0x48C7C405, 0x48C80405, 0x48C88405, 0x48C8C405, 0x48C9C405,
+    0x48CA4405, 0x48CA8405, 0x48CAC405, 0x48CB4405, 0x48CB8405, 0x48CC0405, 0x48CC4405, 0x48CC8405,
+    0x48CCC405, 0x48CD0405, 0x48CE4405, 0x48CF0405, 0x48CF0405, 0x48D00405, 0x48D04405, 0x48D08405,
+    0x48D0C405, 0x48D10405, 0x48D18405, 0x41960405, 0x48C8C405, 0x48CA8405, 0x48CB4405, 0x48D08405,
+    0x48CE4405, 0x48CD0405, 0x48C9040B, 0x48C90405, 0x00000000, 0x00000000, 0x47E60405, 0x47E64405,
+    0x47E68405, 0x47E6C405, 0x47E70405, 0x47E74405, 0x47E78405, 0x47E7C405, 0x47E80405, 0x47E84405,
+    0x47E60405, 0x47E64405, 0x47E68405, 0x47E6C405, 0x47E70405, 0x47E74405, 0x47E78405, 0x47E7C405,
+    0x47E80405, 0x47E84405, 0x47E60405, 0x47E64405, 0x47E68405, 0x47E6C405, 0x47E70405, 0x47E74405,
+    0x47E78405, 0x47E7C405, 0x47E80405, 0x47E84405, 0x47E60405, 0x47E64405, 0x47E68405, 0x47E6C405,
+    0x47E70405, 0x47E74405, 0x47E78405, 0x47E7C405, 0x47E80405, 0x47E84405, 0x47E60405, 0x47E64405,
+    0x47E68405, 0x47E6C405, 0x47E70405, 0x47E74405, 0x47E78405, 0x47E7C405, 0x47E80405, 0x47E84405,
+    0x46BFC402, 0x46C00402, 0x46C04402, 0x46C08402, 0x46C0C402, 0x46C10402, 0x46C14402, 0x46C18402,
+    0x46C1C402, 0x46C20402, 0x46C24402, 0x46C28402, 0x46C2C402, 0x46C30402, 0x46C34402, 0x46C38402,
+    0x46C3C402, 0x46C40402, 0x46C44402, 0x46C48402, 0x46C4C402, 0x46C50402, 0x46C54402, 0x46C58402,
+    0x46C5C402, 0x46C60402, 0x46C64402, 0x46C68402, 0x46C6C402, 0x46C70402, 0x46C74402, 0x46C78402,
+    0x46C7C402, 0x46C80402, 0x46C84402, 0x46C88402, 0x46C8C402, 0x46C90402, 0x46C94402, 0x46C98402,
+    0x46C9C402, 0x46CA0402, 0x46CA4402, 0x46CA8402, 0x46CAC402, 0x46CB0402, 0x46CB4402, 0x46CB8402,
+    0x46CBC402, 0x46CC0402, 0x46CC4402, 0x46CC8402, 0x46CCC402, 0x46CD0402, 0x46CD4402, 0x46CD8402,
+    0x46CDC402, 0x46CE0402, 0x46CE4402, 0x46CE8402, 0x46CEC402, 0x46CF0402, 0x46CF4402, 0x46CF8402,
+    0x46CFC402, 0x46D00402, 0x46D04402, 0x46D08402, 0x46D0C402, 0x46D10402, 0x46D14402, 0x46D18402,
+    0x46D1C402, 0x46D20402, 0x46D24402, 0x46D28402, 0x46D2C402, 0x46D30402, 0x46D34402, 0x46D38402,
+    0x46D3C402, 0x46D40402, 0x46D44402, 0x46D48402, 0x46D4C402, 0x46D50402, 0x46D54402, 0x46D58402,
+    0x46D5C402, 0x46D60402, 0x46D64402, 0x46D68402, 0x46D6C402, 0x46D70402, 0x46D74402, 0x46D78402,
+    0x46D7C402, 0x46D80402, 0x46D84402, 0x46D88402, 0x46D8C402, 0x46D90402, 0x46D94402, 0x46D98402,
+    0x46D9C402, 0x46DA0402, 0x46DA4402, 0x46DA8402, 0x46DAC402, 0x46DB0402, 0x46DB4402, 0x46DB8402,
+    0x46DBC402, 0x46DC0402, 0x46DC4402, 0x46DC8402, 0x46DCC402, 0x46DD0402, 0x46DD4402, 0x46DD8402,
+    0x46DDC402, 0x46DE0402, 0x46DE4402, 0x46DE8402, 0x46DEC402, 0x46DF0402, 0x46DF4402, 0x46DF8402,
+    0x46DFC402, 0x46E00402, 0x46E04402, 0x46E08402, 0x46E0C402, 0x46E10402, 0x46E14402, 0x46E18402,
+    0x46E1C402, 0x46E20402, 0x46E24402, 0x46E28402, 0x46E2C402, 0x46E30402, 0x46E34402, 0x46E38402,
+    0x46E3C402, 0x46E40402, 0x46E44402, 0x46E48402, 0x46E4C402, 0x46E50402, 0x46E54402, 0x46E58402,
+    0x46E5C402, 0x46E60402, 0x46E64402, 0x46E68402, 0x46E6C402, 0x46E70402, 0x46E74402, 0x46E78402,
+    0x46E7C402, 0x46E80402, 0x46E84402, 0x46E88402, 0x46E8C402, 0x46E90402, 0x46E94402, 0x46E98402,
+    0x46E9C402, 0x46EA0402, 0x46EA4402, 0x46EA8402, 0x46EAC402, 0x46EB0402, 0x46EB4402, 0x46EB8402,
+    0x46EBC402, 0x46EC0402, 0x46EC4402, 0x46EC8402, 0x46ECC402, 0x46ED0402, 0x46ED4402, 0x46ED8402,
+    0x46EDC402, 0x46EE0402, 0x46EE4402, 0x46EE8402, 0x46EEC402, 0x46EF0402, 0x46EF4402, 0x46EF8402,
+    0x46EFC402, 0x46F00402, 0x46F04402, 0x46F08402, 0x46F0C402, 0x46F10402, 0x46F14402, 0x46F18402,
+    0x46F1C402, 0x46F20402, 0x46F24402, 0x46F28402, 0x46F2C402, 0x46F30402, 0x46F34402, 0x46F38402,
+    0x46F3C402, 0x46F40402, 0x46F44402, 0x46F48402, 0x46F4C402, 0x46F50402, 0x46F54402, 0x46F58402,
+    0x46F5C402, 0x46F60402, 0x46F64402, 0x46F68402, 0x46F6C402, 0x46F70402, 0x46F74402, 0x46F78402,
+    0x46F7C402, 0x46F80402, 0x46F84402, 0x46F88402, 0x46F8C402, 0x46F90402, 0x46F94402, 0x46F98402,
+    0x46F9C402, 0x46FA0402, 0x46FA4402, 0x46FA8402, 0x46FAC402, 0x46FB0402, 0x46FB4402, 0x46FB8402,
+    0x46FBC402, 0x46FC0402, 0x46FC4402, 0x46FC8402, 0x46FCC402, 0x46FD0402, 0x46FD4402, 0x46FD8402,
+    0x46FDC402, 0x46FE0402, 0x46FE4402, 0x46FE8402, 0x46FEC402, 0x46FF0402, 0x46FF4402, 0x46FF8402,
+    0x46FFC402, 0x47000402, 0x47004402, 0x47008402, 0x4700C402, 0x47010402, 0x47014402, 0x47018402,
+    0x4701C402, 0x47020402, 0x47024402, 0x47028402, 0x4702C402, 0x47030402, 0x47034402, 0x47038402,
+    0x4703C402, 0x47040402, 0x47044402, 0x47048402, 0x4704C402, 0x47050402, 0x47054402, 0x47058402,
+    0x4705C402, 0x47060402, 0x47064402, 0x47068402, 0x4706C402, 0x47070402, 0x47074402, 0x47078402,
+    0x4707C402, 0x47080402, 0x47084402, 0x47088402, 0x4708C402, 0x47090402, 0x47094402, 0x47098402,
+    0x4709C402, 0x470A0402, 0x470A4402, 0x470A8402, 0x470AC402, 0x470B0402, 0x470B4402, 0x470B8402,
+    0x470BC402, 0x470C0402, 0x470C4402, 0x470C8402, 0x470CC402, 0x470D0402, 0x470D4402, 0x470D8402,
+    0x470DC402, 0x470E0402, 0x470E4402, 0x470E8402, 0x470EC402, 0x470F0402, 0x470F4402, 0x470F8402,
+    0x470FC402, 0x47100402, 0x47104402, 0x47108402, 0x4710C402, 0x47110402, 0x47114402, 0x47118402,
+    0x4711C402, 0x47120402, 0x47124402, 0x47128402, 0x4712C402, 0x47130402, 0x47134402, 0x47138402,
+    0x4713C402, 0x47140402, 0x47144402, 0x47148402, 0x4714C402, 0x47150402, 0x47154402, 0x47158402,
+    0x4715C402, 0x47160402, 0x47164402, 0x47168402, 0x4716C402, 0x47170402, 0x47174402, 0x47178402,
+    0x4717C402, 0x47180402, 0x47184402, 0x47188402, 0x4718C402, 0x47190402, 0x47194402, 0x47198402,
+    0x4719C402, 0x471A0402, 0x471A4402, 0x471A8402, 0x471AC402, 0x471B0402, 0x471B4402, 0x471B8402,
+    0x471BC402, 0x471C0402, 0x471C4402, 0x471C8402, 0x471CC402, 0x471D0402, 0x471D4402, 0x471D8402,
+    0x471DC402, 0x471E0402, 0x471E4402, 0x471E8402, 0x471EC402, 0x471F0402, 0x471F4402, 0x471F8402,
+    0x471FC402, 0x47200402, 0x47204402, 0x47208402, 0x4720C402, 0x47210402, 0x47214402, 0x47218402,
+    0x4721C402, 0x47220402, 0x47224402, 0x47228402, 0x4722C402, 0x47230402, 0x47234402, 0x47238402,
+    0x4723C402, 0x47240402, 0x47244402, 0x47248402, 0x4724C402, 0x47250402, 0x47254402, 0x47258402,
+    0x4725C402, 0x47260402, 0x47264402, 0x47268402, 0x4726C402, 0x47270402, 0x47274402, 0x47278402,
+    0x4727C402, 0x47280402, 0x47284402, 0x47288402, 0x4728C402, 0x47290402, 0x47294402, 0x47298402,
+    0x4729C402, 0x472A0402, 0x472A4402, 0x472A8402, 0x472AC402, 0x472B0402, 0x472B4402, 0x472B8402,
+    0x472BC402, 0x472C0402, 0x472C4402, 0x472C8402, 0x472CC402, 0x472D0402, 0x472D4402, 0x472D8402,
+    0x472DC402, 0x472E0402, 0x472E4402, 0x472E8402, 0x472EC402, 0x472F0402, 0x472F4402, 0x472F8402,
+    0x472FC402, 0x47300402, 0x47304402, 0x47308402, 0x4730C402, 0x47310402, 0x47314402, 0x47318402,
+    0x4731C402, 0x47320402, 0x47324402, 0x47328402, 0x4732C402, 0x47330402, 0x47334402, 0x47338402,
+    0x4733C402, 0x47340402, 0x47344402, 0x47348402, 0x4734C402, 0x47350402, 0x47354402, 0x47358402,
+    0x4735C402, 0x47360402, 0x47364402, 0x47368402, 0x4736C402, 0x47370402, 0x47374402, 0x47378402,
+    0x4737C402, 0x47380402, 0x47384402, 0x47388402, 0x4738C402, 0x47390402, 0x47394402, 0x47398402,
+    0x4739C402, 0x473A0402, 0x473A4402, 0x473A8402, 0x473AC402, 0x473B0402, 0x473B4402, 0x473B8402,
+    0x473BC402, 0x473C0402, 0x473C4402, 0x473C8402, 0x473CC402, 0x473D0402, 0x473D4402, 0x473D8402,
+    0x473DC402, 0x473E0402, 0x473E4402, 0x473E8402, 0x473EC402, 0x473F0402, 0x473F4402, 0x473F8402,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x473FC402,
+    0x47400402, 0x47404402, 0x47408402, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x4740C402, 0x47410402, 0x47414402,
+    0x47418402, 0x4741C402, 0x47420402, 0x47424402, 0x47428402, 0x40000000, 0x4742C402, 0x47430402,
+    0x47434402, 0x47438402, 0x4743C402, 0x47440402, 0x47444402, 0x47448402, 0x4744C402, 0x47450402,
+    0x47454402, 0x47458402, 0x4745C402, 0x47460402, 0x40000000, 0x47464402, 0x47468402, 0x412BC402,
+    0x412C0402, 0x412C4402, 0x412C8402, 0x412CC402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x00000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x49528404, 0x4952C404, 0x49530404, 0x49534404, 0x49538404, 0x4953C404, 0x49540404, 0x00000000,
+    0x49548404, 0x4954C404, 0x49550404, 0x49554404, 0x49558404, 0x4955C404, 0x49560404, 0x49564404,
+    0x49568404, 0x4956C404, 0x49570404, 0x49574404, 0x49578404, 0x4957C404, 0x49580404, 0x49584404,
+    0x49588404, 0x00000000, 0x00000000, 0x49594404, 0x49598404, 0x4959C404, 0x495A0404, 0x495A4404,
+    0x495A8404, 0x495AC404, 0x00000000, 0x495B4404, 0x495B8404, 0x00000000, 0x495C0404, 0x495C4404,
+    0x495C8404, 0x495CC404, 0x495D0404, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52988402, 0x5298C402, 0x52990402, 0x52994402, 0x52998402, 0x5299C402, 0x529A0402, 0x529A4402,
+    0x529A8402, 0x529AC402, 0x529B0402, 0x529B4402, 0x529B8402, 0x529BC402, 0x529C0402, 0x529C4402,
+    0x529C8402, 0x529CC402, 0x529D0402, 0x529D4402, 0x529D8402, 0x529DC402, 0x529E0402, 0x529E4402,
+    0x529E8402, 0x529EC402, 0x529F0402, 0x529F4402, 0x529F8402, 0x529FC402, 0x52A00402, 0x52A04402,
+    0x52A08402, 0x52A0C402, 0x52A10402, 0x52A14402, 0x52A18402, 0x52A1C402, 0x52A20402, 0x52A24402,
+    0x52A28402, 0x52A2C402, 0x52A30402, 0x52A34402, 0x52A38402, 0x00000000, 0x00000000, 0x00000000,
+    0x40001F42, 0x40001EC2, 0x40001F02, 0x40001F22, 0x40001F62, 0x40001F82, 0x40001EE2, 0x52A3C402,
+    0x52A40402, 0x52A44402, 0x52A48402, 0x52A4C402, 0x47D54402, 0x47D58402, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x52A50402, 0x4448C402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x52A54402, 0x52A58402, 0x52A5C402, 0x52A60402, 0x52A64402, 0x52A68402, 0x52A6C402, 0x52A70402,
+    0x52A74402, 0x52A78402, 0x52A7C402, 0x52A80402, 0x52A84402, 0x52A88402, 0x52A8C402, 0x52A90402,
+    0x52A94402, 0x52A98402, 0x52A9C402, 0x52AA0402, 0x52AA4402, 0x52AA8402, 0x52AAC402, 0x52AB0402,
+    0x52AB4402, 0x52AB8402, 0x52ABC402, 0x52AC0402, 0x52AC4402, 0x52AC8402, 0x52ACC402, 0x52AD0402,
+    0x52AD4402, 0x52AD8402, 0x52ADC402, 0x52AE0402, 0x52AE4402, 0x52AE8402, 0x52AEC402, 0x52AF0402,
+    0x52AF4402, 0x52AF8402, 0x52AFC402, 0x52B00402, 0x40001FA2, 0x40001FC2, 0x40001FE2, 0x40002002,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x47DDC402,
+    0x501B4402, 0x501B8402, 0x501BC402, 0x501C0402, 0x501C4402, 0x501C8402, 0x501CC402, 0x501D0402,
+    0x501D4402, 0x501D8402, 0x501DC402, 0x501E0402, 0x501E4402, 0x501E8402, 0x501EC402, 0x501F0402,
+    0x501F4402, 0x501F8402, 0x501FC402, 0x50200402, 0x50204402, 0x50208402, 0x5020C402, 0x50210402,
+    0x50214402, 0x50218402, 0x5021C402, 0x50220402, 0x50224402, 0x50228402, 0x5022C402, 0x50230402,
+    0x50234402, 0x50238402, 0x5023C402, 0x50240402, 0x50244402, 0x50248402, 0x5024C402, 0x50250402,
+    0x50254402, 0x50258402, 0x5025C402, 0x50260402, 0x50264402, 0x50268402, 0x5026C402, 0x50270402,
+    0x50274402, 0x50278402, 0x5027C402, 0x50280402, 0x50284402, 0x50288402, 0x5028C402, 0x50290402,
+    0x50294402, 0x50298402, 0x5029C402, 0x502A0402, 0x502A4402, 0x502A8402, 0x502AC402, 0x502B0402,
+    0x502B4402, 0x502B8402, 0x502BC402, 0x502C0402, 0x502C4402, 0x502C8402, 0x502CC402, 0x502D0402,
+    0x502D4402, 0x502D8402, 0x502DC402, 0x502E0402, 0x502E4402, 0x502E8402, 0x502EC402, 0x502F0402,
+    0x502F4402, 0x502F8402, 0x502FC402, 0x50300402, 0x50304402, 0x50308402, 0x5030C402, 0x50310402,
+    0x50314402, 0x50318402, 0x5031C402, 0x50320402, 0x50324402, 0x50328402, 0x5032C402, 0x50330402,
+    0x50334402, 0x50338402, 0x5033C402, 0x50340402, 0x50344402, 0x50348402, 0x5034C402, 0x50350402,
+    0x50354402, 0x50358402, 0x5035C402, 0x50360402, 0x50364402, 0x50368402, 0x5036C402, 0x50370402,
+    0x50374402, 0x50378402, 0x5037C402, 0x50380402, 0x50384402, 0x50388402, 0x5038C402, 0x50390402,
+    0x50394402, 0x50398402, 0x5039C402, 0x503A0402, 0x503A4402, 0x503A8402, 0x503AC402, 0x503B0402,
+    0x503B4402, 0x503B8402, 0x503BC402, 0x503C0402, 0x503C4402, 0x503C8402, 0x503CC402, 0x503D0402,
+    0x503D4402, 0x503D8402, 0x503DC402, 0x503E0402, 0x503E4402, 0x503E8402, 0x503EC402, 0x503F0402,
+    0x503F4402, 0x503F8402, 0x503FC402, 0x50400402, 0x50404402, 0x50408402, 0x5040C402, 0x50410402,
+    0x50414402, 0x50418402, 0x5041C402, 0x50420402, 0x50424402, 0x50428402, 0x5042C402, 0x50430402,
+    0x50434402, 0x50438402, 0x5043C402, 0x50440402, 0x50444402, 0x50448402, 0x5044C402, 0x50450402,
+    0x50454402, 0x50458402, 0x5045C402, 0x50460402, 0x50464402, 0x50468402, 0x5046C402, 0x50470402,
+    0x50474402, 0x50478402, 0x5047C402, 0x50480402, 0x50484402, 0x50488402, 0x5048C402, 0x50490402,
+    0x50494402, 0x50498402, 0x5049C402, 0x504A0402, 0x504A4402, 0x504A8402, 0x504AC402, 0x504B0402,
+    0x504B4402, 0x504B8402, 0x504BC402, 0x504C0402, 0x504C4402, 0x00000000, 0x00000000, 0x47E64402,
+    0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x50548408, 0x5054C408, 0x50550408, 0x50554408, 0x50558408, 0x5055C408, 0x50560408, 0x50564408,
+    0x50568408, 0x5056C408, 0x50570408, 0x50574408, 0x50578408, 0x5057C408, 0x50580408, 0x50584408,
+    0x50588408, 0x5058C408, 0x50590408, 0x50594408, 0x50598408, 0x5059C408, 0x505A0408, 0x505A4408,
+    0x505A8408, 0x505AC408, 0x505B0408, 0x505B4408, 0x505B8408, 0x505BC408, 0x505C0408, 0x505C4408,
+    0x505C8408, 0x505CC408, 0x50548402, 0x5054C402, 0x50550402, 0x50554402, 0x50558402, 0x5055C402,
+    0x50560402, 0x50564402, 0x50568402, 0x5056C402, 0x50570402, 0x50574402, 0x50578402, 0x5057C402,
+    0x50580402, 0x50584402, 0x50588402, 0x5058C402, 0x50590402, 0x50594402, 0x50598402, 0x5059C402,
+    0x505A0402, 0x505A4402, 0x505A8402, 0x505AC402, 0x505B0402, 0x505B4402, 0x505B8402, 0x505BC402,
+    0x505C0402, 0x505C4402, 0x505C8402, 0x505CC402, 0x400017A2, 0x400017A2, 0x400017A2, 0x400017E2,
+    0x40001802, 0x40001822, 0x400017C2, 0x505D0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x409B0402, 0x409EC402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47A70402, 0x47A74402, 0x47A78402, 0x47A7C402, 0x47A80402, 0x47A84402,
+    0x47A88402, 0x47A8C402, 0x47A90402, 0x47A94402, 0x47A98402, 0x47A9C402, 0x47AA0402, 0x47AA4402,
+    0x47AA8402, 0x47AAC402, 0x47AB0402, 0x47AB4402, 0x47AB8402, 0x47ABC402, 0x47AC0402, 0x47AC4402,
+    0x47AC8402, 0x47ACC402, 0x47AD0402, 0x47AD4402, 0x47AD8402, 0x47ADC402, 0x47AE0402, 0x47AE4402,
+    0x47AE8402, 0x47AEC402, 0x47AF0402, 0x47AF4402, 0x47AF8402, 0x47AFC402, 0x47B00402, 0x47B04402,
+    0x47B08402, 0x47B0C402, 0x47B10402, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402,
+    0x47E78402, 0x47E7C402, 0x47E80402, 0x47E84402, 0x44C54402, 0x47B14402, 0x47B18402, 0x47B1C402,
+    0x47E44402, 0x80047962, 0x800479A2, 0x47B20402, 0x47B24402, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x47E64402, 0x47E68402, 0x47E6C402, 0x47E70402, 0x47E74402, 0x47E78402, 0x47E7C402,
+    0x47E80402, 0x47E84402, 0x47B28402, 0x47B2C402, 0x47B30402, 0x47B34402, 0x47B38402, 0x47B3C402,
+    0x47B40402, 0x47B44402, 0x47B48402, 0x47B4C402, 0x47B50402, 0x47B54402, 0x47B58402, 0x47B5C402,
+    0x47B60402, 0x47B64402, 0x47B68402, 0x47B6C402, 0x47B70402, 0x47B74402, 0x47B78402, 0x47B7C402,
+    0x47B80402, 0x47B84402, 0x47B88402, 0x47B8C402, 0x47B90402, 0x47B94402, 0x47B98402, 0x47B9C402,
+    0x47BA0402, 0x47BA4402, 0x47BA8402, 0x47BAC402, 0x47BB0402, 0x47BB4402, 0x44C58402, 0x800479A2,
+    0x80047C42, 0x80047C82, 0x80047CC2, 0x80047D02, 0x80047D42, 0x80047D82, 0x80047DC2, 0x47BB8402,
+    0x47BBC402, 0x47BC0402, 0x47BC4402, 0x47BC8402, 0x47BCC402, 0x47BD0402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x499C8405, 0x499D0405, 0x49A3C405, 0x49A90405, 0x00000000, 0x49CA0405, 0x49AD0405, 0x49A64405,
+    0x49B5C405, 0x49CDC405, 0x49BD8405, 0x49C30405, 0x49C50405, 0x49C60405, 0x49B18405, 0x49B6C405,
+    0x49B90405, 0x49B44405, 0x49BC0405, 0x49ACC405, 0x49B1C405, 0x49A14405, 0x49A18405, 0x49A68405,
+    0x49A94405, 0x49B48405, 0x49B60405, 0x49B70405, 0x499CC405, 0x49C64405, 0x49B94405, 0x49BBC405,
+    0x00000000, 0x499D0405, 0x49A3C405, 0x00000000, 0x49C88405, 0x00000000, 0x00000000, 0x49A64405,
+    0x00000000, 0x49CDC405, 0x49BD8405, 0x49C30405, 0x49C50405, 0x49C60405, 0x49B18405, 0x49B6C405,
+    0x49B90405, 0x49B44405, 0x49BC0405, 0x00000000, 0x49B1C405, 0x49A14405, 0x49A18405, 0x49A68405,
+    0x00000000, 0x49B48405, 0x00000000, 0x49B70405, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x49A3C405, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x49A64405,
+    0x00000000, 0x49CDC405, 0x00000000, 0x49C30405, 0x00000000, 0x49C60405, 0x49B18405, 0x49B6C405,
+    0x00000000, 0x49B44405, 0x49BC0405, 0x00000000, 0x49B1C405, 0x00000000, 0x00000000, 0x49A68405,
+    0x00000000, 0x49B48405, 0x00000000, 0x49B70405, 0x00000000, 0x49C64405, 0x00000000, 0x49BBC405,
+    0x00000000, 0x499D0405, 0x49A3C405, 0x00000000, 0x49C88405, 0x00000000, 0x00000000, 0x49A64405,
+    0x49B5C405, 0x49CDC405, 0x49BD8405, 0x00000000, 0x49C50405, 0x49C60405, 0x49B18405, 0x49B6C405,
+    0x49B90405, 0x49B44405, 0x49BC0405, 0x00000000, 0x49B1C405, 0x49A14405, 0x49A18405, 0x49A68405,
+    0x00000000, 0x49B48405, 0x49B60405, 0x49B70405, 0x499CC405, 0x00000000, 0x49B94405, 0x00000000,
+    0x499C8405, 0x499D0405, 0x49A3C405, 0x49A90405, 0x49C88405, 0x49CA0405, 0x49AD0405, 0x49A64405,
+    0x49B5C405, 0x49CDC405, 0x00000000, 0x49C30405, 0x49C50405, 0x49C60405, 0x49B18405, 0x49B6C405,
+    0x49B90405, 0x49B44405, 0x49BC0405, 0x49ACC405, 0x49B1C405, 0x49A14405, 0x49A18405, 0x49A68405,
+    0x49A94405, 0x49B48405, 0x49B60405, 0x49B70405, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x499D0405, 0x49A3C405, 0x49A90405, 0x00000000, 0x49CA0405, 0x49AD0405, 0x49A64405,
+    0x49B5C405, 0x49CDC405, 0x00000000, 0x49C30405, 0x49C50405, 0x49C60405, 0x49B18405, 0x49B6C405,
+    0x49B90405, 0x49B44405, 0x49BC0405, 0x49ACC405, 0x49B1C405, 0x49A14405, 0x49A18405, 0x49A68405,
+    0x49A94405, 0x49B48405, 0x49B60405, 0x49B70405, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x414BC402, 0x414C0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x44C5C402, 0x44C60402, 0x44C64402, 0x44C68402, 0x44C6C402, 0x44C70402, 0x44C74402, 0x44C78402,
+    0x44C7C402, 0x44C80402, 0x44C84402, 0x44C88402, 0x44C8C402, 0x44C90402, 0x44C94402, 0x44C98402,
+    0x44C9C402, 0x44CA0402, 0x44CA4402, 0x44CA8402, 0x44CAC402, 0x44CB0402, 0x44CB4402, 0x44CB8402,
+    0x44CBC402, 0x44CC0402, 0x44CC4402, 0x44CC8402, 0x44CCC402, 0x44CD0402, 0x44CD4402, 0x44CD8402,
+    0x44CDC402, 0x44CE0402, 0x44CE4402, 0x44CE8402, 0x44CEC402, 0x44CF0402, 0x44CF4402, 0x44CF8402,
+    0x44CFC402, 0x44D00402, 0x44D04402, 0x44D08402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x44D0C402, 0x44D10402, 0x44D14402, 0x44D18402, 0x44D1C402, 0x44D20402, 0x44D24402, 0x44D28402,
+    0x44D2C402, 0x44D30402, 0x44D34402, 0x44D38402, 0x44D3C402, 0x44D40402, 0x44D44402, 0x44D48402,
+    0x44D4C402, 0x44D50402, 0x44D54402, 0x44D58402, 0x44D5C402, 0x44D60402, 0x44D64402, 0x44D68402,
+    0x44D6C402, 0x44D70402, 0x44D74402, 0x44D78402, 0x44D7C402, 0x44D80402, 0x44D84402, 0x44D88402,
+    0x44D8C402, 0x44D90402, 0x44D94402, 0x44D98402, 0x44D9C402, 0x44DA0402, 0x44DA4402, 0x44DA8402,
+    0x44DAC402, 0x44DB0402, 0x44DB4402, 0x44DB8402, 0x44DBC402, 0x44DC0402, 0x44DC4402, 0x44DC8402,
+    0x44DCC402, 0x44DD0402, 0x44DD4402, 0x44DD8402, 0x44DDC402, 0x44DE0402, 0x44DE4402, 0x44DE8402,
+    0x44DEC402, 0x44DF0402, 0x44DF4402, 0x44DF8402, 0x44DFC402, 0x44E00402, 0x44E04402, 0x44E08402,
+    0x44E0C402, 0x44E10402, 0x44E14402, 0x44E18402, 0x44E1C402, 0x44E20402, 0x44E24402, 0x44E28402,
+    0x44E2C402, 0x44E30402, 0x44E34402, 0x44E38402, 0x44E3C402, 0x44E40402, 0x44E44402, 0x44E48402,
+    0x44E4C402, 0x44E50402, 0x44E54402, 0x44E58402, 0x44E5C402, 0x44E60402, 0x44E64402, 0x44E68402,
+    0x44E6C402, 0x44E70402, 0x44E74402, 0x44E78402, 0x44E7C402, 0x44E80402, 0x44E84402, 0x44E88402,
+    0x44E8C402, 0x44E90402, 0x44E94402, 0x44E98402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x44E9C402, 0x44EA0402, 0x44EA4402, 0x44EA8402, 0x44EAC402, 0x44EB0402, 0x44EB4402, 0x44EB8402,
+    0x44EBC402, 0x44EC0402, 0x44EC4402, 0x44EC8402, 0x44ECC402, 0x44ED0402, 0x44ED4402, 0x00000000,
+    0x00000000, 0x44ED8402, 0x44EDC402, 0x44EE0402, 0x44EE4402, 0x44EE8402, 0x44EEC402, 0x44EF0402,
+    0x44EF4402, 0x44EF8402, 0x44EFC402, 0x44F00402, 0x44F04402, 0x44F08402, 0x44F0C402, 0x44F10402,
+    0x00000000, 0x44F14402, 0x44F18402, 0x44F1C402, 0x44F20402, 0x44F24402, 0x44F28402, 0x44F2C402,
+    0x44F30402, 0x44F34402, 0x44F38402, 0x44F3C402, 0x44F40402, 0x44F44402, 0x44F48402, 0x44F4C402,
+    0x00000000, 0x44F50402, 0x44F54402, 0x44F58402, 0x44F5C402, 0x44F60402, 0x44F64402, 0x44F68402,
+    0x44F6C402, 0x44F70402, 0x44F74402, 0x44F78402, 0x44F7C402, 0x44F80402, 0x44F84402, 0x44F88402,
+    0x44F8C402, 0x44F90402, 0x44F94402, 0x44F98402, 0x44F9C402, 0x44FA0402, 0x44FA4402, 0x44FA8402,
+    0x44FAC402, 0x44FB0402, 0x44FB4402, 0x44FB8402, 0x44FBC402, 0x44FC0402, 0x44FC4402, 0x44FC8402,
+    0x44FCC402, 0x44FD0402, 0x44FD4402, 0x44FD8402, 0x44FDC402, 0x44FE0402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80047E02, 0x80047E42, 0x80047E82, 0x80047EC2, 0x80047F02, 0x80047F42, 0x80047F82, 0x80047FC2,
+    0x80048002, 0x80048042, 0x80048082, 0x47E60406, 0x47E60406, 0x4516C402, 0x45170402, 0x45174402,
+    0x800480C3, 0x80048123, 0x80048183, 0x800481E3, 0x80048243, 0x800482A3, 0x80048303, 0x80048363,
+    0x800483C3, 0x80048423, 0x80048483, 0x800484E3, 0x80048543, 0x800485A3, 0x80048603, 0x80048663,
+    0x800486C3, 0x80048723, 0x80048783, 0x800487E3, 0x80048843, 0x800488A3, 0x80048903, 0x80048963,
+    0x800489C3, 0x80048A23, 0x80048A83, 0x47F5840C, 0x4864C40C, 0x80048AE2, 0x80048B22, 0x4174C402,
+    0x47E8841D, 0x47EF041D, 0x47F5841D, 0x47FAC41D, 0x4801C41D, 0x4810841D, 0x4814441D, 0x481D441D,
+    0x4824041D, 0x482AC41D, 0x4831041D, 0x4835841D, 0x4842441D, 0x4846041D, 0x484F041D, 0x485AC41D,
+    0x4860041D, 0x4864C41D, 0x4874841D, 0x487DC41D, 0x4885C41D, 0x4891C41D, 0x4896441D, 0x4899041D,
+    0x489C041D, 0x48A1841D, 0x80048B62, 0x80033222, 0x80048BA2, 0x80048BE2, 0x80048C23, 0x80048C82,
+    0x47E8840C, 0x47EF040C, 0x47F5840C, 0x47FAC40C, 0x4801C40C, 0x4810840C, 0x4814440C, 0x481D440C,
+    0x4824040C, 0x482AC40C, 0x4831040C, 0x4835840C, 0x4842440C, 0x4846040C, 0x484F040C, 0x485AC40C,
+    0x4860040C, 0x4864C40C, 0x4874840C, 0x487DC40C, 0x4885C40C, 0x4891C40C, 0x4896440C, 0x4899040C,
+    0x489C040C, 0x48A1840C, 0x80048CC2, 0x80048D02, 0x80048D42, 0x45178402, 0x4517C402, 0x45180402,
+    0x47E8841D, 0x47EF041D, 0x47F5841D, 0x47FAC41D, 0x4801C41D, 0x4810841D, 0x4814441D, 0x481D441D,
+    0x4824041D, 0x482AC41D, 0x4831041D, 0x4835841D, 0x4842441D, 0x4846041D, 0x484F041D, 0x485AC41D,
+    0x4860041D, 0x4864C41D, 0x4874841D, 0x487DC41D, 0x4885C41D, 0x4891C41D, 0x4896441D, 0x4899041D,
+    0x489C041D, 0x48A1841D, 0x485AC41D, 0x80048D82, 0x80048DC2, 0x80048E02, 0x80048E42, 0x80048C82,
+    0x80048E82, 0x80048EC2, 0x80048F04, 0x80048F84, 0x80049002, 0x80049043, 0x800490A2, 0x800490E2,
+    0x80049123, 0x80049183, 0x800491E2, 0x80049222, 0x80049267, 0x80049342, 0x80049382, 0x800493C2,
+    0x80049403, 0x80049463, 0x800494C4, 0x80049543, 0x800495A4, 0x47FAC41C, 0x80049622, 0x80049663,
+    0x800496C6, 0x80049788, 0x80049883, 0x800498E3, 0x80049943, 0x41754402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x42C88402, 0x42C8C402,
+    0x42C90402, 0x42C94402, 0x42C98402, 0x42C9C402, 0x42CA0402, 0x42CA4402, 0x42CA8402, 0x42CAC402,
+    0x42CB0402, 0x42CB4402, 0x42CB8402, 0x42CBC402, 0x42CC0402, 0x42CC4402, 0x42CC8402, 0x42CCC402,
+    0x42CD0402, 0x42CD4402, 0x42CD8402, 0x42CDC402, 0x42CE0402, 0x42CE4402, 0x42CE8402, 0x42CEC402,
+    0x800499A2, 0x800499E2, 0x50B9441C, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x80049A22, 0x80049A62, 0x80049AA2, 0x80049AE2, 0x80049B22, 0x80049B62, 0x80049BA2, 0x80049BE2,
+    0x80049C22, 0x80049C62, 0x80049CA2, 0x80049CE2, 0x80049D22, 0x80049D62, 0x80049DA2, 0x80049DE2,
+    0x80049E22, 0x80049E62, 0x80049EA2, 0x80049EE2, 0x80049F22, 0x80049F62, 0x80049FA2, 0x80049FE2,
+    0x8004A022, 0x8004A062, 0x8004A0A2, 0x8004A0E2, 0x8004A122, 0x8004A162, 0x8004A1A2, 0x8004A1E2,
+    0x8004A222, 0x8004A262, 0x8004A2A2, 0x8004A2E2, 0x8004A322, 0x8004A362, 0x8004A3A2, 0x8004A3E2,
+    0x8004A422, 0x8004A462, 0x8004A4A2, 0x8004A4E2, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x8004A524, 0x8004A5A4, 0x8004A624, 0x8004A6A4, 0x8004A724, 0x8004A7A4, 0x8004A824, 0x8004A8A4,
+    0x8004A924, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x8004A9A2, 0x8004A9E2, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45184402, 0x45188402, 0x4518C402, 0x45190402, 0x45194402, 0x45198402, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4519C402, 0x451A0402, 0x451A4402, 0x451A8402, 0x451AC402, 0x451B0402, 0x451B4402, 0x451B8402,
+    0x451BC402, 0x451C0402, 0x451C4402, 0x451C8402, 0x451CC402, 0x451D0402, 0x451D4402, 0x451D8402,
+    0x451DC402, 0x451E0402, 0x451E4402, 0x451E8402, 0x451EC402, 0x451F0402, 0x451F4402, 0x451F8402,
+    0x451FC402, 0x45200402, 0x45204402, 0x45208402, 0x4520C402, 0x45210402, 0x45214402, 0x45218402,
+    0x4521C402, 0x45220402, 0x45224402, 0x45228402, 0x4522C402, 0x45230402, 0x45234402, 0x45238402,
+    0x4523C402, 0x45240402, 0x45244402, 0x45248402, 0x4524C402, 0x45250402, 0x45254402, 0x45258402,
+    0x4525C402, 0x45260402, 0x45264402, 0x45268402, 0x4526C402, 0x45270402, 0x45274402, 0x45278402,
+    0x4527C402, 0x45280402, 0x45284402, 0x45288402, 0x4528C402, 0x45290402, 0x45294402, 0x45298402,
+    0x4529C402, 0x452A0402, 0x452A4402, 0x452A8402, 0x452AC402, 0x452B0402, 0x452B4402, 0x452B8402,
+    0x452BC402, 0x452C0402, 0x452C4402, 0x452C8402, 0x452CC402, 0x452D0402, 0x452D4402, 0x452D8402,
+    0x452DC402, 0x452E0402, 0x452E4402, 0x452E8402, 0x452EC402, 0x452F0402, 0x452F4402, 0x452F8402,
+    0x452FC402, 0x45300402, 0x45304402, 0x45308402, 0x4530C402, 0x45310402, 0x45314402, 0x45318402,
+    0x4531C402, 0x45320402, 0x45324402, 0x45328402, 0x4532C402, 0x45330402, 0x45334402, 0x45338402,
+    0x4533C402, 0x45340402, 0x45344402, 0x45348402, 0x4534C402, 0x45350402, 0x45354402, 0x45358402,
+    0x4535C402, 0x45360402, 0x45364402, 0x45368402, 0x4536C402, 0x45370402, 0x45374402, 0x45378402,
+    0x4537C402, 0x45380402, 0x45384402, 0x45388402, 0x4538C402, 0x45390402, 0x45394402, 0x45398402,
+    0x4539C402, 0x453A0402, 0x453A4402, 0x453A8402, 0x453AC402, 0x453B0402, 0x453B4402, 0x453B8402,
+    0x453BC402, 0x453C0402, 0x453C4402, 0x453C8402, 0x453CC402, 0x453D0402, 0x453D4402, 0x453D8402,
+    0x453DC402, 0x453E0402, 0x453E4402, 0x453E8402, 0x453EC402, 0x453F0402, 0x453F4402, 0x453F8402,
+    0x453FC402, 0x45400402, 0x45404402, 0x45408402, 0x4540C402, 0x45410402, 0x45414402, 0x45418402,
+    0x4541C402, 0x45420402, 0x45424402, 0x45428402, 0x4542C402, 0x45430402, 0x45434402, 0x45438402,
+    0x4543C402, 0x45440402, 0x45444402, 0x45448402, 0x4544C402, 0x45450402, 0x45454402, 0x45458402,
+    0x4545C402, 0x45460402, 0x45464402, 0x45468402, 0x4546C402, 0x45470402, 0x45474402, 0x45478402,
+    0x4547C402, 0x45480402, 0x45484402, 0x45488402, 0x4548C402, 0x45490402, 0x45494402, 0x45498402,
+    0x4549C402, 0x454A0402, 0x454A4402, 0x454A8402, 0x454AC402, 0x454B0402, 0x454B4402, 0x454B8402,
+    0x454BC402, 0x454C0402, 0x454C4402, 0x454C8402, 0x454CC402, 0x454D0402, 0x454D4402, 0x454D8402,
+    0x454DC402, 0x454E0402, 0x454E4402, 0x454E8402, 0x454EC402, 0x454F0402, 0x454F4402, 0x454F8402,
+    0x454FC402, 0x45500402, 0x45504402, 0x45508402, 0x4550C402, 0x45510402, 0x45514402, 0x45518402,
+    0x4551C402, 0x45520402, 0x45524402, 0x45528402, 0x4552C402, 0x45530402, 0x45534402, 0x45538402,
+    0x4553C402, 0x45540402, 0x45544402, 0x45548402, 0x4554C402, 0x45550402, 0x45554402, 0x45558402,
+    0x4555C402, 0x45560402, 0x45564402, 0x45568402, 0x4556C402, 0x45570402, 0x45574402, 0x45578402,
+    0x4557C402, 0x45580402, 0x45584402, 0x45588402, 0x4558C402, 0x45590402, 0x45594402, 0x45598402,
+    0x4559C402, 0x455A0402, 0x455A4402, 0x455A8402, 0x455AC402, 0x455B0402, 0x455B4402, 0x455B8402,
+    0x455BC402, 0x455C0402, 0x455C4402, 0x455C8402, 0x455CC402, 0x455D0402, 0x455D4402, 0x455D8402,
+    0x455DC402, 0x455E0402, 0x455E4402, 0x455E8402, 0x455EC402, 0x455F0402, 0x455F4402, 0x455F8402,
+    0x455FC402, 0x45600402, 0x45604402, 0x45608402, 0x4560C402, 0x45610402, 0x45614402, 0x45618402,
+    0x4561C402, 0x45620402, 0x45624402, 0x45628402, 0x4562C402, 0x45630402, 0x45634402, 0x45638402,
+    0x4563C402, 0x45640402, 0x45644402, 0x45648402, 0x4564C402, 0x45650402, 0x45654402, 0x45658402,
+    0x4565C402, 0x45660402, 0x45664402, 0x45668402, 0x4566C402, 0x45670402, 0x45674402, 0x45678402,
+    0x4567C402, 0x45680402, 0x45684402, 0x45688402, 0x4568C402, 0x45690402, 0x45694402, 0x45698402,
+    0x4569C402, 0x456A0402, 0x456A4402, 0x456A8402, 0x456AC402, 0x456B0402, 0x456B4402, 0x456B8402,
+    0x456BC402, 0x456C0402, 0x456C4402, 0x456C8402, 0x456CC402, 0x456D0402, 0x456D4402, 0x456D8402,
+    0x456DC402, 0x456E0402, 0x456E4402, 0x456E8402, 0x456EC402, 0x456F0402, 0x456F4402, 0x456F8402,
+    0x456FC402, 0x45700402, 0x45704402, 0x45708402, 0x4570C402, 0x45710402, 0x45714402, 0x45718402,
+    0x4571C402, 0x45720402, 0x45724402, 0x45728402, 0x4572C402, 0x45730402, 0x45734402, 0x45738402,
+    0x4573C402, 0x45740402, 0x45744402, 0x45748402, 0x4574C402, 0x45750402, 0x45754402, 0x45758402,
+    0x4575C402, 0x45760402, 0x45764402, 0x45768402, 0x4576C402, 0x45770402, 0x45774402, 0x45778402,
+    0x4577C402, 0x45780402, 0x45784402, 0x45788402, 0x4578C402, 0x45790402, 0x45794402, 0x45798402,
+    0x4579C402, 0x457A0402, 0x457A4402, 0x457A8402, 0x457AC402, 0x457B0402, 0x457B4402, 0x457B8402,
+    0x457BC402, 0x457C0402, 0x457C4402, 0x457C8402, 0x457CC402, 0x457D0402, 0x457D4402, 0x457D8402,
+    0x457DC402, 0x457E0402, 0x457E4402, 0x457E8402, 0x457EC402, 0x457F0402, 0x457F4402, 0x457F8402,
+    0x457FC402, 0x45800402, 0x45804402, 0x45808402, 0x4580C402, 0x45810402, 0x45814402, 0x45818402,
+    0x4581C402, 0x45820402, 0x45824402, 0x45828402, 0x4582C402, 0x45830402, 0x45834402, 0x45838402,
+    0x4583C402, 0x45840402, 0x45844402, 0x45848402, 0x4584C402, 0x45850402, 0x45854402, 0x45858402,
+    0x4585C402, 0x45860402, 0x45864402, 0x45868402, 0x4586C402, 0x45870402, 0x45874402, 0x45878402,
+    0x4587C402, 0x45880402, 0x45884402, 0x45888402, 0x4588C402, 0x45890402, 0x45894402, 0x45898402,
+    0x4589C402, 0x458A0402, 0x458A4402, 0x458A8402, 0x458AC402, 0x458B0402, 0x458B4402, 0x458B8402,
+    0x458BC402, 0x458C0402, 0x458C4402, 0x458C8402, 0x458CC402, 0x458D0402, 0x458D4402, 0x458D8402,
+    0x458DC402, 0x458E0402, 0x458E4402, 0x458E8402, 0x458EC402, 0x458F0402, 0x458F4402, 0x458F8402,
+    0x458FC402, 0x45900402, 0x45904402, 0x45908402, 0x4590C402, 0x45910402, 0x45914402, 0x45918402,
+    0x4591C402, 0x45920402, 0x45924402, 0x45928402, 0x4592C402, 0x45930402, 0x45934402, 0x45938402,
+    0x4593C402, 0x45940402, 0x45944402, 0x45948402, 0x4594C402, 0x45950402, 0x45954402, 0x45958402,
+    0x4595C402, 0x45960402, 0x45964402, 0x45968402, 0x4596C402, 0x45970402, 0x45974402, 0x45978402,
+    0x4597C402, 0x45980402, 0x45984402, 0x45988402, 0x4598C402, 0x45990402, 0x45994402, 0x45998402,
+    0x4599C402, 0x459A0402, 0x459A4402, 0x459A8402, 0x459AC402, 0x459B0402, 0x459B4402, 0x459B8402,
+    0x459BC402, 0x459C0402, 0x459C4402, 0x459C8402, 0x459CC402, 0x459D0402, 0x459D4402, 0x459D8402,
+    0x459DC402, 0x459E0402, 0x459E4402, 0x459E8402, 0x459EC402, 0x459F0402, 0x459F4402, 0x459F8402,
+    0x459FC402, 0x45A00402, 0x45A04402, 0x45A08402, 0x45A0C402, 0x45A10402, 0x45A14402, 0x45A18402,
+    0x45A1C402, 0x45A20402, 0x45A24402, 0x45A28402, 0x45A2C402, 0x45A30402, 0x45A34402, 0x45A38402,
+    0x45A3C402, 0x45A40402, 0x45A44402, 0x45A48402, 0x45A4C402, 0x45A50402, 0x45A54402, 0x45A58402,
+    0x45A5C402, 0x45A60402, 0x45A64402, 0x45A68402, 0x45A6C402, 0x45A70402, 0x45A74402, 0x45A78402,
+    0x45A7C402, 0x45A80402, 0x45A84402, 0x45A88402, 0x45A8C402, 0x45A90402, 0x45A94402, 0x45A98402,
+    0x45A9C402, 0x45AA0402, 0x45AA4402, 0x45AA8402, 0x45AAC402, 0x45AB0402, 0x45AB4402, 0x45AB8402,
+    0x45ABC402, 0x45AC0402, 0x45AC4402, 0x45AC8402, 0x45ACC402, 0x45AD0402, 0x45AD4402, 0x45AD8402,
+    0x45ADC402, 0x45AE0402, 0x45AE4402, 0x45AE8402, 0x45AEC402, 0x45AF0402, 0x45AF4402, 0x45AF8402,
+    0x45AFC402, 0x45B00402, 0x45B04402, 0x45B08402, 0x45B0C402, 0x45B10402, 0x45B14402, 0x45B18402,
+    0x45B1C402, 0x45B20402, 0x45B24402, 0x45B28402, 0x45B2C402, 0x45B30402, 0x45B34402, 0x45B38402,
+    0x45B3C402, 0x45B40402, 0x45B44402, 0x45B48402, 0x45B4C402, 0x45B50402, 0x45B54402, 0x45B58402,
+    0x45B5C402, 0x45B60402, 0x45B64402, 0x45B68402, 0x45B6C402, 0x45B70402, 0x45B74402, 0x45B78402,
+    0x45B7C402, 0x45B80402, 0x45B84402, 0x45B88402, 0x45B8C402, 0x45B90402, 0x45B94402, 0x45B98402,
+    0x45B9C402, 0x45BA0402, 0x45BA4402, 0x45BA8402, 0x45BAC402, 0x45BB0402, 0x45BB4402, 0x45BB8402,
+    0x45BBC402, 0x45BC0402, 0x45BC4402, 0x45BC8402, 0x45BCC402, 0x45BD0402, 0x45BD4402, 0x45BD8402,
+    0x45BDC402, 0x45BE0402, 0x45BE4402, 0x45BE8402, 0x45BEC402, 0x45BF0402, 0x45BF4402, 0x45BF8402,
+    0x45BFC402, 0x45C00402, 0x45C04402, 0x45C08402, 0x45C0C402, 0x45C10402, 0x45C14402, 0x45C18402,
+    0x45C1C402, 0x45C20402, 0x45C24402, 0x45C28402, 0x45C2C402, 0x45C30402, 0x45C34402, 0x45C38402,
+    0x45C3C402, 0x45C40402, 0x45C44402, 0x45C48402, 0x45C4C402, 0x45C50402, 0x45C54402, 0x45C58402,
+    0x45C5C402, 0x45C60402, 0x45C64402, 0x45C68402, 0x45C6C402, 0x45C70402, 0x45C74402, 0x45C78402,
+    0x45C7C402, 0x45C80402, 0x45C84402, 0x45C88402, 0x45C8C402, 0x45C90402, 0x45C94402, 0x45C98402,
+    0x45C9C402, 0x45CA0402, 0x45CA4402, 0x45CA8402, 0x45CAC402, 0x45CB0402, 0x45CB4402, 0x45CB8402,
+    0x45CBC402, 0x45CC0402, 0x45CC4402, 0x45CC8402, 0x45CCC402, 0x45CD0402, 0x45CD4402, 0x45CD8402,
+    0x45CDC402, 0x45CE0402, 0x45CE4402, 0x45CE8402, 0x45CEC402, 0x45CF0402, 0x45CF4402, 0x45CF8402,
+    0x45CFC402, 0x45D00402, 0x45D04402, 0x45D08402, 0x45D0C402, 0x45D10402, 0x45D14402, 0x45D18402,
+    0x45D1C402, 0x45D20402, 0x45D24402, 0x45D28402, 0x45D2C402, 0x45D30402, 0x45D34402, 0x45D38402,
+    0x45D3C402, 0x45D40402, 0x45D44402, 0x45D48402, 0x45D4C402, 0x45D50402, 0x45D54402, 0x45D58402,
+    0x45D5C402, 0x45D60402, 0x45D64402, 0x45D68402, 0x45D6C402, 0x45D70402, 0x45D74402, 0x45D78402,
+    0x45D7C402, 0x45D80402, 0x45D84402, 0x45D88402, 0x45D8C402, 0x45D90402, 0x45D94402, 0x45D98402,
+    0x46278402, 0x4627C402, 0x46280402, 0x46284402, 0x46288402, 0x4628C402, 0x46290402, 0x46294402,
+    0x46298402, 0x4629C402, 0x462A0402, 0x462A4402, 0x462A8402, 0x462AC402, 0x462B0402, 0x462B4402,
+    0x462B8402, 0x462BC402, 0x462C0402, 0x462C4402, 0x462C8402, 0x462CC402, 0x462D0402, 0x462D4402,
+    0x462D8402, 0x462DC402, 0x462E0402, 0x462E4402, 0x462E8402, 0x462EC402, 0x462F0402, 0x462F4402,
+    0x462F8402, 0x462FC402, 0x46300402, 0x46304402, 0x46308402, 0x4630C402, 0x46310402, 0x46314402,
+    0x46318402, 0x4631C402, 0x46320402, 0x46324402, 0x46328402, 0x4632C402, 0x46330402, 0x46334402,
+    0x46338402, 0x4633C402, 0x46340402, 0x46344402, 0x46348402, 0x4634C402, 0x46350402, 0x46354402,
+    0x46358402, 0x4635C402, 0x46360402, 0x46364402, 0x46368402, 0x4636C402, 0x46370402, 0x46374402,
+    0x46378402, 0x4637C402, 0x46380402, 0x46384402, 0x46388402, 0x4638C402, 0x46390402, 0x46394402,
+    0x46398402, 0x4639C402, 0x463A0402, 0x463A4402, 0x463A8402, 0x463AC402, 0x463B0402, 0x463B4402,
+    0x463B8402, 0x463BC402, 0x463C0402, 0x463C4402, 0x463C8402, 0x463CC402, 0x463D0402, 0x463D4402,
+    0x463D8402, 0x463DC402, 0x463E0402, 0x463E4402, 0x463E8402, 0x463EC402, 0x463F0402, 0x463F4402,
+    0x463F8402, 0x463FC402, 0x46400402, 0x46404402, 0x46408402, 0x4640C402, 0x46410402, 0x46414402,
+    0x46418402, 0x4641C402, 0x46420402, 0x46424402, 0x46428402, 0x4642C402, 0x46430402, 0x46434402,
+    0x46438402, 0x4643C402, 0x46440402, 0x46444402, 0x46448402, 0x4644C402, 0x46450402, 0x46454402,
+    0x46458402, 0x4645C402, 0x46460402, 0x46464402, 0x46468402, 0x4646C402, 0x46470402, 0x46474402,
+    0x46478402, 0x4647C402, 0x46480402, 0x46484402, 0x46488402, 0x4648C402, 0x46490402, 0x46494402,
+    0x46498402, 0x4649C402, 0x464A0402, 0x464A4402, 0x464A8402, 0x464AC402, 0x464B0402, 0x464B4402,
+    0x464B8402, 0x464BC402, 0x464C0402, 0x464C4402, 0x464C8402, 0x464CC402, 0x464D0402, 0x464D4402,
+    0x464D8402, 0x464DC402, 0x464E0402, 0x464E4402, 0x464E8402, 0x464EC402, 0x464F0402, 0x464F4402,
+    0x464F8402, 0x464FC402, 0x46500402, 0x46504402, 0x46508402, 0x4650C402, 0x46510402, 0x46514402,
+    0x46518402, 0x4651C402, 0x46520402, 0x46524402, 0x46528402, 0x4652C402, 0x46530402, 0x46534402,
+    0x46538402, 0x4653C402, 0x46540402, 0x46544402, 0x46548402, 0x4654C402, 0x46550402, 0x46554402,
+    0x46558402, 0x4655C402, 0x46560402, 0x46564402, 0x46568402, 0x4656C402, 0x46570402, 0x46574402,
+    0x46578402, 0x4657C402, 0x46580402, 0x46584402, 0x46588402, 0x4658C402, 0x46590402, 0x46594402,
+    0x46598402, 0x4659C402, 0x465A0402, 0x465A4402, 0x465A8402, 0x465AC402, 0x465B0402, 0x465B4402,
+    0x465B8402, 0x465BC402, 0x465C0402, 0x465C4402, 0x465C8402, 0x465CC402, 0x465D0402, 0x465D4402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x465D8402, 0x465DC402, 0x465E0402, 0x465E4402, 0x465E8402, 0x465EC402, 0x465F0402, 0x465F4402,
+    0x465F8402, 0x465FC402, 0x46600402, 0x46604402, 0x46608402, 0x00000000, 0x00000000, 0x00000000,
+    0x4660C402, 0x46610402, 0x46614402, 0x46618402, 0x4661C402, 0x46620402, 0x46624402, 0x46628402,
+    0x4662C402, 0x46630402, 0x46634402, 0x46638402, 0x4663C402, 0x00000000, 0x00000000, 0x00000000,
+    0x46640402, 0x46644402, 0x46648402, 0x4664C402, 0x46650402, 0x46654402, 0x46658402, 0x4665C402,
+    0x46660402, 0x46664402, 0x46668402, 0x4666C402, 0x46670402, 0x46674402, 0x46678402, 0x4667C402,
+    0x46680402, 0x46684402, 0x46688402, 0x4668C402, 0x46690402, 0x46694402, 0x46698402, 0x4669C402,
+    0x466A0402, 0x466A4402, 0x466A8402, 0x466AC402, 0x466B0402, 0x466B4402, 0x466B8402, 0x466BC402,
+    0x466C0402, 0x466C4402, 0x466C8402, 0x466CC402, 0x466D0402, 0x466D4402, 0x466D8402, 0x466DC402,
+    0x466E0402, 0x466E4402, 0x466E8402, 0x466EC402, 0x466F0402, 0x466F4402, 0x466F8402, 0x466FC402,
+    0x46700402, 0x46704402, 0x46708402, 0x4670C402, 0x46710402, 0x46714402, 0x46718402, 0x4671C402,
+    0x46720402, 0x46724402, 0x46728402, 0x4672C402, 0x46730402, 0x46734402, 0x46738402, 0x4673C402,
+    0x46740402, 0x46744402, 0x46748402, 0x4674C402, 0x46750402, 0x46754402, 0x46758402, 0x4675C402,
+    0x46760402, 0x46764402, 0x46768402, 0x4676C402, 0x46770402, 0x46774402, 0x46778402, 0x4677C402,
+    0x46780402, 0x46784402, 0x46788402, 0x4678C402, 0x46790402, 0x46794402, 0x46798402, 0x4679C402,
+    0x467A0402, 0x467A4402, 0x467A8402, 0x467AC402, 0x467B0402, 0x467B4402, 0x467B8402, 0x467BC402,
+    0x467C0402, 0x467C4402, 0x467C8402, 0x467CC402, 0x467D0402, 0x467D4402, 0x467D8402, 0x467DC402,
+    0x467E0402, 0x467E4402, 0x467E8402, 0x467EC402, 0x467F0402, 0x467F4402, 0x467F8402, 0x467FC402,
+    0x46800402, 0x46804402, 0x46808402, 0x4680C402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x46810402, 0x46814402, 0x46818402, 0x4681C402, 0x46820402, 0x46824402, 0x46828402, 0x4682C402,
+    0x46830402, 0x46834402, 0x46838402, 0x4683C402, 0x46840402, 0x46844402, 0x46848402, 0x4684C402,
+    0x46850402, 0x46854402, 0x46858402, 0x4685C402, 0x46860402, 0x46864402, 0x46868402, 0x4686C402,
+    0x46870402, 0x46874402, 0x46878402, 0x4687C402, 0x46880402, 0x46884402, 0x46888402, 0x4688C402,
+    0x46890402, 0x46894402, 0x46898402, 0x4689C402, 0x468A0402, 0x468A4402, 0x468A8402, 0x468AC402,
+    0x468B0402, 0x468B4402, 0x468B8402, 0x468BC402, 0x468C0402, 0x468C4402, 0x468C8402, 0x468CC402,
+    0x468D0402, 0x468D4402, 0x468D8402, 0x468DC402, 0x468E0402, 0x468E4402, 0x468E8402, 0x468EC402,
+    0x468F0402, 0x468F4402, 0x468F8402, 0x468FC402, 0x46900402, 0x46904402, 0x46908402, 0x4690C402,
+    0x46910402, 0x46914402, 0x46918402, 0x4691C402, 0x46920402, 0x46924402, 0x46928402, 0x4692C402,
+    0x46930402, 0x46934402, 0x46938402, 0x4693C402, 0x46940402, 0x46944402, 0x46948402, 0x4694C402,
+    0x46950402, 0x46954402, 0x46958402, 0x4695C402, 0x46960402, 0x46964402, 0x46968402, 0x4696C402,
+    0x46970402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x46974402, 0x46978402, 0x4697C402, 0x46980402, 0x46984402, 0x46988402, 0x4698C402, 0x46990402,
+    0x46994402, 0x46998402, 0x4699C402, 0x469A0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x469A4402, 0x469A8402, 0x469AC402, 0x469B0402, 0x469B4402, 0x469B8402, 0x469BC402, 0x469C0402,
+    0x469C4402, 0x469C8402, 0x469CC402, 0x469D0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x469D4402, 0x469D8402, 0x469DC402, 0x469E0402, 0x469E4402, 0x469E8402, 0x469EC402, 0x469F0402,
+    0x469F4402, 0x469F8402, 0x469FC402, 0x46A00402, 0x46A04402, 0x46A08402, 0x46A0C402, 0x46A10402,
+    0x46A14402, 0x46A18402, 0x46A1C402, 0x46A20402, 0x46A24402, 0x46A28402, 0x46A2C402, 0x46A30402,
+    0x46A34402, 0x46A38402, 0x46A3C402, 0x46A40402, 0x46A44402, 0x46A48402, 0x46A4C402, 0x46A50402,
+    0x46A54402, 0x46A58402, 0x46A5C402, 0x46A60402, 0x46A64402, 0x46A68402, 0x46A6C402, 0x46A70402,
+    0x46A74402, 0x46A78402, 0x46A7C402, 0x46A80402, 0x46A84402, 0x46A88402, 0x46A8C402, 0x46A90402,
+    0x46A94402, 0x46A98402, 0x46A9C402, 0x46AA0402, 0x46AA4402, 0x46AA8402, 0x46AAC402, 0x46AB0402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x46AB4402, 0x46AB8402, 0x46ABC402, 0x46AC0402, 0x46AC4402, 0x46AC8402, 0x46ACC402, 0x46AD0402,
+    0x46AD4402, 0x46AD8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x46ADC402, 0x46AE0402, 0x46AE4402, 0x46AE8402, 0x46AEC402, 0x46AF0402, 0x46AF4402, 0x46AF8402,
+    0x46AFC402, 0x46B00402, 0x46B04402, 0x46B08402, 0x46B0C402, 0x46B10402, 0x46B14402, 0x46B18402,
+    0x46B1C402, 0x46B20402, 0x46B24402, 0x46B28402, 0x46B2C402, 0x46B30402, 0x46B34402, 0x46B38402,
+    0x46B3C402, 0x46B40402, 0x46B44402, 0x46B48402, 0x46B4C402, 0x46B50402, 0x46B54402, 0x46B58402,
+    0x46B5C402, 0x46B60402, 0x46B64402, 0x46B68402, 0x46B6C402, 0x46B70402, 0x46B74402, 0x46B78402,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x46B7C402, 0x46B80402, 0x46B84402, 0x46B88402, 0x46B8C402, 0x46B90402, 0x46B94402, 0x46B98402,
+    0x46B9C402, 0x46BA0402, 0x46BA4402, 0x46BA8402, 0x46BAC402, 0x46BB0402, 0x46BB4402, 0x46BB8402,
+    0x46BBC402, 0x46BC0402, 0x46BC4402, 0x46BC8402, 0x46BCC402, 0x46BD0402, 0x46BD4402, 0x46BD8402,
+    0x46BDC402, 0x46BE0402, 0x46BE4402, 0x46BE8402, 0x46BEC402, 0x46BF0402, 0x00000000, 0x00000000,
+    0x46BF4402, 0x46BF8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45D9C402, 0x45DA0402, 0x45DA4402, 0x45DA8402, 0x45DAC402, 0x45DB0402, 0x45DB4402, 0x45DB8402,
+    0x45DBC402, 0x45DC0402, 0x45DC4402, 0x45DC8402, 0x45DCC402, 0x45DD0402, 0x45DD4402, 0x45DD8402,
+    0x45DDC402, 0x45DE0402, 0x45DE4402, 0x45DE8402, 0x45DEC402, 0x45DF0402, 0x45DF4402, 0x45DF8402,
+    0x45DFC402, 0x45E00402, 0x45E04402, 0x45E08402, 0x45E0C402, 0x45E10402, 0x45E14402, 0x45E18402,
+    0x45E1C402, 0x45E20402, 0x45E24402, 0x45E28402, 0x45E2C402, 0x45E30402, 0x45E34402, 0x45E38402,
+    0x45E3C402, 0x45E40402, 0x45E44402, 0x45E48402, 0x45E4C402, 0x45E50402, 0x45E54402, 0x45E58402,
+    0x45E5C402, 0x45E60402, 0x45E64402, 0x45E68402, 0x45E6C402, 0x45E70402, 0x45E74402, 0x45E78402,
+    0x45E7C402, 0x45E80402, 0x45E84402, 0x45E88402, 0x45E8C402, 0x45E90402, 0x45E94402, 0x45E98402,
+    0x45E9C402, 0x45EA0402, 0x45EA4402, 0x45EA8402, 0x45EAC402, 0x45EB0402, 0x45EB4402, 0x45EB8402,
+    0x45EBC402, 0x45EC0402, 0x45EC4402, 0x45EC8402, 0x45ECC402, 0x45ED0402, 0x45ED4402, 0x45ED8402,
+    0x45EDC402, 0x45EE0402, 0x45EE4402, 0x45EE8402, 0x45EEC402, 0x45EF0402, 0x45EF4402, 0x45EF8402,
+    0x45EFC402, 0x45F00402, 0x45F04402, 0x45F08402, 0x45F0C402, 0x45F10402, 0x45F14402, 0x45F18402,
+    0x45F1C402, 0x45F20402, 0x45F24402, 0x45F28402, 0x45F2C402, 0x45F30402, 0x45F34402, 0x45F38402,
+    0x45F3C402, 0x45F40402, 0x45F44402, 0x45F48402, 0x45F4C402, 0x45F50402, 0x45F54402, 0x45F58402,
+    0x45F5C402, 0x45F60402, 0x45F64402, 0x45F68402, 0x45F6C402, 0x45F70402, 0x45F74402, 0x45F78402,
+    0x45F7C402, 0x00000000, 0x45F80402, 0x45F84402, 0x45F88402, 0x45F8C402, 0x45F90402, 0x45F94402,
+    0x45F98402, 0x45F9C402, 0x45FA0402, 0x45FA4402, 0x45FA8402, 0x45FAC402, 0x45FB0402, 0x45FB4402,
+    0x45FB8402, 0x45FBC402, 0x45FC0402, 0x45FC4402, 0x45FC8402, 0x45FCC402, 0x45FD0402, 0x45FD4402,
+    0x45FD8402, 0x45FDC402, 0x45FE0402, 0x45FE4402, 0x45FE8402, 0x45FEC402, 0x45FF0402, 0x45FF4402,
+    0x45FF8402, 0x45FFC402, 0x46000402, 0x46004402, 0x46008402, 0x4600C402, 0x46010402, 0x46014402,
+    0x46018402, 0x4601C402, 0x46020402, 0x46024402, 0x46028402, 0x4602C402, 0x46030402, 0x46034402,
+    0x46038402, 0x4603C402, 0x46040402, 0x46044402, 0x46048402, 0x4604C402, 0x46050402, 0x46054402,
+    0x46058402, 0x4605C402, 0x46060402, 0x46064402, 0x46068402, 0x4606C402, 0x46070402, 0x46074402,
+    0x46078402, 0x4607C402, 0x46080402, 0x46084402, 0x46088402, 0x4608C402, 0x46090402, 0x46094402,
+    0x46098402, 0x4609C402, 0x460A0402, 0x460A4402, 0x460A8402, 0x460AC402, 0x460B0402, 0x460B4402,
+    0x460B8402, 0x460BC402, 0x460C0402, 0x460C4402, 0x00000000, 0x460C8402, 0x460CC402, 0x460D0402,
+    0x460D4402, 0x460D8402, 0x460DC402, 0x460E0402, 0x460E4402, 0x460E8402, 0x460EC402, 0x460F0402,
+    0x460F4402, 0x460F8402, 0x460FC402, 0x46100402, 0x46104402, 0x46108402, 0x4610C402, 0x46110402,
+    0x46114402, 0x46118402, 0x4611C402, 0x46120402, 0x46124402, 0x46128402, 0x4612C402, 0x46130402,
+    0x46134402, 0x46138402, 0x4613C402, 0x46140402, 0x46144402, 0x46148402, 0x4614C402, 0x46150402,
+    0x46154402, 0x46158402, 0x4615C402, 0x46160402, 0x46164402, 0x46168402, 0x4616C402, 0x46170402,
+    0x46174402, 0x46178402, 0x4617C402, 0x46180402, 0x46184402, 0x46188402, 0x4618C402, 0x46190402,
+    0x44FE4402, 0x44FE8402, 0x44FEC402, 0x44FF0402, 0x44FF4402, 0x44FF8402, 0x44FFC402, 0x45000402,
+    0x45004402, 0x45008402, 0x4500C402, 0x45010402, 0x45014402, 0x45018402, 0x4501C402, 0x45020402,
+    0x45024402, 0x45028402, 0x4502C402, 0x45030402, 0x45034402, 0x45038402, 0x4503C402, 0x45040402,
+    0x45044402, 0x45048402, 0x4504C402, 0x45050402, 0x45054402, 0x45058402, 0x4505C402, 0x45060402,
+    0x45064402, 0x45068402, 0x4506C402, 0x45070402, 0x45074402, 0x45078402, 0x4507C402, 0x45080402,
+    0x45084402, 0x45088402, 0x4508C402, 0x45090402, 0x45094402, 0x45098402, 0x4509C402, 0x450A0402,
+    0x450A4402, 0x450A8402, 0x450AC402, 0x450B0402, 0x450B4402, 0x450B8402, 0x450BC402, 0x450C0402,
+    0x450C4402, 0x450C8402, 0x450CC402, 0x450D0402, 0x450D4402, 0x450D8402, 0x450DC402, 0x450E0402,
+    0x450E4402, 0x450E8402, 0x450EC402, 0x450F0402, 0x450F4402, 0x450F8402, 0x450FC402, 0x45100402,
+    0x45104402, 0x45108402, 0x4510C402, 0x45110402, 0x45114402, 0x45118402, 0x4511C402, 0x45120402,
+    0x45124402, 0x45128402, 0x4512C402, 0x45130402, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x45134402, 0x45138402, 0x4513C402, 0x45140402, 0x45144402, 0x45148402, 0x4514C402, 0x45150402,
+    0x45154402, 0x45158402, 0x4515C402, 0x45160402, 0x45164402, 0x45168402, 0x00000000, 0x00000000,
+    0x46194402, 0x46198402, 0x4619C402, 0x461A0402, 0x461A4402, 0x00000000, 0x00000000, 0x00000000,
+    0x461A8402, 0x461AC402, 0x461B0402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x461B4402, 0x461B8402, 0x461BC402, 0x461C0402, 0x461C4402, 0x461C8402, 0x461CC402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x461D0402, 0x461D4402, 0x461D8402, 0x461DC402, 0x461E0402, 0x461E4402, 0x461E8402, 0x461EC402,
+    0x461F0402, 0x461F4402, 0x461F8402, 0x461FC402, 0x46200402, 0x46204402, 0x46208402, 0x4620C402,
+    0x46210402, 0x46214402, 0x46218402, 0x4621C402, 0x46220402, 0x46224402, 0x46228402, 0x4622C402,
+    0x46230402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x46234402, 0x46238402, 0x4623C402, 0x46240402, 0x46244402, 0x46248402, 0x4624C402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x46250402, 0x46254402, 0x46258402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x4625C402, 0x46260402, 0x46264402, 0x46268402, 0x4626C402, 0x46270402, 0x46274402, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x425A4402, 0x425A8402, 0x425AC402, 0x425B0402, 0x425B4402, 0x425B8402, 0x425BC402, 0x425C0402,
+    0x425C4402, 0x425C8402, 0x425CC402, 0x425D0402, 0x425D4402, 0x425D8402, 0x425DC402, 0x425E0402,
+    0x425E4402, 0x425E8402, 0x425EC402, 0x425F0402, 0x425F4402, 0x425F8402, 0x425FC402, 0x42600402,
+    0x42604402, 0x42608402, 0x4260C402, 0x42610402, 0x42614402, 0x42618402, 0x4261C402, 0x42620402,
+    0x42624402, 0x42628402, 0x4262C402, 0x42630402, 0x42634402, 0x42638402, 0x4263C402, 0x42640402,
+    0x42644402, 0x42648402, 0x4264C402, 0x42650402, 0x42654402, 0x42658402, 0x4265C402, 0x42660402,
+    0x42664402, 0x42668402, 0x4266C402, 0x42670402, 0x42674402, 0x42678402, 0x4267C402, 0x42680402,
+    0x42684402, 0x42688402, 0x4268C402, 0x42690402, 0x42694402, 0x42698402, 0x4269C402, 0x426A0402,
+    0x426A4402, 0x426A8402, 0x426AC402, 0x426B0402, 0x426B4402, 0x426B8402, 0x426BC402, 0x426C0402,
+    0x426C4402, 0x426C8402, 0x426CC402, 0x426D0402, 0x426D4402, 0x426D8402, 0x426DC402, 0x426E0402,
+    0x426E4402, 0x426E8402, 0x426EC402, 0x426F0402, 0x426F4402, 0x426F8402, 0x426FC402, 0x42700402,
+    0x42704402, 0x42708402, 0x4270C402, 0x42710402, 0x42714402, 0x42718402, 0x4271C402, 0x42720402,
+    0x42724402, 0x42728402, 0x4272C402, 0x42730402, 0x42734402, 0x42738402, 0x4273C402, 0x42740402,
+    0x42744402, 0x42748402, 0x4274C402, 0x42750402, 0x42754402, 0x42758402, 0x4275C402, 0x42760402,
+    0x42764402, 0x42768402, 0x4276C402, 0x42770402, 0x42774402, 0x42778402, 0x4277C402, 0x42780402,
+    0x42784402, 0x42788402, 0x4278C402, 0x42790402, 0x42794402, 0x42798402, 0x4279C402, 0x427A0402,
+    0x427A4402, 0x427A8402, 0x427AC402, 0x427B0402, 0x427B4402, 0x427B8402, 0x427BC402, 0x427C0402,
+    0x427C4402, 0x427C8402, 0x427CC402, 0x427D0402, 0x427D4402, 0x427D8402, 0x427DC402, 0x427E0402,
+    0x427E4402, 0x427E8402, 0x427EC402, 0x00000000, 0x427F0402, 0x427F4402, 0x427F8402, 0x427FC402,
+    0x42800402, 0x42804402, 0x42808402, 0x4280C402, 0x42810402, 0x42814402, 0x42818402, 0x4281C402,
+    0x42820402, 0x42824402, 0x42828402, 0x4282C402, 0x42830402, 0x42834402, 0x42838402, 0x4283C402,
+    0x42840402, 0x42844402, 0x42848402, 0x4284C402, 0x42850402, 0x42854402, 0x42858402, 0x4285C402,
+    0x42860402, 0x42864402, 0x42868402, 0x4286C402, 0x42870402, 0x42874402, 0x42878402, 0x4287C402,
+    0x42880402, 0x42884402, 0x42888402, 0x4288C402, 0x42890402, 0x42894402, 0x42898402, 0x4289C402,
+    0x428A0402, 0x428A4402, 0x428A8402, 0x428AC402, 0x428B0402, 0x428B4402, 0x428B8402, 0x428BC402,
+    0x428C0402, 0x428C4402, 0x428C8402, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x47E60405, 0x47E64405, 0x47E68405, 0x47E6C405, 0x47E70405, 0x47E74405, 0x47E78405, 0x47E7C405,
+    0x47E80405, 0x47E84405, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000000, 0x00000000,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x8004AA22, 0x8004AA62, 0x8004AAA2, 0x8004AAE2, 0x8004AB22, 0x8003A522, 0x8004AB62, 0x8004ABA2,
+    0x8004ABE2, 0x8004AC22, 0x8003A562, 0x8004AC62, 0x8004ACA2, 0x8004ACE2, 0x8003A5A2, 0x8004AD22,
+    0x8004AD62, 0x8004ADA2, 0x8004ADE2, 0x8004AE22, 0x8004AE62, 0x8004AEA2, 0x8004AEE2, 0x8004AF22,
+    0x8004AF62, 0x8004AFA2, 0x8004AFE2, 0x8003B422, 0x8004B022, 0x8004B062, 0x8004B0A2, 0x8004B0E2,
+    0x8004B122, 0x8004B162, 0x8004B1A2, 0x8004B1E2, 0x8004B222, 0x8003B562, 0x8003A5E2, 0x8003A622,
+    0x8003B5A2, 0x8004B262, 0x8004B2A2, 0x800372E2, 0x8004B2E2, 0x8003A662, 0x8004B322, 0x8004B362,
+    0x8004B3A2, 0x8004B3E2, 0x8004B3E2, 0x8004B3E2, 0x8004B422, 0x8004B462, 0x8004B4A2, 0x8004B4E2,
+    0x8004B522, 0x8004B562, 0x8004B5A2, 0x8004B5E2, 0x8004B622, 0x8004B662, 0x8004B6A2, 0x8004B6E2,
+    0x8004B722, 0x8004B762, 0x8004B7A2, 0x8004B7E2, 0x8004B822, 0x8004B862, 0x8004B862, 0x8003B622,
+    0x8004B8A2, 0x8004B8E2, 0x8004B922, 0x8004B962, 0x8003A6E2, 0x8004B9A2, 0x8004B9E2, 0x8004BA22,
+    0x80039922, 0x8004BA62, 0x8004BAA2, 0x8004BAE2, 0x8004BB22, 0x8004BB62, 0x8004BBA2, 0x8004BBE2,
+    0x8004BC22, 0x8004BC62, 0x8004BCA2, 0x8004BCE2, 0x8004BD22, 0x8004BD62, 0x8004BDA2, 0x8004BDE2,
+    0x8004BE22, 0x8004BE62, 0x8004BEA2, 0x8004BEE2, 0x8004BF22, 0x8004BF62, 0x8004BFA2, 0x8004BFE2,
+    0x8004C022, 0x8004C062, 0x8004C0A2, 0x8004C0A2, 0x8004C0E2, 0x8004C122, 0x8004C162, 0x800371E2,
+    0x8004C1A2, 0x8004C1E2, 0x8004C222, 0x8004C262, 0x8004C2A2, 0x8004C2E2, 0x8004C322, 0x8004C362,
+    0x8003A822, 0x8004C3A2, 0x8004C3E2, 0x8004C422, 0x8004C462, 0x8004C4A2, 0x8004C4E2, 0x8004C522,
+    0x8004C562, 0x8004C5A2, 0x8004C5E2, 0x8004C622, 0x8004C662, 0x8004C6A2, 0x8004C6E2, 0x8004C722,
+    0x8004C762, 0x8004C7A2, 0x8004C7E2, 0x8004C822, 0x8004C862, 0x8004C8A2, 0x80036462, 0x8004C8E2,
+    0x8004C922, 0x8004C962, 0x8004C962, 0x8004C9A2, 0x8004C9E2, 0x8004C9E2, 0x8004CA22, 0x8004CA62,
+    0x8004CAA2, 0x8004CAE2, 0x8004CB22, 0x8004CB62, 0x8004CBA2, 0x8004CBE2, 0x8004CC22, 0x8004CC62,
+    0x8004CCA2, 0x8004CCE2, 0x8004CD22, 0x8003A862, 0x8004CD62, 0x8004CDA2, 0x8004CDE2, 0x8004CE22,
+    0x8003B922, 0x8004CE22, 0x8004CE62, 0x8003A8E2, 0x8004CEA2, 0x8004CEE2, 0x8004CF22, 0x8004CF62,
+    0x8003A922, 0x80035DA2, 0x8004CFA2, 0x8004CFE2, 0x8004D022, 0x8004D062, 0x8004D0A2, 0x8004D0E2,
+    0x8004D122, 0x8004D162, 0x8004D1A2, 0x8004D1E2, 0x8004D222, 0x8004D262, 0x8004D2A2, 0x8004D2E2,
+    0x8004D322, 0x8004D362, 0x8004D3A2, 0x8004D3E2, 0x8004D422, 0x8004D462, 0x8004D4A2, 0x8004D4E2,
+    0x8003A962, 0x8004D522, 0x8004D562, 0x8004D5A2, 0x8004D5E2, 0x8004D622, 0x8004D662, 0x8003A9E2,
+    0x8004D6A2, 0x8004D6E2, 0x8004D722, 0x8004D762, 0x8004D7A2, 0x8004D7E2, 0x8004D822, 0x8004D862,
+    0x800364A2, 0x8003BB22, 0x8004D8A2, 0x8004D8E2, 0x8004D922, 0x8004D962, 0x8004D9A2, 0x8004D9E2,
+    0x8004DA22, 0x8004DA62, 0x8003AA22, 0x8004DAA2, 0x8004DAE2, 0x8004DB22, 0x8004DB62, 0x8003C5E2,
+    0x8004DBA2, 0x8004DBE2, 0x8004DC22, 0x8004DC62, 0x8004DCA2, 0x8004DCE2, 0x8004DD22, 0x8004DD62,
+    0x8004DDA2, 0x8004DDE2, 0x8004DE22, 0x8004DE62, 0x8004DEA2, 0x80037622, 0x8004DEE2, 0x8004DF22,
+    0x8004DF62, 0x8004DFA2, 0x8004DFE2, 0x8004E022, 0x8004E062, 0x8004E0A2, 0x8004E0E2, 0x8004E122,
+    0x8004E162, 0x8003AA62, 0x80038BE2, 0x8004E1A2, 0x8004E1E2, 0x8004E222, 0x8004E262, 0x8004E2A2,
+    0x8004E2E2, 0x8004E322, 0x8004E362, 0x8003BC22, 0x8004E3A2, 0x8004E3E2, 0x8004E422, 0x8004E462,
+    0x8004E4A2, 0x8004E4E2, 0x8004E522, 0x8004E562, 0x8003BC62, 0x8004E5A2, 0x8004E5E2, 0x8004E622,
+    0x8004E662, 0x8004E6A2, 0x8004E6E2, 0x8004E722, 0x8004E762, 0x8004E7A2, 0x8004E7E2, 0x8004E822,
+    0x8004E862, 0x8003BCE2, 0x8004E8A2, 0x8004E8E2, 0x8004E922, 0x8004E962, 0x8004E9A2, 0x8004E9E2,
+    0x8004EA22, 0x8004EA62, 0x8004EAA2, 0x8004EAE2, 0x8004EB22, 0x8004EB22, 0x8004EB62, 0x8004EBA2,
+    0x8003BD62, 0x8004EBE2, 0x8004EC22, 0x8004EC62, 0x8004ECA2, 0x8004ECE2, 0x8004ED22, 0x8004ED62,
+    0x800372A2, 0x8004EDA2, 0x8004EDE2, 0x8004EE22, 0x8004EE62, 0x8004EEA2, 0x8004EEE2, 0x8004EF22,
+    0x8003BEE2, 0x8004EF62, 0x8004EFA2, 0x8004EFE2, 0x8004F022, 0x8004F062, 0x8004F0A2, 0x8004F0A2,
+    0x8003BF22, 0x8003C662, 0x8004F0E2, 0x8004F122, 0x8004F162, 0x8004F1A2, 0x8004F1E2, 0x80036922,
+    0x8003BFA2, 0x8004F222, 0x8004F262, 0x8003AD22, 0x8004F2A2, 0x8004F2E2, 0x80039FE2, 0x8004F322,
+    0x8004F362, 0x8003AE22, 0x8004F3A2, 0x8004F3E2, 0x8004F422, 0x8004F462, 0x8004F462, 0x8004F4A2,
+    0x8004F4E2, 0x8004F522, 0x8004F562, 0x8004F5A2, 0x8004F5E2, 0x8004F622, 0x8004F662, 0x8004F6A2,
+    0x8004F6E2, 0x8004F722, 0x8004F762, 0x8004F7A2, 0x8004F7E2, 0x8004F822, 0x8004F862, 0x8004F8A2,
+    0x8004F8E2, 0x8004F922, 0x8004F962, 0x8004F9A2, 0x8004F9E2, 0x8004FA22, 0x8004FA62, 0x8004FAA2,
+    0x8004FAE2, 0x8004FB22, 0x8003AFA2, 0x8004FB62, 0x8004FBA2, 0x8004FBE2, 0x8004FC22, 0x8004FC62,
+    0x8004FCA2, 0x8004FCE2, 0x8004FD22, 0x8004FD62, 0x8004FDA2, 0x8004FDE2, 0x8004FE22, 0x8004FE62,
+    0x8004FEA2, 0x8004FEE2, 0x8004FF22, 0x8004C9A2, 0x8004FF62, 0x8004FFA2, 0x8004FFE2, 0x80050022,
+    0x80050062, 0x800500A2, 0x800500E2, 0x80050122, 0x80050162, 0x800501A2, 0x800501E2, 0x80050222,
+    0x80037722, 0x80050262, 0x800502A2, 0x800502E2, 0x80050322, 0x80050362, 0x800503A2, 0x8003B062,
+    0x800503E2, 0x80050422, 0x80050462, 0x800504A2, 0x800504E2, 0x80050522, 0x80050562, 0x800505A2,
+    0x800505E2, 0x80050622, 0x80050662, 0x800506A2, 0x800506E2, 0x80050722, 0x80050762, 0x800507A2,
+    0x800507E2, 0x80050822, 0x80050862, 0x800508A2, 0x800367E2, 0x800508E2, 0x80050922, 0x80050962,
+    0x800509A2, 0x800509E2, 0x80050A22, 0x8003C162, 0x80050A62, 0x80050AA2, 0x80050AE2, 0x80050B22,
+    0x80050B62, 0x80050BA2, 0x80050BE2, 0x80050C22, 0x80050C62, 0x80050CA2, 0x80050CE2, 0x80050D22,
+    0x80050D62, 0x80050DA2, 0x80050DE2, 0x80050E22, 0x80050E62, 0x80050EA2, 0x80050EE2, 0x80050F22,
+    0x8003C2A2, 0x8003C2E2, 0x80050F62, 0x80050FA2, 0x80050FE2, 0x80051022, 0x80051062, 0x800510A2,
+    0x800510E2, 0x80051122, 0x80051162, 0x800511A2, 0x800511E2, 0x80051222, 0x80051262, 0x8003C322,
+    0x800512A2, 0x800512E2, 0x80051322, 0x80051362, 0x800513A2, 0x800513E2, 0x80051422, 0x80051462,
+    0x800514A2, 0x800514E2, 0x80051522, 0x80051562, 0x800515A2, 0x800515E2, 0x80051622, 0x80051662,
+    0x800516A2, 0x800516E2, 0x80051722, 0x80051762, 0x800517A2, 0x800517E2, 0x80051822, 0x80051862,
+    0x800518A2, 0x800518E2, 0x80051922, 0x80051962, 0x800519A2, 0x800519E2, 0x8003C4A2, 0x8003C4A2,
+    0x80051A22, 0x80051A62, 0x80051AA2, 0x80051AE2, 0x80051B22, 0x80051B62, 0x80051BA2, 0x80051BE2,
+    0x80051C22, 0x80051C62, 0x8003C4E2, 0x80051CA2, 0x80051CE2, 0x80051D22, 0x80051D62, 0x80051DA2,
+    0x80051DE2, 0x80051E22, 0x80051E62, 0x80051EA2, 0x80051EE2, 0x80051F22, 0x80051F62, 0x80051FA2,
+    0x80051FE2, 0x80052022, 0x80052062, 0x800520A2, 0x800520E2, 0x80052122, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002, 0x00000002,
+    0x00000002, 0x00000002, 0x00000002, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x40000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000, 0x40000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+
+static const uint32 collationElements[10507] =
+{
+    0x08358408, 0x00002302, 0x08358402, 0x00002302, 0x0C85C402, 0x0C944402, 0x0C860402, 0x0C944402,
+    0x0C864402, 0x0C944402, 0x0C868402, 0x0C944402, 0x0C86C402, 0x0C944402, 0x0C870402, 0x0C944402,
+    0x0C874402, 0x0C944402, 0x0C878402, 0x0C944402, 0x0C87C402, 0x0C944402, 0x0C880402, 0x0C944402,
+    0x0C884402, 0x0C944402, 0x0C888402, 0x0C944402, 0x0C88C402, 0x0C944402, 0x0C890402, 0x0C944402,
+    0x0C894402, 0x0C944402, 0x0C898402, 0x0C944402, 0x0C89C402, 0x0C944402, 0x0C8A0402, 0x0C944402,
+    0x0C8A4402, 0x0C944402, 0x0C8A8402, 0x0C944402, 0x0C8AC402, 0x0C944402, 0x0C8B0402, 0x0C944402,
+    0x0C8B4402, 0x0C944402, 0x0C8B8402, 0x0C944402, 0x0C8BC402, 0x0C944402, 0x0C8C0402, 0x0C944402,
+    0x0C8C4402, 0x0C944402, 0x0C8C8402, 0x0C944402, 0x0C8CC402, 0x0C944402, 0x0C8D0402, 0x0C944402,
+    0x0C8D4402, 0x0C944402, 0x0C8D8402, 0x0C944402, 0x0C8DC402, 0x0C944402, 0x0C8E0402, 0x0C944402,
+    0x0C8E4402, 0x0C944402, 0x0C8E8402, 0x0C944402, 0x0C8EC402, 0x0C944402, 0x0C8F0402, 0x0C944402,
+    0x0C8F4402, 0x0C944402, 0x0C8F8402, 0x0C944402, 0x0C8FC402, 0x0C944402, 0x0C900402, 0x0C944402,
+    0x0C904402, 0x0C944402, 0x0C908402, 0x0C944402, 0x0C90C402, 0x0C944402, 0x0C910402, 0x0C944402,
+    0x0C85C402, 0x0C948402, 0x0C860402, 0x0C948402, 0x0C864402, 0x0C948402, 0x0C868402, 0x0C948402,
+    0x0C86C402, 0x0C948402, 0x0C870402, 0x0C948402, 0x0C874402, 0x0C948402, 0x0C878402, 0x0C948402,
+    0x0C87C402, 0x0C948402, 0x0C880402, 0x0C948402, 0x0C884402, 0x0C948402, 0x0C888402, 0x0C948402,
+    0x0C88C402, 0x0C948402, 0x0C890402, 0x0C948402, 0x0C894402, 0x0C948402, 0x0C898402, 0x0C948402,
+    0x0C89C402, 0x0C948402, 0x0C8A0402, 0x0C948402, 0x0C8A4402, 0x0C948402, 0x0C8A8402, 0x0C948402,
+    0x0C8AC402, 0x0C948402, 0x0C8B0402, 0x0C948402, 0x0C8B4402, 0x0C948402, 0x0C8B8402, 0x0C948402,
+    0x0C8BC402, 0x0C948402, 0x0C8C0402, 0x0C948402, 0x0C8C4402, 0x0C948402, 0x0C8C8402, 0x0C948402,
+    0x0C8CC402, 0x0C948402, 0x0C8D0402, 0x0C948402, 0x0C8D4402, 0x0C948402, 0x0C8D8402, 0x0C948402,
+    0x0C8DC402, 0x0C948402, 0x0C8E0402, 0x0C948402, 0x0C8E4402, 0x0C948402, 0x0C8E8402, 0x0C948402,
+    0x0C8EC402, 0x0C948402, 0x0C8F0402, 0x0C948402, 0x0C8F4402, 0x0C948402, 0x0C8F8402, 0x0C948402,
+    0x0C8FC402, 0x0C948402, 0x0C900402, 0x0C948402, 0x0C904402, 0x0C948402, 0x0C908402, 0x0C948402,
+    0x0C90C402, 0x0C948402, 0x0C910402, 0x0C948402, 0x0C85C402, 0x0C94C402, 0x0C860402, 0x0C94C402,
+    0x0C864402, 0x0C94C402, 0x0C868402, 0x0C94C402, 0x0C86C402, 0x0C94C402, 0x0C870402, 0x0C94C402,
+    0x0C874402, 0x0C94C402, 0x0C878402, 0x0C94C402, 0x0C87C402, 0x0C94C402, 0x0C880402, 0x0C94C402,
+    0x0C884402, 0x0C94C402, 0x0C888402, 0x0C94C402, 0x0C88C402, 0x0C94C402, 0x0C890402, 0x0C94C402,
+    0x0C894402, 0x0C94C402, 0x0C898402, 0x0C94C402, 0x0C89C402, 0x0C94C402, 0x0C8A0402, 0x0C94C402,
+    0x0C8A4402, 0x0C94C402, 0x0C8A8402, 0x0C94C402, 0x0C8AC402, 0x0C94C402, 0x0C8B0402, 0x0C94C402,
+    0x0C8B4402, 0x0C94C402, 0x0C8B8402, 0x0C94C402, 0x0C8BC402, 0x0C94C402, 0x0C8C0402, 0x0C94C402,
+    0x0C8C4402, 0x0C94C402, 0x0C8C8402, 0x0C94C402, 0x0C8CC402, 0x0C94C402, 0x0C8D0402, 0x0C94C402,
+    0x0C8D4402, 0x0C94C402, 0x0C8D8402, 0x0C94C402, 0x0C8DC402, 0x0C94C402, 0x0C8E0402, 0x0C94C402,
+    0x0C8E4402, 0x0C94C402, 0x0C8E8402, 0x0C94C402, 0x0C8EC402, 0x0C94C402, 0x0C8F0402, 0x0C94C402,
+    0x0C8F4402, 0x0C94C402, 0x0C8F8402, 0x0C94C402, 0x0C8FC402, 0x0C94C402, 0x0C900402, 0x0C94C402,
+    0x0C904402, 0x0C94C402, 0x0C908402, 0x0C94C402, 0x0C90C402, 0x0C94C402, 0x0C910402, 0x0C94C402,
+    0x0C85C402, 0x0C950402, 0x0C860402, 0x0C950402, 0x0C864402, 0x0C950402, 0x0C868402, 0x0C950402,
+    0x0C86C402, 0x0C950402, 0x0C870402, 0x0C950402, 0x0C874402, 0x0C950402, 0x0C878402, 0x0C950402,
+    0x0C87C402, 0x0C950402, 0x0C880402, 0x0C950402, 0x0C884402, 0x0C950402, 0x0C888402, 0x0C950402,
+    0x0C88C402, 0x0C950402, 0x0C890402, 0x0C950402, 0x0C894402, 0x0C950402, 0x0C898402, 0x0C950402,
+    0x0C89C402, 0x0C950402, 0x0C8A0402, 0x0C950402, 0x0C8A4402, 0x0C950402, 0x0C8A8402, 0x0C950402,
+    0x0C8AC402, 0x0C950402, 0x0C8B0402, 0x0C950402, 0x0C8B4402, 0x0C950402, 0x0C8B8402, 0x0C950402,
+    0x0C8BC402, 0x0C950402, 0x0C8C0402, 0x0C950402, 0x0C8C4402, 0x0C950402, 0x0C8C8402, 0x0C950402,
+    0x0C8CC402, 0x0C950402, 0x0C8D0402, 0x0C950402, 0x0C8D4402, 0x0C950402, 0x0C8D8402, 0x0C950402,
+    0x0C8DC402, 0x0C950402, 0x0C8E0402, 0x0C950402, 0x0C8E4402, 0x0C950402, 0x0C8E8402, 0x0C950402,
+    0x0C8EC402, 0x0C950402, 0x0C8F0402, 0x0C950402, 0x0C8F4402, 0x0C950402, 0x0C8F8402, 0x0C950402,
+    0x0C8FC402, 0x0C950402, 0x0C900402, 0x0C950402, 0x0C904402, 0x0C950402, 0x0C908402, 0x0C950402,
+    0x0C90C402, 0x0C950402, 0x0C910402, 0x0C950402, 0x0C85C402, 0x0C954402, 0x0C860402, 0x0C954402,
+    0x0C864402, 0x0C954402, 0x0C868402, 0x0C954402, 0x0C86C402, 0x0C954402, 0x0C870402, 0x0C954402,
+    0x0C874402, 0x0C954402, 0x0C878402, 0x0C954402, 0x0C87C402, 0x0C954402, 0x0C880402, 0x0C954402,
+    0x0C884402, 0x0C954402, 0x0C888402, 0x0C954402, 0x0C88C402, 0x0C954402, 0x0C890402, 0x0C954402,
+    0x0C894402, 0x0C954402, 0x0C898402, 0x0C954402, 0x0C89C402, 0x0C954402, 0x0C8A0402, 0x0C954402,
+    0x0C8A4402, 0x0C954402, 0x0C8A8402, 0x0C954402, 0x0C8AC402, 0x0C954402, 0x0C8B0402, 0x0C954402,
+    0x0C8B4402, 0x0C954402, 0x0C8B8402, 0x0C954402, 0x0C8BC402, 0x0C954402, 0x0C8C0402, 0x0C954402,
+    0x0C8C4402, 0x0C954402, 0x0C8C8402, 0x0C954402, 0x0C8CC402, 0x0C954402, 0x0C8D0402, 0x0C954402,
+    0x0C8D4402, 0x0C954402, 0x0C8D8402, 0x0C954402, 0x0C8DC402, 0x0C954402, 0x0C8E0402, 0x0C954402,
+    0x0C8E4402, 0x0C954402, 0x0C8E8402, 0x0C954402, 0x0C8EC402, 0x0C954402, 0x0C8F0402, 0x0C954402,
+    0x0C8F4402, 0x0C954402, 0x0C8F8402, 0x0C954402, 0x0C8FC402, 0x0C954402, 0x0C900402, 0x0C954402,
+    0x0C904402, 0x0C954402, 0x0C908402, 0x0C954402, 0x0C90C402, 0x0C954402, 0x0C910402, 0x0C954402,
+    0x0C960402, 0x0CA44402, 0x0C964402, 0x0CA44402, 0x0C968402, 0x0CA44402, 0x0C96C402, 0x0CA44402,
+    0x0C970402, 0x0CA44402, 0x0C974402, 0x0CA44402, 0x0C978402, 0x0CA44402, 0x0C980402, 0x0CA44402,
+    0x0C984402, 0x0CA44402, 0x0C990402, 0x0CA44402, 0x0C988402, 0x0CA44402, 0x0C994402, 0x0CA44402,
+    0x0C998402, 0x0CA44402, 0x0C99C402, 0x0CA44402, 0x0C9A0402, 0x0CA44402, 0x0C9A4402, 0x0CA44402,
+    0x0C9A8402, 0x0CA44402, 0x0C9AC402, 0x0CA44402, 0x0C9B0402, 0x0CA44402, 0x0C9B4402, 0x0CA44402,
+    0x0C9B8402, 0x0CA44402, 0x0C9BC402, 0x0CA44402, 0x0C9C0402, 0x0CA44402, 0x0C9C4402, 0x0CA44402,
+    0x0C9C8402, 0x0CA44402, 0x0C9CC402, 0x0CA44402, 0x0C9D0402, 0x0CA44402, 0x0C9D4402, 0x0CA44402,
+    0x0C9D8402, 0x0CA44402, 0x0C9DC402, 0x0CA44402, 0x0C9E0402, 0x0CA44402, 0x0C9E4402, 0x0CA44402,
+    0x0C9E8402, 0x0CA44402, 0x0C9EC402, 0x0CA44402, 0x0C9F0402, 0x0CA44402, 0x0C9F4402, 0x0CA44402,
+    0x0C97C402, 0x0CA44402, 0x0C9F8402, 0x0CA44402, 0x0C9FC402, 0x0CA44402, 0x0CA00402, 0x0CA44402,
+    0x0CA04402, 0x0CA44402, 0x0C9F8404, 0x0C9BC404, 0x0CA44402, 0x0C9F8404, 0x0C9DC404, 0x0CA44402,
+    0x0C95C402, 0x0CA44402, 0x0C98C402, 0x0CA44402, 0x0C960402, 0x0CA48402, 0x0C964402, 0x0CA48402,
+    0x0C968402, 0x0CA48402, 0x0C96C402, 0x0CA48402, 0x0C970402, 0x0CA48402, 0x0C974402, 0x0CA48402,
+    0x0C978402, 0x0CA48402, 0x0C980402, 0x0CA48402, 0x0C984402, 0x0CA48402, 0x0C990402, 0x0CA48402,
+    0x0C988402, 0x0CA48402, 0x0C994402, 0x0CA48402, 0x0C998402, 0x0CA48402, 0x0C99C402, 0x0CA48402,
+    0x0C9A0402, 0x0CA48402, 0x0C9A4402, 0x0CA48402, 0x0C9A8402, 0x0CA48402, 0x0C9AC402, 0x0CA48402,
+    0x0C9B0402, 0x0CA48402, 0x0C9B4402, 0x0CA48402, 0x0C9B8402, 0x0CA48402, 0x0C9BC402, 0x0CA48402,
+    0x0C9C0402, 0x0CA48402, 0x0C9C4402, 0x0CA48402, 0x0C9C8402, 0x0CA48402, 0x0C9CC402, 0x0CA48402,
+    0x0C9D0402, 0x0CA48402, 0x0C9D4402, 0x0CA48402, 0x0C9D8402, 0x0CA48402, 0x0C9DC402, 0x0CA48402,
+    0x0C9E0402, 0x0CA48402, 0x0C9E4402, 0x0CA48402, 0x0C9E8402, 0x0CA48402, 0x0C9EC402, 0x0CA48402,
+    0x0C9F0402, 0x0CA48402, 0x0C9F4402, 0x0CA48402, 0x0C97C402, 0x0CA48402, 0x0C9F8402, 0x0CA48402,
+    0x0C9FC402, 0x0CA48402, 0x0CA00402, 0x0CA48402, 0x0CA04402, 0x0CA48402, 0x0C9F8404, 0x0C9BC404,
+    0x0CA48402, 0x0C9F8404, 0x0C9DC404, 0x0CA48402, 0x0C95C402, 0x0CA48402, 0x0C98C402, 0x0CA48402,
+    0x0C960402, 0x0CA4C402, 0x0C964402, 0x0CA4C402, 0x0C968402, 0x0CA4C402, 0x0C96C402, 0x0CA4C402,
+    0x0C970402, 0x0CA4C402, 0x0C974402, 0x0CA4C402, 0x0C978402, 0x0CA4C402, 0x0C980402, 0x0CA4C402,
+    0x0C984402, 0x0CA4C402, 0x0C990402, 0x0CA4C402, 0x0C988402, 0x0CA4C402, 0x0C994402, 0x0CA4C402,
+    0x0C998402, 0x0CA4C402, 0x0C99C402, 0x0CA4C402, 0x0C9A0402, 0x0CA4C402, 0x0C9A4402, 0x0CA4C402,
+    0x0C9A8402, 0x0CA4C402, 0x0C9AC402, 0x0CA4C402, 0x0C9B0402, 0x0CA4C402, 0x0C9B4402, 0x0CA4C402,
+    0x0C9B8402, 0x0CA4C402, 0x0C9BC402, 0x0CA4C402, 0x0C9C0402, 0x0CA4C402, 0x0C9C4402, 0x0CA4C402,
+    0x0C9C8402, 0x0CA4C402, 0x0C9CC402, 0x0CA4C402, 0x0C9D0402, 0x0CA4C402, 0x0C9D4402, 0x0CA4C402,
+    0x0C9D8402, 0x0CA4C402, 0x0C9DC402, 0x0CA4C402, 0x0C9E0402, 0x0CA4C402, 0x0C9E4402, 0x0CA4C402,
+    0x0C9E8402, 0x0CA4C402, 0x0C9EC402, 0x0CA4C402, 0x0C9F0402, 0x0CA4C402, 0x0C9F4402, 0x0CA4C402,
+    0x0C97C402, 0x0CA4C402, 0x0C9F8402, 0x0CA4C402, 0x0C9FC402, 0x0CA4C402, 0x0CA00402, 0x0CA4C402,
+    0x0CA04402, 0x0CA4C402, 0x0C9F8404, 0x0C9BC404, 0x0CA4C402, 0x0C9F8404, 0x0C9DC404, 0x0CA4C402,
+    0x0C95C402, 0x0CA4C402, 0x0C98C402, 0x0CA4C402, 0x0C960402, 0x0CA50402, 0x0C964402, 0x0CA50402,
+    0x0C968402, 0x0CA50402, 0x0C96C402, 0x0CA50402, 0x0C970402, 0x0CA50402, 0x0C974402, 0x0CA50402,
+    0x0C978402, 0x0CA50402, 0x0C980402, 0x0CA50402, 0x0C984402, 0x0CA50402, 0x0C990402, 0x0CA50402,
+    0x0C988402, 0x0CA50402, 0x0C994402, 0x0CA50402, 0x0C998402, 0x0CA50402, 0x0C99C402, 0x0CA50402,
+    0x0C9A0402, 0x0CA50402, 0x0C9A4402, 0x0CA50402, 0x0C9A8402, 0x0CA50402, 0x0C9AC402, 0x0CA50402,
+    0x0C9B0402, 0x0CA50402, 0x0C9B4402, 0x0CA50402, 0x0C9B8402, 0x0CA50402, 0x0C9BC402, 0x0CA50402,
+    0x0C9C0402, 0x0CA50402, 0x0C9C4402, 0x0CA50402, 0x0C9C8402, 0x0CA50402, 0x0C9CC402, 0x0CA50402,
+    0x0C9D0402, 0x0CA50402, 0x0C9D4402, 0x0CA50402, 0x0C9D8402, 0x0CA50402, 0x0C9DC402, 0x0CA50402,
+    0x0C9E0402, 0x0CA50402, 0x0C9E4402, 0x0CA50402, 0x0C9E8402, 0x0CA50402, 0x0C9EC402, 0x0CA50402,
+    0x0C9F0402, 0x0CA50402, 0x0C9F4402, 0x0CA50402, 0x0C97C402, 0x0CA50402, 0x0C9F8402, 0x0CA50402,
+    0x0C9FC402, 0x0CA50402, 0x0CA00402, 0x0CA50402, 0x0CA04402, 0x0CA50402, 0x0C9F8404, 0x0C9BC404,
+    0x0CA50402, 0x0C9F8404, 0x0C9DC404, 0x0CA50402, 0x0C95C402, 0x0CA50402, 0x0C98C402, 0x0CA50402,
+    0x0C960402, 0x0CA54402, 0x0C964402, 0x0CA54402, 0x0C968402, 0x0CA54402, 0x0C96C402, 0x0CA54402,
+    0x0C970402, 0x0CA54402, 0x0C974402, 0x0CA54402, 0x0C978402, 0x0CA54402, 0x0C980402, 0x0CA54402,
+    0x0C984402, 0x0CA54402, 0x0C990402, 0x0CA54402, 0x0C988402, 0x0CA54402, 0x0C994402, 0x0CA54402,
+    0x0C998402, 0x0CA54402, 0x0C99C402, 0x0CA54402, 0x0C9A0402, 0x0CA54402, 0x0C9A4402, 0x0CA54402,
+    0x0C9A8402, 0x0CA54402, 0x0C9AC402, 0x0CA54402, 0x0C9B0402, 0x0CA54402, 0x0C9B4402, 0x0CA54402,
+    0x0C9B8402, 0x0CA54402, 0x0C9BC402, 0x0CA54402, 0x0C9C0402, 0x0CA54402, 0x0C9C4402, 0x0CA54402,
+    0x0C9C8402, 0x0CA54402, 0x0C9CC402, 0x0CA54402, 0x0C9D0402, 0x0CA54402, 0x0C9D4402, 0x0CA54402,
+    0x0C9D8402, 0x0CA54402, 0x0C9DC402, 0x0CA54402, 0x0C9E0402, 0x0CA54402, 0x0C9E4402, 0x0CA54402,
+    0x0C9E8402, 0x0CA54402, 0x0C9EC402, 0x0CA54402, 0x0C9F0402, 0x0CA54402, 0x0C9F4402, 0x0CA54402,
+    0x0C97C402, 0x0CA54402, 0x0C9F8402, 0x0CA54402, 0x0C9FC402, 0x0CA54402, 0x0CA00402, 0x0CA54402,
+    0x0CA04402, 0x0CA54402, 0x0C9F8404, 0x0C9BC404, 0x0CA54402, 0x0C9F8404, 0x0C9DC404, 0x0CA54402,
+    0x0C95C402, 0x0CA54402, 0x0C98C402, 0x0CA54402, 0x0DB78402, 0x0DC3C402, 0x0DB7C402, 0x0DC3C402,
+    0x0DB80402, 0x0DC3C402, 0x0DB84402, 0x0DC3C402, 0x0DB88402, 0x0DC3C402, 0x0DB8C402, 0x0DC3C402,
+    0x0DB90402, 0x0DC3C402, 0x0DB94402, 0x0DC3C402, 0x0DB98402, 0x0DC3C402, 0x0DB9C402, 0x0DC3C402,
+    0x0DBA0402, 0x0DC3C402, 0x0DBA4402, 0x0DC3C402, 0x0DBA8402, 0x0DC3C402, 0x0DBAC402, 0x0DC3C402,
+    0x0DBB0402, 0x0DC3C402, 0x0DBB4402, 0x0DC3C402, 0x0DBB8402, 0x0DC3C402, 0x0DBBC402, 0x0DC3C402,
+    0x0DBC0402, 0x0DC3C402, 0x0DBC4402, 0x0DC3C402, 0x0DBC8402, 0x0DC3C402, 0x0DBCC402, 0x0DC3C402,
+    0x0DBD0402, 0x0DC3C402, 0x0DBD4402, 0x0DC3C402, 0x0DBD8402, 0x0DC3C402, 0x0DBDC402, 0x0DC3C402,
+    0x0DBE0402, 0x0DC3C402, 0x0DBE4402, 0x0DC3C402, 0x0DBE8402, 0x0DC3C402, 0x0DBEC402, 0x0DC3C402,
+    0x0DBF0402, 0x0DC3C402, 0x0DBF4402, 0x0DC3C402, 0x0DBF8402, 0x0DC3C402, 0x0DBFC402, 0x0DC3C402,
+    0x0DC00402, 0x0DC3C402, 0x0DC04402, 0x0DC3C402, 0x0DC08402, 0x0DC3C402, 0x0DC0C402, 0x0DC3C402,
+    0x0DC10402, 0x0DC3C402, 0x0DC14402, 0x0DC3C402, 0x0DC18402, 0x0DC3C402, 0x0DC1C402, 0x0DC3C402,
+    0x0DC20402, 0x0DC3C402, 0x0DC24402, 0x0DC3C402, 0x0DB78402, 0x0DC40402, 0x0DB7C402, 0x0DC40402,
+    0x0DB80402, 0x0DC40402, 0x0DB84402, 0x0DC40402, 0x0DB88402, 0x0DC40402, 0x0DB8C402, 0x0DC40402,
+    0x0DB90402, 0x0DC40402, 0x0DB94402, 0x0DC40402, 0x0DB98402, 0x0DC40402, 0x0DB9C402, 0x0DC40402,
+    0x0DBA0402, 0x0DC40402, 0x0DBA4402, 0x0DC40402, 0x0DBA8402, 0x0DC40402, 0x0DBAC402, 0x0DC40402,
+    0x0DBB0402, 0x0DC40402, 0x0DBB4402, 0x0DC40402, 0x0DBB8402, 0x0DC40402, 0x0DBBC402, 0x0DC40402,
+    0x0DBC0402, 0x0DC40402, 0x0DBC4402, 0x0DC40402, 0x0DBC8402, 0x0DC40402, 0x0DBCC402, 0x0DC40402,
+    0x0DBD0402, 0x0DC40402, 0x0DBD4402, 0x0DC40402, 0x0DBD8402, 0x0DC40402, 0x0DBDC402, 0x0DC40402,
+    0x0DBE0402, 0x0DC40402, 0x0DBE4402, 0x0DC40402, 0x0DBE8402, 0x0DC40402, 0x0DBEC402, 0x0DC40402,
+    0x0DBF0402, 0x0DC40402, 0x0DBF4402, 0x0DC40402, 0x0DBF8402, 0x0DC40402, 0x0DBFC402, 0x0DC40402,
+    0x0DC00402, 0x0DC40402, 0x0DC04402, 0x0DC40402, 0x0DC08402, 0x0DC40402, 0x0DC0C402, 0x0DC40402,
+    0x0DC10402, 0x0DC40402, 0x0DC14402, 0x0DC40402, 0x0DC18402, 0x0DC40402, 0x0DC1C402, 0x0DC40402,
+    0x0DC20402, 0x0DC40402, 0x0DC24402, 0x0DC40402, 0x0DB78402, 0x0DC44402, 0x0DB7C402, 0x0DC44402,
+    0x0DB80402, 0x0DC44402, 0x0DB84402, 0x0DC44402, 0x0DB88402, 0x0DC44402, 0x0DB8C402, 0x0DC44402,
+    0x0DB90402, 0x0DC44402, 0x0DB94402, 0x0DC44402, 0x0DB98402, 0x0DC44402, 0x0DB9C402, 0x0DC44402,
+    0x0DBA0402, 0x0DC44402, 0x0DBA4402, 0x0DC44402, 0x0DBA8402, 0x0DC44402, 0x0DBAC402, 0x0DC44402,
+    0x0DBB0402, 0x0DC44402, 0x0DBB4402, 0x0DC44402, 0x0DBB8402, 0x0DC44402, 0x0DBBC402, 0x0DC44402,
+    0x0DBC0402, 0x0DC44402, 0x0DBC4402, 0x0DC44402, 0x0DBC8402, 0x0DC44402, 0x0DBCC402, 0x0DC44402,
+    0x0DBD0402, 0x0DC44402, 0x0DBD4402, 0x0DC44402, 0x0DBD8402, 0x0DC44402, 0x0DBDC402, 0x0DC44402,
+    0x0DBE0402, 0x0DC44402, 0x0DBE4402, 0x0DC44402, 0x0DBE8402, 0x0DC44402, 0x0DBEC402, 0x0DC44402,
+    0x0DBF0402, 0x0DC44402, 0x0DBF4402, 0x0DC44402, 0x0DBF8402, 0x0DC44402, 0x0DBFC402, 0x0DC44402,
+    0x0DC00402, 0x0DC44402, 0x0DC04402, 0x0DC44402, 0x0DC08402, 0x0DC44402, 0x0DC0C402, 0x0DC44402,
+    0x0DC10402, 0x0DC44402, 0x0DC14402, 0x0DC44402, 0x0DC18402, 0x0DC44402, 0x0DC1C402, 0x0DC44402,
+    0x0DC20402, 0x0DC44402, 0x0DC24402, 0x0DC44402, 0x0DB78402, 0x0DC50402, 0x0DB7C402, 0x0DC50402,
+    0x0DB80402, 0x0DC50402, 0x0DB84402, 0x0DC50402, 0x0DB88402, 0x0DC50402, 0x0DB8C402, 0x0DC50402,
+    0x0DB90402, 0x0DC50402, 0x0DB94402, 0x0DC50402, 0x0DB98402, 0x0DC50402, 0x0DB9C402, 0x0DC50402,
+    0x0DBA0402, 0x0DC50402, 0x0DBA4402, 0x0DC50402, 0x0DBA8402, 0x0DC50402, 0x0DBAC402, 0x0DC50402,
+    0x0DBB0402, 0x0DC50402, 0x0DBB4402, 0x0DC50402, 0x0DBB8402, 0x0DC50402, 0x0DBBC402, 0x0DC50402,
+    0x0DBC0402, 0x0DC50402, 0x0DBC4402, 0x0DC50402, 0x0DBC8402, 0x0DC50402, 0x0DBCC402, 0x0DC50402,
+    0x0DBD0402, 0x0DC50402, 0x0DBD4402, 0x0DC50402, 0x0DBD8402, 0x0DC50402, 0x0DBDC402, 0x0DC50402,
+    0x0DBE0402, 0x0DC50402, 0x0DBE4402, 0x0DC50402, 0x0DBE8402, 0x0DC50402, 0x0DBEC402, 0x0DC50402,
+    0x0DBF0402, 0x0DC50402, 0x0DBF4402, 0x0DC50402, 0x0DBF8402, 0x0DC50402, 0x0DBFC402, 0x0DC50402,
+    0x0DC00402, 0x0DC50402, 0x0DC04402, 0x0DC50402, 0x0DC08402, 0x0DC50402, 0x0DC0C402, 0x0DC50402,
+    0x0DC10402, 0x0DC50402, 0x0DC14402, 0x0DC50402, 0x0DC18402, 0x0DC50402, 0x0DC1C402, 0x0DC50402,
+    0x0DC20402, 0x0DC50402, 0x0DC24402, 0x0DC50402, 0x0CA58402, 0x0CB2C402, 0x0CA5C402, 0x0CB2C402,
+    0x0CA60402, 0x0CB2C402, 0x0CA64402, 0x0CB2C402, 0x0CA68402, 0x0CB2C402, 0x0CA6C402, 0x0CB2C402,
+    0x0CA70402, 0x0CB2C402, 0x0CA74402, 0x0CB2C402, 0x0CA78402, 0x0CB2C402, 0x0CA7C402, 0x0CB2C402,
+    0x0CA80402, 0x0CB2C402, 0x0CA84402, 0x0CB2C402, 0x0CA88402, 0x0CB2C402, 0x0CA8C402, 0x0CB2C402,
+    0x0CA90402, 0x0CB2C402, 0x0CA94402, 0x0CB2C402, 0x0CA98402, 0x0CB2C402, 0x0CA9C402, 0x0CB2C402,
+    0x0CAA0402, 0x0CB2C402, 0x0CAA4402, 0x0CB2C402, 0x0CAA8402, 0x0CB2C402, 0x0CAAC402, 0x0CB2C402,
+    0x0CAB0402, 0x0CB2C402, 0x0CAB4402, 0x0CB2C402, 0x0CAB8402, 0x0CB2C402, 0x0CABC402, 0x0CB2C402,
+    0x0CAC0402, 0x0CB2C402, 0x0CAC4402, 0x0CB2C402, 0x0CAC8402, 0x0CB2C402, 0x0CACC402, 0x0CB2C402,
+    0x0CAD0402, 0x0CB2C402, 0x0CAD4402, 0x0CB2C402, 0x0CAD8402, 0x0CB2C402, 0x0CADC402, 0x0CB2C402,
+    0x0CAE0402, 0x0CB2C402, 0x0CAE4402, 0x0CB2C402, 0x0CAE8402, 0x0CB2C402, 0x0CAEC402, 0x0CB2C402,
+    0x0CAF0402, 0x0CB2C402, 0x0CAF4402, 0x0CB2C402, 0x0CAF8402, 0x0CB2C402, 0x0CAFC402, 0x0CB2C402,
+    0x0CB00402, 0x0CB2C402, 0x0CB04402, 0x0CB2C402, 0x0CB08402, 0x0CB2C402, 0x0CB0C402, 0x0CB2C402,
+    0x0CB10402, 0x0CB2C402, 0x0CB14402, 0x0CB2C402, 0x0CA58402, 0x0CB30402, 0x0CA5C402, 0x0CB30402,
+    0x0CA60402, 0x0CB30402, 0x0CA64402, 0x0CB30402, 0x0CA68402, 0x0CB30402, 0x0CA6C402, 0x0CB30402,
+    0x0CA70402, 0x0CB30402, 0x0CA74402, 0x0CB30402, 0x0CA78402, 0x0CB30402, 0x0CA7C402, 0x0CB30402,
+    0x0CA80402, 0x0CB30402, 0x0CA84402, 0x0CB30402, 0x0CA88402, 0x0CB30402, 0x0CA8C402, 0x0CB30402,
+    0x0CA90402, 0x0CB30402, 0x0CA94402, 0x0CB30402, 0x0CA98402, 0x0CB30402, 0x0CA9C402, 0x0CB30402,
+    0x0CAA0402, 0x0CB30402, 0x0CAA4402, 0x0CB30402, 0x0CAA8402, 0x0CB30402, 0x0CAAC402, 0x0CB30402,
+    0x0CAB0402, 0x0CB30402, 0x0CAB4402, 0x0CB30402, 0x0CAB8402, 0x0CB30402, 0x0CABC402, 0x0CB30402,
+    0x0CAC0402, 0x0CB30402, 0x0CAC4402, 0x0CB30402, 0x0CAC8402, 0x0CB30402, 0x0CACC402, 0x0CB30402,
+    0x0CAD0402, 0x0CB30402, 0x0CAD4402, 0x0CB30402, 0x0CAD8402, 0x0CB30402, 0x0CADC402, 0x0CB30402,
+    0x0CAE0402, 0x0CB30402, 0x0CAE4402, 0x0CB30402, 0x0CAE8402, 0x0CB30402, 0x0CAEC402, 0x0CB30402,
+    0x0CAF0402, 0x0CB30402, 0x0CAF4402, 0x0CB30402, 0x0CAF8402, 0x0CB30402, 0x0CAFC402, 0x0CB30402,
+    0x0CB00402, 0x0CB30402, 0x0CB04402, 0x0CB30402, 0x0CB08402, 0x0CB30402, 0x0CB0C402, 0x0CB30402,
+    0x0CB10402, 0x0CB30402, 0x0CB14402, 0x0CB30402, 0x0CA58402, 0x0CB3C402, 0x0CA5C402, 0x0CB3C402,
+    0x0CA60402, 0x0CB3C402, 0x0CA64402, 0x0CB3C402, 0x0CA68402, 0x0CB3C402, 0x0CA6C402, 0x0CB3C402,
+    0x0CA70402, 0x0CB3C402, 0x0CA74402, 0x0CB3C402, 0x0CA78402, 0x0CB3C402, 0x0CA7C402, 0x0CB3C402,
+    0x0CA80402, 0x0CB3C402, 0x0CA84402, 0x0CB3C402, 0x0CA88402, 0x0CB3C402, 0x0CA8C402, 0x0CB3C402,
+    0x0CA90402, 0x0CB3C402, 0x0CA94402, 0x0CB3C402, 0x0CA98402, 0x0CB3C402, 0x0CA9C402, 0x0CB3C402,
+    0x0CAA0402, 0x0CB3C402, 0x0CAA4402, 0x0CB3C402, 0x0CAA8402, 0x0CB3C402, 0x0CAAC402, 0x0CB3C402,
+    0x0CAB0402, 0x0CB3C402, 0x0CAB4402, 0x0CB3C402, 0x0CAB8402, 0x0CB3C402, 0x0CABC402, 0x0CB3C402,
+    0x0CAC0402, 0x0CB3C402, 0x0CAC4402, 0x0CB3C402, 0x0CAC8402, 0x0CB3C402, 0x0CACC402, 0x0CB3C402,
+    0x0CAD0402, 0x0CB3C402, 0x0CAD4402, 0x0CB3C402, 0x0CAD8402, 0x0CB3C402, 0x0CADC402, 0x0CB3C402,
+    0x0CAE0402, 0x0CB3C402, 0x0CAE4402, 0x0CB3C402, 0x0CAE8402, 0x0CB3C402, 0x0CAEC402, 0x0CB3C402,
+    0x0CAF0402, 0x0CB3C402, 0x0CAF4402, 0x0CB3C402, 0x0CAF8402, 0x0CB3C402, 0x0CAFC402, 0x0CB3C402,
+    0x0CB00402, 0x0CB3C402, 0x0CB04402, 0x0CB3C402, 0x0CB08402, 0x0CB3C402, 0x0CB0C402, 0x0CB3C402,
+    0x0CB10402, 0x0CB3C402, 0x0CB14402, 0x0CB3C402, 0x0CA58402, 0x0CB44402, 0x0CA5C402, 0x0CB44402,
+    0x0CA60402, 0x0CB44402, 0x0CA64402, 0x0CB44402, 0x0CA68402, 0x0CB44402, 0x0CA6C402, 0x0CB44402,
+    0x0CA70402, 0x0CB44402, 0x0CA74402, 0x0CB44402, 0x0CA78402, 0x0CB44402, 0x0CA7C402, 0x0CB44402,
+    0x0CA80402, 0x0CB44402, 0x0CA84402, 0x0CB44402, 0x0CA88402, 0x0CB44402, 0x0CA8C402, 0x0CB44402,
+    0x0CA90402, 0x0CB44402, 0x0CA94402, 0x0CB44402, 0x0CA98402, 0x0CB44402, 0x0CA9C402, 0x0CB44402,
+    0x0CAA0402, 0x0CB44402, 0x0CAA4402, 0x0CB44402, 0x0CAA8402, 0x0CB44402, 0x0CAAC402, 0x0CB44402,
+    0x0CAB0402, 0x0CB44402, 0x0CAB4402, 0x0CB44402, 0x0CAB8402, 0x0CB44402, 0x0CABC402, 0x0CB44402,
+    0x0CAC0402, 0x0CB44402, 0x0CAC4402, 0x0CB44402, 0x0CAC8402, 0x0CB44402, 0x0CACC402, 0x0CB44402,
+    0x0CAD0402, 0x0CB44402, 0x0CAD4402, 0x0CB44402, 0x0CAD8402, 0x0CB44402, 0x0CADC402, 0x0CB44402,
+    0x0CAE0402, 0x0CB44402, 0x0CAE4402, 0x0CB44402, 0x0CAE8402, 0x0CB44402, 0x0CAEC402, 0x0CB44402,
+    0x0CAF0402, 0x0CB44402, 0x0CAF4402, 0x0CB44402, 0x0CAF8402, 0x0CB44402, 0x0CAFC402, 0x0CB44402,
+    0x0CB00402, 0x0CB44402, 0x0CB04402, 0x0CB44402, 0x0CB08402, 0x0CB44402, 0x0CB0C402, 0x0CB44402,
+    0x0CB10402, 0x0CB44402, 0x0CB14402, 0x0CB44402, 0x0CA58402, 0x0CB48402, 0x0CA5C402, 0x0CB48402,
+    0x0CA60402, 0x0CB48402, 0x0CA64402, 0x0CB48402, 0x0CA68402, 0x0CB48402, 0x0CA6C402, 0x0CB48402,
+    0x0CA70402, 0x0CB48402, 0x0CA74402, 0x0CB48402, 0x0CA78402, 0x0CB48402, 0x0CA7C402, 0x0CB48402,
+    0x0CA80402, 0x0CB48402, 0x0CA84402, 0x0CB48402, 0x0CA88402, 0x0CB48402, 0x0CA8C402, 0x0CB48402,
+    0x0CA90402, 0x0CB48402, 0x0CA94402, 0x0CB48402, 0x0CA98402, 0x0CB48402, 0x0CA9C402, 0x0CB48402,
+    0x0CAA0402, 0x0CB48402, 0x0CAA4402, 0x0CB48402, 0x0CAA8402, 0x0CB48402, 0x0CAAC402, 0x0CB48402,
+    0x0CAB0402, 0x0CB48402, 0x0CAB4402, 0x0CB48402, 0x0CAB8402, 0x0CB48402, 0x0CABC402, 0x0CB48402,
+    0x0CAC0402, 0x0CB48402, 0x0CAC4402, 0x0CB48402, 0x0CAC8402, 0x0CB48402, 0x0CACC402, 0x0CB48402,
+    0x0CAD0402, 0x0CB48402, 0x0CAD4402, 0x0CB48402, 0x0CAD8402, 0x0CB48402, 0x0CADC402, 0x0CB48402,
+    0x0CAE0402, 0x0CB48402, 0x0CAE4402, 0x0CB48402, 0x0CAE8402, 0x0CB48402, 0x0CAEC402, 0x0CB48402,
+    0x0CAF0402, 0x0CB48402, 0x0CAF4402, 0x0CB48402, 0x0CAF8402, 0x0CB48402, 0x0CAFC402, 0x0CB48402,
+    0x0CB00402, 0x0CB48402, 0x0CB04402, 0x0CB48402, 0x0CB08402, 0x0CB48402, 0x0CB0C402, 0x0CB48402,
+    0x0CB10402, 0x0CB48402, 0x0CB14402, 0x0CB48402, 0x07E6441E, 0x019D841E, 0x07E7041E, 0x07E6441E,
+    0x019D841E, 0x07E6841E, 0x07E6C41E, 0x019D841E, 0x07E7041E, 0x07E88408, 0x000004A2, 0x07E88408,
+    0x00000482, 0x07E88408, 0x000004E2, 0x07E88408, 0x000005A2, 0x07E88408, 0x00000562, 0x07E88408,
+    0x00000522, 0x07E8840A, 0x00002304, 0x0801C40A, 0x07F58408, 0x00000602, 0x0801C408, 0x000004A2,
+    0x0801C408, 0x00000482, 0x0801C408, 0x000004E2, 0x0801C408, 0x00000562, 0x08240408, 0x000004A2,
+    0x08240408, 0x00000482, 0x08240408, 0x000004E2, 0x08240408, 0x00000562, 0x07FAC40A, 0x00002304,
+    0x08460408, 0x000005A2, 0x084F0408, 0x000004A2, 0x084F0408, 0x00000482, 0x084F0408, 0x000004E2,
+    0x084F0408, 0x000005A2, 0x084F0408, 0x00000562, 0x084F0408, 0x000005E2, 0x0885C408, 0x000004A2,
+    0x0885C408, 0x00000482, 0x0885C408, 0x000004E2, 0x0885C408, 0x00000562, 0x089C0408, 0x00000482,
+    0x08748404, 0x00002304, 0x08748404, 0x07E88402, 0x000004A2, 0x07E88402, 0x00000482, 0x07E88402,
+    0x000004E2, 0x07E88402, 0x000005A2, 0x07E88402, 0x00000562, 0x07E88402, 0x00000522, 0x07E88404,
+    0x00002304, 0x0801C404, 0x07F58402, 0x00000602, 0x0801C402, 0x000004A2, 0x0801C402, 0x00000482,
+    0x0801C402, 0x000004E2, 0x0801C402, 0x00000562, 0x08240402, 0x000004A2, 0x08240402, 0x00000482,
+    0x08240402, 0x000004E2, 0x08240402, 0x00000562, 0x07FAC404, 0x00002304, 0x08460402, 0x000005A2,
+    0x084F0402, 0x000004A2, 0x084F0402, 0x00000482, 0x084F0402, 0x000004E2, 0x084F0402, 0x000005A2,
+    0x084F0402, 0x00000562, 0x084F0402, 0x000005E2, 0x0885C402, 0x000004A2, 0x0885C402, 0x00000482,
+    0x0885C402, 0x000004E2, 0x0885C402, 0x00000562, 0x089C0402, 0x00000482, 0x089C0402, 0x00000562,
+    0x07E88408, 0x00000642, 0x07E88402, 0x00000642, 0x07E88408, 0x000004C2, 0x07E88402, 0x000004C2,
+    0x07E88408, 0x00000622, 0x07E88402, 0x00000622, 0x07F58408, 0x00000482, 0x07F58402, 0x00000482,
+    0x07F58408, 0x000004E2, 0x07F58402, 0x000004E2, 0x07F58408, 0x000005C2, 0x07F58402, 0x000005C2,
+    0x07F58408, 0x00000502, 0x07F58402, 0x00000502, 0x07FAC408, 0x00000502, 0x07FAC402, 0x00000502,
+    0x07FAC408, 0x00000722, 0x07FAC402, 0x00000722, 0x0801C408, 0x00000642, 0x0801C402, 0x00000642,
+    0x0801C408, 0x000004C2, 0x0801C402, 0x000004C2, 0x0801C408, 0x000005C2, 0x0801C402, 0x000005C2,
+    0x0801C408, 0x00000622, 0x0801C402, 0x00000622, 0x0801C408, 0x00000502, 0x0801C402, 0x00000502,
+    0x08144408, 0x000004E2, 0x08144402, 0x000004E2, 0x08144408, 0x000004C2, 0x08144402, 0x000004C2,
+    0x08144408, 0x000005C2, 0x08144402, 0x000005C2, 0x08144408, 0x00000602, 0x08144402, 0x00000602,
+    0x081D4408, 0x000004E2, 0x081D4402, 0x000004E2, 0x081D4408, 0x00000722, 0x081D4402, 0x00000722,
+    0x08240408, 0x000005A2, 0x08240402, 0x000005A2, 0x08240408, 0x00000642, 0x08240402, 0x00000642,
+    0x08240408, 0x000004C2, 0x08240402, 0x000004C2, 0x08240408, 0x00000622, 0x08240402, 0x00000622,
+    0x08240408, 0x000005C2, 0x0824040A, 0x082AC40A, 0x08240404, 0x082AC404, 0x082AC408, 0x000004E2,
+    0x082AC402, 0x000004E2, 0x08310408, 0x00000602, 0x08310402, 0x00000602, 0x08358408, 0x00000482,
+    0x08358402, 0x00000482, 0x08358408, 0x00000602, 0x08358402, 0x00000602, 0x08358408, 0x00000502,
+    0x08358402, 0x00000502, 0x08358408, 0x00000722, 0x08358402, 0x00000722, 0x08460408, 0x00000482,
+    0x08460402, 0x00000482, 0x08460408, 0x00000602, 0x08460402, 0x00000602, 0x08460408, 0x00000502,
+    0x08460402, 0x00000502, 0x08B8C404, 0x08460404, 0x084F0408, 0x00000642, 0x084F0402, 0x00000642,
+    0x084F0408, 0x000004C2, 0x084F0402, 0x000004C2, 0x084F0408, 0x00000582, 0x084F0402, 0x00000582,
+    0x084F040A, 0x00002304, 0x0801C40A, 0x084F0404, 0x00002304, 0x0801C404, 0x0864C408, 0x00000482,
+    0x0864C402, 0x00000482, 0x0864C408, 0x00000602, 0x0864C402, 0x00000602, 0x0864C408, 0x00000502,
+    0x0864C402, 0x00000502, 0x08748408, 0x00000482, 0x08748402, 0x00000482, 0x08748408, 0x000004E2,
+    0x08748402, 0x000004E2, 0x08748408, 0x00000602, 0x08748402, 0x00000602, 0x08748408, 0x00000502,
+    0x08748402, 0x00000502, 0x087DC408, 0x00000602, 0x087DC402, 0x00000602, 0x087DC408, 0x00000502,
+    0x087DC402, 0x00000502, 0x0885C408, 0x000005A2, 0x0885C402, 0x000005A2, 0x0885C408, 0x00000642,
+    0x0885C402, 0x00000642, 0x0885C408, 0x000004C2, 0x0885C402, 0x000004C2, 0x0885C408, 0x00000522,
+    0x0885C402, 0x00000522, 0x0885C408, 0x00000582, 0x0885C402, 0x00000582, 0x0885C408, 0x00000622,
+    0x0885C402, 0x00000622, 0x08964408, 0x000004E2, 0x08964402, 0x000004E2, 0x089C0408, 0x000004E2,
+    0x089C0402, 0x000004E2, 0x089C0408, 0x00000562, 0x08A18408, 0x00000482, 0x08A18402, 0x00000482,
+    0x08A18408, 0x000005C2, 0x08A18402, 0x000005C2, 0x08A18408, 0x00000502, 0x08A18402, 0x00000502,
+    0x08748404, 0x00002324, 0x08A18404, 0x08964404, 0x084F0408, 0x000007E2, 0x084F0402, 0x000007E2,
+    0x0885C408, 0x000007E2, 0x0885C402, 0x000007E2, 0x087DC404, 0x08748404, 0x07FAC40A, 0x08A1840A,
+    0x00000504, 0x07FAC40A, 0x08A18404, 0x00000504, 0x07FAC404, 0x08A18404, 0x00000504, 0x0835840A,
+    0x082AC40A, 0x0835840A, 0x082AC404, 0x08358404, 0x082AC404, 0x0846040A, 0x082AC40A, 0x0846040A,
+    0x082AC404, 0x08460404, 0x082AC404, 0x07E88408, 0x00000502, 0x07E88402, 0x00000502, 0x08240408,
+    0x00000502, 0x08240402, 0x00000502, 0x084F0408, 0x00000502, 0x084F0402, 0x00000502, 0x0885C408,
+    0x00000502, 0x0885C402, 0x00000502, 0x0885C408, 0x00000562, 0x00000642, 0x0885C402, 0x00000562,
+    0x00000642, 0x0885C408, 0x00000562, 0x00000482, 0x0885C402, 0x00000562, 0x00000482, 0x0885C408,
+    0x00000562, 0x00000502, 0x0885C402, 0x00000562, 0x00000502, 0x0885C408, 0x00000562, 0x000004A2,
+    0x0885C402, 0x00000562, 0x000004A2, 0x07E88408, 0x00000562, 0x00000642, 0x07E88402, 0x00000562,
+    0x00000642, 0x07E88408, 0x000005C2, 0x00000642, 0x07E88402, 0x000005C2, 0x00000642, 0x07E8840A,
+    0x00002304, 0x0801C40A, 0x00000642, 0x07E88404, 0x00002304, 0x0801C404, 0x00000642, 0x08144408,
+    0x00000502, 0x08144402, 0x00000502, 0x08310408, 0x00000502, 0x08310402, 0x00000502, 0x084F0408,
+    0x00000622, 0x084F0402, 0x00000622, 0x084F0408, 0x00000622, 0x00000642, 0x084F0402, 0x00000622,
+    0x00000642, 0x08A8C408, 0x00000502, 0x08A8C402, 0x00000502, 0x082AC402, 0x00000502, 0x07FAC40A,
+    0x08A1840A, 0x07FAC40A, 0x08A18404, 0x07FAC404, 0x08A18404, 0x08144408, 0x00000482, 0x08144402,
+    0x00000482, 0x08460408, 0x000004A2, 0x08460402, 0x000004A2, 0x07E88408, 0x00000522, 0x00000482,
+    0x07E88402, 0x00000522, 0x00000482, 0x07E8840A, 0x00002304, 0x0801C40A, 0x00000482, 0x07E88404,
+    0x00002304, 0x0801C404, 0x00000482, 0x084F0408, 0x000005E2, 0x00000482, 0x084F0402, 0x000005E2,
+    0x00000482, 0x07E88408, 0x00000782, 0x07E88402, 0x00000782, 0x07E88408, 0x000007C2, 0x07E88402,
+    0x000007C2, 0x0801C408, 0x00000782, 0x0801C402, 0x00000782, 0x0801C408, 0x000007C2, 0x0801C402,
+    0x000007C2, 0x08240408, 0x00000782, 0x08240402, 0x00000782, 0x08240408, 0x000007C2, 0x08240402,
+    0x000007C2, 0x084F0408, 0x00000782, 0x084F0402, 0x00000782, 0x084F0408, 0x000007C2, 0x084F0402,
+    0x000007C2, 0x0864C408, 0x00000782, 0x0864C402, 0x00000782, 0x0864C408, 0x000007C2, 0x0864C402,
+    0x000007C2, 0x0885C408, 0x00000782, 0x0885C402, 0x00000782, 0x0885C408, 0x000007C2, 0x0885C402,
+    0x000007C2, 0x08748408, 0x000008A2, 0x08748402, 0x000008A2, 0x087DC408, 0x000008A2, 0x087DC402,
+    0x000008A2, 0x081D4408, 0x00000502, 0x081D4402, 0x00000502, 0x07E88408, 0x000005C2, 0x07E88402,
+    0x000005C2, 0x0801C408, 0x00000602, 0x0801C402, 0x00000602, 0x084F0408, 0x00000562, 0x00000642,
+    0x084F0402, 0x00000562, 0x00000642, 0x084F0408, 0x000005A2, 0x00000642, 0x084F0402, 0x000005A2,
+    0x00000642, 0x084F0408, 0x000005C2, 0x084F0402, 0x000005C2, 0x084F0408, 0x000005C2, 0x00000642,
+    0x084F0402, 0x000005C2, 0x00000642, 0x089C0408, 0x00000642, 0x089C0402, 0x00000642, 0x07FAC404,
+    0x07EF0404, 0x08600404, 0x085AC404, 0x07FAC404, 0x08A8C404, 0x07FAC404, 0x08A64404, 0x087DC404,
+    0x08790404, 0x087DC404, 0x07F94404, 0x08108404, 0x084DC404, 0x08358404, 0x08748404, 0x08358404,
+    0x08A18404, 0x00000562, 0x00000482, 0x012EC402, 0x00000482, 0x08C78408, 0x00000482, 0x08C8C408,
+    0x00000482, 0x08CA4408, 0x00000482, 0x08CAC408, 0x00000482, 0x08CCC408, 0x00000482, 0x08D04408,
+    0x00000482, 0x08D18408, 0x00000482, 0x08CAC402, 0x00000562, 0x00000482, 0x08CAC408, 0x00000562,
+    0x08D04408, 0x00000562, 0x08C78402, 0x00000482, 0x08C8C402, 0x00000482, 0x08CA4402, 0x00000482,
+    0x08CAC402, 0x00000482, 0x08D04402, 0x00000562, 0x00000482, 0x08CAC402, 0x00000562, 0x08D04402,
+    0x00000562, 0x08CCC402, 0x00000482, 0x08D04402, 0x00000482, 0x08D18402, 0x00000482, 0x08CB440A,
+    0x08C78404, 0x08CAC404, 0x08D0440A, 0x00000482, 0x08D0440A, 0x00000562, 0x08CB4404, 0x08C78404,
+    0x08CAC404, 0x08EFC408, 0x000004A2, 0x08EFC408, 0x00000562, 0x08E6C408, 0x00000482, 0x08FB4408,
+    0x00000562, 0x08FEC408, 0x00000482, 0x08F94408, 0x000004A2, 0x09208408, 0x000004C2, 0x08EFC402,
+    0x000004A2, 0x08EFC402, 0x00000562, 0x08E6C402, 0x00000482, 0x08FB4402, 0x00000562, 0x08FEC402,
+    0x00000482, 0x08F94402, 0x000004A2, 0x09208402, 0x000004C2, 0x094F0408, 0x00000782, 0x094F0402,
+    0x00000782, 0x08E6C40A, 0x00002324, 0x08E6C404, 0x00002324, 0x08F1C408, 0x000004C2, 0x08F1C402,
+    0x000004C2, 0x08E1C408, 0x000004C2, 0x08E1C402, 0x000004C2, 0x08E1C408, 0x00000562, 0x08E1C402,
+    0x00000562, 0x08EFC408, 0x000004C2, 0x08EFC402, 0x000004C2, 0x08E2C408, 0x00000562, 0x08E2C402,
+    0x00000562, 0x08F1C408, 0x00000562, 0x08F1C402, 0x00000562, 0x08F44408, 0x00000562, 0x08F44402,
+    0x00000562, 0x08F94408, 0x00000642, 0x08F94402, 0x00000642, 0x08F94408, 0x00000562, 0x08F94402,
+    0x00000562, 0x09130408, 0x00000562, 0x09130402, 0x00000562, 0x09140408, 0x00000562, 0x09140402,
+    0x00000562, 0x09428408, 0x00000562, 0x09428402, 0x00000562, 0x09208408, 0x00000642, 0x09208402,
+    0x00000642, 0x09208408, 0x00000562, 0x09208402, 0x00000562, 0x09208408, 0x00000582, 0x09208402,
+    0x00000582, 0x09324408, 0x00000562, 0x09324402, 0x00000562, 0x093E4408, 0x00000562, 0x093E4402,
+    0x00000562, 0x097E8404, 0x09860404, 0x0989C404, 0x09888404, 0x0988C404, 0x09888404, 0x0988C404,
+    0x0988C404, 0x0988C404, 0x0989C404, 0x0989C404, 0x0989C404, 0x099C8404, 0x09990404, 0x09CA0404,
+    0x09990404, 0x09CB0404, 0x09990404, 0x09CDC404, 0x09990404, 0x09C9C402, 0x00001062, 0x09C90402,
+    0x00001062, 0x09D14402, 0x00001062, 0x09990404, 0x00002324, 0x09C50404, 0x00002324, 0x09D28404,
+    0x00002324, 0x09D48404, 0x00002324, 0x09D70404, 0x00002324, 0x09D24404, 0x00002344, 0x09D28404,
+    0x00002344, 0x09D30404, 0x00002344, 0x09F14404, 0x00002304, 0x09F18404, 0x00002304, 0x09F20404,
+    0x00002304, 0x0A82C402, 0x00001842, 0x0A850402, 0x00001842, 0x0A858402, 0x00001842, 0x0A7CC402,
+    0x00001842, 0x0A7D0402, 0x00001842, 0x0A7D4402, 0x00001842, 0x0A7EC402, 0x00001842, 0x0A80C402,
+    0x00001842, 0x0A814402, 0x00001842, 0x0A834402, 0x00001842, 0x0A848402, 0x00001842, 0x0A96C404,
+    0x0A9F0404, 0x0A960402, 0x00001842, 0x0A964402, 0x00001842, 0x0A994402, 0x00001842, 0x0AAAC402,
+    0x00001842, 0x0AA30402, 0x00001842, 0x0AA40402, 0x00001842, 0x0AA44402, 0x00001842, 0x0AA58402,
+    0x00001842, 0x0AA90402, 0x00001842, 0x0AC5C402, 0x00001842, 0x0AC60402, 0x00001842, 0x0B0C8404,
+    0x0B13C404, 0x0B0C0404, 0x0B13C404, 0x0B0C4404, 0x0B13C404, 0x0B0E8404, 0x0B13C404, 0x0B094404,
+    0x0B13C404, 0x0B0A8404, 0x0B13C404, 0x0B0CC404, 0x0B13C404, 0x0B0E4404, 0x0B13C404, 0x0B05C404,
+    0x0B13C404, 0x0C9F8404, 0x0C9BC404, 0x0C9F8404, 0x0C9DC404, 0x0CC7C404, 0x0CCD8404, 0x00001884,
+    0x0CB78402, 0x0CC78402, 0x0CBB8402, 0x0CC78402, 0x0CBD8402, 0x0CC78402, 0x0CBF8402, 0x0CC78402,
+    0x0CC18402, 0x0CC78402, 0x0CB64402, 0x0CC68402, 0x0CC48404, 0x00002324, 0x0CB7C402, 0x0CC78402,
+    0x0CBBC402, 0x0CC78402, 0x0CBDC402, 0x0CC78402, 0x0CBFC402, 0x0CC78402, 0x0CC1C402, 0x0CC78402,
+    0x0CB68402, 0x0CC68402, 0x0CC24404, 0x00002324, 0x0CC44404, 0x00002324, 0x0CC4C404, 0x00002324,
+    0x0D724404, 0x0D808404, 0x0D724404, 0x0F0D4404, 0x00002304, 0x0F0D8404, 0x00002304, 0x0F0D8404,
+    0x00002324, 0x0F0DC404, 0x00002304, 0x0F0E0404, 0x00002304, 0x0F0E0404, 0x00002324, 0x0F0E0404,
+    0x00002344, 0x0F0E0404, 0x00002364, 0x0F0F4404, 0x00002304, 0x0F0F4404, 0x00002324, 0x0F0F4404,
+    0x00002344, 0x0F0F4404, 0x00002364, 0x0F104404, 0x00002304, 0x0F104404, 0x00002324, 0x0F104404,
+    0x00002344, 0x0F108404, 0x00002304, 0x0F108404, 0x00002324, 0x0F10C404, 0x00002304, 0x0F114404,
+    0x00002304, 0x0F118404, 0x00002304, 0x0F128404, 0x00002304, 0x0F128404, 0x00002344, 0x0F128404,
+    0x00002364, 0x0F128404, 0x00002384, 0x0F130404, 0x00002304, 0x0F130404, 0x00002324, 0x0F134404,
+    0x00002304, 0x0F134404, 0x00002324, 0x0F120404, 0x00002304, 0x0F140404, 0x00002304, 0x0F140404,
+    0x00002324, 0x0F144404, 0x00002304, 0x0F148404, 0x00002304, 0x0F188404, 0x00002304, 0x0F188404,
+    0x00002324, 0x0F100404, 0x00002304, 0x0F128404, 0x00002324, 0x0F118404, 0x0F144404, 0x0F140404,
+    0x00002304, 0x0F140404, 0x00002304, 0x0F0DC404, 0x0F0DC404, 0x0D170404, 0x0D1E8404, 0x0D17C404,
+    0x0D1EC404, 0x0DBE8404, 0x0DC40404, 0x0DBE8404, 0x0DC40404, 0x0DC6C404, 0x0DD28404, 0x0DDC0404,
+    0x0DD28404, 0x07E88414, 0x00002314, 0x0801C414, 0x08144404, 0x00002324, 0x087DC404, 0x00002304,
+    0x081D4404, 0x07FAC414, 0x00002314, 0x07E88404, 0x00002304, 0x07E88404, 0x084F0404, 0x07E88404,
+    0x0891C404, 0x07F58404, 0x00000604, 0x07FAC404, 0x00002324, 0x084F0404, 0x00000684, 0x0885C404,
+    0x00000684, 0x07E88404, 0x00000564, 0x084F0404, 0x00000564, 0x0885C404, 0x00000564, 0x07E88408,
+    0x00000882, 0x07E88402, 0x00000882, 0x07EF0408, 0x000005C2, 0x07EF0402, 0x000005C2, 0x07EF0408,
+    0x00000842, 0x07EF0402, 0x00000842, 0x07EF0408, 0x00000922, 0x07EF0402, 0x00000922, 0x07F58408,
+    0x00000602, 0x00000482, 0x07F58402, 0x00000602, 0x00000482, 0x07FAC408, 0x000005C2, 0x07FAC402,
+    0x000005C2, 0x07FAC408, 0x00000842, 0x07FAC402, 0x00000842, 0x07FAC408, 0x00000922, 0x07FAC402,
+    0x00000922, 0x07FAC408, 0x00000602, 0x07FAC402, 0x00000602, 0x07FAC408, 0x000008C2, 0x07FAC402,
+    0x000008C2, 0x0801C408, 0x00000642, 0x000004A2, 0x0801C402, 0x00000642, 0x000004A2, 0x0801C408,
+    0x00000642, 0x00000482, 0x0801C402, 0x00000642, 0x00000482, 0x0801C408, 0x000008C2, 0x0801C402,
+    0x000008C2, 0x0801C408, 0x00000902, 0x0801C402, 0x00000902, 0x0801C408, 0x00000602, 0x000004C2,
+    0x0801C402, 0x00000602, 0x000004C2, 0x08108408, 0x000005C2, 0x08108402, 0x000005C2, 0x08144408,
+    0x00000642, 0x08144402, 0x00000642, 0x081D4408, 0x000005C2, 0x081D4402, 0x000005C2, 0x081D4408,
+    0x00000842, 0x081D4402, 0x00000842, 0x081D4408, 0x00000562, 0x081D4402, 0x00000562, 0x081D4408,
+    0x00000602, 0x081D4402, 0x00000602, 0x081D4408, 0x000008E2, 0x081D4402, 0x000008E2, 0x08240408,
+    0x00000902, 0x08240402, 0x00000902, 0x08240408, 0x00000562, 0x00000482, 0x08240402, 0x00000562,
+    0x00000482, 0x08310408, 0x00000482, 0x08310402, 0x00000482, 0x08310408, 0x00000842, 0x08310402,
+    0x00000842, 0x08310408, 0x00000922, 0x08310402, 0x00000922, 0x08358408, 0x00000842, 0x08358402,
+    0x00000842, 0x08358408, 0x00000842, 0x00000642, 0x08358402, 0x00000842, 0x00000642, 0x08358408,
+    0x00000922, 0x08358402, 0x00000922, 0x08358408, 0x000008C2, 0x08358402, 0x000008C2, 0x08424408,
+    0x00000482, 0x08424402, 0x00000482, 0x08424408, 0x000005C2, 0x08424402, 0x000005C2, 0x08424408,
+    0x00000842, 0x08424402, 0x00000842, 0x08460408, 0x000005C2, 0x08460402, 0x000005C2, 0x08460408,
+    0x00000842, 0x08460402, 0x00000842, 0x08460408, 0x00000922, 0x08460402, 0x00000922, 0x08460408,
+    0x000008C2, 0x08460402, 0x000008C2, 0x084F0408, 0x000005A2, 0x00000482, 0x084F0402, 0x000005A2,
+    0x00000482, 0x084F0408, 0x000005A2, 0x00000562, 0x084F0402, 0x000005A2, 0x00000562, 0x084F0408,
+    0x00000642, 0x000004A2, 0x084F0402, 0x00000642, 0x000004A2, 0x084F0408, 0x00000642, 0x00000482,
+    0x084F0402, 0x00000642, 0x00000482, 0x085AC408, 0x00000482, 0x085AC402, 0x00000482, 0x085AC408,
+    0x000005C2, 0x085AC402, 0x000005C2, 0x0864C408, 0x000005C2, 0x0864C402, 0x000005C2, 0x0864C408,
+    0x00000842, 0x0864C402, 0x00000842, 0x0864C408, 0x00000842, 0x00000642, 0x0864C402, 0x00000842,
+    0x00000642, 0x0864C408, 0x00000922, 0x0864C402, 0x00000922, 0x08748408, 0x000005C2, 0x08748402,
+    0x000005C2, 0x08748408, 0x00000842, 0x08748402, 0x00000842, 0x08748408, 0x00000482, 0x000005C2,
+    0x08748402, 0x00000482, 0x000005C2, 0x08748408, 0x00000502, 0x000005C2, 0x08748402, 0x00000502,
+    0x000005C2, 0x08748408, 0x00000842, 0x000005C2, 0x08748402, 0x00000842, 0x000005C2, 0x087DC408,
+    0x000005C2, 0x087DC402, 0x000005C2, 0x087DC408, 0x00000842, 0x087DC402, 0x00000842, 0x087DC408,
+    0x00000922, 0x087DC402, 0x00000922, 0x087DC408, 0x000008C2, 0x087DC402, 0x000008C2, 0x0885C408,
+    0x00000862, 0x0885C402, 0x00000862, 0x0885C408, 0x00000902, 0x0885C402, 0x00000902, 0x0885C408,
+    0x000008C2, 0x0885C402, 0x000008C2, 0x0885C408, 0x000005A2, 0x00000482, 0x0885C402, 0x000005A2,
+    0x00000482, 0x0885C408, 0x00000642, 0x00000562, 0x0885C402, 0x00000642, 0x00000562, 0x0891C408,
+    0x000005A2, 0x0891C402, 0x000005A2, 0x0891C408, 0x00000842, 0x0891C402, 0x00000842, 0x08964408,
+    0x000004A2, 0x08964402, 0x000004A2, 0x08964408, 0x00000482, 0x08964402, 0x00000482, 0x08964408,
+    0x00000562, 0x08964402, 0x00000562, 0x08964408, 0x000005C2, 0x08964402, 0x000005C2, 0x08964408,
+    0x00000842, 0x08964402, 0x00000842, 0x08990408, 0x000005C2, 0x08990402, 0x000005C2, 0x08990408,
+    0x00000562, 0x08990402, 0x00000562, 0x089C0408, 0x000005C2, 0x089C0402, 0x000005C2, 0x08A18408,
+    0x000004E2, 0x08A18402, 0x000004E2, 0x08A18408, 0x00000842, 0x08A18402, 0x00000842, 0x08A18408,
+    0x00000922, 0x08A18402, 0x00000922, 0x081D4402, 0x00000922, 0x087DC402, 0x00000562, 0x08964402,
+    0x00000522, 0x089C0402, 0x00000522, 0x07E88404, 0x08B94404, 0x08748404, 0x00002324, 0x000005C2,
+    0x0874840A, 0x00002304, 0x0874840A, 0x07E88408, 0x00000842, 0x07E88402, 0x00000842, 0x07E88408,
+    0x00000762, 0x07E88402, 0x00000762, 0x07E88408, 0x000004E2, 0x00000482, 0x07E88402, 0x000004E2,
+    0x00000482, 0x07E88408, 0x000004E2, 0x000004A2, 0x07E88402, 0x000004E2, 0x000004A2, 0x07E88408,
+    0x000004E2, 0x00000762, 0x07E88402, 0x000004E2, 0x00000762, 0x07E88408, 0x000004E2, 0x000005A2,
+    0x07E88402, 0x000004E2, 0x000005A2, 0x07E88408, 0x00000842, 0x000004E2, 0x07E88402, 0x00000842,
+    0x000004E2, 0x07E88408, 0x000004C2, 0x00000482, 0x07E88402, 0x000004C2, 0x00000482, 0x07E88408,
+    0x000004C2, 0x000004A2, 0x07E88402, 0x000004C2, 0x000004A2, 0x07E88408, 0x000004C2, 0x00000762,
+    0x07E88402, 0x000004C2, 0x00000762, 0x07E88408, 0x000004C2, 0x000005A2, 0x07E88402, 0x000004C2,
+    0x000005A2, 0x07E88408, 0x00000842, 0x000004C2, 0x07E88402, 0x00000842, 0x000004C2, 0x0801C408,
+    0x00000842, 0x0801C402, 0x00000842, 0x0801C408, 0x00000762, 0x0801C402, 0x00000762, 0x0801C408,
+    0x000005A2, 0x0801C402, 0x000005A2, 0x0801C408, 0x000004E2, 0x00000482, 0x0801C402, 0x000004E2,
+    0x00000482, 0x0801C408, 0x000004E2, 0x000004A2, 0x0801C402, 0x000004E2, 0x000004A2, 0x0801C408,
+    0x000004E2, 0x00000762, 0x0801C402, 0x000004E2, 0x00000762, 0x0801C408, 0x000004E2, 0x000005A2,
+    0x0801C402, 0x000004E2, 0x000005A2, 0x0801C408, 0x00000842, 0x000004E2, 0x0801C402, 0x00000842,
+    0x000004E2, 0x08240408, 0x00000762, 0x08240402, 0x00000762, 0x08240408, 0x00000842, 0x08240402,
+    0x00000842, 0x084F0408, 0x00000842, 0x084F0402, 0x00000842, 0x084F0408, 0x00000762, 0x084F0402,
+    0x00000762, 0x084F0408, 0x000004E2, 0x00000482, 0x084F0402, 0x000004E2, 0x00000482, 0x084F0408,
+    0x000004E2, 0x000004A2, 0x084F0402, 0x000004E2, 0x000004A2, 0x084F0408, 0x000004E2, 0x00000762,
+    0x084F0402, 0x000004E2, 0x00000762, 0x084F0408, 0x000004E2, 0x000005A2, 0x084F0402, 0x000004E2,
+    0x000005A2, 0x084F0408, 0x00000842, 0x000004E2, 0x084F0402, 0x00000842, 0x000004E2, 0x084F0408,
+    0x000007E2, 0x00000482, 0x084F0402, 0x000007E2, 0x00000482, 0x084F0408, 0x000007E2, 0x000004A2,
+    0x084F0402, 0x000007E2, 0x000004A2, 0x084F0408, 0x000007E2, 0x00000762, 0x084F0402, 0x000007E2,
+    0x00000762, 0x084F0408, 0x000007E2, 0x000005A2, 0x084F0402, 0x000007E2, 0x000005A2, 0x084F0408,
+    0x000007E2, 0x00000842, 0x084F0402, 0x000007E2, 0x00000842, 0x0885C408, 0x00000842, 0x0885C402,
+    0x00000842, 0x0885C408, 0x00000762, 0x0885C402, 0x00000762, 0x0885C408, 0x000007E2, 0x00000482,
+    0x0885C402, 0x000007E2, 0x00000482, 0x0885C408, 0x000007E2, 0x000004A2, 0x0885C402, 0x000007E2,
+    0x000004A2, 0x0885C408, 0x000007E2, 0x00000762, 0x0885C402, 0x000007E2, 0x00000762, 0x0885C408,
+    0x000007E2, 0x000005A2, 0x0885C402, 0x000007E2, 0x000005A2, 0x0885C408, 0x000007E2, 0x00000842,
+    0x0885C402, 0x000007E2, 0x00000842, 0x089C0408, 0x000004A2, 0x089C0402, 0x000004A2, 0x089C0408,
+    0x00000842, 0x089C0402, 0x00000842, 0x089C0408, 0x00000762, 0x089C0402, 0x00000762, 0x089C0408,
+    0x000005A2, 0x089C0402, 0x000005A2, 0x0835840A, 0x0835840A, 0x08358404, 0x08358404, 0x08C78402,
+    0x00000442, 0x08C78402, 0x00000462, 0x08C78402, 0x00000442, 0x000004A2, 0x08C78402, 0x00000462,
+    0x000004A2, 0x08C78402, 0x00000442, 0x00000482, 0x08C78402, 0x00000462, 0x00000482, 0x08C78402,
+    0x00000442, 0x00000542, 0x08C78402, 0x00000462, 0x00000542, 0x08C78408, 0x00000442, 0x08C78408,
+    0x00000462, 0x08C78408, 0x00000442, 0x000004A2, 0x08C78408, 0x00000462, 0x000004A2, 0x08C78408,
+    0x00000442, 0x00000482, 0x08C78408, 0x00000462, 0x00000482, 0x08C78408, 0x00000442, 0x00000542,
+    0x08C78408, 0x00000462, 0x00000542, 0x08C8C402, 0x00000442, 0x08C8C402, 0x00000462, 0x08C8C402,
+    0x00000442, 0x000004A2, 0x08C8C402, 0x00000462, 0x000004A2, 0x08C8C402, 0x00000442, 0x00000482,
+    0x08C8C402, 0x00000462, 0x00000482, 0x08C8C408, 0x00000442, 0x08C8C408, 0x00000462, 0x08C8C408,
+    0x00000442, 0x000004A2, 0x08C8C408, 0x00000462, 0x000004A2, 0x08C8C408, 0x00000442, 0x00000482,
+    0x08C8C408, 0x00000462, 0x00000482, 0x08CA4402, 0x00000442, 0x08CA4402, 0x00000462, 0x08CA4402,
+    0x00000442, 0x000004A2, 0x08CA4402, 0x00000462, 0x000004A2, 0x08CA4402, 0x00000442, 0x00000482,
+    0x08CA4402, 0x00000462, 0x00000482, 0x08CA4402, 0x00000442, 0x00000542, 0x08CA4402, 0x00000462,
+    0x00000542, 0x08CA4408, 0x00000442, 0x08CA4408, 0x00000462, 0x08CA4408, 0x00000442, 0x000004A2,
+    0x08CA4408, 0x00000462, 0x000004A2, 0x08CA4408, 0x00000442, 0x00000482, 0x08CA4408, 0x00000462,
+    0x00000482, 0x08CA4408, 0x00000442, 0x00000542, 0x08CA4408, 0x00000462, 0x00000542, 0x08CAC402,
+    0x00000442, 0x08CAC402, 0x00000462, 0x08CAC402, 0x00000442, 0x000004A2, 0x08CAC402, 0x00000462,
+    0x000004A2, 0x08CAC402, 0x00000442, 0x00000482, 0x08CAC402, 0x00000462, 0x00000482, 0x08CAC402,
+    0x00000442, 0x00000542, 0x08CAC402, 0x00000462, 0x00000542, 0x08CAC408, 0x00000442, 0x08CAC408,
+    0x00000462, 0x08CAC408, 0x00000442, 0x000004A2, 0x08CAC408, 0x00000462, 0x000004A2, 0x08CAC408,
+    0x00000442, 0x00000482, 0x08CAC408, 0x00000462, 0x00000482, 0x08CAC408, 0x00000442, 0x00000542,
+    0x08CAC408, 0x00000462, 0x00000542, 0x08CCC402, 0x00000442, 0x08CCC402, 0x00000462, 0x08CCC402,
+    0x00000442, 0x000004A2, 0x08CCC402, 0x00000462, 0x000004A2, 0x08CCC402, 0x00000442, 0x00000482,
+    0x08CCC402, 0x00000462, 0x00000482, 0x08CCC408, 0x00000442, 0x08CCC408, 0x00000462, 0x08CCC408,
+    0x00000442, 0x000004A2, 0x08CCC408, 0x00000462, 0x000004A2, 0x08CCC408, 0x00000442, 0x00000482,
+    0x08CCC408, 0x00000462, 0x00000482, 0x08D04402, 0x00000442, 0x08D04402, 0x00000462, 0x08D04402,
+    0x00000442, 0x000004A2, 0x08D04402, 0x00000462, 0x000004A2, 0x08D04402, 0x00000442, 0x00000482,
+    0x08D04402, 0x00000462, 0x00000482, 0x08D04402, 0x00000442, 0x00000542, 0x08D04402, 0x00000462,
+    0x00000542, 0x08D04408, 0x00000462, 0x08D04408, 0x00000462, 0x000004A2, 0x08D04408, 0x00000462,
+    0x00000482, 0x08D04408, 0x00000462, 0x00000542, 0x08D18402, 0x00000442, 0x08D18402, 0x00000462,
+    0x08D18402, 0x00000442, 0x000004A2, 0x08D18402, 0x00000462, 0x000004A2, 0x08D18402, 0x00000442,
+    0x00000482, 0x08D18402, 0x00000462, 0x00000482, 0x08D18402, 0x00000442, 0x00000542, 0x08D18402,
+    0x00000462, 0x00000542, 0x08D18408, 0x00000442, 0x08D18408, 0x00000462, 0x08D18408, 0x00000442,
+    0x000004A2, 0x08D18408, 0x00000462, 0x000004A2, 0x08D18408, 0x00000442, 0x00000482, 0x08D18408,
+    0x00000462, 0x00000482, 0x08D18408, 0x00000442, 0x00000542, 0x08D18408, 0x00000462, 0x00000542,
+    0x08C78402, 0x000004A2, 0x08C8C402, 0x000004A2, 0x08CA4402, 0x000004A2, 0x08CAC402, 0x000004A2,
+    0x08CCC402, 0x000004A2, 0x08D04402, 0x000004A2, 0x08D18402, 0x000004A2, 0x08C78402, 0x00000442,
+    0x00000982, 0x08C78402, 0x00000462, 0x00000982, 0x08C78402, 0x00000442, 0x000004A2, 0x00000982,
+    0x08C78402, 0x00000462, 0x000004A2, 0x00000982, 0x08C78402, 0x00000442, 0x00000482, 0x00000982,
+    0x08C78402, 0x00000462, 0x00000482, 0x00000982, 0x08C78402, 0x00000442, 0x00000542, 0x00000982,
+    0x08C78402, 0x00000462, 0x00000542, 0x00000982, 0x08C78408, 0x00000442, 0x00000982, 0x08C78408,
+    0x00000462, 0x00000982, 0x08C78408, 0x00000442, 0x000004A2, 0x00000982, 0x08C78408, 0x00000462,
+    0x000004A2, 0x00000982, 0x08C78408, 0x00000442, 0x00000482, 0x00000982, 0x08C78408, 0x00000462,
+    0x00000482, 0x00000982, 0x08C78408, 0x00000442, 0x00000542, 0x00000982, 0x08C78408, 0x00000462,
+    0x00000542, 0x00000982, 0x08CA4402, 0x00000442, 0x00000982, 0x08CA4402, 0x00000462, 0x00000982,
+    0x08CA4402, 0x00000442, 0x000004A2, 0x00000982, 0x08CA4402, 0x00000462, 0x000004A2, 0x00000982,
+    0x08CA4402, 0x00000442, 0x00000482, 0x00000982, 0x08CA4402, 0x00000462, 0x00000482, 0x00000982,
+    0x08CA4402, 0x00000442, 0x00000542, 0x00000982, 0x08CA4402, 0x00000462, 0x00000542, 0x00000982,
+    0x08CA4408, 0x00000442, 0x00000982, 0x08CA4408, 0x00000462, 0x00000982, 0x08CA4408, 0x00000442,
+    0x000004A2, 0x00000982, 0x08CA4408, 0x00000462, 0x000004A2, 0x00000982, 0x08CA4408, 0x00000442,
+    0x00000482, 0x00000982, 0x08CA4408, 0x00000462, 0x00000482, 0x00000982, 0x08CA4408, 0x00000442,
+    0x00000542, 0x00000982, 0x08CA4408, 0x00000462, 0x00000542, 0x00000982, 0x08D18402, 0x00000442,
+    0x00000982, 0x08D18402, 0x00000462, 0x00000982, 0x08D18402, 0x00000442, 0x000004A2, 0x00000982,
+    0x08D18402, 0x00000462, 0x000004A2, 0x00000982, 0x08D18402, 0x00000442, 0x00000482, 0x00000982,
+    0x08D18402, 0x00000462, 0x00000482, 0x00000982, 0x08D18402, 0x00000442, 0x00000542, 0x00000982,
+    0x08D18402, 0x00000462, 0x00000542, 0x00000982, 0x08D18408, 0x00000442, 0x00000982, 0x08D18408,
+    0x00000462, 0x00000982, 0x08D18408, 0x00000442, 0x000004A2, 0x00000982, 0x08D18408, 0x00000462,
+    0x000004A2, 0x00000982, 0x08D18408, 0x00000442, 0x00000482, 0x00000982, 0x08D18408, 0x00000462,
+    0x00000482, 0x00000982, 0x08D18408, 0x00000442, 0x00000542, 0x00000982, 0x08D18408, 0x00000462,
+    0x00000542, 0x00000982, 0x08C78402, 0x000004C2, 0x08C78402, 0x00000642, 0x08C78402, 0x000004A2,
+    0x00000982, 0x08C78402, 0x00000982, 0x08C78402, 0x00000482, 0x00000982, 0x08C78402, 0x00000542,
+    0x08C78402, 0x00000542, 0x00000982, 0x08C78408, 0x000004C2, 0x08C78408, 0x00000642, 0x08C78408,
+    0x000004A2, 0x08C78408, 0x00000982, 0x012EC402, 0x00000542, 0x08CA4402, 0x000004A2, 0x00000982,
+    0x08CA4402, 0x00000982, 0x08CA4402, 0x00000482, 0x00000982, 0x08CA4402, 0x00000542, 0x08CA4402,
+    0x00000542, 0x00000982, 0x08C8C408, 0x000004A2, 0x08CA4408, 0x000004A2, 0x08CA4408, 0x00000982,
+    0x01300402, 0x000004A2, 0x01300402, 0x00000482, 0x01300402, 0x00000542, 0x08CAC402, 0x000004C2,
+    0x08CAC402, 0x00000642, 0x08CAC402, 0x00000562, 0x000004A2, 0x08CAC402, 0x00000542, 0x08CAC402,
+    0x00000562, 0x00000542, 0x08CAC408, 0x000004C2, 0x08CAC408, 0x00000642, 0x08CAC408, 0x000004A2,
+    0x01304402, 0x000004A2, 0x01304402, 0x00000482, 0x01304402, 0x00000542, 0x08D04402, 0x000004C2,
+    0x08D04402, 0x00000642, 0x08D04402, 0x00000562, 0x000004A2, 0x08CE4402, 0x00000442, 0x08CE4402,
+    0x00000462, 0x08D04402, 0x00000542, 0x08D04402, 0x00000562, 0x00000542, 0x08D04408, 0x000004C2,
+    0x08D04408, 0x00000642, 0x08D04408, 0x000004A2, 0x08CE4408, 0x00000462, 0x012EC402, 0x000004A2,
+    0x08D18402, 0x000004A2, 0x00000982, 0x08D18402, 0x00000982, 0x08D18402, 0x00000482, 0x00000982,
+    0x08D18402, 0x00000542, 0x08D18402, 0x00000542, 0x00000982, 0x08CCC408, 0x000004A2, 0x08D18408,
+    0x000004A2, 0x08D18408, 0x00000982, 0x009F8404, 0x009F8404, 0x009F8404, 0x009F8404, 0x009F8404,
+    0x00EFC404, 0x00EFC404, 0x00EFC404, 0x00EFC404, 0x00EFC404, 0x00F00404, 0x00F00404, 0x00F00404,
+    0x00F00404, 0x00F00404, 0x0099C404, 0x0099C404, 0x009B4404, 0x009B4404, 0x009B4404, 0x0099C404,
+    0x0099C404, 0x009B4404, 0x00EFC404, 0x00EFC404, 0x00EFC404, 0x00EFC404, 0x0864C40A, 0x08748404,
+    0x07E88404, 0x00E98404, 0x07F58404, 0x07E88404, 0x00E98404, 0x08748404, 0x014A8404, 0x07F5840A,
+    0x07F58404, 0x00E98404, 0x084F0404, 0x07F58404, 0x00E98404, 0x0885C404, 0x014A8404, 0x0810840A,
+    0x0846040A, 0x084F0404, 0x08748414, 0x08424414, 0x087DC40A, 0x0801C40A, 0x0835840A, 0x087DC414,
+    0x08424414, 0x0810840A, 0x07E8840A, 0x0899040A, 0x07E8840A, 0x00E98404, 0x0874840A, 0x07E6441E,
+    0x019D841E, 0x07E7C41E, 0x07E6441E, 0x019D841E, 0x07E8441E, 0x07E6441E, 0x019D841E, 0x07E6441E,
+    0x07E6041E, 0x07E6441E, 0x019D841E, 0x07E6C41E, 0x07E6841E, 0x019D841E, 0x07E6C41E, 0x07E6441E,
+    0x019D841E, 0x07E7441E, 0x07E6841E, 0x019D841E, 0x07E7441E, 0x07E6C41E, 0x019D841E, 0x07E7441E,
+    0x07E7041E, 0x019D841E, 0x07E7441E, 0x07E6441E, 0x019D841E, 0x07E7841E, 0x07E7441E, 0x019D841E,
+    0x07E7841E, 0x07E6441E, 0x019D841E, 0x07E8041E, 0x07E6C41E, 0x019D841E, 0x07E8041E, 0x07E7441E,
+    0x019D841E, 0x07E8041E, 0x07E7C41E, 0x019D841E, 0x07E8041E, 0x07E6441E, 0x019D841E, 0x0824040A,
+    0x0824040A, 0x0824040A, 0x0824040A, 0x0824040A, 0x0824040A, 0x0891C40A, 0x0891C40A, 0x0824040A,
+    0x0891C40A, 0x0824040A, 0x0824040A, 0x0891C40A, 0x0824040A, 0x0824040A, 0x0824040A, 0x0824040A,
+    0x0899040A, 0x0899040A, 0x0824040A, 0x0899040A, 0x0824040A, 0x0824040A, 0x08240404, 0x08240404,
+    0x08240404, 0x08240404, 0x08240404, 0x08240404, 0x0891C404, 0x0891C404, 0x08240404, 0x0891C404,
+    0x08240404, 0x08240404, 0x0891C404, 0x08240404, 0x08240404, 0x08240404, 0x08240404, 0x08990404,
+    0x08990404, 0x08240404, 0x08990404, 0x08240404, 0x08240404, 0x07E6041E, 0x019D841E, 0x07E6C41E,
+    0x017B0402, 0x000005E2, 0x017B4402, 0x000005E2, 0x017C0402, 0x000005E2, 0x01898402, 0x000005E2,
+    0x018A8402, 0x000005E2, 0x018A0402, 0x000005E2, 0x01964402, 0x000005E2, 0x01974402, 0x000005E2,
+    0x0197C402, 0x000005E2, 0x01A18402, 0x000005E2, 0x01A1C402, 0x000005E2, 0x01A30404, 0x01A30404,
+    0x01A30404, 0x01A30404, 0x01A30404, 0x01A34404, 0x01A34404, 0x01A34404, 0x01A34404, 0x01A34404,
+    0x01A64402, 0x000005E2, 0x01A7C402, 0x000005E2, 0x01A80402, 0x000005E2, 0x01A88402, 0x000005E2,
+    0x019AC402, 0x000005E2, 0x01AE4402, 0x000005E2, 0x01A98402, 0x000005E2, 0x019A8402, 0x000005E2,
+    0x019B0402, 0x000005E2, 0x01AEC402, 0x000005E2, 0x01AF0402, 0x000005E2, 0x01B10402, 0x000005E2,
+    0x01B14402, 0x000005E2, 0x01B18402, 0x000005E2, 0x01B1C402, 0x000005E2, 0x01B20402, 0x000005E2,
+    0x01B24402, 0x000005E2, 0x01B38402, 0x000005E2, 0x01B3C402, 0x000005E2, 0x01B40402, 0x000005E2,
+    0x01B44402, 0x000005E2, 0x01BA8402, 0x000005E2, 0x01BC0402, 0x000005E2, 0x01BC4402, 0x000005E2,
+    0x01BCC402, 0x000005E2, 0x01B28402, 0x000005E2, 0x01B2C402, 0x000005E2, 0x01B64402, 0x000005E2,
+    0x01B68402, 0x000005E2, 0x01BD8402, 0x000005E2, 0x01BDC402, 0x000005E2, 0x01BE0402, 0x000005E2,
+    0x01BE4402, 0x000005E2, 0x07E64406, 0x07E60406, 0x07E64406, 0x07E64406, 0x07E64406, 0x07E68406,
+    0x07E64406, 0x07E6C406, 0x07E64406, 0x07E70406, 0x07E64406, 0x07E74406, 0x07E64406, 0x07E78406,
+    0x07E64406, 0x07E7C406, 0x07E64406, 0x07E80406, 0x07E64406, 0x07E84406, 0x07E68406, 0x07E60406,
+    0x00CA0404, 0x07E64404, 0x00CA4404, 0x00CA0404, 0x07E68404, 0x00CA4404, 0x00CA0404, 0x07E6C404,
+    0x00CA4404, 0x00CA0404, 0x07E70404, 0x00CA4404, 0x00CA0404, 0x07E74404, 0x00CA4404, 0x00CA0404,
+    0x07E78404, 0x00CA4404, 0x00CA0404, 0x07E7C404, 0x00CA4404, 0x00CA0404, 0x07E80404, 0x00CA4404,
+    0x00CA0404, 0x07E84404, 0x00CA4404, 0x00CA0404, 0x07E64404, 0x07E60404, 0x00CA4404, 0x00CA0404,
+    0x07E64404, 0x07E64404, 0x00CA4404, 0x00CA0404, 0x07E64404, 0x07E68404, 0x00CA4404, 0x00CA0404,
+    0x07E64404, 0x07E6C404, 0x00CA4404, 0x00CA0404, 0x07E64404, 0x07E70404, 0x00CA4404, 0x00CA0404,
+    0x07E64404, 0x07E74404, 0x00CA4404, 0x00CA0404, 0x07E64404, 0x07E78404, 0x00CA4404, 0x00CA0404,
+    0x07E64404, 0x07E7C404, 0x00CA4404, 0x00CA0404, 0x07E64404, 0x07E80404, 0x00CA4404, 0x00CA0404,
+    0x07E64404, 0x07E84404, 0x00CA4404, 0x00CA0404, 0x07E68404, 0x07E60404, 0x00CA4404, 0x07E64404,
+    0x009F8404, 0x07E68404, 0x009F8404, 0x07E6C404, 0x009F8404, 0x07E70404, 0x009F8404, 0x07E74404,
+    0x009F8404, 0x07E78404, 0x009F8404, 0x07E7C404, 0x009F8404, 0x07E80404, 0x009F8404, 0x07E84404,
+    0x009F8404, 0x07E64404, 0x07E60404, 0x009F8404, 0x07E64404, 0x07E64404, 0x009F8404, 0x07E64404,
+    0x07E68404, 0x009F8404, 0x07E64404, 0x07E6C404, 0x009F8404, 0x07E64404, 0x07E70404, 0x009F8404,
+    0x07E64404, 0x07E74404, 0x009F8404, 0x07E64404, 0x07E78404, 0x009F8404, 0x07E64404, 0x07E7C404,
+    0x009F8404, 0x07E64404, 0x07E80404, 0x009F8404, 0x07E64404, 0x07E84404, 0x009F8404, 0x07E68404,
+    0x07E60404, 0x009F8404, 0x00CA0404, 0x07E88404, 0x00CA4404, 0x00CA0404, 0x07EF0404, 0x00CA4404,
+    0x00CA0404, 0x07F58404, 0x00CA4404, 0x00CA0404, 0x07FAC404, 0x00CA4404, 0x00CA0404, 0x0801C404,
+    0x00CA4404, 0x00CA0404, 0x08108404, 0x00CA4404, 0x00CA0404, 0x08144404, 0x00CA4404, 0x00CA0404,
+    0x081D4404, 0x00CA4404, 0x00CA0404, 0x08240404, 0x00CA4404, 0x00CA0404, 0x082AC404, 0x00CA4404,
+    0x00CA0404, 0x08310404, 0x00CA4404, 0x00CA0404, 0x08358404, 0x00CA4404, 0x00CA0404, 0x08424404,
+    0x00CA4404, 0x00CA0404, 0x08460404, 0x00CA4404, 0x00CA0404, 0x084F0404, 0x00CA4404, 0x00CA0404,
+    0x085AC404, 0x00CA4404, 0x00CA0404, 0x08600404, 0x00CA4404, 0x00CA0404, 0x0864C404, 0x00CA4404,
+    0x00CA0404, 0x08748404, 0x00CA4404, 0x00CA0404, 0x087DC404, 0x00CA4404, 0x00CA0404, 0x0885C404,
+    0x00CA4404, 0x00CA0404, 0x0891C404, 0x00CA4404, 0x00CA0404, 0x08964404, 0x00CA4404, 0x00CA0404,
+    0x08990404, 0x00CA4404, 0x00CA0404, 0x089C0404, 0x00CA4404, 0x00CA0404, 0x08A18404, 0x00CA4404,
+    0x01A30404, 0x01A30404, 0x01A30404, 0x01A30404, 0x00900404, 0x00900404, 0x019AC404, 0x019AC404,
+    0x019AC404, 0x019AC404, 0x019AC404, 0x019AC404, 0x03708402, 0x000005E2, 0x08D58404, 0x08D2C404,
+    0x08D54404, 0x091A8404, 0x091CC404, 0x3ED00404, 0x338D8000, 0x00002304, 0x3ED00404, 0x34E08000,
+    0x00002304, 0x3ED00404, 0x3396C000, 0x3ED00404, 0x33968000, 0x3ED00404, 0x33964000, 0x00002304,
+    0x3ED00404, 0x33AEC000, 0x3ED00404, 0x34608000, 0x00002304, 0x3ED00404, 0x34780000, 0x00002304,
+    0x3ED00404, 0x34800000, 0x00002304, 0x3ED00404, 0x34808000, 0x3ED00404, 0x34D70000, 0x00002304,
+    0x3ED00404, 0x34DA4000, 0x00002304, 0x3ED00404, 0x3703C000, 0x00002304, 0x3ED00404, 0x3703C000,
+    0x00002324, 0x3ED00404, 0x37088000, 0x00002304, 0x3ED00404, 0x3708C000, 0x3ED00404, 0x37088000,
+    0x3ED00404, 0x3708C000, 0x00002304, 0x3ED00404, 0x377CC000, 0x3ED00404, 0x379E8000, 0x3ED00404,
+    0x37D44000, 0x3ED00404, 0x37D40000, 0x00002304, 0x3ED00404, 0x37F10000, 0x3ED00404, 0x37F0C000,
+    0x00002304, 0x3ED00404, 0x38930000, 0x3ED00404, 0x394D4000, 0x3ED00404, 0x39784000, 0x3ED00404,
+    0x39794000, 0x00002304, 0x3ED00404, 0x39C20000, 0x00002304, 0x3ED00404, 0x3ADE8000, 0x00002304,
+    0x3ED00404, 0x3AF34000, 0x3ED00404, 0x3B044000, 0x3ED00404, 0x3B0D4000, 0x3ED00404, 0x3B0E8000,
+    0x3ED00404, 0x3C1B0000, 0x3ED00404, 0x3C8AC000, 0x3ED00404, 0x3C8AC000, 0x00002304, 0x3ED00404,
+    0x338B0000, 0x3ED00404, 0x3C96C000, 0x00002304, 0x3ED00404, 0x3CAB4000, 0x3ED00404, 0x3CE2C000,
+    0x00002304, 0x3ED00404, 0x3D62C000, 0x00002304, 0x3ED00404, 0x3DBB8000, 0x00002304, 0x3ED00404,
+    0x3E4E8000, 0x00002304, 0x3ED00404, 0x3E4EC000, 0x3ED00404, 0x3EBE4000, 0x00002304, 0x3ED00404,
+    0x3F3E4000, 0x3ED00404, 0x3FA7C000, 0x3ED00404, 0x3FD4C000, 0x3ED00404, 0x3FD48000, 0x3ED00404,
+    0x3FD4C000, 0x00002304, 0x3ED00404, 0x3FD4C000, 0x00002324, 0x3ED00404, 0x3FD48000, 0x00002304,
+    0x3ED00404, 0x3FE28000, 0x00002304, 0x3ED00404, 0x3FE28000, 0x00002324, 0x3ED00404, 0x3FE2C000,
+    0x3ED04404, 0x20008000, 0x3ED04404, 0x20200000, 0x3ED04404, 0x201FC000, 0x00002304, 0x3ED04404,
+    0x20224000, 0x00002304, 0x3ED04404, 0x207F0000, 0x00002304, 0x3ED04404, 0x209E4000, 0x3ED04404,
+    0x209E4000, 0x00002304, 0x3ED04404, 0x209E4000, 0x00002324, 0x3ED04404, 0x21938000, 0x3ED04404,
+    0x22190000, 0x3ED04404, 0x22600000, 0x3ED04404, 0x225FC000, 0x3ED04404, 0x22704000, 0x3ED04404,
+    0x22748000, 0x3ED04404, 0x22748000, 0x00002304, 0x3ED04404, 0x22E80000, 0x3ED04404, 0x23474000,
+    0x3ED04404, 0x236CC000, 0x00002304, 0x3ED04404, 0x23D98000, 0x3ED04404, 0x23ED8000, 0x3ED04404,
+    0x23ED8000, 0x00002304, 0x3ED04404, 0x23ED8000, 0x00002324, 0x3ED04404, 0x24244000, 0x00002304,
+    0x3ED04404, 0x25214000, 0x3ED04404, 0x255DC000, 0x3ED04404, 0x255E0000, 0x3ED04404, 0x255FC000,
+    0x3ED04404, 0x257A0000, 0x3ED04404, 0x25870000, 0x00002304, 0x3ED04404, 0x25874000, 0x3ED04404,
+    0x25BA0000, 0x00002304, 0x3ED04404, 0x25D48000, 0x3ED04404, 0x25F98000, 0x3ED04404, 0x261D4000,
+    0x3ED04404, 0x26338000, 0x3ED04404, 0x26378000, 0x3ED04404, 0x2637C000, 0x3ED04404, 0x26380000,
+    0x00002304, 0x3ED04404, 0x26380000, 0x3ED04404, 0x2658C000, 0x3ED04404, 0x26658000, 0x00002304,
+    0x3ED04404, 0x269B0000, 0x3ED04404, 0x26AA0000, 0x00002304, 0x3ED04404, 0x26CF0000, 0x00002304,
+    0x3ED04404, 0x271F0000, 0x3ED04404, 0x2787C000, 0x3ED04404, 0x279D4000, 0x00002304, 0x3ED04404,
+    0x27A98000, 0x3ED04404, 0x27B10000, 0x3ED04404, 0x27BF8000, 0x3ED04404, 0x27D28000, 0x00002304,
+    0x3ED04404, 0x27D40000, 0x3ED04404, 0x27D48000, 0x00002304, 0x3ED04404, 0x27DFC000, 0x3ED04404,
+    0x27E34000, 0x00002304, 0x3ED04404, 0x27E64000, 0x3ED04404, 0x27E70000, 0x00002304, 0x3ED04404,
+    0x27E70000, 0x00002324, 0x3ED04404, 0x27E7C000, 0x3ED00404, 0x33800000, 0x3ED00404, 0x338A0000,
+    0x3ED00404, 0x338D8000, 0x3ED00404, 0x338FC000, 0x3ED00404, 0x33964000, 0x3ED00404, 0x33A14000,
+    0x3ED00404, 0x33A30000, 0x3ED00404, 0x33A80000, 0x3ED00404, 0x33AE8000, 0x3ED00404, 0x344FC000,
+    0x3ED00404, 0x34594000, 0x3ED00404, 0x345AC000, 0x3ED00404, 0x34608000, 0x3ED00404, 0x34658000,
+    0x3ED00404, 0x346AC000, 0x3ED00404, 0x34780000, 0x3ED00404, 0x347D4000, 0x3ED00404, 0x34800000,
+    0x3ED00404, 0x34A6C000, 0x3ED00404, 0x34BE4000, 0x3ED00404, 0x34C54000, 0x3ED00404, 0x34C68000,
+    0x3ED00404, 0x34CE0000, 0x3ED00404, 0x34D04000, 0x3ED00404, 0x34D70000, 0x3ED00404, 0x34DA4000,
+    0x3ED00404, 0x34E08000, 0x3ED00404, 0x34ED8000, 0x3ED00404, 0x34F20000, 0x3ED00404, 0x34F8C000,
+    0x3ED00404, 0x35B5C000, 0x3ED00404, 0x35C7C000, 0x3ED00404, 0x363AC000, 0x3ED00404, 0x36408000,
+    0x3ED00404, 0x36428000, 0x3ED00404, 0x36454000, 0x3ED00404, 0x3649C000, 0x3ED00404, 0x365CC000,
+    0x3ED00404, 0x36D40000, 0x3ED00404, 0x36E00000, 0x3ED00404, 0x36FE0000, 0x3ED00404, 0x3703C000,
+    0x3ED00404, 0x370E0000, 0x3ED00404, 0x371B8000, 0x3ED00404, 0x371C4000, 0x3ED00404, 0x3776C000,
+    0x3ED00404, 0x37794000, 0x3ED00404, 0x377C4000, 0x3ED00404, 0x377F8000, 0x3ED00404, 0x379C8000,
+    0x3ED00404, 0x379FC000, 0x3ED00404, 0x37BD0000, 0x3ED00404, 0x37BF8000, 0x3ED00404, 0x37C2C000,
+    0x3ED00404, 0x37C4C000, 0x3ED00404, 0x37D40000, 0x3ED00404, 0x37D84000, 0x3ED00404, 0x37DCC000,
+    0x3ED00404, 0x37F0C000, 0x3ED00404, 0x38820000, 0x3ED00404, 0x388D8000, 0x3ED00404, 0x3892C000,
+    0x3ED00404, 0x394BC000, 0x3ED00404, 0x394D0000, 0x3ED00404, 0x3961C000, 0x3ED00404, 0x3965C000,
+    0x3ED00404, 0x39690000, 0x3ED00404, 0x396E4000, 0x3ED00404, 0x39780000, 0x3ED00404, 0x39794000,
+    0x3ED00404, 0x39BC0000, 0x3ED00404, 0x39C20000, 0x3ED00404, 0x39CA0000, 0x3ED00404, 0x3AC80000,
+    0x3ED00404, 0x3AD88000, 0x3ED00404, 0x3ADE4000, 0x3ED00404, 0x3AECC000, 0x3ED00404, 0x3AF2C000,
+    0x3ED00404, 0x3AF50000, 0x3ED00404, 0x3AF6C000, 0x3ED00404, 0x3B03C000, 0x3ED00404, 0x3B050000,
+    0x3ED00404, 0x3B0D0000, 0x3ED00404, 0x3C1AC000, 0x3ED00404, 0x3C8A8000, 0x3ED00404, 0x3C8D8000,
+    0x3ED00404, 0x3C8EC000, 0x3ED00404, 0x3C8FC000, 0x3ED00404, 0x3C91C000, 0x3ED00404, 0x3C964000,
+    0x3ED00404, 0x3C96C000, 0x3ED00404, 0x3CAB0000, 0x3ED00404, 0x3CE10000, 0x3ED00404, 0x3CE24000,
+    0x3ED00404, 0x3D370000, 0x3ED00404, 0x3D398000, 0x3ED00404, 0x3D460000, 0x3ED00404, 0x3D47C000,
+    0x3ED00404, 0x3D4A0000, 0x3ED00404, 0x3D4C0000, 0x3ED00404, 0x3D62C000, 0x3ED00404, 0x3D648000,
+    0x3ED00404, 0x3D9D8000, 0x3ED00404, 0x3D9F4000, 0x3ED00404, 0x3DAB8000, 0x3ED00404, 0x3DAFC000,
+    0x3ED00404, 0x3DBB8000, 0x3ED00404, 0x3DF6C000, 0x3ED00404, 0x3DF88000, 0x3ED00404, 0x3DFCC000,
+    0x3ED00404, 0x3E4E8000, 0x3ED00404, 0x3E6E0000, 0x3ED00404, 0x3E6F8000, 0x3ED00404, 0x3E9D0000,
+    0x3ED00404, 0x3EB2C000, 0x3ED00404, 0x3EBE4000, 0x3ED00404, 0x3F1CC000, 0x3ED00404, 0x3F3E0000,
+    0x3ED00404, 0x3FCD8000, 0x3ED00404, 0x3FD44000, 0x3ED00404, 0x3FE28000, 0x3ED00404, 0x3FEF4000,
+    0x3ED04404, 0x20004000, 0x3ED04404, 0x20030000, 0x3ED04404, 0x20048000, 0x3ED04404, 0x200CC000,
+    0x3ED04404, 0x201FC000, 0x3ED04404, 0x20224000, 0x3ED04404, 0x2078C000, 0x3ED04404, 0x207A8000,
+    0x3ED04404, 0x207CC000, 0x3ED04404, 0x207F0000, 0x3ED04404, 0x20830000, 0x3ED04404, 0x2086C000,
+    0x3ED04404, 0x2087C000, 0x3ED04404, 0x209B8000, 0x3ED04404, 0x209C8000, 0x3ED04404, 0x209E0000,
+    0x3ED04404, 0x21934000, 0x3ED04404, 0x219AC000, 0x3ED04404, 0x22100000, 0x3ED04404, 0x22130000,
+    0x3ED04404, 0x2218C000, 0x3ED04404, 0x225F8000, 0x3ED04404, 0x2262C000, 0x3ED04404, 0x22800000,
+    0x3ED04404, 0x230DC000, 0x3ED04404, 0x23118000, 0x3ED04404, 0x23154000, 0x3ED04404, 0x231E0000,
+    0x3ED04404, 0x23274000, 0x3ED04404, 0x23590000, 0x3ED04404, 0x235C0000, 0x3ED04404, 0x236CC000,
+    0x3ED04404, 0x23AAC000, 0x3ED04404, 0x23B28000, 0x3ED04404, 0x23E6C000, 0x3ED04404, 0x23EC0000,
+    0x3ED04404, 0x23ED4000, 0x3ED04404, 0x24244000, 0x3ED04404, 0x24524000, 0x3ED04404, 0x24718000,
+    0x3ED04404, 0x24730000, 0x3ED04404, 0x24744000, 0x3ED04404, 0x25600000, 0x3ED04404, 0x25870000,
+    0x3ED04404, 0x25AD8000, 0x3ED04404, 0x25AE4000, 0x3ED04404, 0x25BA0000, 0x3ED04404, 0x25D44000,
+    0x3ED04404, 0x25D78000, 0x3ED04404, 0x25D88000, 0x3ED04404, 0x25DA4000, 0x3ED04404, 0x25F2C000,
+    0x3ED04404, 0x25FB4000, 0x3ED04404, 0x25FCC000, 0x3ED04404, 0x26004000, 0x3ED04404, 0x262A0000,
+    0x3ED04404, 0x2636C000, 0x3ED04404, 0x26658000, 0x3ED04404, 0x26664000, 0x3ED04404, 0x266B0000,
+    0x3ED04404, 0x26AA0000, 0x3ED04404, 0x26B60000, 0x3ED04404, 0x26B7C000, 0x3ED04404, 0x26C94000,
+    0x3ED04404, 0x26CBC000, 0x3ED04404, 0x26CC8000, 0x3ED04404, 0x26CF0000, 0x3ED04404, 0x26D68000,
+    0x3ED04404, 0x27394000, 0x3ED04404, 0x279D4000, 0x3ED04404, 0x279FC000, 0x3ED04404, 0x27A94000,
+    0x3ED04404, 0x27AEC000, 0x3ED04404, 0x27B0C000, 0x3ED04404, 0x27B34000, 0x3ED04404, 0x27B44000,
+    0x3ED04404, 0x27BE4000, 0x3ED04404, 0x27BF4000, 0x3ED04404, 0x27C38000, 0x3ED04404, 0x27C4C000,
+    0x3ED04404, 0x27C80000, 0x3ED04404, 0x27CEC000, 0x3ED04404, 0x27D28000, 0x3ED04404, 0x27D48000,
+    0x3ED04404, 0x27E34000, 0x3ED04404, 0x27E70000, 0x3ED04404, 0x27E80000, 0x10B98404, 0x10BF0404,
+    0x07D70402, 0x000006E2, 0x07D74402, 0x000006E2, 0x3ED00404, 0x34D10000, 0x3ED00404, 0x34D14000,
+    0x10BE4404, 0x10B9C404, 0x10B8040E, 0x000006E2, 0x10B8440E, 0x000006E2, 0x10B8840E, 0x000006E2,
+    0x10B8C40E, 0x000006E2, 0x10B9040E, 0x000006E2, 0x10B9440E, 0x000006E2, 0x10B9840E, 0x000006E2,
+    0x10B9C40E, 0x000006E2, 0x10BA040E, 0x000006E2, 0x10BA440E, 0x000006E2, 0x10BA840E, 0x000006E2,
+    0x10BAC40E, 0x000006E2, 0x10BB040E, 0x000006E2, 0x10BB440E, 0x000006E2, 0x10BB840E, 0x000006E2,
+    0x10BD040E, 0x000006E2, 0x10BD040E, 0x00000702, 0x10BD440E, 0x000006E2, 0x10BD440E, 0x00000702,
+    0x10BD840E, 0x000006E2, 0x10BD840E, 0x00000702, 0x10BDC40E, 0x000006E2, 0x10BDC40E, 0x00000702,
+    0x10BE040E, 0x000006E2, 0x10BE040E, 0x00000702, 0x10B7040E, 0x000006E2, 0x07D7C402, 0x000006E2,
+    0x10C00416, 0x10C08416, 0x10B80411, 0x000006E2, 0x10B84411, 0x000006E2, 0x10B88411, 0x000006E2,
+    0x10B8C411, 0x000006E2, 0x10B90411, 0x000006E2, 0x10B94411, 0x000006E2, 0x10B98411, 0x000006E2,
+    0x10B9C411, 0x000006E2, 0x10BA0411, 0x000006E2, 0x10BA4411, 0x000006E2, 0x10BA8411, 0x000006E2,
+    0x10BAC411, 0x000006E2, 0x10BB0411, 0x000006E2, 0x10BB4411, 0x000006E2, 0x10BB8411, 0x000006E2,
+    0x10BD0411, 0x000006E2, 0x10BD0411, 0x00000702, 0x10BD4411, 0x000006E2, 0x10BD4411, 0x00000702,
+    0x10BD8411, 0x000006E2, 0x10BD8411, 0x00000702, 0x10BDC411, 0x000006E2, 0x10BDC411, 0x00000702,
+    0x10BE0411, 0x000006E2, 0x10BE0411, 0x00000702, 0x10B70411, 0x000006E2, 0x10C18411, 0x000006E2,
+    0x10C1C411, 0x000006E2, 0x10C20411, 0x000006E2, 0x10C24411, 0x000006E2, 0x07D84402, 0x000006E2,
+    0x10B90416, 0x10BB8416, 0x3ED00414, 0x33800000, 0x3ED00414, 0x33A30000, 0x3ED00414, 0x33824000,
+    0x3ED00414, 0x35B6C000, 0x3ED00414, 0x33828000, 0x3ED00414, 0x338B4000, 0x3ED00414, 0x3382C000,
+    0x3ED00414, 0x3D4C8000, 0x3ED00414, 0x33964000, 0x3ED00414, 0x33864000, 0x3ED00414, 0x33804000,
+    0x3ED00414, 0x364A4000, 0x3ED00414, 0x35CC0000, 0x3ED00414, 0x33AE8000, 0x110A4404, 0x00002324,
+    0x1110C404, 0x00002324, 0x110E4404, 0x00002324, 0x110D0404, 0x00002324, 0x11138404, 0x00002324,
+    0x11128404, 0x00002324, 0x11170404, 0x00002344, 0x11124404, 0x00002324, 0x1116C404, 0x00002324,
+    0x11170404, 0x00002324, 0x1113C404, 0x00002324, 0x11144404, 0x00002324, 0x1116C416, 0x00002336,
+    0x00CA0404, 0x105D4404, 0x00CA4404, 0x00CA0404, 0x105DC404, 0x00CA4404, 0x00CA0404, 0x105E0404,
+    0x00CA4404, 0x00CA0404, 0x105E8404, 0x00CA4404, 0x00CA0404, 0x105EC404, 0x00CA4404, 0x00CA0404,
+    0x105F0404, 0x00CA4404, 0x00CA0404, 0x105F8404, 0x00CA4404, 0x00CA0404, 0x10600404, 0x00CA4404,
+    0x00CA0404, 0x10604404, 0x00CA4404, 0x00CA0404, 0x1060C404, 0x00CA4404, 0x00CA0404, 0x10610404,
+    0x00CA4404, 0x00CA0404, 0x10614404, 0x00CA4404, 0x00CA0404, 0x10618404, 0x00CA4404, 0x00CA0404,
+    0x1061C404, 0x00CA4404, 0x00CA0404, 0x105D4404, 0x107CC404, 0x00CA4404, 0x00CA0404, 0x105DC404,
+    0x107CC404, 0x00CA4404, 0x00CA0404, 0x105E0404, 0x107CC404, 0x00CA4404, 0x00CA0404, 0x105E8404,
+    0x107CC404, 0x00CA4404, 0x00CA0404, 0x105EC404, 0x107CC404, 0x00CA4404, 0x00CA0404, 0x105F0404,
+    0x107CC404, 0x00CA4404, 0x00CA0404, 0x105F8404, 0x107CC404, 0x00CA4404, 0x00CA0404, 0x10600404,
+    0x107CC404, 0x00CA4404, 0x00CA0404, 0x10604404, 0x107CC404, 0x00CA4404, 0x00CA0404, 0x1060C404,
+    0x107CC404, 0x00CA4404, 0x00CA0404, 0x10610404, 0x107CC404, 0x00CA4404, 0x00CA0404, 0x10614404,
+    0x107CC404, 0x00CA4404, 0x00CA0404, 0x10618404, 0x107CC404, 0x00CA4404, 0x00CA0404, 0x1061C404,
+    0x107CC404, 0x00CA4404, 0x00CA0404, 0x10604404, 0x10800404, 0x00CA4404, 0x00CA0404, 0x10600404,
+    0x107EC404, 0x10604404, 0x107DC404, 0x10950404, 0x00CA4404, 0x00CA0404, 0x10600404, 0x107EC404,
+    0x1061C404, 0x10800404, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x33800000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x33A30000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x33824000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x35B6C000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x33A50000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x345B4000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x3380C000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x345AC000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x33974000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x34D04000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x39C20000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x3C1AC000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x3B0D0000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x39CA0000, 0x00CA4404, 0x00CA0404, 0x3ED04404, 0x24744000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x35C7C000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x39794000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x3A0A8000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x39C24000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x3E4F8000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x35034000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x3C9E4000, 0x00CA4404, 0x00CA0404, 0x3ED04404, 0x23284000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x3E574000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x34AD0000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x33B8C000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x351F0000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x36D98000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x3DB8C000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x33C04000, 0x00CA4404, 0x00CA0404, 0x3ED04404, 0x2331C000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x34D50000, 0x00CA4404, 0x00CA0404, 0x3ED00404, 0x3E5B4000, 0x00CA4404, 0x00CA0404,
+    0x3ED00404, 0x33C44000, 0x00CA4404, 0x00CA0404, 0x3ED04404, 0x207A8000, 0x00CA4404, 0x00CA0404,
+    0x3ED04404, 0x207CC000, 0x00CA4404, 0x3ED00406, 0x3553C000, 0x3ED00406, 0x379F0000, 0x3ED00406,
+    0x3961C000, 0x3ED00406, 0x3EE3C000, 0x07E6C406, 0x07E60406, 0x07E70406, 0x07E60406, 0x07E74406,
+    0x07E60406, 0x07E78406, 0x07E60406, 0x07E7C406, 0x07E60406, 0x07E80406, 0x07E60406, 0x085AC41D,
+    0x087DC41D, 0x0801C41D, 0x07E68406, 0x07E64406, 0x07E68406, 0x07E68406, 0x07E68406, 0x07E6C406,
+    0x07E68406, 0x07E70406, 0x07E68406, 0x07E74406, 0x07E68406, 0x07E78406, 0x07E68406, 0x07E7C406,
+    0x07E68406, 0x07E80406, 0x07E68406, 0x07E84406, 0x07E6C406, 0x07E64406, 0x07E6C406, 0x07E68406,
+    0x07E6C406, 0x07E6C406, 0x07E6C406, 0x07E70406, 0x07E6C406, 0x07E74406, 0x105D4406, 0x107CC406,
+    0x105DC406, 0x107CC406, 0x105E0406, 0x107CC406, 0x105E8406, 0x107CC406, 0x105EC406, 0x107CC406,
+    0x105F0406, 0x107CC406, 0x105F8406, 0x107CC406, 0x10600406, 0x107CC406, 0x10604406, 0x107CC406,
+    0x1060C406, 0x107CC406, 0x10610406, 0x107CC406, 0x10614406, 0x107CC406, 0x10618406, 0x107CC406,
+    0x1061C406, 0x107CC406, 0x1060C406, 0x107CC406, 0x10980406, 0x105D4406, 0x107EC406, 0x10604406,
+    0x10800406, 0x10600406, 0x10818406, 0x10600406, 0x10800406, 0x3ED00406, 0x33800000, 0x3ED00406,
+    0x33A30000, 0x3ED00406, 0x33824000, 0x3ED00406, 0x35B6C000, 0x3ED00406, 0x33A50000, 0x3ED00406,
+    0x345B4000, 0x3ED00406, 0x3380C000, 0x3ED00406, 0x345AC000, 0x3ED00406, 0x33974000, 0x3ED00406,
+    0x34D04000, 0x3ED00406, 0x39C20000, 0x3ED00406, 0x3C1AC000, 0x3ED00406, 0x3B0D0000, 0x3ED00406,
+    0x39CA0000, 0x3ED04406, 0x24744000, 0x3ED00406, 0x35C7C000, 0x3ED00406, 0x39794000, 0x3ED00406,
+    0x3A0A8000, 0x3ED00406, 0x39C24000, 0x3ED00406, 0x3E4F8000, 0x3ED00406, 0x35034000, 0x3ED00406,
+    0x3C9E4000, 0x3ED04406, 0x23284000, 0x3ED00406, 0x3E574000, 0x3ED00406, 0x34AD0000, 0x3ED00406,
+    0x3E760000, 0x3ED00406, 0x3D4DC000, 0x3ED00406, 0x365CC000, 0x3ED04406, 0x241A4000, 0x3ED00406,
+    0x344A8000, 0x3ED00406, 0x34DC0000, 0x3ED00406, 0x3B3A0000, 0x3ED04406, 0x26014000, 0x3ED00406,
+    0x33C44000, 0x3ED00406, 0x34664000, 0x3ED00406, 0x3AD8C000, 0x3ED00406, 0x33828000, 0x3ED00406,
+    0x338B4000, 0x3ED00406, 0x3382C000, 0x3ED00406, 0x37798000, 0x3ED00406, 0x34FCC000, 0x3ED00406,
+    0x34CEC000, 0x3ED00406, 0x36E5C000, 0x3ED00406, 0x36D98000, 0x3ED00406, 0x3DB8C000, 0x3ED00406,
+    0x33C04000, 0x3ED04406, 0x2331C000, 0x3ED00406, 0x34D50000, 0x3ED00406, 0x36470000, 0x07E6C406,
+    0x07E78406, 0x07E6C406, 0x07E7C406, 0x07E6C406, 0x07E80406, 0x07E6C406, 0x07E84406, 0x07E70406,
+    0x07E64406, 0x07E70406, 0x07E68406, 0x07E70406, 0x07E6C406, 0x07E70406, 0x07E70406, 0x07E70406,
+    0x07E74406, 0x07E70406, 0x07E78406, 0x07E70406, 0x07E7C406, 0x07E70406, 0x07E80406, 0x07E70406,
+    0x07E84406, 0x07E64404, 0x3ED00404, 0x39C20000, 0x07E68404, 0x3ED00404, 0x39C20000, 0x07E6C404,
+    0x3ED00404, 0x39C20000, 0x07E70404, 0x3ED00404, 0x39C20000, 0x07E74404, 0x3ED00404, 0x39C20000,
+    0x07E78404, 0x3ED00404, 0x39C20000, 0x07E7C404, 0x3ED00404, 0x39C20000, 0x07E80404, 0x3ED00404,
+    0x39C20000, 0x07E84404, 0x3ED00404, 0x39C20000, 0x07E64404, 0x07E60404, 0x3ED00404, 0x39C20000,
+    0x07E64404, 0x07E64404, 0x3ED00404, 0x39C20000, 0x07E64404, 0x07E68404, 0x3ED00404, 0x39C20000,
+    0x081D441D, 0x0814441C, 0x0801C41C, 0x0864C41C, 0x0814441C, 0x0801C41C, 0x0891C41D, 0x0835841D,
+    0x087DC41D, 0x07FAC41D, 0x3ED0041C, 0x33B90000, 0x3ED0041C, 0x35230000, 0x10B6841C, 0x10BD041C,
+    0x0000071C, 0x07D8041C, 0x10BB841C, 0x10B6841C, 0x10C0C41C, 0x10BD841C, 0x10B6841C, 0x10B6841C,
+    0x10C2841C, 0x10BDC41C, 0x0000071C, 0x10B6841C, 0x10B6841C, 0x07D8041C, 0x10C0C41C, 0x10B6C41C,
+    0x10BC041C, 0x10C2841C, 0x10B8841C, 0x000006FC, 0x10B6C41C, 0x10C2841C, 0x10BAC41C, 0x10B7041C,
+    0x10B7C41C, 0x10C2841C, 0x10B7841C, 0x10B9C41C, 0x10B8841C, 0x07D8041C, 0x10BB841C, 0x000006FC,
+    0x10B7841C, 0x07D8041C, 0x10B8041C, 0x07D8041C, 0x10B7C41C, 0x10C2841C, 0x10B9C41C, 0x10B7C41C,
+    0x07D8041C, 0x10BEC41C, 0x10B8041C, 0x10B6C41C, 0x10C0841C, 0x10B8041C, 0x10C0441C, 0x10BB041C,
+    0x10BB841C, 0x10B8041C, 0x10C1441C, 0x10C0841C, 0x07D8041C, 0x10B8041C, 0x000006FC, 0x10C1441C,
+    0x10C2841C, 0x10B8041C, 0x000006FC, 0x10C2841C, 0x10BE441C, 0x10B8441C, 0x000006FC, 0x10B8041C,
+    0x000006FC, 0x10B8441C, 0x000006FC, 0x10BC041C, 0x07D8041C, 0x10B8441C, 0x10BFC41C, 0x10C0841C,
+    0x07D8041C, 0x10B8441C, 0x000006FC, 0x10C0C41C, 0x10BA841C, 0x000006FC, 0x07D8041C, 0x10B8441C,
+    0x10C1441C, 0x10B8441C, 0x10C1441C, 0x10B8841C, 0x000006FC, 0x10C0441C, 0x10BEC41C, 0x10B8441C,
+    0x10C1441C, 0x10BF041C, 0x07D8041C, 0x10BB841C, 0x10C0C41C, 0x10B8441C, 0x10C1441C, 0x10C1841C,
+    0x10BB041C, 0x10BB841C, 0x10B8841C, 0x000006FC, 0x10C0441C, 0x10BEC41C, 0x10B8841C, 0x000006FC,
+    0x10C0441C, 0x10BEC41C, 0x10BB841C, 0x10C2841C, 0x10B8841C, 0x10C0C41C, 0x10BA041C, 0x000006FC,
+    0x10B6C41C, 0x10C1441C, 0x10B8841C, 0x10C1441C, 0x07D8041C, 0x10BC841C, 0x10B8C41C, 0x07D8041C,
+    0x10B9C41C, 0x10B9041C, 0x10C0C41C, 0x10BBC41C, 0x10B9041C, 0x07D8041C, 0x10BE041C, 0x0000071C,
+    0x10B9441C, 0x10B6C41C, 0x10B8841C, 0x10C0C41C, 0x10B9441C, 0x10C2841C, 0x10BAC41C, 0x07D8041C,
+    0x10BEC41C, 0x10B9841C, 0x10C0841C, 0x10C2841C, 0x10B8841C, 0x000006FC, 0x10BA041C, 0x10C2841C,
+    0x10BAC41C, 0x10BA041C, 0x10C2841C, 0x10BB841C, 0x10BA841C, 0x000006FC, 0x07D8041C, 0x10B9C41C,
+    0x10BB441C, 0x000006FC, 0x10B9841C, 0x10BB841C, 0x000006FC, 0x10C0C41C, 0x10BB841C, 0x10C2841C,
+    0x10BBC41C, 0x10BCC41C, 0x10BCC41C, 0x10BB041C, 0x10BB841C, 0x10BD041C, 0x10B6C41C, 0x10BB041C,
+    0x10BD041C, 0x0000071C, 0x07D8041C, 0x10BA041C, 0x10C2841C, 0x10BB841C, 0x10BD041C, 0x0000071C,
+    0x07D8041C, 0x10BB041C, 0x10BD041C, 0x000006FC, 0x07D8041C, 0x10C1041C, 0x10C0C41C, 0x10BD441C,
+    0x0000071C, 0x10B6841C, 0x10B9C41C, 0x10BB841C, 0x10C0C41C, 0x10BD441C, 0x0000071C, 0x10B8841C,
+    0x10C0C41C, 0x10BD441C, 0x0000071C, 0x10B9041C, 0x10BD441C, 0x000006FC, 0x10C0C41C, 0x10BD841C,
+    0x10B6841C, 0x10C0441C, 0x10BB041C, 0x10BB841C, 0x000006FC, 0x10BD841C, 0x10B6C41C, 0x07D8041C,
+    0x10BB841C, 0x10BD841C, 0x000006FC, 0x10BB041C, 0x10B9841C, 0x10B7841C, 0x10C0C41C, 0x10BD841C,
+    0x10C0441C, 0x10C2841C, 0x10BDC41C, 0x10B8841C, 0x10BA841C, 0x07D8041C, 0x10C0C41C, 0x10BDC41C,
+    0x0000071C, 0x10BA441C, 0x10BDC41C, 0x0000071C, 0x10BC041C, 0x10BD441C, 0x10BDC41C, 0x10C0C41C,
+    0x10BB041C, 0x10BDC41C, 0x0000071C, 0x10C2841C, 0x10B9C41C, 0x10BDC41C, 0x0000071C, 0x07D8041C,
+    0x10B9841C, 0x000006FC, 0x10BDC41C, 0x000006FC, 0x07D8041C, 0x10BA841C, 0x10BE041C, 0x0000071C,
+    0x10B6C41C, 0x10C2841C, 0x10BB841C, 0x10BE041C, 0x000006FC, 0x10C0C41C, 0x10BB841C, 0x10BE041C,
+    0x10C2841C, 0x10BE041C, 0x0000071C, 0x10C2841C, 0x10BB841C, 0x000006FC, 0x10BE041C, 0x07D8041C,
+    0x10C0C41C, 0x10BE041C, 0x07D8041C, 0x10C2841C, 0x10BE441C, 0x10B6C41C, 0x10B8841C, 0x10C1441C,
+    0x10BE441C, 0x10B6C41C, 0x10C0C41C, 0x10BE441C, 0x10BB041C, 0x10BD041C, 0x10BE441C, 0x10C0C41C,
+    0x10B8841C, 0x10BE441C, 0x10C2841C, 0x10B9841C, 0x10C0041C, 0x10C2841C, 0x10BE841C, 0x10B8841C,
+    0x10C1441C, 0x10C2841C, 0x10BE841C, 0x10C0841C, 0x10BE841C, 0x10C0841C, 0x10BD041C, 0x000006FC,
+    0x07D8041C, 0x10C0C41C, 0x10BF041C, 0x10B8041C, 0x000006FC, 0x10BF041C, 0x10B8041C, 0x000006FC,
+    0x10BB841C, 0x10C2841C, 0x10BF041C, 0x07D8041C, 0x10BB841C, 0x10C0C41C, 0x10BF841C, 0x07D8041C,
+    0x10BB841C, 0x000006FC, 0x10BF841C, 0x07D8041C, 0x10C0C41C, 0x10BFC41C, 0x10B6841C, 0x10C2841C,
+    0x10C0841C, 0x10BB041C, 0x10BB841C, 0x10C0C41C, 0x10C0841C, 0x10C0441C, 0x10C0C41C, 0x10BD441C,
+    0x0000071C, 0x07D8041C, 0x10C0C41C, 0x07D8041C, 0x10BD841C, 0x000006FC, 0x10C0C41C, 0x10C1041C,
+    0x10BEC41C, 0x10C1041C, 0x10C2841C, 0x10BB841C, 0x10B8C41C, 0x000006FC, 0x10C2841C, 0x10C1841C,
+    0x10BB041C, 0x10BB841C, 0x07E60404, 0x3ED00404, 0x3C2E4000, 0x07E64404, 0x3ED00404, 0x3C2E4000,
+    0x07E68404, 0x3ED00404, 0x3C2E4000, 0x07E6C404, 0x3ED00404, 0x3C2E4000, 0x07E70404, 0x3ED00404,
+    0x3C2E4000, 0x07E74404, 0x3ED00404, 0x3C2E4000, 0x07E78404, 0x3ED00404, 0x3C2E4000, 0x07E7C404,
+    0x3ED00404, 0x3C2E4000, 0x07E80404, 0x3ED00404, 0x3C2E4000, 0x07E84404, 0x3ED00404, 0x3C2E4000,
+    0x07E64404, 0x07E60404, 0x3ED00404, 0x3C2E4000, 0x07E64404, 0x07E64404, 0x3ED00404, 0x3C2E4000,
+    0x07E64404, 0x07E68404, 0x3ED00404, 0x3C2E4000, 0x07E64404, 0x07E6C404, 0x3ED00404, 0x3C2E4000,
+    0x07E64404, 0x07E70404, 0x3ED00404, 0x3C2E4000, 0x07E64404, 0x07E74404, 0x3ED00404, 0x3C2E4000,
+    0x07E64404, 0x07E78404, 0x3ED00404, 0x3C2E4000, 0x07E64404, 0x07E7C404, 0x3ED00404, 0x3C2E4000,
+    0x07E64404, 0x07E80404, 0x3ED00404, 0x3C2E4000, 0x07E64404, 0x07E84404, 0x3ED00404, 0x3C2E4000,
+    0x07E68404, 0x07E60404, 0x3ED00404, 0x3C2E4000, 0x07E68404, 0x07E64404, 0x3ED00404, 0x3C2E4000,
+    0x07E68404, 0x07E68404, 0x3ED00404, 0x3C2E4000, 0x07E68404, 0x07E6C404, 0x3ED00404, 0x3C2E4000,
+    0x07E68404, 0x07E70404, 0x3ED00404, 0x3C2E4000, 0x081D441C, 0x085AC41D, 0x07E8841C, 0x07FAC41C,
+    0x07E8841C, 0x07E8841D, 0x0885C41D, 0x07EF041C, 0x07E8841C, 0x0864C41C, 0x084F041C, 0x0891C41D,
+    0x085AC41C, 0x07F5841C, 0x07FAC41C, 0x0842441C, 0x07FAC41C, 0x0842441C, 0x07E6841C, 0x07FAC41C,
+    0x0842441C, 0x07E6C41C, 0x0824041D, 0x0885C41D, 0x3ED0041C, 0x379CC000, 0x3ED0041C, 0x38840000,
+    0x3ED0041C, 0x398B4000, 0x3ED0041C, 0x35230000, 0x3ED0041C, 0x3649C000, 0x3ED0041C, 0x3AD8C000,
+    0x3ED0041C, 0x39838000, 0x3ED0041C, 0x3B2EC000, 0x3ED0041C, 0x3A0A8000, 0x3ED0041C, 0x37C3C000,
+    0x3ED0041C, 0x33C68000, 0x3ED0041C, 0x3E4F8000, 0x085AC41C, 0x07E8841D, 0x0846041C, 0x07E8841D,
+    0x08CC041C, 0x07E8841D, 0x0842441C, 0x07E8841D, 0x0831041C, 0x07E8841D, 0x0831041D, 0x07EF041D,
+    0x0842441D, 0x07EF041D, 0x0814441D, 0x07EF041D, 0x07F5841C, 0x07E8841C, 0x0835841C, 0x0831041C,
+    0x07F5841C, 0x07E8841C, 0x0835841C, 0x085AC41C, 0x0810841D, 0x0846041C, 0x0810841D, 0x08CC041C,
+    0x0810841D, 0x08CC041C, 0x0814441C, 0x0842441C, 0x0814441C, 0x0831041C, 0x0814441C, 0x081D441D,
+    0x08A1841C, 0x0831041C, 0x081D441D, 0x08A1841C, 0x0842441D, 0x081D441D, 0x08A1841C, 0x0814441D,
+    0x081D441D, 0x08A1841C, 0x087DC41D, 0x081D441D, 0x08A1841C, 0x08CC041C, 0x0835841C, 0x0842441C,
+    0x0835841C, 0x07FAC41C, 0x0835841C, 0x0831041C, 0x0835841C, 0x0810841C, 0x0842441C, 0x0846041C,
+    0x0842441C, 0x08CC041C, 0x0842441C, 0x0842441C, 0x0842441C, 0x07F5841C, 0x0842441C, 0x0831041C,
+    0x0842441C, 0x0842441C, 0x0842441C, 0x07E6841C, 0x07F5841C, 0x0842441C, 0x07E6841C, 0x0842441C,
+    0x07E6841C, 0x0831041C, 0x0842441C, 0x07E6841C, 0x0842441C, 0x0842441C, 0x07E6C41C, 0x07F5841C,
+    0x0842441C, 0x07E6C41C, 0x0842441C, 0x07E6C41C, 0x0831041C, 0x0842441C, 0x07E6C41C, 0x0842441C,
+    0x019D441C, 0x0874841C, 0x0842441C, 0x019D441C, 0x0874841C, 0x07E6841C, 0x085AC41D, 0x07E8841C,
+    0x0831041C, 0x085AC41D, 0x07E8841C, 0x0842441D, 0x085AC41D, 0x07E8841C, 0x0814441D, 0x085AC41D,
+    0x07E8841C, 0x0864C41C, 0x07E8841C, 0x07FAC41C, 0x0864C41C, 0x07E8841C, 0x07FAC41C, 0x019D441C,
+    0x0874841C, 0x0864C41C, 0x07E8841C, 0x07FAC41C, 0x019D441C, 0x0874841C, 0x07E6841C, 0x085AC41C,
+    0x0874841C, 0x0846041C, 0x0874841C, 0x08CC041C, 0x0874841C, 0x0842441C, 0x0874841C, 0x085AC41C,
+    0x0891C41D, 0x0846041C, 0x0891C41D, 0x08CC041C, 0x0891C41D, 0x0842441C, 0x0891C41D, 0x0831041C,
+    0x0891C41D, 0x0842441D, 0x0891C41D, 0x085AC41C, 0x0896441D, 0x0846041C, 0x0896441D, 0x08CC041C,
+    0x0896441D, 0x0842441C, 0x0896441D, 0x0831041C, 0x0896441D, 0x0842441D, 0x0896441D, 0x0831041C,
+    0x08D1841D, 0x0842441D, 0x08D1841D, 0x07E8841C, 0x009F841C, 0x0842441C, 0x009F841C, 0x07EF041D,
+    0x0860041C, 0x07F5841C, 0x07F5841C, 0x07F5841C, 0x07FAC41C, 0x07F5841D, 0x019D441C, 0x0831041C,
+    0x0814441C, 0x07F5841D, 0x084F041C, 0x009F841C, 0x07FAC41C, 0x07EF041D, 0x0814441D, 0x089C041C,
+    0x081D441C, 0x07E8841C, 0x081D441D, 0x085AC41D, 0x0824041C, 0x0846041C, 0x0831041D, 0x0831041D,
+    0x0831041D, 0x0842441D, 0x0831041C, 0x087DC41C, 0x0835841C, 0x0842441C, 0x0835841C, 0x0846041C,
+    0x0835841C, 0x084F041C, 0x0814441C, 0x0835841C, 0x0899041C, 0x0842441C, 0x07EF041C, 0x0842441C,
+    0x0824041C, 0x0835841C, 0x0842441C, 0x084F041C, 0x0835841C, 0x085AC41D, 0x081D441D, 0x085AC41C,
+    0x009F841C, 0x0842441C, 0x009F841C, 0x085AC41D, 0x085AC41D, 0x0842441D, 0x085AC41D, 0x0864C41D,
+    0x0874841C, 0x0864C41C, 0x0874841D, 0x0891C41C, 0x0896441D, 0x07EF041C, 0x0891C41D, 0x019D441C,
+    0x0842441C, 0x07E8841D, 0x019D441C, 0x0842441C, 0x07E64404, 0x3ED00404, 0x39794000, 0x07E68404,
+    0x3ED00404, 0x39794000, 0x07E6C404, 0x3ED00404, 0x39794000, 0x07E70404, 0x3ED00404, 0x39794000,
+    0x07E74404, 0x3ED00404, 0x39794000, 0x07E78404, 0x3ED00404, 0x39794000, 0x07E7C404, 0x3ED00404,
+    0x39794000, 0x07E80404, 0x3ED00404, 0x39794000, 0x07E84404, 0x3ED00404, 0x39794000, 0x07E64404,
+    0x07E60404, 0x3ED00404, 0x39794000, 0x07E64404, 0x07E64404, 0x3ED00404, 0x39794000, 0x07E64404,
+    0x07E68404, 0x3ED00404, 0x39794000, 0x07E64404, 0x07E6C404, 0x3ED00404, 0x39794000, 0x07E64404,
+    0x07E70404, 0x3ED00404, 0x39794000, 0x07E64404, 0x07E74404, 0x3ED00404, 0x39794000, 0x07E64404,
+    0x07E78404, 0x3ED00404, 0x39794000, 0x07E64404, 0x07E7C404, 0x3ED00404, 0x39794000, 0x07E64404,
+    0x07E80404, 0x3ED00404, 0x39794000, 0x07E64404, 0x07E84404, 0x3ED00404, 0x39794000, 0x07E68404,
+    0x07E60404, 0x3ED00404, 0x39794000, 0x07E68404, 0x07E64404, 0x3ED00404, 0x39794000, 0x07E68404,
+    0x07E68404, 0x3ED00404, 0x39794000, 0x07E68404, 0x07E6C404, 0x3ED00404, 0x39794000, 0x07E68404,
+    0x07E70404, 0x3ED00404, 0x39794000, 0x07E68404, 0x07E74404, 0x3ED00404, 0x39794000, 0x07E68404,
+    0x07E78404, 0x3ED00404, 0x39794000, 0x07E68404, 0x07E7C404, 0x3ED00404, 0x39794000, 0x07E68404,
+    0x07E80404, 0x3ED00404, 0x39794000, 0x07E68404, 0x07E84404, 0x3ED00404, 0x39794000, 0x07E6C404,
+    0x07E60404, 0x3ED00404, 0x39794000, 0x07E6C404, 0x07E64404, 0x3ED00404, 0x39794000, 0x0814441C,
+    0x07E8841C, 0x0835841C, 0x0F314404, 0x0F710404, 0x0F35C404, 0x0F710404, 0x0F3B0404, 0x0F710404,
+    0x0F400404, 0x0F714404, 0x0F42C404, 0x0F710404, 0x0F444404, 0x0F714404, 0x0F44C404, 0x0F714404,
+    0x0F464404, 0x0F710404, 0x0F4F8404, 0x0F710404, 0x0F5B4404, 0x0F710404, 0x0F610404, 0x0F710404,
+    0x0F628404, 0x0F714404, 0x0F644404, 0x0F710404, 0x08FB4404, 0x00000564, 0x087DC40A, 0x08A18404,
+    0x087DC404, 0x08A18404, 0x07E8840A, 0x07E8840A, 0x07E88404, 0x07E88404, 0x07E8840A, 0x084F040A,
+    0x07E8840A, 0x0885C40A, 0x07E88404, 0x0885C404, 0x07E8840A, 0x0891C40A, 0x07E8840A, 0x00002304,
+    0x0891C40A, 0x07E88404, 0x00002304, 0x0891C404, 0x07E8840A, 0x089C040A, 0x07E88404, 0x089C0404,
+    0x084F040A, 0x084F040A, 0x084F0404, 0x084F0404, 0x0891C40A, 0x089C040A, 0x0891C404, 0x089C0404,
+    0x07FAC40A, 0x00002324, 0x0810840A, 0x00002324, 0x08108404, 0x00002324, 0x0814440A, 0x00002324,
+    0x0864C40A, 0x00002324, 0x0864C404, 0x00002324, 0x0874840A, 0x00002324, 0x087DC40A, 0x00002324,
+    0x087DC404, 0x00002324, 0x07E8840A, 0x00000564, 0x084F040A, 0x00000564, 0x0885C40A, 0x00000564,
+    0x0814440A, 0x000006A4, 0x08144404, 0x000006A4, 0x0831040A, 0x000006A4, 0x08310404, 0x000006A4,
+    0x0846040A, 0x000006A4, 0x08460404, 0x000006A4, 0x0864C40A, 0x000006A4, 0x0864C404, 0x000006A4,
+    0x0874840A, 0x000006A4, 0x08748404, 0x000006A4, 0x081D4414, 0x00000734, 0x084F0414, 0x00002314,
+    0x0801C414, 0x07FAC404, 0x08A54404, 0x087DC404, 0x08768404, 0x3ED04402, 0x23120000, 0x3ED00402,
+    0x39BD0000, 0x3ED04402, 0x23B28000, 0x3ED04402, 0x23320000, 0x3ED00402, 0x3BB44000, 0x3ED00402,
+    0x338C8000, 0x3ED00402, 0x34F94000, 0x3ED04402, 0x27E70000, 0x3ED00402, 0x36544000, 0x3ED04402,
+    0x24744000, 0x3ED00402, 0x3561C000, 0x3ED00402, 0x36520000, 0x3ED00402, 0x387D8000, 0x3ED00402,
+    0x3D9A4000, 0x3ED00402, 0x3FE14000, 0x3ED04402, 0x218FC000, 0x3ED04402, 0x21EE8000, 0x3ED04402,
+    0x223E0000, 0x3ED04402, 0x2423C000, 0x3ED00402, 0x3A808000, 0x3ED00402, 0x3B46C000, 0x3ED00402,
+    0x3C364000, 0x3ED00402, 0x3CF78000, 0x3ED04402, 0x210F4000, 0x3ED04402, 0x245A8000, 0x3ED04402,
+    0x267C4000, 0x3ED00402, 0x33A08000, 0x3ED00402, 0x34DD4000, 0x3ED00402, 0x3AC10000, 0x3ED00402,
+    0x3C86C000, 0x3ED04402, 0x218B4000, 0x3ED04402, 0x27878000, 0x3ED00402, 0x37540000, 0x3ED00402,
+    0x3BFAC000, 0x3ED04402, 0x21734000, 0x3ED04402, 0x22590000, 0x3ED00402, 0x38B24000, 0x3ED04402,
+    0x20760000, 0x3ED04402, 0x2207C000, 0x3ED00402, 0x37B28000, 0x3ED00402, 0x39C5C000, 0x3ED00402,
+    0x3B5A8000, 0x3ED00402, 0x3CBF0000, 0x3ED04402, 0x24338000, 0x3ED00402, 0x33E18000, 0x3ED00402,
+    0x346DC000, 0x3ED00402, 0x34B78000, 0x3ED00402, 0x39310000, 0x3ED00402, 0x3AB4C000, 0x3ED00402,
+    0x3C840000, 0x3ED00402, 0x3DB9C000, 0x3ED04402, 0x20004000, 0x3ED04402, 0x21818000, 0x3ED04402,
+    0x21970000, 0x3ED04402, 0x237BC000, 0x3ED04402, 0x25CC8000, 0x3ED04402, 0x26DBC000, 0x3ED04402,
+    0x277E8000, 0x3ED00402, 0x3E230000, 0x3ED00402, 0x3E5FC000, 0x3ED00402, 0x3F680000, 0x3ED04402,
+    0x20F24000, 0x3ED04402, 0x24C10000, 0x3ED04402, 0x279FC000, 0x3ED04402, 0x22B58000, 0x3ED00402,
+    0x3637C000, 0x3ED00402, 0x37C10000, 0x3ED00402, 0x3F180000, 0x3ED04402, 0x201F8000, 0x3ED00402,
+    0x3C988000, 0x3ED00402, 0x3E328000, 0x3ED04402, 0x23308000, 0x3ED04402, 0x25BDC000, 0x3ED00402,
+    0x36360000, 0x3ED00402, 0x37188000, 0x3ED00402, 0x3A84C000, 0x3ED00402, 0x3B768000, 0x3ED00402,
+    0x3BC3C000, 0x3ED00402, 0x3F4BC000, 0x3ED00402, 0x3F8DC000, 0x3ED04402, 0x2592C000, 0x3ED00402,
+    0x34B48000, 0x3ED04402, 0x2022C000, 0x3ED00402, 0x34770000, 0x3ED00402, 0x34730000, 0x3ED00402,
+    0x3E870000, 0x3ED00402, 0x3F6F8000, 0x3ED04402, 0x20FC4000, 0x3ED04402, 0x259D4000, 0x3ED04402,
+    0x22E00000, 0x3ED00402, 0x38B3C000, 0x3ED04402, 0x22BF8000, 0x3ED00402, 0x338E4000, 0x3ED00402,
+    0x36F9C000, 0x3ED00402, 0x38048000, 0x3ED00402, 0x3CE1C000, 0x3ED00402, 0x3D5C0000, 0x3ED00402,
+    0x34C5C000, 0x3ED00402, 0x3E3EC000, 0x3ED00402, 0x33EFC000, 0x3ED00402, 0x37EA4000, 0x3ED00402,
+    0x33834000, 0x3ED00402, 0x3B330000, 0x3ED00402, 0x395E0000, 0x3ED00402, 0x3F488000, 0x3ED00402,
+    0x34F0C000, 0x3ED00402, 0x36178000, 0x3ED00402, 0x3DC04000, 0x3ED04402, 0x21124000, 0x3ED04402,
+    0x22AA8000, 0x3ED00402, 0x3AEE8000, 0x3ED04402, 0x23EC0000, 0x3ED00402, 0x3B220000, 0x3ED00402,
+    0x38BF8000, 0x3ED04402, 0x20B94000, 0x3ED00402, 0x38E80000, 0x3ED00402, 0x3D594000, 0x3ED00402,
+    0x33AB8000, 0x3ED00402, 0x345A4000, 0x3ED00402, 0x34724000, 0x3ED00402, 0x3A204000, 0x3ED00402,
+    0x3F39C000, 0x3ED04402, 0x209BC000, 0x3ED04402, 0x22B48000, 0x3ED04402, 0x2473C000, 0x3ED00402,
+    0x34BD4000, 0x3ED00402, 0x35108000, 0x3ED00402, 0x365CC000, 0x3ED00402, 0x37BB0000, 0x3ED00402,
+    0x39714000, 0x3ED00402, 0x3BFF8000, 0x3ED00402, 0x3E4A8000, 0x3ED04402, 0x256B4000, 0x3ED04402,
+    0x269A8000, 0x3ED04402, 0x27A5C000, 0x3ED04402, 0x27B38000, 0x3ED00402, 0x34A6C000, 0x3ED00402,
+    0x39B18000, 0x3ED00402, 0x3ADDC000, 0x3ED04402, 0x23D88000, 0x3ED00402, 0x379D0000, 0x3ED00402,
+    0x38640000, 0x3ED00402, 0x38800000, 0x3ED00402, 0x39268000, 0x3ED00402, 0x3BC8C000, 0x3ED00402,
+    0x3C524000, 0x3ED00402, 0x3D224000, 0x3ED00402, 0x3E728000, 0x3ED00402, 0x3F7D0000, 0x3ED04402,
+    0x201BC000, 0x3ED04402, 0x23C98000, 0x3ED04402, 0x213B8000, 0x3ED04402, 0x2408C000, 0x3ED04402,
+    0x24D28000, 0x3ED00402, 0x3485C000, 0x3ED00402, 0x34A8C000, 0x3ED00402, 0x352F4000, 0x3ED00402,
+    0x3C320000, 0x3ED04402, 0x22308000, 0x3ED00402, 0x37B24000, 0x3ED00402, 0x37FD4000, 0x3ED00402,
+    0x38DEC000, 0x3ED00402, 0x3AEB8000, 0x3ED00402, 0x3F0F8000, 0x3ED00402, 0x3CDD4000, 0x3ED00402,
+    0x33B90000, 0x3ED00402, 0x35BE4000, 0x3ED00402, 0x376E8000, 0x3ED00402, 0x38070000, 0x3ED00402,
+    0x3CEC8000, 0x3ED00402, 0x3D1A4000, 0x3ED00402, 0x3FE68000, 0x3ED04402, 0x20118000, 0x3ED04402,
+    0x248D0000, 0x3ED04402, 0x25BD8000, 0x3ED04402, 0x25D20000, 0x3ED04402, 0x26060000, 0x3ED00402,
+    0x33E2C000, 0x3ED00402, 0x3E6B8000, 0x3ED04402, 0x246D0000, 0x3ED04402, 0x25AE0000, 0x3ED00402,
+    0x38384000, 0x3ED00402, 0x33A18000, 0x3ED00402, 0x34368000, 0x3ED00402, 0x36FB8000, 0x3ED00402,
+    0x370FC000, 0x3ED00402, 0x39664000, 0x3ED00402, 0x3C738000, 0x3ED00402, 0x3D908000, 0x3ED04402,
+    0x213F0000, 0x3ED04402, 0x241F0000, 0x3ED04402, 0x27E34000, 0x3ED00402, 0x39A20000, 0x3ED04402,
+    0x258B8000, 0x3ED00402, 0x34A24000, 0x3ED00402, 0x39DEC000, 0x3ED00402, 0x39FCC000, 0x3ED00402,
+    0x3B504000, 0x3ED00402, 0x3BA70000, 0x3ED00402, 0x3D024000, 0x3ED00402, 0x3D564000, 0x3ED00402,
+    0x3E1AC000, 0x3ED00402, 0x3F440000, 0x3ED04402, 0x26178000, 0x3ED00402, 0x345B4000, 0x3ED00402,
+    0x388B8000, 0x3ED04402, 0x259E0000, 0x3ED00402, 0x340AC000, 0x3ED00402, 0x37464000, 0x3ED00402,
+    0x3B7A8000, 0x3ED04402, 0x23CA8000, 0x3ED00402, 0x37E2C000, 0x3ED00402, 0x38510000, 0x3ED00402,
+    0x3A05C000, 0x3ED04402, 0x25A18000, 0x3ED00402, 0x348A4000, 0x3ED00402, 0x3503C000, 0x3ED00402,
+    0x37194000, 0x3ED00402, 0x3984C000, 0x3ED00402, 0x39D38000, 0x3ED00402, 0x3A2A0000, 0x3ED00402,
+    0x3B394000, 0x3ED00402, 0x3D018000, 0x3ED00402, 0x3D788000, 0x3ED00402, 0x3FDE4000, 0x3ED04402,
+    0x2233C000, 0x3ED04402, 0x22384000, 0x3ED04402, 0x24730000, 0x3ED04402, 0x25B88000, 0x3ED00402,
+    0x34CFC000, 0x3ED00402, 0x3BAE8000, 0x3ED00402, 0x35074000, 0x3ED00402, 0x3C740000, 0x3ED00402,
+    0x3D260000, 0x3ED04402, 0x217E8000, 0x3ED04402, 0x25A8C000, 0x3ED04402, 0x2715C000, 0x3ED04402,
+    0x27A7C000, 0x3ED00402, 0x39E5C000, 0x3ED00402, 0x3B72C000, 0x3ED04402, 0x207A0000, 0x3ED00402,
+    0x3EB2C000, 0x3ED00402, 0x3EC80000, 0x3ED00402, 0x3F248000, 0x3ED00402, 0x3CB00000, 0x3ED00402,
+    0x3C264000, 0x3ED04402, 0x22D60000, 0x3ED00402, 0x33B00000, 0x3ED04402, 0x20CD8000, 0x3ED00402,
+    0x348E8000, 0x3ED00402, 0x3481C000, 0x3ED00402, 0x37A98000, 0x3ED00402, 0x38B4C000, 0x3ED00402,
+    0x3F358000, 0x3ED00402, 0x36E14000, 0x3ED00402, 0x3B478000, 0x3ED00402, 0x39AD0000, 0x3ED04402,
+    0x23CEC000, 0x3ED04402, 0x22130000, 0x3ED04402, 0x25934000, 0x3ED04402, 0x2262C000, 0x3ED00402,
+    0x37B4C000, 0x3ED00402, 0x34500000, 0x3ED00402, 0x35700000, 0x3ED04402, 0x3E838000, 0x3ED04402,
+    0x3E83C000, 0x3ED00402, 0x36168000, 0x3ED04402, 0x3E844000, 0x3ED00402, 0x399D0000, 0x3ED04402,
+    0x3E84C000, 0x3ED04402, 0x3E850000, 0x3ED00402, 0x34778000, 0x3ED00402, 0x3CCA8000, 0x3ED00402,
+    0x3DB28000, 0x3ED00402, 0x3E4F0000, 0x3ED00402, 0x3E578000, 0x3ED00402, 0x3E594000, 0x3ED00402,
+    0x3E63C000, 0x3ED04402, 0x25D58000, 0x3ED00402, 0x3F2F8000, 0x3ED00402, 0x3FEF4000, 0x3ED04402,
+    0x3E87C000, 0x3ED04402, 0x21848000, 0x3ED04402, 0x3E884000, 0x3ED04402, 0x22BE0000, 0x3ED04402,
+    0x3E88C000, 0x3ED04402, 0x3E890000, 0x3ED04402, 0x240E0000, 0x3ED04402, 0x243F4000, 0x3ED04402,
+    0x3E89C000, 0x3ED04402, 0x3E8A0000, 0x3ED04402, 0x3E8A4000, 0x3ED04402, 0x263BC000, 0x3ED04402,
+    0x263F0000, 0x3ED04402, 0x264A0000, 0x3ED04402, 0x276D0000, 0x3ED04402, 0x24378000, 0x3ED04402,
+    0x25ADC000, 0x3ED00402, 0x33EB8000, 0x3ED00402, 0x3439C000, 0x3ED00402, 0x34534000, 0x3ED00402,
+    0x34B24000, 0x3ED00402, 0x34B90000, 0x3ED00402, 0x34D44000, 0x3ED00402, 0x35674000, 0x3ED00402,
+    0x35818000, 0x3ED00402, 0x359A0000, 0x3ED00402, 0x36100000, 0x3ED00402, 0x362A0000, 0x3ED00402,
+    0x37190000, 0x3ED00402, 0x371B8000, 0x3ED00402, 0x38250000, 0x3ED00402, 0x385A0000, 0x3ED00402,
+    0x38638000, 0x3ED00402, 0x387C8000, 0x3ED00402, 0x3953C000, 0x3ED00402, 0x39788000, 0x3ED00402,
+    0x39A44000, 0x3ED00402, 0x3A214000, 0x3ED00402, 0x3B5DC000, 0x3ED00402, 0x3B868000, 0x3ED00402,
+    0x3BC88000, 0x3ED00402, 0x3C5B8000, 0x3ED00402, 0x3C8AC000, 0x3ED00402, 0x3D088000, 0x3ED00402,
+    0x3E244000, 0x3ED00402, 0x3E4F8000, 0x3ED00402, 0x3E524000, 0x3ED00402, 0x3E520000, 0x3ED00402,
+    0x3E540000, 0x3ED00402, 0x3E558000, 0x3ED00402, 0x3E574000, 0x3ED00402, 0x3E634000, 0x3ED00402,
+    0x3E638000, 0x3ED00402, 0x3E900000, 0x3ED00402, 0x3EA04000, 0x3ED00402, 0x3EF00000, 0x3ED00402,
+    0x3F824000, 0x3ED00402, 0x3F904000, 0x3ED00402, 0x3FDC8000, 0x3ED04402, 0x20014000, 0x3ED04402,
+    0x207B4000, 0x3ED04402, 0x209E4000, 0x3ED04402, 0x2115C000, 0x3ED04402, 0x22440000, 0x3ED04402,
+    0x22658000, 0x3ED04402, 0x22C04000, 0x3ED04402, 0x22CE4000, 0x3ED04402, 0x2334C000, 0x3ED04402,
+    0x23420000, 0x3ED04402, 0x23ED8000, 0x3ED04402, 0x25B8C000, 0x3ED04402, 0x25FFC000, 0x3ED04402,
+    0x260EC000, 0x3ED00402, 0x381D4000, 0x3EE10402, 0x30BB8000, 0x3ED04402, 0x20860000, 0x3ED00402,
+    0x33898000, 0x3ED00402, 0x346D4000, 0x3ED00402, 0x345A0000, 0x3ED00402, 0x33E00000, 0x3ED00402,
+    0x34514000, 0x3ED00402, 0x34600000, 0x3ED00402, 0x34B1C000, 0x3ED00402, 0x34BE8000, 0x3ED00402,
+    0x35554000, 0x3ED00402, 0x35664000, 0x3ED00402, 0x35788000, 0x3ED00402, 0x362CC000, 0x3ED00402,
+    0x36510000, 0x3ED00402, 0x36550000, 0x3ED00402, 0x36988000, 0x3ED00402, 0x36CA0000, 0x3ED00402,
+    0x37B48000, 0x3ED00402, 0x37B64000, 0x3ED00402, 0x37DA4000, 0x3ED00402, 0x37EB4000, 0x3ED00402,
+    0x38360000, 0x3ED00402, 0x38538000, 0x3ED00402, 0x38420000, 0x3ED00402, 0x38580000, 0x3ED00402,
+    0x388D0000, 0x3ED00402, 0x38F10000, 0x3ED00402, 0x39070000, 0x3ED00402, 0x39148000, 0x3ED00402,
+    0x39558000, 0x3ED00402, 0x39C6C000, 0x3ED00402, 0x39D58000, 0x3ED00402, 0x3ADE4000, 0x3ED00402,
+    0x3BB6C000, 0x3ED00402, 0x3BB2C000, 0x3ED00402, 0x3C078000, 0x3ED00402, 0x3DE9C000, 0x3ED00402,
+    0x3C8D4000, 0x3ED00402, 0x3CABC000, 0x3ED00402, 0x3D1C4000, 0x3ED00402, 0x3D418000, 0x3ED00402,
+    0x3D4EC000, 0x3ED00402, 0x3D874000, 0x3ED00402, 0x3D87C000, 0x3ED00402, 0x3DB6C000, 0x3ED00402,
+    0x3DBD0000, 0x3ED00402, 0x3DD28000, 0x3ED00402, 0x3DD00000, 0x3ED00402, 0x3E330000, 0x3ED00402,
+    0x3EAC4000, 0x3ED00402, 0x3F1EC000, 0x3ED00402, 0x3F56C000, 0x3ED00402, 0x3FCF8000, 0x3ED04402,
+    0x20D48000, 0x3ED04402, 0x20FBC000, 0x3ED04402, 0x21DE4000, 0x3ED04402, 0x22504000, 0x3ED04402,
+    0x22618000, 0x3ED04402, 0x22AFC000, 0x3ED04402, 0x22B2C000, 0x3ED04402, 0x22BB4000, 0x3ED04402,
+    0x22E28000, 0x3ED04402, 0x23CE0000, 0x3ED04402, 0x241C8000, 0x3ED04402, 0x24664000, 0x3ED04402,
+    0x249D8000, 0x3ED04402, 0x259F0000, 0x3ED04402, 0x25F6C000, 0x3ED04402, 0x2602C000, 0x3ED04402,
+    0x26C48000, 0x3EE10402, 0x2A128000, 0x3EE10402, 0x2A110000, 0x3EE10402, 0x2CF54000, 0x3EE00402,
+    0x2EE74000, 0x3EE00402, 0x30060000, 0x3EE00402, 0x300E4000, 0x3EE10402, 0x34924000, 0x3EE10402,
+    0x37340000, 0x3EE10402, 0x3FB4C000, 0x3ED04402, 0x27D0C000, 0x3ED04402, 0x27E38000, 0x08108404,
+    0x08108404, 0x08108404, 0x08240404, 0x08108404, 0x08358404, 0x08108404, 0x08108404, 0x08240404,
+    0x08108404, 0x08108404, 0x08358404, 0x08748404, 0x00002324, 0x087DC404, 0x08748404, 0x087DC404,
+    0x09824404, 0x09830404, 0x09824404, 0x097E8404, 0x09824404, 0x09800404, 0x09850404, 0x09830404,
+    0x09824404, 0x09808404, 0x0989C402, 0x00000AC2, 0x0989C404, 0x0989C404, 0x00000B22, 0x098C8402,
+    0x00000BC2, 0x098C8402, 0x00000BA2, 0x098C8402, 0x00000BE2, 0x00000BC2, 0x098C8402, 0x00000BE2,
+    0x00000BA2, 0x09878402, 0x00000B22, 0x09878402, 0x00000B42, 0x09878402, 0x00000BE2, 0x0987C402,
+    0x00000BE2, 0x09880402, 0x00000BE2, 0x09884402, 0x00000BE2, 0x09888402, 0x00000BE2, 0x0988C402,
+    0x00000BE2, 0x09890402, 0x00000BE2, 0x09898402, 0x00000BE2, 0x0989C402, 0x00000BE2, 0x098A0419,
+    0x00000BE2, 0x098A0402, 0x00000BE2, 0x098A4402, 0x00000BE2, 0x098A8402, 0x00000BE2, 0x098AC402,
+    0x00000BE2, 0x098B0402, 0x00000BE2, 0x098B8419, 0x00000BE2, 0x098B8402, 0x00000BE2, 0x098BC402,
+    0x00000BE2, 0x098C0402, 0x00000BE2, 0x098C4402, 0x00000BE2, 0x098C8402, 0x00000BE2, 0x098CC402,
+    0x00000BE2, 0x0988C402, 0x00000B62, 0x0987C402, 0x00000C02, 0x098A0402, 0x00000C02, 0x098B8402,
+    0x00000C02, 0x09878404, 0x098A4404, 0x09C9C41A, 0x0000107A, 0x09C9C419, 0x00001079, 0x09D1441A,
+    0x0000107A, 0x09D14419, 0x00001079, 0x09CB041A, 0x0999041A, 0x099B841A, 0x099C841A, 0x099B8419,
+    0x099C8419, 0x099B841A, 0x09C9C41A, 0x099B8419, 0x09C9C419, 0x099B841A, 0x09CA041A, 0x099B8419,
+    0x09CA0419, 0x099B841A, 0x09CB041A, 0x099B8419, 0x09CB0419, 0x099B841A, 0x09CAC41A, 0x099B8419,
+    0x09CAC419, 0x099B841A, 0x09CB441A, 0x099B8419, 0x09CB4419, 0x099B841A, 0x09CEC41A, 0x099B8419,
+    0x09CEC419, 0x099B8417, 0x09CEC417, 0x099B841A, 0x09CD841A, 0x099B8419, 0x09CD8419, 0x099B8417,
+    0x09CD8417, 0x099B841A, 0x09A3C41A, 0x099B841A, 0x09A6441A, 0x099B841A, 0x09C5041A, 0x099B841A,
+    0x09CDC41A, 0x099D041A, 0x09A3C41A, 0x099D041A, 0x09A6441A, 0x099D041A, 0x09A6841A, 0x099D041A,
+    0x09C5041A, 0x099D041A, 0x09CD841A, 0x099D041A, 0x09CDC41A, 0x09A1441A, 0x09A3C41A, 0x09A1441A,
+    0x09A6441A, 0x09A1441A, 0x09A6841A, 0x09A1441A, 0x09C5041A, 0x09A1441A, 0x09CD841A, 0x09A1441A,
+    0x09CDC41A, 0x09A1841A, 0x09A3C41A, 0x09A1841A, 0x09C5041A, 0x09A1841A, 0x09CD841A, 0x09A1841A,
+    0x09CDC41A, 0x09A3C41A, 0x09A6441A, 0x09A3C41A, 0x09C5041A, 0x09A6441A, 0x09A3C41A, 0x09A6441A,
+    0x09C5041A, 0x09A6841A, 0x09A3C41A, 0x09A6841A, 0x09A6441A, 0x09A6841A, 0x09C5041A, 0x09B1841A,
+    0x09A3C41A, 0x09B1841A, 0x09A6441A, 0x09B1841A, 0x09A6841A, 0x09B1841A, 0x09C5041A, 0x09B4441A,
+    0x09A6441A, 0x09B4441A, 0x09C5041A, 0x09B4841A, 0x09A3C41A, 0x09B4841A, 0x09A6441A, 0x09B4841A,
+    0x09A6841A, 0x09B4841A, 0x09C5041A, 0x09B5C41A, 0x09A6441A, 0x09B5C41A, 0x09C5041A, 0x09B6041A,
+    0x09C5041A, 0x09B6C41A, 0x09A3C41A, 0x09B6C41A, 0x09C5041A, 0x09B7041A, 0x09A3C41A, 0x09B7041A,
+    0x09C5041A, 0x09B9041A, 0x09A3C41A, 0x09B9041A, 0x09A6441A, 0x09B9041A, 0x09A6841A, 0x09B9041A,
+    0x09C5041A, 0x09B9041A, 0x09CD841A, 0x09B9041A, 0x09CDC41A, 0x09BC041A, 0x09A6441A, 0x09BC041A,
+    0x09C5041A, 0x09BC041A, 0x09CD841A, 0x09BC041A, 0x09CDC41A, 0x09BD841A, 0x099C841A, 0x09BD841A,
+    0x09A3C41A, 0x09BD841A, 0x09A6441A, 0x09BD841A, 0x09A6841A, 0x09BD841A, 0x09C3041A, 0x09BD841A,
+    0x09C5041A, 0x09BD841A, 0x09CD841A, 0x09BD841A, 0x09CDC41A, 0x09C3041A, 0x09A3C41A, 0x09C3041A,
+    0x09A6441A, 0x09C3041A, 0x09A6841A, 0x09C3041A, 0x09C5041A, 0x09C3041A, 0x09CD841A, 0x09C3041A,
+    0x09CDC41A, 0x09C5041A, 0x09A3C41A, 0x09C5041A, 0x09A6441A, 0x09C5041A, 0x09A6841A, 0x09C5041A,
+    0x09C5041A, 0x09C5041A, 0x09CD841A, 0x09C5041A, 0x09CDC41A, 0x09C6041A, 0x09A3C41A, 0x09C6041A,
+    0x09A6441A, 0x09C6041A, 0x09A6841A, 0x09C6041A, 0x09C5041A, 0x09C6041A, 0x09CD841A, 0x09C6041A,
+    0x09CDC41A, 0x09C8841A, 0x09A3C41A, 0x09C8841A, 0x09C5041A, 0x09C8841A, 0x09CD841A, 0x09C8841A,
+    0x09CDC41A, 0x09CDC41A, 0x09A3C41A, 0x09CDC41A, 0x09A6441A, 0x09CDC41A, 0x09A6841A, 0x09CDC41A,
+    0x09C5041A, 0x09CDC41A, 0x09CD841A, 0x09CDC41A, 0x09CDC41A, 0x09A9441A, 0x0000131A, 0x09ACC41A,
+    0x0000131A, 0x09CD841A, 0x0000131A, 0x00000E1A, 0x0000101A, 0x00000E7A, 0x0000101A, 0x00000EDA,
+    0x0000101A, 0x00000F5A, 0x0000101A, 0x00000FBA, 0x0000101A, 0x0000101A, 0x0000131A, 0x099B8419,
+    0x09ACC419, 0x099B8419, 0x09AD0419, 0x099B8419, 0x09C50419, 0x099B8419, 0x09C60419, 0x099B8419,
+    0x09CDC419, 0x099D0419, 0x09ACC419, 0x099D0419, 0x09AD0419, 0x099D0419, 0x09C50419, 0x099D0419,
+    0x09C60419, 0x099D0419, 0x09CD8419, 0x099D0419, 0x09CDC419, 0x09A14419, 0x09ACC419, 0x09A14419,
+    0x09AD0419, 0x09A14419, 0x09C50419, 0x09A14419, 0x09C60419, 0x09A14419, 0x09CD8419, 0x09A14419,
+    0x09CDC419, 0x09A18419, 0x09ACC419, 0x09A18419, 0x09AD0419, 0x09A18419, 0x09C50419, 0x09A18419,
+    0x09C60419, 0x09A18419, 0x09CD8419, 0x09A18419, 0x09CDC419, 0x09B90419, 0x09CD8419, 0x09B90419,
+    0x09CDC419, 0x09BC0419, 0x09CD8419, 0x09BC0419, 0x09CDC419, 0x09BD8419, 0x099C8419, 0x09BD8419,
+    0x09C30419, 0x09BD8419, 0x09C50419, 0x09BD8419, 0x09CD8419, 0x09BD8419, 0x09CDC419, 0x09C30419,
+    0x09C50419, 0x09C30419, 0x09CD8419, 0x09C30419, 0x09CDC419, 0x09C50419, 0x099C8419, 0x09C50419,
+    0x09C50419, 0x09C60419, 0x09ACC419, 0x09C60419, 0x09AD0419, 0x09C60419, 0x09C50419, 0x09C60419,
+    0x09C60419, 0x09C60419, 0x09CD8419, 0x09C60419, 0x09CDC419, 0x09CD8419, 0x00001319, 0x09CDC419,
+    0x09ACC419, 0x09CDC419, 0x09AD0419, 0x09CDC419, 0x09C50419, 0x09CDC419, 0x09C60419, 0x09CDC419,
+    0x09CD8419, 0x09CDC419, 0x09CDC419, 0x099B8417, 0x09A3C417, 0x099B8417, 0x09A64417, 0x099B8417,
+    0x09A68417, 0x099B8417, 0x09C50417, 0x099B8417, 0x09C88417, 0x099D0417, 0x09A3C417, 0x099D0417,
+    0x09A64417, 0x099D0417, 0x09A68417, 0x099D0417, 0x09C50417, 0x099D0417, 0x09C88417, 0x09A14417,
+    0x09A3C417, 0x09A14417, 0x09A64417, 0x09A14417, 0x09A68417, 0x09A14417, 0x09C50417, 0x09A14417,
+    0x09C88417, 0x09A18417, 0x09C50417, 0x09A3C417, 0x09A64417, 0x09A3C417, 0x09C50417, 0x09A64417,
+    0x09A3C417, 0x09A64417, 0x09C50417, 0x09A68417, 0x09A3C417, 0x09A68417, 0x09C50417, 0x09B18417,
+    0x09A3C417, 0x09B18417, 0x09A64417, 0x09B18417, 0x09A68417, 0x09B18417, 0x09C50417, 0x09B44417,
+    0x09A64417, 0x09B44417, 0x09A68417, 0x09B44417, 0x09C50417, 0x09B48417, 0x09A3C417, 0x09B48417,
+    0x09A64417, 0x09B48417, 0x09A68417, 0x09B48417, 0x09C50417, 0x09B5C417, 0x09A64417, 0x09B60417,
+    0x09C50417, 0x09B6C417, 0x09A3C417, 0x09B6C417, 0x09C50417, 0x09B70417, 0x09A3C417, 0x09B70417,
+    0x09C50417, 0x09B90417, 0x09A3C417, 0x09B90417, 0x09A64417, 0x09B90417, 0x09A68417, 0x09B90417,
+    0x09C50417, 0x09BC0417, 0x09A64417, 0x09BC0417, 0x09C50417, 0x09BD8417, 0x09A3C417, 0x09BD8417,
+    0x09A64417, 0x09BD8417, 0x09A68417, 0x09BD8417, 0x09C30417, 0x09BD8417, 0x09C50417, 0x09C30417,
+    0x09A3C417, 0x09C30417, 0x09A64417, 0x09C30417, 0x09A68417, 0x09C30417, 0x09C50417, 0x09C30417,
+    0x09C88417, 0x09C50417, 0x09A3C417, 0x09C50417, 0x09A64417, 0x09C50417, 0x09A68417, 0x09C50417,
+    0x09C50417, 0x09C60417, 0x09A3C417, 0x09C60417, 0x09A64417, 0x09C60417, 0x09A68417, 0x09C60417,
+    0x09C50417, 0x09C60417, 0x09C88417, 0x09C88417, 0x09A3C417, 0x09C88417, 0x09C50417, 0x09C88417,
+    0x00001317, 0x09CDC417, 0x09A3C417, 0x09CDC417, 0x09A64417, 0x09CDC417, 0x09A68417, 0x09CDC417,
+    0x09C50417, 0x09CDC417, 0x09C88417, 0x099B8418, 0x09C50418, 0x099B8418, 0x09C88418, 0x099D0418,
+    0x09C50418, 0x099D0418, 0x09C88418, 0x09A14418, 0x09C50418, 0x09A14418, 0x09C88418, 0x09A18418,
+    0x09C50418, 0x09A18418, 0x09C88418, 0x09B18418, 0x09C50418, 0x09B18418, 0x09C88418, 0x09B1C418,
+    0x09C50418, 0x09B1C418, 0x09C88418, 0x09BD8418, 0x09C30418, 0x09BD8418, 0x09C50418, 0x09C30418,
+    0x09C50418, 0x09C60418, 0x09C50418, 0x09C60418, 0x09C88418, 0x09CDC418, 0x09C50418, 0x09CDC418,
+    0x09C88418, 0x00000ED8, 0x00001018, 0x00000F58, 0x00001018, 0x00000FB8, 0x00001018, 0x09B5C41A,
+    0x09CD841A, 0x09B5C41A, 0x09CDC41A, 0x09B6C41A, 0x09CD841A, 0x09B6C41A, 0x09CDC41A, 0x09B7041A,
+    0x09CD841A, 0x09B7041A, 0x09CDC41A, 0x09B1841A, 0x09CD841A, 0x09B1841A, 0x09CDC41A, 0x09B1C41A,
+    0x09CD841A, 0x09B1C41A, 0x09CDC41A, 0x09A6441A, 0x09CD841A, 0x09A6441A, 0x09CDC41A, 0x09A3C41A,
+    0x09CD841A, 0x09A3C41A, 0x09CDC41A, 0x09A6841A, 0x09CD841A, 0x09A6841A, 0x09CDC41A, 0x09B4441A,
+    0x09CD841A, 0x09B4441A, 0x09CDC41A, 0x09B4841A, 0x09CD841A, 0x09B4841A, 0x09CDC41A, 0x09B1C41A,
+    0x09A3C41A, 0x09B1C41A, 0x09A6441A, 0x09B1C41A, 0x09A6841A, 0x09B1C41A, 0x09C5041A, 0x09B1C41A,
+    0x09ACC41A, 0x09B1841A, 0x09ACC41A, 0x09B4441A, 0x09ACC41A, 0x09B4841A, 0x09ACC41A, 0x09B5C419,
+    0x09CD8419, 0x09B5C419, 0x09CDC419, 0x09B6C419, 0x09CD8419, 0x09B6C419, 0x09CDC419, 0x09B70419,
+    0x09CD8419, 0x09B70419, 0x09CDC419, 0x09B18419, 0x09CD8419, 0x09B18419, 0x09CDC419, 0x09B1C419,
+    0x09CD8419, 0x09B1C419, 0x09CDC419, 0x09A64419, 0x09CD8419, 0x09A64419, 0x09CDC419, 0x09A3C419,
+    0x09CD8419, 0x09A3C419, 0x09CDC419, 0x09A68419, 0x09CD8419, 0x09A68419, 0x09CDC419, 0x09B44419,
+    0x09CD8419, 0x09B44419, 0x09CDC419, 0x09B48419, 0x09CD8419, 0x09B48419, 0x09CDC419, 0x09B1C419,
+    0x09A3C419, 0x09B1C419, 0x09A64419, 0x09B1C419, 0x09A68419, 0x09B1C419, 0x09C50419, 0x09B1C419,
+    0x09ACC419, 0x09B18419, 0x09ACC419, 0x09B44419, 0x09ACC419, 0x09B48419, 0x09ACC419, 0x09B1C417,
+    0x09A3C417, 0x09B1C417, 0x09A64417, 0x09B1C417, 0x09A68417, 0x09B1C417, 0x09C50417, 0x09B18417,
+    0x09C88417, 0x09B1C417, 0x09C88417, 0x09B5C417, 0x09C50417, 0x09B18418, 0x09A3C418, 0x09B18418,
+    0x09A64418, 0x09B18418, 0x09A68418, 0x09B1C418, 0x09A3C418, 0x09B1C418, 0x09A64418, 0x09B1C418,
+    0x09A68418, 0x09B5C418, 0x09C50418, 0x09B60418, 0x09C50418, 0x099C8419, 0x00000DB9, 0x099C841A,
+    0x00000DBA, 0x09A14417, 0x09A3C417, 0x09C50417, 0x09A14419, 0x09A64419, 0x09A3C419, 0x09A14417,
+    0x09A64417, 0x09A3C417, 0x09A14417, 0x09A64417, 0x09C50417, 0x09A14417, 0x09A68417, 0x09C50417,
+    0x09A14417, 0x09C50417, 0x09A3C417, 0x09A14417, 0x09C50417, 0x09A64417, 0x09A14417, 0x09C50417,
+    0x09A68417, 0x09A3C419, 0x09C50419, 0x09A64419, 0x09A3C417, 0x09C50417, 0x09A64417, 0x09A64419,
+    0x09C50419, 0x09CDC419, 0x09A64419, 0x09C50419, 0x09CD8419, 0x09B18417, 0x09A64417, 0x09A3C417,
+    0x09B18417, 0x09A3C417, 0x09A64417, 0x09B18419, 0x09A3C419, 0x09CD8419, 0x09B18419, 0x09C50419,
+    0x09A64419, 0x09B18417, 0x09C50417, 0x09A64417, 0x09B18417, 0x09C50417, 0x09A3C417, 0x09B18419,
+    0x09C50419, 0x09C50419, 0x09B18417, 0x09C50417, 0x09C50417, 0x09B44419, 0x09A64419, 0x09A64419,
+    0x09B44417, 0x09A64417, 0x09A64417, 0x09B44419, 0x09C50419, 0x09C50419, 0x09B1C419, 0x09A64419,
+    0x09C50419, 0x09B1C417, 0x09A64417, 0x09C50417, 0x09B1C419, 0x09A3C419, 0x09CDC419, 0x09B1C419,
+    0x09C50419, 0x09A68419, 0x09B1C417, 0x09C50417, 0x09A68417, 0x09B1C419, 0x09C50419, 0x09C50419,
+    0x09B1C417, 0x09C50417, 0x09C50417, 0x09B48419, 0x09A64419, 0x09CD8419, 0x09B48419, 0x09A68419,
+    0x09C50419, 0x09B48417, 0x09A68417, 0x09C50417, 0x09B5C419, 0x09C50419, 0x09A64419, 0x09B5C417,
+    0x09C50417, 0x09A64417, 0x09B5C417, 0x09C50417, 0x09C50417, 0x09B5C419, 0x09C50419, 0x09CDC419,
+    0x09B6C419, 0x09A3C419, 0x09C50419, 0x09B6C419, 0x09C50419, 0x09C50419, 0x09B6C417, 0x09C50417,
+    0x09C50417, 0x09B6C419, 0x09C50419, 0x09CD8419, 0x09B70419, 0x09C50419, 0x09C50419, 0x09B70419,
+    0x09C50419, 0x09CDC419, 0x09B70419, 0x09C50419, 0x09CD8419, 0x09B90419, 0x09A68419, 0x09C50419,
+    0x09B90417, 0x09A68417, 0x09C50417, 0x09BC0419, 0x09C50419, 0x09A64419, 0x09BC0419, 0x09C50419,
+    0x09C50419, 0x09C30419, 0x09A64419, 0x09C50419, 0x09C30419, 0x09A64419, 0x09CDC419, 0x09C30419,
+    0x09A64419, 0x09CD8419, 0x09C30417, 0x09A3C417, 0x09A3C417, 0x09C30419, 0x09A3C419, 0x09A3C419,
+    0x09C30419, 0x09A68419, 0x09C50419, 0x09C30417, 0x09A68417, 0x09C50417, 0x09C30419, 0x09C50419,
+    0x09A64419, 0x09C30417, 0x09C50417, 0x09A64417, 0x09C50417, 0x09A64417, 0x09A3C417, 0x09C50417,
+    0x09A64417, 0x09C50417, 0x09C50419, 0x09A64419, 0x09CDC419, 0x09C50417, 0x09A3C417, 0x09A64417,
+    0x09C50417, 0x09A3C417, 0x09C50417, 0x09C50417, 0x09A68417, 0x09A3C417, 0x09C50417, 0x09A68417,
+    0x09C50417, 0x09C50417, 0x09A3C417, 0x09A68417, 0x09C88417, 0x09C50417, 0x09A3C417, 0x09C88417,
+    0x09C50417, 0x09C50417, 0x09C60417, 0x09A64417, 0x09C50417, 0x09C60419, 0x09A64419, 0x09CD8419,
+    0x09C60419, 0x09A3C419, 0x09C50419, 0x09C60417, 0x09A3C417, 0x09C50417, 0x09C60419, 0x09A3C419,
+    0x09CD8419, 0x09C60419, 0x09C50419, 0x09CDC419, 0x09C60419, 0x09C50419, 0x09CD8419, 0x09CDC419,
+    0x09C50419, 0x09C50419, 0x09CDC417, 0x09C50417, 0x09C50417, 0x099D0419, 0x09A68419, 0x09CDC419,
+    0x09A14419, 0x09A3C419, 0x09CDC419, 0x09A14419, 0x09A3C419, 0x09CD8419, 0x09A14419, 0x09A68419,
+    0x09CDC419, 0x09A14419, 0x09A68419, 0x09CD8419, 0x09A14419, 0x09C50419, 0x09CDC419, 0x09A14419,
+    0x09C50419, 0x09CD8419, 0x09A3C419, 0x09C50419, 0x09CDC419, 0x09A3C419, 0x09A64419, 0x09CD8419,
+    0x09A3C419, 0x09C50419, 0x09CD8419, 0x09B18419, 0x09A68419, 0x09CD8419, 0x09B44419, 0x09A64419,
+    0x09CDC419, 0x09B1C419, 0x09A64419, 0x09CDC419, 0x09B48419, 0x09A64419, 0x09CDC419, 0x09C30419,
+    0x09A3C419, 0x09CDC419, 0x09C30419, 0x09C50419, 0x09CDC419, 0x09CDC419, 0x09A64419, 0x09CDC419,
+    0x09CDC419, 0x09A3C419, 0x09CDC419, 0x09CDC419, 0x09C50419, 0x09CDC419, 0x09C50419, 0x09C50419,
+    0x09CDC419, 0x09BC0419, 0x09C50419, 0x09CDC419, 0x09C60419, 0x09A64419, 0x09CDC419, 0x09BC0417,
+    0x09C50417, 0x09A64417, 0x09C30417, 0x09A64417, 0x09C50417, 0x09B6C419, 0x09C50419, 0x09CDC419,
+    0x09BD8419, 0x09C50419, 0x09CDC419, 0x09C60417, 0x09A3C417, 0x09A64417, 0x09C50419, 0x09A68419,
+    0x09CDC419, 0x09C30417, 0x09A3C417, 0x09C50417, 0x09BD8419, 0x09C50419, 0x09C50419, 0x09C30419,
+    0x09A3C419, 0x09C50419, 0x09C60419, 0x09A3C419, 0x09A64419, 0x09A3C419, 0x09A64419, 0x09CDC419,
+    0x09A64419, 0x09A3C419, 0x09CDC419, 0x09C50419, 0x09A3C419, 0x09CDC419, 0x09B90419, 0x09C50419,
+    0x09CDC419, 0x099D0419, 0x09A64419, 0x09CDC419, 0x09BD8417, 0x09C50417, 0x09C50417, 0x09B6C417,
+    0x09A3C417, 0x09C50417, 0x09B44417, 0x09C50417, 0x09C50417, 0x09B18419, 0x09A68419, 0x09CDC419,
+    0x09C60419, 0x09A3C419, 0x09CDC419, 0x09B4441A, 0x09C3041A, 0x09D1441A, 0x09BC041A, 0x09C3041A,
+    0x09D1441A, 0x099C841A, 0x09C3041A, 0x09C3041A, 0x09C8841A, 0x099C841A, 0x09BD841A, 0x099D041A,
+    0x09ACC41A, 0x09C5041A, 0x09A6441A, 0x09C5041A, 0x09A9041A, 0x09B4441A, 0x09C3041A, 0x09B6C41A,
+    0x09C5041A, 0x09ACC41A, 0x09B1841A, 0x09CA041A, 0x09C3041A, 0x09B6C41A, 0x09C3041A, 0x09CDC41A,
+    0x09C8841A, 0x09CA041A, 0x09B1841A, 0x09C3041A, 0x09C5041A, 0x09B4441A, 0x09C3041A, 0x09CD841A,
+    0x09B4441A, 0x09C3041A, 0x09CD841A, 0x0082441A, 0x099C841A, 0x09C3041A, 0x09C3041A, 0x09C8841A,
+    0x0082441A, 0x09B6C41A, 0x09C3041A, 0x09CDC41A, 0x09C8841A, 0x0082441A, 0x09CA041A, 0x09B1841A,
+    0x09C3041A, 0x09C5041A, 0x09A3C41A, 0x09C3041A, 0x0082441A, 0x09A3C41A, 0x09C3041A, 0x099C841A,
+    0x09C3041A, 0x09C8841A, 0x09ACC41A, 0x09CE041A, 0x099C841A, 0x09C3041A, 0x009F8416, 0x009F8416,
+    0x009F8416, 0x009F8416, 0x009F8416, 0x09C3041A, 0x0999441A, 0x09C30419, 0x09994419, 0x09C3041A,
+    0x0999841A, 0x09C30419, 0x09998419, 0x09C3041A, 0x099A841A, 0x09C30419, 0x099A8419, 0x09C3041A,
+    0x099C841A, 0x09C30419, 0x099C8419, 0x16758404, 0x00002304, 0x1675C404, 0x00002304, 0x16760404,
+    0x00002304, 0x16764404, 0x00002304, 0x16768404, 0x00002304, 0x1676C404, 0x00002304, 0x16770404,
+    0x00002304, 0x16770404, 0x00002324, 0x16774404, 0x00002304, 0x16778404, 0x00002304, 0x1677C404,
+    0x00002304, 0x1677C404, 0x00002324, 0x16780404, 0x00002304, 0x16780404, 0x00002324, 0x16784404,
+    0x00002304, 0x16784404, 0x00002324, 0x16788404, 0x00002304, 0x1678C404, 0x00002304, 0x16790404,
+    0x00002304, 0x16794404, 0x00002324, 0x16794404, 0x00002344, 0x16798404, 0x00002304, 0x1679C404,
+    0x00002304, 0x167A0404, 0x00002304, 0x167A4404, 0x00002304, 0x167A4404, 0x00002324, 0x167A8404,
+    0x00002304, 0x167A8404, 0x00002324, 0x167AC404, 0x00002304, 0x167B0404, 0x00002304, 0x16794404,
+    0x00002304, 0x141E4404, 0x00002324, 0x13F08404, 0x00002304, 0x0F230404, 0x00002304, 0x0F238404,
+    0x00002304, 0x0F244404, 0x00002304, 0x0F248404, 0x00002304, 0x0F24C404, 0x00002304, 0x0F250404,
+    0x00002304, 0x0F254404, 0x00002304, 0x0F258404, 0x00002304, 0x0F260404, 0x00002304, 0x0F264404,
+    0x00002304, 0x0F268404, 0x00002304, 0x0F26C404, 0x00002304, 0x0F270404, 0x00002304, 0x0F274404,
+    0x00002304, 0x0F288404, 0x00002304, 0x0F28C404, 0x00002304, 0x0F290404, 0x00002304, 0x0F294404,
+    0x00002304, 0x0F29C404, 0x00002304, 0x0F2AC404, 0x00002304, 0x0F2B0404, 0x00002304, 0x0F2B4404,
+    0x00002304, 0x0F2B8404, 0x00002304, 0x0F2BC404, 0x00002304, 0x0F2CC404, 0x00002304, 0x0F2D0404,
+    0x00002304, 0x0F2D4404, 0x00002304, 0x0F2D8404, 0x00002304, 0x0F18C40A, 0x00002304, 0x0F1AC40A,
+    0x00002304, 0x0F1AC40A, 0x00002324, 0x0F1C040A, 0x00002304, 0x0F1E840A, 0x00002304, 0x0F1EC40A,
+    0x00002304, 0x0F1EC40A, 0x00002324, 0x0F1F840A, 0x00002304, 0x0F21440A, 0x00002304, 0x0F21840A,
+    0x00002304, 0x0F18C404, 0x00002304, 0x0F1AC404, 0x00002304, 0x0F1AC404, 0x00002324, 0x0F1C0404,
+    0x00002304, 0x0F1E8404, 0x00002304, 0x0F1EC404, 0x00002304, 0x0F1EC404, 0x00002324, 0x0F1F8404,
+    0x00002304, 0x0F214404, 0x00002304, 0x0F218404, 0x00002304, 0x14284404, 0x00002324, 0x1428C404,
+    0x00002324, 0x14294404, 0x00002324, 0x142A0404, 0x00002324, 0x1428C404, 0x14298404, 0x142E8404,
+    0x00002324, 0x14188404, 0x14194404, 0x0B574402, 0x00001842, 0x0B578402, 0x00001842, 0x0B59C402,
+    0x00001842, 0x0BD24404, 0x00002304, 0x0BD24404, 0x00002324, 0x0BD28404, 0x00002304, 0x0BD2C404,
+    0x00002304, 0x0BDE4404, 0x00002304, 0x0BDE8404, 0x00002304, 0x0C2A4404, 0x00002304, 0x0C2E4404,
+    0x00002304, 0x0C2B0404, 0x00002304, 0x07E64404, 0x00002304, 0x07E68404, 0x00002304, 0x07E6C402,
+    0x00002302, 0x049C8402, 0x00000000, 0x049CC402, 0x00000000, 0x049CC402, 0x00000000, 0x00000000,
+    0x04A9C402, 0x00000000, 0x04AA0402, 0x00000000, 0x04A9C402, 0x00000000, 0x00000000, 0x04AA0402,
+    0x00000000, 0x00000000, 0x07E6C404, 0x00002304, 0x07E70404, 0x00002304, 0x07E74404, 0x00002304,
+    0x07E78404, 0x00002304, 0x07E7C404, 0x00002304, 0x07E80404, 0x00002304, 0x07E84404, 0x00002304,
+    0x07E60404, 0x009F8404, 0x07E60404, 0x0088C404, 0x07E64404, 0x0088C404, 0x07E68404, 0x0088C404,
+    0x07E6C404, 0x0088C404, 0x07E70404, 0x0088C404, 0x07E74404, 0x0088C404, 0x07E78404, 0x0088C404,
+    0x07E7C404, 0x0088C404, 0x07E80404, 0x0088C404, 0x07E84404, 0x0088C404, 0x00CA0404, 0x07E8840A,
+    0x00CA4404, 0x00CA0404, 0x07EF040A, 0x00CA4404, 0x00CA0404, 0x07F5840A, 0x00CA4404, 0x00CA0404,
+    0x07FAC40A, 0x00CA4404, 0x00CA0404, 0x0801C40A, 0x00CA4404, 0x00CA0404, 0x0810840A, 0x00CA4404,
+    0x00CA0404, 0x0814440A, 0x00CA4404, 0x00CA0404, 0x081D440A, 0x00CA4404, 0x00CA0404, 0x0824040A,
+    0x00CA4404, 0x00CA0404, 0x082AC40A, 0x00CA4404, 0x00CA0404, 0x0831040A, 0x00CA4404, 0x00CA0404,
+    0x0835840A, 0x00CA4404, 0x00CA0404, 0x0842440A, 0x00CA4404, 0x00CA0404, 0x0846040A, 0x00CA4404,
+    0x00CA0404, 0x084F040A, 0x00CA4404, 0x00CA0404, 0x085AC40A, 0x00CA4404, 0x00CA0404, 0x0860040A,
+    0x00CA4404, 0x00CA0404, 0x0864C40A, 0x00CA4404, 0x00CA0404, 0x0874840A, 0x00CA4404, 0x00CA0404,
+    0x087DC40A, 0x00CA4404, 0x00CA0404, 0x0885C40A, 0x00CA4404, 0x00CA0404, 0x0891C40A, 0x00CA4404,
+    0x00CA0404, 0x0896440A, 0x00CA4404, 0x00CA0404, 0x0899040A, 0x00CA4404, 0x00CA0404, 0x089C040A,
+    0x00CA4404, 0x00CA0404, 0x08A1840A, 0x00CA4404, 0x00E28404, 0x0874840A, 0x00E2C404, 0x07F5840C,
+    0x07FAC40C, 0x0896440C, 0x08A1840C, 0x081D441D, 0x0891C41D, 0x0874841D, 0x07FAC41D, 0x0874841D,
+    0x0874841D, 0x085AC41D, 0x085AC41D, 0x0891C41D, 0x0896441D, 0x07F5841D, 0x08424414, 0x07F58414,
+    0x08424414, 0x07FAC414, 0x08424414, 0x0864C414, 0x0824041D, 0x07F5841D, 0x085AC41D, 0x07E8841D,
+    0x0874841D, 0x07E8841D, 0x07E8841D, 0x07EF041D, 0x07FAC41D, 0x082AC41D, 0x07F5841D, 0x0835841D,
+    0x07F5841D, 0x084F041D, 0x084F041D, 0x0835841D, 0x0810841D, 0x0864C41D, 0x0801C41D, 0x0801C41D,
+    0x0824041D, 0x07FAC41D, 0x0846041D, 0x0801C41D, 0x0896441D, 0x0846041D, 0x0814441D, 0x084F041D,
+    0x0831041D, 0x0874841D, 0x084F041D, 0x0874841D, 0x0885C41D, 0x085AC41D, 0x0099C41C, 0x0891C41D,
+    0x0874841D, 0x07E6C41C, 0x07FAC41D, 0x07E6841C, 0x0846041C, 0x07FAC41C, 0x0082441C, 0x0874841D,
+    0x07F5841C, 0x0864C41C, 0x07E6841C, 0x0831041D, 0x07E7041C, 0x0831041D, 0x07E8041C, 0x0831041D,
+    0x07E7441C, 0x009F841C, 0x07E6441C, 0x07E7C41C, 0x009F841C, 0x07E6441C, 0x07E6841C, 0x07E6841C,
+    0x009F841C, 0x07E6841C, 0x07E7841C, 0x07E6041C, 0x085AC41D, 0x07E6441C, 0x07E6841C, 0x07E6041C,
+    0x085AC41D, 0x081D441D, 0x07F5841C, 0x081D441D, 0x07FAC41C, 0x0864C41D, 0x081D441D, 0x0824041C,
+    0x0082441C, 0x0864C41D, 0x0801C41C, 0x0874841C, 0x0835841D, 0x084F041C, 0x0874841C, 0x0874841C,
+    0x0835841C, 0x0801C41C, 0x0874841C, 0x0874841C, 0x0874841D, 0x081D441D, 0x0891C41D, 0x0885C41D,
+    0x081D441D, 0x07FAC41D, 0x0891C41D, 0x084F041D, 0x07FAC41D, 0x10BE041C, 0x10B8041C, 0x10B9041C,
+    0x10B9041C, 0x3ED0041C, 0x3892C000, 0x3ED0041C, 0x36D5C000, 0x3ED0041C, 0x34F30000, 0x10BB441C,
+    0x000006FC, 0x3ED0041C, 0x33A30000, 0x3ED0041C, 0x36468000, 0x3ED0441C, 0x2278C000, 0x3ED0041C,
+    0x364A4000, 0x3ED0041C, 0x33A90000, 0x3ED0041C, 0x39880000, 0x3ED0041C, 0x3C484000, 0x3ED0041C,
+    0x39664000, 0x3ED0041C, 0x34934000, 0x3ED0041C, 0x37E30000, 0x3ED0041C, 0x34634000, 0x3ED0041C,
+    0x396C0000, 0x3ED0041C, 0x34874000, 0x3ED0041C, 0x3F508000, 0x3ED0041C, 0x3D47C000, 0x3ED0441C,
+    0x232A4000, 0x3ED0041C, 0x363C0000, 0x3ED0041C, 0x350E4000, 0x3ED0041C, 0x3BC50000, 0x3ED0041C,
+    0x38A54000, 0x3ED0041C, 0x38D54000, 0x3ED0041C, 0x33800000, 0x3ED0041C, 0x33824000, 0x3ED0441C,
+    0x24128000, 0x3ED0041C, 0x37798000, 0x3ED0041C, 0x338B4000, 0x3ED0041C, 0x34FCC000, 0x3ED0041C,
+    0x38C1C000, 0x3ED0441C, 0x235C0000, 0x3ED0041C, 0x3894C000, 0x3ED0041C, 0x3E604000, 0x3ED0041C,
+    0x3E9E8000, 0x3ED0041C, 0x35020000, 0x3ED0041C, 0x3BA00000, 0x3ED0041C, 0x39C24000, 0x3ED0041C,
+    0x39C20000, 0x3ED0041C, 0x3D4CC000, 0x3ED0041C, 0x349C8000, 0x3ED0041C, 0x356D8000, 0x3ED0441C,
+    0x24534000, 0x00E28404, 0x3ED00404, 0x39CB0000, 0x00E2C404, 0x00E28404, 0x3ED00404, 0x33824000,
+    0x00E2C404, 0x00E28404, 0x3ED00404, 0x33A30000, 0x00E2C404, 0x00E28404, 0x3ED00404, 0x36E24000,
+    0x00E2C404, 0x00E28404, 0x3ED00404, 0x3C2E4000, 0x00E2C404, 0x00E28404, 0x3ED00404, 0x3894C000,
+    0x00E2C404, 0x00E28404, 0x3ED00404, 0x3DB5C000, 0x00E2C404, 0x00E28404, 0x3ED00404, 0x34B74000,
+    0x00E2C404, 0x00E28404, 0x3ED00404, 0x3955C000, 0x00E2C404, 0x3ED00406, 0x37E5C000, 0x3ED00406,
+    0x34FBC000, 0x3ED00402, 0x338F4000, 0x3ED00402, 0x338E0000, 0x3ED00402, 0x33904000, 0x3EE10402,
+    0x20488000, 0x3ED00402, 0x33D80000, 0x3ED00402, 0x33EEC000, 0x3ED00402, 0x34008000, 0x3ED00402,
+    0x341E8000, 0x3ED00402, 0x34264000, 0x3ED00402, 0x3433C000, 0x3EE00402, 0x2D278000, 0x3EE10402,
+    0x218E8000, 0x3ED00402, 0x34550000, 0x3ED00402, 0x34590000, 0x3ED00402, 0x345DC000, 0x3EE10402,
+    0x21470000, 0x3EE00402, 0x2D2E4000, 0x3ED00402, 0x3459C000, 0x3ED00402, 0x34634000, 0x3EE10402,
+    0x2152C000, 0x3ED00402, 0x3465C000, 0x3ED00402, 0x34690000, 0x3ED00402, 0x33B30000, 0x3ED00402,
+    0x346B0000, 0x3EE14402, 0x2477C000, 0x3ED00402, 0x347D4000, 0x3ED00402, 0x3480C000, 0x3EE00402,
+    0x2D37C000, 0x3ED00402, 0x348EC000, 0x3ED00402, 0x34918000, 0x3ED00402, 0x349C8000, 0x3ED00402,
+    0x349DC000, 0x3EE00402, 0x2D454000, 0x3ED00402, 0x34C14000, 0x3ED00402, 0x34C18000, 0x3ED00402,
+    0x34D24000, 0x3ED00402, 0x34D68000, 0x3ED00402, 0x34DCC000, 0x3ED00402, 0x34DF4000, 0x3ED00402,
+    0x34DFC000, 0x3EE10402, 0x228B0000, 0x3ED00402, 0x3C1C0000, 0x3ED00402, 0x34F28000, 0x3ED00402,
+    0x34F7C000, 0x3EE10402, 0x22D8C000, 0x3ED00402, 0x34FAC000, 0x3ED00402, 0x34FC4000, 0x3ED00402,
+    0x35018000, 0x3ED00402, 0x35278000, 0x3ED00402, 0x350E0000, 0x3ED00402, 0x35120000, 0x3ED00402,
+    0x351A0000, 0x3ED00402, 0x35288000, 0x3ED00402, 0x353D8000, 0x3ED00402, 0x35440000, 0x3ED00402,
+    0x3554C000, 0x3ED00402, 0x3558C000, 0x3ED00402, 0x35610000, 0x3ED00402, 0x356AC000, 0x3ED00402,
+    0x356CC000, 0x3ED00402, 0x35708000, 0x3ED00402, 0x35C58000, 0x3ED00402, 0x35C5C000, 0x3ED00402,
+    0x35944000, 0x3ED00402, 0x359D0000, 0x3ED00402, 0x363B8000, 0x3ED00402, 0x35F38000, 0x3ED00402,
+    0x35FD0000, 0x3ED00402, 0x36034000, 0x3ED00402, 0x35E2C000, 0x3ED00402, 0x360C8000, 0x3ED00402,
+    0x360C4000, 0x3ED00402, 0x362B0000, 0x3EE10402, 0x25390000, 0x3ED00402, 0x363C8000, 0x3ED00402,
+    0x363DC000, 0x3ED00402, 0x36418000, 0x3ED00402, 0x36468000, 0x3ED00402, 0x36488000, 0x3ED00402,
+    0x36588000, 0x3EE10402, 0x25AA0000, 0x3EE10402, 0x25BA8000, 0x3ED00402, 0x367B0000, 0x3ED00402,
+    0x3686C000, 0x3ED00402, 0x3689C000, 0x3ED00402, 0x36760000, 0x3ED00402, 0x36998000, 0x3EE00402,
+    0x2DBB8000, 0x3EE00402, 0x2DBF0000, 0x3ED00402, 0x36C20000, 0x3ED00402, 0x36CF8000, 0x3EE10402,
+    0x26720000, 0x3ED00402, 0x36F0C000, 0x3ED00402, 0x36F60000, 0x3ED00402, 0x36FCC000, 0x3EE10402,
+    0x26C60000, 0x3ED00402, 0x36FFC000, 0x3ED00402, 0x37018000, 0x3ED00402, 0x37D4C000, 0x3ED00402,
+    0x37088000, 0x3EE00402, 0x2DE04000, 0x3ED00402, 0x37180000, 0x3ED00402, 0x37300000, 0x3ED00402,
+    0x37234000, 0x3EE10402, 0x27790000, 0x3ED00402, 0x3750C000, 0x3EE10402, 0x27798000, 0x3ED00402,
+    0x375B8000, 0x3ED00402, 0x375AC000, 0x3ED00402, 0x375F0000, 0x3ED00402, 0x37784000, 0x3ED00402,
+    0x37788000, 0x3EE00402, 0x2E0BC000, 0x3ED00402, 0x377F4000, 0x3ED00402, 0x378A0000, 0x3ED00402,
+    0x378F4000, 0x3ED00402, 0x379A4000, 0x3EE00402, 0x2E188000, 0x3EE10402, 0x2860C000, 0x3EE00402,
+    0x2E1F0000, 0x3ED00402, 0x37AC0000, 0x3ED00402, 0x37ACC000, 0x3ED00402, 0x37AD8000, 0x3EE14402,
+    0x28E48000, 0x3ED00402, 0x37BF8000, 0x3EE10402, 0x28CC4000, 0x3ED04402, 0x20804000, 0x3ED00402,
+    0x37C88000, 0x3EE00402, 0x2E31C000, 0x3EE10402, 0x2CAE0000, 0x3EE10402, 0x38768000, 0x3ED00402,
+    0x37D88000, 0x3ED00402, 0x37DAC000, 0x3EE00402, 0x2E38C000, 0x3ED00402, 0x37E68000, 0x3ED00402,
+    0x37F34000, 0x3ED00402, 0x37F5C000, 0x3ED00402, 0x37FE4000, 0x3ED00402, 0x38204000, 0x3EE00402,
+    0x2E4E8000, 0x3EE00402, 0x2E470000, 0x3EE10402, 0x29B50000, 0x3ED00402, 0x3831C000, 0x3ED00402,
+    0x38520000, 0x3ED00402, 0x38530000, 0x3ED00402, 0x385E8000, 0x3ED00402, 0x386C8000, 0x3ED00402,
+    0x38690000, 0x3ED00402, 0x386BC000, 0x3ED00402, 0x38778000, 0x3ED00402, 0x38840000, 0x3ED00402,
+    0x3886C000, 0x3ED00402, 0x38974000, 0x3ED00402, 0x38AC4000, 0x3ED00402, 0x38B50000, 0x3ED00402,
+    0x38D40000, 0x3EE10402, 0x2AC30000, 0x3ED00402, 0x38CF4000, 0x3ED00402, 0x38BF0000, 0x3ED00402,
+    0x38DA0000, 0x3ED00402, 0x38E0C000, 0x3ED00402, 0x38F90000, 0x3EE10402, 0x2AFC4000, 0x3ED00402,
+    0x39088000, 0x3ED00402, 0x38F14000, 0x3ED00402, 0x38EA4000, 0x3EE00402, 0x2E8B8000, 0x3ED00402,
+    0x391A4000, 0x3ED00402, 0x391F8000, 0x3ED00402, 0x39274000, 0x3ED00402, 0x391DC000, 0x3EE00402,
+    0x2E9B0000, 0x3ED00402, 0x395B0000, 0x3EE10402, 0x2C028000, 0x3ED00402, 0x3978C000, 0x3ED00402,
+    0x39BE0000, 0x3ED00402, 0x39924000, 0x3EE00402, 0x2EC64000, 0x3EE00402, 0x2EC20000, 0x3EE00402,
+    0x2EB90000, 0x3ED00402, 0x34648000, 0x3ED00402, 0x34654000, 0x3ED00402, 0x39C00000, 0x3ED00402,
+    0x39A70000, 0x3ED04402, 0x202B4000, 0x3EE00402, 0x30F64000, 0x3ED00402, 0x39C84000, 0x3ED00402,
+    0x39D78000, 0x3ED00402, 0x39D4C000, 0x3EE10402, 0x2CF0C000, 0x3EE00402, 0x2ED24000, 0x3ED00402,
+    0x39FE8000, 0x3ED00402, 0x39E14000, 0x3ED00402, 0x3A148000, 0x3EE10402, 0x2D1B4000, 0x3ED00402,
+    0x3A238000, 0x3ED00402, 0x3A07C000, 0x3ED00402, 0x3A450000, 0x3ED00402, 0x3A508000, 0x3ED00402,
+    0x3A68C000, 0x3ED00402, 0x3A7A8000, 0x3ED00402, 0x3AAA0000, 0x3EE10402, 0x2DA8C000, 0x3ED00402,
+    0x3AB6C000, 0x3EE00402, 0x2F060000, 0x3ED00402, 0x3AC84000, 0x3EE10402, 0x2E29C000, 0x3ED00402,
+    0x3AD50000, 0x3EE00402, 0x2F138000, 0x3ED00402, 0x3ADC8000, 0x3ED00402, 0x3AE7C000, 0x3ED00402,
+    0x3AEEC000, 0x3EE10402, 0x2EA34000, 0x3EE10402, 0x2742C000, 0x3EE10402, 0x2EBE8000, 0x3ED00402,
+    0x3B138000, 0x3EE10402, 0x2F2F0000, 0x3ED00402, 0x3B2FC000, 0x3ED00402, 0x3B334000, 0x3ED00402,
+    0x3B19C000, 0x3ED00402, 0x3B458000, 0x3ED00402, 0x3B4F8000, 0x3ED00402, 0x3B5A4000, 0x3ED00402,
+    0x3B5E0000, 0x3ED00402, 0x3B614000, 0x3EE10402, 0x2F478000, 0x3ED00402, 0x3B4D0000, 0x3ED00402,
+    0x3B8BC000, 0x3ED00402, 0x3B9B8000, 0x3EE00402, 0x2F4CC000, 0x3ED00402, 0x3BB1C000, 0x3EE10402,
+    0x2FB44000, 0x3ED00402, 0x3B7E4000, 0x3ED00402, 0x3BDB8000, 0x3EE10402, 0x2FD78000, 0x3EE10402,
+    0x2FE38000, 0x3ED00402, 0x3BF18000, 0x3ED00402, 0x3C0E4000, 0x3ED00402, 0x3C06C000, 0x3EE00402,
+    0x2F658000, 0x3ED00402, 0x3C128000, 0x3ED00402, 0x3C1F4000, 0x3ED00402, 0x3C1DC000, 0x3ED00402,
+    0x3C2B4000, 0x3EE10402, 0x21494000, 0x3ED00402, 0x3C514000, 0x3EE10402, 0x3098C000, 0x3ED00402,
+    0x3C670000, 0x3EE10402, 0x30EAC000, 0x3ED00402, 0x3C8A0000, 0x3ED00402, 0x3C940000, 0x3EE10402,
+    0x31820000, 0x3ED00402, 0x3CA00000, 0x3ED00402, 0x3CA54000, 0x3EE10402, 0x31CD4000, 0x3EE10402,
+    0x32050000, 0x3ED00402, 0x3CDE8000, 0x3ED00402, 0x3CE2C000, 0x3EE00402, 0x2FAB0000, 0x3ED00402,
+    0x3CE94000, 0x3EE00402, 0x2FAE0000, 0x3ED00402, 0x3D11C000, 0x3ED00402, 0x3D170000, 0x3ED00402,
+    0x3D214000, 0x3ED00402, 0x3D328000, 0x3EE00402, 0x2FC6C000, 0x3ED00402, 0x3D490000, 0x3EE10402,
+    0x330D8000, 0x3ED00402, 0x3D4F8000, 0x3EE10402, 0x33248000, 0x3EE10402, 0x2867C000, 0x3ED00402,
+    0x3D840000, 0x3EE10402, 0x33E84000, 0x3EE10402, 0x33EE0000, 0x3EE10402, 0x34110000, 0x3EE00402,
+    0x2FFF0000, 0x3EE00402, 0x30020000, 0x3EE10402, 0x343CC000, 0x3EE10402, 0x343C8000, 0x3EE10402,
+    0x34464000, 0x3EE10402, 0x344CC000, 0x3ED00402, 0x3DC78000, 0x3ED00402, 0x3DC7C000, 0x3ED00402,
+    0x3DE2C000, 0x3EE00402, 0x30118000, 0x3EE00402, 0x30258000, 0x3EE10402, 0x35074000, 0x3ED00402,
+    0x3E138000, 0x3EE00402, 0x3038C000, 0x3EE10402, 0x35898000, 0x3EE10402, 0x35A68000, 0x3EE10402,
+    0x35B14000, 0x3ED00402, 0x3E7AC000, 0x3EE00402, 0x304BC000, 0x3ED00402, 0x3E928000, 0x3ED00402,
+    0x3E93C000, 0x3EE10402, 0x365F0000, 0x3EE10402, 0x36A9C000, 0x3ED00402, 0x3EBB8000, 0x3EE00402,
+    0x30808000, 0x3EE10402, 0x36EAC000, 0x3ED00402, 0x3EF18000, 0x3ED00402, 0x3EF24000, 0x3EE00402,
+    0x3089C000, 0x3EE10402, 0x37200000, 0x3ED00402, 0x3F348000, 0x3EE00402, 0x30A80000, 0x3ED00402,
+    0x3F3A0000, 0x3ED00402, 0x3F38C000, 0x3ED00402, 0x3F400000, 0x3EE10402, 0x37E18000, 0x3ED00402,
+    0x3F58C000, 0x3EE00402, 0x30C04000, 0x3ED00402, 0x3F71C000, 0x3ED00402, 0x3F808000, 0x3ED00402,
+    0x3F914000, 0x3EE00402, 0x30CD0000, 0x3EE10402, 0x388A0000, 0x3EE10402, 0x3891C000, 0x3EE00402,
+    0x30D64000, 0x3EE10402, 0x38B64000, 0x3ED00402, 0x3FDE8000, 0x3EE10402, 0x38CF8000, 0x3ED00402,
+    0x3FE54000, 0x3ED00402, 0x3FFE8000, 0x3EE10402, 0x39368000, 0x3EE10402, 0x3948C000, 0x3ED04402,
+    0x20180000, 0x3EE10402, 0x396A0000, 0x3ED04402, 0x201C0000, 0x3EE10402, 0x2CD7C000, 0x3EE00402,
+    0x30F54000, 0x3ED04402, 0x202C8000, 0x3ED04402, 0x2040C000, 0x3EE00402, 0x3102C000, 0x3ED04402,
+    0x204F8000, 0x3ED00402, 0x36AD4000, 0x3EE10402, 0x39E9C000, 0x3EE10402, 0x39ED4000, 0x3EE10402,
+    0x2CE4C000, 0x3EE10402, 0x2CE70000, 0x3ED04402, 0x20810000, 0x3ED04402, 0x23E78000, 0x3EE00402,
+    0x311AC000, 0x3ED04402, 0x20A44000, 0x3ED04402, 0x20A2C000, 0x3ED04402, 0x20A74000, 0x3ED00402,
+    0x34ACC000, 0x3ED04402, 0x20AC4000, 0x3ED04402, 0x20ACC000, 0x3ED04402, 0x20AF4000, 0x3ED04402,
+    0x20B98000, 0x3EE10402, 0x3ACF0000, 0x3ED04402, 0x20C74000, 0x3ED04402, 0x20D8C000, 0x3ED04402,
+    0x20EB4000, 0x3ED04402, 0x20C8C000, 0x3ED04402, 0x20EF4000, 0x3ED04402, 0x20F9C000, 0x3ED04402,
+    0x20D4C000, 0x3ED04402, 0x20F28000, 0x3ED04402, 0x20F30000, 0x3ED04402, 0x20F70000, 0x3EE10402,
+    0x3B0D8000, 0x3EE10402, 0x3B5AC000, 0x3EE10402, 0x3B354000, 0x3EE00402, 0x314AC000, 0x3ED04402,
+    0x213C4000, 0x3ED04402, 0x213CC000, 0x3ED04402, 0x21458000, 0x3EE10402, 0x3CF28000, 0x3ED04402,
+    0x21590000, 0x3EE10402, 0x3BCB0000, 0x3EE00402, 0x31574000, 0x3EE00402, 0x31584000, 0x3EE10402,
+    0x3BEC4000, 0x3EE10402, 0x3C348000, 0x3EE00402, 0x315AC000, 0x3ED04402, 0x21940000, 0x3ED04402,
+    0x2199C000, 0x3ED04402, 0x219A4000, 0x3ED04402, 0x21AA4000, 0x3ED04402, 0x21A20000, 0x3ED04402,
+    0x21C38000, 0x3ED04402, 0x21B88000, 0x3ED04402, 0x21CA0000, 0x3ED04402, 0x21DAC000, 0x3ED04402,
+    0x21E18000, 0x3EE00402, 0x3175C000, 0x3ED04402, 0x21F84000, 0x3ED04402, 0x22004000, 0x3EE00402,
+    0x317E4000, 0x3ED04402, 0x22180000, 0x3ED04402, 0x2218C000, 0x3EE10402, 0x3D99C000, 0x3ED04402,
+    0x2235C000, 0x3ED04402, 0x22378000, 0x3EE00402, 0x318D4000, 0x3ED04402, 0x223E8000, 0x3EE00402,
+    0x2D2EC000, 0x3EE10402, 0x3E2B8000, 0x3EE10402, 0x3E598000, 0x3EE00402, 0x31AF8000, 0x3EE00402,
+    0x31B1C000, 0x3ED04402, 0x22A80000, 0x3ED04402, 0x23154000, 0x3EE10402, 0x3F2A0000, 0x3ED04402,
+    0x232AC000, 0x3ED04402, 0x23304000, 0x3ED04402, 0x2346C000, 0x3ED04402, 0x235DC000, 0x3EE10402,
+    0x3FCBC000, 0x3EE10402, 0x22010000, 0x3ED04402, 0x2372C000, 0x3ED04402, 0x236F0000, 0x3ED04402,
+    0x237C0000, 0x3EE10402, 0x22378000, 0x3ED04402, 0x23B50000, 0x3EE14402, 0x21748000, 0x3EE14402,
+    0x217B4000, 0x3ED04402, 0x24250000, 0x3ED04402, 0x243C4000, 0x3ED04402, 0x24444000, 0x3EE14402,
+    0x21CB8000, 0x3ED04402, 0x2446C000, 0x3ED04402, 0x248E0000, 0x3ED04402, 0x24B5C000, 0x3ED04402,
+    0x24B60000, 0x3ED04402, 0x249F0000, 0x3ED04402, 0x24FE4000, 0x3ED04402, 0x25054000, 0x3EE14402,
+    0x22FE8000, 0x3ED04402, 0x2562C000, 0x3EE00402, 0x32654000, 0x3ED04402, 0x256DC000, 0x3EE14402,
+    0x235DC000, 0x3EE00402, 0x32798000, 0x3ED04402, 0x25B0C000, 0x3ED00402, 0x376C8000, 0x3ED04402,
+    0x25C8C000, 0x3EE14402, 0x24514000, 0x3EE14402, 0x24868000, 0x3EE00402, 0x329B8000, 0x3EE00402,
+    0x329D8000, 0x3ED04402, 0x25F80000, 0x3EE14402, 0x25028000, 0x3EE00402, 0x32AC8000, 0x3EE14402,
+    0x25258000, 0x3ED04402, 0x260A4000, 0x3EE14402, 0x256D8000, 0x3ED04402, 0x26388000, 0x3EE00402,
+    0x32CCC000, 0x3ED04402, 0x264A4000, 0x3ED04402, 0x2669C000, 0x3ED04402, 0x26708000, 0x3ED04402,
+    0x267F8000, 0x3EE00402, 0x32F38000, 0x3EE14402, 0x26CC0000, 0x3ED04402, 0x27100000, 0x3ED04402,
+    0x273F4000, 0x3EE00402, 0x33338000, 0x3EE00402, 0x333B4000, 0x3ED04402, 0x2759C000, 0x3EE14402,
+    0x28338000, 0x3EE00402, 0x333E0000, 0x3EE14402, 0x28414000, 0x3EE14402, 0x28838000, 0x3EE14402,
+    0x28A44000, 0x3ED04402, 0x27AEC000, 0x3EE00402, 0x33558000, 0x3ED04402, 0x27BE4000, 0x3ED04402,
+    0x27BF8000, 0x3ED04402, 0x27C14000, 0x3ED04402, 0x27C3C000, 0x3ED04402, 0x27C58000, 0x3ED04402,
+    0x27CEC000, 0x3EE14402, 0x29800000
+};
+
+static const uint32 collationContractions[3006] =
+{
+    0x000000B7, 0x00000000, 0x80000002, 0x00000387, 0x00000000, 0x80000002, 0x00000000, 0x00000000,
+    0x48358408, 0x000000B7, 0x00000000, 0x80000042, 0x00000387, 0x00000000, 0x80000042, 0x00000000,
+    0x00000000, 0x48358402, 0x00000306, 0x00000000, 0x48FC8408, 0x00000000, 0x00000000, 0x48F94408,
+    0x00000306, 0x00000000, 0x48FC8402, 0x00000000, 0x00000000, 0x48F94402, 0x00000653, 0x00000000,
+    0x49994402, 0x00000654, 0x00000000, 0x49998402, 0x00000655, 0x00000000, 0x499A8402, 0x00000000,
+    0x00000000, 0x499C8402, 0x00000654, 0x00000000, 0x499A4402, 0x00000000, 0x00000000, 0x49CA0402,
+    0x00000654, 0x00000000, 0x499B8402, 0x00000000, 0x00000000, 0x49CDC402, 0x000009BE, 0x00000000,
+    0x4A9E8402, 0x000009D7, 0x00000000, 0x4A9EC402, 0x00000000, 0x00000000, 0x4A9E0402, 0x00000B3E,
+    0x00000000, 0x4ACEC402, 0x00000B56, 0x00000000, 0x4ACE8402, 0x00000B57, 0x00000000, 0x4ACF0402,
+    0x00000000, 0x00000000, 0x4ACE4402, 0x00000BD7, 0x00000000, 0x4AD30402, 0x00000000, 0x00000000,
+    0x4AD28402, 0x00000BBE, 0x00000000, 0x4ADB4402, 0x00000BD7, 0x00000000, 0x4ADBC402, 0x00000000,
+    0x00000000, 0x4ADA8402, 0x00000BBE, 0x00000000, 0x4ADB8402, 0x00000000, 0x00000000, 0x4ADAC402,
+    0x00000C56, 0x00000000, 0x4AED4402, 0x00000000, 0x00000000, 0x4AECC402, 0x00000CD5, 0x00000000,
+    0x4AFD8402, 0x00000000, 0x00000000, 0x4AFD4402, 0x00000CC2, 0x00000CD5, 0x4B004402, 0x00000CC2,
+    0x00000000, 0x4B000402, 0x00000CD5, 0x00000000, 0x4AFF8402, 0x00000CD6, 0x00000000, 0x4AFFC402,
+    0x00000000, 0x00000000, 0x4AFF4402, 0x00000CD5, 0x00000000, 0x4B004402, 0x00000000, 0x00000000,
+    0x4B000402, 0x00000D3E, 0x00000000, 0x4B12C402, 0x00000D57, 0x00000000, 0x4B134402, 0x00000000,
+    0x00000000, 0x4B120402, 0x00000D3E, 0x00000000, 0x4B130402, 0x00000000, 0x00000000, 0x4B124402,
+    0x00000DCF, 0x00000DCA, 0x4B268402, 0x00000DCA, 0x00000000, 0x4B25C402, 0x00000DCF, 0x00000000,
+    0x4B264402, 0x00000DDF, 0x00000000, 0x4B26C402, 0x00000000, 0x00000000, 0x4B258402, 0x00000DCA,
+    0x00000000, 0x4B268402, 0x00000000, 0x00000000, 0x4B264402, 0x00000E01, 0x00000000, 0x80000082,
+    0x00000E02, 0x00000000, 0x800000C2, 0x00000E03, 0x00000000, 0x80000102, 0x00000E04, 0x00000000,
+    0x80000142, 0x00000E05, 0x00000000, 0x80000182, 0x00000E06, 0x00000000, 0x800001C2, 0x00000E07,
+    0x00000000, 0x80000202, 0x00000E08, 0x00000000, 0x80000242, 0x00000E09, 0x00000000, 0x80000282,
+    0x00000E0A, 0x00000000, 0x800002C2, 0x00000E0B, 0x00000000, 0x80000302, 0x00000E0C, 0x00000000,
+    0x80000342, 0x00000E0D, 0x00000000, 0x80000382, 0x00000E0E, 0x00000000, 0x800003C2, 0x00000E0F,
+    0x00000000, 0x80000402, 0x00000E10, 0x00000000, 0x80000442, 0x00000E11, 0x00000000, 0x80000482,
+    0x00000E12, 0x00000000, 0x800004C2, 0x00000E13, 0x00000000, 0x80000502, 0x00000E14, 0x00000000,
+    0x80000542, 0x00000E15, 0x00000000, 0x80000582, 0x00000E16, 0x00000000, 0x800005C2, 0x00000E17,
+    0x00000000, 0x80000602, 0x00000E18, 0x00000000, 0x80000642, 0x00000E19, 0x00000000, 0x80000682,
+    0x00000E1A, 0x00000000, 0x800006C2, 0x00000E1B, 0x00000000, 0x80000702, 0x00000E1C, 0x00000000,
+    0x80000742, 0x00000E1D, 0x00000000, 0x80000782, 0x00000E1E, 0x00000000, 0x800007C2, 0x00000E1F,
+    0x00000000, 0x80000802, 0x00000E20, 0x00000000, 0x80000842, 0x00000E21, 0x00000000, 0x80000882,
+    0x00000E22, 0x00000000, 0x800008C2, 0x00000E23, 0x00000000, 0x80000902, 0x00000E24, 0x00000000,
+    0x80000942, 0x00000E25, 0x00000000, 0x80000982, 0x00000E26, 0x00000000, 0x800009C2, 0x00000E27,
+    0x00000000, 0x80000A02, 0x00000E28, 0x00000000, 0x80000A42, 0x00000E29, 0x00000000, 0x80000A82,
+    0x00000E2A, 0x00000000, 0x80000AC2, 0x00000E2B, 0x00000000, 0x80000B02, 0x00000E2C, 0x00000000,
+    0x80000B42, 0x00000E2D, 0x00000000, 0x80000B82, 0x00000E2E, 0x00000000, 0x80000BC2, 0x00000000,
+    0x00000000, 0x4C944402, 0x00000E01, 0x00000000, 0x80000C02, 0x00000E02, 0x00000000, 0x80000C42,
+    0x00000E03, 0x00000000, 0x80000C82, 0x00000E04, 0x00000000, 0x80000CC2, 0x00000E05, 0x00000000,
+    0x80000D02, 0x00000E06, 0x00000000, 0x80000D42, 0x00000E07, 0x00000000, 0x80000D82, 0x00000E08,
+    0x00000000, 0x80000DC2, 0x00000E09, 0x00000000, 0x80000E02, 0x00000E0A, 0x00000000, 0x80000E42,
+    0x00000E0B, 0x00000000, 0x80000E82, 0x00000E0C, 0x00000000, 0x80000EC2, 0x00000E0D, 0x00000000,
+    0x80000F02, 0x00000E0E, 0x00000000, 0x80000F42, 0x00000E0F, 0x00000000, 0x80000F82, 0x00000E10,
+    0x00000000, 0x80000FC2, 0x00000E11, 0x00000000, 0x80001002, 0x00000E12, 0x00000000, 0x80001042,
+    0x00000E13, 0x00000000, 0x80001082, 0x00000E14, 0x00000000, 0x800010C2, 0x00000E15, 0x00000000,
+    0x80001102, 0x00000E16, 0x00000000, 0x80001142, 0x00000E17, 0x00000000, 0x80001182, 0x00000E18,
+    0x00000000, 0x800011C2, 0x00000E19, 0x00000000, 0x80001202, 0x00000E1A, 0x00000000, 0x80001242,
+    0x00000E1B, 0x00000000, 0x80001282, 0x00000E1C, 0x00000000, 0x800012C2, 0x00000E1D, 0x00000000,
+    0x80001302, 0x00000E1E, 0x00000000, 0x80001342, 0x00000E1F, 0x00000000, 0x80001382, 0x00000E20,
+    0x00000000, 0x800013C2, 0x00000E21, 0x00000000, 0x80001402, 0x00000E22, 0x00000000, 0x80001442,
+    0x00000E23, 0x00000000, 0x80001482, 0x00000E24, 0x00000000, 0x800014C2, 0x00000E25, 0x00000000,
+    0x80001502, 0x00000E26, 0x00000000, 0x80001542, 0x00000E27, 0x00000000, 0x80001582, 0x00000E28,
+    0x00000000, 0x800015C2, 0x00000E29, 0x00000000, 0x80001602, 0x00000E2A, 0x00000000, 0x80001642,
+    0x00000E2B, 0x00000000, 0x80001682, 0x00000E2C, 0x00000000, 0x800016C2, 0x00000E2D, 0x00000000,
+    0x80001702, 0x00000E2E, 0x00000000, 0x80001742, 0x00000000, 0x00000000, 0x4C948402, 0x00000E01,
+    0x00000000, 0x80001782, 0x00000E02, 0x00000000, 0x800017C2, 0x00000E03, 0x00000000, 0x80001802,
+    0x00000E04, 0x00000000, 0x80001842, 0x00000E05, 0x00000000, 0x80001882, 0x00000E06, 0x00000000,
+    0x800018C2, 0x00000E07, 0x00000000, 0x80001902, 0x00000E08, 0x00000000, 0x80001942, 0x00000E09,
+    0x00000000, 0x80001982, 0x00000E0A, 0x00000000, 0x800019C2, 0x00000E0B, 0x00000000, 0x80001A02,
+    0x00000E0C, 0x00000000, 0x80001A42, 0x00000E0D, 0x00000000, 0x80001A82, 0x00000E0E, 0x00000000,
+    0x80001AC2, 0x00000E0F, 0x00000000, 0x80001B02, 0x00000E10, 0x00000000, 0x80001B42, 0x00000E11,
+    0x00000000, 0x80001B82, 0x00000E12, 0x00000000, 0x80001BC2, 0x00000E13, 0x00000000, 0x80001C02,
+    0x00000E14, 0x00000000, 0x80001C42, 0x00000E15, 0x00000000, 0x80001C82, 0x00000E16, 0x00000000,
+    0x80001CC2, 0x00000E17, 0x00000000, 0x80001D02, 0x00000E18, 0x00000000, 0x80001D42, 0x00000E19,
+    0x00000000, 0x80001D82, 0x00000E1A, 0x00000000, 0x80001DC2, 0x00000E1B, 0x00000000, 0x80001E02,
+    0x00000E1C, 0x00000000, 0x80001E42, 0x00000E1D, 0x00000000, 0x80001E82, 0x00000E1E, 0x00000000,
+    0x80001EC2, 0x00000E1F, 0x00000000, 0x80001F02, 0x00000E20, 0x00000000, 0x80001F42, 0x00000E21,
+    0x00000000, 0x80001F82, 0x00000E22, 0x00000000, 0x80001FC2, 0x00000E23, 0x00000000, 0x80002002,
+    0x00000E24, 0x00000000, 0x80002042, 0x00000E25, 0x00000000, 0x80002082, 0x00000E26, 0x00000000,
+    0x800020C2, 0x00000E27, 0x00000000, 0x80002102, 0x00000E28, 0x00000000, 0x80002142, 0x00000E29,
+    0x00000000, 0x80002182, 0x00000E2A, 0x00000000, 0x800021C2, 0x00000E2B, 0x00000000, 0x80002202,
+    0x00000E2C, 0x00000000, 0x80002242, 0x00000E2D, 0x00000000, 0x80002282, 0x00000E2E, 0x00000000,
+    0x800022C2, 0x00000000, 0x00000000, 0x4C94C402, 0x00000E01, 0x00000000, 0x80002302, 0x00000E02,
+    0x00000000, 0x80002342, 0x00000E03, 0x00000000, 0x80002382, 0x00000E04, 0x00000000, 0x800023C2,
+    0x00000E05, 0x00000000, 0x80002402, 0x00000E06, 0x00000000, 0x80002442, 0x00000E07, 0x00000000,
+    0x80002482, 0x00000E08, 0x00000000, 0x800024C2, 0x00000E09, 0x00000000, 0x80002502, 0x00000E0A,
+    0x00000000, 0x80002542, 0x00000E0B, 0x00000000, 0x80002582, 0x00000E0C, 0x00000000, 0x800025C2,
+    0x00000E0D, 0x00000000, 0x80002602, 0x00000E0E, 0x00000000, 0x80002642, 0x00000E0F, 0x00000000,
+    0x80002682, 0x00000E10, 0x00000000, 0x800026C2, 0x00000E11, 0x00000000, 0x80002702, 0x00000E12,
+    0x00000000, 0x80002742, 0x00000E13, 0x00000000, 0x80002782, 0x00000E14, 0x00000000, 0x800027C2,
+    0x00000E15, 0x00000000, 0x80002802, 0x00000E16, 0x00000000, 0x80002842, 0x00000E17, 0x00000000,
+    0x80002882, 0x00000E18, 0x00000000, 0x800028C2, 0x00000E19, 0x00000000, 0x80002902, 0x00000E1A,
+    0x00000000, 0x80002942, 0x00000E1B, 0x00000000, 0x80002982, 0x00000E1C, 0x00000000, 0x800029C2,
+    0x00000E1D, 0x00000000, 0x80002A02, 0x00000E1E, 0x00000000, 0x80002A42, 0x00000E1F, 0x00000000,
+    0x80002A82, 0x00000E20, 0x00000000, 0x80002AC2, 0x00000E21, 0x00000000, 0x80002B02, 0x00000E22,
+    0x00000000, 0x80002B42, 0x00000E23, 0x00000000, 0x80002B82, 0x00000E24, 0x00000000, 0x80002BC2,
+    0x00000E25, 0x00000000, 0x80002C02, 0x00000E26, 0x00000000, 0x80002C42, 0x00000E27, 0x00000000,
+    0x80002C82, 0x00000E28, 0x00000000, 0x80002CC2, 0x00000E29, 0x00000000, 0x80002D02, 0x00000E2A,
+    0x00000000, 0x80002D42, 0x00000E2B, 0x00000000, 0x80002D82, 0x00000E2C, 0x00000000, 0x80002DC2,
+    0x00000E2D, 0x00000000, 0x80002E02, 0x00000E2E, 0x00000000, 0x80002E42, 0x00000000, 0x00000000,
+    0x4C950402, 0x00000E01, 0x00000000, 0x80002E82, 0x00000E02, 0x00000000, 0x80002EC2, 0x00000E03,
+    0x00000000, 0x80002F02, 0x00000E04, 0x00000000, 0x80002F42, 0x00000E05, 0x00000000, 0x80002F82,
+    0x00000E06, 0x00000000, 0x80002FC2, 0x00000E07, 0x00000000, 0x80003002, 0x00000E08, 0x00000000,
+    0x80003042, 0x00000E09, 0x00000000, 0x80003082, 0x00000E0A, 0x00000000, 0x800030C2, 0x00000E0B,
+    0x00000000, 0x80003102, 0x00000E0C, 0x00000000, 0x80003142, 0x00000E0D, 0x00000000, 0x80003182,
+    0x00000E0E, 0x00000000, 0x800031C2, 0x00000E0F, 0x00000000, 0x80003202, 0x00000E10, 0x00000000,
+    0x80003242, 0x00000E11, 0x00000000, 0x80003282, 0x00000E12, 0x00000000, 0x800032C2, 0x00000E13,
+    0x00000000, 0x80003302, 0x00000E14, 0x00000000, 0x80003342, 0x00000E15, 0x00000000, 0x80003382,
+    0x00000E16, 0x00000000, 0x800033C2, 0x00000E17, 0x00000000, 0x80003402, 0x00000E18, 0x00000000,
+    0x80003442, 0x00000E19, 0x00000000, 0x80003482, 0x00000E1A, 0x00000000, 0x800034C2, 0x00000E1B,
+    0x00000000, 0x80003502, 0x00000E1C, 0x00000000, 0x80003542, 0x00000E1D, 0x00000000, 0x80003582,
+    0x00000E1E, 0x00000000, 0x800035C2, 0x00000E1F, 0x00000000, 0x80003602, 0x00000E20, 0x00000000,
+    0x80003642, 0x00000E21, 0x00000000, 0x80003682, 0x00000E22, 0x00000000, 0x800036C2, 0x00000E23,
+    0x00000000, 0x80003702, 0x00000E24, 0x00000000, 0x80003742, 0x00000E25, 0x00000000, 0x80003782,
+    0x00000E26, 0x00000000, 0x800037C2, 0x00000E27, 0x00000000, 0x80003802, 0x00000E28, 0x00000000,
+    0x80003842, 0x00000E29, 0x00000000, 0x80003882, 0x00000E2A, 0x00000000, 0x800038C2, 0x00000E2B,
+    0x00000000, 0x80003902, 0x00000E2C, 0x00000000, 0x80003942, 0x00000E2D, 0x00000000, 0x80003982,
+    0x00000E2E, 0x00000000, 0x800039C2, 0x00000000, 0x00000000, 0x4C954402, 0x00000E32, 0x00000000,
+    0x4C924402, 0x00000000, 0x00000000, 0x40001B42, 0x00000E81, 0x00000000, 0x80003A02, 0x00000E82,
+    0x00000000, 0x80003A42, 0x00000E84, 0x00000000, 0x80003A82, 0x00000E86, 0x00000000, 0x80003AC2,
+    0x00000E87, 0x00000000, 0x80003B02, 0x00000E88, 0x00000000, 0x80003B42, 0x00000E89, 0x00000000,
+    0x80003B82, 0x00000E8A, 0x00000000, 0x80003BC2, 0x00000E8C, 0x00000000, 0x80003C02, 0x00000E8D,
+    0x00000000, 0x80003C42, 0x00000E8E, 0x00000000, 0x80003C82, 0x00000E8F, 0x00000000, 0x80003CC2,
+    0x00000E90, 0x00000000, 0x80003D02, 0x00000E91, 0x00000000, 0x80003D42, 0x00000E92, 0x00000000,
+    0x80003D82, 0x00000E93, 0x00000000, 0x80003DC2, 0x00000E94, 0x00000000, 0x80003E02, 0x00000E95,
+    0x00000000, 0x80003E42, 0x00000E96, 0x00000000, 0x80003E82, 0x00000E97, 0x00000000, 0x80003EC2,
+    0x00000E98, 0x00000000, 0x80003F02, 0x00000E99, 0x00000000, 0x80003F42, 0x00000E9A, 0x00000000,
+    0x80003F82, 0x00000E9B, 0x00000000, 0x80003FC2, 0x00000E9C, 0x00000000, 0x80004002, 0x00000E9D,
+    0x00000000, 0x80004042, 0x00000E9E, 0x00000000, 0x80004082, 0x00000E9F, 0x00000000, 0x800040C2,
+    0x00000EA0, 0x00000000, 0x80004102, 0x00000EA1, 0x00000000, 0x80004142, 0x00000EA2, 0x00000000,
+    0x80004182, 0x00000EA3, 0x00000000, 0x800041C2, 0x00000EA5, 0x00000000, 0x80004202, 0x00000EA7,
+    0x00000000, 0x80004242, 0x00000EA8, 0x00000000, 0x80004282, 0x00000EA9, 0x00000000, 0x800042C2,
+    0x00000EAA, 0x00000000, 0x80004302, 0x00000EAB, 0x00000000, 0x80004342, 0x00000EAC, 0x00000000,
+    0x80004382, 0x00000EAD, 0x00000000, 0x800043C2, 0x00000EAE, 0x00000000, 0x80004402, 0x00000EDC,
+    0x00000000, 0x80004443, 0x00000EDD, 0x00000000, 0x800044A3, 0x00000EDE, 0x00000000, 0x80004502,
+    0x00000EDF, 0x00000000, 0x80004542, 0x00000000, 0x00000000, 0x4CA44402, 0x00000E81, 0x00000000,
+    0x80004582, 0x00000E82, 0x00000000, 0x800045C2, 0x00000E84, 0x00000000, 0x80004602, 0x00000E86,
+    0x00000000, 0x80004642, 0x00000E87, 0x00000000, 0x80004682, 0x00000E88, 0x00000000, 0x800046C2,
+    0x00000E89, 0x00000000, 0x80004702, 0x00000E8A, 0x00000000, 0x80004742, 0x00000E8C, 0x00000000,
+    0x80004782, 0x00000E8D, 0x00000000, 0x800047C2, 0x00000E8E, 0x00000000, 0x80004802, 0x00000E8F,
+    0x00000000, 0x80004842, 0x00000E90, 0x00000000, 0x80004882, 0x00000E91, 0x00000000, 0x800048C2,
+    0x00000E92, 0x00000000, 0x80004902, 0x00000E93, 0x00000000, 0x80004942, 0x00000E94, 0x00000000,
+    0x80004982, 0x00000E95, 0x00000000, 0x800049C2, 0x00000E96, 0x00000000, 0x80004A02, 0x00000E97,
+    0x00000000, 0x80004A42, 0x00000E98, 0x00000000, 0x80004A82, 0x00000E99, 0x00000000, 0x80004AC2,
+    0x00000E9A, 0x00000000, 0x80004B02, 0x00000E9B, 0x00000000, 0x80004B42, 0x00000E9C, 0x00000000,
+    0x80004B82, 0x00000E9D, 0x00000000, 0x80004BC2, 0x00000E9E, 0x00000000, 0x80004C02, 0x00000E9F,
+    0x00000000, 0x80004C42, 0x00000EA0, 0x00000000, 0x80004C82, 0x00000EA1, 0x00000000, 0x80004CC2,
+    0x00000EA2, 0x00000000, 0x80004D02, 0x00000EA3, 0x00000000, 0x80004D42, 0x00000EA5, 0x00000000,
+    0x80004D82, 0x00000EA7, 0x00000000, 0x80004DC2, 0x00000EA8, 0x00000000, 0x80004E02, 0x00000EA9,
+    0x00000000, 0x80004E42, 0x00000EAA, 0x00000000, 0x80004E82, 0x00000EAB, 0x00000000, 0x80004EC2,
+    0x00000EAC, 0x00000000, 0x80004F02, 0x00000EAD, 0x00000000, 0x80004F42, 0x00000EAE, 0x00000000,
+    0x80004F82, 0x00000EDC, 0x00000000, 0x80004FC3, 0x00000EDD, 0x00000000, 0x80005023, 0x00000EDE,
+    0x00000000, 0x80005082, 0x00000EDF, 0x00000000, 0x800050C2, 0x00000000, 0x00000000, 0x4CA48402,
+    0x00000E81, 0x00000000, 0x80005102, 0x00000E82, 0x00000000, 0x80005142, 0x00000E84, 0x00000000,
+    0x80005182, 0x00000E86, 0x00000000, 0x800051C2, 0x00000E87, 0x00000000, 0x80005202, 0x00000E88,
+    0x00000000, 0x80005242, 0x00000E89, 0x00000000, 0x80005282, 0x00000E8A, 0x00000000, 0x800052C2,
+    0x00000E8C, 0x00000000, 0x80005302, 0x00000E8D, 0x00000000, 0x80005342, 0x00000E8E, 0x00000000,
+    0x80005382, 0x00000E8F, 0x00000000, 0x800053C2, 0x00000E90, 0x00000000, 0x80005402, 0x00000E91,
+    0x00000000, 0x80005442, 0x00000E92, 0x00000000, 0x80005482, 0x00000E93, 0x00000000, 0x800054C2,
+    0x00000E94, 0x00000000, 0x80005502, 0x00000E95, 0x00000000, 0x80005542, 0x00000E96, 0x00000000,
+    0x80005582, 0x00000E97, 0x00000000, 0x800055C2, 0x00000E98, 0x00000000, 0x80005602, 0x00000E99,
+    0x00000000, 0x80005642, 0x00000E9A, 0x00000000, 0x80005682, 0x00000E9B, 0x00000000, 0x800056C2,
+    0x00000E9C, 0x00000000, 0x80005702, 0x00000E9D, 0x00000000, 0x80005742, 0x00000E9E, 0x00000000,
+    0x80005782, 0x00000E9F, 0x00000000, 0x800057C2, 0x00000EA0, 0x00000000, 0x80005802, 0x00000EA1,
+    0x00000000, 0x80005842, 0x00000EA2, 0x00000000, 0x80005882, 0x00000EA3, 0x00000000, 0x800058C2,
+    0x00000EA5, 0x00000000, 0x80005902, 0x00000EA7, 0x00000000, 0x80005942, 0x00000EA8, 0x00000000,
+    0x80005982, 0x00000EA9, 0x00000000, 0x800059C2, 0x00000EAA, 0x00000000, 0x80005A02, 0x00000EAB,
+    0x00000000, 0x80005A42, 0x00000EAC, 0x00000000, 0x80005A82, 0x00000EAD, 0x00000000, 0x80005AC2,
+    0x00000EAE, 0x00000000, 0x80005B02, 0x00000EDC, 0x00000000, 0x80005B43, 0x00000EDD, 0x00000000,
+    0x80005BA3, 0x00000EDE, 0x00000000, 0x80005C02, 0x00000EDF, 0x00000000, 0x80005C42, 0x00000000,
+    0x00000000, 0x4CA4C402, 0x00000E81, 0x00000000, 0x80005C82, 0x00000E82, 0x00000000, 0x80005CC2,
+    0x00000E84, 0x00000000, 0x80005D02, 0x00000E86, 0x00000000, 0x80005D42, 0x00000E87, 0x00000000,
+    0x80005D82, 0x00000E88, 0x00000000, 0x80005DC2, 0x00000E89, 0x00000000, 0x80005E02, 0x00000E8A,
+    0x00000000, 0x80005E42, 0x00000E8C, 0x00000000, 0x80005E82, 0x00000E8D, 0x00000000, 0x80005EC2,
+    0x00000E8E, 0x00000000, 0x80005F02, 0x00000E8F, 0x00000000, 0x80005F42, 0x00000E90, 0x00000000,
+    0x80005F82, 0x00000E91, 0x00000000, 0x80005FC2, 0x00000E92, 0x00000000, 0x80006002, 0x00000E93,
+    0x00000000, 0x80006042, 0x00000E94, 0x00000000, 0x80006082, 0x00000E95, 0x00000000, 0x800060C2,
+    0x00000E96, 0x00000000, 0x80006102, 0x00000E97, 0x00000000, 0x80006142, 0x00000E98, 0x00000000,
+    0x80006182, 0x00000E99, 0x00000000, 0x800061C2, 0x00000E9A, 0x00000000, 0x80006202, 0x00000E9B,
+    0x00000000, 0x80006242, 0x00000E9C, 0x00000000, 0x80006282, 0x00000E9D, 0x00000000, 0x800062C2,
+    0x00000E9E, 0x00000000, 0x80006302, 0x00000E9F, 0x00000000, 0x80006342, 0x00000EA0, 0x00000000,
+    0x80006382, 0x00000EA1, 0x00000000, 0x800063C2, 0x00000EA2, 0x00000000, 0x80006402, 0x00000EA3,
+    0x00000000, 0x80006442, 0x00000EA5, 0x00000000, 0x80006482, 0x00000EA7, 0x00000000, 0x800064C2,
+    0x00000EA8, 0x00000000, 0x80006502, 0x00000EA9, 0x00000000, 0x80006542, 0x00000EAA, 0x00000000,
+    0x80006582, 0x00000EAB, 0x00000000, 0x800065C2, 0x00000EAC, 0x00000000, 0x80006602, 0x00000EAD,
+    0x00000000, 0x80006642, 0x00000EAE, 0x00000000, 0x80006682, 0x00000EDC, 0x00000000, 0x800066C3,
+    0x00000EDD, 0x00000000, 0x80006723, 0x00000EDE, 0x00000000, 0x80006782, 0x00000EDF, 0x00000000,
+    0x800067C2, 0x00000000, 0x00000000, 0x4CA50402, 0x00000E81, 0x00000000, 0x80006802, 0x00000E82,
+    0x00000000, 0x80006842, 0x00000E84, 0x00000000, 0x80006882, 0x00000E86, 0x00000000, 0x800068C2,
+    0x00000E87, 0x00000000, 0x80006902, 0x00000E88, 0x00000000, 0x80006942, 0x00000E89, 0x00000000,
+    0x80006982, 0x00000E8A, 0x00000000, 0x800069C2, 0x00000E8C, 0x00000000, 0x80006A02, 0x00000E8D,
+    0x00000000, 0x80006A42, 0x00000E8E, 0x00000000, 0x80006A82, 0x00000E8F, 0x00000000, 0x80006AC2,
+    0x00000E90, 0x00000000, 0x80006B02, 0x00000E91, 0x00000000, 0x80006B42, 0x00000E92, 0x00000000,
+    0x80006B82, 0x00000E93, 0x00000000, 0x80006BC2, 0x00000E94, 0x00000000, 0x80006C02, 0x00000E95,
+    0x00000000, 0x80006C42, 0x00000E96, 0x00000000, 0x80006C82, 0x00000E97, 0x00000000, 0x80006CC2,
+    0x00000E98, 0x00000000, 0x80006D02, 0x00000E99, 0x00000000, 0x80006D42, 0x00000E9A, 0x00000000,
+    0x80006D82, 0x00000E9B, 0x00000000, 0x80006DC2, 0x00000E9C, 0x00000000, 0x80006E02, 0x00000E9D,
+    0x00000000, 0x80006E42, 0x00000E9E, 0x00000000, 0x80006E82, 0x00000E9F, 0x00000000, 0x80006EC2,
+    0x00000EA0, 0x00000000, 0x80006F02, 0x00000EA1, 0x00000000, 0x80006F42, 0x00000EA2, 0x00000000,
+    0x80006F82, 0x00000EA3, 0x00000000, 0x80006FC2, 0x00000EA5, 0x00000000, 0x80007002, 0x00000EA7,
+    0x00000000, 0x80007042, 0x00000EA8, 0x00000000, 0x80007082, 0x00000EA9, 0x00000000, 0x800070C2,
+    0x00000EAA, 0x00000000, 0x80007102, 0x00000EAB, 0x00000000, 0x80007142, 0x00000EAC, 0x00000000,
+    0x80007182, 0x00000EAD, 0x00000000, 0x800071C2, 0x00000EAE, 0x00000000, 0x80007202, 0x00000EDC,
+    0x00000000, 0x80007243, 0x00000EDD, 0x00000000, 0x800072A3, 0x00000EDE, 0x00000000, 0x80007302,
+    0x00000EDF, 0x00000000, 0x80007342, 0x00000000, 0x00000000, 0x4CA54402, 0x00000EB2, 0x00000000,
+    0x4CA18402, 0x00000000, 0x00000000, 0x40001C02, 0x00000F72, 0x00000000, 0x4CCAC402, 0x00000F74,
+    0x00000000, 0x4CCBC402, 0x00000F80, 0x00000000, 0x4CCB4402, 0x00000000, 0x00000000, 0x4CCA4402,
+    0x00000F71, 0x00000F80, 0x4CCC4402, 0x00000F80, 0x00000000, 0x4CCC0402, 0x00000F81, 0x00000000,
+    0x4CCC4402, 0x00000000, 0x00000000, 0x4CC4C402, 0x00000F71, 0x00000F80, 0x4CCCC402, 0x00000F80,
+    0x00000000, 0x4CCC8402, 0x00000F81, 0x00000000, 0x4CCCC402, 0x00000000, 0x00000000, 0x4CC58402,
+    0x0000102E, 0x00000000, 0x4D774402, 0x00000000, 0x00000000, 0x4D770402, 0x00001980, 0x00000000,
+    0x80007382, 0x00001981, 0x00000000, 0x800073C2, 0x00001982, 0x00000000, 0x80007402, 0x00001983,
+    0x00000000, 0x80007442, 0x00001984, 0x00000000, 0x80007482, 0x00001985, 0x00000000, 0x800074C2,
+    0x00001986, 0x00000000, 0x80007502, 0x00001987, 0x00000000, 0x80007542, 0x00001988, 0x00000000,
+    0x80007582, 0x00001989, 0x00000000, 0x800075C2, 0x0000198A, 0x00000000, 0x80007602, 0x0000198B,
+    0x00000000, 0x80007642, 0x0000198C, 0x00000000, 0x80007682, 0x0000198D, 0x00000000, 0x800076C2,
+    0x0000198E, 0x00000000, 0x80007702, 0x0000198F, 0x00000000, 0x80007742, 0x00001990, 0x00000000,
+    0x80007782, 0x00001991, 0x00000000, 0x800077C2, 0x00001992, 0x00000000, 0x80007802, 0x00001993,
+    0x00000000, 0x80007842, 0x00001994, 0x00000000, 0x80007882, 0x00001995, 0x00000000, 0x800078C2,
+    0x00001996, 0x00000000, 0x80007902, 0x00001997, 0x00000000, 0x80007942, 0x00001998, 0x00000000,
+    0x80007982, 0x00001999, 0x00000000, 0x800079C2, 0x0000199A, 0x00000000, 0x80007A02, 0x0000199B,
+    0x00000000, 0x80007A42, 0x0000199C, 0x00000000, 0x80007A82, 0x0000199D, 0x00000000, 0x80007AC2,
+    0x0000199E, 0x00000000, 0x80007B02, 0x0000199F, 0x00000000, 0x80007B42, 0x000019A0, 0x00000000,
+    0x80007B82, 0x000019A1, 0x00000000, 0x80007BC2, 0x000019A2, 0x00000000, 0x80007C02, 0x000019A3,
+    0x00000000, 0x80007C42, 0x000019A4, 0x00000000, 0x80007C82, 0x000019A5, 0x00000000, 0x80007CC2,
+    0x000019A6, 0x00000000, 0x80007D02, 0x000019A7, 0x00000000, 0x80007D42, 0x000019A8, 0x00000000,
+    0x80007D82, 0x000019A9, 0x00000000, 0x80007DC2, 0x000019AA, 0x00000000, 0x80007E02, 0x000019AB,
+    0x00000000, 0x80007E42, 0x00000000, 0x00000000, 0x4DC3C402, 0x00001980, 0x00000000, 0x80007E82,
+    0x00001981, 0x00000000, 0x80007EC2, 0x00001982, 0x00000000, 0x80007F02, 0x00001983, 0x00000000,
+    0x80007F42, 0x00001984, 0x00000000, 0x80007F82, 0x00001985, 0x00000000, 0x80007FC2, 0x00001986,
+    0x00000000, 0x80008002, 0x00001987, 0x00000000, 0x80008042, 0x00001988, 0x00000000, 0x80008082,
+    0x00001989, 0x00000000, 0x800080C2, 0x0000198A, 0x00000000, 0x80008102, 0x0000198B, 0x00000000,
+    0x80008142, 0x0000198C, 0x00000000, 0x80008182, 0x0000198D, 0x00000000, 0x800081C2, 0x0000198E,
+    0x00000000, 0x80008202, 0x0000198F, 0x00000000, 0x80008242, 0x00001990, 0x00000000, 0x80008282,
+    0x00001991, 0x00000000, 0x800082C2, 0x00001992, 0x00000000, 0x80008302, 0x00001993, 0x00000000,
+    0x80008342, 0x00001994, 0x00000000, 0x80008382, 0x00001995, 0x00000000, 0x800083C2, 0x00001996,
+    0x00000000, 0x80008402, 0x00001997, 0x00000000, 0x80008442, 0x00001998, 0x00000000, 0x80008482,
+    0x00001999, 0x00000000, 0x800084C2, 0x0000199A, 0x00000000, 0x80008502, 0x0000199B, 0x00000000,
+    0x80008542, 0x0000199C, 0x00000000, 0x80008582, 0x0000199D, 0x00000000, 0x800085C2, 0x0000199E,
+    0x00000000, 0x80008602, 0x0000199F, 0x00000000, 0x80008642, 0x000019A0, 0x00000000, 0x80008682,
+    0x000019A1, 0x00000000, 0x800086C2, 0x000019A2, 0x00000000, 0x80008702, 0x000019A3, 0x00000000,
+    0x80008742, 0x000019A4, 0x00000000, 0x80008782, 0x000019A5, 0x00000000, 0x800087C2, 0x000019A6,
+    0x00000000, 0x80008802, 0x000019A7, 0x00000000, 0x80008842, 0x000019A8, 0x00000000, 0x80008882,
+    0x000019A9, 0x00000000, 0x800088C2, 0x000019AA, 0x00000000, 0x80008902, 0x000019AB, 0x00000000,
+    0x80008942, 0x00000000, 0x00000000, 0x4DC40402, 0x00001980, 0x00000000, 0x80008982, 0x00001981,
+    0x00000000, 0x800089C2, 0x00001982, 0x00000000, 0x80008A02, 0x00001983, 0x00000000, 0x80008A42,
+    0x00001984, 0x00000000, 0x80008A82, 0x00001985, 0x00000000, 0x80008AC2, 0x00001986, 0x00000000,
+    0x80008B02, 0x00001987, 0x00000000, 0x80008B42, 0x00001988, 0x00000000, 0x80008B82, 0x00001989,
+    0x00000000, 0x80008BC2, 0x0000198A, 0x00000000, 0x80008C02, 0x0000198B, 0x00000000, 0x80008C42,
+    0x0000198C, 0x00000000, 0x80008C82, 0x0000198D, 0x00000000, 0x80008CC2, 0x0000198E, 0x00000000,
+    0x80008D02, 0x0000198F, 0x00000000, 0x80008D42, 0x00001990, 0x00000000, 0x80008D82, 0x00001991,
+    0x00000000, 0x80008DC2, 0x00001992, 0x00000000, 0x80008E02, 0x00001993, 0x00000000, 0x80008E42,
+    0x00001994, 0x00000000, 0x80008E82, 0x00001995, 0x00000000, 0x80008EC2, 0x00001996, 0x00000000,
+    0x80008F02, 0x00001997, 0x00000000, 0x80008F42, 0x00001998, 0x00000000, 0x80008F82, 0x00001999,
+    0x00000000, 0x80008FC2, 0x0000199A, 0x00000000, 0x80009002, 0x0000199B, 0x00000000, 0x80009042,
+    0x0000199C, 0x00000000, 0x80009082, 0x0000199D, 0x00000000, 0x800090C2, 0x0000199E, 0x00000000,
+    0x80009102, 0x0000199F, 0x00000000, 0x80009142, 0x000019A0, 0x00000000, 0x80009182, 0x000019A1,
+    0x00000000, 0x800091C2, 0x000019A2, 0x00000000, 0x80009202, 0x000019A3, 0x00000000, 0x80009242,
+    0x000019A4, 0x00000000, 0x80009282, 0x000019A5, 0x00000000, 0x800092C2, 0x000019A6, 0x00000000,
+    0x80009302, 0x000019A7, 0x00000000, 0x80009342, 0x000019A8, 0x00000000, 0x80009382, 0x000019A9,
+    0x00000000, 0x800093C2, 0x000019AA, 0x00000000, 0x80009402, 0x000019AB, 0x00000000, 0x80009442,
+    0x00000000, 0x00000000, 0x4DC44402, 0x00001980, 0x00000000, 0x80009482, 0x00001981, 0x00000000,
+    0x800094C2, 0x00001982, 0x00000000, 0x80009502, 0x00001983, 0x00000000, 0x80009542, 0x00001984,
+    0x00000000, 0x80009582, 0x00001985, 0x00000000, 0x800095C2, 0x00001986, 0x00000000, 0x80009602,
+    0x00001987, 0x00000000, 0x80009642, 0x00001988, 0x00000000, 0x80009682, 0x00001989, 0x00000000,
+    0x800096C2, 0x0000198A, 0x00000000, 0x80009702, 0x0000198B, 0x00000000, 0x80009742, 0x0000198C,
+    0x00000000, 0x80009782, 0x0000198D, 0x00000000, 0x800097C2, 0x0000198E, 0x00000000, 0x80009802,
+    0x0000198F, 0x00000000, 0x80009842, 0x00001990, 0x00000000, 0x80009882, 0x00001991, 0x00000000,
+    0x800098C2, 0x00001992, 0x00000000, 0x80009902, 0x00001993, 0x00000000, 0x80009942, 0x00001994,
+    0x00000000, 0x80009982, 0x00001995, 0x00000000, 0x800099C2, 0x00001996, 0x00000000, 0x80009A02,
+    0x00001997, 0x00000000, 0x80009A42, 0x00001998, 0x00000000, 0x80009A82, 0x00001999, 0x00000000,
+    0x80009AC2, 0x0000199A, 0x00000000, 0x80009B02, 0x0000199B, 0x00000000, 0x80009B42, 0x0000199C,
+    0x00000000, 0x80009B82, 0x0000199D, 0x00000000, 0x80009BC2, 0x0000199E, 0x00000000, 0x80009C02,
+    0x0000199F, 0x00000000, 0x80009C42, 0x000019A0, 0x00000000, 0x80009C82, 0x000019A1, 0x00000000,
+    0x80009CC2, 0x000019A2, 0x00000000, 0x80009D02, 0x000019A3, 0x00000000, 0x80009D42, 0x000019A4,
+    0x00000000, 0x80009D82, 0x000019A5, 0x00000000, 0x80009DC2, 0x000019A6, 0x00000000, 0x80009E02,
+    0x000019A7, 0x00000000, 0x80009E42, 0x000019A8, 0x00000000, 0x80009E82, 0x000019A9, 0x00000000,
+    0x80009EC2, 0x000019AA, 0x00000000, 0x80009F02, 0x000019AB, 0x00000000, 0x80009F42, 0x00000000,
+    0x00000000, 0x4DC50402, 0x00001B35, 0x00000000, 0x4DEDC402, 0x00000000, 0x00000000, 0x4DED8402,
+    0x00001B35, 0x00000000, 0x4DEE4402, 0x00000000, 0x00000000, 0x4DEE0402, 0x00001B35, 0x00000000,
+    0x4DEEC402, 0x00000000, 0x00000000, 0x4DEE8402, 0x00001B35, 0x00000000, 0x4DEF4402, 0x00000000,
+    0x00000000, 0x4DEF0402, 0x00001B35, 0x00000000, 0x4DEFC402, 0x00000000, 0x00000000, 0x4DEF8402,
+    0x00001B35, 0x00000000, 0x4DF0C402, 0x00000000, 0x00000000, 0x4DF08402, 0x00001B35, 0x00000000,
+    0x4DFC8402, 0x00000000, 0x00000000, 0x4DFC4402, 0x00001B35, 0x00000000, 0x4DFD0402, 0x00000000,
+    0x00000000, 0x4DFCC402, 0x00001B35, 0x00000000, 0x4DFDC402, 0x00000000, 0x00000000, 0x4DFD4402,
+    0x00001B35, 0x00000000, 0x4DFE0402, 0x00000000, 0x00000000, 0x4DFD8402, 0x00001B35, 0x00000000,
+    0x4DFE8402, 0x00000000, 0x00000000, 0x4DFE4402, 0x0000AA80, 0x00000000, 0x80009F82, 0x0000AA81,
+    0x00000000, 0x80009FC2, 0x0000AA82, 0x00000000, 0x8000A002, 0x0000AA83, 0x00000000, 0x8000A042,
+    0x0000AA84, 0x00000000, 0x8000A082, 0x0000AA85, 0x00000000, 0x8000A0C2, 0x0000AA86, 0x00000000,
+    0x8000A102, 0x0000AA87, 0x00000000, 0x8000A142, 0x0000AA88, 0x00000000, 0x8000A182, 0x0000AA89,
+    0x00000000, 0x8000A1C2, 0x0000AA8A, 0x00000000, 0x8000A202, 0x0000AA8B, 0x00000000, 0x8000A242,
+    0x0000AA8C, 0x00000000, 0x8000A282, 0x0000AA8D, 0x00000000, 0x8000A2C2, 0x0000AA8E, 0x00000000,
+    0x8000A302, 0x0000AA8F, 0x00000000, 0x8000A342, 0x0000AA90, 0x00000000, 0x8000A382, 0x0000AA91,
+    0x00000000, 0x8000A3C2, 0x0000AA92, 0x00000000, 0x8000A402, 0x0000AA93, 0x00000000, 0x8000A442,
+    0x0000AA94, 0x00000000, 0x8000A482, 0x0000AA95, 0x00000000, 0x8000A4C2, 0x0000AA96, 0x00000000,
+    0x8000A502, 0x0000AA97, 0x00000000, 0x8000A542, 0x0000AA98, 0x00000000, 0x8000A582, 0x0000AA99,
+    0x00000000, 0x8000A5C2, 0x0000AA9A, 0x00000000, 0x8000A602, 0x0000AA9B, 0x00000000, 0x8000A642,
+    0x0000AA9C, 0x00000000, 0x8000A682, 0x0000AA9D, 0x00000000, 0x8000A6C2, 0x0000AA9E, 0x00000000,
+    0x8000A702, 0x0000AA9F, 0x00000000, 0x8000A742, 0x0000AAA0, 0x00000000, 0x8000A782, 0x0000AAA1,
+    0x00000000, 0x8000A7C2, 0x0000AAA2, 0x00000000, 0x8000A802, 0x0000AAA3, 0x00000000, 0x8000A842,
+    0x0000AAA4, 0x00000000, 0x8000A882, 0x0000AAA5, 0x00000000, 0x8000A8C2, 0x0000AAA6, 0x00000000,
+    0x8000A902, 0x0000AAA7, 0x00000000, 0x8000A942, 0x0000AAA8, 0x00000000, 0x8000A982, 0x0000AAA9,
+    0x00000000, 0x8000A9C2, 0x0000AAAA, 0x00000000, 0x8000AA02, 0x0000AAAB, 0x00000000, 0x8000AA42,
+    0x0000AAAC, 0x00000000, 0x8000AA82, 0x0000AAAD, 0x00000000, 0x8000AAC2, 0x0000AAAE, 0x00000000,
+    0x8000AB02, 0x0000AAAF, 0x00000000, 0x8000AB42, 0x00000000, 0x00000000, 0x4CB2C402, 0x0000AA80,
+    0x00000000, 0x8000AB82, 0x0000AA81, 0x00000000, 0x8000ABC2, 0x0000AA82, 0x00000000, 0x8000AC02,
+    0x0000AA83, 0x00000000, 0x8000AC42, 0x0000AA84, 0x00000000, 0x8000AC82, 0x0000AA85, 0x00000000,
+    0x8000ACC2, 0x0000AA86, 0x00000000, 0x8000AD02, 0x0000AA87, 0x00000000, 0x8000AD42, 0x0000AA88,
+    0x00000000, 0x8000AD82, 0x0000AA89, 0x00000000, 0x8000ADC2, 0x0000AA8A, 0x00000000, 0x8000AE02,
+    0x0000AA8B, 0x00000000, 0x8000AE42, 0x0000AA8C, 0x00000000, 0x8000AE82, 0x0000AA8D, 0x00000000,
+    0x8000AEC2, 0x0000AA8E, 0x00000000, 0x8000AF02, 0x0000AA8F, 0x00000000, 0x8000AF42, 0x0000AA90,
+    0x00000000, 0x8000AF82, 0x0000AA91, 0x00000000, 0x8000AFC2, 0x0000AA92, 0x00000000, 0x8000B002,
+    0x0000AA93, 0x00000000, 0x8000B042, 0x0000AA94, 0x00000000, 0x8000B082, 0x0000AA95, 0x00000000,
+    0x8000B0C2, 0x0000AA96, 0x00000000, 0x8000B102, 0x0000AA97, 0x00000000, 0x8000B142, 0x0000AA98,
+    0x00000000, 0x8000B182, 0x0000AA99, 0x00000000, 0x8000B1C2, 0x0000AA9A, 0x00000000, 0x8000B202,
+    0x0000AA9B, 0x00000000, 0x8000B242, 0x0000AA9C, 0x00000000, 0x8000B282, 0x0000AA9D, 0x00000000,
+    0x8000B2C2, 0x0000AA9E, 0x00000000, 0x8000B302, 0x0000AA9F, 0x00000000, 0x8000B342, 0x0000AAA0,
+    0x00000000, 0x8000B382, 0x0000AAA1, 0x00000000, 0x8000B3C2, 0x0000AAA2, 0x00000000, 0x8000B402,
+    0x0000AAA3, 0x00000000, 0x8000B442, 0x0000AAA4, 0x00000000, 0x8000B482, 0x0000AAA5, 0x00000000,
+    0x8000B4C2, 0x0000AAA6, 0x00000000, 0x8000B502, 0x0000AAA7, 0x00000000, 0x8000B542, 0x0000AAA8,
+    0x00000000, 0x8000B582, 0x0000AAA9, 0x00000000, 0x8000B5C2, 0x0000AAAA, 0x00000000, 0x8000B602,
+    0x0000AAAB, 0x00000000, 0x8000B642, 0x0000AAAC, 0x00000000, 0x8000B682, 0x0000AAAD, 0x00000000,
+    0x8000B6C2, 0x0000AAAE, 0x00000000, 0x8000B702, 0x0000AAAF, 0x00000000, 0x8000B742, 0x00000000,
+    0x00000000, 0x4CB30402, 0x0000AA80, 0x00000000, 0x8000B782, 0x0000AA81, 0x00000000, 0x8000B7C2,
+    0x0000AA82, 0x00000000, 0x8000B802, 0x0000AA83, 0x00000000, 0x8000B842, 0x0000AA84, 0x00000000,
+    0x8000B882, 0x0000AA85, 0x00000000, 0x8000B8C2, 0x0000AA86, 0x00000000, 0x8000B902, 0x0000AA87,
+    0x00000000, 0x8000B942, 0x0000AA88, 0x00000000, 0x8000B982, 0x0000AA89, 0x00000000, 0x8000B9C2,
+    0x0000AA8A, 0x00000000, 0x8000BA02, 0x0000AA8B, 0x00000000, 0x8000BA42, 0x0000AA8C, 0x00000000,
+    0x8000BA82, 0x0000AA8D, 0x00000000, 0x8000BAC2, 0x0000AA8E, 0x00000000, 0x8000BB02, 0x0000AA8F,
+    0x00000000, 0x8000BB42, 0x0000AA90, 0x00000000, 0x8000BB82, 0x0000AA91, 0x00000000, 0x8000BBC2,
+    0x0000AA92, 0x00000000, 0x8000BC02, 0x0000AA93, 0x00000000, 0x8000BC42, 0x0000AA94, 0x00000000,
+    0x8000BC82, 0x0000AA95, 0x00000000, 0x8000BCC2, 0x0000AA96, 0x00000000, 0x8000BD02, 0x0000AA97,
+    0x00000000, 0x8000BD42, 0x0000AA98, 0x00000000, 0x8000BD82, 0x0000AA99, 0x00000000, 0x8000BDC2,
+    0x0000AA9A, 0x00000000, 0x8000BE02, 0x0000AA9B, 0x00000000, 0x8000BE42, 0x0000AA9C, 0x00000000,
+    0x8000BE82, 0x0000AA9D, 0x00000000, 0x8000BEC2, 0x0000AA9E, 0x00000000, 0x8000BF02, 0x0000AA9F,
+    0x00000000, 0x8000BF42, 0x0000AAA0, 0x00000000, 0x8000BF82, 0x0000AAA1, 0x00000000, 0x8000BFC2,
+    0x0000AAA2, 0x00000000, 0x8000C002, 0x0000AAA3, 0x00000000, 0x8000C042, 0x0000AAA4, 0x00000000,
+    0x8000C082, 0x0000AAA5, 0x00000000, 0x8000C0C2, 0x0000AAA6, 0x00000000, 0x8000C102, 0x0000AAA7,
+    0x00000000, 0x8000C142, 0x0000AAA8, 0x00000000, 0x8000C182, 0x0000AAA9, 0x00000000, 0x8000C1C2,
+    0x0000AAAA, 0x00000000, 0x8000C202, 0x0000AAAB, 0x00000000, 0x8000C242, 0x0000AAAC, 0x00000000,
+    0x8000C282, 0x0000AAAD, 0x00000000, 0x8000C2C2, 0x0000AAAE, 0x00000000, 0x8000C302, 0x0000AAAF,
+    0x00000000, 0x8000C342, 0x00000000, 0x00000000, 0x4CB3C402, 0x0000AA80, 0x00000000, 0x8000C382,
+    0x0000AA81, 0x00000000, 0x8000C3C2, 0x0000AA82, 0x00000000, 0x8000C402, 0x0000AA83, 0x00000000,
+    0x8000C442, 0x0000AA84, 0x00000000, 0x8000C482, 0x0000AA85, 0x00000000, 0x8000C4C2, 0x0000AA86,
+    0x00000000, 0x8000C502, 0x0000AA87, 0x00000000, 0x8000C542, 0x0000AA88, 0x00000000, 0x8000C582,
+    0x0000AA89, 0x00000000, 0x8000C5C2, 0x0000AA8A, 0x00000000, 0x8000C602, 0x0000AA8B, 0x00000000,
+    0x8000C642, 0x0000AA8C, 0x00000000, 0x8000C682, 0x0000AA8D, 0x00000000, 0x8000C6C2, 0x0000AA8E,
+    0x00000000, 0x8000C702, 0x0000AA8F, 0x00000000, 0x8000C742, 0x0000AA90, 0x00000000, 0x8000C782,
+    0x0000AA91, 0x00000000, 0x8000C7C2, 0x0000AA92, 0x00000000, 0x8000C802, 0x0000AA93, 0x00000000,
+    0x8000C842, 0x0000AA94, 0x00000000, 0x8000C882, 0x0000AA95, 0x00000000, 0x8000C8C2, 0x0000AA96,
+    0x00000000, 0x8000C902, 0x0000AA97, 0x00000000, 0x8000C942, 0x0000AA98, 0x00000000, 0x8000C982,
+    0x0000AA99, 0x00000000, 0x8000C9C2, 0x0000AA9A, 0x00000000, 0x8000CA02, 0x0000AA9B, 0x00000000,
+    0x8000CA42, 0x0000AA9C, 0x00000000, 0x8000CA82, 0x0000AA9D, 0x00000000, 0x8000CAC2, 0x0000AA9E,
+    0x00000000, 0x8000CB02, 0x0000AA9F, 0x00000000, 0x8000CB42, 0x0000AAA0, 0x00000000, 0x8000CB82,
+    0x0000AAA1, 0x00000000, 0x8000CBC2, 0x0000AAA2, 0x00000000, 0x8000CC02, 0x0000AAA3, 0x00000000,
+    0x8000CC42, 0x0000AAA4, 0x00000000, 0x8000CC82, 0x0000AAA5, 0x00000000, 0x8000CCC2, 0x0000AAA6,
+    0x00000000, 0x8000CD02, 0x0000AAA7, 0x00000000, 0x8000CD42, 0x0000AAA8, 0x00000000, 0x8000CD82,
+    0x0000AAA9, 0x00000000, 0x8000CDC2, 0x0000AAAA, 0x00000000, 0x8000CE02, 0x0000AAAB, 0x00000000,
+    0x8000CE42, 0x0000AAAC, 0x00000000, 0x8000CE82, 0x0000AAAD, 0x00000000, 0x8000CEC2, 0x0000AAAE,
+    0x00000000, 0x8000CF02, 0x0000AAAF, 0x00000000, 0x8000CF42, 0x00000000, 0x00000000, 0x4CB44402,
+    0x0000AA80, 0x00000000, 0x8000CF82, 0x0000AA81, 0x00000000, 0x8000CFC2, 0x0000AA82, 0x00000000,
+    0x8000D002, 0x0000AA83, 0x00000000, 0x8000D042, 0x0000AA84, 0x00000000, 0x8000D082, 0x0000AA85,
+    0x00000000, 0x8000D0C2, 0x0000AA86, 0x00000000, 0x8000D102, 0x0000AA87, 0x00000000, 0x8000D142,
+    0x0000AA88, 0x00000000, 0x8000D182, 0x0000AA89, 0x00000000, 0x8000D1C2, 0x0000AA8A, 0x00000000,
+    0x8000D202, 0x0000AA8B, 0x00000000, 0x8000D242, 0x0000AA8C, 0x00000000, 0x8000D282, 0x0000AA8D,
+    0x00000000, 0x8000D2C2, 0x0000AA8E, 0x00000000, 0x8000D302, 0x0000AA8F, 0x00000000, 0x8000D342,
+    0x0000AA90, 0x00000000, 0x8000D382, 0x0000AA91, 0x00000000, 0x8000D3C2, 0x0000AA92, 0x00000000,
+    0x8000D402, 0x0000AA93, 0x00000000, 0x8000D442, 0x0000AA94, 0x00000000, 0x8000D482, 0x0000AA95,
+    0x00000000, 0x8000D4C2, 0x0000AA96, 0x00000000, 0x8000D502, 0x0000AA97, 0x00000000, 0x8000D542,
+    0x0000AA98, 0x00000000, 0x8000D582, 0x0000AA99, 0x00000000, 0x8000D5C2, 0x0000AA9A, 0x00000000,
+    0x8000D602, 0x0000AA9B, 0x00000000, 0x8000D642, 0x0000AA9C, 0x00000000, 0x8000D682, 0x0000AA9D,
+    0x00000000, 0x8000D6C2, 0x0000AA9E, 0x00000000, 0x8000D702, 0x0000AA9F, 0x00000000, 0x8000D742,
+    0x0000AAA0, 0x00000000, 0x8000D782, 0x0000AAA1, 0x00000000, 0x8000D7C2, 0x0000AAA2, 0x00000000,
+    0x8000D802, 0x0000AAA3, 0x00000000, 0x8000D842, 0x0000AAA4, 0x00000000, 0x8000D882, 0x0000AAA5,
+    0x00000000, 0x8000D8C2, 0x0000AAA6, 0x00000000, 0x8000D902, 0x0000AAA7, 0x00000000, 0x8000D942,
+    0x0000AAA8, 0x00000000, 0x8000D982, 0x0000AAA9, 0x00000000, 0x8000D9C2, 0x0000AAAA, 0x00000000,
+    0x8000DA02, 0x0000AAAB, 0x00000000, 0x8000DA42, 0x0000AAAC, 0x00000000, 0x8000DA82, 0x0000AAAD,
+    0x00000000, 0x8000DAC2, 0x0000AAAE, 0x00000000, 0x8000DB02, 0x0000AAAF, 0x00000000, 0x8000DB42,
+    0x00000000, 0x00000000, 0x4CB48402, 0x00011127, 0x00000000, 0x4D9B0402, 0x00000000, 0x00000000,
+    0x4D9BC402, 0x00011127, 0x00000000, 0x4D9B4402, 0x00000000, 0x00000000, 0x4D9C0402, 0x0001133E,
+    0x00000000, 0x4BAD4402, 0x00011357, 0x00000000, 0x4BAD8402, 0x00000000, 0x00000000, 0x4BACC402,
+    0x000114B0, 0x00000000, 0x4BD0C402, 0x000114BA, 0x00000000, 0x4BD08402, 0x000114BD, 0x00000000,
+    0x4BD14402, 0x00000000, 0x00000000, 0x4BD00402, 0x000115AF, 0x00000000, 0x4BDFC402, 0x00000000,
+    0x00000000, 0x4BDF4402, 0x000115AF, 0x00000000, 0x4BE00402, 0x00000000, 0x00000000, 0x4BDF8402,
+    0x00011930, 0x00000000, 0x4C0B0402, 0x00000000, 0x00000000, 0x4C0A8402
+};
+
+}
+
+#endif
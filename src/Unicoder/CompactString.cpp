@@ -0,0 +1,361 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/CompactString.h>
+#include <Unicoder/Transcoder.h>
+
+#include <algorithm>
+
+#if defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+//
+// The three storage formats, as fixed width encodings for the Transcoder.
+//
+typedef BasicUTF32Encoding<Byte>  Latin1Storage;
+typedef BasicUTF32Encoding<UTF16> UCS2Storage;
+typedef UTF32Encoding             UCS4Storage;
+
+//
+// The largest byte in [begin, end). For UTF-8 text the largest lead byte
+// tells the largest code point: below C4 it is at most U+00FF, below F0 it
+// is in the BMP.
+//
+Byte
+MaxByte(const Byte* begin, const Byte* end)
+{
+    Byte result = 0;
+
+#if defined(ARCH_CPU_SSE2)
+    if (end - begin >= 16)
+    {
+        __m128i max = _mm_setzero_si128();
+        for (; end - begin >= 16; begin += 16)
+        {
+            max = _mm_max_epu8(max, _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin)));
+        }
+        Byte lanes[16];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), max);
+        result = *std::max_element(lanes, lanes + 16);
+    }
+#elif defined(ARCH_CPU_NEON)
+    if (end - begin >= 16)
+    {
+        uint8x16_t max = vdupq_n_u8(0);
+        for (; end - begin >= 16; begin += 16)
+        {
+            max = vmaxq_u8(max, vld1q_u8(begin));
+        }
+        Byte lanes[16];
+        vst1q_u8(lanes, max);
+        result = *std::max_element(lanes, lanes + 16);
+    }
+#endif
+
+    for (; begin != end; ++begin)
+    {
+        result = std::max(result, *begin);
+    }
+    return result;
+}
+
+//
+// OR of all code units: it is below 0x100 (0x10000) iff every unit is.
+// A plain loop, which compilers vectorize.
+//
+template<typename unitT>
+UTF32
+OrUnits(const unitT* first, const unitT* last)
+{
+    UTF32 bits = 0;
+    for (; first != last; ++first)
+    {
+        bits |= static_cast<UTF32>(*first);
+    }
+    return bits;
+}
+
+inline int
+WidthFor(UTF32 bits)
+{
+    return bits < 0x100 ? 1 : bits < 0x10000 ? 2 : 4;
+}
+
+void
+RaiseConversionError(ConversionResult cr)
+{
+    throw UTFConversionException(__FILE__, __LINE__, cr == sourceExhausted ? partialCharacter : badEncoding);
+}
+
+//
+// Converts [first, last) into data, sized for at most size code points.
+// Returns the number of code points written.
+//
+template<typename SourceEncoding, typename StorageEncoding>
+size_t
+Transcode(const typename SourceEncoding::CodeUnit* first, const typename SourceEncoding::CodeUnit* last,
+          vector<Byte>& data, size_t size, ConversionFlags flags)
+{
+    typedef typename StorageEncoding::CodeUnit Unit;
+
+    data.resize(size * sizeof(Unit));
+    if (size == 0)
+    {
+        return 0;
+    }
+
+    Unit* target = reinterpret_cast<Unit*>(&data[0]);
+    Unit* targetStart = target;
+    ConversionResult cr = Transcoder<SourceEncoding, StorageEncoding>::Convert(
+        first, last, targetStart, target + size, flags);
+    if (cr != conversionOK || first != last)
+    {
+        RaiseConversionError(cr == conversionOK ? sourceIllegal : cr);
+    }
+    size_t written = static_cast<size_t>(targetStart - target);
+    data.resize(written * sizeof(Unit));
+    return written;
+}
+
+template<typename TargetEncoding, typename charT>
+void
+Export(const vector<Byte>& data, size_t size, int width, basic_string<charT>& target)
+{
+    const Byte* p = data.empty() ? 0 : &data[0];
+    switch (width)
+    {
+        case 1:
+            Transcoder<Latin1Storage, TargetEncoding>::Convert(p, p + size, target, lenientConversion);
+            break;
+        case 2:
+        {
+            const UTF16* first = reinterpret_cast<const UTF16*>(p);
+            Transcoder<UCS2Storage, TargetEncoding>::Convert(first, first + size, target, lenientConversion);
+            break;
+        }
+        default:
+        {
+            const UTF32* first = reinterpret_cast<const UTF32*>(p);
+            Transcoder<UCS4Storage, TargetEncoding>::Convert(first, first + size, target, lenientConversion);
+            break;
+        }
+    }
+}
+
+}
+
+CompactString::CompactString() :
+    m_size(0),
+    m_width(1)
+{
+}
+
+CompactString::CompactString(const string& utf8, ConversionFlags flags) :
+    m_size(0),
+    m_width(1)
+{
+    FromUTF8(utf8.data(), utf8.data() + utf8.size(), flags).Swap(*this);
+}
+
+CompactString::CompactString(const wstring& wstr, ConversionFlags flags) :
+    m_size(0),
+    m_width(1)
+{
+    const wchar_t* first = wstr.data();
+    const wchar_t* last = first + wstr.size();
+
+    UTF32 bits = OrUnits(first, last);
+    if (bits < 0x100)
+    {
+        m_size = Transcode<WstringEncoding, Latin1Storage>(first, last, m_data, wstr.size(), flags);
+    }
+    else if (bits < 0x10000 && sizeof(wchar_t) == 4)
+    {
+        m_width = 2;
+        m_size = Transcode<WstringEncoding, UCS2Storage>(first, last, m_data, wstr.size(), flags);
+    }
+    else
+    {
+        //
+        // Surrogate pairs or replaced characters: decode first, then narrow.
+        //
+        vector<Byte> data;
+        size_t size = Transcode<WstringEncoding, UCS4Storage>(first, last, data, wstr.size(), flags);
+        const UTF32* codePoints = data.empty() ? 0 : reinterpret_cast<const UTF32*>(&data[0]);
+        Assign(codePoints, codePoints + size);
+    }
+}
+
+CompactString
+CompactString::FromUTF8(const char* first, const char* last, ConversionFlags flags)
+{
+    const Byte* source = reinterpret_cast<const Byte*>(first);
+    const Byte* sourceEnd = reinterpret_cast<const Byte*>(last);
+
+    CompactString result;
+    if (FindNonASCII(source, sourceEnd) == sourceEnd)
+    {
+        result.m_data.assign(source, sourceEnd);
+        result.m_size = result.m_data.size();
+        return result;
+    }
+
+    Byte maxByte = MaxByte(source, sourceEnd);
+    size_t size = static_cast<size_t>(sourceEnd - source) - CountContinuationBytes(source, sourceEnd);
+    if (maxByte < 0xC4)
+    {
+        result.m_size = Transcode<UTF8Encoding, Latin1Storage>(source, sourceEnd, result.m_data, size, flags);
+    }
+    else if (maxByte < 0xF0)
+    {
+        result.m_width = 2;
+        result.m_size = Transcode<UTF8Encoding, UCS2Storage>(source, sourceEnd, result.m_data, size, flags);
+    }
+    else
+    {
+        result.m_width = 4;
+        result.m_size = Transcode<UTF8Encoding, UCS4Storage>(source, sourceEnd, result.m_data, size, flags);
+    }
+    return result;
+}
+
+CompactString
+CompactString::FromCodePoints(const UTF32* first, const UTF32* last)
+{
+    CompactString result;
+    result.Assign(first, last);
+    return result;
+}
+
+string
+CompactString::ToUTF8() const
+{
+    string result;
+    Export<UTF8Encoding>(m_data, m_size, m_width, result);
+    return result;
+}
+
+wstring
+CompactString::ToWstring() const
+{
+    wstring result;
+    Export<WstringEncoding>(m_data, m_size, m_width, result);
+    return result;
+}
+
+CompactString
+CompactString::Substr(size_t pos, size_t count) const
+{
+    pos = std::min(pos, m_size);
+    count = std::min(count, m_size - pos);
+
+    CompactString result;
+    if (count == 0)
+    {
+        return result;
+    }
+
+    const Byte* p = &m_data[0];
+    switch (m_width)
+    {
+        case 1:
+            result.m_data.assign(p + pos, p + pos + count);
+            result.m_size = count;
+            break;
+        case 2:
+        {
+            const UTF16* first = reinterpret_cast<const UTF16*>(p) + pos;
+            result.Assign(first, first + count);
+            break;
+        }
+        default:
+        {
+            const UTF32* first = reinterpret_cast<const UTF32*>(p) + pos;
+            result.Assign(first, first + count);
+            break;
+        }
+    }
+    return result;
+}
+
+bool
+CompactString::operator==(const CompactString& rhs) const
+{
+    return m_width == rhs.m_width && m_data == rhs.m_data;
+}
+
+bool
+CompactString::operator!=(const CompactString& rhs) const
+{
+    return !operator==(rhs);
+}
+
+bool
+CompactString::operator<(const CompactString& rhs) const
+{
+    if (m_width == 1 && rhs.m_width == 1)
+    {
+        return m_data < rhs.m_data;
+    }
+
+    size_t size = std::min(m_size, rhs.m_size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        UTF32 a = (*this)[i];
+        UTF32 b = rhs[i];
+        if (a != b)
+        {
+            return a < b;
+        }
+    }
+    return m_size < rhs.m_size;
+}
+
+void
+CompactString::Swap(CompactString& rhs)
+{
+    m_data.swap(rhs.m_data);
+    std::swap(m_size, rhs.m_size);
+    std::swap(m_width, rhs.m_width);
+}
+
+template<typename unitT>
+void
+CompactString::Assign(const unitT* first, const unitT* last)
+{
+    m_size = static_cast<size_t>(last - first);
+    m_width = WidthFor(OrUnits(first, last));
+    m_data.resize(m_size * m_width);
+    if (m_size == 0)
+    {
+        return;
+    }
+
+    switch (m_width)
+    {
+        case 1:
+            std::copy(first, last, &m_data[0]);
+            break;
+        case 2:
+            std::copy(first, last, reinterpret_cast<UTF16*>(&m_data[0]));
+            break;
+        default:
+            std::copy(first, last, reinterpret_cast<UTF32*>(&m_data[0]));
+            break;
+    }
+}
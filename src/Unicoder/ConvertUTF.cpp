@@ -215,9 +215,9 @@ Boolean IsLegalUTF8(const UTF8 *source, int length) {
         switch (*source) {
             /* no fall-through in this inner switch */
             case 0xE0: if (a < 0xA0) return false; break;
-            case 0xED: if (a > 0x9F) return false; break;
+            case 0xED: if (a < 0x80 || a > 0x9F) return false; break;
             case 0xF0: if (a < 0x90) return false; break;
-            case 0xF4: if (a > 0x8F) return false; break;
+            case 0xF4: if (a < 0x80 || a > 0x8F) return false; break;
             default:   if (a < 0x80) return false;
         }
 
@@ -447,10 +447,12 @@ using namespace UtilInternal;
  * This is not used here; it's just exported.
  */
 Boolean IsLegalUTF8Sequence(const UTF8 *source, const UTF8 *sourceEnd) {
-    if (source == sourceEnd) {
-        return true;
-    }
     while (true) {
+        /* Runs of ASCII are always legal; skip them in bulk. */
+        source = FindNonASCII(source, sourceEnd);
+        if (source == sourceEnd) {
+            return true;
+        }
         int length = trailingBytesForUTF8[*source]+1;
         // Is buffer big enough to contain character?
         if (source+length > sourceEnd) {
@@ -460,11 +462,7 @@ Boolean IsLegalUTF8Sequence(const UTF8 *source, const UTF8 *sourceEnd) {
         if (!IsLegalUTF8(source, length)) {
             return false;
         }
-        // Are we at end of buffer?
         source += length;
-        if (source == sourceEnd) {
-            return true;
-        }
     }
 }
 
@@ -0,0 +1,278 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/DisplayWidth.h>
+#include <Unicoder/Transcoder.h>
+#include <Unicoder/CharacterProperties.h>
+#include <Util/Bits.h>
+
+#include "WidthData.h"
+
+#include <algorithm>
+
+#if defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+const UTF32 zeroWidthJoiner = 0x200D;
+const UTF32 variationSelector16 = 0xFE0F;
+
+inline uint8
+GetWidthValue(UTF32 cp)
+{
+    return static_cast<uint8>((GetCharacterRecord(cp) >> characterWidthShift) & characterWidthMask);
+}
+
+inline bool
+IsControl(UTF32 cp)
+{
+    return cp < 0x20 || (cp >= 0x7F && cp < 0xA0);
+}
+
+//
+// Number of bytes in the ASCII run [begin, end) that are not control
+// characters (below 0x20 or 0x7F).
+//
+size_t
+CountPrintableASCII(const Byte* begin, const Byte* end)
+{
+    size_t controls = 0;
+    size_t size = static_cast<size_t>(end - begin);
+
+#if defined(ARCH_CPU_SSE2)
+    const __m128i space = _mm_set1_epi8(0x20);
+    const __m128i del = _mm_set1_epi8(0x7F);
+    for (; end - begin >= 16; begin += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        __m128i control = _mm_or_si128(_mm_cmplt_epi8(v, space), _mm_cmpeq_epi8(v, del));
+        controls += Bits::PopCount32(static_cast<uint32>(_mm_movemask_epi8(control)));
+    }
+#elif defined(ARCH_CPU_NEON)
+    const uint8x16_t space = vdupq_n_u8(0x20);
+    const uint8x16_t del = vdupq_n_u8(0x7F);
+    const uint8x16_t one = vdupq_n_u8(1);
+    for (; end - begin >= 16; begin += 16)
+    {
+        uint8x16_t v = vld1q_u8(begin);
+        uint8x16_t control = vandq_u8(vorrq_u8(vcltq_u8(v, space), vceqq_u8(v, del)), one);
+        uint64x2_t total = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(control)));
+        controls += static_cast<size_t>(vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1));
+    }
+#endif
+
+    for (; begin != end; ++begin)
+    {
+        controls += *begin < 0x20 || *begin == 0x7F;
+    }
+    return size - controls;
+}
+
+//
+// Measures [p, last) up to the first character that does not fit in
+// columns any more and returns where it stopped.
+//
+const Byte*
+Measure(const Byte* p, const Byte* last, size_t columns, size_t& width)
+{
+    width = 0;
+
+    //
+    // The previous character if U+FE0F makes it wide, with the width
+    // before it, and whether the previous character was a ZWJ: an emoji
+    // after it is part of an emoji ZWJ sequence and takes no columns of
+    // its own.
+    //
+    const Byte* emoji = 0;
+    size_t emojiWidth = 0;
+    bool afterJoiner = false;
+
+    while (p != last)
+    {
+        if (*p < 0x80)
+        {
+            afterJoiner = false;
+            const Byte* run = FindNonASCII(p, last);
+            while (p != run)
+            {
+                size_t available = columns - width;
+                if (available == 0)
+                {
+                    while (p != run && (*p < 0x20 || *p == 0x7F))
+                    {
+                        ++p;
+                    }
+                    if (p != run)
+                    {
+                        return p;
+                    }
+                    break;
+                }
+                const Byte* chunk = p + std::min(static_cast<size_t>(run - p), available);
+                width += CountPrintableASCII(p, chunk);
+                p = chunk;
+            }
+            Byte b = p[-1];
+            emoji = b >= 0x20 && b != 0x7F && (GetWidthValue(b) & widthEmojiVariation) ? p - 1 : 0;
+            emojiWidth = width - 1;
+            continue;
+        }
+
+        const Byte* start = p;
+        UTF32 cp;
+        size_t cpWidth;
+        if (UTF8Encoding::Decode(p, last, cp, strictConversion) != conversionOK)
+        {
+            ++p;
+            afterJoiner = false;
+            cpWidth = 1;
+            if (width + cpWidth > columns)
+            {
+                return start;
+            }
+            width += cpWidth;
+            emoji = 0;
+            continue;
+        }
+
+        uint8 value = GetWidthValue(cp);
+        if (afterJoiner)
+        {
+            afterJoiner = false;
+            if ((value & widthMask) == 2 || (value & widthEmojiVariation))
+            {
+                emoji = 0;
+                continue;
+            }
+        }
+        if (cp == zeroWidthJoiner)
+        {
+            afterJoiner = true;
+            emoji = 0;
+            continue;
+        }
+        if (cp == variationSelector16)
+        {
+            if (emoji != 0)
+            {
+                if (width + 1 > columns)
+                {
+                    //
+                    // The emoji does not fit once it is wide.
+                    //
+                    width = emojiWidth;
+                    return emoji;
+                }
+                width += 1;
+                emoji = 0;
+            }
+            continue;
+        }
+        if (IsControl(cp))
+        {
+            emoji = 0;
+            continue;
+        }
+
+        cpWidth = value & widthMask;
+        if (width + cpWidth > columns)
+        {
+            return start;
+        }
+        emoji = cpWidth != 0 && (value & widthEmojiVariation) ? start : 0;
+        emojiWidth = width;
+        width += cpWidth;
+    }
+    return p;
+}
+
+}
+
+int
+Util::CodePointWidth(UTF32 cp)
+{
+    if (cp >= 0x20 && cp < 0x7F)
+    {
+        return 1;
+    }
+    if (cp == 0)
+    {
+        return 0;
+    }
+    if (IsControl(cp))
+    {
+        return -1;
+    }
+    if (cp >= characterLimit)
+    {
+        return 1;
+    }
+    return GetWidthValue(cp) & widthMask;
+}
+
+size_t
+Util::DisplayWidth(const char* first, const char* last)
+{
+    size_t width;
+    Measure(reinterpret_cast<const Byte*>(first), reinterpret_cast<const Byte*>(last), static_cast<size_t>(-1), width);
+    return width;
+}
+
+size_t
+Util::DisplayWidth(const string& utf8)
+{
+    return DisplayWidth(utf8.data(), utf8.data() + utf8.size());
+}
+
+size_t
+Util::ColumnTruncationLength(const char* utf8, size_t size, size_t columns, size_t* width)
+{
+    size_t measured;
+    const Byte* first = reinterpret_cast<const Byte*>(utf8);
+    const Byte* end = Measure(first, first + size, columns, measured);
+    if (width != 0)
+    {
+        *width = measured;
+    }
+    return static_cast<size_t>(end - first);
+}
+
+string
+Util::TruncateToColumns(const string& utf8, size_t columns)
+{
+    return utf8.substr(0, ColumnTruncationLength(utf8.data(), utf8.size(), columns));
+}
+
+string
+Util::PadToColumns(const string& utf8, size_t columns, ColumnAlignment alignment, char fill)
+{
+    size_t width;
+    size_t length = ColumnTruncationLength(utf8.data(), utf8.size(), columns, &width);
+
+    string result;
+    result.reserve(length + columns - width);
+    if (alignment == alignRight)
+    {
+        result.append(columns - width, fill);
+    }
+    result.append(utf8, 0, length);
+    if (alignment == alignLeft)
+    {
+        result.append(columns - width, fill);
+    }
+    return result;
+}
@@ -0,0 +1,934 @@
+#!/usr/bin/perl
+# **********************************************************************
+#
+# Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+#
+# <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+#
+# **********************************************************************
+
+#
+# Generates the Unicode property tables of the Unicoder module from the
+# Unicode Character Database that ships with Perl (Unicode::UCD and
+# Unicode::Normalize), so no UCD text files need to be downloaded.
+#
+# Usage: perl MakeUnicodeTables.pl [source directory [include directory]]
+#
+# The generated headers are checked in; rerun this script (with a Perl
+# whose Unicode version is the one wanted) to update them. CharacterData.h,
+# included by CharacterProperties.h, goes to include/Unicoder, the others
+# next to the sources that use them.
+#
+
+use strict;
+use warnings;
+use feature qw(fc unicode_strings);
+
+use File::Spec;
+use Unicode::UCD qw(prop_invmap prop_invlist prop_value_aliases);
+use Unicode::Normalize qw(getCanon getCompat getComposite getCombinClass
+                          isNFD_NO isNFKD_NO isNFC_NO isNFC_MAYBE isNFKC_NO isNFKC_MAYBE
+                          isComp_Ex);
+
+my $outputDir = shift || (File::Spec->splitpath(File::Spec->rel2abs($0)))[1];
+my $includeDir = shift || File::Spec->catdir($outputDir, File::Spec->updir(), File::Spec->updir(), 'include', 'Unicoder');
+my $unicodeVersion = Unicode::UCD::UnicodeVersion();
+
+my $MAX_CODE_POINT = 0x10FFFF;
+
+#
+# Helpers
+#
+
+sub OpenHeader
+{
+    my ($name, $guard, $public) = @_;
+    my $path = File::Spec->catfile($public ? $includeDir : $outputDir, $name);
+    open(my $fh, '>', $path) or die "cannot write $path: $!";
+    binmode($fh);
+    my $scope = $public ? "namespace UtilInternal\n{\n" :
+                "//\n// Only included by the source file that uses the tables.\n//\nnamespace\n{\n";
+    print $fh <<EOF;
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+//
+// Generated by MakeUnicodeTables.pl from the Unicode Character Database
+// $unicodeVersion - do not edit.
+//
+
+#ifndef $guard
+#define $guard
+
+#include <Util/Config.h>
+#include <Unicoder/ConvertUTF.h>
+
+${scope}
+EOF
+    return $fh;
+}
+
+sub CloseHeader
+{
+    my ($fh) = @_;
+    print $fh "}\n\n#endif\n";
+    close($fh);
+}
+
+#
+# Writes a C array, width is the number of hex digits per element. The
+# qualifiers default to static const.
+#
+sub WriteArray
+{
+    my ($fh, $type, $name, $width, $values, $qualifiers) = @_;
+    my $perLine = $width <= 2 ? 16 : $width <= 4 ? 12 : $width <= 8 ? 8 : 4;
+    my $format = $width <= 8 ? "0x%0${width}X" : "UTIL_UINT64(0x%0${width}X)";
+    $qualifiers = 'static const' if !defined $qualifiers;
+    print $fh "$qualifiers $type ${name}[" . scalar(@$values) . "] =\n{\n";
+    for (my $i = 0; $i < @$values; $i += $perLine)
+    {
+        my $last = $i + $perLine - 1;
+        $last = $#$values if $last > $#$values;
+        print $fh "    " . join(", ", map { sprintf($format, $_) } @$values[$i .. $last]);
+        print $fh "," if $last < $#$values;
+        print $fh "\n";
+    }
+    print $fh "};\n\n";
+}
+
+#
+# Splits the per code point values into blocks of 2^shift entries and
+# stores each distinct block once: value(cp) = data[index[cp >> shift] + (cp & mask)].
+# Returns references to the index and the data arrays.
+#
+sub TwoStageTable
+{
+    my ($values, $shift) = @_;
+    my $blockSize = 1 << $shift;
+    my (@index, @data, %blocks);
+    for (my $start = 0; $start < @$values; $start += $blockSize)
+    {
+        my @block = @$values[$start .. $start + $blockSize - 1];
+        my $key = join(',', @block);
+        if (!exists $blocks{$key})
+        {
+            $blocks{$key} = scalar(@data);
+            push(@data, @block);
+        }
+        push(@index, $blocks{$key});
+    }
+    return (\@index, \@data);
+}
+
+#
+# Number of code points the table has to cover: everything above the last
+# code point whose value differs from the default maps to the default.
+#
+sub TableLimit
+{
+    my ($values, $shift, $default) = @_;
+    my $last = $#$values;
+    $last-- while $last >= 0 && $values->[$last] == $default;
+    my $blockSize = 1 << $shift;
+    return (int($last / $blockSize) + 1) * $blockSize;
+}
+
+#
+# Expands the inversion map of a property into a per code point array.
+#
+sub PropertyValues
+{
+    my ($property) = @_;
+    my ($ranges, $values) = prop_invmap($property);
+    die "no property $property" if !$ranges;
+    my @result;
+    for my $i (0 .. $#$ranges)
+    {
+        my $end = $i < $#$ranges ? $ranges->[$i + 1] - 1 : $MAX_CODE_POINT;
+        $result[$_] = $values->[$i] for $ranges->[$i] .. $end;
+    }
+    return \@result;
+}
+
+#
+# Expands the inversion list of a binary property into its code points.
+#
+sub ExpandInvlist
+{
+    my ($property) = @_;
+    my @list = prop_invlist($property);
+    my @result;
+    for (my $i = 0; $i < @list; $i += 2)
+    {
+        my $end = $i + 1 < @list ? $list[$i + 1] - 1 : $MAX_CODE_POINT;
+        push(@result, $list[$i] .. $end);
+    }
+    return @result;
+}
+
+#
+# NormalizationData.h
+#
+
+sub IsHangulSyllable
+{
+    my ($cp) = @_;
+    return $cp >= 0xAC00 && $cp < 0xAC00 + 11172;
+}
+
+#
+# Returns the normalization properties of every code point, stored in the
+# character records.
+#
+sub WriteNormalizationData
+{
+    my @properties = (0) x ($MAX_CODE_POINT + 1);
+    my (@decompositions, @decompositionData, %mappingOffsets);
+    my @compositions;
+
+    my $mappingOf = sub
+    {
+        my ($string) = @_;
+        my @cps = map { ord } split(//, $string);
+        my $key = join(',', @cps);
+        if (!exists $mappingOffsets{$key})
+        {
+            $mappingOffsets{$key} = scalar(@decompositionData);
+            push(@decompositionData, @cps);
+        }
+        die "decomposition too long" if @cps > 31;
+        return ($mappingOffsets{$key} << 5) | scalar(@cps);
+    };
+
+    for my $cp (0 .. $MAX_CODE_POINT)
+    {
+        next if $cp >= 0xD800 && $cp <= 0xDFFF;
+
+        my $value = getCombinClass($cp);
+        $value |= 0x0100 if isNFD_NO($cp);
+        $value |= 0x0200 if isNFKD_NO($cp);
+        $value |= 0x0400 if isNFC_NO($cp);
+        $value |= 0x0800 if isNFC_MAYBE($cp);
+        $value |= 0x1000 if isNFKC_NO($cp);
+        $value |= 0x2000 if isNFKC_MAYBE($cp);
+        $properties[$cp] = $value;
+
+        next if IsHangulSyllable($cp);
+
+        my $canonical = getCanon($cp);
+        my $compat = getCompat($cp);
+        if (defined $compat)
+        {
+            push(@decompositions, [$cp,
+                                   defined $canonical ? $mappingOf->($canonical) : 0,
+                                   $mappingOf->($compat)]);
+        }
+
+        #
+        # Primary composites: two code point canonical mappings that are
+        # not excluded from composition.
+        #
+        if (defined $canonical)
+        {
+            my $raw = Unicode::UCD::charinfo($cp)->{decomposition};
+            if ($raw !~ /^</)
+            {
+                my @parts = map { hex } split(' ', $raw);
+                if (@parts == 2)
+                {
+                    my $composite = getComposite($parts[0], $parts[1]);
+                    if (defined $composite && $composite == $cp && !isComp_Ex($cp))
+                    {
+                        push(@compositions, [@parts, $cp]);
+                    }
+                }
+            }
+        }
+    }
+
+    @compositions = sort { $a->[0] <=> $b->[0] || $a->[1] <=> $b->[1] } @compositions;
+
+    my $fh = OpenHeader('NormalizationData.h', 'UTIL_NORMALIZATION_DATA_H');
+    print $fh <<EOF;
+//
+// The normalization properties of a code point are in its character
+// record (CharacterData.h): bits 0-7 are the canonical combining class,
+// the others are the quick check values below.
+//
+const uint16 normalizationNFDNo     = 0x0100;
+const uint16 normalizationNFKDNo    = 0x0200;
+const uint16 normalizationNFCNo     = 0x0400;
+const uint16 normalizationNFCMaybe  = 0x0800;
+const uint16 normalizationNFKCNo    = 0x1000;
+const uint16 normalizationNFKCMaybe = 0x2000;
+
+EOF
+    print $fh <<EOF;
+//
+// Full (recursively applied) decompositions of every code point but the
+// Hangul syllables, sorted by code point. canonical and compat are
+// (offset << 5) | length into decompositionData; canonical is 0 if the code
+// point only has a compatibility decomposition.
+//
+struct DecompositionEntry
+{
+    UtilInternal::UTF32 codePoint;
+    uint32 canonical;
+    uint32 compat;
+};
+
+static const DecompositionEntry decompositions[${\ scalar(@decompositions)}] =
+{
+EOF
+    for my $i (0 .. $#decompositions)
+    {
+        my $entry = $decompositions[$i];
+        printf $fh "    { 0x%05X, 0x%06X, 0x%06X }%s\n", @$entry, $i < $#decompositions ? ',' : '';
+    }
+    print $fh "};\n\n";
+    WriteArray($fh, 'UtilInternal::UTF32', 'decompositionData', 5, \@decompositionData);
+
+    print $fh <<EOF;
+//
+// Primary composites but the Hangul syllables, sorted by first and second
+// code point.
+//
+struct CompositionEntry
+{
+    UtilInternal::UTF32 first;
+    UtilInternal::UTF32 second;
+    UtilInternal::UTF32 composite;
+};
+
+static const CompositionEntry compositions[${\ scalar(@compositions)}] =
+{
+EOF
+    for my $i (0 .. $#compositions)
+    {
+        printf $fh "    { 0x%05X, 0x%05X, 0x%05X }%s\n", @{$compositions[$i]}, $i < $#compositions ? ',' : '';
+    }
+    print $fh "};\n\n";
+    CloseHeader($fh);
+
+    printf("NormalizationData.h: %d decompositions, %d compositions\n",
+           scalar(@decompositions), scalar(@compositions));
+    return \@properties;
+}
+
+#
+# CaseData.h
+#
+
+#
+# Returns the index in caseRecords of every code point, stored in the
+# character records; Cased and Case_Ignorable are there already.
+#
+sub WriteCaseData
+{
+    my (@recordIndex, @records, %recordKeys, @specialData, %specialOffsets);
+    my $special = sub
+    {
+        my (@cps) = @_;
+        my $key = join(',', @cps);
+        if (!exists $specialOffsets{$key})
+        {
+            $specialOffsets{$key} = scalar(@specialData);
+            push(@specialData, @cps);
+        }
+        die "case mapping too long" if @cps > 3;
+        return ($specialOffsets{$key} << 2) | scalar(@cps);
+    };
+
+    #
+    # A mapping to a single code point is stored as a delta, longer ones
+    # as (offset << 2) | length into caseSpecialData plus a flag.
+    #
+    my $map = sub
+    {
+        my ($cp, $string, $flag, $flags) = @_;
+        my @cps = map { ord } split(//, $string);
+        if (@cps == 1)
+        {
+            return $cps[0] - $cp;
+        }
+        $$flags |= $flag;
+        return $special->(@cps);
+    };
+
+    for my $cp (0 .. $MAX_CODE_POINT)
+    {
+        my ($lower, $upper, $fold, $flags) = (0, 0, 0, 0);
+        if ($cp < 0xD800 || $cp > 0xDFFF)
+        {
+            my $c = chr($cp);
+            $lower = $map->($cp, lc($c), 0x01, \$flags);
+            $upper = $map->($cp, uc($c), 0x02, \$flags);
+            $fold = $map->($cp, fc($c), 0x04, \$flags);
+        }
+        my $key = "$lower,$upper,$fold,$flags";
+        if (!exists $recordKeys{$key})
+        {
+            $recordKeys{$key} = scalar(@records);
+            push(@records, [$lower, $upper, $fold, $flags]);
+        }
+        push(@recordIndex, $recordKeys{$key});
+    }
+    die "too many case records" if @records > 0x1000;
+
+    my $fh = OpenHeader('CaseData.h', 'UTIL_CASE_DATA_H');
+    print $fh <<EOF;
+//
+// Full case mappings (SpecialCasing.txt without the conditional and
+// language specific entries) and full case folding (status C + F). The
+// character record of a code point (CharacterData.h) holds the index of
+// its CaseRecord, record 0 is no mapping. lower, upper and fold are deltas
+// to the mapped code point unless the matching special flag is set, then
+// they are (offset << 2) | length into caseSpecialData.
+//
+const uint8 caseLowerSpecial = 0x01;
+const uint8 caseUpperSpecial = 0x02;
+const uint8 caseFoldSpecial  = 0x04;
+
+struct CaseRecord
+{
+    int32 lower;
+    int32 upper;
+    int32 fold;
+    uint8 flags;
+};
+
+static const CaseRecord caseRecords[${\ scalar(@records)}] =
+{
+EOF
+    for my $i (0 .. $#records)
+    {
+        printf $fh "    { %d, %d, %d, 0x%02X }%s\n", @{$records[$i]}, $i < $#records ? ',' : '';
+    }
+    print $fh "};\n\n";
+    WriteArray($fh, 'UtilInternal::UTF32', 'caseSpecialData', 5, \@specialData);
+    CloseHeader($fh);
+
+    printf("CaseData.h: %d records, %d special code points\n", scalar(@records), scalar(@specialData));
+    return \@recordIndex;
+}
+
+#
+# SegmentationData.h
+#
+
+#
+# Returns the segmentation properties of every code point, stored in the
+# character records.
+#
+sub WriteSegmentationData
+{
+    my @graphemeBreaks = qw(Other CR LF Control Extend ZWJ Regional_Indicator Prepend SpacingMark L V T LV LVT);
+    my @wordBreaks = qw(Other CR LF Newline Extend ZWJ Regional_Indicator Format Katakana Hebrew_Letter ALetter
+                        Single_Quote Double_Quote MidNumLet MidLetter MidNum Numeric ExtendNumLet WSegSpace);
+    my %graphemeValue = map { $graphemeBreaks[$_] => $_ } 0 .. $#graphemeBreaks;
+    my %wordValue = map { $wordBreaks[$_] => $_ } 0 .. $#wordBreaks;
+
+    my $gcb = PropertyValues('GCB');
+    my $wb = PropertyValues('WB');
+    my $gc = PropertyValues('gc');
+    my $pictographic = PropertyValues('Extended_Pictographic');
+
+    my @values;
+    for my $cp (0 .. $MAX_CODE_POINT)
+    {
+        #
+        # Perl folds Extended_Pictographic into GCB and WB, and tailors WB
+        # for horizontal white space; undo both.
+        #
+        my $grapheme = $gcb->[$cp];
+        $grapheme = 'Other' if $grapheme eq 'ExtPict_XX';
+        my $word = $wb->[$cp];
+        $word = 'Other' if $word eq 'ExtPict_XX';
+        $word = 'ALetter' if $word eq 'ExtPict_LE';
+        if ($word eq 'Perl_Tailored_HSpace')
+        {
+            # WSegSpace is Zs without the <noBreak> spaces (U+202F is ExtendNumLet).
+            my $noBreak = $cp == 0xA0 || $cp == 0x2007;
+            $word = $gc->[$cp] eq 'Zs' && !$noBreak ? 'WSegSpace' : 'Other';
+        }
+        die sprintf("unknown GCB %s of U+%04X", $grapheme, $cp) if !exists $graphemeValue{$grapheme};
+        die sprintf("unknown WB %s of U+%04X", $word, $cp) if !exists $wordValue{$word};
+
+        my $value = $graphemeValue{$grapheme} | ($wordValue{$word} << 4);
+        $value |= 0x200 if $pictographic->[$cp] eq 'Y';
+        push(@values, $value);
+    }
+
+    my $fh = OpenHeader('SegmentationData.h', 'UTIL_SEGMENTATION_DATA_H');
+    print $fh "//\n";
+    print $fh "// The segmentation properties of a code point are in its character record\n";
+    print $fh "// (CharacterData.h): Grapheme_Cluster_Break (bits 0-3), Word_Break (bits\n";
+    print $fh "// 4-8) and Extended_Pictographic (bit 9) of UAX #29.\n";
+    print $fh "//\n";
+    print $fh "const uint16 segmentationGraphemeMask = 0x00F;\n";
+    print $fh "const int segmentationWordShift = 4;\n";
+    print $fh "const uint16 segmentationWordMask = 0x1F0;\n";
+    print $fh "const uint16 segmentationPictographic = 0x200;\n\n";
+
+    my $enum = sub
+    {
+        my ($name, $prefix, $names) = @_;
+        print $fh "enum $name\n{\n";
+        for my $i (0 .. $#$names)
+        {
+            (my $value = $names->[$i]) =~ s/_//g;
+            print $fh "    $prefix$value" . ($i < $#$names ? ",\n" : "\n");
+        }
+        print $fh "};\n\n";
+    };
+    $enum->('GraphemeBreak', 'grapheme', \@graphemeBreaks);
+    $enum->('WordBreak', 'word', \@wordBreaks);
+    CloseHeader($fh);
+
+    return \@values;
+}
+
+#
+# WidthData.h
+#
+
+#
+# Returns the width value of every code point, stored in the character
+# records.
+#
+sub WriteWidthData
+{
+    my $gc = PropertyValues('gc');
+    my $ea = PropertyValues('ea');
+    my %emoji = map { $_ => 1 } ExpandInvlist('Emoji');
+    my %presentation = map { $_ => 1 } ExpandInvlist('Emoji_Presentation');
+    my %modifier = map { $_ => 1 } ExpandInvlist('Emoji_Modifier');
+
+    #
+    # The width (bits 0-1) and whether U+FE0F turns the character into a
+    # wide emoji (bit 2).
+    #
+    my @values;
+    for my $cp (0 .. $MAX_CODE_POINT)
+    {
+        my $category = $gc->[$cp];
+        my $width = 1;
+        if ($category =~ /^(Mn|Me|Mc|Zl|Zp)$/ || ($category eq 'Cf' && $cp != 0xAD) ||
+            ($cp >= 0x1160 && $cp <= 0x11FF) || ($cp >= 0xD7B0 && $cp <= 0xD7FF) || $cp == 0x200B ||
+            $modifier{$cp})
+        {
+            $width = 0;
+        }
+        elsif ($ea->[$cp] eq 'W' || $ea->[$cp] eq 'F')
+        {
+            $width = 2;
+        }
+        my $value = $width;
+        $value |= 4 if $width == 1 && $emoji{$cp} && !$presentation{$cp};
+        push(@values, $value);
+    }
+
+    my $fh = OpenHeader('WidthData.h', 'UTIL_WIDTH_DATA_H');
+    print $fh <<EOF;
+//
+// The terminal column width of a code point is in its character record
+// (CharacterData.h). Bits 0-1 hold the width: 0 for combining, enclosing
+// and spacing marks, format characters, Hangul medial vowels / final
+// consonants and emoji skin tone modifiers (they merge with the emoji
+// before them), 2 for East Asian Wide and Fullwidth, 1 otherwise (C0 / C1
+// controls are handled by the code). Bit 2 is set for emoji that become
+// wide when followed by U+FE0F.
+//
+const uint8 widthMask = 0x03;
+const uint8 widthEmojiVariation = 0x04;
+
+EOF
+    CloseHeader($fh);
+
+    return \@values;
+}
+
+#
+# CharacterData.h
+#
+
+sub WriteStringArray
+{
+    my ($fh, $qualifiers, $name, $strings) = @_;
+    print $fh "$qualifiers ${name}[" . scalar(@$strings) . "] =\n{\n";
+    for (my $i = 0; $i < @$strings; $i += 10)
+    {
+        my $last = $i + 9;
+        $last = $#$strings if $last > $#$strings;
+        print $fh "    " . join(", ", map { "\"$_\"" } @$strings[$i .. $last]);
+        print $fh "," if $last < $#$strings;
+        print $fh "\n";
+    }
+    print $fh "};\n\n";
+}
+
+#
+# The character records hold every per code point property: those of
+# CharacterProperties.h and those of the normalization, case mapping,
+# segmentation and width modules, given as arrays of values.
+#
+sub WriteCharacterData
+{
+    my ($normalization, $caseMappings, $segmentation, $widths) = @_;
+    my $DATA_SHIFT = 4;
+    my $INDEX_SHIFT = 6;
+
+    #
+    # Cn first: unassigned code points are the default.
+    #
+    my @categories = qw(Cn Lu Ll Lt Lm Lo Mn Mc Me Nd Nl No Pc Pd Ps Pe Pi Pf Po
+                        Sm Sc Sk So Zs Zl Zp Cc Cf Cs Co);
+    my %categoryValue = map { $categories[$_] => $_ } 0 .. $#categories;
+
+    my $gc = PropertyValues('gc');
+    my $sc = PropertyValues('sc');
+    my $lowercase = PropertyValues('Lowercase');
+    my $uppercase = PropertyValues('Uppercase');
+    my $cased = PropertyValues('Cased');
+    my $caseIgnorable = PropertyValues('Case_Ignorable');
+
+    my %seen;
+    my @scripts = ('Unknown', sort grep { $_ ne 'Unknown' && !$seen{$_}++ } @$sc);
+    my %scriptValue = map { $scripts[$_] => $_ } 0 .. $#scripts;
+    die "too many scripts" if @scripts > 256;
+
+    #
+    # Each code point maps to one of the distinct property records, the
+    # first one is the default.
+    #
+    my @records = (0);
+    my %recordIndex = (0 => 0);
+    my @values;
+    for my $cp (0 .. $MAX_CODE_POINT)
+    {
+        die sprintf("unknown gc %s of U+%04X", $gc->[$cp], $cp) if !exists $categoryValue{$gc->[$cp]};
+        die "normalization properties out of range" if $normalization->[$cp] > 0x3FFF;
+        die "segmentation properties out of range" if $segmentation->[$cp] > 0x3FF;
+        die "width out of range" if $widths->[$cp] > 0x7;
+        die "case mapping out of range" if $caseMappings->[$cp] > 0xFFF;
+        my $record = $categoryValue{$gc->[$cp]};
+        $record |= 0x20 if $lowercase->[$cp] eq 'Y';
+        $record |= 0x40 if $uppercase->[$cp] eq 'Y';
+        $record |= 0x80 if $cased->[$cp] eq 'Y';
+        $record |= 0x100 if $caseIgnorable->[$cp] eq 'Y';
+        $record |= $scriptValue{$sc->[$cp]} << 9;
+        $record |= $normalization->[$cp] << 17;
+        $record |= $segmentation->[$cp] << 31;
+        $record |= $widths->[$cp] << 41;
+        $record |= $caseMappings->[$cp] << 44;
+        die sprintf("combining class of U+%04X", $cp) if (($record >> 17) & 0xFF) != getCombinClass($cp);
+        if (!exists $recordIndex{$record})
+        {
+            $recordIndex{$record} = scalar(@records);
+            push(@records, $record);
+        }
+        push(@values, $recordIndex{$record});
+    }
+    die "too many records" if @records > 0x10000;
+
+    #
+    # Three stages: the block index of a two-stage table is split into
+    # blocks and shared the same way.
+    #
+    my $limit = TableLimit(\@values, $DATA_SHIFT + $INDEX_SHIFT, 0);
+    my @covered = @values[0 .. $limit - 1];
+    my ($blocks, $data) = TwoStageTable(\@covered, $DATA_SHIFT);
+    my ($index1, $index2) = TwoStageTable($blocks, $INDEX_SHIFT);
+    my $indexShift = $DATA_SHIFT + $INDEX_SHIFT;
+
+    #
+    # ISO 15924 codes, in the order of the long script names.
+    #
+    my @codes = map { (prop_value_aliases('sc', $_))[0] } @scripts;
+
+    my $fh = OpenHeader('CharacterData.h', 'UTIL_CHARACTER_DATA_H', 1);
+    print $fh <<EOF;
+//
+// Every per code point property of the Unicoder module, stored once per
+// distinct combination in CharacterTables::records. The record of a code
+// point is found in three stages:
+//
+//     block(cp)  = index2[index1[cp >> characterIndexShift] + ((cp >> characterDataShift) & characterIndexMask)]
+//     record(cp) = records[data[block(cp) + (cp & characterDataMask)]]
+//
+// Code points at or above characterLimit use record 0. A record holds:
+//
+//     bits 0-4    General_Category, in the order of the GeneralCategory enum
+//     bits 5-8    Lowercase, Uppercase, Cased and Case_Ignorable
+//     bits 9-16   Script, an index in scriptCodes
+//     bits 17-30  the normalization properties (NormalizationData.h), the
+//                 canonical combining class in bits 17-24
+//     bits 31-40  the segmentation properties (SegmentationData.h)
+//     bits 41-43  the width (WidthData.h)
+//     bits 44-55  the case mappings, an index in caseRecords (CaseData.h)
+//
+// Included by CharacterProperties.h, which has the lookup.
+//
+const int characterDataShift = $DATA_SHIFT;
+const int characterIndexShift = $indexShift;
+const UTF32 characterDataMask = ${\ ((1 << $DATA_SHIFT) - 1)};
+const UTF32 characterIndexMask = ${\ ((1 << $INDEX_SHIFT) - 1)};
+const UTF32 characterLimit = $limit;
+
+const uint64 characterCategoryMask = 0x1F;
+const uint64 characterLowercase = 0x20;
+const uint64 characterUppercase = 0x40;
+const uint64 characterCased = 0x80;
+const uint64 characterCaseIgnorable = 0x100;
+const int characterScriptShift = 9;
+const uint64 characterScriptMask = 0xFF;
+const int characterCombiningClassShift = 17;
+const uint64 characterCombiningClassMask = 0xFF;
+const int characterNormalizationShift = 17;
+const uint64 characterNormalizationMask = 0x3FFF;
+const int characterSegmentationShift = 31;
+const uint64 characterSegmentationMask = 0x3FF;
+const int characterWidthShift = 41;
+const uint64 characterWidthMask = 0x7;
+const int characterCaseMappingShift = 44;
+const uint64 characterCaseMappingMask = 0xFFF;
+
+//
+// The tables are static members of a class template so that they can be
+// defined in this header, for the lookups to be inline (and constexpr with
+// C++11), and still be stored once in a program.
+//
+template <typename T>
+struct CharacterTables
+{
+    static const char* const categoryNames[${\ scalar(@categories)}];
+    static const char* const scriptCodes[${\ scalar(@codes)}];
+    static const uint16 index1[${\ scalar(@$index1)}];
+    static const uint16 index2[${\ scalar(@$index2)}];
+    static const uint16 data[${\ scalar(@$data)}];
+    static const uint64 records[${\ scalar(@records)}];
+};
+
+EOF
+    my $member = "template <typename T>\nUTIL_CONSTEXPR const";
+    WriteStringArray($fh, "$member char* const", 'CharacterTables<T>::categoryNames', \@categories);
+    WriteStringArray($fh, "$member char* const", 'CharacterTables<T>::scriptCodes', \@codes);
+    WriteArray($fh, 'uint16', 'CharacterTables<T>::index1', 4, $index1, $member);
+    WriteArray($fh, 'uint16', 'CharacterTables<T>::index2', 4, $index2, $member);
+    WriteArray($fh, 'uint16', 'CharacterTables<T>::data', 4, $data, $member);
+    WriteArray($fh, 'uint64', 'CharacterTables<T>::records', 14, \@records, $member);
+    CloseHeader($fh);
+
+    printf("CharacterData.h: %d records, %d + %d + %d entries\n",
+           scalar(@records), scalar(@$index1), scalar(@$index2), scalar(@$data));
+}
+
+#
+# CollationData.h
+#
+
+sub WriteCollationData
+{
+    my $COLLATION_SHIFT = 7;
+
+    #
+    # The DUCET that ships with Unicode::Collate.
+    #
+    my ($allkeys) = grep { -f } map { File::Spec->catfile($_, 'Unicode', 'Collate', 'allkeys.txt') } @INC;
+    die "cannot find Unicode/Collate/allkeys.txt" if !$allkeys;
+    open(my $in, '<', $allkeys) or die "cannot read $allkeys: $!";
+
+    #
+    # A collation element is packed as primary (bits 14-29), secondary
+    # (bits 5-13) and tertiary (bits 0-4); the variable flag is not kept,
+    # variable weighting is non-ignorable.
+    #
+    my $element = sub
+    {
+        my ($primary, $secondary, $tertiary) = @_;
+        die "collation weight out of range" if $primary > 0xFFFF || $secondary > 0x1FF || $tertiary > 0x1F;
+        return ($primary << 14) | ($secondary << 5) | $tertiary;
+    };
+
+    my ($ducetVersion, %entries, %implicitRanges);
+    while (my $line = <$in>)
+    {
+        $line =~ s/#.*//;
+        next if $line !~ /\S/;
+        if ($line =~ /^\@version\s+(\S+)/)
+        {
+            $ducetVersion = $1;
+        }
+        elsif ($line =~ /^\@implicitweights\s+([0-9A-F]+)\.\.([0-9A-F]+);\s*([0-9A-F]+)/)
+        {
+            push(@{$implicitRanges{hex $3}}, [hex $1, hex $2]);
+        }
+        elsif ($line =~ /^([0-9A-F ]+);\s*((?:\[[.*][0-9A-F.]+\])+)/)
+        {
+            my ($sequence, $weights) = ($1, $2);
+            my @cps = map { hex } split(' ', $sequence);
+            my @elements;
+            while ($weights =~ /\[[.*]([0-9A-F]{4})\.([0-9A-F]{4})\.([0-9A-F]{4})\]/g)
+            {
+                push(@elements, $element->(hex $1, hex $2, hex $3));
+            }
+            $entries{join(',', @cps)} = \@elements;
+        }
+        else
+        {
+            die "cannot parse $allkeys: $line";
+        }
+    }
+    close($in);
+
+    #
+    # The implicit weights of the code points without an entry: the kind
+    # selects the base (and origin) in collationImplicitBases.
+    #
+    my @implicitBases = (0xFBC0, 0xFB40, 0xFB80);
+    my @implicitOrigins = (0, 0, 0);
+    my @values = (0) x ($MAX_CODE_POINT + 1);
+    my $unified = PropertyValues('Unified_Ideograph');
+    my $block = PropertyValues('blk');
+    for my $cp (0 .. $MAX_CODE_POINT)
+    {
+        next if $unified->[$cp] ne 'Y';
+        $values[$cp] = $block->[$cp] =~ /^CJK (Unified|Compatibility) Ideographs$/ ? 1 : 2;
+    }
+    for my $base (sort { $a <=> $b } keys %implicitRanges)
+    {
+        my @ranges = sort { $a->[0] <=> $b->[0] } @{$implicitRanges{$base}};
+        push(@implicitBases, $base);
+        push(@implicitOrigins, $ranges[0][0]);
+        for my $range (@ranges)
+        {
+            $values[$_] = $#implicitBases for $range->[0] .. $range->[1];
+        }
+    }
+    my $hangulKind = scalar(@implicitBases);
+    $values[$_] = $hangulKind for 0xAC00 .. 0xAC00 + 11172 - 1;
+
+    my @elements;
+    my %elementOffsets;
+    my $mapping = sub
+    {
+        my ($list) = @_;
+        return 0x40000000 | $list->[0] if @$list == 1;
+        my $key = join(',', @$list);
+        if (!exists $elementOffsets{$key})
+        {
+            $elementOffsets{$key} = scalar(@elements);
+            push(@elements, @$list);
+        }
+        die "expansion too long" if @$list > 31;
+        return 0x80000000 | ($elementOffsets{$key} << 5) | scalar(@$list);
+    };
+
+    #
+    # Contractions: the starter maps to its entries in collationContractions,
+    # longest first and the starter alone last, as triples of the second and
+    # third code point (0 if none) and the mapping.
+    #
+    my %contractions;
+    for my $key (sort keys %entries)
+    {
+        my @cps = split(/,/, $key);
+        push(@{$contractions{$cps[0]}}, \@cps) if @cps > 1;
+        die "contraction too long" if @cps > 3;
+    }
+    my @contractionData;
+    for my $cp (sort { $a <=> $b } keys %contractions)
+    {
+        die sprintf("contraction starter U+%04X has no entry", $cp) if !exists $entries{$cp};
+        my @list = sort { @$b <=> @$a || join(',', @$a) cmp join(',', @$b) } @{$contractions{$cp}};
+        push(@list, [$cp]);
+        die "too many contractions" if @list > 63;
+        my $offset = scalar(@contractionData) / 3;
+        for my $cps (@list)
+        {
+            push(@contractionData, $cps->[1] || 0, $cps->[2] || 0, $mapping->($entries{join(',', @$cps)}));
+        }
+        $values[$cp] = 0xC0000000 | ($offset << 6) | scalar(@list);
+    }
+    for my $key (sort { $a <=> $b } grep { !/,/ } keys %entries)
+    {
+        next if exists $contractions{$key};
+        $values[$key] = $mapping->($entries{$key});
+    }
+    for my $jamo (0x1100 .. 0x1112, 0x1161 .. 0x1175, 0x11A8 .. 0x11C2)
+    {
+        die "Hangul jamo without a single collation element" if ($values[$jamo] & 0xC0000000) != 0x40000000;
+    }
+
+    #
+    # Starters whose canonical decomposition starts with a combining mark:
+    # the only characters besides the marks that normalization can reorder.
+    #
+    my @reordered;
+    for my $cp (0 .. $MAX_CODE_POINT)
+    {
+        next if ($cp >= 0xD800 && $cp <= 0xDFFF) || getCombinClass($cp) != 0;
+        my $decomposition = getCanon($cp);
+        push(@reordered, $cp) if defined $decomposition && getCombinClass(ord($decomposition)) != 0;
+    }
+
+    my $limit = TableLimit(\@values, $COLLATION_SHIFT, 0);
+    my @covered = @values[0 .. $limit - 1];
+    my ($index, $data) = TwoStageTable(\@covered, $COLLATION_SHIFT);
+    die "collation table too large" if @$data > 0x10000;
+
+    my $fh = OpenHeader('CollationData.h', 'UTIL_COLLATION_DATA_H');
+    print $fh <<EOF;
+//
+// The Default Unicode Collation Element Table (DUCET) $ducetVersion of UTS #10.
+//
+//     value(cp) = collationData[collationIndex[cp >> collationShift] + (cp & ((1 << collationShift) - 1))]
+//
+// The top two bits of a value tell what the others are:
+//
+//     collationImplicit     the kind of implicit weights, an index in
+//                           collationImplicitBases, or collationHangul for
+//                           Hangul syllables (weighed as their jamo)
+//     collationSingle       a single collation element
+//     collationExpansion    (offset << 5) | length in collationElements
+//     collationContraction  (offset << 6) | count in collationContractions,
+//                           in triples
+//
+// Code points at or above collationLimit have the implicit weights of
+// kind 0. A collation element holds the primary weight in bits 14-29, the
+// secondary in bits 5-13 and the tertiary in bits 0-4.
+//
+const int collationShift = $COLLATION_SHIFT;
+const UtilInternal::UTF32 collationLimit = $limit;
+
+const uint32 collationTagMask = 0xC0000000;
+const uint32 collationImplicit = 0x00000000;
+const uint32 collationSingle = 0x40000000;
+const uint32 collationExpansion = 0x80000000;
+const uint32 collationContraction = 0xC0000000;
+
+const uint32 collationHangul = $hangulKind;
+
+EOF
+    WriteArray($fh, 'uint16', 'collationImplicitBases', 4, \@implicitBases);
+    WriteArray($fh, 'UtilInternal::UTF32', 'collationImplicitOrigins', 5, \@implicitOrigins);
+    print $fh "//\n// Starters with a canonical decomposition that starts with a combining mark.\n//\n";
+    WriteArray($fh, 'UtilInternal::UTF32', 'collationReorderedStarters', 5, \@reordered);
+    WriteArray($fh, 'uint16', 'collationIndex', 4, $index);
+    WriteArray($fh, 'uint32', 'collationData', 8, $data);
+    WriteArray($fh, 'uint32', 'collationElements', 8, \@elements);
+    WriteArray($fh, 'uint32', 'collationContractions', 8, \@contractionData);
+    CloseHeader($fh);
+
+    printf("CollationData.h: %d blocks, %d expansion elements, %d contractions\n",
+           scalar(@$data) >> $COLLATION_SHIFT, scalar(@elements), scalar(@contractionData) / 3);
+}
+
+WriteCharacterData(WriteNormalizationData(), WriteCaseData(), WriteSegmentationData(), WriteWidthData());
+WriteCollationData();
@@ -0,0 +1,7647 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+//
+// Generated by MakeUnicodeTables.pl from the Unicode Character Database
+// 14.0.0 - do not edit.
+//
+
+#ifndef UTIL_NORMALIZATION_DATA_H
+#define UTIL_NORMALIZATION_DATA_H
+
+#include <Util/Config.h>
+#include <Unicoder/ConvertUTF.h>
+
+//
+// Only included by the source file that uses the tables.
+//
+namespace
+{
+
+//
+// The normalization properties of a code point are in its character
+// record (CharacterData.h): bits 0-7 are the canonical combining class,
+// the others are the quick check values below.
+//
+const uint16 normalizationNFDNo     = 0x0100;
+const uint16 normalizationNFKDNo    = 0x0200;
+const uint16 normalizationNFCNo     = 0x0400;
+const uint16 normalizationNFCMaybe  = 0x0800;
+const uint16 normalizationNFKCNo    = 0x1000;
+const uint16 normalizationNFKCMaybe = 0x2000;
+
+//
+// Full (recursively applied) decompositions of every code point but the
+// Hangul syllables, sorted by code point. canonical and compat are
+// (offset << 5) | length into decompositionData; canonical is 0 if the code
+// point only has a compatibility decomposition.
+//
+struct DecompositionEntry
+{
+    UtilInternal::UTF32 codePoint;
+    uint32 canonical;
+    uint32 compat;
+};
+
+static const DecompositionEntry decompositions[5795] =
+{
+    { 0x000A0, 0x000000, 0x000001 },
+    { 0x000A8, 0x000000, 0x000022 },
+    { 0x000AA, 0x000000, 0x000061 },
+    { 0x000AF, 0x000000, 0x000082 },
+    { 0x000B2, 0x000000, 0x0000C1 },
+    { 0x000B3, 0x000000, 0x0000E1 },
+    { 0x000B4, 0x000000, 0x000102 },
+    { 0x000B5, 0x000000, 0x000141 },
+    { 0x000B8, 0x000000, 0x000162 },
+    { 0x000B9, 0x000000, 0x0001A1 },
+    { 0x000BA, 0x000000, 0x0001C1 },
+    { 0x000BC, 0x000000, 0x0001E3 },
+    { 0x000BD, 0x000000, 0x000243 },
+    { 0x000BE, 0x000000, 0x0002A3 },
+    { 0x000C0, 0x000302, 0x000302 },
+    { 0x000C1, 0x000342, 0x000342 },
+    { 0x000C2, 0x000382, 0x000382 },
+    { 0x000C3, 0x0003C2, 0x0003C2 },
+    { 0x000C4, 0x000402, 0x000402 },
+    { 0x000C5, 0x000442, 0x000442 },
+    { 0x000C7, 0x000482, 0x000482 },
+    { 0x000C8, 0x0004C2, 0x0004C2 },
+    { 0x000C9, 0x000502, 0x000502 },
+    { 0x000CA, 0x000542, 0x000542 },
+    { 0x000CB, 0x000582, 0x000582 },
+    { 0x000CC, 0x0005C2, 0x0005C2 },
+    { 0x000CD, 0x000602, 0x000602 },
+    { 0x000CE, 0x000642, 0x000642 },
+    { 0x000CF, 0x000682, 0x000682 },
+    { 0x000D1, 0x0006C2, 0x0006C2 },
+    { 0x000D2, 0x000702, 0x000702 },
+    { 0x000D3, 0x000742, 0x000742 },
+    { 0x000D4, 0x000782, 0x000782 },
+    { 0x000D5, 0x0007C2, 0x0007C2 },
+    { 0x000D6, 0x000802, 0x000802 },
+    { 0x000D9, 0x000842, 0x000842 },
+    { 0x000DA, 0x000882, 0x000882 },
+    { 0x000DB, 0x0008C2, 0x0008C2 },
+    { 0x000DC, 0x000902, 0x000902 },
+    { 0x000DD, 0x000942, 0x000942 },
+    { 0x000E0, 0x000982, 0x000982 },
+    { 0x000E1, 0x0009C2, 0x0009C2 },
+    { 0x000E2, 0x000A02, 0x000A02 },
+    { 0x000E3, 0x000A42, 0x000A42 },
+    { 0x000E4, 0x000A82, 0x000A82 },
+    { 0x000E5, 0x000AC2, 0x000AC2 },
+    { 0x000E7, 0x000B02, 0x000B02 },
+    { 0x000E8, 0x000B42, 0x000B42 },
+    { 0x000E9, 0x000B82, 0x000B82 },
+    { 0x000EA, 0x000BC2, 0x000BC2 },
+    { 0x000EB, 0x000C02, 0x000C02 },
+    { 0x000EC, 0x000C42, 0x000C42 },
+    { 0x000ED, 0x000C82, 0x000C82 },
+    { 0x000EE, 0x000CC2, 0x000CC2 },
+    { 0x000EF, 0x000D02, 0x000D02 },
+    { 0x000F1, 0x000D42, 0x000D42 },
+    { 0x000F2, 0x000D82, 0x000D82 },
+    { 0x000F3, 0x000DC2, 0x000DC2 },
+    { 0x000F4, 0x000E02, 0x000E02 },
+    { 0x000F5, 0x000E42, 0x000E42 },
+    { 0x000F6, 0x000E82, 0x000E82 },
+    { 0x000F9, 0x000EC2, 0x000EC2 },
+    { 0x000FA, 0x000F02, 0x000F02 },
+    { 0x000FB, 0x000F42, 0x000F42 },
+    { 0x000FC, 0x000F82, 0x000F82 },
+    { 0x000FD, 0x000FC2, 0x000FC2 },
+    { 0x000FF, 0x001002, 0x001002 },
+    { 0x00100, 0x001042, 0x001042 },
+    { 0x00101, 0x001082, 0x001082 },
+    { 0x00102, 0x0010C2, 0x0010C2 },
+    { 0x00103, 0x001102, 0x001102 },
+    { 0x00104, 0x001142, 0x001142 },
+    { 0x00105, 0x001182, 0x001182 },
+    { 0x00106, 0x0011C2, 0x0011C2 },
+    { 0x00107, 0x001202, 0x001202 },
+    { 0x00108, 0x001242, 0x001242 },
+    { 0x00109, 0x001282, 0x001282 },
+    { 0x0010A, 0x0012C2, 0x0012C2 },
+    { 0x0010B, 0x001302, 0x001302 },
+    { 0x0010C, 0x001342, 0x001342 },
+    { 0x0010D, 0x001382, 0x001382 },
+    { 0x0010E, 0x0013C2, 0x0013C2 },
+    { 0x0010F, 0x001402, 0x001402 },
+    { 0x00112, 0x001442, 0x001442 },
+    { 0x00113, 0x001482, 0x001482 },
+    { 0x00114, 0x0014C2, 0x0014C2 },
+    { 0x00115, 0x001502, 0x001502 },
+    { 0x00116, 0x001542, 0x001542 },
+    { 0x00117, 0x001582, 0x001582 },
+    { 0x00118, 0x0015C2, 0x0015C2 },
+    { 0x00119, 0x001602, 0x001602 },
+    { 0x0011A, 0x001642, 0x001642 },
+    { 0x0011B, 0x001682, 0x001682 },
+    { 0x0011C, 0x0016C2, 0x0016C2 },
+    { 0x0011D, 0x001702, 0x001702 },
+    { 0x0011E, 0x001742, 0x001742 },
+    { 0x0011F, 0x001782, 0x001782 },
+    { 0x00120, 0x0017C2, 0x0017C2 },
+    { 0x00121, 0x001802, 0x001802 },
+    { 0x00122, 0x001842, 0x001842 },
+    { 0x00123, 0x001882, 0x001882 },
+    { 0x00124, 0x0018C2, 0x0018C2 },
+    { 0x00125, 0x001902, 0x001902 },
+    { 0x00128, 0x001942, 0x001942 },
+    { 0x00129, 0x001982, 0x001982 },
+    { 0x0012A, 0x0019C2, 0x0019C2 },
+    { 0x0012B, 0x001A02, 0x001A02 },
+    { 0x0012C, 0x001A42, 0x001A42 },
+    { 0x0012D, 0x001A82, 0x001A82 },
+    { 0x0012E, 0x001AC2, 0x001AC2 },
+    { 0x0012F, 0x001B02, 0x001B02 },
+    { 0x00130, 0x001B42, 0x001B42 },
+    { 0x00132, 0x000000, 0x001B82 },
+    { 0x00133, 0x000000, 0x001BC2 },
+    { 0x00134, 0x001C02, 0x001C02 },
+    { 0x00135, 0x001C42, 0x001C42 },
+    { 0x00136, 0x001C82, 0x001C82 },
+    { 0x00137, 0x001CC2, 0x001CC2 },
+    { 0x00139, 0x001D02, 0x001D02 },
+    { 0x0013A, 0x001D42, 0x001D42 },
+    { 0x0013B, 0x001D82, 0x001D82 },
+    { 0x0013C, 0x001DC2, 0x001DC2 },
+    { 0x0013D, 0x001E02, 0x001E02 },
+    { 0x0013E, 0x001E42, 0x001E42 },
+    { 0x0013F, 0x000000, 0x001E82 },
+    { 0x00140, 0x000000, 0x001EC2 },
+    { 0x00143, 0x001F02, 0x001F02 },
+    { 0x00144, 0x001F42, 0x001F42 },
+    { 0x00145, 0x001F82, 0x001F82 },
+    { 0x00146, 0x001FC2, 0x001FC2 },
+    { 0x00147, 0x002002, 0x002002 },
+    { 0x00148, 0x002042, 0x002042 },
+    { 0x00149, 0x000000, 0x002082 },
+    { 0x0014C, 0x0020C2, 0x0020C2 },
+    { 0x0014D, 0x002102, 0x002102 },
+    { 0x0014E, 0x002142, 0x002142 },
+    { 0x0014F, 0x002182, 0x002182 },
+    { 0x00150, 0x0021C2, 0x0021C2 },
+    { 0x00151, 0x002202, 0x002202 },
+    { 0x00154, 0x002242, 0x002242 },
+    { 0x00155, 0x002282, 0x002282 },
+    { 0x00156, 0x0022C2, 0x0022C2 },
+    { 0x00157, 0x002302, 0x002302 },
+    { 0x00158, 0x002342, 0x002342 },
+    { 0x00159, 0x002382, 0x002382 },
+    { 0x0015A, 0x0023C2, 0x0023C2 },
+    { 0x0015B, 0x002402, 0x002402 },
+    { 0x0015C, 0x002442, 0x002442 },
+    { 0x0015D, 0x002482, 0x002482 },
+    { 0x0015E, 0x0024C2, 0x0024C2 },
+    { 0x0015F, 0x002502, 0x002502 },
+    { 0x00160, 0x002542, 0x002542 },
+    { 0x00161, 0x002582, 0x002582 },
+    { 0x00162, 0x0025C2, 0x0025C2 },
+    { 0x00163, 0x002602, 0x002602 },
+    { 0x00164, 0x002642, 0x002642 },
+    { 0x00165, 0x002682, 0x002682 },
+    { 0x00168, 0x0026C2, 0x0026C2 },
+    { 0x00169, 0x002702, 0x002702 },
+    { 0x0016A, 0x002742, 0x002742 },
+    { 0x0016B, 0x002782, 0x002782 },
+    { 0x0016C, 0x0027C2, 0x0027C2 },
+    { 0x0016D, 0x002802, 0x002802 },
+    { 0x0016E, 0x002842, 0x002842 },
+    { 0x0016F, 0x002882, 0x002882 },
+    { 0x00170, 0x0028C2, 0x0028C2 },
+    { 0x00171, 0x002902, 0x002902 },
+    { 0x00172, 0x002942, 0x002942 },
+    { 0x00173, 0x002982, 0x002982 },
+    { 0x00174, 0x0029C2, 0x0029C2 },
+    { 0x00175, 0x002A02, 0x002A02 },
+    { 0x00176, 0x002A42, 0x002A42 },
+    { 0x00177, 0x002A82, 0x002A82 },
+    { 0x00178, 0x002AC2, 0x002AC2 },
+    { 0x00179, 0x002B02, 0x002B02 },
+    { 0x0017A, 0x002B42, 0x002B42 },
+    { 0x0017B, 0x002B82, 0x002B82 },
+    { 0x0017C, 0x002BC2, 0x002BC2 },
+    { 0x0017D, 0x002C02, 0x002C02 },
+    { 0x0017E, 0x002C42, 0x002C42 },
+    { 0x0017F, 0x000000, 0x002C81 },
+    { 0x001A0, 0x002CA2, 0x002CA2 },
+    { 0x001A1, 0x002CE2, 0x002CE2 },
+    { 0x001AF, 0x002D22, 0x002D22 },
+    { 0x001B0, 0x002D62, 0x002D62 },
+    { 0x001C4, 0x000000, 0x002DA3 },
+    { 0x001C5, 0x000000, 0x002E03 },
+    { 0x001C6, 0x000000, 0x002E63 },
+    { 0x001C7, 0x000000, 0x002EC2 },
+    { 0x001C8, 0x000000, 0x002F02 },
+    { 0x001C9, 0x000000, 0x002F42 },
+    { 0x001CA, 0x000000, 0x002F82 },
+    { 0x001CB, 0x000000, 0x002FC2 },
+    { 0x001CC, 0x000000, 0x003002 },
+    { 0x001CD, 0x003042, 0x003042 },
+    { 0x001CE, 0x003082, 0x003082 },
+    { 0x001CF, 0x0030C2, 0x0030C2 },
+    { 0x001D0, 0x003102, 0x003102 },
+    { 0x001D1, 0x003142, 0x003142 },
+    { 0x001D2, 0x003182, 0x003182 },
+    { 0x001D3, 0x0031C2, 0x0031C2 },
+    { 0x001D4, 0x003202, 0x003202 },
+    { 0x001D5, 0x003243, 0x003243 },
+    { 0x001D6, 0x0032A3, 0x0032A3 },
+    { 0x001D7, 0x003303, 0x003303 },
+    { 0x001D8, 0x003363, 0x003363 },
+    { 0x001D9, 0x0033C3, 0x0033C3 },
+    { 0x001DA, 0x003423, 0x003423 },
+    { 0x001DB, 0x003483, 0x003483 },
+    { 0x001DC, 0x0034E3, 0x0034E3 },
+    { 0x001DE, 0x003543, 0x003543 },
+    { 0x001DF, 0x0035A3, 0x0035A3 },
+    { 0x001E0, 0x003603, 0x003603 },
+    { 0x001E1, 0x003663, 0x003663 },
+    { 0x001E2, 0x0036C2, 0x0036C2 },
+    { 0x001E3, 0x003702, 0x003702 },
+    { 0x001E6, 0x003742, 0x003742 },
+    { 0x001E7, 0x003782, 0x003782 },
+    { 0x001E8, 0x0037C2, 0x0037C2 },
+    { 0x001E9, 0x003802, 0x003802 },
+    { 0x001EA, 0x003842, 0x003842 },
+    { 0x001EB, 0x003882, 0x003882 },
+    { 0x001EC, 0x0038C3, 0x0038C3 },
+    { 0x001ED, 0x003923, 0x003923 },
+    { 0x001EE, 0x003982, 0x003982 },
+    { 0x001EF, 0x0039C2, 0x0039C2 },
+    { 0x001F0, 0x003A02, 0x003A02 },
+    { 0x001F1, 0x000000, 0x003A42 },
+    { 0x001F2, 0x000000, 0x003A82 },
+    { 0x001F3, 0x000000, 0x003AC2 },
+    { 0x001F4, 0x003B02, 0x003B02 },
+    { 0x001F5, 0x003B42, 0x003B42 },
+    { 0x001F8, 0x003B82, 0x003B82 },
+    { 0x001F9, 0x003BC2, 0x003BC2 },
+    { 0x001FA, 0x003C03, 0x003C03 },
+    { 0x001FB, 0x003C63, 0x003C63 },
+    { 0x001FC, 0x003CC2, 0x003CC2 },
+    { 0x001FD, 0x003D02, 0x003D02 },
+    { 0x001FE, 0x003D42, 0x003D42 },
+    { 0x001FF, 0x003D82, 0x003D82 },
+    { 0x00200, 0x003DC2, 0x003DC2 },
+    { 0x00201, 0x003E02, 0x003E02 },
+    { 0x00202, 0x003E42, 0x003E42 },
+    { 0x00203, 0x003E82, 0x003E82 },
+    { 0x00204, 0x003EC2, 0x003EC2 },
+    { 0x00205, 0x003F02, 0x003F02 },
+    { 0x00206, 0x003F42, 0x003F42 },
+    { 0x00207, 0x003F82, 0x003F82 },
+    { 0x00208, 0x003FC2, 0x003FC2 },
+    { 0x00209, 0x004002, 0x004002 },
+    { 0x0020A, 0x004042, 0x004042 },
+    { 0x0020B, 0x004082, 0x004082 },
+    { 0x0020C, 0x0040C2, 0x0040C2 },
+    { 0x0020D, 0x004102, 0x004102 },
+    { 0x0020E, 0x004142, 0x004142 },
+    { 0x0020F, 0x004182, 0x004182 },
+    { 0x00210, 0x0041C2, 0x0041C2 },
+    { 0x00211, 0x004202, 0x004202 },
+    { 0x00212, 0x004242, 0x004242 },
+    { 0x00213, 0x004282, 0x004282 },
+    { 0x00214, 0x0042C2, 0x0042C2 },
+    { 0x00215, 0x004302, 0x004302 },
+    { 0x00216, 0x004342, 0x004342 },
+    { 0x00217, 0x004382, 0x004382 },
+    { 0x00218, 0x0043C2, 0x0043C2 },
+    { 0x00219, 0x004402, 0x004402 },
+    { 0x0021A, 0x004442, 0x004442 },
+    { 0x0021B, 0x004482, 0x004482 },
+    { 0x0021E, 0x0044C2, 0x0044C2 },
+    { 0x0021F, 0x004502, 0x004502 },
+    { 0x00226, 0x004542, 0x004542 },
+    { 0x00227, 0x004582, 0x004582 },
+    { 0x00228, 0x0045C2, 0x0045C2 },
+    { 0x00229, 0x004602, 0x004602 },
+    { 0x0022A, 0x004643, 0x004643 },
+    { 0x0022B, 0x0046A3, 0x0046A3 },
+    { 0x0022C, 0x004703, 0x004703 },
+    { 0x0022D, 0x004763, 0x004763 },
+    { 0x0022E, 0x0047C2, 0x0047C2 },
+    { 0x0022F, 0x004802, 0x004802 },
+    { 0x00230, 0x004843, 0x004843 },
+    { 0x00231, 0x0048A3, 0x0048A3 },
+    { 0x00232, 0x004902, 0x004902 },
+    { 0x00233, 0x004942, 0x004942 },
+    { 0x002B0, 0x000000, 0x004981 },
+    { 0x002B1, 0x000000, 0x0049A1 },
+    { 0x002B2, 0x000000, 0x0049C1 },
+    { 0x002B3, 0x000000, 0x0049E1 },
+    { 0x002B4, 0x000000, 0x004A01 },
+    { 0x002B5, 0x000000, 0x004A21 },
+    { 0x002B6, 0x000000, 0x004A41 },
+    { 0x002B7, 0x000000, 0x004A61 },
+    { 0x002B8, 0x000000, 0x004A81 },
+    { 0x002D8, 0x000000, 0x004AA2 },
+    { 0x002D9, 0x000000, 0x004AE2 },
+    { 0x002DA, 0x000000, 0x004B22 },
+    { 0x002DB, 0x000000, 0x004B62 },
+    { 0x002DC, 0x000000, 0x004BA2 },
+    { 0x002DD, 0x000000, 0x004BE2 },
+    { 0x002E0, 0x000000, 0x004C21 },
+    { 0x002E1, 0x000000, 0x004C41 },
+    { 0x002E2, 0x000000, 0x002C81 },
+    { 0x002E3, 0x000000, 0x004C61 },
+    { 0x002E4, 0x000000, 0x004C81 },
+    { 0x00340, 0x004CA1, 0x004CA1 },
+    { 0x00341, 0x004CC1, 0x004CC1 },
+    { 0x00343, 0x004CE1, 0x004CE1 },
+    { 0x00344, 0x004D02, 0x004D02 },
+    { 0x00374, 0x004D41, 0x004D41 },
+    { 0x0037A, 0x000000, 0x004D62 },
+    { 0x0037E, 0x004DA1, 0x004DA1 },
+    { 0x00384, 0x000000, 0x000102 },
+    { 0x00385, 0x004DC2, 0x004E03 },
+    { 0x00386, 0x004E62, 0x004E62 },
+    { 0x00387, 0x004EA1, 0x004EA1 },
+    { 0x00388, 0x004EC2, 0x004EC2 },
+    { 0x00389, 0x004F02, 0x004F02 },
+    { 0x0038A, 0x004F42, 0x004F42 },
+    { 0x0038C, 0x004F82, 0x004F82 },
+    { 0x0038E, 0x004FC2, 0x004FC2 },
+    { 0x0038F, 0x005002, 0x005002 },
+    { 0x00390, 0x005043, 0x005043 },
+    { 0x003AA, 0x0050A2, 0x0050A2 },
+    { 0x003AB, 0x0050E2, 0x0050E2 },
+    { 0x003AC, 0x005122, 0x005122 },
+    { 0x003AD, 0x005162, 0x005162 },
+    { 0x003AE, 0x0051A2, 0x0051A2 },
+    { 0x003AF, 0x0051E2, 0x0051E2 },
+    { 0x003B0, 0x005223, 0x005223 },
+    { 0x003CA, 0x005282, 0x005282 },
+    { 0x003CB, 0x0052C2, 0x0052C2 },
+    { 0x003CC, 0x005302, 0x005302 },
+    { 0x003CD, 0x005342, 0x005342 },
+    { 0x003CE, 0x005382, 0x005382 },
+    { 0x003D0, 0x000000, 0x0053C1 },
+    { 0x003D1, 0x000000, 0x0053E1 },
+    { 0x003D2, 0x000000, 0x005401 },
+    { 0x003D3, 0x005422, 0x004FC2 },
+    { 0x003D4, 0x005462, 0x0050E2 },
+    { 0x003D5, 0x000000, 0x0054A1 },
+    { 0x003D6, 0x000000, 0x0054C1 },
+    { 0x003F0, 0x000000, 0x0054E1 },
+    { 0x003F1, 0x000000, 0x005501 },
+    { 0x003F2, 0x000000, 0x005521 },
+    { 0x003F4, 0x000000, 0x005541 },
+    { 0x003F5, 0x000000, 0x005561 },
+    { 0x003F9, 0x000000, 0x005581 },
+    { 0x00400, 0x0055A2, 0x0055A2 },
+    { 0x00401, 0x0055E2, 0x0055E2 },
+    { 0x00403, 0x005622, 0x005622 },
+    { 0x00407, 0x005662, 0x005662 },
+    { 0x0040C, 0x0056A2, 0x0056A2 },
+    { 0x0040D, 0x0056E2, 0x0056E2 },
+    { 0x0040E, 0x005722, 0x005722 },
+    { 0x00419, 0x005762, 0x005762 },
+    { 0x00439, 0x0057A2, 0x0057A2 },
+    { 0x00450, 0x0057E2, 0x0057E2 },
+    { 0x00451, 0x005822, 0x005822 },
+    { 0x00453, 0x005862, 0x005862 },
+    { 0x00457, 0x0058A2, 0x0058A2 },
+    { 0x0045C, 0x0058E2, 0x0058E2 },
+    { 0x0045D, 0x005922, 0x005922 },
+    { 0x0045E, 0x005962, 0x005962 },
+    { 0x00476, 0x0059A2, 0x0059A2 },
+    { 0x00477, 0x0059E2, 0x0059E2 },
+    { 0x004C1, 0x005A22, 0x005A22 },
+    { 0x004C2, 0x005A62, 0x005A62 },
+    { 0x004D0, 0x005AA2, 0x005AA2 },
+    { 0x004D1, 0x005AE2, 0x005AE2 },
+    { 0x004D2, 0x005B22, 0x005B22 },
+    { 0x004D3, 0x005B62, 0x005B62 },
+    { 0x004D6, 0x005BA2, 0x005BA2 },
+    { 0x004D7, 0x005BE2, 0x005BE2 },
+    { 0x004DA, 0x005C22, 0x005C22 },
+    { 0x004DB, 0x005C62, 0x005C62 },
+    { 0x004DC, 0x005CA2, 0x005CA2 },
+    { 0x004DD, 0x005CE2, 0x005CE2 },
+    { 0x004DE, 0x005D22, 0x005D22 },
+    { 0x004DF, 0x005D62, 0x005D62 },
+    { 0x004E2, 0x005DA2, 0x005DA2 },
+    { 0x004E3, 0x005DE2, 0x005DE2 },
+    { 0x004E4, 0x005E22, 0x005E22 },
+    { 0x004E5, 0x005E62, 0x005E62 },
+    { 0x004E6, 0x005EA2, 0x005EA2 },
+    { 0x004E7, 0x005EE2, 0x005EE2 },
+    { 0x004EA, 0x005F22, 0x005F22 },
+    { 0x004EB, 0x005F62, 0x005F62 },
+    { 0x004EC, 0x005FA2, 0x005FA2 },
+    { 0x004ED, 0x005FE2, 0x005FE2 },
+    { 0x004EE, 0x006022, 0x006022 },
+    { 0x004EF, 0x006062, 0x006062 },
+    { 0x004F0, 0x0060A2, 0x0060A2 },
+    { 0x004F1, 0x0060E2, 0x0060E2 },
+    { 0x004F2, 0x006122, 0x006122 },
+    { 0x004F3, 0x006162, 0x006162 },
+    { 0x004F4, 0x0061A2, 0x0061A2 },
+    { 0x004F5, 0x0061E2, 0x0061E2 },
+    { 0x004F8, 0x006222, 0x006222 },
+    { 0x004F9, 0x006262, 0x006262 },
+    { 0x00587, 0x000000, 0x0062A2 },
+    { 0x00622, 0x0062E2, 0x0062E2 },
+    { 0x00623, 0x006322, 0x006322 },
+    { 0x00624, 0x006362, 0x006362 },
+    { 0x00625, 0x0063A2, 0x0063A2 },
+    { 0x00626, 0x0063E2, 0x0063E2 },
+    { 0x00675, 0x000000, 0x006422 },
+    { 0x00676, 0x000000, 0x006462 },
+    { 0x00677, 0x000000, 0x0064A2 },
+    { 0x00678, 0x000000, 0x0064E2 },
+    { 0x006C0, 0x006522, 0x006522 },
+    { 0x006C2, 0x006562, 0x006562 },
+    { 0x006D3, 0x0065A2, 0x0065A2 },
+    { 0x00929, 0x0065E2, 0x0065E2 },
+    { 0x00931, 0x006622, 0x006622 },
+    { 0x00934, 0x006662, 0x006662 },
+    { 0x00958, 0x0066A2, 0x0066A2 },
+    { 0x00959, 0x0066E2, 0x0066E2 },
+    { 0x0095A, 0x006722, 0x006722 },
+    { 0x0095B, 0x006762, 0x006762 },
+    { 0x0095C, 0x0067A2, 0x0067A2 },
+    { 0x0095D, 0x0067E2, 0x0067E2 },
+    { 0x0095E, 0x006822, 0x006822 },
+    { 0x0095F, 0x006862, 0x006862 },
+    { 0x009CB, 0x0068A2, 0x0068A2 },
+    { 0x009CC, 0x0068E2, 0x0068E2 },
+    { 0x009DC, 0x006922, 0x006922 },
+    { 0x009DD, 0x006962, 0x006962 },
+    { 0x009DF, 0x0069A2, 0x0069A2 },
+    { 0x00A33, 0x0069E2, 0x0069E2 },
+    { 0x00A36, 0x006A22, 0x006A22 },
+    { 0x00A59, 0x006A62, 0x006A62 },
+    { 0x00A5A, 0x006AA2, 0x006AA2 },
+    { 0x00A5B, 0x006AE2, 0x006AE2 },
+    { 0x00A5E, 0x006B22, 0x006B22 },
+    { 0x00B48, 0x006B62, 0x006B62 },
+    { 0x00B4B, 0x006BA2, 0x006BA2 },
+    { 0x00B4C, 0x006BE2, 0x006BE2 },
+    { 0x00B5C, 0x006C22, 0x006C22 },
+    { 0x00B5D, 0x006C62, 0x006C62 },
+    { 0x00B94, 0x006CA2, 0x006CA2 },
+    { 0x00BCA, 0x006CE2, 0x006CE2 },
+    { 0x00BCB, 0x006D22, 0x006D22 },
+    { 0x00BCC, 0x006D62, 0x006D62 },
+    { 0x00C48, 0x006DA2, 0x006DA2 },
+    { 0x00CC0, 0x006DE2, 0x006DE2 },
+    { 0x00CC7, 0x006E22, 0x006E22 },
+    { 0x00CC8, 0x006E62, 0x006E62 },
+    { 0x00CCA, 0x006EA2, 0x006EA2 },
+    { 0x00CCB, 0x006EE3, 0x006EE3 },
+    { 0x00D4A, 0x006F42, 0x006F42 },
+    { 0x00D4B, 0x006F82, 0x006F82 },
+    { 0x00D4C, 0x006FC2, 0x006FC2 },
+    { 0x00DDA, 0x007002, 0x007002 },
+    { 0x00DDC, 0x007042, 0x007042 },
+    { 0x00DDD, 0x007083, 0x007083 },
+    { 0x00DDE, 0x0070E2, 0x0070E2 },
+    { 0x00E33, 0x000000, 0x007122 },
+    { 0x00EB3, 0x000000, 0x007162 },
+    { 0x00EDC, 0x000000, 0x0071A2 },
+    { 0x00EDD, 0x000000, 0x0071E2 },
+    { 0x00F0C, 0x000000, 0x007221 },
+    { 0x00F43, 0x007242, 0x007242 },
+    { 0x00F4D, 0x007282, 0x007282 },
+    { 0x00F52, 0x0072C2, 0x0072C2 },
+    { 0x00F57, 0x007302, 0x007302 },
+    { 0x00F5C, 0x007342, 0x007342 },
+    { 0x00F69, 0x007382, 0x007382 },
+    { 0x00F73, 0x0073C2, 0x0073C2 },
+    { 0x00F75, 0x007402, 0x007402 },
+    { 0x00F76, 0x007442, 0x007442 },
+    { 0x00F77, 0x000000, 0x007483 },
+    { 0x00F78, 0x0074E2, 0x0074E2 },
+    { 0x00F79, 0x000000, 0x007523 },
+    { 0x00F81, 0x007582, 0x007582 },
+    { 0x00F93, 0x0075C2, 0x0075C2 },
+    { 0x00F9D, 0x007602, 0x007602 },
+    { 0x00FA2, 0x007642, 0x007642 },
+    { 0x00FA7, 0x007682, 0x007682 },
+    { 0x00FAC, 0x0076C2, 0x0076C2 },
+    { 0x00FB9, 0x007702, 0x007702 },
+    { 0x01026, 0x007742, 0x007742 },
+    { 0x010FC, 0x000000, 0x007781 },
+    { 0x01B06, 0x0077A2, 0x0077A2 },
+    { 0x01B08, 0x0077E2, 0x0077E2 },
+    { 0x01B0A, 0x007822, 0x007822 },
+    { 0x01B0C, 0x007862, 0x007862 },
+    { 0x01B0E, 0x0078A2, 0x0078A2 },
+    { 0x01B12, 0x0078E2, 0x0078E2 },
+    { 0x01B3B, 0x007922, 0x007922 },
+    { 0x01B3D, 0x007962, 0x007962 },
+    { 0x01B40, 0x0079A2, 0x0079A2 },
+    { 0x01B41, 0x0079E2, 0x0079E2 },
+    { 0x01B43, 0x007A22, 0x007A22 },
+    { 0x01D2C, 0x000000, 0x007A61 },
+    { 0x01D2D, 0x000000, 0x007A81 },
+    { 0x01D2E, 0x000000, 0x007AA1 },
+    { 0x01D30, 0x000000, 0x007AC1 },
+    { 0x01D31, 0x000000, 0x007AE1 },
+    { 0x01D32, 0x000000, 0x007B01 },
+    { 0x01D33, 0x000000, 0x007B21 },
+    { 0x01D34, 0x000000, 0x007B41 },
+    { 0x01D35, 0x000000, 0x007B61 },
+    { 0x01D36, 0x000000, 0x007B81 },
+    { 0x01D37, 0x000000, 0x007BA1 },
+    { 0x01D38, 0x000000, 0x007BC1 },
+    { 0x01D39, 0x000000, 0x007BE1 },
+    { 0x01D3A, 0x000000, 0x007C01 },
+    { 0x01D3C, 0x000000, 0x007C21 },
+    { 0x01D3D, 0x000000, 0x007C41 },
+    { 0x01D3E, 0x000000, 0x007C61 },
+    { 0x01D3F, 0x000000, 0x007C81 },
+    { 0x01D40, 0x000000, 0x007CA1 },
+    { 0x01D41, 0x000000, 0x007CC1 },
+    { 0x01D42, 0x000000, 0x007CE1 },
+    { 0x01D43, 0x000000, 0x000061 },
+    { 0x01D44, 0x000000, 0x007D01 },
+    { 0x01D45, 0x000000, 0x007D21 },
+    { 0x01D46, 0x000000, 0x007D41 },
+    { 0x01D47, 0x000000, 0x007D61 },
+    { 0x01D48, 0x000000, 0x007D81 },
+    { 0x01D49, 0x000000, 0x007DA1 },
+    { 0x01D4A, 0x000000, 0x007DC1 },
+    { 0x01D4B, 0x000000, 0x007DE1 },
+    { 0x01D4C, 0x000000, 0x007E01 },
+    { 0x01D4D, 0x000000, 0x007E21 },
+    { 0x01D4F, 0x000000, 0x007E41 },
+    { 0x01D50, 0x000000, 0x007E61 },
+    { 0x01D51, 0x000000, 0x007E81 },
+    { 0x01D52, 0x000000, 0x0001C1 },
+    { 0x01D53, 0x000000, 0x007EA1 },
+    { 0x01D54, 0x000000, 0x007EC1 },
+    { 0x01D55, 0x000000, 0x007EE1 },
+    { 0x01D56, 0x000000, 0x007F01 },
+    { 0x01D57, 0x000000, 0x007F21 },
+    { 0x01D58, 0x000000, 0x007F41 },
+    { 0x01D59, 0x000000, 0x007F61 },
+    { 0x01D5A, 0x000000, 0x007F81 },
+    { 0x01D5B, 0x000000, 0x007FA1 },
+    { 0x01D5C, 0x000000, 0x007FC1 },
+    { 0x01D5D, 0x000000, 0x0053C1 },
+    { 0x01D5E, 0x000000, 0x007FE1 },
+    { 0x01D5F, 0x000000, 0x008001 },
+    { 0x01D60, 0x000000, 0x0054A1 },
+    { 0x01D61, 0x000000, 0x008021 },
+    { 0x01D62, 0x000000, 0x008041 },
+    { 0x01D63, 0x000000, 0x0049E1 },
+    { 0x01D64, 0x000000, 0x007F41 },
+    { 0x01D65, 0x000000, 0x007FA1 },
+    { 0x01D66, 0x000000, 0x0053C1 },
+    { 0x01D67, 0x000000, 0x007FE1 },
+    { 0x01D68, 0x000000, 0x005501 },
+    { 0x01D69, 0x000000, 0x0054A1 },
+    { 0x01D6A, 0x000000, 0x008021 },
+    { 0x01D78, 0x000000, 0x008061 },
+    { 0x01D9B, 0x000000, 0x008081 },
+    { 0x01D9C, 0x000000, 0x0080A1 },
+    { 0x01D9D, 0x000000, 0x0080C1 },
+    { 0x01D9E, 0x000000, 0x0080E1 },
+    { 0x01D9F, 0x000000, 0x007E01 },
+    { 0x01DA0, 0x000000, 0x008101 },
+    { 0x01DA1, 0x000000, 0x008121 },
+    { 0x01DA2, 0x000000, 0x008141 },
+    { 0x01DA3, 0x000000, 0x008161 },
+    { 0x01DA4, 0x000000, 0x008181 },
+    { 0x01DA5, 0x000000, 0x0081A1 },
+    { 0x01DA6, 0x000000, 0x0081C1 },
+    { 0x01DA7, 0x000000, 0x0081E1 },
+    { 0x01DA8, 0x000000, 0x008201 },
+    { 0x01DA9, 0x000000, 0x008221 },
+    { 0x01DAA, 0x000000, 0x008241 },
+    { 0x01DAB, 0x000000, 0x008261 },
+    { 0x01DAC, 0x000000, 0x008281 },
+    { 0x01DAD, 0x000000, 0x0082A1 },
+    { 0x01DAE, 0x000000, 0x0082C1 },
+    { 0x01DAF, 0x000000, 0x0082E1 },
+    { 0x01DB0, 0x000000, 0x008301 },
+    { 0x01DB1, 0x000000, 0x008321 },
+    { 0x01DB2, 0x000000, 0x008341 },
+    { 0x01DB3, 0x000000, 0x008361 },
+    { 0x01DB4, 0x000000, 0x008381 },
+    { 0x01DB5, 0x000000, 0x0083A1 },
+    { 0x01DB6, 0x000000, 0x0083C1 },
+    { 0x01DB7, 0x000000, 0x0083E1 },
+    { 0x01DB8, 0x000000, 0x008401 },
+    { 0x01DB9, 0x000000, 0x008421 },
+    { 0x01DBA, 0x000000, 0x008441 },
+    { 0x01DBB, 0x000000, 0x008461 },
+    { 0x01DBC, 0x000000, 0x008481 },
+    { 0x01DBD, 0x000000, 0x0084A1 },
+    { 0x01DBE, 0x000000, 0x0084C1 },
+    { 0x01DBF, 0x000000, 0x0053E1 },
+    { 0x01E00, 0x0084E2, 0x0084E2 },
+    { 0x01E01, 0x008522, 0x008522 },
+    { 0x01E02, 0x008562, 0x008562 },
+    { 0x01E03, 0x0085A2, 0x0085A2 },
+    { 0x01E04, 0x0085E2, 0x0085E2 },
+    { 0x01E05, 0x008622, 0x008622 },
+    { 0x01E06, 0x008662, 0x008662 },
+    { 0x01E07, 0x0086A2, 0x0086A2 },
+    { 0x01E08, 0x0086E3, 0x0086E3 },
+    { 0x01E09, 0x008743, 0x008743 },
+    { 0x01E0A, 0x0087A2, 0x0087A2 },
+    { 0x01E0B, 0x0087E2, 0x0087E2 },
+    { 0x01E0C, 0x008822, 0x008822 },
+    { 0x01E0D, 0x008862, 0x008862 },
+    { 0x01E0E, 0x0088A2, 0x0088A2 },
+    { 0x01E0F, 0x0088E2, 0x0088E2 },
+    { 0x01E10, 0x008922, 0x008922 },
+    { 0x01E11, 0x008962, 0x008962 },
+    { 0x01E12, 0x0089A2, 0x0089A2 },
+    { 0x01E13, 0x0089E2, 0x0089E2 },
+    { 0x01E14, 0x008A23, 0x008A23 },
+    { 0x01E15, 0x008A83, 0x008A83 },
+    { 0x01E16, 0x008AE3, 0x008AE3 },
+    { 0x01E17, 0x008B43, 0x008B43 },
+    { 0x01E18, 0x008BA2, 0x008BA2 },
+    { 0x01E19, 0x008BE2, 0x008BE2 },
+    { 0x01E1A, 0x008C22, 0x008C22 },
+    { 0x01E1B, 0x008C62, 0x008C62 },
+    { 0x01E1C, 0x008CA3, 0x008CA3 },
+    { 0x01E1D, 0x008D03, 0x008D03 },
+    { 0x01E1E, 0x008D62, 0x008D62 },
+    { 0x01E1F, 0x008DA2, 0x008DA2 },
+    { 0x01E20, 0x008DE2, 0x008DE2 },
+    { 0x01E21, 0x008E22, 0x008E22 },
+    { 0x01E22, 0x008E62, 0x008E62 },
+    { 0x01E23, 0x008EA2, 0x008EA2 },
+    { 0x01E24, 0x008EE2, 0x008EE2 },
+    { 0x01E25, 0x008F22, 0x008F22 },
+    { 0x01E26, 0x008F62, 0x008F62 },
+    { 0x01E27, 0x008FA2, 0x008FA2 },
+    { 0x01E28, 0x008FE2, 0x008FE2 },
+    { 0x01E29, 0x009022, 0x009022 },
+    { 0x01E2A, 0x009062, 0x009062 },
+    { 0x01E2B, 0x0090A2, 0x0090A2 },
+    { 0x01E2C, 0x0090E2, 0x0090E2 },
+    { 0x01E2D, 0x009122, 0x009122 },
+    { 0x01E2E, 0x009163, 0x009163 },
+    { 0x01E2F, 0x0091C3, 0x0091C3 },
+    { 0x01E30, 0x009222, 0x009222 },
+    { 0x01E31, 0x009262, 0x009262 },
+    { 0x01E32, 0x0092A2, 0x0092A2 },
+    { 0x01E33, 0x0092E2, 0x0092E2 },
+    { 0x01E34, 0x009322, 0x009322 },
+    { 0x01E35, 0x009362, 0x009362 },
+    { 0x01E36, 0x0093A2, 0x0093A2 },
+    { 0x01E37, 0x0093E2, 0x0093E2 },
+    { 0x01E38, 0x009423, 0x009423 },
+    { 0x01E39, 0x009483, 0x009483 },
+    { 0x01E3A, 0x0094E2, 0x0094E2 },
+    { 0x01E3B, 0x009522, 0x009522 },
+    { 0x01E3C, 0x009562, 0x009562 },
+    { 0x01E3D, 0x0095A2, 0x0095A2 },
+    { 0x01E3E, 0x0095E2, 0x0095E2 },
+    { 0x01E3F, 0x009622, 0x009622 },
+    { 0x01E40, 0x009662, 0x009662 },
+    { 0x01E41, 0x0096A2, 0x0096A2 },
+    { 0x01E42, 0x0096E2, 0x0096E2 },
+    { 0x01E43, 0x009722, 0x009722 },
+    { 0x01E44, 0x009762, 0x009762 },
+    { 0x01E45, 0x0097A2, 0x0097A2 },
+    { 0x01E46, 0x0097E2, 0x0097E2 },
+    { 0x01E47, 0x009822, 0x009822 },
+    { 0x01E48, 0x009862, 0x009862 },
+    { 0x01E49, 0x0098A2, 0x0098A2 },
+    { 0x01E4A, 0x0098E2, 0x0098E2 },
+    { 0x01E4B, 0x009922, 0x009922 },
+    { 0x01E4C, 0x009963, 0x009963 },
+    { 0x01E4D, 0x0099C3, 0x0099C3 },
+    { 0x01E4E, 0x009A23, 0x009A23 },
+    { 0x01E4F, 0x009A83, 0x009A83 },
+    { 0x01E50, 0x009AE3, 0x009AE3 },
+    { 0x01E51, 0x009B43, 0x009B43 },
+    { 0x01E52, 0x009BA3, 0x009BA3 },
+    { 0x01E53, 0x009C03, 0x009C03 },
+    { 0x01E54, 0x009C62, 0x009C62 },
+    { 0x01E55, 0x009CA2, 0x009CA2 },
+    { 0x01E56, 0x009CE2, 0x009CE2 },
+    { 0x01E57, 0x009D22, 0x009D22 },
+    { 0x01E58, 0x009D62, 0x009D62 },
+    { 0x01E59, 0x009DA2, 0x009DA2 },
+    { 0x01E5A, 0x009DE2, 0x009DE2 },
+    { 0x01E5B, 0x009E22, 0x009E22 },
+    { 0x01E5C, 0x009E63, 0x009E63 },
+    { 0x01E5D, 0x009EC3, 0x009EC3 },
+    { 0x01E5E, 0x009F22, 0x009F22 },
+    { 0x01E5F, 0x009F62, 0x009F62 },
+    { 0x01E60, 0x009FA2, 0x009FA2 },
+    { 0x01E61, 0x009FE2, 0x009FE2 },
+    { 0x01E62, 0x00A022, 0x00A022 },
+    { 0x01E63, 0x00A062, 0x00A062 },
+    { 0x01E64, 0x00A0A3, 0x00A0A3 },
+    { 0x01E65, 0x00A103, 0x00A103 },
+    { 0x01E66, 0x00A163, 0x00A163 },
+    { 0x01E67, 0x00A1C3, 0x00A1C3 },
+    { 0x01E68, 0x00A223, 0x00A223 },
+    { 0x01E69, 0x00A283, 0x00A283 },
+    { 0x01E6A, 0x00A2E2, 0x00A2E2 },
+    { 0x01E6B, 0x00A322, 0x00A322 },
+    { 0x01E6C, 0x00A362, 0x00A362 },
+    { 0x01E6D, 0x00A3A2, 0x00A3A2 },
+    { 0x01E6E, 0x00A3E2, 0x00A3E2 },
+    { 0x01E6F, 0x00A422, 0x00A422 },
+    { 0x01E70, 0x00A462, 0x00A462 },
+    { 0x01E71, 0x00A4A2, 0x00A4A2 },
+    { 0x01E72, 0x00A4E2, 0x00A4E2 },
+    { 0x01E73, 0x00A522, 0x00A522 },
+    { 0x01E74, 0x00A562, 0x00A562 },
+    { 0x01E75, 0x00A5A2, 0x00A5A2 },
+    { 0x01E76, 0x00A5E2, 0x00A5E2 },
+    { 0x01E77, 0x00A622, 0x00A622 },
+    { 0x01E78, 0x00A663, 0x00A663 },
+    { 0x01E79, 0x00A6C3, 0x00A6C3 },
+    { 0x01E7A, 0x00A723, 0x00A723 },
+    { 0x01E7B, 0x00A783, 0x00A783 },
+    { 0x01E7C, 0x00A7E2, 0x00A7E2 },
+    { 0x01E7D, 0x00A822, 0x00A822 },
+    { 0x01E7E, 0x00A862, 0x00A862 },
+    { 0x01E7F, 0x00A8A2, 0x00A8A2 },
+    { 0x01E80, 0x00A8E2, 0x00A8E2 },
+    { 0x01E81, 0x00A922, 0x00A922 },
+    { 0x01E82, 0x00A962, 0x00A962 },
+    { 0x01E83, 0x00A9A2, 0x00A9A2 },
+    { 0x01E84, 0x00A9E2, 0x00A9E2 },
+    { 0x01E85, 0x00AA22, 0x00AA22 },
+    { 0x01E86, 0x00AA62, 0x00AA62 },
+    { 0x01E87, 0x00AAA2, 0x00AAA2 },
+    { 0x01E88, 0x00AAE2, 0x00AAE2 },
+    { 0x01E89, 0x00AB22, 0x00AB22 },
+    { 0x01E8A, 0x00AB62, 0x00AB62 },
+    { 0x01E8B, 0x00ABA2, 0x00ABA2 },
+    { 0x01E8C, 0x00ABE2, 0x00ABE2 },
+    { 0x01E8D, 0x00AC22, 0x00AC22 },
+    { 0x01E8E, 0x00AC62, 0x00AC62 },
+    { 0x01E8F, 0x00ACA2, 0x00ACA2 },
+    { 0x01E90, 0x00ACE2, 0x00ACE2 },
+    { 0x01E91, 0x00AD22, 0x00AD22 },
+    { 0x01E92, 0x00AD62, 0x00AD62 },
+    { 0x01E93, 0x00ADA2, 0x00ADA2 },
+    { 0x01E94, 0x00ADE2, 0x00ADE2 },
+    { 0x01E95, 0x00AE22, 0x00AE22 },
+    { 0x01E96, 0x00AE62, 0x00AE62 },
+    { 0x01E97, 0x00AEA2, 0x00AEA2 },
+    { 0x01E98, 0x00AEE2, 0x00AEE2 },
+    { 0x01E99, 0x00AF22, 0x00AF22 },
+    { 0x01E9A, 0x000000, 0x00AF62 },
+    { 0x01E9B, 0x00AFA2, 0x009FE2 },
+    { 0x01EA0, 0x00AFE2, 0x00AFE2 },
+    { 0x01EA1, 0x00B022, 0x00B022 },
+    { 0x01EA2, 0x00B062, 0x00B062 },
+    { 0x01EA3, 0x00B0A2, 0x00B0A2 },
+    { 0x01EA4, 0x00B0E3, 0x00B0E3 },
+    { 0x01EA5, 0x00B143, 0x00B143 },
+    { 0x01EA6, 0x00B1A3, 0x00B1A3 },
+    { 0x01EA7, 0x00B203, 0x00B203 },
+    { 0x01EA8, 0x00B263, 0x00B263 },
+    { 0x01EA9, 0x00B2C3, 0x00B2C3 },
+    { 0x01EAA, 0x00B323, 0x00B323 },
+    { 0x01EAB, 0x00B383, 0x00B383 },
+    { 0x01EAC, 0x00B3E3, 0x00B3E3 },
+    { 0x01EAD, 0x00B443, 0x00B443 },
+    { 0x01EAE, 0x00B4A3, 0x00B4A3 },
+    { 0x01EAF, 0x00B503, 0x00B503 },
+    { 0x01EB0, 0x00B563, 0x00B563 },
+    { 0x01EB1, 0x00B5C3, 0x00B5C3 },
+    { 0x01EB2, 0x00B623, 0x00B623 },
+    { 0x01EB3, 0x00B683, 0x00B683 },
+    { 0x01EB4, 0x00B6E3, 0x00B6E3 },
+    { 0x01EB5, 0x00B743, 0x00B743 },
+    { 0x01EB6, 0x00B7A3, 0x00B7A3 },
+    { 0x01EB7, 0x00B803, 0x00B803 },
+    { 0x01EB8, 0x00B862, 0x00B862 },
+    { 0x01EB9, 0x00B8A2, 0x00B8A2 },
+    { 0x01EBA, 0x00B8E2, 0x00B8E2 },
+    { 0x01EBB, 0x00B922, 0x00B922 },
+    { 0x01EBC, 0x00B962, 0x00B962 },
+    { 0x01EBD, 0x00B9A2, 0x00B9A2 },
+    { 0x01EBE, 0x00B9E3, 0x00B9E3 },
+    { 0x01EBF, 0x00BA43, 0x00BA43 },
+    { 0x01EC0, 0x00BAA3, 0x00BAA3 },
+    { 0x01EC1, 0x00BB03, 0x00BB03 },
+    { 0x01EC2, 0x00BB63, 0x00BB63 },
+    { 0x01EC3, 0x00BBC3, 0x00BBC3 },
+    { 0x01EC4, 0x00BC23, 0x00BC23 },
+    { 0x01EC5, 0x00BC83, 0x00BC83 },
+    { 0x01EC6, 0x00BCE3, 0x00BCE3 },
+    { 0x01EC7, 0x00BD43, 0x00BD43 },
+    { 0x01EC8, 0x00BDA2, 0x00BDA2 },
+    { 0x01EC9, 0x00BDE2, 0x00BDE2 },
+    { 0x01ECA, 0x00BE22, 0x00BE22 },
+    { 0x01ECB, 0x00BE62, 0x00BE62 },
+    { 0x01ECC, 0x00BEA2, 0x00BEA2 },
+    { 0x01ECD, 0x00BEE2, 0x00BEE2 },
+    { 0x01ECE, 0x00BF22, 0x00BF22 },
+    { 0x01ECF, 0x00BF62, 0x00BF62 },
+    { 0x01ED0, 0x00BFA3, 0x00BFA3 },
+    { 0x01ED1, 0x00C003, 0x00C003 },
+    { 0x01ED2, 0x00C063, 0x00C063 },
+    { 0x01ED3, 0x00C0C3, 0x00C0C3 },
+    { 0x01ED4, 0x00C123, 0x00C123 },
+    { 0x01ED5, 0x00C183, 0x00C183 },
+    { 0x01ED6, 0x00C1E3, 0x00C1E3 },
+    { 0x01ED7, 0x00C243, 0x00C243 },
+    { 0x01ED8, 0x00C2A3, 0x00C2A3 },
+    { 0x01ED9, 0x00C303, 0x00C303 },
+    { 0x01EDA, 0x00C363, 0x00C363 },
+    { 0x01EDB, 0x00C3C3, 0x00C3C3 },
+    { 0x01EDC, 0x00C423, 0x00C423 },
+    { 0x01EDD, 0x00C483, 0x00C483 },
+    { 0x01EDE, 0x00C4E3, 0x00C4E3 },
+    { 0x01EDF, 0x00C543, 0x00C543 },
+    { 0x01EE0, 0x00C5A3, 0x00C5A3 },
+    { 0x01EE1, 0x00C603, 0x00C603 },
+    { 0x01EE2, 0x00C663, 0x00C663 },
+    { 0x01EE3, 0x00C6C3, 0x00C6C3 },
+    { 0x01EE4, 0x00C722, 0x00C722 },
+    { 0x01EE5, 0x00C762, 0x00C762 },
+    { 0x01EE6, 0x00C7A2, 0x00C7A2 },
+    { 0x01EE7, 0x00C7E2, 0x00C7E2 },
+    { 0x01EE8, 0x00C823, 0x00C823 },
+    { 0x01EE9, 0x00C883, 0x00C883 },
+    { 0x01EEA, 0x00C8E3, 0x00C8E3 },
+    { 0x01EEB, 0x00C943, 0x00C943 },
+    { 0x01EEC, 0x00C9A3, 0x00C9A3 },
+    { 0x01EED, 0x00CA03, 0x00CA03 },
+    { 0x01EEE, 0x00CA63, 0x00CA63 },
+    { 0x01EEF, 0x00CAC3, 0x00CAC3 },
+    { 0x01EF0, 0x00CB23, 0x00CB23 },
+    { 0x01EF1, 0x00CB83, 0x00CB83 },
+    { 0x01EF2, 0x00CBE2, 0x00CBE2 },
+    { 0x01EF3, 0x00CC22, 0x00CC22 },
+    { 0x01EF4, 0x00CC62, 0x00CC62 },
+    { 0x01EF5, 0x00CCA2, 0x00CCA2 },
+    { 0x01EF6, 0x00CCE2, 0x00CCE2 },
+    { 0x01EF7, 0x00CD22, 0x00CD22 },
+    { 0x01EF8, 0x00CD62, 0x00CD62 },
+    { 0x01EF9, 0x00CDA2, 0x00CDA2 },
+    { 0x01F00, 0x00CDE2, 0x00CDE2 },
+    { 0x01F01, 0x00CE22, 0x00CE22 },
+    { 0x01F02, 0x00CE63, 0x00CE63 },
+    { 0x01F03, 0x00CEC3, 0x00CEC3 },
+    { 0x01F04, 0x00CF23, 0x00CF23 },
+    { 0x01F05, 0x00CF83, 0x00CF83 },
+    { 0x01F06, 0x00CFE3, 0x00CFE3 },
+    { 0x01F07, 0x00D043, 0x00D043 },
+    { 0x01F08, 0x00D0A2, 0x00D0A2 },
+    { 0x01F09, 0x00D0E2, 0x00D0E2 },
+    { 0x01F0A, 0x00D123, 0x00D123 },
+    { 0x01F0B, 0x00D183, 0x00D183 },
+    { 0x01F0C, 0x00D1E3, 0x00D1E3 },
+    { 0x01F0D, 0x00D243, 0x00D243 },
+    { 0x01F0E, 0x00D2A3, 0x00D2A3 },
+    { 0x01F0F, 0x00D303, 0x00D303 },
+    { 0x01F10, 0x00D362, 0x00D362 },
+    { 0x01F11, 0x00D3A2, 0x00D3A2 },
+    { 0x01F12, 0x00D3E3, 0x00D3E3 },
+    { 0x01F13, 0x00D443, 0x00D443 },
+    { 0x01F14, 0x00D4A3, 0x00D4A3 },
+    { 0x01F15, 0x00D503, 0x00D503 },
+    { 0x01F18, 0x00D562, 0x00D562 },
+    { 0x01F19, 0x00D5A2, 0x00D5A2 },
+    { 0x01F1A, 0x00D5E3, 0x00D5E3 },
+    { 0x01F1B, 0x00D643, 0x00D643 },
+    { 0x01F1C, 0x00D6A3, 0x00D6A3 },
+    { 0x01F1D, 0x00D703, 0x00D703 },
+    { 0x01F20, 0x00D762, 0x00D762 },
+    { 0x01F21, 0x00D7A2, 0x00D7A2 },
+    { 0x01F22, 0x00D7E3, 0x00D7E3 },
+    { 0x01F23, 0x00D843, 0x00D843 },
+    { 0x01F24, 0x00D8A3, 0x00D8A3 },
+    { 0x01F25, 0x00D903, 0x00D903 },
+    { 0x01F26, 0x00D963, 0x00D963 },
+    { 0x01F27, 0x00D9C3, 0x00D9C3 },
+    { 0x01F28, 0x00DA22, 0x00DA22 },
+    { 0x01F29, 0x00DA62, 0x00DA62 },
+    { 0x01F2A, 0x00DAA3, 0x00DAA3 },
+    { 0x01F2B, 0x00DB03, 0x00DB03 },
+    { 0x01F2C, 0x00DB63, 0x00DB63 },
+    { 0x01F2D, 0x00DBC3, 0x00DBC3 },
+    { 0x01F2E, 0x00DC23, 0x00DC23 },
+    { 0x01F2F, 0x00DC83, 0x00DC83 },
+    { 0x01F30, 0x00DCE2, 0x00DCE2 },
+    { 0x01F31, 0x00DD22, 0x00DD22 },
+    { 0x01F32, 0x00DD63, 0x00DD63 },
+    { 0x01F33, 0x00DDC3, 0x00DDC3 },
+    { 0x01F34, 0x00DE23, 0x00DE23 },
+    { 0x01F35, 0x00DE83, 0x00DE83 },
+    { 0x01F36, 0x00DEE3, 0x00DEE3 },
+    { 0x01F37, 0x00DF43, 0x00DF43 },
+    { 0x01F38, 0x00DFA2, 0x00DFA2 },
+    { 0x01F39, 0x00DFE2, 0x00DFE2 },
+    { 0x01F3A, 0x00E023, 0x00E023 },
+    { 0x01F3B, 0x00E083, 0x00E083 },
+    { 0x01F3C, 0x00E0E3, 0x00E0E3 },
+    { 0x01F3D, 0x00E143, 0x00E143 },
+    { 0x01F3E, 0x00E1A3, 0x00E1A3 },
+    { 0x01F3F, 0x00E203, 0x00E203 },
+    { 0x01F40, 0x00E262, 0x00E262 },
+    { 0x01F41, 0x00E2A2, 0x00E2A2 },
+    { 0x01F42, 0x00E2E3, 0x00E2E3 },
+    { 0x01F43, 0x00E343, 0x00E343 },
+    { 0x01F44, 0x00E3A3, 0x00E3A3 },
+    { 0x01F45, 0x00E403, 0x00E403 },
+    { 0x01F48, 0x00E462, 0x00E462 },
+    { 0x01F49, 0x00E4A2, 0x00E4A2 },
+    { 0x01F4A, 0x00E4E3, 0x00E4E3 },
+    { 0x01F4B, 0x00E543, 0x00E543 },
+    { 0x01F4C, 0x00E5A3, 0x00E5A3 },
+    { 0x01F4D, 0x00E603, 0x00E603 },
+    { 0x01F50, 0x00E662, 0x00E662 },
+    { 0x01F51, 0x00E6A2, 0x00E6A2 },
+    { 0x01F52, 0x00E6E3, 0x00E6E3 },
+    { 0x01F53, 0x00E743, 0x00E743 },
+    { 0x01F54, 0x00E7A3, 0x00E7A3 },
+    { 0x01F55, 0x00E803, 0x00E803 },
+    { 0x01F56, 0x00E863, 0x00E863 },
+    { 0x01F57, 0x00E8C3, 0x00E8C3 },
+    { 0x01F59, 0x00E922, 0x00E922 },
+    { 0x01F5B, 0x00E963, 0x00E963 },
+    { 0x01F5D, 0x00E9C3, 0x00E9C3 },
+    { 0x01F5F, 0x00EA23, 0x00EA23 },
+    { 0x01F60, 0x00EA82, 0x00EA82 },
+    { 0x01F61, 0x00EAC2, 0x00EAC2 },
+    { 0x01F62, 0x00EB03, 0x00EB03 },
+    { 0x01F63, 0x00EB63, 0x00EB63 },
+    { 0x01F64, 0x00EBC3, 0x00EBC3 },
+    { 0x01F65, 0x00EC23, 0x00EC23 },
+    { 0x01F66, 0x00EC83, 0x00EC83 },
+    { 0x01F67, 0x00ECE3, 0x00ECE3 },
+    { 0x01F68, 0x00ED42, 0x00ED42 },
+    { 0x01F69, 0x00ED82, 0x00ED82 },
+    { 0x01F6A, 0x00EDC3, 0x00EDC3 },
+    { 0x01F6B, 0x00EE23, 0x00EE23 },
+    { 0x01F6C, 0x00EE83, 0x00EE83 },
+    { 0x01F6D, 0x00EEE3, 0x00EEE3 },
+    { 0x01F6E, 0x00EF43, 0x00EF43 },
+    { 0x01F6F, 0x00EFA3, 0x00EFA3 },
+    { 0x01F70, 0x00F002, 0x00F002 },
+    { 0x01F71, 0x005122, 0x005122 },
+    { 0x01F72, 0x00F042, 0x00F042 },
+    { 0x01F73, 0x005162, 0x005162 },
+    { 0x01F74, 0x00F082, 0x00F082 },
+    { 0x01F75, 0x0051A2, 0x0051A2 },
+    { 0x01F76, 0x00F0C2, 0x00F0C2 },
+    { 0x01F77, 0x0051E2, 0x0051E2 },
+    { 0x01F78, 0x00F102, 0x00F102 },
+    { 0x01F79, 0x005302, 0x005302 },
+    { 0x01F7A, 0x00F142, 0x00F142 },
+    { 0x01F7B, 0x005342, 0x005342 },
+    { 0x01F7C, 0x00F182, 0x00F182 },
+    { 0x01F7D, 0x005382, 0x005382 },
+    { 0x01F80, 0x00F1C3, 0x00F1C3 },
+    { 0x01F81, 0x00F223, 0x00F223 },
+    { 0x01F82, 0x00F284, 0x00F284 },
+    { 0x01F83, 0x00F304, 0x00F304 },
+    { 0x01F84, 0x00F384, 0x00F384 },
+    { 0x01F85, 0x00F404, 0x00F404 },
+    { 0x01F86, 0x00F484, 0x00F484 },
+    { 0x01F87, 0x00F504, 0x00F504 },
+    { 0x01F88, 0x00F583, 0x00F583 },
+    { 0x01F89, 0x00F5E3, 0x00F5E3 },
+    { 0x01F8A, 0x00F644, 0x00F644 },
+    { 0x01F8B, 0x00F6C4, 0x00F6C4 },
+    { 0x01F8C, 0x00F744, 0x00F744 },
+    { 0x01F8D, 0x00F7C4, 0x00F7C4 },
+    { 0x01F8E, 0x00F844, 0x00F844 },
+    { 0x01F8F, 0x00F8C4, 0x00F8C4 },
+    { 0x01F90, 0x00F943, 0x00F943 },
+    { 0x01F91, 0x00F9A3, 0x00F9A3 },
+    { 0x01F92, 0x00FA04, 0x00FA04 },
+    { 0x01F93, 0x00FA84, 0x00FA84 },
+    { 0x01F94, 0x00FB04, 0x00FB04 },
+    { 0x01F95, 0x00FB84, 0x00FB84 },
+    { 0x01F96, 0x00FC04, 0x00FC04 },
+    { 0x01F97, 0x00FC84, 0x00FC84 },
+    { 0x01F98, 0x00FD03, 0x00FD03 },
+    { 0x01F99, 0x00FD63, 0x00FD63 },
+    { 0x01F9A, 0x00FDC4, 0x00FDC4 },
+    { 0x01F9B, 0x00FE44, 0x00FE44 },
+    { 0x01F9C, 0x00FEC4, 0x00FEC4 },
+    { 0x01F9D, 0x00FF44, 0x00FF44 },
+    { 0x01F9E, 0x00FFC4, 0x00FFC4 },
+    { 0x01F9F, 0x010044, 0x010044 },
+    { 0x01FA0, 0x0100C3, 0x0100C3 },
+    { 0x01FA1, 0x010123, 0x010123 },
+    { 0x01FA2, 0x010184, 0x010184 },
+    { 0x01FA3, 0x010204, 0x010204 },
+    { 0x01FA4, 0x010284, 0x010284 },
+    { 0x01FA5, 0x010304, 0x010304 },
+    { 0x01FA6, 0x010384, 0x010384 },
+    { 0x01FA7, 0x010404, 0x010404 },
+    { 0x01FA8, 0x010483, 0x010483 },
+    { 0x01FA9, 0x0104E3, 0x0104E3 },
+    { 0x01FAA, 0x010544, 0x010544 },
+    { 0x01FAB, 0x0105C4, 0x0105C4 },
+    { 0x01FAC, 0x010644, 0x010644 },
+    { 0x01FAD, 0x0106C4, 0x0106C4 },
+    { 0x01FAE, 0x010744, 0x010744 },
+    { 0x01FAF, 0x0107C4, 0x0107C4 },
+    { 0x01FB0, 0x010842, 0x010842 },
+    { 0x01FB1, 0x010882, 0x010882 },
+    { 0x01FB2, 0x0108C3, 0x0108C3 },
+    { 0x01FB3, 0x010922, 0x010922 },
+    { 0x01FB4, 0x010963, 0x010963 },
+    { 0x01FB6, 0x0109C2, 0x0109C2 },
+    { 0x01FB7, 0x010A03, 0x010A03 },
+    { 0x01FB8, 0x010A62, 0x010A62 },
+    { 0x01FB9, 0x010AA2, 0x010AA2 },
+    { 0x01FBA, 0x010AE2, 0x010AE2 },
+    { 0x01FBB, 0x004E62, 0x004E62 },
+    { 0x01FBC, 0x010B22, 0x010B22 },
+    { 0x01FBD, 0x000000, 0x010B62 },
+    { 0x01FBE, 0x010BA1, 0x010BA1 },
+    { 0x01FBF, 0x000000, 0x010B62 },
+    { 0x01FC0, 0x000000, 0x010BC2 },
+    { 0x01FC1, 0x010C02, 0x010C43 },
+    { 0x01FC2, 0x010CA3, 0x010CA3 },
+    { 0x01FC3, 0x010D02, 0x010D02 },
+    { 0x01FC4, 0x010D43, 0x010D43 },
+    { 0x01FC6, 0x010DA2, 0x010DA2 },
+    { 0x01FC7, 0x010DE3, 0x010DE3 },
+    { 0x01FC8, 0x010E42, 0x010E42 },
+    { 0x01FC9, 0x004EC2, 0x004EC2 },
+    { 0x01FCA, 0x010E82, 0x010E82 },
+    { 0x01FCB, 0x004F02, 0x004F02 },
+    { 0x01FCC, 0x010EC2, 0x010EC2 },
+    { 0x01FCD, 0x010F02, 0x010F43 },
+    { 0x01FCE, 0x010FA2, 0x010FE3 },
+    { 0x01FCF, 0x011042, 0x011083 },
+    { 0x01FD0, 0x0110E2, 0x0110E2 },
+    { 0x01FD1, 0x011122, 0x011122 },
+    { 0x01FD2, 0x011163, 0x011163 },
+    { 0x01FD3, 0x005043, 0x005043 },
+    { 0x01FD6, 0x0111C2, 0x0111C2 },
+    { 0x01FD7, 0x011203, 0x011203 },
+    { 0x01FD8, 0x011262, 0x011262 },
+    { 0x01FD9, 0x0112A2, 0x0112A2 },
+    { 0x01FDA, 0x0112E2, 0x0112E2 },
+    { 0x01FDB, 0x004F42, 0x004F42 },
+    { 0x01FDD, 0x011322, 0x011363 },
+    { 0x01FDE, 0x0113C2, 0x011403 },
+    { 0x01FDF, 0x011462, 0x0114A3 },
+    { 0x01FE0, 0x011502, 0x011502 },
+    { 0x01FE1, 0x011542, 0x011542 },
+    { 0x01FE2, 0x011583, 0x011583 },
+    { 0x01FE3, 0x005223, 0x005223 },
+    { 0x01FE4, 0x0115E2, 0x0115E2 },
+    { 0x01FE5, 0x011622, 0x011622 },
+    { 0x01FE6, 0x011662, 0x011662 },
+    { 0x01FE7, 0x0116A3, 0x0116A3 },
+    { 0x01FE8, 0x011702, 0x011702 },
+    { 0x01FE9, 0x011742, 0x011742 },
+    { 0x01FEA, 0x011782, 0x011782 },
+    { 0x01FEB, 0x004FC2, 0x004FC2 },
+    { 0x01FEC, 0x0117C2, 0x0117C2 },
+    { 0x01FED, 0x011802, 0x011843 },
+    { 0x01FEE, 0x004DC2, 0x004E03 },
+    { 0x01FEF, 0x0118A1, 0x0118A1 },
+    { 0x01FF2, 0x0118C3, 0x0118C3 },
+    { 0x01FF3, 0x011922, 0x011922 },
+    { 0x01FF4, 0x011963, 0x011963 },
+    { 0x01FF6, 0x0119C2, 0x0119C2 },
+    { 0x01FF7, 0x011A03, 0x011A03 },
+    { 0x01FF8, 0x011A62, 0x011A62 },
+    { 0x01FF9, 0x004F82, 0x004F82 },
+    { 0x01FFA, 0x011AA2, 0x011AA2 },
+    { 0x01FFB, 0x005002, 0x005002 },
+    { 0x01FFC, 0x011AE2, 0x011AE2 },
+    { 0x01FFD, 0x011B21, 0x000102 },
+    { 0x01FFE, 0x000000, 0x011B42 },
+    { 0x02000, 0x011B81, 0x000001 },
+    { 0x02001, 0x011BA1, 0x000001 },
+    { 0x02002, 0x000000, 0x000001 },
+    { 0x02003, 0x000000, 0x000001 },
+    { 0x02004, 0x000000, 0x000001 },
+    { 0x02005, 0x000000, 0x000001 },
+    { 0x02006, 0x000000, 0x000001 },
+    { 0x02007, 0x000000, 0x000001 },
+    { 0x02008, 0x000000, 0x000001 },
+    { 0x02009, 0x000000, 0x000001 },
+    { 0x0200A, 0x000000, 0x000001 },
+    { 0x02011, 0x000000, 0x011BC1 },
+    { 0x02017, 0x000000, 0x011BE2 },
+    { 0x02024, 0x000000, 0x011C21 },
+    { 0x02025, 0x000000, 0x011C42 },
+    { 0x02026, 0x000000, 0x011C83 },
+    { 0x0202F, 0x000000, 0x000001 },
+    { 0x02033, 0x000000, 0x011CE2 },
+    { 0x02034, 0x000000, 0x011D23 },
+    { 0x02036, 0x000000, 0x011D82 },
+    { 0x02037, 0x000000, 0x011DC3 },
+    { 0x0203C, 0x000000, 0x011E22 },
+    { 0x0203E, 0x000000, 0x011E62 },
+    { 0x02047, 0x000000, 0x011EA2 },
+    { 0x02048, 0x000000, 0x011EE2 },
+    { 0x02049, 0x000000, 0x011F22 },
+    { 0x02057, 0x000000, 0x011F64 },
+    { 0x0205F, 0x000000, 0x000001 },
+    { 0x02070, 0x000000, 0x011FE1 },
+    { 0x02071, 0x000000, 0x008041 },
+    { 0x02074, 0x000000, 0x012001 },
+    { 0x02075, 0x000000, 0x012021 },
+    { 0x02076, 0x000000, 0x012041 },
+    { 0x02077, 0x000000, 0x012061 },
+    { 0x02078, 0x000000, 0x012081 },
+    { 0x02079, 0x000000, 0x0120A1 },
+    { 0x0207A, 0x000000, 0x0120C1 },
+    { 0x0207B, 0x000000, 0x0120E1 },
+    { 0x0207C, 0x000000, 0x012101 },
+    { 0x0207D, 0x000000, 0x012121 },
+    { 0x0207E, 0x000000, 0x012141 },
+    { 0x0207F, 0x000000, 0x012161 },
+    { 0x02080, 0x000000, 0x011FE1 },
+    { 0x02081, 0x000000, 0x0001A1 },
+    { 0x02082, 0x000000, 0x0000C1 },
+    { 0x02083, 0x000000, 0x0000E1 },
+    { 0x02084, 0x000000, 0x012001 },
+    { 0x02085, 0x000000, 0x012021 },
+    { 0x02086, 0x000000, 0x012041 },
+    { 0x02087, 0x000000, 0x012061 },
+    { 0x02088, 0x000000, 0x012081 },
+    { 0x02089, 0x000000, 0x0120A1 },
+    { 0x0208A, 0x000000, 0x0120C1 },
+    { 0x0208B, 0x000000, 0x0120E1 },
+    { 0x0208C, 0x000000, 0x012101 },
+    { 0x0208D, 0x000000, 0x012121 },
+    { 0x0208E, 0x000000, 0x012141 },
+    { 0x02090, 0x000000, 0x000061 },
+    { 0x02091, 0x000000, 0x007DA1 },
+    { 0x02092, 0x000000, 0x0001C1 },
+    { 0x02093, 0x000000, 0x004C61 },
+    { 0x02094, 0x000000, 0x007DC1 },
+    { 0x02095, 0x000000, 0x004981 },
+    { 0x02096, 0x000000, 0x007E41 },
+    { 0x02097, 0x000000, 0x004C41 },
+    { 0x02098, 0x000000, 0x007E61 },
+    { 0x02099, 0x000000, 0x012161 },
+    { 0x0209A, 0x000000, 0x007F01 },
+    { 0x0209B, 0x000000, 0x002C81 },
+    { 0x0209C, 0x000000, 0x007F21 },
+    { 0x020A8, 0x000000, 0x012182 },
+    { 0x02100, 0x000000, 0x0121C3 },
+    { 0x02101, 0x000000, 0x012223 },
+    { 0x02102, 0x000000, 0x012281 },
+    { 0x02103, 0x000000, 0x0122A2 },
+    { 0x02105, 0x000000, 0x0122E3 },
+    { 0x02106, 0x000000, 0x012343 },
+    { 0x02107, 0x000000, 0x0123A1 },
+    { 0x02109, 0x000000, 0x0123C2 },
+    { 0x0210A, 0x000000, 0x007E21 },
+    { 0x0210B, 0x000000, 0x007B41 },
+    { 0x0210C, 0x000000, 0x007B41 },
+    { 0x0210D, 0x000000, 0x007B41 },
+    { 0x0210E, 0x000000, 0x004981 },
+    { 0x0210F, 0x000000, 0x012401 },
+    { 0x02110, 0x000000, 0x007B61 },
+    { 0x02111, 0x000000, 0x007B61 },
+    { 0x02112, 0x000000, 0x007BC1 },
+    { 0x02113, 0x000000, 0x004C41 },
+    { 0x02115, 0x000000, 0x007C01 },
+    { 0x02116, 0x000000, 0x012422 },
+    { 0x02119, 0x000000, 0x007C61 },
+    { 0x0211A, 0x000000, 0x012461 },
+    { 0x0211B, 0x000000, 0x007C81 },
+    { 0x0211C, 0x000000, 0x007C81 },
+    { 0x0211D, 0x000000, 0x007C81 },
+    { 0x02120, 0x000000, 0x012482 },
+    { 0x02121, 0x000000, 0x0124C3 },
+    { 0x02122, 0x000000, 0x012522 },
+    { 0x02124, 0x000000, 0x012561 },
+    { 0x02126, 0x012581, 0x012581 },
+    { 0x02128, 0x000000, 0x012561 },
+    { 0x0212A, 0x007BA1, 0x007BA1 },
+    { 0x0212B, 0x000442, 0x000442 },
+    { 0x0212C, 0x000000, 0x007AA1 },
+    { 0x0212D, 0x000000, 0x012281 },
+    { 0x0212F, 0x000000, 0x007DA1 },
+    { 0x02130, 0x000000, 0x007AE1 },
+    { 0x02131, 0x000000, 0x0125A1 },
+    { 0x02133, 0x000000, 0x007BE1 },
+    { 0x02134, 0x000000, 0x0001C1 },
+    { 0x02135, 0x000000, 0x0125C1 },
+    { 0x02136, 0x000000, 0x0125E1 },
+    { 0x02137, 0x000000, 0x012601 },
+    { 0x02138, 0x000000, 0x012621 },
+    { 0x02139, 0x000000, 0x008041 },
+    { 0x0213B, 0x000000, 0x012643 },
+    { 0x0213C, 0x000000, 0x0054C1 },
+    { 0x0213D, 0x000000, 0x007FE1 },
+    { 0x0213E, 0x000000, 0x0126A1 },
+    { 0x0213F, 0x000000, 0x0126C1 },
+    { 0x02140, 0x000000, 0x0126E1 },
+    { 0x02145, 0x000000, 0x007AC1 },
+    { 0x02146, 0x000000, 0x007D81 },
+    { 0x02147, 0x000000, 0x007DA1 },
+    { 0x02148, 0x000000, 0x008041 },
+    { 0x02149, 0x000000, 0x0049C1 },
+    { 0x02150, 0x000000, 0x012703 },
+    { 0x02151, 0x000000, 0x012763 },
+    { 0x02152, 0x000000, 0x0127C4 },
+    { 0x02153, 0x000000, 0x012843 },
+    { 0x02154, 0x000000, 0x0128A3 },
+    { 0x02155, 0x000000, 0x012903 },
+    { 0x02156, 0x000000, 0x012963 },
+    { 0x02157, 0x000000, 0x0129C3 },
+    { 0x02158, 0x000000, 0x012A23 },
+    { 0x02159, 0x000000, 0x012A83 },
+    { 0x0215A, 0x000000, 0x012AE3 },
+    { 0x0215B, 0x000000, 0x012B43 },
+    { 0x0215C, 0x000000, 0x012BA3 },
+    { 0x0215D, 0x000000, 0x012C03 },
+    { 0x0215E, 0x000000, 0x012C63 },
+    { 0x0215F, 0x000000, 0x012CC2 },
+    { 0x02160, 0x000000, 0x007B61 },
+    { 0x02161, 0x000000, 0x012D02 },
+    { 0x02162, 0x000000, 0x012D43 },
+    { 0x02163, 0x000000, 0x012DA2 },
+    { 0x02164, 0x000000, 0x012DE1 },
+    { 0x02165, 0x000000, 0x012E02 },
+    { 0x02166, 0x000000, 0x012E43 },
+    { 0x02167, 0x000000, 0x012EA4 },
+    { 0x02168, 0x000000, 0x012F22 },
+    { 0x02169, 0x000000, 0x012F61 },
+    { 0x0216A, 0x000000, 0x012F82 },
+    { 0x0216B, 0x000000, 0x012FC3 },
+    { 0x0216C, 0x000000, 0x007BC1 },
+    { 0x0216D, 0x000000, 0x012281 },
+    { 0x0216E, 0x000000, 0x007AC1 },
+    { 0x0216F, 0x000000, 0x007BE1 },
+    { 0x02170, 0x000000, 0x008041 },
+    { 0x02171, 0x000000, 0x013022 },
+    { 0x02172, 0x000000, 0x013063 },
+    { 0x02173, 0x000000, 0x0130C2 },
+    { 0x02174, 0x000000, 0x007FA1 },
+    { 0x02175, 0x000000, 0x013102 },
+    { 0x02176, 0x000000, 0x013143 },
+    { 0x02177, 0x000000, 0x0131A4 },
+    { 0x02178, 0x000000, 0x013222 },
+    { 0x02179, 0x000000, 0x004C61 },
+    { 0x0217A, 0x000000, 0x013262 },
+    { 0x0217B, 0x000000, 0x0132A3 },
+    { 0x0217C, 0x000000, 0x004C41 },
+    { 0x0217D, 0x000000, 0x0080A1 },
+    { 0x0217E, 0x000000, 0x007D81 },
+    { 0x0217F, 0x000000, 0x007E61 },
+    { 0x02189, 0x000000, 0x013303 },
+    { 0x0219A, 0x013362, 0x013362 },
+    { 0x0219B, 0x0133A2, 0x0133A2 },
+    { 0x021AE, 0x0133E2, 0x0133E2 },
+    { 0x021CD, 0x013422, 0x013422 },
+    { 0x021CE, 0x013462, 0x013462 },
+    { 0x021CF, 0x0134A2, 0x0134A2 },
+    { 0x02204, 0x0134E2, 0x0134E2 },
+    { 0x02209, 0x013522, 0x013522 },
+    { 0x0220C, 0x013562, 0x013562 },
+    { 0x02224, 0x0135A2, 0x0135A2 },
+    { 0x02226, 0x0135E2, 0x0135E2 },
+    { 0x0222C, 0x000000, 0x013622 },
+    { 0x0222D, 0x000000, 0x013663 },
+    { 0x0222F, 0x000000, 0x0136C2 },
+    { 0x02230, 0x000000, 0x013703 },
+    { 0x02241, 0x013762, 0x013762 },
+    { 0x02244, 0x0137A2, 0x0137A2 },
+    { 0x02247, 0x0137E2, 0x0137E2 },
+    { 0x02249, 0x013822, 0x013822 },
+    { 0x02260, 0x013862, 0x013862 },
+    { 0x02262, 0x0138A2, 0x0138A2 },
+    { 0x0226D, 0x0138E2, 0x0138E2 },
+    { 0x0226E, 0x013922, 0x013922 },
+    { 0x0226F, 0x013962, 0x013962 },
+    { 0x02270, 0x0139A2, 0x0139A2 },
+    { 0x02271, 0x0139E2, 0x0139E2 },
+    { 0x02274, 0x013A22, 0x013A22 },
+    { 0x02275, 0x013A62, 0x013A62 },
+    { 0x02278, 0x013AA2, 0x013AA2 },
+    { 0x02279, 0x013AE2, 0x013AE2 },
+    { 0x02280, 0x013B22, 0x013B22 },
+    { 0x02281, 0x013B62, 0x013B62 },
+    { 0x02284, 0x013BA2, 0x013BA2 },
+    { 0x02285, 0x013BE2, 0x013BE2 },
+    { 0x02288, 0x013C22, 0x013C22 },
+    { 0x02289, 0x013C62, 0x013C62 },
+    { 0x022AC, 0x013CA2, 0x013CA2 },
+    { 0x022AD, 0x013CE2, 0x013CE2 },
+    { 0x022AE, 0x013D22, 0x013D22 },
+    { 0x022AF, 0x013D62, 0x013D62 },
+    { 0x022E0, 0x013DA2, 0x013DA2 },
+    { 0x022E1, 0x013DE2, 0x013DE2 },
+    { 0x022E2, 0x013E22, 0x013E22 },
+    { 0x022E3, 0x013E62, 0x013E62 },
+    { 0x022EA, 0x013EA2, 0x013EA2 },
+    { 0x022EB, 0x013EE2, 0x013EE2 },
+    { 0x022EC, 0x013F22, 0x013F22 },
+    { 0x022ED, 0x013F62, 0x013F62 },
+    { 0x02329, 0x013FA1, 0x013FA1 },
+    { 0x0232A, 0x013FC1, 0x013FC1 },
+    { 0x02460, 0x000000, 0x0001A1 },
+    { 0x02461, 0x000000, 0x0000C1 },
+    { 0x02462, 0x000000, 0x0000E1 },
+    { 0x02463, 0x000000, 0x012001 },
+    { 0x02464, 0x000000, 0x012021 },
+    { 0x02465, 0x000000, 0x012041 },
+    { 0x02466, 0x000000, 0x012061 },
+    { 0x02467, 0x000000, 0x012081 },
+    { 0x02468, 0x000000, 0x0120A1 },
+    { 0x02469, 0x000000, 0x013FE2 },
+    { 0x0246A, 0x000000, 0x014022 },
+    { 0x0246B, 0x000000, 0x014062 },
+    { 0x0246C, 0x000000, 0x0140A2 },
+    { 0x0246D, 0x000000, 0x0140E2 },
+    { 0x0246E, 0x000000, 0x014122 },
+    { 0x0246F, 0x000000, 0x014162 },
+    { 0x02470, 0x000000, 0x0141A2 },
+    { 0x02471, 0x000000, 0x0141E2 },
+    { 0x02472, 0x000000, 0x014222 },
+    { 0x02473, 0x000000, 0x014262 },
+    { 0x02474, 0x000000, 0x0142A3 },
+    { 0x02475, 0x000000, 0x014303 },
+    { 0x02476, 0x000000, 0x014363 },
+    { 0x02477, 0x000000, 0x0143C3 },
+    { 0x02478, 0x000000, 0x014423 },
+    { 0x02479, 0x000000, 0x014483 },
+    { 0x0247A, 0x000000, 0x0144E3 },
+    { 0x0247B, 0x000000, 0x014543 },
+    { 0x0247C, 0x000000, 0x0145A3 },
+    { 0x0247D, 0x000000, 0x014604 },
+    { 0x0247E, 0x000000, 0x014684 },
+    { 0x0247F, 0x000000, 0x014704 },
+    { 0x02480, 0x000000, 0x014784 },
+    { 0x02481, 0x000000, 0x014804 },
+    { 0x02482, 0x000000, 0x014884 },
+    { 0x02483, 0x000000, 0x014904 },
+    { 0x02484, 0x000000, 0x014984 },
+    { 0x02485, 0x000000, 0x014A04 },
+    { 0x02486, 0x000000, 0x014A84 },
+    { 0x02487, 0x000000, 0x014B04 },
+    { 0x02488, 0x000000, 0x014B82 },
+    { 0x02489, 0x000000, 0x014BC2 },
+    { 0x0248A, 0x000000, 0x014C02 },
+    { 0x0248B, 0x000000, 0x014C42 },
+    { 0x0248C, 0x000000, 0x014C82 },
+    { 0x0248D, 0x000000, 0x014CC2 },
+    { 0x0248E, 0x000000, 0x014D02 },
+    { 0x0248F, 0x000000, 0x014D42 },
+    { 0x02490, 0x000000, 0x014D82 },
+    { 0x02491, 0x000000, 0x014DC3 },
+    { 0x02492, 0x000000, 0x014E23 },
+    { 0x02493, 0x000000, 0x014E83 },
+    { 0x02494, 0x000000, 0x014EE3 },
+    { 0x02495, 0x000000, 0x014F43 },
+    { 0x02496, 0x000000, 0x014FA3 },
+    { 0x02497, 0x000000, 0x015003 },
+    { 0x02498, 0x000000, 0x015063 },
+    { 0x02499, 0x000000, 0x0150C3 },
+    { 0x0249A, 0x000000, 0x015123 },
+    { 0x0249B, 0x000000, 0x015183 },
+    { 0x0249C, 0x000000, 0x0151E3 },
+    { 0x0249D, 0x000000, 0x015243 },
+    { 0x0249E, 0x000000, 0x0152A3 },
+    { 0x0249F, 0x000000, 0x015303 },
+    { 0x024A0, 0x000000, 0x015363 },
+    { 0x024A1, 0x000000, 0x0153C3 },
+    { 0x024A2, 0x000000, 0x015423 },
+    { 0x024A3, 0x000000, 0x015483 },
+    { 0x024A4, 0x000000, 0x0154E3 },
+    { 0x024A5, 0x000000, 0x015543 },
+    { 0x024A6, 0x000000, 0x0155A3 },
+    { 0x024A7, 0x000000, 0x015603 },
+    { 0x024A8, 0x000000, 0x015663 },
+    { 0x024A9, 0x000000, 0x0156C3 },
+    { 0x024AA, 0x000000, 0x015723 },
+    { 0x024AB, 0x000000, 0x015783 },
+    { 0x024AC, 0x000000, 0x0157E3 },
+    { 0x024AD, 0x000000, 0x015843 },
+    { 0x024AE, 0x000000, 0x0158A3 },
+    { 0x024AF, 0x000000, 0x015903 },
+    { 0x024B0, 0x000000, 0x015963 },
+    { 0x024B1, 0x000000, 0x0159C3 },
+    { 0x024B2, 0x000000, 0x015A23 },
+    { 0x024B3, 0x000000, 0x015A83 },
+    { 0x024B4, 0x000000, 0x015AE3 },
+    { 0x024B5, 0x000000, 0x015B43 },
+    { 0x024B6, 0x000000, 0x007A61 },
+    { 0x024B7, 0x000000, 0x007AA1 },
+    { 0x024B8, 0x000000, 0x012281 },
+    { 0x024B9, 0x000000, 0x007AC1 },
+    { 0x024BA, 0x000000, 0x007AE1 },
+    { 0x024BB, 0x000000, 0x0125A1 },
+    { 0x024BC, 0x000000, 0x007B21 },
+    { 0x024BD, 0x000000, 0x007B41 },
+    { 0x024BE, 0x000000, 0x007B61 },
+    { 0x024BF, 0x000000, 0x007B81 },
+    { 0x024C0, 0x000000, 0x007BA1 },
+    { 0x024C1, 0x000000, 0x007BC1 },
+    { 0x024C2, 0x000000, 0x007BE1 },
+    { 0x024C3, 0x000000, 0x007C01 },
+    { 0x024C4, 0x000000, 0x007C21 },
+    { 0x024C5, 0x000000, 0x007C61 },
+    { 0x024C6, 0x000000, 0x012461 },
+    { 0x024C7, 0x000000, 0x007C81 },
+    { 0x024C8, 0x000000, 0x015BA1 },
+    { 0x024C9, 0x000000, 0x007CA1 },
+    { 0x024CA, 0x000000, 0x007CC1 },
+    { 0x024CB, 0x000000, 0x012DE1 },
+    { 0x024CC, 0x000000, 0x007CE1 },
+    { 0x024CD, 0x000000, 0x012F61 },
+    { 0x024CE, 0x000000, 0x015BC1 },
+    { 0x024CF, 0x000000, 0x012561 },
+    { 0x024D0, 0x000000, 0x000061 },
+    { 0x024D1, 0x000000, 0x007D61 },
+    { 0x024D2, 0x000000, 0x0080A1 },
+    { 0x024D3, 0x000000, 0x007D81 },
+    { 0x024D4, 0x000000, 0x007DA1 },
+    { 0x024D5, 0x000000, 0x008101 },
+    { 0x024D6, 0x000000, 0x007E21 },
+    { 0x024D7, 0x000000, 0x004981 },
+    { 0x024D8, 0x000000, 0x008041 },
+    { 0x024D9, 0x000000, 0x0049C1 },
+    { 0x024DA, 0x000000, 0x007E41 },
+    { 0x024DB, 0x000000, 0x004C41 },
+    { 0x024DC, 0x000000, 0x007E61 },
+    { 0x024DD, 0x000000, 0x012161 },
+    { 0x024DE, 0x000000, 0x0001C1 },
+    { 0x024DF, 0x000000, 0x007F01 },
+    { 0x024E0, 0x000000, 0x015BE1 },
+    { 0x024E1, 0x000000, 0x0049E1 },
+    { 0x024E2, 0x000000, 0x002C81 },
+    { 0x024E3, 0x000000, 0x007F21 },
+    { 0x024E4, 0x000000, 0x007F41 },
+    { 0x024E5, 0x000000, 0x007FA1 },
+    { 0x024E6, 0x000000, 0x004A61 },
+    { 0x024E7, 0x000000, 0x004C61 },
+    { 0x024E8, 0x000000, 0x004A81 },
+    { 0x024E9, 0x000000, 0x008461 },
+    { 0x024EA, 0x000000, 0x011FE1 },
+    { 0x02A0C, 0x000000, 0x015C04 },
+    { 0x02A74, 0x000000, 0x015C83 },
+    { 0x02A75, 0x000000, 0x015CE2 },
+    { 0x02A76, 0x000000, 0x015D23 },
+    { 0x02ADC, 0x015D82, 0x015D82 },
+    { 0x02C7C, 0x000000, 0x0049C1 },
+    { 0x02C7D, 0x000000, 0x012DE1 },
+    { 0x02D6F, 0x000000, 0x015DC1 },
+    { 0x02E9F, 0x000000, 0x015DE1 },
+    { 0x02EF3, 0x000000, 0x015E01 },
+    { 0x02F00, 0x000000, 0x015E21 },
+    { 0x02F01, 0x000000, 0x015E41 },
+    { 0x02F02, 0x000000, 0x015E61 },
+    { 0x02F03, 0x000000, 0x015E81 },
+    { 0x02F04, 0x000000, 0x015EA1 },
+    { 0x02F05, 0x000000, 0x015EC1 },
+    { 0x02F06, 0x000000, 0x015EE1 },
+    { 0x02F07, 0x000000, 0x015F01 },
+    { 0x02F08, 0x000000, 0x015F21 },
+    { 0x02F09, 0x000000, 0x015F41 },
+    { 0x02F0A, 0x000000, 0x015F61 },
+    { 0x02F0B, 0x000000, 0x015F81 },
+    { 0x02F0C, 0x000000, 0x015FA1 },
+    { 0x02F0D, 0x000000, 0x015FC1 },
+    { 0x02F0E, 0x000000, 0x015FE1 },
+    { 0x02F0F, 0x000000, 0x016001 },
+    { 0x02F10, 0x000000, 0x016021 },
+    { 0x02F11, 0x000000, 0x016041 },
+    { 0x02F12, 0x000000, 0x016061 },
+    { 0x02F13, 0x000000, 0x016081 },
+    { 0x02F14, 0x000000, 0x0160A1 },
+    { 0x02F15, 0x000000, 0x0160C1 },
+    { 0x02F16, 0x000000, 0x0160E1 },
+    { 0x02F17, 0x000000, 0x016101 },
+    { 0x02F18, 0x000000, 0x016121 },
+    { 0x02F19, 0x000000, 0x016141 },
+    { 0x02F1A, 0x000000, 0x016161 },
+    { 0x02F1B, 0x000000, 0x016181 },
+    { 0x02F1C, 0x000000, 0x0161A1 },
+    { 0x02F1D, 0x000000, 0x0161C1 },
+    { 0x02F1E, 0x000000, 0x0161E1 },
+    { 0x02F1F, 0x000000, 0x016201 },
+    { 0x02F20, 0x000000, 0x016221 },
+    { 0x02F21, 0x000000, 0x016241 },
+    { 0x02F22, 0x000000, 0x016261 },
+    { 0x02F23, 0x000000, 0x016281 },
+    { 0x02F24, 0x000000, 0x0162A1 },
+    { 0x02F25, 0x000000, 0x0162C1 },
+    { 0x02F26, 0x000000, 0x0162E1 },
+    { 0x02F27, 0x000000, 0x016301 },
+    { 0x02F28, 0x000000, 0x016321 },
+    { 0x02F29, 0x000000, 0x016341 },
+    { 0x02F2A, 0x000000, 0x016361 },
+    { 0x02F2B, 0x000000, 0x016381 },
+    { 0x02F2C, 0x000000, 0x0163A1 },
+    { 0x02F2D, 0x000000, 0x0163C1 },
+    { 0x02F2E, 0x000000, 0x0163E1 },
+    { 0x02F2F, 0x000000, 0x016401 },
+    { 0x02F30, 0x000000, 0x016421 },
+    { 0x02F31, 0x000000, 0x016441 },
+    { 0x02F32, 0x000000, 0x016461 },
+    { 0x02F33, 0x000000, 0x016481 },
+    { 0x02F34, 0x000000, 0x0164A1 },
+    { 0x02F35, 0x000000, 0x0164C1 },
+    { 0x02F36, 0x000000, 0x0164E1 },
+    { 0x02F37, 0x000000, 0x016501 },
+    { 0x02F38, 0x000000, 0x016521 },
+    { 0x02F39, 0x000000, 0x016541 },
+    { 0x02F3A, 0x000000, 0x016561 },
+    { 0x02F3B, 0x000000, 0x016581 },
+    { 0x02F3C, 0x000000, 0x0165A1 },
+    { 0x02F3D, 0x000000, 0x0165C1 },
+    { 0x02F3E, 0x000000, 0x0165E1 },
+    { 0x02F3F, 0x000000, 0x016601 },
+    { 0x02F40, 0x000000, 0x016621 },
+    { 0x02F41, 0x000000, 0x016641 },
+    { 0x02F42, 0x000000, 0x016661 },
+    { 0x02F43, 0x000000, 0x016681 },
+    { 0x02F44, 0x000000, 0x0166A1 },
+    { 0x02F45, 0x000000, 0x0166C1 },
+    { 0x02F46, 0x000000, 0x0166E1 },
+    { 0x02F47, 0x000000, 0x016701 },
+    { 0x02F48, 0x000000, 0x016721 },
+    { 0x02F49, 0x000000, 0x016741 },
+    { 0x02F4A, 0x000000, 0x016761 },
+    { 0x02F4B, 0x000000, 0x016781 },
+    { 0x02F4C, 0x000000, 0x0167A1 },
+    { 0x02F4D, 0x000000, 0x0167C1 },
+    { 0x02F4E, 0x000000, 0x0167E1 },
+    { 0x02F4F, 0x000000, 0x016801 },
+    { 0x02F50, 0x000000, 0x016821 },
+    { 0x02F51, 0x000000, 0x016841 },
+    { 0x02F52, 0x000000, 0x016861 },
+    { 0x02F53, 0x000000, 0x016881 },
+    { 0x02F54, 0x000000, 0x0168A1 },
+    { 0x02F55, 0x000000, 0x0168C1 },
+    { 0x02F56, 0x000000, 0x0168E1 },
+    { 0x02F57, 0x000000, 0x016901 },
+    { 0x02F58, 0x000000, 0x016921 },
+    { 0x02F59, 0x000000, 0x016941 },
+    { 0x02F5A, 0x000000, 0x016961 },
+    { 0x02F5B, 0x000000, 0x016981 },
+    { 0x02F5C, 0x000000, 0x0169A1 },
+    { 0x02F5D, 0x000000, 0x0169C1 },
+    { 0x02F5E, 0x000000, 0x0169E1 },
+    { 0x02F5F, 0x000000, 0x016A01 },
+    { 0x02F60, 0x000000, 0x016A21 },
+    { 0x02F61, 0x000000, 0x016A41 },
+    { 0x02F62, 0x000000, 0x016A61 },
+    { 0x02F63, 0x000000, 0x016A81 },
+    { 0x02F64, 0x000000, 0x016AA1 },
+    { 0x02F65, 0x000000, 0x016AC1 },
+    { 0x02F66, 0x000000, 0x016AE1 },
+    { 0x02F67, 0x000000, 0x016B01 },
+    { 0x02F68, 0x000000, 0x016B21 },
+    { 0x02F69, 0x000000, 0x016B41 },
+    { 0x02F6A, 0x000000, 0x016B61 },
+    { 0x02F6B, 0x000000, 0x016B81 },
+    { 0x02F6C, 0x000000, 0x016BA1 },
+    { 0x02F6D, 0x000000, 0x016BC1 },
+    { 0x02F6E, 0x000000, 0x016BE1 },
+    { 0x02F6F, 0x000000, 0x016C01 },
+    { 0x02F70, 0x000000, 0x016C21 },
+    { 0x02F71, 0x000000, 0x016C41 },
+    { 0x02F72, 0x000000, 0x016C61 },
+    { 0x02F73, 0x000000, 0x016C81 },
+    { 0x02F74, 0x000000, 0x016CA1 },
+    { 0x02F75, 0x000000, 0x016CC1 },
+    { 0x02F76, 0x000000, 0x016CE1 },
+    { 0x02F77, 0x000000, 0x016D01 },
+    { 0x02F78, 0x000000, 0x016D21 },
+    { 0x02F79, 0x000000, 0x016D41 },
+    { 0x02F7A, 0x000000, 0x016D61 },
+    { 0x02F7B, 0x000000, 0x016D81 },
+    { 0x02F7C, 0x000000, 0x016DA1 },
+    { 0x02F7D, 0x000000, 0x016DC1 },
+    { 0x02F7E, 0x000000, 0x016DE1 },
+    { 0x02F7F, 0x000000, 0x016E01 },
+    { 0x02F80, 0x000000, 0x016E21 },
+    { 0x02F81, 0x000000, 0x016E41 },
+    { 0x02F82, 0x000000, 0x016E61 },
+    { 0x02F83, 0x000000, 0x016E81 },
+    { 0x02F84, 0x000000, 0x016EA1 },
+    { 0x02F85, 0x000000, 0x016EC1 },
+    { 0x02F86, 0x000000, 0x016EE1 },
+    { 0x02F87, 0x000000, 0x016F01 },
+    { 0x02F88, 0x000000, 0x016F21 },
+    { 0x02F89, 0x000000, 0x016F41 },
+    { 0x02F8A, 0x000000, 0x016F61 },
+    { 0x02F8B, 0x000000, 0x016F81 },
+    { 0x02F8C, 0x000000, 0x016FA1 },
+    { 0x02F8D, 0x000000, 0x016FC1 },
+    { 0x02F8E, 0x000000, 0x016FE1 },
+    { 0x02F8F, 0x000000, 0x017001 },
+    { 0x02F90, 0x000000, 0x017021 },
+    { 0x02F91, 0x000000, 0x017041 },
+    { 0x02F92, 0x000000, 0x017061 },
+    { 0x02F93, 0x000000, 0x017081 },
+    { 0x02F94, 0x000000, 0x0170A1 },
+    { 0x02F95, 0x000000, 0x0170C1 },
+    { 0x02F96, 0x000000, 0x0170E1 },
+    { 0x02F97, 0x000000, 0x017101 },
+    { 0x02F98, 0x000000, 0x017121 },
+    { 0x02F99, 0x000000, 0x017141 },
+    { 0x02F9A, 0x000000, 0x017161 },
+    { 0x02F9B, 0x000000, 0x017181 },
+    { 0x02F9C, 0x000000, 0x0171A1 },
+    { 0x02F9D, 0x000000, 0x0171C1 },
+    { 0x02F9E, 0x000000, 0x0171E1 },
+    { 0x02F9F, 0x000000, 0x017201 },
+    { 0x02FA0, 0x000000, 0x017221 },
+    { 0x02FA1, 0x000000, 0x017241 },
+    { 0x02FA2, 0x000000, 0x017261 },
+    { 0x02FA3, 0x000000, 0x017281 },
+    { 0x02FA4, 0x000000, 0x0172A1 },
+    { 0x02FA5, 0x000000, 0x0172C1 },
+    { 0x02FA6, 0x000000, 0x0172E1 },
+    { 0x02FA7, 0x000000, 0x017301 },
+    { 0x02FA8, 0x000000, 0x017321 },
+    { 0x02FA9, 0x000000, 0x017341 },
+    { 0x02FAA, 0x000000, 0x017361 },
+    { 0x02FAB, 0x000000, 0x017381 },
+    { 0x02FAC, 0x000000, 0x0173A1 },
+    { 0x02FAD, 0x000000, 0x0173C1 },
+    { 0x02FAE, 0x000000, 0x0173E1 },
+    { 0x02FAF, 0x000000, 0x017401 },
+    { 0x02FB0, 0x000000, 0x017421 },
+    { 0x02FB1, 0x000000, 0x017441 },
+    { 0x02FB2, 0x000000, 0x017461 },
+    { 0x02FB3, 0x000000, 0x017481 },
+    { 0x02FB4, 0x000000, 0x0174A1 },
+    { 0x02FB5, 0x000000, 0x0174C1 },
+    { 0x02FB6, 0x000000, 0x0174E1 },
+    { 0x02FB7, 0x000000, 0x017501 },
+    { 0x02FB8, 0x000000, 0x017521 },
+    { 0x02FB9, 0x000000, 0x017541 },
+    { 0x02FBA, 0x000000, 0x017561 },
+    { 0x02FBB, 0x000000, 0x017581 },
+    { 0x02FBC, 0x000000, 0x0175A1 },
+    { 0x02FBD, 0x000000, 0x0175C1 },
+    { 0x02FBE, 0x000000, 0x0175E1 },
+    { 0x02FBF, 0x000000, 0x017601 },
+    { 0x02FC0, 0x000000, 0x017621 },
+    { 0x02FC1, 0x000000, 0x017641 },
+    { 0x02FC2, 0x000000, 0x017661 },
+    { 0x02FC3, 0x000000, 0x017681 },
+    { 0x02FC4, 0x000000, 0x0176A1 },
+    { 0x02FC5, 0x000000, 0x0176C1 },
+    { 0x02FC6, 0x000000, 0x0176E1 },
+    { 0x02FC7, 0x000000, 0x017701 },
+    { 0x02FC8, 0x000000, 0x017721 },
+    { 0x02FC9, 0x000000, 0x017741 },
+    { 0x02FCA, 0x000000, 0x017761 },
+    { 0x02FCB, 0x000000, 0x017781 },
+    { 0x02FCC, 0x000000, 0x0177A1 },
+    { 0x02FCD, 0x000000, 0x0177C1 },
+    { 0x02FCE, 0x000000, 0x0177E1 },
+    { 0x02FCF, 0x000000, 0x017801 },
+    { 0x02FD0, 0x000000, 0x017821 },
+    { 0x02FD1, 0x000000, 0x017841 },
+    { 0x02FD2, 0x000000, 0x017861 },
+    { 0x02FD3, 0x000000, 0x017881 },
+    { 0x02FD4, 0x000000, 0x0178A1 },
+    { 0x02FD5, 0x000000, 0x0178C1 },
+    { 0x03000, 0x000000, 0x000001 },
+    { 0x03036, 0x000000, 0x0178E1 },
+    { 0x03038, 0x000000, 0x016101 },
+    { 0x03039, 0x000000, 0x017901 },
+    { 0x0303A, 0x000000, 0x017921 },
+    { 0x0304C, 0x017942, 0x017942 },
+    { 0x0304E, 0x017982, 0x017982 },
+    { 0x03050, 0x0179C2, 0x0179C2 },
+    { 0x03052, 0x017A02, 0x017A02 },
+    { 0x03054, 0x017A42, 0x017A42 },
+    { 0x03056, 0x017A82, 0x017A82 },
+    { 0x03058, 0x017AC2, 0x017AC2 },
+    { 0x0305A, 0x017B02, 0x017B02 },
+    { 0x0305C, 0x017B42, 0x017B42 },
+    { 0x0305E, 0x017B82, 0x017B82 },
+    { 0x03060, 0x017BC2, 0x017BC2 },
+    { 0x03062, 0x017C02, 0x017C02 },
+    { 0x03065, 0x017C42, 0x017C42 },
+    { 0x03067, 0x017C82, 0x017C82 },
+    { 0x03069, 0x017CC2, 0x017CC2 },
+    { 0x03070, 0x017D02, 0x017D02 },
+    { 0x03071, 0x017D42, 0x017D42 },
+    { 0x03073, 0x017D82, 0x017D82 },
+    { 0x03074, 0x017DC2, 0x017DC2 },
+    { 0x03076, 0x017E02, 0x017E02 },
+    { 0x03077, 0x017E42, 0x017E42 },
+    { 0x03079, 0x017E82, 0x017E82 },
+    { 0x0307A, 0x017EC2, 0x017EC2 },
+    { 0x0307C, 0x017F02, 0x017F02 },
+    { 0x0307D, 0x017F42, 0x017F42 },
+    { 0x03094, 0x017F82, 0x017F82 },
+    { 0x0309B, 0x000000, 0x017FC2 },
+    { 0x0309C, 0x000000, 0x018002 },
+    { 0x0309E, 0x018042, 0x018042 },
+    { 0x0309F, 0x000000, 0x018082 },
+    { 0x030AC, 0x0180C2, 0x0180C2 },
+    { 0x030AE, 0x018102, 0x018102 },
+    { 0x030B0, 0x018142, 0x018142 },
+    { 0x030B2, 0x018182, 0x018182 },
+    { 0x030B4, 0x0181C2, 0x0181C2 },
+    { 0x030B6, 0x018202, 0x018202 },
+    { 0x030B8, 0x018242, 0x018242 },
+    { 0x030BA, 0x018282, 0x018282 },
+    { 0x030BC, 0x0182C2, 0x0182C2 },
+    { 0x030BE, 0x018302, 0x018302 },
+    { 0x030C0, 0x018342, 0x018342 },
+    { 0x030C2, 0x018382, 0x018382 },
+    { 0x030C5, 0x0183C2, 0x0183C2 },
+    { 0x030C7, 0x018402, 0x018402 },
+    { 0x030C9, 0x018442, 0x018442 },
+    { 0x030D0, 0x018482, 0x018482 },
+    { 0x030D1, 0x0184C2, 0x0184C2 },
+    { 0x030D3, 0x018502, 0x018502 },
+    { 0x030D4, 0x018542, 0x018542 },
+    { 0x030D6, 0x018582, 0x018582 },
+    { 0x030D7, 0x0185C2, 0x0185C2 },
+    { 0x030D9, 0x018602, 0x018602 },
+    { 0x030DA, 0x018642, 0x018642 },
+    { 0x030DC, 0x018682, 0x018682 },
+    { 0x030DD, 0x0186C2, 0x0186C2 },
+    { 0x030F4, 0x018702, 0x018702 },
+    { 0x030F7, 0x018742, 0x018742 },
+    { 0x030F8, 0x018782, 0x018782 },
+    { 0x030F9, 0x0187C2, 0x0187C2 },
+    { 0x030FA, 0x018802, 0x018802 },
+    { 0x030FE, 0x018842, 0x018842 },
+    { 0x030FF, 0x000000, 0x018882 },
+    { 0x03131, 0x000000, 0x0188C1 },
+    { 0x03132, 0x000000, 0x0188E1 },
+    { 0x03133, 0x000000, 0x018901 },
+    { 0x03134, 0x000000, 0x018921 },
+    { 0x03135, 0x000000, 0x018941 },
+    { 0x03136, 0x000000, 0x018961 },
+    { 0x03137, 0x000000, 0x018981 },
+    { 0x03138, 0x000000, 0x0189A1 },
+    { 0x03139, 0x000000, 0x0189C1 },
+    { 0x0313A, 0x000000, 0x0189E1 },
+    { 0x0313B, 0x000000, 0x018A01 },
+    { 0x0313C, 0x000000, 0x018A21 },
+    { 0x0313D, 0x000000, 0x018A41 },
+    { 0x0313E, 0x000000, 0x018A61 },
+    { 0x0313F, 0x000000, 0x018A81 },
+    { 0x03140, 0x000000, 0x018AA1 },
+    { 0x03141, 0x000000, 0x018AC1 },
+    { 0x03142, 0x000000, 0x018AE1 },
+    { 0x03143, 0x000000, 0x018B01 },
+    { 0x03144, 0x000000, 0x018B21 },
+    { 0x03145, 0x000000, 0x018B41 },
+    { 0x03146, 0x000000, 0x018B61 },
+    { 0x03147, 0x000000, 0x018B81 },
+    { 0x03148, 0x000000, 0x018BA1 },
+    { 0x03149, 0x000000, 0x018BC1 },
+    { 0x0314A, 0x000000, 0x018BE1 },
+    { 0x0314B, 0x000000, 0x018C01 },
+    { 0x0314C, 0x000000, 0x018C21 },
+    { 0x0314D, 0x000000, 0x018C41 },
+    { 0x0314E, 0x000000, 0x018C61 },
+    { 0x0314F, 0x000000, 0x018C81 },
+    { 0x03150, 0x000000, 0x018CA1 },
+    { 0x03151, 0x000000, 0x018CC1 },
+    { 0x03152, 0x000000, 0x018CE1 },
+    { 0x03153, 0x000000, 0x018D01 },
+    { 0x03154, 0x000000, 0x018D21 },
+    { 0x03155, 0x000000, 0x018D41 },
+    { 0x03156, 0x000000, 0x018D61 },
+    { 0x03157, 0x000000, 0x018D81 },
+    { 0x03158, 0x000000, 0x018DA1 },
+    { 0x03159, 0x000000, 0x018DC1 },
+    { 0x0315A, 0x000000, 0x018DE1 },
+    { 0x0315B, 0x000000, 0x018E01 },
+    { 0x0315C, 0x000000, 0x018E21 },
+    { 0x0315D, 0x000000, 0x018E41 },
+    { 0x0315E, 0x000000, 0x018E61 },
+    { 0x0315F, 0x000000, 0x018E81 },
+    { 0x03160, 0x000000, 0x018EA1 },
+    { 0x03161, 0x000000, 0x018EC1 },
+    { 0x03162, 0x000000, 0x018EE1 },
+    { 0x03163, 0x000000, 0x018F01 },
+    { 0x03164, 0x000000, 0x018F21 },
+    { 0x03165, 0x000000, 0x018F41 },
+    { 0x03166, 0x000000, 0x018F61 },
+    { 0x03167, 0x000000, 0x018F81 },
+    { 0x03168, 0x000000, 0x018FA1 },
+    { 0x03169, 0x000000, 0x018FC1 },
+    { 0x0316A, 0x000000, 0x018FE1 },
+    { 0x0316B, 0x000000, 0x019001 },
+    { 0x0316C, 0x000000, 0x019021 },
+    { 0x0316D, 0x000000, 0x019041 },
+    { 0x0316E, 0x000000, 0x019061 },
+    { 0x0316F, 0x000000, 0x019081 },
+    { 0x03170, 0x000000, 0x0190A1 },
+    { 0x03171, 0x000000, 0x0190C1 },
+    { 0x03172, 0x000000, 0x0190E1 },
+    { 0x03173, 0x000000, 0x019101 },
+    { 0x03174, 0x000000, 0x019121 },
+    { 0x03175, 0x000000, 0x019141 },
+    { 0x03176, 0x000000, 0x019161 },
+    { 0x03177, 0x000000, 0x019181 },
+    { 0x03178, 0x000000, 0x0191A1 },
+    { 0x03179, 0x000000, 0x0191C1 },
+    { 0x0317A, 0x000000, 0x0191E1 },
+    { 0x0317B, 0x000000, 0x019201 },
+    { 0x0317C, 0x000000, 0x019221 },
+    { 0x0317D, 0x000000, 0x019241 },
+    { 0x0317E, 0x000000, 0x019261 },
+    { 0x0317F, 0x000000, 0x019281 },
+    { 0x03180, 0x000000, 0x0192A1 },
+    { 0x03181, 0x000000, 0x0192C1 },
+    { 0x03182, 0x000000, 0x0192E1 },
+    { 0x03183, 0x000000, 0x019301 },
+    { 0x03184, 0x000000, 0x019321 },
+    { 0x03185, 0x000000, 0x019341 },
+    { 0x03186, 0x000000, 0x019361 },
+    { 0x03187, 0x000000, 0x019381 },
+    { 0x03188, 0x000000, 0x0193A1 },
+    { 0x03189, 0x000000, 0x0193C1 },
+    { 0x0318A, 0x000000, 0x0193E1 },
+    { 0x0318B, 0x000000, 0x019401 },
+    { 0x0318C, 0x000000, 0x019421 },
+    { 0x0318D, 0x000000, 0x019441 },
+    { 0x0318E, 0x000000, 0x019461 },
+    { 0x03192, 0x000000, 0x015E21 },
+    { 0x03193, 0x000000, 0x015EE1 },
+    { 0x03194, 0x000000, 0x019481 },
+    { 0x03195, 0x000000, 0x0194A1 },
+    { 0x03196, 0x000000, 0x0194C1 },
+    { 0x03197, 0x000000, 0x0194E1 },
+    { 0x03198, 0x000000, 0x019501 },
+    { 0x03199, 0x000000, 0x019521 },
+    { 0x0319A, 0x000000, 0x015EA1 },
+    { 0x0319B, 0x000000, 0x019541 },
+    { 0x0319C, 0x000000, 0x019561 },
+    { 0x0319D, 0x000000, 0x019581 },
+    { 0x0319E, 0x000000, 0x0195A1 },
+    { 0x0319F, 0x000000, 0x015F21 },
+    { 0x03200, 0x000000, 0x0195C3 },
+    { 0x03201, 0x000000, 0x019623 },
+    { 0x03202, 0x000000, 0x019683 },
+    { 0x03203, 0x000000, 0x0196E3 },
+    { 0x03204, 0x000000, 0x019743 },
+    { 0x03205, 0x000000, 0x0197A3 },
+    { 0x03206, 0x000000, 0x019803 },
+    { 0x03207, 0x000000, 0x019863 },
+    { 0x03208, 0x000000, 0x0198C3 },
+    { 0x03209, 0x000000, 0x019923 },
+    { 0x0320A, 0x000000, 0x019983 },
+    { 0x0320B, 0x000000, 0x0199E3 },
+    { 0x0320C, 0x000000, 0x019A43 },
+    { 0x0320D, 0x000000, 0x019AA3 },
+    { 0x0320E, 0x000000, 0x019B04 },
+    { 0x0320F, 0x000000, 0x019B84 },
+    { 0x03210, 0x000000, 0x019C04 },
+    { 0x03211, 0x000000, 0x019C84 },
+    { 0x03212, 0x000000, 0x019D04 },
+    { 0x03213, 0x000000, 0x019D84 },
+    { 0x03214, 0x000000, 0x019E04 },
+    { 0x03215, 0x000000, 0x019E84 },
+    { 0x03216, 0x000000, 0x019F04 },
+    { 0x03217, 0x000000, 0x019F84 },
+    { 0x03218, 0x000000, 0x01A004 },
+    { 0x03219, 0x000000, 0x01A084 },
+    { 0x0321A, 0x000000, 0x01A104 },
+    { 0x0321B, 0x000000, 0x01A184 },
+    { 0x0321C, 0x000000, 0x01A204 },
+    { 0x0321D, 0x000000, 0x01A287 },
+    { 0x0321E, 0x000000, 0x01A366 },
+    { 0x03220, 0x000000, 0x01A423 },
+    { 0x03221, 0x000000, 0x01A483 },
+    { 0x03222, 0x000000, 0x01A4E3 },
+    { 0x03223, 0x000000, 0x01A543 },
+    { 0x03224, 0x000000, 0x01A5A3 },
+    { 0x03225, 0x000000, 0x01A603 },
+    { 0x03226, 0x000000, 0x01A663 },
+    { 0x03227, 0x000000, 0x01A6C3 },
+    { 0x03228, 0x000000, 0x01A723 },
+    { 0x03229, 0x000000, 0x01A783 },
+    { 0x0322A, 0x000000, 0x01A7E3 },
+    { 0x0322B, 0x000000, 0x01A843 },
+    { 0x0322C, 0x000000, 0x01A8A3 },
+    { 0x0322D, 0x000000, 0x01A903 },
+    { 0x0322E, 0x000000, 0x01A963 },
+    { 0x0322F, 0x000000, 0x01A9C3 },
+    { 0x03230, 0x000000, 0x01AA23 },
+    { 0x03231, 0x000000, 0x01AA83 },
+    { 0x03232, 0x000000, 0x01AAE3 },
+    { 0x03233, 0x000000, 0x01AB43 },
+    { 0x03234, 0x000000, 0x01ABA3 },
+    { 0x03235, 0x000000, 0x01AC03 },
+    { 0x03236, 0x000000, 0x01AC63 },
+    { 0x03237, 0x000000, 0x01ACC3 },
+    { 0x03238, 0x000000, 0x01AD23 },
+    { 0x03239, 0x000000, 0x01AD83 },
+    { 0x0323A, 0x000000, 0x01ADE3 },
+    { 0x0323B, 0x000000, 0x01AE43 },
+    { 0x0323C, 0x000000, 0x01AEA3 },
+    { 0x0323D, 0x000000, 0x01AF03 },
+    { 0x0323E, 0x000000, 0x01AF63 },
+    { 0x0323F, 0x000000, 0x01AFC3 },
+    { 0x03240, 0x000000, 0x01B023 },
+    { 0x03241, 0x000000, 0x01B083 },
+    { 0x03242, 0x000000, 0x01B0E3 },
+    { 0x03243, 0x000000, 0x01B143 },
+    { 0x03244, 0x000000, 0x01B1A1 },
+    { 0x03245, 0x000000, 0x01B1C1 },
+    { 0x03246, 0x000000, 0x016661 },
+    { 0x03247, 0x000000, 0x01B1E1 },
+    { 0x03250, 0x000000, 0x01B203 },
+    { 0x03251, 0x000000, 0x01B262 },
+    { 0x03252, 0x000000, 0x01B2A2 },
+    { 0x03253, 0x000000, 0x01B2E2 },
+    { 0x03254, 0x000000, 0x01B322 },
+    { 0x03255, 0x000000, 0x01B362 },
+    { 0x03256, 0x000000, 0x01B3A2 },
+    { 0x03257, 0x000000, 0x01B3E2 },
+    { 0x03258, 0x000000, 0x01B422 },
+    { 0x03259, 0x000000, 0x01B462 },
+    { 0x0325A, 0x000000, 0x01B4A2 },
+    { 0x0325B, 0x000000, 0x01B4E2 },
+    { 0x0325C, 0x000000, 0x01B522 },
+    { 0x0325D, 0x000000, 0x01B562 },
+    { 0x0325E, 0x000000, 0x01B5A2 },
+    { 0x0325F, 0x000000, 0x01B5E2 },
+    { 0x03260, 0x000000, 0x0188C1 },
+    { 0x03261, 0x000000, 0x018921 },
+    { 0x03262, 0x000000, 0x018981 },
+    { 0x03263, 0x000000, 0x0189C1 },
+    { 0x03264, 0x000000, 0x018AC1 },
+    { 0x03265, 0x000000, 0x018AE1 },
+    { 0x03266, 0x000000, 0x018B41 },
+    { 0x03267, 0x000000, 0x018B81 },
+    { 0x03268, 0x000000, 0x018BA1 },
+    { 0x03269, 0x000000, 0x018BE1 },
+    { 0x0326A, 0x000000, 0x018C01 },
+    { 0x0326B, 0x000000, 0x018C21 },
+    { 0x0326C, 0x000000, 0x018C41 },
+    { 0x0326D, 0x000000, 0x018C61 },
+    { 0x0326E, 0x000000, 0x01B622 },
+    { 0x0326F, 0x000000, 0x01B662 },
+    { 0x03270, 0x000000, 0x01B6A2 },
+    { 0x03271, 0x000000, 0x01B6E2 },
+    { 0x03272, 0x000000, 0x01B722 },
+    { 0x03273, 0x000000, 0x01B762 },
+    { 0x03274, 0x000000, 0x01B7A2 },
+    { 0x03275, 0x000000, 0x01B7E2 },
+    { 0x03276, 0x000000, 0x01B822 },
+    { 0x03277, 0x000000, 0x01B862 },
+    { 0x03278, 0x000000, 0x01B8A2 },
+    { 0x03279, 0x000000, 0x01B8E2 },
+    { 0x0327A, 0x000000, 0x01B922 },
+    { 0x0327B, 0x000000, 0x01B962 },
+    { 0x0327C, 0x000000, 0x01B9A5 },
+    { 0x0327D, 0x000000, 0x01BA44 },
+    { 0x0327E, 0x000000, 0x01BAC2 },
+    { 0x03280, 0x000000, 0x015E21 },
+    { 0x03281, 0x000000, 0x015EE1 },
+    { 0x03282, 0x000000, 0x019481 },
+    { 0x03283, 0x000000, 0x0194A1 },
+    { 0x03284, 0x000000, 0x01BB01 },
+    { 0x03285, 0x000000, 0x01BB21 },
+    { 0x03286, 0x000000, 0x01BB41 },
+    { 0x03287, 0x000000, 0x015F81 },
+    { 0x03288, 0x000000, 0x01BB61 },
+    { 0x03289, 0x000000, 0x016101 },
+    { 0x0328A, 0x000000, 0x016741 },
+    { 0x0328B, 0x000000, 0x0168C1 },
+    { 0x0328C, 0x000000, 0x0168A1 },
+    { 0x0328D, 0x000000, 0x016761 },
+    { 0x0328E, 0x000000, 0x0172E1 },
+    { 0x0328F, 0x000000, 0x016201 },
+    { 0x03290, 0x000000, 0x016701 },
+    { 0x03291, 0x000000, 0x01BB81 },
+    { 0x03292, 0x000000, 0x01BBA1 },
+    { 0x03293, 0x000000, 0x01BBC1 },
+    { 0x03294, 0x000000, 0x01BBE1 },
+    { 0x03295, 0x000000, 0x01BC01 },
+    { 0x03296, 0x000000, 0x01BC21 },
+    { 0x03297, 0x000000, 0x01BC41 },
+    { 0x03298, 0x000000, 0x01BC61 },
+    { 0x03299, 0x000000, 0x01BC81 },
+    { 0x0329A, 0x000000, 0x01BCA1 },
+    { 0x0329B, 0x000000, 0x0162C1 },
+    { 0x0329C, 0x000000, 0x01BCC1 },
+    { 0x0329D, 0x000000, 0x01BCE1 },
+    { 0x0329E, 0x000000, 0x01BD01 },
+    { 0x0329F, 0x000000, 0x01BD21 },
+    { 0x032A0, 0x000000, 0x01BD41 },
+    { 0x032A1, 0x000000, 0x01BD61 },
+    { 0x032A2, 0x000000, 0x01BD81 },
+    { 0x032A3, 0x000000, 0x01BDA1 },
+    { 0x032A4, 0x000000, 0x0194C1 },
+    { 0x032A5, 0x000000, 0x0194E1 },
+    { 0x032A6, 0x000000, 0x019501 },
+    { 0x032A7, 0x000000, 0x01BDC1 },
+    { 0x032A8, 0x000000, 0x01BDE1 },
+    { 0x032A9, 0x000000, 0x01BE01 },
+    { 0x032AA, 0x000000, 0x01BE21 },
+    { 0x032AB, 0x000000, 0x01BE41 },
+    { 0x032AC, 0x000000, 0x01BE61 },
+    { 0x032AD, 0x000000, 0x01BE81 },
+    { 0x032AE, 0x000000, 0x01BEA1 },
+    { 0x032AF, 0x000000, 0x01BEC1 },
+    { 0x032B0, 0x000000, 0x01BEE1 },
+    { 0x032B1, 0x000000, 0x01BF02 },
+    { 0x032B2, 0x000000, 0x01BF42 },
+    { 0x032B3, 0x000000, 0x01BF82 },
+    { 0x032B4, 0x000000, 0x01BFC2 },
+    { 0x032B5, 0x000000, 0x01C002 },
+    { 0x032B6, 0x000000, 0x01C042 },
+    { 0x032B7, 0x000000, 0x01C082 },
+    { 0x032B8, 0x000000, 0x01C0C2 },
+    { 0x032B9, 0x000000, 0x01C102 },
+    { 0x032BA, 0x000000, 0x01C142 },
+    { 0x032BB, 0x000000, 0x01C182 },
+    { 0x032BC, 0x000000, 0x01C1C2 },
+    { 0x032BD, 0x000000, 0x01C202 },
+    { 0x032BE, 0x000000, 0x01C242 },
+    { 0x032BF, 0x000000, 0x01C282 },
+    { 0x032C0, 0x000000, 0x01C2C2 },
+    { 0x032C1, 0x000000, 0x01C302 },
+    { 0x032C2, 0x000000, 0x01C342 },
+    { 0x032C3, 0x000000, 0x01C382 },
+    { 0x032C4, 0x000000, 0x01C3C2 },
+    { 0x032C5, 0x000000, 0x01C402 },
+    { 0x032C6, 0x000000, 0x01C442 },
+    { 0x032C7, 0x000000, 0x01C482 },
+    { 0x032C8, 0x000000, 0x01C4C2 },
+    { 0x032C9, 0x000000, 0x01C503 },
+    { 0x032CA, 0x000000, 0x01C563 },
+    { 0x032CB, 0x000000, 0x01C5C3 },
+    { 0x032CC, 0x000000, 0x01C622 },
+    { 0x032CD, 0x000000, 0x01C663 },
+    { 0x032CE, 0x000000, 0x01C6C2 },
+    { 0x032CF, 0x000000, 0x01C703 },
+    { 0x032D0, 0x000000, 0x01C761 },
+    { 0x032D1, 0x000000, 0x01C781 },
+    { 0x032D2, 0x000000, 0x01C7A1 },
+    { 0x032D3, 0x000000, 0x01C7C1 },
+    { 0x032D4, 0x000000, 0x01C7E1 },
+    { 0x032D5, 0x000000, 0x01C801 },
+    { 0x032D6, 0x000000, 0x01C821 },
+    { 0x032D7, 0x000000, 0x01C841 },
+    { 0x032D8, 0x000000, 0x01C861 },
+    { 0x032D9, 0x000000, 0x01C881 },
+    { 0x032DA, 0x000000, 0x01C8A1 },
+    { 0x032DB, 0x000000, 0x01C8C1 },
+    { 0x032DC, 0x000000, 0x01C8E1 },
+    { 0x032DD, 0x000000, 0x01C901 },
+    { 0x032DE, 0x000000, 0x01C921 },
+    { 0x032DF, 0x000000, 0x01C941 },
+    { 0x032E0, 0x000000, 0x01C961 },
+    { 0x032E1, 0x000000, 0x01C981 },
+    { 0x032E2, 0x000000, 0x01C9A1 },
+    { 0x032E3, 0x000000, 0x01C9C1 },
+    { 0x032E4, 0x000000, 0x01C9E1 },
+    { 0x032E5, 0x000000, 0x01CA01 },
+    { 0x032E6, 0x000000, 0x01CA21 },
+    { 0x032E7, 0x000000, 0x01CA41 },
+    { 0x032E8, 0x000000, 0x01CA61 },
+    { 0x032E9, 0x000000, 0x01CA81 },
+    { 0x032EA, 0x000000, 0x01CAA1 },
+    { 0x032EB, 0x000000, 0x01CAC1 },
+    { 0x032EC, 0x000000, 0x01CAE1 },
+    { 0x032ED, 0x000000, 0x01CB01 },
+    { 0x032EE, 0x000000, 0x01CB21 },
+    { 0x032EF, 0x000000, 0x01CB41 },
+    { 0x032F0, 0x000000, 0x01CB61 },
+    { 0x032F1, 0x000000, 0x01CB81 },
+    { 0x032F2, 0x000000, 0x01CBA1 },
+    { 0x032F3, 0x000000, 0x01CBC1 },
+    { 0x032F4, 0x000000, 0x01CBE1 },
+    { 0x032F5, 0x000000, 0x01CC01 },
+    { 0x032F6, 0x000000, 0x01CC21 },
+    { 0x032F7, 0x000000, 0x01CC41 },
+    { 0x032F8, 0x000000, 0x01CC61 },
+    { 0x032F9, 0x000000, 0x01CC81 },
+    { 0x032FA, 0x000000, 0x01CCA1 },
+    { 0x032FB, 0x000000, 0x01CCC1 },
+    { 0x032FC, 0x000000, 0x01CCE1 },
+    { 0x032FD, 0x000000, 0x01CD01 },
+    { 0x032FE, 0x000000, 0x01CD21 },
+    { 0x032FF, 0x000000, 0x01CD42 },
+    { 0x03300, 0x000000, 0x01CD85 },
+    { 0x03301, 0x000000, 0x01CE24 },
+    { 0x03302, 0x000000, 0x01CEA5 },
+    { 0x03303, 0x000000, 0x01CF43 },
+    { 0x03304, 0x000000, 0x01CFA5 },
+    { 0x03305, 0x000000, 0x01D043 },
+    { 0x03306, 0x000000, 0x01D0A3 },
+    { 0x03307, 0x000000, 0x01D106 },
+    { 0x03308, 0x000000, 0x01D1C4 },
+    { 0x03309, 0x000000, 0x01D243 },
+    { 0x0330A, 0x000000, 0x01D2A3 },
+    { 0x0330B, 0x000000, 0x01D303 },
+    { 0x0330C, 0x000000, 0x01D364 },
+    { 0x0330D, 0x000000, 0x01D3E4 },
+    { 0x0330E, 0x000000, 0x01D464 },
+    { 0x0330F, 0x000000, 0x01D4E4 },
+    { 0x03310, 0x000000, 0x01D564 },
+    { 0x03311, 0x000000, 0x01D5E4 },
+    { 0x03312, 0x000000, 0x01D664 },
+    { 0x03313, 0x000000, 0x01D6E6 },
+    { 0x03314, 0x000000, 0x01D7A2 },
+    { 0x03315, 0x000000, 0x01D7E6 },
+    { 0x03316, 0x000000, 0x01D8A6 },
+    { 0x03317, 0x000000, 0x01D965 },
+    { 0x03318, 0x000000, 0x01DA04 },
+    { 0x03319, 0x000000, 0x01DA86 },
+    { 0x0331A, 0x000000, 0x01DB46 },
+    { 0x0331B, 0x000000, 0x01DC04 },
+    { 0x0331C, 0x000000, 0x01DC83 },
+    { 0x0331D, 0x000000, 0x01DCE3 },
+    { 0x0331E, 0x000000, 0x01DD44 },
+    { 0x0331F, 0x000000, 0x01DDC4 },
+    { 0x03320, 0x000000, 0x01DE45 },
+    { 0x03321, 0x000000, 0x01DEE5 },
+    { 0x03322, 0x000000, 0x01DF83 },
+    { 0x03323, 0x000000, 0x01DFE3 },
+    { 0x03324, 0x000000, 0x01E044 },
+    { 0x03325, 0x000000, 0x01E0C3 },
+    { 0x03326, 0x000000, 0x01E123 },
+    { 0x03327, 0x000000, 0x01E182 },
+    { 0x03328, 0x000000, 0x01E1C2 },
+    { 0x03329, 0x000000, 0x01E203 },
+    { 0x0332A, 0x000000, 0x01E263 },
+    { 0x0332B, 0x000000, 0x01E2C6 },
+    { 0x0332C, 0x000000, 0x01E384 },
+    { 0x0332D, 0x000000, 0x01E405 },
+    { 0x0332E, 0x000000, 0x01E4A6 },
+    { 0x0332F, 0x000000, 0x01E564 },
+    { 0x03330, 0x000000, 0x01E5E3 },
+    { 0x03331, 0x000000, 0x01E643 },
+    { 0x03332, 0x000000, 0x01E6A6 },
+    { 0x03333, 0x000000, 0x01E764 },
+    { 0x03334, 0x000000, 0x01E7E6 },
+    { 0x03335, 0x000000, 0x01E8A3 },
+    { 0x03336, 0x000000, 0x01E905 },
+    { 0x03337, 0x000000, 0x01E9A3 },
+    { 0x03338, 0x000000, 0x01EA04 },
+    { 0x03339, 0x000000, 0x01EA83 },
+    { 0x0333A, 0x000000, 0x01EAE4 },
+    { 0x0333B, 0x000000, 0x01EB65 },
+    { 0x0333C, 0x000000, 0x01EC04 },
+    { 0x0333D, 0x000000, 0x01EC85 },
+    { 0x0333E, 0x000000, 0x01ED24 },
+    { 0x0333F, 0x000000, 0x01EDA2 },
+    { 0x03340, 0x000000, 0x01EDE5 },
+    { 0x03341, 0x000000, 0x01EE83 },
+    { 0x03342, 0x000000, 0x01EEE3 },
+    { 0x03343, 0x000000, 0x01EF44 },
+    { 0x03344, 0x000000, 0x01EFC3 },
+    { 0x03345, 0x000000, 0x01F023 },
+    { 0x03346, 0x000000, 0x01F083 },
+    { 0x03347, 0x000000, 0x01F0E5 },
+    { 0x03348, 0x000000, 0x01F184 },
+    { 0x03349, 0x000000, 0x01F202 },
+    { 0x0334A, 0x000000, 0x01F246 },
+    { 0x0334B, 0x000000, 0x01F303 },
+    { 0x0334C, 0x000000, 0x01F365 },
+    { 0x0334D, 0x000000, 0x01F404 },
+    { 0x0334E, 0x000000, 0x01F484 },
+    { 0x0334F, 0x000000, 0x01F503 },
+    { 0x03350, 0x000000, 0x01F563 },
+    { 0x03351, 0x000000, 0x01F5C4 },
+    { 0x03352, 0x000000, 0x01F642 },
+    { 0x03353, 0x000000, 0x01F684 },
+    { 0x03354, 0x000000, 0x01F705 },
+    { 0x03355, 0x000000, 0x01F7A2 },
+    { 0x03356, 0x000000, 0x01F7E6 },
+    { 0x03357, 0x000000, 0x01F8A3 },
+    { 0x03358, 0x000000, 0x01F902 },
+    { 0x03359, 0x000000, 0x01F942 },
+    { 0x0335A, 0x000000, 0x01F982 },
+    { 0x0335B, 0x000000, 0x01F9C2 },
+    { 0x0335C, 0x000000, 0x01FA02 },
+    { 0x0335D, 0x000000, 0x01FA42 },
+    { 0x0335E, 0x000000, 0x01FA82 },
+    { 0x0335F, 0x000000, 0x01FAC2 },
+    { 0x03360, 0x000000, 0x01FB02 },
+    { 0x03361, 0x000000, 0x01FB42 },
+    { 0x03362, 0x000000, 0x01FB83 },
+    { 0x03363, 0x000000, 0x01FBE3 },
+    { 0x03364, 0x000000, 0x01FC43 },
+    { 0x03365, 0x000000, 0x01FCA3 },
+    { 0x03366, 0x000000, 0x01FD03 },
+    { 0x03367, 0x000000, 0x01FD63 },
+    { 0x03368, 0x000000, 0x01FDC3 },
+    { 0x03369, 0x000000, 0x01FE23 },
+    { 0x0336A, 0x000000, 0x01FE83 },
+    { 0x0336B, 0x000000, 0x01FEE3 },
+    { 0x0336C, 0x000000, 0x01FF43 },
+    { 0x0336D, 0x000000, 0x01FFA3 },
+    { 0x0336E, 0x000000, 0x020003 },
+    { 0x0336F, 0x000000, 0x020063 },
+    { 0x03370, 0x000000, 0x0200C3 },
+    { 0x03371, 0x000000, 0x020123 },
+    { 0x03372, 0x000000, 0x020182 },
+    { 0x03373, 0x000000, 0x0201C2 },
+    { 0x03374, 0x000000, 0x020203 },
+    { 0x03375, 0x000000, 0x020262 },
+    { 0x03376, 0x000000, 0x0202A2 },
+    { 0x03377, 0x000000, 0x0202E2 },
+    { 0x03378, 0x000000, 0x020323 },
+    { 0x03379, 0x000000, 0x020383 },
+    { 0x0337A, 0x000000, 0x0203E2 },
+    { 0x0337B, 0x000000, 0x020422 },
+    { 0x0337C, 0x000000, 0x020462 },
+    { 0x0337D, 0x000000, 0x0204A2 },
+    { 0x0337E, 0x000000, 0x0204E2 },
+    { 0x0337F, 0x000000, 0x020524 },
+    { 0x03380, 0x000000, 0x0205A2 },
+    { 0x03381, 0x000000, 0x0205E2 },
+    { 0x03382, 0x000000, 0x020622 },
+    { 0x03383, 0x000000, 0x020662 },
+    { 0x03384, 0x000000, 0x0206A2 },
+    { 0x03385, 0x000000, 0x0206E2 },
+    { 0x03386, 0x000000, 0x020722 },
+    { 0x03387, 0x000000, 0x020762 },
+    { 0x03388, 0x000000, 0x0207A3 },
+    { 0x03389, 0x000000, 0x020804 },
+    { 0x0338A, 0x000000, 0x020882 },
+    { 0x0338B, 0x000000, 0x0208C2 },
+    { 0x0338C, 0x000000, 0x020902 },
+    { 0x0338D, 0x000000, 0x020942 },
+    { 0x0338E, 0x000000, 0x020982 },
+    { 0x0338F, 0x000000, 0x0209C2 },
+    { 0x03390, 0x000000, 0x020A02 },
+    { 0x03391, 0x000000, 0x020A43 },
+    { 0x03392, 0x000000, 0x020AA3 },
+    { 0x03393, 0x000000, 0x020B03 },
+    { 0x03394, 0x000000, 0x020B63 },
+    { 0x03395, 0x000000, 0x020BC2 },
+    { 0x03396, 0x000000, 0x020C02 },
+    { 0x03397, 0x000000, 0x020C42 },
+    { 0x03398, 0x000000, 0x020C82 },
+    { 0x03399, 0x000000, 0x020CC2 },
+    { 0x0339A, 0x000000, 0x020D02 },
+    { 0x0339B, 0x000000, 0x020D42 },
+    { 0x0339C, 0x000000, 0x020D82 },
+    { 0x0339D, 0x000000, 0x020DC2 },
+    { 0x0339E, 0x000000, 0x020E02 },
+    { 0x0339F, 0x000000, 0x020E43 },
+    { 0x033A0, 0x000000, 0x020EA3 },
+    { 0x033A1, 0x000000, 0x020F02 },
+    { 0x033A2, 0x000000, 0x020F43 },
+    { 0x033A3, 0x000000, 0x020FA3 },
+    { 0x033A4, 0x000000, 0x021003 },
+    { 0x033A5, 0x000000, 0x021062 },
+    { 0x033A6, 0x000000, 0x0210A3 },
+    { 0x033A7, 0x000000, 0x021103 },
+    { 0x033A8, 0x000000, 0x021164 },
+    { 0x033A9, 0x000000, 0x0211E2 },
+    { 0x033AA, 0x000000, 0x021223 },
+    { 0x033AB, 0x000000, 0x021283 },
+    { 0x033AC, 0x000000, 0x0212E3 },
+    { 0x033AD, 0x000000, 0x021343 },
+    { 0x033AE, 0x000000, 0x0213A5 },
+    { 0x033AF, 0x000000, 0x021446 },
+    { 0x033B0, 0x000000, 0x021502 },
+    { 0x033B1, 0x000000, 0x021542 },
+    { 0x033B2, 0x000000, 0x021582 },
+    { 0x033B3, 0x000000, 0x0215C2 },
+    { 0x033B4, 0x000000, 0x021602 },
+    { 0x033B5, 0x000000, 0x021642 },
+    { 0x033B6, 0x000000, 0x021682 },
+    { 0x033B7, 0x000000, 0x0216C2 },
+    { 0x033B8, 0x000000, 0x021702 },
+    { 0x033B9, 0x000000, 0x021742 },
+    { 0x033BA, 0x000000, 0x021782 },
+    { 0x033BB, 0x000000, 0x0217C2 },
+    { 0x033BC, 0x000000, 0x021802 },
+    { 0x033BD, 0x000000, 0x021842 },
+    { 0x033BE, 0x000000, 0x021882 },
+    { 0x033BF, 0x000000, 0x0218C2 },
+    { 0x033C0, 0x000000, 0x021902 },
+    { 0x033C1, 0x000000, 0x021942 },
+    { 0x033C2, 0x000000, 0x021984 },
+    { 0x033C3, 0x000000, 0x021A02 },
+    { 0x033C4, 0x000000, 0x021A42 },
+    { 0x033C5, 0x000000, 0x021A82 },
+    { 0x033C6, 0x000000, 0x021AC4 },
+    { 0x033C7, 0x000000, 0x021B43 },
+    { 0x033C8, 0x000000, 0x021BA2 },
+    { 0x033C9, 0x000000, 0x021BE2 },
+    { 0x033CA, 0x000000, 0x021C22 },
+    { 0x033CB, 0x000000, 0x021C62 },
+    { 0x033CC, 0x000000, 0x021CA2 },
+    { 0x033CD, 0x000000, 0x021CE2 },
+    { 0x033CE, 0x000000, 0x021D22 },
+    { 0x033CF, 0x000000, 0x021D62 },
+    { 0x033D0, 0x000000, 0x021DA2 },
+    { 0x033D1, 0x000000, 0x021DE2 },
+    { 0x033D2, 0x000000, 0x021E23 },
+    { 0x033D3, 0x000000, 0x021E82 },
+    { 0x033D4, 0x000000, 0x021EC2 },
+    { 0x033D5, 0x000000, 0x021F03 },
+    { 0x033D6, 0x000000, 0x021F63 },
+    { 0x033D7, 0x000000, 0x021FC2 },
+    { 0x033D8, 0x000000, 0x022004 },
+    { 0x033D9, 0x000000, 0x022083 },
+    { 0x033DA, 0x000000, 0x0220E2 },
+    { 0x033DB, 0x000000, 0x022122 },
+    { 0x033DC, 0x000000, 0x022162 },
+    { 0x033DD, 0x000000, 0x0221A2 },
+    { 0x033DE, 0x000000, 0x0221E3 },
+    { 0x033DF, 0x000000, 0x022243 },
+    { 0x033E0, 0x000000, 0x0222A2 },
+    { 0x033E1, 0x000000, 0x0222E2 },
+    { 0x033E2, 0x000000, 0x022322 },
+    { 0x033E3, 0x000000, 0x022362 },
+    { 0x033E4, 0x000000, 0x0223A2 },
+    { 0x033E5, 0x000000, 0x0223E2 },
+    { 0x033E6, 0x000000, 0x022422 },
+    { 0x033E7, 0x000000, 0x022462 },
+    { 0x033E8, 0x000000, 0x0224A2 },
+    { 0x033E9, 0x000000, 0x0224E3 },
+    { 0x033EA, 0x000000, 0x022543 },
+    { 0x033EB, 0x000000, 0x0225A3 },
+    { 0x033EC, 0x000000, 0x022603 },
+    { 0x033ED, 0x000000, 0x022663 },
+    { 0x033EE, 0x000000, 0x0226C3 },
+    { 0x033EF, 0x000000, 0x022723 },
+    { 0x033F0, 0x000000, 0x022783 },
+    { 0x033F1, 0x000000, 0x0227E3 },
+    { 0x033F2, 0x000000, 0x022843 },
+    { 0x033F3, 0x000000, 0x0228A3 },
+    { 0x033F4, 0x000000, 0x022903 },
+    { 0x033F5, 0x000000, 0x022963 },
+    { 0x033F6, 0x000000, 0x0229C3 },
+    { 0x033F7, 0x000000, 0x022A23 },
+    { 0x033F8, 0x000000, 0x022A83 },
+    { 0x033F9, 0x000000, 0x022AE3 },
+    { 0x033FA, 0x000000, 0x022B43 },
+    { 0x033FB, 0x000000, 0x022BA3 },
+    { 0x033FC, 0x000000, 0x022C03 },
+    { 0x033FD, 0x000000, 0x022C63 },
+    { 0x033FE, 0x000000, 0x022CC3 },
+    { 0x033FF, 0x000000, 0x022D23 },
+    { 0x0A69C, 0x000000, 0x022D81 },
+    { 0x0A69D, 0x000000, 0x022DA1 },
+    { 0x0A770, 0x000000, 0x022DC1 },
+    { 0x0A7F2, 0x000000, 0x012281 },
+    { 0x0A7F3, 0x000000, 0x0125A1 },
+    { 0x0A7F4, 0x000000, 0x012461 },
+    { 0x0A7F8, 0x000000, 0x022DE1 },
+    { 0x0A7F9, 0x000000, 0x022E01 },
+    { 0x0AB5C, 0x000000, 0x022E21 },
+    { 0x0AB5D, 0x000000, 0x022E41 },
+    { 0x0AB5E, 0x000000, 0x022E61 },
+    { 0x0AB5F, 0x000000, 0x022E81 },
+    { 0x0AB69, 0x000000, 0x022EA1 },
+    { 0x0F900, 0x022EC1, 0x022EC1 },
+    { 0x0F901, 0x022EE1, 0x022EE1 },
+    { 0x0F902, 0x0171E1, 0x0171E1 },
+    { 0x0F903, 0x022F01, 0x022F01 },
+    { 0x0F904, 0x022F21, 0x022F21 },
+    { 0x0F905, 0x022F41, 0x022F41 },
+    { 0x0F906, 0x022F61, 0x022F61 },
+    { 0x0F907, 0x0178A1, 0x0178A1 },
+    { 0x0F908, 0x0178A1, 0x0178A1 },
+    { 0x0F909, 0x022F81, 0x022F81 },
+    { 0x0F90A, 0x0172E1, 0x0172E1 },
+    { 0x0F90B, 0x022FA1, 0x022FA1 },
+    { 0x0F90C, 0x022FC1, 0x022FC1 },
+    { 0x0F90D, 0x022FE1, 0x022FE1 },
+    { 0x0F90E, 0x023001, 0x023001 },
+    { 0x0F90F, 0x023021, 0x023021 },
+    { 0x0F910, 0x023041, 0x023041 },
+    { 0x0F911, 0x023061, 0x023061 },
+    { 0x0F912, 0x023081, 0x023081 },
+    { 0x0F913, 0x0230A1, 0x0230A1 },
+    { 0x0F914, 0x0230C1, 0x0230C1 },
+    { 0x0F915, 0x0230E1, 0x0230E1 },
+    { 0x0F916, 0x023101, 0x023101 },
+    { 0x0F917, 0x023121, 0x023121 },
+    { 0x0F918, 0x023141, 0x023141 },
+    { 0x0F919, 0x023161, 0x023161 },
+    { 0x0F91A, 0x023181, 0x023181 },
+    { 0x0F91B, 0x0231A1, 0x0231A1 },
+    { 0x0F91C, 0x0231C1, 0x0231C1 },
+    { 0x0F91D, 0x0231E1, 0x0231E1 },
+    { 0x0F91E, 0x023201, 0x023201 },
+    { 0x0F91F, 0x023221, 0x023221 },
+    { 0x0F920, 0x023241, 0x023241 },
+    { 0x0F921, 0x023261, 0x023261 },
+    { 0x0F922, 0x023281, 0x023281 },
+    { 0x0F923, 0x0232A1, 0x0232A1 },
+    { 0x0F924, 0x0232C1, 0x0232C1 },
+    { 0x0F925, 0x0232E1, 0x0232E1 },
+    { 0x0F926, 0x023301, 0x023301 },
+    { 0x0F927, 0x023321, 0x023321 },
+    { 0x0F928, 0x023341, 0x023341 },
+    { 0x0F929, 0x023361, 0x023361 },
+    { 0x0F92A, 0x023381, 0x023381 },
+    { 0x0F92B, 0x0233A1, 0x0233A1 },
+    { 0x0F92C, 0x0233C1, 0x0233C1 },
+    { 0x0F92D, 0x0233E1, 0x0233E1 },
+    { 0x0F92E, 0x023401, 0x023401 },
+    { 0x0F92F, 0x023421, 0x023421 },
+    { 0x0F930, 0x023441, 0x023441 },
+    { 0x0F931, 0x023461, 0x023461 },
+    { 0x0F932, 0x023481, 0x023481 },
+    { 0x0F933, 0x0234A1, 0x0234A1 },
+    { 0x0F934, 0x016DA1, 0x016DA1 },
+    { 0x0F935, 0x0234C1, 0x0234C1 },
+    { 0x0F936, 0x0234E1, 0x0234E1 },
+    { 0x0F937, 0x023501, 0x023501 },
+    { 0x0F938, 0x023521, 0x023521 },
+    { 0x0F939, 0x023541, 0x023541 },
+    { 0x0F93A, 0x023561, 0x023561 },
+    { 0x0F93B, 0x023581, 0x023581 },
+    { 0x0F93C, 0x0235A1, 0x0235A1 },
+    { 0x0F93D, 0x0235C1, 0x0235C1 },
+    { 0x0F93E, 0x0235E1, 0x0235E1 },
+    { 0x0F93F, 0x023601, 0x023601 },
+    { 0x0F940, 0x0176C1, 0x0176C1 },
+    { 0x0F941, 0x023621, 0x023621 },
+    { 0x0F942, 0x023641, 0x023641 },
+    { 0x0F943, 0x023661, 0x023661 },
+    { 0x0F944, 0x023681, 0x023681 },
+    { 0x0F945, 0x0236A1, 0x0236A1 },
+    { 0x0F946, 0x0236C1, 0x0236C1 },
+    { 0x0F947, 0x0236E1, 0x0236E1 },
+    { 0x0F948, 0x023701, 0x023701 },
+    { 0x0F949, 0x023721, 0x023721 },
+    { 0x0F94A, 0x023741, 0x023741 },
+    { 0x0F94B, 0x023761, 0x023761 },
+    { 0x0F94C, 0x023781, 0x023781 },
+    { 0x0F94D, 0x0237A1, 0x0237A1 },
+    { 0x0F94E, 0x0237C1, 0x0237C1 },
+    { 0x0F94F, 0x0237E1, 0x0237E1 },
+    { 0x0F950, 0x023801, 0x023801 },
+    { 0x0F951, 0x023821, 0x023821 },
+    { 0x0F952, 0x023841, 0x023841 },
+    { 0x0F953, 0x023861, 0x023861 },
+    { 0x0F954, 0x023881, 0x023881 },
+    { 0x0F955, 0x0238A1, 0x0238A1 },
+    { 0x0F956, 0x0238C1, 0x0238C1 },
+    { 0x0F957, 0x0238E1, 0x0238E1 },
+    { 0x0F958, 0x023901, 0x023901 },
+    { 0x0F959, 0x023921, 0x023921 },
+    { 0x0F95A, 0x023941, 0x023941 },
+    { 0x0F95B, 0x023961, 0x023961 },
+    { 0x0F95C, 0x0230C1, 0x0230C1 },
+    { 0x0F95D, 0x023981, 0x023981 },
+    { 0x0F95E, 0x0239A1, 0x0239A1 },
+    { 0x0F95F, 0x0239C1, 0x0239C1 },
+    { 0x0F960, 0x0239E1, 0x0239E1 },
+    { 0x0F961, 0x023A01, 0x023A01 },
+    { 0x0F962, 0x023A21, 0x023A21 },
+    { 0x0F963, 0x023A41, 0x023A41 },
+    { 0x0F964, 0x023A61, 0x023A61 },
+    { 0x0F965, 0x023A81, 0x023A81 },
+    { 0x0F966, 0x023AA1, 0x023AA1 },
+    { 0x0F967, 0x023AC1, 0x023AC1 },
+    { 0x0F968, 0x023AE1, 0x023AE1 },
+    { 0x0F969, 0x023B01, 0x023B01 },
+    { 0x0F96A, 0x023B21, 0x023B21 },
+    { 0x0F96B, 0x023B41, 0x023B41 },
+    { 0x0F96C, 0x023B61, 0x023B61 },
+    { 0x0F96D, 0x023B81, 0x023B81 },
+    { 0x0F96E, 0x023BA1, 0x023BA1 },
+    { 0x0F96F, 0x023BC1, 0x023BC1 },
+    { 0x0F970, 0x023BE1, 0x023BE1 },
+    { 0x0F971, 0x017221, 0x017221 },
+    { 0x0F972, 0x023C01, 0x023C01 },
+    { 0x0F973, 0x023C21, 0x023C21 },
+    { 0x0F974, 0x023C41, 0x023C41 },
+    { 0x0F975, 0x023C61, 0x023C61 },
+    { 0x0F976, 0x023C81, 0x023C81 },
+    { 0x0F977, 0x023CA1, 0x023CA1 },
+    { 0x0F978, 0x023CC1, 0x023CC1 },
+    { 0x0F979, 0x023CE1, 0x023CE1 },
+    { 0x0F97A, 0x023D01, 0x023D01 },
+    { 0x0F97B, 0x023D21, 0x023D21 },
+    { 0x0F97C, 0x023D41, 0x023D41 },
+    { 0x0F97D, 0x023D61, 0x023D61 },
+    { 0x0F97E, 0x023D81, 0x023D81 },
+    { 0x0F97F, 0x023DA1, 0x023DA1 },
+    { 0x0F980, 0x023DC1, 0x023DC1 },
+    { 0x0F981, 0x0162C1, 0x0162C1 },
+    { 0x0F982, 0x023DE1, 0x023DE1 },
+    { 0x0F983, 0x023E01, 0x023E01 },
+    { 0x0F984, 0x023E21, 0x023E21 },
+    { 0x0F985, 0x023E41, 0x023E41 },
+    { 0x0F986, 0x023E61, 0x023E61 },
+    { 0x0F987, 0x023E81, 0x023E81 },
+    { 0x0F988, 0x023EA1, 0x023EA1 },
+    { 0x0F989, 0x023EC1, 0x023EC1 },
+    { 0x0F98A, 0x016061, 0x016061 },
+    { 0x0F98B, 0x023EE1, 0x023EE1 },
+    { 0x0F98C, 0x023F01, 0x023F01 },
+    { 0x0F98D, 0x023F21, 0x023F21 },
+    { 0x0F98E, 0x023F41, 0x023F41 },
+    { 0x0F98F, 0x023F61, 0x023F61 },
+    { 0x0F990, 0x023F81, 0x023F81 },
+    { 0x0F991, 0x023FA1, 0x023FA1 },
+    { 0x0F992, 0x023FC1, 0x023FC1 },
+    { 0x0F993, 0x023FE1, 0x023FE1 },
+    { 0x0F994, 0x024001, 0x024001 },
+    { 0x0F995, 0x024021, 0x024021 },
+    { 0x0F996, 0x024041, 0x024041 },
+    { 0x0F997, 0x024061, 0x024061 },
+    { 0x0F998, 0x024081, 0x024081 },
+    { 0x0F999, 0x0240A1, 0x0240A1 },
+    { 0x0F99A, 0x0240C1, 0x0240C1 },
+    { 0x0F99B, 0x0240E1, 0x0240E1 },
+    { 0x0F99C, 0x024101, 0x024101 },
+    { 0x0F99D, 0x024121, 0x024121 },
+    { 0x0F99E, 0x024141, 0x024141 },
+    { 0x0F99F, 0x024161, 0x024161 },
+    { 0x0F9A0, 0x024181, 0x024181 },
+    { 0x0F9A1, 0x023BC1, 0x023BC1 },
+    { 0x0F9A2, 0x0241A1, 0x0241A1 },
+    { 0x0F9A3, 0x0241C1, 0x0241C1 },
+    { 0x0F9A4, 0x0241E1, 0x0241E1 },
+    { 0x0F9A5, 0x024201, 0x024201 },
+    { 0x0F9A6, 0x024221, 0x024221 },
+    { 0x0F9A7, 0x024241, 0x024241 },
+    { 0x0F9A8, 0x024261, 0x024261 },
+    { 0x0F9A9, 0x024281, 0x024281 },
+    { 0x0F9AA, 0x0239C1, 0x0239C1 },
+    { 0x0F9AB, 0x0242A1, 0x0242A1 },
+    { 0x0F9AC, 0x0242C1, 0x0242C1 },
+    { 0x0F9AD, 0x0242E1, 0x0242E1 },
+    { 0x0F9AE, 0x024301, 0x024301 },
+    { 0x0F9AF, 0x024321, 0x024321 },
+    { 0x0F9B0, 0x024341, 0x024341 },
+    { 0x0F9B1, 0x024361, 0x024361 },
+    { 0x0F9B2, 0x024381, 0x024381 },
+    { 0x0F9B3, 0x0243A1, 0x0243A1 },
+    { 0x0F9B4, 0x0243C1, 0x0243C1 },
+    { 0x0F9B5, 0x0243E1, 0x0243E1 },
+    { 0x0F9B6, 0x024401, 0x024401 },
+    { 0x0F9B7, 0x024421, 0x024421 },
+    { 0x0F9B8, 0x024441, 0x024441 },
+    { 0x0F9B9, 0x024461, 0x024461 },
+    { 0x0F9BA, 0x024481, 0x024481 },
+    { 0x0F9BB, 0x0244A1, 0x0244A1 },
+    { 0x0F9BC, 0x0244C1, 0x0244C1 },
+    { 0x0F9BD, 0x0244E1, 0x0244E1 },
+    { 0x0F9BE, 0x024501, 0x024501 },
+    { 0x0F9BF, 0x0230C1, 0x0230C1 },
+    { 0x0F9C0, 0x024521, 0x024521 },
+    { 0x0F9C1, 0x024541, 0x024541 },
+    { 0x0F9C2, 0x024561, 0x024561 },
+    { 0x0F9C3, 0x024581, 0x024581 },
+    { 0x0F9C4, 0x017881, 0x017881 },
+    { 0x0F9C5, 0x0245A1, 0x0245A1 },
+    { 0x0F9C6, 0x0245C1, 0x0245C1 },
+    { 0x0F9C7, 0x0245E1, 0x0245E1 },
+    { 0x0F9C8, 0x024601, 0x024601 },
+    { 0x0F9C9, 0x024621, 0x024621 },
+    { 0x0F9CA, 0x024641, 0x024641 },
+    { 0x0F9CB, 0x024661, 0x024661 },
+    { 0x0F9CC, 0x024681, 0x024681 },
+    { 0x0F9CD, 0x0246A1, 0x0246A1 },
+    { 0x0F9CE, 0x0246C1, 0x0246C1 },
+    { 0x0F9CF, 0x0246E1, 0x0246E1 },
+    { 0x0F9D0, 0x024701, 0x024701 },
+    { 0x0F9D1, 0x01BB21, 0x01BB21 },
+    { 0x0F9D2, 0x024721, 0x024721 },
+    { 0x0F9D3, 0x024741, 0x024741 },
+    { 0x0F9D4, 0x024761, 0x024761 },
+    { 0x0F9D5, 0x024781, 0x024781 },
+    { 0x0F9D6, 0x0247A1, 0x0247A1 },
+    { 0x0F9D7, 0x0247C1, 0x0247C1 },
+    { 0x0F9D8, 0x0247E1, 0x0247E1 },
+    { 0x0F9D9, 0x024801, 0x024801 },
+    { 0x0F9DA, 0x024821, 0x024821 },
+    { 0x0F9DB, 0x023A01, 0x023A01 },
+    { 0x0F9DC, 0x024841, 0x024841 },
+    { 0x0F9DD, 0x024861, 0x024861 },
+    { 0x0F9DE, 0x024881, 0x024881 },
+    { 0x0F9DF, 0x0248A1, 0x0248A1 },
+    { 0x0F9E0, 0x0248C1, 0x0248C1 },
+    { 0x0F9E1, 0x0248E1, 0x0248E1 },
+    { 0x0F9E2, 0x024901, 0x024901 },
+    { 0x0F9E3, 0x024921, 0x024921 },
+    { 0x0F9E4, 0x024941, 0x024941 },
+    { 0x0F9E5, 0x024961, 0x024961 },
+    { 0x0F9E6, 0x024981, 0x024981 },
+    { 0x0F9E7, 0x0249A1, 0x0249A1 },
+    { 0x0F9E8, 0x0249C1, 0x0249C1 },
+    { 0x0F9E9, 0x0172C1, 0x0172C1 },
+    { 0x0F9EA, 0x0249E1, 0x0249E1 },
+    { 0x0F9EB, 0x024A01, 0x024A01 },
+    { 0x0F9EC, 0x024A21, 0x024A21 },
+    { 0x0F9ED, 0x024A41, 0x024A41 },
+    { 0x0F9EE, 0x024A61, 0x024A61 },
+    { 0x0F9EF, 0x024A81, 0x024A81 },
+    { 0x0F9F0, 0x024AA1, 0x024AA1 },
+    { 0x0F9F1, 0x024AC1, 0x024AC1 },
+    { 0x0F9F2, 0x024AE1, 0x024AE1 },
+    { 0x0F9F3, 0x024B01, 0x024B01 },
+    { 0x0F9F4, 0x024B21, 0x024B21 },
+    { 0x0F9F5, 0x024B41, 0x024B41 },
+    { 0x0F9F6, 0x024B61, 0x024B61 },
+    { 0x0F9F7, 0x016CA1, 0x016CA1 },
+    { 0x0F9F8, 0x024B81, 0x024B81 },
+    { 0x0F9F9, 0x024BA1, 0x024BA1 },
+    { 0x0F9FA, 0x024BC1, 0x024BC1 },
+    { 0x0F9FB, 0x024BE1, 0x024BE1 },
+    { 0x0F9FC, 0x024C01, 0x024C01 },
+    { 0x0F9FD, 0x024C21, 0x024C21 },
+    { 0x0F9FE, 0x024C41, 0x024C41 },
+    { 0x0F9FF, 0x024C61, 0x024C61 },
+    { 0x0FA00, 0x024C81, 0x024C81 },
+    { 0x0FA01, 0x024CA1, 0x024CA1 },
+    { 0x0FA02, 0x024CC1, 0x024CC1 },
+    { 0x0FA03, 0x024CE1, 0x024CE1 },
+    { 0x0FA04, 0x024D01, 0x024D01 },
+    { 0x0FA05, 0x024D21, 0x024D21 },
+    { 0x0FA06, 0x024D41, 0x024D41 },
+    { 0x0FA07, 0x024D61, 0x024D61 },
+    { 0x0FA08, 0x017001, 0x017001 },
+    { 0x0FA09, 0x024D81, 0x024D81 },
+    { 0x0FA0A, 0x017061, 0x017061 },
+    { 0x0FA0B, 0x024DA1, 0x024DA1 },
+    { 0x0FA0C, 0x024DC1, 0x024DC1 },
+    { 0x0FA0D, 0x024DE1, 0x024DE1 },
+    { 0x0FA10, 0x024E01, 0x024E01 },
+    { 0x0FA12, 0x024E21, 0x024E21 },
+    { 0x0FA15, 0x024E41, 0x024E41 },
+    { 0x0FA16, 0x024E61, 0x024E61 },
+    { 0x0FA17, 0x024E81, 0x024E81 },
+    { 0x0FA18, 0x024EA1, 0x024EA1 },
+    { 0x0FA19, 0x024EC1, 0x024EC1 },
+    { 0x0FA1A, 0x024EE1, 0x024EE1 },
+    { 0x0FA1B, 0x024F01, 0x024F01 },
+    { 0x0FA1C, 0x024F21, 0x024F21 },
+    { 0x0FA1D, 0x024F41, 0x024F41 },
+    { 0x0FA1E, 0x016D81, 0x016D81 },
+    { 0x0FA20, 0x024F61, 0x024F61 },
+    { 0x0FA22, 0x024F81, 0x024F81 },
+    { 0x0FA25, 0x024FA1, 0x024FA1 },
+    { 0x0FA26, 0x024FC1, 0x024FC1 },
+    { 0x0FA2A, 0x024FE1, 0x024FE1 },
+    { 0x0FA2B, 0x025001, 0x025001 },
+    { 0x0FA2C, 0x025021, 0x025021 },
+    { 0x0FA2D, 0x025041, 0x025041 },
+    { 0x0FA2E, 0x025061, 0x025061 },
+    { 0x0FA2F, 0x025081, 0x025081 },
+    { 0x0FA30, 0x0250A1, 0x0250A1 },
+    { 0x0FA31, 0x0250C1, 0x0250C1 },
+    { 0x0FA32, 0x0250E1, 0x0250E1 },
+    { 0x0FA33, 0x025101, 0x025101 },
+    { 0x0FA34, 0x025121, 0x025121 },
+    { 0x0FA35, 0x025141, 0x025141 },
+    { 0x0FA36, 0x025161, 0x025161 },
+    { 0x0FA37, 0x025181, 0x025181 },
+    { 0x0FA38, 0x0251A1, 0x0251A1 },
+    { 0x0FA39, 0x0251C1, 0x0251C1 },
+    { 0x0FA3A, 0x0251E1, 0x0251E1 },
+    { 0x0FA3B, 0x025201, 0x025201 },
+    { 0x0FA3C, 0x0163A1, 0x0163A1 },
+    { 0x0FA3D, 0x025221, 0x025221 },
+    { 0x0FA3E, 0x025241, 0x025241 },
+    { 0x0FA3F, 0x025261, 0x025261 },
+    { 0x0FA40, 0x025281, 0x025281 },
+    { 0x0FA41, 0x0252A1, 0x0252A1 },
+    { 0x0FA42, 0x0252C1, 0x0252C1 },
+    { 0x0FA43, 0x0252E1, 0x0252E1 },
+    { 0x0FA44, 0x025301, 0x025301 },
+    { 0x0FA45, 0x025321, 0x025321 },
+    { 0x0FA46, 0x025341, 0x025341 },
+    { 0x0FA47, 0x025361, 0x025361 },
+    { 0x0FA48, 0x025381, 0x025381 },
+    { 0x0FA49, 0x0253A1, 0x0253A1 },
+    { 0x0FA4A, 0x0253C1, 0x0253C1 },
+    { 0x0FA4B, 0x0253E1, 0x0253E1 },
+    { 0x0FA4C, 0x01BBC1, 0x01BBC1 },
+    { 0x0FA4D, 0x025401, 0x025401 },
+    { 0x0FA4E, 0x025421, 0x025421 },
+    { 0x0FA4F, 0x025441, 0x025441 },
+    { 0x0FA50, 0x025461, 0x025461 },
+    { 0x0FA51, 0x01BC41, 0x01BC41 },
+    { 0x0FA52, 0x025481, 0x025481 },
+    { 0x0FA53, 0x0254A1, 0x0254A1 },
+    { 0x0FA54, 0x0254C1, 0x0254C1 },
+    { 0x0FA55, 0x0254E1, 0x0254E1 },
+    { 0x0FA56, 0x025501, 0x025501 },
+    { 0x0FA57, 0x024041, 0x024041 },
+    { 0x0FA58, 0x025521, 0x025521 },
+    { 0x0FA59, 0x025541, 0x025541 },
+    { 0x0FA5A, 0x025561, 0x025561 },
+    { 0x0FA5B, 0x025581, 0x025581 },
+    { 0x0FA5C, 0x0255A1, 0x0255A1 },
+    { 0x0FA5D, 0x0255C1, 0x0255C1 },
+    { 0x0FA5E, 0x0255C1, 0x0255C1 },
+    { 0x0FA5F, 0x0255E1, 0x0255E1 },
+    { 0x0FA60, 0x025601, 0x025601 },
+    { 0x0FA61, 0x025621, 0x025621 },
+    { 0x0FA62, 0x025641, 0x025641 },
+    { 0x0FA63, 0x025661, 0x025661 },
+    { 0x0FA64, 0x025681, 0x025681 },
+    { 0x0FA65, 0x0256A1, 0x0256A1 },
+    { 0x0FA66, 0x0256C1, 0x0256C1 },
+    { 0x0FA67, 0x024FA1, 0x024FA1 },
+    { 0x0FA68, 0x0256E1, 0x0256E1 },
+    { 0x0FA69, 0x025701, 0x025701 },
+    { 0x0FA6A, 0x025721, 0x025721 },
+    { 0x0FA6B, 0x025741, 0x025741 },
+    { 0x0FA6C, 0x025761, 0x025761 },
+    { 0x0FA6D, 0x025781, 0x025781 },
+    { 0x0FA70, 0x0257A1, 0x0257A1 },
+    { 0x0FA71, 0x0257C1, 0x0257C1 },
+    { 0x0FA72, 0x0257E1, 0x0257E1 },
+    { 0x0FA73, 0x025801, 0x025801 },
+    { 0x0FA74, 0x025821, 0x025821 },
+    { 0x0FA75, 0x025841, 0x025841 },
+    { 0x0FA76, 0x025861, 0x025861 },
+    { 0x0FA77, 0x025881, 0x025881 },
+    { 0x0FA78, 0x025161, 0x025161 },
+    { 0x0FA79, 0x0258A1, 0x0258A1 },
+    { 0x0FA7A, 0x0258C1, 0x0258C1 },
+    { 0x0FA7B, 0x0258E1, 0x0258E1 },
+    { 0x0FA7C, 0x024E01, 0x024E01 },
+    { 0x0FA7D, 0x025901, 0x025901 },
+    { 0x0FA7E, 0x025921, 0x025921 },
+    { 0x0FA7F, 0x025941, 0x025941 },
+    { 0x0FA80, 0x025961, 0x025961 },
+    { 0x0FA81, 0x025981, 0x025981 },
+    { 0x0FA82, 0x0259A1, 0x0259A1 },
+    { 0x0FA83, 0x0259C1, 0x0259C1 },
+    { 0x0FA84, 0x0259E1, 0x0259E1 },
+    { 0x0FA85, 0x025A01, 0x025A01 },
+    { 0x0FA86, 0x025A21, 0x025A21 },
+    { 0x0FA87, 0x025A41, 0x025A41 },
+    { 0x0FA88, 0x025A61, 0x025A61 },
+    { 0x0FA89, 0x025261, 0x025261 },
+    { 0x0FA8A, 0x025A81, 0x025A81 },
+    { 0x0FA8B, 0x025281, 0x025281 },
+    { 0x0FA8C, 0x025AA1, 0x025AA1 },
+    { 0x0FA8D, 0x025AC1, 0x025AC1 },
+    { 0x0FA8E, 0x025AE1, 0x025AE1 },
+    { 0x0FA8F, 0x025B01, 0x025B01 },
+    { 0x0FA90, 0x025B21, 0x025B21 },
+    { 0x0FA91, 0x024E21, 0x024E21 },
+    { 0x0FA92, 0x023361, 0x023361 },
+    { 0x0FA93, 0x025B41, 0x025B41 },
+    { 0x0FA94, 0x025B61, 0x025B61 },
+    { 0x0FA95, 0x0167C1, 0x0167C1 },
+    { 0x0FA96, 0x023BE1, 0x023BE1 },
+    { 0x0FA97, 0x024641, 0x024641 },
+    { 0x0FA98, 0x025B81, 0x025B81 },
+    { 0x0FA99, 0x025BA1, 0x025BA1 },
+    { 0x0FA9A, 0x025361, 0x025361 },
+    { 0x0FA9B, 0x025BC1, 0x025BC1 },
+    { 0x0FA9C, 0x025381, 0x025381 },
+    { 0x0FA9D, 0x025BE1, 0x025BE1 },
+    { 0x0FA9E, 0x025C01, 0x025C01 },
+    { 0x0FA9F, 0x025C21, 0x025C21 },
+    { 0x0FAA0, 0x024E61, 0x024E61 },
+    { 0x0FAA1, 0x025C41, 0x025C41 },
+    { 0x0FAA2, 0x025C61, 0x025C61 },
+    { 0x0FAA3, 0x025C81, 0x025C81 },
+    { 0x0FAA4, 0x025CA1, 0x025CA1 },
+    { 0x0FAA5, 0x025CC1, 0x025CC1 },
+    { 0x0FAA6, 0x024E81, 0x024E81 },
+    { 0x0FAA7, 0x025CE1, 0x025CE1 },
+    { 0x0FAA8, 0x025D01, 0x025D01 },
+    { 0x0FAA9, 0x025D21, 0x025D21 },
+    { 0x0FAAA, 0x025D41, 0x025D41 },
+    { 0x0FAAB, 0x025D61, 0x025D61 },
+    { 0x0FAAC, 0x025D81, 0x025D81 },
+    { 0x0FAAD, 0x025501, 0x025501 },
+    { 0x0FAAE, 0x025DA1, 0x025DA1 },
+    { 0x0FAAF, 0x025DC1, 0x025DC1 },
+    { 0x0FAB0, 0x024041, 0x024041 },
+    { 0x0FAB1, 0x025DE1, 0x025DE1 },
+    { 0x0FAB2, 0x025581, 0x025581 },
+    { 0x0FAB3, 0x025E01, 0x025E01 },
+    { 0x0FAB4, 0x025E21, 0x025E21 },
+    { 0x0FAB5, 0x025E41, 0x025E41 },
+    { 0x0FAB6, 0x025E61, 0x025E61 },
+    { 0x0FAB7, 0x025E81, 0x025E81 },
+    { 0x0FAB8, 0x025621, 0x025621 },
+    { 0x0FAB9, 0x025EA1, 0x025EA1 },
+    { 0x0FABA, 0x024F81, 0x024F81 },
+    { 0x0FABB, 0x025EC1, 0x025EC1 },
+    { 0x0FABC, 0x025641, 0x025641 },
+    { 0x0FABD, 0x023981, 0x023981 },
+    { 0x0FABE, 0x025EE1, 0x025EE1 },
+    { 0x0FABF, 0x025661, 0x025661 },
+    { 0x0FAC0, 0x025F01, 0x025F01 },
+    { 0x0FAC1, 0x0256A1, 0x0256A1 },
+    { 0x0FAC2, 0x025F21, 0x025F21 },
+    { 0x0FAC3, 0x025F41, 0x025F41 },
+    { 0x0FAC4, 0x025F61, 0x025F61 },
+    { 0x0FAC5, 0x025F81, 0x025F81 },
+    { 0x0FAC6, 0x025FA1, 0x025FA1 },
+    { 0x0FAC7, 0x0256E1, 0x0256E1 },
+    { 0x0FAC8, 0x024F21, 0x024F21 },
+    { 0x0FAC9, 0x025FC1, 0x025FC1 },
+    { 0x0FACA, 0x025701, 0x025701 },
+    { 0x0FACB, 0x025FE1, 0x025FE1 },
+    { 0x0FACC, 0x025721, 0x025721 },
+    { 0x0FACD, 0x026001, 0x026001 },
+    { 0x0FACE, 0x0178A1, 0x0178A1 },
+    { 0x0FACF, 0x026021, 0x026021 },
+    { 0x0FAD0, 0x026041, 0x026041 },
+    { 0x0FAD1, 0x026061, 0x026061 },
+    { 0x0FAD2, 0x026081, 0x026081 },
+    { 0x0FAD3, 0x0260A1, 0x0260A1 },
+    { 0x0FAD4, 0x0260C1, 0x0260C1 },
+    { 0x0FAD5, 0x0260E1, 0x0260E1 },
+    { 0x0FAD6, 0x026101, 0x026101 },
+    { 0x0FAD7, 0x026121, 0x026121 },
+    { 0x0FAD8, 0x026141, 0x026141 },
+    { 0x0FAD9, 0x026161, 0x026161 },
+    { 0x0FB00, 0x000000, 0x026182 },
+    { 0x0FB01, 0x000000, 0x0261C2 },
+    { 0x0FB02, 0x000000, 0x026202 },
+    { 0x0FB03, 0x000000, 0x026243 },
+    { 0x0FB04, 0x000000, 0x0262A3 },
+    { 0x0FB05, 0x000000, 0x026302 },
+    { 0x0FB06, 0x000000, 0x026302 },
+    { 0x0FB13, 0x000000, 0x026342 },
+    { 0x0FB14, 0x000000, 0x026382 },
+    { 0x0FB15, 0x000000, 0x0263C2 },
+    { 0x0FB16, 0x000000, 0x026402 },
+    { 0x0FB17, 0x000000, 0x026442 },
+    { 0x0FB1D, 0x026482, 0x026482 },
+    { 0x0FB1F, 0x0264C2, 0x0264C2 },
+    { 0x0FB20, 0x000000, 0x026501 },
+    { 0x0FB21, 0x000000, 0x0125C1 },
+    { 0x0FB22, 0x000000, 0x012621 },
+    { 0x0FB23, 0x000000, 0x026521 },
+    { 0x0FB24, 0x000000, 0x026541 },
+    { 0x0FB25, 0x000000, 0x026561 },
+    { 0x0FB26, 0x000000, 0x026581 },
+    { 0x0FB27, 0x000000, 0x0265A1 },
+    { 0x0FB28, 0x000000, 0x0265C1 },
+    { 0x0FB29, 0x000000, 0x0120C1 },
+    { 0x0FB2A, 0x0265E2, 0x0265E2 },
+    { 0x0FB2B, 0x026622, 0x026622 },
+    { 0x0FB2C, 0x026663, 0x026663 },
+    { 0x0FB2D, 0x0266C3, 0x0266C3 },
+    { 0x0FB2E, 0x026722, 0x026722 },
+    { 0x0FB2F, 0x026762, 0x026762 },
+    { 0x0FB30, 0x0267A2, 0x0267A2 },
+    { 0x0FB31, 0x0267E2, 0x0267E2 },
+    { 0x0FB32, 0x026822, 0x026822 },
+    { 0x0FB33, 0x026862, 0x026862 },
+    { 0x0FB34, 0x0268A2, 0x0268A2 },
+    { 0x0FB35, 0x0268E2, 0x0268E2 },
+    { 0x0FB36, 0x026922, 0x026922 },
+    { 0x0FB38, 0x026962, 0x026962 },
+    { 0x0FB39, 0x0269A2, 0x0269A2 },
+    { 0x0FB3A, 0x0269E2, 0x0269E2 },
+    { 0x0FB3B, 0x026A22, 0x026A22 },
+    { 0x0FB3C, 0x026A62, 0x026A62 },
+    { 0x0FB3E, 0x026AA2, 0x026AA2 },
+    { 0x0FB40, 0x026AE2, 0x026AE2 },
+    { 0x0FB41, 0x026B22, 0x026B22 },
+    { 0x0FB43, 0x026B62, 0x026B62 },
+    { 0x0FB44, 0x026BA2, 0x026BA2 },
+    { 0x0FB46, 0x026BE2, 0x026BE2 },
+    { 0x0FB47, 0x026C22, 0x026C22 },
+    { 0x0FB48, 0x026C62, 0x026C62 },
+    { 0x0FB49, 0x026CA2, 0x026CA2 },
+    { 0x0FB4A, 0x026CE2, 0x026CE2 },
+    { 0x0FB4B, 0x026D22, 0x026D22 },
+    { 0x0FB4C, 0x026D62, 0x026D62 },
+    { 0x0FB4D, 0x026DA2, 0x026DA2 },
+    { 0x0FB4E, 0x026DE2, 0x026DE2 },
+    { 0x0FB4F, 0x000000, 0x026E22 },
+    { 0x0FB50, 0x000000, 0x026E61 },
+    { 0x0FB51, 0x000000, 0x026E61 },
+    { 0x0FB52, 0x000000, 0x026E81 },
+    { 0x0FB53, 0x000000, 0x026E81 },
+    { 0x0FB54, 0x000000, 0x026E81 },
+    { 0x0FB55, 0x000000, 0x026E81 },
+    { 0x0FB56, 0x000000, 0x026EA1 },
+    { 0x0FB57, 0x000000, 0x026EA1 },
+    { 0x0FB58, 0x000000, 0x026EA1 },
+    { 0x0FB59, 0x000000, 0x026EA1 },
+    { 0x0FB5A, 0x000000, 0x026EC1 },
+    { 0x0FB5B, 0x000000, 0x026EC1 },
+    { 0x0FB5C, 0x000000, 0x026EC1 },
+    { 0x0FB5D, 0x000000, 0x026EC1 },
+    { 0x0FB5E, 0x000000, 0x026EE1 },
+    { 0x0FB5F, 0x000000, 0x026EE1 },
+    { 0x0FB60, 0x000000, 0x026EE1 },
+    { 0x0FB61, 0x000000, 0x026EE1 },
+    { 0x0FB62, 0x000000, 0x026F01 },
+    { 0x0FB63, 0x000000, 0x026F01 },
+    { 0x0FB64, 0x000000, 0x026F01 },
+    { 0x0FB65, 0x000000, 0x026F01 },
+    { 0x0FB66, 0x000000, 0x026F21 },
+    { 0x0FB67, 0x000000, 0x026F21 },
+    { 0x0FB68, 0x000000, 0x026F21 },
+    { 0x0FB69, 0x000000, 0x026F21 },
+    { 0x0FB6A, 0x000000, 0x026F41 },
+    { 0x0FB6B, 0x000000, 0x026F41 },
+    { 0x0FB6C, 0x000000, 0x026F41 },
+    { 0x0FB6D, 0x000000, 0x026F41 },
+    { 0x0FB6E, 0x000000, 0x026F61 },
+    { 0x0FB6F, 0x000000, 0x026F61 },
+    { 0x0FB70, 0x000000, 0x026F61 },
+    { 0x0FB71, 0x000000, 0x026F61 },
+    { 0x0FB72, 0x000000, 0x026F81 },
+    { 0x0FB73, 0x000000, 0x026F81 },
+    { 0x0FB74, 0x000000, 0x026F81 },
+    { 0x0FB75, 0x000000, 0x026F81 },
+    { 0x0FB76, 0x000000, 0x026FA1 },
+    { 0x0FB77, 0x000000, 0x026FA1 },
+    { 0x0FB78, 0x000000, 0x026FA1 },
+    { 0x0FB79, 0x000000, 0x026FA1 },
+    { 0x0FB7A, 0x000000, 0x026FC1 },
+    { 0x0FB7B, 0x000000, 0x026FC1 },
+    { 0x0FB7C, 0x000000, 0x026FC1 },
+    { 0x0FB7D, 0x000000, 0x026FC1 },
+    { 0x0FB7E, 0x000000, 0x026FE1 },
+    { 0x0FB7F, 0x000000, 0x026FE1 },
+    { 0x0FB80, 0x000000, 0x026FE1 },
+    { 0x0FB81, 0x000000, 0x026FE1 },
+    { 0x0FB82, 0x000000, 0x027001 },
+    { 0x0FB83, 0x000000, 0x027001 },
+    { 0x0FB84, 0x000000, 0x027021 },
+    { 0x0FB85, 0x000000, 0x027021 },
+    { 0x0FB86, 0x000000, 0x027041 },
+    { 0x0FB87, 0x000000, 0x027041 },
+    { 0x0FB88, 0x000000, 0x027061 },
+    { 0x0FB89, 0x000000, 0x027061 },
+    { 0x0FB8A, 0x000000, 0x027081 },
+    { 0x0FB8B, 0x000000, 0x027081 },
+    { 0x0FB8C, 0x000000, 0x0270A1 },
+    { 0x0FB8D, 0x000000, 0x0270A1 },
+    { 0x0FB8E, 0x000000, 0x0270C1 },
+    { 0x0FB8F, 0x000000, 0x0270C1 },
+    { 0x0FB90, 0x000000, 0x0270C1 },
+    { 0x0FB91, 0x000000, 0x0270C1 },
+    { 0x0FB92, 0x000000, 0x0270E1 },
+    { 0x0FB93, 0x000000, 0x0270E1 },
+    { 0x0FB94, 0x000000, 0x0270E1 },
+    { 0x0FB95, 0x000000, 0x0270E1 },
+    { 0x0FB96, 0x000000, 0x027101 },
+    { 0x0FB97, 0x000000, 0x027101 },
+    { 0x0FB98, 0x000000, 0x027101 },
+    { 0x0FB99, 0x000000, 0x027101 },
+    { 0x0FB9A, 0x000000, 0x027121 },
+    { 0x0FB9B, 0x000000, 0x027121 },
+    { 0x0FB9C, 0x000000, 0x027121 },
+    { 0x0FB9D, 0x000000, 0x027121 },
+    { 0x0FB9E, 0x000000, 0x027141 },
+    { 0x0FB9F, 0x000000, 0x027141 },
+    { 0x0FBA0, 0x000000, 0x027161 },
+    { 0x0FBA1, 0x000000, 0x027161 },
+    { 0x0FBA2, 0x000000, 0x027161 },
+    { 0x0FBA3, 0x000000, 0x027161 },
+    { 0x0FBA4, 0x000000, 0x006522 },
+    { 0x0FBA5, 0x000000, 0x006522 },
+    { 0x0FBA6, 0x000000, 0x027181 },
+    { 0x0FBA7, 0x000000, 0x027181 },
+    { 0x0FBA8, 0x000000, 0x027181 },
+    { 0x0FBA9, 0x000000, 0x027181 },
+    { 0x0FBAA, 0x000000, 0x0271A1 },
+    { 0x0FBAB, 0x000000, 0x0271A1 },
+    { 0x0FBAC, 0x000000, 0x0271A1 },
+    { 0x0FBAD, 0x000000, 0x0271A1 },
+    { 0x0FBAE, 0x000000, 0x0271C1 },
+    { 0x0FBAF, 0x000000, 0x0271C1 },
+    { 0x0FBB0, 0x000000, 0x0065A2 },
+    { 0x0FBB1, 0x000000, 0x0065A2 },
+    { 0x0FBD3, 0x000000, 0x0271E1 },
+    { 0x0FBD4, 0x000000, 0x0271E1 },
+    { 0x0FBD5, 0x000000, 0x0271E1 },
+    { 0x0FBD6, 0x000000, 0x0271E1 },
+    { 0x0FBD7, 0x000000, 0x027201 },
+    { 0x0FBD8, 0x000000, 0x027201 },
+    { 0x0FBD9, 0x000000, 0x027221 },
+    { 0x0FBDA, 0x000000, 0x027221 },
+    { 0x0FBDB, 0x000000, 0x027241 },
+    { 0x0FBDC, 0x000000, 0x027241 },
+    { 0x0FBDD, 0x000000, 0x0064A2 },
+    { 0x0FBDE, 0x000000, 0x027261 },
+    { 0x0FBDF, 0x000000, 0x027261 },
+    { 0x0FBE0, 0x000000, 0x027281 },
+    { 0x0FBE1, 0x000000, 0x027281 },
+    { 0x0FBE2, 0x000000, 0x0272A1 },
+    { 0x0FBE3, 0x000000, 0x0272A1 },
+    { 0x0FBE4, 0x000000, 0x0272C1 },
+    { 0x0FBE5, 0x000000, 0x0272C1 },
+    { 0x0FBE6, 0x000000, 0x0272C1 },
+    { 0x0FBE7, 0x000000, 0x0272C1 },
+    { 0x0FBE8, 0x000000, 0x0272E1 },
+    { 0x0FBE9, 0x000000, 0x0272E1 },
+    { 0x0FBEA, 0x000000, 0x027303 },
+    { 0x0FBEB, 0x000000, 0x027303 },
+    { 0x0FBEC, 0x000000, 0x027363 },
+    { 0x0FBED, 0x000000, 0x027363 },
+    { 0x0FBEE, 0x000000, 0x0273C3 },
+    { 0x0FBEF, 0x000000, 0x0273C3 },
+    { 0x0FBF0, 0x000000, 0x027423 },
+    { 0x0FBF1, 0x000000, 0x027423 },
+    { 0x0FBF2, 0x000000, 0x027483 },
+    { 0x0FBF3, 0x000000, 0x027483 },
+    { 0x0FBF4, 0x000000, 0x0274E3 },
+    { 0x0FBF5, 0x000000, 0x0274E3 },
+    { 0x0FBF6, 0x000000, 0x027543 },
+    { 0x0FBF7, 0x000000, 0x027543 },
+    { 0x0FBF8, 0x000000, 0x027543 },
+    { 0x0FBF9, 0x000000, 0x0275A3 },
+    { 0x0FBFA, 0x000000, 0x0275A3 },
+    { 0x0FBFB, 0x000000, 0x0275A3 },
+    { 0x0FBFC, 0x000000, 0x027601 },
+    { 0x0FBFD, 0x000000, 0x027601 },
+    { 0x0FBFE, 0x000000, 0x027601 },
+    { 0x0FBFF, 0x000000, 0x027601 },
+    { 0x0FC00, 0x000000, 0x027623 },
+    { 0x0FC01, 0x000000, 0x027683 },
+    { 0x0FC02, 0x000000, 0x0276E3 },
+    { 0x0FC03, 0x000000, 0x0275A3 },
+    { 0x0FC04, 0x000000, 0x027743 },
+    { 0x0FC05, 0x000000, 0x0277A2 },
+    { 0x0FC06, 0x000000, 0x0277E2 },
+    { 0x0FC07, 0x000000, 0x027822 },
+    { 0x0FC08, 0x000000, 0x027862 },
+    { 0x0FC09, 0x000000, 0x0278A2 },
+    { 0x0FC0A, 0x000000, 0x0278E2 },
+    { 0x0FC0B, 0x000000, 0x027922 },
+    { 0x0FC0C, 0x000000, 0x027962 },
+    { 0x0FC0D, 0x000000, 0x0279A2 },
+    { 0x0FC0E, 0x000000, 0x0279E2 },
+    { 0x0FC0F, 0x000000, 0x027A22 },
+    { 0x0FC10, 0x000000, 0x027A62 },
+    { 0x0FC11, 0x000000, 0x027AA2 },
+    { 0x0FC12, 0x000000, 0x027AE2 },
+    { 0x0FC13, 0x000000, 0x027B22 },
+    { 0x0FC14, 0x000000, 0x027B62 },
+    { 0x0FC15, 0x000000, 0x027BA2 },
+    { 0x0FC16, 0x000000, 0x027BE2 },
+    { 0x0FC17, 0x000000, 0x027C22 },
+    { 0x0FC18, 0x000000, 0x027C62 },
+    { 0x0FC19, 0x000000, 0x027CA2 },
+    { 0x0FC1A, 0x000000, 0x027CE2 },
+    { 0x0FC1B, 0x000000, 0x027D22 },
+    { 0x0FC1C, 0x000000, 0x027D62 },
+    { 0x0FC1D, 0x000000, 0x027DA2 },
+    { 0x0FC1E, 0x000000, 0x027DE2 },
+    { 0x0FC1F, 0x000000, 0x027E22 },
+    { 0x0FC20, 0x000000, 0x027E62 },
+    { 0x0FC21, 0x000000, 0x027EA2 },
+    { 0x0FC22, 0x000000, 0x027EE2 },
+    { 0x0FC23, 0x000000, 0x027F22 },
+    { 0x0FC24, 0x000000, 0x027F62 },
+    { 0x0FC25, 0x000000, 0x027FA2 },
+    { 0x0FC26, 0x000000, 0x027FE2 },
+    { 0x0FC27, 0x000000, 0x028022 },
+    { 0x0FC28, 0x000000, 0x028062 },
+    { 0x0FC29, 0x000000, 0x0280A2 },
+    { 0x0FC2A, 0x000000, 0x0280E2 },
+    { 0x0FC2B, 0x000000, 0x028122 },
+    { 0x0FC2C, 0x000000, 0x028162 },
+    { 0x0FC2D, 0x000000, 0x0281A2 },
+    { 0x0FC2E, 0x000000, 0x0281E2 },
+    { 0x0FC2F, 0x000000, 0x028222 },
+    { 0x0FC30, 0x000000, 0x028262 },
+    { 0x0FC31, 0x000000, 0x0282A2 },
+    { 0x0FC32, 0x000000, 0x0282E2 },
+    { 0x0FC33, 0x000000, 0x028322 },
+    { 0x0FC34, 0x000000, 0x028362 },
+    { 0x0FC35, 0x000000, 0x0283A2 },
+    { 0x0FC36, 0x000000, 0x0283E2 },
+    { 0x0FC37, 0x000000, 0x028422 },
+    { 0x0FC38, 0x000000, 0x028462 },
+    { 0x0FC39, 0x000000, 0x0284A2 },
+    { 0x0FC3A, 0x000000, 0x0284E2 },
+    { 0x0FC3B, 0x000000, 0x028522 },
+    { 0x0FC3C, 0x000000, 0x028562 },
+    { 0x0FC3D, 0x000000, 0x0285A2 },
+    { 0x0FC3E, 0x000000, 0x0285E2 },
+    { 0x0FC3F, 0x000000, 0x028622 },
+    { 0x0FC40, 0x000000, 0x028662 },
+    { 0x0FC41, 0x000000, 0x0286A2 },
+    { 0x0FC42, 0x000000, 0x0286E2 },
+    { 0x0FC43, 0x000000, 0x028722 },
+    { 0x0FC44, 0x000000, 0x028762 },
+    { 0x0FC45, 0x000000, 0x0287A2 },
+    { 0x0FC46, 0x000000, 0x0287E2 },
+    { 0x0FC47, 0x000000, 0x028822 },
+    { 0x0FC48, 0x000000, 0x028862 },
+    { 0x0FC49, 0x000000, 0x0288A2 },
+    { 0x0FC4A, 0x000000, 0x0288E2 },
+    { 0x0FC4B, 0x000000, 0x028922 },
+    { 0x0FC4C, 0x000000, 0x028962 },
+    { 0x0FC4D, 0x000000, 0x0289A2 },
+    { 0x0FC4E, 0x000000, 0x0289E2 },
+    { 0x0FC4F, 0x000000, 0x028A22 },
+    { 0x0FC50, 0x000000, 0x028A62 },
+    { 0x0FC51, 0x000000, 0x028AA2 },
+    { 0x0FC52, 0x000000, 0x028AE2 },
+    { 0x0FC53, 0x000000, 0x028B22 },
+    { 0x0FC54, 0x000000, 0x028B62 },
+    { 0x0FC55, 0x000000, 0x028BA2 },
+    { 0x0FC56, 0x000000, 0x028BE2 },
+    { 0x0FC57, 0x000000, 0x028C22 },
+    { 0x0FC58, 0x000000, 0x028C62 },
+    { 0x0FC59, 0x000000, 0x028CA2 },
+    { 0x0FC5A, 0x000000, 0x028CE2 },
+    { 0x0FC5B, 0x000000, 0x028D22 },
+    { 0x0FC5C, 0x000000, 0x028D62 },
+    { 0x0FC5D, 0x000000, 0x028DA2 },
+    { 0x0FC5E, 0x000000, 0x028DE3 },
+    { 0x0FC5F, 0x000000, 0x028E43 },
+    { 0x0FC60, 0x000000, 0x028EA3 },
+    { 0x0FC61, 0x000000, 0x028F03 },
+    { 0x0FC62, 0x000000, 0x028F63 },
+    { 0x0FC63, 0x000000, 0x028FC3 },
+    { 0x0FC64, 0x000000, 0x029023 },
+    { 0x0FC65, 0x000000, 0x029083 },
+    { 0x0FC66, 0x000000, 0x0276E3 },
+    { 0x0FC67, 0x000000, 0x0290E3 },
+    { 0x0FC68, 0x000000, 0x0275A3 },
+    { 0x0FC69, 0x000000, 0x027743 },
+    { 0x0FC6A, 0x000000, 0x029142 },
+    { 0x0FC6B, 0x000000, 0x029182 },
+    { 0x0FC6C, 0x000000, 0x027862 },
+    { 0x0FC6D, 0x000000, 0x0291C2 },
+    { 0x0FC6E, 0x000000, 0x0278A2 },
+    { 0x0FC6F, 0x000000, 0x0278E2 },
+    { 0x0FC70, 0x000000, 0x029202 },
+    { 0x0FC71, 0x000000, 0x029242 },
+    { 0x0FC72, 0x000000, 0x0279E2 },
+    { 0x0FC73, 0x000000, 0x029282 },
+    { 0x0FC74, 0x000000, 0x027A22 },
+    { 0x0FC75, 0x000000, 0x027A62 },
+    { 0x0FC76, 0x000000, 0x0292C2 },
+    { 0x0FC77, 0x000000, 0x029302 },
+    { 0x0FC78, 0x000000, 0x027AE2 },
+    { 0x0FC79, 0x000000, 0x029342 },
+    { 0x0FC7A, 0x000000, 0x027B22 },
+    { 0x0FC7B, 0x000000, 0x027B62 },
+    { 0x0FC7C, 0x000000, 0x0282A2 },
+    { 0x0FC7D, 0x000000, 0x0282E2 },
+    { 0x0FC7E, 0x000000, 0x0283A2 },
+    { 0x0FC7F, 0x000000, 0x0283E2 },
+    { 0x0FC80, 0x000000, 0x028422 },
+    { 0x0FC81, 0x000000, 0x028522 },
+    { 0x0FC82, 0x000000, 0x028562 },
+    { 0x0FC83, 0x000000, 0x0285A2 },
+    { 0x0FC84, 0x000000, 0x0285E2 },
+    { 0x0FC85, 0x000000, 0x0286E2 },
+    { 0x0FC86, 0x000000, 0x028722 },
+    { 0x0FC87, 0x000000, 0x028762 },
+    { 0x0FC88, 0x000000, 0x029382 },
+    { 0x0FC89, 0x000000, 0x028862 },
+    { 0x0FC8A, 0x000000, 0x0293C2 },
+    { 0x0FC8B, 0x000000, 0x029402 },
+    { 0x0FC8C, 0x000000, 0x0289E2 },
+    { 0x0FC8D, 0x000000, 0x029442 },
+    { 0x0FC8E, 0x000000, 0x028A22 },
+    { 0x0FC8F, 0x000000, 0x028A62 },
+    { 0x0FC90, 0x000000, 0x028DA2 },
+    { 0x0FC91, 0x000000, 0x029482 },
+    { 0x0FC92, 0x000000, 0x0294C2 },
+    { 0x0FC93, 0x000000, 0x028C62 },
+    { 0x0FC94, 0x000000, 0x029502 },
+    { 0x0FC95, 0x000000, 0x028CA2 },
+    { 0x0FC96, 0x000000, 0x028CE2 },
+    { 0x0FC97, 0x000000, 0x027623 },
+    { 0x0FC98, 0x000000, 0x027683 },
+    { 0x0FC99, 0x000000, 0x029543 },
+    { 0x0FC9A, 0x000000, 0x0276E3 },
+    { 0x0FC9B, 0x000000, 0x0295A3 },
+    { 0x0FC9C, 0x000000, 0x0277A2 },
+    { 0x0FC9D, 0x000000, 0x0277E2 },
+    { 0x0FC9E, 0x000000, 0x027822 },
+    { 0x0FC9F, 0x000000, 0x027862 },
+    { 0x0FCA0, 0x000000, 0x029602 },
+    { 0x0FCA1, 0x000000, 0x027922 },
+    { 0x0FCA2, 0x000000, 0x027962 },
+    { 0x0FCA3, 0x000000, 0x0279A2 },
+    { 0x0FCA4, 0x000000, 0x0279E2 },
+    { 0x0FCA5, 0x000000, 0x029642 },
+    { 0x0FCA6, 0x000000, 0x027AE2 },
+    { 0x0FCA7, 0x000000, 0x027BA2 },
+    { 0x0FCA8, 0x000000, 0x027BE2 },
+    { 0x0FCA9, 0x000000, 0x027C22 },
+    { 0x0FCAA, 0x000000, 0x027C62 },
+    { 0x0FCAB, 0x000000, 0x027CA2 },
+    { 0x0FCAC, 0x000000, 0x027D22 },
+    { 0x0FCAD, 0x000000, 0x027D62 },
+    { 0x0FCAE, 0x000000, 0x027DA2 },
+    { 0x0FCAF, 0x000000, 0x027DE2 },
+    { 0x0FCB0, 0x000000, 0x027E22 },
+    { 0x0FCB1, 0x000000, 0x027E62 },
+    { 0x0FCB2, 0x000000, 0x029682 },
+    { 0x0FCB3, 0x000000, 0x027EA2 },
+    { 0x0FCB4, 0x000000, 0x027EE2 },
+    { 0x0FCB5, 0x000000, 0x027F22 },
+    { 0x0FCB6, 0x000000, 0x027F62 },
+    { 0x0FCB7, 0x000000, 0x027FA2 },
+    { 0x0FCB8, 0x000000, 0x027FE2 },
+    { 0x0FCB9, 0x000000, 0x028062 },
+    { 0x0FCBA, 0x000000, 0x0280A2 },
+    { 0x0FCBB, 0x000000, 0x0280E2 },
+    { 0x0FCBC, 0x000000, 0x028122 },
+    { 0x0FCBD, 0x000000, 0x028162 },
+    { 0x0FCBE, 0x000000, 0x0281A2 },
+    { 0x0FCBF, 0x000000, 0x0281E2 },
+    { 0x0FCC0, 0x000000, 0x028222 },
+    { 0x0FCC1, 0x000000, 0x028262 },
+    { 0x0FCC2, 0x000000, 0x028322 },
+    { 0x0FCC3, 0x000000, 0x028362 },
+    { 0x0FCC4, 0x000000, 0x028462 },
+    { 0x0FCC5, 0x000000, 0x0284A2 },
+    { 0x0FCC6, 0x000000, 0x0284E2 },
+    { 0x0FCC7, 0x000000, 0x028522 },
+    { 0x0FCC8, 0x000000, 0x028562 },
+    { 0x0FCC9, 0x000000, 0x028622 },
+    { 0x0FCCA, 0x000000, 0x028662 },
+    { 0x0FCCB, 0x000000, 0x0286A2 },
+    { 0x0FCCC, 0x000000, 0x0286E2 },
+    { 0x0FCCD, 0x000000, 0x0296C2 },
+    { 0x0FCCE, 0x000000, 0x0287A2 },
+    { 0x0FCCF, 0x000000, 0x0287E2 },
+    { 0x0FCD0, 0x000000, 0x028822 },
+    { 0x0FCD1, 0x000000, 0x028862 },
+    { 0x0FCD2, 0x000000, 0x028922 },
+    { 0x0FCD3, 0x000000, 0x028962 },
+    { 0x0FCD4, 0x000000, 0x0289A2 },
+    { 0x0FCD5, 0x000000, 0x0289E2 },
+    { 0x0FCD6, 0x000000, 0x029702 },
+    { 0x0FCD7, 0x000000, 0x028AA2 },
+    { 0x0FCD8, 0x000000, 0x028AE2 },
+    { 0x0FCD9, 0x000000, 0x029742 },
+    { 0x0FCDA, 0x000000, 0x028BA2 },
+    { 0x0FCDB, 0x000000, 0x028BE2 },
+    { 0x0FCDC, 0x000000, 0x028C22 },
+    { 0x0FCDD, 0x000000, 0x028C62 },
+    { 0x0FCDE, 0x000000, 0x029782 },
+    { 0x0FCDF, 0x000000, 0x0276E3 },
+    { 0x0FCE0, 0x000000, 0x0295A3 },
+    { 0x0FCE1, 0x000000, 0x027862 },
+    { 0x0FCE2, 0x000000, 0x029602 },
+    { 0x0FCE3, 0x000000, 0x0279E2 },
+    { 0x0FCE4, 0x000000, 0x029642 },
+    { 0x0FCE5, 0x000000, 0x027AE2 },
+    { 0x0FCE6, 0x000000, 0x0297C2 },
+    { 0x0FCE7, 0x000000, 0x027E22 },
+    { 0x0FCE8, 0x000000, 0x029802 },
+    { 0x0FCE9, 0x000000, 0x029842 },
+    { 0x0FCEA, 0x000000, 0x029882 },
+    { 0x0FCEB, 0x000000, 0x028522 },
+    { 0x0FCEC, 0x000000, 0x028562 },
+    { 0x0FCED, 0x000000, 0x0286E2 },
+    { 0x0FCEE, 0x000000, 0x0289E2 },
+    { 0x0FCEF, 0x000000, 0x029702 },
+    { 0x0FCF0, 0x000000, 0x028C62 },
+    { 0x0FCF1, 0x000000, 0x029782 },
+    { 0x0FCF2, 0x000000, 0x0298C3 },
+    { 0x0FCF3, 0x000000, 0x029923 },
+    { 0x0FCF4, 0x000000, 0x029983 },
+    { 0x0FCF5, 0x000000, 0x0299E2 },
+    { 0x0FCF6, 0x000000, 0x029A22 },
+    { 0x0FCF7, 0x000000, 0x029A62 },
+    { 0x0FCF8, 0x000000, 0x029AA2 },
+    { 0x0FCF9, 0x000000, 0x029AE2 },
+    { 0x0FCFA, 0x000000, 0x029B22 },
+    { 0x0FCFB, 0x000000, 0x029B62 },
+    { 0x0FCFC, 0x000000, 0x029BA2 },
+    { 0x0FCFD, 0x000000, 0x029BE2 },
+    { 0x0FCFE, 0x000000, 0x029C22 },
+    { 0x0FCFF, 0x000000, 0x029C62 },
+    { 0x0FD00, 0x000000, 0x029CA2 },
+    { 0x0FD01, 0x000000, 0x029CE2 },
+    { 0x0FD02, 0x000000, 0x029D22 },
+    { 0x0FD03, 0x000000, 0x029D62 },
+    { 0x0FD04, 0x000000, 0x029DA2 },
+    { 0x0FD05, 0x000000, 0x029DE2 },
+    { 0x0FD06, 0x000000, 0x029E22 },
+    { 0x0FD07, 0x000000, 0x029E62 },
+    { 0x0FD08, 0x000000, 0x029EA2 },
+    { 0x0FD09, 0x000000, 0x029EE2 },
+    { 0x0FD0A, 0x000000, 0x029F22 },
+    { 0x0FD0B, 0x000000, 0x029F62 },
+    { 0x0FD0C, 0x000000, 0x029842 },
+    { 0x0FD0D, 0x000000, 0x029FA2 },
+    { 0x0FD0E, 0x000000, 0x029FE2 },
+    { 0x0FD0F, 0x000000, 0x02A022 },
+    { 0x0FD10, 0x000000, 0x02A062 },
+    { 0x0FD11, 0x000000, 0x0299E2 },
+    { 0x0FD12, 0x000000, 0x029A22 },
+    { 0x0FD13, 0x000000, 0x029A62 },
+    { 0x0FD14, 0x000000, 0x029AA2 },
+    { 0x0FD15, 0x000000, 0x029AE2 },
+    { 0x0FD16, 0x000000, 0x029B22 },
+    { 0x0FD17, 0x000000, 0x029B62 },
+    { 0x0FD18, 0x000000, 0x029BA2 },
+    { 0x0FD19, 0x000000, 0x029BE2 },
+    { 0x0FD1A, 0x000000, 0x029C22 },
+    { 0x0FD1B, 0x000000, 0x029C62 },
+    { 0x0FD1C, 0x000000, 0x029CA2 },
+    { 0x0FD1D, 0x000000, 0x029CE2 },
+    { 0x0FD1E, 0x000000, 0x029D22 },
+    { 0x0FD1F, 0x000000, 0x029D62 },
+    { 0x0FD20, 0x000000, 0x029DA2 },
+    { 0x0FD21, 0x000000, 0x029DE2 },
+    { 0x0FD22, 0x000000, 0x029E22 },
+    { 0x0FD23, 0x000000, 0x029E62 },
+    { 0x0FD24, 0x000000, 0x029EA2 },
+    { 0x0FD25, 0x000000, 0x029EE2 },
+    { 0x0FD26, 0x000000, 0x029F22 },
+    { 0x0FD27, 0x000000, 0x029F62 },
+    { 0x0FD28, 0x000000, 0x029842 },
+    { 0x0FD29, 0x000000, 0x029FA2 },
+    { 0x0FD2A, 0x000000, 0x029FE2 },
+    { 0x0FD2B, 0x000000, 0x02A022 },
+    { 0x0FD2C, 0x000000, 0x02A062 },
+    { 0x0FD2D, 0x000000, 0x029EE2 },
+    { 0x0FD2E, 0x000000, 0x029F22 },
+    { 0x0FD2F, 0x000000, 0x029F62 },
+    { 0x0FD30, 0x000000, 0x029842 },
+    { 0x0FD31, 0x000000, 0x029802 },
+    { 0x0FD32, 0x000000, 0x029882 },
+    { 0x0FD33, 0x000000, 0x028022 },
+    { 0x0FD34, 0x000000, 0x027D62 },
+    { 0x0FD35, 0x000000, 0x027DA2 },
+    { 0x0FD36, 0x000000, 0x027DE2 },
+    { 0x0FD37, 0x000000, 0x029EE2 },
+    { 0x0FD38, 0x000000, 0x029F22 },
+    { 0x0FD39, 0x000000, 0x029F62 },
+    { 0x0FD3A, 0x000000, 0x028022 },
+    { 0x0FD3B, 0x000000, 0x028062 },
+    { 0x0FD3C, 0x000000, 0x02A0A2 },
+    { 0x0FD3D, 0x000000, 0x02A0A2 },
+    { 0x0FD50, 0x000000, 0x02A0E3 },
+    { 0x0FD51, 0x000000, 0x02A143 },
+    { 0x0FD52, 0x000000, 0x02A143 },
+    { 0x0FD53, 0x000000, 0x02A1A3 },
+    { 0x0FD54, 0x000000, 0x02A203 },
+    { 0x0FD55, 0x000000, 0x02A263 },
+    { 0x0FD56, 0x000000, 0x02A2C3 },
+    { 0x0FD57, 0x000000, 0x02A323 },
+    { 0x0FD58, 0x000000, 0x02A383 },
+    { 0x0FD59, 0x000000, 0x02A383 },
+    { 0x0FD5A, 0x000000, 0x02A3E3 },
+    { 0x0FD5B, 0x000000, 0x02A443 },
+    { 0x0FD5C, 0x000000, 0x02A4A3 },
+    { 0x0FD5D, 0x000000, 0x02A503 },
+    { 0x0FD5E, 0x000000, 0x02A563 },
+    { 0x0FD5F, 0x000000, 0x02A5C3 },
+    { 0x0FD60, 0x000000, 0x02A5C3 },
+    { 0x0FD61, 0x000000, 0x02A623 },
+    { 0x0FD62, 0x000000, 0x02A683 },
+    { 0x0FD63, 0x000000, 0x02A683 },
+    { 0x0FD64, 0x000000, 0x02A6E3 },
+    { 0x0FD65, 0x000000, 0x02A6E3 },
+    { 0x0FD66, 0x000000, 0x02A743 },
+    { 0x0FD67, 0x000000, 0x02A7A3 },
+    { 0x0FD68, 0x000000, 0x02A7A3 },
+    { 0x0FD69, 0x000000, 0x02A803 },
+    { 0x0FD6A, 0x000000, 0x02A863 },
+    { 0x0FD6B, 0x000000, 0x02A863 },
+    { 0x0FD6C, 0x000000, 0x02A8C3 },
+    { 0x0FD6D, 0x000000, 0x02A8C3 },
+    { 0x0FD6E, 0x000000, 0x02A923 },
+    { 0x0FD6F, 0x000000, 0x02A983 },
+    { 0x0FD70, 0x000000, 0x02A983 },
+    { 0x0FD71, 0x000000, 0x02A9E3 },
+    { 0x0FD72, 0x000000, 0x02A9E3 },
+    { 0x0FD73, 0x000000, 0x02AA43 },
+    { 0x0FD74, 0x000000, 0x02AAA3 },
+    { 0x0FD75, 0x000000, 0x02AB03 },
+    { 0x0FD76, 0x000000, 0x02AB63 },
+    { 0x0FD77, 0x000000, 0x02AB63 },
+    { 0x0FD78, 0x000000, 0x02ABC3 },
+    { 0x0FD79, 0x000000, 0x02AC23 },
+    { 0x0FD7A, 0x000000, 0x02AC83 },
+    { 0x0FD7B, 0x000000, 0x02ACE3 },
+    { 0x0FD7C, 0x000000, 0x02AD43 },
+    { 0x0FD7D, 0x000000, 0x02AD43 },
+    { 0x0FD7E, 0x000000, 0x02ADA3 },
+    { 0x0FD7F, 0x000000, 0x02AE03 },
+    { 0x0FD80, 0x000000, 0x02AE63 },
+    { 0x0FD81, 0x000000, 0x02AEC3 },
+    { 0x0FD82, 0x000000, 0x02AF23 },
+    { 0x0FD83, 0x000000, 0x02AF83 },
+    { 0x0FD84, 0x000000, 0x02AF83 },
+    { 0x0FD85, 0x000000, 0x02AFE3 },
+    { 0x0FD86, 0x000000, 0x02AFE3 },
+    { 0x0FD87, 0x000000, 0x02B043 },
+    { 0x0FD88, 0x000000, 0x02B043 },
+    { 0x0FD89, 0x000000, 0x02B0A3 },
+    { 0x0FD8A, 0x000000, 0x02B103 },
+    { 0x0FD8B, 0x000000, 0x02B163 },
+    { 0x0FD8C, 0x000000, 0x02B1C3 },
+    { 0x0FD8D, 0x000000, 0x02B223 },
+    { 0x0FD8E, 0x000000, 0x02B283 },
+    { 0x0FD8F, 0x000000, 0x02B2E3 },
+    { 0x0FD92, 0x000000, 0x02B343 },
+    { 0x0FD93, 0x000000, 0x02B3A3 },
+    { 0x0FD94, 0x000000, 0x02B403 },
+    { 0x0FD95, 0x000000, 0x02B463 },
+    { 0x0FD96, 0x000000, 0x02B4C3 },
+    { 0x0FD97, 0x000000, 0x02B523 },
+    { 0x0FD98, 0x000000, 0x02B523 },
+    { 0x0FD99, 0x000000, 0x02B583 },
+    { 0x0FD9A, 0x000000, 0x02B5E3 },
+    { 0x0FD9B, 0x000000, 0x02B643 },
+    { 0x0FD9C, 0x000000, 0x02B6A3 },
+    { 0x0FD9D, 0x000000, 0x02B6A3 },
+    { 0x0FD9E, 0x000000, 0x02B703 },
+    { 0x0FD9F, 0x000000, 0x02B763 },
+    { 0x0FDA0, 0x000000, 0x02B7C3 },
+    { 0x0FDA1, 0x000000, 0x02B823 },
+    { 0x0FDA2, 0x000000, 0x02B883 },
+    { 0x0FDA3, 0x000000, 0x02B8E3 },
+    { 0x0FDA4, 0x000000, 0x02B943 },
+    { 0x0FDA5, 0x000000, 0x02B9A3 },
+    { 0x0FDA6, 0x000000, 0x02BA03 },
+    { 0x0FDA7, 0x000000, 0x02BA63 },
+    { 0x0FDA8, 0x000000, 0x02BAC3 },
+    { 0x0FDA9, 0x000000, 0x02BB23 },
+    { 0x0FDAA, 0x000000, 0x02BB83 },
+    { 0x0FDAB, 0x000000, 0x02BBE3 },
+    { 0x0FDAC, 0x000000, 0x02BC43 },
+    { 0x0FDAD, 0x000000, 0x02BCA3 },
+    { 0x0FDAE, 0x000000, 0x02BD03 },
+    { 0x0FDAF, 0x000000, 0x02BD63 },
+    { 0x0FDB0, 0x000000, 0x02BDC3 },
+    { 0x0FDB1, 0x000000, 0x02BE23 },
+    { 0x0FDB2, 0x000000, 0x02BE83 },
+    { 0x0FDB3, 0x000000, 0x02BEE3 },
+    { 0x0FDB4, 0x000000, 0x02ADA3 },
+    { 0x0FDB5, 0x000000, 0x02AE63 },
+    { 0x0FDB6, 0x000000, 0x02BF43 },
+    { 0x0FDB7, 0x000000, 0x02BFA3 },
+    { 0x0FDB8, 0x000000, 0x02C003 },
+    { 0x0FDB9, 0x000000, 0x02C063 },
+    { 0x0FDBA, 0x000000, 0x02C0C3 },
+    { 0x0FDBB, 0x000000, 0x02C123 },
+    { 0x0FDBC, 0x000000, 0x02C0C3 },
+    { 0x0FDBD, 0x000000, 0x02C003 },
+    { 0x0FDBE, 0x000000, 0x02C183 },
+    { 0x0FDBF, 0x000000, 0x02C1E3 },
+    { 0x0FDC0, 0x000000, 0x02C243 },
+    { 0x0FDC1, 0x000000, 0x02C2A3 },
+    { 0x0FDC2, 0x000000, 0x02C303 },
+    { 0x0FDC3, 0x000000, 0x02C123 },
+    { 0x0FDC4, 0x000000, 0x02AB03 },
+    { 0x0FDC5, 0x000000, 0x02A743 },
+    { 0x0FDC6, 0x000000, 0x02C363 },
+    { 0x0FDC7, 0x000000, 0x02C3C3 },
+    { 0x0FDF0, 0x000000, 0x02C423 },
+    { 0x0FDF1, 0x000000, 0x02C483 },
+    { 0x0FDF2, 0x000000, 0x02C4E4 },
+    { 0x0FDF3, 0x000000, 0x02C564 },
+    { 0x0FDF4, 0x000000, 0x02C5E4 },
+    { 0x0FDF5, 0x000000, 0x02C664 },
+    { 0x0FDF6, 0x000000, 0x02C6E4 },
+    { 0x0FDF7, 0x000000, 0x02C764 },
+    { 0x0FDF8, 0x000000, 0x02C7E4 },
+    { 0x0FDF9, 0x000000, 0x02C863 },
+    { 0x0FDFA, 0x000000, 0x02C8D2 },
+    { 0x0FDFB, 0x000000, 0x02CB08 },
+    { 0x0FDFC, 0x000000, 0x02CC04 },
+    { 0x0FE10, 0x000000, 0x02CC81 },
+    { 0x0FE11, 0x000000, 0x02CCA1 },
+    { 0x0FE12, 0x000000, 0x02CCC1 },
+    { 0x0FE13, 0x000000, 0x02CCE1 },
+    { 0x0FE14, 0x000000, 0x004DA1 },
+    { 0x0FE15, 0x000000, 0x02CD01 },
+    { 0x0FE16, 0x000000, 0x02CD21 },
+    { 0x0FE17, 0x000000, 0x02CD41 },
+    { 0x0FE18, 0x000000, 0x02CD61 },
+    { 0x0FE19, 0x000000, 0x011C83 },
+    { 0x0FE30, 0x000000, 0x011C42 },
+    { 0x0FE31, 0x000000, 0x02CD81 },
+    { 0x0FE32, 0x000000, 0x02CDA1 },
+    { 0x0FE33, 0x000000, 0x02CDC1 },
+    { 0x0FE34, 0x000000, 0x02CDC1 },
+    { 0x0FE35, 0x000000, 0x012121 },
+    { 0x0FE36, 0x000000, 0x012141 },
+    { 0x0FE37, 0x000000, 0x02CDE1 },
+    { 0x0FE38, 0x000000, 0x02CE01 },
+    { 0x0FE39, 0x000000, 0x02CE21 },
+    { 0x0FE3A, 0x000000, 0x02CE41 },
+    { 0x0FE3B, 0x000000, 0x02CE61 },
+    { 0x0FE3C, 0x000000, 0x02CE81 },
+    { 0x0FE3D, 0x000000, 0x02CEA1 },
+    { 0x0FE3E, 0x000000, 0x02CEC1 },
+    { 0x0FE3F, 0x000000, 0x013FA1 },
+    { 0x0FE40, 0x000000, 0x013FC1 },
+    { 0x0FE41, 0x000000, 0x02CEE1 },
+    { 0x0FE42, 0x000000, 0x02CF01 },
+    { 0x0FE43, 0x000000, 0x02CF21 },
+    { 0x0FE44, 0x000000, 0x02CF41 },
+    { 0x0FE47, 0x000000, 0x02CF61 },
+    { 0x0FE48, 0x000000, 0x02CF81 },
+    { 0x0FE49, 0x000000, 0x011E62 },
+    { 0x0FE4A, 0x000000, 0x011E62 },
+    { 0x0FE4B, 0x000000, 0x011E62 },
+    { 0x0FE4C, 0x000000, 0x011E62 },
+    { 0x0FE4D, 0x000000, 0x02CDC1 },
+    { 0x0FE4E, 0x000000, 0x02CDC1 },
+    { 0x0FE4F, 0x000000, 0x02CDC1 },
+    { 0x0FE50, 0x000000, 0x02CC81 },
+    { 0x0FE51, 0x000000, 0x02CCA1 },
+    { 0x0FE52, 0x000000, 0x011C21 },
+    { 0x0FE54, 0x000000, 0x004DA1 },
+    { 0x0FE55, 0x000000, 0x02CCE1 },
+    { 0x0FE56, 0x000000, 0x02CD21 },
+    { 0x0FE57, 0x000000, 0x02CD01 },
+    { 0x0FE58, 0x000000, 0x02CD81 },
+    { 0x0FE59, 0x000000, 0x012121 },
+    { 0x0FE5A, 0x000000, 0x012141 },
+    { 0x0FE5B, 0x000000, 0x02CDE1 },
+    { 0x0FE5C, 0x000000, 0x02CE01 },
+    { 0x0FE5D, 0x000000, 0x02CE21 },
+    { 0x0FE5E, 0x000000, 0x02CE41 },
+    { 0x0FE5F, 0x000000, 0x02CFA1 },
+    { 0x0FE60, 0x000000, 0x02CFC1 },
+    { 0x0FE61, 0x000000, 0x02CFE1 },
+    { 0x0FE62, 0x000000, 0x0120C1 },
+    { 0x0FE63, 0x000000, 0x02D001 },
+    { 0x0FE64, 0x000000, 0x02D021 },
+    { 0x0FE65, 0x000000, 0x02D041 },
+    { 0x0FE66, 0x000000, 0x012101 },
+    { 0x0FE68, 0x000000, 0x02D061 },
+    { 0x0FE69, 0x000000, 0x02D081 },
+    { 0x0FE6A, 0x000000, 0x02D0A1 },
+    { 0x0FE6B, 0x000000, 0x02D0C1 },
+    { 0x0FE70, 0x000000, 0x02D0E2 },
+    { 0x0FE71, 0x000000, 0x02D122 },
+    { 0x0FE72, 0x000000, 0x02D162 },
+    { 0x0FE74, 0x000000, 0x02D1A2 },
+    { 0x0FE76, 0x000000, 0x02D1E2 },
+    { 0x0FE77, 0x000000, 0x02D222 },
+    { 0x0FE78, 0x000000, 0x02D262 },
+    { 0x0FE79, 0x000000, 0x02D2A2 },
+    { 0x0FE7A, 0x000000, 0x02D2E2 },
+    { 0x0FE7B, 0x000000, 0x02D322 },
+    { 0x0FE7C, 0x000000, 0x02D362 },
+    { 0x0FE7D, 0x000000, 0x02D3A2 },
+    { 0x0FE7E, 0x000000, 0x02D3E2 },
+    { 0x0FE7F, 0x000000, 0x02D422 },
+    { 0x0FE80, 0x000000, 0x02D461 },
+    { 0x0FE81, 0x000000, 0x0062E2 },
+    { 0x0FE82, 0x000000, 0x0062E2 },
+    { 0x0FE83, 0x000000, 0x006322 },
+    { 0x0FE84, 0x000000, 0x006322 },
+    { 0x0FE85, 0x000000, 0x006362 },
+    { 0x0FE86, 0x000000, 0x006362 },
+    { 0x0FE87, 0x000000, 0x0063A2 },
+    { 0x0FE88, 0x000000, 0x0063A2 },
+    { 0x0FE89, 0x000000, 0x0063E2 },
+    { 0x0FE8A, 0x000000, 0x0063E2 },
+    { 0x0FE8B, 0x000000, 0x0063E2 },
+    { 0x0FE8C, 0x000000, 0x0063E2 },
+    { 0x0FE8D, 0x000000, 0x02D481 },
+    { 0x0FE8E, 0x000000, 0x02D481 },
+    { 0x0FE8F, 0x000000, 0x02D4A1 },
+    { 0x0FE90, 0x000000, 0x02D4A1 },
+    { 0x0FE91, 0x000000, 0x02D4A1 },
+    { 0x0FE92, 0x000000, 0x02D4A1 },
+    { 0x0FE93, 0x000000, 0x02D4C1 },
+    { 0x0FE94, 0x000000, 0x02D4C1 },
+    { 0x0FE95, 0x000000, 0x02D4E1 },
+    { 0x0FE96, 0x000000, 0x02D4E1 },
+    { 0x0FE97, 0x000000, 0x02D4E1 },
+    { 0x0FE98, 0x000000, 0x02D4E1 },
+    { 0x0FE99, 0x000000, 0x02D501 },
+    { 0x0FE9A, 0x000000, 0x02D501 },
+    { 0x0FE9B, 0x000000, 0x02D501 },
+    { 0x0FE9C, 0x000000, 0x02D501 },
+    { 0x0FE9D, 0x000000, 0x02D521 },
+    { 0x0FE9E, 0x000000, 0x02D521 },
+    { 0x0FE9F, 0x000000, 0x02D521 },
+    { 0x0FEA0, 0x000000, 0x02D521 },
+    { 0x0FEA1, 0x000000, 0x02D541 },
+    { 0x0FEA2, 0x000000, 0x02D541 },
+    { 0x0FEA3, 0x000000, 0x02D541 },
+    { 0x0FEA4, 0x000000, 0x02D541 },
+    { 0x0FEA5, 0x000000, 0x02D561 },
+    { 0x0FEA6, 0x000000, 0x02D561 },
+    { 0x0FEA7, 0x000000, 0x02D561 },
+    { 0x0FEA8, 0x000000, 0x02D561 },
+    { 0x0FEA9, 0x000000, 0x02D581 },
+    { 0x0FEAA, 0x000000, 0x02D581 },
+    { 0x0FEAB, 0x000000, 0x02D5A1 },
+    { 0x0FEAC, 0x000000, 0x02D5A1 },
+    { 0x0FEAD, 0x000000, 0x02D5C1 },
+    { 0x0FEAE, 0x000000, 0x02D5C1 },
+    { 0x0FEAF, 0x000000, 0x02D5E1 },
+    { 0x0FEB0, 0x000000, 0x02D5E1 },
+    { 0x0FEB1, 0x000000, 0x02D601 },
+    { 0x0FEB2, 0x000000, 0x02D601 },
+    { 0x0FEB3, 0x000000, 0x02D601 },
+    { 0x0FEB4, 0x000000, 0x02D601 },
+    { 0x0FEB5, 0x000000, 0x02D621 },
+    { 0x0FEB6, 0x000000, 0x02D621 },
+    { 0x0FEB7, 0x000000, 0x02D621 },
+    { 0x0FEB8, 0x000000, 0x02D621 },
+    { 0x0FEB9, 0x000000, 0x02D641 },
+    { 0x0FEBA, 0x000000, 0x02D641 },
+    { 0x0FEBB, 0x000000, 0x02D641 },
+    { 0x0FEBC, 0x000000, 0x02D641 },
+    { 0x0FEBD, 0x000000, 0x02D661 },
+    { 0x0FEBE, 0x000000, 0x02D661 },
+    { 0x0FEBF, 0x000000, 0x02D661 },
+    { 0x0FEC0, 0x000000, 0x02D661 },
+    { 0x0FEC1, 0x000000, 0x02D681 },
+    { 0x0FEC2, 0x000000, 0x02D681 },
+    { 0x0FEC3, 0x000000, 0x02D681 },
+    { 0x0FEC4, 0x000000, 0x02D681 },
+    { 0x0FEC5, 0x000000, 0x02D6A1 },
+    { 0x0FEC6, 0x000000, 0x02D6A1 },
+    { 0x0FEC7, 0x000000, 0x02D6A1 },
+    { 0x0FEC8, 0x000000, 0x02D6A1 },
+    { 0x0FEC9, 0x000000, 0x02D6C1 },
+    { 0x0FECA, 0x000000, 0x02D6C1 },
+    { 0x0FECB, 0x000000, 0x02D6C1 },
+    { 0x0FECC, 0x000000, 0x02D6C1 },
+    { 0x0FECD, 0x000000, 0x02D6E1 },
+    { 0x0FECE, 0x000000, 0x02D6E1 },
+    { 0x0FECF, 0x000000, 0x02D6E1 },
+    { 0x0FED0, 0x000000, 0x02D6E1 },
+    { 0x0FED1, 0x000000, 0x02D701 },
+    { 0x0FED2, 0x000000, 0x02D701 },
+    { 0x0FED3, 0x000000, 0x02D701 },
+    { 0x0FED4, 0x000000, 0x02D701 },
+    { 0x0FED5, 0x000000, 0x02D721 },
+    { 0x0FED6, 0x000000, 0x02D721 },
+    { 0x0FED7, 0x000000, 0x02D721 },
+    { 0x0FED8, 0x000000, 0x02D721 },
+    { 0x0FED9, 0x000000, 0x02D741 },
+    { 0x0FEDA, 0x000000, 0x02D741 },
+    { 0x0FEDB, 0x000000, 0x02D741 },
+    { 0x0FEDC, 0x000000, 0x02D741 },
+    { 0x0FEDD, 0x000000, 0x02D761 },
+    { 0x0FEDE, 0x000000, 0x02D761 },
+    { 0x0FEDF, 0x000000, 0x02D761 },
+    { 0x0FEE0, 0x000000, 0x02D761 },
+    { 0x0FEE1, 0x000000, 0x02D781 },
+    { 0x0FEE2, 0x000000, 0x02D781 },
+    { 0x0FEE3, 0x000000, 0x02D781 },
+    { 0x0FEE4, 0x000000, 0x02D781 },
+    { 0x0FEE5, 0x000000, 0x02D7A1 },
+    { 0x0FEE6, 0x000000, 0x02D7A1 },
+    { 0x0FEE7, 0x000000, 0x02D7A1 },
+    { 0x0FEE8, 0x000000, 0x02D7A1 },
+    { 0x0FEE9, 0x000000, 0x02D7C1 },
+    { 0x0FEEA, 0x000000, 0x02D7C1 },
+    { 0x0FEEB, 0x000000, 0x02D7C1 },
+    { 0x0FEEC, 0x000000, 0x02D7C1 },
+    { 0x0FEED, 0x000000, 0x02D7E1 },
+    { 0x0FEEE, 0x000000, 0x02D7E1 },
+    { 0x0FEEF, 0x000000, 0x0272E1 },
+    { 0x0FEF0, 0x000000, 0x0272E1 },
+    { 0x0FEF1, 0x000000, 0x02D801 },
+    { 0x0FEF2, 0x000000, 0x02D801 },
+    { 0x0FEF3, 0x000000, 0x02D801 },
+    { 0x0FEF4, 0x000000, 0x02D801 },
+    { 0x0FEF5, 0x000000, 0x02D823 },
+    { 0x0FEF6, 0x000000, 0x02D823 },
+    { 0x0FEF7, 0x000000, 0x02D883 },
+    { 0x0FEF8, 0x000000, 0x02D883 },
+    { 0x0FEF9, 0x000000, 0x02D8E3 },
+    { 0x0FEFA, 0x000000, 0x02D8E3 },
+    { 0x0FEFB, 0x000000, 0x02D942 },
+    { 0x0FEFC, 0x000000, 0x02D942 },
+    { 0x0FF01, 0x000000, 0x02CD01 },
+    { 0x0FF02, 0x000000, 0x02D981 },
+    { 0x0FF03, 0x000000, 0x02CFA1 },
+    { 0x0FF04, 0x000000, 0x02D081 },
+    { 0x0FF05, 0x000000, 0x02D0A1 },
+    { 0x0FF06, 0x000000, 0x02CFC1 },
+    { 0x0FF07, 0x000000, 0x02D9A1 },
+    { 0x0FF08, 0x000000, 0x012121 },
+    { 0x0FF09, 0x000000, 0x012141 },
+    { 0x0FF0A, 0x000000, 0x02CFE1 },
+    { 0x0FF0B, 0x000000, 0x0120C1 },
+    { 0x0FF0C, 0x000000, 0x02CC81 },
+    { 0x0FF0D, 0x000000, 0x02D001 },
+    { 0x0FF0E, 0x000000, 0x011C21 },
+    { 0x0FF0F, 0x000000, 0x02D9C1 },
+    { 0x0FF10, 0x000000, 0x011FE1 },
+    { 0x0FF11, 0x000000, 0x0001A1 },
+    { 0x0FF12, 0x000000, 0x0000C1 },
+    { 0x0FF13, 0x000000, 0x0000E1 },
+    { 0x0FF14, 0x000000, 0x012001 },
+    { 0x0FF15, 0x000000, 0x012021 },
+    { 0x0FF16, 0x000000, 0x012041 },
+    { 0x0FF17, 0x000000, 0x012061 },
+    { 0x0FF18, 0x000000, 0x012081 },
+    { 0x0FF19, 0x000000, 0x0120A1 },
+    { 0x0FF1A, 0x000000, 0x02CCE1 },
+    { 0x0FF1B, 0x000000, 0x004DA1 },
+    { 0x0FF1C, 0x000000, 0x02D021 },
+    { 0x0FF1D, 0x000000, 0x012101 },
+    { 0x0FF1E, 0x000000, 0x02D041 },
+    { 0x0FF1F, 0x000000, 0x02CD21 },
+    { 0x0FF20, 0x000000, 0x02D0C1 },
+    { 0x0FF21, 0x000000, 0x007A61 },
+    { 0x0FF22, 0x000000, 0x007AA1 },
+    { 0x0FF23, 0x000000, 0x012281 },
+    { 0x0FF24, 0x000000, 0x007AC1 },
+    { 0x0FF25, 0x000000, 0x007AE1 },
+    { 0x0FF26, 0x000000, 0x0125A1 },
+    { 0x0FF27, 0x000000, 0x007B21 },
+    { 0x0FF28, 0x000000, 0x007B41 },
+    { 0x0FF29, 0x000000, 0x007B61 },
+    { 0x0FF2A, 0x000000, 0x007B81 },
+    { 0x0FF2B, 0x000000, 0x007BA1 },
+    { 0x0FF2C, 0x000000, 0x007BC1 },
+    { 0x0FF2D, 0x000000, 0x007BE1 },
+    { 0x0FF2E, 0x000000, 0x007C01 },
+    { 0x0FF2F, 0x000000, 0x007C21 },
+    { 0x0FF30, 0x000000, 0x007C61 },
+    { 0x0FF31, 0x000000, 0x012461 },
+    { 0x0FF32, 0x000000, 0x007C81 },
+    { 0x0FF33, 0x000000, 0x015BA1 },
+    { 0x0FF34, 0x000000, 0x007CA1 },
+    { 0x0FF35, 0x000000, 0x007CC1 },
+    { 0x0FF36, 0x000000, 0x012DE1 },
+    { 0x0FF37, 0x000000, 0x007CE1 },
+    { 0x0FF38, 0x000000, 0x012F61 },
+    { 0x0FF39, 0x000000, 0x015BC1 },
+    { 0x0FF3A, 0x000000, 0x012561 },
+    { 0x0FF3B, 0x000000, 0x02CF61 },
+    { 0x0FF3C, 0x000000, 0x02D061 },
+    { 0x0FF3D, 0x000000, 0x02CF81 },
+    { 0x0FF3E, 0x000000, 0x02D9E1 },
+    { 0x0FF3F, 0x000000, 0x02CDC1 },
+    { 0x0FF40, 0x000000, 0x0118A1 },
+    { 0x0FF41, 0x000000, 0x000061 },
+    { 0x0FF42, 0x000000, 0x007D61 },
+    { 0x0FF43, 0x000000, 0x0080A1 },
+    { 0x0FF44, 0x000000, 0x007D81 },
+    { 0x0FF45, 0x000000, 0x007DA1 },
+    { 0x0FF46, 0x000000, 0x008101 },
+    { 0x0FF47, 0x000000, 0x007E21 },
+    { 0x0FF48, 0x000000, 0x004981 },
+    { 0x0FF49, 0x000000, 0x008041 },
+    { 0x0FF4A, 0x000000, 0x0049C1 },
+    { 0x0FF4B, 0x000000, 0x007E41 },
+    { 0x0FF4C, 0x000000, 0x004C41 },
+    { 0x0FF4D, 0x000000, 0x007E61 },
+    { 0x0FF4E, 0x000000, 0x012161 },
+    { 0x0FF4F, 0x000000, 0x0001C1 },
+    { 0x0FF50, 0x000000, 0x007F01 },
+    { 0x0FF51, 0x000000, 0x015BE1 },
+    { 0x0FF52, 0x000000, 0x0049E1 },
+    { 0x0FF53, 0x000000, 0x002C81 },
+    { 0x0FF54, 0x000000, 0x007F21 },
+    { 0x0FF55, 0x000000, 0x007F41 },
+    { 0x0FF56, 0x000000, 0x007FA1 },
+    { 0x0FF57, 0x000000, 0x004A61 },
+    { 0x0FF58, 0x000000, 0x004C61 },
+    { 0x0FF59, 0x000000, 0x004A81 },
+    { 0x0FF5A, 0x000000, 0x008461 },
+    { 0x0FF5B, 0x000000, 0x02CDE1 },
+    { 0x0FF5C, 0x000000, 0x02DA01 },
+    { 0x0FF5D, 0x000000, 0x02CE01 },
+    { 0x0FF5E, 0x000000, 0x02DA21 },
+    { 0x0FF5F, 0x000000, 0x02DA41 },
+    { 0x0FF60, 0x000000, 0x02DA61 },
+    { 0x0FF61, 0x000000, 0x02CCC1 },
+    { 0x0FF62, 0x000000, 0x02CEE1 },
+    { 0x0FF63, 0x000000, 0x02CF01 },
+    { 0x0FF64, 0x000000, 0x02CCA1 },
+    { 0x0FF65, 0x000000, 0x02DA81 },
+    { 0x0FF66, 0x000000, 0x01CD21 },
+    { 0x0FF67, 0x000000, 0x02DAA1 },
+    { 0x0FF68, 0x000000, 0x02DAC1 },
+    { 0x0FF69, 0x000000, 0x02DAE1 },
+    { 0x0FF6A, 0x000000, 0x02DB01 },
+    { 0x0FF6B, 0x000000, 0x02DB21 },
+    { 0x0FF6C, 0x000000, 0x02DB41 },
+    { 0x0FF6D, 0x000000, 0x02DB61 },
+    { 0x0FF6E, 0x000000, 0x02DB81 },
+    { 0x0FF6F, 0x000000, 0x02DBA1 },
+    { 0x0FF70, 0x000000, 0x02DBC1 },
+    { 0x0FF71, 0x000000, 0x01C761 },
+    { 0x0FF72, 0x000000, 0x01C781 },
+    { 0x0FF73, 0x000000, 0x01C7A1 },
+    { 0x0FF74, 0x000000, 0x01C7C1 },
+    { 0x0FF75, 0x000000, 0x01C7E1 },
+    { 0x0FF76, 0x000000, 0x01C801 },
+    { 0x0FF77, 0x000000, 0x01C821 },
+    { 0x0FF78, 0x000000, 0x01C841 },
+    { 0x0FF79, 0x000000, 0x01C861 },
+    { 0x0FF7A, 0x000000, 0x01C881 },
+    { 0x0FF7B, 0x000000, 0x01C8A1 },
+    { 0x0FF7C, 0x000000, 0x01C8C1 },
+    { 0x0FF7D, 0x000000, 0x01C8E1 },
+    { 0x0FF7E, 0x000000, 0x01C901 },
+    { 0x0FF7F, 0x000000, 0x01C921 },
+    { 0x0FF80, 0x000000, 0x01C941 },
+    { 0x0FF81, 0x000000, 0x01C961 },
+    { 0x0FF82, 0x000000, 0x01C981 },
+    { 0x0FF83, 0x000000, 0x01C9A1 },
+    { 0x0FF84, 0x000000, 0x01C9C1 },
+    { 0x0FF85, 0x000000, 0x01C9E1 },
+    { 0x0FF86, 0x000000, 0x01CA01 },
+    { 0x0FF87, 0x000000, 0x01CA21 },
+    { 0x0FF88, 0x000000, 0x01CA41 },
+    { 0x0FF89, 0x000000, 0x01CA61 },
+    { 0x0FF8A, 0x000000, 0x01CA81 },
+    { 0x0FF8B, 0x000000, 0x01CAA1 },
+    { 0x0FF8C, 0x000000, 0x01CAC1 },
+    { 0x0FF8D, 0x000000, 0x01CAE1 },
+    { 0x0FF8E, 0x000000, 0x01CB01 },
+    { 0x0FF8F, 0x000000, 0x01CB21 },
+    { 0x0FF90, 0x000000, 0x01CB41 },
+    { 0x0FF91, 0x000000, 0x01CB61 },
+    { 0x0FF92, 0x000000, 0x01CB81 },
+    { 0x0FF93, 0x000000, 0x01CBA1 },
+    { 0x0FF94, 0x000000, 0x01CBC1 },
+    { 0x0FF95, 0x000000, 0x01CBE1 },
+    { 0x0FF96, 0x000000, 0x01CC01 },
+    { 0x0FF97, 0x000000, 0x01CC21 },
+    { 0x0FF98, 0x000000, 0x01CC41 },
+    { 0x0FF99, 0x000000, 0x01CC61 },
+    { 0x0FF9A, 0x000000, 0x01CC81 },
+    { 0x0FF9B, 0x000000, 0x01CCA1 },
+    { 0x0FF9C, 0x000000, 0x01CCC1 },
+    { 0x0FF9D, 0x000000, 0x02DBE1 },
+    { 0x0FF9E, 0x000000, 0x02DC01 },
+    { 0x0FF9F, 0x000000, 0x02DC21 },
+    { 0x0FFA0, 0x000000, 0x018F21 },
+    { 0x0FFA1, 0x000000, 0x0188C1 },
+    { 0x0FFA2, 0x000000, 0x0188E1 },
+    { 0x0FFA3, 0x000000, 0x018901 },
+    { 0x0FFA4, 0x000000, 0x018921 },
+    { 0x0FFA5, 0x000000, 0x018941 },
+    { 0x0FFA6, 0x000000, 0x018961 },
+    { 0x0FFA7, 0x000000, 0x018981 },
+    { 0x0FFA8, 0x000000, 0x0189A1 },
+    { 0x0FFA9, 0x000000, 0x0189C1 },
+    { 0x0FFAA, 0x000000, 0x0189E1 },
+    { 0x0FFAB, 0x000000, 0x018A01 },
+    { 0x0FFAC, 0x000000, 0x018A21 },
+    { 0x0FFAD, 0x000000, 0x018A41 },
+    { 0x0FFAE, 0x000000, 0x018A61 },
+    { 0x0FFAF, 0x000000, 0x018A81 },
+    { 0x0FFB0, 0x000000, 0x018AA1 },
+    { 0x0FFB1, 0x000000, 0x018AC1 },
+    { 0x0FFB2, 0x000000, 0x018AE1 },
+    { 0x0FFB3, 0x000000, 0x018B01 },
+    { 0x0FFB4, 0x000000, 0x018B21 },
+    { 0x0FFB5, 0x000000, 0x018B41 },
+    { 0x0FFB6, 0x000000, 0x018B61 },
+    { 0x0FFB7, 0x000000, 0x018B81 },
+    { 0x0FFB8, 0x000000, 0x018BA1 },
+    { 0x0FFB9, 0x000000, 0x018BC1 },
+    { 0x0FFBA, 0x000000, 0x018BE1 },
+    { 0x0FFBB, 0x000000, 0x018C01 },
+    { 0x0FFBC, 0x000000, 0x018C21 },
+    { 0x0FFBD, 0x000000, 0x018C41 },
+    { 0x0FFBE, 0x000000, 0x018C61 },
+    { 0x0FFC2, 0x000000, 0x018C81 },
+    { 0x0FFC3, 0x000000, 0x018CA1 },
+    { 0x0FFC4, 0x000000, 0x018CC1 },
+    { 0x0FFC5, 0x000000, 0x018CE1 },
+    { 0x0FFC6, 0x000000, 0x018D01 },
+    { 0x0FFC7, 0x000000, 0x018D21 },
+    { 0x0FFCA, 0x000000, 0x018D41 },
+    { 0x0FFCB, 0x000000, 0x018D61 },
+    { 0x0FFCC, 0x000000, 0x018D81 },
+    { 0x0FFCD, 0x000000, 0x018DA1 },
+    { 0x0FFCE, 0x000000, 0x018DC1 },
+    { 0x0FFCF, 0x000000, 0x018DE1 },
+    { 0x0FFD2, 0x000000, 0x018E01 },
+    { 0x0FFD3, 0x000000, 0x018E21 },
+    { 0x0FFD4, 0x000000, 0x018E41 },
+    { 0x0FFD5, 0x000000, 0x018E61 },
+    { 0x0FFD6, 0x000000, 0x018E81 },
+    { 0x0FFD7, 0x000000, 0x018EA1 },
+    { 0x0FFDA, 0x000000, 0x018EC1 },
+    { 0x0FFDB, 0x000000, 0x018EE1 },
+    { 0x0FFDC, 0x000000, 0x018F01 },
+    { 0x0FFE0, 0x000000, 0x02DC41 },
+    { 0x0FFE1, 0x000000, 0x02DC61 },
+    { 0x0FFE2, 0x000000, 0x02DC81 },
+    { 0x0FFE3, 0x000000, 0x000082 },
+    { 0x0FFE4, 0x000000, 0x02DCA1 },
+    { 0x0FFE5, 0x000000, 0x02DCC1 },
+    { 0x0FFE6, 0x000000, 0x02DCE1 },
+    { 0x0FFE8, 0x000000, 0x02DD01 },
+    { 0x0FFE9, 0x000000, 0x02DD21 },
+    { 0x0FFEA, 0x000000, 0x02DD41 },
+    { 0x0FFEB, 0x000000, 0x02DD61 },
+    { 0x0FFEC, 0x000000, 0x02DD81 },
+    { 0x0FFED, 0x000000, 0x02DDA1 },
+    { 0x0FFEE, 0x000000, 0x02DDC1 },
+    { 0x10781, 0x000000, 0x02DDE1 },
+    { 0x10782, 0x000000, 0x02DE01 },
+    { 0x10783, 0x000000, 0x02DE21 },
+    { 0x10784, 0x000000, 0x02DE41 },
+    { 0x10785, 0x000000, 0x02DE61 },
+    { 0x10787, 0x000000, 0x02DE81 },
+    { 0x10788, 0x000000, 0x02DEA1 },
+    { 0x10789, 0x000000, 0x02DEC1 },
+    { 0x1078A, 0x000000, 0x02DEE1 },
+    { 0x1078B, 0x000000, 0x02DF01 },
+    { 0x1078C, 0x000000, 0x02DF21 },
+    { 0x1078D, 0x000000, 0x02DF41 },
+    { 0x1078E, 0x000000, 0x02DF61 },
+    { 0x1078F, 0x000000, 0x02DF81 },
+    { 0x10790, 0x000000, 0x02DFA1 },
+    { 0x10791, 0x000000, 0x02DFC1 },
+    { 0x10792, 0x000000, 0x02DFE1 },
+    { 0x10793, 0x000000, 0x02E001 },
+    { 0x10794, 0x000000, 0x02E021 },
+    { 0x10795, 0x000000, 0x012401 },
+    { 0x10796, 0x000000, 0x02E041 },
+    { 0x10797, 0x000000, 0x02E061 },
+    { 0x10798, 0x000000, 0x02E081 },
+    { 0x10799, 0x000000, 0x02E0A1 },
+    { 0x1079A, 0x000000, 0x02E0C1 },
+    { 0x1079B, 0x000000, 0x02E0E1 },
+    { 0x1079C, 0x000000, 0x02E101 },
+    { 0x1079D, 0x000000, 0x02E121 },
+    { 0x1079E, 0x000000, 0x02E141 },
+    { 0x1079F, 0x000000, 0x02E161 },
+    { 0x107A0, 0x000000, 0x02E181 },
+    { 0x107A1, 0x000000, 0x02E1A1 },
+    { 0x107A2, 0x000000, 0x02E1C1 },
+    { 0x107A3, 0x000000, 0x02E1E1 },
+    { 0x107A4, 0x000000, 0x02E201 },
+    { 0x107A5, 0x000000, 0x015BE1 },
+    { 0x107A6, 0x000000, 0x02E221 },
+    { 0x107A7, 0x000000, 0x02E241 },
+    { 0x107A8, 0x000000, 0x02E261 },
+    { 0x107A9, 0x000000, 0x02E281 },
+    { 0x107AA, 0x000000, 0x02E2A1 },
+    { 0x107AB, 0x000000, 0x02E2C1 },
+    { 0x107AC, 0x000000, 0x02E2E1 },
+    { 0x107AD, 0x000000, 0x02E301 },
+    { 0x107AE, 0x000000, 0x02E321 },
+    { 0x107AF, 0x000000, 0x02E341 },
+    { 0x107B0, 0x000000, 0x02E361 },
+    { 0x107B2, 0x000000, 0x02E381 },
+    { 0x107B3, 0x000000, 0x02E3A1 },
+    { 0x107B4, 0x000000, 0x02E3C1 },
+    { 0x107B5, 0x000000, 0x02E3E1 },
+    { 0x107B6, 0x000000, 0x02E401 },
+    { 0x107B7, 0x000000, 0x02E421 },
+    { 0x107B8, 0x000000, 0x02E441 },
+    { 0x107B9, 0x000000, 0x02E461 },
+    { 0x107BA, 0x000000, 0x02E481 },
+    { 0x1109A, 0x02E4A2, 0x02E4A2 },
+    { 0x1109C, 0x02E4E2, 0x02E4E2 },
+    { 0x110AB, 0x02E522, 0x02E522 },
+    { 0x1112E, 0x02E562, 0x02E562 },
+    { 0x1112F, 0x02E5A2, 0x02E5A2 },
+    { 0x1134B, 0x02E5E2, 0x02E5E2 },
+    { 0x1134C, 0x02E622, 0x02E622 },
+    { 0x114BB, 0x02E662, 0x02E662 },
+    { 0x114BC, 0x02E6A2, 0x02E6A2 },
+    { 0x114BE, 0x02E6E2, 0x02E6E2 },
+    { 0x115BA, 0x02E722, 0x02E722 },
+    { 0x115BB, 0x02E762, 0x02E762 },
+    { 0x11938, 0x02E7A2, 0x02E7A2 },
+    { 0x1D15E, 0x02E7E2, 0x02E7E2 },
+    { 0x1D15F, 0x02E822, 0x02E822 },
+    { 0x1D160, 0x02E863, 0x02E863 },
+    { 0x1D161, 0x02E8C3, 0x02E8C3 },
+    { 0x1D162, 0x02E923, 0x02E923 },
+    { 0x1D163, 0x02E983, 0x02E983 },
+    { 0x1D164, 0x02E9E3, 0x02E9E3 },
+    { 0x1D1BB, 0x02EA42, 0x02EA42 },
+    { 0x1D1BC, 0x02EA82, 0x02EA82 },
+    { 0x1D1BD, 0x02EAC3, 0x02EAC3 },
+    { 0x1D1BE, 0x02EB23, 0x02EB23 },
+    { 0x1D1BF, 0x02EB83, 0x02EB83 },
+    { 0x1D1C0, 0x02EBE3, 0x02EBE3 },
+    { 0x1D400, 0x000000, 0x007A61 },
+    { 0x1D401, 0x000000, 0x007AA1 },
+    { 0x1D402, 0x000000, 0x012281 },
+    { 0x1D403, 0x000000, 0x007AC1 },
+    { 0x1D404, 0x000000, 0x007AE1 },
+    { 0x1D405, 0x000000, 0x0125A1 },
+    { 0x1D406, 0x000000, 0x007B21 },
+    { 0x1D407, 0x000000, 0x007B41 },
+    { 0x1D408, 0x000000, 0x007B61 },
+    { 0x1D409, 0x000000, 0x007B81 },
+    { 0x1D40A, 0x000000, 0x007BA1 },
+    { 0x1D40B, 0x000000, 0x007BC1 },
+    { 0x1D40C, 0x000000, 0x007BE1 },
+    { 0x1D40D, 0x000000, 0x007C01 },
+    { 0x1D40E, 0x000000, 0x007C21 },
+    { 0x1D40F, 0x000000, 0x007C61 },
+    { 0x1D410, 0x000000, 0x012461 },
+    { 0x1D411, 0x000000, 0x007C81 },
+    { 0x1D412, 0x000000, 0x015BA1 },
+    { 0x1D413, 0x000000, 0x007CA1 },
+    { 0x1D414, 0x000000, 0x007CC1 },
+    { 0x1D415, 0x000000, 0x012DE1 },
+    { 0x1D416, 0x000000, 0x007CE1 },
+    { 0x1D417, 0x000000, 0x012F61 },
+    { 0x1D418, 0x000000, 0x015BC1 },
+    { 0x1D419, 0x000000, 0x012561 },
+    { 0x1D41A, 0x000000, 0x000061 },
+    { 0x1D41B, 0x000000, 0x007D61 },
+    { 0x1D41C, 0x000000, 0x0080A1 },
+    { 0x1D41D, 0x000000, 0x007D81 },
+    { 0x1D41E, 0x000000, 0x007DA1 },
+    { 0x1D41F, 0x000000, 0x008101 },
+    { 0x1D420, 0x000000, 0x007E21 },
+    { 0x1D421, 0x000000, 0x004981 },
+    { 0x1D422, 0x000000, 0x008041 },
+    { 0x1D423, 0x000000, 0x0049C1 },
+    { 0x1D424, 0x000000, 0x007E41 },
+    { 0x1D425, 0x000000, 0x004C41 },
+    { 0x1D426, 0x000000, 0x007E61 },
+    { 0x1D427, 0x000000, 0x012161 },
+    { 0x1D428, 0x000000, 0x0001C1 },
+    { 0x1D429, 0x000000, 0x007F01 },
+    { 0x1D42A, 0x000000, 0x015BE1 },
+    { 0x1D42B, 0x000000, 0x0049E1 },
+    { 0x1D42C, 0x000000, 0x002C81 },
+    { 0x1D42D, 0x000000, 0x007F21 },
+    { 0x1D42E, 0x000000, 0x007F41 },
+    { 0x1D42F, 0x000000, 0x007FA1 },
+    { 0x1D430, 0x000000, 0x004A61 },
+    { 0x1D431, 0x000000, 0x004C61 },
+    { 0x1D432, 0x000000, 0x004A81 },
+    { 0x1D433, 0x000000, 0x008461 },
+    { 0x1D434, 0x000000, 0x007A61 },
+    { 0x1D435, 0x000000, 0x007AA1 },
+    { 0x1D436, 0x000000, 0x012281 },
+    { 0x1D437, 0x000000, 0x007AC1 },
+    { 0x1D438, 0x000000, 0x007AE1 },
+    { 0x1D439, 0x000000, 0x0125A1 },
+    { 0x1D43A, 0x000000, 0x007B21 },
+    { 0x1D43B, 0x000000, 0x007B41 },
+    { 0x1D43C, 0x000000, 0x007B61 },
+    { 0x1D43D, 0x000000, 0x007B81 },
+    { 0x1D43E, 0x000000, 0x007BA1 },
+    { 0x1D43F, 0x000000, 0x007BC1 },
+    { 0x1D440, 0x000000, 0x007BE1 },
+    { 0x1D441, 0x000000, 0x007C01 },
+    { 0x1D442, 0x000000, 0x007C21 },
+    { 0x1D443, 0x000000, 0x007C61 },
+    { 0x1D444, 0x000000, 0x012461 },
+    { 0x1D445, 0x000000, 0x007C81 },
+    { 0x1D446, 0x000000, 0x015BA1 },
+    { 0x1D447, 0x000000, 0x007CA1 },
+    { 0x1D448, 0x000000, 0x007CC1 },
+    { 0x1D449, 0x000000, 0x012DE1 },
+    { 0x1D44A, 0x000000, 0x007CE1 },
+    { 0x1D44B, 0x000000, 0x012F61 },
+    { 0x1D44C, 0x000000, 0x015BC1 },
+    { 0x1D44D, 0x000000, 0x012561 },
+    { 0x1D44E, 0x000000, 0x000061 },
+    { 0x1D44F, 0x000000, 0x007D61 },
+    { 0x1D450, 0x000000, 0x0080A1 },
+    { 0x1D451, 0x000000, 0x007D81 },
+    { 0x1D452, 0x000000, 0x007DA1 },
+    { 0x1D453, 0x000000, 0x008101 },
+    { 0x1D454, 0x000000, 0x007E21 },
+    { 0x1D456, 0x000000, 0x008041 },
+    { 0x1D457, 0x000000, 0x0049C1 },
+    { 0x1D458, 0x000000, 0x007E41 },
+    { 0x1D459, 0x000000, 0x004C41 },
+    { 0x1D45A, 0x000000, 0x007E61 },
+    { 0x1D45B, 0x000000, 0x012161 },
+    { 0x1D45C, 0x000000, 0x0001C1 },
+    { 0x1D45D, 0x000000, 0x007F01 },
+    { 0x1D45E, 0x000000, 0x015BE1 },
+    { 0x1D45F, 0x000000, 0x0049E1 },
+    { 0x1D460, 0x000000, 0x002C81 },
+    { 0x1D461, 0x000000, 0x007F21 },
+    { 0x1D462, 0x000000, 0x007F41 },
+    { 0x1D463, 0x000000, 0x007FA1 },
+    { 0x1D464, 0x000000, 0x004A61 },
+    { 0x1D465, 0x000000, 0x004C61 },
+    { 0x1D466, 0x000000, 0x004A81 },
+    { 0x1D467, 0x000000, 0x008461 },
+    { 0x1D468, 0x000000, 0x007A61 },
+    { 0x1D469, 0x000000, 0x007AA1 },
+    { 0x1D46A, 0x000000, 0x012281 },
+    { 0x1D46B, 0x000000, 0x007AC1 },
+    { 0x1D46C, 0x000000, 0x007AE1 },
+    { 0x1D46D, 0x000000, 0x0125A1 },
+    { 0x1D46E, 0x000000, 0x007B21 },
+    { 0x1D46F, 0x000000, 0x007B41 },
+    { 0x1D470, 0x000000, 0x007B61 },
+    { 0x1D471, 0x000000, 0x007B81 },
+    { 0x1D472, 0x000000, 0x007BA1 },
+    { 0x1D473, 0x000000, 0x007BC1 },
+    { 0x1D474, 0x000000, 0x007BE1 },
+    { 0x1D475, 0x000000, 0x007C01 },
+    { 0x1D476, 0x000000, 0x007C21 },
+    { 0x1D477, 0x000000, 0x007C61 },
+    { 0x1D478, 0x000000, 0x012461 },
+    { 0x1D479, 0x000000, 0x007C81 },
+    { 0x1D47A, 0x000000, 0x015BA1 },
+    { 0x1D47B, 0x000000, 0x007CA1 },
+    { 0x1D47C, 0x000000, 0x007CC1 },
+    { 0x1D47D, 0x000000, 0x012DE1 },
+    { 0x1D47E, 0x000000, 0x007CE1 },
+    { 0x1D47F, 0x000000, 0x012F61 },
+    { 0x1D480, 0x000000, 0x015BC1 },
+    { 0x1D481, 0x000000, 0x012561 },
+    { 0x1D482, 0x000000, 0x000061 },
+    { 0x1D483, 0x000000, 0x007D61 },
+    { 0x1D484, 0x000000, 0x0080A1 },
+    { 0x1D485, 0x000000, 0x007D81 },
+    { 0x1D486, 0x000000, 0x007DA1 },
+    { 0x1D487, 0x000000, 0x008101 },
+    { 0x1D488, 0x000000, 0x007E21 },
+    { 0x1D489, 0x000000, 0x004981 },
+    { 0x1D48A, 0x000000, 0x008041 },
+    { 0x1D48B, 0x000000, 0x0049C1 },
+    { 0x1D48C, 0x000000, 0x007E41 },
+    { 0x1D48D, 0x000000, 0x004C41 },
+    { 0x1D48E, 0x000000, 0x007E61 },
+    { 0x1D48F, 0x000000, 0x012161 },
+    { 0x1D490, 0x000000, 0x0001C1 },
+    { 0x1D491, 0x000000, 0x007F01 },
+    { 0x1D492, 0x000000, 0x015BE1 },
+    { 0x1D493, 0x000000, 0x0049E1 },
+    { 0x1D494, 0x000000, 0x002C81 },
+    { 0x1D495, 0x000000, 0x007F21 },
+    { 0x1D496, 0x000000, 0x007F41 },
+    { 0x1D497, 0x000000, 0x007FA1 },
+    { 0x1D498, 0x000000, 0x004A61 },
+    { 0x1D499, 0x000000, 0x004C61 },
+    { 0x1D49A, 0x000000, 0x004A81 },
+    { 0x1D49B, 0x000000, 0x008461 },
+    { 0x1D49C, 0x000000, 0x007A61 },
+    { 0x1D49E, 0x000000, 0x012281 },
+    { 0x1D49F, 0x000000, 0x007AC1 },
+    { 0x1D4A2, 0x000000, 0x007B21 },
+    { 0x1D4A5, 0x000000, 0x007B81 },
+    { 0x1D4A6, 0x000000, 0x007BA1 },
+    { 0x1D4A9, 0x000000, 0x007C01 },
+    { 0x1D4AA, 0x000000, 0x007C21 },
+    { 0x1D4AB, 0x000000, 0x007C61 },
+    { 0x1D4AC, 0x000000, 0x012461 },
+    { 0x1D4AE, 0x000000, 0x015BA1 },
+    { 0x1D4AF, 0x000000, 0x007CA1 },
+    { 0x1D4B0, 0x000000, 0x007CC1 },
+    { 0x1D4B1, 0x000000, 0x012DE1 },
+    { 0x1D4B2, 0x000000, 0x007CE1 },
+    { 0x1D4B3, 0x000000, 0x012F61 },
+    { 0x1D4B4, 0x000000, 0x015BC1 },
+    { 0x1D4B5, 0x000000, 0x012561 },
+    { 0x1D4B6, 0x000000, 0x000061 },
+    { 0x1D4B7, 0x000000, 0x007D61 },
+    { 0x1D4B8, 0x000000, 0x0080A1 },
+    { 0x1D4B9, 0x000000, 0x007D81 },
+    { 0x1D4BB, 0x000000, 0x008101 },
+    { 0x1D4BD, 0x000000, 0x004981 },
+    { 0x1D4BE, 0x000000, 0x008041 },
+    { 0x1D4BF, 0x000000, 0x0049C1 },
+    { 0x1D4C0, 0x000000, 0x007E41 },
+    { 0x1D4C1, 0x000000, 0x004C41 },
+    { 0x1D4C2, 0x000000, 0x007E61 },
+    { 0x1D4C3, 0x000000, 0x012161 },
+    { 0x1D4C5, 0x000000, 0x007F01 },
+    { 0x1D4C6, 0x000000, 0x015BE1 },
+    { 0x1D4C7, 0x000000, 0x0049E1 },
+    { 0x1D4C8, 0x000000, 0x002C81 },
+    { 0x1D4C9, 0x000000, 0x007F21 },
+    { 0x1D4CA, 0x000000, 0x007F41 },
+    { 0x1D4CB, 0x000000, 0x007FA1 },
+    { 0x1D4CC, 0x000000, 0x004A61 },
+    { 0x1D4CD, 0x000000, 0x004C61 },
+    { 0x1D4CE, 0x000000, 0x004A81 },
+    { 0x1D4CF, 0x000000, 0x008461 },
+    { 0x1D4D0, 0x000000, 0x007A61 },
+    { 0x1D4D1, 0x000000, 0x007AA1 },
+    { 0x1D4D2, 0x000000, 0x012281 },
+    { 0x1D4D3, 0x000000, 0x007AC1 },
+    { 0x1D4D4, 0x000000, 0x007AE1 },
+    { 0x1D4D5, 0x000000, 0x0125A1 },
+    { 0x1D4D6, 0x000000, 0x007B21 },
+    { 0x1D4D7, 0x000000, 0x007B41 },
+    { 0x1D4D8, 0x000000, 0x007B61 },
+    { 0x1D4D9, 0x000000, 0x007B81 },
+    { 0x1D4DA, 0x000000, 0x007BA1 },
+    { 0x1D4DB, 0x000000, 0x007BC1 },
+    { 0x1D4DC, 0x000000, 0x007BE1 },
+    { 0x1D4DD, 0x000000, 0x007C01 },
+    { 0x1D4DE, 0x000000, 0x007C21 },
+    { 0x1D4DF, 0x000000, 0x007C61 },
+    { 0x1D4E0, 0x000000, 0x012461 },
+    { 0x1D4E1, 0x000000, 0x007C81 },
+    { 0x1D4E2, 0x000000, 0x015BA1 },
+    { 0x1D4E3, 0x000000, 0x007CA1 },
+    { 0x1D4E4, 0x000000, 0x007CC1 },
+    { 0x1D4E5, 0x000000, 0x012DE1 },
+    { 0x1D4E6, 0x000000, 0x007CE1 },
+    { 0x1D4E7, 0x000000, 0x012F61 },
+    { 0x1D4E8, 0x000000, 0x015BC1 },
+    { 0x1D4E9, 0x000000, 0x012561 },
+    { 0x1D4EA, 0x000000, 0x000061 },
+    { 0x1D4EB, 0x000000, 0x007D61 },
+    { 0x1D4EC, 0x000000, 0x0080A1 },
+    { 0x1D4ED, 0x000000, 0x007D81 },
+    { 0x1D4EE, 0x000000, 0x007DA1 },
+    { 0x1D4EF, 0x000000, 0x008101 },
+    { 0x1D4F0, 0x000000, 0x007E21 },
+    { 0x1D4F1, 0x000000, 0x004981 },
+    { 0x1D4F2, 0x000000, 0x008041 },
+    { 0x1D4F3, 0x000000, 0x0049C1 },
+    { 0x1D4F4, 0x000000, 0x007E41 },
+    { 0x1D4F5, 0x000000, 0x004C41 },
+    { 0x1D4F6, 0x000000, 0x007E61 },
+    { 0x1D4F7, 0x000000, 0x012161 },
+    { 0x1D4F8, 0x000000, 0x0001C1 },
+    { 0x1D4F9, 0x000000, 0x007F01 },
+    { 0x1D4FA, 0x000000, 0x015BE1 },
+    { 0x1D4FB, 0x000000, 0x0049E1 },
+    { 0x1D4FC, 0x000000, 0x002C81 },
+    { 0x1D4FD, 0x000000, 0x007F21 },
+    { 0x1D4FE, 0x000000, 0x007F41 },
+    { 0x1D4FF, 0x000000, 0x007FA1 },
+    { 0x1D500, 0x000000, 0x004A61 },
+    { 0x1D501, 0x000000, 0x004C61 },
+    { 0x1D502, 0x000000, 0x004A81 },
+    { 0x1D503, 0x000000, 0x008461 },
+    { 0x1D504, 0x000000, 0x007A61 },
+    { 0x1D505, 0x000000, 0x007AA1 },
+    { 0x1D507, 0x000000, 0x007AC1 },
+    { 0x1D508, 0x000000, 0x007AE1 },
+    { 0x1D509, 0x000000, 0x0125A1 },
+    { 0x1D50A, 0x000000, 0x007B21 },
+    { 0x1D50D, 0x000000, 0x007B81 },
+    { 0x1D50E, 0x000000, 0x007BA1 },
+    { 0x1D50F, 0x000000, 0x007BC1 },
+    { 0x1D510, 0x000000, 0x007BE1 },
+    { 0x1D511, 0x000000, 0x007C01 },
+    { 0x1D512, 0x000000, 0x007C21 },
+    { 0x1D513, 0x000000, 0x007C61 },
+    { 0x1D514, 0x000000, 0x012461 },
+    { 0x1D516, 0x000000, 0x015BA1 },
+    { 0x1D517, 0x000000, 0x007CA1 },
+    { 0x1D518, 0x000000, 0x007CC1 },
+    { 0x1D519, 0x000000, 0x012DE1 },
+    { 0x1D51A, 0x000000, 0x007CE1 },
+    { 0x1D51B, 0x000000, 0x012F61 },
+    { 0x1D51C, 0x000000, 0x015BC1 },
+    { 0x1D51E, 0x000000, 0x000061 },
+    { 0x1D51F, 0x000000, 0x007D61 },
+    { 0x1D520, 0x000000, 0x0080A1 },
+    { 0x1D521, 0x000000, 0x007D81 },
+    { 0x1D522, 0x000000, 0x007DA1 },
+    { 0x1D523, 0x000000, 0x008101 },
+    { 0x1D524, 0x000000, 0x007E21 },
+    { 0x1D525, 0x000000, 0x004981 },
+    { 0x1D526, 0x000000, 0x008041 },
+    { 0x1D527, 0x000000, 0x0049C1 },
+    { 0x1D528, 0x000000, 0x007E41 },
+    { 0x1D529, 0x000000, 0x004C41 },
+    { 0x1D52A, 0x000000, 0x007E61 },
+    { 0x1D52B, 0x000000, 0x012161 },
+    { 0x1D52C, 0x000000, 0x0001C1 },
+    { 0x1D52D, 0x000000, 0x007F01 },
+    { 0x1D52E, 0x000000, 0x015BE1 },
+    { 0x1D52F, 0x000000, 0x0049E1 },
+    { 0x1D530, 0x000000, 0x002C81 },
+    { 0x1D531, 0x000000, 0x007F21 },
+    { 0x1D532, 0x000000, 0x007F41 },
+    { 0x1D533, 0x000000, 0x007FA1 },
+    { 0x1D534, 0x000000, 0x004A61 },
+    { 0x1D535, 0x000000, 0x004C61 },
+    { 0x1D536, 0x000000, 0x004A81 },
+    { 0x1D537, 0x000000, 0x008461 },
+    { 0x1D538, 0x000000, 0x007A61 },
+    { 0x1D539, 0x000000, 0x007AA1 },
+    { 0x1D53B, 0x000000, 0x007AC1 },
+    { 0x1D53C, 0x000000, 0x007AE1 },
+    { 0x1D53D, 0x000000, 0x0125A1 },
+    { 0x1D53E, 0x000000, 0x007B21 },
+    { 0x1D540, 0x000000, 0x007B61 },
+    { 0x1D541, 0x000000, 0x007B81 },
+    { 0x1D542, 0x000000, 0x007BA1 },
+    { 0x1D543, 0x000000, 0x007BC1 },
+    { 0x1D544, 0x000000, 0x007BE1 },
+    { 0x1D546, 0x000000, 0x007C21 },
+    { 0x1D54A, 0x000000, 0x015BA1 },
+    { 0x1D54B, 0x000000, 0x007CA1 },
+    { 0x1D54C, 0x000000, 0x007CC1 },
+    { 0x1D54D, 0x000000, 0x012DE1 },
+    { 0x1D54E, 0x000000, 0x007CE1 },
+    { 0x1D54F, 0x000000, 0x012F61 },
+    { 0x1D550, 0x000000, 0x015BC1 },
+    { 0x1D552, 0x000000, 0x000061 },
+    { 0x1D553, 0x000000, 0x007D61 },
+    { 0x1D554, 0x000000, 0x0080A1 },
+    { 0x1D555, 0x000000, 0x007D81 },
+    { 0x1D556, 0x000000, 0x007DA1 },
+    { 0x1D557, 0x000000, 0x008101 },
+    { 0x1D558, 0x000000, 0x007E21 },
+    { 0x1D559, 0x000000, 0x004981 },
+    { 0x1D55A, 0x000000, 0x008041 },
+    { 0x1D55B, 0x000000, 0x0049C1 },
+    { 0x1D55C, 0x000000, 0x007E41 },
+    { 0x1D55D, 0x000000, 0x004C41 },
+    { 0x1D55E, 0x000000, 0x007E61 },
+    { 0x1D55F, 0x000000, 0x012161 },
+    { 0x1D560, 0x000000, 0x0001C1 },
+    { 0x1D561, 0x000000, 0x007F01 },
+    { 0x1D562, 0x000000, 0x015BE1 },
+    { 0x1D563, 0x000000, 0x0049E1 },
+    { 0x1D564, 0x000000, 0x002C81 },
+    { 0x1D565, 0x000000, 0x007F21 },
+    { 0x1D566, 0x000000, 0x007F41 },
+    { 0x1D567, 0x000000, 0x007FA1 },
+    { 0x1D568, 0x000000, 0x004A61 },
+    { 0x1D569, 0x000000, 0x004C61 },
+    { 0x1D56A, 0x000000, 0x004A81 },
+    { 0x1D56B, 0x000000, 0x008461 },
+    { 0x1D56C, 0x000000, 0x007A61 },
+    { 0x1D56D, 0x000000, 0x007AA1 },
+    { 0x1D56E, 0x000000, 0x012281 },
+    { 0x1D56F, 0x000000, 0x007AC1 },
+    { 0x1D570, 0x000000, 0x007AE1 },
+    { 0x1D571, 0x000000, 0x0125A1 },
+    { 0x1D572, 0x000000, 0x007B21 },
+    { 0x1D573, 0x000000, 0x007B41 },
+    { 0x1D574, 0x000000, 0x007B61 },
+    { 0x1D575, 0x000000, 0x007B81 },
+    { 0x1D576, 0x000000, 0x007BA1 },
+    { 0x1D577, 0x000000, 0x007BC1 },
+    { 0x1D578, 0x000000, 0x007BE1 },
+    { 0x1D579, 0x000000, 0x007C01 },
+    { 0x1D57A, 0x000000, 0x007C21 },
+    { 0x1D57B, 0x000000, 0x007C61 },
+    { 0x1D57C, 0x000000, 0x012461 },
+    { 0x1D57D, 0x000000, 0x007C81 },
+    { 0x1D57E, 0x000000, 0x015BA1 },
+    { 0x1D57F, 0x000000, 0x007CA1 },
+    { 0x1D580, 0x000000, 0x007CC1 },
+    { 0x1D581, 0x000000, 0x012DE1 },
+    { 0x1D582, 0x000000, 0x007CE1 },
+    { 0x1D583, 0x000000, 0x012F61 },
+    { 0x1D584, 0x000000, 0x015BC1 },
+    { 0x1D585, 0x000000, 0x012561 },
+    { 0x1D586, 0x000000, 0x000061 },
+    { 0x1D587, 0x000000, 0x007D61 },
+    { 0x1D588, 0x000000, 0x0080A1 },
+    { 0x1D589, 0x000000, 0x007D81 },
+    { 0x1D58A, 0x000000, 0x007DA1 },
+    { 0x1D58B, 0x000000, 0x008101 },
+    { 0x1D58C, 0x000000, 0x007E21 },
+    { 0x1D58D, 0x000000, 0x004981 },
+    { 0x1D58E, 0x000000, 0x008041 },
+    { 0x1D58F, 0x000000, 0x0049C1 },
+    { 0x1D590, 0x000000, 0x007E41 },
+    { 0x1D591, 0x000000, 0x004C41 },
+    { 0x1D592, 0x000000, 0x007E61 },
+    { 0x1D593, 0x000000, 0x012161 },
+    { 0x1D594, 0x000000, 0x0001C1 },
+    { 0x1D595, 0x000000, 0x007F01 },
+    { 0x1D596, 0x000000, 0x015BE1 },
+    { 0x1D597, 0x000000, 0x0049E1 },
+    { 0x1D598, 0x000000, 0x002C81 },
+    { 0x1D599, 0x000000, 0x007F21 },
+    { 0x1D59A, 0x000000, 0x007F41 },
+    { 0x1D59B, 0x000000, 0x007FA1 },
+    { 0x1D59C, 0x000000, 0x004A61 },
+    { 0x1D59D, 0x000000, 0x004C61 },
+    { 0x1D59E, 0x000000, 0x004A81 },
+    { 0x1D59F, 0x000000, 0x008461 },
+    { 0x1D5A0, 0x000000, 0x007A61 },
+    { 0x1D5A1, 0x000000, 0x007AA1 },
+    { 0x1D5A2, 0x000000, 0x012281 },
+    { 0x1D5A3, 0x000000, 0x007AC1 },
+    { 0x1D5A4, 0x000000, 0x007AE1 },
+    { 0x1D5A5, 0x000000, 0x0125A1 },
+    { 0x1D5A6, 0x000000, 0x007B21 },
+    { 0x1D5A7, 0x000000, 0x007B41 },
+    { 0x1D5A8, 0x000000, 0x007B61 },
+    { 0x1D5A9, 0x000000, 0x007B81 },
+    { 0x1D5AA, 0x000000, 0x007BA1 },
+    { 0x1D5AB, 0x000000, 0x007BC1 },
+    { 0x1D5AC, 0x000000, 0x007BE1 },
+    { 0x1D5AD, 0x000000, 0x007C01 },
+    { 0x1D5AE, 0x000000, 0x007C21 },
+    { 0x1D5AF, 0x000000, 0x007C61 },
+    { 0x1D5B0, 0x000000, 0x012461 },
+    { 0x1D5B1, 0x000000, 0x007C81 },
+    { 0x1D5B2, 0x000000, 0x015BA1 },
+    { 0x1D5B3, 0x000000, 0x007CA1 },
+    { 0x1D5B4, 0x000000, 0x007CC1 },
+    { 0x1D5B5, 0x000000, 0x012DE1 },
+    { 0x1D5B6, 0x000000, 0x007CE1 },
+    { 0x1D5B7, 0x000000, 0x012F61 },
+    { 0x1D5B8, 0x000000, 0x015BC1 },
+    { 0x1D5B9, 0x000000, 0x012561 },
+    { 0x1D5BA, 0x000000, 0x000061 },
+    { 0x1D5BB, 0x000000, 0x007D61 },
+    { 0x1D5BC, 0x000000, 0x0080A1 },
+    { 0x1D5BD, 0x000000, 0x007D81 },
+    { 0x1D5BE, 0x000000, 0x007DA1 },
+    { 0x1D5BF, 0x000000, 0x008101 },
+    { 0x1D5C0, 0x000000, 0x007E21 },
+    { 0x1D5C1, 0x000000, 0x004981 },
+    { 0x1D5C2, 0x000000, 0x008041 },
+    { 0x1D5C3, 0x000000, 0x0049C1 },
+    { 0x1D5C4, 0x000000, 0x007E41 },
+    { 0x1D5C5, 0x000000, 0x004C41 },
+    { 0x1D5C6, 0x000000, 0x007E61 },
+    { 0x1D5C7, 0x000000, 0x012161 },
+    { 0x1D5C8, 0x000000, 0x0001C1 },
+    { 0x1D5C9, 0x000000, 0x007F01 },
+    { 0x1D5CA, 0x000000, 0x015BE1 },
+    { 0x1D5CB, 0x000000, 0x0049E1 },
+    { 0x1D5CC, 0x000000, 0x002C81 },
+    { 0x1D5CD, 0x000000, 0x007F21 },
+    { 0x1D5CE, 0x000000, 0x007F41 },
+    { 0x1D5CF, 0x000000, 0x007FA1 },
+    { 0x1D5D0, 0x000000, 0x004A61 },
+    { 0x1D5D1, 0x000000, 0x004C61 },
+    { 0x1D5D2, 0x000000, 0x004A81 },
+    { 0x1D5D3, 0x000000, 0x008461 },
+    { 0x1D5D4, 0x000000, 0x007A61 },
+    { 0x1D5D5, 0x000000, 0x007AA1 },
+    { 0x1D5D6, 0x000000, 0x012281 },
+    { 0x1D5D7, 0x000000, 0x007AC1 },
+    { 0x1D5D8, 0x000000, 0x007AE1 },
+    { 0x1D5D9, 0x000000, 0x0125A1 },
+    { 0x1D5DA, 0x000000, 0x007B21 },
+    { 0x1D5DB, 0x000000, 0x007B41 },
+    { 0x1D5DC, 0x000000, 0x007B61 },
+    { 0x1D5DD, 0x000000, 0x007B81 },
+    { 0x1D5DE, 0x000000, 0x007BA1 },
+    { 0x1D5DF, 0x000000, 0x007BC1 },
+    { 0x1D5E0, 0x000000, 0x007BE1 },
+    { 0x1D5E1, 0x000000, 0x007C01 },
+    { 0x1D5E2, 0x000000, 0x007C21 },
+    { 0x1D5E3, 0x000000, 0x007C61 },
+    { 0x1D5E4, 0x000000, 0x012461 },
+    { 0x1D5E5, 0x000000, 0x007C81 },
+    { 0x1D5E6, 0x000000, 0x015BA1 },
+    { 0x1D5E7, 0x000000, 0x007CA1 },
+    { 0x1D5E8, 0x000000, 0x007CC1 },
+    { 0x1D5E9, 0x000000, 0x012DE1 },
+    { 0x1D5EA, 0x000000, 0x007CE1 },
+    { 0x1D5EB, 0x000000, 0x012F61 },
+    { 0x1D5EC, 0x000000, 0x015BC1 },
+    { 0x1D5ED, 0x000000, 0x012561 },
+    { 0x1D5EE, 0x000000, 0x000061 },
+    { 0x1D5EF, 0x000000, 0x007D61 },
+    { 0x1D5F0, 0x000000, 0x0080A1 },
+    { 0x1D5F1, 0x000000, 0x007D81 },
+    { 0x1D5F2, 0x000000, 0x007DA1 },
+    { 0x1D5F3, 0x000000, 0x008101 },
+    { 0x1D5F4, 0x000000, 0x007E21 },
+    { 0x1D5F5, 0x000000, 0x004981 },
+    { 0x1D5F6, 0x000000, 0x008041 },
+    { 0x1D5F7, 0x000000, 0x0049C1 },
+    { 0x1D5F8, 0x000000, 0x007E41 },
+    { 0x1D5F9, 0x000000, 0x004C41 },
+    { 0x1D5FA, 0x000000, 0x007E61 },
+    { 0x1D5FB, 0x000000, 0x012161 },
+    { 0x1D5FC, 0x000000, 0x0001C1 },
+    { 0x1D5FD, 0x000000, 0x007F01 },
+    { 0x1D5FE, 0x000000, 0x015BE1 },
+    { 0x1D5FF, 0x000000, 0x0049E1 },
+    { 0x1D600, 0x000000, 0x002C81 },
+    { 0x1D601, 0x000000, 0x007F21 },
+    { 0x1D602, 0x000000, 0x007F41 },
+    { 0x1D603, 0x000000, 0x007FA1 },
+    { 0x1D604, 0x000000, 0x004A61 },
+    { 0x1D605, 0x000000, 0x004C61 },
+    { 0x1D606, 0x000000, 0x004A81 },
+    { 0x1D607, 0x000000, 0x008461 },
+    { 0x1D608, 0x000000, 0x007A61 },
+    { 0x1D609, 0x000000, 0x007AA1 },
+    { 0x1D60A, 0x000000, 0x012281 },
+    { 0x1D60B, 0x000000, 0x007AC1 },
+    { 0x1D60C, 0x000000, 0x007AE1 },
+    { 0x1D60D, 0x000000, 0x0125A1 },
+    { 0x1D60E, 0x000000, 0x007B21 },
+    { 0x1D60F, 0x000000, 0x007B41 },
+    { 0x1D610, 0x000000, 0x007B61 },
+    { 0x1D611, 0x000000, 0x007B81 },
+    { 0x1D612, 0x000000, 0x007BA1 },
+    { 0x1D613, 0x000000, 0x007BC1 },
+    { 0x1D614, 0x000000, 0x007BE1 },
+    { 0x1D615, 0x000000, 0x007C01 },
+    { 0x1D616, 0x000000, 0x007C21 },
+    { 0x1D617, 0x000000, 0x007C61 },
+    { 0x1D618, 0x000000, 0x012461 },
+    { 0x1D619, 0x000000, 0x007C81 },
+    { 0x1D61A, 0x000000, 0x015BA1 },
+    { 0x1D61B, 0x000000, 0x007CA1 },
+    { 0x1D61C, 0x000000, 0x007CC1 },
+    { 0x1D61D, 0x000000, 0x012DE1 },
+    { 0x1D61E, 0x000000, 0x007CE1 },
+    { 0x1D61F, 0x000000, 0x012F61 },
+    { 0x1D620, 0x000000, 0x015BC1 },
+    { 0x1D621, 0x000000, 0x012561 },
+    { 0x1D622, 0x000000, 0x000061 },
+    { 0x1D623, 0x000000, 0x007D61 },
+    { 0x1D624, 0x000000, 0x0080A1 },
+    { 0x1D625, 0x000000, 0x007D81 },
+    { 0x1D626, 0x000000, 0x007DA1 },
+    { 0x1D627, 0x000000, 0x008101 },
+    { 0x1D628, 0x000000, 0x007E21 },
+    { 0x1D629, 0x000000, 0x004981 },
+    { 0x1D62A, 0x000000, 0x008041 },
+    { 0x1D62B, 0x000000, 0x0049C1 },
+    { 0x1D62C, 0x000000, 0x007E41 },
+    { 0x1D62D, 0x000000, 0x004C41 },
+    { 0x1D62E, 0x000000, 0x007E61 },
+    { 0x1D62F, 0x000000, 0x012161 },
+    { 0x1D630, 0x000000, 0x0001C1 },
+    { 0x1D631, 0x000000, 0x007F01 },
+    { 0x1D632, 0x000000, 0x015BE1 },
+    { 0x1D633, 0x000000, 0x0049E1 },
+    { 0x1D634, 0x000000, 0x002C81 },
+    { 0x1D635, 0x000000, 0x007F21 },
+    { 0x1D636, 0x000000, 0x007F41 },
+    { 0x1D637, 0x000000, 0x007FA1 },
+    { 0x1D638, 0x000000, 0x004A61 },
+    { 0x1D639, 0x000000, 0x004C61 },
+    { 0x1D63A, 0x000000, 0x004A81 },
+    { 0x1D63B, 0x000000, 0x008461 },
+    { 0x1D63C, 0x000000, 0x007A61 },
+    { 0x1D63D, 0x000000, 0x007AA1 },
+    { 0x1D63E, 0x000000, 0x012281 },
+    { 0x1D63F, 0x000000, 0x007AC1 },
+    { 0x1D640, 0x000000, 0x007AE1 },
+    { 0x1D641, 0x000000, 0x0125A1 },
+    { 0x1D642, 0x000000, 0x007B21 },
+    { 0x1D643, 0x000000, 0x007B41 },
+    { 0x1D644, 0x000000, 0x007B61 },
+    { 0x1D645, 0x000000, 0x007B81 },
+    { 0x1D646, 0x000000, 0x007BA1 },
+    { 0x1D647, 0x000000, 0x007BC1 },
+    { 0x1D648, 0x000000, 0x007BE1 },
+    { 0x1D649, 0x000000, 0x007C01 },
+    { 0x1D64A, 0x000000, 0x007C21 },
+    { 0x1D64B, 0x000000, 0x007C61 },
+    { 0x1D64C, 0x000000, 0x012461 },
+    { 0x1D64D, 0x000000, 0x007C81 },
+    { 0x1D64E, 0x000000, 0x015BA1 },
+    { 0x1D64F, 0x000000, 0x007CA1 },
+    { 0x1D650, 0x000000, 0x007CC1 },
+    { 0x1D651, 0x000000, 0x012DE1 },
+    { 0x1D652, 0x000000, 0x007CE1 },
+    { 0x1D653, 0x000000, 0x012F61 },
+    { 0x1D654, 0x000000, 0x015BC1 },
+    { 0x1D655, 0x000000, 0x012561 },
+    { 0x1D656, 0x000000, 0x000061 },
+    { 0x1D657, 0x000000, 0x007D61 },
+    { 0x1D658, 0x000000, 0x0080A1 },
+    { 0x1D659, 0x000000, 0x007D81 },
+    { 0x1D65A, 0x000000, 0x007DA1 },
+    { 0x1D65B, 0x000000, 0x008101 },
+    { 0x1D65C, 0x000000, 0x007E21 },
+    { 0x1D65D, 0x000000, 0x004981 },
+    { 0x1D65E, 0x000000, 0x008041 },
+    { 0x1D65F, 0x000000, 0x0049C1 },
+    { 0x1D660, 0x000000, 0x007E41 },
+    { 0x1D661, 0x000000, 0x004C41 },
+    { 0x1D662, 0x000000, 0x007E61 },
+    { 0x1D663, 0x000000, 0x012161 },
+    { 0x1D664, 0x000000, 0x0001C1 },
+    { 0x1D665, 0x000000, 0x007F01 },
+    { 0x1D666, 0x000000, 0x015BE1 },
+    { 0x1D667, 0x000000, 0x0049E1 },
+    { 0x1D668, 0x000000, 0x002C81 },
+    { 0x1D669, 0x000000, 0x007F21 },
+    { 0x1D66A, 0x000000, 0x007F41 },
+    { 0x1D66B, 0x000000, 0x007FA1 },
+    { 0x1D66C, 0x000000, 0x004A61 },
+    { 0x1D66D, 0x000000, 0x004C61 },
+    { 0x1D66E, 0x000000, 0x004A81 },
+    { 0x1D66F, 0x000000, 0x008461 },
+    { 0x1D670, 0x000000, 0x007A61 },
+    { 0x1D671, 0x000000, 0x007AA1 },
+    { 0x1D672, 0x000000, 0x012281 },
+    { 0x1D673, 0x000000, 0x007AC1 },
+    { 0x1D674, 0x000000, 0x007AE1 },
+    { 0x1D675, 0x000000, 0x0125A1 },
+    { 0x1D676, 0x000000, 0x007B21 },
+    { 0x1D677, 0x000000, 0x007B41 },
+    { 0x1D678, 0x000000, 0x007B61 },
+    { 0x1D679, 0x000000, 0x007B81 },
+    { 0x1D67A, 0x000000, 0x007BA1 },
+    { 0x1D67B, 0x000000, 0x007BC1 },
+    { 0x1D67C, 0x000000, 0x007BE1 },
+    { 0x1D67D, 0x000000, 0x007C01 },
+    { 0x1D67E, 0x000000, 0x007C21 },
+    { 0x1D67F, 0x000000, 0x007C61 },
+    { 0x1D680, 0x000000, 0x012461 },
+    { 0x1D681, 0x000000, 0x007C81 },
+    { 0x1D682, 0x000000, 0x015BA1 },
+    { 0x1D683, 0x000000, 0x007CA1 },
+    { 0x1D684, 0x000000, 0x007CC1 },
+    { 0x1D685, 0x000000, 0x012DE1 },
+    { 0x1D686, 0x000000, 0x007CE1 },
+    { 0x1D687, 0x000000, 0x012F61 },
+    { 0x1D688, 0x000000, 0x015BC1 },
+    { 0x1D689, 0x000000, 0x012561 },
+    { 0x1D68A, 0x000000, 0x000061 },
+    { 0x1D68B, 0x000000, 0x007D61 },
+    { 0x1D68C, 0x000000, 0x0080A1 },
+    { 0x1D68D, 0x000000, 0x007D81 },
+    { 0x1D68E, 0x000000, 0x007DA1 },
+    { 0x1D68F, 0x000000, 0x008101 },
+    { 0x1D690, 0x000000, 0x007E21 },
+    { 0x1D691, 0x000000, 0x004981 },
+    { 0x1D692, 0x000000, 0x008041 },
+    { 0x1D693, 0x000000, 0x0049C1 },
+    { 0x1D694, 0x000000, 0x007E41 },
+    { 0x1D695, 0x000000, 0x004C41 },
+    { 0x1D696, 0x000000, 0x007E61 },
+    { 0x1D697, 0x000000, 0x012161 },
+    { 0x1D698, 0x000000, 0x0001C1 },
+    { 0x1D699, 0x000000, 0x007F01 },
+    { 0x1D69A, 0x000000, 0x015BE1 },
+    { 0x1D69B, 0x000000, 0x0049E1 },
+    { 0x1D69C, 0x000000, 0x002C81 },
+    { 0x1D69D, 0x000000, 0x007F21 },
+    { 0x1D69E, 0x000000, 0x007F41 },
+    { 0x1D69F, 0x000000, 0x007FA1 },
+    { 0x1D6A0, 0x000000, 0x004A61 },
+    { 0x1D6A1, 0x000000, 0x004C61 },
+    { 0x1D6A2, 0x000000, 0x004A81 },
+    { 0x1D6A3, 0x000000, 0x008461 },
+    { 0x1D6A4, 0x000000, 0x02EC41 },
+    { 0x1D6A5, 0x000000, 0x02EC61 },
+    { 0x1D6A8, 0x000000, 0x02EC81 },
+    { 0x1D6A9, 0x000000, 0x02ECA1 },
+    { 0x1D6AA, 0x000000, 0x0126A1 },
+    { 0x1D6AB, 0x000000, 0x02ECC1 },
+    { 0x1D6AC, 0x000000, 0x02ECE1 },
+    { 0x1D6AD, 0x000000, 0x02ED01 },
+    { 0x1D6AE, 0x000000, 0x02ED21 },
+    { 0x1D6AF, 0x000000, 0x005541 },
+    { 0x1D6B0, 0x000000, 0x02ED41 },
+    { 0x1D6B1, 0x000000, 0x02ED61 },
+    { 0x1D6B2, 0x000000, 0x02ED81 },
+    { 0x1D6B3, 0x000000, 0x02EDA1 },
+    { 0x1D6B4, 0x000000, 0x02EDC1 },
+    { 0x1D6B5, 0x000000, 0x02EDE1 },
+    { 0x1D6B6, 0x000000, 0x02EE01 },
+    { 0x1D6B7, 0x000000, 0x0126C1 },
+    { 0x1D6B8, 0x000000, 0x02EE21 },
+    { 0x1D6B9, 0x000000, 0x005541 },
+    { 0x1D6BA, 0x000000, 0x005581 },
+    { 0x1D6BB, 0x000000, 0x02EE41 },
+    { 0x1D6BC, 0x000000, 0x005401 },
+    { 0x1D6BD, 0x000000, 0x02EE61 },
+    { 0x1D6BE, 0x000000, 0x02EE81 },
+    { 0x1D6BF, 0x000000, 0x02EEA1 },
+    { 0x1D6C0, 0x000000, 0x012581 },
+    { 0x1D6C1, 0x000000, 0x02EEC1 },
+    { 0x1D6C2, 0x000000, 0x02EEE1 },
+    { 0x1D6C3, 0x000000, 0x0053C1 },
+    { 0x1D6C4, 0x000000, 0x007FE1 },
+    { 0x1D6C5, 0x000000, 0x008001 },
+    { 0x1D6C6, 0x000000, 0x005561 },
+    { 0x1D6C7, 0x000000, 0x02EF01 },
+    { 0x1D6C8, 0x000000, 0x02EF21 },
+    { 0x1D6C9, 0x000000, 0x0053E1 },
+    { 0x1D6CA, 0x000000, 0x010BA1 },
+    { 0x1D6CB, 0x000000, 0x0054E1 },
+    { 0x1D6CC, 0x000000, 0x02EF41 },
+    { 0x1D6CD, 0x000000, 0x000141 },
+    { 0x1D6CE, 0x000000, 0x02EF61 },
+    { 0x1D6CF, 0x000000, 0x02EF81 },
+    { 0x1D6D0, 0x000000, 0x02EFA1 },
+    { 0x1D6D1, 0x000000, 0x0054C1 },
+    { 0x1D6D2, 0x000000, 0x005501 },
+    { 0x1D6D3, 0x000000, 0x005521 },
+    { 0x1D6D4, 0x000000, 0x02EFC1 },
+    { 0x1D6D5, 0x000000, 0x02EFE1 },
+    { 0x1D6D6, 0x000000, 0x02F001 },
+    { 0x1D6D7, 0x000000, 0x0054A1 },
+    { 0x1D6D8, 0x000000, 0x008021 },
+    { 0x1D6D9, 0x000000, 0x02F021 },
+    { 0x1D6DA, 0x000000, 0x02F041 },
+    { 0x1D6DB, 0x000000, 0x02F061 },
+    { 0x1D6DC, 0x000000, 0x005561 },
+    { 0x1D6DD, 0x000000, 0x0053E1 },
+    { 0x1D6DE, 0x000000, 0x0054E1 },
+    { 0x1D6DF, 0x000000, 0x0054A1 },
+    { 0x1D6E0, 0x000000, 0x005501 },
+    { 0x1D6E1, 0x000000, 0x0054C1 },
+    { 0x1D6E2, 0x000000, 0x02EC81 },
+    { 0x1D6E3, 0x000000, 0x02ECA1 },
+    { 0x1D6E4, 0x000000, 0x0126A1 },
+    { 0x1D6E5, 0x000000, 0x02ECC1 },
+    { 0x1D6E6, 0x000000, 0x02ECE1 },
+    { 0x1D6E7, 0x000000, 0x02ED01 },
+    { 0x1D6E8, 0x000000, 0x02ED21 },
+    { 0x1D6E9, 0x000000, 0x005541 },
+    { 0x1D6EA, 0x000000, 0x02ED41 },
+    { 0x1D6EB, 0x000000, 0x02ED61 },
+    { 0x1D6EC, 0x000000, 0x02ED81 },
+    { 0x1D6ED, 0x000000, 0x02EDA1 },
+    { 0x1D6EE, 0x000000, 0x02EDC1 },
+    { 0x1D6EF, 0x000000, 0x02EDE1 },
+    { 0x1D6F0, 0x000000, 0x02EE01 },
+    { 0x1D6F1, 0x000000, 0x0126C1 },
+    { 0x1D6F2, 0x000000, 0x02EE21 },
+    { 0x1D6F3, 0x000000, 0x005541 },
+    { 0x1D6F4, 0x000000, 0x005581 },
+    { 0x1D6F5, 0x000000, 0x02EE41 },
+    { 0x1D6F6, 0x000000, 0x005401 },
+    { 0x1D6F7, 0x000000, 0x02EE61 },
+    { 0x1D6F8, 0x000000, 0x02EE81 },
+    { 0x1D6F9, 0x000000, 0x02EEA1 },
+    { 0x1D6FA, 0x000000, 0x012581 },
+    { 0x1D6FB, 0x000000, 0x02EEC1 },
+    { 0x1D6FC, 0x000000, 0x02EEE1 },
+    { 0x1D6FD, 0x000000, 0x0053C1 },
+    { 0x1D6FE, 0x000000, 0x007FE1 },
+    { 0x1D6FF, 0x000000, 0x008001 },
+    { 0x1D700, 0x000000, 0x005561 },
+    { 0x1D701, 0x000000, 0x02EF01 },
+    { 0x1D702, 0x000000, 0x02EF21 },
+    { 0x1D703, 0x000000, 0x0053E1 },
+    { 0x1D704, 0x000000, 0x010BA1 },
+    { 0x1D705, 0x000000, 0x0054E1 },
+    { 0x1D706, 0x000000, 0x02EF41 },
+    { 0x1D707, 0x000000, 0x000141 },
+    { 0x1D708, 0x000000, 0x02EF61 },
+    { 0x1D709, 0x000000, 0x02EF81 },
+    { 0x1D70A, 0x000000, 0x02EFA1 },
+    { 0x1D70B, 0x000000, 0x0054C1 },
+    { 0x1D70C, 0x000000, 0x005501 },
+    { 0x1D70D, 0x000000, 0x005521 },
+    { 0x1D70E, 0x000000, 0x02EFC1 },
+    { 0x1D70F, 0x000000, 0x02EFE1 },
+    { 0x1D710, 0x000000, 0x02F001 },
+    { 0x1D711, 0x000000, 0x0054A1 },
+    { 0x1D712, 0x000000, 0x008021 },
+    { 0x1D713, 0x000000, 0x02F021 },
+    { 0x1D714, 0x000000, 0x02F041 },
+    { 0x1D715, 0x000000, 0x02F061 },
+    { 0x1D716, 0x000000, 0x005561 },
+    { 0x1D717, 0x000000, 0x0053E1 },
+    { 0x1D718, 0x000000, 0x0054E1 },
+    { 0x1D719, 0x000000, 0x0054A1 },
+    { 0x1D71A, 0x000000, 0x005501 },
+    { 0x1D71B, 0x000000, 0x0054C1 },
+    { 0x1D71C, 0x000000, 0x02EC81 },
+    { 0x1D71D, 0x000000, 0x02ECA1 },
+    { 0x1D71E, 0x000000, 0x0126A1 },
+    { 0x1D71F, 0x000000, 0x02ECC1 },
+    { 0x1D720, 0x000000, 0x02ECE1 },
+    { 0x1D721, 0x000000, 0x02ED01 },
+    { 0x1D722, 0x000000, 0x02ED21 },
+    { 0x1D723, 0x000000, 0x005541 },
+    { 0x1D724, 0x000000, 0x02ED41 },
+    { 0x1D725, 0x000000, 0x02ED61 },
+    { 0x1D726, 0x000000, 0x02ED81 },
+    { 0x1D727, 0x000000, 0x02EDA1 },
+    { 0x1D728, 0x000000, 0x02EDC1 },
+    { 0x1D729, 0x000000, 0x02EDE1 },
+    { 0x1D72A, 0x000000, 0x02EE01 },
+    { 0x1D72B, 0x000000, 0x0126C1 },
+    { 0x1D72C, 0x000000, 0x02EE21 },
+    { 0x1D72D, 0x000000, 0x005541 },
+    { 0x1D72E, 0x000000, 0x005581 },
+    { 0x1D72F, 0x000000, 0x02EE41 },
+    { 0x1D730, 0x000000, 0x005401 },
+    { 0x1D731, 0x000000, 0x02EE61 },
+    { 0x1D732, 0x000000, 0x02EE81 },
+    { 0x1D733, 0x000000, 0x02EEA1 },
+    { 0x1D734, 0x000000, 0x012581 },
+    { 0x1D735, 0x000000, 0x02EEC1 },
+    { 0x1D736, 0x000000, 0x02EEE1 },
+    { 0x1D737, 0x000000, 0x0053C1 },
+    { 0x1D738, 0x000000, 0x007FE1 },
+    { 0x1D739, 0x000000, 0x008001 },
+    { 0x1D73A, 0x000000, 0x005561 },
+    { 0x1D73B, 0x000000, 0x02EF01 },
+    { 0x1D73C, 0x000000, 0x02EF21 },
+    { 0x1D73D, 0x000000, 0x0053E1 },
+    { 0x1D73E, 0x000000, 0x010BA1 },
+    { 0x1D73F, 0x000000, 0x0054E1 },
+    { 0x1D740, 0x000000, 0x02EF41 },
+    { 0x1D741, 0x000000, 0x000141 },
+    { 0x1D742, 0x000000, 0x02EF61 },
+    { 0x1D743, 0x000000, 0x02EF81 },
+    { 0x1D744, 0x000000, 0x02EFA1 },
+    { 0x1D745, 0x000000, 0x0054C1 },
+    { 0x1D746, 0x000000, 0x005501 },
+    { 0x1D747, 0x000000, 0x005521 },
+    { 0x1D748, 0x000000, 0x02EFC1 },
+    { 0x1D749, 0x000000, 0x02EFE1 },
+    { 0x1D74A, 0x000000, 0x02F001 },
+    { 0x1D74B, 0x000000, 0x0054A1 },
+    { 0x1D74C, 0x000000, 0x008021 },
+    { 0x1D74D, 0x000000, 0x02F021 },
+    { 0x1D74E, 0x000000, 0x02F041 },
+    { 0x1D74F, 0x000000, 0x02F061 },
+    { 0x1D750, 0x000000, 0x005561 },
+    { 0x1D751, 0x000000, 0x0053E1 },
+    { 0x1D752, 0x000000, 0x0054E1 },
+    { 0x1D753, 0x000000, 0x0054A1 },
+    { 0x1D754, 0x000000, 0x005501 },
+    { 0x1D755, 0x000000, 0x0054C1 },
+    { 0x1D756, 0x000000, 0x02EC81 },
+    { 0x1D757, 0x000000, 0x02ECA1 },
+    { 0x1D758, 0x000000, 0x0126A1 },
+    { 0x1D759, 0x000000, 0x02ECC1 },
+    { 0x1D75A, 0x000000, 0x02ECE1 },
+    { 0x1D75B, 0x000000, 0x02ED01 },
+    { 0x1D75C, 0x000000, 0x02ED21 },
+    { 0x1D75D, 0x000000, 0x005541 },
+    { 0x1D75E, 0x000000, 0x02ED41 },
+    { 0x1D75F, 0x000000, 0x02ED61 },
+    { 0x1D760, 0x000000, 0x02ED81 },
+    { 0x1D761, 0x000000, 0x02EDA1 },
+    { 0x1D762, 0x000000, 0x02EDC1 },
+    { 0x1D763, 0x000000, 0x02EDE1 },
+    { 0x1D764, 0x000000, 0x02EE01 },
+    { 0x1D765, 0x000000, 0x0126C1 },
+    { 0x1D766, 0x000000, 0x02EE21 },
+    { 0x1D767, 0x000000, 0x005541 },
+    { 0x1D768, 0x000000, 0x005581 },
+    { 0x1D769, 0x000000, 0x02EE41 },
+    { 0x1D76A, 0x000000, 0x005401 },
+    { 0x1D76B, 0x000000, 0x02EE61 },
+    { 0x1D76C, 0x000000, 0x02EE81 },
+    { 0x1D76D, 0x000000, 0x02EEA1 },
+    { 0x1D76E, 0x000000, 0x012581 },
+    { 0x1D76F, 0x000000, 0x02EEC1 },
+    { 0x1D770, 0x000000, 0x02EEE1 },
+    { 0x1D771, 0x000000, 0x0053C1 },
+    { 0x1D772, 0x000000, 0x007FE1 },
+    { 0x1D773, 0x000000, 0x008001 },
+    { 0x1D774, 0x000000, 0x005561 },
+    { 0x1D775, 0x000000, 0x02EF01 },
+    { 0x1D776, 0x000000, 0x02EF21 },
+    { 0x1D777, 0x000000, 0x0053E1 },
+    { 0x1D778, 0x000000, 0x010BA1 },
+    { 0x1D779, 0x000000, 0x0054E1 },
+    { 0x1D77A, 0x000000, 0x02EF41 },
+    { 0x1D77B, 0x000000, 0x000141 },
+    { 0x1D77C, 0x000000, 0x02EF61 },
+    { 0x1D77D, 0x000000, 0x02EF81 },
+    { 0x1D77E, 0x000000, 0x02EFA1 },
+    { 0x1D77F, 0x000000, 0x0054C1 },
+    { 0x1D780, 0x000000, 0x005501 },
+    { 0x1D781, 0x000000, 0x005521 },
+    { 0x1D782, 0x000000, 0x02EFC1 },
+    { 0x1D783, 0x000000, 0x02EFE1 },
+    { 0x1D784, 0x000000, 0x02F001 },
+    { 0x1D785, 0x000000, 0x0054A1 },
+    { 0x1D786, 0x000000, 0x008021 },
+    { 0x1D787, 0x000000, 0x02F021 },
+    { 0x1D788, 0x000000, 0x02F041 },
+    { 0x1D789, 0x000000, 0x02F061 },
+    { 0x1D78A, 0x000000, 0x005561 },
+    { 0x1D78B, 0x000000, 0x0053E1 },
+    { 0x1D78C, 0x000000, 0x0054E1 },
+    { 0x1D78D, 0x000000, 0x0054A1 },
+    { 0x1D78E, 0x000000, 0x005501 },
+    { 0x1D78F, 0x000000, 0x0054C1 },
+    { 0x1D790, 0x000000, 0x02EC81 },
+    { 0x1D791, 0x000000, 0x02ECA1 },
+    { 0x1D792, 0x000000, 0x0126A1 },
+    { 0x1D793, 0x000000, 0x02ECC1 },
+    { 0x1D794, 0x000000, 0x02ECE1 },
+    { 0x1D795, 0x000000, 0x02ED01 },
+    { 0x1D796, 0x000000, 0x02ED21 },
+    { 0x1D797, 0x000000, 0x005541 },
+    { 0x1D798, 0x000000, 0x02ED41 },
+    { 0x1D799, 0x000000, 0x02ED61 },
+    { 0x1D79A, 0x000000, 0x02ED81 },
+    { 0x1D79B, 0x000000, 0x02EDA1 },
+    { 0x1D79C, 0x000000, 0x02EDC1 },
+    { 0x1D79D, 0x000000, 0x02EDE1 },
+    { 0x1D79E, 0x000000, 0x02EE01 },
+    { 0x1D79F, 0x000000, 0x0126C1 },
+    { 0x1D7A0, 0x000000, 0x02EE21 },
+    { 0x1D7A1, 0x000000, 0x005541 },
+    { 0x1D7A2, 0x000000, 0x005581 },
+    { 0x1D7A3, 0x000000, 0x02EE41 },
+    { 0x1D7A4, 0x000000, 0x005401 },
+    { 0x1D7A5, 0x000000, 0x02EE61 },
+    { 0x1D7A6, 0x000000, 0x02EE81 },
+    { 0x1D7A7, 0x000000, 0x02EEA1 },
+    { 0x1D7A8, 0x000000, 0x012581 },
+    { 0x1D7A9, 0x000000, 0x02EEC1 },
+    { 0x1D7AA, 0x000000, 0x02EEE1 },
+    { 0x1D7AB, 0x000000, 0x0053C1 },
+    { 0x1D7AC, 0x000000, 0x007FE1 },
+    { 0x1D7AD, 0x000000, 0x008001 },
+    { 0x1D7AE, 0x000000, 0x005561 },
+    { 0x1D7AF, 0x000000, 0x02EF01 },
+    { 0x1D7B0, 0x000000, 0x02EF21 },
+    { 0x1D7B1, 0x000000, 0x0053E1 },
+    { 0x1D7B2, 0x000000, 0x010BA1 },
+    { 0x1D7B3, 0x000000, 0x0054E1 },
+    { 0x1D7B4, 0x000000, 0x02EF41 },
+    { 0x1D7B5, 0x000000, 0x000141 },
+    { 0x1D7B6, 0x000000, 0x02EF61 },
+    { 0x1D7B7, 0x000000, 0x02EF81 },
+    { 0x1D7B8, 0x000000, 0x02EFA1 },
+    { 0x1D7B9, 0x000000, 0x0054C1 },
+    { 0x1D7BA, 0x000000, 0x005501 },
+    { 0x1D7BB, 0x000000, 0x005521 },
+    { 0x1D7BC, 0x000000, 0x02EFC1 },
+    { 0x1D7BD, 0x000000, 0x02EFE1 },
+    { 0x1D7BE, 0x000000, 0x02F001 },
+    { 0x1D7BF, 0x000000, 0x0054A1 },
+    { 0x1D7C0, 0x000000, 0x008021 },
+    { 0x1D7C1, 0x000000, 0x02F021 },
+    { 0x1D7C2, 0x000000, 0x02F041 },
+    { 0x1D7C3, 0x000000, 0x02F061 },
+    { 0x1D7C4, 0x000000, 0x005561 },
+    { 0x1D7C5, 0x000000, 0x0053E1 },
+    { 0x1D7C6, 0x000000, 0x0054E1 },
+    { 0x1D7C7, 0x000000, 0x0054A1 },
+    { 0x1D7C8, 0x000000, 0x005501 },
+    { 0x1D7C9, 0x000000, 0x0054C1 },
+    { 0x1D7CA, 0x000000, 0x02F081 },
+    { 0x1D7CB, 0x000000, 0x02F0A1 },
+    { 0x1D7CE, 0x000000, 0x011FE1 },
+    { 0x1D7CF, 0x000000, 0x0001A1 },
+    { 0x1D7D0, 0x000000, 0x0000C1 },
+    { 0x1D7D1, 0x000000, 0x0000E1 },
+    { 0x1D7D2, 0x000000, 0x012001 },
+    { 0x1D7D3, 0x000000, 0x012021 },
+    { 0x1D7D4, 0x000000, 0x012041 },
+    { 0x1D7D5, 0x000000, 0x012061 },
+    { 0x1D7D6, 0x000000, 0x012081 },
+    { 0x1D7D7, 0x000000, 0x0120A1 },
+    { 0x1D7D8, 0x000000, 0x011FE1 },
+    { 0x1D7D9, 0x000000, 0x0001A1 },
+    { 0x1D7DA, 0x000000, 0x0000C1 },
+    { 0x1D7DB, 0x000000, 0x0000E1 },
+    { 0x1D7DC, 0x000000, 0x012001 },
+    { 0x1D7DD, 0x000000, 0x012021 },
+    { 0x1D7DE, 0x000000, 0x012041 },
+    { 0x1D7DF, 0x000000, 0x012061 },
+    { 0x1D7E0, 0x000000, 0x012081 },
+    { 0x1D7E1, 0x000000, 0x0120A1 },
+    { 0x1D7E2, 0x000000, 0x011FE1 },
+    { 0x1D7E3, 0x000000, 0x0001A1 },
+    { 0x1D7E4, 0x000000, 0x0000C1 },
+    { 0x1D7E5, 0x000000, 0x0000E1 },
+    { 0x1D7E6, 0x000000, 0x012001 },
+    { 0x1D7E7, 0x000000, 0x012021 },
+    { 0x1D7E8, 0x000000, 0x012041 },
+    { 0x1D7E9, 0x000000, 0x012061 },
+    { 0x1D7EA, 0x000000, 0x012081 },
+    { 0x1D7EB, 0x000000, 0x0120A1 },
+    { 0x1D7EC, 0x000000, 0x011FE1 },
+    { 0x1D7ED, 0x000000, 0x0001A1 },
+    { 0x1D7EE, 0x000000, 0x0000C1 },
+    { 0x1D7EF, 0x000000, 0x0000E1 },
+    { 0x1D7F0, 0x000000, 0x012001 },
+    { 0x1D7F1, 0x000000, 0x012021 },
+    { 0x1D7F2, 0x000000, 0x012041 },
+    { 0x1D7F3, 0x000000, 0x012061 },
+    { 0x1D7F4, 0x000000, 0x012081 },
+    { 0x1D7F5, 0x000000, 0x0120A1 },
+    { 0x1D7F6, 0x000000, 0x011FE1 },
+    { 0x1D7F7, 0x000000, 0x0001A1 },
+    { 0x1D7F8, 0x000000, 0x0000C1 },
+    { 0x1D7F9, 0x000000, 0x0000E1 },
+    { 0x1D7FA, 0x000000, 0x012001 },
+    { 0x1D7FB, 0x000000, 0x012021 },
+    { 0x1D7FC, 0x000000, 0x012041 },
+    { 0x1D7FD, 0x000000, 0x012061 },
+    { 0x1D7FE, 0x000000, 0x012081 },
+    { 0x1D7FF, 0x000000, 0x0120A1 },
+    { 0x1EE00, 0x000000, 0x02D481 },
+    { 0x1EE01, 0x000000, 0x02D4A1 },
+    { 0x1EE02, 0x000000, 0x02D521 },
+    { 0x1EE03, 0x000000, 0x02D581 },
+    { 0x1EE05, 0x000000, 0x02D7E1 },
+    { 0x1EE06, 0x000000, 0x02D5E1 },
+    { 0x1EE07, 0x000000, 0x02D541 },
+    { 0x1EE08, 0x000000, 0x02D681 },
+    { 0x1EE09, 0x000000, 0x02D801 },
+    { 0x1EE0A, 0x000000, 0x02D741 },
+    { 0x1EE0B, 0x000000, 0x02D761 },
+    { 0x1EE0C, 0x000000, 0x02D781 },
+    { 0x1EE0D, 0x000000, 0x02D7A1 },
+    { 0x1EE0E, 0x000000, 0x02D601 },
+    { 0x1EE0F, 0x000000, 0x02D6C1 },
+    { 0x1EE10, 0x000000, 0x02D701 },
+    { 0x1EE11, 0x000000, 0x02D641 },
+    { 0x1EE12, 0x000000, 0x02D721 },
+    { 0x1EE13, 0x000000, 0x02D5C1 },
+    { 0x1EE14, 0x000000, 0x02D621 },
+    { 0x1EE15, 0x000000, 0x02D4E1 },
+    { 0x1EE16, 0x000000, 0x02D501 },
+    { 0x1EE17, 0x000000, 0x02D561 },
+    { 0x1EE18, 0x000000, 0x02D5A1 },
+    { 0x1EE19, 0x000000, 0x02D661 },
+    { 0x1EE1A, 0x000000, 0x02D6A1 },
+    { 0x1EE1B, 0x000000, 0x02D6E1 },
+    { 0x1EE1C, 0x000000, 0x02F0C1 },
+    { 0x1EE1D, 0x000000, 0x027141 },
+    { 0x1EE1E, 0x000000, 0x02F0E1 },
+    { 0x1EE1F, 0x000000, 0x02F101 },
+    { 0x1EE21, 0x000000, 0x02D4A1 },
+    { 0x1EE22, 0x000000, 0x02D521 },
+    { 0x1EE24, 0x000000, 0x02D7C1 },
+    { 0x1EE27, 0x000000, 0x02D541 },
+    { 0x1EE29, 0x000000, 0x02D801 },
+    { 0x1EE2A, 0x000000, 0x02D741 },
+    { 0x1EE2B, 0x000000, 0x02D761 },
+    { 0x1EE2C, 0x000000, 0x02D781 },
+    { 0x1EE2D, 0x000000, 0x02D7A1 },
+    { 0x1EE2E, 0x000000, 0x02D601 },
+    { 0x1EE2F, 0x000000, 0x02D6C1 },
+    { 0x1EE30, 0x000000, 0x02D701 },
+    { 0x1EE31, 0x000000, 0x02D641 },
+    { 0x1EE32, 0x000000, 0x02D721 },
+    { 0x1EE34, 0x000000, 0x02D621 },
+    { 0x1EE35, 0x000000, 0x02D4E1 },
+    { 0x1EE36, 0x000000, 0x02D501 },
+    { 0x1EE37, 0x000000, 0x02D561 },
+    { 0x1EE39, 0x000000, 0x02D661 },
+    { 0x1EE3B, 0x000000, 0x02D6E1 },
+    { 0x1EE42, 0x000000, 0x02D521 },
+    { 0x1EE47, 0x000000, 0x02D541 },
+    { 0x1EE49, 0x000000, 0x02D801 },
+    { 0x1EE4B, 0x000000, 0x02D761 },
+    { 0x1EE4D, 0x000000, 0x02D7A1 },
+    { 0x1EE4E, 0x000000, 0x02D601 },
+    { 0x1EE4F, 0x000000, 0x02D6C1 },
+    { 0x1EE51, 0x000000, 0x02D641 },
+    { 0x1EE52, 0x000000, 0x02D721 },
+    { 0x1EE54, 0x000000, 0x02D621 },
+    { 0x1EE57, 0x000000, 0x02D561 },
+    { 0x1EE59, 0x000000, 0x02D661 },
+    { 0x1EE5B, 0x000000, 0x02D6E1 },
+    { 0x1EE5D, 0x000000, 0x027141 },
+    { 0x1EE5F, 0x000000, 0x02F101 },
+    { 0x1EE61, 0x000000, 0x02D4A1 },
+    { 0x1EE62, 0x000000, 0x02D521 },
+    { 0x1EE64, 0x000000, 0x02D7C1 },
+    { 0x1EE67, 0x000000, 0x02D541 },
+    { 0x1EE68, 0x000000, 0x02D681 },
+    { 0x1EE69, 0x000000, 0x02D801 },
+    { 0x1EE6A, 0x000000, 0x02D741 },
+    { 0x1EE6C, 0x000000, 0x02D781 },
+    { 0x1EE6D, 0x000000, 0x02D7A1 },
+    { 0x1EE6E, 0x000000, 0x02D601 },
+    { 0x1EE6F, 0x000000, 0x02D6C1 },
+    { 0x1EE70, 0x000000, 0x02D701 },
+    { 0x1EE71, 0x000000, 0x02D641 },
+    { 0x1EE72, 0x000000, 0x02D721 },
+    { 0x1EE74, 0x000000, 0x02D621 },
+    { 0x1EE75, 0x000000, 0x02D4E1 },
+    { 0x1EE76, 0x000000, 0x02D501 },
+    { 0x1EE77, 0x000000, 0x02D561 },
+    { 0x1EE79, 0x000000, 0x02D661 },
+    { 0x1EE7A, 0x000000, 0x02D6A1 },
+    { 0x1EE7B, 0x000000, 0x02D6E1 },
+    { 0x1EE7C, 0x000000, 0x02F0C1 },
+    { 0x1EE7E, 0x000000, 0x02F0E1 },
+    { 0x1EE80, 0x000000, 0x02D481 },
+    { 0x1EE81, 0x000000, 0x02D4A1 },
+    { 0x1EE82, 0x000000, 0x02D521 },
+    { 0x1EE83, 0x000000, 0x02D581 },
+    { 0x1EE84, 0x000000, 0x02D7C1 },
+    { 0x1EE85, 0x000000, 0x02D7E1 },
+    { 0x1EE86, 0x000000, 0x02D5E1 },
+    { 0x1EE87, 0x000000, 0x02D541 },
+    { 0x1EE88, 0x000000, 0x02D681 },
+    { 0x1EE89, 0x000000, 0x02D801 },
+    { 0x1EE8B, 0x000000, 0x02D761 },
+    { 0x1EE8C, 0x000000, 0x02D781 },
+    { 0x1EE8D, 0x000000, 0x02D7A1 },
+    { 0x1EE8E, 0x000000, 0x02D601 },
+    { 0x1EE8F, 0x000000, 0x02D6C1 },
+    { 0x1EE90, 0x000000, 0x02D701 },
+    { 0x1EE91, 0x000000, 0x02D641 },
+    { 0x1EE92, 0x000000, 0x02D721 },
+    { 0x1EE93, 0x000000, 0x02D5C1 },
+    { 0x1EE94, 0x000000, 0x02D621 },
+    { 0x1EE95, 0x000000, 0x02D4E1 },
+    { 0x1EE96, 0x000000, 0x02D501 },
+    { 0x1EE97, 0x000000, 0x02D561 },
+    { 0x1EE98, 0x000000, 0x02D5A1 },
+    { 0x1EE99, 0x000000, 0x02D661 },
+    { 0x1EE9A, 0x000000, 0x02D6A1 },
+    { 0x1EE9B, 0x000000, 0x02D6E1 },
+    { 0x1EEA1, 0x000000, 0x02D4A1 },
+    { 0x1EEA2, 0x000000, 0x02D521 },
+    { 0x1EEA3, 0x000000, 0x02D581 },
+    { 0x1EEA5, 0x000000, 0x02D7E1 },
+    { 0x1EEA6, 0x000000, 0x02D5E1 },
+    { 0x1EEA7, 0x000000, 0x02D541 },
+    { 0x1EEA8, 0x000000, 0x02D681 },
+    { 0x1EEA9, 0x000000, 0x02D801 },
+    { 0x1EEAB, 0x000000, 0x02D761 },
+    { 0x1EEAC, 0x000000, 0x02D781 },
+    { 0x1EEAD, 0x000000, 0x02D7A1 },
+    { 0x1EEAE, 0x000000, 0x02D601 },
+    { 0x1EEAF, 0x000000, 0x02D6C1 },
+    { 0x1EEB0, 0x000000, 0x02D701 },
+    { 0x1EEB1, 0x000000, 0x02D641 },
+    { 0x1EEB2, 0x000000, 0x02D721 },
+    { 0x1EEB3, 0x000000, 0x02D5C1 },
+    { 0x1EEB4, 0x000000, 0x02D621 },
+    { 0x1EEB5, 0x000000, 0x02D4E1 },
+    { 0x1EEB6, 0x000000, 0x02D501 },
+    { 0x1EEB7, 0x000000, 0x02D561 },
+    { 0x1EEB8, 0x000000, 0x02D5A1 },
+    { 0x1EEB9, 0x000000, 0x02D661 },
+    { 0x1EEBA, 0x000000, 0x02D6A1 },
+    { 0x1EEBB, 0x000000, 0x02D6E1 },
+    { 0x1F100, 0x000000, 0x02F122 },
+    { 0x1F101, 0x000000, 0x02F162 },
+    { 0x1F102, 0x000000, 0x02F1A2 },
+    { 0x1F103, 0x000000, 0x02F1E2 },
+    { 0x1F104, 0x000000, 0x02F222 },
+    { 0x1F105, 0x000000, 0x02F262 },
+    { 0x1F106, 0x000000, 0x02F2A2 },
+    { 0x1F107, 0x000000, 0x02F2E2 },
+    { 0x1F108, 0x000000, 0x02F322 },
+    { 0x1F109, 0x000000, 0x02F362 },
+    { 0x1F10A, 0x000000, 0x02F3A2 },
+    { 0x1F110, 0x000000, 0x02F3E3 },
+    { 0x1F111, 0x000000, 0x02F443 },
+    { 0x1F112, 0x000000, 0x02F4A3 },
+    { 0x1F113, 0x000000, 0x02F503 },
+    { 0x1F114, 0x000000, 0x02F563 },
+    { 0x1F115, 0x000000, 0x02F5C3 },
+    { 0x1F116, 0x000000, 0x02F623 },
+    { 0x1F117, 0x000000, 0x02F683 },
+    { 0x1F118, 0x000000, 0x02F6E3 },
+    { 0x1F119, 0x000000, 0x02F743 },
+    { 0x1F11A, 0x000000, 0x02F7A3 },
+    { 0x1F11B, 0x000000, 0x02F803 },
+    { 0x1F11C, 0x000000, 0x02F863 },
+    { 0x1F11D, 0x000000, 0x02F8C3 },
+    { 0x1F11E, 0x000000, 0x02F923 },
+    { 0x1F11F, 0x000000, 0x02F983 },
+    { 0x1F120, 0x000000, 0x02F9E3 },
+    { 0x1F121, 0x000000, 0x02FA43 },
+    { 0x1F122, 0x000000, 0x02FAA3 },
+    { 0x1F123, 0x000000, 0x02FB03 },
+    { 0x1F124, 0x000000, 0x02FB63 },
+    { 0x1F125, 0x000000, 0x02FBC3 },
+    { 0x1F126, 0x000000, 0x02FC23 },
+    { 0x1F127, 0x000000, 0x02FC83 },
+    { 0x1F128, 0x000000, 0x02FCE3 },
+    { 0x1F129, 0x000000, 0x02FD43 },
+    { 0x1F12A, 0x000000, 0x02FDA3 },
+    { 0x1F12B, 0x000000, 0x012281 },
+    { 0x1F12C, 0x000000, 0x007C81 },
+    { 0x1F12D, 0x000000, 0x02FE02 },
+    { 0x1F12E, 0x000000, 0x02FE42 },
+    { 0x1F130, 0x000000, 0x007A61 },
+    { 0x1F131, 0x000000, 0x007AA1 },
+    { 0x1F132, 0x000000, 0x012281 },
+    { 0x1F133, 0x000000, 0x007AC1 },
+    { 0x1F134, 0x000000, 0x007AE1 },
+    { 0x1F135, 0x000000, 0x0125A1 },
+    { 0x1F136, 0x000000, 0x007B21 },
+    { 0x1F137, 0x000000, 0x007B41 },
+    { 0x1F138, 0x000000, 0x007B61 },
+    { 0x1F139, 0x000000, 0x007B81 },
+    { 0x1F13A, 0x000000, 0x007BA1 },
+    { 0x1F13B, 0x000000, 0x007BC1 },
+    { 0x1F13C, 0x000000, 0x007BE1 },
+    { 0x1F13D, 0x000000, 0x007C01 },
+    { 0x1F13E, 0x000000, 0x007C21 },
+    { 0x1F13F, 0x000000, 0x007C61 },
+    { 0x1F140, 0x000000, 0x012461 },
+    { 0x1F141, 0x000000, 0x007C81 },
+    { 0x1F142, 0x000000, 0x015BA1 },
+    { 0x1F143, 0x000000, 0x007CA1 },
+    { 0x1F144, 0x000000, 0x007CC1 },
+    { 0x1F145, 0x000000, 0x012DE1 },
+    { 0x1F146, 0x000000, 0x007CE1 },
+    { 0x1F147, 0x000000, 0x012F61 },
+    { 0x1F148, 0x000000, 0x015BC1 },
+    { 0x1F149, 0x000000, 0x012561 },
+    { 0x1F14A, 0x000000, 0x02FE82 },
+    { 0x1F14B, 0x000000, 0x021742 },
+    { 0x1F14C, 0x000000, 0x02FEC2 },
+    { 0x1F14D, 0x000000, 0x02FF02 },
+    { 0x1F14E, 0x000000, 0x02FF43 },
+    { 0x1F14F, 0x000000, 0x02FFA2 },
+    { 0x1F16A, 0x000000, 0x02FFE2 },
+    { 0x1F16B, 0x000000, 0x030022 },
+    { 0x1F16C, 0x000000, 0x030062 },
+    { 0x1F190, 0x000000, 0x0300A2 },
+    { 0x1F200, 0x000000, 0x0300E2 },
+    { 0x1F201, 0x000000, 0x030122 },
+    { 0x1F202, 0x000000, 0x01C8A1 },
+    { 0x1F210, 0x000000, 0x016601 },
+    { 0x1F211, 0x000000, 0x030161 },
+    { 0x1F212, 0x000000, 0x030181 },
+    { 0x1F213, 0x000000, 0x018402 },
+    { 0x1F214, 0x000000, 0x015EE1 },
+    { 0x1F215, 0x000000, 0x0301A1 },
+    { 0x1F216, 0x000000, 0x0301C1 },
+    { 0x1F217, 0x000000, 0x019581 },
+    { 0x1F218, 0x000000, 0x0301E1 },
+    { 0x1F219, 0x000000, 0x030201 },
+    { 0x1F21A, 0x000000, 0x030221 },
+    { 0x1F21B, 0x000000, 0x024501 },
+    { 0x1F21C, 0x000000, 0x030241 },
+    { 0x1F21D, 0x000000, 0x030261 },
+    { 0x1F21E, 0x000000, 0x030281 },
+    { 0x1F21F, 0x000000, 0x0302A1 },
+    { 0x1F220, 0x000000, 0x0302C1 },
+    { 0x1F221, 0x000000, 0x0302E1 },
+    { 0x1F222, 0x000000, 0x016A81 },
+    { 0x1F223, 0x000000, 0x030301 },
+    { 0x1F224, 0x000000, 0x030321 },
+    { 0x1F225, 0x000000, 0x030341 },
+    { 0x1F226, 0x000000, 0x030361 },
+    { 0x1F227, 0x000000, 0x030381 },
+    { 0x1F228, 0x000000, 0x0303A1 },
+    { 0x1F229, 0x000000, 0x015E21 },
+    { 0x1F22A, 0x000000, 0x019481 },
+    { 0x1F22B, 0x000000, 0x0303C1 },
+    { 0x1F22C, 0x000000, 0x01BDC1 },
+    { 0x1F22D, 0x000000, 0x0194E1 },
+    { 0x1F22E, 0x000000, 0x01BDE1 },
+    { 0x1F22F, 0x000000, 0x0303E1 },
+    { 0x1F230, 0x000000, 0x017181 },
+    { 0x1F231, 0x000000, 0x030401 },
+    { 0x1F232, 0x000000, 0x030421 },
+    { 0x1F233, 0x000000, 0x030441 },
+    { 0x1F234, 0x000000, 0x030461 },
+    { 0x1F235, 0x000000, 0x030481 },
+    { 0x1F236, 0x000000, 0x01BBA1 },
+    { 0x1F237, 0x000000, 0x016741 },
+    { 0x1F238, 0x000000, 0x0304A1 },
+    { 0x1F239, 0x000000, 0x0304C1 },
+    { 0x1F23A, 0x000000, 0x0304E1 },
+    { 0x1F23B, 0x000000, 0x030501 },
+    { 0x1F240, 0x000000, 0x030523 },
+    { 0x1F241, 0x000000, 0x030583 },
+    { 0x1F242, 0x000000, 0x0305E3 },
+    { 0x1F243, 0x000000, 0x030643 },
+    { 0x1F244, 0x000000, 0x0306A3 },
+    { 0x1F245, 0x000000, 0x030703 },
+    { 0x1F246, 0x000000, 0x030763 },
+    { 0x1F247, 0x000000, 0x0307C3 },
+    { 0x1F248, 0x000000, 0x030823 },
+    { 0x1F250, 0x000000, 0x030881 },
+    { 0x1F251, 0x000000, 0x0308A1 },
+    { 0x1FBF0, 0x000000, 0x011FE1 },
+    { 0x1FBF1, 0x000000, 0x0001A1 },
+    { 0x1FBF2, 0x000000, 0x0000C1 },
+    { 0x1FBF3, 0x000000, 0x0000E1 },
+    { 0x1FBF4, 0x000000, 0x012001 },
+    { 0x1FBF5, 0x000000, 0x012021 },
+    { 0x1FBF6, 0x000000, 0x012041 },
+    { 0x1FBF7, 0x000000, 0x012061 },
+    { 0x1FBF8, 0x000000, 0x012081 },
+    { 0x1FBF9, 0x000000, 0x0120A1 },
+    { 0x2F800, 0x0308C1, 0x0308C1 },
+    { 0x2F801, 0x0308E1, 0x0308E1 },
+    { 0x2F802, 0x030901, 0x030901 },
+    { 0x2F803, 0x030921, 0x030921 },
+    { 0x2F804, 0x030941, 0x030941 },
+    { 0x2F805, 0x0250A1, 0x0250A1 },
+    { 0x2F806, 0x030961, 0x030961 },
+    { 0x2F807, 0x030981, 0x030981 },
+    { 0x2F808, 0x0309A1, 0x0309A1 },
+    { 0x2F809, 0x0309C1, 0x0309C1 },
+    { 0x2F80A, 0x0250C1, 0x0250C1 },
+    { 0x2F80B, 0x0309E1, 0x0309E1 },
+    { 0x2F80C, 0x030A01, 0x030A01 },
+    { 0x2F80D, 0x030A21, 0x030A21 },
+    { 0x2F80E, 0x0250E1, 0x0250E1 },
+    { 0x2F80F, 0x030A41, 0x030A41 },
+    { 0x2F810, 0x030A61, 0x030A61 },
+    { 0x2F811, 0x030A81, 0x030A81 },
+    { 0x2F812, 0x030AA1, 0x030AA1 },
+    { 0x2F813, 0x030AC1, 0x030AC1 },
+    { 0x2F814, 0x030AE1, 0x030AE1 },
+    { 0x2F815, 0x030281, 0x030281 },
+    { 0x2F816, 0x030B01, 0x030B01 },
+    { 0x2F817, 0x030B21, 0x030B21 },
+    { 0x2F818, 0x030B41, 0x030B41 },
+    { 0x2F819, 0x030B61, 0x030B61 },
+    { 0x2F81A, 0x030B81, 0x030B81 },
+    { 0x2F81B, 0x0257C1, 0x0257C1 },
+    { 0x2F81C, 0x030BA1, 0x030BA1 },
+    { 0x2F81D, 0x016021, 0x016021 },
+    { 0x2F81E, 0x030BC1, 0x030BC1 },
+    { 0x2F81F, 0x030BE1, 0x030BE1 },
+    { 0x2F820, 0x030C01, 0x030C01 },
+    { 0x2F821, 0x030C21, 0x030C21 },
+    { 0x2F822, 0x0304C1, 0x0304C1 },
+    { 0x2F823, 0x030C41, 0x030C41 },
+    { 0x2F824, 0x030C61, 0x030C61 },
+    { 0x2F825, 0x025861, 0x025861 },
+    { 0x2F826, 0x025101, 0x025101 },
+    { 0x2F827, 0x025121, 0x025121 },
+    { 0x2F828, 0x025881, 0x025881 },
+    { 0x2F829, 0x030C81, 0x030C81 },
+    { 0x2F82A, 0x030CA1, 0x030CA1 },
+    { 0x2F82B, 0x023A41, 0x023A41 },
+    { 0x2F82C, 0x030CC1, 0x030CC1 },
+    { 0x2F82D, 0x025141, 0x025141 },
+    { 0x2F82E, 0x030CE1, 0x030CE1 },
+    { 0x2F82F, 0x030D01, 0x030D01 },
+    { 0x2F830, 0x030D21, 0x030D21 },
+    { 0x2F831, 0x030D41, 0x030D41 },
+    { 0x2F832, 0x030D41, 0x030D41 },
+    { 0x2F833, 0x030D41, 0x030D41 },
+    { 0x2F834, 0x030D61, 0x030D61 },
+    { 0x2F835, 0x030D81, 0x030D81 },
+    { 0x2F836, 0x030DA1, 0x030DA1 },
+    { 0x2F837, 0x030DC1, 0x030DC1 },
+    { 0x2F838, 0x030DE1, 0x030DE1 },
+    { 0x2F839, 0x030E01, 0x030E01 },
+    { 0x2F83A, 0x030E21, 0x030E21 },
+    { 0x2F83B, 0x030E41, 0x030E41 },
+    { 0x2F83C, 0x030E61, 0x030E61 },
+    { 0x2F83D, 0x030E81, 0x030E81 },
+    { 0x2F83E, 0x030EA1, 0x030EA1 },
+    { 0x2F83F, 0x030EC1, 0x030EC1 },
+    { 0x2F840, 0x030EE1, 0x030EE1 },
+    { 0x2F841, 0x030F01, 0x030F01 },
+    { 0x2F842, 0x030F21, 0x030F21 },
+    { 0x2F843, 0x030F41, 0x030F41 },
+    { 0x2F844, 0x030F61, 0x030F61 },
+    { 0x2F845, 0x030F81, 0x030F81 },
+    { 0x2F846, 0x030F81, 0x030F81 },
+    { 0x2F847, 0x0258C1, 0x0258C1 },
+    { 0x2F848, 0x030FA1, 0x030FA1 },
+    { 0x2F849, 0x030FC1, 0x030FC1 },
+    { 0x2F84A, 0x030FE1, 0x030FE1 },
+    { 0x2F84B, 0x031001, 0x031001 },
+    { 0x2F84C, 0x025181, 0x025181 },
+    { 0x2F84D, 0x031021, 0x031021 },
+    { 0x2F84E, 0x031041, 0x031041 },
+    { 0x2F84F, 0x031061, 0x031061 },
+    { 0x2F850, 0x024C81, 0x024C81 },
+    { 0x2F851, 0x031081, 0x031081 },
+    { 0x2F852, 0x0310A1, 0x0310A1 },
+    { 0x2F853, 0x0310C1, 0x0310C1 },
+    { 0x2F854, 0x0310E1, 0x0310E1 },
+    { 0x2F855, 0x031101, 0x031101 },
+    { 0x2F856, 0x031121, 0x031121 },
+    { 0x2F857, 0x031141, 0x031141 },
+    { 0x2F858, 0x031161, 0x031161 },
+    { 0x2F859, 0x031181, 0x031181 },
+    { 0x2F85A, 0x0311A1, 0x0311A1 },
+    { 0x2F85B, 0x0311C1, 0x0311C1 },
+    { 0x2F85C, 0x0311E1, 0x0311E1 },
+    { 0x2F85D, 0x0301A1, 0x0301A1 },
+    { 0x2F85E, 0x031201, 0x031201 },
+    { 0x2F85F, 0x031221, 0x031221 },
+    { 0x2F860, 0x031241, 0x031241 },
+    { 0x2F861, 0x031261, 0x031261 },
+    { 0x2F862, 0x031281, 0x031281 },
+    { 0x2F863, 0x0312A1, 0x0312A1 },
+    { 0x2F864, 0x0312C1, 0x0312C1 },
+    { 0x2F865, 0x0312E1, 0x0312E1 },
+    { 0x2F866, 0x031301, 0x031301 },
+    { 0x2F867, 0x031321, 0x031321 },
+    { 0x2F868, 0x031341, 0x031341 },
+    { 0x2F869, 0x031361, 0x031361 },
+    { 0x2F86A, 0x031381, 0x031381 },
+    { 0x2F86B, 0x031381, 0x031381 },
+    { 0x2F86C, 0x0313A1, 0x0313A1 },
+    { 0x2F86D, 0x0313C1, 0x0313C1 },
+    { 0x2F86E, 0x0313E1, 0x0313E1 },
+    { 0x2F86F, 0x0239C1, 0x0239C1 },
+    { 0x2F870, 0x031401, 0x031401 },
+    { 0x2F871, 0x031421, 0x031421 },
+    { 0x2F872, 0x031441, 0x031441 },
+    { 0x2F873, 0x031461, 0x031461 },
+    { 0x2F874, 0x031481, 0x031481 },
+    { 0x2F875, 0x016361, 0x016361 },
+    { 0x2F876, 0x0314A1, 0x0314A1 },
+    { 0x2F877, 0x0314C1, 0x0314C1 },
+    { 0x2F878, 0x0163A1, 0x0163A1 },
+    { 0x2F879, 0x0314E1, 0x0314E1 },
+    { 0x2F87A, 0x031501, 0x031501 },
+    { 0x2F87B, 0x031521, 0x031521 },
+    { 0x2F87C, 0x031541, 0x031541 },
+    { 0x2F87D, 0x031561, 0x031561 },
+    { 0x2F87E, 0x031581, 0x031581 },
+    { 0x2F87F, 0x0315A1, 0x0315A1 },
+    { 0x2F880, 0x0315C1, 0x0315C1 },
+    { 0x2F881, 0x0315E1, 0x0315E1 },
+    { 0x2F882, 0x031601, 0x031601 },
+    { 0x2F883, 0x031621, 0x031621 },
+    { 0x2F884, 0x031641, 0x031641 },
+    { 0x2F885, 0x031661, 0x031661 },
+    { 0x2F886, 0x031681, 0x031681 },
+    { 0x2F887, 0x0316A1, 0x0316A1 },
+    { 0x2F888, 0x0316C1, 0x0316C1 },
+    { 0x2F889, 0x0316E1, 0x0316E1 },
+    { 0x2F88A, 0x031701, 0x031701 },
+    { 0x2F88B, 0x031721, 0x031721 },
+    { 0x2F88C, 0x031741, 0x031741 },
+    { 0x2F88D, 0x031761, 0x031761 },
+    { 0x2F88E, 0x023341, 0x023341 },
+    { 0x2F88F, 0x031781, 0x031781 },
+    { 0x2F890, 0x0164E1, 0x0164E1 },
+    { 0x2F891, 0x0317A1, 0x0317A1 },
+    { 0x2F892, 0x0317A1, 0x0317A1 },
+    { 0x2F893, 0x0317C1, 0x0317C1 },
+    { 0x2F894, 0x0317E1, 0x0317E1 },
+    { 0x2F895, 0x0317E1, 0x0317E1 },
+    { 0x2F896, 0x031801, 0x031801 },
+    { 0x2F897, 0x031821, 0x031821 },
+    { 0x2F898, 0x031841, 0x031841 },
+    { 0x2F899, 0x031861, 0x031861 },
+    { 0x2F89A, 0x031881, 0x031881 },
+    { 0x2F89B, 0x0318A1, 0x0318A1 },
+    { 0x2F89C, 0x0318C1, 0x0318C1 },
+    { 0x2F89D, 0x0318E1, 0x0318E1 },
+    { 0x2F89E, 0x031901, 0x031901 },
+    { 0x2F89F, 0x031921, 0x031921 },
+    { 0x2F8A0, 0x031941, 0x031941 },
+    { 0x2F8A1, 0x031961, 0x031961 },
+    { 0x2F8A2, 0x031981, 0x031981 },
+    { 0x2F8A3, 0x025221, 0x025221 },
+    { 0x2F8A4, 0x0319A1, 0x0319A1 },
+    { 0x2F8A5, 0x0319C1, 0x0319C1 },
+    { 0x2F8A6, 0x0319E1, 0x0319E1 },
+    { 0x2F8A7, 0x031A01, 0x031A01 },
+    { 0x2F8A8, 0x025A41, 0x025A41 },
+    { 0x2F8A9, 0x031A01, 0x031A01 },
+    { 0x2F8AA, 0x031A21, 0x031A21 },
+    { 0x2F8AB, 0x025261, 0x025261 },
+    { 0x2F8AC, 0x031A41, 0x031A41 },
+    { 0x2F8AD, 0x031A61, 0x031A61 },
+    { 0x2F8AE, 0x031A81, 0x031A81 },
+    { 0x2F8AF, 0x031AA1, 0x031AA1 },
+    { 0x2F8B0, 0x025281, 0x025281 },
+    { 0x2F8B1, 0x022FE1, 0x022FE1 },
+    { 0x2F8B2, 0x031AC1, 0x031AC1 },
+    { 0x2F8B3, 0x031AE1, 0x031AE1 },
+    { 0x2F8B4, 0x031B01, 0x031B01 },
+    { 0x2F8B5, 0x031B21, 0x031B21 },
+    { 0x2F8B6, 0x031B41, 0x031B41 },
+    { 0x2F8B7, 0x031B61, 0x031B61 },
+    { 0x2F8B8, 0x031B81, 0x031B81 },
+    { 0x2F8B9, 0x031BA1, 0x031BA1 },
+    { 0x2F8BA, 0x031BC1, 0x031BC1 },
+    { 0x2F8BB, 0x031BE1, 0x031BE1 },
+    { 0x2F8BC, 0x031C01, 0x031C01 },
+    { 0x2F8BD, 0x031C21, 0x031C21 },
+    { 0x2F8BE, 0x031C41, 0x031C41 },
+    { 0x2F8BF, 0x031C61, 0x031C61 },
+    { 0x2F8C0, 0x031C81, 0x031C81 },
+    { 0x2F8C1, 0x031CA1, 0x031CA1 },
+    { 0x2F8C2, 0x031CC1, 0x031CC1 },
+    { 0x2F8C3, 0x031CE1, 0x031CE1 },
+    { 0x2F8C4, 0x031D01, 0x031D01 },
+    { 0x2F8C5, 0x031D21, 0x031D21 },
+    { 0x2F8C6, 0x031D41, 0x031D41 },
+    { 0x2F8C7, 0x031D61, 0x031D61 },
+    { 0x2F8C8, 0x0252A1, 0x0252A1 },
+    { 0x2F8C9, 0x031D81, 0x031D81 },
+    { 0x2F8CA, 0x031DA1, 0x031DA1 },
+    { 0x2F8CB, 0x031DC1, 0x031DC1 },
+    { 0x2F8CC, 0x031DE1, 0x031DE1 },
+    { 0x2F8CD, 0x031E01, 0x031E01 },
+    { 0x2F8CE, 0x031E21, 0x031E21 },
+    { 0x2F8CF, 0x0252E1, 0x0252E1 },
+    { 0x2F8D0, 0x031E41, 0x031E41 },
+    { 0x2F8D1, 0x031E61, 0x031E61 },
+    { 0x2F8D2, 0x031E81, 0x031E81 },
+    { 0x2F8D3, 0x031EA1, 0x031EA1 },
+    { 0x2F8D4, 0x031EC1, 0x031EC1 },
+    { 0x2F8D5, 0x031EE1, 0x031EE1 },
+    { 0x2F8D6, 0x031F01, 0x031F01 },
+    { 0x2F8D7, 0x031F21, 0x031F21 },
+    { 0x2F8D8, 0x023361, 0x023361 },
+    { 0x2F8D9, 0x025B41, 0x025B41 },
+    { 0x2F8DA, 0x031F41, 0x031F41 },
+    { 0x2F8DB, 0x031F61, 0x031F61 },
+    { 0x2F8DC, 0x031F81, 0x031F81 },
+    { 0x2F8DD, 0x031FA1, 0x031FA1 },
+    { 0x2F8DE, 0x031FC1, 0x031FC1 },
+    { 0x2F8DF, 0x031FE1, 0x031FE1 },
+    { 0x2F8E0, 0x032001, 0x032001 },
+    { 0x2F8E1, 0x032021, 0x032021 },
+    { 0x2F8E2, 0x025301, 0x025301 },
+    { 0x2F8E3, 0x032041, 0x032041 },
+    { 0x2F8E4, 0x032061, 0x032061 },
+    { 0x2F8E5, 0x032081, 0x032081 },
+    { 0x2F8E6, 0x0320A1, 0x0320A1 },
+    { 0x2F8E7, 0x026081, 0x026081 },
+    { 0x2F8E8, 0x0320C1, 0x0320C1 },
+    { 0x2F8E9, 0x0320E1, 0x0320E1 },
+    { 0x2F8EA, 0x032101, 0x032101 },
+    { 0x2F8EB, 0x032121, 0x032121 },
+    { 0x2F8EC, 0x032141, 0x032141 },
+    { 0x2F8ED, 0x032161, 0x032161 },
+    { 0x2F8EE, 0x032181, 0x032181 },
+    { 0x2F8EF, 0x0321A1, 0x0321A1 },
+    { 0x2F8F0, 0x0321C1, 0x0321C1 },
+    { 0x2F8F1, 0x0321E1, 0x0321E1 },
+    { 0x2F8F2, 0x032201, 0x032201 },
+    { 0x2F8F3, 0x032221, 0x032221 },
+    { 0x2F8F4, 0x032241, 0x032241 },
+    { 0x2F8F5, 0x023BE1, 0x023BE1 },
+    { 0x2F8F6, 0x032261, 0x032261 },
+    { 0x2F8F7, 0x032281, 0x032281 },
+    { 0x2F8F8, 0x0322A1, 0x0322A1 },
+    { 0x2F8F9, 0x0322C1, 0x0322C1 },
+    { 0x2F8FA, 0x0322E1, 0x0322E1 },
+    { 0x2F8FB, 0x032301, 0x032301 },
+    { 0x2F8FC, 0x032321, 0x032321 },
+    { 0x2F8FD, 0x032341, 0x032341 },
+    { 0x2F8FE, 0x032361, 0x032361 },
+    { 0x2F8FF, 0x032381, 0x032381 },
+    { 0x2F900, 0x0323A1, 0x0323A1 },
+    { 0x2F901, 0x025321, 0x025321 },
+    { 0x2F902, 0x024641, 0x024641 },
+    { 0x2F903, 0x0323C1, 0x0323C1 },
+    { 0x2F904, 0x0323E1, 0x0323E1 },
+    { 0x2F905, 0x032401, 0x032401 },
+    { 0x2F906, 0x032421, 0x032421 },
+    { 0x2F907, 0x032441, 0x032441 },
+    { 0x2F908, 0x032461, 0x032461 },
+    { 0x2F909, 0x032481, 0x032481 },
+    { 0x2F90A, 0x0324A1, 0x0324A1 },
+    { 0x2F90B, 0x025BA1, 0x025BA1 },
+    { 0x2F90C, 0x0324C1, 0x0324C1 },
+    { 0x2F90D, 0x0324E1, 0x0324E1 },
+    { 0x2F90E, 0x032501, 0x032501 },
+    { 0x2F90F, 0x032521, 0x032521 },
+    { 0x2F910, 0x032541, 0x032541 },
+    { 0x2F911, 0x032561, 0x032561 },
+    { 0x2F912, 0x032581, 0x032581 },
+    { 0x2F913, 0x0325A1, 0x0325A1 },
+    { 0x2F914, 0x025BC1, 0x025BC1 },
+    { 0x2F915, 0x0325C1, 0x0325C1 },
+    { 0x2F916, 0x0325E1, 0x0325E1 },
+    { 0x2F917, 0x032601, 0x032601 },
+    { 0x2F918, 0x032621, 0x032621 },
+    { 0x2F919, 0x032641, 0x032641 },
+    { 0x2F91A, 0x032661, 0x032661 },
+    { 0x2F91B, 0x032681, 0x032681 },
+    { 0x2F91C, 0x0326A1, 0x0326A1 },
+    { 0x2F91D, 0x0326C1, 0x0326C1 },
+    { 0x2F91E, 0x0326E1, 0x0326E1 },
+    { 0x2F91F, 0x032701, 0x032701 },
+    { 0x2F920, 0x032721, 0x032721 },
+    { 0x2F921, 0x025C01, 0x025C01 },
+    { 0x2F922, 0x032741, 0x032741 },
+    { 0x2F923, 0x032761, 0x032761 },
+    { 0x2F924, 0x032781, 0x032781 },
+    { 0x2F925, 0x0327A1, 0x0327A1 },
+    { 0x2F926, 0x0327C1, 0x0327C1 },
+    { 0x2F927, 0x0327E1, 0x0327E1 },
+    { 0x2F928, 0x032801, 0x032801 },
+    { 0x2F929, 0x032821, 0x032821 },
+    { 0x2F92A, 0x032841, 0x032841 },
+    { 0x2F92B, 0x032861, 0x032861 },
+    { 0x2F92C, 0x032881, 0x032881 },
+    { 0x2F92D, 0x032881, 0x032881 },
+    { 0x2F92E, 0x0328A1, 0x0328A1 },
+    { 0x2F92F, 0x0328C1, 0x0328C1 },
+    { 0x2F930, 0x025C41, 0x025C41 },
+    { 0x2F931, 0x0328E1, 0x0328E1 },
+    { 0x2F932, 0x032901, 0x032901 },
+    { 0x2F933, 0x032921, 0x032921 },
+    { 0x2F934, 0x032941, 0x032941 },
+    { 0x2F935, 0x032961, 0x032961 },
+    { 0x2F936, 0x032981, 0x032981 },
+    { 0x2F937, 0x0329A1, 0x0329A1 },
+    { 0x2F938, 0x023A21, 0x023A21 },
+    { 0x2F939, 0x0329C1, 0x0329C1 },
+    { 0x2F93A, 0x0329E1, 0x0329E1 },
+    { 0x2F93B, 0x032A01, 0x032A01 },
+    { 0x2F93C, 0x032A21, 0x032A21 },
+    { 0x2F93D, 0x032A41, 0x032A41 },
+    { 0x2F93E, 0x032A61, 0x032A61 },
+    { 0x2F93F, 0x032A81, 0x032A81 },
+    { 0x2F940, 0x025D01, 0x025D01 },
+    { 0x2F941, 0x032AA1, 0x032AA1 },
+    { 0x2F942, 0x032AC1, 0x032AC1 },
+    { 0x2F943, 0x032AE1, 0x032AE1 },
+    { 0x2F944, 0x032B01, 0x032B01 },
+    { 0x2F945, 0x032B21, 0x032B21 },
+    { 0x2F946, 0x032B41, 0x032B41 },
+    { 0x2F947, 0x032B41, 0x032B41 },
+    { 0x2F948, 0x025D21, 0x025D21 },
+    { 0x2F949, 0x0260C1, 0x0260C1 },
+    { 0x2F94A, 0x032B61, 0x032B61 },
+    { 0x2F94B, 0x032B81, 0x032B81 },
+    { 0x2F94C, 0x032BA1, 0x032BA1 },
+    { 0x2F94D, 0x032BC1, 0x032BC1 },
+    { 0x2F94E, 0x032BE1, 0x032BE1 },
+    { 0x2F94F, 0x023581, 0x023581 },
+    { 0x2F950, 0x025D61, 0x025D61 },
+    { 0x2F951, 0x032C01, 0x032C01 },
+    { 0x2F952, 0x032C21, 0x032C21 },
+    { 0x2F953, 0x025461, 0x025461 },
+    { 0x2F954, 0x032C41, 0x032C41 },
+    { 0x2F955, 0x032C61, 0x032C61 },
+    { 0x2F956, 0x024F01, 0x024F01 },
+    { 0x2F957, 0x032C81, 0x032C81 },
+    { 0x2F958, 0x032CA1, 0x032CA1 },
+    { 0x2F959, 0x0254C1, 0x0254C1 },
+    { 0x2F95A, 0x032CC1, 0x032CC1 },
+    { 0x2F95B, 0x032CE1, 0x032CE1 },
+    { 0x2F95C, 0x032D01, 0x032D01 },
+    { 0x2F95D, 0x032D21, 0x032D21 },
+    { 0x2F95E, 0x032D21, 0x032D21 },
+    { 0x2F95F, 0x032D41, 0x032D41 },
+    { 0x2F960, 0x032D61, 0x032D61 },
+    { 0x2F961, 0x032D81, 0x032D81 },
+    { 0x2F962, 0x032DA1, 0x032DA1 },
+    { 0x2F963, 0x032DC1, 0x032DC1 },
+    { 0x2F964, 0x032DE1, 0x032DE1 },
+    { 0x2F965, 0x032E01, 0x032E01 },
+    { 0x2F966, 0x032E21, 0x032E21 },
+    { 0x2F967, 0x032E41, 0x032E41 },
+    { 0x2F968, 0x032E61, 0x032E61 },
+    { 0x2F969, 0x032E81, 0x032E81 },
+    { 0x2F96A, 0x032EA1, 0x032EA1 },
+    { 0x2F96B, 0x032EC1, 0x032EC1 },
+    { 0x2F96C, 0x032EE1, 0x032EE1 },
+    { 0x2F96D, 0x032F01, 0x032F01 },
+    { 0x2F96E, 0x032F21, 0x032F21 },
+    { 0x2F96F, 0x032F41, 0x032F41 },
+    { 0x2F970, 0x032F61, 0x032F61 },
+    { 0x2F971, 0x032F81, 0x032F81 },
+    { 0x2F972, 0x032FA1, 0x032FA1 },
+    { 0x2F973, 0x032FC1, 0x032FC1 },
+    { 0x2F974, 0x032FE1, 0x032FE1 },
+    { 0x2F975, 0x033001, 0x033001 },
+    { 0x2F976, 0x033021, 0x033021 },
+    { 0x2F977, 0x033041, 0x033041 },
+    { 0x2F978, 0x033061, 0x033061 },
+    { 0x2F979, 0x033081, 0x033081 },
+    { 0x2F97A, 0x025581, 0x025581 },
+    { 0x2F97B, 0x0330A1, 0x0330A1 },
+    { 0x2F97C, 0x0330C1, 0x0330C1 },
+    { 0x2F97D, 0x0330E1, 0x0330E1 },
+    { 0x2F97E, 0x033101, 0x033101 },
+    { 0x2F97F, 0x033121, 0x033121 },
+    { 0x2F980, 0x033141, 0x033141 },
+    { 0x2F981, 0x033161, 0x033161 },
+    { 0x2F982, 0x033181, 0x033181 },
+    { 0x2F983, 0x0331A1, 0x0331A1 },
+    { 0x2F984, 0x0331C1, 0x0331C1 },
+    { 0x2F985, 0x0331E1, 0x0331E1 },
+    { 0x2F986, 0x033201, 0x033201 },
+    { 0x2F987, 0x033221, 0x033221 },
+    { 0x2F988, 0x033241, 0x033241 },
+    { 0x2F989, 0x033261, 0x033261 },
+    { 0x2F98A, 0x033281, 0x033281 },
+    { 0x2F98B, 0x0317C1, 0x0317C1 },
+    { 0x2F98C, 0x0332A1, 0x0332A1 },
+    { 0x2F98D, 0x0332C1, 0x0332C1 },
+    { 0x2F98E, 0x0332E1, 0x0332E1 },
+    { 0x2F98F, 0x033301, 0x033301 },
+    { 0x2F990, 0x033321, 0x033321 },
+    { 0x2F991, 0x033341, 0x033341 },
+    { 0x2F992, 0x033361, 0x033361 },
+    { 0x2F993, 0x033381, 0x033381 },
+    { 0x2F994, 0x0333A1, 0x0333A1 },
+    { 0x2F995, 0x0333C1, 0x0333C1 },
+    { 0x2F996, 0x0333E1, 0x0333E1 },
+    { 0x2F997, 0x033401, 0x033401 },
+    { 0x2F998, 0x023C41, 0x023C41 },
+    { 0x2F999, 0x033421, 0x033421 },
+    { 0x2F99A, 0x033441, 0x033441 },
+    { 0x2F99B, 0x033461, 0x033461 },
+    { 0x2F99C, 0x033481, 0x033481 },
+    { 0x2F99D, 0x0334A1, 0x0334A1 },
+    { 0x2F99E, 0x0334C1, 0x0334C1 },
+    { 0x2F99F, 0x0255E1, 0x0255E1 },
+    { 0x2F9A0, 0x0334E1, 0x0334E1 },
+    { 0x2F9A1, 0x033501, 0x033501 },
+    { 0x2F9A2, 0x033521, 0x033521 },
+    { 0x2F9A3, 0x033541, 0x033541 },
+    { 0x2F9A4, 0x033561, 0x033561 },
+    { 0x2F9A5, 0x033581, 0x033581 },
+    { 0x2F9A6, 0x0335A1, 0x0335A1 },
+    { 0x2F9A7, 0x0335C1, 0x0335C1 },
+    { 0x2F9A8, 0x0335E1, 0x0335E1 },
+    { 0x2F9A9, 0x033601, 0x033601 },
+    { 0x2F9AA, 0x033621, 0x033621 },
+    { 0x2F9AB, 0x033641, 0x033641 },
+    { 0x2F9AC, 0x033661, 0x033661 },
+    { 0x2F9AD, 0x033681, 0x033681 },
+    { 0x2F9AE, 0x0336A1, 0x0336A1 },
+    { 0x2F9AF, 0x0336C1, 0x0336C1 },
+    { 0x2F9B0, 0x0336E1, 0x0336E1 },
+    { 0x2F9B1, 0x033701, 0x033701 },
+    { 0x2F9B2, 0x033721, 0x033721 },
+    { 0x2F9B3, 0x033741, 0x033741 },
+    { 0x2F9B4, 0x0234E1, 0x0234E1 },
+    { 0x2F9B5, 0x033761, 0x033761 },
+    { 0x2F9B6, 0x033781, 0x033781 },
+    { 0x2F9B7, 0x0337A1, 0x0337A1 },
+    { 0x2F9B8, 0x0337C1, 0x0337C1 },
+    { 0x2F9B9, 0x0337E1, 0x0337E1 },
+    { 0x2F9BA, 0x033801, 0x033801 },
+    { 0x2F9BB, 0x025E41, 0x025E41 },
+    { 0x2F9BC, 0x033821, 0x033821 },
+    { 0x2F9BD, 0x033841, 0x033841 },
+    { 0x2F9BE, 0x033861, 0x033861 },
+    { 0x2F9BF, 0x033881, 0x033881 },
+    { 0x2F9C0, 0x0338A1, 0x0338A1 },
+    { 0x2F9C1, 0x0338C1, 0x0338C1 },
+    { 0x2F9C2, 0x0338E1, 0x0338E1 },
+    { 0x2F9C3, 0x033901, 0x033901 },
+    { 0x2F9C4, 0x017021, 0x017021 },
+    { 0x2F9C5, 0x033921, 0x033921 },
+    { 0x2F9C6, 0x033941, 0x033941 },
+    { 0x2F9C7, 0x033961, 0x033961 },
+    { 0x2F9C8, 0x033981, 0x033981 },
+    { 0x2F9C9, 0x0339A1, 0x0339A1 },
+    { 0x2F9CA, 0x0339C1, 0x0339C1 },
+    { 0x2F9CB, 0x0339E1, 0x0339E1 },
+    { 0x2F9CC, 0x033A01, 0x033A01 },
+    { 0x2F9CD, 0x033A21, 0x033A21 },
+    { 0x2F9CE, 0x033A41, 0x033A41 },
+    { 0x2F9CF, 0x033A61, 0x033A61 },
+    { 0x2F9D0, 0x025EE1, 0x025EE1 },
+    { 0x2F9D1, 0x025F01, 0x025F01 },
+    { 0x2F9D2, 0x017101, 0x017101 },
+    { 0x2F9D3, 0x033A81, 0x033A81 },
+    { 0x2F9D4, 0x033AA1, 0x033AA1 },
+    { 0x2F9D5, 0x033AC1, 0x033AC1 },
+    { 0x2F9D6, 0x033AE1, 0x033AE1 },
+    { 0x2F9D7, 0x033B01, 0x033B01 },
+    { 0x2F9D8, 0x033B21, 0x033B21 },
+    { 0x2F9D9, 0x033B41, 0x033B41 },
+    { 0x2F9DA, 0x033B61, 0x033B61 },
+    { 0x2F9DB, 0x033B81, 0x033B81 },
+    { 0x2F9DC, 0x033BA1, 0x033BA1 },
+    { 0x2F9DD, 0x033BC1, 0x033BC1 },
+    { 0x2F9DE, 0x033BE1, 0x033BE1 },
+    { 0x2F9DF, 0x025F21, 0x025F21 },
+    { 0x2F9E0, 0x033C01, 0x033C01 },
+    { 0x2F9E1, 0x033C21, 0x033C21 },
+    { 0x2F9E2, 0x033C41, 0x033C41 },
+    { 0x2F9E3, 0x033C61, 0x033C61 },
+    { 0x2F9E4, 0x033C81, 0x033C81 },
+    { 0x2F9E5, 0x033CA1, 0x033CA1 },
+    { 0x2F9E6, 0x033CC1, 0x033CC1 },
+    { 0x2F9E7, 0x033CE1, 0x033CE1 },
+    { 0x2F9E8, 0x033D01, 0x033D01 },
+    { 0x2F9E9, 0x033D21, 0x033D21 },
+    { 0x2F9EA, 0x033D41, 0x033D41 },
+    { 0x2F9EB, 0x033D61, 0x033D61 },
+    { 0x2F9EC, 0x033D81, 0x033D81 },
+    { 0x2F9ED, 0x033DA1, 0x033DA1 },
+    { 0x2F9EE, 0x033DC1, 0x033DC1 },
+    { 0x2F9EF, 0x033DE1, 0x033DE1 },
+    { 0x2F9F0, 0x033E01, 0x033E01 },
+    { 0x2F9F1, 0x033E21, 0x033E21 },
+    { 0x2F9F2, 0x033E41, 0x033E41 },
+    { 0x2F9F3, 0x033E61, 0x033E61 },
+    { 0x2F9F4, 0x033E81, 0x033E81 },
+    { 0x2F9F5, 0x033EA1, 0x033EA1 },
+    { 0x2F9F6, 0x033EC1, 0x033EC1 },
+    { 0x2F9F7, 0x033EE1, 0x033EE1 },
+    { 0x2F9F8, 0x033F01, 0x033F01 },
+    { 0x2F9F9, 0x033F21, 0x033F21 },
+    { 0x2F9FA, 0x033F41, 0x033F41 },
+    { 0x2F9FB, 0x033F61, 0x033F61 },
+    { 0x2F9FC, 0x033F81, 0x033F81 },
+    { 0x2F9FD, 0x033FA1, 0x033FA1 },
+    { 0x2F9FE, 0x025FE1, 0x025FE1 },
+    { 0x2F9FF, 0x025FE1, 0x025FE1 },
+    { 0x2FA00, 0x033FC1, 0x033FC1 },
+    { 0x2FA01, 0x033FE1, 0x033FE1 },
+    { 0x2FA02, 0x034001, 0x034001 },
+    { 0x2FA03, 0x034021, 0x034021 },
+    { 0x2FA04, 0x034041, 0x034041 },
+    { 0x2FA05, 0x034061, 0x034061 },
+    { 0x2FA06, 0x034081, 0x034081 },
+    { 0x2FA07, 0x0340A1, 0x0340A1 },
+    { 0x2FA08, 0x0340C1, 0x0340C1 },
+    { 0x2FA09, 0x0340E1, 0x0340E1 },
+    { 0x2FA0A, 0x026001, 0x026001 },
+    { 0x2FA0B, 0x034101, 0x034101 },
+    { 0x2FA0C, 0x034121, 0x034121 },
+    { 0x2FA0D, 0x034141, 0x034141 },
+    { 0x2FA0E, 0x034161, 0x034161 },
+    { 0x2FA0F, 0x034181, 0x034181 },
+    { 0x2FA10, 0x0341A1, 0x0341A1 },
+    { 0x2FA11, 0x0341C1, 0x0341C1 },
+    { 0x2FA12, 0x0341E1, 0x0341E1 },
+    { 0x2FA13, 0x034201, 0x034201 },
+    { 0x2FA14, 0x034221, 0x034221 },
+    { 0x2FA15, 0x017701, 0x017701 },
+    { 0x2FA16, 0x034241, 0x034241 },
+    { 0x2FA17, 0x017781, 0x017781 },
+    { 0x2FA18, 0x034261, 0x034261 },
+    { 0x2FA19, 0x034281, 0x034281 },
+    { 0x2FA1A, 0x0342A1, 0x0342A1 },
+    { 0x2FA1B, 0x0342C1, 0x0342C1 },
+    { 0x2FA1C, 0x017821, 0x017821 },
+    { 0x2FA1D, 0x0342E1, 0x0342E1 }
+};
+
+static const UtilInternal::UTF32 decompositionData[6680] =
+{
+    0x00020, 0x00020, 0x00308, 0x00061, 0x00020, 0x00304, 0x00032, 0x00033,
+    0x00020, 0x00301, 0x003BC, 0x00020, 0x00327, 0x00031, 0x0006F, 0x00031,
+    0x02044, 0x00034, 0x00031, 0x02044, 0x00032, 0x00033, 0x02044, 0x00034,
+    0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+    0x00041, 0x00308, 0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300,
+    0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+    0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303,
+    0x0004F, 0x00300, 0x0004F, 0x00301, 0x0004F, 0x00302, 0x0004F, 0x00303,
+    0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+    0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+    0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030A,
+    0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+    0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+    0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300, 0x0006F, 0x00301,
+    0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+    0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+    0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+    0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+    0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+    0x00063, 0x00307, 0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C,
+    0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+    0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+    0x00065, 0x00328, 0x00045, 0x0030C, 0x00065, 0x0030C, 0x00047, 0x00302,
+    0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+    0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+    0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+    0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+    0x00069, 0x00328, 0x00049, 0x00307, 0x00049, 0x0004A, 0x00069, 0x0006A,
+    0x0004A, 0x00302, 0x0006A, 0x00302, 0x0004B, 0x00327, 0x0006B, 0x00327,
+    0x0004C, 0x00301, 0x0006C, 0x00301, 0x0004C, 0x00327, 0x0006C, 0x00327,
+    0x0004C, 0x0030C, 0x0006C, 0x0030C, 0x0004C, 0x000B7, 0x0006C, 0x000B7,
+    0x0004E, 0x00301, 0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327,
+    0x0004E, 0x0030C, 0x0006E, 0x0030C, 0x002BC, 0x0006E, 0x0004F, 0x00304,
+    0x0006F, 0x00304, 0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B,
+    0x0006F, 0x0030B, 0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327,
+    0x00072, 0x00327, 0x00052, 0x0030C, 0x00072, 0x0030C, 0x00053, 0x00301,
+    0x00073, 0x00301, 0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327,
+    0x00073, 0x00327, 0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327,
+    0x00074, 0x00327, 0x00054, 0x0030C, 0x00074, 0x0030C, 0x00055, 0x00303,
+    0x00075, 0x00303, 0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306,
+    0x00075, 0x00306, 0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B,
+    0x00075, 0x0030B, 0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302,
+    0x00077, 0x00302, 0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308,
+    0x0005A, 0x00301, 0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307,
+    0x0005A, 0x0030C, 0x0007A, 0x0030C, 0x00073, 0x0004F, 0x0031B, 0x0006F,
+    0x0031B, 0x00055, 0x0031B, 0x00075, 0x0031B, 0x00044, 0x0005A, 0x0030C,
+    0x00044, 0x0007A, 0x0030C, 0x00064, 0x0007A, 0x0030C, 0x0004C, 0x0004A,
+    0x0004C, 0x0006A, 0x0006C, 0x0006A, 0x0004E, 0x0004A, 0x0004E, 0x0006A,
+    0x0006E, 0x0006A, 0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C,
+    0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C,
+    0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+    0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+    0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075,
+    0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+    0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+    0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C,
+    0x0006B, 0x0030C, 0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328,
+    0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C,
+    0x0006A, 0x0030C, 0x00044, 0x0005A, 0x00044, 0x0007A, 0x00064, 0x0007A,
+    0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300, 0x0006E, 0x00300,
+    0x00041, 0x0030A, 0x00301, 0x00061, 0x0030A, 0x00301, 0x000C6, 0x00301,
+    0x000E6, 0x00301, 0x000D8, 0x00301, 0x000F8, 0x00301, 0x00041, 0x0030F,
+    0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311, 0x00045, 0x0030F,
+    0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311, 0x00049, 0x0030F,
+    0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311, 0x0004F, 0x0030F,
+    0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311, 0x00052, 0x0030F,
+    0x00072, 0x0030F, 0x00052, 0x00311, 0x00072, 0x00311, 0x00055, 0x0030F,
+    0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311, 0x00053, 0x00326,
+    0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326, 0x00048, 0x0030C,
+    0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307, 0x00045, 0x00327,
+    0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F, 0x00308, 0x00304,
+    0x0004F, 0x00303, 0x00304, 0x0006F, 0x00303, 0x00304, 0x0004F, 0x00307,
+    0x0006F, 0x00307, 0x0004F, 0x00307, 0x00304, 0x0006F, 0x00307, 0x00304,
+    0x00059, 0x00304, 0x00079, 0x00304, 0x00068, 0x00266, 0x0006A, 0x00072,
+    0x00279, 0x0027B, 0x00281, 0x00077, 0x00079, 0x00020, 0x00306, 0x00020,
+    0x00307, 0x00020, 0x0030A, 0x00020, 0x00328, 0x00020, 0x00303, 0x00020,
+    0x0030B, 0x00263, 0x0006C, 0x00078, 0x00295, 0x00300, 0x00301, 0x00313,
+    0x00308, 0x00301, 0x002B9, 0x00020, 0x00345, 0x0003B, 0x000A8, 0x00301,
+    0x00020, 0x00308, 0x00301, 0x00391, 0x00301, 0x000B7, 0x00395, 0x00301,
+    0x00397, 0x00301, 0x00399, 0x00301, 0x0039F, 0x00301, 0x003A5, 0x00301,
+    0x003A9, 0x00301, 0x003B9, 0x00308, 0x00301, 0x00399, 0x00308, 0x003A5,
+    0x00308, 0x003B1, 0x00301, 0x003B5, 0x00301, 0x003B7, 0x00301, 0x003B9,
+    0x00301, 0x003C5, 0x00308, 0x00301, 0x003B9, 0x00308, 0x003C5, 0x00308,
+    0x003BF, 0x00301, 0x003C5, 0x00301, 0x003C9, 0x00301, 0x003B2, 0x003B8,
+    0x003A5, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x003C6, 0x003C0, 0x003BA,
+    0x003C1, 0x003C2, 0x00398, 0x003B5, 0x003A3, 0x00415, 0x00300, 0x00415,
+    0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041A, 0x00301, 0x00418,
+    0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306, 0x00435,
+    0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308, 0x0043A,
+    0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F, 0x00475,
+    0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306, 0x00430,
+    0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306, 0x00435,
+    0x00306, 0x004D8, 0x00308, 0x004D9, 0x00308, 0x00416, 0x00308, 0x00436,
+    0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304, 0x00438,
+    0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308, 0x0043E,
+    0x00308, 0x004E8, 0x00308, 0x004E9, 0x00308, 0x0042D, 0x00308, 0x0044D,
+    0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308, 0x00443,
+    0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308, 0x00447,
+    0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00565, 0x00582, 0x00627,
+    0x00653, 0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A,
+    0x00654, 0x00627, 0x00674, 0x00648, 0x00674, 0x006C7, 0x00674, 0x0064A,
+    0x00674, 0x006D5, 0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928,
+    0x0093C, 0x00930, 0x0093C, 0x00933, 0x0093C, 0x00915, 0x0093C, 0x00916,
+    0x0093C, 0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922,
+    0x0093C, 0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7,
+    0x009D7, 0x009A1, 0x009BC, 0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32,
+    0x00A3C, 0x00A38, 0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C,
+    0x00A3C, 0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E, 0x00B47,
+    0x00B57, 0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92, 0x00BD7, 0x00BC6,
+    0x00BBE, 0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF,
+    0x00CD5, 0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6,
+    0x00CC2, 0x00CD5, 0x00D46, 0x00D3E, 0x00D47, 0x00D3E, 0x00D46, 0x00D57,
+    0x00DD9, 0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9,
+    0x00DDF, 0x00E4D, 0x00E32, 0x00ECD, 0x00EB2, 0x00EAB, 0x00E99, 0x00EAB,
+    0x00EA1, 0x00F0B, 0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7,
+    0x00F56, 0x00FB7, 0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72,
+    0x00F71, 0x00F74, 0x00FB2, 0x00F80, 0x00FB2, 0x00F71, 0x00F80, 0x00FB3,
+    0x00F80, 0x00FB3, 0x00F71, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7,
+    0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7,
+    0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x010DC, 0x01B05, 0x01B35, 0x01B07,
+    0x01B35, 0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11,
+    0x01B35, 0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F,
+    0x01B35, 0x01B42, 0x01B35, 0x00041, 0x000C6, 0x00042, 0x00044, 0x00045,
+    0x0018E, 0x00047, 0x00048, 0x00049, 0x0004A, 0x0004B, 0x0004C, 0x0004D,
+    0x0004E, 0x0004F, 0x00222, 0x00050, 0x00052, 0x00054, 0x00055, 0x00057,
+    0x00250, 0x00251, 0x01D02, 0x00062, 0x00064, 0x00065, 0x00259, 0x0025B,
+    0x0025C, 0x00067, 0x0006B, 0x0006D, 0x0014B, 0x00254, 0x01D16, 0x01D17,
+    0x00070, 0x00074, 0x00075, 0x01D1D, 0x0026F, 0x00076, 0x01D25, 0x003B3,
+    0x003B4, 0x003C7, 0x00069, 0x0043D, 0x00252, 0x00063, 0x00255, 0x000F0,
+    0x00066, 0x0025F, 0x00261, 0x00265, 0x00268, 0x00269, 0x0026A, 0x01D7B,
+    0x0029D, 0x0026D, 0x01D85, 0x0029F, 0x00271, 0x00270, 0x00272, 0x00273,
+    0x00274, 0x00275, 0x00278, 0x00282, 0x00283, 0x001AB, 0x00289, 0x0028A,
+    0x01D1C, 0x0028B, 0x0028C, 0x0007A, 0x00290, 0x00291, 0x00292, 0x00041,
+    0x00325, 0x00061, 0x00325, 0x00042, 0x00307, 0x00062, 0x00307, 0x00042,
+    0x00323, 0x00062, 0x00323, 0x00042, 0x00331, 0x00062, 0x00331, 0x00043,
+    0x00327, 0x00301, 0x00063, 0x00327, 0x00301, 0x00044, 0x00307, 0x00064,
+    0x00307, 0x00044, 0x00323, 0x00064, 0x00323, 0x00044, 0x00331, 0x00064,
+    0x00331, 0x00044, 0x00327, 0x00064, 0x00327, 0x00044, 0x0032D, 0x00064,
+    0x0032D, 0x00045, 0x00304, 0x00300, 0x00065, 0x00304, 0x00300, 0x00045,
+    0x00304, 0x00301, 0x00065, 0x00304, 0x00301, 0x00045, 0x0032D, 0x00065,
+    0x0032D, 0x00045, 0x00330, 0x00065, 0x00330, 0x00045, 0x00327, 0x00306,
+    0x00065, 0x00327, 0x00306, 0x00046, 0x00307, 0x00066, 0x00307, 0x00047,
+    0x00304, 0x00067, 0x00304, 0x00048, 0x00307, 0x00068, 0x00307, 0x00048,
+    0x00323, 0x00068, 0x00323, 0x00048, 0x00308, 0x00068, 0x00308, 0x00048,
+    0x00327, 0x00068, 0x00327, 0x00048, 0x0032E, 0x00068, 0x0032E, 0x00049,
+    0x00330, 0x00069, 0x00330, 0x00049, 0x00308, 0x00301, 0x00069, 0x00308,
+    0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301, 0x0004B, 0x00323, 0x0006B,
+    0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331, 0x0004C, 0x00323, 0x0006C,
+    0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C, 0x00323, 0x00304, 0x0004C,
+    0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D, 0x0006C, 0x0032D, 0x0004D,
+    0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307, 0x0006D, 0x00307, 0x0004D,
+    0x00323, 0x0006D, 0x00323, 0x0004E, 0x00307, 0x0006E, 0x00307, 0x0004E,
+    0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331, 0x0006E, 0x00331, 0x0004E,
+    0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303, 0x00301, 0x0006F, 0x00303,
+    0x00301, 0x0004F, 0x00303, 0x00308, 0x0006F, 0x00303, 0x00308, 0x0004F,
+    0x00304, 0x00300, 0x0006F, 0x00304, 0x00300, 0x0004F, 0x00304, 0x00301,
+    0x0006F, 0x00304, 0x00301, 0x00050, 0x00301, 0x00070, 0x00301, 0x00050,
+    0x00307, 0x00070, 0x00307, 0x00052, 0x00307, 0x00072, 0x00307, 0x00052,
+    0x00323, 0x00072, 0x00323, 0x00052, 0x00323, 0x00304, 0x00072, 0x00323,
+    0x00304, 0x00052, 0x00331, 0x00072, 0x00331, 0x00053, 0x00307, 0x00073,
+    0x00307, 0x00053, 0x00323, 0x00073, 0x00323, 0x00053, 0x00301, 0x00307,
+    0x00073, 0x00301, 0x00307, 0x00053, 0x0030C, 0x00307, 0x00073, 0x0030C,
+    0x00307, 0x00053, 0x00323, 0x00307, 0x00073, 0x00323, 0x00307, 0x00054,
+    0x00307, 0x00074, 0x00307, 0x00054, 0x00323, 0x00074, 0x00323, 0x00054,
+    0x00331, 0x00074, 0x00331, 0x00054, 0x0032D, 0x00074, 0x0032D, 0x00055,
+    0x00324, 0x00075, 0x00324, 0x00055, 0x00330, 0x00075, 0x00330, 0x00055,
+    0x0032D, 0x00075, 0x0032D, 0x00055, 0x00303, 0x00301, 0x00075, 0x00303,
+    0x00301, 0x00055, 0x00304, 0x00308, 0x00075, 0x00304, 0x00308, 0x00056,
+    0x00303, 0x00076, 0x00303, 0x00056, 0x00323, 0x00076, 0x00323, 0x00057,
+    0x00300, 0x00077, 0x00300, 0x00057, 0x00301, 0x00077, 0x00301, 0x00057,
+    0x00308, 0x00077, 0x00308, 0x00057, 0x00307, 0x00077, 0x00307, 0x00057,
+    0x00323, 0x00077, 0x00323, 0x00058, 0x00307, 0x00078, 0x00307, 0x00058,
+    0x00308, 0x00078, 0x00308, 0x00059, 0x00307, 0x00079, 0x00307, 0x0005A,
+    0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323, 0x0007A, 0x00323, 0x0005A,
+    0x00331, 0x0007A, 0x00331, 0x00068, 0x00331, 0x00074, 0x00308, 0x00077,
+    0x0030A, 0x00079, 0x0030A, 0x00061, 0x002BE, 0x0017F, 0x00307, 0x00041,
+    0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309, 0x00041,
+    0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302, 0x00300,
+    0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061, 0x00302,
+    0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303, 0x00041,
+    0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306, 0x00301,
+    0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061, 0x00306,
+    0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309, 0x00041,
+    0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323, 0x00306,
+    0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323, 0x00045,
+    0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303, 0x00045,
+    0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302, 0x00300,
+    0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065, 0x00302,
+    0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303, 0x00045,
+    0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309, 0x00069,
+    0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004F, 0x00323, 0x0006F,
+    0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302, 0x00301,
+    0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F, 0x00302,
+    0x00300, 0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302, 0x00309, 0x0004F,
+    0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323, 0x00302,
+    0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F, 0x0031B,
+    0x00301, 0x0004F, 0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300, 0x0004F,
+    0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B, 0x00303,
+    0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F, 0x0031B,
+    0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309, 0x00075,
+    0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301, 0x00055,
+    0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B, 0x00309,
+    0x00075, 0x0031B, 0x00309, 0x00055, 0x0031B, 0x00303, 0x00075, 0x0031B,
+    0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323, 0x00059,
+    0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323, 0x00059,
+    0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303, 0x003B1,
+    0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1, 0x00314,
+    0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301, 0x003B1,
+    0x00313, 0x00342, 0x003B1, 0x00314, 0x00342, 0x00391, 0x00313, 0x00391,
+    0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300, 0x00391,
+    0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313, 0x00342,
+    0x00391, 0x00314, 0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314, 0x003B5,
+    0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313, 0x00301,
+    0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314, 0x00395,
+    0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313, 0x00301,
+    0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314, 0x003B7,
+    0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313, 0x00301,
+    0x003B7, 0x00314, 0x00301, 0x003B7, 0x00313, 0x00342, 0x003B7, 0x00314,
+    0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313, 0x00300,
+    0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397, 0x00314,
+    0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342, 0x003B9,
+    0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9, 0x00314,
+    0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301, 0x003B9,
+    0x00313, 0x00342, 0x003B9, 0x00314, 0x00342, 0x00399, 0x00313, 0x00399,
+    0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300, 0x00399,
+    0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313, 0x00342,
+    0x00399, 0x00314, 0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314, 0x003BF,
+    0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313, 0x00301,
+    0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314, 0x0039F,
+    0x00313, 0x00300, 0x0039F, 0x00314, 0x00300, 0x0039F, 0x00313, 0x00301,
+    0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314, 0x003C5,
+    0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313, 0x00301,
+    0x003C5, 0x00314, 0x00301, 0x003C5, 0x00313, 0x00342, 0x003C5, 0x00314,
+    0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5, 0x00314,
+    0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9, 0x00314,
+    0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314, 0x00300, 0x003C9, 0x00313,
+    0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342, 0x003C9,
+    0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9, 0x00313,
+    0x00300, 0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313, 0x00301, 0x003A9,
+    0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314, 0x00342,
+    0x003B1, 0x00300, 0x003B5, 0x00300, 0x003B7, 0x00300, 0x003B9, 0x00300,
+    0x003BF, 0x00300, 0x003C5, 0x00300, 0x003C9, 0x00300, 0x003B1, 0x00313,
+    0x00345, 0x003B1, 0x00314, 0x00345, 0x003B1, 0x00313, 0x00300, 0x00345,
+    0x003B1, 0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301, 0x00345,
+    0x003B1, 0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342, 0x00345,
+    0x003B1, 0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345, 0x00391,
+    0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391, 0x00314,
+    0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391, 0x00314,
+    0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391, 0x00314,
+    0x00342, 0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314, 0x00345,
+    0x003B7, 0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300, 0x00345,
+    0x003B7, 0x00313, 0x00301, 0x00345, 0x003B7, 0x00314, 0x00301, 0x00345,
+    0x003B7, 0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342, 0x00345,
+    0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313,
+    0x00300, 0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397, 0x00313,
+    0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397, 0x00313,
+    0x00342, 0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9, 0x00313,
+    0x00345, 0x003C9, 0x00314, 0x00345, 0x003C9, 0x00313, 0x00300, 0x00345,
+    0x003C9, 0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301, 0x00345,
+    0x003C9, 0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342, 0x00345,
+    0x003C9, 0x00314, 0x00342, 0x00345, 0x003A9, 0x00313, 0x00345, 0x003A9,
+    0x00314, 0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9, 0x00314,
+    0x00300, 0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9, 0x00314,
+    0x00301, 0x00345, 0x003A9, 0x00313, 0x00342, 0x00345, 0x003A9, 0x00314,
+    0x00342, 0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1, 0x00300,
+    0x00345, 0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1, 0x00342,
+    0x003B1, 0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304, 0x00391,
+    0x00300, 0x00391, 0x00345, 0x00020, 0x00313, 0x003B9, 0x00020, 0x00342,
+    0x000A8, 0x00342, 0x00020, 0x00308, 0x00342, 0x003B7, 0x00300, 0x00345,
+    0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7, 0x00342, 0x003B7,
+    0x00342, 0x00345, 0x00395, 0x00300, 0x00397, 0x00300, 0x00397, 0x00345,
+    0x01FBF, 0x00300, 0x00020, 0x00313, 0x00300, 0x01FBF, 0x00301, 0x00020,
+    0x00313, 0x00301, 0x01FBF, 0x00342, 0x00020, 0x00313, 0x00342, 0x003B9,
+    0x00306, 0x003B9, 0x00304, 0x003B9, 0x00308, 0x00300, 0x003B9, 0x00342,
+    0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399,
+    0x00300, 0x01FFE, 0x00300, 0x00020, 0x00314, 0x00300, 0x01FFE, 0x00301,
+    0x00020, 0x00314, 0x00301, 0x01FFE, 0x00342, 0x00020, 0x00314, 0x00342,
+    0x003C5, 0x00306, 0x003C5, 0x00304, 0x003C5, 0x00308, 0x00300, 0x003C1,
+    0x00313, 0x003C1, 0x00314, 0x003C5, 0x00342, 0x003C5, 0x00308, 0x00342,
+    0x003A5, 0x00306, 0x003A5, 0x00304, 0x003A5, 0x00300, 0x003A1, 0x00314,
+    0x000A8, 0x00300, 0x00020, 0x00308, 0x00300, 0x00060, 0x003C9, 0x00300,
+    0x00345, 0x003C9, 0x00345, 0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342,
+    0x003C9, 0x00342, 0x00345, 0x0039F, 0x00300, 0x003A9, 0x00300, 0x003A9,
+    0x00345, 0x000B4, 0x00020, 0x00314, 0x02002, 0x02003, 0x02010, 0x00020,
+    0x00333, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x02032,
+    0x02032, 0x02032, 0x02032, 0x02032, 0x02035, 0x02035, 0x02035, 0x02035,
+    0x02035, 0x00021, 0x00021, 0x00020, 0x00305, 0x0003F, 0x0003F, 0x0003F,
+    0x00021, 0x00021, 0x0003F, 0x02032, 0x02032, 0x02032, 0x02032, 0x00030,
+    0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039, 0x0002B, 0x02212,
+    0x0003D, 0x00028, 0x00029, 0x0006E, 0x00052, 0x00073, 0x00061, 0x0002F,
+    0x00063, 0x00061, 0x0002F, 0x00073, 0x00043, 0x000B0, 0x00043, 0x00063,
+    0x0002F, 0x0006F, 0x00063, 0x0002F, 0x00075, 0x00190, 0x000B0, 0x00046,
+    0x00127, 0x0004E, 0x0006F, 0x00051, 0x00053, 0x0004D, 0x00054, 0x00045,
+    0x0004C, 0x00054, 0x0004D, 0x0005A, 0x003A9, 0x00046, 0x005D0, 0x005D1,
+    0x005D2, 0x005D3, 0x00046, 0x00041, 0x00058, 0x00393, 0x003A0, 0x02211,
+    0x00031, 0x02044, 0x00037, 0x00031, 0x02044, 0x00039, 0x00031, 0x02044,
+    0x00031, 0x00030, 0x00031, 0x02044, 0x00033, 0x00032, 0x02044, 0x00033,
+    0x00031, 0x02044, 0x00035, 0x00032, 0x02044, 0x00035, 0x00033, 0x02044,
+    0x00035, 0x00034, 0x02044, 0x00035, 0x00031, 0x02044, 0x00036, 0x00035,
+    0x02044, 0x00036, 0x00031, 0x02044, 0x00038, 0x00033, 0x02044, 0x00038,
+    0x00035, 0x02044, 0x00038, 0x00037, 0x02044, 0x00038, 0x00031, 0x02044,
+    0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00056, 0x00056,
+    0x00056, 0x00049, 0x00056, 0x00049, 0x00049, 0x00056, 0x00049, 0x00049,
+    0x00049, 0x00049, 0x00058, 0x00058, 0x00058, 0x00049, 0x00058, 0x00049,
+    0x00049, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00076,
+    0x00076, 0x00069, 0x00076, 0x00069, 0x00069, 0x00076, 0x00069, 0x00069,
+    0x00069, 0x00069, 0x00078, 0x00078, 0x00069, 0x00078, 0x00069, 0x00069,
+    0x00030, 0x02044, 0x00033, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194,
+    0x00338, 0x021D0, 0x00338, 0x021D4, 0x00338, 0x021D2, 0x00338, 0x02203,
+    0x00338, 0x02208, 0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225,
+    0x00338, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0222E, 0x0222E,
+    0x0222E, 0x0222E, 0x0222E, 0x0223C, 0x00338, 0x02243, 0x00338, 0x02245,
+    0x00338, 0x02248, 0x00338, 0x0003D, 0x00338, 0x02261, 0x00338, 0x0224D,
+    0x00338, 0x0003C, 0x00338, 0x0003E, 0x00338, 0x02264, 0x00338, 0x02265,
+    0x00338, 0x02272, 0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277,
+    0x00338, 0x0227A, 0x00338, 0x0227B, 0x00338, 0x02282, 0x00338, 0x02283,
+    0x00338, 0x02286, 0x00338, 0x02287, 0x00338, 0x022A2, 0x00338, 0x022A8,
+    0x00338, 0x022A9, 0x00338, 0x022AB, 0x00338, 0x0227C, 0x00338, 0x0227D,
+    0x00338, 0x02291, 0x00338, 0x02292, 0x00338, 0x022B2, 0x00338, 0x022B3,
+    0x00338, 0x022B4, 0x00338, 0x022B5, 0x00338, 0x03008, 0x03009, 0x00031,
+    0x00030, 0x00031, 0x00031, 0x00031, 0x00032, 0x00031, 0x00033, 0x00031,
+    0x00034, 0x00031, 0x00035, 0x00031, 0x00036, 0x00031, 0x00037, 0x00031,
+    0x00038, 0x00031, 0x00039, 0x00032, 0x00030, 0x00028, 0x00031, 0x00029,
+    0x00028, 0x00032, 0x00029, 0x00028, 0x00033, 0x00029, 0x00028, 0x00034,
+    0x00029, 0x00028, 0x00035, 0x00029, 0x00028, 0x00036, 0x00029, 0x00028,
+    0x00037, 0x00029, 0x00028, 0x00038, 0x00029, 0x00028, 0x00039, 0x00029,
+    0x00028, 0x00031, 0x00030, 0x00029, 0x00028, 0x00031, 0x00031, 0x00029,
+    0x00028, 0x00031, 0x00032, 0x00029, 0x00028, 0x00031, 0x00033, 0x00029,
+    0x00028, 0x00031, 0x00034, 0x00029, 0x00028, 0x00031, 0x00035, 0x00029,
+    0x00028, 0x00031, 0x00036, 0x00029, 0x00028, 0x00031, 0x00037, 0x00029,
+    0x00028, 0x00031, 0x00038, 0x00029, 0x00028, 0x00031, 0x00039, 0x00029,
+    0x00028, 0x00032, 0x00030, 0x00029, 0x00031, 0x0002E, 0x00032, 0x0002E,
+    0x00033, 0x0002E, 0x00034, 0x0002E, 0x00035, 0x0002E, 0x00036, 0x0002E,
+    0x00037, 0x0002E, 0x00038, 0x0002E, 0x00039, 0x0002E, 0x00031, 0x00030,
+    0x0002E, 0x00031, 0x00031, 0x0002E, 0x00031, 0x00032, 0x0002E, 0x00031,
+    0x00033, 0x0002E, 0x00031, 0x00034, 0x0002E, 0x00031, 0x00035, 0x0002E,
+    0x00031, 0x00036, 0x0002E, 0x00031, 0x00037, 0x0002E, 0x00031, 0x00038,
+    0x0002E, 0x00031, 0x00039, 0x0002E, 0x00032, 0x00030, 0x0002E, 0x00028,
+    0x00061, 0x00029, 0x00028, 0x00062, 0x00029, 0x00028, 0x00063, 0x00029,
+    0x00028, 0x00064, 0x00029, 0x00028, 0x00065, 0x00029, 0x00028, 0x00066,
+    0x00029, 0x00028, 0x00067, 0x00029, 0x00028, 0x00068, 0x00029, 0x00028,
+    0x00069, 0x00029, 0x00028, 0x0006A, 0x00029, 0x00028, 0x0006B, 0x00029,
+    0x00028, 0x0006C, 0x00029, 0x00028, 0x0006D, 0x00029, 0x00028, 0x0006E,
+    0x00029, 0x00028, 0x0006F, 0x00029, 0x00028, 0x00070, 0x00029, 0x00028,
+    0x00071, 0x00029, 0x00028, 0x00072, 0x00029, 0x00028, 0x00073, 0x00029,
+    0x00028, 0x00074, 0x00029, 0x00028, 0x00075, 0x00029, 0x00028, 0x00076,
+    0x00029, 0x00028, 0x00077, 0x00029, 0x00028, 0x00078, 0x00029, 0x00028,
+    0x00079, 0x00029, 0x00028, 0x0007A, 0x00029, 0x00053, 0x00059, 0x00071,
+    0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0003A, 0x0003A, 0x0003D, 0x0003D,
+    0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x02ADD, 0x00338, 0x02D61, 0x06BCD,
+    0x09F9F, 0x04E00, 0x04E28, 0x04E36, 0x04E3F, 0x04E59, 0x04E85, 0x04E8C,
+    0x04EA0, 0x04EBA, 0x0513F, 0x05165, 0x0516B, 0x05182, 0x05196, 0x051AB,
+    0x051E0, 0x051F5, 0x05200, 0x0529B, 0x052F9, 0x05315, 0x0531A, 0x05338,
+    0x05341, 0x0535C, 0x05369, 0x05382, 0x053B6, 0x053C8, 0x053E3, 0x056D7,
+    0x0571F, 0x058EB, 0x05902, 0x0590A, 0x05915, 0x05927, 0x05973, 0x05B50,
+    0x05B80, 0x05BF8, 0x05C0F, 0x05C22, 0x05C38, 0x05C6E, 0x05C71, 0x05DDB,
+    0x05DE5, 0x05DF1, 0x05DFE, 0x05E72, 0x05E7A, 0x05E7F, 0x05EF4, 0x05EFE,
+    0x05F0B, 0x05F13, 0x05F50, 0x05F61, 0x05F73, 0x05FC3, 0x06208, 0x06236,
+    0x0624B, 0x0652F, 0x06534, 0x06587, 0x06597, 0x065A4, 0x065B9, 0x065E0,
+    0x065E5, 0x066F0, 0x06708, 0x06728, 0x06B20, 0x06B62, 0x06B79, 0x06BB3,
+    0x06BCB, 0x06BD4, 0x06BDB, 0x06C0F, 0x06C14, 0x06C34, 0x0706B, 0x0722A,
+    0x07236, 0x0723B, 0x0723F, 0x07247, 0x07259, 0x0725B, 0x072AC, 0x07384,
+    0x07389, 0x074DC, 0x074E6, 0x07518, 0x0751F, 0x07528, 0x07530, 0x0758B,
+    0x07592, 0x07676, 0x0767D, 0x076AE, 0x076BF, 0x076EE, 0x077DB, 0x077E2,
+    0x077F3, 0x0793A, 0x079B8, 0x079BE, 0x07A74, 0x07ACB, 0x07AF9, 0x07C73,
+    0x07CF8, 0x07F36, 0x07F51, 0x07F8A, 0x07FBD, 0x08001, 0x0800C, 0x08012,
+    0x08033, 0x0807F, 0x08089, 0x081E3, 0x081EA, 0x081F3, 0x081FC, 0x0820C,
+    0x0821B, 0x0821F, 0x0826E, 0x08272, 0x08278, 0x0864D, 0x0866B, 0x08840,
+    0x0884C, 0x08863, 0x0897E, 0x0898B, 0x089D2, 0x08A00, 0x08C37, 0x08C46,
+    0x08C55, 0x08C78, 0x08C9D, 0x08D64, 0x08D70, 0x08DB3, 0x08EAB, 0x08ECA,
+    0x08F9B, 0x08FB0, 0x08FB5, 0x09091, 0x09149, 0x091C6, 0x091CC, 0x091D1,
+    0x09577, 0x09580, 0x0961C, 0x096B6, 0x096B9, 0x096E8, 0x09751, 0x0975E,
+    0x09762, 0x09769, 0x097CB, 0x097ED, 0x097F3, 0x09801, 0x098A8, 0x098DB,
+    0x098DF, 0x09996, 0x09999, 0x099AC, 0x09AA8, 0x09AD8, 0x09ADF, 0x09B25,
+    0x09B2F, 0x09B32, 0x09B3C, 0x09B5A, 0x09CE5, 0x09E75, 0x09E7F, 0x09EA5,
+    0x09EBB, 0x09EC3, 0x09ECD, 0x09ED1, 0x09EF9, 0x09EFD, 0x09F0E, 0x09F13,
+    0x09F20, 0x09F3B, 0x09F4A, 0x09F52, 0x09F8D, 0x09F9C, 0x09FA0, 0x03012,
+    0x05344, 0x05345, 0x0304B, 0x03099, 0x0304D, 0x03099, 0x0304F, 0x03099,
+    0x03051, 0x03099, 0x03053, 0x03099, 0x03055, 0x03099, 0x03057, 0x03099,
+    0x03059, 0x03099, 0x0305B, 0x03099, 0x0305D, 0x03099, 0x0305F, 0x03099,
+    0x03061, 0x03099, 0x03064, 0x03099, 0x03066, 0x03099, 0x03068, 0x03099,
+    0x0306F, 0x03099, 0x0306F, 0x0309A, 0x03072, 0x03099, 0x03072, 0x0309A,
+    0x03075, 0x03099, 0x03075, 0x0309A, 0x03078, 0x03099, 0x03078, 0x0309A,
+    0x0307B, 0x03099, 0x0307B, 0x0309A, 0x03046, 0x03099, 0x00020, 0x03099,
+    0x00020, 0x0309A, 0x0309D, 0x03099, 0x03088, 0x0308A, 0x030AB, 0x03099,
+    0x030AD, 0x03099, 0x030AF, 0x03099, 0x030B1, 0x03099, 0x030B3, 0x03099,
+    0x030B5, 0x03099, 0x030B7, 0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099,
+    0x030BD, 0x03099, 0x030BF, 0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099,
+    0x030C6, 0x03099, 0x030C8, 0x03099, 0x030CF, 0x03099, 0x030CF, 0x0309A,
+    0x030D2, 0x03099, 0x030D2, 0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A,
+    0x030D8, 0x03099, 0x030D8, 0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A,
+    0x030A6, 0x03099, 0x030EF, 0x03099, 0x030F0, 0x03099, 0x030F1, 0x03099,
+    0x030F2, 0x03099, 0x030FD, 0x03099, 0x030B3, 0x030C8, 0x01100, 0x01101,
+    0x011AA, 0x01102, 0x011AC, 0x011AD, 0x01103, 0x01104, 0x01105, 0x011B0,
+    0x011B1, 0x011B2, 0x011B3, 0x011B4, 0x011B5, 0x0111A, 0x01106, 0x01107,
+    0x01108, 0x01121, 0x01109, 0x0110A, 0x0110B, 0x0110C, 0x0110D, 0x0110E,
+    0x0110F, 0x01110, 0x01111, 0x01112, 0x01161, 0x01162, 0x01163, 0x01164,
+    0x01165, 0x01166, 0x01167, 0x01168, 0x01169, 0x0116A, 0x0116B, 0x0116C,
+    0x0116D, 0x0116E, 0x0116F, 0x01170, 0x01171, 0x01172, 0x01173, 0x01174,
+    0x01175, 0x01160, 0x01114, 0x01115, 0x011C7, 0x011C8, 0x011CC, 0x011CE,
+    0x011D3, 0x011D7, 0x011D9, 0x0111C, 0x011DD, 0x011DF, 0x0111D, 0x0111E,
+    0x01120, 0x01122, 0x01123, 0x01127, 0x01129, 0x0112B, 0x0112C, 0x0112D,
+    0x0112E, 0x0112F, 0x01132, 0x01136, 0x01140, 0x01147, 0x0114C, 0x011F1,
+    0x011F2, 0x01157, 0x01158, 0x01159, 0x01184, 0x01185, 0x01188, 0x01191,
+    0x01192, 0x01194, 0x0119E, 0x011A1, 0x04E09, 0x056DB, 0x04E0A, 0x04E2D,
+    0x04E0B, 0x07532, 0x04E19, 0x04E01, 0x05929, 0x05730, 0x00028, 0x01100,
+    0x00029, 0x00028, 0x01102, 0x00029, 0x00028, 0x01103, 0x00029, 0x00028,
+    0x01105, 0x00029, 0x00028, 0x01106, 0x00029, 0x00028, 0x01107, 0x00029,
+    0x00028, 0x01109, 0x00029, 0x00028, 0x0110B, 0x00029, 0x00028, 0x0110C,
+    0x00029, 0x00028, 0x0110E, 0x00029, 0x00028, 0x0110F, 0x00029, 0x00028,
+    0x01110, 0x00029, 0x00028, 0x01111, 0x00029, 0x00028, 0x01112, 0x00029,
+    0x00028, 0x01100, 0x01161, 0x00029, 0x00028, 0x01102, 0x01161, 0x00029,
+    0x00028, 0x01103, 0x01161, 0x00029, 0x00028, 0x01105, 0x01161, 0x00029,
+    0x00028, 0x01106, 0x01161, 0x00029, 0x00028, 0x01107, 0x01161, 0x00029,
+    0x00028, 0x01109, 0x01161, 0x00029, 0x00028, 0x0110B, 0x01161, 0x00029,
+    0x00028, 0x0110C, 0x01161, 0x00029, 0x00028, 0x0110E, 0x01161, 0x00029,
+    0x00028, 0x0110F, 0x01161, 0x00029, 0x00028, 0x01110, 0x01161, 0x00029,
+    0x00028, 0x01111, 0x01161, 0x00029, 0x00028, 0x01112, 0x01161, 0x00029,
+    0x00028, 0x0110C, 0x0116E, 0x00029, 0x00028, 0x0110B, 0x01169, 0x0110C,
+    0x01165, 0x011AB, 0x00029, 0x00028, 0x0110B, 0x01169, 0x01112, 0x0116E,
+    0x00029, 0x00028, 0x04E00, 0x00029, 0x00028, 0x04E8C, 0x00029, 0x00028,
+    0x04E09, 0x00029, 0x00028, 0x056DB, 0x00029, 0x00028, 0x04E94, 0x00029,
+    0x00028, 0x0516D, 0x00029, 0x00028, 0x04E03, 0x00029, 0x00028, 0x0516B,
+    0x00029, 0x00028, 0x04E5D, 0x00029, 0x00028, 0x05341, 0x00029, 0x00028,
+    0x06708, 0x00029, 0x00028, 0x0706B, 0x00029, 0x00028, 0x06C34, 0x00029,
+    0x00028, 0x06728, 0x00029, 0x00028, 0x091D1, 0x00029, 0x00028, 0x0571F,
+    0x00029, 0x00028, 0x065E5, 0x00029, 0x00028, 0x0682A, 0x00029, 0x00028,
+    0x06709, 0x00029, 0x00028, 0x0793E, 0x00029, 0x00028, 0x0540D, 0x00029,
+    0x00028, 0x07279, 0x00029, 0x00028, 0x08CA1, 0x00029, 0x00028, 0x0795D,
+    0x00029, 0x00028, 0x052B4, 0x00029, 0x00028, 0x04EE3, 0x00029, 0x00028,
+    0x0547C, 0x00029, 0x00028, 0x05B66, 0x00029, 0x00028, 0x076E3, 0x00029,
+    0x00028, 0x04F01, 0x00029, 0x00028, 0x08CC7, 0x00029, 0x00028, 0x05354,
+    0x00029, 0x00028, 0x0796D, 0x00029, 0x00028, 0x04F11, 0x00029, 0x00028,
+    0x081EA, 0x00029, 0x00028, 0x081F3, 0x00029, 0x0554F, 0x05E7C, 0x07B8F,
+    0x00050, 0x00054, 0x00045, 0x00032, 0x00031, 0x00032, 0x00032, 0x00032,
+    0x00033, 0x00032, 0x00034, 0x00032, 0x00035, 0x00032, 0x00036, 0x00032,
+    0x00037, 0x00032, 0x00038, 0x00032, 0x00039, 0x00033, 0x00030, 0x00033,
+    0x00031, 0x00033, 0x00032, 0x00033, 0x00033, 0x00033, 0x00034, 0x00033,
+    0x00035, 0x01100, 0x01161, 0x01102, 0x01161, 0x01103, 0x01161, 0x01105,
+    0x01161, 0x01106, 0x01161, 0x01107, 0x01161, 0x01109, 0x01161, 0x0110B,
+    0x01161, 0x0110C, 0x01161, 0x0110E, 0x01161, 0x0110F, 0x01161, 0x01110,
+    0x01161, 0x01111, 0x01161, 0x01112, 0x01161, 0x0110E, 0x01161, 0x011B7,
+    0x01100, 0x01169, 0x0110C, 0x0116E, 0x0110B, 0x01174, 0x0110B, 0x0116E,
+    0x04E94, 0x0516D, 0x04E03, 0x04E5D, 0x0682A, 0x06709, 0x0793E, 0x0540D,
+    0x07279, 0x08CA1, 0x0795D, 0x052B4, 0x079D8, 0x07537, 0x09069, 0x0512A,
+    0x05370, 0x06CE8, 0x09805, 0x04F11, 0x05199, 0x06B63, 0x05DE6, 0x053F3,
+    0x0533B, 0x05B97, 0x05B66, 0x076E3, 0x04F01, 0x08CC7, 0x05354, 0x0591C,
+    0x00033, 0x00036, 0x00033, 0x00037, 0x00033, 0x00038, 0x00033, 0x00039,
+    0x00034, 0x00030, 0x00034, 0x00031, 0x00034, 0x00032, 0x00034, 0x00033,
+    0x00034, 0x00034, 0x00034, 0x00035, 0x00034, 0x00036, 0x00034, 0x00037,
+    0x00034, 0x00038, 0x00034, 0x00039, 0x00035, 0x00030, 0x00031, 0x06708,
+    0x00032, 0x06708, 0x00033, 0x06708, 0x00034, 0x06708, 0x00035, 0x06708,
+    0x00036, 0x06708, 0x00037, 0x06708, 0x00038, 0x06708, 0x00039, 0x06708,
+    0x00031, 0x00030, 0x06708, 0x00031, 0x00031, 0x06708, 0x00031, 0x00032,
+    0x06708, 0x00048, 0x00067, 0x00065, 0x00072, 0x00067, 0x00065, 0x00056,
+    0x0004C, 0x00054, 0x00044, 0x030A2, 0x030A4, 0x030A6, 0x030A8, 0x030AA,
+    0x030AB, 0x030AD, 0x030AF, 0x030B1, 0x030B3, 0x030B5, 0x030B7, 0x030B9,
+    0x030BB, 0x030BD, 0x030BF, 0x030C1, 0x030C4, 0x030C6, 0x030C8, 0x030CA,
+    0x030CB, 0x030CC, 0x030CD, 0x030CE, 0x030CF, 0x030D2, 0x030D5, 0x030D8,
+    0x030DB, 0x030DE, 0x030DF, 0x030E0, 0x030E1, 0x030E2, 0x030E4, 0x030E6,
+    0x030E8, 0x030E9, 0x030EA, 0x030EB, 0x030EC, 0x030ED, 0x030EF, 0x030F0,
+    0x030F1, 0x030F2, 0x04EE4, 0x0548C, 0x030A2, 0x030CF, 0x0309A, 0x030FC,
+    0x030C8, 0x030A2, 0x030EB, 0x030D5, 0x030A1, 0x030A2, 0x030F3, 0x030D8,
+    0x0309A, 0x030A2, 0x030A2, 0x030FC, 0x030EB, 0x030A4, 0x030CB, 0x030F3,
+    0x030AF, 0x03099, 0x030A4, 0x030F3, 0x030C1, 0x030A6, 0x030A9, 0x030F3,
+    0x030A8, 0x030B9, 0x030AF, 0x030FC, 0x030C8, 0x03099, 0x030A8, 0x030FC,
+    0x030AB, 0x030FC, 0x030AA, 0x030F3, 0x030B9, 0x030AA, 0x030FC, 0x030E0,
+    0x030AB, 0x030A4, 0x030EA, 0x030AB, 0x030E9, 0x030C3, 0x030C8, 0x030AB,
+    0x030ED, 0x030EA, 0x030FC, 0x030AB, 0x03099, 0x030ED, 0x030F3, 0x030AB,
+    0x03099, 0x030F3, 0x030DE, 0x030AD, 0x03099, 0x030AB, 0x03099, 0x030AD,
+    0x03099, 0x030CB, 0x030FC, 0x030AD, 0x030E5, 0x030EA, 0x030FC, 0x030AD,
+    0x03099, 0x030EB, 0x030BF, 0x03099, 0x030FC, 0x030AD, 0x030ED, 0x030AD,
+    0x030ED, 0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030AD, 0x030ED, 0x030E1,
+    0x030FC, 0x030C8, 0x030EB, 0x030AD, 0x030ED, 0x030EF, 0x030C3, 0x030C8,
+    0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030AF, 0x03099, 0x030E9, 0x030E0,
+    0x030C8, 0x030F3, 0x030AF, 0x030EB, 0x030BB, 0x03099, 0x030A4, 0x030ED,
+    0x030AF, 0x030ED, 0x030FC, 0x030CD, 0x030B1, 0x030FC, 0x030B9, 0x030B3,
+    0x030EB, 0x030CA, 0x030B3, 0x030FC, 0x030DB, 0x0309A, 0x030B5, 0x030A4,
+    0x030AF, 0x030EB, 0x030B5, 0x030F3, 0x030C1, 0x030FC, 0x030E0, 0x030B7,
+    0x030EA, 0x030F3, 0x030AF, 0x03099, 0x030BB, 0x030F3, 0x030C1, 0x030BB,
+    0x030F3, 0x030C8, 0x030BF, 0x03099, 0x030FC, 0x030B9, 0x030C6, 0x03099,
+    0x030B7, 0x030C8, 0x03099, 0x030EB, 0x030C8, 0x030F3, 0x030CA, 0x030CE,
+    0x030CE, 0x030C3, 0x030C8, 0x030CF, 0x030A4, 0x030C4, 0x030CF, 0x0309A,
+    0x030FC, 0x030BB, 0x030F3, 0x030C8, 0x030CF, 0x0309A, 0x030FC, 0x030C4,
+    0x030CF, 0x03099, 0x030FC, 0x030EC, 0x030EB, 0x030D2, 0x0309A, 0x030A2,
+    0x030B9, 0x030C8, 0x030EB, 0x030D2, 0x0309A, 0x030AF, 0x030EB, 0x030D2,
+    0x0309A, 0x030B3, 0x030D2, 0x03099, 0x030EB, 0x030D5, 0x030A1, 0x030E9,
+    0x030C3, 0x030C8, 0x03099, 0x030D5, 0x030A3, 0x030FC, 0x030C8, 0x030D5,
+    0x03099, 0x030C3, 0x030B7, 0x030A7, 0x030EB, 0x030D5, 0x030E9, 0x030F3,
+    0x030D8, 0x030AF, 0x030BF, 0x030FC, 0x030EB, 0x030D8, 0x0309A, 0x030BD,
+    0x030D8, 0x0309A, 0x030CB, 0x030D2, 0x030D8, 0x030EB, 0x030C4, 0x030D8,
+    0x0309A, 0x030F3, 0x030B9, 0x030D8, 0x0309A, 0x030FC, 0x030B7, 0x03099,
+    0x030D8, 0x03099, 0x030FC, 0x030BF, 0x030DB, 0x0309A, 0x030A4, 0x030F3,
+    0x030C8, 0x030DB, 0x03099, 0x030EB, 0x030C8, 0x030DB, 0x030F3, 0x030DB,
+    0x0309A, 0x030F3, 0x030C8, 0x03099, 0x030DB, 0x030FC, 0x030EB, 0x030DB,
+    0x030FC, 0x030F3, 0x030DE, 0x030A4, 0x030AF, 0x030ED, 0x030DE, 0x030A4,
+    0x030EB, 0x030DE, 0x030C3, 0x030CF, 0x030DE, 0x030EB, 0x030AF, 0x030DE,
+    0x030F3, 0x030B7, 0x030E7, 0x030F3, 0x030DF, 0x030AF, 0x030ED, 0x030F3,
+    0x030DF, 0x030EA, 0x030DF, 0x030EA, 0x030CF, 0x03099, 0x030FC, 0x030EB,
+    0x030E1, 0x030AB, 0x03099, 0x030E1, 0x030AB, 0x03099, 0x030C8, 0x030F3,
+    0x030E1, 0x030FC, 0x030C8, 0x030EB, 0x030E4, 0x030FC, 0x030C8, 0x03099,
+    0x030E4, 0x030FC, 0x030EB, 0x030E6, 0x030A2, 0x030F3, 0x030EA, 0x030C3,
+    0x030C8, 0x030EB, 0x030EA, 0x030E9, 0x030EB, 0x030D2, 0x0309A, 0x030FC,
+    0x030EB, 0x030FC, 0x030D5, 0x03099, 0x030EB, 0x030EC, 0x030E0, 0x030EC,
+    0x030F3, 0x030C8, 0x030B1, 0x03099, 0x030F3, 0x030EF, 0x030C3, 0x030C8,
+    0x00030, 0x070B9, 0x00031, 0x070B9, 0x00032, 0x070B9, 0x00033, 0x070B9,
+    0x00034, 0x070B9, 0x00035, 0x070B9, 0x00036, 0x070B9, 0x00037, 0x070B9,
+    0x00038, 0x070B9, 0x00039, 0x070B9, 0x00031, 0x00030, 0x070B9, 0x00031,
+    0x00031, 0x070B9, 0x00031, 0x00032, 0x070B9, 0x00031, 0x00033, 0x070B9,
+    0x00031, 0x00034, 0x070B9, 0x00031, 0x00035, 0x070B9, 0x00031, 0x00036,
+    0x070B9, 0x00031, 0x00037, 0x070B9, 0x00031, 0x00038, 0x070B9, 0x00031,
+    0x00039, 0x070B9, 0x00032, 0x00030, 0x070B9, 0x00032, 0x00031, 0x070B9,
+    0x00032, 0x00032, 0x070B9, 0x00032, 0x00033, 0x070B9, 0x00032, 0x00034,
+    0x070B9, 0x00068, 0x00050, 0x00061, 0x00064, 0x00061, 0x00041, 0x00055,
+    0x00062, 0x00061, 0x00072, 0x0006F, 0x00056, 0x00070, 0x00063, 0x00064,
+    0x0006D, 0x00064, 0x0006D, 0x00032, 0x00064, 0x0006D, 0x00033, 0x00049,
+    0x00055, 0x05E73, 0x06210, 0x0662D, 0x0548C, 0x05927, 0x06B63, 0x0660E,
+    0x06CBB, 0x0682A, 0x05F0F, 0x04F1A, 0x0793E, 0x00070, 0x00041, 0x0006E,
+    0x00041, 0x003BC, 0x00041, 0x0006D, 0x00041, 0x0006B, 0x00041, 0x0004B,
+    0x00042, 0x0004D, 0x00042, 0x00047, 0x00042, 0x00063, 0x00061, 0x0006C,
+    0x0006B, 0x00063, 0x00061, 0x0006C, 0x00070, 0x00046, 0x0006E, 0x00046,
+    0x003BC, 0x00046, 0x003BC, 0x00067, 0x0006D, 0x00067, 0x0006B, 0x00067,
+    0x00048, 0x0007A, 0x0006B, 0x00048, 0x0007A, 0x0004D, 0x00048, 0x0007A,
+    0x00047, 0x00048, 0x0007A, 0x00054, 0x00048, 0x0007A, 0x003BC, 0x0006C,
+    0x0006D, 0x0006C, 0x00064, 0x0006C, 0x0006B, 0x0006C, 0x00066, 0x0006D,
+    0x0006E, 0x0006D, 0x003BC, 0x0006D, 0x0006D, 0x0006D, 0x00063, 0x0006D,
+    0x0006B, 0x0006D, 0x0006D, 0x0006D, 0x00032, 0x00063, 0x0006D, 0x00032,
+    0x0006D, 0x00032, 0x0006B, 0x0006D, 0x00032, 0x0006D, 0x0006D, 0x00033,
+    0x00063, 0x0006D, 0x00033, 0x0006D, 0x00033, 0x0006B, 0x0006D, 0x00033,
+    0x0006D, 0x02215, 0x00073, 0x0006D, 0x02215, 0x00073, 0x00032, 0x00050,
+    0x00061, 0x0006B, 0x00050, 0x00061, 0x0004D, 0x00050, 0x00061, 0x00047,
+    0x00050, 0x00061, 0x00072, 0x00061, 0x00064, 0x00072, 0x00061, 0x00064,
+    0x02215, 0x00073, 0x00072, 0x00061, 0x00064, 0x02215, 0x00073, 0x00032,
+    0x00070, 0x00073, 0x0006E, 0x00073, 0x003BC, 0x00073, 0x0006D, 0x00073,
+    0x00070, 0x00056, 0x0006E, 0x00056, 0x003BC, 0x00056, 0x0006D, 0x00056,
+    0x0006B, 0x00056, 0x0004D, 0x00056, 0x00070, 0x00057, 0x0006E, 0x00057,
+    0x003BC, 0x00057, 0x0006D, 0x00057, 0x0006B, 0x00057, 0x0004D, 0x00057,
+    0x0006B, 0x003A9, 0x0004D, 0x003A9, 0x00061, 0x0002E, 0x0006D, 0x0002E,
+    0x00042, 0x00071, 0x00063, 0x00063, 0x00063, 0x00064, 0x00043, 0x02215,
+    0x0006B, 0x00067, 0x00043, 0x0006F, 0x0002E, 0x00064, 0x00042, 0x00047,
+    0x00079, 0x00068, 0x00061, 0x00048, 0x00050, 0x00069, 0x0006E, 0x0004B,
+    0x0004B, 0x0004B, 0x0004D, 0x0006B, 0x00074, 0x0006C, 0x0006D, 0x0006C,
+    0x0006E, 0x0006C, 0x0006F, 0x00067, 0x0006C, 0x00078, 0x0006D, 0x00062,
+    0x0006D, 0x00069, 0x0006C, 0x0006D, 0x0006F, 0x0006C, 0x00050, 0x00048,
+    0x00070, 0x0002E, 0x0006D, 0x0002E, 0x00050, 0x00050, 0x0004D, 0x00050,
+    0x00052, 0x00073, 0x00072, 0x00053, 0x00076, 0x00057, 0x00062, 0x00056,
+    0x02215, 0x0006D, 0x00041, 0x02215, 0x0006D, 0x00031, 0x065E5, 0x00032,
+    0x065E5, 0x00033, 0x065E5, 0x00034, 0x065E5, 0x00035, 0x065E5, 0x00036,
+    0x065E5, 0x00037, 0x065E5, 0x00038, 0x065E5, 0x00039, 0x065E5, 0x00031,
+    0x00030, 0x065E5, 0x00031, 0x00031, 0x065E5, 0x00031, 0x00032, 0x065E5,
+    0x00031, 0x00033, 0x065E5, 0x00031, 0x00034, 0x065E5, 0x00031, 0x00035,
+    0x065E5, 0x00031, 0x00036, 0x065E5, 0x00031, 0x00037, 0x065E5, 0x00031,
+    0x00038, 0x065E5, 0x00031, 0x00039, 0x065E5, 0x00032, 0x00030, 0x065E5,
+    0x00032, 0x00031, 0x065E5, 0x00032, 0x00032, 0x065E5, 0x00032, 0x00033,
+    0x065E5, 0x00032, 0x00034, 0x065E5, 0x00032, 0x00035, 0x065E5, 0x00032,
+    0x00036, 0x065E5, 0x00032, 0x00037, 0x065E5, 0x00032, 0x00038, 0x065E5,
+    0x00032, 0x00039, 0x065E5, 0x00033, 0x00030, 0x065E5, 0x00033, 0x00031,
+    0x065E5, 0x00067, 0x00061, 0x0006C, 0x0044A, 0x0044C, 0x0A76F, 0x00126,
+    0x00153, 0x0A727, 0x0AB37, 0x0026B, 0x0AB52, 0x0028D, 0x08C48, 0x066F4,
+    0x08CC8, 0x06ED1, 0x04E32, 0x053E5, 0x05951, 0x05587, 0x05948, 0x061F6,
+    0x07669, 0x07F85, 0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B,
+    0x070D9, 0x073DE, 0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04,
+    0x0721B, 0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9,
+    0x081D8, 0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86,
+    0x051B7, 0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08606, 0x0865C,
+    0x08DEF, 0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9,
+    0x09304, 0x08AD6, 0x058DF, 0x05F04, 0x07C60, 0x0807E, 0x07262, 0x078CA,
+    0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA, 0x06F0F, 0x07D2F,
+    0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC, 0x07A1C, 0x07DBE,
+    0x083F1, 0x09675, 0x08B80, 0x062CF, 0x08AFE, 0x04E39, 0x05BE7, 0x06012,
+    0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9, 0x04E0D, 0x06CCC,
+    0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449, 0x08AAA, 0x06BBA,
+    0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565, 0x04EAE, 0x05169, 0x051C9,
+    0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF, 0x052F5, 0x05442, 0x05EEC,
+    0x065C5, 0x06FFE, 0x0792A, 0x095AD, 0x09A6A, 0x09E97, 0x09ECE, 0x066C6,
+    0x06B77, 0x08F62, 0x05E74, 0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149,
+    0x07489, 0x079CA, 0x07DF4, 0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A,
+    0x05217, 0x052A3, 0x054BD, 0x070C8, 0x088C2, 0x05EC9, 0x05FF5, 0x0637B,
+    0x06BAE, 0x07C3E, 0x07375, 0x04EE4, 0x056F9, 0x05DBA, 0x0601C, 0x073B2,
+    0x07469, 0x07F9A, 0x08046, 0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B,
+    0x079AE, 0x091B4, 0x096B8, 0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F,
+    0x06599, 0x071CE, 0x07642, 0x084FC, 0x0907C, 0x06688, 0x0962E, 0x05289,
+    0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B, 0x07D10,
+    0x0985E, 0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A, 0x05F8B,
+    0x06144, 0x06817, 0x09686, 0x05229, 0x0540F, 0x05C65, 0x06613, 0x0674E,
+    0x068A8, 0x06CE5, 0x07406, 0x075E2, 0x07F79, 0x088CF, 0x088E1, 0x096E2,
+    0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498, 0x085FA, 0x096A3, 0x09C57,
+    0x09E9F, 0x06797, 0x06DCB, 0x081E8, 0x07B20, 0x07C92, 0x072C0, 0x07099,
+    0x08B58, 0x04EC0, 0x08336, 0x0523A, 0x05207, 0x05EA6, 0x062D3, 0x07CD6,
+    0x05B85, 0x06D1E, 0x066B4, 0x08F3B, 0x0964D, 0x05ED3, 0x05140, 0x055C0,
+    0x0585A, 0x06674, 0x051DE, 0x0732A, 0x076CA, 0x0793C, 0x0795E, 0x07965,
+    0x0798F, 0x09756, 0x07CBE, 0x08612, 0x08AF8, 0x09038, 0x090FD, 0x098EF,
+    0x098FC, 0x09928, 0x09DB4, 0x090DE, 0x096B7, 0x04FAE, 0x050E7, 0x0514D,
+    0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606, 0x05668, 0x05840, 0x058A8,
+    0x05C64, 0x06094, 0x06168, 0x0618E, 0x061F2, 0x0654F, 0x065E2, 0x06691,
+    0x06885, 0x06D77, 0x06E1A, 0x06F22, 0x0716E, 0x0722B, 0x07422, 0x07891,
+    0x07949, 0x07948, 0x07950, 0x07956, 0x0798D, 0x0798E, 0x07A40, 0x07A81,
+    0x07BC0, 0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279, 0x08457,
+    0x08910, 0x08996, 0x08B01, 0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x096E3,
+    0x097FF, 0x0983B, 0x06075, 0x242EE, 0x08218, 0x04E26, 0x051B5, 0x05168,
+    0x04F80, 0x05145, 0x05180, 0x052C7, 0x052FA, 0x05555, 0x05599, 0x055E2,
+    0x058B3, 0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69,
+    0x05FAD, 0x060D8, 0x0614E, 0x06108, 0x06160, 0x06234, 0x063C4, 0x0641C,
+    0x06452, 0x06556, 0x0671B, 0x06756, 0x06EDB, 0x06ECB, 0x0701E, 0x077A7,
+    0x07235, 0x072AF, 0x07471, 0x07506, 0x0753B, 0x0761D, 0x0761F, 0x076DB,
+    0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1, 0x07C7B, 0x07D5B, 0x07F3E,
+    0x08352, 0x083EF, 0x08779, 0x08941, 0x08986, 0x08ABF, 0x08ACB, 0x08AED,
+    0x08B8A, 0x08F38, 0x09072, 0x09199, 0x09276, 0x0967C, 0x097DB, 0x0980B,
+    0x09B12, 0x2284A, 0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249,
+    0x25CD0, 0x27ED3, 0x09F43, 0x09F8E, 0x00066, 0x00066, 0x00066, 0x00069,
+    0x00066, 0x0006C, 0x00066, 0x00066, 0x00069, 0x00066, 0x00066, 0x0006C,
+    0x00073, 0x00074, 0x00574, 0x00576, 0x00574, 0x00565, 0x00574, 0x0056B,
+    0x0057E, 0x00576, 0x00574, 0x0056D, 0x005D9, 0x005B4, 0x005F2, 0x005B7,
+    0x005E2, 0x005D4, 0x005DB, 0x005DC, 0x005DD, 0x005E8, 0x005EA, 0x005E9,
+    0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1, 0x005E9, 0x005BC,
+    0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0, 0x005BC, 0x005D1,
+    0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4, 0x005BC, 0x005D5,
+    0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC, 0x005DA,
+    0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE, 0x005BC, 0x005E0,
+    0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4, 0x005BC, 0x005E6,
+    0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9, 0x005BC, 0x005EA,
+    0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB, 0x005BF, 0x005E4,
+    0x005BF, 0x005D0, 0x005DC, 0x00671, 0x0067B, 0x0067E, 0x00680, 0x0067A,
+    0x0067F, 0x00679, 0x006A4, 0x006A6, 0x00684, 0x00683, 0x00686, 0x00687,
+    0x0068D, 0x0068C, 0x0068E, 0x00688, 0x00698, 0x00691, 0x006A9, 0x006AF,
+    0x006B3, 0x006B1, 0x006BA, 0x006BB, 0x006C1, 0x006BE, 0x006D2, 0x006AD,
+    0x006C7, 0x006C6, 0x006C8, 0x006CB, 0x006C5, 0x006C9, 0x006D0, 0x00649,
+    0x0064A, 0x00654, 0x00627, 0x0064A, 0x00654, 0x006D5, 0x0064A, 0x00654,
+    0x00648, 0x0064A, 0x00654, 0x006C7, 0x0064A, 0x00654, 0x006C6, 0x0064A,
+    0x00654, 0x006C8, 0x0064A, 0x00654, 0x006D0, 0x0064A, 0x00654, 0x00649,
+    0x006CC, 0x0064A, 0x00654, 0x0062C, 0x0064A, 0x00654, 0x0062D, 0x0064A,
+    0x00654, 0x00645, 0x0064A, 0x00654, 0x0064A, 0x00628, 0x0062C, 0x00628,
+    0x0062D, 0x00628, 0x0062E, 0x00628, 0x00645, 0x00628, 0x00649, 0x00628,
+    0x0064A, 0x0062A, 0x0062C, 0x0062A, 0x0062D, 0x0062A, 0x0062E, 0x0062A,
+    0x00645, 0x0062A, 0x00649, 0x0062A, 0x0064A, 0x0062B, 0x0062C, 0x0062B,
+    0x00645, 0x0062B, 0x00649, 0x0062B, 0x0064A, 0x0062C, 0x0062D, 0x0062C,
+    0x00645, 0x0062D, 0x0062C, 0x0062D, 0x00645, 0x0062E, 0x0062C, 0x0062E,
+    0x0062D, 0x0062E, 0x00645, 0x00633, 0x0062C, 0x00633, 0x0062D, 0x00633,
+    0x0062E, 0x00633, 0x00645, 0x00635, 0x0062D, 0x00635, 0x00645, 0x00636,
+    0x0062C, 0x00636, 0x0062D, 0x00636, 0x0062E, 0x00636, 0x00645, 0x00637,
+    0x0062D, 0x00637, 0x00645, 0x00638, 0x00645, 0x00639, 0x0062C, 0x00639,
+    0x00645, 0x0063A, 0x0062C, 0x0063A, 0x00645, 0x00641, 0x0062C, 0x00641,
+    0x0062D, 0x00641, 0x0062E, 0x00641, 0x00645, 0x00641, 0x00649, 0x00641,
+    0x0064A, 0x00642, 0x0062D, 0x00642, 0x00645, 0x00642, 0x00649, 0x00642,
+    0x0064A, 0x00643, 0x00627, 0x00643, 0x0062C, 0x00643, 0x0062D, 0x00643,
+    0x0062E, 0x00643, 0x00644, 0x00643, 0x00645, 0x00643, 0x00649, 0x00643,
+    0x0064A, 0x00644, 0x0062C, 0x00644, 0x0062D, 0x00644, 0x0062E, 0x00644,
+    0x00645, 0x00644, 0x00649, 0x00644, 0x0064A, 0x00645, 0x0062C, 0x00645,
+    0x0062D, 0x00645, 0x0062E, 0x00645, 0x00645, 0x00645, 0x00649, 0x00645,
+    0x0064A, 0x00646, 0x0062C, 0x00646, 0x0062D, 0x00646, 0x0062E, 0x00646,
+    0x00645, 0x00646, 0x00649, 0x00646, 0x0064A, 0x00647, 0x0062C, 0x00647,
+    0x00645, 0x00647, 0x00649, 0x00647, 0x0064A, 0x0064A, 0x0062C, 0x0064A,
+    0x0062D, 0x0064A, 0x0062E, 0x0064A, 0x00645, 0x0064A, 0x00649, 0x0064A,
+    0x0064A, 0x00630, 0x00670, 0x00631, 0x00670, 0x00649, 0x00670, 0x00020,
+    0x0064C, 0x00651, 0x00020, 0x0064D, 0x00651, 0x00020, 0x0064E, 0x00651,
+    0x00020, 0x0064F, 0x00651, 0x00020, 0x00650, 0x00651, 0x00020, 0x00651,
+    0x00670, 0x0064A, 0x00654, 0x00631, 0x0064A, 0x00654, 0x00632, 0x0064A,
+    0x00654, 0x00646, 0x00628, 0x00631, 0x00628, 0x00632, 0x00628, 0x00646,
+    0x0062A, 0x00631, 0x0062A, 0x00632, 0x0062A, 0x00646, 0x0062B, 0x00631,
+    0x0062B, 0x00632, 0x0062B, 0x00646, 0x00645, 0x00627, 0x00646, 0x00631,
+    0x00646, 0x00632, 0x00646, 0x00646, 0x0064A, 0x00631, 0x0064A, 0x00632,
+    0x0064A, 0x00646, 0x0064A, 0x00654, 0x0062E, 0x0064A, 0x00654, 0x00647,
+    0x00628, 0x00647, 0x0062A, 0x00647, 0x00635, 0x0062E, 0x00644, 0x00647,
+    0x00646, 0x00647, 0x00647, 0x00670, 0x0064A, 0x00647, 0x0062B, 0x00647,
+    0x00633, 0x00647, 0x00634, 0x00645, 0x00634, 0x00647, 0x00640, 0x0064E,
+    0x00651, 0x00640, 0x0064F, 0x00651, 0x00640, 0x00650, 0x00651, 0x00637,
+    0x00649, 0x00637, 0x0064A, 0x00639, 0x00649, 0x00639, 0x0064A, 0x0063A,
+    0x00649, 0x0063A, 0x0064A, 0x00633, 0x00649, 0x00633, 0x0064A, 0x00634,
+    0x00649, 0x00634, 0x0064A, 0x0062D, 0x00649, 0x0062D, 0x0064A, 0x0062C,
+    0x00649, 0x0062C, 0x0064A, 0x0062E, 0x00649, 0x0062E, 0x0064A, 0x00635,
+    0x00649, 0x00635, 0x0064A, 0x00636, 0x00649, 0x00636, 0x0064A, 0x00634,
+    0x0062C, 0x00634, 0x0062D, 0x00634, 0x0062E, 0x00634, 0x00631, 0x00633,
+    0x00631, 0x00635, 0x00631, 0x00636, 0x00631, 0x00627, 0x0064B, 0x0062A,
+    0x0062C, 0x00645, 0x0062A, 0x0062D, 0x0062C, 0x0062A, 0x0062D, 0x00645,
+    0x0062A, 0x0062E, 0x00645, 0x0062A, 0x00645, 0x0062C, 0x0062A, 0x00645,
+    0x0062D, 0x0062A, 0x00645, 0x0062E, 0x0062C, 0x00645, 0x0062D, 0x0062D,
+    0x00645, 0x0064A, 0x0062D, 0x00645, 0x00649, 0x00633, 0x0062D, 0x0062C,
+    0x00633, 0x0062C, 0x0062D, 0x00633, 0x0062C, 0x00649, 0x00633, 0x00645,
+    0x0062D, 0x00633, 0x00645, 0x0062C, 0x00633, 0x00645, 0x00645, 0x00635,
+    0x0062D, 0x0062D, 0x00635, 0x00645, 0x00645, 0x00634, 0x0062D, 0x00645,
+    0x00634, 0x0062C, 0x0064A, 0x00634, 0x00645, 0x0062E, 0x00634, 0x00645,
+    0x00645, 0x00636, 0x0062D, 0x00649, 0x00636, 0x0062E, 0x00645, 0x00637,
+    0x00645, 0x0062D, 0x00637, 0x00645, 0x00645, 0x00637, 0x00645, 0x0064A,
+    0x00639, 0x0062C, 0x00645, 0x00639, 0x00645, 0x00645, 0x00639, 0x00645,
+    0x00649, 0x0063A, 0x00645, 0x00645, 0x0063A, 0x00645, 0x0064A, 0x0063A,
+    0x00645, 0x00649, 0x00641, 0x0062E, 0x00645, 0x00642, 0x00645, 0x0062D,
+    0x00642, 0x00645, 0x00645, 0x00644, 0x0062D, 0x00645, 0x00644, 0x0062D,
+    0x0064A, 0x00644, 0x0062D, 0x00649, 0x00644, 0x0062C, 0x0062C, 0x00644,
+    0x0062E, 0x00645, 0x00644, 0x00645, 0x0062D, 0x00645, 0x0062D, 0x0062C,
+    0x00645, 0x0062D, 0x00645, 0x00645, 0x0062D, 0x0064A, 0x00645, 0x0062C,
+    0x0062D, 0x00645, 0x0062C, 0x00645, 0x00645, 0x0062E, 0x0062C, 0x00645,
+    0x0062E, 0x00645, 0x00645, 0x0062C, 0x0062E, 0x00647, 0x00645, 0x0062C,
+    0x00647, 0x00645, 0x00645, 0x00646, 0x0062D, 0x00645, 0x00646, 0x0062D,
+    0x00649, 0x00646, 0x0062C, 0x00645, 0x00646, 0x0062C, 0x00649, 0x00646,
+    0x00645, 0x0064A, 0x00646, 0x00645, 0x00649, 0x0064A, 0x00645, 0x00645,
+    0x00628, 0x0062E, 0x0064A, 0x0062A, 0x0062C, 0x0064A, 0x0062A, 0x0062C,
+    0x00649, 0x0062A, 0x0062E, 0x0064A, 0x0062A, 0x0062E, 0x00649, 0x0062A,
+    0x00645, 0x0064A, 0x0062A, 0x00645, 0x00649, 0x0062C, 0x00645, 0x0064A,
+    0x0062C, 0x0062D, 0x00649, 0x0062C, 0x00645, 0x00649, 0x00633, 0x0062E,
+    0x00649, 0x00635, 0x0062D, 0x0064A, 0x00634, 0x0062D, 0x0064A, 0x00636,
+    0x0062D, 0x0064A, 0x00644, 0x0062C, 0x0064A, 0x00644, 0x00645, 0x0064A,
+    0x0064A, 0x0062D, 0x0064A, 0x0064A, 0x0062C, 0x0064A, 0x0064A, 0x00645,
+    0x0064A, 0x00645, 0x00645, 0x0064A, 0x00642, 0x00645, 0x0064A, 0x00646,
+    0x0062D, 0x0064A, 0x00639, 0x00645, 0x0064A, 0x00643, 0x00645, 0x0064A,
+    0x00646, 0x0062C, 0x0062D, 0x00645, 0x0062E, 0x0064A, 0x00644, 0x0062C,
+    0x00645, 0x00643, 0x00645, 0x00645, 0x0062C, 0x0062D, 0x0064A, 0x0062D,
+    0x0062C, 0x0064A, 0x00645, 0x0062C, 0x0064A, 0x00641, 0x00645, 0x0064A,
+    0x00628, 0x0062D, 0x0064A, 0x00633, 0x0062E, 0x0064A, 0x00646, 0x0062C,
+    0x0064A, 0x00635, 0x00644, 0x006D2, 0x00642, 0x00644, 0x006D2, 0x00627,
+    0x00644, 0x00644, 0x00647, 0x00627, 0x00643, 0x00628, 0x00631, 0x00645,
+    0x0062D, 0x00645, 0x0062F, 0x00635, 0x00644, 0x00639, 0x00645, 0x00631,
+    0x00633, 0x00648, 0x00644, 0x00639, 0x00644, 0x0064A, 0x00647, 0x00648,
+    0x00633, 0x00644, 0x00645, 0x00635, 0x00644, 0x00649, 0x00635, 0x00644,
+    0x00649, 0x00020, 0x00627, 0x00644, 0x00644, 0x00647, 0x00020, 0x00639,
+    0x00644, 0x0064A, 0x00647, 0x00020, 0x00648, 0x00633, 0x00644, 0x00645,
+    0x0062C, 0x00644, 0x00020, 0x0062C, 0x00644, 0x00627, 0x00644, 0x00647,
+    0x00631, 0x006CC, 0x00627, 0x00644, 0x0002C, 0x03001, 0x03002, 0x0003A,
+    0x00021, 0x0003F, 0x03016, 0x03017, 0x02014, 0x02013, 0x0005F, 0x0007B,
+    0x0007D, 0x03014, 0x03015, 0x03010, 0x03011, 0x0300A, 0x0300B, 0x0300C,
+    0x0300D, 0x0300E, 0x0300F, 0x0005B, 0x0005D, 0x00023, 0x00026, 0x0002A,
+    0x0002D, 0x0003C, 0x0003E, 0x0005C, 0x00024, 0x00025, 0x00040, 0x00020,
+    0x0064B, 0x00640, 0x0064B, 0x00020, 0x0064C, 0x00020, 0x0064D, 0x00020,
+    0x0064E, 0x00640, 0x0064E, 0x00020, 0x0064F, 0x00640, 0x0064F, 0x00020,
+    0x00650, 0x00640, 0x00650, 0x00020, 0x00651, 0x00640, 0x00651, 0x00020,
+    0x00652, 0x00640, 0x00652, 0x00621, 0x00627, 0x00628, 0x00629, 0x0062A,
+    0x0062B, 0x0062C, 0x0062D, 0x0062E, 0x0062F, 0x00630, 0x00631, 0x00632,
+    0x00633, 0x00634, 0x00635, 0x00636, 0x00637, 0x00638, 0x00639, 0x0063A,
+    0x00641, 0x00642, 0x00643, 0x00644, 0x00645, 0x00646, 0x00647, 0x00648,
+    0x0064A, 0x00644, 0x00627, 0x00653, 0x00644, 0x00627, 0x00654, 0x00644,
+    0x00627, 0x00655, 0x00644, 0x00627, 0x00022, 0x00027, 0x0002F, 0x0005E,
+    0x0007C, 0x0007E, 0x02985, 0x02986, 0x030FB, 0x030A1, 0x030A3, 0x030A5,
+    0x030A7, 0x030A9, 0x030E3, 0x030E5, 0x030E7, 0x030C3, 0x030FC, 0x030F3,
+    0x03099, 0x0309A, 0x000A2, 0x000A3, 0x000AC, 0x000A6, 0x000A5, 0x020A9,
+    0x02502, 0x02190, 0x02191, 0x02192, 0x02193, 0x025A0, 0x025CB, 0x002D0,
+    0x002D1, 0x000E6, 0x00299, 0x00253, 0x002A3, 0x0AB66, 0x002A5, 0x002A4,
+    0x00256, 0x00257, 0x01D91, 0x00258, 0x0025E, 0x002A9, 0x00264, 0x00262,
+    0x00260, 0x0029B, 0x0029C, 0x00267, 0x00284, 0x002AA, 0x002AB, 0x0026C,
+    0x1DF04, 0x0A78E, 0x0026E, 0x1DF05, 0x0028E, 0x1DF06, 0x000F8, 0x00276,
+    0x00277, 0x0027A, 0x1DF08, 0x0027D, 0x0027E, 0x00280, 0x002A8, 0x002A6,
+    0x0AB67, 0x002A7, 0x00288, 0x02C71, 0x0028F, 0x002A1, 0x002A2, 0x00298,
+    0x001C0, 0x001C1, 0x001C2, 0x1DF0A, 0x1DF1E, 0x11099, 0x110BA, 0x1109B,
+    0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347,
+    0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9,
+    0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157,
+    0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165,
+    0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158,
+    0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165,
+    0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA,
+    0x1D165, 0x1D16F, 0x00131, 0x00237, 0x00391, 0x00392, 0x00394, 0x00395,
+    0x00396, 0x00397, 0x00399, 0x0039A, 0x0039B, 0x0039C, 0x0039D, 0x0039E,
+    0x0039F, 0x003A1, 0x003A4, 0x003A6, 0x003A7, 0x003A8, 0x02207, 0x003B1,
+    0x003B6, 0x003B7, 0x003BB, 0x003BD, 0x003BE, 0x003BF, 0x003C3, 0x003C4,
+    0x003C5, 0x003C8, 0x003C9, 0x02202, 0x003DC, 0x003DD, 0x0066E, 0x006A1,
+    0x0066F, 0x00030, 0x0002E, 0x00030, 0x0002C, 0x00031, 0x0002C, 0x00032,
+    0x0002C, 0x00033, 0x0002C, 0x00034, 0x0002C, 0x00035, 0x0002C, 0x00036,
+    0x0002C, 0x00037, 0x0002C, 0x00038, 0x0002C, 0x00039, 0x0002C, 0x00028,
+    0x00041, 0x00029, 0x00028, 0x00042, 0x00029, 0x00028, 0x00043, 0x00029,
+    0x00028, 0x00044, 0x00029, 0x00028, 0x00045, 0x00029, 0x00028, 0x00046,
+    0x00029, 0x00028, 0x00047, 0x00029, 0x00028, 0x00048, 0x00029, 0x00028,
+    0x00049, 0x00029, 0x00028, 0x0004A, 0x00029, 0x00028, 0x0004B, 0x00029,
+    0x00028, 0x0004C, 0x00029, 0x00028, 0x0004D, 0x00029, 0x00028, 0x0004E,
+    0x00029, 0x00028, 0x0004F, 0x00029, 0x00028, 0x00050, 0x00029, 0x00028,
+    0x00051, 0x00029, 0x00028, 0x00052, 0x00029, 0x00028, 0x00053, 0x00029,
+    0x00028, 0x00054, 0x00029, 0x00028, 0x00055, 0x00029, 0x00028, 0x00056,
+    0x00029, 0x00028, 0x00057, 0x00029, 0x00028, 0x00058, 0x00029, 0x00028,
+    0x00059, 0x00029, 0x00028, 0x0005A, 0x00029, 0x03014, 0x00053, 0x03015,
+    0x00043, 0x00044, 0x00057, 0x0005A, 0x00048, 0x00056, 0x00053, 0x00044,
+    0x00053, 0x00053, 0x00050, 0x00050, 0x00056, 0x00057, 0x00043, 0x0004D,
+    0x00043, 0x0004D, 0x00044, 0x0004D, 0x00052, 0x00044, 0x0004A, 0x0307B,
+    0x0304B, 0x030B3, 0x030B3, 0x05B57, 0x053CC, 0x0591A, 0x089E3, 0x04EA4,
+    0x06620, 0x07121, 0x0524D, 0x05F8C, 0x0518D, 0x065B0, 0x0521D, 0x07D42,
+    0x08CA9, 0x058F0, 0x05439, 0x06F14, 0x06295, 0x06355, 0x0904A, 0x06307,
+    0x06253, 0x07981, 0x07A7A, 0x05408, 0x06E80, 0x07533, 0x05272, 0x055B6,
+    0x0914D, 0x03014, 0x0672C, 0x03015, 0x03014, 0x04E09, 0x03015, 0x03014,
+    0x04E8C, 0x03015, 0x03014, 0x05B89, 0x03015, 0x03014, 0x070B9, 0x03015,
+    0x03014, 0x06253, 0x03015, 0x03014, 0x076D7, 0x03015, 0x03014, 0x052DD,
+    0x03015, 0x03014, 0x06557, 0x03015, 0x05F97, 0x053EF, 0x04E3D, 0x04E38,
+    0x04E41, 0x20122, 0x04F60, 0x04FBB, 0x05002, 0x0507A, 0x05099, 0x050CF,
+    0x0349E, 0x2063A, 0x05154, 0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167,
+    0x2054B, 0x05197, 0x051A4, 0x04ECC, 0x051AC, 0x291DF, 0x05203, 0x034DF,
+    0x0523B, 0x05246, 0x05277, 0x03515, 0x05305, 0x05306, 0x05349, 0x0535A,
+    0x05373, 0x0537D, 0x0537F, 0x20A2C, 0x07070, 0x053CA, 0x053DF, 0x20B63,
+    0x053EB, 0x053F1, 0x05406, 0x0549E, 0x05438, 0x05448, 0x05468, 0x054A2,
+    0x054F6, 0x05510, 0x05553, 0x05563, 0x05584, 0x055AB, 0x055B3, 0x055C2,
+    0x05716, 0x05717, 0x05651, 0x05674, 0x058EE, 0x057CE, 0x057F4, 0x0580D,
+    0x0578B, 0x05832, 0x05831, 0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906,
+    0x05922, 0x05962, 0x216A8, 0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8,
+    0x05A66, 0x036EE, 0x036FC, 0x05B08, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8,
+    0x05BF3, 0x21B18, 0x05BFF, 0x05C06, 0x05F53, 0x03781, 0x05C60, 0x05CC0,
+    0x05C8D, 0x21DE4, 0x05D43, 0x21DE6, 0x05D6E, 0x05D6B, 0x05D7C, 0x05DE1,
+    0x05DE2, 0x0382F, 0x05DFD, 0x05E28, 0x05E3D, 0x05E69, 0x03862, 0x22183,
+    0x0387C, 0x05EB0, 0x05EB3, 0x05EB6, 0x2A392, 0x22331, 0x08201, 0x05F22,
+    0x038C7, 0x232B8, 0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD,
+    0x05FD7, 0x05FF9, 0x06081, 0x0393A, 0x0391C, 0x226D4, 0x060C7, 0x06148,
+    0x0614C, 0x0617A, 0x061B2, 0x061A4, 0x061AF, 0x061DE, 0x06210, 0x0621B,
+    0x0625D, 0x062B1, 0x062D4, 0x06350, 0x22B0C, 0x0633D, 0x062FC, 0x06368,
+    0x06383, 0x063E4, 0x22BF1, 0x06422, 0x063C5, 0x063A9, 0x03A2E, 0x06469,
+    0x0647E, 0x0649D, 0x06477, 0x03A6C, 0x0656C, 0x2300A, 0x065E3, 0x066F8,
+    0x06649, 0x03B19, 0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C,
+    0x080AD, 0x043D9, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA,
+    0x06785, 0x06852, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x06942, 0x069A3,
+    0x069EA, 0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21, 0x238A7, 0x06B54,
+    0x03C4E, 0x06B72, 0x06B9F, 0x06BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x06C4E,
+    0x23CBC, 0x06CBF, 0x06CCD, 0x06C67, 0x06D16, 0x06D3E, 0x06D69, 0x06D78,
+    0x06D85, 0x23D1E, 0x06D34, 0x06E2F, 0x06E6E, 0x03D33, 0x06EC7, 0x23ED1,
+    0x06DF9, 0x06F6E, 0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701B, 0x03D96,
+    0x0704A, 0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C,
+    0x243AB, 0x07228, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814,
+    0x0737A, 0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x07447, 0x0745C, 0x07485,
+    0x074CA, 0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92, 0x2219F, 0x07610,
+    0x24FA1, 0x24FB8, 0x25044, 0x03FFC, 0x04008, 0x250F3, 0x250F2, 0x25119,
+    0x25133, 0x0771E, 0x0771F, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E,
+    0x040E3, 0x25626, 0x2569A, 0x256C5, 0x079EB, 0x0412F, 0x07A4A, 0x07A4F,
+    0x2597C, 0x25AA7, 0x07AEE, 0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227,
+    0x25C80, 0x07CD2, 0x042A0, 0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63,
+    0x04301, 0x07DC7, 0x07E02, 0x07E45, 0x04334, 0x26228, 0x26247, 0x04359,
+    0x262D9, 0x07F7A, 0x2633E, 0x07F95, 0x07FFA, 0x264DA, 0x26523, 0x08060,
+    0x265A8, 0x08070, 0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E,
+    0x05AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x08204, 0x08F9E, 0x0446B,
+    0x08291, 0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6,
+    0x26B3C, 0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08353,
+    0x083CA, 0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B, 0x084F1,
+    0x084F3, 0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561, 0x26FB1,
+    0x270D2, 0x0456B, 0x08650, 0x08667, 0x08669, 0x086A9, 0x08688, 0x0870E,
+    0x086E2, 0x08728, 0x0876B, 0x08786, 0x045D7, 0x087E1, 0x08801, 0x045F9,
+    0x08860, 0x27667, 0x088D7, 0x088DE, 0x04635, 0x088FA, 0x034BB, 0x278AE,
+    0x27966, 0x046BE, 0x046C7, 0x08AA0, 0x27CA8, 0x08CAB, 0x08CC1, 0x08D1B,
+    0x08D77, 0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE, 0x08ED4,
+    0x285D2, 0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B, 0x09238,
+    0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995,
+    0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145, 0x2921A,
+    0x04A6E, 0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x09829, 0x295B6,
+    0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE, 0x04BCE, 0x29B30,
+    0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67, 0x2A0CE, 0x04CF8, 0x2A105,
+    0x2A20E, 0x2A291, 0x04D56, 0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x2A600
+};
+
+//
+// Primary composites but the Hangul syllables, sorted by first and second
+// code point.
+//
+struct CompositionEntry
+{
+    UtilInternal::UTF32 first;
+    UtilInternal::UTF32 second;
+    UtilInternal::UTF32 composite;
+};
+
+static const CompositionEntry compositions[941] =
+{
+    { 0x0003C, 0x00338, 0x0226E },
+    { 0x0003D, 0x00338, 0x02260 },
+    { 0x0003E, 0x00338, 0x0226F },
+    { 0x00041, 0x00300, 0x000C0 },
+    { 0x00041, 0x00301, 0x000C1 },
+    { 0x00041, 0x00302, 0x000C2 },
+    { 0x00041, 0x00303, 0x000C3 },
+    { 0x00041, 0x00304, 0x00100 },
+    { 0x00041, 0x00306, 0x00102 },
+    { 0x00041, 0x00307, 0x00226 },
+    { 0x00041, 0x00308, 0x000C4 },
+    { 0x00041, 0x00309, 0x01EA2 },
+    { 0x00041, 0x0030A, 0x000C5 },
+    { 0x00041, 0x0030C, 0x001CD },
+    { 0x00041, 0x0030F, 0x00200 },
+    { 0x00041, 0x00311, 0x00202 },
+    { 0x00041, 0x00323, 0x01EA0 },
+    { 0x00041, 0x00325, 0x01E00 },
+    { 0x00041, 0x00328, 0x00104 },
+    { 0x00042, 0x00307, 0x01E02 },
+    { 0x00042, 0x00323, 0x01E04 },
+    { 0x00042, 0x00331, 0x01E06 },
+    { 0x00043, 0x00301, 0x00106 },
+    { 0x00043, 0x00302, 0x00108 },
+    { 0x00043, 0x00307, 0x0010A },
+    { 0x00043, 0x0030C, 0x0010C },
+    { 0x00043, 0x00327, 0x000C7 },
+    { 0x00044, 0x00307, 0x01E0A },
+    { 0x00044, 0x0030C, 0x0010E },
+    { 0x00044, 0x00323, 0x01E0C },
+    { 0x00044, 0x00327, 0x01E10 },
+    { 0x00044, 0x0032D, 0x01E12 },
+    { 0x00044, 0x00331, 0x01E0E },
+    { 0x00045, 0x00300, 0x000C8 },
+    { 0x00045, 0x00301, 0x000C9 },
+    { 0x00045, 0x00302, 0x000CA },
+    { 0x00045, 0x00303, 0x01EBC },
+    { 0x00045, 0x00304, 0x00112 },
+    { 0x00045, 0x00306, 0x00114 },
+    { 0x00045, 0x00307, 0x00116 },
+    { 0x00045, 0x00308, 0x000CB },
+    { 0x00045, 0x00309, 0x01EBA },
+    { 0x00045, 0x0030C, 0x0011A },
+    { 0x00045, 0x0030F, 0x00204 },
+    { 0x00045, 0x00311, 0x00206 },
+    { 0x00045, 0x00323, 0x01EB8 },
+    { 0x00045, 0x00327, 0x00228 },
+    { 0x00045, 0x00328, 0x00118 },
+    { 0x00045, 0x0032D, 0x01E18 },
+    { 0x00045, 0x00330, 0x01E1A },
+    { 0x00046, 0x00307, 0x01E1E },
+    { 0x00047, 0x00301, 0x001F4 },
+    { 0x00047, 0x00302, 0x0011C },
+    { 0x00047, 0x00304, 0x01E20 },
+    { 0x00047, 0x00306, 0x0011E },
+    { 0x00047, 0x00307, 0x00120 },
+    { 0x00047, 0x0030C, 0x001E6 },
+    { 0x00047, 0x00327, 0x00122 },
+    { 0x00048, 0x00302, 0x00124 },
+    { 0x00048, 0x00307, 0x01E22 },
+    { 0x00048, 0x00308, 0x01E26 },
+    { 0x00048, 0x0030C, 0x0021E },
+    { 0x00048, 0x00323, 0x01E24 },
+    { 0x00048, 0x00327, 0x01E28 },
+    { 0x00048, 0x0032E, 0x01E2A },
+    { 0x00049, 0x00300, 0x000CC },
+    { 0x00049, 0x00301, 0x000CD },
+    { 0x00049, 0x00302, 0x000CE },
+    { 0x00049, 0x00303, 0x00128 },
+    { 0x00049, 0x00304, 0x0012A },
+    { 0x00049, 0x00306, 0x0012C },
+    { 0x00049, 0x00307, 0x00130 },
+    { 0x00049, 0x00308, 0x000CF },
+    { 0x00049, 0x00309, 0x01EC8 },
+    { 0x00049, 0x0030C, 0x001CF },
+    { 0x00049, 0x0030F, 0x00208 },
+    { 0x00049, 0x00311, 0x0020A },
+    { 0x00049, 0x00323, 0x01ECA },
+    { 0x00049, 0x00328, 0x0012E },
+    { 0x00049, 0x00330, 0x01E2C },
+    { 0x0004A, 0x00302, 0x00134 },
+    { 0x0004B, 0x00301, 0x01E30 },
+    { 0x0004B, 0x0030C, 0x001E8 },
+    { 0x0004B, 0x00323, 0x01E32 },
+    { 0x0004B, 0x00327, 0x00136 },
+    { 0x0004B, 0x00331, 0x01E34 },
+    { 0x0004C, 0x00301, 0x00139 },
+    { 0x0004C, 0x0030C, 0x0013D },
+    { 0x0004C, 0x00323, 0x01E36 },
+    { 0x0004C, 0x00327, 0x0013B },
+    { 0x0004C, 0x0032D, 0x01E3C },
+    { 0x0004C, 0x00331, 0x01E3A },
+    { 0x0004D, 0x00301, 0x01E3E },
+    { 0x0004D, 0x00307, 0x01E40 },
+    { 0x0004D, 0x00323, 0x01E42 },
+    { 0x0004E, 0x00300, 0x001F8 },
+    { 0x0004E, 0x00301, 0x00143 },
+    { 0x0004E, 0x00303, 0x000D1 },
+    { 0x0004E, 0x00307, 0x01E44 },
+    { 0x0004E, 0x0030C, 0x00147 },
+    { 0x0004E, 0x00323, 0x01E46 },
+    { 0x0004E, 0x00327, 0x00145 },
+    { 0x0004E, 0x0032D, 0x01E4A },
+    { 0x0004E, 0x00331, 0x01E48 },
+    { 0x0004F, 0x00300, 0x000D2 },
+    { 0x0004F, 0x00301, 0x000D3 },
+    { 0x0004F, 0x00302, 0x000D4 },
+    { 0x0004F, 0x00303, 0x000D5 },
+    { 0x0004F, 0x00304, 0x0014C },
+    { 0x0004F, 0x00306, 0x0014E },
+    { 0x0004F, 0x00307, 0x0022E },
+    { 0x0004F, 0x00308, 0x000D6 },
+    { 0x0004F, 0x00309, 0x01ECE },
+    { 0x0004F, 0x0030B, 0x00150 },
+    { 0x0004F, 0x0030C, 0x001D1 },
+    { 0x0004F, 0x0030F, 0x0020C },
+    { 0x0004F, 0x00311, 0x0020E },
+    { 0x0004F, 0x0031B, 0x001A0 },
+    { 0x0004F, 0x00323, 0x01ECC },
+    { 0x0004F, 0x00328, 0x001EA },
+    { 0x00050, 0x00301, 0x01E54 },
+    { 0x00050, 0x00307, 0x01E56 },
+    { 0x00052, 0x00301, 0x00154 },
+    { 0x00052, 0x00307, 0x01E58 },
+    { 0x00052, 0x0030C, 0x00158 },
+    { 0x00052, 0x0030F, 0x00210 },
+    { 0x00052, 0x00311, 0x00212 },
+    { 0x00052, 0x00323, 0x01E5A },
+    { 0x00052, 0x00327, 0x00156 },
+    { 0x00052, 0x00331, 0x01E5E },
+    { 0x00053, 0x00301, 0x0015A },
+    { 0x00053, 0x00302, 0x0015C },
+    { 0x00053, 0x00307, 0x01E60 },
+    { 0x00053, 0x0030C, 0x00160 },
+    { 0x00053, 0x00323, 0x01E62 },
+    { 0x00053, 0x00326, 0x00218 },
+    { 0x00053, 0x00327, 0x0015E },
+    { 0x00054, 0x00307, 0x01E6A },
+    { 0x00054, 0x0030C, 0x00164 },
+    { 0x00054, 0x00323, 0x01E6C },
+    { 0x00054, 0x00326, 0x0021A },
+    { 0x00054, 0x00327, 0x00162 },
+    { 0x00054, 0x0032D, 0x01E70 },
+    { 0x00054, 0x00331, 0x01E6E },
+    { 0x00055, 0x00300, 0x000D9 },
+    { 0x00055, 0x00301, 0x000DA },
+    { 0x00055, 0x00302, 0x000DB },
+    { 0x00055, 0x00303, 0x00168 },
+    { 0x00055, 0x00304, 0x0016A },
+    { 0x00055, 0x00306, 0x0016C },
+    { 0x00055, 0x00308, 0x000DC },
+    { 0x00055, 0x00309, 0x01EE6 },
+    { 0x00055, 0x0030A, 0x0016E },
+    { 0x00055, 0x0030B, 0x00170 },
+    { 0x00055, 0x0030C, 0x001D3 },
+    { 0x00055, 0x0030F, 0x00214 },
+    { 0x00055, 0x00311, 0x00216 },
+    { 0x00055, 0x0031B, 0x001AF },
+    { 0x00055, 0x00323, 0x01EE4 },
+    { 0x00055, 0x00324, 0x01E72 },
+    { 0x00055, 0x00328, 0x00172 },
+    { 0x00055, 0x0032D, 0x01E76 },
+    { 0x00055, 0x00330, 0x01E74 },
+    { 0x00056, 0x00303, 0x01E7C },
+    { 0x00056, 0x00323, 0x01E7E },
+    { 0x00057, 0x00300, 0x01E80 },
+    { 0x00057, 0x00301, 0x01E82 },
+    { 0x00057, 0x00302, 0x00174 },
+    { 0x00057, 0x00307, 0x01E86 },
+    { 0x00057, 0x00308, 0x01E84 },
+    { 0x00057, 0x00323, 0x01E88 },
+    { 0x00058, 0x00307, 0x01E8A },
+    { 0x00058, 0x00308, 0x01E8C },
+    { 0x00059, 0x00300, 0x01EF2 },
+    { 0x00059, 0x00301, 0x000DD },
+    { 0x00059, 0x00302, 0x00176 },
+    { 0x00059, 0x00303, 0x01EF8 },
+    { 0x00059, 0x00304, 0x00232 },
+    { 0x00059, 0x00307, 0x01E8E },
+    { 0x00059, 0x00308, 0x00178 },
+    { 0x00059, 0x00309, 0x01EF6 },
+    { 0x00059, 0x00323, 0x01EF4 },
+    { 0x0005A, 0x00301, 0x00179 },
+    { 0x0005A, 0x00302, 0x01E90 },
+    { 0x0005A, 0x00307, 0x0017B },
+    { 0x0005A, 0x0030C, 0x0017D },
+    { 0x0005A, 0x00323, 0x01E92 },
+    { 0x0005A, 0x00331, 0x01E94 },
+    { 0x00061, 0x00300, 0x000E0 },
+    { 0x00061, 0x00301, 0x000E1 },
+    { 0x00061, 0x00302, 0x000E2 },
+    { 0x00061, 0x00303, 0x000E3 },
+    { 0x00061, 0x00304, 0x00101 },
+    { 0x00061, 0x00306, 0x00103 },
+    { 0x00061, 0x00307, 0x00227 },
+    { 0x00061, 0x00308, 0x000E4 },
+    { 0x00061, 0x00309, 0x01EA3 },
+    { 0x00061, 0x0030A, 0x000E5 },
+    { 0x00061, 0x0030C, 0x001CE },
+    { 0x00061, 0x0030F, 0x00201 },
+    { 0x00061, 0x00311, 0x00203 },
+    { 0x00061, 0x00323, 0x01EA1 },
+    { 0x00061, 0x00325, 0x01E01 },
+    { 0x00061, 0x00328, 0x00105 },
+    { 0x00062, 0x00307, 0x01E03 },
+    { 0x00062, 0x00323, 0x01E05 },
+    { 0x00062, 0x00331, 0x01E07 },
+    { 0x00063, 0x00301, 0x00107 },
+    { 0x00063, 0x00302, 0x00109 },
+    { 0x00063, 0x00307, 0x0010B },
+    { 0x00063, 0x0030C, 0x0010D },
+    { 0x00063, 0x00327, 0x000E7 },
+    { 0x00064, 0x00307, 0x01E0B },
+    { 0x00064, 0x0030C, 0x0010F },
+    { 0x00064, 0x00323, 0x01E0D },
+    { 0x00064, 0x00327, 0x01E11 },
+    { 0x00064, 0x0032D, 0x01E13 },
+    { 0x00064, 0x00331, 0x01E0F },
+    { 0x00065, 0x00300, 0x000E8 },
+    { 0x00065, 0x00301, 0x000E9 },
+    { 0x00065, 0x00302, 0x000EA },
+    { 0x00065, 0x00303, 0x01EBD },
+    { 0x00065, 0x00304, 0x00113 },
+    { 0x00065, 0x00306, 0x00115 },
+    { 0x00065, 0x00307, 0x00117 },
+    { 0x00065, 0x00308, 0x000EB },
+    { 0x00065, 0x00309, 0x01EBB },
+    { 0x00065, 0x0030C, 0x0011B },
+    { 0x00065, 0x0030F, 0x00205 },
+    { 0x00065, 0x00311, 0x00207 },
+    { 0x00065, 0x00323, 0x01EB9 },
+    { 0x00065, 0x00327, 0x00229 },
+    { 0x00065, 0x00328, 0x00119 },
+    { 0x00065, 0x0032D, 0x01E19 },
+    { 0x00065, 0x00330, 0x01E1B },
+    { 0x00066, 0x00307, 0x01E1F },
+    { 0x00067, 0x00301, 0x001F5 },
+    { 0x00067, 0x00302, 0x0011D },
+    { 0x00067, 0x00304, 0x01E21 },
+    { 0x00067, 0x00306, 0x0011F },
+    { 0x00067, 0x00307, 0x00121 },
+    { 0x00067, 0x0030C, 0x001E7 },
+    { 0x00067, 0x00327, 0x00123 },
+    { 0x00068, 0x00302, 0x00125 },
+    { 0x00068, 0x00307, 0x01E23 },
+    { 0x00068, 0x00308, 0x01E27 },
+    { 0x00068, 0x0030C, 0x0021F },
+    { 0x00068, 0x00323, 0x01E25 },
+    { 0x00068, 0x00327, 0x01E29 },
+    { 0x00068, 0x0032E, 0x01E2B },
+    { 0x00068, 0x00331, 0x01E96 },
+    { 0x00069, 0x00300, 0x000EC },
+    { 0x00069, 0x00301, 0x000ED },
+    { 0x00069, 0x00302, 0x000EE },
+    { 0x00069, 0x00303, 0x00129 },
+    { 0x00069, 0x00304, 0x0012B },
+    { 0x00069, 0x00306, 0x0012D },
+    { 0x00069, 0x00308, 0x000EF },
+    { 0x00069, 0x00309, 0x01EC9 },
+    { 0x00069, 0x0030C, 0x001D0 },
+    { 0x00069, 0x0030F, 0x00209 },
+    { 0x00069, 0x00311, 0x0020B },
+    { 0x00069, 0x00323, 0x01ECB },
+    { 0x00069, 0x00328, 0x0012F },
+    { 0x00069, 0x00330, 0x01E2D },
+    { 0x0006A, 0x00302, 0x00135 },
+    { 0x0006A, 0x0030C, 0x001F0 },
+    { 0x0006B, 0x00301, 0x01E31 },
+    { 0x0006B, 0x0030C, 0x001E9 },
+    { 0x0006B, 0x00323, 0x01E33 },
+    { 0x0006B, 0x00327, 0x00137 },
+    { 0x0006B, 0x00331, 0x01E35 },
+    { 0x0006C, 0x00301, 0x0013A },
+    { 0x0006C, 0x0030C, 0x0013E },
+    { 0x0006C, 0x00323, 0x01E37 },
+    { 0x0006C, 0x00327, 0x0013C },
+    { 0x0006C, 0x0032D, 0x01E3D },
+    { 0x0006C, 0x00331, 0x01E3B },
+    { 0x0006D, 0x00301, 0x01E3F },
+    { 0x0006D, 0x00307, 0x01E41 },
+    { 0x0006D, 0x00323, 0x01E43 },
+    { 0x0006E, 0x00300, 0x001F9 },
+    { 0x0006E, 0x00301, 0x00144 },
+    { 0x0006E, 0x00303, 0x000F1 },
+    { 0x0006E, 0x00307, 0x01E45 },
+    { 0x0006E, 0x0030C, 0x00148 },
+    { 0x0006E, 0x00323, 0x01E47 },
+    { 0x0006E, 0x00327, 0x00146 },
+    { 0x0006E, 0x0032D, 0x01E4B },
+    { 0x0006E, 0x00331, 0x01E49 },
+    { 0x0006F, 0x00300, 0x000F2 },
+    { 0x0006F, 0x00301, 0x000F3 },
+    { 0x0006F, 0x00302, 0x000F4 },
+    { 0x0006F, 0x00303, 0x000F5 },
+    { 0x0006F, 0x00304, 0x0014D },
+    { 0x0006F, 0x00306, 0x0014F },
+    { 0x0006F, 0x00307, 0x0022F },
+    { 0x0006F, 0x00308, 0x000F6 },
+    { 0x0006F, 0x00309, 0x01ECF },
+    { 0x0006F, 0x0030B, 0x00151 },
+    { 0x0006F, 0x0030C, 0x001D2 },
+    { 0x0006F, 0x0030F, 0x0020D },
+    { 0x0006F, 0x00311, 0x0020F },
+    { 0x0006F, 0x0031B, 0x001A1 },
+    { 0x0006F, 0x00323, 0x01ECD },
+    { 0x0006F, 0x00328, 0x001EB },
+    { 0x00070, 0x00301, 0x01E55 },
+    { 0x00070, 0x00307, 0x01E57 },
+    { 0x00072, 0x00301, 0x00155 },
+    { 0x00072, 0x00307, 0x01E59 },
+    { 0x00072, 0x0030C, 0x00159 },
+    { 0x00072, 0x0030F, 0x00211 },
+    { 0x00072, 0x00311, 0x00213 },
+    { 0x00072, 0x00323, 0x01E5B },
+    { 0x00072, 0x00327, 0x00157 },
+    { 0x00072, 0x00331, 0x01E5F },
+    { 0x00073, 0x00301, 0x0015B },
+    { 0x00073, 0x00302, 0x0015D },
+    { 0x00073, 0x00307, 0x01E61 },
+    { 0x00073, 0x0030C, 0x00161 },
+    { 0x00073, 0x00323, 0x01E63 },
+    { 0x00073, 0x00326, 0x00219 },
+    { 0x00073, 0x00327, 0x0015F },
+    { 0x00074, 0x00307, 0x01E6B },
+    { 0x00074, 0x00308, 0x01E97 },
+    { 0x00074, 0x0030C, 0x00165 },
+    { 0x00074, 0x00323, 0x01E6D },
+    { 0x00074, 0x00326, 0x0021B },
+    { 0x00074, 0x00327, 0x00163 },
+    { 0x00074, 0x0032D, 0x01E71 },
+    { 0x00074, 0x00331, 0x01E6F },
+    { 0x00075, 0x00300, 0x000F9 },
+    { 0x00075, 0x00301, 0x000FA },
+    { 0x00075, 0x00302, 0x000FB },
+    { 0x00075, 0x00303, 0x00169 },
+    { 0x00075, 0x00304, 0x0016B },
+    { 0x00075, 0x00306, 0x0016D },
+    { 0x00075, 0x00308, 0x000FC },
+    { 0x00075, 0x00309, 0x01EE7 },
+    { 0x00075, 0x0030A, 0x0016F },
+    { 0x00075, 0x0030B, 0x00171 },
+    { 0x00075, 0x0030C, 0x001D4 },
+    { 0x00075, 0x0030F, 0x00215 },
+    { 0x00075, 0x00311, 0x00217 },
+    { 0x00075, 0x0031B, 0x001B0 },
+    { 0x00075, 0x00323, 0x01EE5 },
+    { 0x00075, 0x00324, 0x01E73 },
+    { 0x00075, 0x00328, 0x00173 },
+    { 0x00075, 0x0032D, 0x01E77 },
+    { 0x00075, 0x00330, 0x01E75 },
+    { 0x00076, 0x00303, 0x01E7D },
+    { 0x00076, 0x00323, 0x01E7F },
+    { 0x00077, 0x00300, 0x01E81 },
+    { 0x00077, 0x00301, 0x01E83 },
+    { 0x00077, 0x00302, 0x00175 },
+    { 0x00077, 0x00307, 0x01E87 },
+    { 0x00077, 0x00308, 0x01E85 },
+    { 0x00077, 0x0030A, 0x01E98 },
+    { 0x00077, 0x00323, 0x01E89 },
+    { 0x00078, 0x00307, 0x01E8B },
+    { 0x00078, 0x00308, 0x01E8D },
+    { 0x00079, 0x00300, 0x01EF3 },
+    { 0x00079, 0x00301, 0x000FD },
+    { 0x00079, 0x00302, 0x00177 },
+    { 0x00079, 0x00303, 0x01EF9 },
+    { 0x00079, 0x00304, 0x00233 },
+    { 0x00079, 0x00307, 0x01E8F },
+    { 0x00079, 0x00308, 0x000FF },
+    { 0x00079, 0x00309, 0x01EF7 },
+    { 0x00079, 0x0030A, 0x01E99 },
+    { 0x00079, 0x00323, 0x01EF5 },
+    { 0x0007A, 0x00301, 0x0017A },
+    { 0x0007A, 0x00302, 0x01E91 },
+    { 0x0007A, 0x00307, 0x0017C },
+    { 0x0007A, 0x0030C, 0x0017E },
+    { 0x0007A, 0x00323, 0x01E93 },
+    { 0x0007A, 0x00331, 0x01E95 },
+    { 0x000A8, 0x00300, 0x01FED },
+    { 0x000A8, 0x00301, 0x00385 },
+    { 0x000A8, 0x00342, 0x01FC1 },
+    { 0x000C2, 0x00300, 0x01EA6 },
+    { 0x000C2, 0x00301, 0x01EA4 },
+    { 0x000C2, 0x00303, 0x01EAA },
+    { 0x000C2, 0x00309, 0x01EA8 },
+    { 0x000C4, 0x00304, 0x001DE },
+    { 0x000C5, 0x00301, 0x001FA },
+    { 0x000C6, 0x00301, 0x001FC },
+    { 0x000C6, 0x00304, 0x001E2 },
+    { 0x000C7, 0x00301, 0x01E08 },
+    { 0x000CA, 0x00300, 0x01EC0 },
+    { 0x000CA, 0x00301, 0x01EBE },
+    { 0x000CA, 0x00303, 0x01EC4 },
+    { 0x000CA, 0x00309, 0x01EC2 },
+    { 0x000CF, 0x00301, 0x01E2E },
+    { 0x000D4, 0x00300, 0x01ED2 },
+    { 0x000D4, 0x00301, 0x01ED0 },
+    { 0x000D4, 0x00303, 0x01ED6 },
+    { 0x000D4, 0x00309, 0x01ED4 },
+    { 0x000D5, 0x00301, 0x01E4C },
+    { 0x000D5, 0x00304, 0x0022C },
+    { 0x000D5, 0x00308, 0x01E4E },
+    { 0x000D6, 0x00304, 0x0022A },
+    { 0x000D8, 0x00301, 0x001FE },
+    { 0x000DC, 0x00300, 0x001DB },
+    { 0x000DC, 0x00301, 0x001D7 },
+    { 0x000DC, 0x00304, 0x001D5 },
+    { 0x000DC, 0x0030C, 0x001D9 },
+    { 0x000E2, 0x00300, 0x01EA7 },
+    { 0x000E2, 0x00301, 0x01EA5 },
+    { 0x000E2, 0x00303, 0x01EAB },
+    { 0x000E2, 0x00309, 0x01EA9 },
+    { 0x000E4, 0x00304, 0x001DF },
+    { 0x000E5, 0x00301, 0x001FB },
+    { 0x000E6, 0x00301, 0x001FD },
+    { 0x000E6, 0x00304, 0x001E3 },
+    { 0x000E7, 0x00301, 0x01E09 },
+    { 0x000EA, 0x00300, 0x01EC1 },
+    { 0x000EA, 0x00301, 0x01EBF },
+    { 0x000EA, 0x00303, 0x01EC5 },
+    { 0x000EA, 0x00309, 0x01EC3 },
+    { 0x000EF, 0x00301, 0x01E2F },
+    { 0x000F4, 0x00300, 0x01ED3 },
+    { 0x000F4, 0x00301, 0x01ED1 },
+    { 0x000F4, 0x00303, 0x01ED7 },
+    { 0x000F4, 0x00309, 0x01ED5 },
+    { 0x000F5, 0x00301, 0x01E4D },
+    { 0x000F5, 0x00304, 0x0022D },
+    { 0x000F5, 0x00308, 0x01E4F },
+    { 0x000F6, 0x00304, 0x0022B },
+    { 0x000F8, 0x00301, 0x001FF },
+    { 0x000FC, 0x00300, 0x001DC },
+    { 0x000FC, 0x00301, 0x001D8 },
+    { 0x000FC, 0x00304, 0x001D6 },
+    { 0x000FC, 0x0030C, 0x001DA },
+    { 0x00102, 0x00300, 0x01EB0 },
+    { 0x00102, 0x00301, 0x01EAE },
+    { 0x00102, 0x00303, 0x01EB4 },
+    { 0x00102, 0x00309, 0x01EB2 },
+    { 0x00103, 0x00300, 0x01EB1 },
+    { 0x00103, 0x00301, 0x01EAF },
+    { 0x00103, 0x00303, 0x01EB5 },
+    { 0x00103, 0x00309, 0x01EB3 },
+    { 0x00112, 0x00300, 0x01E14 },
+    { 0x00112, 0x00301, 0x01E16 },
+    { 0x00113, 0x00300, 0x01E15 },
+    { 0x00113, 0x00301, 0x01E17 },
+    { 0x0014C, 0x00300, 0x01E50 },
+    { 0x0014C, 0x00301, 0x01E52 },
+    { 0x0014D, 0x00300, 0x01E51 },
+    { 0x0014D, 0x00301, 0x01E53 },
+    { 0x0015A, 0x00307, 0x01E64 },
+    { 0x0015B, 0x00307, 0x01E65 },
+    { 0x00160, 0x00307, 0x01E66 },
+    { 0x00161, 0x00307, 0x01E67 },
+    { 0x00168, 0x00301, 0x01E78 },
+    { 0x00169, 0x00301, 0x01E79 },
+    { 0x0016A, 0x00308, 0x01E7A },
+    { 0x0016B, 0x00308, 0x01E7B },
+    { 0x0017F, 0x00307, 0x01E9B },
+    { 0x001A0, 0x00300, 0x01EDC },
+    { 0x001A0, 0x00301, 0x01EDA },
+    { 0x001A0, 0x00303, 0x01EE0 },
+    { 0x001A0, 0x00309, 0x01EDE },
+    { 0x001A0, 0x00323, 0x01EE2 },
+    { 0x001A1, 0x00300, 0x01EDD },
+    { 0x001A1, 0x00301, 0x01EDB },
+    { 0x001A1, 0x00303, 0x01EE1 },
+    { 0x001A1, 0x00309, 0x01EDF },
+    { 0x001A1, 0x00323, 0x01EE3 },
+    { 0x001AF, 0x00300, 0x01EEA },
+    { 0x001AF, 0x00301, 0x01EE8 },
+    { 0x001AF, 0x00303, 0x01EEE },
+    { 0x001AF, 0x00309, 0x01EEC },
+    { 0x001AF, 0x00323, 0x01EF0 },
+    { 0x001B0, 0x00300, 0x01EEB },
+    { 0x001B0, 0x00301, 0x01EE9 },
+    { 0x001B0, 0x00303, 0x01EEF },
+    { 0x001B0, 0x00309, 0x01EED },
+    { 0x001B0, 0x00323, 0x01EF1 },
+    { 0x001B7, 0x0030C, 0x001EE },
+    { 0x001EA, 0x00304, 0x001EC },
+    { 0x001EB, 0x00304, 0x001ED },
+    { 0x00226, 0x00304, 0x001E0 },
+    { 0x00227, 0x00304, 0x001E1 },
+    { 0x00228, 0x00306, 0x01E1C },
+    { 0x00229, 0x00306, 0x01E1D },
+    { 0x0022E, 0x00304, 0x00230 },
+    { 0x0022F, 0x00304, 0x00231 },
+    { 0x00292, 0x0030C, 0x001EF },
+    { 0x00391, 0x00300, 0x01FBA },
+    { 0x00391, 0x00301, 0x00386 },
+    { 0x00391, 0x00304, 0x01FB9 },
+    { 0x00391, 0x00306, 0x01FB8 },
+    { 0x00391, 0x00313, 0x01F08 },
+    { 0x00391, 0x00314, 0x01F09 },
+    { 0x00391, 0x00345, 0x01FBC },
+    { 0x00395, 0x00300, 0x01FC8 },
+    { 0x00395, 0x00301, 0x00388 },
+    { 0x00395, 0x00313, 0x01F18 },
+    { 0x00395, 0x00314, 0x01F19 },
+    { 0x00397, 0x00300, 0x01FCA },
+    { 0x00397, 0x00301, 0x00389 },
+    { 0x00397, 0x00313, 0x01F28 },
+    { 0x00397, 0x00314, 0x01F29 },
+    { 0x00397, 0x00345, 0x01FCC },
+    { 0x00399, 0x00300, 0x01FDA },
+    { 0x00399, 0x00301, 0x0038A },
+    { 0x00399, 0x00304, 0x01FD9 },
+    { 0x00399, 0x00306, 0x01FD8 },
+    { 0x00399, 0x00308, 0x003AA },
+    { 0x00399, 0x00313, 0x01F38 },
+    { 0x00399, 0x00314, 0x01F39 },
+    { 0x0039F, 0x00300, 0x01FF8 },
+    { 0x0039F, 0x00301, 0x0038C },
+    { 0x0039F, 0x00313, 0x01F48 },
+    { 0x0039F, 0x00314, 0x01F49 },
+    { 0x003A1, 0x00314, 0x01FEC },
+    { 0x003A5, 0x00300, 0x01FEA },
+    { 0x003A5, 0x00301, 0x0038E },
+    { 0x003A5, 0x00304, 0x01FE9 },
+    { 0x003A5, 0x00306, 0x01FE8 },
+    { 0x003A5, 0x00308, 0x003AB },
+    { 0x003A5, 0x00314, 0x01F59 },
+    { 0x003A9, 0x00300, 0x01FFA },
+    { 0x003A9, 0x00301, 0x0038F },
+    { 0x003A9, 0x00313, 0x01F68 },
+    { 0x003A9, 0x00314, 0x01F69 },
+    { 0x003A9, 0x00345, 0x01FFC },
+    { 0x003AC, 0x00345, 0x01FB4 },
+    { 0x003AE, 0x00345, 0x01FC4 },
+    { 0x003B1, 0x00300, 0x01F70 },
+    { 0x003B1, 0x00301, 0x003AC },
+    { 0x003B1, 0x00304, 0x01FB1 },
+    { 0x003B1, 0x00306, 0x01FB0 },
+    { 0x003B1, 0x00313, 0x01F00 },
+    { 0x003B1, 0x00314, 0x01F01 },
+    { 0x003B1, 0x00342, 0x01FB6 },
+    { 0x003B1, 0x00345, 0x01FB3 },
+    { 0x003B5, 0x00300, 0x01F72 },
+    { 0x003B5, 0x00301, 0x003AD },
+    { 0x003B5, 0x00313, 0x01F10 },
+    { 0x003B5, 0x00314, 0x01F11 },
+    { 0x003B7, 0x00300, 0x01F74 },
+    { 0x003B7, 0x00301, 0x003AE },
+    { 0x003B7, 0x00313, 0x01F20 },
+    { 0x003B7, 0x00314, 0x01F21 },
+    { 0x003B7, 0x00342, 0x01FC6 },
+    { 0x003B7, 0x00345, 0x01FC3 },
+    { 0x003B9, 0x00300, 0x01F76 },
+    { 0x003B9, 0x00301, 0x003AF },
+    { 0x003B9, 0x00304, 0x01FD1 },
+    { 0x003B9, 0x00306, 0x01FD0 },
+    { 0x003B9, 0x00308, 0x003CA },
+    { 0x003B9, 0x00313, 0x01F30 },
+    { 0x003B9, 0x00314, 0x01F31 },
+    { 0x003B9, 0x00342, 0x01FD6 },
+    { 0x003BF, 0x00300, 0x01F78 },
+    { 0x003BF, 0x00301, 0x003CC },
+    { 0x003BF, 0x00313, 0x01F40 },
+    { 0x003BF, 0x00314, 0x01F41 },
+    { 0x003C1, 0x00313, 0x01FE4 },
+    { 0x003C1, 0x00314, 0x01FE5 },
+    { 0x003C5, 0x00300, 0x01F7A },
+    { 0x003C5, 0x00301, 0x003CD },
+    { 0x003C5, 0x00304, 0x01FE1 },
+    { 0x003C5, 0x00306, 0x01FE0 },
+    { 0x003C5, 0x00308, 0x003CB },
+    { 0x003C5, 0x00313, 0x01F50 },
+    { 0x003C5, 0x00314, 0x01F51 },
+    { 0x003C5, 0x00342, 0x01FE6 },
+    { 0x003C9, 0x00300, 0x01F7C },
+    { 0x003C9, 0x00301, 0x003CE },
+    { 0x003C9, 0x00313, 0x01F60 },
+    { 0x003C9, 0x00314, 0x01F61 },
+    { 0x003C9, 0x00342, 0x01FF6 },
+    { 0x003C9, 0x00345, 0x01FF3 },
+    { 0x003CA, 0x00300, 0x01FD2 },
+    { 0x003CA, 0x00301, 0x00390 },
+    { 0x003CA, 0x00342, 0x01FD7 },
+    { 0x003CB, 0x00300, 0x01FE2 },
+    { 0x003CB, 0x00301, 0x003B0 },
+    { 0x003CB, 0x00342, 0x01FE7 },
+    { 0x003CE, 0x00345, 0x01FF4 },
+    { 0x003D2, 0x00301, 0x003D3 },
+    { 0x003D2, 0x00308, 0x003D4 },
+    { 0x00406, 0x00308, 0x00407 },
+    { 0x00410, 0x00306, 0x004D0 },
+    { 0x00410, 0x00308, 0x004D2 },
+    { 0x00413, 0x00301, 0x00403 },
+    { 0x00415, 0x00300, 0x00400 },
+    { 0x00415, 0x00306, 0x004D6 },
+    { 0x00415, 0x00308, 0x00401 },
+    { 0x00416, 0x00306, 0x004C1 },
+    { 0x00416, 0x00308, 0x004DC },
+    { 0x00417, 0x00308, 0x004DE },
+    { 0x00418, 0x00300, 0x0040D },
+    { 0x00418, 0x00304, 0x004E2 },
+    { 0x00418, 0x00306, 0x00419 },
+    { 0x00418, 0x00308, 0x004E4 },
+    { 0x0041A, 0x00301, 0x0040C },
+    { 0x0041E, 0x00308, 0x004E6 },
+    { 0x00423, 0x00304, 0x004EE },
+    { 0x00423, 0x00306, 0x0040E },
+    { 0x00423, 0x00308, 0x004F0 },
+    { 0x00423, 0x0030B, 0x004F2 },
+    { 0x00427, 0x00308, 0x004F4 },
+    { 0x0042B, 0x00308, 0x004F8 },
+    { 0x0042D, 0x00308, 0x004EC },
+    { 0x00430, 0x00306, 0x004D1 },
+    { 0x00430, 0x00308, 0x004D3 },
+    { 0x00433, 0x00301, 0x00453 },
+    { 0x00435, 0x00300, 0x00450 },
+    { 0x00435, 0x00306, 0x004D7 },
+    { 0x00435, 0x00308, 0x00451 },
+    { 0x00436, 0x00306, 0x004C2 },
+    { 0x00436, 0x00308, 0x004DD },
+    { 0x00437, 0x00308, 0x004DF },
+    { 0x00438, 0x00300, 0x0045D },
+    { 0x00438, 0x00304, 0x004E3 },
+    { 0x00438, 0x00306, 0x00439 },
+    { 0x00438, 0x00308, 0x004E5 },
+    { 0x0043A, 0x00301, 0x0045C },
+    { 0x0043E, 0x00308, 0x004E7 },
+    { 0x00443, 0x00304, 0x004EF },
+    { 0x00443, 0x00306, 0x0045E },
+    { 0x00443, 0x00308, 0x004F1 },
+    { 0x00443, 0x0030B, 0x004F3 },
+    { 0x00447, 0x00308, 0x004F5 },
+    { 0x0044B, 0x00308, 0x004F9 },
+    { 0x0044D, 0x00308, 0x004ED },
+    { 0x00456, 0x00308, 0x00457 },
+    { 0x00474, 0x0030F, 0x00476 },
+    { 0x00475, 0x0030F, 0x00477 },
+    { 0x004D8, 0x00308, 0x004DA },
+    { 0x004D9, 0x00308, 0x004DB },
+    { 0x004E8, 0x00308, 0x004EA },
+    { 0x004E9, 0x00308, 0x004EB },
+    { 0x00627, 0x00653, 0x00622 },
+    { 0x00627, 0x00654, 0x00623 },
+    { 0x00627, 0x00655, 0x00625 },
+    { 0x00648, 0x00654, 0x00624 },
+    { 0x0064A, 0x00654, 0x00626 },
+    { 0x006C1, 0x00654, 0x006C2 },
+    { 0x006D2, 0x00654, 0x006D3 },
+    { 0x006D5, 0x00654, 0x006C0 },
+    { 0x00928, 0x0093C, 0x00929 },
+    { 0x00930, 0x0093C, 0x00931 },
+    { 0x00933, 0x0093C, 0x00934 },
+    { 0x009C7, 0x009BE, 0x009CB },
+    { 0x009C7, 0x009D7, 0x009CC },
+    { 0x00B47, 0x00B3E, 0x00B4B },
+    { 0x00B47, 0x00B56, 0x00B48 },
+    { 0x00B47, 0x00B57, 0x00B4C },
+    { 0x00B92, 0x00BD7, 0x00B94 },
+    { 0x00BC6, 0x00BBE, 0x00BCA },
+    { 0x00BC6, 0x00BD7, 0x00BCC },
+    { 0x00BC7, 0x00BBE, 0x00BCB },
+    { 0x00C46, 0x00C56, 0x00C48 },
+    { 0x00CBF, 0x00CD5, 0x00CC0 },
+    { 0x00CC6, 0x00CC2, 0x00CCA },
+    { 0x00CC6, 0x00CD5, 0x00CC7 },
+    { 0x00CC6, 0x00CD6, 0x00CC8 },
+    { 0x00CCA, 0x00CD5, 0x00CCB },
+    { 0x00D46, 0x00D3E, 0x00D4A },
+    { 0x00D46, 0x00D57, 0x00D4C },
+    { 0x00D47, 0x00D3E, 0x00D4B },
+    { 0x00DD9, 0x00DCA, 0x00DDA },
+    { 0x00DD9, 0x00DCF, 0x00DDC },
+    { 0x00DD9, 0x00DDF, 0x00DDE },
+    { 0x00DDC, 0x00DCA, 0x00DDD },
+    { 0x01025, 0x0102E, 0x01026 },
+    { 0x01B05, 0x01B35, 0x01B06 },
+    { 0x01B07, 0x01B35, 0x01B08 },
+    { 0x01B09, 0x01B35, 0x01B0A },
+    { 0x01B0B, 0x01B35, 0x01B0C },
+    { 0x01B0D, 0x01B35, 0x01B0E },
+    { 0x01B11, 0x01B35, 0x01B12 },
+    { 0x01B3A, 0x01B35, 0x01B3B },
+    { 0x01B3C, 0x01B35, 0x01B3D },
+    { 0x01B3E, 0x01B35, 0x01B40 },
+    { 0x01B3F, 0x01B35, 0x01B41 },
+    { 0x01B42, 0x01B35, 0x01B43 },
+    { 0x01E36, 0x00304, 0x01E38 },
+    { 0x01E37, 0x00304, 0x01E39 },
+    { 0x01E5A, 0x00304, 0x01E5C },
+    { 0x01E5B, 0x00304, 0x01E5D },
+    { 0x01E62, 0x00307, 0x01E68 },
+    { 0x01E63, 0x00307, 0x01E69 },
+    { 0x01EA0, 0x00302, 0x01EAC },
+    { 0x01EA0, 0x00306, 0x01EB6 },
+    { 0x01EA1, 0x00302, 0x01EAD },
+    { 0x01EA1, 0x00306, 0x01EB7 },
+    { 0x01EB8, 0x00302, 0x01EC6 },
+    { 0x01EB9, 0x00302, 0x01EC7 },
+    { 0x01ECC, 0x00302, 0x01ED8 },
+    { 0x01ECD, 0x00302, 0x01ED9 },
+    { 0x01F00, 0x00300, 0x01F02 },
+    { 0x01F00, 0x00301, 0x01F04 },
+    { 0x01F00, 0x00342, 0x01F06 },
+    { 0x01F00, 0x00345, 0x01F80 },
+    { 0x01F01, 0x00300, 0x01F03 },
+    { 0x01F01, 0x00301, 0x01F05 },
+    { 0x01F01, 0x00342, 0x01F07 },
+    { 0x01F01, 0x00345, 0x01F81 },
+    { 0x01F02, 0x00345, 0x01F82 },
+    { 0x01F03, 0x00345, 0x01F83 },
+    { 0x01F04, 0x00345, 0x01F84 },
+    { 0x01F05, 0x00345, 0x01F85 },
+    { 0x01F06, 0x00345, 0x01F86 },
+    { 0x01F07, 0x00345, 0x01F87 },
+    { 0x01F08, 0x00300, 0x01F0A },
+    { 0x01F08, 0x00301, 0x01F0C },
+    { 0x01F08, 0x00342, 0x01F0E },
+    { 0x01F08, 0x00345, 0x01F88 },
+    { 0x01F09, 0x00300, 0x01F0B },
+    { 0x01F09, 0x00301, 0x01F0D },
+    { 0x01F09, 0x00342, 0x01F0F },
+    { 0x01F09, 0x00345, 0x01F89 },
+    { 0x01F0A, 0x00345, 0x01F8A },
+    { 0x01F0B, 0x00345, 0x01F8B },
+    { 0x01F0C, 0x00345, 0x01F8C },
+    { 0x01F0D, 0x00345, 0x01F8D },
+    { 0x01F0E, 0x00345, 0x01F8E },
+    { 0x01F0F, 0x00345, 0x01F8F },
+    { 0x01F10, 0x00300, 0x01F12 },
+    { 0x01F10, 0x00301, 0x01F14 },
+    { 0x01F11, 0x00300, 0x01F13 },
+    { 0x01F11, 0x00301, 0x01F15 },
+    { 0x01F18, 0x00300, 0x01F1A },
+    { 0x01F18, 0x00301, 0x01F1C },
+    { 0x01F19, 0x00300, 0x01F1B },
+    { 0x01F19, 0x00301, 0x01F1D },
+    { 0x01F20, 0x00300, 0x01F22 },
+    { 0x01F20, 0x00301, 0x01F24 },
+    { 0x01F20, 0x00342, 0x01F26 },
+    { 0x01F20, 0x00345, 0x01F90 },
+    { 0x01F21, 0x00300, 0x01F23 },
+    { 0x01F21, 0x00301, 0x01F25 },
+    { 0x01F21, 0x00342, 0x01F27 },
+    { 0x01F21, 0x00345, 0x01F91 },
+    { 0x01F22, 0x00345, 0x01F92 },
+    { 0x01F23, 0x00345, 0x01F93 },
+    { 0x01F24, 0x00345, 0x01F94 },
+    { 0x01F25, 0x00345, 0x01F95 },
+    { 0x01F26, 0x00345, 0x01F96 },
+    { 0x01F27, 0x00345, 0x01F97 },
+    { 0x01F28, 0x00300, 0x01F2A },
+    { 0x01F28, 0x00301, 0x01F2C },
+    { 0x01F28, 0x00342, 0x01F2E },
+    { 0x01F28, 0x00345, 0x01F98 },
+    { 0x01F29, 0x00300, 0x01F2B },
+    { 0x01F29, 0x00301, 0x01F2D },
+    { 0x01F29, 0x00342, 0x01F2F },
+    { 0x01F29, 0x00345, 0x01F99 },
+    { 0x01F2A, 0x00345, 0x01F9A },
+    { 0x01F2B, 0x00345, 0x01F9B },
+    { 0x01F2C, 0x00345, 0x01F9C },
+    { 0x01F2D, 0x00345, 0x01F9D },
+    { 0x01F2E, 0x00345, 0x01F9E },
+    { 0x01F2F, 0x00345, 0x01F9F },
+    { 0x01F30, 0x00300, 0x01F32 },
+    { 0x01F30, 0x00301, 0x01F34 },
+    { 0x01F30, 0x00342, 0x01F36 },
+    { 0x01F31, 0x00300, 0x01F33 },
+    { 0x01F31, 0x00301, 0x01F35 },
+    { 0x01F31, 0x00342, 0x01F37 },
+    { 0x01F38, 0x00300, 0x01F3A },
+    { 0x01F38, 0x00301, 0x01F3C },
+    { 0x01F38, 0x00342, 0x01F3E },
+    { 0x01F39, 0x00300, 0x01F3B },
+    { 0x01F39, 0x00301, 0x01F3D },
+    { 0x01F39, 0x00342, 0x01F3F },
+    { 0x01F40, 0x00300, 0x01F42 },
+    { 0x01F40, 0x00301, 0x01F44 },
+    { 0x01F41, 0x00300, 0x01F43 },
+    { 0x01F41, 0x00301, 0x01F45 },
+    { 0x01F48, 0x00300, 0x01F4A },
+    { 0x01F48, 0x00301, 0x01F4C },
+    { 0x01F49, 0x00300, 0x01F4B },
+    { 0x01F49, 0x00301, 0x01F4D },
+    { 0x01F50, 0x00300, 0x01F52 },
+    { 0x01F50, 0x00301, 0x01F54 },
+    { 0x01F50, 0x00342, 0x01F56 },
+    { 0x01F51, 0x00300, 0x01F53 },
+    { 0x01F51, 0x00301, 0x01F55 },
+    { 0x01F51, 0x00342, 0x01F57 },
+    { 0x01F59, 0x00300, 0x01F5B },
+    { 0x01F59, 0x00301, 0x01F5D },
+    { 0x01F59, 0x00342, 0x01F5F },
+    { 0x01F60, 0x00300, 0x01F62 },
+    { 0x01F60, 0x00301, 0x01F64 },
+    { 0x01F60, 0x00342, 0x01F66 },
+    { 0x01F60, 0x00345, 0x01FA0 },
+    { 0x01F61, 0x00300, 0x01F63 },
+    { 0x01F61, 0x00301, 0x01F65 },
+    { 0x01F61, 0x00342, 0x01F67 },
+    { 0x01F61, 0x00345, 0x01FA1 },
+    { 0x01F62, 0x00345, 0x01FA2 },
+    { 0x01F63, 0x00345, 0x01FA3 },
+    { 0x01F64, 0x00345, 0x01FA4 },
+    { 0x01F65, 0x00345, 0x01FA5 },
+    { 0x01F66, 0x00345, 0x01FA6 },
+    { 0x01F67, 0x00345, 0x01FA7 },
+    { 0x01F68, 0x00300, 0x01F6A },
+    { 0x01F68, 0x00301, 0x01F6C },
+    { 0x01F68, 0x00342, 0x01F6E },
+    { 0x01F68, 0x00345, 0x01FA8 },
+    { 0x01F69, 0x00300, 0x01F6B },
+    { 0x01F69, 0x00301, 0x01F6D },
+    { 0x01F69, 0x00342, 0x01F6F },
+    { 0x01F69, 0x00345, 0x01FA9 },
+    { 0x01F6A, 0x00345, 0x01FAA },
+    { 0x01F6B, 0x00345, 0x01FAB },
+    { 0x01F6C, 0x00345, 0x01FAC },
+    { 0x01F6D, 0x00345, 0x01FAD },
+    { 0x01F6E, 0x00345, 0x01FAE },
+    { 0x01F6F, 0x00345, 0x01FAF },
+    { 0x01F70, 0x00345, 0x01FB2 },
+    { 0x01F74, 0x00345, 0x01FC2 },
+    { 0x01F7C, 0x00345, 0x01FF2 },
+    { 0x01FB6, 0x00345, 0x01FB7 },
+    { 0x01FBF, 0x00300, 0x01FCD },
+    { 0x01FBF, 0x00301, 0x01FCE },
+    { 0x01FBF, 0x00342, 0x01FCF },
+    { 0x01FC6, 0x00345, 0x01FC7 },
+    { 0x01FF6, 0x00345, 0x01FF7 },
+    { 0x01FFE, 0x00300, 0x01FDD },
+    { 0x01FFE, 0x00301, 0x01FDE },
+    { 0x01FFE, 0x00342, 0x01FDF },
+    { 0x02190, 0x00338, 0x0219A },
+    { 0x02192, 0x00338, 0x0219B },
+    { 0x02194, 0x00338, 0x021AE },
+    { 0x021D0, 0x00338, 0x021CD },
+    { 0x021D2, 0x00338, 0x021CF },
+    { 0x021D4, 0x00338, 0x021CE },
+    { 0x02203, 0x00338, 0x02204 },
+    { 0x02208, 0x00338, 0x02209 },
+    { 0x0220B, 0x00338, 0x0220C },
+    { 0x02223, 0x00338, 0x02224 },
+    { 0x02225, 0x00338, 0x02226 },
+    { 0x0223C, 0x00338, 0x02241 },
+    { 0x02243, 0x00338, 0x02244 },
+    { 0x02245, 0x00338, 0x02247 },
+    { 0x02248, 0x00338, 0x02249 },
+    { 0x0224D, 0x00338, 0x0226D },
+    { 0x02261, 0x00338, 0x02262 },
+    { 0x02264, 0x00338, 0x02270 },
+    { 0x02265, 0x00338, 0x02271 },
+    { 0x02272, 0x00338, 0x02274 },
+    { 0x02273, 0x00338, 0x02275 },
+    { 0x02276, 0x00338, 0x02278 },
+    { 0x02277, 0x00338, 0x02279 },
+    { 0x0227A, 0x00338, 0x02280 },
+    { 0x0227B, 0x00338, 0x02281 },
+    { 0x0227C, 0x00338, 0x022E0 },
+    { 0x0227D, 0x00338, 0x022E1 },
+    { 0x02282, 0x00338, 0x02284 },
+    { 0x02283, 0x00338, 0x02285 },
+    { 0x02286, 0x00338, 0x02288 },
+    { 0x02287, 0x00338, 0x02289 },
+    { 0x02291, 0x00338, 0x022E2 },
+    { 0x02292, 0x00338, 0x022E3 },
+    { 0x022A2, 0x00338, 0x022AC },
+    { 0x022A8, 0x00338, 0x022AD },
+    { 0x022A9, 0x00338, 0x022AE },
+    { 0x022AB, 0x00338, 0x022AF },
+    { 0x022B2, 0x00338, 0x022EA },
+    { 0x022B3, 0x00338, 0x022EB },
+    { 0x022B4, 0x00338, 0x022EC },
+    { 0x022B5, 0x00338, 0x022ED },
+    { 0x03046, 0x03099, 0x03094 },
+    { 0x0304B, 0x03099, 0x0304C },
+    { 0x0304D, 0x03099, 0x0304E },
+    { 0x0304F, 0x03099, 0x03050 },
+    { 0x03051, 0x03099, 0x03052 },
+    { 0x03053, 0x03099, 0x03054 },
+    { 0x03055, 0x03099, 0x03056 },
+    { 0x03057, 0x03099, 0x03058 },
+    { 0x03059, 0x03099, 0x0305A },
+    { 0x0305B, 0x03099, 0x0305C },
+    { 0x0305D, 0x03099, 0x0305E },
+    { 0x0305F, 0x03099, 0x03060 },
+    { 0x03061, 0x03099, 0x03062 },
+    { 0x03064, 0x03099, 0x03065 },
+    { 0x03066, 0x03099, 0x03067 },
+    { 0x03068, 0x03099, 0x03069 },
+    { 0x0306F, 0x03099, 0x03070 },
+    { 0x0306F, 0x0309A, 0x03071 },
+    { 0x03072, 0x03099, 0x03073 },
+    { 0x03072, 0x0309A, 0x03074 },
+    { 0x03075, 0x03099, 0x03076 },
+    { 0x03075, 0x0309A, 0x03077 },
+    { 0x03078, 0x03099, 0x03079 },
+    { 0x03078, 0x0309A, 0x0307A },
+    { 0x0307B, 0x03099, 0x0307C },
+    { 0x0307B, 0x0309A, 0x0307D },
+    { 0x0309D, 0x03099, 0x0309E },
+    { 0x030A6, 0x03099, 0x030F4 },
+    { 0x030AB, 0x03099, 0x030AC },
+    { 0x030AD, 0x03099, 0x030AE },
+    { 0x030AF, 0x03099, 0x030B0 },
+    { 0x030B1, 0x03099, 0x030B2 },
+    { 0x030B3, 0x03099, 0x030B4 },
+    { 0x030B5, 0x03099, 0x030B6 },
+    { 0x030B7, 0x03099, 0x030B8 },
+    { 0x030B9, 0x03099, 0x030BA },
+    { 0x030BB, 0x03099, 0x030BC },
+    { 0x030BD, 0x03099, 0x030BE },
+    { 0x030BF, 0x03099, 0x030C0 },
+    { 0x030C1, 0x03099, 0x030C2 },
+    { 0x030C4, 0x03099, 0x030C5 },
+    { 0x030C6, 0x03099, 0x030C7 },
+    { 0x030C8, 0x03099, 0x030C9 },
+    { 0x030CF, 0x03099, 0x030D0 },
+    { 0x030CF, 0x0309A, 0x030D1 },
+    { 0x030D2, 0x03099, 0x030D3 },
+    { 0x030D2, 0x0309A, 0x030D4 },
+    { 0x030D5, 0x03099, 0x030D6 },
+    { 0x030D5, 0x0309A, 0x030D7 },
+    { 0x030D8, 0x03099, 0x030D9 },
+    { 0x030D8, 0x0309A, 0x030DA },
+    { 0x030DB, 0x03099, 0x030DC },
+    { 0x030DB, 0x0309A, 0x030DD },
+    { 0x030EF, 0x03099, 0x030F7 },
+    { 0x030F0, 0x03099, 0x030F8 },
+    { 0x030F1, 0x03099, 0x030F9 },
+    { 0x030F2, 0x03099, 0x030FA },
+    { 0x030FD, 0x03099, 0x030FE },
+    { 0x11099, 0x110BA, 0x1109A },
+    { 0x1109B, 0x110BA, 0x1109C },
+    { 0x110A5, 0x110BA, 0x110AB },
+    { 0x11131, 0x11127, 0x1112E },
+    { 0x11132, 0x11127, 0x1112F },
+    { 0x11347, 0x1133E, 0x1134B },
+    { 0x11347, 0x11357, 0x1134C },
+    { 0x114B9, 0x114B0, 0x114BC },
+    { 0x114B9, 0x114BA, 0x114BB },
+    { 0x114B9, 0x114BD, 0x114BE },
+    { 0x115B8, 0x115AF, 0x115BA },
+    { 0x115B9, 0x115AF, 0x115BB },
+    { 0x11935, 0x11930, 0x11938 }
+};
+
+}
+
+#endif
@@ -0,0 +1,534 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/Normalizer.h>
+#include <Unicoder/CodePointIterator.h>
+#include <Unicoder/CharacterProperties.h>
+
+#include "NormalizationData.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+//
+// Hangul syllable constants, see "Conjoining Jamo Behavior" in chapter 3
+// of the Unicode Standard.
+//
+const UTF32 SBase = 0xAC00;
+const UTF32 LBase = 0x1100;
+const UTF32 VBase = 0x1161;
+const UTF32 TBase = 0x11A7;
+const UTF32 LCount = 19;
+const UTF32 VCount = 21;
+const UTF32 TCount = 28;
+const UTF32 NCount = VCount * TCount;
+const UTF32 SCount = LCount * NCount;
+
+struct FormInfo
+{
+    uint16 no;
+    uint16 maybe;
+    bool compat;
+    bool compose;
+};
+
+const FormInfo&
+GetFormInfo(NormalizationForm form)
+{
+    static const FormInfo forms[] =
+    {
+        { normalizationNFCNo, normalizationNFCMaybe, false, true },     // NFC
+        { normalizationNFDNo, 0, false, false },                        // NFD
+        { normalizationNFKCNo, normalizationNFKCMaybe, true, true },    // NFKC
+        { normalizationNFKDNo, 0, true, false }                         // NFKD
+    };
+    return forms[form];
+}
+
+inline uint16
+GetProperties(UTF32 cp)
+{
+    return static_cast<uint16>((GetCharacterRecord(cp) >> characterNormalizationShift) & characterNormalizationMask);
+}
+
+inline int
+CombiningClass(UTF32 cp)
+{
+    return GetProperties(cp) & 0xFF;
+}
+
+//
+// Growable array that lives on the stack until it holds more than N
+// elements.
+//
+template<typename T, size_t N>
+class StackBuffer : public noncopyable
+{
+public:
+
+    StackBuffer() :
+        m_data(m_local),
+        m_size(0),
+        m_capacity(N)
+    {
+    }
+
+    ~StackBuffer()
+    {
+        if (m_data != m_local)
+        {
+            delete[] m_data;
+        }
+    }
+
+    void PushBack(const T& value)
+    {
+        if (m_size == m_capacity)
+        {
+            T* data = new T[m_capacity * 2];
+            std::copy(m_data, m_data + m_size, data);
+            if (m_data != m_local)
+            {
+                delete[] m_data;
+            }
+            m_data = data;
+            m_capacity *= 2;
+        }
+        m_data[m_size++] = value;
+    }
+
+    void Resize(size_t size)
+    {
+        assert(size <= m_size);
+        m_size = size;
+    }
+
+    size_t Size() const
+    {
+        return m_size;
+    }
+
+    T& operator[](size_t index)
+    {
+        return m_data[index];
+    }
+
+    T* Begin()
+    {
+        return m_data;
+    }
+
+    T* End()
+    {
+        return m_data + m_size;
+    }
+
+private:
+
+    T m_local[N];
+    T* m_data;
+    size_t m_size;
+    size_t m_capacity;
+};
+
+typedef StackBuffer<UTF32, 256> CodePointBuffer;
+
+//
+// Appends cp and moves it before the preceding characters with a higher
+// combining class (canonical ordering).
+//
+void
+AppendOrdered(UTF32 cp, CodePointBuffer& buffer)
+{
+    buffer.PushBack(cp);
+    int cc = CombiningClass(cp);
+    if (cc == 0)
+    {
+        return;
+    }
+
+    for (size_t i = buffer.Size() - 1; i > 0 && CombiningClass(buffer[i - 1]) > cc; --i)
+    {
+        std::swap(buffer[i], buffer[i - 1]);
+    }
+}
+
+bool
+CompareDecomposition(const DecompositionEntry& entry, UTF32 cp)
+{
+    return entry.codePoint < cp;
+}
+
+void
+Decompose(UTF32 cp, bool compat, CodePointBuffer& buffer)
+{
+    if (cp - SBase < SCount)
+    {
+        UTF32 index = cp - SBase;
+        buffer.PushBack(LBase + index / NCount);
+        buffer.PushBack(VBase + (index % NCount) / TCount);
+        if (index % TCount != 0)
+        {
+            buffer.PushBack(TBase + index % TCount);
+        }
+        return;
+    }
+
+    if ((GetProperties(cp) & (compat ? normalizationNFKDNo : normalizationNFDNo)) == 0)
+    {
+        AppendOrdered(cp, buffer);
+        return;
+    }
+
+    const DecompositionEntry* last = decompositions + sizeof(decompositions) / sizeof(decompositions[0]);
+    const DecompositionEntry* entry = lower_bound(decompositions, last, cp, CompareDecomposition);
+    assert(entry != last && entry->codePoint == cp);
+
+    uint32 mapping = compat ? entry->compat : entry->canonical;
+    const UTF32* p = decompositionData + (mapping >> 5);
+    for (const UTF32* end = p + (mapping & 0x1F); p != end; ++p)
+    {
+        AppendOrdered(*p, buffer);
+    }
+}
+
+bool
+CompareComposition(const CompositionEntry& entry, const CompositionEntry& key)
+{
+    return entry.first < key.first || (entry.first == key.first && entry.second < key.second);
+}
+
+//
+// Returns the primary composite of first and second, or 0 if there is none.
+//
+UTF32
+ComposePair(UTF32 first, UTF32 second)
+{
+    if (first - LBase < LCount && second - VBase < VCount)
+    {
+        return SBase + ((first - LBase) * VCount + (second - VBase)) * TCount;
+    }
+    if (first - SBase < SCount && (first - SBase) % TCount == 0 && second - TBase - 1 < TCount - 1)
+    {
+        return first + (second - TBase);
+    }
+
+    CompositionEntry key = { first, second, 0 };
+    const CompositionEntry* last = compositions + sizeof(compositions) / sizeof(compositions[0]);
+    const CompositionEntry* entry = lower_bound(compositions, last, key, CompareComposition);
+    if (entry != last && entry->first == first && entry->second == second)
+    {
+        return entry->composite;
+    }
+    return 0;
+}
+
+//
+// Canonical composition of a decomposed, canonically ordered buffer.
+//
+void
+Compose(CodePointBuffer& buffer)
+{
+    if (buffer.Size() == 0)
+    {
+        return;
+    }
+
+    size_t starterPosition = 0;
+    UTF32 starter = buffer[0];
+    int lastClass = CombiningClass(starter);
+    if (lastClass != 0)
+    {
+        lastClass = 256; // Nothing composes with a leading non-starter.
+    }
+
+    size_t composedSize = 1;
+    for (size_t i = 1; i < buffer.Size(); ++i)
+    {
+        UTF32 cp = buffer[i];
+        int cc = CombiningClass(cp);
+        UTF32 composite = ComposePair(starter, cp);
+        if (composite != 0 && (lastClass < cc || lastClass == 0))
+        {
+            buffer[starterPosition] = composite;
+            starter = composite;
+            continue;
+        }
+        if (cc == 0)
+        {
+            starterPosition = composedSize;
+            starter = cp;
+        }
+        lastClass = cc;
+        buffer[composedSize++] = cp;
+    }
+    buffer.Resize(composedSize);
+}
+
+enum QuickCheckResult
+{
+    quickCheckYes,
+    quickCheckNo,
+    quickCheckMaybe
+};
+
+//
+// Skips a run of ASCII, which is always normalized. Returns the start of the
+// last ASCII character skipped, or 0 if p is not ASCII.
+//
+inline const Byte*
+SkipASCII(const Byte*& p, const Byte* last)
+{
+    if (*p >= 0x80)
+    {
+        return 0;
+    }
+    p = FindNonASCII(p, last);
+    return p - 1;
+}
+
+template<typename unitT>
+inline const unitT*
+SkipASCII(const unitT*& p, const unitT* last)
+{
+    if (static_cast<UTF32>(*p) >= 0x80)
+    {
+        return 0;
+    }
+    while (++p != last && static_cast<UTF32>(*p) < 0x80)
+    {
+    }
+    return p - 1;
+}
+
+inline void
+ThrowConversionError(ConversionResult result)
+{
+    throw UTFConversionException(__FILE__, __LINE__, result == sourceExhausted ? partialCharacter : badEncoding);
+}
+
+//
+// Throws UTFConversionException if [first, last) is ill-formed.
+//
+template<typename Encoding>
+void
+CheckWellFormed(const typename Encoding::CodeUnit* first, const typename Encoding::CodeUnit* last)
+{
+    const typename Encoding::CodeUnit* p = first;
+    while (p < last)
+    {
+        UTF32 cp;
+        ConversionResult result = Encoding::Decode(p, last, cp, strictConversion);
+        if (result != conversionOK)
+        {
+            ThrowConversionError(result);
+        }
+    }
+}
+
+//
+// The UAX #15 quick check. safe is set to the last position before the
+// first No / Maybe character from which normalizing the rest of the string
+// gives the same result as normalizing all of it: a starter that does not
+// interact with anything before it.
+//
+// Input is decoded as Normalize() decodes it: ill-formed input raises
+// UTFConversionException with strictConversion, and with lenientConversion
+// ill-formed UTF-8 is No (it is replaced by U+FFFD) while lone surrogates
+// in wide strings are kept.
+//
+template<typename Encoding>
+QuickCheckResult
+QuickCheck(const typename Encoding::CodeUnit* first, const typename Encoding::CodeUnit* last,
+           const FormInfo& form, ConversionFlags flags, const typename Encoding::CodeUnit*& safe)
+{
+    typedef typename Encoding::CodeUnit CodeUnit;
+
+    QuickCheckResult result = quickCheckYes;
+    int lastClass = 0;
+    safe = first;
+
+    const CodeUnit* p = first;
+    while (p < last)
+    {
+        const CodeUnit* ascii = SkipASCII(p, last);
+        if (ascii != 0)
+        {
+            if (result == quickCheckYes)
+            {
+                safe = ascii;
+            }
+            lastClass = 0;
+            continue;
+        }
+
+        const CodeUnit* start = p;
+        UTF32 cp;
+        ConversionResult decoded = Encoding::Decode(p, last, cp, flags);
+        if (decoded != conversionOK)
+        {
+            if (flags == strictConversion)
+            {
+                ThrowConversionError(decoded);
+            }
+            return quickCheckNo;
+        }
+
+        uint16 properties = GetProperties(cp);
+        int cc = properties & 0xFF;
+        if ((lastClass > cc && cc != 0) || (properties & form.no))
+        {
+            return quickCheckNo;
+        }
+        if (properties & form.maybe)
+        {
+            result = quickCheckMaybe;
+        }
+        else if (cc == 0 && result == quickCheckYes)
+        {
+            safe = start;
+        }
+        lastClass = cc;
+    }
+    return result;
+}
+
+//
+// Normalizes [first, last) and appends the result to target.
+//
+template<typename Encoding, typename charT>
+void
+NormalizeRange(const typename Encoding::CodeUnit* first, const typename Encoding::CodeUnit* last,
+               const FormInfo& form, ConversionFlags flags, basic_string<charT>& target)
+{
+    CodePointBuffer buffer;
+    CodePointRange<Encoding> range(first, last, flags);
+    for (typename CodePointRange<Encoding>::iterator p = range.begin(); p != range.end(); ++p)
+    {
+        Decompose(*p, form.compat, buffer);
+    }
+    if (form.compose)
+    {
+        Compose(buffer);
+    }
+
+    target.reserve(target.size() + static_cast<size_t>(last - first));
+    std::copy(buffer.Begin(), buffer.End(), EncodeTo<Encoding>(std::back_inserter(target)));
+}
+
+template<typename Encoding, typename charT>
+bool
+IsNormalizedT(const basic_string<charT>& str, NormalizationForm normalizationForm, ConversionFlags flags)
+{
+    typedef typename Encoding::CodeUnit CodeUnit;
+
+    const FormInfo& form = GetFormInfo(normalizationForm);
+    const CodeUnit* first = reinterpret_cast<const CodeUnit*>(str.data());
+    const CodeUnit* last = first + str.size();
+    const CodeUnit* safe;
+
+    switch (QuickCheck<Encoding>(first, last, form, flags, safe))
+    {
+        case quickCheckYes:
+            return true;
+        case quickCheckNo:
+        {
+            //
+            // The quick check stops at the first No character; the rest
+            // must still be well-formed in strict mode.
+            //
+            if (flags == strictConversion)
+            {
+                CheckWellFormed<Encoding>(safe, last);
+            }
+            return false;
+        }
+        default:
+        {
+            basic_string<charT> tail;
+            NormalizeRange<Encoding>(safe, last, form, flags, tail);
+            return tail.size() == static_cast<size_t>(last - safe) &&
+                   std::equal(tail.begin(), tail.end(), reinterpret_cast<const charT*>(safe));
+        }
+    }
+}
+
+template<typename Encoding, typename charT>
+void
+NormalizeInPlaceT(basic_string<charT>& str, NormalizationForm normalizationForm, ConversionFlags flags)
+{
+    typedef typename Encoding::CodeUnit CodeUnit;
+
+    const FormInfo& form = GetFormInfo(normalizationForm);
+    const CodeUnit* first = reinterpret_cast<const CodeUnit*>(str.data());
+    const CodeUnit* last = first + str.size();
+    const CodeUnit* safe;
+
+    QuickCheckResult result = QuickCheck<Encoding>(first, last, form, flags, safe);
+    if (result == quickCheckYes)
+    {
+        return;
+    }
+
+    basic_string<charT> tail;
+    NormalizeRange<Encoding>(safe, last, form, flags, tail);
+    size_t offset = static_cast<size_t>(safe - first);
+    if (result == quickCheckMaybe && str.compare(offset, string::npos, tail) == 0)
+    {
+        return;
+    }
+    str.replace(offset, string::npos, tail);
+}
+
+}
+
+bool
+Util::IsNormalized(const string& utf8, NormalizationForm form, ConversionFlags flags)
+{
+    return IsNormalizedT<UTF8Encoding>(utf8, form, flags);
+}
+
+bool
+Util::IsNormalized(const wstring& wstr, NormalizationForm form, ConversionFlags flags)
+{
+    return IsNormalizedT<WstringEncoding>(wstr, form, flags);
+}
+
+string
+Util::Normalize(const string& utf8, NormalizationForm form, ConversionFlags flags)
+{
+    string result(utf8);
+    NormalizeInPlaceT<UTF8Encoding>(result, form, flags);
+    return result;
+}
+
+wstring
+Util::Normalize(const wstring& wstr, NormalizationForm form, ConversionFlags flags)
+{
+    wstring result(wstr);
+    NormalizeInPlaceT<WstringEncoding>(result, form, flags);
+    return result;
+}
+
+void
+Util::NormalizeInPlace(string& utf8, NormalizationForm form, ConversionFlags flags)
+{
+    NormalizeInPlaceT<UTF8Encoding>(utf8, form, flags);
+}
+
+void
+Util::NormalizeInPlace(wstring& wstr, NormalizationForm form, ConversionFlags flags)
+{
+    NormalizeInPlaceT<WstringEncoding>(wstr, form, flags);
+}
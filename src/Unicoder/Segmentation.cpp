@@ -0,0 +1,432 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/Segmentation.h>
+#include <Unicoder/CodePointIterator.h>
+#include <Unicoder/CharacterProperties.h>
+
+#include "SegmentationData.h"
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+inline uint16
+GetProperties(UTF32 cp)
+{
+    return static_cast<uint16>((GetCharacterRecord(cp) >> characterSegmentationShift) & characterSegmentationMask);
+}
+
+inline int
+GraphemeBreakOf(uint16 properties)
+{
+    return properties & segmentationGraphemeMask;
+}
+
+inline int
+WordBreakOf(uint16 properties)
+{
+    return (properties & segmentationWordMask) >> segmentationWordShift;
+}
+
+//
+// GB6 - GB8: Hangul syllable sequences.
+//
+inline bool
+JoinsHangul(int previous, int current)
+{
+    switch (previous)
+    {
+        case graphemeL:
+            return current == graphemeL || current == graphemeV || current == graphemeLV || current == graphemeLVT;
+        case graphemeLV:
+        case graphemeV:
+            return current == graphemeV || current == graphemeT;
+        case graphemeLVT:
+        case graphemeT:
+            return current == graphemeT;
+        default:
+            return false;
+    }
+}
+
+//
+// State of GB11 (ExtPict Extend* ZWJ x ExtPict).
+//
+enum PictographicState
+{
+    noPictographic,
+    afterPictographic,
+    afterPictographicZWJ
+};
+
+//
+// GB3 - GB13 for a candidate boundary between previous and current.
+//
+bool
+JoinsGrapheme(int previous, int current, uint16 properties, PictographicState pictographic,
+              int regionalIndicators)
+{
+    if (previous == graphemeCR || previous == graphemeLF || previous == graphemeControl ||
+        current == graphemeCR || current == graphemeLF || current == graphemeControl)
+    {
+        return previous == graphemeCR && current == graphemeLF;              // GB3 - GB5
+    }
+    return JoinsHangul(previous, current) ||                                // GB6 - GB8
+           current == graphemeExtend || current == graphemeZWJ ||           // GB9
+           current == graphemeSpacingMark ||                                // GB9a
+           previous == graphemePrepend ||                                   // GB9b
+           (pictographic == afterPictographicZWJ &&
+            (properties & segmentationPictographic)) ||                     // GB11
+           (current == graphemeRegionalIndicator && regionalIndicators % 2 == 1); // GB12, GB13
+}
+
+//
+// True if position is a grapheme cluster boundary for certain, judging by
+// the code points on either side only: it is unless GB11 or GB12 / GB13
+// apply, which depend on everything before.
+//
+bool
+IsKnownGraphemeBoundary(const Byte* begin, const Byte* position, const Byte* end)
+{
+    UTF32 cp;
+    const Byte* next = position;
+    if (UTF8Encoding::Decode(next, end, cp, strictConversion) != conversionOK)
+    {
+        return true;
+    }
+    uint16 properties = GetProperties(cp);
+    int current = GraphemeBreakOf(properties);
+
+    const Byte* previousStart = TranscoderInternal::CodePointRetreater<8>::Retreat<UTF8Encoding>(begin, position);
+    if (UTF8Encoding::Decode(previousStart, position, cp, strictConversion) != conversionOK)
+    {
+        return true;
+    }
+    int previous = GraphemeBreakOf(GetProperties(cp));
+
+    if ((previous == graphemeRegionalIndicator && current == graphemeRegionalIndicator) ||
+        (previous == graphemeZWJ && (properties & segmentationPictographic)))
+    {
+        return false;
+    }
+    return !JoinsGrapheme(previous, current, properties, noPictographic, 0);
+}
+
+inline bool
+IsAHLetter(int wordBreak)
+{
+    return wordBreak == wordALetter || wordBreak == wordHebrewLetter;
+}
+
+inline bool
+IsMidNumLetQ(int wordBreak)
+{
+    return wordBreak == wordMidNumLet || wordBreak == wordSingleQuote;
+}
+
+inline bool
+IsWordIgnorable(int wordBreak)
+{
+    return wordBreak == wordExtend || wordBreak == wordFormat || wordBreak == wordZWJ;
+}
+
+inline bool
+IsNewline(int wordBreak)
+{
+    return wordBreak == wordCR || wordBreak == wordLF || wordBreak == wordNewline;
+}
+
+//
+// ASCII letters, digits and '_' never have a word boundary between them.
+//
+inline bool
+IsASCIIWordCharacter(Byte b)
+{
+    return (static_cast<Byte>((b | 0x20) - 'a') < 26) || (static_cast<Byte>(b - '0') < 10) || b == '_';
+}
+
+//
+// Word_Break of the first code point at or after p that WB4 does not
+// skip, or wordOther at the end.
+//
+int
+NextWordBreak(const Byte* p, const Byte* last)
+{
+    while (p != last)
+    {
+        UTF32 cp;
+        if (UTF8Encoding::Decode(p, last, cp, strictConversion) != conversionOK)
+        {
+            break;
+        }
+        int wordBreak = WordBreakOf(GetProperties(cp));
+        if (!IsWordIgnorable(wordBreak))
+        {
+            return wordBreak;
+        }
+    }
+    return wordOther;
+}
+
+//
+// WB5 - WB16, previous and beforePrevious are the characters before the
+// candidate boundary with Extend, Format and ZWJ skipped (WB4), next
+// points after current.
+//
+bool
+JoinsWord(int beforePrevious, int previous, int current, const Byte* next, const Byte* last,
+          int regionalIndicators)
+{
+    if (IsAHLetter(previous))
+    {
+        if (IsAHLetter(current) || current == wordNumeric || current == wordExtendNumLet)
+        {
+            return true;                                                    // WB5, WB9, WB13a
+        }
+        if (current == wordMidLetter || IsMidNumLetQ(current))
+        {
+            if (IsAHLetter(NextWordBreak(next, last)))
+            {
+                return true;                                                // WB6
+            }
+        }
+        if (previous == wordHebrewLetter)
+        {
+            if (current == wordSingleQuote)
+            {
+                return true;                                                // WB7a
+            }
+            if (current == wordDoubleQuote && NextWordBreak(next, last) == wordHebrewLetter)
+            {
+                return true;                                                // WB7b
+            }
+        }
+        return false;
+    }
+
+    switch (previous)
+    {
+        case wordMidLetter:
+        case wordMidNumLet:
+        case wordSingleQuote:
+            if (IsAHLetter(beforePrevious) && IsAHLetter(current))
+            {
+                return true;                                                // WB7
+            }
+            return previous != wordMidLetter && beforePrevious == wordNumeric &&
+                   current == wordNumeric;                                  // WB11
+        case wordDoubleQuote:
+            return beforePrevious == wordHebrewLetter && current == wordHebrewLetter; // WB7c
+        case wordMidNum:
+            return beforePrevious == wordNumeric && current == wordNumeric;  // WB11
+        case wordNumeric:
+            if (current == wordNumeric || IsAHLetter(current) || current == wordExtendNumLet)
+            {
+                return true;                                                // WB8, WB10, WB13a
+            }
+            return (current == wordMidNum || IsMidNumLetQ(current)) &&
+                   NextWordBreak(next, last) == wordNumeric;                // WB12
+        case wordKatakana:
+            return current == wordKatakana || current == wordExtendNumLet;  // WB13, WB13a
+        case wordExtendNumLet:
+            return IsAHLetter(current) || current == wordNumeric || current == wordKatakana ||
+                   current == wordExtendNumLet;                             // WB13a, WB13b
+        case wordRegionalIndicator:
+            return current == wordRegionalIndicator && regionalIndicators % 2 == 1; // WB15, WB16
+        default:
+            return false;
+    }
+}
+
+}
+
+const char*
+Util::NextGraphemeBoundary(const char* first, const char* last)
+{
+    assert(first < last);
+    const Byte* p = reinterpret_cast<const Byte*>(first);
+    const Byte* end = reinterpret_cast<const Byte*>(last);
+
+    //
+    // Two ASCII characters only stay together as CR LF (GB3), everything
+    // else that could join an ASCII character (GB9 - GB9a) is not ASCII.
+    //
+    if (p[0] < 0x80 && (p + 1 == end || (p[1] < 0x80 && !(p[0] == '\r' && p[1] == '\n'))))
+    {
+        return first + 1;
+    }
+
+    UTF32 cp;
+    if (UTF8Encoding::Decode(p, end, cp, strictConversion) != conversionOK)
+    {
+        return first + 1;
+    }
+    uint16 properties = GetProperties(cp);
+    int previous = GraphemeBreakOf(properties);
+    PictographicState pictographic = (properties & segmentationPictographic) ? afterPictographic : noPictographic;
+    int regionalIndicators = previous == graphemeRegionalIndicator ? 1 : 0;
+
+    while (p != end)
+    {
+        const Byte* start = p;
+        if (UTF8Encoding::Decode(p, end, cp, strictConversion) != conversionOK)
+        {
+            return reinterpret_cast<const char*>(start);
+        }
+        properties = GetProperties(cp);
+        int current = GraphemeBreakOf(properties);
+
+        if (!JoinsGrapheme(previous, current, properties, pictographic, regionalIndicators))
+        {
+            return reinterpret_cast<const char*>(start);
+        }
+
+        if (properties & segmentationPictographic)
+        {
+            pictographic = afterPictographic;
+        }
+        else if (pictographic == afterPictographic && current == graphemeZWJ)
+        {
+            pictographic = afterPictographicZWJ;
+        }
+        else if (pictographic != afterPictographic || current != graphemeExtend)
+        {
+            pictographic = noPictographic;
+        }
+        regionalIndicators = current == graphemeRegionalIndicator ? regionalIndicators + 1 : 0;
+        previous = current;
+    }
+    return last;
+}
+
+const char*
+Util::NextWordBoundary(const char* first, const char* last)
+{
+    assert(first < last);
+    const Byte* p = reinterpret_cast<const Byte*>(first);
+    const Byte* end = reinterpret_cast<const Byte*>(last);
+
+    int raw;
+    int previous;
+    int beforePrevious = wordOther;
+    int regionalIndicators = 0;
+
+    if (IsASCIIWordCharacter(p[0]))
+    {
+        //
+        // ALetter, Numeric and ExtendNumLet all join each other (WB5, WB8 -
+        // WB10, WB13a, WB13b): skip the run of them and go on from its last
+        // two characters.
+        //
+        const Byte* run = p + 1;
+        while (run != end && IsASCIIWordCharacter(*run))
+        {
+            ++run;
+        }
+        if (run - p >= 2)
+        {
+            beforePrevious = WordBreakOf(GetProperties(run[-2]));
+        }
+        previous = WordBreakOf(GetProperties(run[-1]));
+        p = run;
+    }
+    else
+    {
+        UTF32 cp;
+        if (UTF8Encoding::Decode(p, end, cp, strictConversion) != conversionOK)
+        {
+            return first + 1;
+        }
+        previous = WordBreakOf(GetProperties(cp));
+        regionalIndicators = previous == wordRegionalIndicator ? 1 : 0;
+    }
+    raw = previous;
+
+    while (p != end)
+    {
+        const Byte* start = p;
+        UTF32 cp;
+        if (UTF8Encoding::Decode(p, end, cp, strictConversion) != conversionOK)
+        {
+            return reinterpret_cast<const char*>(start);
+        }
+        uint16 properties = GetProperties(cp);
+        int current = WordBreakOf(properties);
+
+        if (IsNewline(raw) || IsNewline(current))
+        {
+            if (!(raw == wordCR && current == wordLF))                      // WB3 - WB3b
+            {
+                return reinterpret_cast<const char*>(start);
+            }
+        }
+        else if ((raw == wordZWJ && (properties & segmentationPictographic)) || // WB3c
+                 (raw == wordWSegSpace && current == wordWSegSpace))        // WB3d
+        {
+        }
+        else if (IsWordIgnorable(current))                                  // WB4
+        {
+            raw = current;
+            continue;
+        }
+        else if (!JoinsWord(beforePrevious, previous, current, p, end, regionalIndicators))
+        {
+            return reinterpret_cast<const char*>(start);
+        }
+
+        regionalIndicators = current == wordRegionalIndicator ? regionalIndicators + 1 : 0;
+        beforePrevious = previous;
+        previous = current;
+        raw = current;
+    }
+    return last;
+}
+
+size_t
+Util::GraphemeTruncationLength(const char* utf8, size_t size, size_t maxBytes)
+{
+    size_t length = UTF8TruncationLength(utf8, size, maxBytes);
+    if (length == size)
+    {
+        return size;
+    }
+
+    //
+    // Back up to a certain boundary, then step forward over the clusters
+    // up to the one that crosses the cut.
+    //
+    const Byte* begin = reinterpret_cast<const Byte*>(utf8);
+    const Byte* end = begin + size;
+    const Byte* known = begin + length;
+    while (known != begin && !IsKnownGraphemeBoundary(begin, known, end))
+    {
+        known = TranscoderInternal::CodePointRetreater<8>::Retreat<UTF8Encoding>(begin, known);
+    }
+
+    const char* boundary = reinterpret_cast<const char*>(known);
+    const char* last = utf8 + size;
+    while (true)
+    {
+        const char* next = NextGraphemeBoundary(boundary, last);
+        if (static_cast<size_t>(next - utf8) > length)
+        {
+            return static_cast<size_t>(boundary - utf8);
+        }
+        boundary = next;
+    }
+}
+
+string
+Util::TruncateGraphemes(const string& utf8, size_t maxBytes)
+{
+    return utf8.substr(0, GraphemeTruncationLength(utf8.data(), utf8.size(), maxBytes));
+}
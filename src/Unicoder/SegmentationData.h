@@ -0,0 +1,79 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+//
+// Generated by MakeUnicodeTables.pl from the Unicode Character Database
+// 14.0.0 - do not edit.
+//
+
+#ifndef UTIL_SEGMENTATION_DATA_H
+#define UTIL_SEGMENTATION_DATA_H
+
+#include <Util/Config.h>
+#include <Unicoder/ConvertUTF.h>
+
+//
+// Only included by the source file that uses the tables.
+//
+namespace
+{
+
+//
+// The segmentation properties of a code point are in its character record
+// (CharacterData.h): Grapheme_Cluster_Break (bits 0-3), Word_Break (bits
+// 4-8) and Extended_Pictographic (bit 9) of UAX #29.
+//
+const uint16 segmentationGraphemeMask = 0x00F;
+const int segmentationWordShift = 4;
+const uint16 segmentationWordMask = 0x1F0;
+const uint16 segmentationPictographic = 0x200;
+
+enum GraphemeBreak
+{
+    graphemeOther,
+    graphemeCR,
+    graphemeLF,
+    graphemeControl,
+    graphemeExtend,
+    graphemeZWJ,
+    graphemeRegionalIndicator,
+    graphemePrepend,
+    graphemeSpacingMark,
+    graphemeL,
+    graphemeV,
+    graphemeT,
+    graphemeLV,
+    graphemeLVT
+};
+
+enum WordBreak
+{
+    wordOther,
+    wordCR,
+    wordLF,
+    wordNewline,
+    wordExtend,
+    wordZWJ,
+    wordRegionalIndicator,
+    wordFormat,
+    wordKatakana,
+    wordHebrewLetter,
+    wordALetter,
+    wordSingleQuote,
+    wordDoubleQuote,
+    wordMidNumLet,
+    wordMidLetter,
+    wordMidNum,
+    wordNumeric,
+    wordExtendNumLet,
+    wordWSegSpace
+};
+
+}
+
+#endif
@@ -7,11 +7,12 @@
 // **********************************************************************
 
 #include <Unicoder/StringConverter.h>
+#include <Unicoder/StaticStringConverter.h>
 #include <Util/StringUtil.h>
 #include <Util/ScopedArray.h>
 
-#ifndef _WIN32
-#    include <Util/IconvStringConverter.h>
+#if !defined(_WIN32) || defined(ICONV_ON_WINDOWS)
+#    include <Unicoder/IconvStringConverter.h>
 #endif
 
 #ifdef __MINGW32__
@@ -25,58 +26,79 @@ using namespace std;
 namespace
 {
 
+//
+// Hands out the storage of the target string itself, so converters write
+// straight into the string NativeToUTF8 returns instead of into a malloc'ed
+// buffer that has to be copied once more afterwards.
+//
 class UTF8BufferI : public Util::UTF8Buffer
 {
 public:
 
-   UTF8BufferI() :
-        m_buffer(0),
-        m_offset(0)
-    {
-    }
-    
-   ~UTF8BufferI()
+    UTF8BufferI(string& target) :
+        m_target(target)
     {
-        free(m_buffer);
     }
 
     Util::Byte* GetMoreBytes(size_t howMany, Byte* firstUnused)
     {
-        if (m_buffer == 0)
-        {
-            m_buffer = (Byte*)malloc(howMany);
-        }
-        else
+        size_t offset = 0;
+        if (firstUnused != 0)
         {
-            assert(firstUnused != 0);
-            m_offset = firstUnused - m_buffer;
-            m_buffer = (Byte*)realloc(m_buffer, m_offset + howMany);
+            offset = firstUnused - GetBuffer();
+            assert(offset <= m_target.size());
         }
-        
-        if (!m_buffer)
-        {
-            throw std::bad_alloc();
-        }
-        return m_buffer + m_offset;
+        m_target.resize(offset + howMany);
+        return GetBuffer() + offset;
     }
-    
+
     Util::Byte* GetBuffer()
     {
-        return m_buffer;
-    }
-    
-    void Reset()
-    {
-        free(m_buffer);
-        m_buffer = 0;
-        m_offset = 0;
+        return m_target.empty() ? 0 : reinterpret_cast<Util::Byte*>(&m_target[0]);
     }
 
 private:
 
-    Util::Byte* m_buffer;
-    size_t m_offset;
+    string& m_target;
 };
+
+void
+CheckUTF8(const Byte* sourceStart, const Byte* sourceEnd)
+{
+    if (!IsLegalUTF8Sequence(sourceStart, sourceEnd))
+    {
+        throw StringConversionException(__FILE__, __LINE__, "UTF-8 string source illegal");
+    }
+}
+
+//
+// ToUTF8 / FromUTF8 for narrow strings that are UTF-8 already.
+//
+Byte*
+CopyUTF8(const char* sourceStart, const char* sourceEnd, UTF8Buffer& buffer, bool validate)
+{
+    const Byte* source = reinterpret_cast<const Byte*>(sourceStart);
+    size_t size = static_cast<size_t>(sourceEnd - sourceStart);
+    if (validate)
+    {
+        CheckUTF8(source, source + size);
+    }
+
+    Byte* target = buffer.GetMoreBytes(std::max<size_t>(size, 1), 0);
+    memcpy(target, source, size);
+    return target + size;
+}
+
+void
+AssignUTF8(const Byte* sourceStart, const Byte* sourceEnd, string& target, bool validate)
+{
+    if (validate)
+    {
+        CheckUTF8(sourceStart, sourceEnd);
+    }
+    target.assign(reinterpret_cast<const char*>(sourceStart), sourceEnd - sourceStart);
+}
+
 }
 
 
@@ -89,46 +111,17 @@ UnicodeWstringConverter::UnicodeWstringConverter(ConversionFlags flags) :
 {
 }
 
+//
+// UnicodeWstringConverter is the virtual adapter over the statically
+// dispatched converter for the wstring encoding.
+//
 Byte* 
 UnicodeWstringConverter::ToUTF8(const wchar_t* sourceStart, 
                                 const wchar_t* sourceEnd,
                                 UTF8Buffer& buffer) const
 {
-    //
-    // The "chunk size" is the maximum of the number of characters in the
-    // source and 6 (== max bytes necessary to encode one Unicode character).
-    //
-    size_t chunkSize = std::max<size_t>(static_cast<size_t>(sourceEnd - sourceStart), 6);
-
-    Byte* targetStart = buffer.GetMoreBytes(chunkSize, 0);
-    Byte* targetEnd = targetStart + chunkSize;
-
-    ConversionResult result;
-
-    while ((result =
-          ConvertUTFWstringToUTF8(sourceStart, sourceEnd, 
-                                  targetStart, targetEnd, m_conversionFlags))
-          == targetExhausted)
-    {
-        targetStart = buffer.GetMoreBytes(chunkSize, targetStart);
-        targetEnd = targetStart + chunkSize;
-    }
-        
-    switch(result)
-    {
-        case conversionOK:
-            break;
-        case sourceExhausted:
-            throw StringConversionException(__FILE__, __LINE__, "wide string source exhausted");
-        case sourceIllegal:
-            throw StringConversionException(__FILE__, __LINE__, "wide string source illegal");
-        default:
-        {
-            assert(0);
-            throw StringConversionException(__FILE__, __LINE__);
-        }
-    }
-    return targetStart;
+    return StaticStringConverter<wchar_t, WstringEncoding>(m_conversionFlags).ToUTF8(
+        sourceStart, sourceEnd, buffer);
 }
 
 
@@ -137,29 +130,48 @@ UnicodeWstringConverter::FromUTF8(const Byte* sourceStart,
                                   const Byte* sourceEnd,
                                   wstring& target) const
 {
-    if (sourceStart == sourceEnd)
-    {
-        target = L"";
-        return;
-    }
+    StaticStringConverter<wchar_t, WstringEncoding>(m_conversionFlags).FromUTF8(
+        sourceStart, sourceEnd, target);
+}
 
-    ConversionResult result = 
-        ConvertUTF8ToUTFWstring(sourceStart, sourceEnd, target, m_conversionFlags);
-
-    switch(result)
-    {    
-        case conversionOK:
-            break;
-        case sourceExhausted:
-            throw StringConversionException(__FILE__, __LINE__, "UTF-8 string source exhausted");
-        case sourceIllegal:
-            throw StringConversionException(__FILE__, __LINE__, "UTF-8 string source illegal");
-        default:
+//////////////////////////////////////////////////////////////////////////
+/// UTF8StringConverter
+UTF8StringConverter::UTF8StringConverter(bool validate) :
+    m_validate(validate)
+{
+}
+
+Byte*
+UTF8StringConverter::ToUTF8(const char* sourceStart, const char* sourceEnd, UTF8Buffer& buffer) const
+{
+    return CopyUTF8(sourceStart, sourceEnd, buffer, m_validate);
+}
+
+void
+UTF8StringConverter::FromUTF8(const Byte* sourceStart, const Byte* sourceEnd, string& target) const
+{
+    AssignUTF8(sourceStart, sourceEnd, target, m_validate);
+}
+
+bool
+UTF8StringConverter::IsUTF8() const
+{
+    return true;
+}
+
+bool
+IsUTF8Codeset(const string& codeset)
+{
+    string name;
+    name.reserve(codeset.size());
+    for (string::const_iterator p = codeset.begin(); p != codeset.end(); ++p)
+    {
+        if (*p != '-' && *p != '_')
         {
-            assert(0);
-            throw StringConversionException(__FILE__, __LINE__);
+            name += ToUpperChar(*p);
         }
     }
+    return name == "UTF8" || name == "CP65001";
 }
 
 #ifdef _WIN32
@@ -168,6 +180,11 @@ UnicodeWstringConverter::FromUTF8(const Byte* sourceStart,
 /// WindowsStringConverter
 int WindowsStringConverter::getCodePage(const std::string& internalCode)
 {
+    if (IsUTF8Codeset(internalCode))
+    {
+        return CP_UTF8;
+    }
+
     std::string codeName = Util::String::ToUpper(internalCode);
     if (Util::String::Match(codeName, "GB*", true))
     {
@@ -220,6 +237,11 @@ WindowsStringConverter::ToUTF8(const char* sourceStart,
                                const char* sourceEnd,
                                UTF8Buffer& buffer) const
 {
+    if (m_codePage == CP_UTF8)
+    {
+        return CopyUTF8(sourceStart, sourceEnd, buffer, true);
+    }
+
     //
     // First convert to UTF-16
     //
@@ -262,6 +284,12 @@ WindowsStringConverter::FromUTF8(const Byte* sourceStart, const Byte* sourceEnd,
         return;
     }
 
+    if (m_codePage == CP_UTF8)
+    {
+        AssignUTF8(sourceStart, sourceEnd, target, true);
+        return;
+    }
+
     //
     // First convert to wstring (UTF-16)
     //
@@ -290,7 +318,47 @@ WindowsStringConverter::FromUTF8(const Byte* sourceStart, const Byte* sourceEnd,
     target.assign(buffer.Get(), writtenChar);
 }
 
+bool
+WindowsStringConverter::IsUTF8() const
+{
+    return m_codePage == CP_UTF8;
+}
+
+#endif
+
+StringConverterPtr
+CreateStringConverter(const string& internalCode)
+{
+#if defined(_WIN32) && !defined(ICONV_ON_WINDOWS)
+    if (internalCode.empty())
+    {
+        unsigned int codePage = GetACP();
+        if (codePage == CP_UTF8)
+        {
+            return new UTF8StringConverter();
+        }
+        return new WindowsStringConverter(codePage);
+    }
+    if (IsUTF8Codeset(internalCode))
+    {
+        return new UTF8StringConverter();
+    }
+    return new WindowsStringConverter(internalCode);
+#else
+    string code = internalCode;
+#   ifndef _WIN32
+    if (code.empty())
+    {
+        code = nl_langinfo(CODESET);
+    }
+#   endif
+    if (IsUTF8Codeset(code))
+    {
+        return new UTF8StringConverter();
+    }
+    return new IconvStringConverter<char>(code.c_str());
 #endif
+}
 
 string
 Util::NativeToUTF8(const Util::StringConverterPtr& converter, const string& str)
@@ -303,9 +371,11 @@ Util::NativeToUTF8(const Util::StringConverterPtr& converter, const string& str)
     {
         return str;
     }
-    UTF8BufferI buffer;
+    string result;
+    UTF8BufferI buffer(result);
     Util::Byte* last = converter->ToUTF8(str.data(), str.data() + str.size(), buffer);
-    return string(reinterpret_cast<const char*>(buffer.GetBuffer()), last - buffer.GetBuffer());
+    result.resize(last - buffer.GetBuffer());
+    return result;
 }
 
 string
@@ -325,6 +395,40 @@ Util::UTF8ToNative(const Util::StringConverterPtr& converter, const string& str)
     return tmp;
 }
 
+void
+NativeToUTF8InPlace(const Util::StringConverterPtr& converter, string& str)
+{
+    if (!converter || str.empty())
+    {
+        return;
+    }
+    if (converter->IsUTF8())
+    {
+        const Util::Byte* data = reinterpret_cast<const Util::Byte*>(str.data());
+        CheckUTF8(data, data + str.size());
+        return;
+    }
+    string tmp = NativeToUTF8(converter, str);
+    str.swap(tmp);
+}
+
+void
+UTF8ToNativeInPlace(const Util::StringConverterPtr& converter, string& str)
+{
+    if (!converter || str.empty())
+    {
+        return;
+    }
+    if (converter->IsUTF8())
+    {
+        const Util::Byte* data = reinterpret_cast<const Util::Byte*>(str.data());
+        CheckUTF8(data, data + str.size());
+        return;
+    }
+    string tmp = UTF8ToNative(converter, str);
+    str.swap(tmp);
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// StringConversionException
 Util::StringConversionException::StringConversionException(const char *file, int line) :
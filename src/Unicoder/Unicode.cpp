@@ -17,78 +17,21 @@
 
 #include <Unicoder/Unicode.h>
 #include <Unicoder/ConvertUTF.h>
+#include <Unicoder/Transcoder.h>
+#include <Util/Bits.h>
+
+#include <algorithm>
+
+#if defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
 
 using namespace std;
 using namespace Util;
 using namespace UtilInternal;
 
-namespace
-{
-//
-// Helper class, base never defined
-// Usage: WstringHelper<sizeof(wchar_t)>::ToUTF8 and FromUTF8.
-//
-template<size_t wcharSize> 
-struct WstringHelper
-{
-    static ConversionResult ToUTF8(
-        const wchar_t*& sourceStart, const wchar_t* sourceEnd, 
-        Byte*& targetStart, Byte* targetEnd, ConversionFlags flags);
-
-    static ConversionResult FromUTF8(
-        const Byte*& sourceStart, const Byte* sourceEnd, 
-        wchar_t*& targetStart, wchar_t* targetEnd, ConversionFlags flags);
-};
-
-template<>
-struct WstringHelper<2>
-{
-    static ConversionResult ToUTF8(
-        const wchar_t*& sourceStart, const wchar_t* sourceEnd, 
-        Byte*& targetStart, Byte* targetEnd, ConversionFlags flags)
-    {
-        return ConvertUTF16toUTF8(
-            reinterpret_cast<const UTF16**>(&sourceStart),
-            reinterpret_cast<const UTF16*>(sourceEnd),
-            &targetStart, targetEnd, flags);
-    }
-    
-    static ConversionResult FromUTF8(
-        const Byte*& sourceStart, const Byte* sourceEnd, 
-        wchar_t*& targetStart, wchar_t* targetEnd, ConversionFlags flags)
-    {
-        return ConvertUTF8toUTF16(
-            &sourceStart, sourceEnd,
-            reinterpret_cast<UTF16**>(&targetStart),
-            reinterpret_cast<UTF16*>(targetEnd), flags);
-    }
-};
-
-template<>
-struct WstringHelper<4>
-{
-    static ConversionResult ToUTF8(
-        const wchar_t*& sourceStart, const wchar_t* sourceEnd, 
-        Byte*& targetStart, Byte* targetEnd, ConversionFlags flags)
-    {
-        return ConvertUTF32toUTF8(
-            reinterpret_cast<const UTF32**>(&sourceStart),
-            reinterpret_cast<const UTF32*>(sourceEnd),
-            &targetStart, targetEnd, flags);
-    }
-    
-    static ConversionResult FromUTF8(
-        const Byte*& sourceStart, const Byte* sourceEnd, 
-        wchar_t*& targetStart, wchar_t* targetEnd, ConversionFlags flags)
-    {
-        return ConvertUTF8toUTF32(
-            &sourceStart, sourceEnd,
-            reinterpret_cast<UTF32**>(&targetStart),
-            reinterpret_cast<UTF32*>(targetEnd), flags);
-    }
-};
-}
-
 //
 // convertXXX functions
 //
@@ -98,7 +41,7 @@ UtilInternal::ConvertUTFWstringToUTF8(
     const wchar_t*& sourceStart, const wchar_t* sourceEnd, 
     Byte*& targetStart, Byte* targetEnd, ConversionFlags flags)
 {
-    return WstringHelper<sizeof(wchar_t)>::ToUTF8(
+    return Transcoder<WstringEncoding, UTF8Encoding>::Convert(
         sourceStart, sourceEnd, targetStart, targetEnd, flags);
 }
 
@@ -107,7 +50,7 @@ UtilInternal::ConvertUTF8ToUTFWstring(
     const Byte*& sourceStart, const Byte* sourceEnd, 
     wchar_t*& targetStart, wchar_t* targetEnd, ConversionFlags flags)
 {
-    return WstringHelper<sizeof(wchar_t)>::FromUTF8(
+    return Transcoder<UTF8Encoding, WstringEncoding>::Convert(
         sourceStart, sourceEnd, targetStart, targetEnd, flags);
 }
 
@@ -116,24 +59,136 @@ UtilInternal::ConvertUTF8ToUTFWstring(const Byte*& sourceStart, const Byte* sour
                                  std::wstring& target, ConversionFlags flags)
 {
     //
-    // Could be reimplemented without this temporary wchar_t buffer
+    // Not Transcoder's string overload, which leaves sourceStart alone.
     //
-    size_t size = static_cast<size_t>(sourceEnd - sourceStart);
-    wchar_t* outBuf = new wchar_t[size];
-    wchar_t* targetStart = outBuf; 
-    wchar_t* targetEnd = targetStart + size;
+    std::wstring result(Transcoder<UTF8Encoding, WstringEncoding>::MaxTargetSize(
+                            static_cast<size_t>(sourceEnd - sourceStart)), L'\0');
+    if (result.empty())
+    {
+        target.swap(result);
+        return conversionOK;
+    }
 
-    ConversionResult result =  
-        ConvertUTF8ToUTFWstring(sourceStart, sourceEnd, targetStart,
-                                targetEnd, flags);
+    wchar_t* first = &result[0];
+    wchar_t* last = first;
+    ConversionResult cr = ConvertUTF8ToUTFWstring(sourceStart, sourceEnd, last, first + result.size(), flags);
+    if (cr == conversionOK)
+    {
+        result.resize(static_cast<size_t>(last - first));
+        target.swap(result);
+    }
+    return cr;
+}
 
-    if (result == conversionOK)
+const Byte*
+UtilInternal::FindNonASCII(const Byte* begin, const Byte* end)
+{
+#if defined(ARCH_CPU_SSE2)
+    while (end - begin >= 16)
     {
-        std::wstring s(outBuf, static_cast<size_t>(targetStart - outBuf));
-        s.swap(target);
+        int mask = _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(begin)));
+        if (mask != 0)
+        {
+            return begin + Bits::CountTrailingZeros32(static_cast<uint32>(mask));
+        }
+        begin += 16;
     }
-    delete[] outBuf;
-    return result;
+#elif defined(ARCH_CPU_NEON)
+    while (end - begin >= 16)
+    {
+        uint8x16_t v = vld1q_u8(begin);
+        uint8x8_t m = vmax_u8(vget_low_u8(v), vget_high_u8(v));
+        m = vpmax_u8(m, m);
+        m = vpmax_u8(m, m);
+        m = vpmax_u8(m, m);
+        if (vget_lane_u8(m, 0) & 0x80)
+        {
+            break; // The word loop below locates the exact byte.
+        }
+        begin += 16;
+    }
+#endif
+
+    //
+    // One machine word at a time: a byte is non-ASCII iff its high bit is set.
+    //
+    const size_t highBits = static_cast<size_t>(-1) / 0xFF * 0x80;
+    while (static_cast<size_t>(end - begin) >= sizeof(size_t))
+    {
+        size_t word;
+        memcpy(&word, begin, sizeof(word));
+        if (word & highBits)
+        {
+            break;
+        }
+        begin += sizeof(size_t);
+    }
+
+    while (begin != end && *begin < 0x80)
+    {
+        ++begin;
+    }
+    return begin;
+}
+
+size_t
+UtilInternal::CountContinuationBytes(const Byte* begin, const Byte* end)
+{
+    size_t count = 0;
+
+#if defined(ARCH_CPU_SSE2)
+    //
+    // As signed bytes the continuation bytes 0x80..0xBF are exactly those
+    // below -64. The 0/-1 compare results are accumulated per lane for at
+    // most 255 blocks and then summed horizontally with psadbw.
+    //
+    const __m128i threshold = _mm_set1_epi8(-64);
+    const __m128i zero = _mm_setzero_si128();
+    while (end - begin >= 16)
+    {
+        size_t blocks = std::min<size_t>(static_cast<size_t>(end - begin) / 16, 255);
+        __m128i sum = zero;
+        for (size_t i = 0; i < blocks; ++i, begin += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+            sum = _mm_sub_epi8(sum, _mm_cmplt_epi8(v, threshold));
+        }
+        sum = _mm_sad_epu8(sum, zero);
+        count += static_cast<size_t>(_mm_cvtsi128_si32(sum)) + static_cast<size_t>(_mm_extract_epi16(sum, 4));
+    }
+#elif defined(ARCH_CPU_NEON)
+    const int8x16_t threshold = vdupq_n_s8(-64);
+    while (end - begin >= 16)
+    {
+        size_t blocks = std::min<size_t>(static_cast<size_t>(end - begin) / 16, 255);
+        uint8x16_t sum = vdupq_n_u8(0);
+        for (size_t i = 0; i < blocks; ++i, begin += 16)
+        {
+            int8x16_t v = vreinterpretq_s8_u8(vld1q_u8(begin));
+            sum = vsubq_u8(sum, vcltq_s8(v, threshold));
+        }
+        uint64x2_t total = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(sum)));
+        count += static_cast<size_t>(vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1));
+    }
+#endif
+
+    //
+    // A byte is a continuation byte iff bit 7 is set and bit 6 is clear.
+    //
+    const uint64 highBits = 0x8080808080808080ULL;
+    while (end - begin >= 8)
+    {
+        uint64 word;
+        memcpy(&word, begin, sizeof(word));
+        count += Bits::PopCount64(word & ~(word << 1) & highBits);
+        begin += 8;
+    }
+
+    for (; begin != end; ++begin)
+    {
+        count += (*begin & 0xC0) == 0x80;
+    }
+    return count;
 }
 
 
@@ -196,32 +251,18 @@ string
 Util::WstringToString(const wstring& wstr, ConversionFlags flags)
 {
     string target;
-    
-    size_t size = wstr.size() * 3 * (sizeof(wchar_t) / 2);
-
-    Byte* outBuf = new Byte[size];
-    Byte* targetStart = outBuf; 
-    Byte* targetEnd = outBuf + size;
-
     const wchar_t* sourceStart = wstr.data();
-  
+
     ConversionResult cr = 
-        ConvertUTFWstringToUTF8(
-            sourceStart, sourceStart + wstr.size(), 
-            targetStart, targetEnd, flags);
+        Transcoder<WstringEncoding, UTF8Encoding>::Convert(
+            sourceStart, sourceStart + wstr.size(), target, flags);
         
     if (cr != conversionOK)
     {
-        delete[] outBuf;
         assert(cr == sourceExhausted || cr == sourceIllegal);
         throw UTFConversionException(__FILE__, __LINE__, 
                                      cr == sourceExhausted ? partialCharacter : badEncoding);
     }
-    
-    string s(reinterpret_cast<char*>(outBuf),
-             static_cast<size_t>(targetStart - outBuf));
-    s.swap(target);
-    delete[] outBuf;
     return target;
 }
 
@@ -244,3 +285,44 @@ Util::StringToWstring(const string& str, ConversionFlags flags)
     }
     return result;
 }
+
+size_t
+Util::UTF8TruncationLength(const char* utf8, size_t size, size_t maxBytes)
+{
+    if (size <= maxBytes)
+    {
+        return size;
+    }
+
+    //
+    // Back up over the continuation bytes before maxBytes to the lead byte
+    // of the character they belong to, and cut before it if the character
+    // does not end by maxBytes.
+    //
+    const Byte* p = reinterpret_cast<const Byte*>(utf8);
+    size_t start = maxBytes;
+    while (start > 0 && maxBytes - start < 3 && (p[start] & 0xC0) == 0x80)
+    {
+        --start;
+    }
+    if (start == maxBytes)
+    {
+        return maxBytes;
+    }
+
+    Byte lead = p[start];
+    size_t length = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+    return start + length > maxBytes ? start : maxBytes;
+}
+
+string
+Util::TruncateUTF8(const string& utf8, size_t maxBytes)
+{
+    return utf8.substr(0, UTF8TruncationLength(utf8.data(), utf8.size(), maxBytes));
+}
+
+void
+Util::TruncateUTF8InPlace(string& utf8, size_t maxBytes)
+{
+    utf8.resize(UTF8TruncationLength(utf8.data(), utf8.size(), maxBytes));
+}
@@ -0,0 +1,40 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+//
+// Generated by MakeUnicodeTables.pl from the Unicode Character Database
+// 14.0.0 - do not edit.
+//
+
+#ifndef UTIL_WIDTH_DATA_H
+#define UTIL_WIDTH_DATA_H
+
+#include <Util/Config.h>
+#include <Unicoder/ConvertUTF.h>
+
+//
+// Only included by the source file that uses the tables.
+//
+namespace
+{
+
+//
+// The terminal column width of a code point is in its character record
+// (CharacterData.h). Bits 0-1 hold the width: 0 for combining, enclosing
+// and spacing marks, format characters, Hangul medial vowels / final
+// consonants and emoji skin tone modifiers (they merge with the emoji
+// before them), 2 for East Asian Wide and Fullwidth, 1 otherwise (C0 / C1
+// controls are handled by the code). Bit 2 is set for emoji that become
+// wide when followed by U+FE0F.
+//
+const uint8 widthMask = 0x03;
+const uint8 widthEmojiVariation = 0x04;
+
+}
+
+#endif
@@ -0,0 +1,287 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_COMPACTION_TABLE_H
+#define UTIL_COMPACTION_TABLE_H
+
+#include <Util/Config.h>
+
+//
+// Only included by the source file that uses the table.
+//
+namespace
+{
+
+//
+// For each mask of eight bytes to drop, bit i for byte i, the positions of
+// the bytes to keep, in order, followed by 0x80: a shuffle (pshufb, vtbl)
+// with this row packs the bytes kept at the start and zeroes the rest.
+//
+static const uint8 compactionTable[256][8] =
+{
+    { 0, 1, 2, 3, 4, 5, 6, 7 },
+    { 1, 2, 3, 4, 5, 6, 7, 0x80 },
+    { 0, 2, 3, 4, 5, 6, 7, 0x80 },
+    { 2, 3, 4, 5, 6, 7, 0x80, 0x80 },
+    { 0, 1, 3, 4, 5, 6, 7, 0x80 },
+    { 1, 3, 4, 5, 6, 7, 0x80, 0x80 },
+    { 0, 3, 4, 5, 6, 7, 0x80, 0x80 },
+    { 3, 4, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 5, 6, 7, 0x80 },
+    { 1, 2, 4, 5, 6, 7, 0x80, 0x80 },
+    { 0, 2, 4, 5, 6, 7, 0x80, 0x80 },
+    { 2, 4, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 5, 6, 7, 0x80, 0x80 },
+    { 1, 4, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 4, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 4, 5, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 5, 6, 7, 0x80 },
+    { 1, 2, 3, 5, 6, 7, 0x80, 0x80 },
+    { 0, 2, 3, 5, 6, 7, 0x80, 0x80 },
+    { 2, 3, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 5, 6, 7, 0x80, 0x80 },
+    { 1, 3, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 3, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 3, 5, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 5, 6, 7, 0x80, 0x80 },
+    { 1, 2, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 2, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 2, 5, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 5, 6, 7, 0x80, 0x80, 0x80 },
+    { 1, 5, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 5, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 5, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 6, 7, 0x80 },
+    { 1, 2, 3, 4, 6, 7, 0x80, 0x80 },
+    { 0, 2, 3, 4, 6, 7, 0x80, 0x80 },
+    { 2, 3, 4, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 4, 6, 7, 0x80, 0x80 },
+    { 1, 3, 4, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 3, 4, 6, 7, 0x80, 0x80, 0x80 },
+    { 3, 4, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 6, 7, 0x80, 0x80 },
+    { 1, 2, 4, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 2, 4, 6, 7, 0x80, 0x80, 0x80 },
+    { 2, 4, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 6, 7, 0x80, 0x80, 0x80 },
+    { 1, 4, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 4, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 4, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 6, 7, 0x80, 0x80 },
+    { 1, 2, 3, 6, 7, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 6, 7, 0x80, 0x80, 0x80 },
+    { 2, 3, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 6, 7, 0x80, 0x80, 0x80 },
+    { 1, 3, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 6, 7, 0x80, 0x80, 0x80 },
+    { 1, 2, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 6, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 6, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 5, 7, 0x80 },
+    { 1, 2, 3, 4, 5, 7, 0x80, 0x80 },
+    { 0, 2, 3, 4, 5, 7, 0x80, 0x80 },
+    { 2, 3, 4, 5, 7, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 4, 5, 7, 0x80, 0x80 },
+    { 1, 3, 4, 5, 7, 0x80, 0x80, 0x80 },
+    { 0, 3, 4, 5, 7, 0x80, 0x80, 0x80 },
+    { 3, 4, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 5, 7, 0x80, 0x80 },
+    { 1, 2, 4, 5, 7, 0x80, 0x80, 0x80 },
+    { 0, 2, 4, 5, 7, 0x80, 0x80, 0x80 },
+    { 2, 4, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 5, 7, 0x80, 0x80, 0x80 },
+    { 1, 4, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 4, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 4, 5, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 5, 7, 0x80, 0x80 },
+    { 1, 2, 3, 5, 7, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 5, 7, 0x80, 0x80, 0x80 },
+    { 2, 3, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 5, 7, 0x80, 0x80, 0x80 },
+    { 1, 3, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 5, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 5, 7, 0x80, 0x80, 0x80 },
+    { 1, 2, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 5, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 5, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 5, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 5, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 5, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 7, 0x80, 0x80 },
+    { 1, 2, 3, 4, 7, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 4, 7, 0x80, 0x80, 0x80 },
+    { 2, 3, 4, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 4, 7, 0x80, 0x80, 0x80 },
+    { 1, 3, 4, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 4, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 4, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 7, 0x80, 0x80, 0x80 },
+    { 1, 2, 4, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 4, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 4, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 4, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 4, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 4, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 7, 0x80, 0x80, 0x80 },
+    { 1, 2, 3, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 3, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 3, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 7, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 2, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 7, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 7, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 5, 6, 0x80 },
+    { 1, 2, 3, 4, 5, 6, 0x80, 0x80 },
+    { 0, 2, 3, 4, 5, 6, 0x80, 0x80 },
+    { 2, 3, 4, 5, 6, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 4, 5, 6, 0x80, 0x80 },
+    { 1, 3, 4, 5, 6, 0x80, 0x80, 0x80 },
+    { 0, 3, 4, 5, 6, 0x80, 0x80, 0x80 },
+    { 3, 4, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 5, 6, 0x80, 0x80 },
+    { 1, 2, 4, 5, 6, 0x80, 0x80, 0x80 },
+    { 0, 2, 4, 5, 6, 0x80, 0x80, 0x80 },
+    { 2, 4, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 5, 6, 0x80, 0x80, 0x80 },
+    { 1, 4, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 4, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 4, 5, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 5, 6, 0x80, 0x80 },
+    { 1, 2, 3, 5, 6, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 5, 6, 0x80, 0x80, 0x80 },
+    { 2, 3, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 5, 6, 0x80, 0x80, 0x80 },
+    { 1, 3, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 5, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 5, 6, 0x80, 0x80, 0x80 },
+    { 1, 2, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 5, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 5, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 5, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 5, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 5, 6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 6, 0x80, 0x80 },
+    { 1, 2, 3, 4, 6, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 4, 6, 0x80, 0x80, 0x80 },
+    { 2, 3, 4, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 4, 6, 0x80, 0x80, 0x80 },
+    { 1, 3, 4, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 4, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 4, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 6, 0x80, 0x80, 0x80 },
+    { 1, 2, 4, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 4, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 4, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 4, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 4, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 4, 6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 6, 0x80, 0x80, 0x80 },
+    { 1, 2, 3, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 3, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 3, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 6, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 2, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 6, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 6, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 5, 0x80, 0x80 },
+    { 1, 2, 3, 4, 5, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 4, 5, 0x80, 0x80, 0x80 },
+    { 2, 3, 4, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 4, 5, 0x80, 0x80, 0x80 },
+    { 1, 3, 4, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 4, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 4, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 5, 0x80, 0x80, 0x80 },
+    { 1, 2, 4, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 4, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 4, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 4, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 4, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 4, 5, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 5, 0x80, 0x80, 0x80 },
+    { 1, 2, 3, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 3, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 3, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 5, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 5, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 2, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 5, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 5, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 5, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 5, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 5, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 4, 0x80, 0x80, 0x80 },
+    { 1, 2, 3, 4, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 4, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 3, 4, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 4, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 3, 4, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 4, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 4, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 2, 4, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 4, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 4, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 4, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 3, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 2, 3, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 3, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 3, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 3, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 2, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 2, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 2, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 2, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 1, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 },
+    { 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 }
+};
+
+}
+
+#endif
@@ -0,0 +1,499 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/CsvParser.h>
+#include <Util/Bits.h>
+#include <Util/Exception.h>
+#include <Unicoder/Unicode.h>
+
+#include <cstring>
+
+#if defined(ARCH_CPU_AVX2)
+#    include <immintrin.h>
+#elif defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON) && defined(ARCH_CPU_ARM64)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const size_t blockSize = 64;
+
+//
+// One bit per byte of a block.
+//
+struct BlockMasks
+{
+    uint64 doubleQuotes;
+    uint64 singleQuotes;
+    uint64 backslashes;
+    uint64 delimiters;
+    uint64 newlines;
+    uint64 nonASCII;
+};
+
+#if defined(ARCH_CPU_AVX2)
+
+inline uint64
+Equal(__m256i low, __m256i high, __m256i c)
+{
+    return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, c))) |
+           static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, c)))) << 32;
+}
+
+void
+Classify(const Byte* p, Byte delimiter, BlockMasks& masks)
+{
+    __m256i low = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    __m256i high = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32));
+    masks.doubleQuotes = Equal(low, high, _mm256_set1_epi8('"'));
+    masks.singleQuotes = Equal(low, high, _mm256_set1_epi8('\''));
+    masks.backslashes = Equal(low, high, _mm256_set1_epi8('\\'));
+    masks.delimiters = Equal(low, high, _mm256_set1_epi8(static_cast<char>(delimiter)));
+    masks.newlines = Equal(low, high, _mm256_set1_epi8('\n'));
+    masks.nonASCII = static_cast<uint32>(_mm256_movemask_epi8(low)) |
+                     static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(high))) << 32;
+}
+
+#elif defined(ARCH_CPU_SSE2)
+
+inline uint64
+MoveMask(__m128i v0, __m128i v1, __m128i v2, __m128i v3)
+{
+    return static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(v0))) |
+           static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(v1))) << 16 |
+           static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(v2))) << 32 |
+           static_cast<uint64>(static_cast<uint16>(_mm_movemask_epi8(v3))) << 48;
+}
+
+inline uint64
+Equal(const __m128i* block, __m128i c)
+{
+    return MoveMask(_mm_cmpeq_epi8(block[0], c), _mm_cmpeq_epi8(block[1], c),
+                    _mm_cmpeq_epi8(block[2], c), _mm_cmpeq_epi8(block[3], c));
+}
+
+void
+Classify(const Byte* p, Byte delimiter, BlockMasks& masks)
+{
+    __m128i block[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        block[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * i));
+    }
+    masks.doubleQuotes = Equal(block, _mm_set1_epi8('"'));
+    masks.singleQuotes = Equal(block, _mm_set1_epi8('\''));
+    masks.backslashes = Equal(block, _mm_set1_epi8('\\'));
+    masks.delimiters = Equal(block, _mm_set1_epi8(static_cast<char>(delimiter)));
+    masks.newlines = Equal(block, _mm_set1_epi8('\n'));
+    masks.nonASCII = MoveMask(block[0], block[1], block[2], block[3]);
+}
+
+#elif defined(ARCH_CPU_NEON) && defined(ARCH_CPU_ARM64)
+
+//
+// NEON has no movemask: each byte keeps its own bit of a weight, and
+// pairwise additions pack the 64 bytes in 64 bits.
+//
+inline uint64
+MoveMask(uint8x16_t v0, uint8x16_t v1, uint8x16_t v2, uint8x16_t v3)
+{
+    static const uint8 weights[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x16_t bits = vld1q_u8(weights);
+    uint8x16_t sum0 = vpaddq_u8(vandq_u8(v0, bits), vandq_u8(v1, bits));
+    uint8x16_t sum1 = vpaddq_u8(vandq_u8(v2, bits), vandq_u8(v3, bits));
+    sum0 = vpaddq_u8(sum0, sum1);
+    sum0 = vpaddq_u8(sum0, sum0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+inline uint64
+Equal(const uint8x16_t* block, uint8x16_t c)
+{
+    return MoveMask(vceqq_u8(block[0], c), vceqq_u8(block[1], c), vceqq_u8(block[2], c), vceqq_u8(block[3], c));
+}
+
+void
+Classify(const Byte* p, Byte delimiter, BlockMasks& masks)
+{
+    uint8x16_t block[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        block[i] = vld1q_u8(p + 16 * i);
+    }
+    masks.doubleQuotes = Equal(block, vdupq_n_u8('"'));
+    masks.singleQuotes = Equal(block, vdupq_n_u8('\''));
+    masks.backslashes = Equal(block, vdupq_n_u8('\\'));
+    masks.delimiters = Equal(block, vdupq_n_u8(delimiter));
+    masks.newlines = Equal(block, vdupq_n_u8('\n'));
+    uint8x16_t top = vdupq_n_u8(0x80);
+    masks.nonASCII = MoveMask(vcgeq_u8(block[0], top), vcgeq_u8(block[1], top),
+                              vcgeq_u8(block[2], top), vcgeq_u8(block[3], top));
+}
+
+#else
+
+void
+Classify(const Byte* p, Byte delimiter, BlockMasks& masks)
+{
+    memset(&masks, 0, sizeof(masks));
+    for (size_t i = 0; i < blockSize; ++i)
+    {
+        Byte c = p[i];
+        masks.doubleQuotes |= static_cast<uint64>(c == '"') << i;
+        masks.singleQuotes |= static_cast<uint64>(c == '\'') << i;
+        masks.backslashes |= static_cast<uint64>(c == '\\') << i;
+        masks.delimiters |= static_cast<uint64>(c == delimiter) << i;
+        masks.newlines |= static_cast<uint64>(c == '\n') << i;
+        masks.nonASCII |= static_cast<uint64>(c >= 0x80) << i;
+    }
+}
+
+#endif
+
+enum QuoteState
+{
+    outsideQuotes,
+    inSingleQuotes,
+    inDoubleQuotes
+};
+
+//
+// The bits of the block at or after position start of the text, for the
+// block at offset.
+//
+inline uint64
+BitsFrom(size_t start, size_t offset)
+{
+    if (start <= offset)
+    {
+        return ~UTIL_UINT64(0);
+    }
+    if (start - offset >= blockSize)
+    {
+        return 0;
+    }
+    return ~UTIL_UINT64(0) << (start - offset);
+}
+
+//
+// The quoted bytes of a block, given the quotes that are not escaped and
+// the state at the start of the block, which is updated to the state at
+// the end. Quotes of the other kind are plain characters inside quotes,
+// so the prefix xor works when only one kind matters; otherwise the
+// quotes are followed one by one.
+//
+uint64
+QuotedMask(uint64 doubleQuotes, uint64 singleQuotes, QuoteState& state)
+{
+    if (singleQuotes == 0 && state != inSingleQuotes)
+    {
+        uint64 inside = Bits::PrefixXor64(doubleQuotes) ^ (state == inDoubleQuotes ? ~UTIL_UINT64(0) : 0);
+        state = (inside >> 63) != 0 ? inDoubleQuotes : outsideQuotes;
+        return inside;
+    }
+    if (doubleQuotes == 0 && state != inDoubleQuotes)
+    {
+        uint64 inside = Bits::PrefixXor64(singleQuotes) ^ (state == inSingleQuotes ? ~UTIL_UINT64(0) : 0);
+        state = (inside >> 63) != 0 ? inSingleQuotes : outsideQuotes;
+        return inside;
+    }
+
+    uint64 inside = 0;
+    uint64 quotes = doubleQuotes | singleQuotes;
+    int start = 0;
+    while (quotes != 0)
+    {
+        int i = Bits::CountTrailingZeros64(quotes);
+        uint64 bit = UTIL_UINT64(1) << i;
+        if (state == outsideQuotes)
+        {
+            state = (doubleQuotes & bit) != 0 ? inDoubleQuotes : inSingleQuotes;
+            start = i;
+        }
+        else if (((state == inDoubleQuotes ? doubleQuotes : singleQuotes) & bit) != 0)
+        {
+            inside |= (bit - 1) & (~UTIL_UINT64(0) << start);
+            state = outsideQuotes;
+        }
+        quotes &= quotes - 1;
+    }
+    if (state != outsideQuotes)
+    {
+        inside |= ~UTIL_UINT64(0) << start;
+    }
+    return inside;
+}
+
+//
+// Appends the field at [p, last) to out without its quotes and escapes,
+// like StringTokenizer.
+//
+void
+AppendUnquoted(const char* p, const char* last, string& out)
+{
+    while (p != last)
+    {
+        char c = *p;
+        if (c == '\\' && p + 1 != last && (p[1] == '\'' || p[1] == '"'))
+        {
+            out += p[1];
+            p += 2;
+        }
+        else if (c == '\'' || c == '"')
+        {
+            ++p;
+            while (p != last && *p != c)
+            {
+                if (*p == '\\' && p + 1 != last && p[1] == c)
+                {
+                    out += c;
+                    p += 2;
+                }
+                else
+                {
+                    out += *p++;
+                }
+            }
+            if (p != last)
+            {
+                ++p;
+            }
+        }
+        else
+        {
+            out += *p++;
+        }
+    }
+}
+
+//
+// The size of the UTF-8 sequence starting with lead, which
+// IsLegalUTF8Sequence rejects if lead cannot start one.
+//
+inline size_t
+SequenceLength(Byte lead)
+{
+    return lead < 0xC0 ? 1 : (lead < 0xE0 ? 2 : (lead < 0xF0 ? 3 : 4));
+}
+
+}
+
+Util::CsvBatch::CsvBatch() :
+    m_columnCount(0),
+    m_balanced(true),
+    m_validUTF8(true)
+{
+}
+
+void
+Util::CsvBatch::Clear()
+{
+    for (size_t i = 0; i < m_columnCount; ++i)
+    {
+        m_columns[i].clear();
+    }
+    m_columnCount = 0;
+    m_fieldCounts.clear();
+    m_buffer.clear();
+    m_copies.clear();
+    m_balanced = true;
+    m_validUTF8 = true;
+}
+
+void
+Util::CsvBatch::AddColumn()
+{
+    if (m_columnCount == m_columns.size())
+    {
+        m_columns.push_back(vector<StringPiece>());
+    }
+    m_columns[m_columnCount].assign(m_fieldCounts.size(), StringPiece());
+    ++m_columnCount;
+}
+
+void
+Util::CsvBatch::SetCopies(size_t first)
+{
+    const char* buffer = m_buffer.data();
+    for (size_t i = first; i < m_copies.size(); ++i)
+    {
+        const Copy& copy = m_copies[i];
+        m_columns[copy.column][copy.record] = StringPiece(buffer + copy.offset, copy.size);
+    }
+}
+
+Util::CsvParser::CsvParser(char delimiter, bool validateUTF8) :
+    m_delimiter(delimiter),
+    m_validateUTF8(validateUTF8)
+{
+    if (delimiter == '"' || delimiter == '\'' || delimiter == '\\' || delimiter == '\n')
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__,
+                                       "invalid CSV delimiter `" + string(1, delimiter) + "'");
+    }
+}
+
+void
+Util::CsvParser::AddRecord(const char* text, CsvBatch& batch)
+{
+    Span& lastField = m_fields.back();
+    if (lastField.last != lastField.first && text[lastField.last - 1] == '\r')
+    {
+        --lastField.last;
+    }
+    if (m_fields.size() == 1 && lastField.last == lastField.first)
+    {
+        m_fields.clear();
+        return;
+    }
+
+    size_t record = batch.m_fieldCounts.size();
+    for (size_t i = 0; i < m_fields.size(); ++i)
+    {
+        if (i == batch.m_columnCount)
+        {
+            batch.AddColumn();
+        }
+
+        const Span& field = m_fields[i];
+        if (field.quoted)
+        {
+            CsvBatch::Copy copy;
+            copy.column = i;
+            copy.record = record;
+            copy.offset = batch.m_buffer.size();
+            AppendUnquoted(text + field.first, text + field.last, batch.m_buffer);
+            copy.size = batch.m_buffer.size() - copy.offset;
+            batch.m_copies.push_back(copy);
+
+            //
+            // Set once the buffer no longer moves.
+            //
+            batch.m_columns[i].push_back(StringPiece());
+        }
+        else
+        {
+            batch.m_columns[i].push_back(StringPiece(text + field.first, field.last - field.first));
+        }
+    }
+    for (size_t i = m_fields.size(); i < batch.m_columnCount; ++i)
+    {
+        batch.m_columns[i].push_back(StringPiece());
+    }
+    batch.m_fieldCounts.push_back(m_fields.size());
+    m_fields.clear();
+}
+
+size_t
+Util::CsvParser::Parse(const void* data, size_t size, CsvBatch& batch, bool last)
+{
+    const Byte* bytes = static_cast<const Byte*>(data);
+    const char* text = static_cast<const char*>(data);
+    const char* oldBuffer = batch.m_buffer.data();
+    size_t oldCopies = batch.m_copies.size();
+    m_fields.clear();
+
+    QuoteState state = outsideQuotes;
+    uint64 backslashCarry = 0;
+    size_t recordStart = 0;
+    Span field;
+    field.first = 0;
+    field.quoted = false;
+
+    //
+    // The bytes before checked are valid UTF-8, the first invalid
+    // sequence found starts at invalid.
+    //
+    size_t checked = 0;
+    size_t invalid = size;
+
+    Byte tail[blockSize];
+    for (size_t offset = 0; offset < size; offset += blockSize)
+    {
+        const Byte* block = bytes + offset;
+        if (size - offset < blockSize)
+        {
+            memset(tail, 0, blockSize);
+            memcpy(tail, block, size - offset);
+            block = tail;
+        }
+
+        BlockMasks masks;
+        Classify(block, static_cast<Byte>(m_delimiter), masks);
+
+        //
+        // A backslash before a quote escapes it, backslashes never escape
+        // each other.
+        //
+        uint64 quotes = masks.doubleQuotes | masks.singleQuotes;
+        uint64 escaped = quotes & ((masks.backslashes << 1) | backslashCarry);
+        backslashCarry = masks.backslashes >> 63;
+        uint64 inside = QuotedMask(masks.doubleQuotes & ~escaped, masks.singleQuotes & ~escaped, state);
+
+        uint64 ends = (masks.delimiters | masks.newlines) & ~inside;
+        while (ends != 0)
+        {
+            int i = Bits::CountTrailingZeros64(ends);
+            field.last = offset + i;
+            field.quoted = field.quoted || (quotes & BitsFrom(field.first, offset) & ((UTIL_UINT64(1) << i) - 1)) != 0;
+            m_fields.push_back(field);
+            if ((masks.newlines >> i) & 1)
+            {
+                AddRecord(text, batch);
+                recordStart = field.last + 1;
+            }
+            field.first = field.last + 1;
+            field.quoted = false;
+            ends &= ends - 1;
+        }
+        field.quoted = field.quoted || (quotes & BitsFrom(field.first, offset)) != 0;
+
+        if (m_validateUTF8 && invalid == size)
+        {
+            uint64 nonASCII = masks.nonASCII & BitsFrom(checked, offset);
+            while (nonASCII != 0)
+            {
+                size_t position = offset + Bits::CountTrailingZeros64(nonASCII);
+                size_t length = SequenceLength(bytes[position]);
+                if (length > size - position || !IsLegalUTF8Sequence(bytes + position, bytes + position + length))
+                {
+                    invalid = position;
+                    break;
+                }
+                checked = position + length;
+                nonASCII &= BitsFrom(checked, offset);
+            }
+        }
+    }
+
+    if (last && recordStart != size)
+    {
+        field.last = size;
+        m_fields.push_back(field);
+        AddRecord(text, batch);
+        recordStart = size;
+        if (state != outsideQuotes)
+        {
+            batch.m_balanced = false;
+        }
+    }
+    m_fields.clear();
+
+    if (invalid < recordStart)
+    {
+        batch.m_validUTF8 = false;
+    }
+    batch.SetCopies(batch.m_buffer.data() == oldBuffer ? oldCopies : 0);
+    return recordStart;
+}
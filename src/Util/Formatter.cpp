@@ -0,0 +1,420 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/Formatter.h>
+
+#if defined(LANG_CPP11) && (!defined(_MSC_VER) || _MSC_VER >= 1800)
+
+#include <Util/NumberConversion.h>
+#include <Util/Exception.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const int maxSpecNumber = 1000000;
+
+//
+// Writes value in base 2^shift and returns the number of digits.
+//
+size_t
+WritePowerOfTwoBase(uint64 value, int shift, bool upper, char* buffer)
+{
+    const char* digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    const unsigned mask = (1u << shift) - 1;
+    char reversed[64];
+    size_t size = 0;
+    do
+    {
+        reversed[size++] = digits[value & mask];
+        value >>= shift;
+    }
+    while (value != 0);
+    reverse_copy(reversed, reversed + size, buffer);
+    return size;
+}
+
+bool
+ParseNumber(const char*& p, int& number)
+{
+    if (*p < '0' || *p > '9')
+    {
+        return false;
+    }
+    number = 0;
+    for (; *p >= '0' && *p <= '9'; ++p)
+    {
+        number = number * 10 + (*p - '0');
+        if (number >= maxSpecNumber)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+}
+
+bool
+Util::Formatter::ParseSpec(const char*& p, Spec& spec)
+{
+    spec.left = false;
+    spec.zero = false;
+    spec.width = 0;
+    spec.precision = -1;
+    spec.type = 0;
+
+    if (*p == ':')
+    {
+        ++p;
+        if (*p == '-')
+        {
+            spec.left = true;
+            ++p;
+        }
+        if (*p == '0')
+        {
+            spec.zero = true;
+            ++p;
+        }
+        if (*p >= '1' && *p <= '9' && !ParseNumber(p, spec.width))
+        {
+            return false;
+        }
+        if (*p == '.')
+        {
+            ++p;
+            if (!ParseNumber(p, spec.precision))
+            {
+                return false;
+            }
+        }
+        if (*p != 0 && strchr("xXobf", *p) != 0)
+        {
+            spec.type = *p++;
+        }
+    }
+
+    if (*p != '}')
+    {
+        return false;
+    }
+    ++p;
+    return true;
+}
+
+bool
+Util::Formatter::TypeFits(const Spec& spec, const FormatArgument& argument)
+{
+    switch (spec.type)
+    {
+        case 'x':
+        case 'X':
+        case 'o':
+        case 'b':
+        {
+            return argument.m_kind == FormatArgument::intArgument ||
+                   argument.m_kind == FormatArgument::unsignedArgument;
+        }
+
+        case 'f':
+        {
+            return argument.m_kind == FormatArgument::doubleArgument;
+        }
+
+        default:
+        {
+            return true;
+        }
+    }
+}
+
+void
+Util::Formatter::AppendArgument(string& out, const Spec& spec, const FormatArgument& argument)
+{
+    size_t start = out.size();
+
+    //
+    // The sign or base prefix zeros are inserted after.
+    //
+    size_t prefix = 0;
+    bool number = true;
+
+    char buffer[72];
+    size_t size = 0;
+    switch (argument.m_kind)
+    {
+        case FormatArgument::boolArgument:
+        {
+            out.append(argument.m_value.integer != 0 ? "true" : "false");
+            number = false;
+            break;
+        }
+
+        case FormatArgument::charArgument:
+        {
+            out += static_cast<char>(argument.m_value.integer);
+            number = false;
+            break;
+        }
+
+        case FormatArgument::intArgument:
+        case FormatArgument::unsignedArgument:
+        {
+            uint64 value = argument.m_value.unsignedInteger;
+            if (argument.m_kind == FormatArgument::intArgument && argument.m_value.integer < 0)
+            {
+                buffer[size++] = '-';
+                prefix = 1;
+                value = UTIL_UINT64(0) - value;
+            }
+            switch (spec.type)
+            {
+                case 'x':
+                case 'X':
+                {
+                    size += WritePowerOfTwoBase(value, 4, spec.type == 'X', buffer + size);
+                    break;
+                }
+
+                case 'o':
+                {
+                    size += WritePowerOfTwoBase(value, 3, false, buffer + size);
+                    break;
+                }
+
+                case 'b':
+                {
+                    size += WritePowerOfTwoBase(value, 1, false, buffer + size);
+                    break;
+                }
+
+                default:
+                {
+                    size += FormatUInt64(value, buffer + size);
+                    break;
+                }
+            }
+            out.append(buffer, size);
+            break;
+        }
+
+        case FormatArgument::doubleArgument:
+        {
+            double value = argument.m_value.real;
+            if (spec.type == 'f' || spec.precision >= 0)
+            {
+                int precision = spec.precision >= 0 ? spec.precision : 6;
+                out.resize(start + maxFixedDoubleSize + precision);
+                out.resize(start + FormatDoubleFixed(value, precision, &out[start]));
+            }
+            else
+            {
+                out.append(buffer, FormatDouble(value, buffer));
+            }
+            prefix = out[start] == '-' ? 1 : 0;
+            number = value == value && value - value == 0;
+            break;
+        }
+
+        case FormatArgument::stringArgument:
+        {
+            size = argument.m_value.text.size;
+            if (spec.precision >= 0)
+            {
+                size = min(size, static_cast<size_t>(spec.precision));
+            }
+            out.append(argument.m_value.text.data, size);
+            number = false;
+            break;
+        }
+
+        case FormatArgument::pointerArgument:
+        {
+            buffer[0] = '0';
+            buffer[1] = 'x';
+            size = 2 + WritePowerOfTwoBase(reinterpret_cast<size_t>(argument.m_value.pointer), 4, false,
+                                           buffer + 2);
+            out.append(buffer, size);
+            prefix = 2;
+            break;
+        }
+
+        default:
+        {
+            assert(false);
+            break;
+        }
+    }
+
+    size = out.size() - start;
+    if (static_cast<size_t>(spec.width) > size)
+    {
+        size_t padding = spec.width - size;
+        if (spec.left)
+        {
+            out.append(padding, ' ');
+        }
+        else if (spec.zero && number)
+        {
+            out.insert(start + prefix, padding, '0');
+        }
+        else
+        {
+            out.insert(start, padding, ' ');
+        }
+    }
+}
+
+void
+Util::Formatter::Append(string& out, const char* format, const FormatArgument* arguments, size_t count)
+{
+    //
+    // The format is only checked as it is written, so take back what was
+    // written before an error.
+    //
+    size_t start = out.size();
+    try
+    {
+        AppendUnchecked(out, format, arguments, count);
+    }
+    catch (...)
+    {
+        out.resize(start);
+        throw;
+    }
+}
+
+void
+Util::Formatter::AppendUnchecked(string& out, const char* format, const FormatArgument* arguments, size_t count)
+{
+    const char* p = format;
+    size_t next = 0;
+    for (;;)
+    {
+        const char* literal = p;
+        while (*p != 0 && *p != '{' && *p != '}')
+        {
+            ++p;
+        }
+        out.append(literal, p);
+        if (*p == 0)
+        {
+            if (next != count)
+            {
+                throw IllegalArgumentException(__FILE__, __LINE__,
+                                               "too many arguments for format `" + string(format) + "'");
+            }
+            return;
+        }
+
+        if (p[1] == p[0])
+        {
+            out += *p;
+            p += 2;
+            continue;
+        }
+        if (*p == '}')
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "unmatched `}' in format `" + string(format) + "'");
+        }
+
+        ++p;
+        Spec spec;
+        if (!ParseSpec(p, spec))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "invalid `{' in format `" + string(format) + "'");
+        }
+        if (next == count)
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "too few arguments for format `" + string(format) + "'");
+        }
+        if (!TypeFits(spec, arguments[next]))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__,
+                                           "type that does not fit its argument in format `" + string(format) + "'");
+        }
+        AppendArgument(out, spec, arguments[next++]);
+    }
+}
+
+void
+Util::Formatter::Append(string& out, const FormatPattern& pattern, const FormatArgument* arguments, size_t count)
+{
+    if (count < pattern.m_elements.size())
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__,
+                                       "too few arguments for format `" + pattern.m_pattern + "'");
+    }
+    if (count > pattern.m_elements.size())
+    {
+        throw IllegalArgumentException(__FILE__, __LINE__,
+                                       "too many arguments for format `" + pattern.m_pattern + "'");
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!TypeFits(pattern.m_elements[i].spec, arguments[i]))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__,
+                                           "type that does not fit its argument in format `" + pattern.m_pattern + "'");
+        }
+    }
+
+    const char* literals = pattern.m_literals.data();
+    for (size_t i = 0; i < pattern.m_elements.size(); ++i)
+    {
+        const FormatPattern::Element& element = pattern.m_elements[i];
+        out.append(literals + element.offset, element.size);
+        AppendArgument(out, element.spec, arguments[i]);
+    }
+    out.append(literals + pattern.m_tail, pattern.m_literals.size() - pattern.m_tail);
+}
+
+Util::FormatPattern::FormatPattern(const string& format) :
+    m_pattern(format),
+    m_tail(0)
+{
+    const char* p = m_pattern.c_str();
+    const char* last = p + m_pattern.size();
+    while (p != last)
+    {
+        if (*p != '{' && *p != '}')
+        {
+            m_literals += *p++;
+            continue;
+        }
+
+        if (p[1] == p[0])
+        {
+            m_literals += *p;
+            p += 2;
+            continue;
+        }
+        if (*p == '}')
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "unmatched `}' in format `" + m_pattern + "'");
+        }
+
+        ++p;
+        Element element;
+        element.offset = m_tail;
+        element.size = m_literals.size() - m_tail;
+        if (!Formatter::ParseSpec(p, element.spec))
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "invalid `{' in format `" + m_pattern + "'");
+        }
+        m_elements.push_back(element);
+        m_tail = m_literals.size();
+    }
+}
+
+#endif
@@ -0,0 +1,553 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/Glob.h>
+#include <Util/StringSearch.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+//
+// Reads the class of the [ before p into bits (256 bits). Returns the
+// position after its ], or 0 if there is none.
+//
+const char*
+ParseClass(const char* p, const char* last, uint32* bits)
+{
+    fill(bits, bits + 8, 0);
+    bool negate = p != last && (*p == '!' || *p == '^');
+    if (negate)
+    {
+        ++p;
+    }
+
+    const char* start = p;
+    while (p != last && (*p != ']' || p == start))
+    {
+        Byte low = static_cast<Byte>(*p);
+        Byte high = low;
+        if (last - p >= 3 && p[1] == '-' && p[2] != ']')
+        {
+            high = static_cast<Byte>(p[2]);
+            p += 3;
+        }
+        else
+        {
+            ++p;
+        }
+        for (unsigned int b = low; b <= high; ++b)
+        {
+            bits[b >> 5] |= 1u << (b & 31);
+        }
+    }
+    if (p == last)
+    {
+        return 0;
+    }
+
+    if (negate)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            bits[i] = ~bits[i];
+        }
+    }
+    return p + 1;
+}
+
+inline bool
+InClass(const uint32* bits, Byte b)
+{
+    return (bits[b >> 5] >> (b & 31)) & 1;
+}
+
+//
+// Matches the byte b against the element (not a star) of the pattern at p
+// and sets next to the element after it.
+//
+bool
+MatchElement(const char* p, const char* last, Byte b, const char*& next)
+{
+    switch (*p)
+    {
+        case '?':
+        {
+            next = p + 1;
+            return true;
+        }
+        case '[':
+        {
+            uint32 bits[8];
+            const char* end = ParseClass(p + 1, last, bits);
+            if (end != 0)
+            {
+                next = end;
+                return InClass(bits, b);
+            }
+            break;
+        }
+        case '\\':
+        {
+            if (p + 1 != last)
+            {
+                next = p + 2;
+                return static_cast<Byte>(p[1]) == b;
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+    }
+    next = p + 1;
+    return static_cast<Byte>(*p) == b;
+}
+
+}
+
+bool
+Util::MatchGlob(const char* first, const char* last, const char* patternFirst, const char* patternLast, bool emptyStar)
+{
+    //
+    // On a mismatch the last star takes one more byte and matching starts
+    // again after it: earlier stars never need to take more.
+    //
+    const char* t = first;
+    const char* p = patternFirst;
+    const char* starPattern = 0;
+    const char* starText = 0;
+    for (;;)
+    {
+        if (p != patternLast && *p == '*')
+        {
+            //
+            // A run of stars is one star, preceded by a byte per star if
+            // they cannot be empty.
+            //
+            size_t skip = 0;
+            while (p != patternLast && *p == '*')
+            {
+                ++p;
+                ++skip;
+            }
+            if (emptyStar)
+            {
+                skip = 0;
+            }
+            if (static_cast<size_t>(last - t) >= skip)
+            {
+                t += skip;
+                starPattern = p;
+                starText = t;
+                continue;
+            }
+        }
+        else if (t == last)
+        {
+            if (p == patternLast)
+            {
+                return true;
+            }
+        }
+        else if (p != patternLast)
+        {
+            const char* next;
+            if (MatchElement(p, patternLast, static_cast<Byte>(*t), next))
+            {
+                p = next;
+                ++t;
+                continue;
+            }
+        }
+
+        if (starPattern == 0 || starText == last)
+        {
+            return false;
+        }
+        t = ++starText;
+        p = starPattern;
+    }
+}
+
+bool
+Util::MatchGlob(const string& s, const string& pattern, bool emptyStar)
+{
+    return MatchGlob(s.data(), s.data() + s.size(), pattern.data(), pattern.data() + pattern.size(), emptyStar);
+}
+
+Util::GlobPattern::GlobPattern(const string& pattern, bool emptyStar) :
+    m_pattern(pattern),
+    m_star(false),
+    m_minSize(0)
+{
+    Segment segment = { 0, 0, 0 };
+    m_segments.push_back(segment);
+
+    const char* p = pattern.data();
+    const char* last = p + pattern.size();
+    while (p != last)
+    {
+        Element element = { anyElement, 0, 1 };
+        if (*p == '*')
+        {
+            uint32 stars = 0;
+            while (p != last && *p == '*')
+            {
+                ++p;
+                ++stars;
+            }
+            if (!emptyStar)
+            {
+                element.size = stars;
+                m_elements.push_back(element);
+                ++m_segments.back().count;
+                m_segments.back().size += stars;
+            }
+            m_star = true;
+            segment.first = static_cast<uint32>(m_elements.size());
+            m_segments.push_back(segment);
+            continue;
+        }
+
+        if (*p == '?')
+        {
+            ++p;
+        }
+        else
+        {
+            uint32 bits[8];
+            const char* end = *p == '[' ? ParseClass(p + 1, last, bits) : 0;
+            if (end != 0)
+            {
+                element.kind = classElement;
+                element.offset = static_cast<uint32>(m_classes.size());
+                m_classes.insert(m_classes.end(), bits, bits + 8);
+                p = end;
+            }
+            else
+            {
+                if (*p == '\\' && p + 1 != last)
+                {
+                    ++p;
+                }
+                element.kind = literalElement;
+                element.offset = static_cast<uint32>(m_literals.size());
+                m_literals += *p++;
+            }
+        }
+
+        ++m_segments.back().size;
+        if (element.kind == literalElement && m_segments.back().count != 0 &&
+           m_elements.back().kind == literalElement)
+        {
+            ++m_elements.back().size;
+            continue;
+        }
+        m_elements.push_back(element);
+        ++m_segments.back().count;
+    }
+
+    for (vector<Segment>::const_iterator q = m_segments.begin(); q != m_segments.end(); ++q)
+    {
+        m_minSize += q->size;
+    }
+
+    const Segment& head = m_segments.front();
+    if (head.count != 0 && m_elements[head.first].kind == literalElement)
+    {
+        m_prefix = m_literals.substr(m_elements[head.first].offset, m_elements[head.first].size);
+    }
+    const Segment& tail = m_segments.back();
+    if (tail.count != 0 && m_elements[tail.first + tail.count - 1].kind == literalElement)
+    {
+        const Element& element = m_elements[tail.first + tail.count - 1];
+        m_suffix = m_literals.substr(element.offset, element.size);
+    }
+}
+
+bool
+Util::GlobPattern::MatchSegment(const Segment& segment, const Byte* p) const
+{
+    const Element* element = segment.count == 0 ? 0 : &m_elements[segment.first];
+    for (uint32 i = 0; i < segment.count; ++i, ++element)
+    {
+        switch (element->kind)
+        {
+            case literalElement:
+            {
+                if (memcmp(p, m_literals.data() + element->offset, element->size) != 0)
+                {
+                    return false;
+                }
+                break;
+            }
+            case classElement:
+            {
+                if (!InClass(&m_classes[element->offset], *p))
+                {
+                    return false;
+                }
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+        p += element->size;
+    }
+    return true;
+}
+
+const Byte*
+Util::GlobPattern::FindSegment(const Segment& segment, const Byte* first, const Byte* last) const
+{
+    if (static_cast<size_t>(last - first) < segment.size)
+    {
+        return 0;
+    }
+    const Byte* lastStart = last - segment.size;
+
+    const Element& head = m_elements[segment.first];
+    if (head.kind != literalElement)
+    {
+        for (const Byte* p = first; p <= lastStart; ++p)
+        {
+            if (MatchSegment(segment, p))
+            {
+                return p;
+            }
+        }
+        return 0;
+    }
+
+    const char* literal = m_literals.data() + head.offset;
+    for (const Byte* p = first; p <= lastStart; ++p)
+    {
+        p = FindBytes(p, static_cast<size_t>(lastStart - p) + head.size, literal, head.size);
+        if (p == 0)
+        {
+            return 0;
+        }
+        if (MatchSegment(segment, p))
+        {
+            return p;
+        }
+    }
+    return 0;
+}
+
+bool
+Util::GlobPattern::Match(const char* first, const char* last) const
+{
+    size_t size = static_cast<size_t>(last - first);
+    const Byte* p = reinterpret_cast<const Byte*>(first);
+    if (!m_star)
+    {
+        return size == m_minSize && MatchSegment(m_segments[0], p);
+    }
+    if (size < m_minSize)
+    {
+        return false;
+    }
+
+    const Segment& head = m_segments.front();
+    const Segment& tail = m_segments.back();
+    const Byte* end = reinterpret_cast<const Byte*>(last) - tail.size;
+    if (!MatchSegment(head, p) || !MatchSegment(tail, end))
+    {
+        return false;
+    }
+
+    p += head.size;
+    for (size_t i = 1; i + 1 < m_segments.size(); ++i)
+    {
+        p = FindSegment(m_segments[i], p, end);
+        if (p == 0)
+        {
+            return false;
+        }
+        p += m_segments[i].size;
+    }
+    return true;
+}
+
+bool
+Util::GlobPattern::Match(const string& s) const
+{
+    return Match(s.data(), s.data() + s.size());
+}
+
+bool
+Util::GlobSet::Entry::operator<(const Entry& rhs) const
+{
+    if (key.size() != rhs.key.size())
+    {
+        return key.size() < rhs.key.size();
+    }
+    int result = key.compare(rhs.key);
+    return result != 0 ? result < 0 : pattern < rhs.pattern;
+}
+
+namespace
+{
+
+//
+// Compares the keys of a size with the bytes of the string at the same
+// place.
+//
+template<class Entry>
+struct KeyLess
+{
+    bool operator()(const Entry& entry, const char* p) const
+    {
+        return memcmp(entry.key.data(), p, entry.key.size()) < 0;
+    }
+
+    bool operator()(const char* p, const Entry& entry) const
+    {
+        return memcmp(p, entry.key.data(), entry.key.size()) < 0;
+    }
+};
+
+}
+
+void
+Util::GlobSet::Index::Insert(const string& key, size_t pattern)
+{
+    Entry entry;
+    entry.key = key;
+    entry.pattern = pattern;
+    entries.insert(upper_bound(entries.begin(), entries.end(), entry), entry);
+
+    sizes.clear();
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        if (sizes.empty() || sizes.back().size != entries[i].key.size())
+        {
+            KeySize range = { entries[i].key.size(), i, i };
+            sizes.push_back(range);
+        }
+        sizes.back().last = i + 1;
+    }
+}
+
+Util::GlobSet::GlobSet()
+{
+}
+
+size_t
+Util::GlobSet::Add(const string& pattern, bool emptyStar)
+{
+    size_t index = m_patterns.size();
+    m_patterns.push_back(GlobPattern(pattern, emptyStar));
+    const GlobPattern& glob = m_patterns.back();
+    if (!glob.Prefix().empty())
+    {
+        m_prefixes.Insert(glob.Prefix(), index);
+    }
+    else if (!glob.Suffix().empty())
+    {
+        m_suffixes.Insert(glob.Suffix(), index);
+    }
+    else
+    {
+        m_unindexed.push_back(index);
+    }
+    return index;
+}
+
+size_t
+Util::GlobSet::Search(const char* first, const char* last, vector<size_t>* matches) const
+{
+    size_t size = static_cast<size_t>(last - first);
+    size_t best = string::npos;
+    size_t count = 0;
+
+    for (int side = 0; side < 2; ++side)
+    {
+        const Index& index = side == 0 ? m_prefixes : m_suffixes;
+        for (vector<KeySize>::const_iterator p = index.sizes.begin(); p != index.sizes.end() && p->size <= size; ++p)
+        {
+            const char* key = side == 0 ? first : last - p->size;
+            pair<vector<Entry>::const_iterator, vector<Entry>::const_iterator> range =
+                equal_range(index.entries.begin() + p->first, index.entries.begin() + p->last, key, KeyLess<Entry>());
+
+            //
+            // The patterns of a key are in increasing order.
+            //
+            for (vector<Entry>::const_iterator q = range.first; q != range.second; ++q)
+            {
+                if (matches == 0 && q->pattern >= best)
+                {
+                    break;
+                }
+                if (m_patterns[q->pattern].Match(first, last))
+                {
+                    ++count;
+                    if (matches == 0)
+                    {
+                        best = q->pattern;
+                        break;
+                    }
+                    matches->push_back(q->pattern);
+                }
+            }
+        }
+    }
+
+    for (vector<size_t>::const_iterator p = m_unindexed.begin(); p != m_unindexed.end(); ++p)
+    {
+        if (matches == 0 && *p >= best)
+        {
+            break;
+        }
+        if (m_patterns[*p].Match(first, last))
+        {
+            ++count;
+            if (matches == 0)
+            {
+                best = *p;
+                break;
+            }
+            matches->push_back(*p);
+        }
+    }
+    return matches == 0 ? best : count;
+}
+
+size_t
+Util::GlobSet::Find(const char* first, const char* last) const
+{
+    return Search(first, last, 0);
+}
+
+size_t
+Util::GlobSet::Find(const string& s) const
+{
+    return Find(s.data(), s.data() + s.size());
+}
+
+bool
+Util::GlobSet::FindAll(const string& s, vector<size_t>& matches) const
+{
+    size_t first = matches.size();
+    if (Search(s.data(), s.data() + s.size(), &matches) == 0)
+    {
+        return false;
+    }
+    sort(matches.begin() + first, matches.end());
+    return true;
+}
@@ -0,0 +1,454 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/Hash.h>
+#include <Util/Bits.h>
+
+#include <cstring>
+
+#if defined(ARCH_CPU_LITTLE_ENDIAN)
+#   if defined(ARCH_CPU_AVX2)
+#       include <immintrin.h>
+#   elif defined(ARCH_CPU_SSE2)
+#       include <emmintrin.h>
+#   elif defined(ARCH_CPU_NEON)
+#       include <arm_neon.h>
+#   endif
+#endif
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const uint32 prime32 = 0x9E3779B1u;
+const uint64 prime64 = UTIL_UINT64(0x9E3779B185EBCA87);
+
+//
+// The secrets of the short hash.
+//
+const uint64 mixSecret[4] =
+{
+    UTIL_UINT64(0xA0761D6478BD642F),
+    UTIL_UINT64(0xE7037ED1A0B428DB),
+    UTIL_UINT64(0x8EBC6AF09C88C6E3),
+    UTIL_UINT64(0x589965CC75374CC3)
+};
+
+const uint64 initialAccumulators[8] =
+{
+    UTIL_UINT64(0x00000000C2B2AE3D),
+    UTIL_UINT64(0x9E3779B185EBCA87),
+    UTIL_UINT64(0xC2B2AE3D27D4EB4F),
+    UTIL_UINT64(0x165667B19E3779F9),
+    UTIL_UINT64(0x85EBCA77C2B2AE63),
+    UTIL_UINT64(0x0000000085EBCA77),
+    UTIL_UINT64(0x27D4EB2F165667C5),
+    UTIL_UINT64(0x000000009E3779B1)
+};
+
+//
+// The secret of the long hash for seed 0: SplitMix64 from 0. Stripe s of
+// a block is keyed with words s to s + 7, so that equal stripes at
+// different places do not cancel out.
+//
+const uint64 defaultSecret[Hasher::secretSize] =
+{
+    UTIL_UINT64(0xE220A8397B1DCDAF),
+    UTIL_UINT64(0x6E789E6AA1B965F4),
+    UTIL_UINT64(0x06C45D188009454F),
+    UTIL_UINT64(0xF88BB8A8724C81EC),
+    UTIL_UINT64(0x1B39896A51A8749B),
+    UTIL_UINT64(0x53CB9F0C747EA2EA),
+    UTIL_UINT64(0x2C829ABE1F4532E1),
+    UTIL_UINT64(0xC584133AC916AB3C),
+    UTIL_UINT64(0x3EE5789041C98AC3),
+    UTIL_UINT64(0xF3B8488C368CB0A6),
+    UTIL_UINT64(0x657EECDD3CB13D09),
+    UTIL_UINT64(0xC2D326E0055BDEF6),
+    UTIL_UINT64(0x8621A03FE0BBDB7B),
+    UTIL_UINT64(0x8E1F7555983AA92F),
+    UTIL_UINT64(0xB54E0F1600CC4D19),
+    UTIL_UINT64(0x84BB3F97971D80AB),
+    UTIL_UINT64(0x7D29825C75521255),
+    UTIL_UINT64(0xC3CF17102B7F7F86),
+    UTIL_UINT64(0x3466E9A083914F64),
+    UTIL_UINT64(0xD81A8D2B5A4485AC),
+    UTIL_UINT64(0xDB01602B100B9ED7),
+    UTIL_UINT64(0xA9038A921825F10D),
+    UTIL_UINT64(0xEDF5F1D90DCA2F6A),
+    UTIL_UINT64(0x54496AD67BD2634C)
+};
+
+const size_t stripesPerBlock = 16;
+const size_t lastStripeKey = 9;
+const size_t scrambleKey = 16;
+const size_t mergeKey = 11;
+
+inline uint64
+Read64(const Byte* p)
+{
+    uint64 value;
+    memcpy(&value, p, sizeof(value));
+#if !defined(ARCH_CPU_LITTLE_ENDIAN)
+    value = (value >> 56) | ((value >> 40) & UTIL_UINT64(0xFF00)) | ((value >> 24) & UTIL_UINT64(0xFF0000)) |
+            ((value >> 8) & UTIL_UINT64(0xFF000000)) | ((value & UTIL_UINT64(0xFF000000)) << 8) |
+            ((value & UTIL_UINT64(0xFF0000)) << 24) | ((value & UTIL_UINT64(0xFF00)) << 40) | (value << 56);
+#endif
+    return value;
+}
+
+inline uint64
+Read32(const Byte* p)
+{
+    return static_cast<uint64>(p[0]) | static_cast<uint64>(p[1]) << 8 | static_cast<uint64>(p[2]) << 16 |
+           static_cast<uint64>(p[3]) << 24;
+}
+
+//
+// The two halves of the 128-bit product, folded.
+//
+inline uint64
+Mix(uint64 a, uint64 b)
+{
+    uint64 high;
+    uint64 low = Bits::Multiply128(a, b, high);
+    return low ^ high;
+}
+
+//
+// wyhash, for up to Hasher::bufferSize bytes.
+//
+uint64
+HashShort(const Byte* p, size_t size, uint64 seed)
+{
+    seed ^= Mix(seed ^ mixSecret[0], mixSecret[1]);
+    uint64 a;
+    uint64 b;
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            size_t middle = (size >> 3) << 2;
+            a = Read32(p) << 32 | Read32(p + middle);
+            b = Read32(p + size - 4) << 32 | Read32(p + size - 4 - middle);
+        }
+        else if (size > 0)
+        {
+            a = static_cast<uint64>(p[0]) << 16 | static_cast<uint64>(p[size >> 1]) << 8 | p[size - 1];
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        size_t i = size;
+        if (i >= 48)
+        {
+            uint64 seed1 = seed;
+            uint64 seed2 = seed;
+            do
+            {
+                seed = Mix(Read64(p) ^ mixSecret[1], Read64(p + 8) ^ seed);
+                seed1 = Mix(Read64(p + 16) ^ mixSecret[2], Read64(p + 24) ^ seed1);
+                seed2 = Mix(Read64(p + 32) ^ mixSecret[3], Read64(p + 40) ^ seed2);
+                p += 48;
+                i -= 48;
+            }
+            while (i >= 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (i > 16)
+        {
+            seed = Mix(Read64(p) ^ mixSecret[1], Read64(p + 8) ^ seed);
+            p += 16;
+            i -= 16;
+        }
+
+        //
+        // The last 16 bytes, which may have been mixed already.
+        //
+        a = Read64(p + i - 16);
+        b = Read64(p + i - 8);
+    }
+
+    uint64 high;
+    a = Bits::Multiply128(a ^ mixSecret[1], b ^ seed, high);
+    return Mix(a ^ mixSecret[0] ^ size, high ^ mixSecret[1]);
+}
+
+void
+InitSecret(uint64 seed, uint64* secret)
+{
+    for (size_t i = 0; i < Hasher::secretSize; i += 2)
+    {
+        secret[i] = defaultSecret[i] + seed;
+        secret[i + 1] = defaultSecret[i + 1] - seed;
+    }
+}
+
+//
+// Adds count stripes at p to the accumulators, each accumulator i with
+// the product of the two halves of the word i of the stripe xor its key,
+// and its neighbour i ^ 1 with the word itself. The accumulators are
+// scrambled every stripesPerBlock stripes, stripes counts the stripes of
+// the current block.
+//
+void
+Accumulate(uint64* accumulators, size_t& stripes, const Byte* p, size_t count, const uint64* keys,
+           const uint64* scrambleKeys)
+{
+#if defined(ARCH_CPU_LITTLE_ENDIAN) && defined(ARCH_CPU_AVX2)
+    __m256i acc[2];
+    for (size_t j = 0; j < 2; ++j)
+    {
+        acc[j] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(accumulators + 4 * j));
+    }
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(prime32));
+    for (size_t s = 0; s < count; ++s, p += Hasher::stripeSize)
+    {
+        for (size_t j = 0; j < 2; ++j)
+        {
+            __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 32 * j));
+            __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + stripes + 4 * j));
+            __m256i keyed = _mm256_xor_si256(data, key);
+            __m256i product = _mm256_mul_epu32(keyed, _mm256_srli_epi64(keyed, 32));
+            __m256i swapped = _mm256_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            acc[j] = _mm256_add_epi64(acc[j], _mm256_add_epi64(product, swapped));
+        }
+        if (++stripes == stripesPerBlock)
+        {
+            for (size_t j = 0; j < 2; ++j)
+            {
+                __m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(scrambleKeys + 4 * j));
+                __m256i a = _mm256_xor_si256(_mm256_xor_si256(acc[j], _mm256_srli_epi64(acc[j], 47)), key);
+                __m256i low = _mm256_mul_epu32(a, prime);
+                __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), prime);
+                acc[j] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+            }
+            stripes = 0;
+        }
+    }
+    for (size_t j = 0; j < 2; ++j)
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(accumulators + 4 * j), acc[j]);
+    }
+#elif defined(ARCH_CPU_LITTLE_ENDIAN) && defined(ARCH_CPU_SSE2)
+    __m128i acc[4];
+    for (size_t j = 0; j < 4; ++j)
+    {
+        acc[j] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(accumulators + 2 * j));
+    }
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(prime32));
+    for (size_t s = 0; s < count; ++s, p += Hasher::stripeSize)
+    {
+        for (size_t j = 0; j < 4; ++j)
+        {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * j));
+            __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + stripes + 2 * j));
+            __m128i keyed = _mm_xor_si128(data, key);
+            __m128i product = _mm_mul_epu32(keyed, _mm_srli_epi64(keyed, 32));
+            __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            acc[j] = _mm_add_epi64(acc[j], _mm_add_epi64(product, swapped));
+        }
+        if (++stripes == stripesPerBlock)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(scrambleKeys + 2 * j));
+                __m128i a = _mm_xor_si128(_mm_xor_si128(acc[j], _mm_srli_epi64(acc[j], 47)), key);
+                __m128i low = _mm_mul_epu32(a, prime);
+                __m128i high = _mm_mul_epu32(_mm_srli_epi64(a, 32), prime);
+                acc[j] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+            }
+            stripes = 0;
+        }
+    }
+    for (size_t j = 0; j < 4; ++j)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(accumulators + 2 * j), acc[j]);
+    }
+#elif defined(ARCH_CPU_LITTLE_ENDIAN) && defined(ARCH_CPU_NEON)
+    uint64x2_t acc[4];
+    for (size_t j = 0; j < 4; ++j)
+    {
+        acc[j] = vld1q_u64(accumulators + 2 * j);
+    }
+    const uint32x2_t prime = vdup_n_u32(prime32);
+    for (size_t s = 0; s < count; ++s, p += Hasher::stripeSize)
+    {
+        for (size_t j = 0; j < 4; ++j)
+        {
+            uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(p + 16 * j));
+            uint64x2_t keyed = veorq_u64(data, vld1q_u64(keys + stripes + 2 * j));
+            acc[j] = vmlal_u32(acc[j], vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+            acc[j] = vaddq_u64(acc[j], vextq_u64(data, data, 1));
+        }
+        if (++stripes == stripesPerBlock)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                uint64x2_t a = veorq_u64(veorq_u64(acc[j], vshrq_n_u64(acc[j], 47)), vld1q_u64(scrambleKeys + 2 * j));
+                uint64x2_t low = vmull_u32(vmovn_u64(a), prime);
+                uint64x2_t high = vmull_u32(vshrn_n_u64(a, 32), prime);
+                acc[j] = vaddq_u64(low, vshlq_n_u64(high, 32));
+            }
+            stripes = 0;
+        }
+    }
+    for (size_t j = 0; j < 4; ++j)
+    {
+        vst1q_u64(accumulators + 2 * j, acc[j]);
+    }
+#else
+    for (size_t s = 0; s < count; ++s, p += Hasher::stripeSize)
+    {
+        for (size_t i = 0; i < 8; ++i)
+        {
+            uint64 data = Read64(p + 8 * i);
+            uint64 keyed = data ^ keys[stripes + i];
+            accumulators[i ^ 1] += data;
+            accumulators[i] += (keyed & 0xFFFFFFFFu) * (keyed >> 32);
+        }
+        if (++stripes == stripesPerBlock)
+        {
+            for (size_t i = 0; i < 8; ++i)
+            {
+                uint64 a = accumulators[i];
+                accumulators[i] = (a ^ (a >> 47) ^ scrambleKeys[i]) * prime32;
+            }
+            stripes = 0;
+        }
+    }
+#endif
+}
+
+//
+// Adds the last stripe, which ends with the input, and reduces the
+// accumulators to the hash.
+//
+uint64
+Finish(uint64* accumulators, const Byte* lastStripe, uint64 size, const uint64* secret)
+{
+    size_t stripes = 0;
+    Accumulate(accumulators, stripes, lastStripe, 1, secret + lastStripeKey, secret + scrambleKey);
+
+    uint64 result = size * prime64;
+    for (size_t i = 0; i < 8; i += 2)
+    {
+        result += Mix(accumulators[i] ^ secret[mergeKey + i], accumulators[i + 1] ^ secret[mergeKey + i + 1]);
+    }
+    result ^= result >> 37;
+    result *= UTIL_UINT64(0x165667919E3779F9);
+    return result ^ (result >> 32);
+}
+
+}
+
+uint64
+Util::HashBytes(const void* data, size_t size, uint64 seed)
+{
+    const Byte* p = static_cast<const Byte*>(data);
+    if (size <= Hasher::bufferSize)
+    {
+        return HashShort(p, size, seed);
+    }
+
+    uint64 secret[Hasher::secretSize];
+    InitSecret(seed, secret);
+    uint64 accumulators[8];
+    memcpy(accumulators, initialAccumulators, sizeof(accumulators));
+    size_t stripes = 0;
+    Accumulate(accumulators, stripes, p, (size - 1) / Hasher::stripeSize, secret, secret + scrambleKey);
+    return Finish(accumulators, p + size - Hasher::stripeSize, size, secret);
+}
+
+Util::Hasher::Hasher(uint64 seed)
+{
+    Reset(seed);
+}
+
+void
+Util::Hasher::Reset(uint64 seed)
+{
+    m_seed = seed;
+    m_total = 0;
+    memcpy(m_accumulators, initialAccumulators, sizeof(m_accumulators));
+    InitSecret(seed, m_secret);
+    m_stripes = 0;
+    m_buffered = 0;
+}
+
+void
+Util::Hasher::Update(const void* data, size_t size)
+{
+    const Byte* p = static_cast<const Byte*>(data);
+    m_total += size;
+    if (size <= bufferSize - m_buffered)
+    {
+        memcpy(m_buffer + m_buffered, p, size);
+        m_buffered += size;
+        return;
+    }
+
+    //
+    // More input follows, so none of the stripes accumulated here is the
+    // last one. At least one byte is kept for it.
+    //
+    if (m_buffered != 0)
+    {
+        size_t fill = bufferSize - m_buffered;
+        memcpy(m_buffer + m_buffered, p, fill);
+        p += fill;
+        size -= fill;
+        Accumulate(m_accumulators, m_stripes, m_buffer, bufferSize / stripeSize, m_secret, m_secret + scrambleKey);
+        memcpy(m_previous, m_buffer + bufferSize - stripeSize, stripeSize);
+    }
+    if (size > bufferSize)
+    {
+        size_t count = (size - 1) / bufferSize * (bufferSize / stripeSize);
+        Accumulate(m_accumulators, m_stripes, p, count, m_secret, m_secret + scrambleKey);
+        p += count * stripeSize;
+        size -= count * stripeSize;
+        memcpy(m_previous, p - stripeSize, stripeSize);
+    }
+    memcpy(m_buffer, p, size);
+    m_buffered = size;
+}
+
+uint64
+Util::Hasher::Final() const
+{
+    if (m_total <= bufferSize)
+    {
+        return HashShort(m_buffer, m_buffered, m_seed);
+    }
+
+    uint64 accumulators[8];
+    memcpy(accumulators, m_accumulators, sizeof(accumulators));
+    size_t stripes = m_stripes;
+    Accumulate(accumulators, stripes, m_buffer, (m_buffered - 1) / stripeSize, m_secret, m_secret + scrambleKey);
+
+    Byte last[stripeSize];
+    const Byte* lastStripe = last;
+    if (m_buffered >= stripeSize)
+    {
+        lastStripe = m_buffer + m_buffered - stripeSize;
+    }
+    else
+    {
+        memcpy(last, m_previous + m_buffered, stripeSize - m_buffered);
+        memcpy(last + stripeSize - m_buffered, m_buffer, m_buffered);
+    }
+    return Finish(accumulators, lastStripe, m_total, m_secret);
+}
@@ -0,0 +1,252 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/HexCoding.h>
+
+#include <cstring>
+
+#if defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const char lowerDigits[] = "0123456789abcdef";
+const char upperDigits[] = "0123456789ABCDEF";
+
+//
+// The value of a hex digit, or -1.
+//
+inline int
+HexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    c = static_cast<char>(c | 0x20);
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+#if defined(ARCH_CPU_SSE2)
+
+//
+// A nibble n is written n + '0', plus 'a' - '0' - 10 (or 'A' - '0' - 10)
+// if n > 9.
+//
+inline __m128i
+ToDigits(__m128i nibbles, __m128i letterOffset)
+{
+    __m128i digits = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+    return _mm_add_epi8(digits, _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), letterOffset));
+}
+
+//
+// The values of 16 hex digits; false if one of them is not a hex digit.
+//
+inline bool
+ToNibbles(__m128i digits, __m128i& nibbles)
+{
+    __m128i decimal = _mm_sub_epi8(digits, _mm_set1_epi8('0'));
+    __m128i isDecimal = _mm_cmpeq_epi8(_mm_min_epu8(decimal, _mm_set1_epi8(9)), decimal);
+    __m128i letter = _mm_sub_epi8(_mm_or_si128(digits, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+    nibbles = _mm_or_si128(_mm_and_si128(isDecimal, decimal),
+                           _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    return _mm_movemask_epi8(_mm_or_si128(isDecimal, isLetter)) == 0xFFFF;
+}
+
+//
+// Each 16-bit lane has the high nibble in its low byte and the low
+// nibble in its high byte (little endian); the byte goes in its low byte.
+//
+inline __m128i
+JoinNibbles(__m128i nibbles)
+{
+    __m128i high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4);
+    return _mm_or_si128(high, _mm_srli_epi16(nibbles, 8));
+}
+
+#elif defined(ARCH_CPU_NEON)
+
+inline uint8x16_t
+ToDigits(uint8x16_t nibbles, uint8x16_t letterOffset)
+{
+    uint8x16_t digits = vaddq_u8(nibbles, vdupq_n_u8('0'));
+    return vaddq_u8(digits, vandq_u8(vcgtq_u8(nibbles, vdupq_n_u8(9)), letterOffset));
+}
+
+inline uint8x16_t
+ToNibbles(uint8x16_t digits, uint8x16_t& valid)
+{
+    uint8x16_t decimal = vsubq_u8(digits, vdupq_n_u8('0'));
+    uint8x16_t isDecimal = vcleq_u8(decimal, vdupq_n_u8(9));
+    uint8x16_t letter = vsubq_u8(vorrq_u8(digits, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t isLetter = vcleq_u8(letter, vdupq_n_u8(5));
+    valid = vandq_u8(valid, vorrq_u8(isDecimal, isLetter));
+    return vbslq_u8(isDecimal, decimal, vaddq_u8(letter, vdupq_n_u8(10)));
+}
+
+#endif
+
+}
+
+size_t
+Util::EncodeHex(const void* data, size_t size, char* target, bool upper)
+{
+    const Byte* p = static_cast<const Byte*>(data);
+    const Byte* last = p + size;
+    char* out = target;
+
+#if defined(ARCH_CPU_SSE2)
+    const __m128i letterOffset = _mm_set1_epi8(upper ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    const __m128i lowNibble = _mm_set1_epi8(0x0F);
+    for (; last - p >= 16; p += 16, out += 32)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i high = ToDigits(_mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibble), letterOffset);
+        __m128i low = ToDigits(_mm_and_si128(bytes, lowNibble), letterOffset);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(high, low));
+    }
+#elif defined(ARCH_CPU_NEON)
+    const uint8x16_t letterOffset = vdupq_n_u8(upper ? 'A' - '0' - 10 : 'a' - '0' - 10);
+    for (; last - p >= 16; p += 16, out += 32)
+    {
+        uint8x16_t bytes = vld1q_u8(p);
+        uint8x16x2_t digits;
+        digits.val[0] = ToDigits(vshrq_n_u8(bytes, 4), letterOffset);
+        digits.val[1] = ToDigits(vandq_u8(bytes, vdupq_n_u8(0x0F)), letterOffset);
+        vst2q_u8(reinterpret_cast<uint8*>(out), digits);
+    }
+#endif
+
+    const char* digits = upper ? upperDigits : lowerDigits;
+    for (; p != last; ++p)
+    {
+        *out++ = digits[*p >> 4];
+        *out++ = digits[*p & 0x0F];
+    }
+    return 2 * size;
+}
+
+size_t
+Util::DecodeHex(const char* text, size_t size, Byte* target, const char** end)
+{
+    const char* p = text;
+    const char* last = text + (size & ~static_cast<size_t>(1));
+    Byte* out = target;
+
+    //
+    // A block with something else than hex digits is done again below,
+    // to stop at the right pair.
+    //
+#if defined(ARCH_CPU_SSE2)
+    for (; last - p >= 32; p += 32, out += 16)
+    {
+        __m128i first;
+        __m128i second;
+        bool valid = ToNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), first);
+        if (!(ToNibbles(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16)), second) && valid))
+        {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(JoinNibbles(first), JoinNibbles(second)));
+    }
+#elif defined(ARCH_CPU_NEON)
+    for (; last - p >= 32; p += 32, out += 16)
+    {
+        uint8x16x2_t digits = vld2q_u8(reinterpret_cast<const uint8*>(p));
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        uint8x16_t high = ToNibbles(digits.val[0], valid);
+        uint8x16_t low = ToNibbles(digits.val[1], valid);
+        uint64x2_t lanes = vreinterpretq_u64_u8(valid);
+        if ((vgetq_lane_u64(lanes, 0) & vgetq_lane_u64(lanes, 1)) != ~UTIL_UINT64(0))
+        {
+            break;
+        }
+        vst1q_u8(out, vorrq_u8(vshlq_n_u8(high, 4), low));
+    }
+#endif
+
+    for (; p != last; p += 2)
+    {
+        int high = HexValue(p[0]);
+        int low = HexValue(p[1]);
+        if (high < 0 || low < 0)
+        {
+            break;
+        }
+        *out++ = static_cast<Byte>(high << 4 | low);
+    }
+    if (end != 0)
+    {
+        *end = p;
+    }
+    return static_cast<size_t>(out - target);
+}
+
+size_t
+Util::FormatHexDumpLine(const void* data, size_t size, uint64 offset, size_t lineLength, char* line)
+{
+    assert(size <= lineLength);
+    const Byte* bytes = static_cast<const Byte*>(data);
+    char* p = line;
+
+    *p++ = '[';
+    int digits = 8;
+    while (digits < 16 && (offset >> (4 * digits)) != 0)
+    {
+        ++digits;
+    }
+    for (int i = digits - 1; i >= 0; --i)
+    {
+        *p++ = upperDigits[(offset >> (4 * i)) & 0x0F];
+    }
+    memcpy(p, "h]: ", 4);
+    p += 4;
+
+    //
+    // Each byte is followed by a space, with one more between the two
+    // halves of the line.
+    //
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (i == lineLength / 2)
+        {
+            *p++ = ' ';
+        }
+        *p++ = upperDigits[bytes[i] >> 4];
+        *p++ = upperDigits[bytes[i] & 0x0F];
+        *p++ = ' ';
+    }
+    size_t padding = 3 * (lineLength - size) + (size <= lineLength / 2 ? 1 : 0);
+    memset(p, ' ', padding);
+    p += padding;
+    memcpy(p, "   |", 4);
+    p += 4;
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        *p++ = bytes[i] >= 32 && bytes[i] <= 126 ? static_cast<char>(bytes[i]) : '.';
+    }
+    memset(p, ' ', lineLength - size);
+    p += lineLength - size;
+    *p++ = '|';
+    return static_cast<size_t>(p - line);
+}
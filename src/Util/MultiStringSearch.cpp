@@ -0,0 +1,680 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/MultiStringSearch.h>
+#include <Util/Exception.h>
+#include <Unicoder/CaseMapping.h>
+#include <Unicoder/Transcoder.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace std;
+using namespace Util;
+using namespace UtilInternal;
+
+namespace
+{
+
+//
+// The largest dense transition table, in bytes.
+//
+const size_t maxDenseTable = 1 << 20;
+
+//
+// Sparse states with more transitions are searched by bisection.
+//
+const uint32 linearEdges = 8;
+
+const uint32 noState = 0xFFFFFFFF;
+
+inline Byte
+FoldASCII(Byte b)
+{
+    return static_cast<Byte>(b - 'A') < 26 ? static_cast<Byte>(b | 0x20) : b;
+}
+
+//
+// The trie of the patterns while the automaton is built, with the states
+// numbered in creation order.
+//
+struct TrieNode
+{
+    vector<pair<Byte, uint32> > children;
+    vector<uint32> patterns;
+};
+
+uint32
+Child(const vector<TrieNode>& trie, uint32 node, Byte c)
+{
+    const vector<pair<Byte, uint32> >& children = trie[node].children;
+    vector<pair<Byte, uint32> >::const_iterator p =
+        lower_bound(children.begin(), children.end(), make_pair(c, static_cast<uint32>(0)));
+    return p != children.end() && p->first == c ? p->second : noState;
+}
+
+}
+
+//
+// Runs the automaton of a searcher over a chunk and reports the matches.
+//
+class Util::MultiStringSearcher::Scanner
+{
+public:
+
+    Scanner(const MultiStringSearcher& searcher, State& state, vector<MultiStringMatch>* matches) :
+        m_searcher(searcher),
+        m_state(state),
+        m_matches(matches),
+        m_firstMatch(matches != 0 ? matches->size() : 0),
+        m_found(0),
+        m_stopped(false),
+        m_folding(searcher.m_case == unicodeCaseInsensitiveMatch),
+        m_firstMatchId(searcher.IsDense() ? searcher.m_matchFirst / searcher.m_classCount : searcher.m_matchFirst),
+        m_mask(0)
+    {
+        if (m_folding)
+        {
+            size_t ring = 1;
+            while (ring < searcher.m_maxLength)
+            {
+                ring <<= 1;
+            }
+            if (state.m_starts.size() != ring)
+            {
+                state.m_starts.assign(ring, 0);
+            }
+            m_mask = ring - 1;
+        }
+    }
+
+    size_t Found() const
+    {
+        return m_found;
+    }
+
+    void Scan(const Byte* first, const Byte* last)
+    {
+        if (m_folding)
+        {
+            ScanFolded(first, last);
+        }
+        else if (m_searcher.IsDense())
+        {
+            ScanDense(first, last);
+        }
+        else
+        {
+            ScanSparse(first, last);
+        }
+    }
+
+    //
+    // Feeds the bytes of an incomplete sequence at the end of the stream
+    // unchanged, like FoldCase.
+    //
+    void Finish()
+    {
+        for (int i = 0; i < m_state.m_pendingSize && !m_stopped; ++i)
+        {
+            Feed(m_state.m_pending[i], m_state.m_offset, m_state.m_offset + 1);
+            ++m_state.m_offset;
+        }
+        m_state.m_pendingSize = 0;
+    }
+
+private:
+
+    void ScanDense(const Byte* first, const Byte* last)
+    {
+        const uint32* table = &m_searcher.m_dense[0];
+        const Byte* classes = m_searcher.m_classes;
+        const uint32 matchFirst = m_searcher.m_matchFirst;
+        uint32 s = m_state.m_state;
+
+        for (const Byte* p = first; p != last; ++p)
+        {
+            s = table[s + classes[*p]];
+            if (s >= matchFirst)
+            {
+                if (!Report(s / m_searcher.m_classCount, m_state.m_offset + static_cast<size_t>(p + 1 - first), 0))
+                {
+                    break;
+                }
+            }
+        }
+        m_state.m_state = s;
+        m_state.m_offset += static_cast<size_t>(last - first);
+    }
+
+    void ScanSparse(const Byte* first, const Byte* last)
+    {
+        const Byte* classes = m_searcher.m_classes;
+        const uint32 matchFirst = m_searcher.m_matchFirst;
+        uint32 s = m_state.m_state;
+
+        for (const Byte* p = first; p != last; ++p)
+        {
+            s = Next(s, classes[*p]);
+            if (s >= matchFirst)
+            {
+                if (!Report(s, m_state.m_offset + static_cast<size_t>(p + 1 - first), 0))
+                {
+                    break;
+                }
+            }
+        }
+        m_state.m_state = s;
+        m_state.m_offset += static_cast<size_t>(last - first);
+    }
+
+    //
+    // The automaton of unicodeCaseInsensitiveMatch is fed the case folding
+    // of the text. A character split across chunks waits in the State.
+    //
+    void ScanFolded(const Byte* first, const Byte* last)
+    {
+        if (m_state.m_pendingSize != 0)
+        {
+            Byte buffer[8];
+            size_t pending = static_cast<size_t>(m_state.m_pendingSize);
+            size_t taken = min(static_cast<size_t>(last - first), static_cast<size_t>(3));
+            memcpy(buffer, m_state.m_pending, pending);
+            memcpy(buffer + pending, first, taken);
+
+            size_t consumed = static_cast<size_t>(Fold(buffer, buffer + pending + taken, buffer + pending) - buffer);
+            m_state.m_offset += consumed;
+            if (consumed < pending)
+            {
+                //
+                // Still incomplete: the whole chunk is in the buffer.
+                //
+                m_state.m_pendingSize = static_cast<int>(pending + taken - consumed);
+                memmove(m_state.m_pending, buffer + consumed, m_state.m_pendingSize);
+                return;
+            }
+            m_state.m_pendingSize = 0;
+            first += consumed - pending;
+            if (m_stopped)
+            {
+                return;
+            }
+        }
+
+        const Byte* p = Fold(first, last, last);
+        if (m_stopped)
+        {
+            return;
+        }
+        m_state.m_offset += static_cast<size_t>(p - first);
+        m_state.m_pendingSize = static_cast<int>(last - p);
+        memcpy(m_state.m_pending, p, last - p);
+    }
+
+    //
+    // Feeds the folding of the characters of [first, last) that start
+    // before stop; first is at m_state.m_offset. Returns where it stopped,
+    // at stop or after, or at an incomplete sequence at last.
+    //
+    const Byte* Fold(const Byte* first, const Byte* last, const Byte* stop)
+    {
+        const Byte* p = first;
+        while (p < stop && !m_stopped)
+        {
+            uint64 start = m_state.m_offset + static_cast<size_t>(p - first);
+            if (*p < 0x80)
+            {
+                Feed(FoldASCII(*p), start, start + 1);
+                ++p;
+                continue;
+            }
+
+            const Byte* next = p;
+            UTF32 cp;
+            ConversionResult result = UTF8Encoding::Decode(next, last, cp, strictConversion);
+            if (result == sourceExhausted)
+            {
+                break;
+            }
+            if (result != conversionOK)
+            {
+                Feed(*p, start, start + 1);
+                ++p;
+                continue;
+            }
+
+            uint64 end = m_state.m_offset + static_cast<size_t>(next - first);
+            UTF32 folding[3];
+            int length = FoldCase(cp, folding);
+            for (int i = 0; i < length; ++i)
+            {
+                Byte bytes[UTF8Encoding::MaxUnitsPerCodePoint];
+                Byte* bytesEnd = bytes;
+                UTF8Encoding::Encode(folding[i], bytesEnd, bytes + sizeof(bytes));
+                for (const Byte* b = bytes; b != bytesEnd; ++b)
+                {
+                    Feed(*b, start, end);
+                }
+            }
+            p = next;
+        }
+        return p;
+    }
+
+    void Feed(Byte b, uint64 start, uint64 end)
+    {
+        m_state.m_starts[m_state.m_folded & m_mask] = start;
+        ++m_state.m_folded;
+
+        uint32 s = Next(m_state.m_state, m_searcher.m_classes[b]);
+        m_state.m_state = s;
+        if (s >= m_searcher.m_matchFirst)
+        {
+            if (!Report(m_searcher.IsDense() ? s / m_searcher.m_classCount : s, end, m_state.m_folded))
+            {
+                m_stopped = true;
+            }
+        }
+    }
+
+    uint32 Next(uint32 s, Byte c) const
+    {
+        const MultiStringSearcher& searcher = m_searcher;
+        if (searcher.IsDense())
+        {
+            return searcher.m_dense[s + c];
+        }
+
+        for (;;)
+        {
+            if (s < searcher.m_denseEnd)
+            {
+                return searcher.m_dense[s * searcher.m_classCount + c];
+            }
+            if (s >= searcher.m_denseMatchFirst)
+            {
+                return searcher.m_dense[(s - searcher.m_denseMatchFirst + searcher.m_denseEnd) * searcher.m_classCount + c];
+            }
+
+            const uint32* sparse = &searcher.m_sparse[(s - searcher.m_denseEnd) * 2];
+            const Byte* classes = &searcher.m_edgeClasses[0];
+            uint32 begin = sparse[0];
+            uint32 end = sparse[2];
+            if (end - begin <= linearEdges)
+            {
+                for (uint32 i = begin; i != end; ++i)
+                {
+                    if (classes[i] == c)
+                    {
+                        return searcher.m_edgeTargets[i];
+                    }
+                }
+            }
+            else
+            {
+                const Byte* p = lower_bound(classes + begin, classes + end, c);
+                if (p != classes + end && *p == c)
+                {
+                    return searcher.m_edgeTargets[p - classes];
+                }
+            }
+            s = sparse[1];
+        }
+    }
+
+    //
+    // Reports the patterns ended by state id (not premultiplied) at end,
+    // folded is the number of folded bytes fed for
+    // unicodeCaseInsensitiveMatch. Returns false to stop.
+    //
+    bool Report(uint32 id, uint64 end, uint64 folded)
+    {
+        do
+        {
+            uint32 index = id - m_firstMatchId;
+            for (uint32 i = m_searcher.m_outputBegin[index]; i != m_searcher.m_outputBegin[index + 1]; ++i)
+            {
+                MultiStringMatch match;
+                match.pattern = m_searcher.m_outputPatterns[i];
+                size_t length = m_searcher.m_lengths[match.pattern];
+                match.offset = !m_folding ? end - length : m_state.m_starts[(folded - length) & m_mask];
+                match.length = end - match.offset;
+                if (m_folding && IsReported(match))
+                {
+                    continue;
+                }
+
+                ++m_found;
+                if (m_matches == 0)
+                {
+                    return false;
+                }
+                m_matches->push_back(match);
+            }
+            id = m_searcher.m_outputLink[index];
+        }
+        while (id != 0);
+        return true;
+    }
+
+    //
+    // A character folds to several bytes, so a pattern can end more than
+    // once in it at the same start ("s" twice in U+00DF, whose folding is
+    // "ss"): these matches cover the same bytes of the text and are only
+    // reported once. They end at the same character, after the matches
+    // ending before it.
+    //
+    bool IsReported(const MultiStringMatch& match) const
+    {
+        if (m_matches == 0)
+        {
+            return false;
+        }
+        uint64 end = match.offset + match.length;
+        for (size_t i = m_matches->size(); i > m_firstMatch; --i)
+        {
+            const MultiStringMatch& previous = (*m_matches)[i - 1];
+            if (previous.offset + previous.length != end)
+            {
+                break;
+            }
+            if (previous.pattern == match.pattern && previous.offset == match.offset)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const MultiStringSearcher& m_searcher;
+    State& m_state;
+    vector<MultiStringMatch>* m_matches;
+    size_t m_firstMatch;
+    size_t m_found;
+    bool m_stopped;
+    bool m_folding;
+    uint32 m_firstMatchId;
+    uint64 m_mask;
+};
+
+Util::MultiStringSearcher::State::State()
+{
+    Reset();
+}
+
+void
+Util::MultiStringSearcher::State::Reset()
+{
+    m_state = 0;
+    m_offset = 0;
+    m_folded = 0;
+    m_pendingSize = 0;
+}
+
+Util::MultiStringSearcher::MultiStringSearcher(const vector<string>& patterns, MultiStringCase matchCase) :
+    m_case(matchCase),
+    m_patterns(patterns),
+    m_maxLength(0)
+{
+    vector<string> keys(patterns);
+    for (vector<string>::iterator p = keys.begin(); p != keys.end(); ++p)
+    {
+        if (p->empty())
+        {
+            throw IllegalArgumentException(__FILE__, __LINE__, "empty pattern");
+        }
+        if (matchCase == asciiCaseInsensitiveMatch)
+        {
+            for (string::iterator q = p->begin(); q != p->end(); ++q)
+            {
+                *q = static_cast<char>(FoldASCII(static_cast<Byte>(*q)));
+            }
+        }
+        else if (matchCase == unicodeCaseInsensitiveMatch)
+        {
+            *p = FoldCase(*p);
+        }
+        m_lengths.push_back(p->size());
+        m_maxLength = max(m_maxLength, p->size());
+    }
+    Build(keys);
+}
+
+void
+Util::MultiStringSearcher::Build(const vector<string>& keys)
+{
+    //
+    // The bytes no pattern uses share class 0.
+    //
+    bool used[256] = { false };
+    for (vector<string>::const_iterator p = keys.begin(); p != keys.end(); ++p)
+    {
+        for (string::const_iterator q = p->begin(); q != p->end(); ++q)
+        {
+            used[static_cast<Byte>(*q)] = true;
+        }
+    }
+    Byte classOf[256];
+    m_classCount = static_cast<uint32>(count(used, used + 256, true)) < 256 ? 1 : 0;
+    for (int b = 0; b < 256; ++b)
+    {
+        classOf[b] = used[b] ? static_cast<Byte>(m_classCount++) : 0;
+    }
+    for (int b = 0; b < 256; ++b)
+    {
+        m_classes[b] = classOf[m_case == asciiCaseInsensitiveMatch ? FoldASCII(static_cast<Byte>(b)) : b];
+    }
+
+    vector<TrieNode> trie(1);
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        uint32 node = 0;
+        for (string::const_iterator q = keys[i].begin(); q != keys[i].end(); ++q)
+        {
+            Byte c = classOf[static_cast<Byte>(*q)];
+            uint32 child = Child(trie, node, c);
+            if (child == noState)
+            {
+                child = static_cast<uint32>(trie.size());
+                vector<pair<Byte, uint32> >& children = trie[node].children;
+                children.insert(lower_bound(children.begin(), children.end(), make_pair(c, child)),
+                                make_pair(c, child));
+                trie.push_back(TrieNode());
+            }
+            node = child;
+        }
+        trie[node].patterns.push_back(static_cast<uint32>(i));
+    }
+
+    //
+    // Failure links and the links to the next state along them that ends
+    // patterns, breadth first.
+    //
+    uint32 states = static_cast<uint32>(trie.size());
+    vector<uint32> order(1, 0);
+    vector<uint32> fail(states, 0);
+    vector<uint32> outputLink(states, 0);
+    vector<uint32> depth(states, 0);
+    order.reserve(states);
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        uint32 node = order[i];
+        const vector<pair<Byte, uint32> >& children = trie[node].children;
+        for (vector<pair<Byte, uint32> >::const_iterator p = children.begin(); p != children.end(); ++p)
+        {
+            uint32 child = p->second;
+            if (node != 0)
+            {
+                uint32 f = fail[node];
+                while (f != 0 && Child(trie, f, p->first) == noState)
+                {
+                    f = fail[f];
+                }
+                uint32 target = Child(trie, f, p->first);
+                fail[child] = target == noState ? 0 : target;
+            }
+            outputLink[child] = trie[fail[child]].patterns.empty() ? outputLink[fail[child]] : fail[child];
+            depth[child] = depth[node] + 1;
+            order.push_back(child);
+        }
+    }
+
+    //
+    // The states get a row with a transition for every class, all of them
+    // if the table fits in maxDenseTable, else the least deep levels that
+    // fit: with them a failure link never leads to more than one sparse
+    // state lookup at a shallow level, where states have many transitions.
+    //
+    size_t rowSize = m_classCount * sizeof(uint32);
+    uint32 denseDepth = 1;
+    size_t denseStates = 0;
+    for (size_t i = 0; i < order.size();)
+    {
+        size_t j = i;
+        while (j < order.size() && depth[order[j]] == depth[order[i]])
+        {
+            ++j;
+        }
+        if ((denseStates + j - i) * rowSize > maxDenseTable && i != 0)
+        {
+            break;
+        }
+        denseStates += j - i;
+        denseDepth = depth[order[i]] + 1;
+        i = j;
+    }
+    bool allDense = denseStates == states;
+
+    //
+    // The states are numbered, breadth first, in four groups: dense and
+    // sparse states that end no pattern, then sparse and dense states that
+    // do. The start state is the first dense one.
+    //
+    vector<uint32> renumbered(states);
+    vector<uint32> original;
+    original.reserve(states);
+    uint32 groupEnd[4];
+    for (int group = 0; group < 4; ++group)
+    {
+        for (vector<uint32>::const_iterator p = order.begin(); p != order.end(); ++p)
+        {
+            bool dense = depth[*p] < denseDepth;
+            bool ends = !trie[*p].patterns.empty() || outputLink[*p] != 0;
+            if ((ends ? (dense ? 3 : 2) : (dense ? 0 : 1)) == group)
+            {
+                renumbered[*p] = static_cast<uint32>(original.size());
+                original.push_back(*p);
+            }
+        }
+        groupEnd[group] = static_cast<uint32>(original.size());
+    }
+    m_denseEnd = groupEnd[0];
+    m_matchFirst = groupEnd[1];
+    m_denseMatchFirst = groupEnd[2];
+
+    m_outputBegin.push_back(0);
+    for (uint32 id = m_matchFirst; id < states; ++id)
+    {
+        const vector<uint32>& patterns = trie[original[id]].patterns;
+        m_outputPatterns.insert(m_outputPatterns.end(), patterns.begin(), patterns.end());
+        m_outputBegin.push_back(static_cast<uint32>(m_outputPatterns.size()));
+        m_outputLink.push_back(renumbered[outputLink[original[id]]]);
+    }
+
+    //
+    // A dense state without a transition takes that of its failure state,
+    // whose row is complete since it is less deep. A dense automaton holds
+    // the states premultiplied by m_classCount.
+    //
+    uint32 multiplier = allDense ? m_classCount : 1;
+    m_dense.resize(denseStates * m_classCount);
+    for (vector<uint32>::const_iterator p = order.begin(); p != order.end() && depth[*p] < denseDepth; ++p)
+    {
+        uint32 id = renumbered[*p];
+        uint32 row = id < m_denseEnd ? id : id - m_denseMatchFirst + m_denseEnd;
+        uint32* transitions = &m_dense[static_cast<size_t>(row) * m_classCount];
+        if (*p != 0)
+        {
+            uint32 failId = renumbered[fail[*p]];
+            uint32 failRow = failId < m_denseEnd ? failId : failId - m_denseMatchFirst + m_denseEnd;
+            const uint32* failTransitions = &m_dense[static_cast<size_t>(failRow) * m_classCount];
+            copy(failTransitions, failTransitions + m_classCount, transitions);
+        }
+        const vector<pair<Byte, uint32> >& children = trie[*p].children;
+        for (vector<pair<Byte, uint32> >::const_iterator q = children.begin(); q != children.end(); ++q)
+        {
+            transitions[q->first] = renumbered[q->second] * multiplier;
+        }
+    }
+    if (allDense)
+    {
+        m_matchFirst *= m_classCount;
+        return;
+    }
+
+    m_sparse.reserve((m_denseMatchFirst - m_denseEnd) * 2 + 1);
+    for (uint32 id = m_denseEnd; id < m_denseMatchFirst; ++id)
+    {
+        m_sparse.push_back(static_cast<uint32>(m_edgeClasses.size()));
+        m_sparse.push_back(renumbered[fail[original[id]]]);
+        const vector<pair<Byte, uint32> >& children = trie[original[id]].children;
+        for (vector<pair<Byte, uint32> >::const_iterator q = children.begin(); q != children.end(); ++q)
+        {
+            m_edgeClasses.push_back(q->first);
+            m_edgeTargets.push_back(renumbered[q->second]);
+        }
+    }
+    m_sparse.push_back(static_cast<uint32>(m_edgeClasses.size()));
+}
+size_t
+Util::MultiStringSearcher::Scan(const void* data, size_t size, State& state, vector<MultiStringMatch>& matches) const
+{
+    Scanner scanner(*this, state, &matches);
+    const Byte* first = static_cast<const Byte*>(data);
+    scanner.Scan(first, first + size);
+    return scanner.Found();
+}
+
+size_t
+Util::MultiStringSearcher::Finish(State& state, vector<MultiStringMatch>& matches) const
+{
+    Scanner scanner(*this, state, &matches);
+    scanner.Finish();
+    return scanner.Found();
+}
+
+void
+Util::MultiStringSearcher::FindAll(const void* data, size_t size, vector<MultiStringMatch>& matches) const
+{
+    State state;
+    Scan(data, size, state, matches);
+    Finish(state, matches);
+}
+
+void
+Util::MultiStringSearcher::FindAll(const string& text, vector<MultiStringMatch>& matches) const
+{
+    FindAll(text.data(), text.size(), matches);
+}
+
+bool
+Util::MultiStringSearcher::Contains(const void* data, size_t size) const
+{
+    State state;
+    Scanner scanner(*this, state, 0);
+    const Byte* first = static_cast<const Byte*>(data);
+    scanner.Scan(first, first + size);
+    scanner.Finish();
+    return scanner.Found() != 0;
+}
+
+bool
+Util::MultiStringSearcher::Contains(const string& text) const
+{
+    return Contains(text.data(), text.size());
+}
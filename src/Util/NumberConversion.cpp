@@ -0,0 +1,1242 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/NumberConversion.h>
+#include <Util/Bits.h>
+
+#include "PowersOfFive.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <limits>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const int mantissaBits = 52;
+const int exponentBias = 1023;
+const int infinitePower = 0x7FF;
+const uint64 infinityBits = static_cast<uint64>(infinitePower) << mantissaBits;
+
+//
+// The most significant digits used by the exact conversion: the digits
+// after them only matter as far as they are not all zero.
+//
+const int maxExactDigits = 768;
+
+const double exactPowersOfTen[] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+inline bool
+IsDecimalDigit(char c)
+{
+    return static_cast<unsigned char>(c - '0') < 10;
+}
+
+//
+// Eight ASCII digits loaded little endian into a word: checked and
+// converted with a few multiplications instead of eight steps.
+//
+inline bool
+IsEightDigits(uint64 chunk)
+{
+    return ((chunk & UTIL_UINT64(0xF0F0F0F0F0F0F0F0)) |
+            (((chunk + UTIL_UINT64(0x0606060606060606)) & UTIL_UINT64(0xF0F0F0F0F0F0F0F0)) >> 4)) ==
+           UTIL_UINT64(0x3333333333333333);
+}
+
+inline uint32
+ParseEightDigits(uint64 chunk)
+{
+    const uint64 mask = UTIL_UINT64(0x000000FF000000FF);
+    chunk -= UTIL_UINT64(0x3030303030303030);
+    chunk = chunk * 10 + (chunk >> 8);
+    chunk = ((chunk & mask) * UTIL_UINT64(0x000F424000000064) +
+             ((chunk >> 16) & mask) * UTIL_UINT64(0x0000271000000001)) >> 32;
+    return static_cast<uint32>(chunk);
+}
+
+//
+// Appends the decimal digits at p to w, modulo 2^64, and moves p after
+// them.
+//
+inline void
+AccumulateDigits(const char*& p, const char* last, uint64& w)
+{
+#if defined(ARCH_CPU_LITTLE_ENDIAN)
+    uint64 chunk;
+    while (last - p >= 8)
+    {
+        memcpy(&chunk, p, sizeof(chunk));
+        if (!IsEightDigits(chunk))
+        {
+            break;
+        }
+        w = w * 100000000 + ParseEightDigits(chunk);
+        p += 8;
+    }
+#endif
+    for (; p != last && IsDecimalDigit(*p); ++p)
+    {
+        w = 10 * w + static_cast<uint64>(*p - '0');
+    }
+}
+
+//
+// The value of a digit in bases up to 36, or 36.
+//
+inline unsigned
+DigitValue(char c)
+{
+    unsigned value = static_cast<unsigned char>(c) - '0';
+    if (value < 10)
+    {
+        return value;
+    }
+    value = (static_cast<unsigned char>(c) | 0x20) - 'a';
+    return value < 26 ? value + 10 : 36;
+}
+
+//
+// Parses the digits of an unsigned number at p and moves p after them, all
+// of them if the number overflows.
+//
+NumberParseResult
+ParseMagnitude(const char*& p, const char* last, int base, uint64& value)
+{
+    const uint64 maxValue = ~UTIL_UINT64(0);
+    const char* first = p;
+    value = 0;
+    if (base < 2 || base > 36)
+    {
+        return numberInvalid;
+    }
+
+    if (base == 10)
+    {
+        while (p != last && *p == '0')
+        {
+            ++p;
+        }
+
+        //
+        // 19 digits cannot overflow, the 20th may.
+        //
+        AccumulateDigits(p, p + min<ptrdiff_t>(last - p, 19), value);
+        if (p != last && IsDecimalDigit(*p))
+        {
+            unsigned digit = *p++ - '0';
+            if (value > (maxValue - digit) / 10 || (p != last && IsDecimalDigit(*p)))
+            {
+                while (p != last && IsDecimalDigit(*p))
+                {
+                    ++p;
+                }
+                value = maxValue;
+                return numberOverflow;
+            }
+            value = 10 * value + digit;
+        }
+        return p == first ? numberInvalid : numberOK;
+    }
+
+    bool overflow = false;
+    unsigned digit;
+    for (; p != last && (digit = DigitValue(*p)) < static_cast<unsigned>(base); ++p)
+    {
+        if (value > (maxValue - digit) / base)
+        {
+            overflow = true;
+        }
+        value = value * base + digit;
+    }
+    if (p == first)
+    {
+        return numberInvalid;
+    }
+    if (overflow)
+    {
+        value = maxValue;
+        return numberOverflow;
+    }
+    return numberOK;
+}
+
+const char digitPairs[] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+inline int
+DecimalDigitCount(uint64 value)
+{
+    for (int count = 1;; count += 4)
+    {
+        if (value < 10)
+        {
+            return count;
+        }
+        if (value < 100)
+        {
+            return count + 1;
+        }
+        if (value < 1000)
+        {
+            return count + 2;
+        }
+        if (value < 10000)
+        {
+            return count + 3;
+        }
+        value /= 10000;
+    }
+}
+
+inline double
+BitsToDouble(uint64 bits)
+{
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+//
+// The digits of a number: [integer, integerEnd) before the decimal point,
+// [fraction, fractionEnd) after it, and the explicit exponent.
+//
+struct DecimalText
+{
+    const char* integer;
+    const char* integerEnd;
+    const char* fraction;
+    const char* fractionEnd;
+    int64 exponent;
+};
+
+//
+// Computes the double nearest to w * 10^q, as the bits of its magnitude,
+// with the Eisel-Lemire algorithm. Sets exact to false in the rare cases
+// where the product is not precise enough to be sure, the result is then
+// off by at most one.
+//
+uint64
+ComputeDouble(int64 q, uint64 w, bool& exact)
+{
+    if (w == 0 || q < minPowerOfFive)
+    {
+        return 0;
+    }
+    if (q > maxPowerOfFive)
+    {
+        return infinityBits;
+    }
+
+    int leadingZeros = Bits::CountLeadingZeros64(w);
+    w <<= leadingZeros;
+
+    //
+    // 55 significant bits are needed (the mantissa, the implicit bit, and
+    // one more to round): the second half of the power only matters if
+    // the bits below them are all ones.
+    //
+    const uint64* power = powersOfFive[q - minPowerOfFive];
+    uint64 high;
+    uint64 low = Bits::Multiply128(w, power[0], high);
+    if ((high & 0x1FF) == 0x1FF)
+    {
+        uint64 secondHigh;
+        Bits::Multiply128(w, power[1], secondHigh);
+        low += secondHigh;
+        if (secondHigh > low)
+        {
+            ++high;
+        }
+        if (low == ~UTIL_UINT64(0) && (q < -27 || q > 55))
+        {
+            exact = false;
+        }
+    }
+
+    int upperBit = static_cast<int>(high >> 63);
+    int shift = upperBit + 64 - mantissaBits - 3;
+    uint64 mantissa = high >> shift;
+
+    //
+    // floor(q * log2(10)) + 63, then the normalization shifts.
+    //
+    int power2 = ((152170 + 65536) * static_cast<int>(q) >> 16) + 63 + upperBit - leadingZeros + exponentBias;
+    if (power2 <= 0)
+    {
+        //
+        // A denormal, or zero.
+        //
+        if (-power2 + 1 >= 64)
+        {
+            return 0;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        mantissa >>= 1;
+        return mantissa;
+    }
+
+    //
+    // Exactly halfway between two doubles, which only happens for small
+    // powers: round to even instead of up.
+    //
+    if (low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == high)
+    {
+        mantissa &= ~UTIL_UINT64(1);
+    }
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (UTIL_UINT64(2) << mantissaBits))
+    {
+        mantissa = UTIL_UINT64(1) << mantissaBits;
+        ++power2;
+    }
+    mantissa &= ~(UTIL_UINT64(1) << mantissaBits);
+    if (power2 >= infinitePower)
+    {
+        return infinityBits;
+    }
+    return (static_cast<uint64>(power2) << mantissaBits) | mantissa;
+}
+
+//
+// A fixed size unsigned big integer, large enough for the exact
+// comparisons of the slow path.
+//
+class BigInteger
+{
+public:
+
+    explicit BigInteger(uint64 value) :
+        m_size(0)
+    {
+        while (value != 0)
+        {
+            m_limbs[m_size++] = static_cast<uint32>(value);
+            value >>= 32;
+        }
+    }
+
+    void MultiplyAdd(uint32 factor, uint32 addend)
+    {
+        uint64 carry = addend;
+        for (int i = 0; i < m_size; ++i)
+        {
+            uint64 product = static_cast<uint64>(m_limbs[i]) * factor + carry;
+            m_limbs[i] = static_cast<uint32>(product);
+            carry = product >> 32;
+        }
+        if (carry != 0)
+        {
+            Push(static_cast<uint32>(carry));
+        }
+    }
+
+    void MultiplyPowerOfFive(int64 exponent)
+    {
+        for (; exponent >= 13; exponent -= 13)
+        {
+            MultiplyAdd(1220703125, 0);
+        }
+        uint32 factor = 1;
+        for (; exponent > 0; --exponent)
+        {
+            factor *= 5;
+        }
+        MultiplyAdd(factor, 0);
+    }
+
+    void ShiftLeft(int64 bits)
+    {
+        if (m_size == 0 || bits == 0)
+        {
+            return;
+        }
+        int limbs = static_cast<int>(bits / 32);
+        int rest = static_cast<int>(bits % 32);
+        assert(m_size + limbs + 1 <= capacity);
+        if (rest != 0)
+        {
+            uint32 carry = 0;
+            for (int i = 0; i < m_size; ++i)
+            {
+                uint32 limb = m_limbs[i];
+                m_limbs[i] = (limb << rest) | carry;
+                carry = limb >> (32 - rest);
+            }
+            if (carry != 0)
+            {
+                m_limbs[m_size++] = carry;
+            }
+        }
+        if (limbs != 0)
+        {
+            memmove(m_limbs + limbs, m_limbs, m_size * sizeof(uint32));
+            fill(m_limbs, m_limbs + limbs, 0);
+            m_size += limbs;
+        }
+    }
+
+    int Compare(const BigInteger& rhs) const
+    {
+        if (m_size != rhs.m_size)
+        {
+            return m_size < rhs.m_size ? -1 : 1;
+        }
+        for (int i = m_size - 1; i >= 0; --i)
+        {
+            if (m_limbs[i] != rhs.m_limbs[i])
+            {
+                return m_limbs[i] < rhs.m_limbs[i] ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+private:
+
+    void Push(uint32 limb)
+    {
+        assert(m_size < capacity);
+        m_limbs[m_size++] = limb;
+    }
+
+    //
+    // 768 digits times 5^1100 or so, with room for the shifts.
+    //
+    enum { capacity = 180 };
+
+    uint32 m_limbs[capacity];
+    int m_size;
+};
+
+//
+// Compares digits * 10^exponent with the point halfway between the double
+// of the given bits and the next one up.
+//
+int
+CompareHalfway(const BigInteger& digits, int64 exponent, uint64 bits)
+{
+    uint64 mantissa = bits & ((UTIL_UINT64(1) << mantissaBits) - 1);
+    int power2 = static_cast<int>(bits >> mantissaBits);
+    int64 twos = -exponentBias - mantissaBits + 1;
+    if (power2 != 0)
+    {
+        mantissa |= UTIL_UINT64(1) << mantissaBits;
+        twos += power2 - 1;
+    }
+
+    //
+    // digits * 5^exponent * 2^exponent against (2 * mantissa + 1) * 2^(twos - 1)
+    //
+    BigInteger lhs(digits);
+    BigInteger rhs(2 * mantissa + 1);
+    if (exponent >= 0)
+    {
+        lhs.MultiplyPowerOfFive(exponent);
+    }
+    else
+    {
+        rhs.MultiplyPowerOfFive(-exponent);
+    }
+    int64 common = min(exponent, twos - 1);
+    lhs.ShiftLeft(exponent - common);
+    rhs.ShiftLeft(twos - 1 - common);
+    return lhs.Compare(rhs);
+}
+
+//
+// Decides between the candidate and its neighbours with exact arithmetic.
+//
+uint64
+ComputeDoubleExactly(const DecimalText& text, uint64 candidate)
+{
+    BigInteger digits(0);
+    int used = 0;
+    int64 dropped = 0;
+    bool sticky = false;
+    uint32 chunk = 0;
+    int chunkSize = 0;
+    for (int part = 0; part < 2; ++part)
+    {
+        const char* p = part == 0 ? text.integer : text.fraction;
+        const char* last = part == 0 ? text.integerEnd : text.fractionEnd;
+        for (; p != last; ++p)
+        {
+            if (used == 0 && *p == '0')
+            {
+                continue;
+            }
+            if (used == maxExactDigits)
+            {
+                ++dropped;
+                sticky = sticky || *p != '0';
+                continue;
+            }
+            chunk = chunk * 10 + (*p - '0');
+            ++used;
+            if (++chunkSize == 9)
+            {
+                digits.MultiplyAdd(1000000000, chunk);
+                chunk = 0;
+                chunkSize = 0;
+            }
+        }
+    }
+    uint32 scale = 1;
+    for (int i = 0; i < chunkSize; ++i)
+    {
+        scale *= 10;
+    }
+    digits.MultiplyAdd(scale, chunk);
+
+    int64 exponent = text.exponent - (text.fractionEnd - text.fraction) + dropped;
+    if (sticky)
+    {
+        //
+        // Any digit between the truncated number and the next one will do.
+        //
+        digits.MultiplyAdd(10, 1);
+        --exponent;
+    }
+
+    uint64 bits = candidate;
+    for (;;)
+    {
+        if (bits < infinityBits)
+        {
+            int result = CompareHalfway(digits, exponent, bits);
+            if (result > 0 || (result == 0 && (bits & 1) != 0))
+            {
+                ++bits;
+                continue;
+            }
+        }
+        if (bits > 0)
+        {
+            int result = CompareHalfway(digits, exponent, bits - 1);
+            if (result < 0 || (result == 0 && (bits & 1) != 0))
+            {
+                --bits;
+                continue;
+            }
+        }
+        return bits;
+    }
+}
+
+bool
+SkipWord(const char*& p, const char* last, const char* word)
+{
+    const char* q = p;
+    for (; *word != 0; ++word, ++q)
+    {
+        if (q == last || (*q | 0x20) != *word)
+        {
+            return false;
+        }
+    }
+    p = q;
+    return true;
+}
+
+inline int
+FloorLog10Pow2(int e)
+{
+    return (e * 1262611) >> 22;
+}
+
+inline int
+FloorLog10ThreeQuartersPow2(int e)
+{
+    return (e * 1262611 - 524031) >> 22;
+}
+
+inline int
+FloorLog2Pow10(int e)
+{
+    return (e * 1741647) >> 19;
+}
+
+//
+// g * cp / 2^128, rounded to odd: the lowest bit is set if the quotient
+// is inexact.
+//
+inline uint64
+RoundToOdd(uint64 gHigh, uint64 gLow, uint64 cp)
+{
+    uint64 xHigh;
+    Bits::Multiply128(gLow, cp, xHigh);
+    uint64 yHigh;
+    uint64 yLow = Bits::Multiply128(gHigh, cp, yHigh);
+    yLow += xHigh;
+    if (yLow < xHigh)
+    {
+        ++yHigh;
+    }
+    return yHigh | (yLow > 1 ? 1 : 0);
+}
+
+//
+// The shortest digits * 10^exponent that rounds to c * 2^q (Schubfach):
+// the bounds of the interval that rounds to c * 2^q are scaled by 10^-k,
+// 10^k being just below the spacing of the doubles there, with a 128-bit
+// power of ten rounded up. Rounded to odd, the products are precise
+// enough to tell whether a candidate with one digit less, or the ones just
+// below and above the value, are inside the interval. The result may end
+// with zeros.
+//
+void
+ShortestDecimal(uint64 c, int q, bool closerLower, uint64& digits, int& exponent)
+{
+    int k = closerLower ? FloorLog10ThreeQuartersPow2(q) : FloorLog10Pow2(q);
+    int h = q + FloorLog2Pow10(-k) + 1;
+
+    //
+    // g = floor(10^-k * 2^(127 - FloorLog2Pow10(-k))) + 1. The table has
+    // the + 1 already for 5^-1 to 5^-27.
+    //
+    const uint64* power = powersOfFive[-k - minPowerOfFive];
+    uint64 gHigh = power[0];
+    uint64 gLow = power[1];
+    if (k <= 0 || k > 27)
+    {
+        if (++gLow == 0)
+        {
+            ++gHigh;
+        }
+    }
+
+    //
+    // The value and its bounds, in quarters of c's unit.
+    //
+    bool even = (c & 1) == 0;
+    uint64 cb = 4 * c;
+    uint64 lower = RoundToOdd(gHigh, gLow, (cb - 2 + (closerLower ? 1 : 0)) << h) + (even ? 0 : 1);
+    uint64 vb = RoundToOdd(gHigh, gLow, cb << h);
+    uint64 upper = RoundToOdd(gHigh, gLow, (cb + 2) << h) - (even ? 0 : 1);
+
+    uint64 s = vb / 4;
+    if (s >= 10)
+    {
+        uint64 sp = s / 10;
+        bool upInside = lower <= 40 * sp;
+        bool wpInside = 40 * sp + 40 <= upper;
+        if (upInside != wpInside)
+        {
+            digits = sp + (wpInside ? 1 : 0);
+            exponent = k + 1;
+            return;
+        }
+    }
+
+    bool uInside = lower <= 4 * s;
+    bool wInside = 4 * s + 4 <= upper;
+    if (uInside != wInside)
+    {
+        digits = s + (wInside ? 1 : 0);
+        exponent = k;
+        return;
+    }
+
+    uint64 middle = 4 * s + 2;
+    bool roundUp = vb > middle || (vb == middle && (s & 1) != 0);
+    digits = s + (roundUp ? 1 : 0);
+    exponent = k;
+}
+
+//
+// Writes m * 2^e, too large for 64 bits, in decimal.
+//
+size_t
+WriteLargeInteger(uint64 m, int e, char* p)
+{
+    uint32 limbs[36] = { 0 };
+    int size = e / 32;
+    int shift = e % 32;
+    limbs[size++] = static_cast<uint32>(m << shift);
+    limbs[size++] = static_cast<uint32>((m << shift) >> 32);
+    if (shift != 0)
+    {
+        limbs[size++] = static_cast<uint32>(m >> (64 - shift));
+    }
+    while (limbs[size - 1] == 0)
+    {
+        --size;
+    }
+
+    //
+    // Divided by 10^9 until nothing is left, 309 digits at most.
+    //
+    uint32 chunks[36];
+    int count = 0;
+    while (size > 0)
+    {
+        uint64 remainder = 0;
+        for (int i = size - 1; i >= 0; --i)
+        {
+            uint64 current = (remainder << 32) | limbs[i];
+            limbs[i] = static_cast<uint32>(current / 1000000000);
+            remainder = current % 1000000000;
+        }
+        chunks[count++] = static_cast<uint32>(remainder);
+        while (size > 0 && limbs[size - 1] == 0)
+        {
+            --size;
+        }
+    }
+
+    char* q = p + FormatUInt64(chunks[--count], p);
+    while (count > 0)
+    {
+        uint32 chunk = chunks[--count];
+        for (int i = 8; i >= 0; --i)
+        {
+            q[i] = static_cast<char>('0' + chunk % 10);
+            chunk /= 10;
+        }
+        q += 9;
+    }
+    return q - p;
+}
+
+//
+// Writes the first digits of the fraction m / 2^k, k > 64, and returns
+// whether the rest is above one half of the last one (or exactly one half
+// and the last digit is odd).
+//
+bool
+WriteLongFraction(uint64 m, int k, int precision, char*& p)
+{
+    //
+    // The fraction is kept as a multiple of 2^-32size, the digits are
+    // carried out of the top limb.
+    //
+    uint32 limbs[36] = { 0 };
+    int size = (k + 31) / 32;
+    int shift = size * 32 - k;
+    limbs[0] = static_cast<uint32>(m << shift);
+    limbs[1] = static_cast<uint32>((m << shift) >> 32);
+    limbs[2] = shift == 0 ? 0 : static_cast<uint32>(m >> (64 - shift));
+
+    int low = 0;
+    for (int i = 0; i < precision; ++i)
+    {
+        while (low < size && limbs[low] == 0)
+        {
+            ++low;
+        }
+        if (low == size)
+        {
+            memset(p, '0', precision - i);
+            p += precision - i;
+            return false;
+        }
+        uint32 carry = 0;
+        for (int j = low; j < size; ++j)
+        {
+            uint64 product = static_cast<uint64>(limbs[j]) * 10 + carry;
+            limbs[j] = static_cast<uint32>(product);
+            carry = static_cast<uint32>(product >> 32);
+        }
+        *p++ = static_cast<char>('0' + carry);
+    }
+
+    const uint32 half = 0x80000000;
+    if (limbs[size - 1] != half)
+    {
+        return limbs[size - 1] > half;
+    }
+    for (int j = 0; j < size - 1; ++j)
+    {
+        if (limbs[j] != 0)
+        {
+            return true;
+        }
+    }
+    return ((p[-1] - '0') & 1) != 0;
+}
+
+//
+// Adds one to the last digit of [first, last), which may contain a
+// decimal point, and returns the new end.
+//
+char*
+RoundUp(char* first, char* last)
+{
+    for (char* q = last; q != first;)
+    {
+        --q;
+        if (*q == '.')
+        {
+            continue;
+        }
+        if (*q != '9')
+        {
+            ++*q;
+            return last;
+        }
+        *q = '0';
+    }
+    memmove(first + 1, first, last - first);
+    *first = '1';
+    return last + 1;
+}
+
+size_t
+WriteSpecial(uint64 bits, char* buffer)
+{
+    if ((bits & ((UTIL_UINT64(1) << mantissaBits) - 1)) != 0)
+    {
+        memcpy(buffer, "nan", 3);
+        return 3;
+    }
+    char* p = buffer;
+    if ((bits >> 63) != 0)
+    {
+        *p++ = '-';
+    }
+    memcpy(p, "inf", 3);
+    return p + 3 - buffer;
+}
+
+}
+
+NumberParseResult
+Util::ParseDouble(const char* first, const char* last, double& value, const char** end)
+{
+    const char* p = first;
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+
+    DecimalText text;
+    uint64 w = 0;
+    text.integer = p;
+    AccumulateDigits(p, last, w);
+    text.integerEnd = p;
+    text.fraction = p;
+    text.fractionEnd = p;
+    if (p != last && *p == '.')
+    {
+        text.fraction = ++p;
+        AccumulateDigits(p, last, w);
+        text.fractionEnd = p;
+    }
+
+    int64 digitCount = (text.integerEnd - text.integer) + (text.fractionEnd - text.fraction);
+    if (digitCount == 0)
+    {
+        p = text.integer;
+        if (SkipWord(p, last, "inf"))
+        {
+            SkipWord(p, last, "inity");
+            value = negative ? -numeric_limits<double>::infinity() : numeric_limits<double>::infinity();
+        }
+        else if (SkipWord(p, last, "nan"))
+        {
+            value = negative ? -numeric_limits<double>::quiet_NaN() : numeric_limits<double>::quiet_NaN();
+        }
+        else
+        {
+            value = 0;
+            p = first;
+        }
+        if (end != 0)
+        {
+            *end = p;
+        }
+        return p == first ? numberInvalid : numberOK;
+    }
+
+    text.exponent = 0;
+    if (p != last && (*p | 0x20) == 'e')
+    {
+        const char* q = p + 1;
+        bool negativeExponent = false;
+        if (q != last && (*q == '-' || *q == '+'))
+        {
+            negativeExponent = *q == '-';
+            ++q;
+        }
+        if (q != last && IsDecimalDigit(*q))
+        {
+            for (; q != last && IsDecimalDigit(*q); ++q)
+            {
+                if (text.exponent < 0x10000000)
+                {
+                    text.exponent = 10 * text.exponent + (*q - '0');
+                }
+            }
+            if (negativeExponent)
+            {
+                text.exponent = -text.exponent;
+            }
+            p = q;
+        }
+    }
+    if (end != 0)
+    {
+        *end = p;
+    }
+
+    //
+    // w holds all the digits if there are at most 19 of them (leading
+    // zeros aside), else only the first 19.
+    //
+    int64 exponent = text.exponent - (text.fractionEnd - text.fraction);
+    bool truncated = false;
+    if (digitCount > 19)
+    {
+        for (const char* q = text.integer; q != text.fractionEnd && (*q == '0' || *q == '.'); ++q)
+        {
+            if (*q == '0')
+            {
+                --digitCount;
+            }
+        }
+        if (digitCount > 19)
+        {
+            truncated = true;
+            const uint64 minNineteenDigits = UTIL_UINT64(1000000000000000000);
+            w = 0;
+            const char* q = text.integer;
+            while (w < minNineteenDigits && q != text.integerEnd)
+            {
+                w = 10 * w + static_cast<uint64>(*q++ - '0');
+            }
+            if (w >= minNineteenDigits)
+            {
+                exponent = (text.integerEnd - q) + text.exponent;
+            }
+            else
+            {
+                q = text.fraction;
+                while (w < minNineteenDigits && q != text.fractionEnd)
+                {
+                    w = 10 * w + static_cast<uint64>(*q++ - '0');
+                }
+                exponent = (text.fraction - q) + text.exponent;
+            }
+        }
+    }
+
+    uint64 bits;
+    if (w == 0)
+    {
+        bits = 0;
+    }
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+    else if (!truncated && exponent >= -22 && exponent <= 22 && w <= (UTIL_UINT64(1) << 53))
+    {
+        //
+        // Both w and the power of ten are exact doubles: one correctly
+        // rounded operation.
+        //
+        double result = static_cast<double>(static_cast<int64>(w));
+        result = exponent < 0 ? result / exactPowersOfTen[-exponent] : result * exactPowersOfTen[exponent];
+        value = negative ? -result : result;
+        return numberOK;
+    }
+#endif
+    else
+    {
+        bool exact = true;
+        bits = ComputeDouble(exponent, w, exact);
+        if (truncated && exact && ComputeDouble(exponent, w + 1, exact) != bits)
+        {
+            exact = false;
+        }
+        if (!exact)
+        {
+            bits = ComputeDoubleExactly(text, bits);
+        }
+    }
+
+    value = BitsToDouble(bits | (negative ? UTIL_UINT64(1) << 63 : 0));
+    if (bits == infinityBits)
+    {
+        return numberOverflow;
+    }
+    if (bits == 0 && w != 0)
+    {
+        return numberUnderflow;
+    }
+    return numberOK;
+}
+
+size_t
+Util::FormatDouble(double value, char* buffer)
+{
+    uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    int biased = static_cast<int>(bits >> mantissaBits) & infinitePower;
+    if (biased == infinitePower)
+    {
+        return WriteSpecial(bits, buffer);
+    }
+
+    char* p = buffer;
+    if ((bits >> 63) != 0)
+    {
+        *p++ = '-';
+    }
+
+    uint64 m = bits & ((UTIL_UINT64(1) << mantissaBits) - 1);
+    if (biased == 0 && m == 0)
+    {
+        *p++ = '0';
+        return p - buffer;
+    }
+
+    int e = biased == 0 ? 1 - exponentBias - mantissaBits : biased - exponentBias - mantissaBits;
+    bool closerLower = m == 0 && biased > 1;
+    if (biased != 0)
+    {
+        m |= UTIL_UINT64(1) << mantissaBits;
+    }
+
+    uint64 digits;
+    int exponent;
+    if (e <= 0 && e > -mantissaBits - 1 && (m & ((UTIL_UINT64(1) << -e) - 1)) == 0)
+    {
+        //
+        // An integer below 2^53.
+        //
+        digits = m >> -e;
+        exponent = 0;
+    }
+    else
+    {
+        ShortestDecimal(m, e, closerLower, digits, exponent);
+    }
+    while (digits % 10 == 0)
+    {
+        digits /= 10;
+        ++exponent;
+    }
+
+    //
+    // The layout of JavaScript's Number.prototype.toString: plain digits
+    // for decimal exponents from -6 to 20, scientific notation otherwise.
+    //
+    int size = static_cast<int>(FormatUInt64(digits, p));
+    int point = size + exponent;
+    if (exponent >= 0 && point <= 21)
+    {
+        memset(p + size, '0', exponent);
+        p += point;
+    }
+    else if (point > 0 && point <= 21)
+    {
+        memmove(p + point + 1, p + point, size - point);
+        p[point] = '.';
+        p += size + 1;
+    }
+    else if (point > -6 && point <= 0)
+    {
+        memmove(p + 2 - point, p, size);
+        p[0] = '0';
+        p[1] = '.';
+        memset(p + 2, '0', -point);
+        p += 2 - point + size;
+    }
+    else
+    {
+        if (size > 1)
+        {
+            memmove(p + 2, p + 1, size - 1);
+            p[1] = '.';
+            ++size;
+        }
+        p += size;
+        *p++ = 'e';
+        *p++ = point - 1 < 0 ? '-' : '+';
+        p += FormatUInt64(static_cast<uint64>(point - 1 < 0 ? 1 - point : point - 1), p);
+    }
+    return p - buffer;
+}
+
+size_t
+Util::FormatDoubleFixed(double value, int precision, char* buffer)
+{
+    uint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    int biased = static_cast<int>(bits >> mantissaBits) & infinitePower;
+    if (biased == infinitePower)
+    {
+        return WriteSpecial(bits, buffer);
+    }
+    if (precision < 0)
+    {
+        precision = 0;
+    }
+
+    char* p = buffer;
+    if ((bits >> 63) != 0)
+    {
+        *p++ = '-';
+    }
+
+    uint64 m = bits & ((UTIL_UINT64(1) << mantissaBits) - 1);
+    int e = biased == 0 ? 1 - exponentBias - mantissaBits : biased - exponentBias - mantissaBits;
+    if (biased != 0)
+    {
+        m |= UTIL_UINT64(1) << mantissaBits;
+    }
+
+    char* digits = p;
+    if (e >= 0)
+    {
+        //
+        // An integer.
+        //
+        p += e <= 11 ? FormatUInt64(m << e, p) : WriteLargeInteger(m, e, p);
+        if (precision > 0)
+        {
+            *p++ = '.';
+            memset(p, '0', precision);
+            p += precision;
+        }
+        return p - buffer;
+    }
+
+    int k = -e;
+    p += FormatUInt64(k < 64 ? m >> k : 0, p);
+    if (precision > 0)
+    {
+        *p++ = '.';
+    }
+
+    bool roundUp;
+    if (k <= 64)
+    {
+        //
+        // The fraction as a multiple of 2^-64: each digit is the high word
+        // of the product by ten.
+        //
+        uint64 fraction = k == 64 ? m : (m & ((UTIL_UINT64(1) << k) - 1)) << (64 - k);
+        int i = 0;
+        for (; i < precision && fraction != 0; ++i)
+        {
+            uint64 digit;
+            fraction = Bits::Multiply128(fraction, 10, digit);
+            *p++ = static_cast<char>('0' + digit);
+        }
+        memset(p, '0', precision - i);
+        p += precision - i;
+
+        const uint64 half = UTIL_UINT64(1) << 63;
+        roundUp = fraction > half || (fraction == half && ((p[-1] - '0') & 1) != 0);
+    }
+    else
+    {
+        roundUp = WriteLongFraction(m, k, precision, p);
+    }
+
+    if (roundUp)
+    {
+        p = RoundUp(digits, p);
+    }
+    return p - buffer;
+}
+
+NumberParseResult
+Util::ParseUInt64(const char* first, const char* last, uint64& value, const char** end, int base)
+{
+    const char* p = first;
+    if (p != last && *p == '+')
+    {
+        ++p;
+    }
+    NumberParseResult result = ParseMagnitude(p, last, base, value);
+    if (end != 0)
+    {
+        *end = result == numberInvalid ? first : p;
+    }
+    return result;
+}
+
+NumberParseResult
+Util::ParseInt64(const char* first, const char* last, int64& value, const char** end, int base)
+{
+    const char* p = first;
+    bool negative = false;
+    if (p != last && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+
+    uint64 magnitude;
+    NumberParseResult result = ParseMagnitude(p, last, base, magnitude);
+    if (end != 0)
+    {
+        *end = result == numberInvalid ? first : p;
+    }
+    if (result == numberInvalid)
+    {
+        value = 0;
+        return result;
+    }
+
+    const uint64 limit = (UTIL_UINT64(1) << 63) - (negative ? 0 : 1);
+    if (result == numberOverflow || magnitude > limit)
+    {
+        value = negative ? -static_cast<int64>(limit - 1) - 1 : static_cast<int64>(limit);
+        return numberOverflow;
+    }
+    value = negative && magnitude != 0 ? -static_cast<int64>(magnitude - 1) - 1 : static_cast<int64>(magnitude);
+    return numberOK;
+}
+
+size_t
+Util::FormatUInt64(uint64 value, char* buffer)
+{
+    int size = DecimalDigitCount(value);
+    char* p = buffer + size;
+    while (value >= 100)
+    {
+        unsigned pair = static_cast<unsigned>(value % 100) * 2;
+        value /= 100;
+        p -= 2;
+        memcpy(p, digitPairs + pair, 2);
+    }
+    if (value >= 10)
+    {
+        memcpy(p - 2, digitPairs + value * 2, 2);
+    }
+    else
+    {
+        p[-1] = static_cast<char>('0' + value);
+    }
+    return size;
+}
+
+size_t
+Util::FormatInt64(int64 value, char* buffer)
+{
+    if (value < 0)
+    {
+        *buffer = '-';
+        return 1 + FormatUInt64(UTIL_UINT64(0) - static_cast<uint64>(value), buffer + 1);
+    }
+    return FormatUInt64(static_cast<uint64>(value), buffer);
+}
@@ -0,0 +1,703 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef UTIL_POWERS_OF_FIVE_H
+#define UTIL_POWERS_OF_FIVE_H
+
+#include <Util/Config.h>
+
+//
+// Only included by the source file that uses the table.
+//
+namespace
+{
+
+//
+// 128-bit approximations of the powers of five 5^q for q from
+// minPowerOfFive to maxPowerOfFive, as high and low words, normalized so
+// that the top bit is set. 5^q is truncated for q >= 0; for q < 0 the
+// entry is 2^b / 5^-q + 1, with b = z + 127 for q >= -27 and b = 2z + 128
+// otherwise (z the bit length of 5^-q - 1), truncated to 128 bits.
+//
+const int minPowerOfFive = -342;
+const int maxPowerOfFive = 324;
+
+static const uint64 powersOfFive[667][2] =
+{
+    { UTIL_UINT64(0xEEF453D6923BD65A), UTIL_UINT64(0x113FAA2906A13B3F) },
+    { UTIL_UINT64(0x9558B4661B6565F8), UTIL_UINT64(0x4AC7CA59A424C507) },
+    { UTIL_UINT64(0xBAAEE17FA23EBF76), UTIL_UINT64(0x5D79BCF00D2DF649) },
+    { UTIL_UINT64(0xE95A99DF8ACE6F53), UTIL_UINT64(0xF4D82C2C107973DC) },
+    { UTIL_UINT64(0x91D8A02BB6C10594), UTIL_UINT64(0x79071B9B8A4BE869) },
+    { UTIL_UINT64(0xB64EC836A47146F9), UTIL_UINT64(0x9748E2826CDEE284) },
+    { UTIL_UINT64(0xE3E27A444D8D98B7), UTIL_UINT64(0xFD1B1B2308169B25) },
+    { UTIL_UINT64(0x8E6D8C6AB0787F72), UTIL_UINT64(0xFE30F0F5E50E20F7) },
+    { UTIL_UINT64(0xB208EF855C969F4F), UTIL_UINT64(0xBDBD2D335E51A935) },
+    { UTIL_UINT64(0xDE8B2B66B3BC4723), UTIL_UINT64(0xAD2C788035E61382) },
+    { UTIL_UINT64(0x8B16FB203055AC76), UTIL_UINT64(0x4C3BCB5021AFCC31) },
+    { UTIL_UINT64(0xADDCB9E83C6B1793), UTIL_UINT64(0xDF4ABE242A1BBF3D) },
+    { UTIL_UINT64(0xD953E8624B85DD78), UTIL_UINT64(0xD71D6DAD34A2AF0D) },
+    { UTIL_UINT64(0x87D4713D6F33AA6B), UTIL_UINT64(0x8672648C40E5AD68) },
+    { UTIL_UINT64(0xA9C98D8CCB009506), UTIL_UINT64(0x680EFDAF511F18C2) },
+    { UTIL_UINT64(0xD43BF0EFFDC0BA48), UTIL_UINT64(0x0212BD1B2566DEF2) },
+    { UTIL_UINT64(0x84A57695FE98746D), UTIL_UINT64(0x014BB630F7604B57) },
+    { UTIL_UINT64(0xA5CED43B7E3E9188), UTIL_UINT64(0x419EA3BD35385E2D) },
+    { UTIL_UINT64(0xCF42894A5DCE35EA), UTIL_UINT64(0x52064CAC828675B9) },
+    { UTIL_UINT64(0x818995CE7AA0E1B2), UTIL_UINT64(0x7343EFEBD1940993) },
+    { UTIL_UINT64(0xA1EBFB4219491A1F), UTIL_UINT64(0x1014EBE6C5F90BF8) },
+    { UTIL_UINT64(0xCA66FA129F9B60A6), UTIL_UINT64(0xD41A26E077774EF6) },
+    { UTIL_UINT64(0xFD00B897478238D0), UTIL_UINT64(0x8920B098955522B4) },
+    { UTIL_UINT64(0x9E20735E8CB16382), UTIL_UINT64(0x55B46E5F5D5535B0) },
+    { UTIL_UINT64(0xC5A890362FDDBC62), UTIL_UINT64(0xEB2189F734AA831D) },
+    { UTIL_UINT64(0xF712B443BBD52B7B), UTIL_UINT64(0xA5E9EC7501D523E4) },
+    { UTIL_UINT64(0x9A6BB0AA55653B2D), UTIL_UINT64(0x47B233C92125366E) },
+    { UTIL_UINT64(0xC1069CD4EABE89F8), UTIL_UINT64(0x999EC0BB696E840A) },
+    { UTIL_UINT64(0xF148440A256E2C76), UTIL_UINT64(0xC00670EA43CA250D) },
+    { UTIL_UINT64(0x96CD2A865764DBCA), UTIL_UINT64(0x380406926A5E5728) },
+    { UTIL_UINT64(0xBC807527ED3E12BC), UTIL_UINT64(0xC605083704F5ECF2) },
+    { UTIL_UINT64(0xEBA09271E88D976B), UTIL_UINT64(0xF7864A44C633682E) },
+    { UTIL_UINT64(0x93445B8731587EA3), UTIL_UINT64(0x7AB3EE6AFBE0211D) },
+    { UTIL_UINT64(0xB8157268FDAE9E4C), UTIL_UINT64(0x5960EA05BAD82964) },
+    { UTIL_UINT64(0xE61ACF033D1A45DF), UTIL_UINT64(0x6FB92487298E33BD) },
+    { UTIL_UINT64(0x8FD0C16206306BAB), UTIL_UINT64(0xA5D3B6D479F8E056) },
+    { UTIL_UINT64(0xB3C4F1BA87BC8696), UTIL_UINT64(0x8F48A4899877186C) },
+    { UTIL_UINT64(0xE0B62E2929ABA83C), UTIL_UINT64(0x331ACDABFE94DE87) },
+    { UTIL_UINT64(0x8C71DCD9BA0B4925), UTIL_UINT64(0x9FF0C08B7F1D0B14) },
+    { UTIL_UINT64(0xAF8E5410288E1B6F), UTIL_UINT64(0x07ECF0AE5EE44DD9) },
+    { UTIL_UINT64(0xDB71E91432B1A24A), UTIL_UINT64(0xC9E82CD9F69D6150) },
+    { UTIL_UINT64(0x892731AC9FAF056E), UTIL_UINT64(0xBE311C083A225CD2) },
+    { UTIL_UINT64(0xAB70FE17C79AC6CA), UTIL_UINT64(0x6DBD630A48AAF406) },
+    { UTIL_UINT64(0xD64D3D9DB981787D), UTIL_UINT64(0x092CBBCCDAD5B108) },
+    { UTIL_UINT64(0x85F0468293F0EB4E), UTIL_UINT64(0x25BBF56008C58EA5) },
+    { UTIL_UINT64(0xA76C582338ED2621), UTIL_UINT64(0xAF2AF2B80AF6F24E) },
+    { UTIL_UINT64(0xD1476E2C07286FAA), UTIL_UINT64(0x1AF5AF660DB4AEE1) },
+    { UTIL_UINT64(0x82CCA4DB847945CA), UTIL_UINT64(0x50D98D9FC890ED4D) },
+    { UTIL_UINT64(0xA37FCE126597973C), UTIL_UINT64(0xE50FF107BAB528A0) },
+    { UTIL_UINT64(0xCC5FC196FEFD7D0C), UTIL_UINT64(0x1E53ED49A96272C8) },
+    { UTIL_UINT64(0xFF77B1FCBEBCDC4F), UTIL_UINT64(0x25E8E89C13BB0F7A) },
+    { UTIL_UINT64(0x9FAACF3DF73609B1), UTIL_UINT64(0x77B191618C54E9AC) },
+    { UTIL_UINT64(0xC795830D75038C1D), UTIL_UINT64(0xD59DF5B9EF6A2417) },
+    { UTIL_UINT64(0xF97AE3D0D2446F25), UTIL_UINT64(0x4B0573286B44AD1D) },
+    { UTIL_UINT64(0x9BECCE62836AC577), UTIL_UINT64(0x4EE367F9430AEC32) },
+    { UTIL_UINT64(0xC2E801FB244576D5), UTIL_UINT64(0x229C41F793CDA73F) },
+    { UTIL_UINT64(0xF3A20279ED56D48A), UTIL_UINT64(0x6B43527578C1110F) },
+    { UTIL_UINT64(0x9845418C345644D6), UTIL_UINT64(0x830A13896B78AAA9) },
+    { UTIL_UINT64(0xBE5691EF416BD60C), UTIL_UINT64(0x23CC986BC656D553) },
+    { UTIL_UINT64(0xEDEC366B11C6CB8F), UTIL_UINT64(0x2CBFBE86B7EC8AA8) },
+    { UTIL_UINT64(0x94B3A202EB1C3F39), UTIL_UINT64(0x7BF7D71432F3D6A9) },
+    { UTIL_UINT64(0xB9E08A83A5E34F07), UTIL_UINT64(0xDAF5CCD93FB0CC53) },
+    { UTIL_UINT64(0xE858AD248F5C22C9), UTIL_UINT64(0xD1B3400F8F9CFF68) },
+    { UTIL_UINT64(0x91376C36D99995BE), UTIL_UINT64(0x23100809B9C21FA1) },
+    { UTIL_UINT64(0xB58547448FFFFB2D), UTIL_UINT64(0xABD40A0C2832A78A) },
+    { UTIL_UINT64(0xE2E69915B3FFF9F9), UTIL_UINT64(0x16C90C8F323F516C) },
+    { UTIL_UINT64(0x8DD01FAD907FFC3B), UTIL_UINT64(0xAE3DA7D97F6792E3) },
+    { UTIL_UINT64(0xB1442798F49FFB4A), UTIL_UINT64(0x99CD11CFDF41779C) },
+    { UTIL_UINT64(0xDD95317F31C7FA1D), UTIL_UINT64(0x40405643D711D583) },
+    { UTIL_UINT64(0x8A7D3EEF7F1CFC52), UTIL_UINT64(0x482835EA666B2572) },
+    { UTIL_UINT64(0xAD1C8EAB5EE43B66), UTIL_UINT64(0xDA3243650005EECF) },
+    { UTIL_UINT64(0xD863B256369D4A40), UTIL_UINT64(0x90BED43E40076A82) },
+    { UTIL_UINT64(0x873E4F75E2224E68), UTIL_UINT64(0x5A7744A6E804A291) },
+    { UTIL_UINT64(0xA90DE3535AAAE202), UTIL_UINT64(0x711515D0A205CB36) },
+    { UTIL_UINT64(0xD3515C2831559A83), UTIL_UINT64(0x0D5A5B44CA873E03) },
+    { UTIL_UINT64(0x8412D9991ED58091), UTIL_UINT64(0xE858790AFE9486C2) },
+    { UTIL_UINT64(0xA5178FFF668AE0B6), UTIL_UINT64(0x626E974DBE39A872) },
+    { UTIL_UINT64(0xCE5D73FF402D98E3), UTIL_UINT64(0xFB0A3D212DC8128F) },
+    { UTIL_UINT64(0x80FA687F881C7F8E), UTIL_UINT64(0x7CE66634BC9D0B99) },
+    { UTIL_UINT64(0xA139029F6A239F72), UTIL_UINT64(0x1C1FFFC1EBC44E80) },
+    { UTIL_UINT64(0xC987434744AC874E), UTIL_UINT64(0xA327FFB266B56220) },
+    { UTIL_UINT64(0xFBE9141915D7A922), UTIL_UINT64(0x4BF1FF9F0062BAA8) },
+    { UTIL_UINT64(0x9D71AC8FADA6C9B5), UTIL_UINT64(0x6F773FC3603DB4A9) },
+    { UTIL_UINT64(0xC4CE17B399107C22), UTIL_UINT64(0xCB550FB4384D21D3) },
+    { UTIL_UINT64(0xF6019DA07F549B2B), UTIL_UINT64(0x7E2A53A146606A48) },
+    { UTIL_UINT64(0x99C102844F94E0FB), UTIL_UINT64(0x2EDA7444CBFC426D) },
+    { UTIL_UINT64(0xC0314325637A1939), UTIL_UINT64(0xFA911155FEFB5308) },
+    { UTIL_UINT64(0xF03D93EEBC589F88), UTIL_UINT64(0x793555AB7EBA27CA) },
+    { UTIL_UINT64(0x96267C7535B763B5), UTIL_UINT64(0x4BC1558B2F3458DE) },
+    { UTIL_UINT64(0xBBB01B9283253CA2), UTIL_UINT64(0x9EB1AAEDFB016F16) },
+    { UTIL_UINT64(0xEA9C227723EE8BCB), UTIL_UINT64(0x465E15A979C1CADC) },
+    { UTIL_UINT64(0x92A1958A7675175F), UTIL_UINT64(0x0BFACD89EC191EC9) },
+    { UTIL_UINT64(0xB749FAED14125D36), UTIL_UINT64(0xCEF980EC671F667B) },
+    { UTIL_UINT64(0xE51C79A85916F484), UTIL_UINT64(0x82B7E12780E7401A) },
+    { UTIL_UINT64(0x8F31CC0937AE58D2), UTIL_UINT64(0xD1B2ECB8B0908810) },
+    { UTIL_UINT64(0xB2FE3F0B8599EF07), UTIL_UINT64(0x861FA7E6DCB4AA15) },
+    { UTIL_UINT64(0xDFBDCECE67006AC9), UTIL_UINT64(0x67A791E093E1D49A) },
+    { UTIL_UINT64(0x8BD6A141006042BD), UTIL_UINT64(0xE0C8BB2C5C6D24E0) },
+    { UTIL_UINT64(0xAECC49914078536D), UTIL_UINT64(0x58FAE9F773886E18) },
+    { UTIL_UINT64(0xDA7F5BF590966848), UTIL_UINT64(0xAF39A475506A899E) },
+    { UTIL_UINT64(0x888F99797A5E012D), UTIL_UINT64(0x6D8406C952429603) },
+    { UTIL_UINT64(0xAAB37FD7D8F58178), UTIL_UINT64(0xC8E5087BA6D33B83) },
+    { UTIL_UINT64(0xD5605FCDCF32E1D6), UTIL_UINT64(0xFB1E4A9A90880A64) },
+    { UTIL_UINT64(0x855C3BE0A17FCD26), UTIL_UINT64(0x5CF2EEA09A55067F) },
+    { UTIL_UINT64(0xA6B34AD8C9DFC06F), UTIL_UINT64(0xF42FAA48C0EA481E) },
+    { UTIL_UINT64(0xD0601D8EFC57B08B), UTIL_UINT64(0xF13B94DAF124DA26) },
+    { UTIL_UINT64(0x823C12795DB6CE57), UTIL_UINT64(0x76C53D08D6B70858) },
+    { UTIL_UINT64(0xA2CB1717B52481ED), UTIL_UINT64(0x54768C4B0C64CA6E) },
+    { UTIL_UINT64(0xCB7DDCDDA26DA268), UTIL_UINT64(0xA9942F5DCF7DFD09) },
+    { UTIL_UINT64(0xFE5D54150B090B02), UTIL_UINT64(0xD3F93B35435D7C4C) },
+    { UTIL_UINT64(0x9EFA548D26E5A6E1), UTIL_UINT64(0xC47BC5014A1A6DAF) },
+    { UTIL_UINT64(0xC6B8E9B0709F109A), UTIL_UINT64(0x359AB6419CA1091B) },
+    { UTIL_UINT64(0xF867241C8CC6D4C0), UTIL_UINT64(0xC30163D203C94B62) },
+    { UTIL_UINT64(0x9B407691D7FC44F8), UTIL_UINT64(0x79E0DE63425DCF1D) },
+    { UTIL_UINT64(0xC21094364DFB5636), UTIL_UINT64(0x985915FC12F542E4) },
+    { UTIL_UINT64(0xF294B943E17A2BC4), UTIL_UINT64(0x3E6F5B7B17B2939D) },
+    { UTIL_UINT64(0x979CF3CA6CEC5B5A), UTIL_UINT64(0xA705992CEECF9C42) },
+    { UTIL_UINT64(0xBD8430BD08277231), UTIL_UINT64(0x50C6FF782A838353) },
+    { UTIL_UINT64(0xECE53CEC4A314EBD), UTIL_UINT64(0xA4F8BF5635246428) },
+    { UTIL_UINT64(0x940F4613AE5ED136), UTIL_UINT64(0x871B7795E136BE99) },
+    { UTIL_UINT64(0xB913179899F68584), UTIL_UINT64(0x28E2557B59846E3F) },
+    { UTIL_UINT64(0xE757DD7EC07426E5), UTIL_UINT64(0x331AEADA2FE589CF) },
+    { UTIL_UINT64(0x9096EA6F3848984F), UTIL_UINT64(0x3FF0D2C85DEF7621) },
+    { UTIL_UINT64(0xB4BCA50B065ABE63), UTIL_UINT64(0x0FED077A756B53A9) },
+    { UTIL_UINT64(0xE1EBCE4DC7F16DFB), UTIL_UINT64(0xD3E8495912C62894) },
+    { UTIL_UINT64(0x8D3360F09CF6E4BD), UTIL_UINT64(0x64712DD7ABBBD95C) },
+    { UTIL_UINT64(0xB080392CC4349DEC), UTIL_UINT64(0xBD8D794D96AACFB3) },
+    { UTIL_UINT64(0xDCA04777F541C567), UTIL_UINT64(0xECF0D7A0FC5583A0) },
+    { UTIL_UINT64(0x89E42CAAF9491B60), UTIL_UINT64(0xF41686C49DB57244) },
+    { UTIL_UINT64(0xAC5D37D5B79B6239), UTIL_UINT64(0x311C2875C522CED5) },
+    { UTIL_UINT64(0xD77485CB25823AC7), UTIL_UINT64(0x7D633293366B828B) },
+    { UTIL_UINT64(0x86A8D39EF77164BC), UTIL_UINT64(0xAE5DFF9C02033197) },
+    { UTIL_UINT64(0xA8530886B54DBDEB), UTIL_UINT64(0xD9F57F830283FDFC) },
+    { UTIL_UINT64(0xD267CAA862A12D66), UTIL_UINT64(0xD072DF63C324FD7B) },
+    { UTIL_UINT64(0x8380DEA93DA4BC60), UTIL_UINT64(0x4247CB9E59F71E6D) },
+    { UTIL_UINT64(0xA46116538D0DEB78), UTIL_UINT64(0x52D9BE85F074E608) },
+    { UTIL_UINT64(0xCD795BE870516656), UTIL_UINT64(0x67902E276C921F8B) },
+    { UTIL_UINT64(0x806BD9714632DFF6), UTIL_UINT64(0x00BA1CD8A3DB53B6) },
+    { UTIL_UINT64(0xA086CFCD97BF97F3), UTIL_UINT64(0x80E8A40ECCD228A4) },
+    { UTIL_UINT64(0xC8A883C0FDAF7DF0), UTIL_UINT64(0x6122CD128006B2CD) },
+    { UTIL_UINT64(0xFAD2A4B13D1B5D6C), UTIL_UINT64(0x796B805720085F81) },
+    { UTIL_UINT64(0x9CC3A6EEC6311A63), UTIL_UINT64(0xCBE3303674053BB0) },
+    { UTIL_UINT64(0xC3F490AA77BD60FC), UTIL_UINT64(0xBEDBFC4411068A9C) },
+    { UTIL_UINT64(0xF4F1B4D515ACB93B), UTIL_UINT64(0xEE92FB5515482D44) },
+    { UTIL_UINT64(0x991711052D8BF3C5), UTIL_UINT64(0x751BDD152D4D1C4A) },
+    { UTIL_UINT64(0xBF5CD54678EEF0B6), UTIL_UINT64(0xD262D45A78A0635D) },
+    { UTIL_UINT64(0xEF340A98172AACE4), UTIL_UINT64(0x86FB897116C87C34) },
+    { UTIL_UINT64(0x9580869F0E7AAC0E), UTIL_UINT64(0xD45D35E6AE3D4DA0) },
+    { UTIL_UINT64(0xBAE0A846D2195712), UTIL_UINT64(0x8974836059CCA109) },
+    { UTIL_UINT64(0xE998D258869FACD7), UTIL_UINT64(0x2BD1A438703FC94B) },
+    { UTIL_UINT64(0x91FF83775423CC06), UTIL_UINT64(0x7B6306A34627DDCF) },
+    { UTIL_UINT64(0xB67F6455292CBF08), UTIL_UINT64(0x1A3BC84C17B1D542) },
+    { UTIL_UINT64(0xE41F3D6A7377EECA), UTIL_UINT64(0x20CABA5F1D9E4A93) },
+    { UTIL_UINT64(0x8E938662882AF53E), UTIL_UINT64(0x547EB47B7282EE9C) },
+    { UTIL_UINT64(0xB23867FB2A35B28D), UTIL_UINT64(0xE99E619A4F23AA43) },
+    { UTIL_UINT64(0xDEC681F9F4C31F31), UTIL_UINT64(0x6405FA00E2EC94D4) },
+    { UTIL_UINT64(0x8B3C113C38F9F37E), UTIL_UINT64(0xDE83BC408DD3DD04) },
+    { UTIL_UINT64(0xAE0B158B4738705E), UTIL_UINT64(0x9624AB50B148D445) },
+    { UTIL_UINT64(0xD98DDAEE19068C76), UTIL_UINT64(0x3BADD624DD9B0957) },
+    { UTIL_UINT64(0x87F8A8D4CFA417C9), UTIL_UINT64(0xE54CA5D70A80E5D6) },
+    { UTIL_UINT64(0xA9F6D30A038D1DBC), UTIL_UINT64(0x5E9FCF4CCD211F4C) },
+    { UTIL_UINT64(0xD47487CC8470652B), UTIL_UINT64(0x7647C3200069671F) },
+    { UTIL_UINT64(0x84C8D4DFD2C63F3B), UTIL_UINT64(0x29ECD9F40041E073) },
+    { UTIL_UINT64(0xA5FB0A17C777CF09), UTIL_UINT64(0xF468107100525890) },
+    { UTIL_UINT64(0xCF79CC9DB955C2CC), UTIL_UINT64(0x7182148D4066EEB4) },
+    { UTIL_UINT64(0x81AC1FE293D599BF), UTIL_UINT64(0xC6F14CD848405530) },
+    { UTIL_UINT64(0xA21727DB38CB002F), UTIL_UINT64(0xB8ADA00E5A506A7C) },
+    { UTIL_UINT64(0xCA9CF1D206FDC03B), UTIL_UINT64(0xA6D90811F0E4851C) },
+    { UTIL_UINT64(0xFD442E4688BD304A), UTIL_UINT64(0x908F4A166D1DA663) },
+    { UTIL_UINT64(0x9E4A9CEC15763E2E), UTIL_UINT64(0x9A598E4E043287FE) },
+    { UTIL_UINT64(0xC5DD44271AD3CDBA), UTIL_UINT64(0x40EFF1E1853F29FD) },
+    { UTIL_UINT64(0xF7549530E188C128), UTIL_UINT64(0xD12BEE59E68EF47C) },
+    { UTIL_UINT64(0x9A94DD3E8CF578B9), UTIL_UINT64(0x82BB74F8301958CE) },
+    { UTIL_UINT64(0xC13A148E3032D6E7), UTIL_UINT64(0xE36A52363C1FAF01) },
+    { UTIL_UINT64(0xF18899B1BC3F8CA1), UTIL_UINT64(0xDC44E6C3CB279AC1) },
+    { UTIL_UINT64(0x96F5600F15A7B7E5), UTIL_UINT64(0x29AB103A5EF8C0B9) },
+    { UTIL_UINT64(0xBCB2B812DB11A5DE), UTIL_UINT64(0x7415D448F6B6F0E7) },
+    { UTIL_UINT64(0xEBDF661791D60F56), UTIL_UINT64(0x111B495B3464AD21) },
+    { UTIL_UINT64(0x936B9FCEBB25C995), UTIL_UINT64(0xCAB10DD900BEEC34) },
+    { UTIL_UINT64(0xB84687C269EF3BFB), UTIL_UINT64(0x3D5D514F40EEA742) },
+    { UTIL_UINT64(0xE65829B3046B0AFA), UTIL_UINT64(0x0CB4A5A3112A5112) },
+    { UTIL_UINT64(0x8FF71A0FE2C2E6DC), UTIL_UINT64(0x47F0E785EABA72AB) },
+    { UTIL_UINT64(0xB3F4E093DB73A093), UTIL_UINT64(0x59ED216765690F56) },
+    { UTIL_UINT64(0xE0F218B8D25088B8), UTIL_UINT64(0x306869C13EC3532C) },
+    { UTIL_UINT64(0x8C974F7383725573), UTIL_UINT64(0x1E414218C73A13FB) },
+    { UTIL_UINT64(0xAFBD2350644EEACF), UTIL_UINT64(0xE5D1929EF90898FA) },
+    { UTIL_UINT64(0xDBAC6C247D62A583), UTIL_UINT64(0xDF45F746B74ABF39) },
+    { UTIL_UINT64(0x894BC396CE5DA772), UTIL_UINT64(0x6B8BBA8C328EB783) },
+    { UTIL_UINT64(0xAB9EB47C81F5114F), UTIL_UINT64(0x066EA92F3F326564) },
+    { UTIL_UINT64(0xD686619BA27255A2), UTIL_UINT64(0xC80A537B0EFEFEBD) },
+    { UTIL_UINT64(0x8613FD0145877585), UTIL_UINT64(0xBD06742CE95F5F36) },
+    { UTIL_UINT64(0xA798FC4196E952E7), UTIL_UINT64(0x2C48113823B73704) },
+    { UTIL_UINT64(0xD17F3B51FCA3A7A0), UTIL_UINT64(0xF75A15862CA504C5) },
+    { UTIL_UINT64(0x82EF85133DE648C4), UTIL_UINT64(0x9A984D73DBE722FB) },
+    { UTIL_UINT64(0xA3AB66580D5FDAF5), UTIL_UINT64(0xC13E60D0D2E0EBBA) },
+    { UTIL_UINT64(0xCC963FEE10B7D1B3), UTIL_UINT64(0x318DF905079926A8) },
+    { UTIL_UINT64(0xFFBBCFE994E5C61F), UTIL_UINT64(0xFDF17746497F7052) },
+    { UTIL_UINT64(0x9FD561F1FD0F9BD3), UTIL_UINT64(0xFEB6EA8BEDEFA633) },
+    { UTIL_UINT64(0xC7CABA6E7C5382C8), UTIL_UINT64(0xFE64A52EE96B8FC0) },
+    { UTIL_UINT64(0xF9BD690A1B68637B), UTIL_UINT64(0x3DFDCE7AA3C673B0) },
+    { UTIL_UINT64(0x9C1661A651213E2D), UTIL_UINT64(0x06BEA10CA65C084E) },
+    { UTIL_UINT64(0xC31BFA0FE5698DB8), UTIL_UINT64(0x486E494FCFF30A62) },
+    { UTIL_UINT64(0xF3E2F893DEC3F126), UTIL_UINT64(0x5A89DBA3C3EFCCFA) },
+    { UTIL_UINT64(0x986DDB5C6B3A76B7), UTIL_UINT64(0xF89629465A75E01C) },
+    { UTIL_UINT64(0xBE89523386091465), UTIL_UINT64(0xF6BBB397F1135823) },
+    { UTIL_UINT64(0xEE2BA6C0678B597F), UTIL_UINT64(0x746AA07DED582E2C) },
+    { UTIL_UINT64(0x94DB483840B717EF), UTIL_UINT64(0xA8C2A44EB4571CDC) },
+    { UTIL_UINT64(0xBA121A4650E4DDEB), UTIL_UINT64(0x92F34D62616CE413) },
+    { UTIL_UINT64(0xE896A0D7E51E1566), UTIL_UINT64(0x77B020BAF9C81D17) },
+    { UTIL_UINT64(0x915E2486EF32CD60), UTIL_UINT64(0x0ACE1474DC1D122E) },
+    { UTIL_UINT64(0xB5B5ADA8AAFF80B8), UTIL_UINT64(0x0D819992132456BA) },
+    { UTIL_UINT64(0xE3231912D5BF60E6), UTIL_UINT64(0x10E1FFF697ED6C69) },
+    { UTIL_UINT64(0x8DF5EFABC5979C8F), UTIL_UINT64(0xCA8D3FFA1EF463C1) },
+    { UTIL_UINT64(0xB1736B96B6FD83B3), UTIL_UINT64(0xBD308FF8A6B17CB2) },
+    { UTIL_UINT64(0xDDD0467C64BCE4A0), UTIL_UINT64(0xAC7CB3F6D05DDBDE) },
+    { UTIL_UINT64(0x8AA22C0DBEF60EE4), UTIL_UINT64(0x6BCDF07A423AA96B) },
+    { UTIL_UINT64(0xAD4AB7112EB3929D), UTIL_UINT64(0x86C16C98D2C953C6) },
+    { UTIL_UINT64(0xD89D64D57A607744), UTIL_UINT64(0xE871C7BF077BA8B7) },
+    { UTIL_UINT64(0x87625F056C7C4A8B), UTIL_UINT64(0x11471CD764AD4972) },
+    { UTIL_UINT64(0xA93AF6C6C79B5D2D), UTIL_UINT64(0xD598E40D3DD89BCF) },
+    { UTIL_UINT64(0xD389B47879823479), UTIL_UINT64(0x4AFF1D108D4EC2C3) },
+    { UTIL_UINT64(0x843610CB4BF160CB), UTIL_UINT64(0xCEDF722A585139BA) },
+    { UTIL_UINT64(0xA54394FE1EEDB8FE), UTIL_UINT64(0xC2974EB4EE658828) },
+    { UTIL_UINT64(0xCE947A3DA6A9273E), UTIL_UINT64(0x733D226229FEEA32) },
+    { UTIL_UINT64(0x811CCC668829B887), UTIL_UINT64(0x0806357D5A3F525F) },
+    { UTIL_UINT64(0xA163FF802A3426A8), UTIL_UINT64(0xCA07C2DCB0CF26F7) },
+    { UTIL_UINT64(0xC9BCFF6034C13052), UTIL_UINT64(0xFC89B393DD02F0B5) },
+    { UTIL_UINT64(0xFC2C3F3841F17C67), UTIL_UINT64(0xBBAC2078D443ACE2) },
+    { UTIL_UINT64(0x9D9BA7832936EDC0), UTIL_UINT64(0xD54B944B84AA4C0D) },
+    { UTIL_UINT64(0xC5029163F384A931), UTIL_UINT64(0x0A9E795E65D4DF11) },
+    { UTIL_UINT64(0xF64335BCF065D37D), UTIL_UINT64(0x4D4617B5FF4A16D5) },
+    { UTIL_UINT64(0x99EA0196163FA42E), UTIL_UINT64(0x504BCED1BF8E4E45) },
+    { UTIL_UINT64(0xC06481FB9BCF8D39), UTIL_UINT64(0xE45EC2862F71E1D6) },
+    { UTIL_UINT64(0xF07DA27A82C37088), UTIL_UINT64(0x5D767327BB4E5A4C) },
+    { UTIL_UINT64(0x964E858C91BA2655), UTIL_UINT64(0x3A6A07F8D510F86F) },
+    { UTIL_UINT64(0xBBE226EFB628AFEA), UTIL_UINT64(0x890489F70A55368B) },
+    { UTIL_UINT64(0xEADAB0ABA3B2DBE5), UTIL_UINT64(0x2B45AC74CCEA842E) },
+    { UTIL_UINT64(0x92C8AE6B464FC96F), UTIL_UINT64(0x3B0B8BC90012929D) },
+    { UTIL_UINT64(0xB77ADA0617E3BBCB), UTIL_UINT64(0x09CE6EBB40173744) },
+    { UTIL_UINT64(0xE55990879DDCAABD), UTIL_UINT64(0xCC420A6A101D0515) },
+    { UTIL_UINT64(0x8F57FA54C2A9EAB6), UTIL_UINT64(0x9FA946824A12232D) },
+    { UTIL_UINT64(0xB32DF8E9F3546564), UTIL_UINT64(0x47939822DC96ABF9) },
+    { UTIL_UINT64(0xDFF9772470297EBD), UTIL_UINT64(0x59787E2B93BC56F7) },
+    { UTIL_UINT64(0x8BFBEA76C619EF36), UTIL_UINT64(0x57EB4EDB3C55B65A) },
+    { UTIL_UINT64(0xAEFAE51477A06B03), UTIL_UINT64(0xEDE622920B6B23F1) },
+    { UTIL_UINT64(0xDAB99E59958885C4), UTIL_UINT64(0xE95FAB368E45ECED) },
+    { UTIL_UINT64(0x88B402F7FD75539B), UTIL_UINT64(0x11DBCB0218EBB414) },
+    { UTIL_UINT64(0xAAE103B5FCD2A881), UTIL_UINT64(0xD652BDC29F26A119) },
+    { UTIL_UINT64(0xD59944A37C0752A2), UTIL_UINT64(0x4BE76D3346F0495F) },
+    { UTIL_UINT64(0x857FCAE62D8493A5), UTIL_UINT64(0x6F70A4400C562DDB) },
+    { UTIL_UINT64(0xA6DFBD9FB8E5B88E), UTIL_UINT64(0xCB4CCD500F6BB952) },
+    { UTIL_UINT64(0xD097AD07A71F26B2), UTIL_UINT64(0x7E2000A41346A7A7) },
+    { UTIL_UINT64(0x825ECC24C873782F), UTIL_UINT64(0x8ED400668C0C28C8) },
+    { UTIL_UINT64(0xA2F67F2DFA90563B), UTIL_UINT64(0x728900802F0F32FA) },
+    { UTIL_UINT64(0xCBB41EF979346BCA), UTIL_UINT64(0x4F2B40A03AD2FFB9) },
+    { UTIL_UINT64(0xFEA126B7D78186BC), UTIL_UINT64(0xE2F610C84987BFA8) },
+    { UTIL_UINT64(0x9F24B832E6B0F436), UTIL_UINT64(0x0DD9CA7D2DF4D7C9) },
+    { UTIL_UINT64(0xC6EDE63FA05D3143), UTIL_UINT64(0x91503D1C79720DBB) },
+    { UTIL_UINT64(0xF8A95FCF88747D94), UTIL_UINT64(0x75A44C6397CE912A) },
+    { UTIL_UINT64(0x9B69DBE1B548CE7C), UTIL_UINT64(0xC986AFBE3EE11ABA) },
+    { UTIL_UINT64(0xC24452DA229B021B), UTIL_UINT64(0xFBE85BADCE996168) },
+    { UTIL_UINT64(0xF2D56790AB41C2A2), UTIL_UINT64(0xFAE27299423FB9C3) },
+    { UTIL_UINT64(0x97C560BA6B0919A5), UTIL_UINT64(0xDCCD879FC967D41A) },
+    { UTIL_UINT64(0xBDB6B8E905CB600F), UTIL_UINT64(0x5400E987BBC1C920) },
+    { UTIL_UINT64(0xED246723473E3813), UTIL_UINT64(0x290123E9AAB23B68) },
+    { UTIL_UINT64(0x9436C0760C86E30B), UTIL_UINT64(0xF9A0B6720AAF6521) },
+    { UTIL_UINT64(0xB94470938FA89BCE), UTIL_UINT64(0xF808E40E8D5B3E69) },
+    { UTIL_UINT64(0xE7958CB87392C2C2), UTIL_UINT64(0xB60B1D1230B20E04) },
+    { UTIL_UINT64(0x90BD77F3483BB9B9), UTIL_UINT64(0xB1C6F22B5E6F48C2) },
+    { UTIL_UINT64(0xB4ECD5F01A4AA828), UTIL_UINT64(0x1E38AEB6360B1AF3) },
+    { UTIL_UINT64(0xE2280B6C20DD5232), UTIL_UINT64(0x25C6DA63C38DE1B0) },
+    { UTIL_UINT64(0x8D590723948A535F), UTIL_UINT64(0x579C487E5A38AD0E) },
+    { UTIL_UINT64(0xB0AF48EC79ACE837), UTIL_UINT64(0x2D835A9DF0C6D851) },
+    { UTIL_UINT64(0xDCDB1B2798182244), UTIL_UINT64(0xF8E431456CF88E65) },
+    { UTIL_UINT64(0x8A08F0F8BF0F156B), UTIL_UINT64(0x1B8E9ECB641B58FF) },
+    { UTIL_UINT64(0xAC8B2D36EED2DAC5), UTIL_UINT64(0xE272467E3D222F3F) },
+    { UTIL_UINT64(0xD7ADF884AA879177), UTIL_UINT64(0x5B0ED81DCC6ABB0F) },
+    { UTIL_UINT64(0x86CCBB52EA94BAEA), UTIL_UINT64(0x98E947129FC2B4E9) },
+    { UTIL_UINT64(0xA87FEA27A539E9A5), UTIL_UINT64(0x3F2398D747B36224) },
+    { UTIL_UINT64(0xD29FE4B18E88640E), UTIL_UINT64(0x8EEC7F0D19A03AAD) },
+    { UTIL_UINT64(0x83A3EEEEF9153E89), UTIL_UINT64(0x1953CF68300424AC) },
+    { UTIL_UINT64(0xA48CEAAAB75A8E2B), UTIL_UINT64(0x5FA8C3423C052DD7) },
+    { UTIL_UINT64(0xCDB02555653131B6), UTIL_UINT64(0x3792F412CB06794D) },
+    { UTIL_UINT64(0x808E17555F3EBF11), UTIL_UINT64(0xE2BBD88BBEE40BD0) },
+    { UTIL_UINT64(0xA0B19D2AB70E6ED6), UTIL_UINT64(0x5B6ACEAEAE9D0EC4) },
+    { UTIL_UINT64(0xC8DE047564D20A8B), UTIL_UINT64(0xF245825A5A445275) },
+    { UTIL_UINT64(0xFB158592BE068D2E), UTIL_UINT64(0xEED6E2F0F0D56712) },
+    { UTIL_UINT64(0x9CED737BB6C4183D), UTIL_UINT64(0x55464DD69685606B) },
+    { UTIL_UINT64(0xC428D05AA4751E4C), UTIL_UINT64(0xAA97E14C3C26B886) },
+    { UTIL_UINT64(0xF53304714D9265DF), UTIL_UINT64(0xD53DD99F4B3066A8) },
+    { UTIL_UINT64(0x993FE2C6D07B7FAB), UTIL_UINT64(0xE546A8038EFE4029) },
+    { UTIL_UINT64(0xBF8FDB78849A5F96), UTIL_UINT64(0xDE98520472BDD033) },
+    { UTIL_UINT64(0xEF73D256A5C0F77C), UTIL_UINT64(0x963E66858F6D4440) },
+    { UTIL_UINT64(0x95A8637627989AAD), UTIL_UINT64(0xDDE7001379A44AA8) },
+    { UTIL_UINT64(0xBB127C53B17EC159), UTIL_UINT64(0x5560C018580D5D52) },
+    { UTIL_UINT64(0xE9D71B689DDE71AF), UTIL_UINT64(0xAAB8F01E6E10B4A6) },
+    { UTIL_UINT64(0x9226712162AB070D), UTIL_UINT64(0xCAB3961304CA70E8) },
+    { UTIL_UINT64(0xB6B00D69BB55C8D1), UTIL_UINT64(0x3D607B97C5FD0D22) },
+    { UTIL_UINT64(0xE45C10C42A2B3B05), UTIL_UINT64(0x8CB89A7DB77C506A) },
+    { UTIL_UINT64(0x8EB98A7A9A5B04E3), UTIL_UINT64(0x77F3608E92ADB242) },
+    { UTIL_UINT64(0xB267ED1940F1C61C), UTIL_UINT64(0x55F038B237591ED3) },
+    { UTIL_UINT64(0xDF01E85F912E37A3), UTIL_UINT64(0x6B6C46DEC52F6688) },
+    { UTIL_UINT64(0x8B61313BBABCE2C6), UTIL_UINT64(0x2323AC4B3B3DA015) },
+    { UTIL_UINT64(0xAE397D8AA96C1B77), UTIL_UINT64(0xABEC975E0A0D081A) },
+    { UTIL_UINT64(0xD9C7DCED53C72255), UTIL_UINT64(0x96E7BD358C904A21) },
+    { UTIL_UINT64(0x881CEA14545C7575), UTIL_UINT64(0x7E50D64177DA2E54) },
+    { UTIL_UINT64(0xAA242499697392D2), UTIL_UINT64(0xDDE50BD1D5D0B9E9) },
+    { UTIL_UINT64(0xD4AD2DBFC3D07787), UTIL_UINT64(0x955E4EC64B44E864) },
+    { UTIL_UINT64(0x84EC3C97DA624AB4), UTIL_UINT64(0xBD5AF13BEF0B113E) },
+    { UTIL_UINT64(0xA6274BBDD0FADD61), UTIL_UINT64(0xECB1AD8AEACDD58E) },
+    { UTIL_UINT64(0xCFB11EAD453994BA), UTIL_UINT64(0x67DE18EDA5814AF2) },
+    { UTIL_UINT64(0x81CEB32C4B43FCF4), UTIL_UINT64(0x80EACF948770CED7) },
+    { UTIL_UINT64(0xA2425FF75E14FC31), UTIL_UINT64(0xA1258379A94D028D) },
+    { UTIL_UINT64(0xCAD2F7F5359A3B3E), UTIL_UINT64(0x096EE45813A04330) },
+    { UTIL_UINT64(0xFD87B5F28300CA0D), UTIL_UINT64(0x8BCA9D6E188853FC) },
+    { UTIL_UINT64(0x9E74D1B791E07E48), UTIL_UINT64(0x775EA264CF55347E) },
+    { UTIL_UINT64(0xC612062576589DDA), UTIL_UINT64(0x95364AFE032A819E) },
+    { UTIL_UINT64(0xF79687AED3EEC551), UTIL_UINT64(0x3A83DDBD83F52205) },
+    { UTIL_UINT64(0x9ABE14CD44753B52), UTIL_UINT64(0xC4926A9672793543) },
+    { UTIL_UINT64(0xC16D9A0095928A27), UTIL_UINT64(0x75B7053C0F178294) },
+    { UTIL_UINT64(0xF1C90080BAF72CB1), UTIL_UINT64(0x5324C68B12DD6339) },
+    { UTIL_UINT64(0x971DA05074DA7BEE), UTIL_UINT64(0xD3F6FC16EBCA5E04) },
+    { UTIL_UINT64(0xBCE5086492111AEA), UTIL_UINT64(0x88F4BB1CA6BCF585) },
+    { UTIL_UINT64(0xEC1E4A7DB69561A5), UTIL_UINT64(0x2B31E9E3D06C32E6) },
+    { UTIL_UINT64(0x9392EE8E921D5D07), UTIL_UINT64(0x3AFF322E62439FD0) },
+    { UTIL_UINT64(0xB877AA3236A4B449), UTIL_UINT64(0x09BEFEB9FAD487C3) },
+    { UTIL_UINT64(0xE69594BEC44DE15B), UTIL_UINT64(0x4C2EBE687989A9B4) },
+    { UTIL_UINT64(0x901D7CF73AB0ACD9), UTIL_UINT64(0x0F9D37014BF60A11) },
+    { UTIL_UINT64(0xB424DC35095CD80F), UTIL_UINT64(0x538484C19EF38C95) },
+    { UTIL_UINT64(0xE12E13424BB40E13), UTIL_UINT64(0x2865A5F206B06FBA) },
+    { UTIL_UINT64(0x8CBCCC096F5088CB), UTIL_UINT64(0xF93F87B7442E45D4) },
+    { UTIL_UINT64(0xAFEBFF0BCB24AAFE), UTIL_UINT64(0xF78F69A51539D749) },
+    { UTIL_UINT64(0xDBE6FECEBDEDD5BE), UTIL_UINT64(0xB573440E5A884D1C) },
+    { UTIL_UINT64(0x89705F4136B4A597), UTIL_UINT64(0x31680A88F8953031) },
+    { UTIL_UINT64(0xABCC77118461CEFC), UTIL_UINT64(0xFDC20D2B36BA7C3E) },
+    { UTIL_UINT64(0xD6BF94D5E57A42BC), UTIL_UINT64(0x3D32907604691B4D) },
+    { UTIL_UINT64(0x8637BD05AF6C69B5), UTIL_UINT64(0xA63F9A49C2C1B110) },
+    { UTIL_UINT64(0xA7C5AC471B478423), UTIL_UINT64(0x0FCF80DC33721D54) },
+    { UTIL_UINT64(0xD1B71758E219652B), UTIL_UINT64(0xD3C36113404EA4A9) },
+    { UTIL_UINT64(0x83126E978D4FDF3B), UTIL_UINT64(0x645A1CAC083126EA) },
+    { UTIL_UINT64(0xA3D70A3D70A3D70A), UTIL_UINT64(0x3D70A3D70A3D70A4) },
+    { UTIL_UINT64(0xCCCCCCCCCCCCCCCC), UTIL_UINT64(0xCCCCCCCCCCCCCCCD) },
+    { UTIL_UINT64(0x8000000000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xA000000000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xC800000000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xFA00000000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x9C40000000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xC350000000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xF424000000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x9896800000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xBEBC200000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xEE6B280000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x9502F90000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xBA43B74000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xE8D4A51000000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x9184E72A00000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xB5E620F480000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xE35FA931A0000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x8E1BC9BF04000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xB1A2BC2EC5000000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xDE0B6B3A76400000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x8AC7230489E80000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xAD78EBC5AC620000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xD8D726B7177A8000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x878678326EAC9000), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xA968163F0A57B400), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xD3C21BCECCEDA100), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x84595161401484A0), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xA56FA5B99019A5C8), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0xCECB8F27F4200F3A), UTIL_UINT64(0x0000000000000000) },
+    { UTIL_UINT64(0x813F3978F8940984), UTIL_UINT64(0x4000000000000000) },
+    { UTIL_UINT64(0xA18F07D736B90BE5), UTIL_UINT64(0x5000000000000000) },
+    { UTIL_UINT64(0xC9F2C9CD04674EDE), UTIL_UINT64(0xA400000000000000) },
+    { UTIL_UINT64(0xFC6F7C4045812296), UTIL_UINT64(0x4D00000000000000) },
+    { UTIL_UINT64(0x9DC5ADA82B70B59D), UTIL_UINT64(0xF020000000000000) },
+    { UTIL_UINT64(0xC5371912364CE305), UTIL_UINT64(0x6C28000000000000) },
+    { UTIL_UINT64(0xF684DF56C3E01BC6), UTIL_UINT64(0xC732000000000000) },
+    { UTIL_UINT64(0x9A130B963A6C115C), UTIL_UINT64(0x3C7F400000000000) },
+    { UTIL_UINT64(0xC097CE7BC90715B3), UTIL_UINT64(0x4B9F100000000000) },
+    { UTIL_UINT64(0xF0BDC21ABB48DB20), UTIL_UINT64(0x1E86D40000000000) },
+    { UTIL_UINT64(0x96769950B50D88F4), UTIL_UINT64(0x1314448000000000) },
+    { UTIL_UINT64(0xBC143FA4E250EB31), UTIL_UINT64(0x17D955A000000000) },
+    { UTIL_UINT64(0xEB194F8E1AE525FD), UTIL_UINT64(0x5DCFAB0800000000) },
+    { UTIL_UINT64(0x92EFD1B8D0CF37BE), UTIL_UINT64(0x5AA1CAE500000000) },
+    { UTIL_UINT64(0xB7ABC627050305AD), UTIL_UINT64(0xF14A3D9E40000000) },
+    { UTIL_UINT64(0xE596B7B0C643C719), UTIL_UINT64(0x6D9CCD05D0000000) },
+    { UTIL_UINT64(0x8F7E32CE7BEA5C6F), UTIL_UINT64(0xE4820023A2000000) },
+    { UTIL_UINT64(0xB35DBF821AE4F38B), UTIL_UINT64(0xDDA2802C8A800000) },
+    { UTIL_UINT64(0xE0352F62A19E306E), UTIL_UINT64(0xD50B2037AD200000) },
+    { UTIL_UINT64(0x8C213D9DA502DE45), UTIL_UINT64(0x4526F422CC340000) },
+    { UTIL_UINT64(0xAF298D050E4395D6), UTIL_UINT64(0x9670B12B7F410000) },
+    { UTIL_UINT64(0xDAF3F04651D47B4C), UTIL_UINT64(0x3C0CDD765F114000) },
+    { UTIL_UINT64(0x88D8762BF324CD0F), UTIL_UINT64(0xA5880A69FB6AC800) },
+    { UTIL_UINT64(0xAB0E93B6EFEE0053), UTIL_UINT64(0x8EEA0D047A457A00) },
+    { UTIL_UINT64(0xD5D238A4ABE98068), UTIL_UINT64(0x72A4904598D6D880) },
+    { UTIL_UINT64(0x85A36366EB71F041), UTIL_UINT64(0x47A6DA2B7F864750) },
+    { UTIL_UINT64(0xA70C3C40A64E6C51), UTIL_UINT64(0x999090B65F67D924) },
+    { UTIL_UINT64(0xD0CF4B50CFE20765), UTIL_UINT64(0xFFF4B4E3F741CF6D) },
+    { UTIL_UINT64(0x82818F1281ED449F), UTIL_UINT64(0xBFF8F10E7A8921A4) },
+    { UTIL_UINT64(0xA321F2D7226895C7), UTIL_UINT64(0xAFF72D52192B6A0D) },
+    { UTIL_UINT64(0xCBEA6F8CEB02BB39), UTIL_UINT64(0x9BF4F8A69F764490) },
+    { UTIL_UINT64(0xFEE50B7025C36A08), UTIL_UINT64(0x02F236D04753D5B4) },
+    { UTIL_UINT64(0x9F4F2726179A2245), UTIL_UINT64(0x01D762422C946590) },
+    { UTIL_UINT64(0xC722F0EF9D80AAD6), UTIL_UINT64(0x424D3AD2B7B97EF5) },
+    { UTIL_UINT64(0xF8EBAD2B84E0D58B), UTIL_UINT64(0xD2E0898765A7DEB2) },
+    { UTIL_UINT64(0x9B934C3B330C8577), UTIL_UINT64(0x63CC55F49F88EB2F) },
+    { UTIL_UINT64(0xC2781F49FFCFA6D5), UTIL_UINT64(0x3CBF6B71C76B25FB) },
+    { UTIL_UINT64(0xF316271C7FC3908A), UTIL_UINT64(0x8BEF464E3945EF7A) },
+    { UTIL_UINT64(0x97EDD871CFDA3A56), UTIL_UINT64(0x97758BF0E3CBB5AC) },
+    { UTIL_UINT64(0xBDE94E8E43D0C8EC), UTIL_UINT64(0x3D52EEED1CBEA317) },
+    { UTIL_UINT64(0xED63A231D4C4FB27), UTIL_UINT64(0x4CA7AAA863EE4BDD) },
+    { UTIL_UINT64(0x945E455F24FB1CF8), UTIL_UINT64(0x8FE8CAA93E74EF6A) },
+    { UTIL_UINT64(0xB975D6B6EE39E436), UTIL_UINT64(0xB3E2FD538E122B44) },
+    { UTIL_UINT64(0xE7D34C64A9C85D44), UTIL_UINT64(0x60DBBCA87196B616) },
+    { UTIL_UINT64(0x90E40FBEEA1D3A4A), UTIL_UINT64(0xBC8955E946FE31CD) },
+    { UTIL_UINT64(0xB51D13AEA4A488DD), UTIL_UINT64(0x6BABAB6398BDBE41) },
+    { UTIL_UINT64(0xE264589A4DCDAB14), UTIL_UINT64(0xC696963C7EED2DD1) },
+    { UTIL_UINT64(0x8D7EB76070A08AEC), UTIL_UINT64(0xFC1E1DE5CF543CA2) },
+    { UTIL_UINT64(0xB0DE65388CC8ADA8), UTIL_UINT64(0x3B25A55F43294BCB) },
+    { UTIL_UINT64(0xDD15FE86AFFAD912), UTIL_UINT64(0x49EF0EB713F39EBE) },
+    { UTIL_UINT64(0x8A2DBF142DFCC7AB), UTIL_UINT64(0x6E3569326C784337) },
+    { UTIL_UINT64(0xACB92ED9397BF996), UTIL_UINT64(0x49C2C37F07965404) },
+    { UTIL_UINT64(0xD7E77A8F87DAF7FB), UTIL_UINT64(0xDC33745EC97BE906) },
+    { UTIL_UINT64(0x86F0AC99B4E8DAFD), UTIL_UINT64(0x69A028BB3DED71A3) },
+    { UTIL_UINT64(0xA8ACD7C0222311BC), UTIL_UINT64(0xC40832EA0D68CE0C) },
+    { UTIL_UINT64(0xD2D80DB02AABD62B), UTIL_UINT64(0xF50A3FA490C30190) },
+    { UTIL_UINT64(0x83C7088E1AAB65DB), UTIL_UINT64(0x792667C6DA79E0FA) },
+    { UTIL_UINT64(0xA4B8CAB1A1563F52), UTIL_UINT64(0x577001B891185938) },
+    { UTIL_UINT64(0xCDE6FD5E09ABCF26), UTIL_UINT64(0xED4C0226B55E6F86) },
+    { UTIL_UINT64(0x80B05E5AC60B6178), UTIL_UINT64(0x544F8158315B05B4) },
+    { UTIL_UINT64(0xA0DC75F1778E39D6), UTIL_UINT64(0x696361AE3DB1C721) },
+    { UTIL_UINT64(0xC913936DD571C84C), UTIL_UINT64(0x03BC3A19CD1E38E9) },
+    { UTIL_UINT64(0xFB5878494ACE3A5F), UTIL_UINT64(0x04AB48A04065C723) },
+    { UTIL_UINT64(0x9D174B2DCEC0E47B), UTIL_UINT64(0x62EB0D64283F9C76) },
+    { UTIL_UINT64(0xC45D1DF942711D9A), UTIL_UINT64(0x3BA5D0BD324F8394) },
+    { UTIL_UINT64(0xF5746577930D6500), UTIL_UINT64(0xCA8F44EC7EE36479) },
+    { UTIL_UINT64(0x9968BF6ABBE85F20), UTIL_UINT64(0x7E998B13CF4E1ECB) },
+    { UTIL_UINT64(0xBFC2EF456AE276E8), UTIL_UINT64(0x9E3FEDD8C321A67E) },
+    { UTIL_UINT64(0xEFB3AB16C59B14A2), UTIL_UINT64(0xC5CFE94EF3EA101E) },
+    { UTIL_UINT64(0x95D04AEE3B80ECE5), UTIL_UINT64(0xBBA1F1D158724A12) },
+    { UTIL_UINT64(0xBB445DA9CA61281F), UTIL_UINT64(0x2A8A6E45AE8EDC97) },
+    { UTIL_UINT64(0xEA1575143CF97226), UTIL_UINT64(0xF52D09D71A3293BD) },
+    { UTIL_UINT64(0x924D692CA61BE758), UTIL_UINT64(0x593C2626705F9C56) },
+    { UTIL_UINT64(0xB6E0C377CFA2E12E), UTIL_UINT64(0x6F8B2FB00C77836C) },
+    { UTIL_UINT64(0xE498F455C38B997A), UTIL_UINT64(0x0B6DFB9C0F956447) },
+    { UTIL_UINT64(0x8EDF98B59A373FEC), UTIL_UINT64(0x4724BD4189BD5EAC) },
+    { UTIL_UINT64(0xB2977EE300C50FE7), UTIL_UINT64(0x58EDEC91EC2CB657) },
+    { UTIL_UINT64(0xDF3D5E9BC0F653E1), UTIL_UINT64(0x2F2967B66737E3ED) },
+    { UTIL_UINT64(0x8B865B215899F46C), UTIL_UINT64(0xBD79E0D20082EE74) },
+    { UTIL_UINT64(0xAE67F1E9AEC07187), UTIL_UINT64(0xECD8590680A3AA11) },
+    { UTIL_UINT64(0xDA01EE641A708DE9), UTIL_UINT64(0xE80E6F4820CC9495) },
+    { UTIL_UINT64(0x884134FE908658B2), UTIL_UINT64(0x3109058D147FDCDD) },
+    { UTIL_UINT64(0xAA51823E34A7EEDE), UTIL_UINT64(0xBD4B46F0599FD415) },
+    { UTIL_UINT64(0xD4E5E2CDC1D1EA96), UTIL_UINT64(0x6C9E18AC7007C91A) },
+    { UTIL_UINT64(0x850FADC09923329E), UTIL_UINT64(0x03E2CF6BC604DDB0) },
+    { UTIL_UINT64(0xA6539930BF6BFF45), UTIL_UINT64(0x84DB8346B786151C) },
+    { UTIL_UINT64(0xCFE87F7CEF46FF16), UTIL_UINT64(0xE612641865679A63) },
+    { UTIL_UINT64(0x81F14FAE158C5F6E), UTIL_UINT64(0x4FCB7E8F3F60C07E) },
+    { UTIL_UINT64(0xA26DA3999AEF7749), UTIL_UINT64(0xE3BE5E330F38F09D) },
+    { UTIL_UINT64(0xCB090C8001AB551C), UTIL_UINT64(0x5CADF5BFD3072CC5) },
+    { UTIL_UINT64(0xFDCB4FA002162A63), UTIL_UINT64(0x73D9732FC7C8F7F6) },
+    { UTIL_UINT64(0x9E9F11C4014DDA7E), UTIL_UINT64(0x2867E7FDDCDD9AFA) },
+    { UTIL_UINT64(0xC646D63501A1511D), UTIL_UINT64(0xB281E1FD541501B8) },
+    { UTIL_UINT64(0xF7D88BC24209A565), UTIL_UINT64(0x1F225A7CA91A4226) },
+    { UTIL_UINT64(0x9AE757596946075F), UTIL_UINT64(0x3375788DE9B06958) },
+    { UTIL_UINT64(0xC1A12D2FC3978937), UTIL_UINT64(0x0052D6B1641C83AE) },
+    { UTIL_UINT64(0xF209787BB47D6B84), UTIL_UINT64(0xC0678C5DBD23A49A) },
+    { UTIL_UINT64(0x9745EB4D50CE6332), UTIL_UINT64(0xF840B7BA963646E0) },
+    { UTIL_UINT64(0xBD176620A501FBFF), UTIL_UINT64(0xB650E5A93BC3D898) },
+    { UTIL_UINT64(0xEC5D3FA8CE427AFF), UTIL_UINT64(0xA3E51F138AB4CEBE) },
+    { UTIL_UINT64(0x93BA47C980E98CDF), UTIL_UINT64(0xC66F336C36B10137) },
+    { UTIL_UINT64(0xB8A8D9BBE123F017), UTIL_UINT64(0xB80B0047445D4184) },
+    { UTIL_UINT64(0xE6D3102AD96CEC1D), UTIL_UINT64(0xA60DC059157491E5) },
+    { UTIL_UINT64(0x9043EA1AC7E41392), UTIL_UINT64(0x87C89837AD68DB2F) },
+    { UTIL_UINT64(0xB454E4A179DD1877), UTIL_UINT64(0x29BABE4598C311FB) },
+    { UTIL_UINT64(0xE16A1DC9D8545E94), UTIL_UINT64(0xF4296DD6FEF3D67A) },
+    { UTIL_UINT64(0x8CE2529E2734BB1D), UTIL_UINT64(0x1899E4A65F58660C) },
+    { UTIL_UINT64(0xB01AE745B101E9E4), UTIL_UINT64(0x5EC05DCFF72E7F8F) },
+    { UTIL_UINT64(0xDC21A1171D42645D), UTIL_UINT64(0x76707543F4FA1F73) },
+    { UTIL_UINT64(0x899504AE72497EBA), UTIL_UINT64(0x6A06494A791C53A8) },
+    { UTIL_UINT64(0xABFA45DA0EDBDE69), UTIL_UINT64(0x0487DB9D17636892) },
+    { UTIL_UINT64(0xD6F8D7509292D603), UTIL_UINT64(0x45A9D2845D3C42B6) },
+    { UTIL_UINT64(0x865B86925B9BC5C2), UTIL_UINT64(0x0B8A2392BA45A9B2) },
+    { UTIL_UINT64(0xA7F26836F282B732), UTIL_UINT64(0x8E6CAC7768D7141E) },
+    { UTIL_UINT64(0xD1EF0244AF2364FF), UTIL_UINT64(0x3207D795430CD926) },
+    { UTIL_UINT64(0x8335616AED761F1F), UTIL_UINT64(0x7F44E6BD49E807B8) },
+    { UTIL_UINT64(0xA402B9C5A8D3A6E7), UTIL_UINT64(0x5F16206C9C6209A6) },
+    { UTIL_UINT64(0xCD036837130890A1), UTIL_UINT64(0x36DBA887C37A8C0F) },
+    { UTIL_UINT64(0x802221226BE55A64), UTIL_UINT64(0xC2494954DA2C9789) },
+    { UTIL_UINT64(0xA02AA96B06DEB0FD), UTIL_UINT64(0xF2DB9BAA10B7BD6C) },
+    { UTIL_UINT64(0xC83553C5C8965D3D), UTIL_UINT64(0x6F92829494E5ACC7) },
+    { UTIL_UINT64(0xFA42A8B73ABBF48C), UTIL_UINT64(0xCB772339BA1F17F9) },
+    { UTIL_UINT64(0x9C69A97284B578D7), UTIL_UINT64(0xFF2A760414536EFB) },
+    { UTIL_UINT64(0xC38413CF25E2D70D), UTIL_UINT64(0xFEF5138519684ABA) },
+    { UTIL_UINT64(0xF46518C2EF5B8CD1), UTIL_UINT64(0x7EB258665FC25D69) },
+    { UTIL_UINT64(0x98BF2F79D5993802), UTIL_UINT64(0xEF2F773FFBD97A61) },
+    { UTIL_UINT64(0xBEEEFB584AFF8603), UTIL_UINT64(0xAAFB550FFACFD8FA) },
+    { UTIL_UINT64(0xEEAABA2E5DBF6784), UTIL_UINT64(0x95BA2A53F983CF38) },
+    { UTIL_UINT64(0x952AB45CFA97A0B2), UTIL_UINT64(0xDD945A747BF26183) },
+    { UTIL_UINT64(0xBA756174393D88DF), UTIL_UINT64(0x94F971119AEEF9E4) },
+    { UTIL_UINT64(0xE912B9D1478CEB17), UTIL_UINT64(0x7A37CD5601AAB85D) },
+    { UTIL_UINT64(0x91ABB422CCB812EE), UTIL_UINT64(0xAC62E055C10AB33A) },
+    { UTIL_UINT64(0xB616A12B7FE617AA), UTIL_UINT64(0x577B986B314D6009) },
+    { UTIL_UINT64(0xE39C49765FDF9D94), UTIL_UINT64(0xED5A7E85FDA0B80B) },
+    { UTIL_UINT64(0x8E41ADE9FBEBC27D), UTIL_UINT64(0x14588F13BE847307) },
+    { UTIL_UINT64(0xB1D219647AE6B31C), UTIL_UINT64(0x596EB2D8AE258FC8) },
+    { UTIL_UINT64(0xDE469FBD99A05FE3), UTIL_UINT64(0x6FCA5F8ED9AEF3BB) },
+    { UTIL_UINT64(0x8AEC23D680043BEE), UTIL_UINT64(0x25DE7BB9480D5854) },
+    { UTIL_UINT64(0xADA72CCC20054AE9), UTIL_UINT64(0xAF561AA79A10AE6A) },
+    { UTIL_UINT64(0xD910F7FF28069DA4), UTIL_UINT64(0x1B2BA1518094DA04) },
+    { UTIL_UINT64(0x87AA9AFF79042286), UTIL_UINT64(0x90FB44D2F05D0842) },
+    { UTIL_UINT64(0xA99541BF57452B28), UTIL_UINT64(0x353A1607AC744A53) },
+    { UTIL_UINT64(0xD3FA922F2D1675F2), UTIL_UINT64(0x42889B8997915CE8) },
+    { UTIL_UINT64(0x847C9B5D7C2E09B7), UTIL_UINT64(0x69956135FEBADA11) },
+    { UTIL_UINT64(0xA59BC234DB398C25), UTIL_UINT64(0x43FAB9837E699095) },
+    { UTIL_UINT64(0xCF02B2C21207EF2E), UTIL_UINT64(0x94F967E45E03F4BB) },
+    { UTIL_UINT64(0x8161AFB94B44F57D), UTIL_UINT64(0x1D1BE0EEBAC278F5) },
+    { UTIL_UINT64(0xA1BA1BA79E1632DC), UTIL_UINT64(0x6462D92A69731732) },
+    { UTIL_UINT64(0xCA28A291859BBF93), UTIL_UINT64(0x7D7B8F7503CFDCFE) },
+    { UTIL_UINT64(0xFCB2CB35E702AF78), UTIL_UINT64(0x5CDA735244C3D43E) },
+    { UTIL_UINT64(0x9DEFBF01B061ADAB), UTIL_UINT64(0x3A0888136AFA64A7) },
+    { UTIL_UINT64(0xC56BAEC21C7A1916), UTIL_UINT64(0x088AAA1845B8FDD0) },
+    { UTIL_UINT64(0xF6C69A72A3989F5B), UTIL_UINT64(0x8AAD549E57273D45) },
+    { UTIL_UINT64(0x9A3C2087A63F6399), UTIL_UINT64(0x36AC54E2F678864B) },
+    { UTIL_UINT64(0xC0CB28A98FCF3C7F), UTIL_UINT64(0x84576A1BB416A7DD) },
+    { UTIL_UINT64(0xF0FDF2D3F3C30B9F), UTIL_UINT64(0x656D44A2A11C51D5) },
+    { UTIL_UINT64(0x969EB7C47859E743), UTIL_UINT64(0x9F644AE5A4B1B325) },
+    { UTIL_UINT64(0xBC4665B596706114), UTIL_UINT64(0x873D5D9F0DDE1FEE) },
+    { UTIL_UINT64(0xEB57FF22FC0C7959), UTIL_UINT64(0xA90CB506D155A7EA) },
+    { UTIL_UINT64(0x9316FF75DD87CBD8), UTIL_UINT64(0x09A7F12442D588F2) },
+    { UTIL_UINT64(0xB7DCBF5354E9BECE), UTIL_UINT64(0x0C11ED6D538AEB2F) },
+    { UTIL_UINT64(0xE5D3EF282A242E81), UTIL_UINT64(0x8F1668C8A86DA5FA) },
+    { UTIL_UINT64(0x8FA475791A569D10), UTIL_UINT64(0xF96E017D694487BC) },
+    { UTIL_UINT64(0xB38D92D760EC4455), UTIL_UINT64(0x37C981DCC395A9AC) },
+    { UTIL_UINT64(0xE070F78D3927556A), UTIL_UINT64(0x85BBE253F47B1417) },
+    { UTIL_UINT64(0x8C469AB843B89562), UTIL_UINT64(0x93956D7478CCEC8E) },
+    { UTIL_UINT64(0xAF58416654A6BABB), UTIL_UINT64(0x387AC8D1970027B2) },
+    { UTIL_UINT64(0xDB2E51BFE9D0696A), UTIL_UINT64(0x06997B05FCC0319E) },
+    { UTIL_UINT64(0x88FCF317F22241E2), UTIL_UINT64(0x441FECE3BDF81F03) },
+    { UTIL_UINT64(0xAB3C2FDDEEAAD25A), UTIL_UINT64(0xD527E81CAD7626C3) },
+    { UTIL_UINT64(0xD60B3BD56A5586F1), UTIL_UINT64(0x8A71E223D8D3B074) },
+    { UTIL_UINT64(0x85C7056562757456), UTIL_UINT64(0xF6872D5667844E49) },
+    { UTIL_UINT64(0xA738C6BEBB12D16C), UTIL_UINT64(0xB428F8AC016561DB) },
+    { UTIL_UINT64(0xD106F86E69D785C7), UTIL_UINT64(0xE13336D701BEBA52) },
+    { UTIL_UINT64(0x82A45B450226B39C), UTIL_UINT64(0xECC0024661173473) },
+    { UTIL_UINT64(0xA34D721642B06084), UTIL_UINT64(0x27F002D7F95D0190) },
+    { UTIL_UINT64(0xCC20CE9BD35C78A5), UTIL_UINT64(0x31EC038DF7B441F4) },
+    { UTIL_UINT64(0xFF290242C83396CE), UTIL_UINT64(0x7E67047175A15271) },
+    { UTIL_UINT64(0x9F79A169BD203E41), UTIL_UINT64(0x0F0062C6E984D386) },
+    { UTIL_UINT64(0xC75809C42C684DD1), UTIL_UINT64(0x52C07B78A3E60868) },
+    { UTIL_UINT64(0xF92E0C3537826145), UTIL_UINT64(0xA7709A56CCDF8A82) },
+    { UTIL_UINT64(0x9BBCC7A142B17CCB), UTIL_UINT64(0x88A66076400BB691) },
+    { UTIL_UINT64(0xC2ABF989935DDBFE), UTIL_UINT64(0x6ACFF893D00EA435) },
+    { UTIL_UINT64(0xF356F7EBF83552FE), UTIL_UINT64(0x0583F6B8C4124D43) },
+    { UTIL_UINT64(0x98165AF37B2153DE), UTIL_UINT64(0xC3727A337A8B704A) },
+    { UTIL_UINT64(0xBE1BF1B059E9A8D6), UTIL_UINT64(0x744F18C0592E4C5C) },
+    { UTIL_UINT64(0xEDA2EE1C7064130C), UTIL_UINT64(0x1162DEF06F79DF73) },
+    { UTIL_UINT64(0x9485D4D1C63E8BE7), UTIL_UINT64(0x8ADDCB5645AC2BA8) },
+    { UTIL_UINT64(0xB9A74A0637CE2EE1), UTIL_UINT64(0x6D953E2BD7173692) },
+    { UTIL_UINT64(0xE8111C87C5C1BA99), UTIL_UINT64(0xC8FA8DB6CCDD0437) },
+    { UTIL_UINT64(0x910AB1D4DB9914A0), UTIL_UINT64(0x1D9C9892400A22A2) },
+    { UTIL_UINT64(0xB54D5E4A127F59C8), UTIL_UINT64(0x2503BEB6D00CAB4B) },
+    { UTIL_UINT64(0xE2A0B5DC971F303A), UTIL_UINT64(0x2E44AE64840FD61D) },
+    { UTIL_UINT64(0x8DA471A9DE737E24), UTIL_UINT64(0x5CEAECFED289E5D2) },
+    { UTIL_UINT64(0xB10D8E1456105DAD), UTIL_UINT64(0x7425A83E872C5F47) },
+    { UTIL_UINT64(0xDD50F1996B947518), UTIL_UINT64(0xD12F124E28F77719) },
+    { UTIL_UINT64(0x8A5296FFE33CC92F), UTIL_UINT64(0x82BD6B70D99AAA6F) },
+    { UTIL_UINT64(0xACE73CBFDC0BFB7B), UTIL_UINT64(0x636CC64D1001550B) },
+    { UTIL_UINT64(0xD8210BEFD30EFA5A), UTIL_UINT64(0x3C47F7E05401AA4E) },
+    { UTIL_UINT64(0x8714A775E3E95C78), UTIL_UINT64(0x65ACFAEC34810A71) },
+    { UTIL_UINT64(0xA8D9D1535CE3B396), UTIL_UINT64(0x7F1839A741A14D0D) },
+    { UTIL_UINT64(0xD31045A8341CA07C), UTIL_UINT64(0x1EDE48111209A050) },
+    { UTIL_UINT64(0x83EA2B892091E44D), UTIL_UINT64(0x934AED0AAB460432) },
+    { UTIL_UINT64(0xA4E4B66B68B65D60), UTIL_UINT64(0xF81DA84D5617853F) },
+    { UTIL_UINT64(0xCE1DE40642E3F4B9), UTIL_UINT64(0x36251260AB9D668E) },
+    { UTIL_UINT64(0x80D2AE83E9CE78F3), UTIL_UINT64(0xC1D72B7C6B426019) },
+    { UTIL_UINT64(0xA1075A24E4421730), UTIL_UINT64(0xB24CF65B8612F81F) },
+    { UTIL_UINT64(0xC94930AE1D529CFC), UTIL_UINT64(0xDEE033F26797B627) },
+    { UTIL_UINT64(0xFB9B7CD9A4A7443C), UTIL_UINT64(0x169840EF017DA3B1) },
+    { UTIL_UINT64(0x9D412E0806E88AA5), UTIL_UINT64(0x8E1F289560EE864E) },
+    { UTIL_UINT64(0xC491798A08A2AD4E), UTIL_UINT64(0xF1A6F2BAB92A27E2) },
+    { UTIL_UINT64(0xF5B5D7EC8ACB58A2), UTIL_UINT64(0xAE10AF696774B1DB) },
+    { UTIL_UINT64(0x9991A6F3D6BF1765), UTIL_UINT64(0xACCA6DA1E0A8EF29) },
+    { UTIL_UINT64(0xBFF610B0CC6EDD3F), UTIL_UINT64(0x17FD090A58D32AF3) },
+    { UTIL_UINT64(0xEFF394DCFF8A948E), UTIL_UINT64(0xDDFC4B4CEF07F5B0) },
+    { UTIL_UINT64(0x95F83D0A1FB69CD9), UTIL_UINT64(0x4ABDAF101564F98E) },
+    { UTIL_UINT64(0xBB764C4CA7A4440F), UTIL_UINT64(0x9D6D1AD41ABE37F1) },
+    { UTIL_UINT64(0xEA53DF5FD18D5513), UTIL_UINT64(0x84C86189216DC5ED) },
+    { UTIL_UINT64(0x92746B9BE2F8552C), UTIL_UINT64(0x32FD3CF5B4E49BB4) },
+    { UTIL_UINT64(0xB7118682DBB66A77), UTIL_UINT64(0x3FBC8C33221DC2A1) },
+    { UTIL_UINT64(0xE4D5E82392A40515), UTIL_UINT64(0x0FABAF3FEAA5334A) },
+    { UTIL_UINT64(0x8F05B1163BA6832D), UTIL_UINT64(0x29CB4D87F2A7400E) },
+    { UTIL_UINT64(0xB2C71D5BCA9023F8), UTIL_UINT64(0x743E20E9EF511012) },
+    { UTIL_UINT64(0xDF78E4B2BD342CF6), UTIL_UINT64(0x914DA9246B255416) },
+    { UTIL_UINT64(0x8BAB8EEFB6409C1A), UTIL_UINT64(0x1AD089B6C2F7548E) },
+    { UTIL_UINT64(0xAE9672ABA3D0C320), UTIL_UINT64(0xA184AC2473B529B1) },
+    { UTIL_UINT64(0xDA3C0F568CC4F3E8), UTIL_UINT64(0xC9E5D72D90A2741E) },
+    { UTIL_UINT64(0x8865899617FB1871), UTIL_UINT64(0x7E2FA67C7A658892) },
+    { UTIL_UINT64(0xAA7EEBFB9DF9DE8D), UTIL_UINT64(0xDDBB901B98FEEAB7) },
+    { UTIL_UINT64(0xD51EA6FA85785631), UTIL_UINT64(0x552A74227F3EA565) },
+    { UTIL_UINT64(0x8533285C936B35DE), UTIL_UINT64(0xD53A88958F87275F) },
+    { UTIL_UINT64(0xA67FF273B8460356), UTIL_UINT64(0x8A892ABAF368F137) },
+    { UTIL_UINT64(0xD01FEF10A657842C), UTIL_UINT64(0x2D2B7569B0432D85) },
+    { UTIL_UINT64(0x8213F56A67F6B29B), UTIL_UINT64(0x9C3B29620E29FC73) },
+    { UTIL_UINT64(0xA298F2C501F45F42), UTIL_UINT64(0x8349F3BA91B47B8F) },
+    { UTIL_UINT64(0xCB3F2F7642717713), UTIL_UINT64(0x241C70A936219A73) },
+    { UTIL_UINT64(0xFE0EFB53D30DD4D7), UTIL_UINT64(0xED238CD383AA0110) },
+    { UTIL_UINT64(0x9EC95D1463E8A506), UTIL_UINT64(0xF4363804324A40AA) },
+    { UTIL_UINT64(0xC67BB4597CE2CE48), UTIL_UINT64(0xB143C6053EDCD0D5) },
+    { UTIL_UINT64(0xF81AA16FDC1B81DA), UTIL_UINT64(0xDD94B7868E94050A) },
+    { UTIL_UINT64(0x9B10A4E5E9913128), UTIL_UINT64(0xCA7CF2B4191C8326) },
+    { UTIL_UINT64(0xC1D4CE1F63F57D72), UTIL_UINT64(0xFD1C2F611F63A3F0) },
+    { UTIL_UINT64(0xF24A01A73CF2DCCF), UTIL_UINT64(0xBC633B39673C8CEC) },
+    { UTIL_UINT64(0x976E41088617CA01), UTIL_UINT64(0xD5BE0503E085D813) },
+    { UTIL_UINT64(0xBD49D14AA79DBC82), UTIL_UINT64(0x4B2D8644D8A74E18) },
+    { UTIL_UINT64(0xEC9C459D51852BA2), UTIL_UINT64(0xDDF8E7D60ED1219E) },
+    { UTIL_UINT64(0x93E1AB8252F33B45), UTIL_UINT64(0xCABB90E5C942B503) },
+    { UTIL_UINT64(0xB8DA1662E7B00A17), UTIL_UINT64(0x3D6A751F3B936243) },
+    { UTIL_UINT64(0xE7109BFBA19C0C9D), UTIL_UINT64(0x0CC512670A783AD4) },
+    { UTIL_UINT64(0x906A617D450187E2), UTIL_UINT64(0x27FB2B80668B24C5) },
+    { UTIL_UINT64(0xB484F9DC9641E9DA), UTIL_UINT64(0xB1F9F660802DEDF6) },
+    { UTIL_UINT64(0xE1A63853BBD26451), UTIL_UINT64(0x5E7873F8A0396973) },
+    { UTIL_UINT64(0x8D07E33455637EB2), UTIL_UINT64(0xDB0B487B6423E1E8) },
+    { UTIL_UINT64(0xB049DC016ABC5E5F), UTIL_UINT64(0x91CE1A9A3D2CDA62) },
+    { UTIL_UINT64(0xDC5C5301C56B75F7), UTIL_UINT64(0x7641A140CC7810FB) },
+    { UTIL_UINT64(0x89B9B3E11B6329BA), UTIL_UINT64(0xA9E904C87FCB0A9D) },
+    { UTIL_UINT64(0xAC2820D9623BF429), UTIL_UINT64(0x546345FA9FBDCD44) },
+    { UTIL_UINT64(0xD732290FBACAF133), UTIL_UINT64(0xA97C177947AD4095) },
+    { UTIL_UINT64(0x867F59A9D4BED6C0), UTIL_UINT64(0x49ED8EABCCCC485D) },
+    { UTIL_UINT64(0xA81F301449EE8C70), UTIL_UINT64(0x5C68F256BFFF5A74) },
+    { UTIL_UINT64(0xD226FC195C6A2F8C), UTIL_UINT64(0x73832EEC6FFF3111) },
+    { UTIL_UINT64(0x83585D8FD9C25DB7), UTIL_UINT64(0xC831FD53C5FF7EAB) },
+    { UTIL_UINT64(0xA42E74F3D032F525), UTIL_UINT64(0xBA3E7CA8B77F5E55) },
+    { UTIL_UINT64(0xCD3A1230C43FB26F), UTIL_UINT64(0x28CE1BD2E55F35EB) },
+    { UTIL_UINT64(0x80444B5E7AA7CF85), UTIL_UINT64(0x7980D163CF5B81B3) },
+    { UTIL_UINT64(0xA0555E361951C366), UTIL_UINT64(0xD7E105BCC332621F) },
+    { UTIL_UINT64(0xC86AB5C39FA63440), UTIL_UINT64(0x8DD9472BF3FEFAA7) },
+    { UTIL_UINT64(0xFA856334878FC150), UTIL_UINT64(0xB14F98F6F0FEB951) },
+    { UTIL_UINT64(0x9C935E00D4B9D8D2), UTIL_UINT64(0x6ED1BF9A569F33D3) },
+    { UTIL_UINT64(0xC3B8358109E84F07), UTIL_UINT64(0x0A862F80EC4700C8) },
+    { UTIL_UINT64(0xF4A642E14C6262C8), UTIL_UINT64(0xCD27BB612758C0FA) },
+    { UTIL_UINT64(0x98E7E9CCCFBD7DBD), UTIL_UINT64(0x8038D51CB897789C) },
+    { UTIL_UINT64(0xBF21E44003ACDD2C), UTIL_UINT64(0xE0470A63E6BD56C3) },
+    { UTIL_UINT64(0xEEEA5D5004981478), UTIL_UINT64(0x1858CCFCE06CAC74) },
+    { UTIL_UINT64(0x95527A5202DF0CCB), UTIL_UINT64(0x0F37801E0C43EBC8) },
+    { UTIL_UINT64(0xBAA718E68396CFFD), UTIL_UINT64(0xD30560258F54E6BA) },
+    { UTIL_UINT64(0xE950DF20247C83FD), UTIL_UINT64(0x47C6B82EF32A2069) },
+    { UTIL_UINT64(0x91D28B7416CDD27E), UTIL_UINT64(0x4CDC331D57FA5441) },
+    { UTIL_UINT64(0xB6472E511C81471D), UTIL_UINT64(0xE0133FE4ADF8E952) },
+    { UTIL_UINT64(0xE3D8F9E563A198E5), UTIL_UINT64(0x58180FDDD97723A6) },
+    { UTIL_UINT64(0x8E679C2F5E44FF8F), UTIL_UINT64(0x570F09EAA7EA7648) },
+    { UTIL_UINT64(0xB201833B35D63F73), UTIL_UINT64(0x2CD2CC6551E513DA) },
+    { UTIL_UINT64(0xDE81E40A034BCF4F), UTIL_UINT64(0xF8077F7EA65E58D1) },
+    { UTIL_UINT64(0x8B112E86420F6191), UTIL_UINT64(0xFB04AFAF27FAF782) },
+    { UTIL_UINT64(0xADD57A27D29339F6), UTIL_UINT64(0x79C5DB9AF1F9B563) },
+    { UTIL_UINT64(0xD94AD8B1C7380874), UTIL_UINT64(0x18375281AE7822BC) },
+    { UTIL_UINT64(0x87CEC76F1C830548), UTIL_UINT64(0x8F2293910D0B15B5) },
+    { UTIL_UINT64(0xA9C2794AE3A3C69A), UTIL_UINT64(0xB2EB3875504DDB22) },
+    { UTIL_UINT64(0xD433179D9C8CB841), UTIL_UINT64(0x5FA60692A46151EB) },
+    { UTIL_UINT64(0x849FEEC281D7F328), UTIL_UINT64(0xDBC7C41BA6BCD333) },
+    { UTIL_UINT64(0xA5C7EA73224DEFF3), UTIL_UINT64(0x12B9B522906C0800) },
+    { UTIL_UINT64(0xCF39E50FEAE16BEF), UTIL_UINT64(0xD768226B34870A00) },
+    { UTIL_UINT64(0x81842F29F2CCE375), UTIL_UINT64(0xE6A1158300D46640) },
+    { UTIL_UINT64(0xA1E53AF46F801C53), UTIL_UINT64(0x60495AE3C1097FD0) },
+    { UTIL_UINT64(0xCA5E89B18B602368), UTIL_UINT64(0x385BB19CB14BDFC4) },
+    { UTIL_UINT64(0xFCF62C1DEE382C42), UTIL_UINT64(0x46729E03DD9ED7B5) },
+    { UTIL_UINT64(0x9E19DB92B4E31BA9), UTIL_UINT64(0x6C07A2C26A8346D1) }
+};
+
+}
+
+#endif
@@ -0,0 +1,289 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/StringCompaction.h>
+#include <Util/Bits.h>
+
+#include "CompactionTable.h"
+
+#include <cstring>
+
+#if defined(ARCH_CPU_SSSE3)
+#    include <tmmintrin.h>
+#elif defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const char CR = 0x0d;
+const char LF = 0x0a;
+
+inline bool
+IsTrimmed(char c)
+{
+    return c == ' ' || c == '\t' || c == CR || c == LF;
+}
+
+inline bool
+IsWhitespace(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+#if defined(ARCH_CPU_SSE2)
+
+const size_t blockSize = 16;
+
+inline __m128i
+WhitespaceMask(__m128i block)
+{
+    //
+    // Tab to CR are the bytes b with b - '\t' <= 4, unsigned.
+    //
+    __m128i control = _mm_sub_epi8(block, _mm_set1_epi8('\t'));
+    __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(control, _mm_set1_epi8(4)), control);
+    return _mm_or_si128(isControl, _mm_cmpeq_epi8(block, _mm_set1_epi8(' ')));
+}
+
+//
+// Stores the bytes of block whose bit is clear in drop at target and
+// returns the end. Up to 16 bytes are written at target, whatever is kept.
+//
+#   if defined(ARCH_CPU_SSSE3)
+inline char*
+Compact(__m128i block, uint32 drop, char* target)
+{
+    uint32 low = drop & 0xFF;
+    uint32 high = drop >> 8;
+    __m128i lowShuffle = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(compactionTable[low]));
+    __m128i highShuffle = _mm_add_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(compactionTable[high])),
+                                       _mm_set1_epi8(8));
+    __m128i packed = _mm_shuffle_epi8(block, _mm_unpacklo_epi64(lowShuffle, highShuffle));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(target), packed);
+    target += 8 - Bits::PopCount32(low);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(target), _mm_unpackhi_epi64(packed, packed));
+    return target + 8 - Bits::PopCount32(high);
+}
+#   else
+//
+// No shuffle in SSE2, the bytes are copied from source, the block still
+// there: a byte is only overwritten once it has been read.
+//
+inline char*
+Compact(const char* source, uint32 drop, char* target)
+{
+    for (size_t i = 0; i < blockSize; ++i)
+    {
+        if (((drop >> i) & 1) == 0)
+        {
+            *target++ = source[i];
+        }
+    }
+    return target;
+}
+#   endif
+
+#elif defined(ARCH_CPU_NEON)
+
+const size_t blockSize = 8;
+
+inline uint8x8_t
+WhitespaceMask(uint8x8_t block)
+{
+    uint8x8_t control = vsub_u8(block, vdup_n_u8('\t'));
+    return vorr_u8(vcle_u8(control, vdup_n_u8(4)), vceq_u8(block, vdup_n_u8(' ')));
+}
+
+//
+// NEON has no movemask: each byte keeps its own bit of a weight and
+// pairwise additions gather them.
+//
+inline uint32
+MoveMask(uint8x8_t mask)
+{
+    static const uint8 weights[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    uint8x8_t bits = vand_u8(mask, vld1_u8(weights));
+    bits = vpadd_u8(bits, bits);
+    bits = vpadd_u8(bits, bits);
+    bits = vpadd_u8(bits, bits);
+    return vget_lane_u8(bits, 0);
+}
+
+inline char*
+Compact(uint8x8_t block, uint32 drop, char* target)
+{
+    vst1_u8(reinterpret_cast<uint8*>(target), vtbl1_u8(block, vld1_u8(compactionTable[drop])));
+    return target + 8 - Bits::PopCount32(drop);
+}
+
+#endif
+
+}
+
+StringPiece
+Util::TrimWhitespace(const StringPiece& s)
+{
+    const char* first = s.begin();
+    const char* last = s.end();
+    while (first != last && IsTrimmed(*first))
+    {
+        ++first;
+    }
+    while (last != first && IsTrimmed(last[-1]))
+    {
+        --last;
+    }
+    return StringPiece(first, static_cast<size_t>(last - first));
+}
+
+size_t
+Util::StripWhitespace(const char* source, size_t size, char* target)
+{
+    const char* p = source;
+    const char* last = source + size;
+    char* out = target;
+
+#if defined(ARCH_CPU_SSE2)
+    for (; static_cast<size_t>(last - p) >= blockSize; p += blockSize)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        uint32 drop = static_cast<uint32>(_mm_movemask_epi8(WhitespaceMask(block)));
+        if (drop != 0)
+        {
+#   if defined(ARCH_CPU_SSSE3)
+            out = Compact(block, drop, out);
+#   else
+            out = Compact(p, drop, out);
+#   endif
+        }
+        else
+        {
+            if (out != p)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+            }
+            out += blockSize;
+        }
+    }
+#elif defined(ARCH_CPU_NEON)
+    for (; static_cast<size_t>(last - p) >= blockSize; p += blockSize)
+    {
+        uint8x8_t block = vld1_u8(reinterpret_cast<const uint8*>(p));
+        uint32 drop = MoveMask(WhitespaceMask(block));
+        if (drop != 0)
+        {
+            out = Compact(block, drop, out);
+        }
+        else
+        {
+            if (out != p)
+            {
+                vst1_u8(reinterpret_cast<uint8*>(out), block);
+            }
+            out += blockSize;
+        }
+    }
+#endif
+
+    for (; p != last; ++p)
+    {
+        if (!IsWhitespace(*p))
+        {
+            *out++ = *p;
+        }
+    }
+    return static_cast<size_t>(out - target);
+}
+
+size_t
+Util::NormalizeNewlines(const char* source, size_t size, char* target)
+{
+    const char* p = source;
+    const char* last = source + size;
+    char* out = target;
+
+    //
+    // The LF after a CR is dropped and the CR becomes the LF. afterCR
+    // tells whether the byte before p is a CR.
+    //
+    uint32 afterCR = 0;
+
+#if defined(ARCH_CPU_SSE2)
+    for (; static_cast<size_t>(last - p) >= blockSize; p += blockSize)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i crs = _mm_cmpeq_epi8(block, _mm_set1_epi8(CR));
+        uint32 crMask = static_cast<uint32>(_mm_movemask_epi8(crs));
+        uint32 drop = static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(LF)))) &
+                      ((crMask << 1) | afterCR);
+        afterCR = crMask >> (blockSize - 1);
+        if (crMask == 0 && drop == 0)
+        {
+            if (out != p)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), block);
+            }
+            out += blockSize;
+            continue;
+        }
+
+        block = _mm_xor_si128(block, _mm_and_si128(crs, _mm_set1_epi8(CR ^ LF)));
+#   if defined(ARCH_CPU_SSSE3)
+        out = Compact(block, drop, out);
+#   else
+        for (size_t i = 0; i < blockSize; ++i)
+        {
+            if (((drop >> i) & 1) == 0)
+            {
+                *out++ = p[i] == CR ? LF : p[i];
+            }
+        }
+#   endif
+    }
+#elif defined(ARCH_CPU_NEON)
+    for (; static_cast<size_t>(last - p) >= blockSize; p += blockSize)
+    {
+        uint8x8_t block = vld1_u8(reinterpret_cast<const uint8*>(p));
+        uint8x8_t crs = vceq_u8(block, vdup_n_u8(CR));
+        uint32 crMask = MoveMask(crs);
+        uint32 drop = MoveMask(vceq_u8(block, vdup_n_u8(LF))) & (((crMask << 1) | afterCR) & 0xFF);
+        afterCR = crMask >> (blockSize - 1);
+        if (crMask == 0 && drop == 0)
+        {
+            if (out != p)
+            {
+                vst1_u8(reinterpret_cast<uint8*>(out), block);
+            }
+            out += blockSize;
+            continue;
+        }
+
+        block = veor_u8(block, vand_u8(crs, vdup_n_u8(CR ^ LF)));
+        out = Compact(block, drop, out);
+    }
+#endif
+
+    for (; p != last; ++p)
+    {
+        if (*p == LF && afterCR != 0)
+        {
+            afterCR = 0;
+            continue;
+        }
+        afterCR = *p == CR ? 1 : 0;
+        *out++ = afterCR != 0 ? LF : *p;
+    }
+    return static_cast<size_t>(out - target);
+}
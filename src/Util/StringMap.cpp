@@ -0,0 +1,460 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/StringMap.h>
+#include <Util/Hash.h>
+#include <Util/Bits.h>
+
+#include <cstring>
+
+#if defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const Byte emptyControl = 0x80;
+const Byte deletedControl = 0xFE;
+const size_t arenaBlockSize = 4096;
+
+//
+// The bits of the slots of a group whose control byte is c, one bit per
+// slot (SSE2) or four (NEON, only the top one set), lowest slot first.
+//
+#if defined(ARCH_CPU_SSE2)
+
+const int maskShift = 0;
+
+inline uint64
+MatchControl(const Byte* control, Byte c)
+{
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(control));
+    return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(static_cast<char>(c)))));
+}
+
+//
+// Empty or deleted: the only control bytes with their top bit set.
+//
+inline uint64
+MatchFree(const Byte* control)
+{
+    return static_cast<uint32>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(control))));
+}
+
+#elif defined(ARCH_CPU_NEON)
+
+const int maskShift = 2;
+
+inline uint64
+ToMask(uint8x16_t eq)
+{
+    uint64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    return mask & UTIL_UINT64(0x8888888888888888);
+}
+
+inline uint64
+MatchControl(const Byte* control, Byte c)
+{
+    return ToMask(vceqq_u8(vld1q_u8(control), vdupq_n_u8(c)));
+}
+
+inline uint64
+MatchFree(const Byte* control)
+{
+    return ToMask(vcgeq_u8(vld1q_u8(control), vdupq_n_u8(emptyControl)));
+}
+
+#else
+
+const int maskShift = 0;
+
+inline uint64
+MatchControl(const Byte* control, Byte c)
+{
+    uint64 mask = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        mask |= static_cast<uint64>(control[i] == c) << i;
+    }
+    return mask;
+}
+
+inline uint64
+MatchFree(const Byte* control)
+{
+    uint64 mask = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        mask |= static_cast<uint64>(control[i] >= emptyControl) << i;
+    }
+    return mask;
+}
+
+#endif
+
+inline size_t
+LowestSlot(uint64 mask)
+{
+    return static_cast<size_t>(Bits::CountTrailingZeros64(mask) >> maskShift);
+}
+
+//
+// The low 7 bits of the hash go to the control bytes, the others choose
+// the first group to probe.
+//
+inline Byte
+ControlOf(uint64 hash)
+{
+    return static_cast<Byte>(hash & 0x7F);
+}
+
+inline size_t
+FirstGroup(uint64 hash, size_t groups)
+{
+    return static_cast<size_t>(hash >> 7) & (groups - 1);
+}
+
+//
+// The smallest capacity for size keys, at most 7/8 full.
+//
+size_t
+CapacityFor(size_t size)
+{
+    size_t capacity = 16;
+    while (capacity / 8 * 7 < size)
+    {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+}
+
+Util::StringTable::StringTable(uint64 seed, bool stableKeys) :
+    m_seed(seed),
+    m_stableKeys(stableKeys),
+    m_deleted(0),
+    m_next(0),
+    m_left(0),
+    m_arenaSize(0),
+    m_liveBytes(0),
+    m_deadBytes(0)
+{
+}
+
+Util::StringTable::~StringTable()
+{
+    for (size_t i = 0; i < m_blocks.size(); ++i)
+    {
+        delete[] m_blocks[i];
+    }
+}
+
+size_t
+Util::StringTable::FindSlot(const StringPiece& key, uint64 hash) const
+{
+    if (m_control.empty())
+    {
+        return npos;
+    }
+
+    //
+    // Triangular probing visits every group once, their number being a
+    // power of two.
+    //
+    size_t groups = m_control.size() / groupSize;
+    size_t group = FirstGroup(hash, groups);
+    Byte c = ControlOf(hash);
+    for (size_t step = 1; step <= groups; ++step)
+    {
+        const Byte* control = &m_control[group * groupSize];
+        for (uint64 match = MatchControl(control, c); match != 0; match &= match - 1)
+        {
+            size_t slot = group * groupSize + LowestSlot(match);
+            const Entry& entry = m_entries[m_slots[slot]];
+            if (entry.hash == hash && entry.size == key.Size() &&
+                memcmp(Key(m_slots[slot]).Data(), key.Data(), key.Size()) == 0)
+            {
+                return slot;
+            }
+        }
+        if (MatchControl(control, emptyControl) != 0)
+        {
+            return npos;
+        }
+        group = (group + step) & (groups - 1);
+    }
+    return npos;
+}
+
+size_t
+Util::StringTable::FreeSlot(uint64 hash) const
+{
+    size_t groups = m_control.size() / groupSize;
+    size_t group = FirstGroup(hash, groups);
+    for (size_t step = 1;; ++step)
+    {
+        uint64 free = MatchFree(&m_control[group * groupSize]);
+        if (free != 0)
+        {
+            return group * groupSize + LowestSlot(free);
+        }
+        group = (group + step) & (groups - 1);
+    }
+}
+
+void
+Util::StringTable::SetSlot(size_t slot, uint64 hash, uint32 index)
+{
+    m_control[slot] = ControlOf(hash);
+    m_slots[slot] = index;
+}
+
+void
+Util::StringTable::Rehash(size_t capacity)
+{
+    m_control.assign(capacity, emptyControl);
+    m_slots.resize(capacity);
+    m_deleted = 0;
+    for (size_t i = 0; i < m_entries.size(); ++i)
+    {
+        SetSlot(FreeSlot(m_entries[i].hash), m_entries[i].hash, static_cast<uint32>(i));
+    }
+}
+
+const char*
+Util::StringTable::Store(const StringPiece& key)
+{
+    if (key.Empty())
+    {
+        return "";
+    }
+    if (key.Size() > m_left)
+    {
+        size_t size = max(arenaBlockSize, key.Size());
+        m_blocks.push_back(0);
+        m_blocks.back() = new char[size];
+        m_next = m_blocks.back();
+        m_left = size;
+        m_arenaSize += size;
+    }
+    char* data = m_next;
+    memcpy(data, key.Data(), key.Size());
+    m_next += key.Size();
+    m_left -= key.Size();
+    m_liveBytes += key.Size();
+    return data;
+}
+
+//
+// Copies the keys in the arena to a single new block. Each compaction
+// copies fewer bytes than were removed since the previous one.
+//
+void
+Util::StringTable::CompactArena()
+{
+    vector<char*> blocks;
+    blocks.swap(m_blocks);
+    m_next = 0;
+    m_left = 0;
+    m_arenaSize = 0;
+    m_liveBytes = 0;
+    m_deadBytes = 0;
+
+    size_t live = 0;
+    for (size_t i = 0; i < m_entries.size(); ++i)
+    {
+        if (m_entries[i].size > inlineSize)
+        {
+            live += m_entries[i].size;
+        }
+    }
+    if (live > 0)
+    {
+        m_blocks.push_back(0);
+        m_blocks.back() = new char[max(arenaBlockSize, live)];
+        m_next = m_blocks.back();
+        m_left = max(arenaBlockSize, live);
+        m_arenaSize = m_left;
+    }
+    for (size_t i = 0; i < m_entries.size(); ++i)
+    {
+        Entry& entry = m_entries[i];
+        if (entry.size > inlineSize)
+        {
+            entry.data.pointer = Store(StringPiece(entry.data.pointer, entry.size));
+        }
+    }
+
+    for (size_t i = 0; i < blocks.size(); ++i)
+    {
+        delete[] blocks[i];
+    }
+}
+
+size_t
+Util::StringTable::Find(const StringPiece& key) const
+{
+    if (m_entries.empty())
+    {
+        return npos;
+    }
+    size_t slot = FindSlot(key, HashBytes(key.Data(), key.Size(), m_seed));
+    return slot != npos ? m_slots[slot] : npos;
+}
+
+size_t
+Util::StringTable::Insert(const StringPiece& key, bool& inserted)
+{
+    uint64 hash = HashBytes(key.Data(), key.Size(), m_seed);
+    size_t slot = FindSlot(key, hash);
+    if (slot != npos)
+    {
+        inserted = false;
+        return m_slots[slot];
+    }
+
+    //
+    // Deleted slots count as full: probes go past them. Rehashing to a
+    // capacity that is at least twice the size leaves room for as many
+    // insertions as there are keys before the next one.
+    //
+    size_t size = m_entries.size();
+    if ((size + m_deleted + 1) > m_control.size() / 8 * 7)
+    {
+        Rehash(max(m_control.size(), CapacityFor(2 * (size + 1))));
+    }
+
+    Entry entry;
+    entry.hash = hash;
+    entry.size = static_cast<uint32>(key.Size());
+    if (key.Size() <= inlineSize && !m_stableKeys)
+    {
+        memcpy(entry.data.bytes, key.Data(), key.Size());
+    }
+    else
+    {
+        //
+        // Keys may only move on an insertion, and never with stableKeys.
+        //
+        if (!m_stableKeys && m_deadBytes > m_liveBytes && m_deadBytes >= arenaBlockSize)
+        {
+            CompactArena();
+        }
+        entry.data.pointer = Store(key);
+    }
+    m_entries.push_back(entry);
+
+    slot = FreeSlot(hash);
+    if (m_control[slot] == deletedControl)
+    {
+        --m_deleted;
+    }
+    SetSlot(slot, hash, static_cast<uint32>(size));
+    inserted = true;
+    return size;
+}
+
+bool
+Util::StringTable::Erase(const StringPiece& key, size_t& index)
+{
+    if (m_entries.empty())
+    {
+        return false;
+    }
+    size_t slot = FindSlot(key, HashBytes(key.Data(), key.Size(), m_seed));
+    if (slot == npos)
+    {
+        return false;
+    }
+    index = m_slots[slot];
+    if (m_entries[index].size > inlineSize || m_stableKeys)
+    {
+        m_liveBytes -= m_entries[index].size;
+        m_deadBytes += m_entries[index].size;
+    }
+
+    //
+    // A lookup stops at a group with an empty slot, so the slot can be
+    // empty again if its group has one; otherwise lookups must go on.
+    //
+    if (MatchControl(&m_control[slot / groupSize * groupSize], emptyControl) != 0)
+    {
+        m_control[slot] = emptyControl;
+    }
+    else
+    {
+        m_control[slot] = deletedControl;
+        ++m_deleted;
+    }
+
+    size_t last = m_entries.size() - 1;
+    if (index != last)
+    {
+        uint64 hash = m_entries[last].hash;
+        size_t groups = m_control.size() / groupSize;
+        size_t group = FirstGroup(hash, groups);
+        for (size_t step = 1;; ++step)
+        {
+            const Byte* control = &m_control[group * groupSize];
+            uint64 match = MatchControl(control, ControlOf(hash));
+            for (; match != 0; match &= match - 1)
+            {
+                size_t lastSlot = group * groupSize + LowestSlot(match);
+                if (m_slots[lastSlot] == last)
+                {
+                    m_slots[lastSlot] = static_cast<uint32>(index);
+                    break;
+                }
+            }
+            if (match != 0)
+            {
+                break;
+            }
+            group = (group + step) & (groups - 1);
+        }
+        m_entries[index] = m_entries[last];
+    }
+    m_entries.pop_back();
+    return true;
+}
+
+void
+Util::StringTable::Reserve(size_t size)
+{
+    size_t capacity = CapacityFor(size);
+    if (capacity > m_control.size())
+    {
+        Rehash(capacity);
+    }
+    m_entries.reserve(size);
+}
+
+void
+Util::StringTable::Clear()
+{
+    fill(m_control.begin(), m_control.end(), emptyControl);
+    m_deleted = 0;
+    m_entries.clear();
+    for (size_t i = 0; i < m_blocks.size(); ++i)
+    {
+        delete[] m_blocks[i];
+    }
+    m_blocks.clear();
+    m_next = 0;
+    m_left = 0;
+    m_arenaSize = 0;
+    m_liveBytes = 0;
+    m_deadBytes = 0;
+}
@@ -0,0 +1,537 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/StringSearch.h>
+#include <Util/Bits.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(ARCH_CPU_AVX2)
+#    include <immintrin.h>
+#elif defined(ARCH_CPU_SSE2)
+#    include <emmintrin.h>
+#elif defined(ARCH_CPU_NEON)
+#    include <arm_neon.h>
+#endif
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+//
+// Needles up to this size are searched with the SIMD filter.
+//
+const size_t maxFilterNeedle = 64;
+
+//
+// The filter gives up in favour of Two-Way when there is more than one
+// false candidate per this many bytes scanned (after a few to start with).
+//
+const size_t filterBytesPerCandidate = 16;
+const size_t filterFreeCandidates = 32;
+
+//
+// Checks a position whose first and last bytes match the needle; counts
+// false candidates and tells when there are too many.
+//
+class Candidates
+{
+public:
+
+    Candidates(const Byte* haystack, const Byte* needle, size_t size) :
+        m_haystack(haystack),
+        m_needle(needle),
+        m_size(size),
+        m_false(0)
+    {
+    }
+
+    bool Matches(const Byte* p)
+    {
+        if (memcmp(p + 1, m_needle + 1, m_size - 2) == 0)
+        {
+            return true;
+        }
+        ++m_false;
+        return false;
+    }
+
+    bool TooMany(const Byte* p) const
+    {
+        return m_false > filterFreeCandidates &&
+               m_false * filterBytesPerCandidate > static_cast<size_t>(p - m_haystack);
+    }
+
+private:
+
+    const Byte* m_haystack;
+    const Byte* m_needle;
+    size_t m_size;
+    size_t m_false;
+};
+
+//
+// Searches [haystack, last) for a needle of 2 to maxFilterNeedle bytes by
+// comparing the first and the last byte of the needle at many positions at
+// once. Returns the match, or 0 with resume set to where the search has to
+// go on if it gave up because of too many false candidates.
+//
+const Byte*
+FilterSearch(const Byte* haystack, const Byte* last, const Byte* needle, size_t size, const Byte*& resume)
+{
+    resume = 0;
+    Candidates candidates(haystack, needle, size);
+    const Byte* p = haystack;
+
+#if defined(ARCH_CPU_AVX2)
+    const __m256i firstByte = _mm256_set1_epi8(static_cast<char>(needle[0]));
+    const __m256i lastByte = _mm256_set1_epi8(static_cast<char>(needle[size - 1]));
+    for (; static_cast<size_t>(last - p) >= size + 31; p += 32)
+    {
+        __m256i head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + size - 1));
+        uint32 mask = static_cast<uint32>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(head, firstByte), _mm256_cmpeq_epi8(tail, lastByte))));
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const Byte* candidate = p + Bits::CountTrailingZeros32(mask);
+            if (candidates.Matches(candidate))
+            {
+                return candidate;
+            }
+            if (candidates.TooMany(candidate))
+            {
+                resume = candidate + 1;
+                return 0;
+            }
+        }
+    }
+#elif defined(ARCH_CPU_SSE2)
+    const __m128i firstByte = _mm_set1_epi8(static_cast<char>(needle[0]));
+    const __m128i lastByte = _mm_set1_epi8(static_cast<char>(needle[size - 1]));
+    for (; static_cast<size_t>(last - p) >= size + 15; p += 16)
+    {
+        __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + size - 1));
+        uint32 mask = static_cast<uint32>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(head, firstByte), _mm_cmpeq_epi8(tail, lastByte))));
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const Byte* candidate = p + Bits::CountTrailingZeros32(mask);
+            if (candidates.Matches(candidate))
+            {
+                return candidate;
+            }
+            if (candidates.TooMany(candidate))
+            {
+                resume = candidate + 1;
+                return 0;
+            }
+        }
+    }
+#elif defined(ARCH_CPU_NEON)
+    const uint8x16_t firstByte = vdupq_n_u8(needle[0]);
+    const uint8x16_t lastByte = vdupq_n_u8(needle[size - 1]);
+    for (; static_cast<size_t>(last - p) >= size + 15; p += 16)
+    {
+        uint8x16_t eq = vandq_u8(vceqq_u8(vld1q_u8(p), firstByte), vceqq_u8(vld1q_u8(p + size - 1), lastByte));
+
+        //
+        // Four bits per byte.
+        //
+        uint64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+        for (; mask != 0; mask &= ~(UTIL_UINT64(0xF) << (Bits::CountTrailingZeros64(mask) & ~3)))
+        {
+            const Byte* candidate = p + (Bits::CountTrailingZeros64(mask) >> 2);
+            if (candidates.Matches(candidate))
+            {
+                return candidate;
+            }
+            if (candidates.TooMany(candidate))
+            {
+                resume = candidate + 1;
+                return 0;
+            }
+        }
+    }
+#endif
+
+    //
+    // The rest (everything without SIMD) candidate by candidate.
+    //
+    const Byte* lastStart = last - size + 1;
+    while (p < lastStart)
+    {
+        const Byte* candidate = static_cast<const Byte*>(memchr(p, needle[0], static_cast<size_t>(lastStart - p)));
+        if (candidate == 0)
+        {
+            break;
+        }
+        if (candidate[size - 1] == needle[size - 1])
+        {
+            if (candidates.Matches(candidate))
+            {
+                return candidate;
+            }
+            if (candidates.TooMany(candidate))
+            {
+                resume = candidate + 1;
+                return 0;
+            }
+        }
+        p = candidate + 1;
+    }
+    return 0;
+}
+
+}
+
+Util::StringSearcher::StringSearcher(const string& needle) :
+    m_needle(needle)
+{
+    Prepare();
+}
+
+Util::StringSearcher::StringSearcher(const void* needle, size_t size) :
+    m_needle(static_cast<const char*>(needle), size)
+{
+    Prepare();
+}
+
+void
+Util::StringSearcher::Prepare()
+{
+    const Byte* n = reinterpret_cast<const Byte*>(m_needle.data());
+    size_t size = m_needle.size();
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        m_shift[i] = size;
+    }
+    for (size_t i = 0; i < size; ++i)
+    {
+        m_shift[n[i]] = size - i - 1;
+    }
+
+    m_critical = 0;
+    m_period = 1;
+    m_memory = 0;
+    if (size < 2)
+    {
+        return;
+    }
+
+    //
+    // The maximal suffixes for both orderings of the bytes; the later one
+    // gives the critical factorization (Crochemore and Perrin).
+    //
+    size_t suffix[2];
+    size_t period[2];
+    for (int order = 0; order < 2; ++order)
+    {
+        size_t i = static_cast<size_t>(-1);
+        size_t j = 0;
+        size_t k = 1;
+        size_t p = 1;
+        while (j + k < size)
+        {
+            Byte a = n[i + k];
+            Byte b = n[j + k];
+            if (a == b)
+            {
+                if (k == p)
+                {
+                    j += p;
+                    k = 1;
+                }
+                else
+                {
+                    ++k;
+                }
+            }
+            else if (order == 0 ? a > b : a < b)
+            {
+                j += k;
+                k = 1;
+                p = j - i;
+            }
+            else
+            {
+                i = j++;
+                k = p = 1;
+            }
+        }
+        suffix[order] = i;
+        period[order] = p;
+    }
+    int chosen = suffix[1] + 1 > suffix[0] + 1 ? 1 : 0;
+    m_critical = suffix[chosen] + 1;
+    m_period = period[chosen];
+
+    if (memcmp(n, n + m_period, m_critical) == 0)
+    {
+        m_memory = size - m_period;
+    }
+    else
+    {
+        //
+        // Not periodic: any mismatch in the left part moves the window by
+        // more than the longer part.
+        //
+        m_period = max(m_critical - 1, size - m_critical) + 1;
+    }
+}
+
+const Byte*
+Util::StringSearcher::TwoWay(const Byte* haystack, const Byte* last) const
+{
+    const Byte* n = reinterpret_cast<const Byte*>(m_needle.data());
+    size_t size = m_needle.size();
+    size_t memory = 0;
+
+    while (static_cast<size_t>(last - haystack) >= size)
+    {
+        //
+        // The last byte of the window first: unless it is the last byte of
+        // the needle the window moves to its next occurrence in the needle.
+        //
+        size_t shift = m_shift[haystack[size - 1]];
+        if (shift != 0)
+        {
+            haystack += max(shift, memory);
+            memory = 0;
+            continue;
+        }
+
+        size_t k = max(m_critical, memory);
+        while (k < size && n[k] == haystack[k])
+        {
+            ++k;
+        }
+        if (k < size)
+        {
+            haystack += k - m_critical + 1;
+            memory = 0;
+            continue;
+        }
+
+        k = m_critical;
+        while (k > memory && n[k - 1] == haystack[k - 1])
+        {
+            --k;
+        }
+        if (k <= memory)
+        {
+            return haystack;
+        }
+        haystack += m_period;
+        memory = m_memory;
+    }
+    return 0;
+}
+
+const Byte*
+Util::StringSearcher::Find(const void* haystack, size_t size) const
+{
+    const Byte* h = static_cast<const Byte*>(haystack);
+    size_t needleSize = m_needle.size();
+    if (needleSize == 0)
+    {
+        return h;
+    }
+    if (size < needleSize)
+    {
+        return 0;
+    }
+    if (needleSize == 1)
+    {
+        return static_cast<const Byte*>(memchr(h, m_needle[0], size));
+    }
+    if (needleSize <= maxFilterNeedle)
+    {
+        const Byte* resume;
+        const Byte* match = FilterSearch(h, h + size, reinterpret_cast<const Byte*>(m_needle.data()), needleSize, resume);
+        if (resume == 0)
+        {
+            return match;
+        }
+        h = resume;
+    }
+    return TwoWay(h, static_cast<const Byte*>(haystack) + size);
+}
+
+size_t
+Util::StringSearcher::Find(const string& haystack, size_t pos) const
+{
+    if (pos > haystack.size())
+    {
+        return string::npos;
+    }
+    const Byte* first = reinterpret_cast<const Byte*>(haystack.data());
+    const Byte* match = Find(first + pos, haystack.size() - pos);
+    return match == 0 ? string::npos : static_cast<size_t>(match - first);
+}
+
+const Byte*
+Util::FindBytes(const void* haystack, size_t size, const void* needle, size_t needleSize)
+{
+    const Byte* h = static_cast<const Byte*>(haystack);
+    const Byte* n = static_cast<const Byte*>(needle);
+    if (needleSize == 0)
+    {
+        return h;
+    }
+    if (size < needleSize)
+    {
+        return 0;
+    }
+    if (needleSize == 1)
+    {
+        return static_cast<const Byte*>(memchr(h, n[0], size));
+    }
+    if (needleSize <= maxFilterNeedle)
+    {
+        //
+        // Most searches end here without preparing the needle.
+        //
+        const Byte* resume;
+        const Byte* match = FilterSearch(h, h + size, n, needleSize, resume);
+        if (resume == 0)
+        {
+            return match;
+        }
+        size -= static_cast<size_t>(resume - h);
+        h = resume;
+    }
+    return StringSearcher(needle, needleSize).Find(h, size);
+}
+
+Util::ByteSetFinder::ByteSetFinder(const string& set)
+{
+    Prepare(reinterpret_cast<const Byte*>(set.data()), set.size());
+}
+
+Util::ByteSetFinder::ByteSetFinder(const void* set, size_t size)
+{
+    Prepare(static_cast<const Byte*>(set), size);
+}
+
+void
+Util::ByteSetFinder::Prepare(const Byte* set, size_t size)
+{
+    fill(m_table, m_table + 256, false);
+    m_count = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (!m_table[set[i]])
+        {
+            m_table[set[i]] = true;
+            if (m_count < maxVectorSize)
+            {
+                m_bytes[m_count] = set[i];
+            }
+            ++m_count;
+        }
+    }
+}
+
+const Byte*
+Util::ByteSetFinder::Find(const void* first, size_t size) const
+{
+    const Byte* p = static_cast<const Byte*>(first);
+    const Byte* last = p + size;
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    if (m_count == 1)
+    {
+        return static_cast<const Byte*>(memchr(p, m_bytes[0], size));
+    }
+
+    if (m_count <= maxVectorSize)
+    {
+#if defined(ARCH_CPU_AVX2)
+        __m256i set[maxVectorSize];
+        for (size_t i = 0; i < m_count; ++i)
+        {
+            set[i] = _mm256_set1_epi8(static_cast<char>(m_bytes[i]));
+        }
+        for (; last - p >= 32; p += 32)
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+            __m256i eq = _mm256_cmpeq_epi8(block, set[0]);
+            for (size_t i = 1; i < m_count; ++i)
+            {
+                eq = _mm256_or_si256(eq, _mm256_cmpeq_epi8(block, set[i]));
+            }
+            uint32 mask = static_cast<uint32>(_mm256_movemask_epi8(eq));
+            if (mask != 0)
+            {
+                return p + Bits::CountTrailingZeros32(mask);
+            }
+        }
+#elif defined(ARCH_CPU_SSE2)
+        __m128i set[maxVectorSize];
+        for (size_t i = 0; i < m_count; ++i)
+        {
+            set[i] = _mm_set1_epi8(static_cast<char>(m_bytes[i]));
+        }
+        for (; last - p >= 16; p += 16)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i eq = _mm_cmpeq_epi8(block, set[0]);
+            for (size_t i = 1; i < m_count; ++i)
+            {
+                eq = _mm_or_si128(eq, _mm_cmpeq_epi8(block, set[i]));
+            }
+            uint32 mask = static_cast<uint32>(_mm_movemask_epi8(eq));
+            if (mask != 0)
+            {
+                return p + Bits::CountTrailingZeros32(mask);
+            }
+        }
+#elif defined(ARCH_CPU_NEON)
+        uint8x16_t set[maxVectorSize];
+        for (size_t i = 0; i < m_count; ++i)
+        {
+            set[i] = vdupq_n_u8(m_bytes[i]);
+        }
+        for (; last - p >= 16; p += 16)
+        {
+            uint8x16_t block = vld1q_u8(p);
+            uint8x16_t eq = vceqq_u8(block, set[0]);
+            for (size_t i = 1; i < m_count; ++i)
+            {
+                eq = vorrq_u8(eq, vceqq_u8(block, set[i]));
+            }
+
+            //
+            // Four bits per byte.
+            //
+            uint64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+            if (mask != 0)
+            {
+                return p + (Bits::CountTrailingZeros64(mask) >> 2);
+            }
+        }
+#endif
+    }
+
+    for (; p != last; ++p)
+    {
+        if (m_table[*p])
+        {
+            return p;
+        }
+    }
+    return 0;
+}
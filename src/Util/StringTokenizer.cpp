@@ -0,0 +1,169 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/StringTokenizer.h>
+
+#include <algorithm>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+string
+SpecialBytes(const StringPiece& delimiters)
+{
+    string special = delimiters.ToString();
+    special += "'\"\\";
+    return special;
+}
+
+inline const char*
+FindIn(const ByteSetFinder& finder, const char* first, const char* last)
+{
+    const Byte* p = finder.Find(first, static_cast<size_t>(last - first));
+    return p != 0 ? reinterpret_cast<const char*>(p) : last;
+}
+
+}
+
+Util::StringTokenizer::StringTokenizer(const StringPiece& text, const StringPiece& delimiters, bool keepBlank) :
+    m_next(text.Data()),
+    m_last(text.Data() + text.Size()),
+    m_keepBlank(keepBlank),
+    m_done(false),
+    m_balanced(true),
+    m_backslashDelimits(find(delimiters.begin(), delimiters.end(), '\\') != delimiters.end()),
+    m_special(SpecialBytes(delimiters)),
+    m_inSingleQuotes("'\\"),
+    m_inDoubleQuotes("\"\\"),
+    m_copied(false)
+{
+}
+
+void
+Util::StringTokenizer::AddPiece(const char* first, const char* last)
+{
+    if (first == last)
+    {
+        return;
+    }
+    if (m_copied)
+    {
+        m_buffer.append(first, last);
+    }
+    else if (m_token.Empty())
+    {
+        m_token = StringPiece(first, static_cast<size_t>(last - first));
+    }
+    else if (m_token.end() == first)
+    {
+        m_token = StringPiece(m_token.Data(), m_token.Size() + static_cast<size_t>(last - first));
+    }
+    else
+    {
+        m_buffer.assign(m_token.begin(), m_token.end());
+        m_buffer.append(first, last);
+        m_copied = true;
+    }
+}
+
+bool
+Util::StringTokenizer::Next()
+{
+    while (!m_done)
+    {
+        m_token = StringPiece();
+        m_copied = false;
+
+        const char* p = m_next;
+        const char* piece = p;
+        for (;;)
+        {
+            p = FindIn(m_special, p, m_last);
+            if (p == m_last)
+            {
+                AddPiece(piece, p);
+                m_done = true;
+                break;
+            }
+
+            char c = *p;
+            if (c == '\\')
+            {
+                //
+                // An escaped quote is kept, without the backslash; other
+                // backslashes are plain characters, or delimiters.
+                //
+                if (p + 1 != m_last && (p[1] == '\'' || p[1] == '"'))
+                {
+                    AddPiece(piece, p);
+                    piece = p + 1;
+                    p += 2;
+                    continue;
+                }
+                if (!m_backslashDelimits)
+                {
+                    ++p;
+                    continue;
+                }
+            }
+            if (c == '\'' || c == '"')
+            {
+                AddPiece(piece, p);
+                const ByteSetFinder& inQuotes = c == '\'' ? m_inSingleQuotes : m_inDoubleQuotes;
+                piece = ++p;
+                for (;;)
+                {
+                    p = FindIn(inQuotes, p, m_last);
+                    if (p == m_last)
+                    {
+                        m_balanced = false;
+                        break;
+                    }
+                    if (*p == c)
+                    {
+                        AddPiece(piece, p);
+                        piece = ++p;
+                        break;
+                    }
+                    if (p + 1 != m_last && p[1] == c)
+                    {
+                        AddPiece(piece, p);
+                        piece = p + 1;
+                        p += 2;
+                    }
+                    else
+                    {
+                        ++p;
+                    }
+                }
+            }
+            else
+            {
+                //
+                // A delimiter.
+                //
+                AddPiece(piece, p);
+                m_next = p + 1;
+                break;
+            }
+        }
+
+        if (m_copied)
+        {
+            m_token = m_buffer;
+        }
+        if (!m_token.Empty() || m_keepBlank)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <math.h>
+#include <stdarg.h>
 #include <iomanip>
 #include <errno.h>
 #include <float.h>    // FLT_DIG and DBL_DIG
@@ -19,18 +20,17 @@
 #include <iterator>
 #include <bitset>
 
-#ifdef __MINGW32__
-//#if defined(__MINGW32__) || (defined(_MSC_VER) && (_MSC_VER < 1300))
-#    include <limits.h>
-#endif
-
-#if defined(__hpux)
-#    include <inttypes.h>
-#endif
-
 #include <Util/ScopedArray.h>
 #include <Util/StringUtil.h>
+#include <Util/StringSearch.h>
+#include <Util/StringTokenizer.h>
+#include <Util/StringCompaction.h>
+#include <Util/Hash.h>
+#include <Util/HexCoding.h>
+#include <Util/Glob.h>
+#include <Util/NumberConversion.h>
 #include <Util/Exception.h>
+#include <Unicoder/CaseMapping.h>
 #include <Build/UsefulMacros.h>
 #include <Build/UndefSysMacros.h>
 
@@ -123,12 +123,7 @@ std::wistream& operator >>(std::wistream& is, Util::String& strret)
     std::wstring wstr;
     is >> wstr;
 
-    StringConverterPtr stringConverter = 
-#    if defined(_WIN32) && !defined(ICONV_ON_WINDOWS)
-        new WindowsStringConverter();
-#    else
-        new IconvStringConverter<char>();
-#    endif
+    StringConverterPtr stringConverter = CreateStringConverter();
 
     strret = Util::UTF8ToNative(stringConverter, Util::WstringToString(wstr));
 
@@ -137,12 +132,7 @@ std::wistream& operator >>(std::wistream& is, Util::String& strret)
 
 std::wostream& operator <<(std::wostream& os, const Util::String& strsrc)
 {
-    StringConverterPtr stringConverter = 
-#    if defined(_WIN32) && !defined(ICONV_ON_WINDOWS)
-        new WindowsStringConverter();
-#    else
-        new IconvStringConverter<char>();
-#    endif
+    StringConverterPtr stringConverter = CreateStringConverter();
 
     // This won't work if the String contains NUL characters.  Unfortunately,
     // std::wostream::write() ignores Format flags, so we cannot use that.
@@ -442,62 +432,12 @@ String::UnescapeString(const string& s, string::size_type start, string::size_ty
 bool
 String::SplitString(const string& str, const string& delim, vector<string>& result, bool keepblank)
 {
-    string::size_type pos = 0;
-    string::size_type length = str.length();
-    string elt;
-
-    char quoteChar = '\0';
-    while (pos < length)
+    StringTokenizer tokens(str, delim, keepblank);
+    while (tokens.Next())
     {
-        if (quoteChar == '\0' && (str[pos] == '"' || str[pos] == '\''))
-        {
-            quoteChar = str[pos++];
-            continue; // Skip the quote
-        }
-        else if (quoteChar == '\0' && str[pos] == '\\' && pos + 1 < length && 
-            (str[pos + 1] == '\'' || str[pos + 1] == '"'))
-        {
-            ++pos;
-        }
-        else if (quoteChar != '\0' && str[pos] == '\\' && pos + 1 < length && str[pos + 1] == quoteChar)
-        {
-            ++pos;
-        }
-        else if (quoteChar != '\0' && str[pos] == quoteChar)
-        {
-            ++pos;
-            quoteChar = '\0';
-            continue; // Skip the end quote
-        }
-        else if (delim.find(str[pos]) != string::npos)
-        {
-            if (quoteChar == '\0')
-            {
-                ++pos;
-                if (elt.length() > 0 || keepblank)
-                {
-                    result.push_back(elt);
-                    elt = "";
-                }
-                continue;
-            }
-        }
-
-        if (pos < length)
-        {
-            elt += str[pos++];
-        }
+        result.push_back(tokens.Token().ToString());
     }
-
-    if (elt.length() > 0 || keepblank)
-    {
-        result.push_back(elt);
-    }
-    if (quoteChar != '\0')
-    {
-        return false; // Unmatched quote.
-    }
-    return true;
+    return tokens.Balanced();
 }
 
 string
@@ -521,16 +461,15 @@ String::JoinString(const std::vector<std::string>& values, const std::string& de
 string
 String::Trim(const string& s)
 {
-    static const string delim = " \t\r\n";
-    string::size_type beg = s.find_first_not_of(delim);
-    if (beg == string::npos)
-    {
-        return "";
-    }
-    else
-    {
-        return s.substr(beg, s.find_last_not_of(delim) - beg + 1);
-    }
+    return TrimWhitespace(s).ToString();
+}
+
+void
+String::TrimInPlace(string& s)
+{
+    StringPiece trimmed = TrimWhitespace(s);
+    s.erase(static_cast<string::size_type>(trimmed.end() - s.data()));
+    s.erase(0, static_cast<string::size_type>(trimmed.begin() - s.data()));
 }
 
 //
@@ -576,59 +515,10 @@ String::ExistQuote(const string& s, string::size_type start)
     return string::npos; // No quote.
 }
 
-//
-// Match `s' against the pattern `pat'. A * in the pattern acts
-// as a wildcard: it matches any non-empty sequence of characters.
-// We match by hand here because it's portable across platforms 
-// (whereas regex() isn't). Only one * per pattern is supported.
-//
 bool
 String::Match(const string& s, const string& pat, bool emptyMatch)
 {
-    assert(!s.empty());
-    assert(!pat.empty());
-
-    //
-    // If pattern does not contain a wildcard just compare strings.
-    //
-    string::size_type beginIndex = pat.find('*');
-    if (beginIndex == string::npos)
-    {
-        return s == pat;
-    }
-
-    //
-    // Make sure start of the strings match
-    //
-    if (beginIndex > s.length() || s.substr(0, beginIndex) != pat.substr(0, beginIndex))
-    {
-        return false;
-    }
-
-    //
-    // Make sure there is something present in the middle to match the
-    // wildcard. If emptyMatch is true, allow a match of "".
-    //
-    string::size_type endLength = pat.length() - beginIndex - 1;
-    if (endLength > s.length())
-    {
-        return false;
-    }
-    string::size_type endIndex = s.length() - endLength;
-    if (endIndex < beginIndex || (!emptyMatch && endIndex == beginIndex))
-    {
-        return false;
-    }
-
-    //
-    // Make sure end of the strings match
-    //
-    if (s.substr(endIndex, s.length()) != pat.substr(beginIndex + 1, pat.length()))
-    {
-        return false;
-    }
-
-    return true;
+    return MatchGlob(s, pat, emptyMatch);
 }
 
 std::string 
@@ -636,10 +526,6 @@ String::TranslatingCR2LF(const std::string& src)
 {
     // Translating both the two-character sequence #xD #xA and any #xD that is not followed by #xA to 
     // a single #xA character.
-
-    // Process the buffer in place to normalize new lines. (See comment above.)
-    // Copies from the 'pread' to 'pwrite' pointer, where pread can advance faster if
-    // a newline-carriage return is hit.
     //
     // Wikipedia:
     // Systems based on ASCII or a compatible character set use either LF  (Line feed, '\n', 0x0A, 10 in decimal) or 
@@ -649,101 +535,52 @@ String::TranslatingCR2LF(const std::string& src)
     //        * CR:    Commodore 8-bit machines, Apple II family, Mac OS up to version 9 and OS-9
 
     std::string result(src);
+    TranslatingCR2LFInPlace(result);
+    return result;
+}
 
-    const char *pread = &result[0];
-    char *pwrite = &result[0];
-    const char *pend = &result[0] + result.size();
-
-    const char CR = 0x0d;
-    const char LF = 0x0a;
-
-    while (pread != pend)
+void
+String::TranslatingCR2LFInPlace(std::string& s)
+{
+    if (!s.empty())
     {
-        assert(pwrite <= pread);
-
-        if (CR == *pread)
-        {
-            *pwrite++ = LF;
-            ++pread;
-            if (LF == *pread)
-            {
-                ++pread;
-            }
-        }
-        else
-        {
-            *pwrite++ = *pread++;
-        }
+        s.resize(NormalizeNewlines(&s[0], s.size(), &s[0]));
     }
-
-    result.resize(pwrite - &result[0]);
-
-    return result;
 }
 
 std::string
 String::ToLower(const std::string& s)
 {
-    string result;
-    result.reserve(s.size());
-    for (unsigned int i = 0; i < s.length(); ++i)
-    {
-        if (isascii(s[i]))
-        {
-            result += tolower(static_cast<unsigned char>(s[i]));
-        }
-        else
-        {
-            result += s[i];
-        }
-    }
-    return result;
+    return ToLowerCase(s);
 }
 
 std::string
 String::ToUpper(const std::string& s)
 {
-    string result;
-    result.reserve(s.size());
-    for (unsigned int i = 0; i < s.length(); ++i)
-    {
-        if (isascii(s[i]))
-        {
-            result += toupper(static_cast<unsigned char>(s[i]));
-        }
-        else
-        {
-            result += s[i];
-        }
-    }
-    return result;
+    return ToUpperCase(s);
 }
 
 unsigned long 
 String::Hash(const std::string& s)
 {
-    unsigned long hashCode = s.length();
-    size_t step = (s.length() >> 5) + 1;
-    for (size_t i = s.length(); i >= step; i -= step)
-    {
-        hashCode = hashCode ^ ((hashCode << 5) + ( hashCode >> 2) + (unsigned long)s[i-1]);
-    }
-
-    return hashCode;
+    return static_cast<unsigned long>(HashBytes(s.data(), s.size()));
 }
 
 string
 String::RemoveWhitespace(const std::string& s)
 {
-    string result;
-    for (unsigned int i = 0; i < s.length(); ++ i)
+    string result(s);
+    RemoveWhitespaceInPlace(result);
+    return result;
+}
+
+void
+String::RemoveWhitespaceInPlace(std::string& s)
+{
+    if (!s.empty())
     {
-        if (!isspace(static_cast<unsigned char>(s[i])))
-        {
-            result += s[i];
-        }
+        s.resize(StripWhitespace(&s[0], s.size(), &s[0]));
     }
-    return result;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -762,160 +599,97 @@ static const char digitVal[] =
     30, 31, 32, 33, 34, 35                        // 'U' - 'Z'
 };
 
-#ifdef __MINGW32__
-//#if defined(__MINGW32__) || (defined(_MSC_VER) && (_MSC_VER < 1300))
-
-namespace UtilInternal
+namespace
 {
+
 //
-// The MINGW runtime does not include _strtoi64, so we provide our own implementation
+// strtoull on top of ParseUInt64: skips leading whitespace, a sign and a
+// 0x prefix with base 0 or 16, and sets base from the prefix if it is 0.
+// end is left unchanged if there is no number.
 //
-
-static Util::Int64 strToInt64Impl(const char* s, char** endptr, int base)
+NumberParseResult
+ParseIntegerText(const char* first, const char* last, int& base, bool& negative, uint64& value, const char*& end)
 {
-    //
-    // Assume nothing will be there to convert for now
-    //
-    if (endptr)
+    const char* p = first;
+    while (p != last && isspace(static_cast<unsigned char>(*p)))
     {
-        *endptr = const_cast<char *>(s);
+        ++p;
     }
 
-    //
-    // Skip leading whitespace
-    //
-    while (*s && isspace(static_cast<unsigned char>(*s)))
+    negative = false;
+    if (p != last && (*p == '+' || *p == '-'))
     {
-        ++s;
+        negative = *p == '-';
+        ++p;
     }
 
-    //
-    // Check for sign
-    //
-    int sign = 1;
-    if (*s == '+')
+    if ((base == 0 || base == 16) && last - p >= 3 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X') &&
+        isxdigit(static_cast<unsigned char>(p[2])))
     {
-        ++s;
+        base = 16;
+        p += 2;
     }
-    else if (*s == '-')
+    else if (base == 0)
     {
-        sign = -1;
-        ++s;
+        base = p != last && *p == '0' ? 8 : 10;
     }
 
-    //
-    // Check that base is valid
-    //
-    if (base == 0)
+    value = 0;
+    if (p != last && (*p == '+' || *p == '-'))
     {
-        if (*s == '0')
-        {
-            base = 8;
-            ++s;
-
-            //
-            // We have at least this zero
-            //
-            if (endptr)
-            {
-                *endptr = const_cast<char *>(s);
-            }
-
-            if (*s == 'x' || *s == 'X')
-            {
-                base = 16;
-                ++s;
-            }
-        }
-        else
-        {
-            base = 10;
-        }
+        return numberInvalid;
     }
-    else if (base < 2 || base > 36)
+    NumberParseResult result = ParseUInt64(p, last, value, &p, base);
+    if (result != numberInvalid)
     {
-        errno = EINVAL;
-        return 0;
+        end = p;
     }
+    return result;
+}
+
+}
 
+Util::Int64 
+String::ToInt64(const char* s, char** endptr, int base)
+{
     //
-    // Check that we have something left to parse
+    // Assume nothing will be there to convert for now
     //
-    if (*s == '\0')
+    if (endptr)
     {
-        //
-        // We did not read any new digit so we don't update endptr
-        //
-        return 0;
+        *endptr = const_cast<char*>(s);
     }
 
-    Int64 result = 0;
-    bool overflow = false;
-    bool digitFound = false;
-    const string validDigits(allDigits.begin(), allDigits.begin() + base);
-    while (*s && validDigits.find_first_of(toupper(static_cast<unsigned char>(*s))) != validDigits.npos)
-    {   
-        digitFound = true;
-        if (!overflow)
-        {
-            int digit = digitVal[toupper(static_cast<unsigned char>(*s)) - '0'];
-            assert(digit != 100);
-            if (result < _I64_MAX / base)
-            {
-                result *= base;
-                result += digit;
-            }
-            else if ((digit <= _I64_MAX % base) || (sign == -1 && digit == _I64_MAX % base + 1))
-            {
-                result *= base;
-                result += digit;
-            }
-            else
-            {
-                overflow = true;
-                result = sign == -1 ? _I64_MIN : _I64_MAX;
-            }
-        }
-        ++s;
+    if (base < 0 || base == 1 || base > 36)
+    {
+        errno = EINVAL;
+        return 0;
     }
 
-    if (overflow)
+    const char* end = s;
+    bool negative;
+    uint64 magnitude;
+    NumberParseResult result = ParseIntegerText(s, s + strlen(s), base, negative, magnitude, end);
+    if (endptr)
     {
-        errno = ERANGE;
+        *endptr = const_cast<char*>(end);
     }
-    else
+    if (result == numberInvalid)
     {
-        result *= sign;
+        return 0;
     }
 
-    if (digitFound && endptr != 0)
+    const uint64 limit = (UTIL_UINT64(1) << 63) - (negative ? 0 : 1);
+    if (result == numberOverflow || magnitude > limit)
     {
-        *endptr = const_cast<char *>(s);
+        errno = ERANGE;
+        magnitude = limit;
     }
-
-    return result;
-}
-}
-
-#endif
-
-
-Util::Int64 
-String::ToInt64(const char* s, char** endptr, int base)
-{
-#if defined(_WIN32)
-#   ifdef __MINGW32__
-    return strToInt64Impl(s, endptr, base);
-#   else
-    return _strtoi64(s, endptr, base);
-#   endif
-#elif defined(UTIL_64)
-    return strtol(s, endptr, base);
-#elif defined(__hpux)
-    return __strtoll(s, endptr, base);
-#else
-    return strtoll(s, endptr, base);
-#endif
+    if (negative && magnitude != 0)
+    {
+        return -static_cast<Int64>(magnitude - 1) - 1;
+    }
+    return static_cast<Int64>(magnitude);
 }
 
 bool 
@@ -939,116 +713,53 @@ String::ToULong(const std::string& strval, size_t* endindex, unsigned int base)
         *endindex = 0;
     }
 
-    std::string::const_pointer iter = strval.c_str();
-
-    //
-    // Skip leading whitespace
-    //
-    while (*iter && isspace(static_cast<unsigned char>(*iter)))
+    if (base == 1 || base > 36)
     {
-        ++iter;
+        errno = EINVAL;
+        return 0;
     }
 
-    //
-    // Check for sign
-    //
-    int sign = 1;
-    if ('+' == *iter)
-    {
-        ++iter;
-    }
-    else if ('-' == *iter)
-    {
-        sign = -1;
-        ++iter;
-    }
+    const char* first = strval.c_str();
+    const char* last = first + strval.size();
+    const char* end = first;
+    int numberBase = static_cast<int>(base);
+    bool negative;
+    uint64 value;
+    NumberParseResult result = ParseIntegerText(first, last, numberBase, negative, value, end);
 
     //
-    // Check that base is valid
+    // A decimal number may have a fraction and an exponent, the value is
+    // then rounded to the nearest integer.
     //
-    if (base == 0)
+    if (result != numberInvalid && numberBase == 10 && end != last && (*end == '.' || *end == 'e' || *end == 'E'))
     {
-        if ('0' == *iter)
+        const char* number = first;
+        while (isspace(static_cast<unsigned char>(*number)))
         {
-            base = 8;
-            ++iter;
-
-            //
-            // We have at least this zero
-            //
-            if (endindex)
-            {
-                *endindex = iter - strval.c_str();
-            }
-
-            if ('x' == *iter || 'X' == *iter)
-            {
-                base = 16;
-                ++iter;
-            }
-        }
-        else
-        {
-            base = 10;
+            ++number;
         }
-    }
-    else if (base < 2 || base > 16)    //else if (2 != base && 8 != base && 10 != base && 16 != base)
-    {
-        errno = EINVAL;
-        return 0;
+        double real;
+        ParseDouble(number, last, real, &end);
+        real = fabs(real) + 0.5;
+        result = real < 18446744073709551616.0 ? numberOK : numberOverflow;
+        value = result == numberOK ? static_cast<uint64>(real) : 0;
     }
 
-    int exp = 0;
-    unsigned long result = 0;
-    unsigned value;
-    while (isxdigit(*iter) 
-        && (value = isdigit(*iter) ? *iter - '0' : toupper(*iter) - 'A' + 10) < base)
+    if (endindex)
     {
-        result = result * base + value;
-        ++iter;
+        *endindex = end - first;
     }
 
-    if (10 == base)
-    {
-        if ('.' == *iter)
-        {
-            ++iter;
-            for (int i = -1; isdigit(*iter); --i, ++iter)
-            {
-                result = result *base + (*iter - '0');
-                exp = i;
-            }
-        }
-
-        if ('E' == toupper(*iter))
-        {
-            ++iter;
-            string strexp;
-            strexp.reserve(strval.size() - (iter - strval.c_str()));
-            if ('+' == *iter || '-' == *iter)
-            {
-                strexp += *iter;
-                ++iter;
-            }
-
-            while (isdigit(*iter))
-            {
-                strexp += *iter;
-                ++iter;
-            }
-
-            exp += ToLong(strexp, 0, 10);
-        }
-    }
-
-    if (endindex)
+    //
+    // Like strtoul, an out of range magnitude is ULONG_MAX whatever the sign.
+    //
+    if (result == numberOverflow || value > numeric_limits<unsigned long>::max())
     {
-        *endindex = iter - strval.c_str();
+        errno = ERANGE;
+        return numeric_limits<unsigned long>::max();
     }
-
-    result = static_cast<unsigned long>(result * ::pow(1.0 * base, exp) + 0.5);
-
-    return sign * result;
+    unsigned long magnitude = static_cast<unsigned long>(value);
+    return negative ? 0 - magnitude : magnitude;
 }
 
 long 
@@ -1058,132 +769,47 @@ String::ToLong(const std::string& strval, size_t* endindex, unsigned int base)
 }
 
 double 
-String::ToDouble(const std::string& strval, size_t* endindex, int precision)
+String::ToDouble(const std::string& strval, size_t* endindex, int)
 {
-    //
-    // Assume nothing will be there to convert for now
-    //
-    if (endindex)
-    {
-        *endindex = 0;
-    }
-
-    std::string::const_pointer iter = strval.c_str();
+    const char* first = strval.c_str();
+    const char* last = first + strval.size();
 
     //
     // Skip leading whitespace
     //
-    while (*iter && isspace(static_cast<unsigned char>(*iter)))
-    {
-        ++iter;
-    }
-
-    //
-    // Check for sign
-    //
-    int sign = 1;
-    if ('+' == *iter)
-    {
-        ++iter;
-    }
-    else if ('-' == *iter)
+    const char* iter = first;
+    while (iter != last && isspace(static_cast<unsigned char>(*iter)))
     {
-        sign = -1;
-        ++iter;
-    }
-
-    int exp = 0;
-    double result = 0;    
-    while (isdigit(*iter))
-    {
-        result = result * 10 + *iter - '0';
         ++iter;
     }
 
-    if ('.' == *iter)
+    double result;
+    const char* end;
+    if (ParseDouble(iter, last, result, &end) == numberInvalid)
     {
-        ++iter;
-        for (int i = -1; precision-- && isdigit(*iter); --i, ++iter)
-        {
-            result = result * 10 + (*iter - '0');
-            exp = i;
-        }
-    }
-
-    if ('E' == toupper(*iter))
-    {
-        ++iter;
-        string strexp;
-        strexp.reserve(strval.size() - (iter - strval.c_str()));
-        if ('+' == *iter || '-' == *iter)
-        {
-            strexp += *iter;
-            ++iter;
-        }
-
-        while (isdigit(*iter))
-        {
-            strexp += *iter;
-            ++iter;
-        }
-
-        exp += ToLong(strexp, 0, 10);
+        end = first;
     }
 
     if (endindex)
     {
-        *endindex = iter - strval.c_str();
+        *endindex = end - first;
     }
 
-    result *= ::pow(10.0, exp);
-
-    return sign * result;
+    return result;
 }
 
 std::string 
 String::ToString(unsigned long n)
 {
-    string s;
-    size_t size = sizeof(unsigned long) * 8;
-    s.resize(size);
-    string::size_type charPos = size;
-
-    do
-    {
-        s[--charPos] = n % 10 + '0';
-        n /= 10;
-    }while (0 != n);
-
-    return string(s, charPos, (size - charPos));
+    char buffer[maxInt64Size];
+    return string(buffer, FormatUInt64(n, buffer));
 }
 
 std::string 
 String::ToString(long n)
 {
-    string s;
-    size_t size = sizeof(unsigned long) * 8;
-    s.resize(size);
-    string::size_type charPos = size;
-
-    bool negative = false;
-    if (n < 0)
-    {
-        n = -n;
-        negative = true;
-    }
-
-    do
-    {
-        s[--charPos] = n % 10 + '0';
-        n /= 10;
-    }while (0 != n);
-
-    if (negative)
-    {
-        s[--charPos] = '-';
-    }
-
-    return string(s, charPos, (size - charPos));
+    char buffer[maxInt64Size];
+    return string(buffer, FormatInt64(n, buffer));
 }
 
 bool 
@@ -1383,106 +1009,49 @@ String::FindStringInBuffer(Util::Byte* buffer, size_t buffsize, const std::strin
         return NULL;
     }
 
-    for (size_t i = 0; i < buffsize; ++i)
-    {
-        size_t curindex = i;
-        const char *search = strtosearch.c_str();
-
-        while (*search && curindex < buffsize && *search == buffer[curindex])
-        {
-            ++curindex;
-            ++search;
-        }
-
-        if (!*search)
-        {
-            return buffer + i;
-        }
-    }
-
-    return NULL;
+    return FindBytes(buffer, buffsize, strtosearch.data(), strtosearch.length());
 }
 
 string 
 String::BytesToString(const Byte* src, size_t size)
 {
-    const Byte* end(src + size);
-#if 0
-    ostringstream s;
-    for (; src != end; ++src)
-    {
-        s << setw(2) << setfill('0') << hex << static_cast<int>(*src);
-    }
-
-    return s.str();
-
-#else
-
-    static const char* toHex = "0123456789abcdef";
-
     string s;
     s.resize(size * 2);
-
-    for (unsigned int i = 0 ; src != end; ++src, ++i)
+    if (size != 0)
     {
-        s[i * 2] = toHex[(*src >> 4) & 0xf];
-        s[i * 2 + 1] = toHex[*src & 0xf];
+        EncodeHex(src, size, &s[0]);
     }
-
     return s;
-#endif
 }
 
 string
 String::BytesToString(const ByteSeq& bytes)
 {
-    return BytesToString(&*bytes.begin(), bytes.size());
-
-#if 0
-    ostringstream s;
-    for (ByteSeq::const_iterator p = bytes.begin(); p != bytes.end(); ++p)
-    {
-        s << setw(2) << setfill('0') << hex << static_cast<int>(*p);
-    }
-
-    return s.str();
-
-    //#else
-
-    static const char* toHex = "0123456789abcdef";
-
-    string s;
-    s.resize(bytes.size() * 2);
-
-    for (unsigned int i = 0; i < bytes.size(); ++i)
-    {
-        s[i * 2] = toHex[(bytes[i] >> 4) & 0xf];
-        s[i * 2 + 1] = toHex[bytes[i] & 0xf];
-    }
-
-    return s;
-#endif
-
+    return BytesToString(bytes.empty() ? 0 : &bytes[0], bytes.size());
 }
 
 ByteSeq
 String::StringToBytes(const string& str)
 {
-    ByteSeq bytes;
-    bytes.reserve((str.size() + 1) / 2);
-
-    for(unsigned int i = 0; i + 1 < str.size(); i += 2)
+    ByteSeq bytes(str.size() / 2);
+    if (bytes.empty())
     {
-        int byte = 0;
-#if 0
+        return bytes;
+    }
 
-        istringstream is(str.substr(i, 2));
-        is >> hex >> byte;
+    const char* data;
+    size_t i = DecodeHex(str.data(), str.size(), &bytes[0], &data);
 
-#else
+    //
+    // After a pair that is not hex, characters that are not hex digits
+    // count as 0.
+    //
+    for (; i < bytes.size(); ++i, data += 2)
+    {
+        int byte = 0;
         for(int j = 0; j < 2; ++j)
         {
-            char c = str[i + j];
+            char c = data[j];
 
             if(c >= '0' && c <= '9')
             {
@@ -1502,8 +1071,7 @@ String::StringToBytes(const string& str)
                 byte <<= 4;
             }
         }
-#endif
-        bytes.push_back(static_cast<Byte>(byte));
+        bytes[i] = static_cast<Byte>(byte);
     }
 
     return bytes;
@@ -1521,45 +1089,13 @@ String::HexDumpLine(const void* ptr, size_t offset, size_t size, std::string& li
     // 1*linelength: characters
     // 1: "|"
     // Total: 19 + linelength * (1 + 2 + 1)
-    line.clear();
-    line.reserve(19 + linelength * (1 + 2 + 1));
+    // (FormatHexDumpLine in HexCoding.h), longer if the address needs more
+    // than 8 digits.
     const Util::Byte* srcstr = reinterpret_cast<const Util::Byte*>(ptr) + offset;
     size_t length = std::min(size - offset, linelength);
 
-    std::ostringstream out;
-    out << std::hex << std::uppercase;
-    out << '[';
-    out.width(8);
-    out.fill('0');
-    out << offset << "h]: ";
-
-    for (size_t i = 0; i < length; ++i)
-    {
-        if (i == linelength / 2)
-        {
-            out << ' ';
-        }
-
-        out.width(2);
-        out.fill('0');
-        out << (srcstr[i] & 0x00ff) << ' ';
-    }
-
-    // 3 spaces for each byte we're not printing, one separating the halves
-    // if necessary
-    out << string(3 * (linelength - length) + (length <= linelength / 2), ' ');
-    out << "   |";
-    line.append(out.str());
-
-    for (size_t i = 0; i < length; i++) 
-    {
-        char c = (srcstr[i] >= 32 && srcstr[i] <= 126 ? static_cast<char>(srcstr[i]) : '.');
-        line.append(1, c);
-    }
-    line.append(linelength - length, ' ');
-    line.push_back('|');
-
-    assert(line.size() == 19 + linelength * 4); 
+    line.resize(HexDumpLineCapacity(linelength));
+    line.resize(FormatHexDumpLine(srcstr, length, offset, linelength, &line[0]));
 
     return length;
 }
@@ -1567,9 +1103,13 @@ String::HexDumpLine(const void* ptr, size_t offset, size_t size, std::string& li
 std::string 
 String::HexDump(const void* ptr, size_t size, size_t linelength) 
 {
-    std::ostringstream os;
-    HexDump(ptr, size, std::ostream_iterator<const char*>(os, "\n"), linelength);
-    return os.str();
+    std::string dump;
+    if (linelength != 0)
+    {
+        dump.reserve((size + linelength - 1) / linelength * (20 + linelength * 4));
+    }
+    WriteHexDump(ptr, size, std::back_inserter(dump), linelength);
+    return dump;
 }
 
 std::string 
@@ -1595,7 +1135,7 @@ String::HexStringToBuffer(const string &hexString, string &buffer, const std::st
         data += pos + 3;
     }
 
-    while ('\0' != data)
+    while ('\0' != *data)
     {
         if (string::npos != IFS.find(*data))
         {
@@ -1618,7 +1158,7 @@ String::HexStringToBuffer(const string &hexString, string &buffer, const std::st
             ++data;
         }
 
-        if ('\0' == data)
+        if ('\0' == *data)
         {
             break;
         }
@@ -1628,30 +1168,37 @@ String::HexStringToBuffer(const string &hexString, string &buffer, const std::st
             data += 2;
         }
 
-        string item;
-        item.reserve(128);        // for performance
+        string::const_pointer item = data;
         while (*data && isxdigit(*data))
         {
-            item.push_back(*data);
             ++data;
         }
 
-        if (0 != item.size() % 2)
+        //
+        // The digits are decoded straight into buffer; an odd number of
+        // them has a leading 0.
+        //
+        size_t first = buffer.size();
+        if (0 != (data - item) % 2)
         {
-            item = '0' + item;
+            char pair[2] = { '0', *item++ };
+            Byte byte;
+            DecodeHex(pair, 2, &byte);
+            buffer.push_back(static_cast<char>(byte));
         }
-
-        string::const_iterator citer = item.begin();
-
-        while (item.end() != citer)
+        size_t count = static_cast<size_t>(data - item) / 2;
+        if (0 != count)
         {
-            unsigned short ucdata;
-            std::stringstream is(string(citer, citer + 2));
-            is >> std::hex >> ucdata;
-            ucdata = (unsigned short)ToULong(string(citer, citer + 2), 0, 16);
-            buffer += (char)(sign * ucdata);
+            buffer.resize(buffer.size() + count);
+            DecodeHex(item, 2 * count, reinterpret_cast<Byte*>(&buffer[buffer.size() - count]));
+        }
 
-            citer += 2;
+        if (sign < 0)
+        {
+            for (size_t i = first; i < buffer.size(); ++i)
+            {
+                buffer[i] = (char)(-(int)(Byte)buffer[i]);
+            }
         }
     }
 
@@ -1986,8 +1533,8 @@ bool CStringEquals(const char * lhs, const char * rhs)
     return 0 == strcmp(lhs, rhs);
 }
 
-// Compares two C strings, ignoring case.  Returns true iff they have
-// the same content.
+// Compares two UTF8 C strings, ignoring case with full Unicode case
+// folding.  Returns true iff they have the same content.
 //
 // Unlike strcasecmp(), this function can handle NULL argument(s).  A
 // NULL C string is considered different to any non-NULL C string,
@@ -2002,7 +1549,7 @@ bool CaseInsensitiveCStringEquals(const char * lhs, const char * rhs)
     {
         return false;
     }
-    return 0 == stricmp(lhs, rhs);
+    return 0 == CompareCaseInsensitive(lhs, lhs + strlen(lhs), rhs, rhs + strlen(rhs));
 }
 
 // Compares two wide C strings, ignoring case.  Returns true iff they
@@ -2062,34 +1609,58 @@ bool EndsWithCaseInsensitive(const std::string& str, const std::string& suffix)
 static string 
 formatImpl( const char* format, va_list arglist)
 {
-    va_list tmpvarlist = arglist;
-
     if (NULL == format)
     {
         return "";
     }
 
+    //
+    // Most strings fit in the stack buffer and are formatted once. A
+    // va_list cannot be used again once passed to vsnprintf, a copy is
+    // kept for the second pass.
+    //
+    va_list tmpvarlist;
+    VA_COPY(tmpvarlist, arglist);
+
     // MSVC 8 deprecates vsnprintf(), so we want to suppress warning
     // 4996 (deprecated function) there.
 #ifdef _MSC_VER  // We are using MSVC.
 # pragma warning(push)          // Saves the current warning state.
 # pragma warning(disable:4996)  // Temporarily disables warning 4996.
-
-    const int size = vsnprintf(NULL, 0, format, tmpvarlist);
-
-# pragma warning(pop)           // Restores the warning state.
-#else  // We are not using MSVC.
-    const int size = vsnprintf(NULL, 0, format, tmpvarlist);
 #endif  // _MSC_VER
 
-    if(size < 0)
+    char buffer[256];
+    int size = vsnprintf(buffer, sizeof(buffer), format, tmpvarlist);
+    va_end(tmpvarlist);
+
+#ifdef _MSC_VER
+    //
+    // Before VC14 vsnprintf returns -1 instead of the size of the output
+    // when it does not fit, _vscprintf gives that size.
+    //
+    if (size < 0)
     {
-        return "";
+        VA_COPY(tmpvarlist, arglist);
+        size = _vscprintf(format, tmpvarlist);
+        va_end(tmpvarlist);
     }
+#endif
 
     string str;
-    str.resize(size);
-    vsprintf((char*)str.c_str(), format, arglist);
+    if (size >= static_cast<int>(sizeof(buffer)))
+    {
+        str.resize(size + 1);
+        vsnprintf(&str[0], size + 1, format, arglist);
+        str.resize(size);
+    }
+    else if (size > 0)
+    {
+        str.assign(buffer, size);
+    }
+
+#ifdef _MSC_VER
+# pragma warning(pop)           // Restores the warning state.
+#endif  // _MSC_VER
 
     return str;
 }
@@ -2113,68 +1684,21 @@ Format( const char* format, ...)
 double 
 String2Double(const string& str)
 {
-    string value(str);
-    double result = 0;
-    double sign = 1;
-    int scale = 0;
-    int exponent = 0;
-    int expsign = 1;
-    int j = 0;
-    int jMax = (int) value.length();
-    if (jMax > 0)
-    {
-        if ('+' == value[j])
-        {
-            j++;
-        }
-        else if ('-' == value[j])
-        {
-            sign = -1;
-            j++;
-        }
-        while (j < jMax && IsDigit(value[j]))
-        {
-            result = result * 10 + (value[j] - '0');
-            j++;
-        }
-        if (j < jMax && value[j] == '.')
-        {
-            j++;
-            while (j < jMax && IsDigit(value[j]))
-            {
-                result = result*10 + (value[j] - '0');
-                scale++;
-                j++;
-            }
-        }
-        if (j < jMax && (value[j] == 'E' || value[j] == 'e'))
-        {
-            j++;
-            if ('+' == value[j])
-            {
-                j++;
-            }
-            else if ('-' == value[j])
-            {
-                expsign = -1;
-                j++;
-            }
-            while (j < jMax && IsDigit(value[j]))
-            {
-                exponent = exponent*10 + (value[j] - '0');
-                j++;
-            }
-            exponent *= expsign;
-        }
-        result = sign * result * pow(10.0, exponent-scale);
-    }
+    double result;
+    ParseDouble(str.data(), str.data() + str.size(), result);
     return result;
 }
 
+string 
+Double2String(double value)
+{
+    char buffer[maxShortestDoubleSize];
+    return string(buffer, FormatDouble(value, buffer));
+}
+
 string 
 Double2String(double value, int precision)
 {
-    string number;
     if (precision < 0)
     {
         precision = 0;
@@ -2184,35 +1708,8 @@ Double2String(double value, int precision)
         precision = 16;
     }
 
-    // Use absolute value locally
-    double localValue = fabs(value);
-    double localFraction = (localValue - floor(localValue)) +(5. * pow(10.0, -precision-1));
-    if (localFraction >= 1)
-    {
-        localValue += 1.0;
-        localFraction -= 1.0;
-    }
-    localFraction *= pow(10.0, precision);
-
-    if (value < 0)
-    {
-        number += "-";
-    }
-
-    number += Format("%.0f", floor(localValue));
-
-    // generate fraction, padding with zero if necessary.
-    if (precision > 0)
-    {
-        number += ".";
-        string fraction = Format("%.0f", floor(localFraction));
-        if (fraction.length() < ((size_t) precision))
-        {
-            number += string(precision - fraction.length(), '0');
-        }
-        number += fraction;
-    }
-
+    string number(maxFixedDoubleSize + precision, '\0');
+    number.resize(FormatDoubleFixed(value, precision, &number[0]));
     return number;
 }
 
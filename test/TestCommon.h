@@ -0,0 +1,32 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+#include <Util/Config.h>
+
+#include <iostream>
+#include <cstdlib>
+
+//
+// The test programs print what they test and abort at the first failed
+// check, so a non-zero exit status means failure.
+//
+
+inline void
+TestFailed(const char* expr, const char* file, unsigned int line)
+{
+    std::cout << "failed!" << std::endl;
+    std::cout << file << ':' << line << ": assertion `" << expr << "' failed" << std::endl;
+    abort();
+}
+
+#define test(ex) ((ex) ? ((void)0) : TestFailed(#ex, __FILE__, __LINE__))
+
+#endif
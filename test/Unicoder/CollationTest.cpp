@@ -0,0 +1,70 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/Collation.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const string precomposed = "\xC3\xA4z";         // U+00E4 LATIN SMALL LETTER A WITH DIAERESIS
+const string decomposed = "a\xCC\x88z";         // U+0061 U+0308 COMBINING DIAERESIS
+
+//
+// Both forms of a-umlaut collate like "ae", and keep their order against
+// the letters around it.
+//
+void
+TestPhonebook(const Collator& collator)
+{
+    test(collator.Compare(precomposed, "aez") == 0);
+    test(collator.Compare(decomposed, "aez") == 0);
+    test(collator.Compare(precomposed, decomposed) == 0);
+    test(collator.Compare(precomposed, "afz") < 0);
+    test(collator.Compare(decomposed, "adz") > 0);
+
+    test(collator.GetSortKey(precomposed) == collator.GetSortKey("aez"));
+    test(collator.GetSortKey(decomposed) == collator.GetSortKey("aez"));
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing tailoring of a precomposed sequence... " << flush;
+    {
+        Collator collator(tertiaryStrength);
+        collator.Tailor("\xC3\xA4", "ae");
+        TestPhonebook(collator);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing tailoring of a decomposed sequence... " << flush;
+    {
+        Collator collator(tertiaryStrength);
+        collator.Tailor("a\xCC\x88", "ae");
+        TestPhonebook(collator);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing default collation... " << flush;
+    {
+        Collator collator(tertiaryStrength);
+        test(collator.Compare(precomposed, decomposed) == 0);
+        test(collator.Compare(precomposed, "aez") != 0);
+        test(collator.Compare(precomposed, "az") > 0);
+        test(collator.Compare(precomposed, "b") < 0);
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
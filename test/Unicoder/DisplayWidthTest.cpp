@@ -0,0 +1,71 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/DisplayWidth.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const string heart = "\xE2\x9D\xA4";            // U+2764, narrow unless followed by U+FE0F
+const string selector = "\xEF\xB8\x8F";         // U+FE0F VARIATION SELECTOR-16
+const string acute = "\xCC\x81";                // U+0301 COMBINING ACUTE ACCENT
+
+//
+// The width reported by ColumnTruncationLength is the width of the prefix.
+//
+size_t
+Truncate(const string& s, size_t columns, size_t& width)
+{
+    size_t size = ColumnTruncationLength(s.data(), s.size(), columns, &width);
+    test(width <= columns);
+    test(width == DisplayWidth(s.substr(0, size)));
+    return size;
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing emoji presentation... " << flush;
+    {
+        test(DisplayWidth(heart) == 1);
+        test(DisplayWidth(heart + selector) == 2);
+        test(DisplayWidth("a" + heart + selector + "b") == 4);
+
+        size_t width;
+        test(Truncate(heart + selector, 1, width) == 0 && width == 0);
+        test(Truncate("ab" + heart + selector, 3, width) == 2 && width == 2);
+        test(Truncate("ab" + heart + selector, 4, width) == 8 && width == 4);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing U+FE0F after another character... " << flush;
+    {
+        //
+        // U+FE0F only widens the character right before it.
+        //
+        test(DisplayWidth(heart + "a\t" + selector) == 2);
+        test(DisplayWidth(heart + "\t" + selector) == 1);
+        test(DisplayWidth(heart + acute + selector) == 1);
+        test(DisplayWidth(heart + "\xC2\x85" + selector) == 1);        // U+0085, a C1 control
+
+        size_t width;
+        string s = heart + "a\t" + selector;
+        test(Truncate(s, 2, width) == s.size() && width == 2);
+        test(Truncate(s, 1, width) == heart.size() && width == 1);
+        test(PadToColumns(s, 3) == s + " ");
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
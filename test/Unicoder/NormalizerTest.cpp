@@ -0,0 +1,87 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/Normalizer.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const NormalizationForm forms[] = { NFC, NFD, NFKC, NFKD };
+
+template<typename stringT>
+void
+TestIllFormed(const stringT& str, ConversionErrorType error)
+{
+    for (size_t i = 0; i < sizeof(forms) / sizeof(forms[0]); ++i)
+    {
+        try
+        {
+            IsNormalized(str, forms[i], strictConversion);
+            test(false);
+        }
+        catch (const UTFConversionException& ex)
+        {
+            test(ex.ConversionError() == error);
+        }
+
+        try
+        {
+            Normalize(str, forms[i], strictConversion);
+            test(false);
+        }
+        catch (const UTFConversionException& ex)
+        {
+            test(ex.ConversionError() == error);
+        }
+
+        //
+        // Leniently, both decode the input the same way.
+        //
+        test(IsNormalized(str, forms[i]) == (Normalize(str, forms[i]) == str));
+        test(IsNormalized(Normalize(str, forms[i]), forms[i]));
+    }
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing ill-formed UTF-8... " << flush;
+    {
+        test(!IsNormalized(string("e\xCC"), NFC));      // replaced by U+FFFD
+        TestIllFormed(string("e\xCC"), partialCharacter);           // truncated U+0301
+        TestIllFormed(string("a\xED\xA0\x80" "b"), badEncoding);    // lone surrogate U+D800
+        TestIllFormed(string("\xC3\xA9\xFF"), badEncoding);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing ill-formed wide strings... " << flush;
+    {
+        wstring surrogate(L"a");
+        surrogate += static_cast<wchar_t>(0xD800);
+        surrogate += L"b";
+        TestIllFormed(surrogate, badEncoding);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing well-formed input in strict mode... " << flush;
+    {
+        test(IsNormalized(string("\xC3\xA9"), NFC, strictConversion));
+        test(!IsNormalized(string("e\xCC\x81"), NFC, strictConversion));
+        test(Normalize(string("e\xCC\x81"), NFC, strictConversion) == "\xC3\xA9");
+        test(IsNormalized(string("e\xCC\x81"), NFD, strictConversion));
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Unicoder/StringConverter.h>
+#include <Unicoder/Unicode.h>
+#include <TestCommon.h>
+
+#include <cstring>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+bool
+IsLegal(const char* s)
+{
+    const Byte* p = reinterpret_cast<const Byte*>(s);
+    return IsLegalUTF8Sequence(p, p + strlen(s));
+}
+
+bool
+Copied(const StringConverterPtr& converter, const string& s)
+{
+    try
+    {
+        string copy = s;
+        NativeToUTF8InPlace(converter, copy);
+        test(copy == s);
+        test(NativeToUTF8(converter, s) == s);
+        return true;
+    }
+    catch (const StringConversionException&)
+    {
+        return false;
+    }
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing IsLegalUTF8Sequence... " << flush;
+    {
+        test(IsLegal("plain ASCII"));
+        test(IsLegal("\xC3\xA9\xED\x9F\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF"));
+        test(!IsLegal("\xC0\x80"));                 // overlong
+        test(!IsLegal("\xE0\x80\x80"));             // overlong
+        test(!IsLegal("\xED\xA0\x80"));             // surrogate
+        test(!IsLegal("\xF4\x90\x80\x80"));         // above U+10FFFF
+        test(!IsLegal("\xC3"));                     // truncated
+
+        //
+        // A lead byte followed by ASCII is not a character, after 0xED and
+        // 0xF4 too.
+        //
+        test(!IsLegal("\xED\x61\xA9"));
+        test(!IsLegal("\xF4\x41\x80\x80"));
+        test(!IsLegal("\xE1\x61\x80"));
+        test(!IsLegal("\xF1\x41\x80\x80"));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing the UTF-8 identity converter... " << flush;
+    {
+        StringConverterPtr converter = new UTF8StringConverter;
+        test(Copied(converter, "caf\xC3\xA9"));
+        test(!Copied(converter, "\xED\x61\xA9"));
+        test(!Copied(converter, "\xF4\x41\x80\x80"));
+        test(!Copied(converter, "\xED\xA0\x80"));
+
+        StringConverterPtr trusting = new UTF8StringConverter(false);
+        test(Copied(trusting, "\xED\x61\xA9"));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing conversion to a wide string... " << flush;
+    {
+        const string text = "caf\xC3\xA9";
+        const Byte* source = reinterpret_cast<const Byte*>(text.data());
+        const Byte* sourceEnd = source + text.size();
+        wstring target = L"unchanged";
+        test(UtilInternal::ConvertUTF8ToUTFWstring(source, sourceEnd, target, strictConversion) ==
+             UtilInternal::conversionOK);
+        test(target == L"caf\x00E9");
+        test(source == sourceEnd);
+
+        //
+        // sourceStart stops at the problem, target is left alone.
+        //
+        const string partial = "ab\xC3";
+        source = reinterpret_cast<const Byte*>(partial.data());
+        sourceEnd = source + partial.size();
+        test(UtilInternal::ConvertUTF8ToUTFWstring(source, sourceEnd, target, strictConversion) ==
+             UtilInternal::sourceExhausted);
+        test(target == L"caf\x00E9");
+        test(source == reinterpret_cast<const Byte*>(partial.data()) + 2);
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,72 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/CsvParser.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+bool
+ValidUTF8(const string& text)
+{
+    CsvParser parser(',', true);
+    CsvBatch batch;
+    test(parser.Parse(text.data(), text.size(), batch) == text.size());
+    return batch.ValidUTF8();
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing parsing... " << flush;
+    {
+        string text = "a,'b,c',\"d\\\"e\"\n1,2,3\n";
+        CsvParser parser;
+        CsvBatch batch;
+        test(parser.Parse(text.data(), text.size(), batch) == text.size());
+        test(batch.RecordCount() == 2 && batch.ColumnCount() == 3);
+        test(batch.Field(0, 1) == "b,c");
+        test(batch.Field(0, 2) == "d\"e");
+        test(batch.Field(1, 2) == "3");
+        test(batch.Balanced());
+    }
+    cout << "ok" << endl;
+
+    cout << "testing UTF-8 validation... " << flush;
+    {
+        //
+        // Each text is checked alone and past the first 64-byte block.
+        //
+        const string padding(70, 'x');
+        const char* valid[] = { "caf\xC3\xA9", "\xED\x9F\xBF", "\xF4\x8F\xBF\xBF", "\xF0\x9F\x98\x80" };
+        const char* invalid[] =
+        {
+            "\xC3", "\xC0\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+            "\xED\x61\xA9", "\xF4\x41\x80\x80", "\xE1\x61\x80"
+        };
+        for (size_t i = 0; i < sizeof(valid) / sizeof(valid[0]); ++i)
+        {
+            test(ValidUTF8(string("a,") + valid[i] + "\n"));
+            test(ValidUTF8(padding + "," + valid[i] + ",b\n"));
+        }
+        for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i)
+        {
+            test(!ValidUTF8(string("a,") + invalid[i] + "\n"));
+            test(!ValidUTF8(padding + "," + invalid[i] + ",b\n"));
+        }
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
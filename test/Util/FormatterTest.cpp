@@ -0,0 +1,135 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/Formatter.h>
+#include <Util/Exception.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Util;
+
+//
+// The formatter needs variadic templates.
+//
+#if defined(LANG_CPP11) && (!defined(_MSC_VER) || _MSC_VER >= 1800)
+
+namespace
+{
+
+template <typename... Args>
+bool
+Rejected(const char* format, const Args&... args)
+{
+    try
+    {
+        FormatText(format, args...);
+        return false;
+    }
+    catch (const IllegalArgumentException&)
+    {
+    }
+
+    try
+    {
+        FormatText(FormatPattern(format), args...);
+        return false;
+    }
+    catch (const IllegalArgumentException&)
+    {
+    }
+    return true;
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing formatting... " << flush;
+    {
+        test(FormatText("{} of {} bytes", 3, 4u) == "3 of 4 bytes");
+        test(FormatText("{:x} {:X} {:o} {:b}", 255, 255u, 8, 5) == "ff FF 10 101");
+        test(FormatText("{:08.3f}|{:-6}|{:6}", -1.5, "ab", true) == "-001.500|ab    |  true");
+        test(FormatText("{{}} {}", 0.25) == "{} 0.25");
+        test(FormatText(FormatPattern("{:x}-{}"), 26, 'c') == "1a-c");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing malformed formats... " << flush;
+    {
+        test(Rejected("{", 1));
+        test(Rejected("}", 1));
+        test(Rejected("{:q}", 1));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing argument counts... " << flush;
+    {
+        test(Rejected("{} {}", 1));
+        test(Rejected("{}", 1, 2));
+        test(Rejected("no arguments", 1));
+        test(FormatText("no arguments") == "no arguments");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing types that do not fit the argument... " << flush;
+    {
+        test(Rejected("{:x}", 1.5));
+        test(Rejected("{:b}", "text"));
+        test(Rejected("{:x}", true));
+        test(Rejected("{:f}", 1));
+        test(FormatText("{:x}", 0) == "0");
+        test(FormatText("{:f}", 1.0f) == "1.000000");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing negative integers in other bases... " << flush;
+    {
+        test(FormatText("{:x} {:X} {:o} {:b}", -255, -255L, -8, static_cast<signed char>(-5)) == "-ff -FF -10 -101");
+        test(FormatText(FormatPattern("{:x}"), -1) == "-1");
+        test(FormatText("{:06x}", -26) == "-0001a");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing output after an error... " << flush;
+    {
+        string out = "kept";
+        try
+        {
+            FormatTo(out, "{} {:x} {}", "written", 1.5, 2);
+            test(false);
+        }
+        catch (const IllegalArgumentException&)
+        {
+        }
+        test(out == "kept");
+
+        try
+        {
+            FormatTo(out, "{} {}", "written");
+            test(false);
+        }
+        catch (const IllegalArgumentException&)
+        {
+        }
+        test(out == "kept");
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
+
+#else
+
+int
+main(int, char*[])
+{
+    return EXIT_SUCCESS;
+}
+
+#endif
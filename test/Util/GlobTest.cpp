@@ -0,0 +1,80 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/Glob.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+//
+// MatchGlob and GlobPattern must agree.
+//
+bool
+Match(const string& s, const string& pattern, bool emptyStar = true)
+{
+    bool result = MatchGlob(s, pattern, emptyStar);
+    test(GlobPattern(pattern, emptyStar).Match(s) == result);
+    return result;
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing glob patterns... " << flush;
+    {
+        test(Match("abc", "abc"));
+        test(!Match("abc", "ab"));
+        test(Match("abc", "a?c"));
+        test(Match("abc", "a[a-c]c"));
+        test(!Match("abc", "a[!b]c"));
+        test(Match("a]c", "a[]]c"));
+        test(Match("a*c", "a\\*c"));
+        test(!Match("abc", "a\\*c"));
+        test(Match("a[c", "a[c"));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing empty stars... " << flush;
+    {
+        test(Match("ab", "a*b"));
+        test(Match("ab", "a**b"));
+        test(Match("axyzb", "a*b"));
+        test(Match("", "*"));
+        test(Match("abcabc", "*bc*bc"));
+        test(!Match("abcab", "*bc*bc"));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing non-empty stars... " << flush;
+    {
+        test(!Match("ab", "a*b", false));
+        test(Match("axb", "a*b", false));
+        test(!Match("", "*", false));
+
+        //
+        // Each star of a run takes at least one byte.
+        //
+        test(!Match("axb", "a**b", false));
+        test(Match("axyb", "a**b", false));
+        test(Match("axyzb", "a**b", false));
+        test(!Match("ab", "***", false));
+        test(Match("abc", "***", false));
+        test(!Match("axb", "a*?*b", false));
+        test(Match("axyzb", "a*?*b", false));
+        test(GlobPattern("a**b", false).MinSize() == 4);
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
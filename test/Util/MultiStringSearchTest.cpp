@@ -0,0 +1,105 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/MultiStringSearch.h>
+#include <TestCommon.h>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const string sharpS = "\xC3\x9F";              // U+00DF LATIN SMALL LETTER SHARP S, folds to "ss"
+
+vector<string>
+Patterns(const char* first, const char* second = 0)
+{
+    vector<string> patterns(1, first);
+    if (second != 0)
+    {
+        patterns.push_back(second);
+    }
+    return patterns;
+}
+
+bool
+HasMatch(const vector<MultiStringMatch>& matches, size_t i, size_t pattern, uint64 offset, uint64 length)
+{
+    return i < matches.size() && matches[i].pattern == pattern && matches[i].offset == offset &&
+           matches[i].length == length;
+}
+
+//
+// The matches of a scan one byte at a time.
+//
+vector<MultiStringMatch>
+ScanBytes(const MultiStringSearcher& searcher, const string& text)
+{
+    vector<MultiStringMatch> matches;
+    MultiStringSearcher::State state;
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        searcher.Scan(text.data() + i, 1, state, matches);
+    }
+    searcher.Finish(state, matches);
+    return matches;
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing exact matches... " << flush;
+    {
+        MultiStringSearcher searcher(Patterns("he", "she"));
+        vector<MultiStringMatch> matches;
+        searcher.FindAll("ushers", matches);
+        test(matches.size() == 2);
+        test(HasMatch(matches, 0, 1, 1, 3) || HasMatch(matches, 0, 0, 2, 2));
+        test(HasMatch(matches, 1, 1, 1, 3) || HasMatch(matches, 1, 0, 2, 2));
+        test(!searcher.Contains("HE"));
+
+        MultiStringSearcher ascii(Patterns("he"), asciiCaseInsensitiveMatch);
+        test(ascii.Contains("sHE"));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing a folding of several bytes... " << flush;
+    {
+        MultiStringSearcher searcher(Patterns("s"), unicodeCaseInsensitiveMatch);
+        vector<MultiStringMatch> matches;
+        searcher.FindAll(sharpS, matches);
+        test(matches.size() == 1);
+        test(HasMatch(matches, 0, 0, 0, 2));
+        test(ScanBytes(searcher, sharpS).size() == 1);
+
+        matches.clear();
+        searcher.FindAll("S" + sharpS + "s", matches);
+        test(matches.size() == 3);
+        test(HasMatch(matches, 0, 0, 0, 1));
+        test(HasMatch(matches, 1, 0, 1, 2));
+        test(HasMatch(matches, 2, 0, 3, 1));
+
+        //
+        // "ss" spans the two foldings of a single U+00DF, and then the
+        // second half of one with the s after it.
+        //
+        MultiStringSearcher pair(Patterns("ss", "s"), unicodeCaseInsensitiveMatch);
+        matches = ScanBytes(pair, sharpS + "s");
+        test(matches.size() == 4);
+        test(HasMatch(matches, 0, 1, 0, 2));
+        test(HasMatch(matches, 1, 0, 0, 2));
+        test(HasMatch(matches, 2, 0, 0, 3));
+        test(HasMatch(matches, 3, 1, 2, 1));
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/StringMap.h>
+#include <TestCommon.h>
+
+#include <sstream>
+
+using namespace std;
+using namespace Util;
+
+namespace
+{
+
+const size_t keyCount = 1000;
+const size_t churnCount = 100 * 1000;
+
+//
+// Keys of 31 or 32 bytes, too long to be stored in the table itself.
+//
+string
+LongKey(size_t i)
+{
+    ostringstream os;
+    os << "a key too long to be inline " << i;
+    return os.str();
+}
+
+}
+
+int
+main(int, char*[])
+{
+    cout << "testing insertion and removal... " << flush;
+    {
+        StringMap<int> map;
+        test(map.Insert("short", 1));
+        test(map.Insert(LongKey(1), 2));
+        test(!map.Insert("short", 3));
+        test(*map.Find("short") == 1);
+        test(*map.Find(LongKey(1)) == 2);
+        test(map.Find("missing") == 0);
+
+        test(map.Erase("short"));
+        test(!map.Erase("short"));
+        test(map.Size() == 1);
+        test(map.Key(0) == LongKey(1));
+    }
+    cout << "ok" << endl;
+
+    cout << "testing the arena after removals... " << flush;
+    {
+        StringTable table;
+        bool inserted;
+        for (size_t i = 0; i < keyCount; ++i)
+        {
+            table.Insert(LongKey(i), inserted);
+        }
+        size_t live = 0;
+        for (size_t i = 0; i < keyCount; ++i)
+        {
+            live += LongKey(i).size();
+        }
+        size_t initialSize = table.ArenaSize();
+        test(initialSize >= live);
+
+        //
+        // Replace each key in turn with a new one: without compaction the
+        // arena would hold every key ever inserted.
+        //
+        size_t index;
+        for (size_t i = 0; i < churnCount; ++i)
+        {
+            test(table.Erase(LongKey(i), index));
+            table.Insert(LongKey(i + keyCount), inserted);
+            test(inserted);
+            test(table.ArenaSize() <= 3 * initialSize);
+        }
+        test(table.Size() == keyCount);
+        for (size_t i = churnCount; i < churnCount + keyCount; ++i)
+        {
+            size_t found = table.Find(LongKey(i));
+            test(found != StringTable::npos);
+            test(table.Key(found) == LongKey(i));
+        }
+        test(table.Find(LongKey(0)) == StringTable::npos);
+
+        table.Clear();
+        test(table.ArenaSize() == 0);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing stable keys... " << flush;
+    {
+        StringTable table(0, true);
+        bool inserted;
+        StringPiece first = table.Key(table.Insert(LongKey(0), inserted));
+        StringPiece second = table.Key(table.Insert("short", inserted));
+        size_t index;
+        for (size_t i = 1; i < keyCount; ++i)
+        {
+            table.Insert(LongKey(i), inserted);
+            test(table.Erase(LongKey(i), index));
+        }
+        test(first == LongKey(0));
+        test(second == "short");
+        test(table.Key(table.Find(LongKey(0))).Data() == first.Data());
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}
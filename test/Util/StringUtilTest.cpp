@@ -0,0 +1,97 @@
+// **********************************************************************
+//
+// Copyright (c) 2010-2014 Bernard Luo. All rights reserved.
+//
+// <Email: luo (dot) xiaowei (at) hotmail (dot) com>
+//
+// **********************************************************************
+
+#include <Util/StringUtil.h>
+#include <TestCommon.h>
+
+#include <cerrno>
+#include <limits>
+
+using namespace std;
+using namespace Util;
+
+int
+main(int, char*[])
+{
+    const unsigned long maxULong = numeric_limits<unsigned long>::max();
+
+    cout << "testing ToULong... " << flush;
+    {
+        size_t end;
+        errno = 0;
+        test(String::ToULong("  42 apples", &end) == 42 && end == 4 && errno == 0);
+        test(String::ToULong("ff", &end, 16) == 255 && end == 2 && errno == 0);
+        test(String::ToULong("2.5", &end) == 3 && end == 3 && errno == 0);
+        test(String::ToULong("1e3", &end) == 1000 && end == 3 && errno == 0);
+        test(String::ToULong("-1") == maxULong && errno == 0);
+        test(String::ToULong("x", &end) == 0 && end == 0);
+    }
+    cout << "ok" << endl;
+
+    cout << "testing ToULong out of range... " << flush;
+    {
+        size_t end;
+        errno = 0;
+        test(String::ToULong("99999999999999999999999", &end) == maxULong && end == 23);
+        test(errno == ERANGE);
+
+        errno = 0;
+        test(String::ToULong("-99999999999999999999999") == maxULong && errno == ERANGE);
+
+        errno = 0;
+        test(String::ToULong("1.5e30", &end) == maxULong && end == 6);
+        test(errno == ERANGE);
+
+        errno = 0;
+        test(String::ToULong("99999999999999999999999.5") == maxULong && errno == ERANGE);
+
+        errno = 0;
+        test(String::ToULong("18446744073709551616.0") == maxULong && errno == ERANGE);
+
+        if (maxULong == 0xFFFFFFFFUL)
+        {
+            errno = 0;
+            test(String::ToULong("4294967296") == maxULong && errno == ERANGE);
+        }
+    }
+    cout << "ok" << endl;
+
+    cout << "testing Format... " << flush;
+    {
+        test(Format("%d-%s", 42, "x") == "42-x");
+        test(Format("%s", "") == "");
+
+        //
+        // Longer than the stack buffer.
+        //
+        string text(1000, 'a');
+        test(Format("<%s>", text.c_str()) == "<" + text + ">");
+        test(Format("%255s", "b") == string(254, ' ') + "b");
+        test(Format("%256s", "b") == string(255, ' ') + "b");
+    }
+    cout << "ok" << endl;
+
+    cout << "testing Double2String... " << flush;
+    {
+        test(Double2String(0.1) == "0.1");
+        test(Double2String(-2.5) == "-2.5");
+        test(Double2String(1.126, 2) == "1.13");
+        test(Double2String(-3.75, 2) == "-3.75");
+
+        //
+        // The precision is clamped to 0 to 16.
+        //
+        test(Double2String(2.5, -1) == Double2String(2.5, 0));
+        test(Double2String(7.0, -100) == "7");
+        test(Double2String(0.5, 17) == Double2String(0.5, 16));
+        test(Double2String(0.5, 1000000) == "0.5000000000000000");
+    }
+    cout << "ok" << endl;
+
+    return EXIT_SUCCESS;
+}